@@ -0,0 +1,386 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <benchmarks/benchmark.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // number of heap allocations made by the process, counted by the
+    // replacement operator new below; read by the benchmark driver to report
+    // allocations per iteration
+    std::atomic<std::uint64_t> allocation_count(0);
+}
+
+void *
+operator new (std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (void * result = std::malloc(size > 0 ? size : 1))
+    {
+        return result;
+    }
+
+    throw std::bad_alloc();
+}
+
+void *
+operator new[] (std::size_t size)
+{
+    return operator new (size);
+}
+
+void
+operator delete (void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void
+operator delete (void * pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void
+operator delete[] (void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void
+operator delete[] (void * pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+namespace benchmark
+{
+    volatile double sink = 0.0;
+
+    namespace
+    {
+        // number of timed repetitions of each benchmark's run(); the best
+        // repetition is reported, as it carries the least scheduling noise
+        static const unsigned repetitions = 5;
+
+        struct BenchmarksHolder
+        {
+            std::list<const Benchmark *> benchmarks;
+        };
+
+        BenchmarksHolder *
+        holder()
+        {
+            static BenchmarksHolder result;
+
+            return &result;
+        }
+    }
+
+    Benchmark::Benchmark(const std::string & name, const unsigned & iterations) :
+        _name(name),
+        _iterations(iterations)
+    {
+        holder()->benchmarks.push_back(this);
+    }
+
+    Benchmark::~Benchmark() = default;
+
+    const std::string &
+    Benchmark::name() const
+    {
+        return _name;
+    }
+
+    unsigned
+    Benchmark::iterations() const
+    {
+        return _iterations;
+    }
+
+    namespace
+    {
+        /*
+         * Reference timings are stored as one entry per line,
+         *
+         *     <name> <seconds-per-iteration>
+         *
+         * with '#' introducing comments. Names unknown to the baseline are
+         * reported but do not count as regressions, so newly-added
+         * benchmarks do not break 'make benchmark' before the baseline has
+         * been refreshed on the reference host.
+         */
+        std::map<std::string, double>
+        read_baseline(const std::string & file_name)
+        {
+            std::map<std::string, double> result;
+
+            std::ifstream file(file_name);
+            if (! file.good())
+            {
+                std::cerr << "could not open baseline file '" << file_name << "'" << std::endl;
+                std::abort();
+            }
+
+            std::string line;
+            while (std::getline(file, line))
+            {
+                const auto comment = line.find('#');
+                if (std::string::npos != comment)
+                {
+                    line.erase(comment);
+                }
+
+                std::istringstream input(line);
+                std::string name;
+                double seconds;
+                if (input >> name >> seconds)
+                {
+                    result[name] = seconds;
+                }
+            }
+
+            return result;
+        }
+
+        void
+        write_baseline(const std::string & file_name, const std::map<std::string, double> & timings)
+        {
+            std::ofstream file(file_name);
+            if (! file.good())
+            {
+                std::cerr << "could not open baseline file '" << file_name << "' for writing" << std::endl;
+                std::abort();
+            }
+
+            file << "# reference timings in seconds per iteration, one benchmark per line" << std::endl;
+            file << "# refresh with 'make benchmark-baseline' on the reference host" << std::endl;
+            for (const auto & timing : timings)
+            {
+                file.precision(6);
+                file << timing.first << ' ' << std::scientific << timing.second << std::endl;
+            }
+        }
+
+        /*
+         * Counter for last-level cache misses of the calling thread, based on
+         * the kernel's hardware performance counters. The counter degrades
+         * gracefully: on non-Linux hosts, in containers without access to the
+         * perf interface, or on hardware without a suitable event, valid()
+         * returns false and the miss figures are simply omitted from the
+         * report.
+         */
+        class CacheMissCounter
+        {
+            private:
+                int _fd = -1;
+
+            public:
+                CacheMissCounter()
+                {
+#ifdef __linux__
+                    perf_event_attr attributes;
+                    std::memset(&attributes, 0, sizeof(attributes));
+                    attributes.size = sizeof(attributes);
+                    attributes.type = PERF_TYPE_HARDWARE;
+                    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                    attributes.disabled = 1;
+                    attributes.exclude_kernel = 1;
+                    attributes.exclude_hv = 1;
+
+                    _fd = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+#endif
+                }
+
+                ~CacheMissCounter()
+                {
+#ifdef __linux__
+                    if (_fd >= 0)
+                    {
+                        close(_fd);
+                    }
+#endif
+                }
+
+                bool valid() const
+                {
+                    return _fd >= 0;
+                }
+
+                void start() const
+                {
+#ifdef __linux__
+                    if (_fd >= 0)
+                    {
+                        ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+                        ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+                    }
+#endif
+                }
+
+                std::int64_t stop() const
+                {
+#ifdef __linux__
+                    if (_fd >= 0)
+                    {
+                        ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+                        std::int64_t count;
+                        if (sizeof(count) == read(_fd, &count, sizeof(count)))
+                        {
+                            return count;
+                        }
+                    }
+#endif
+                    return -1;
+                }
+        };
+
+        struct Measurement
+        {
+            // wall-clock seconds per iteration of the best repetition
+            double seconds;
+
+            // LLC misses per iteration of the best repetition; negative if unavailable
+            double llc_misses;
+
+            // heap allocations per iteration of the best repetition
+            double allocations;
+        };
+
+        Measurement
+        measure(const Benchmark * benchmark)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            // untimed warm-up pass to populate caches and lazy singletons
+            benchmark->run();
+
+            const CacheMissCounter counter;
+
+            double best = std::numeric_limits<double>::max();
+            std::int64_t best_misses = -1;
+            std::uint64_t best_allocations = 0;
+            for (unsigned r = 0 ; r < repetitions ; ++r)
+            {
+                const std::uint64_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+                counter.start();
+                const auto start = Clock::now();
+                benchmark->run();
+                const auto stop = Clock::now();
+                const std::int64_t misses = counter.stop();
+                const std::uint64_t allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+                const double seconds = std::chrono::duration<double>(stop - start).count();
+                if (seconds < best)
+                {
+                    best = seconds;
+                    best_misses = misses;
+                    best_allocations = allocations;
+                }
+            }
+
+            Measurement result;
+            result.seconds = best / benchmark->iterations();
+            result.llc_misses = (best_misses >= 0) ? double(best_misses) / benchmark->iterations() : -1.0;
+            result.allocations = double(best_allocations) / benchmark->iterations();
+
+            return result;
+        }
+    }
+
+    int
+    run_all(const std::string & baseline_file, const std::string & update_file, const double & tolerance)
+    {
+        std::map<std::string, double> baseline;
+        if (! baseline_file.empty())
+        {
+            baseline = read_baseline(baseline_file);
+        }
+
+        std::map<std::string, double> timings;
+        int regressions = 0;
+
+        for (const auto * benchmark : holder()->benchmarks)
+        {
+            const Measurement measurement = measure(benchmark);
+            const double seconds = measurement.seconds;
+            timings[benchmark->name()] = seconds;
+
+            std::cout.precision(6);
+            std::cout << std::scientific
+                      << "{ \"name\": \"" << benchmark->name() << "\""
+                      << ", \"iterations\": " << benchmark->iterations()
+                      << ", \"seconds_per_iteration\": " << seconds;
+
+            if (measurement.llc_misses >= 0.0)
+            {
+                std::cout << ", \"llc_misses_per_iteration\": " << measurement.llc_misses;
+            }
+
+            std::cout << ", \"allocations_per_iteration\": " << measurement.allocations;
+
+            const auto reference = baseline.find(benchmark->name());
+            if (baseline.end() != reference)
+            {
+                const double ratio = seconds / reference->second;
+                std::cout << ", \"baseline\": " << reference->second
+                          << ", \"ratio\": " << ratio;
+
+                if (ratio > tolerance)
+                {
+                    std::cout << ", \"regression\": true";
+                    ++regressions;
+                }
+            }
+
+            std::cout << " }" << std::endl;
+        }
+
+        if (! update_file.empty())
+        {
+            write_baseline(update_file, timings);
+        }
+
+        return regressions;
+    }
+}
@@ -0,0 +1,89 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_BENCHMARKS_BENCHMARK_HH
+#define EOS_GUARD_BENCHMARKS_BENCHMARK_HH 1
+
+#include <string>
+
+namespace benchmark
+{
+    /*!
+     * Base class for microbenchmarks of individual physics kernels.
+     *
+     * Each benchmark registers itself with the global registry upon
+     * construction, analogously to test::TestCase. The run() method executes
+     * the kernel iterations() times; the driver measures the wall-clock time
+     * of run() and reports the time per iteration.
+     */
+    class Benchmark
+    {
+        private:
+            std::string _name;
+
+            unsigned _iterations;
+
+        public:
+            Benchmark(const std::string & name, const unsigned & iterations);
+
+            virtual ~Benchmark();
+
+            const std::string & name() const;
+
+            unsigned iterations() const;
+
+            virtual void run() const = 0;
+    };
+
+    /*!
+     * Accumulator used by the benchmark bodies to keep their results alive.
+     *
+     * Folding every kernel result into this volatile sink prevents the
+     * compiler from eliding the kernel calls as dead code.
+     */
+    extern volatile double sink;
+
+    /*!
+     * Run all registered benchmarks and emit one JSON object per benchmark
+     * on stdout.
+     *
+     * On Linux hosts with access to the hardware performance counters, each
+     * object additionally reports the last-level cache misses per iteration,
+     * so that working-set reductions can be demonstrated independently of
+     * wall-clock noise. Each object also reports the heap allocations per
+     * iteration, counted by a replacement operator new, so that boxing of
+     * closures and similar hidden copies show up as a deterministic figure.
+     * Only the timings are baselined.
+     *
+     * When baseline_file is non-empty, the measured timings are compared
+     * against the reference timings stored therein; benchmarks exceeding the
+     * reference by more than the given tolerance factor count as regressions.
+     * When update_file is non-empty, the measured timings are written to it
+     * in the baseline format afterwards.
+     *
+     * @param baseline_file Path to a file with reference timings, or an empty string.
+     * @param update_file   Path to which measured timings shall be written, or an empty string.
+     * @param tolerance     Maximal acceptable ratio of measured over reference timing.
+     *
+     * @return The number of regressions, i.e. 0 on success.
+     */
+    int run_all(const std::string & baseline_file, const std::string & update_file, const double & tolerance);
+}
+
+#endif
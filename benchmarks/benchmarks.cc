@@ -0,0 +1,362 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <benchmarks/benchmark.hh>
+#include <eos/maths/complex.hh>
+#include <eos/maths/fast-math.hh>
+#include <eos/maths/integrate.hh>
+#include <eos/maths/multiplepolylog-li22.hh>
+#include <eos/maths/polylog.hh>
+#include <eos/nonlocal-form-factors/charm-loops.hh>
+#include <eos/rare-b-decays/qcdf-integrals.hh>
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/observable_stub.hh>
+#include <eos/utils/parameters.hh>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace benchmark;
+using namespace eos;
+
+namespace
+{
+    /* polylog.cc: dilogarithm and trilogarithm on a grid of complex arguments */
+
+    class PolylogBenchmark :
+        public Benchmark
+    {
+        public:
+            PolylogBenchmark() :
+                Benchmark("maths/polylog", 10000)
+            {
+            }
+
+            virtual void run() const
+            {
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double phi = 6.28 * i / iterations();
+                    const complex<double> z = 0.8 * std::exp(complex<double>(0.0, phi));
+
+                    sink = sink + real(dilog(z)) + real(trilog(z));
+                }
+            }
+    } polylog_benchmark;
+
+    /* multiplepolylog-li22.cc: Li22 via the batched entry point, with arguments
+     * inside the unit polydisc as they arise in the charm-loop weight functions */
+
+    class Li22Benchmark :
+        public Benchmark
+    {
+        public:
+            Li22Benchmark() :
+                Benchmark("maths/multiplepolylog-li22", 1000)
+            {
+            }
+
+            virtual void run() const
+            {
+                static const unsigned n = 16;
+
+                std::vector<complex<double>> x(n), y(n), results(n);
+                for (unsigned j = 0 ; j < n ; ++j)
+                {
+                    const double phi = 6.28 * j / n;
+                    x[j] = 0.7 * std::exp(complex<double>(0.0, phi));
+                    y[j] = 0.5 * std::exp(complex<double>(0.0, -phi));
+                }
+
+                for (unsigned i = 0 ; i < iterations() / n ; ++i)
+                {
+                    li22(x.data(), y.data(), results.data(), n);
+
+                    for (unsigned j = 0 ; j < n ; ++j)
+                    {
+                        sink = sink + real(results[j]);
+                    }
+                }
+            }
+    } li22_benchmark;
+
+    /* integrate.cc: integrate1D with a fresh capturing closure per call, as in
+     * the decay observables; the closure is passed as a FunctionRef view, so
+     * the allocations-per-iteration figure guards against closure boxing
+     * creeping back into the integration interfaces */
+
+    class Integrate1DClosureBenchmark :
+        public Benchmark
+    {
+        public:
+            Integrate1DClosureBenchmark() :
+                Benchmark("maths/integrate1d-closure", 10000)
+            {
+            }
+
+            virtual void run() const
+            {
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double omega = 1.0 + 0.5 * i / iterations();
+
+                    sink = sink + integrate1D([omega] (const double & x) -> double { return std::sin(omega * x) * std::exp(-x); },
+                            64, 0.0, 1.0);
+                }
+            }
+    } integrate1d_closure_benchmark;
+
+    /* charm-loops.cc: the massive two-loop matrix element contribution F_2^(9) */
+
+    class CharmLoopsBenchmark :
+        public Benchmark
+    {
+        public:
+            CharmLoopsBenchmark() :
+                Benchmark("nonlocal-form-factors/charm-loops-f29-massive", 1000)
+            {
+            }
+
+            virtual void run() const
+            {
+                static const double mu = 4.2, m_b = 4.6, m_c = 1.27;
+
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double s = 0.5 + 5.5 * i / iterations();
+
+                    sink = sink + real(CharmLoops::F29_massive(mu, s, m_b, m_c));
+                }
+            }
+    } charm_loops_benchmark;
+
+    /* qcdf-integrals-analytical.cc: the full set of analytical QCDF integrals
+     * for the charm-loop case of B -> K^* l^+ l^- */
+
+    class QCDFIntegralsBenchmark :
+        public Benchmark
+    {
+        public:
+            QCDFIntegralsBenchmark() :
+                Benchmark("rare-b-decays/qcdf-integrals-analytical-charm", 1000)
+            {
+            }
+
+            virtual void run() const
+            {
+                static const double m_c = 1.4, m_B = 5.279, m_V = 0.896, mu = 4.2;
+                static const double a_1_perp = 0.03, a_2_perp = 0.08, a_1_parallel = 0.03, a_2_parallel = 0.08;
+
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double s = 0.5 + 5.5 * i / iterations();
+
+                    const auto results = QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>::dilepton_charm_case(s, m_c, m_B, m_V, mu,
+                            a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+
+                    sink = sink + real(results.j0_perp) + real(results.j0_parallel) + results.j7_perp;
+                }
+            }
+    } qcdf_integrals_benchmark;
+
+    /* fast-math.hh: a mock per-point amplitude cost, once expressed through
+     * std::pow/std::hypot as the amplitude code used to, and once through the
+     * fast-path helpers; the pair quantifies the per-point reduction */
+
+    class PowStdBenchmark :
+        public Benchmark
+    {
+        public:
+            PowStdBenchmark() :
+                Benchmark("maths/amplitude-kernel-pow-std", 100000)
+            {
+            }
+
+            virtual void run() const
+            {
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double s = 1.0 + 18.0 * i / iterations();
+                    const double shat = s / (5.279 * 5.279);
+
+                    const double series = 1.0 + 0.23 * shat + 0.11 * std::pow(shat, 2.0) - 0.05 * std::pow(shat, 3.0);
+                    const double kinematic = std::pow(1.0 - shat, 3.0) * std::pow(s, 2.0);
+
+                    sink = sink + kinematic * series + std::hypot(series, 1.0 - shat);
+                }
+            }
+    } pow_std_benchmark;
+
+    class PowFastBenchmark :
+        public Benchmark
+    {
+        public:
+            PowFastBenchmark() :
+                Benchmark("maths/amplitude-kernel-pow-fast", 100000)
+            {
+            }
+
+            virtual void run() const
+            {
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    const double s = 1.0 + 18.0 * i / iterations();
+                    const double shat = s / (5.279 * 5.279);
+
+                    const double series = horner(shat, 1.0, 0.23, 0.11, -0.05);
+                    const double kinematic = power_of<3>(1.0 - shat) * power_of<2>(s);
+
+                    sink = sink + kinematic * series + stable_hypot(series, 1.0 - shat);
+                }
+            }
+    } pow_fast_benchmark;
+
+    /* log-likelihood.cc: evaluation of a Gaussian block after a parameter
+     * change, including the cache update it triggers */
+
+    class LogLikelihoodBlockBenchmark :
+        public Benchmark
+    {
+        public:
+            LogLikelihoodBlockBenchmark() :
+                Benchmark("statistics/log-likelihood-gaussian-block", 10000)
+            {
+            }
+
+            virtual void run() const
+            {
+                Parameters p = Parameters::Defaults();
+                Kinematics k;
+                ObservablePtr obs(new ObservableStub(p, "mass::b(MSbar)", k));
+                ObservableCache cache(p);
+
+                auto block = LogLikelihoodBlock::Gaussian(cache, obs, +4.2, +4.3, +4.4);
+
+                Parameter mass = p["mass::b(MSbar)"];
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    mass = 4.2 + 0.2 * i / iterations();
+                    cache.update();
+
+                    sink = sink + block->evaluate();
+                }
+            }
+    } log_likelihood_block_benchmark;
+
+    /* parameters.cc: full sweeps over the parameter set, quantifying the
+     * working set of the hot value/generation arrays against a sweep that
+     * also pulls the cold metadata table through the cache. The gap between
+     * the two is the payoff of keeping metadata out of the hot storage; the
+     * reported LLC misses per iteration make it visible directly. */
+
+    class ParametersHotSweepBenchmark :
+        public Benchmark
+    {
+        public:
+            ParametersHotSweepBenchmark() :
+                Benchmark("utils/parameters-hot-sweep", 1000)
+            {
+            }
+
+            virtual void run() const
+            {
+                Parameters p = Parameters::Defaults();
+
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    double sum = 0.0;
+                    for (auto param : p)
+                    {
+                        sum += param.evaluate();
+                    }
+
+                    sink = sink + sum;
+                }
+            }
+    } parameters_hot_sweep_benchmark;
+
+    class ParametersColdSweepBenchmark :
+        public Benchmark
+    {
+        public:
+            ParametersColdSweepBenchmark() :
+                Benchmark("utils/parameters-cold-sweep", 1000)
+            {
+            }
+
+            virtual void run() const
+            {
+                Parameters p = Parameters::Defaults();
+
+                for (unsigned i = 0 ; i < iterations() ; ++i)
+                {
+                    double sum = 0.0;
+                    for (auto param : p)
+                    {
+                        // additionally touch the ranges, which live in the cold side table
+                        sum += param.evaluate() + param.min() + param.max();
+                    }
+
+                    sink = sink + sum;
+                }
+            }
+    } parameters_cold_sweep_benchmark;
+}
+
+int
+main(int argc, char * argv[])
+{
+    std::string baseline_file, update_file;
+    double tolerance = 1.5;
+
+    for (int i = 1 ; i < argc ; ++i)
+    {
+        const std::string argument(argv[i]);
+
+        if (("--baseline" == argument) && (i + 1 < argc))
+        {
+            baseline_file = argv[++i];
+        }
+        else if (("--write-baseline" == argument) && (i + 1 < argc))
+        {
+            update_file = argv[++i];
+        }
+        else if (("--tolerance" == argument) && (i + 1 < argc))
+        {
+            tolerance = std::stod(argv[++i]);
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--baseline FILE] [--write-baseline FILE] [--tolerance FACTOR]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const int regressions = run_all(baseline_file, update_file, tolerance);
+    if (regressions > 0)
+    {
+        std::cerr << regressions << " benchmark(s) regressed beyond the tolerance factor " << tolerance << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
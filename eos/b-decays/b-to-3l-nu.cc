@@ -19,8 +19,17 @@
  */
 
 #include <eos/b-decays/b-to-3l-nu.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace eos
 {
     using std::norm;
@@ -33,12 +42,115 @@ namespace eos
     using std::cos;
     using std::sin;
 
+    namespace
+    {
+        /*
+         * Hadronic current at one (q^2, k^2) point: the four off-shell B->gamma^*
+         * form factors. The leptonic tensor factorizes, so every differential and
+         * integrated observable of this decay is a linear combination of bilinears
+         * in these four values (and the decay constant f_B).
+         */
+        struct BToThreeLeptonsNeutrinoCurrents
+        {
+            complex<double> F_1;
+            complex<double> F_2;
+            complex<double> F_3;
+            complex<double> F_4;
+        };
+
+        /*
+         * Contracts a vector of leptonic coefficients with the hadronic bilinears.
+         * The bilinear basis is shared by the double- and quintuple-differential
+         * rates and the asymmetry numerator; each of them only populates the
+         * coefficients of the structures it receives contributions from.
+         */
+        double contract(const std::array<double, 21> & coefficients, const BToThreeLeptonsNeutrinoCurrents & c, const double & f_B)
+        {
+            const std::array<double, 21> bilinears
+            {
+                norm(c.F_1), norm(c.F_2), norm(c.F_3), norm(c.F_4),
+                real(conj(c.F_2) * c.F_1), real(conj(c.F_3) * c.F_1), real(conj(c.F_4) * c.F_1),
+                real(conj(c.F_3) * c.F_2), real(conj(c.F_4) * c.F_2),
+                imag(conj(c.F_2) * c.F_1), imag(conj(c.F_4) * c.F_1), imag(conj(c.F_4) * c.F_2), imag(conj(c.F_4) * c.F_3),
+                f_B * real(c.F_1), f_B * real(c.F_2), f_B * real(c.F_3), f_B * real(c.F_4),
+                f_B * imag(c.F_2), f_B * imag(c.F_3), f_B * imag(c.F_4),
+                f_B * f_B
+            };
+
+            double result = 0.0;
+            for (unsigned i = 0 ; i < bilinears.size() ; ++i)
+            {
+                result += coefficients[i] * bilinears[i];
+            }
+
+            return result;
+        }
+
+        /*
+         * Cache of the hadronic currents, shared by all decay objects with
+         * identical parameters and options. The angular variables and the
+         * integrated observables all probe the same (q^2, k^2) points, so pooling
+         * the samples lets each point cost one set of form-factor evaluations per
+         * parameter point instead of one per observable.
+         */
+        struct BToThreeLeptonsNeutrinoCurrentCache
+        {
+            Mutex mutex;
+
+            // generation of the parameter set for which the samples are valid
+            std::uint64_t generation = 0;
+
+            std::map<std::pair<double, double>, BToThreeLeptonsNeutrinoCurrents> samples;
+        };
+
+        std::shared_ptr<BToThreeLeptonsNeutrinoCurrentCache>
+        current_cache_for(const Parameters & parameters, const Options & options)
+        {
+            struct Entry
+            {
+                Parameters parameters;
+
+                std::string options;
+
+                std::weak_ptr<BToThreeLeptonsNeutrinoCurrentCache> cache;
+            };
+
+            static Mutex mutex;
+            static std::vector<Entry> entries;
+
+            Lock l(mutex);
+
+            const std::string options_key = options.as_string();
+            for (auto i = entries.begin() ; i != entries.end() ; )
+            {
+                auto cache = i->cache.lock();
+                if (! cache)
+                {
+                    i = entries.erase(i);
+                    continue;
+                }
+
+                if ((! (i->parameters != parameters)) && (i->options == options_key))
+                    return cache;
+
+                ++i;
+            }
+
+            auto cache = std::make_shared<BToThreeLeptonsNeutrinoCurrentCache>();
+            entries.push_back(Entry{ parameters, options_key, cache });
+
+            return cache;
+        }
+    }
+
     /*
      * Decay: B_q^- -> lprime^+ lprime^- l^- nubar, cf. [KKvDZ:2022A]
      */
     template <>
     struct Implementation<BToThreeLeptonsNeutrino>
     {
+        Parameters parameters;
+
         std::shared_ptr<Model> model;
 
         std::shared_ptr<FormFactors<PToGammaOffShell>> form_factors;
@@ -63,9 +175,15 @@ namespace eos
 
         UsedParameter m_l;
 
+        // cache of the hadronic currents, shared with all other decay objects
+        // built on the same parameters and options, cf. current_cache_for();
+        // invalidated whenever any parameter's value changes
+        std::shared_ptr<BToThreeLeptonsNeutrinoCurrentCache> current_cache;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             model(Model::make(o.get("model", "SM"), p, o)),
             form_factors(FormFactorFactory<PToGammaOffShell>::create("B->gamma^*::" + o.get("form-factors", "KKvDZ2022"), p, o)),
             hbar(p["QM::hbar"], u),
@@ -77,7 +195,8 @@ namespace eos
             opt_lprime(o, options, "lprime"),
             m_lprime(p["mass::" + opt_lprime.str()], u),
             opt_l(o, options, "l"),
-            m_l(p["mass::" + opt_l.str()], u)
+            m_l(p["mass::" + opt_l.str()], u),
+            current_cache(current_cache_for(p, o))
         {
             Context ctx("When constructing B->l'l'lnu observable");
 
@@ -90,6 +209,52 @@ namespace eos
             }
         }
 
+        BToThreeLeptonsNeutrinoCurrents currents(const double & q2, const double & k2) const
+        {
+            const std::uint64_t generation = parameters.generation();
+            const std::pair<double, double> key{ q2, k2 };
+
+            {
+                Lock l(current_cache->mutex);
+
+                if (current_cache->generation != generation)
+                {
+                    current_cache->samples.clear();
+                    current_cache->generation = generation;
+                }
+
+                auto i = current_cache->samples.find(key);
+                if (current_cache->samples.end() != i)
+                    return i->second;
+            }
+
+            // compute outside the lock: the cache's sharers are evaluated
+            // concurrently across the thread pool, and each brings its own
+            // form factors
+            const BToThreeLeptonsNeutrinoCurrents currents
+            {
+                form_factors->F_1(q2, k2), form_factors->F_2(q2, k2),
+                form_factors->F_3(q2, k2), form_factors->F_4(q2, k2)
+            };
+
+            {
+                Lock l(current_cache->mutex);
+
+                if (current_cache->generation == generation)
+                {
+                    // bound the cache's size for long scans at fixed parameter values
+                    if (current_cache->samples.size() >= 1024)
+                    {
+                        current_cache->samples.clear();
+                    }
+
+                    current_cache->samples.emplace(key, currents);
+                }
+            }
+
+            return currents;
+        }
+
         /*!
          * differential decay width of 2 kinematic variables
          * q2 is the invariant mass of the off-shell photon in the range 4 m_l'^2 <= q2 <= (m_B - m_l )^2
@@ -103,10 +268,11 @@ namespace eos
             const double m_l_6 = m_l3 * m_l3;
             const double m_lprime_sq = m_lprime * m_lprime;
 
-            const complex<double> F_1 = form_factors->F_1(q2, k2);
-            const complex<double> F_2 = form_factors->F_2(q2, k2);
-            const complex<double> F_3 = form_factors->F_3(q2, k2);
-            const complex<double> F_4 = form_factors->F_4(q2, k2);
+            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
+                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
+            {
+                return 0.0;
+            }
 
             const double prefactor = (power_of<2>(g_fermi * abs(model->ckm_ub())
             * alpha_qed * 4 * M_PI) / (2.0 * power_of<2>(q2)) * (1.0 - m_l_sq / k2)
@@ -181,18 +347,14 @@ namespace eos
             * (power_of<2>(k2) * m_l_sq - k2 * m_l_sq * q2 + k2 * m_B_sq * (- 2 * m_l_sq + q2)
             + m_l_sq * (m_B_4 - m_B_sq * q2 + m_l_sq * q2)));
 
-            const double amp = f11 * norm(F_1) + f22 * norm(F_2) + f33 * norm(F_3)
-            + f44 * norm(F_4) + f12 * real(F_1 * conj(F_2)) + f15 * f_B * real(F_1)
-            + f25 * f_B * real(F_2) + f35 * f_B * real(F_3) + f45 * f_B * real(F_4)
-            + f55 * power_of<2>(f_B);
-
-            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
-                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
-            {
-                return 0.0;
-            }
-
-            return prefactor * amp;
+            return prefactor * contract({
+                    f11, f22, f33, f44,
+                    f12, 0.0, 0.0, 0.0, 0.0,
+                    0.0, 0.0, 0.0, 0.0,
+                    f15, f25, f35, f45,
+                    0.0, 0.0, 0.0,
+                    f55
+                }, currents(q2, k2), f_B);
         }
 
         /*!
@@ -217,10 +379,11 @@ namespace eos
             const double m_l_sq_k2_diff2 = power_of<2>(m_l_sq - k2);
             const double m_B_sq_k2_diff2 = power_of<2>(m_B_sq - k2);
 
-            const complex<double> F_1 = form_factors->F_1(q2, k2);
-            const complex<double> F_2 = form_factors->F_2(q2, k2);
-            const complex<double> F_3 = form_factors->F_3(q2, k2);
-            const complex<double> F_4 = form_factors->F_4(q2, k2);
+            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
+                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
+            {
+                return 0.0;
+            }
 
             const double prefactor = (power_of<2>(g_fermi * abs(model->ckm_ub())
             * alpha_qed * 4 * M_PI) / (2.0 * power_of<2>(q2)) * (1.0 - m_l_sq / k2)
@@ -691,20 +854,14 @@ namespace eos
             - 2 * k2 * (m_B_sq + q2)) * z_w) + k2 * (-m_B_sq + m_l_sq - q2 + sqrt(k4
             + m_B_sq_q2_diff2 - 2 * k2 * (m_B_sq + q2)) * z_w)));
 
-            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
-                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
-            {
-                return 0.0;
-            }
-
-            return prefactor * (f11 * norm(F_1) + f22 * norm(F_2) + f33 * norm(F_3)
-                + f44 * norm(F_4) + f2c1Re * real(conj(F_2) * F_1) + f3c1Re * real(conj(F_3) * F_1)
-                + f4c1Re * real(conj(F_4) * F_1) + f3c2Re * real(conj(F_3) * F_2)
-                + f4c2Re * real(conj(F_4) * F_2) + f2c1Im * imag(conj(F_2) * F_1)
-                + f4c1Im * imag(conj(F_4) * F_1) + f4c2Im * imag(conj(F_4) * F_2)
-                + f4c3Im * imag(conj(F_4) * F_3) + f51Re * f_B * real(F_1) + f52Re * f_B * real(F_2)
-                + f53Re * f_B * real(F_3) + f54Re * f_B * real(F_4) + f52Im * f_B * imag(F_2)
-                + f53Im * f_B * imag(F_3) + f54Im * f_B * imag(F_4) + f55 * power_of<2>(f_B));
+            return prefactor * contract({
+                    f11, f22, f33, f44,
+                    f2c1Re, f3c1Re, f4c1Re, f3c2Re, f4c2Re,
+                    f2c1Im, f4c1Im, f4c2Im, f4c3Im,
+                    f51Re, f52Re, f53Re, f54Re,
+                    f52Im, f53Im, f54Im,
+                    f55
+                }, currents(q2, k2), f_B);
         }
 
         /*!
@@ -745,7 +902,10 @@ namespace eos
             std::array<double, 2> x_min{ q2_min, k2_min };
             std::array<double, 2> x_max{ q2_max, k2_max };
 
-            return integrate(integrand, x_min, x_max, config_cubature);
+            // reuse the subdivision across successive calls with slowly varying parameters
+            static thread_local cubature::WarmStart warm_start;
+
+            return integrate(integrand, x_min, x_max, warm_start, config_cubature);
         }
 
         double _asymmetry_numerator(const double & q2,const double & k2) const
@@ -755,10 +915,11 @@ namespace eos
             const double m_l_sq = m_l * m_l, m_lprime_sq = m_lprime * m_lprime;
             const double m_l_sq_k2_diff2 = power_of<2>(m_l_sq - k2);
 
-            const complex<double> F_1 = form_factors->F_1(q2, k2);
-            const complex<double> F_2 = form_factors->F_2(q2, k2);
-            const complex<double> F_3 = form_factors->F_3(q2, k2);
-            const complex<double> F_4 = form_factors->F_4(q2, k2);
+            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
+                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
+            {
+                return 0.0;
+            }
 
             const double prefactor = (power_of<2>(g_fermi * abs(model->ckm_ub())
             * alpha_qed * 4 * M_PI) / (2.0 * power_of<2>(q2)) * (1.0 - m_l_sq / k2)
@@ -813,16 +974,14 @@ namespace eos
             / (3. * (- k2 + m_B_sq) * (k2 - m_l_sq) * ((k2 + m_l_sq) * (- k2 + m_B_sq - q2) + 2 * k2
             * q2) * (power_of<2>(- k2 + m_B_sq) * m_l_sq + (k2 - m_l_sq) * (m_B_sq - m_l_sq) * q2));
 
-            if ( power_of<2>(m_B - m_l) < q2 || q2 < 4 * m_lprime_sq
-                || power_of<2>(m_B - sqrt(q2)) < k2 || k2 < m_l_sq )
-            {
-                return 0.0;
-            }
-
-            return prefactor * (g13 * real(conj(F_3) * F_1) + g14 * real(conj(F_4) * F_1)
-                + g23 * real(conj(F_3) * F_2) + g24 * real(conj(F_4) * F_2)
-                + g15 * real(F_1) * f_B + g25 * real(F_2) * f_B + g35 * real(F_3) * f_B
-                + g45 * real(F_4) * f_B + g55 * power_of<2>(f_B));
+            return prefactor * contract({
+                    0.0, 0.0, 0.0, 0.0,
+                    0.0, g13, g14, g23, g24,
+                    0.0, 0.0, 0.0, 0.0,
+                    g15, g25, g35, g45,
+                    0.0, 0.0, 0.0,
+                    g55
+                }, currents(q2, k2), f_B);
         }
 
         double double_differential_forward_backward_asymmetry(const double & q2,const double & k2) const
@@ -852,7 +1011,10 @@ namespace eos
             std::array<double, 2> x_min{ q2_min, k2_min };
             std::array<double, 2> x_max{ q2_max, k2_max };
 
-            return integrate(integrand, x_min, x_max, config_cubature)
+            // reuse the subdivision across successive calls with slowly varying parameters
+            static thread_local cubature::WarmStart warm_start;
+
+            return integrate(integrand, x_min, x_max, warm_start, config_cubature)
                 / ((hbar/tau_B) * integrated_branching_ratio(q2_min, q2_max, k2_min, k2_max));
         }
     };
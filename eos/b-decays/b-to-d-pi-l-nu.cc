@@ -6,10 +6,17 @@
 #include <eos/maths/integrate-impl.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/kinematic.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace eos
 {
     using namespace eos::btovlnu;
@@ -18,9 +25,82 @@ namespace eos
     using std::real;
     using std::sqrt;
 
+    namespace
+    {
+        /*
+         * Transversity amplitudes at one q^2 point; all angular observables of
+         * this decay derive from these four values by bilinear combinations.
+         */
+        struct BToDPiLeptonNeutrinoAmplitudes
+        {
+            double a_long;
+            double a_para;
+            double a_perp;
+            double a_time;
+        };
+
+        /*
+         * Cache of the transversity amplitudes, shared by all decay objects with
+         * identical parameters and options. The angular PDFs each construct their
+         * own decay object but integrate over the same q^2 grid; pooling their
+         * amplitude samples lets every grid point be evaluated exactly once per
+         * parameter point.
+         */
+        struct BToDPiLeptonNeutrinoAmplitudeCache
+        {
+            Mutex mutex;
+
+            // generation of the parameter set for which the samples are valid
+            std::uint64_t generation = 0;
+
+            std::map<double, BToDPiLeptonNeutrinoAmplitudes> samples;
+        };
+
+        std::shared_ptr<BToDPiLeptonNeutrinoAmplitudeCache>
+        amplitude_cache_for(const Parameters & parameters, const Options & options)
+        {
+            struct Entry
+            {
+                Parameters parameters;
+
+                std::string options;
+
+                std::weak_ptr<BToDPiLeptonNeutrinoAmplitudeCache> cache;
+            };
+
+            static Mutex mutex;
+            static std::vector<Entry> entries;
+
+            Lock l(mutex);
+
+            const std::string options_key = options.as_string();
+            for (auto i = entries.begin() ; i != entries.end() ; )
+            {
+                auto cache = i->cache.lock();
+                if (! cache)
+                {
+                    i = entries.erase(i);
+                    continue;
+                }
+
+                if ((! (i->parameters != parameters)) && (i->options == options_key))
+                    return cache;
+
+                ++i;
+            }
+
+            auto cache = std::make_shared<BToDPiLeptonNeutrinoAmplitudeCache>();
+            entries.push_back(Entry{ parameters, options_key, cache });
+
+            return cache;
+        }
+    }
+
     template <>
     struct Implementation<BToDPiLeptonNeutrino>
     {
+        Parameters parameters;
+
         // model
         SwitchOption opt_model;
         std::shared_ptr<Model> model;
@@ -35,16 +115,23 @@ namespace eos
         // form factors
         std::shared_ptr<FormFactors<PToV>> ff;
 
+        // cache of the transversity amplitudes, shared with all other decay objects
+        // built on the same parameters and options, cf. amplitude_cache_for();
+        // invalidated whenever any parameter's value changes
+        std::shared_ptr<BToDPiLeptonNeutrinoAmplitudeCache> amplitude_cache;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             opt_model(o, "model", { "SM", "CKMScan" }, "SM"),
             model(Model::make(opt_model.value(), p, o)),
             m_B(p["mass::B_d"], u),
             m_Dstar(p["mass::D_d^*"], u),
             opt_l(o, options, "l"),
             m_l(p["mass::" + opt_l.str()], u),
-            ff(FormFactorFactory<PToV>::create("B->D^*::" + o.get("form-factors", "BGJvD2019"), p, o))
+            ff(FormFactorFactory<PToV>::create("B->D^*::" + o.get("form-factors", "BGJvD2019"), p, o)),
+            amplitude_cache(amplitude_cache_for(p, o))
         {
             Context ctx("When constructing B->Dpilnu observable");
 
@@ -113,36 +200,68 @@ namespace eos
             return sqrt(lambda / q2) * ff->a_0(q2);
         }
 
+        BToDPiLeptonNeutrinoAmplitudes amplitudes(const double & q2) const
+        {
+            const std::uint64_t generation = parameters.generation();
+
+            {
+                Lock l(amplitude_cache->mutex);
+
+                if (amplitude_cache->generation != generation)
+                {
+                    amplitude_cache->samples.clear();
+                    amplitude_cache->generation = generation;
+                }
+
+                auto i = amplitude_cache->samples.find(q2);
+                if (amplitude_cache->samples.end() != i)
+                    return i->second;
+            }
+
+            // compute outside the lock: the cache's sharers are evaluated
+            // concurrently across the thread pool, and each brings its own
+            // form factors
+            const BToDPiLeptonNeutrinoAmplitudes amplitudes
+            {
+                a_long(q2), a_para(q2), a_perp(q2), a_time(q2)
+            };
+
+            {
+                Lock l(amplitude_cache->mutex);
+
+                if (amplitude_cache->generation == generation)
+                {
+                    // bound the cache's size for long scans at fixed parameter values
+                    if (amplitude_cache->samples.size() >= 1024)
+                    {
+                        amplitude_cache->samples.clear();
+                    }
+
+                    amplitude_cache->samples.emplace(q2, amplitudes);
+                }
+            }
+
+            return amplitudes;
+        }
+
         double lepton_polarization_numerator(const double & q2) const
         {
             const double nf = pdf_normalization(q2);
 
-            const double m_l2     = m_l() * m_l();
-            const double m_B      = this->m_B(),     m_B2     = m_B     * m_B;
-            const double m_Dstar  = this->m_Dstar(), m_Dstar2 = m_Dstar * m_Dstar;
-            const double p_Dstar  = sqrt(eos::lambda(m_B2, m_Dstar2, q2)) / (2.0 * m_B),
-                         p_Dstar2 = p_Dstar * p_Dstar;
-            const double sqrt_q2  = sqrt(q2);
-
-            const double a_0 = ff->a_0(q2);
-            const double a_1 = ff->a_1(q2);
-            const double a_2 = ff->a_2(q2);
-            const double v   = ff->v(q2);
-
-            // cf. [CJLP2012]
-            const double H_pp = (m_B + m_Dstar) * a_1 - 2.0 * m_B / (m_B + m_Dstar) * p_Dstar * v;
-            const double H_mm = (m_B + m_Dstar) * a_1 + 2.0 * m_B / (m_B + m_Dstar) * p_Dstar * v;
-            const double H_00 = ((m_B2 - m_Dstar2 - q2) * (m_B + m_Dstar) * a_1 - 4.0 * m_B2 * p_Dstar2 * a_2 / (m_B + m_Dstar))
-                              / (2.0 * m_Dstar * sqrt_q2);
-            const double H_0t = 2.0 * m_B * p_Dstar / sqrt_q2 * a_0;
-
-            const double H_pp2 = H_pp * H_pp;
-            const double H_mm2 = H_mm * H_mm;
-            const double H_002 = H_00 * H_00;
-            const double H_0t2 = H_0t * H_0t;
+            const double m_l2 = m_l() * m_l();
+
+            // the helicity amplitudes of [CJLP2012] relate to the transversity basis
+            // via H_++ = (a_para + a_perp) / sqrt(2), H_-- = (a_para - a_perp) / sqrt(2),
+            // H_00 = a_long and H_0t = a_time, so H_++^2 + H_--^2 = a_para^2 + a_perp^2
+            const auto amp = amplitudes(q2);
+
+            const double a_long2 = norm(amp.a_long);
+            const double a_para2 = norm(amp.a_para);
+            const double a_perp2 = norm(amp.a_perp);
+            const double a_time2 = norm(amp.a_time);
 
             // cf. [CJLP2012]], eq. (22), p. 17
-            const double num   = (H_pp2 + H_mm2 + H_002) * (1.0 - m_l2 / (2.0 * q2)) - 3.0 * m_l2 / (2.0 * q2) * H_0t2;
+            const double num   = (a_para2 + a_perp2 + a_long2) * (1.0 - m_l2 / (2.0 * q2)) - 3.0 * m_l2 / (2.0 * q2) * a_time2;
 
             return nf * num;
         }
@@ -151,32 +270,18 @@ namespace eos
         {
             const double nf = pdf_normalization(q2);
 
-            const double m_l2     = m_l() * m_l();
-            const double m_B      = this->m_B(),     m_B2     = m_B     * m_B;
-            const double m_Dstar  = this->m_Dstar(), m_Dstar2 = m_Dstar * m_Dstar;
-            const double p_Dstar  = sqrt(eos::lambda(m_B2, m_Dstar2, q2)) / (2.0 * m_B),
-                         p_Dstar2 = p_Dstar * p_Dstar;
-            const double sqrt_q2  = sqrt(q2);
-
-            const double a_0 = ff->a_0(q2);
-            const double a_1 = ff->a_1(q2);
-            const double a_2 = ff->a_2(q2);
-            const double v   = ff->v(q2);
-
-            // cf. [CJLP2012]
-            const double H_pp = (m_B + m_Dstar) * a_1 - 2.0 * m_B / (m_B + m_Dstar) * p_Dstar * v;
-            const double H_mm = (m_B + m_Dstar) * a_1 + 2.0 * m_B / (m_B + m_Dstar) * p_Dstar * v;
-            const double H_00 = ((m_B2 - m_Dstar2 - q2) * (m_B + m_Dstar) * a_1 - 4.0 * m_B2 * p_Dstar2 * a_2 / (m_B + m_Dstar))
-                              / (2.0 * m_Dstar * sqrt_q2);
-            const double H_0t = 2.0 * m_B * p_Dstar / sqrt_q2 * a_0;
-
-            const double H_pp2 = H_pp * H_pp;
-            const double H_mm2 = H_mm * H_mm;
-            const double H_002 = H_00 * H_00;
-            const double H_0t2 = H_0t * H_0t;
+            const double m_l2 = m_l() * m_l();
+
+            // cf. lepton_polarization_numerator() on the change of basis
+            const auto amp = amplitudes(q2);
+
+            const double a_long2 = norm(amp.a_long);
+            const double a_para2 = norm(amp.a_para);
+            const double a_perp2 = norm(amp.a_perp);
+            const double a_time2 = norm(amp.a_time);
 
             // cf. [CJLP2012]], eq. (22), p. 17
-            const double denom = (H_pp2 + H_mm2 + H_002) * (1.0 + m_l2 / (2.0 * q2)) + 3.0 * m_l2 / (2.0 * q2) * H_0t2;
+            const double denom = (a_para2 + a_perp2 + a_long2) * (1.0 + m_l2 / (2.0 * q2)) + 3.0 * m_l2 / (2.0 * q2) * a_time2;
 
             return nf * denom;
         }
@@ -184,7 +289,7 @@ namespace eos
         double lepton_polarization(const double & q2_min, const double & q2_max) const
         {
             std::function<double (const double &)> integrand_num   = std::bind(&Implementation<BToDPiLeptonNeutrino>::lepton_polarization_numerator,   this, std::placeholders::_1);
-            std::function<double (const double &)> integrand_denom = std::bind(&Implementation<BToDPiLeptonNeutrino>::lepton_polarization_denominator, this, std::placeholders::_1);
+            auto integrand_denom = std::bind(&Implementation<BToDPiLeptonNeutrino>::lepton_polarization_denominator, this, std::placeholders::_1);
             const auto num   = integrate<GSL::QAGS>(integrand_num,   q2_min, q2_max);
             const auto denom = integrate<GSL::QAGS>(integrand_denom, q2_min, q2_max);
 
@@ -195,11 +300,13 @@ namespace eos
         {
             const double nf = pdf_normalization(q2);
 
+            const auto amp = amplitudes(q2);
+
             const double m_l2    = m_l() * m_l();
-            const double a_long2 = norm(a_long(q2));
-            const double a_para2 = norm(a_para(q2));
-            const double a_perp2 = norm(a_perp(q2));
-            const double a_time2 = norm(a_time(q2));
+            const double a_long2 = norm(amp.a_long);
+            const double a_para2 = norm(amp.a_para);
+            const double a_perp2 = norm(amp.a_perp);
+            const double a_time2 = norm(amp.a_time);
 
             const double a = 2.0 * (a_long2 + a_para2 + a_perp2) * (1.0 + m_l2 / (2.0 * q2))
                            + 3.0 * a_time2 * m_l2 / q2;
@@ -212,7 +319,7 @@ namespace eos
             const double q2_min = power_of<2>(m_l());
             const double q2_max = 10.68;
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
+            auto f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
             const double num   = dist_q2(q2);
             const double denom = integrate1D(f, 32, q2_min, q2_max);
 
@@ -233,7 +340,7 @@ namespace eos
             const double q2_abs_min = power_of<2>(m_l());
             const double q2_abs_max = power_of<2>(m_B() - m_Dstar());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
+            auto f = std::bind(&Implementation<BToDPiLeptonNeutrino>::dist_q2, this, std::placeholders::_1);
             const double num   = integrate<GSL::QAGS>(f, q2_min,     q2_max);
             const double denom = integrate<GSL::QAGS>(f, q2_abs_min, q2_abs_max);
 
@@ -254,12 +361,14 @@ namespace eos
         {
             const double nf = pdf_normalization(q2);
 
+            const auto amp = amplitudes(q2);
+
             const double m_l2    = m_l() * m_l();
 
-            const double a_long2 = norm(a_long(q2));
-            const double a_para2 = norm(a_para(q2));
-            const double a_perp2 = norm(a_perp(q2));
-            const double a_time2 = norm(a_time(q2));
+            const double a_long2 = norm(amp.a_long);
+            const double a_para2 = norm(amp.a_para);
+            const double a_perp2 = norm(amp.a_perp);
+            const double a_time2 = norm(amp.a_time);
 
             const double a = (a_para2 + a_perp2) * (1.0 + m_l2 / (2.0 * q2));
             const double b = (2.0 * a_long2 - a_para2 - a_perp2) * (1.0 + m_l2 / (2.0 * q2))
@@ -310,20 +419,17 @@ namespace eos
         {
             const double nf = pdf_normalization(q2);
 
-            const double m_l2         = m_l() * m_l();
+            const auto amp = amplitudes(q2);
 
-            const double a_long       = this->a_long(q2);
-            const double a_para       = this->a_para(q2);
-            const double a_perp       = this->a_perp(q2);
-            const double a_time       = this->a_time(q2);
+            const double m_l2         = m_l() * m_l();
 
-            const double a_long2      = norm(a_long);
-            const double a_para2      = norm(a_para);
-            const double a_perp2      = norm(a_perp);
-            const double a_time2      = norm(a_time);
+            const double a_long2      = norm(amp.a_long);
+            const double a_para2      = norm(amp.a_para);
+            const double a_perp2      = norm(amp.a_perp);
+            const double a_time2      = norm(amp.a_time);
 
-            const double re_para_perp = real(a_para * conj(a_perp));
-            const double re_time_long = real(a_time * conj(a_long));
+            const double re_para_perp = real(amp.a_para * conj(amp.a_perp));
+            const double re_time_long = real(amp.a_time * conj(amp.a_long));
 
             const double a = 2.0 * a_long2 + (a_para2 + a_perp2) * (1.0 + m_l2 / q2)
                            + 2.0 * a_time2 * m_l2 / q2;
@@ -375,21 +481,18 @@ namespace eos
         {
             const double nf = pdf_normalization(q2);
 
-            const double m_l2         = m_l() * m_l();
+            const auto amp = amplitudes(q2);
 
-            const double a_long       = this->a_long(q2);
-            const double a_para       = this->a_para(q2);
-            const double a_perp       = this->a_perp(q2);
-            const double a_time       = this->a_time(q2);
+            const double m_l2         = m_l() * m_l();
 
-            const double a_long2      = norm(a_long);
-            const double a_para2      = norm(a_para);
-            const double a_perp2      = norm(a_perp);
-            const double a_time2      = norm(a_time);
+            const double a_long2      = norm(amp.a_long);
+            const double a_para2      = norm(amp.a_para);
+            const double a_perp2      = norm(amp.a_perp);
+            const double a_time2      = norm(amp.a_time);
 
-//            const double re_para_long = real(a_para * conj(a_long));
-            const double re_para_time = real(a_para * conj(a_time));
-            const double re_perp_long = real(a_perp * conj(a_long));
+//            const double re_para_long = real(amp.a_para * conj(amp.a_long));
+            const double re_para_time = real(amp.a_para * conj(amp.a_time));
+            const double re_perp_long = real(amp.a_perp * conj(amp.a_long));
 
             const double a = 2.0 * a_long2 + 3.0 * a_para2 + a_perp2
                            + m_l2 / q2 * (a_long2 + 2.0 * a_perp2 + 3.0 * a_time2);
@@ -19,17 +19,21 @@
 
 #include <eos/b-decays/b-to-pi-l-x-nu.hh>
 #include <eos/form-factors/form-factors.hh>
-#include <eos/maths/integrate.hh>
+#include <eos/maths/interpolation.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <cstdint>
+
 namespace eos
 {
     template <>
     struct Implementation<BToPiLeptonInclusiveNeutrinos>
     {
+        Parameters parameters;
+
         std::shared_ptr<FormFactors<PToP>> form_factors;
 
         QuarkFlavorOption opt_q;
@@ -51,6 +55,7 @@ namespace eos
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             form_factors(FormFactorFactory<PToP>::create("B->pi::" + o.get("form-factors", "BCL2008"), p, o)),
             opt_q(o, options, "q"),
             m_B(p["mass::B_" + opt_q.str()], u),
@@ -137,6 +142,73 @@ namespace eos
 
             return (a + b * z + c * z2 + (d + e * z) * sqrt(1.0 - z2) * cos(phi));
         }
+
+        /*
+         * Tabulated spectra shared by all s-integrated quantities.
+         *
+         * Every moment of dGamma/ds requires the same form factor
+         * evaluations across the spectrum; integrating each moment with an
+         * adaptive quadrature repeats them per moment and per bin. Instead,
+         * the one- and three-neutrino spectra are tabulated in a single pass
+         * over a uniform s grid once per parameter point, and every
+         * s-integrated quantity is served as an analytic integral of the
+         * cubic spline interpolants. The record is invalidated through the
+         * parameter set's generation counter.
+         */
+        struct SpectralGrid
+        {
+            CubicSpline spectrum_1nu;
+
+            CubicSpline spectrum_3nu;
+        };
+
+        mutable std::shared_ptr<SpectralGrid> grid;
+        mutable std::uint64_t grid_generation;
+
+        const SpectralGrid & spectral_grid() const
+        {
+            const std::uint64_t generation = parameters.generation();
+            if (grid && (generation == grid_generation))
+            {
+                return *grid;
+            }
+
+            // at 400 uniform intervals, the spline's interpolation error lies
+            // well below the numerical precision of the form factor inputs
+            static const std::size_t n_nodes = 401;
+
+            const double s_max = power_of<2>(m_B() - m_pi());
+            const double s_min_3nu = power_of<2>(m_tau());
+
+            std::vector<double> s_1nu(n_nodes), w_1nu(n_nodes);
+            std::vector<double> s_3nu(n_nodes), w_3nu(n_nodes);
+            for (std::size_t i = 0 ; i < n_nodes ; ++i)
+            {
+                s_1nu[i] = s_max * i / double(n_nodes - 1);
+                w_1nu[i] = differential_decay_width_1nu_1var(s_1nu[i]);
+
+                s_3nu[i] = s_min_3nu + (s_max - s_min_3nu) * i / double(n_nodes - 1);
+                w_3nu[i] = differential_decay_width_3nu_1var(s_3nu[i]);
+            }
+
+            grid.reset(new SpectralGrid{
+                CubicSpline(s_1nu, w_1nu),
+                CubicSpline(s_3nu, w_3nu)
+            });
+            grid_generation = generation;
+
+            return *grid;
+        }
+
+        double integrated_decay_width_1nu(const double & s_min, const double & s_max) const
+        {
+            return spectral_grid().spectrum_1nu.integrate(s_min, s_max);
+        }
+
+        double integrated_decay_width_3nu(const double & s_min, const double & s_max) const
+        {
+            return spectral_grid().spectrum_3nu.integrate(s_min, s_max);
+        }
     };
 
     const std::vector<OptionSpecification>
@@ -171,19 +243,13 @@ namespace eos
     double
     BToPiLeptonInclusiveNeutrinos::integrated_decay_width_1nu(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPiLeptonInclusiveNeutrinos>::differential_decay_width_1nu_1var,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max);
+        return _imp->integrated_decay_width_1nu(s_min, s_max);
     }
 
     double
     BToPiLeptonInclusiveNeutrinos::integrated_decay_width_3nu(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPiLeptonInclusiveNeutrinos>::differential_decay_width_3nu_1var,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max);
+        return _imp->integrated_decay_width_3nu(s_min, s_max);
     }
 
     const std::string
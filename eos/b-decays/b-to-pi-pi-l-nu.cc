@@ -19,17 +19,77 @@
 
 #include <eos/b-decays/b-to-pi-pi-l-nu.hh>
 #include <eos/form-factors/form-factors.hh>
+#include <eos/maths/gauss-legendre.hh>
 #include <eos/maths/integrate.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
-#include <gsl/gsl_monte.h>
-#include <gsl/gsl_monte_miser.h>
+#include <algorithm>
+#include <memory>
+#include <utility>
 
 namespace eos
 {
+    namespace
+    {
+        /*!
+         * Tensor-product Gauss-Legendre grid over the (q^2, k^2) plane,
+         * shared by all observables integrated over the same phase-space box.
+         *
+         * The node coordinates and combined weights depend only on the
+         * integration bounds, not on the parameter point, so the grid is built
+         * once per box and reused across MCMC steps. The weights include the
+         * affine jacobians of the mappings from [-1, +1] to the bounds.
+         */
+        struct PiPiQuadratureGrid
+        {
+            static constexpr std::size_t q2_points = 32u;
+            static constexpr std::size_t k2_points = 32u;
+
+            double q2min, q2max, k2min, k2max;
+
+            std::array<double, q2_points> q2_nodes, q2_weights;
+            std::array<double, k2_points> k2_nodes, k2_weights;
+
+            template <std::size_t points_>
+            static void map_rule(std::array<double, points_> & nodes, std::array<double, points_> & weights,
+                    const double & a, const double & b)
+            {
+                using Rule = GaussLegendreRule<points_>;
+
+                const double center    = 0.5 * (a + b);
+                const double halfwidth = 0.5 * (b - a);
+
+                // the tabulated rules list only the positive nodes; mirror them about the center
+                for (std::size_t i = 0 ; i < Rule::nodes.size() ; ++i)
+                {
+                    nodes[2 * i]           = center + halfwidth * Rule::nodes[i];
+                    nodes[2 * i + 1]       = center - halfwidth * Rule::nodes[i];
+                    weights[2 * i]         = halfwidth * Rule::weights[i];
+                    weights[2 * i + 1]     = halfwidth * Rule::weights[i];
+                }
+            }
+
+            PiPiQuadratureGrid(const double & q2min, const double & q2max, const double & k2min, const double & k2max) :
+                q2min(q2min),
+                q2max(q2max),
+                k2min(k2min),
+                k2max(k2max)
+            {
+                map_rule(q2_nodes, q2_weights, q2min, q2max);
+                map_rule(k2_nodes, k2_weights, k2min, k2max);
+            }
+
+            bool matches(const double & q2min, const double & q2max, const double & k2min, const double & k2max) const
+            {
+                return (this->q2min == q2min) && (this->q2max == q2max)
+                    && (this->k2min == k2min) && (this->k2max == k2max);
+            }
+        };
+    }
+
     template <>
     struct Implementation<BToPiPiLeptonNeutrino>
     {
@@ -52,10 +112,8 @@ namespace eos
 
         UsedParameter hbar;
 
-        // GSL elements for MC integration
-        gsl_rng * rng;
-        gsl_monte_function normalized_decay_width_integrand;
-        gsl_monte_miser_state * state;
+        // quadrature grid of the last-used phase-space box, reused between parameter points
+        mutable std::unique_ptr<PiPiQuadratureGrid> grid;
 
         static const std::vector<OptionSpecification> options;
 
@@ -69,9 +127,7 @@ namespace eos
             m_pi(p["mass::pi^" + std::string(opt_q.value() == QuarkFlavor::down ? "+" : "0")], u),
             m_l(p["mass::" + opt_l.str()], u),
             g_fermi(p["WET::G_Fermi"], u),
-            hbar(p["QM::hbar"], u),
-            rng(gsl_rng_alloc(gsl_rng_mt19937)),
-            state(gsl_monte_miser_alloc(3u))
+            hbar(p["QM::hbar"], u)
         {
             Context ctx("When constructing B->pipilnu observable");
 
@@ -79,11 +135,7 @@ namespace eos
             u.uses(*model);
         }
 
-        ~Implementation()
-        {
-            gsl_monte_miser_free(state);
-            gsl_rng_free(rng);
-        }
+        ~Implementation() = default;
 
         // normalized to V_ub = 1
         double normalized_differential_decay_width(const double & q2, const double & k2, const double & z) const
@@ -121,60 +173,82 @@ namespace eos
             return normalized_differential_decay_width(q2, k2, z) * std::norm(model->ckm_ub());
         }
 
-        static double normalized_differential_decay_width_gsl_adapter(double * parameters, size_t dim, void * _imp)
+        const PiPiQuadratureGrid & quadrature_grid(const double & q2min, const double & q2max,
+                const double & k2min, const double & k2max) const
+        {
+            if (! grid || ! grid->matches(q2min, q2max, k2min, k2max))
+            {
+                grid.reset(new PiPiQuadratureGrid(q2min, q2max, k2min, k2max));
+            }
+
+            return *grid;
+        }
+
+        /*
+         * Integrate the normalized decay width over the phase-space box via
+         * tensor-product Gauss-Legendre quadrature on the cached (q^2, k^2)
+         * grid, with the z integrals evaluated per node by a fixed-order rule.
+         * For a zero lower z cut the forward and backward z hemispheres are
+         * accumulated separately from the same grid pass, so that the rate and
+         * the forward-backward asymmetry derive from a single evaluation of
+         * the amplitude tensor. Nodes outside the decay's phase space or below
+         * the dilepton threshold do not contribute; the integrand vanishes
+         * like sqrt(lambda) toward the phase-space boundary, so no node
+         * straddles a discontinuity.
+         */
+        std::pair<double, double> normalized_hemisphere_decay_widths(const double & q2min, const double & q2max,
+                const double & k2min, const double & k2max,
+                const double & zmin, const double & zmax) const
         {
-            if (dim != 3u)
-                throw InternalError("Implemenation<BToPiPiLeptonNeutrino::normalized_differentia_decay_width_gsl_adapter(): wrong number of parameters!");
+            const auto & grid = quadrature_grid(q2min, q2max, k2min, k2max);
+
+            const double m_B2 = m_B() * m_B();
+            const double m_l2 = power_of<2>(m_l());
 
-            const double q2 = parameters[0];
-            const double k2 = parameters[1];
-            const double z  = parameters[2];
+            const double zsplit = std::min(std::max(0.0, zmin), zmax);
 
-            auto imp = reinterpret_cast<const Implementation<BToPiPiLeptonNeutrino> *>(_imp);
+            double backward = 0.0, forward = 0.0;
+            for (std::size_t i = 0 ; i < PiPiQuadratureGrid::q2_points ; ++i)
+            {
+                const double q2 = grid.q2_nodes[i];
 
-            if ((lambda(q2, k2, imp->m_B() * imp->m_B()) <= 0) || (q2 <= power_of<2>(imp->m_l())))
-                return 0.0;
+                if (q2 <= m_l2)
+                    continue;
 
-            return imp->normalized_differential_decay_width(q2, k2, z);
+                for (std::size_t j = 0 ; j < PiPiQuadratureGrid::k2_points ; ++j)
+                {
+                    const double k2 = grid.k2_nodes[j];
+
+                    if (lambda(q2, k2, m_B2) <= 0)
+                        continue;
+
+                    const double w = grid.q2_weights[i] * grid.k2_weights[j];
+
+                    auto integrand = [&] (const double & z) { return normalized_differential_decay_width(q2, k2, z); };
+
+                    if (zmin < zsplit)
+                        backward += w * integrate1D_fixed<16u>(integrand, zmin, zsplit);
+                    if (zsplit < zmax)
+                        forward  += w * integrate1D_fixed<16u>(integrand, zsplit, zmax);
+                }
+            }
+
+            return { backward, forward };
         }
 
         double normalized_integrated_decay_width(const double & q2min, const double & q2max,
                 const double k2min, const double & k2max,
                 const double & zmin, const double & zmax) const
         {
-            // Yields a numerical error of approximately 0.2%.
-            static const size_t calls = 50000;
-
-            const double x_min[3] = { q2min, k2min, zmin };
-            const double x_max[3] = { q2max, k2max, zmax };
-
-            gsl_monte_function integrand{ &normalized_differential_decay_width_gsl_adapter, 3u, const_cast<void *>(reinterpret_cast<const void *>(this)) };
+            const auto [backward, forward] = normalized_hemisphere_decay_widths(q2min, q2max, k2min, k2max, zmin, zmax);
 
-            double result, error;
-
-            gsl_monte_miser_integrate(&integrand, x_min, x_max, 3u, calls, rng, state, &result, &error);
-
-            return result;
+            return backward + forward;
         }
 
         double normalized_integrated_forward_backward_asymmetry(const double & q2min, const double & q2max,
                 const double k2min, const double & k2max) const
         {
-            // Yields a numerical error of approximately 0.2%.
-            static const size_t calls = 50000;
-
-            const double x_forward_min[3]  = { q2min, k2min,  0.0 };
-            const double x_forward_max[3]  = { q2max, k2max, +1.0 };
-            const double x_backward_min[3] = { q2min, k2min, -1.0 };
-            const double x_backward_max[3] = { q2max, k2max,  0.0 };
-
-            gsl_monte_function integrand{ &normalized_differential_decay_width_gsl_adapter, 3u, const_cast<void *>(reinterpret_cast<const void *>(this)) };
-
-            double forward,  forward_error;
-            double backward, backward_error;
-
-            gsl_monte_miser_integrate(&integrand, x_forward_min, x_forward_max, 3u, calls, rng, state, &forward, &forward_error);
-            gsl_monte_miser_integrate(&integrand, x_backward_min, x_backward_max, 3u, calls, rng, state, &backward, &backward_error);
+            const auto [backward, forward] = normalized_hemisphere_decay_widths(q2min, q2max, k2min, k2max, -1.0, +1.0);
 
             return (forward - backward) / (forward + backward);
         }
@@ -201,7 +275,7 @@ namespace eos
     double
     BToPiPiLeptonNeutrino::double_differential_branching_ratio(const double & q2, const double & k2) const
     {
-        std::function<double (const double &)> integrand = std::bind(
+        auto integrand = std::bind(
                 &Implementation<BToPiPiLeptonNeutrino>::differential_branching_ratio,
                 _imp.get(), q2, k2, std::placeholders::_1);
 
@@ -217,7 +291,7 @@ namespace eos
     double
     BToPiPiLeptonNeutrino::double_differential_forward_backward_asymmetry(const double & q2, const double & k2) const
     {
-        std::function<double (const double &)> integrand = std::bind(
+        auto integrand = std::bind(
                 &Implementation<BToPiPiLeptonNeutrino>::normalized_differential_decay_width,
                 _imp.get(), q2, k2, std::placeholders::_1);
 
@@ -231,7 +305,7 @@ namespace eos
     double
     BToPiPiLeptonNeutrino::partial_waves(const double & q2, const double & k2, const double & z) const
     {
-        std::function<double (const double &)> integrand = std::bind(
+        auto integrand = std::bind(
                 &Implementation<BToPiPiLeptonNeutrino>::normalized_differential_decay_width,
                 _imp.get(), q2, k2, std::placeholders::_1);
 
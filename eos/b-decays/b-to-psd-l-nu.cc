@@ -389,7 +389,7 @@ namespace eos
             const double q2_min = power_of<2>(m_l());
             const double q2_max = power_of<2>(m_B() - m_P());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
             const double num   = normalized_differential_branching_ratio(q2);
             const double denom = integrate<GSL::QAGS>(f, q2_min, q2_max, int_config);
 
@@ -410,7 +410,7 @@ namespace eos
             const double q2_abs_min = power_of<2>(m_l());
             const double q2_abs_max = power_of<2>(m_B() - m_P());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio, this, std::placeholders::_1);
             const double num   = integrate<GSL::QAGS>(f, q2_min,     q2_max,     int_config);
             const double denom = integrate<GSL::QAGS>(f, q2_abs_min, q2_abs_max, int_config);
 
@@ -483,7 +483,7 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_branching_ratio,
+        auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_branching_ratio,
                 _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
@@ -500,7 +500,7 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio,
+        auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio,
                                                              _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
@@ -510,7 +510,7 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p,
+        auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p,
                                                              _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
@@ -519,7 +519,7 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0,
+        auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0,
                                                              _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
@@ -528,7 +528,7 @@ namespace eos
     double
     BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width(const double & s_min, const double & s_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
+        auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
                                                              _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
@@ -545,14 +545,14 @@ namespace eos
     {
         double integrated_numerator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
 
         double integrated_denominator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
@@ -571,14 +571,14 @@ namespace eos
     {
         double integrated_numerator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
 
         double integrated_denominator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
@@ -597,14 +597,14 @@ namespace eos
     {
         double integrated_numerator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
 
         double integrated_denominator;
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
+            auto f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
                                                                  _imp.get(), std::placeholders::_1);
             integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
         }
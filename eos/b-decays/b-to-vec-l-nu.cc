@@ -33,6 +33,7 @@
 #include <eos/utils/options.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <cmath>
 #include <functional>
@@ -81,8 +82,15 @@ namespace eos
 
         int int_points;
 
+        BooleanOption opt_int_parallel;
+
         std::shared_ptr<FormFactors<PToV>> form_factors;
 
+        // amplitude kernel, instantiated per option combination and selected at construction
+        using AmplitudesFn = b_to_vec_l_nu::Amplitudes (Implementation::*)(const double &) const;
+
+        AmplitudesFn amplitudes_fn;
+
         using IntermediateResult = BToVectorLeptonNeutrino::IntermediateResult;
 
         IntermediateResult intermediate_result;
@@ -162,7 +170,11 @@ namespace eos
             mu(p[opt_U.str() + "b" + opt_l.str() + "nu" + opt_l.str() + "::mu"], u),
             opt_int_points(o, "integration-points", {"256", "4096"}, "256"),
             int_points(destringify<int>(opt_int_points.value())),
-            form_factors(FormFactorFactory<PToV>::create(_process() + "::" + o.get("form-factors", "BSZ2015"), p, o))
+            opt_int_parallel(o, options, "parallel-integration"),
+            form_factors(FormFactorFactory<PToV>::create(_process() + "::" + o.get("form-factors", "BSZ2015"), p, o)),
+            // within the SM the scalar and tensor Wilson coefficients vanish identically,
+            // so the specialized kernel without that sector applies
+            amplitudes_fn("SM" == o.get("model", "SM") ? &Implementation::_amplitudes<false> : &Implementation::_amplitudes<true>)
         {
             Context ctx("When constructing B->Vlnu observable");
 
@@ -201,7 +213,13 @@ namespace eos
             return power_of<2>(g_fermi()) * p * q2 * power_of<2>(1.0 - m_l * m_l / q2) / (3.0 * 64.0 * power_of<3>(M_PI) * m_B * m_B);
         }
 
-        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2) const
+        // The scalar and tensor sector only contributes beyond the SM; which case
+        // applies is fixed by the model option, so the kernel is instantiated for
+        // both cases and selected once at construction. The specialization for the
+        // SM-like case skips the tensor form factors and the running quark masses,
+        // and assembles branch-free per-q2 code.
+        template <bool has_scalar_tensor>
+        b_to_vec_l_nu::Amplitudes _amplitudes(const double & q2) const
         {
             b_to_vec_l_nu::Amplitudes result;
 
@@ -209,24 +227,16 @@ namespace eos
             const WilsonCoefficients<ChargedCurrent> wc = this->wc(opt_l.value(), opt_cp_conjugate.value());
             const complex<double> gV_pl = wc.cvl() + wc.cvr();  // gV_pl = 1 + gV = 1 + VL + VR = cVL + cVR
             const complex<double> gV_mi = wc.cvl() - wc.cvr();  // gV_mi = 1 - gA = 1 + VL - VR = cVL - cVR
-            const complex<double> gP = wc.csr() - wc.csl();
-            const complex<double> TL = wc.ct();
 
             // form factors
             const double aff0  = form_factors->a_0(q2);
             const double aff1  = form_factors->a_1(q2);
             const double aff12 = form_factors->a_12(q2);
             const double vff   = form_factors->v(q2);
-            const double tff1  = form_factors->t_1(q2);
-            const double tff2  = form_factors->t_2(q2);
-            const double tff3  = form_factors->t_3(q2);
             // meson & lepton masses
             const double m_l = this->m_l();
             const double m_B = this->m_B();
             const double m_V = this->m_V();
-            // running quark masses
-            const double mbatmu = model->m_b_msbar(mu);
-            const double mUatmu = this->m_U_msbar(mu);
             // kinematic variables
             const double lam      = lambda(m_B * m_B, m_V * m_V, q2);
             const double sqrt_lam = (lam > 0.0) ? std::sqrt(lam) : 0.0;
@@ -237,16 +247,38 @@ namespace eos
             // transversity amplitudes A's. cf. [DSD2014], p.17
             if ((q2 >= power_of<2>(m_l)) && (q2 <= power_of<2>(m_B - m_V))) {
                 result.a_0          = isospin * gV_mi * 8.0 * m_B * m_V / sqrtq2 * aff12;
-                result.a_0_T        = isospin * TL / (2.0 * m_V) * ( (m_B * m_B + 3.0 * m_V * m_V - q2) * tff2 - lam * tff3 / (m_B * m_B - m_V * m_V) );
                 result.a_plus       = isospin * ( (m_B + m_V) * aff1 * gV_mi - sqrt_lam * vff * gV_pl / (m_B + m_V) );
                 result.a_minus      = isospin * ( (m_B + m_V) * aff1 * gV_mi + sqrt_lam * vff * gV_pl / (m_B + m_V) );
-                result.a_plus_T     = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 + sqrt_lam * tff1 );
-                result.a_minus_T    = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 - sqrt_lam * tff1 );
                 result.a_t          = isospin * sqrt_lam * aff0 * gV_mi / sqrtq2;
-                result.a_P          = isospin * sqrt_lam * aff0 * gP / (mbatmu + mUatmu);
                 result.a_para       = (result.a_plus + result.a_minus) / std::sqrt(2.0);
-                result.a_para_T     = (result.a_plus_T + result.a_minus_T) / std::sqrt(2.0);
                 result.a_perp       = (result.a_plus - result.a_minus) / std::sqrt(2.0);
+
+                if constexpr (has_scalar_tensor)
+                {
+                    const complex<double> gP = wc.csr() - wc.csl();
+                    const complex<double> TL = wc.ct();
+
+                    // tensor form factors
+                    const double tff1  = form_factors->t_1(q2);
+                    const double tff2  = form_factors->t_2(q2);
+                    const double tff3  = form_factors->t_3(q2);
+                    // running quark masses
+                    const double mbatmu = model->m_b_msbar(mu);
+                    const double mUatmu = this->m_U_msbar(mu);
+
+                    result.a_0_T        = isospin * TL / (2.0 * m_V) * ( (m_B * m_B + 3.0 * m_V * m_V - q2) * tff2 - lam * tff3 / (m_B * m_B - m_V * m_V) );
+                    result.a_plus_T     = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 + sqrt_lam * tff1 );
+                    result.a_minus_T    = isospin * TL / sqrtq2 * ( (m_B * m_B - m_V * m_V) * tff2 - sqrt_lam * tff1 );
+                    result.a_P          = isospin * sqrt_lam * aff0 * gP / (mbatmu + mUatmu);
+                }
+                else
+                {
+                    result.a_0_T        = 0.0;
+                    result.a_plus_T     = 0.0;
+                    result.a_minus_T    = 0.0;
+                    result.a_P          = 0.0;
+                }
+                result.a_para_T     = (result.a_plus_T + result.a_minus_T) / std::sqrt(2.0);
                 result.a_perp_T     = (result.a_plus_T - result.a_minus_T) / std::sqrt(2.0);
 
                 result.mlH = (m_l > 0.0) ? std::sqrt(m_l * m_l / q2) : 0.0;
@@ -275,6 +307,11 @@ namespace eos
 
         }
 
+        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2) const
+        {
+            return (this->*amplitudes_fn)(q2);
+        }
+
         std::array<double, 12> _differential_angular_observables(const double & q2) const
         {
             return b_to_vec_l_nu::AngularObservables(this->amplitudes(q2))._vv;
@@ -283,6 +320,32 @@ namespace eos
         // define below integrated observables in generic form
         std::array<double, 12> _integrated_angular_observables(const double & q2_min, const double & q2_max) const
         {
+            if (opt_int_parallel.value())
+            {
+                // evaluate the shared amplitudes at all sampling points jointly across the
+                // thread pool, and let integrate1D accumulate the results per observable
+                const std::function<std::vector<std::array<double, 12>> (unsigned)> sample(
+                    [this, &q2_min, &q2_max] (unsigned m) -> std::vector<std::array<double, 12>>
+                    {
+                        const double h = (q2_max - q2_min) / m;
+
+                        std::vector<std::array<double, 12>> y(m + 1);
+                        ThreadPool::instance()->parallel_for(0, m + 1,
+                            [this, &q2_min, &h, &y] (size_t begin, size_t end)
+                            {
+                                for (size_t i = begin ; i < end ; ++i)
+                                {
+                                    y[i] = this->_differential_angular_observables(q2_min + i * h);
+                                }
+                            });
+
+                        return y;
+                    });
+
+                // second argument of integrate1D is some power of 2
+                return integrate1D(sample, int_points, q2_min, q2_max);
+            }
+
             std::function<std::array<double, 12> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
             // second argument of integrate1D is some power of 2
             return integrate1D(integrand, int_points, q2_min, q2_max);
@@ -314,7 +377,7 @@ namespace eos
             const double q2_abs_min = power_of<2>(m_l());
             const double q2_abs_max = power_of<2>(m_B() - m_V());
 
-            std::function<double (const double &)> f = std::bind(&Implementation<BToVectorLeptonNeutrino>::normalized_decay_width, this, std::placeholders::_1);
+            auto f = std::bind(&Implementation<BToVectorLeptonNeutrino>::normalized_decay_width, this, std::placeholders::_1);
             const double num   = integrate<GSL::QAGS>(f, q2_min,     q2_max);
             const double denom = integrate<GSL::QAGS>(f, q2_abs_min, q2_abs_max);
 
@@ -337,11 +400,12 @@ namespace eos
     {
         Model::option_specification(),
         FormFactorFactory<PToV>::option_specification(),
-        { "cp-conjugate", { "true", "false" },  "false" },
-        { "l",            { "e", "mu", "tau" }, "mu"    },
-        { "U",            { "c", "u" },         "c"     },
-        { "q",            { "u", "d", "s" },    "d"     },
-        { "I",            { "1", "0", "1/2" },  "1"     },
+        { "cp-conjugate",         { "true", "false" },  "false" },
+        { "parallel-integration", { "true", "false" },  "false" },
+        { "l",                    { "e", "mu", "tau" }, "mu"    },
+        { "U",                    { "c", "u" },         "c"     },
+        { "q",                    { "u", "d", "s" },    "d"     },
+        { "I",                    { "1", "0", "1/2" },  "1"     },
     };
 
     const std::map<std::tuple<QuarkFlavor, QuarkFlavor, std::string>, std::tuple<std::string, std::string, std::string, double>>
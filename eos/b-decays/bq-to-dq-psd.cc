@@ -31,6 +31,7 @@
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <cstdint>
 #include <string>
 
 namespace eos
@@ -45,6 +46,8 @@ namespace eos
     template <>
     struct Implementation<BqToDqPseudoscalar>
     {
+        Parameters parameters;
+
         SpecifiedOption opt_model;
 
         std::shared_ptr<Model> model;
@@ -86,6 +89,7 @@ namespace eos
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             opt_model(o, options, "model"),
             model(Model::make(opt_model.value(), p, o)),
             hbar(p["QM::hbar"], u),
@@ -98,7 +102,8 @@ namespace eos
             f_P(p["decay-constant::" + stringify(opt_q.value() == QuarkFlavor::down ? "K_u" : "pi")], u),
             opt_cp_conjugate(o, options, "cp-conjugate"),
             mu(p[stringify(opt_q.value() == QuarkFlavor::down ? "s" : "d") + "bcu::mu"], u),
-            opt_accuracy(o, options, "accuracy")
+            opt_accuracy(o, options, "accuracy"),
+            a_1_valid(false)
         {
             Context ctx("When constructing B_q->D_q P observable");
 
@@ -228,7 +233,34 @@ namespace eos
                 -((8.0 * (4.0 * u + 3.0)) / (1.0 + z)) + (8.0 * (1.0 - z)) / (1.0 + z) * (ATLL(u, z) + ATLL(1.0 - u, z));
         };
 
+        /*
+         * The topological amplitude a_1 is independent of which observable of
+         * the decay family requests it, yet its NLO convolutions are the
+         * dominant cost of every evaluation. It is therefore computed once
+         * per parameter point and served from a cache invalidated through
+         * the parameter set's generation counter; the branching ratio, the
+         * decay width, and both a_1 projections share the cached value.
+         */
+        mutable complex<double> a_1_cached;
+        mutable std::uint64_t a_1_generation;
+        mutable bool a_1_valid;
+
         complex<double> a_1() const
+        {
+            const std::uint64_t generation = parameters.generation();
+            if (a_1_valid && (generation == a_1_generation))
+            {
+                return a_1_cached;
+            }
+
+            a_1_cached = this->compute_a_1();
+            a_1_generation = generation;
+            a_1_valid = true;
+
+            return a_1_cached;
+        }
+
+        complex<double> compute_a_1() const
         {
             const WilsonCoefficients<bern::ClassIII> wc = this->wc();
 
@@ -26,6 +26,7 @@
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/destringify.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/memoise.hh>
@@ -276,6 +277,8 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -290,7 +293,8 @@ namespace eos
             m_Lambda_c(p["mass::Lambda_c"], u),
             alpha(p["Lambda_c::alpha"], u),
             mu(p["cb" + opt_l.str() + "nu" + opt_l.str() + "::mu"], u),
-            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda_c::" + o.get("form-factors", "DKMR2017"), p, o))
+            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda_c::" + o.get("form-factors", "DKMR2017"), p, o)),
+            n_integration_points(integration_points(o, 64, "Lambda_b->Lambda_clnu::angular_observables"))
         {
             Context ctx("When constructing L_b->L_c lnu observable");
 
@@ -380,7 +384,7 @@ namespace eos
         {
             std::function<std::array<double, 10> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
 
-            return integrate1D(integrand, 64, q2_min, q2_max);
+            return integrate1D(integrand, n_integration_points, q2_min, q2_max);
         }
 
         inline lambdab_to_lambdac_l_nu::AngularObservables differential_angular_observables(const double & q2)
@@ -189,7 +189,7 @@ namespace eos
 
         double integrated_branching_ratio(const double & s_min, const double & s_max) const
         {
-            std::function<double (const double &)> f = std::bind(&Implementation<LambdaBToLambdaC2625LeptonNeutrino>::differential_branching_ratio,
+            auto f = std::bind(&Implementation<LambdaBToLambdaC2625LeptonNeutrino>::differential_branching_ratio,
                     *this, std::placeholders::_1);
 
             return integrate<GSL::QAGS>(f, s_min, s_max);
@@ -199,7 +199,7 @@ namespace eos
         {
             std::function<double (const double &)> numerator   = std::bind(&Implementation<LambdaBToLambdaC2625LeptonNeutrino>::normalized_differential_forward_backward_asymmetry,
                     *this, std::placeholders::_1);
-            std::function<double (const double &)> denominator = std::bind(&Implementation<LambdaBToLambdaC2625LeptonNeutrino>::normalized_differential_decay_width,
+            auto denominator = std::bind(&Implementation<LambdaBToLambdaC2625LeptonNeutrino>::normalized_differential_decay_width,
                     *this, std::placeholders::_1);
 
             return integrate<GSL::QAGS>(numerator, s_min, s_max) / integrate<GSL::QAGS>(denominator, s_min, s_max);
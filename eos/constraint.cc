@@ -21,14 +21,18 @@
 #include <eos/maths/gsl-interface.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/statistics/log-likelihood.hh>
+#include <eos/utils/binary-io.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qualified-name.hh>
 #include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <boost/filesystem/directory.hpp>
@@ -36,10 +40,16 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <config.h>
+#include <exception>
+#include <fstream>
 #include <map>
+#include <memory>
 #include <vector>
+
+#include <unistd.h>
 #include <yaml-cpp/yaml.h>
 
 namespace fs = boost::filesystem;
@@ -1257,7 +1267,7 @@ namespace eos
                     std::vector<double> means;
                     for (auto && v : n["means"])
                     {
-                        means.push_back(v.as<double>());
+                        means.push_back(destringify<double>(v.Scalar()));
                     }
 
                     // Test for the presence of the optional "dof" parameter
@@ -1278,19 +1288,19 @@ namespace eos
                     std::vector<double> sigma_stat_hi;
                     for (auto && v : n["sigma-stat-hi"])
                     {
-                        sigma_stat_hi.push_back(v.as<double>());
+                        sigma_stat_hi.push_back(destringify<double>(v.Scalar()));
                     }
 
                     std::vector<double> sigma_stat_lo;
                     for (auto && v : n["sigma-stat-lo"])
                     {
-                        sigma_stat_lo.push_back(v.as<double>());
+                        sigma_stat_lo.push_back(destringify<double>(v.Scalar()));
                     }
 
                     std::vector<double> sigma_sys;
                     for (auto && v : n["sigma-sys"])
                     {
-                        sigma_sys.push_back(v.as<double>());
+                        sigma_sys.push_back(destringify<double>(v.Scalar()));
                     }
 
                     std::vector<std::vector<double>> correlations;
@@ -1300,7 +1310,7 @@ namespace eos
 
                         for (auto && v : row)
                         {
-                            correlations.back().push_back(v.as<double>());
+                            correlations.back().push_back(destringify<double>(v.Scalar()));
                         }
                     }
 
@@ -1731,7 +1741,7 @@ namespace eos
                     std::vector<double> _means;
                     for (auto && v : n["means"])
                     {
-                        _means.push_back(v.as<double>());
+                        _means.push_back(destringify<double>(v.Scalar()));
                     }
                     gsl_vector * means = gsl_vector_alloc(_means.size());
                     for (auto i = 0u; i < _means.size(); ++i)
@@ -1761,7 +1771,7 @@ namespace eos
 
                         for (auto && v : row)
                         {
-                            _covariance.back().push_back(v.as<double>());
+                            _covariance.back().push_back(destringify<double>(v.Scalar()));
                         }
                     }
                     gsl_matrix * covariance = gsl_matrix_alloc(_covariance.size(), _covariance.size());
@@ -1792,7 +1802,7 @@ namespace eos
 
                             for (auto && v : row)
                             {
-                                _response.back().push_back(v.as<double>());
+                                _response.back().push_back(destringify<double>(v.Scalar()));
                             }
                         }
 
@@ -2463,7 +2473,7 @@ namespace eos
                         std::vector<double> _mean;
                         for (auto && v : c["means"])
                         {
-                            _mean.push_back(v.as<double>());
+                            _mean.push_back(destringify<double>(v.Scalar()));
                         }
                         GSLVectorPtr mean = make_gsl_vector(_mean.size());
                         for (auto i = 0u; i < _mean.size(); ++i)
@@ -2484,7 +2494,7 @@ namespace eos
 
                             for (auto && v : row)
                             {
-                                _covariance.back().push_back(v.as<double>());
+                                _covariance.back().push_back(destringify<double>(v.Scalar()));
                             }
                         }
                         GSLMatrixPtr covariance = make_gsl_matrix(_covariance.size(), _covariance.size());
@@ -2525,19 +2535,19 @@ namespace eos
                     std::vector<double> weights;
                     for (auto && v : n["weights"])
                     {
-                        weights.push_back(v.as<double>());
+                        weights.push_back(destringify<double>(v.Scalar()));
                     }
 
                     std::vector<double> sigma;
                     for (auto && v : n["test statistics"]["sigma"])
                     {
-                        sigma.push_back(v.as<double>());
+                        sigma.push_back(destringify<double>(v.Scalar()));
                     }
 
                     std::vector<double> densities;
                     for (auto && v : n["test statistics"]["densities"])
                     {
-                        densities.push_back(v.as<double>());
+                        densities.push_back(destringify<double>(v.Scalar()));
                     }
 
                     if (sigma.size() != densities.size())
@@ -2724,15 +2734,9 @@ namespace eos
         return std::bind(&Factory_::make, f, std::placeholders::_1, std::placeholders::_2);
     }
 
-    std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>
-    load_constraint_entries()
+    fs::path
+    constraint_base_path()
     {
-        Context context("When loading constraint entries:");
-
-        using ValueType = std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::value_type;
-
-        std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> result;
-
         fs::path base;
         if (std::getenv("EOS_TESTS_CONSTRAINTS"))
         {
@@ -2759,6 +2763,157 @@ namespace eos
             throw InternalError("Expect '" + base.string() + " to be a directory");
         }
 
+        return base;
+    }
+
+    /*
+     * Proxy that defers the deserialization of a constraint entry until its first
+     * use. Only the file recorded in the constraint index is parsed, and within
+     * it only once per process.
+     */
+    class LazyConstraintEntry : public ConstraintEntry
+    {
+        private:
+            QualifiedName _constraint_name;
+
+            std::string _file;
+
+            mutable Mutex _mutex;
+
+            mutable std::shared_ptr<const ConstraintEntry> _entry;
+
+            // Parsed top-level nodes per input file, shared between all lazy entries.
+            static std::map<std::string, YAML::Node> &
+            _file_nodes()
+            {
+                static std::map<std::string, YAML::Node> nodes;
+
+                return nodes;
+            }
+
+            static Mutex &
+            _file_mutex()
+            {
+                static Mutex mutex;
+
+                return mutex;
+            }
+
+            const ConstraintEntry &
+            _materialize() const
+            {
+                Lock l(_mutex);
+
+                if (_entry)
+                    return *_entry;
+
+                Context context([this] () { return "When lazily deserializing constraint '" + _constraint_name.full() + "' from file '" + _file + "':"; });
+
+                YAML::Node node;
+                {
+                    Lock l2(_file_mutex());
+
+                    auto & nodes = _file_nodes();
+                    auto   i     = nodes.find(_file);
+                    if (nodes.end() == i)
+                    {
+                        try
+                        {
+                            i = nodes.emplace(_file, YAML::LoadFile(_file)).first;
+                        }
+                        catch (YAML::ParserException & e)
+                        {
+                            throw ConstraintInputFileParseError(_file, e.what());
+                        }
+                    }
+                    node = i->second[_constraint_name.full()];
+                }
+
+                if (! node)
+                {
+                    throw InternalError("Stale constraint index: '" + _constraint_name.full() + "' not found in file '" + _file + "'");
+                }
+
+                _entry.reset(ConstraintEntry::FromYAML(_constraint_name, node));
+
+                return *_entry;
+            }
+
+        public:
+            LazyConstraintEntry(const QualifiedName & name, const std::string & file) :
+                _constraint_name(name),
+                _file(file)
+            {
+            }
+
+            virtual ~LazyConstraintEntry() = default;
+
+            virtual Constraint
+            make(const QualifiedName & name, const Options & options) const
+            {
+                return _materialize().make(name, options);
+            }
+
+            virtual LogPriorPtr
+            make_prior(const Parameters & parameters, const Options & options) const
+            {
+                return _materialize().make_prior(parameters, options);
+            }
+
+            virtual const QualifiedName &
+            name() const
+            {
+                return _constraint_name;
+            }
+
+            virtual const std::string &
+            type() const
+            {
+                return _materialize().type();
+            }
+
+            virtual ObservableNameIterator
+            begin_observable_names() const
+            {
+                return _materialize().begin_observable_names();
+            }
+
+            virtual ObservableNameIterator
+            end_observable_names() const
+            {
+                return _materialize().end_observable_names();
+            }
+
+            virtual ReferenceNameIterator
+            begin_references() const
+            {
+                return _materialize().begin_references();
+            }
+
+            virtual ReferenceNameIterator
+            end_references() const
+            {
+                return _materialize().end_references();
+            }
+
+            virtual void
+            serialize(YAML::Emitter & emitter) const
+            {
+                _materialize().serialize(emitter);
+            }
+    };
+
+    std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>
+    load_constraint_entries(std::map<QualifiedName, std::string> * files = nullptr)
+    {
+        Context context("When loading constraint entries:");
+
+        using ValueType = std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::value_type;
+
+        std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> result;
+
+        const fs::path base = constraint_base_path();
+
         for (fs::directory_iterator f(base), f_end; f != f_end; ++f)
         {
             auto file_path = f->path();
@@ -2776,7 +2931,7 @@ namespace eos
             std::string file = file_path.string();
             try
             {
-                Context context("When parsing file '" + file_path.string() + "':");
+                Context context([&] () { return "When parsing file '" + file_path.string() + "':"; });
 
                 YAML::Node node;
                 try
@@ -2797,7 +2952,7 @@ namespace eos
                         continue;
                     }
 
-                    Context context("When parsing constraint '" + keyname + "':");
+                    Context context([&] () { return "When parsing constraint '" + keyname + "':"; });
 
                     QualifiedName                          name(keyname);
                     std::shared_ptr<const ConstraintEntry> entry{ ConstraintEntry::FromYAML(name, p.second) };
@@ -2806,6 +2961,11 @@ namespace eos
                     {
                         throw ConstraintInputFileParseError(file, "encountered duplicate constraint '" + keyname + "'");
                     }
+
+                    if (files)
+                    {
+                        (*files)[name] = file;
+                    }
                 }
             }
             catch (ConstraintDeserializationError & e)
@@ -2817,18 +2977,168 @@ namespace eos
         return result;
     }
 
+    namespace
+    {
+        const char constraint_index_magic[8] = { 'E', 'O', 'S', 'C', 'I', '0', '1', '\n' };
+    }
+
     class ConstraintEntries : public InstantiationPolicy<ConstraintEntries, Singleton>
     {
         private:
             std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> _entries;
 
-            ConstraintEntries() :
-                _entries(load_constraint_entries())
+            ConstraintEntries()
             {
+                const fs::path base = constraint_base_path();
+
+                // prefer the on-disk index, which maps constraint names to their input
+                // files and allows entries to be deserialized lazily on first use
+                if (_try_load_index(base))
+                    return;
+
+                std::map<QualifiedName, std::string> files;
+                _entries = load_constraint_entries(&files);
+                _write_index(base, files);
             }
 
             ~ConstraintEntries() = default;
 
+            static fs::path
+            _index_path()
+            {
+                if (std::getenv("EOS_DISABLE_CONSTRAINT_CACHE"))
+                    return fs::path();
+
+                if (std::getenv("XDG_CACHE_HOME"))
+                    return fs::path(std::getenv("XDG_CACHE_HOME")) / "eos" / "constraints.index";
+
+                if (std::getenv("HOME"))
+                    return fs::path(std::getenv("HOME")) / ".cache" / "eos" / "constraints.index";
+
+                return fs::path();
+            }
+
+            // Determine the number of YAML input files and the time of the most recent
+            // modification, which together invalidate the index.
+            static void
+            _scan_input_files(const fs::path & base, std::uint32_t & n_files, std::int64_t & newest)
+            {
+                n_files = 0;
+                newest  = 0;
+
+                for (fs::directory_iterator f(base), f_end; f != f_end; ++f)
+                {
+                    auto file_path = f->path();
+
+                    if (! fs::is_regular_file(status(file_path)))
+                    {
+                        continue;
+                    }
+
+                    if (".yaml" != file_path.extension().string())
+                    {
+                        continue;
+                    }
+
+                    ++n_files;
+                    newest = std::max<std::int64_t>(newest, fs::last_write_time(file_path));
+                }
+            }
+
+            bool
+            _try_load_index(const fs::path & base)
+            {
+                const fs::path index = _index_path();
+
+                if (index.empty() || ! fs::is_regular_file(fs::status(index)))
+                    return false;
+
+                try
+                {
+                    // map the index read-only; concurrent processes on the same node
+                    // then share one copy of its pages
+                    binary_io::MappedFile      mapping(index.string());
+                    binary_io::MappedInputStream in(mapping);
+                    in.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
+
+                    char magic[sizeof(constraint_index_magic)];
+                    in.read(magic, sizeof(magic));
+                    if (! std::equal(std::begin(magic), std::end(magic), std::begin(constraint_index_magic)))
+                        return false;
+
+                    // the index is stale if the YAML inputs changed since it was written
+                    std::uint32_t n_files;
+                    std::int64_t  newest;
+                    _scan_input_files(base, n_files, newest);
+
+                    if ((binary_io::read<std::uint32_t>(in) != n_files) || (binary_io::read<std::int64_t>(in) != newest))
+                        return false;
+
+                    const std::uint32_t n_entries = binary_io::read<std::uint32_t>(in);
+                    for (std::uint32_t i = 0; i < n_entries; ++i)
+                    {
+                        QualifiedName name(binary_io::read_string(in));
+                        std::string   file = binary_io::read_string(in);
+
+                        _entries[name] = std::make_shared<const LazyConstraintEntry>(name, file);
+                    }
+
+                    return true;
+                }
+                catch (...)
+                {
+                    // fall back to parsing the YAML inputs
+                    _entries.clear();
+
+                    return false;
+                }
+            }
+
+            void
+            _write_index(const fs::path & base, const std::map<QualifiedName, std::string> & files) const
+            {
+                const fs::path index = _index_path();
+
+                if (index.empty())
+                    return;
+
+                try
+                {
+                    fs::create_directories(index.parent_path());
+
+                    // write to a temporary file first, so that concurrent processes never
+                    // observe a partially written index
+                    const fs::path tmp = index.string() + ".tmp." + stringify(::getpid());
+
+                    {
+                        std::ofstream out(tmp.string(), std::ios::binary | std::ios::trunc);
+                        out.exceptions(std::ios::badbit | std::ios::failbit);
+
+                        out.write(constraint_index_magic, sizeof(constraint_index_magic));
+
+                        std::uint32_t n_files;
+                        std::int64_t  newest;
+                        _scan_input_files(base, n_files, newest);
+                        binary_io::write<std::uint32_t>(out, n_files);
+                        binary_io::write<std::int64_t>(out, newest);
+
+                        binary_io::write<std::uint32_t>(out, files.size());
+                        for (const auto & [name, file] : files)
+                        {
+                            binary_io::write_string(out, name.full());
+                            binary_io::write_string(out, file);
+                        }
+                    }
+
+                    fs::rename(tmp, index);
+                }
+                catch (...)
+                {
+                    Log::instance()->message("ConstraintEntries", ll_informational)
+                        << "Could not write the constraint index to '" << index.string() << "'";
+                }
+            }
+
         public:
             friend class InstantiationPolicy<ConstraintEntries, Singleton>;
 
@@ -2859,6 +3169,91 @@ namespace eos
         return e->second->make(e->first, name.options() + options); // options supersede name.options
     }
 
+    std::vector<Constraint>
+    Constraint::make_all(const std::vector<QualifiedName> & names, const Options & options)
+    {
+        auto & entries = ConstraintEntries::instance()->entries();
+
+        // resolve every name up front, so that unknown names surface before any
+        // worker starts; this also materializes the registry serially
+        std::vector<std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::const_iterator> resolved;
+        resolved.reserve(names.size());
+        for (const auto & name : names)
+        {
+            auto e = entries.find(name);
+            if (e == entries.end())
+            {
+                throw UnknownConstraintError(name);
+            }
+
+            resolved.push_back(e);
+        }
+
+        const std::size_t n = names.size();
+        if (0 == n)
+        {
+            return {};
+        }
+
+        // touch the default parameters serially: every entry's make() starts from
+        // them, and the singleton's first construction must not be raced
+        Parameters::Defaults();
+
+        // construct the constraints in contiguous chunks on the pool; the lazy
+        // entries serialize their YAML deserialization internally
+        std::vector<std::unique_ptr<Constraint>> slots(n);
+        std::vector<std::exception_ptr>          errors(n);
+
+        const std::size_t n_workers  = std::min<std::size_t>(std::max(1u, ThreadPool::instance()->number_of_threads()), n);
+        const std::size_t chunk_size = (n + n_workers - 1) / n_workers;
+
+        std::vector<Ticket> tickets;
+        for (std::size_t offset = 0 ; offset < n ; offset += chunk_size)
+        {
+            const std::size_t end = std::min(n, offset + chunk_size);
+
+            auto f = [&, offset, end] ()
+            {
+                for (std::size_t i = offset ; i < end ; ++i)
+                {
+                    try
+                    {
+                        slots[i] = std::make_unique<Constraint>(resolved[i]->second->make(resolved[i]->first, names[i].options() + options));
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                }
+            };
+            tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+        }
+
+        for (auto & ticket : tickets)
+        {
+            ticket.wait();
+        }
+
+        // rethrow the first error in the order of the names, independently of
+        // which worker encountered it first
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+
+        std::vector<Constraint> results;
+        results.reserve(n);
+        for (auto & slot : slots)
+        {
+            results.push_back(*slot);
+        }
+
+        return results;
+    }
+
     template <> struct WrappedForwardIteratorTraits<Constraints::ConstraintIteratorTag>
     {
             using UnderlyingIterator = std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::const_iterator;
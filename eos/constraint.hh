@@ -83,6 +83,18 @@ namespace eos
              * to actually be able to use it.
              */
             static Constraint make(const QualifiedName & name, const Options & options);
+
+            /*!
+             * Create several of the builtin constraints at once.
+             *
+             * The constraints are constructed concurrently on the ThreadPool
+             * and returned in the order of their names. Construction can be
+             * expensive (lazy YAML deserialization, observable construction),
+             * and batching amortizes it across worker threads when assembling
+             * large likelihoods. The first error, in order of the names,
+             * is rethrown after all workers have finished.
+             */
+            static std::vector<Constraint> make_all(const std::vector<QualifiedName> & names, const Options & options);
     };
     extern template class WrappedForwardIterator<Constraint::BlockIteratorTag, LogLikelihoodBlockPtr>;
     extern template class WrappedForwardIterator<Constraint::ObservableIteratorTag, ObservablePtr>;
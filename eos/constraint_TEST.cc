@@ -1354,5 +1354,34 @@ class ConstraintTest : public TestCase
                     std::cerr << "Caught unexpected unknown exception" << std::endl;
                 }
             }
+
+            /* Test batch construction */
+            {
+                static const std::vector<QualifiedName> names{ "B->pi::f_+@IKMvD:2014A", "B->K::f_0+f_++f_T@HPQCD:2013A" };
+
+                auto constraints = Constraint::make_all(names, Options{ });
+                TEST_CHECK_EQUAL(constraints.size(), names.size());
+
+                // results arrive in the order of the names, identical in layout
+                // to their individually-constructed counterparts
+                auto c = constraints.cbegin();
+                for (auto n = names.cbegin() ; n != names.cend() ; ++n, ++c)
+                {
+                    TEST_CHECK_EQUAL(c->name(), *n);
+
+                    Constraint reference = Constraint::make(*n, Options{ });
+                    TEST_CHECK_EQUAL(std::distance(c->begin_observables(), c->end_observables()),
+                                     std::distance(reference.begin_observables(), reference.end_observables()));
+                    TEST_CHECK_EQUAL(std::distance(c->begin_blocks(), c->end_blocks()),
+                                     std::distance(reference.begin_blocks(), reference.end_blocks()));
+                }
+
+                // an empty batch yields an empty result
+                TEST_CHECK(Constraint::make_all({ }, Options{ }).empty());
+
+                // an unknown name surfaces before any construction starts
+                TEST_CHECK_THROWS(UnknownConstraintError,
+                                  Constraint::make_all({ names[0], QualifiedName("B->X::does-not-exist@ACME:2026A") }, Options{ }));
+            }
         }
 } constraint_test;
@@ -24,6 +24,7 @@
 
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/heavy-meson-lcdas.hh>
+#include <eos/form-factors/lcsr-disk-cache.hh>
 #include <eos/utils/exception.hh>
 #include <eos/maths/integrate.hh>
 #include <eos/maths/power-of.hh>
@@ -34,6 +35,8 @@
 #include <eos/utils/qcd.hh>
 #include <eos/utils/stringify.hh>
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 
@@ -89,6 +92,11 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_fT_2pt;
         bool switch_borel;
 
+        // handles for the persistent memoisation of the sum-rule results
+        Parameters parameters;
+        const ParameterUser & parameter_user;
+        std::string cache_tag_prefix;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -112,7 +120,11 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            parameters(p),
+            parameter_user(u),
+            cache_tag_prefix(stringify(Process_::B) + "->" + stringify(Process_::P) + "@B-LCSR[2pt=" + opt_2pt.value()
+                    + ",3pt=" + opt_3pt.value() + ",method=" + opt_method.value() + "]::")
         {
             u.uses(*b_lcdas);
 
@@ -2726,7 +2738,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fp_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_fp_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_fp_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -2736,8 +2748,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_fp_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_fp_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_fp_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_fp_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fp_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fp_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -2756,7 +2768,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fp_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_fp_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fp_2pt_borel, this, std::placeholders::_1, q2);
@@ -2769,8 +2781,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fp_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fp_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_fp_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_fp_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fp_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fp_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -5465,7 +5477,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fpm_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_fpm_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_fpm_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -5475,8 +5487,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_fpm_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_fpm_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_fpm_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_fpm_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fpm_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fpm_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -5495,7 +5507,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fpm_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_fpm_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fpm_2pt_borel, this, std::placeholders::_1, q2);
@@ -5508,8 +5520,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fpm_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fpm_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_fpm_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_fpm_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fpm_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fpm_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -8340,7 +8352,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_fT_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_fT_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_fT_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -8350,8 +8362,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_fT_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_fT_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_fT_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_fT_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_fT_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_fT_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -8370,7 +8382,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_fT_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_fT_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_fT_2pt_borel, this, std::placeholders::_1, q2);
@@ -8383,8 +8395,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_fT_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_fT_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_fT_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_fT_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_fT_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_fT_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -9489,6 +9501,51 @@ namespace eos
             return results;
         }
 
+        /* persistent memoisation of the sum-rule results */
+
+        std::uint64_t _parameter_hash() const
+        {
+            // FNV-1a hash over the values of all used parameters; the mass of the
+            // virtual quark enters through the model and is not registered with the
+            // ParameterUser, so it is mixed in explicitly
+            std::uint64_t hash = 14695981039346656037ull;
+
+            auto mix = [&hash] (const double & value) -> void
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+
+                for (unsigned i = 0 ; i < sizeof(bits) ; ++i)
+                {
+                    hash ^= (bits >> (8 * i)) & 0xffu;
+                    hash *= 1099511628211ull;
+                }
+            };
+
+            for (const auto & id : parameter_user)
+            {
+                mix(parameters[id].evaluate());
+            }
+            mix(m_v());
+
+            return hash;
+        }
+
+        double _cached(double (Implementation::* function)(const double &) const, const char * name, const double & q2) const
+        {
+            auto * cache = LCSRDiskCache::instance();
+            const std::uint64_t parameter_hash = _parameter_hash();
+
+            double result;
+            if (cache->lookup(cache_tag_prefix + name, parameter_hash, q2, result))
+                return result;
+
+            result = (this->*function)(q2);
+            cache->store(cache_tag_prefix + name, parameter_hash, q2, result);
+
+            return result;
+        }
+
     };
 
     template <typename Process_>
@@ -9522,7 +9579,7 @@ namespace eos
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_p(const double & q2) const
     {
-        return this->_imp->f_p(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_p, "f_p", q2);
     }
 
     template <typename Process_>
@@ -9532,21 +9589,25 @@ namespace eos
         const double m_B = this->_imp->m_B(), m_B2 = power_of<2>(m_B);
         const double m_P = this->_imp->m_P(), m_P2 = power_of<2>(m_P);
 
-        return (this->_imp->f_pm(q2)-this->_imp->f_p(q2)) * q2 / (m_B2 - m_P2) + this->_imp->f_p(q2);
+        const double f_p  = this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_p,  "f_p",  q2);
+        const double f_pm = this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_pm, "f_pm", q2);
+
+        return (f_pm - f_p) * q2 / (m_B2 - m_P2) + f_p;
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_m(const double & q2) const
     {
-        return this->_imp->f_pm(q2)-this->_imp->f_p(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_pm, "f_pm", q2)
+                - this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_p, "f_p", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_t(const double & q2) const
     {
-        return this->_imp->f_t(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_t, "f_t", q2);
     }
 
     template <typename Process_>
@@ -9554,28 +9615,29 @@ namespace eos
     AnalyticFormFactorBToPLCSR<Process_>::f_plus_T(const double & q2) const
     {
         // Conventions of GvDV:2020 eq. (A.5)
-        return this->_imp->f_t(q2) * q2 / this->_imp->m_B() / (this->_imp->m_B() + this->_imp->m_P());
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::f_t, "f_t", q2)
+                * q2 / this->_imp->m_B() / (this->_imp->m_B() + this->_imp->m_P());
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::normalized_moment_1_f_p(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_f_p(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::normalized_moment_1_f_p, "normalized_moment_1_f_p", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::normalized_moment_1_f_pm(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_f_pm(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::normalized_moment_1_f_pm, "normalized_moment_1_f_pm", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::normalized_moment_1_f_t(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_f_t(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToPLCSR<Process_>>::normalized_moment_1_f_t, "normalized_moment_1_f_t", q2);
     }
 
     template <typename Process_>
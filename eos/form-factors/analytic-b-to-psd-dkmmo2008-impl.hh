@@ -26,6 +26,7 @@
 #include <eos/form-factors/pi-lcdas.hh>
 #include <eos/maths/derivative.hh>
 #include <eos/maths/integrate.hh>
+#include <eos/maths/interpolation.hh>
 #include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
@@ -36,6 +37,7 @@
 #include <eos/utils/qcd.hh>
 #include <eos/utils/quantum-numbers.hh>
 
+#include <cstdint>
 #include <functional>
 #include <limits>
 
@@ -333,6 +335,27 @@ namespace eos
         // Parameter for the estimation of NNLO corrections
         UsedParameter zeta_nnlo;
 
+        // tabulations of the u-dependent LCDA kernels on a shared grid,
+        // reused across the quadrature nodes and across the f_+/f_0/f_T
+        // components
+        struct KernelTable
+        {
+            CubicSpline phi;
+            CubicSpline phi3p;
+            CubicSpline phi3s;
+            CubicSpline phi3s_d1;
+            CubicSpline phi4;
+            CubicSpline phi4_d1;
+            CubicSpline phi4_d2;
+            CubicSpline psi4;
+            CubicSpline psi4_i;
+        };
+
+        Parameters parameters;
+
+        mutable std::shared_ptr<KernelTable> _kernel_table;
+        mutable std::uint64_t _kernel_table_generation;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             DKMMO2008Base<q1_, q2_, qs_>(p, o, u),
             opt_rescale_borel(o, "rescale-borel", { "1", "0" }, "1"),
@@ -347,7 +370,9 @@ namespace eos
             _s0_T_p(p[prefix + "::s_0^T'(0)@DKMMO2008"], u),
             _s0_T_pp(p[prefix + "::s_0^T''(0)@DKMMO2008"], u),
             opt_decay_constant(o, options, "decay-constant"),
-            zeta_nnlo(p[prefix + "::zeta(NNLO)@DKMMO2008"], u)
+            zeta_nnlo(p[prefix + "::zeta(NNLO)@DKMMO2008"], u),
+            parameters(p),
+            _kernel_table_generation(0)
         {
             using namespace std::placeholders;
 
@@ -402,6 +427,59 @@ namespace eos
             return _s0_T() + _s0_T_p() * q2 + _s0_T_pp() * 0.5 * q2 * q2;
         }
 
+        /*!
+         * Retabulates the u-dependent LCDA kernels whenever a parameter has
+         * changed since the last tabulation, and returns the shared table.
+         *
+         * The grid clusters its nodes at the endpoints, where the twist-4
+         * kernels behave like ubar log(ubar); the kernels are sampled just
+         * inside the endpoints, where their expressions are indeterminate.
+         */
+        const KernelTable & _kernels() const
+        {
+            const std::uint64_t generation = parameters.generation();
+
+            if ((! _kernel_table) || (generation != _kernel_table_generation))
+            {
+                static const std::size_t n = 257;
+                static const double eps = 1.0e-10;
+
+                std::vector<double> u_grid(n);
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    u_grid[i] = power_of<2>(std::sin(M_PI * i / (2.0 * (n - 1))));
+                }
+
+                auto tabulate = [&] (double (PseudoscalarLCDAs::* kernel)(const double &, const double &) const) -> CubicSpline
+                {
+                    std::vector<double> values(n);
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        const double u = std::min(1.0 - eps, std::max(eps, u_grid[i]));
+                        values[i] = ((*this->lcdas).*kernel)(u, mu);
+                    }
+
+                    return CubicSpline(u_grid, values);
+                };
+
+                _kernel_table = std::make_shared<KernelTable>(KernelTable
+                {
+                    tabulate(&PseudoscalarLCDAs::phi),
+                    tabulate(&PseudoscalarLCDAs::phi3p),
+                    tabulate(&PseudoscalarLCDAs::phi3s),
+                    tabulate(&PseudoscalarLCDAs::phi3s_d1),
+                    tabulate(&PseudoscalarLCDAs::phi4),
+                    tabulate(&PseudoscalarLCDAs::phi4_d1),
+                    tabulate(&PseudoscalarLCDAs::phi4_d2),
+                    tabulate(&PseudoscalarLCDAs::psi4),
+                    tabulate(&PseudoscalarLCDAs::psi4_i)
+                });
+                _kernel_table_generation = generation;
+            }
+
+            return *_kernel_table;
+        }
+
         double _decay_constant_sum_rule() const
         {
             static const double pi = M_PI, pi2 = pi * pi;
@@ -477,13 +555,14 @@ namespace eos
         double F_lo_tw2_integrand(const double & u, const double & q2, const double _M2, const double & _select_weight) const
         {
             const double mb = this->m_b_msbar(mu), mb2 = mb * mb, mP2 = mP * mP;
+            const KernelTable & kernels = _kernels();
 
             // _select_weight:
             //  0.0 -> regular integral
             //  1.0 -> integral of derivative w.r.t. -1/M^2
             const double weight = (1.0 - _select_weight) + _select_weight * (mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / u;
 
-            return weight * std::exp(-(mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / (u * _M2)) / u * this->lcdas->phi(u, mu);
+            return weight * std::exp(-(mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / (u * _M2)) / u * kernels.phi(u);
         }
 
         double F_lo_tw2(const double & q2, const double & _M2, const double & _select_weight = 0.0, const double & _select_corr = 0.0) const
@@ -538,12 +617,14 @@ namespace eos
                 );
             };
 
+            const KernelTable & kernels = _kernels();
+
             const double u2 = u * u;
-            const double tw3a = lcdas->phi3p(u, mu)
+            const double tw3a = kernels.phi3p(u)
                 + (
-                    lcdas->phi3s(u, mu) / u
-                    - (mb2 + q2 - u2 * mP2) / (2 * (mb2 - q2 + u2 * mP2)) * lcdas->phi3s_d1(u, mu)
-                    - (2 * u * mP2 * mb2) / power_of<2>(mb2 - q2 + u2 * mP2) * lcdas->phi3s(u, mu)
+                    kernels.phi3s(u) / u
+                    - (mb2 + q2 - u2 * mP2) / (2 * (mb2 - q2 + u2 * mP2)) * kernels.phi3s_d1(u)
+                    - (2 * u * mP2 * mb2) / power_of<2>(mb2 - q2 + u2 * mP2) * kernels.phi3s(u)
                 ) / 3.0;
             const double tw3b = 2.0 / u * (mb2 - q2 - u2 * mP2) / (mb2 - q2 + u2 * mP2)
                 * (I3_d1(u) - (2.0 * u * mP2) / (mb2 - q2 + u2 * mP2) * I3(u));
@@ -578,6 +659,7 @@ namespace eos
             const double a2pi = lcdas->a2(mu);
             const double delta4 = lcdas->delta4(mu);
             const double omega4 = lcdas->omega4(mu);
+            const KernelTable & kernels = _kernels();
 
             // auxilliary functions and their first derivatives
             auto I4 = [&] (const double & u) -> double
@@ -651,11 +733,11 @@ namespace eos
                 {
                     const double u2 = u * u;
 
-                    const double tw4psi = u * lcdas->psi4(u, mu) + (mb2 - q2 - u2 * mP2) / (mb2 - q2 + u2 * mP2) * lcdas->psi4_i(u, mu);
+                    const double tw4psi = u * kernels.psi4(u) + (mb2 - q2 - u2 * mP2) / (mb2 - q2 + u2 * mP2) * kernels.psi4_i(u);
                     const double tw4phi = (
-                            lcdas->phi4_d2(u, mu)
-                            - 6.0 * u * mP2 / (mb2 - q2 + u2 * mP2) * lcdas->phi4_d1(u, mu)
-                            + 12.0 * u * mP4 / power_of<2>(mb2 - q2 + u2 * mP2) * lcdas->phi4(u, mu)
+                            kernels.phi4_d2(u)
+                            - 6.0 * u * mP2 / (mb2 - q2 + u2 * mP2) * kernels.phi4_d1(u)
+                            + 12.0 * u * mP4 / power_of<2>(mb2 - q2 + u2 * mP2) * kernels.phi4(u)
                         ) * mb2 * u / (4 * (mb2 - q2 + u2 * mP2));
                     const double tw4I4 = I4_d1(u) - 2.0 * u * mP2 / (mb2 - q2 + u2 * mP2) * I4(u);
                     const double tw4I4bar1 = (u * I4bar_d1(u) + (mb2 - q2 - 3.0 * u2 * mP2) / (mb2 - q2 + u2 * mP2) * I4bar(u)) * 2.0 * u * mP2 / (mb2 - q2 + u2 * mP2);
@@ -1095,9 +1177,11 @@ namespace eos
                 );
             };
 
+            const KernelTable & kernels = _kernels();
+
             const double u2 = u * u;
-            const double tw3a = lcdas->phi3p(u, mu) / u
-                + 1 / (6 * u) * lcdas->phi3s_d1(u, mu);
+            const double tw3a = kernels.phi3p(u) / u
+                + 1 / (6 * u) * kernels.phi3s_d1(u);
             const double tw3b = mP2 / (mb2 - q2 + u2 * mP2)
                 * (I3til_d1(u) - (2.0 * u * mP2) / (mb2 - q2 + u2 * mP2) * I3til(u));
 
@@ -1127,6 +1211,7 @@ namespace eos
             const double a2pi = lcdas->a2(mu);
             const double delta4 = lcdas->delta4(mu);
             const double omega4 = lcdas->omega4(mu);
+            const KernelTable & kernels = _kernels();
 
             // auxilliary functions and their first derivatives
             auto I4bar = [&] (const double & u) -> double
@@ -1178,7 +1263,7 @@ namespace eos
                 {
                     const double u2 = u * u;
 
-                    const double tw4psi = lcdas->psi4(u, mu) - (2.0 * u * mP2) / (mb2 - q2 + u2 * mP2) * lcdas->psi4_i(u, mu);
+                    const double tw4psi = kernels.psi4(u) - (2.0 * u * mP2) / (mb2 - q2 + u2 * mP2) * kernels.psi4_i(u);
                     const double tw4I4bar = (- I4bar_d1(u) + (6.0 * u * mP2) / (mb2 - q2 + u2 * mP2) * I4bar(u) + (12.0 * u2 * mP4) / power_of<2>(mb2 - q2 + u2 * mP2) * I4barI(u)) * 2.0 * u * mP2 / (mb2 - q2 + u2 * mP2);
 
                     // _select_weight:
@@ -1462,13 +1547,14 @@ namespace eos
         double FT_lo_tw2_integrand(const double & u, const double & q2, const double & _M2, const double & _select_weight) const
         {
             const double mb = this->m_b_msbar(mu), mb2 = mb * mb, mP2 = mP * mP;
+            const KernelTable & kernels = _kernels();
 
             // _select_weight:
             //  0.0 -> regular integral
             //  1.0 -> integral of derivative w.r.t. -1/M^2
             const double weight = (1.0 - _select_weight) + _select_weight * (mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / u;
 
-            return weight * std::exp(-(mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / (u * _M2)) / u * this->lcdas->phi(u, mu);
+            return weight * std::exp(-(mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / (u * _M2)) / u * kernels.phi(u);
         }
 
         double FT_lo_tw2(const double & q2, const double & _M2, const double & _select_weight = 0.0) const
@@ -1486,6 +1572,7 @@ namespace eos
             const double mb = this->m_b_msbar(mu), mb2 = mb * mb, mP2 = mP * mP;
             const double mu3 = lcdas->mu3(mu);
             const double u2 = u * u;
+            const KernelTable & kernels = _kernels();
 
             // _select_weight:
             //  0.0 -> regular integral
@@ -1493,7 +1580,7 @@ namespace eos
             const double weight = (1.0 - _select_weight) + _select_weight * (mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / u;
 
             return - mb * mu3 * weight * std::exp(-(mb2 - q2 * (1.0 - u) + mP2 * u * (1.0 - u)) / (u * _M2))
-                * (lcdas->phi3s_d1(u, mu) - 2 * u * mP2 * lcdas->phi3s(u, mu) / (mb2 - q2 + u2 * mP2)) / (3.0 * (mb2 - q2 + u2 * mP2));
+                * (kernels.phi3s_d1(u) - 2 * u * mP2 * kernels.phi3s(u) / (mb2 - q2 + u2 * mP2)) / (3.0 * (mb2 - q2 + u2 * mP2));
         }
 
         double FT_lo_tw3(const double & q2, const double & _M2, const double & _select_weight = 0.0) const
@@ -1513,6 +1600,7 @@ namespace eos
             const double a2pi = lcdas->a2(mu);
             const double delta4 = lcdas->delta4(mu);
             const double omega4 = lcdas->omega4(mu);
+            const KernelTable & kernels = _kernels();
 
             // auxilliary functions and their first derivatives
             auto I4T = [&] (const double & u) -> double
@@ -1552,8 +1640,8 @@ namespace eos
                 {
                     const double u2 = u * u;
 
-                    const double tw4phi1 = (lcdas->phi4_d1(u, mu) - 2 * u * mP2 * lcdas->phi4(u, mu) / (mb2 - q2 + u2 * mP2)) / 4.0;
-                    const double tw4phi2 = - mb2 * u * (lcdas->phi4_d2(u, mu) - 6.0 * u * mP2 * lcdas->phi4_d1(u, mu) / (mb2 - q2 + u2 * mP2) + 12.0 * u * mP4 * lcdas->phi4(u, mu) / power_of<2>(mb2 - q2 + u2 * mP2))
+                    const double tw4phi1 = (kernels.phi4_d1(u) - 2 * u * mP2 * kernels.phi4(u) / (mb2 - q2 + u2 * mP2)) / 4.0;
+                    const double tw4phi2 = - mb2 * u * (kernels.phi4_d2(u) - 6.0 * u * mP2 * kernels.phi4_d1(u) / (mb2 - q2 + u2 * mP2) + 12.0 * u * mP4 * kernels.phi4(u) / power_of<2>(mb2 - q2 + u2 * mP2))
                         / (4.0 * (mb2 - q2 + u2 * mP2));
                     const double tw4I4T = - (I4T_d1(u) - 2.0 * u * mP2 * I4T(u) / (mb2 - q2 + u2 * mP2));
 
@@ -24,6 +24,7 @@
 
 #include <eos/form-factors/analytic-b-to-v-lcsr.hh>
 #include <eos/form-factors/heavy-meson-lcdas.hh>
+#include <eos/form-factors/lcsr-disk-cache.hh>
 #include <eos/utils/exception.hh>
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
@@ -34,6 +35,8 @@
 #include <eos/utils/qcd.hh>
 #include <eos/utils/stringify.hh>
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -102,6 +105,11 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_t23B_2pt;
         bool switch_borel;
 
+        // handles for the persistent memoisation of the sum-rule results
+        Parameters parameters;
+        const ParameterUser & parameter_user;
+        std::string cache_tag_prefix;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -133,7 +141,11 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            parameters(p),
+            parameter_user(u),
+            cache_tag_prefix(stringify(Process_::B) + "->" + stringify(Process_::V) + "@B-LCSR[2pt=" + opt_2pt.value()
+                    + ",3pt=" + opt_3pt.value() + ",method=" + opt_method.value() + "]::")
         {
             u.uses(*b_lcdas);
 
@@ -3713,7 +3725,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a1_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_a1_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_A1_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -3723,8 +3735,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_A1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_A1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_A1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_A1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A1_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -3743,7 +3755,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A1_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_A1_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A1_2pt_borel, this, std::placeholders::_1, q2);
@@ -3756,8 +3768,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_A1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_A1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A1_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A1_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -6469,7 +6481,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a2_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_a2_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_A2_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -6479,8 +6491,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_A2_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_A2_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_A2_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_A2_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A2_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A2_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -6499,7 +6511,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A2_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_A2_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A2_2pt_borel, this, std::placeholders::_1, q2);
@@ -6512,8 +6524,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A2_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A2_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_A2_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_A2_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A2_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A2_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -9221,7 +9233,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_a30_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_a30_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_A30_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -9231,8 +9243,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_A30_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_A30_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_A30_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_A30_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A30_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A30_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -9251,7 +9263,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A30_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_A30_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A30_2pt_borel, this, std::placeholders::_1, q2);
@@ -9264,8 +9276,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_A30_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_A30_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_A30_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_A30_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_A30_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_A30_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -11550,7 +11562,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_v_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_v_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_V_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -11560,8 +11572,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_V_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_V_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_V_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_V_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_V_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_V_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -11580,7 +11592,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_V_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_V_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_V_2pt_borel, this, std::placeholders::_1, q2);
@@ -11593,8 +11605,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_V_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_V_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_V_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_V_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_V_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_V_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -14199,7 +14211,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t1_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_t1_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_T1_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -14209,8 +14221,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_T1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_T1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_T1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_T1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T1_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -14229,7 +14241,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T1_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_T1_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T1_2pt_borel, this, std::placeholders::_1, q2);
@@ -14242,8 +14254,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_T1_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_T1_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T1_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T1_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -17089,7 +17101,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t23A_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_t23A_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_T23A_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -17099,8 +17111,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_T23A_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_T23A_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_T23A_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_T23A_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23A_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23A_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -17119,7 +17131,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23A_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_T23A_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23A_2pt_borel, this, std::placeholders::_1, q2);
@@ -17132,8 +17144,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T23A_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T23A_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_T23A_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_T23A_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T23A_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T23A_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -20272,7 +20284,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B());
 
-            const std::function<double (const double &)> integrand_2pt = std::bind(integrand_t23B_2pt, this, std::placeholders::_1, q2);
+            const auto integrand_2pt = std::bind(integrand_t23B_2pt, this, std::placeholders::_1, q2);
 
             const double integral_2pt = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
             const double surface_2pt  = 0.0 - surface_T23B_2pt(switch_borel ? sigma_0 : 0.0, q2);
@@ -20282,8 +20294,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B = std::bind(&Implementation::surface_T23B_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C = std::bind(&Implementation::surface_T23B_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B = std::bind(&Implementation::surface_T23B_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C = std::bind(&Implementation::surface_T23B_3pt_C, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23B_3pt, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23B_3pt_A, this, std::placeholders::_1, sigma_0, q2);
 
@@ -20302,7 +20314,7 @@ namespace eos
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23B_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const auto integrand_2pt_m1 = std::bind(&Implementation::integrand_T23B_2pt_borel_m1, this, std::placeholders::_1, q2);
 
 
             const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23B_2pt_borel, this, std::placeholders::_1, q2);
@@ -20315,8 +20327,8 @@ namespace eos
 
             if (switch_3pt != 0.0)
             {
-                const std::function<double (const double &)> surface_3pt_B_m1 = std::bind(&Implementation::surface_T23B_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C_m1 = std::bind(&Implementation::surface_T23B_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_B_m1 = std::bind(&Implementation::surface_T23B_3pt_B_m1, this, std::placeholders::_1, sigma_0, q2);
+                const auto surface_3pt_C_m1 = std::bind(&Implementation::surface_T23B_3pt_C_m1, this, std::placeholders::_1, sigma_0, q2);
                 const std::function<double (const std::array<double, 3> &)> integrand_3pt_m1 = std::bind(&Implementation::integrand_T23B_3pt_m1, this, std::placeholders::_1, q2);
                 const std::function<double (const std::array<double, 2> &)> surface_3pt_A_m1 = std::bind(&Implementation::surface_T23B_3pt_A_m1, this, std::placeholders::_1, sigma_0, q2);
 
@@ -23124,6 +23136,51 @@ namespace eos
             return results;
         }
 
+        /* persistent memoisation of the sum-rule results */
+
+        std::uint64_t _parameter_hash() const
+        {
+            // FNV-1a hash over the values of all used parameters; the mass of the
+            // virtual quark enters through the model and is not registered with the
+            // ParameterUser, so it is mixed in explicitly
+            std::uint64_t hash = 14695981039346656037ull;
+
+            auto mix = [&hash] (const double & value) -> void
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+
+                for (unsigned i = 0 ; i < sizeof(bits) ; ++i)
+                {
+                    hash ^= (bits >> (8 * i)) & 0xffu;
+                    hash *= 1099511628211ull;
+                }
+            };
+
+            for (const auto & id : parameter_user)
+            {
+                mix(parameters[id].evaluate());
+            }
+            mix(m_v());
+
+            return hash;
+        }
+
+        double _cached(double (Implementation::* function)(const double &) const, const char * name, const double & q2) const
+        {
+            auto * cache = LCSRDiskCache::instance();
+            const std::uint64_t parameter_hash = _parameter_hash();
+
+            double result;
+            if (cache->lookup(cache_tag_prefix + name, parameter_hash, q2, result))
+                return result;
+
+            result = (this->*function)(q2);
+            cache->store(cache_tag_prefix + name, parameter_hash, q2, result);
+
+            return result;
+        }
+
     };
 
     template <typename Process_>
@@ -23160,21 +23217,21 @@ namespace eos
         const double m_B = this->_imp->m_B();
         const double m_V = this->_imp->m_V();
 
-        return ((m_B + m_V) * this->_imp->a_1(q2) - (m_B - m_V) * this->_imp->a_2(q2) - 2.0 * m_V * this->_imp->a_30(q2)) / (2.0 * m_V);
+        return ((m_B + m_V) * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_1, "a_1", q2) - (m_B - m_V) * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_2, "a_2", q2) - 2.0 * m_V * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_30, "a_30", q2)) / (2.0 * m_V);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::a_1(const double & q2) const
     {
-        return this->_imp->a_1(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_1, "a_1", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::a_2(const double & q2) const
     {
-        return this->_imp->a_2(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_2, "a_2", q2);
     }
 
     template <typename Process_>
@@ -23187,21 +23244,21 @@ namespace eos
         const double c_1 = (m_B + m_V) * (m_B * m_B - m_V * m_V - q2) / (16.0 * m_B * m_V * m_V);
         const double c_2 = eos::lambda(m_B * m_B, m_V * m_V, q2) / (16.0 * m_B * m_V * m_V * (m_B + m_V));
 
-        return c_1 * this->_imp->a_1(q2) - c_2 * this->_imp->a_2(q2);
+        return c_1 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_1, "a_1", q2) - c_2 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::a_2, "a_2", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::v(const double & q2) const
     {
-        return this->_imp->v(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::v, "v", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::t_1(const double & q2) const
     {
-        return this->_imp->t_1(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_1, "t_1", q2);
     }
 
     template <typename Process_>
@@ -23214,14 +23271,14 @@ namespace eos
         const double c_1 = (power_of<2>(m_B) - power_of<2>(m_V) - q2) / (power_of<2>(m_B) - power_of<2>(m_V));
         const double c_2 = 2.0 * q2 / (power_of<2>(m_B) - power_of<2>(m_V));
 
-        return c_1 * this->_imp->t_23A(q2) + c_2 * this->_imp->t_23B(q2);
+        return c_1 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23A, "t_23A", q2) + c_2 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23B, "t_23B", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::t_3(const double & q2) const
     {
-        return 1.0 * this->_imp->t_23A(q2) - 2.0 * this->_imp->t_23B(q2);
+        return 1.0 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23A, "t_23A", q2) - 2.0 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23B, "t_23B", q2);
     }
 
     template <typename Process_>
@@ -23236,57 +23293,57 @@ namespace eos
         const double c_3 = (power_of<2>(m_B) - power_of<2>(m_V) - q2) / (power_of<2>(m_B) - power_of<2>(m_V));
         const double c_4 = 2.0 * q2 / (power_of<2>(m_B) - power_of<2>(m_V));
 
-        return c_1 * (c_3 * this->_imp->t_23A(q2) + c_4 * this->_imp->t_23B(q2))
-             + c_2 * (1.0 * this->_imp->t_23A(q2) - 2.0 * this->_imp->t_23B(q2));
+        return c_1 * (c_3 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23A, "t_23A", q2) + c_4 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23B, "t_23B", q2))
+             + c_2 * (1.0 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23A, "t_23A", q2) - 2.0 * this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::t_23B, "t_23B", q2));
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_a_1(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_a_1(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_a_1, "normalized_moment_1_a_1", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_a_2(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_a_2(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_a_2, "normalized_moment_1_a_2", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_a_30(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_a_30(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_a_30, "normalized_moment_1_a_30", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_v(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_v(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_v, "normalized_moment_1_v", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_t_1(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_t_1(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_t_1, "normalized_moment_1_t_1", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_t_23A(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_t_23A(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_t_23A, "normalized_moment_1_t_23A", q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::normalized_moment_1_t_23B(const double & q2) const
     {
-        return this->_imp->normalized_moment_1_t_23B(q2);
+        return this->_imp->_cached(&Implementation<AnalyticFormFactorBToVLCSR<Process_>>::normalized_moment_1_t_23B, "normalized_moment_1_t_23B", q2);
     }
 
     template <typename Process_>
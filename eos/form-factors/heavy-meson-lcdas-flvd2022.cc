@@ -27,6 +27,7 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -39,6 +40,7 @@ namespace eos
     {
         FLvD2022::FLvD2022(const Parameters & p, const Options & o) :
             model(Model::make("SM", p, o)),
+            parameters(p),
             opt_Q(o, options, "Q"),
             opt_q(o, options, "q"),
             opt_gminus(o, options, "gminus"),
@@ -56,7 +58,10 @@ namespace eos
                 UsedParameter(p[parameter("a^phi+_6")], *this),
                 UsedParameter(p[parameter("a^phi+_7")], *this),
                 UsedParameter(p[parameter("a^phi+_8")], *this)
-            })
+            }),
+            cached_mu(0.0),
+            cached_generation(0),
+            cached(false)
         {
             // Verify the size of Weights used internally
             Weights weights;
@@ -120,8 +125,18 @@ namespace eos
         std::tuple<HeavyMesonLCDAs::CoefficientIterator, HeavyMesonLCDAs::CoefficientIterator>
         FLvD2022::coefficient_range(const double & mu) const
         {
+            // serve the RG-evolved coefficients from the cache if neither the scale
+            // nor any parameter has changed since the last query; this collapses the
+            // cost of the nested RGE integrals below, which would otherwise be paid
+            // anew on every evaluation inside e.g. the B->gamma l nu omega-integrals
+            const std::uint64_t generation = parameters.generation();
+            if (cached && (mu == cached_mu) && (generation == cached_generation))
+            {
+                return {cached_values.begin(), cached_values.end()};
+            }
+
             // copy values to array of doubles
-            static thread_local std::array<double, number_of_parameters> values;
+            Weights & values = cached_values;
             for (size_t i = 0; i < values.size(); i++)
             {
                 values[i] = a[i]; // evaluates UsedParameter
@@ -203,6 +218,10 @@ namespace eos
                 values = gsl_sf_gamma(2.0 - g) * std::exp(V) * std::pow(mu_0 * exp_2eulergamma / (2.0 * omega_0), -g) * rge_matrix * values;
             }
 
+            cached_mu = mu;
+            cached_generation = generation;
+            cached = true;
+
             return {values.begin(), values.end()};
         }
 
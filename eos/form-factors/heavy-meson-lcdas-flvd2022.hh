@@ -30,6 +30,7 @@
 #include <eos/utils/reference-name.hh>
 
 #include <array>
+#include <cstdint>
 #include <string>
 #include <tuple>
 
@@ -49,6 +50,8 @@ namespace eos
 
                 std::shared_ptr<Model> model;
 
+                Parameters parameters;
+
                 QuarkFlavorOption opt_Q;
                 QuarkFlavorOption opt_q;
                 SpecifiedOption opt_gminus;
@@ -63,6 +66,13 @@ namespace eos
 
                 std::string parameter(const char * _name) const;
 
+                // cache of the RG-evolved coefficients as returned by coefficient_range();
+                // valid for the recorded scale and parameter generation
+                mutable Weights cached_values;
+                mutable double cached_mu;
+                mutable std::uint64_t cached_generation;
+                mutable bool cached;
+
                 static const std::vector<OptionSpecification> options;
 
             public:
@@ -93,6 +93,18 @@ class FLvD2022Test :
                 {
                     TEST_CHECK_NEARLY_EQUAL(*it, res_evolved[std::distance(c, it)], 1e-7);
                 }
+
+                // a second query at the same scale is served from the cache
+                auto [c2, c2_end] = blcdas.coefficient_range(mu);
+                for (auto it = c2 ; it != c2_end ; ++it)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(*it, res_evolved[std::distance(c2, it)], 1e-7);
+                }
+
+                // changing a parameter invalidates the cache
+                p["B_u::a^phi+_0@FLvD2022"] = 2.0 * ref[0];
+                auto [c3, c3_end] = blcdas.coefficient_range(mu);
+                TEST_CHECK(std::abs(*c3 - res_evolved[0]) > 1e-7);
             }
 
             // pseudo-observables tildephi and the derivative
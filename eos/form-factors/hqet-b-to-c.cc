@@ -25,25 +25,65 @@
 #include <eos/maths/power-of.hh>
 #include <eos/utils/stringify.hh>
 
+#include <cstdint>
+
 namespace eos
 {
     template <>
     struct Implementation<HQETBToC>
     {
+        // kept to detect parameter changes via the generation counter, cf. _alpha_s_inputs()
+        Parameters parameters;
+
         std::shared_ptr<Model> model;
 
         UsedParameter m_b_msbar;
         UsedParameter m_c_msbar;
 
+        /*
+         * Cached strong coupling at the three fixed scales m_b, m_c and mu_match.
+         *
+         * Every Wilson coefficient needs the same three RGE evolutions of alpha_s;
+         * they depend only on the quark masses, so we recompute them only when the
+         * parameters change.
+         */
+        struct AlphaSInputs
+        {
+            double mb, mc, m;
+        };
+
+        mutable AlphaSInputs alpha_s_cache;
+        mutable std::uint64_t alpha_s_generation;
+        mutable bool alpha_s_valid;
 
         Implementation(const Parameters & p, const Options &, ParameterUser & u) :
+            parameters(p),
             model(Model::make("SM", p, Options{ })),
             m_b_msbar(p["mass::b(MSbar)"], u),
-            m_c_msbar(p["mass::c"], u)
+            m_c_msbar(p["mass::c"], u),
+            alpha_s_generation(0),
+            alpha_s_valid(false)
         {
             u.uses(*model);
         }
 
+        const AlphaSInputs & _alpha_s_inputs() const
+        {
+            const std::uint64_t generation = parameters.generation();
+
+            if ((! alpha_s_valid) || (generation != alpha_s_generation))
+            {
+                alpha_s_cache.mb = model->alpha_s(m_b_msbar());
+                alpha_s_cache.mc = model->alpha_s(m_c_msbar());
+                alpha_s_cache.m  = model->alpha_s(mu_match());
+
+                alpha_s_generation = generation;
+                alpha_s_valid      = true;
+            }
+
+            return alpha_s_cache;
+        }
+
         ~Implementation() = default;
 
         /* auxilliary functions from [N1993] */
@@ -171,10 +211,10 @@ namespace eos
             return sqrt(m_b_msbar() * m_c_msbar());
         }
 
-        // universal mu-dependence of the Wilson coefficients
+        // universal mu-dependence of the Wilson coefficients; we work at mu = m_c
         inline double K_hh(const double & omega) const
         {
-            const double alpha_s_mu = model->alpha_s(mu());
+            const double alpha_s_mu = _alpha_s_inputs().mc;
 
             return pow(alpha_s_mu, -a_hh(omega)) * (1.0 - alpha_s_mu / M_PI * Z_hh(omega));
         }
@@ -182,10 +222,9 @@ namespace eos
         // universal prefactor A
         inline double A(const double & omega) const
         {
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
+            const AlphaSInputs & as = _alpha_s_inputs();
 
-            return pow(alpha_s_mc / alpha_s_mb, 6.0 / 25.0) * pow(alpha_s_mc, a_hh(omega));
+            return pow(as.mc / as.mb, 6.0 / 25.0) * pow(as.mc, a_hh(omega));
         }
 
         // h_2(z, omega) is defined in [N1993] eq. (3.129), p. 70
@@ -221,9 +260,10 @@ namespace eos
         {
             static const double Z_4 = -9403.0 / 7500.0 - 7.0 * M_PI * M_PI / 225.0;
 
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double G          = g(z, omega) + 3.0 * omega * z * log(z);
@@ -236,9 +276,10 @@ namespace eos
         }
         double Chat_2_v(const double & omega) const
         {
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double h1         = h_2(1.0 / z, omega) - 2.0 * r(omega) + 1.0;
@@ -253,9 +294,10 @@ namespace eos
         }
         double Chat_3_v(const double & omega) const
         {
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double h2         = h_2(z, omega);
@@ -271,9 +313,10 @@ namespace eos
         {
             static const double Z_4 = -9403.0 / 7500.0 - 7.0 * M_PI * M_PI / 225.0;
 
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double G          = g(z, omega) + 3.0 * omega * z * log(z);
@@ -286,9 +329,10 @@ namespace eos
         }
         double Chat_2_a(const double & omega) const
         {
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double h1         = h_2_5(1.0 / z, omega) - 2.0 * r(omega) - 1.0;
@@ -303,9 +347,10 @@ namespace eos
         }
         double Chat_3_a(const double & omega) const
         {
-            const double alpha_s_mb = model->alpha_s(m_b_msbar());
-            const double alpha_s_mc = model->alpha_s(m_c_msbar());
-            const double alpha_s_m  = model->alpha_s(mu_match());
+            const AlphaSInputs & as = _alpha_s_inputs();
+            const double alpha_s_mb = as.mb;
+            const double alpha_s_mc = as.mc;
+            const double alpha_s_m  = as.m;
             const double x          = alpha_s_mc / alpha_s_mb;
             const double z          = m_c_msbar() / m_b_msbar();
             const double h2         = h_2_5(z, omega);
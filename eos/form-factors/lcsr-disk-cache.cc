@@ -0,0 +1,239 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/form-factors/lcsr-disk-cache.hh>
+#include <eos/utils/binary-io.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/stringify.hh>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <unistd.h>
+
+namespace fs = boost::filesystem;
+
+namespace eos
+{
+    namespace
+    {
+        const char lcsr_cache_magic[8] = { 'E', 'O', 'S', 'L', 'C', '0', '1', '\n' };
+
+        // flush to disk after this many newly computed entries, to bound the
+        // amount of work lost if the process terminates abnormally
+        const unsigned lcsr_cache_flush_interval = 256;
+
+        fs::path
+        lcsr_cache_path()
+        {
+            if (std::getenv("EOS_DISABLE_LCSR_CACHE"))
+                return fs::path();
+
+            if (std::getenv("XDG_CACHE_HOME"))
+                return fs::path(std::getenv("XDG_CACHE_HOME")) / "eos" / "lcsr-form-factors.cache";
+
+            if (std::getenv("HOME"))
+                return fs::path(std::getenv("HOME")) / ".cache" / "eos" / "lcsr-form-factors.cache";
+
+            return fs::path();
+        }
+    }
+
+    std::size_t
+    LCSRDiskCache::KeyHash::operator() (const Key & key) const
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &key.q2, sizeof(bits));
+
+        std::uint64_t result = key.parameter_hash;
+        result ^= (bits + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2));
+        result ^= (key.tag + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2));
+
+        return result;
+    }
+
+    LCSRDiskCache::LCSRDiskCache() :
+        _mutex(new Mutex),
+        _dirty(0)
+    {
+        _load();
+    }
+
+    LCSRDiskCache::~LCSRDiskCache()
+    {
+        if (_dirty > 0)
+        {
+            _flush();
+        }
+
+        delete _mutex;
+    }
+
+    std::uint32_t
+    LCSRDiskCache::_intern(const std::string & tag)
+    {
+        auto i = _tag_map.find(tag);
+
+        if (_tag_map.end() != i)
+            return i->second;
+
+        const std::uint32_t index = _tag_names.size();
+        _tag_map[tag] = index;
+        _tag_names.push_back(tag);
+
+        return index;
+    }
+
+    void
+    LCSRDiskCache::_load()
+    {
+        const fs::path cache = lcsr_cache_path();
+
+        if (cache.empty() || ! fs::is_regular_file(cache))
+            return;
+
+        try
+        {
+            std::ifstream in(cache.string(), std::ios::binary);
+            in.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
+
+            char magic[sizeof(lcsr_cache_magic)];
+            in.read(magic, sizeof(magic));
+            if (! std::equal(std::begin(magic), std::end(magic), std::begin(lcsr_cache_magic)))
+                return;
+
+            const std::uint32_t n_tags = binary_io::read<std::uint32_t>(in);
+            std::vector<std::uint32_t> tag_indices;
+            tag_indices.reserve(n_tags);
+            for (std::uint32_t i = 0 ; i < n_tags ; ++i)
+            {
+                tag_indices.push_back(_intern(binary_io::read_string(in)));
+            }
+
+            const std::uint32_t n_entries = binary_io::read<std::uint32_t>(in);
+            for (std::uint32_t i = 0 ; i < n_entries ; ++i)
+            {
+                const std::uint32_t tag   = binary_io::read<std::uint32_t>(in);
+                const std::uint64_t hash  = binary_io::read<std::uint64_t>(in);
+                const double        q2    = binary_io::read<double>(in);
+                const double        value = binary_io::read<double>(in);
+
+                if (tag >= n_tags)
+                    return;
+
+                _entries.insert(std::make_pair(Key{ tag_indices[tag], hash, q2 }, value));
+            }
+        }
+        catch (std::exception &)
+        {
+            // treat an unreadable or corrupt store as empty; it will be
+            // rewritten on the next flush
+        }
+    }
+
+    void
+    LCSRDiskCache::_flush()
+    {
+        const fs::path cache = lcsr_cache_path();
+
+        if (cache.empty())
+            return;
+
+        try
+        {
+            fs::create_directories(cache.parent_path());
+
+            // pick up entries that other processes stored since our last load
+            _load();
+
+            // write to a temporary file first, so that concurrent processes never
+            // observe a partially written store
+            const fs::path tmp = cache.string() + ".tmp." + stringify(::getpid());
+
+            {
+                std::ofstream out(tmp.string(), std::ios::binary | std::ios::trunc);
+                out.exceptions(std::ios::badbit | std::ios::failbit);
+
+                out.write(lcsr_cache_magic, sizeof(lcsr_cache_magic));
+
+                binary_io::write<std::uint32_t>(out, _tag_names.size());
+                for (const auto & tag : _tag_names)
+                {
+                    binary_io::write_string(out, tag);
+                }
+
+                binary_io::write<std::uint32_t>(out, _entries.size());
+                for (const auto & [key, value] : _entries)
+                {
+                    binary_io::write<std::uint32_t>(out, key.tag);
+                    binary_io::write<std::uint64_t>(out, key.parameter_hash);
+                    binary_io::write<double>(out, key.q2);
+                    binary_io::write<double>(out, value);
+                }
+            }
+
+            fs::rename(tmp, cache);
+
+            _dirty = 0;
+        }
+        catch (std::exception &)
+        {
+            // failure to persist the store is not an error; the results are
+            // merely recomputed by the next process
+        }
+    }
+
+    bool
+    LCSRDiskCache::lookup(const std::string & tag, const std::uint64_t & parameter_hash, const double & q2, double & value)
+    {
+        Lock l(*_mutex);
+
+        auto t = _tag_map.find(tag);
+        if (_tag_map.end() == t)
+            return false;
+
+        auto i = _entries.find(Key{ t->second, parameter_hash, q2 });
+        if (_entries.end() == i)
+            return false;
+
+        value = i->second;
+
+        return true;
+    }
+
+    void
+    LCSRDiskCache::store(const std::string & tag, const std::uint64_t & parameter_hash, const double & q2, const double & value)
+    {
+        Lock l(*_mutex);
+
+        _entries[Key{ _intern(tag), parameter_hash, q2 }] = value;
+
+        if (++_dirty >= lcsr_cache_flush_interval)
+        {
+            _flush();
+        }
+    }
+
+    template class InstantiationPolicy<LCSRDiskCache, Singleton>;
+}
@@ -0,0 +1,106 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_FORM_FACTORS_LCSR_DISK_CACHE_HH
+#define EOS_GUARD_EOS_FORM_FACTORS_LCSR_DISK_CACHE_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/mutex.hh>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Persistent memoisation of LCSR sum-rule results.
+     *
+     * Each entry maps a (form factor, parameter hash, q2) triple to the value of
+     * the corresponding sum rule. Entries are merged into an on-disk store shared
+     * by all EOS processes of one user, so that repeated evaluations of the same
+     * sum rule at the same parameter point skip the numerical integration, even
+     * across process restarts. The store can be disabled by setting the
+     * EOS_DISABLE_LCSR_CACHE environment variable.
+     */
+    class LCSRDiskCache :
+        public InstantiationPolicy<LCSRDiskCache, Singleton>
+    {
+        private:
+            struct Key
+            {
+                std::uint32_t tag;
+                std::uint64_t parameter_hash;
+                double q2;
+
+                bool operator== (const Key & other) const
+                {
+                    return (tag == other.tag) && (parameter_hash == other.parameter_hash) && (q2 == other.q2);
+                }
+            };
+
+            struct KeyHash
+            {
+                std::size_t operator() (const Key & key) const;
+            };
+
+            Mutex * const _mutex;
+
+            // form-factor tags are interned; entries refer to them by index
+            std::unordered_map<std::string, std::uint32_t> _tag_map;
+            std::vector<std::string> _tag_names;
+
+            std::unordered_map<Key, double, KeyHash> _entries;
+
+            // number of entries added since the last flush to disk
+            unsigned _dirty;
+
+            std::uint32_t _intern(const std::string & tag);
+
+            // merge the on-disk store into our entries; silently starts from an
+            // empty store if the file is absent, stale, or corrupt
+            void _load();
+
+            // merge our entries back into the on-disk store
+            void _flush();
+
+        public:
+            LCSRDiskCache();
+
+            ~LCSRDiskCache();
+
+            ///@name Access
+            ///@{
+            /*!
+             * Retrieve a previously stored sum-rule result.
+             *
+             * Returns false on a cache miss, in which case value is left untouched.
+             */
+            bool lookup(const std::string & tag, const std::uint64_t & parameter_hash, const double & q2, double & value);
+
+            /*!
+             * Store a sum-rule result for later retrieval, possibly by another process.
+             */
+            void store(const std::string & tag, const std::uint64_t & parameter_hash, const double & q2, const double & value);
+            ///@}
+    };
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace eos
 {
@@ -90,6 +91,24 @@ namespace eos
             static std::shared_ptr<FormFactors<PToV>> create(const QualifiedName & name, const Parameters & parameters, const Options & options = Options{ });
             static OptionSpecification option_specification(const qnp::Prefix & process);
             static OptionSpecification option_specification();
+
+            /*!
+             * Create a form factor object of a statically known parametrization.
+             *
+             * In contrast to create(), the returned pointer carries the concrete
+             * type. Amplitude code that fixes its parametrization at compile time
+             * can thereby inline the form factor evaluations into its kernels,
+             * rather than paying one virtual call per form factor and phase-space
+             * point.
+             */
+            template <typename FormFactor_>
+            static std::shared_ptr<FormFactor_> create_concrete(const Parameters & parameters, const Options & options = Options{ })
+            {
+                static_assert(std::is_base_of<FormFactors<PToV>, FormFactor_>::value,
+                        "create_concrete() requires a parametrization of the P->V form factors");
+
+                return std::make_shared<FormFactor_>(parameters, options);
+            }
     };
 
     template <>
@@ -200,6 +219,24 @@ namespace eos
             static std::shared_ptr<FormFactors<PToP>> create(const QualifiedName & label, const Parameters & parameters, const Options & options = Options{ });
             static OptionSpecification option_specification(const qnp::Prefix & process);
             static OptionSpecification option_specification();
+
+            /*!
+             * Create a form factor object of a statically known parametrization.
+             *
+             * In contrast to create(), the returned pointer carries the concrete
+             * type. Amplitude code that fixes its parametrization at compile time
+             * can thereby inline the evaluations of f_+, f_0 and f_T into its
+             * kernels, rather than paying one virtual call per form factor and
+             * phase-space point.
+             */
+            template <typename FormFactor_>
+            static std::shared_ptr<FormFactor_> create_concrete(const Parameters & parameters, const Options & options = Options{ })
+            {
+                static_assert(std::is_base_of<FormFactors<PToP>, FormFactor_>::value,
+                        "create_concrete() requires a parametrization of the P->P form factors");
+
+                return std::make_shared<FormFactor_>(parameters, options);
+            }
     };
 
     template <>
@@ -23,6 +23,8 @@
 #include <eos/form-factors/parametric-bcl2008.hh>
 #include <eos/utils/exception.hh>
 
+#include <limits>
+
 namespace eos
 {
     template <typename Process_>
@@ -38,6 +40,32 @@ namespace eos
             / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
     }
 
+    template <typename Process_>
+    const std::array<double, 3> &
+    BCL2008FormFactorBase<Process_, 3u, false>::_zbar(const double & s) const
+    {
+        // one cache per thread: z depends only on s and on compile-time
+        // process constants, so the cache can be shared across instances
+        // but not across threads
+        struct Context
+        {
+            double s = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 3> zbar;
+        };
+        static thread_local Context context;
+
+        if (s != context.s)
+        {
+            const double z = _z(s),   z2 = z * z,     z3 = z * z2;
+            const double z0 = _z(0),  z02 = z0 * z0,  z03 = z0 * z02;
+
+            context.zbar = {{ z - z0, z2 - z02, z3 - z03 }};
+            context.s    = s;
+        }
+
+        return context.zbar;
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 3u, false>::BCL2008FormFactorBase(const Parameters & p, const Options &) :
         _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -53,25 +81,21 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 3u, false>::f_p(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+        const std::array<double, 3> & zbar = _zbar(s);
 
-        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar - z3bar / 3.0) + _b_plus_2 * (z2bar + 2.0 * z3bar / 3.0));
+        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar[0] - zbar[2] / 3.0) + _b_plus_2 * (zbar[1] + 2.0 * zbar[2] / 3.0));
     }
 
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 3u, false>::f_0(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+        const std::array<double, 3> & zbar = _zbar(s);
 
         // note that f_0(0) = f_+(0)!
         // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
         // other coefficients!
-        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar);
+        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar[0] + _b_zero_2 * zbar[1] + _b_zero_3 * zbar[2]);
     }
 
     template <typename Process_>
@@ -105,6 +129,32 @@ namespace eos
             / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
     }
 
+    template <typename Process_>
+    const std::array<double, 4> &
+    BCL2008FormFactorBase<Process_, 4u, false>::_zbar(const double & s) const
+    {
+        // one cache per thread: z depends only on s and on compile-time
+        // process constants, so the cache can be shared across instances
+        // but not across threads
+        struct Context
+        {
+            double s = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 4> zbar;
+        };
+        static thread_local Context context;
+
+        if (s != context.s)
+        {
+            const double z = _z(s),   z2 = z * z,     z3 = z * z2,    z4 = z * z3;
+            const double z0 = _z(0),  z02 = z0 * z0,  z03 = z0 * z02, z04 = z0 * z03;
+
+            context.zbar = {{ z - z0, z2 - z02, z3 - z03, z4 - z04 }};
+            context.s    = s;
+        }
+
+        return context.zbar;
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 4u, false>::BCL2008FormFactorBase(const Parameters & p, const Options &) :
         _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -122,25 +172,21 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 4u, false>::f_p(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+        const std::array<double, 4> & zbar = _zbar(s);
 
-        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar + z4bar / 4.0) + _b_plus_2 * (z2bar - z4bar / 2.0) + _b_plus_3 * (z3bar + 3.0 * z4bar / 4.0));
+        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar[0] + zbar[3] / 4.0) + _b_plus_2 * (zbar[1] - zbar[3] / 2.0) + _b_plus_3 * (zbar[2] + 3.0 * zbar[3] / 4.0));
     }
 
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 4u, false>::f_0(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+        const std::array<double, 4> & zbar = _zbar(s);
 
         // note that f_0(0) = f_+(0)!
         // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
         // other coefficients!
-        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar + _b_zero_4 * z4bar);
+        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar[0] + _b_zero_2 * zbar[1] + _b_zero_3 * zbar[2] + _b_zero_4 * zbar[3]);
     }
 
     template <typename Process_>
@@ -174,6 +220,32 @@ namespace eos
             / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
     }
 
+    template <typename Process_>
+    const std::array<double, 5> &
+    BCL2008FormFactorBase<Process_, 5u, false>::_zbar(const double & s) const
+    {
+        // one cache per thread: z depends only on s and on compile-time
+        // process constants, so the cache can be shared across instances
+        // but not across threads
+        struct Context
+        {
+            double s = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 5> zbar;
+        };
+        static thread_local Context context;
+
+        if (s != context.s)
+        {
+            const double z = _z(s),   z2 = z * z,     z3 = z * z2,    z4 = z * z3,    z5 = z * z4;
+            const double z0 = _z(0),  z02 = z0 * z0,  z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
+
+            context.zbar = {{ z - z0, z2 - z02, z3 - z03, z4 - z04, z5 - z05 }};
+            context.s    = s;
+        }
+
+        return context.zbar;
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 5u, false>::BCL2008FormFactorBase(const Parameters & p, const Options &) :
         _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -194,25 +266,21 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 5u, false>::f_p(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+        const std::array<double, 5> & zbar = _zbar(s);
 
-        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar - z5bar / 5.0) + _b_plus_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_plus_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_plus_4 * (z4bar + 4.0 * z5bar / 5.0));
+        return _f_plus_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_plus_1 * (zbar[0] - zbar[4] / 5.0) + _b_plus_2 * (zbar[1] + 2.0 * zbar[4] / 5.0) + _b_plus_3 * (zbar[2] - 3.0 * zbar[4] / 5.0) + _b_plus_4 * (zbar[3] + 4.0 * zbar[4] / 5.0));
     }
 
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 5u, false>::f_0(const double & s) const
     {
-        const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-        const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+        const std::array<double, 5> & zbar = _zbar(s);
 
         // note that f_0(0) = f_+(0)!
         // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
         // other coefficients!
-        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar + _b_zero_4 * z4bar + _b_zero_5 * z5bar);
+        return _f_plus_0 / (1.0 - s / Process_::mR2_0p) * (1.0 + _b_zero_1 * zbar[0] + _b_zero_2 * zbar[1] + _b_zero_3 * zbar[2] + _b_zero_4 * zbar[3] + _b_zero_5 * zbar[4]);
     }
 
     template <typename Process_>
@@ -246,11 +314,9 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 3u, true>::f_t(const double & s) const
     {
-        const double z = this->_z(s), z2 = z * z, z3 = z * z2;
-        const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+        const std::array<double, 3> & zbar = this->_zbar(s);
 
-        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z3bar / 3.0) + _b_t_2 * (z2bar + 2.0 * z3bar / 3.0));
+        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar[0] - zbar[2] / 3.0) + _b_t_2 * (zbar[1] + 2.0 * zbar[2] / 3.0));
     }
 
     template <typename Process_>
@@ -268,11 +334,9 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 4u, true>::f_t(const double & s) const
     {
-        const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-        const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+        const std::array<double, 4> & zbar = this->_zbar(s);
 
-        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar + z4bar / 4.0) + _b_t_2 * (z2bar - z4bar / 2.0) + _b_t_3 * (z3bar + 3.0 * z4bar / 4.0));
+        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar[0] + zbar[3] / 4.0) + _b_t_2 * (zbar[1] - zbar[3] / 2.0) + _b_t_3 * (zbar[2] + 3.0 * zbar[3] / 4.0));
     }
 
     template <typename Process_>
@@ -291,11 +355,9 @@ namespace eos
     double
     BCL2008FormFactorBase<Process_, 5u, true>::f_t(const double & s) const
     {
-        const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-        const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-        const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+        const std::array<double, 5> & zbar = this->_zbar(s);
 
-        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z5bar / 5.0) + _b_t_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_t_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_t_4 * (z4bar + 4.0 * z5bar / 5.0));
+        return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar[0] - zbar[4] / 5.0) + _b_t_2 * (zbar[1] + 2.0 * zbar[4] / 5.0) + _b_t_3 * (zbar[2] - 3.0 * zbar[4] / 5.0) + _b_t_4 * (zbar[3] + 4.0 * zbar[4] / 5.0));
     }
 
     template <typename Process_, unsigned K_>
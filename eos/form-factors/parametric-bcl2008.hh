@@ -25,6 +25,8 @@
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/options.hh>
 
+#include <array>
+
 namespace eos
 {
     /* Form Factors according to [BCL2008] */
@@ -49,9 +51,16 @@ namespace eos
             UsedParameter _f_plus_0, _b_plus_1, _b_plus_2;
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3;
 
+            // shared series context: powers z^k(s) - z^k(0), computed once per
+            // q^2 and reused by all form factors of the transition; the cache
+            // lives in thread-local storage within _zbar, since observables
+            // may evaluate one form-factor object from several threads at once
+
         protected:
             double _z(const double & s) const;
 
+            const std::array<double, 3> & _zbar(const double & s) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -77,9 +86,16 @@ namespace eos
             UsedParameter _f_plus_0, _b_plus_1, _b_plus_2, _b_plus_3;
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4;
 
+            // shared series context: powers z^k(s) - z^k(0), computed once per
+            // q^2 and reused by all form factors of the transition; the cache
+            // lives in thread-local storage within _zbar, since observables
+            // may evaluate one form-factor object from several threads at once
+
         protected:
             double _z(const double & s) const;
 
+            const std::array<double, 4> & _zbar(const double & s) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -105,9 +121,16 @@ namespace eos
             UsedParameter _f_plus_0, _b_plus_1, _b_plus_2, _b_plus_3, _b_plus_4;
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4, _b_zero_5;
 
+            // shared series context: powers z^k(s) - z^k(0), computed once per
+            // q^2 and reused by all form factors of the transition; the cache
+            // lives in thread-local storage within _zbar, since observables
+            // may evaluate one form-factor object from several threads at once
+
         protected:
             double _z(const double & s) const;
 
+            const std::array<double, 5> & _zbar(const double & s) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -63,27 +63,23 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
 
-        double result = 1.0 + as * (_CV1(w, z) + (w + 1.0) / 2.0 * (_CV2(w, z) + _CV3(w, z)));
+        double result = 1.0 + as * (c.CV1 + (w + 1.0) / 2.0 * (c.CV2 + c.CV3));
         result += eps_c * (L1);
         result += eps_b * (L1);
-        result += eps_c * eps_c * _l1(w);
+        result += eps_c * eps_c * c.l1;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -93,26 +89,23 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L4 = 2.0 * eta - 1.0;
+        const double L4 = 2.0 * c.eta - 1.0;
 
-        double result = (0.0 + as * (w + 1.0) / 2.0 * (_CV2(w, z) - _CV3(w, z)));
+        double result = (0.0 + as * (w + 1.0) / 2.0 * (c.CV2 - c.CV3));
         result += eps_c * L4;
         result -= eps_b * L4;
-        result += eps_c * eps_c * _l4(w);
+        result += eps_c * eps_c * c.l4;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -122,29 +115,24 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
 
-        double result = (1.0 + as * _CS(w, z));
+        double result = (1.0 + as * c.CS);
         result += eps_c * (L1 - (w - 1.0) / (w + 1.0) * L4);
         result += eps_b * (L1 - (w - 1.0) / (w + 1.0) * L4);
-        result += eps_c * eps_c * (_l1(w) - (w - 1.0) / (w + 1.0) * _l4(w));
+        result += eps_c * eps_c * (c.l1 - (w - 1.0) / (w + 1.0) * c.l4);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -154,32 +142,26 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
 
-        double result = 1.0 + as * (_CT1(w, z) - _CT2(w, z) + _CT3(w, z));
+        double result = 1.0 + as * (c.CT1 - c.CT2 + c.CT3);
         result += eps_c * (L1 - L4);
         result += eps_b * (L1 - L4);
-        result += eps_c * eps_c * (_l1(w) - _l4(w));
+        result += eps_c * eps_c * (c.l1 - c.l4);
 
-        return result * xi;
+        return result * c.xi;
     }
 
-
     template <typename Process_>
     HQETFormFactors<Process_, PToP>::HQETFormFactors(const Parameters & p, const Options & o) :
         HQETFormFactorBase(p, o, Process_::hqe_prefix),
@@ -434,60 +416,50 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
 
-        double result = (1.0 + as * _CA1(w, z));
+        double result = (1.0 + as * c.CA1);
         result += eps_c * (L2 - L5 * (w - 1.0) / (w + 1.0));
         result += eps_b * (L1 - L4 * (w - 1.0) / (w + 1.0));
-        result += eps_c * eps_c * (_l2(w) - (w - 1.0) / (w + 1.0) * _l5(w));
+        result += eps_c * eps_c * (c.l2 - (w - 1.0) / (w + 1.0) * c.l5);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
     double
     HQETFormFactors<Process_, PToV>::_h_a2(const double & q2) const
     {
-        const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 + as * _CA2(w, z));
+        double result = (0.0 + as * c.CA2);
         result += eps_c * (L3 + L6);
-        result += eps_c * eps_c * (_l3(w) + _l6(w));
+        result += eps_c * eps_c * (c.l3 + c.l6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -497,33 +469,28 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L3 = 4.0 * chi2;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L3 = 4.0 * c.chi2;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (1.0 + as * (_CA1(w, z) +_CA3(w, z)));
+        double result = (1.0 + as * (c.CA1 +c.CA3));
         result += eps_c * (L2 - L3 + L6 - L5);
         result += eps_b * (L1 - L4);
-        result += eps_c * eps_c * (_l2(w) - _l3(w) + _l6(w) - _l5(w));
+        result += eps_c * eps_c * (c.l2 - c.l3 + c.l6 - c.l5);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -533,31 +500,26 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
 
-        double result = (1.0 + as * _CV1(w, z));
+        double result = (1.0 + as * c.CV1);
         result += eps_c * (L2 - L5);
         result += eps_b * (L1 - L4);
-        result += eps_c * eps_c * (_l2(w) - _l5(w));
+        result += eps_c * eps_c * (c.l2 - c.l5);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -567,28 +529,24 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
 
-        double result = (1.0 + as * (_CT1(w, z) + (w - 1.0) / 2.0 * (_CT2(w, z) - _CT3(w, z))));
+        double result = (1.0 + as * (c.CT1 + (w - 1.0) / 2.0 * (c.CT2 - c.CT3)));
         result += eps_c * L2;
         result += eps_b * L1;
-        result += eps_c * eps_c * _l2(w);
+        result += eps_c * eps_c * c.l2;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -598,56 +556,48 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L4 = 2.0 * eta - 1.0;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
 
-        double result = (0.0 + as * (w + 1.0) / 2.0 * (_CT2(w, z) + _CT3(w, z)));
+        double result = (0.0 + as * (w + 1.0) / 2.0 * (c.CT2 + c.CT3));
         result += eps_c * L5;
         result -= eps_b * L4;
-        result += eps_c * eps_c * _l5(w);
+        result += eps_c * eps_c * c.l5;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
     double
     HQETFormFactors<Process_, PToV>::_h_t3(const double & q2) const
     {
-        const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 + as * _CT2(w, z));
+        double result = (0.0 + as * c.CT2);
         result += eps_c * (L6 - L3);
-        result += eps_c * eps_c * (_l6(w) - _l3(w));
+        result += eps_c * eps_c * (c.l6 - c.l3);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -682,7 +632,6 @@ namespace eos
         return option_specifications.cend();
     }
 
-
     template <typename Process_>
     FormFactors<PToV> *
     HQETFormFactors<Process_, PToV>::make(const Parameters & parameters, const Options & options)
@@ -1048,31 +997,26 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
 
-        double result = (1.0 + as * _CA1(w, z));
+        double result = (1.0 + as * c.CA1);
         result += eps_c * (L1 - L4 * (w - 1.0) / (w + 1.0));
         result += eps_b * (L2 - L5 * (w - 1.0) / (w + 1.0));
-        result += eps_c * eps_c * (_l1(w) - _l4(w) * (w - 1.0) / (w + 1.0));
+        result += eps_c * eps_c * (c.l1 - c.l4 * (w - 1.0) / (w + 1.0));
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1080,27 +1024,22 @@ namespace eos
     HQETFormFactors<Process_, VToP>::h_abar_2(const double & q2) const
     {
         const double m_b_pole = _m_b_pole();
-        const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 - as * _CA3(w, z));
+        double result = (0.0 - as * c.CA3);
         result += eps_b * (L3 + L6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1110,33 +1049,28 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L3 = 4.0 * chi2;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L3 = 4.0 * c.chi2;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (1.0 + as * (_CA1(w, z) - _CA2(w, z)));
+        double result = (1.0 + as * (c.CA1 - c.CA2));
         result += eps_b * (L2 - L3 + L6 - L5);
         result += eps_c * (L1 - L4);
-        result += eps_c * eps_c * (_l1(w) - _l4(w));
+        result += eps_c * eps_c * (c.l1 - c.l4);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1146,31 +1080,26 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-        const double L2 = -4.0 * chi3;
-        const double L4 = 2.0 * eta - 1.0;
+        const double L1 = -4.0 * (w - 1.0) * c.chi2 + 12.0 * c.chi3;
+        const double L2 = -4.0 * c.chi3;
+        const double L4 = 2.0 * c.eta - 1.0;
         const double L5 = -1.0;
 
-        double result = (1.0 + as * _CV1(w, z));
+        double result = (1.0 + as * c.CV1);
         result += eps_b * (L2 - L5);
         result += eps_c * (L1 - L4);
-        result += eps_c * eps_c * (_l1(w) - _l4(w));
+        result += eps_c * eps_c * (c.l1 - c.l4);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1372,26 +1301,23 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L2 = -4.0 * chi3;
+        const double L2 = -4.0 * c.chi3;
 
-        double result = 1.0 + as * (_CV1(w, z) + (w + 1.0) / 2.0 * (_CV2(w, z) + _CV3(w, z)));
+        double result = 1.0 + as * (c.CV1 + (w + 1.0) / 2.0 * (c.CV2 + c.CV3));
         result += eps_c * L2;
         result += eps_b * L2;
-        result += eps_c * eps_c * _l2(w);
+        result += eps_c * eps_c * c.l2;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1401,25 +1327,23 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
         const double L5 = -1.0;
 
-        double result = as * (w + 1.0) / 2.0 * (_CV2(w, z) - _CV3(w, z));
+        double result = as * (w + 1.0) / 2.0 * (c.CV2 - c.CV3);
         result += eps_c * L5;
         result -= eps_b * L5;
-        result += eps_c * eps_c * _l5(w);
+        result += eps_c * eps_c * c.l5;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1429,31 +1353,26 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L2 = -4.0 * chi3;
-        const double L3 = 4.0 * chi2;
+        const double L2 = -4.0 * c.chi3;
+        const double L3 = 4.0 * c.chi2;
         const double L5 = -1.0;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (1.0 + as * _CV1(w, z));
+        double result = (1.0 + as * c.CV1);
         result += eps_c * (L2 + L5 + (w - 1.0) * L3 - (w + 1.0) * L6);
         result += eps_b * (L2 - L5);
-        result += eps_c * eps_c * (_l2(w) + _l5(w) + (w - 1.0) * _l3(w) - (w + 1.0) * _l6(w));
+        result += eps_c * eps_c * (c.l2 + c.l5 + (w - 1.0) * c.l3 - (w + 1.0) * c.l6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1463,60 +1382,50 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L2 = -4.0 * chi3;
-        const double L3 = 4.0 * chi2;
+        const double L2 = -4.0 * c.chi3;
+        const double L3 = 4.0 * c.chi2;
         const double L5 = -1.0;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (1.0 + as * _CV1(w, z));
+        double result = (1.0 + as * c.CV1);
         result += eps_b * (L2 + L5 + (w - 1.0) * L3 - (w + 1.0) * L6);
         result += eps_c * (L2 - L5);
-        result += eps_c * eps_c * (_l2(w) - _l5(w));
+        result += eps_c * eps_c * (c.l2 - c.l5);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
     double
     HQETFormFactors<Process_, VToV>::h_5(const double & q2) const
     {
-        const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 - as * _CV2(w, z));
+        double result = (0.0 - as * c.CV2);
         result += eps_c * (L3 - L6);
-        result += eps_c * eps_c * (_l3(w) - _l6(w));
+        result += eps_c * eps_c * (c.l3 - c.l6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1524,27 +1433,22 @@ namespace eos
     HQETFormFactors<Process_, VToV>::h_6(const double & q2) const
     {
         const double m_b_pole = _m_b_pole();
-        const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 - as * _CV3(w, z));
+        double result = (0.0 - as * c.CV3);
         result += eps_b * (L3 - L6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     // axial current
@@ -1555,26 +1459,23 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double chi3 = _chi3(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L2 = -4.0 * chi3;
+        const double L2 = -4.0 * c.chi3;
 
-        double result = 1.0 + as * (_CA1(w, z) + (w - 1.0) / 2.0 * (_CA2(w, z) - _CA3(w, z)));
+        double result = 1.0 + as * (c.CA1 + (w - 1.0) / 2.0 * (c.CA2 - c.CA3));
         result += eps_b * L2;
         result += eps_c * L2;
-        result += eps_c * eps_c * _l2(w);
+        result += eps_c * eps_c * c.l2;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1584,54 +1485,47 @@ namespace eos
         const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
         const double L5 = -1.0;
 
-        double result = as * (w + 1.0) / 2.0 * (_CA2(w, z) + _CA3(w, z));
+        double result = as * (w + 1.0) / 2.0 * (c.CA2 + c.CA3);
         result += eps_c * L5;
         result -= eps_b * L5;
-        result += eps_c * eps_c * _l5(w);
+        result += eps_c * eps_c * c.l5;
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
     double
     HQETFormFactors<Process_, VToV>::h_9(const double & q2) const
     {
-        const double m_b_pole = _m_b_pole();
         const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 - as * _CA2(w, z));
+        double result = (0.0 - as * c.CA2);
         result += eps_c * (L3 - L6);
-        result += eps_c * eps_c * (_l3(w) - _l6(w));
+        result += eps_c * eps_c * (c.l3 - c.l6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
@@ -1639,27 +1533,22 @@ namespace eos
     HQETFormFactors<Process_, VToV>::h_10(const double & q2) const
     {
         const double m_b_pole = _m_b_pole();
-        const double m_c_pole = _m_c_pole();
 
-        const double w = this->_w(q2);
-        const double z = m_c_pole / m_b_pole;
+        const auto & c = _context_at(q2);
+        const double w = c.w;
 
         const double as = _alpha_s() / M_PI;
 
-        const double xi  = _xi(q2);
-        const double eta = _eta(q2);
-        const double chi2 = _chi2(q2);
-
         const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
 
         // chi_1 is absorbed into def. of xi for LP and LV
-        const double L3 = 4.0 * chi2;
-        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+        const double L3 = 4.0 * c.chi2;
+        const double L6 = -2.0 * (1.0 + c.eta) / (w + 1.0);
 
-        double result = (0.0 + as * _CA3(w, z));
+        double result = (0.0 + as * c.CA3);
         result += eps_b * (L3 - L6);
 
-        return result * xi;
+        return result * c.xi;
     }
 
     template <typename Process_>
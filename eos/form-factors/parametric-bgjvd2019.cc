@@ -20,6 +20,8 @@
 #include <eos/form-factors/parametric-bgjvd2019-impl.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <cstdint>
+
 namespace eos
 {
     std::string
@@ -35,6 +37,7 @@ namespace eos
     }
 
     HQETFormFactorBase::HQETFormFactorBase(const Parameters & p, const Options & o, const std::string & prefix) :
+        _parameters(p),
         _model(Model::make("SM", p, o)),
         _mBar(p[prefix + "::mBar@HQET"], *this),
         _a(p[prefix + "::a@HQET"], *this),
@@ -79,7 +82,10 @@ namespace eos
         _l5ppone(p[_sslp_prefix(prefix) + "::l_5''(1)@HQET"], *this),
         _l6one(p[_sslp_prefix(prefix) + "::l_6(1)@HQET"], *this),
         _l6pone(p[_sslp_prefix(prefix) + "::l_6'(1)@HQET"], *this),
-        _l6ppone(p[_sslp_prefix(prefix) + "::l_6''(1)@HQET"], *this)
+        _l6ppone(p[_sslp_prefix(prefix) + "::l_6''(1)@HQET"], *this),
+        _context_q2(std::numeric_limits<double>::quiet_NaN()),
+        _context_generation(0),
+        _context_valid(false)
     {
         using std::placeholders::_1;
 
@@ -115,6 +121,50 @@ namespace eos
     {
     };
 
+    const HQETFormFactorBase::EvaluationContext &
+    HQETFormFactorBase::_context_at(const double & q2) const
+    {
+        const std::uint64_t generation = _parameters.generation();
+
+        if (_context_valid && (q2 == _context_q2) && (generation == _context_generation))
+            return _context;
+
+        const double w = _w(q2);
+        const double z = _m_c_pole() / _m_b_pole();
+
+        _context.w    = w;
+
+        _context.xi   = _xi(q2);
+        _context.chi2 = _chi2(q2);
+        _context.chi3 = _chi3(q2);
+        _context.eta  = _eta(q2);
+
+        _context.l1   = _l1(w);
+        _context.l2   = _l2(w);
+        _context.l3   = _l3(w);
+        _context.l4   = _l4(w);
+        _context.l5   = _l5(w);
+        _context.l6   = _l6(w);
+
+        _context.CS   = _CS(w, z);
+        _context.CP   = _CP(w, z);
+        _context.CV1  = _CV1(w, z);
+        _context.CV2  = _CV2(w, z);
+        _context.CV3  = _CV3(w, z);
+        _context.CA1  = _CA1(w, z);
+        _context.CA2  = _CA2(w, z);
+        _context.CA3  = _CA3(w, z);
+        _context.CT1  = _CT1(w, z);
+        _context.CT2  = _CT2(w, z);
+        _context.CT3  = _CT3(w, z);
+
+        _context_q2         = q2;
+        _context_generation = generation;
+        _context_valid      = true;
+
+        return _context;
+    }
+
     // uses a power series ansatz
     double
     HQETFormFactorBase::_xi_power_series(const double & q2) const
@@ -33,6 +33,7 @@
 #include <eos/maths/power-of.hh>
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 
 namespace eos
@@ -44,6 +45,9 @@ namespace eos
         public virtual ParameterUser
     {
         protected:
+            // kept to detect parameter changes via the generation counter, cf. _context_at()
+            Parameters _parameters;
+
             std::shared_ptr<Model> _model;
 
             // spin avaraged mB mass
@@ -98,8 +102,40 @@ namespace eos
             UsedParameter _l5one, _l5pone, _l5ppone;
             UsedParameter _l6one, _l6pone, _l6ppone;
 
+            /*
+             * Per-kinematic-point evaluation context.
+             *
+             * All form factor components of one transition evaluated at the same q2
+             * share the (w, z) expansion basis: the Isgur-Wise functions, the
+             * subsubleading power corrections, and the one-loop matching coefficients.
+             * Observables combine several components at identical q2, so we compute
+             * the basis once per (q2, parameter generation) and reuse it, cf. _context_at().
+             */
+            struct EvaluationContext
+            {
+                double w;
+
+                // Isgur-Wise functions
+                double xi, chi2, chi3, eta;
+
+                // subsubleading power corrections
+                double l1, l2, l3, l4, l5, l6;
+
+                // one-loop matching coefficients
+                double CS, CP, CV1, CV2, CV3, CA1, CA2, CA3, CT1, CT2, CT3;
+            };
+
+            mutable EvaluationContext _context;
+            mutable double _context_q2;
+            mutable std::uint64_t _context_generation;
+            mutable bool _context_valid;
+
             std::string _sslp_prefix(const std::string & prefix);
 
+            // returns the evaluation context at q2, recomputing it only if q2 or
+            // the parameter generation changed since the last call
+            const EvaluationContext & _context_at(const double & q2) const;
+
         public:
             HQETFormFactorBase(const Parameters & p, const Options & o, const std::string & prefix);
             ~HQETFormFactorBase();
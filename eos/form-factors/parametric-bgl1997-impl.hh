@@ -26,10 +26,12 @@
 #include <eos/form-factors/parametric-bgl1997.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/models/model.hh>
+#include <eos/maths/dual.hh>
 #include <eos/maths/power-of.hh>
 
 #include <gsl/gsl_sf_dilog.h>
 
+#include <limits>
 #include <numeric>
 
 namespace eos
@@ -111,13 +113,43 @@ namespace eos
                * 1.0 / std::pow(sq_tp_t + sq_tp, c + 3.0);
     }
 
+    template<typename Process_>
+    const std::array<double, 4> &
+    BGL1997FormFactors<Process_, PToV>::_z_powers(const double & s) const
+    {
+        // one cache per thread: z depends only on the key (s, t_0, t_+), so
+        // the cache can be shared across instances but not across threads
+        struct Context
+        {
+            double s   = std::numeric_limits<double>::quiet_NaN();
+            double t_0 = std::numeric_limits<double>::quiet_NaN();
+            double t_p = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 4> zn;
+        };
+        static thread_local Context context;
+
+        const double t_0 = _traits.t_0(), t_p = _traits.tp();
+
+        if ((s != context.s) || (t_0 != context.t_0) || (t_p != context.t_p))
+        {
+            const double z = _traits._z(s, t_0, t_p);
+
+            context.zn  = {{ 1.0, z, z * z, z * z * z }};
+            context.s   = s;
+            context.t_0 = t_0;
+            context.t_p = t_p;
+        }
+
+        return context.zn;
+    }
+
     // Functions
     template<typename Process_>
     double BGL1997FormFactors<Process_, PToV>::g(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 96, 3, 3, 1, _traits.chi_1m);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_g[0] + _a_g[1] * z + _a_g[2] * z * z + _a_g[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_g[0] * zn[0] + _a_g[1] * zn[1] + _a_g[2] * zn[2] + _a_g[3] * zn[3];
         const double blaschke = _traits.blaschke_1m(s);
 
         return series / phi / blaschke;
@@ -127,8 +159,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::f(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 24, 1, 1, 1, _traits.chi_1p);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_f[0] + _a_f[1] * z + _a_f[2] * z * z + _a_f[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_f[0] * zn[0] + _a_f[1] * zn[1] + _a_f[2] * zn[2] + _a_f[3] * zn[3];
         const double blaschke = _traits.blaschke_1p(s);
 
         return series / phi / blaschke;
@@ -155,8 +187,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::F1(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 48, 1, 1, 2, _traits.chi_1p);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = a_F1_0() + _a_F1[0] * z + _a_F1[1] * z * z + _a_F1[2] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = a_F1_0() * zn[0] + _a_F1[0] * zn[1] + _a_F1[1] * zn[2] + _a_F1[2] * zn[3];
         const double blaschke = _traits.blaschke_1p(s);
 
         return series / phi / blaschke;
@@ -186,8 +218,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::F2(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 64, 3, 3, 1, _traits.chi_0m);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = a_F2_0() + _a_F2[0] * z + _a_F2[1] * z * z + _a_F2[2] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = a_F2_0() * zn[0] + _a_F2[0] * zn[1] + _a_F2[1] * zn[2] + _a_F2[2] * zn[3];
         const double blaschke = _traits.blaschke_0m(s);
 
         return series / phi / blaschke;
@@ -227,8 +259,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::t_1(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 24.0, 3, 3, 2, _traits.chi_T_1m);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_T1[0] + _a_T1[1] * z + _a_T1[2] * z * z + _a_T1[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_T1[0] * zn[0] + _a_T1[1] * zn[1] + _a_T1[2] * zn[2] + _a_T1[3] * zn[3];
         const double blaschke = _traits.blaschke_1m(s);
 
         return series / phi / blaschke;
@@ -255,8 +287,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::t_2(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 24.0 / (_traits.tp() * _traits.tm()), 1, 1, 2, _traits.chi_T_1p);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = a_T2_0() + _a_T2[0] * z + _a_T2[1] * z * z + _a_T2[2] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = a_T2_0() * zn[0] + _a_T2[0] * zn[1] + _a_T2[1] * zn[2] + _a_T2[2] * zn[3];
         const double blaschke = _traits.blaschke_1p(s);
 
         return series / phi / blaschke;
@@ -292,8 +324,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToV>::t_23(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 3.0 * _traits.tp() / (power_of<2>(_mB) * power_of<2>(_mV)), 1.0, 1.0, 1.0, _traits.chi_T_1p);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = a_T23_0() + _a_T23[0] * z + _a_T23[1] * z * z + _a_T23[2] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = a_T23_0() * zn[0] + _a_T23[0] * zn[1] + _a_T23[1] * zn[2] + _a_T23[2] * zn[3];
         const double blaschke = _traits.blaschke_1p(s);
 
         return series / phi / blaschke;
@@ -421,12 +453,42 @@ namespace eos
                * 1.0 / std::pow(sq_tp_t + sq_tp, c + 3.0);
     }
 
+    template<typename Process_>
+    const std::array<double, 4> &
+    BGL1997FormFactors<Process_, PToP>::_z_powers(const double & s) const
+    {
+        // one cache per thread: z depends only on the key (s, t_0, t_+), so
+        // the cache can be shared across instances but not across threads
+        struct Context
+        {
+            double s   = std::numeric_limits<double>::quiet_NaN();
+            double t_0 = std::numeric_limits<double>::quiet_NaN();
+            double t_p = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 4> zn;
+        };
+        static thread_local Context context;
+
+        const double t_0 = _traits.t_0(), t_p = _traits.tp();
+
+        if ((s != context.s) || (t_0 != context.t_0) || (t_p != context.t_p))
+        {
+            const double z = _traits._z(s, t_0, t_p);
+
+            context.zn  = {{ 1.0, z, z * z, z * z * z }};
+            context.s   = s;
+            context.t_0 = t_0;
+            context.t_p = t_p;
+        }
+
+        return context.zn;
+    }
+
     template<typename Process_>
     double BGL1997FormFactors<Process_, PToP>::f_p(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 48, 3, 3, 2, _traits.chi_1m);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_f_p[0] + _a_f_p[1] * z + _a_f_p[2] * z * z + _a_f_p[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_f_p[0] * zn[0] + _a_f_p[1] * zn[1] + _a_f_p[2] * zn[2] + _a_f_p[3] * zn[3];
         const double blaschke = _traits.blaschke_1m(s);
 
         return series / phi / blaschke;
@@ -436,8 +498,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToP>::f_0(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 16, 1, 1, 1, _traits.chi_0p);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_f_0[0] + _a_f_0[1] * z + _a_f_0[2] * z * z + _a_f_0[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_f_0[0] * zn[0] + _a_f_0[1] * zn[1] + _a_f_0[2] * zn[2] + _a_f_0[3] * zn[3];
         const double blaschke = _traits.blaschke_0p(s);
 
         return series / phi / blaschke;
@@ -447,8 +509,8 @@ namespace eos
     double BGL1997FormFactors<Process_, PToP>::f_t(const double & s) const
     {
         const double phi      = _phi(s, _traits.t_0, 48.0 * _traits.tp(), 3, 3, 1, _traits.chi_T_1m);
-        const double z        = _traits._z(s, _traits.t_0, _traits.tp());
-        const double series   = _a_f_t[0] + _a_f_t[1] * z + _a_f_t[2] * z * z + _a_f_t[3] * z * z * z;
+        const auto & zn       = _z_powers(s);
+        const double series   = _a_f_t[0] * zn[0] + _a_f_t[1] * zn[1] + _a_f_t[2] * zn[2] + _a_f_t[3] * zn[3];
         const double blaschke = _traits.blaschke_1m(s);
 
         return series / phi / blaschke;
@@ -460,6 +522,45 @@ namespace eos
         return 0.0; //  TODO
     }
 
+    template<typename Process_>
+    std::pair<double, std::array<double, 4>>
+    BGL1997FormFactors<Process_, PToP>::_with_gradient(const double & s, const std::array<UsedParameter, 4> & a,
+            const double & phi, const double & blaschke) const
+    {
+        const auto & zn = _z_powers(s);
+        const double norm = 1.0 / (phi * blaschke);
+
+        Dual<4> series;
+        for (unsigned i = 0 ; i < a.size() ; ++i)
+        {
+            series += Dual<4>(a[i], i) * zn[i];
+        }
+        const Dual<4> result = series * norm;
+
+        return { result.value, result.gradient };
+    }
+
+    template<typename Process_>
+    std::pair<double, std::array<double, 4>>
+    BGL1997FormFactors<Process_, PToP>::f_p_with_gradient(const double & s) const
+    {
+        return _with_gradient(s, _a_f_p, _phi(s, _traits.t_0, 48, 3, 3, 2, _traits.chi_1m), _traits.blaschke_1m(s));
+    }
+
+    template<typename Process_>
+    std::pair<double, std::array<double, 4>>
+    BGL1997FormFactors<Process_, PToP>::f_0_with_gradient(const double & s) const
+    {
+        return _with_gradient(s, _a_f_0, _phi(s, _traits.t_0, 16, 1, 1, 1, _traits.chi_0p), _traits.blaschke_0p(s));
+    }
+
+    template<typename Process_>
+    std::pair<double, std::array<double, 4>>
+    BGL1997FormFactors<Process_, PToP>::f_t_with_gradient(const double & s) const
+    {
+        return _with_gradient(s, _a_f_t, _phi(s, _traits.t_0, 48.0 * _traits.tp(), 3, 3, 1, _traits.chi_T_1m), _traits.blaschke_1m(s));
+    }
+
     template<typename Process_>
     const std::set<ReferenceName> BGL1997FormFactors<Process_, PToP>::references
     {
@@ -35,6 +35,7 @@
 #include <eos/utils/options.hh>
 
 #include <array>
+#include <utility>
 
 namespace eos
 {
@@ -117,7 +118,10 @@ namespace eos
                 if (s > s_p)
                     throw InternalError("The real conformal mapping is used above threshold: " + stringify(s) + " > " + stringify(s_p));
 
-                return real(_z(complex<double>(s, 0.0), complex<double>(s_0, 0.0), complex<double>(s_p, 0.0)));
+                const double sq_sp_s  = std::sqrt(s_p - s);
+                const double sq_sp_s0 = std::sqrt(s_p - s_0);
+
+                return (sq_sp_s - sq_sp_s0) / (sq_sp_s + sq_sp_s0);
             }
 
             double blaschke_1m(const double & s) const
@@ -232,7 +236,10 @@ namespace eos
                 if (s > s_p)
                     throw InternalError("The real conformal mapping is used above threshold: " + stringify(s) + " > " + stringify(s_p));
 
-                return real(_z(complex<double>(s, 0.0), complex<double>(s_0, 0.0), complex<double>(s_p, 0.0)));
+                const double sq_sp_s  = std::sqrt(s_p - s);
+                const double sq_sp_s0 = std::sqrt(s_p - s_0);
+
+                return (sq_sp_s - sq_sp_s0) / (sq_sp_s + sq_sp_s0);
             }
 
             double blaschke_1m(const double & s) const
@@ -279,6 +286,12 @@ namespace eos
             const UsedParameter & _mV;
             const UsedParameter & t_0;
 
+            // shared series context: powers of z(s, t_0, t_+), computed once per
+            // q^2 and reused by all form factors of the transition; the cache
+            // lives in thread-local storage within _z_powers, since observables
+            // may evaluate one form-factor object from several threads at once
+            const std::array<double, 4> & _z_powers(const double & s) const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
@@ -347,6 +360,15 @@ namespace eos
             const UsedParameter & _mP;
             const UsedParameter & t_0;
 
+            // shared series context: powers of z(s, t_0, t_+), computed once per
+            // q^2 and reused by all form factors of the transition; the cache
+            // lives in thread-local storage within _z_powers, since observables
+            // may evaluate one form-factor object from several threads at once
+            const std::array<double, 4> & _z_powers(const double & s) const;
+
+            std::pair<double, std::array<double, 4>> _with_gradient(const double & s, const std::array<UsedParameter, 4> & a,
+                    const double & phi, const double & blaschke) const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
@@ -363,6 +385,20 @@ namespace eos
 
             virtual double f_plus_T(const double & s) const;
 
+            ///@name Combined value+gradient evaluation
+            ///@{
+            /*!
+             * Evaluate a form factor together with its gradient w.r.t. the four
+             * z-expansion coefficients in a single forward-mode pass; cf. dual.hh.
+             * The form factors are linear in their coefficients, so the gradient
+             * is exact up to rounding, at roughly the cost of one evaluation
+             * instead of the 2 * 4 evaluations of two-sided finite differences.
+             */
+            std::pair<double, std::array<double, 4>> f_p_with_gradient(const double & s) const;
+            std::pair<double, std::array<double, 4>> f_0_with_gradient(const double & s) const;
+            std::pair<double, std::array<double, 4>> f_t_with_gradient(const double & s) const;
+            ///@}
+
             Diagnostics diagnostics() const;
 
             static const std::vector<OptionSpecification> _options;
@@ -635,6 +635,24 @@ class BGL1997FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(-2.0), 0.161964,  eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+1.0), 0.177010,  eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(+4.0), 0.195134,  eps);
+
+                /* combined value+gradient evaluation: the value agrees with the
+                 * plain evaluation, and the gradient components are the form
+                 * factor values for unit coefficient vectors */
+                {
+                    const auto [value, gradient] = ff.f_p_with_gradient(+1.0);
+                    TEST_CHECK_NEARLY_EQUAL(value, ff.f_p(+1.0), eps);
+
+                    const std::array<double, 4> a{{ 0.4e-02, 0.3e-02, 0.2e-02, 0.1e-02 }};
+                    for (unsigned i = 0 ; i < 4 ; ++i)
+                    {
+                        for (unsigned j = 0 ; j < 4 ; ++j)
+                        {
+                            p["B->D::a^f+_" + stringify(j) + "@BGL1997"] = (i == j) ? 1.0 : 0.0;
+                        }
+                        TEST_CHECK_NEARLY_EQUAL(gradient[i], ff.f_p(+1.0), eps);
+                    }
+                }
             }
         }
 } BGL1997_form_factor_test;
@@ -23,6 +23,8 @@
 #include <eos/form-factors/parametric-bsz2015.hh>
 #include <eos/maths/power-of.hh>
 
+#include <limits>
+
 namespace eos
 {
     template <typename Process_>
@@ -70,6 +72,46 @@ namespace eos
                 (a_0 + a_1 * diff_z + a_2 * power_of<2>(diff_z));
     }
 
+    template <typename Process_>
+    const std::array<double, 3> &
+    BSZ2015FormFactors<Process_, PToV>::_z_powers(const double & s) const
+    {
+        // one cache per thread: z depends only on the key (s, tp, t0), so the
+        // cache can be shared across instances but not across threads
+        struct Context
+        {
+            double s  = std::numeric_limits<double>::quiet_NaN();
+            double tp = std::numeric_limits<double>::quiet_NaN();
+            double t0 = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 3> zpow;
+        };
+        static thread_local Context context;
+
+        const double tp = _traits.tp(), t0 = _traits.t0();
+
+        if ((s != context.s) || (tp != context.tp) || (t0 != context.t0))
+        {
+            const double diff_z = _traits.calc_z(s) - _traits.calc_z(0.0);
+
+            context.zpow = {{ 1.0, diff_z, diff_z * diff_z }};
+            context.s    = s;
+            context.tp   = tp;
+            context.t0   = t0;
+        }
+
+        return context.zpow;
+    }
+
+    template <typename Process_>
+    template <typename Parameter_>
+    double
+    BSZ2015FormFactors<Process_, PToV>::_calc_ff(const double & s, const double & m_R, const std::array<Parameter_, 3> & a) const
+    {
+        const std::array<double, 3> & zpow = _z_powers(s);
+
+        return (a[0] * zpow[0] + a[1] * zpow[1] + a[2] * zpow[2]) / (1.0 - s / power_of<2>(m_R));
+    }
+
     template <typename Process_>
     std::string
     BSZ2015FormFactors<Process_, PToV>::_par_name(const std::string & ff_name)
@@ -194,56 +236,75 @@ namespace eos
     double
     BSZ2015FormFactors<Process_, PToV>::v(const double & s) const
     {
-        return real(v(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1m, _a_V);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::a_0(const double & s) const
     {
-        return real(a_0(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_0m, _a_A0);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::a_1(const double & s) const
     {
-        return real(a_1(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1p, _a_A1);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::a_12(const double & s) const
     {
-        return real(a_12(complex<double>(s)));
+        // use constraint (B.6) in [BSZ2015] to remove A_12(0)
+        std::array<double, 3> values
+        {{
+            (power_of<2>(_mB) - power_of<2>(_mV)) / (8.0 * _mB * _mV) * _a_A0[0],
+            _a_A12[1 - 1],
+            _a_A12[2 - 1],
+        }};
+
+        return _calc_ff(s, _traits.m_R_1p, values);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::a_2(const double & s) const
     {
-        return real(a_2(complex<double>(s)));
+        const double lambda = eos::lambda(power_of<2>(_mB), power_of<2>(_mV), s);
+
+        return (power_of<2>(_mB + _mV) * (power_of<2>(_mB) - power_of<2>(_mV) - s) * a_1(s)
+                - 16.0 * _mB * power_of<2>(_mV) * (_mB + _mV) * a_12(s)) / lambda;
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::t_1(const double & s) const
     {
-        return real(t_1(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1m, _a_T1);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::t_2(const double & s) const
     {
-        return real(t_2(complex<double>(s)));
+        // use constraint T_1(0) = T_2(0) to replace T_2(0)
+        std::array<double, 3> values
+        {{
+            _a_T1[0],
+            _a_T2[1 - 1],
+            _a_T2[2 - 1],
+        }};
+
+        return _calc_ff(s, _traits.m_R_1p, values);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToV>::t_23(const double & s) const
     {
-        return real(t_23(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1p, _a_T23);
     }
 
     template <typename Process_>
@@ -344,6 +405,46 @@ namespace eos
                 (a_0 + a_1 * diff_z + a_2 * power_of<2>(diff_z));
     }
 
+    template <typename Process_>
+    const std::array<double, 3> &
+    BSZ2015FormFactors<Process_, PToP>::_z_powers(const double & s) const
+    {
+        // one cache per thread: z depends only on the key (s, tp, t0), so the
+        // cache can be shared across instances but not across threads
+        struct Context
+        {
+            double s  = std::numeric_limits<double>::quiet_NaN();
+            double tp = std::numeric_limits<double>::quiet_NaN();
+            double t0 = std::numeric_limits<double>::quiet_NaN();
+            std::array<double, 3> zpow;
+        };
+        static thread_local Context context;
+
+        const double tp = _traits.tp(), t0 = _traits.t0();
+
+        if ((s != context.s) || (tp != context.tp) || (t0 != context.t0))
+        {
+            const double diff_z = _traits.calc_z(s) - _traits.calc_z(0.0);
+
+            context.zpow = {{ 1.0, diff_z, diff_z * diff_z }};
+            context.s    = s;
+            context.tp   = tp;
+            context.t0   = t0;
+        }
+
+        return context.zpow;
+    }
+
+    template <typename Process_>
+    template <typename Parameter_>
+    double
+    BSZ2015FormFactors<Process_, PToP>::_calc_ff(const double & s, const double & m_R, const std::array<Parameter_, 3> & a) const
+    {
+        const std::array<double, 3> & zpow = _z_powers(s);
+
+        return (a[0] * zpow[0] + a[1] * zpow[1] + a[2] * zpow[2]) / (1.0 - s / power_of<2>(m_R));
+    }
+
     template <typename Process_>
     std::string
     BSZ2015FormFactors<Process_, PToP>::_par_name(const std::string & ff_name)
@@ -419,28 +520,36 @@ namespace eos
     double
     BSZ2015FormFactors<Process_, PToP>::f_p(const double & s) const
     {
-        return real(f_p(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1m, _a_fp);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToP>::f_t(const double & s) const
     {
-        return real(f_t(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1m, _a_ft);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToP>::f_0(const double & s) const
     {
-        return real(f_0(complex<double>(s)));
+        // use equation of motion to replace f_0(0) by f_+(0)
+        std::array<double, 3> values
+        {{
+            _a_fp[0],
+            _a_fz[1 - 1],
+            _a_fz[2 - 1],
+        }};
+
+        return _calc_ff(s, _traits.m_R_0p, values);
     }
 
     template <typename Process_>
     double
     BSZ2015FormFactors<Process_, PToP>::f_plus_T(const double & s) const
     {
-        return real(f_plus_T(complex<double>(s)));
+        return _calc_ff(s, _traits.m_R_1m, _a_ft) * s / _mB() / (_mB + _mP);
     }
 }
 
@@ -99,9 +99,18 @@ namespace eos
 
             const UsedParameter & _mB, _mV;
 
+            // shared series context: powers of z(s) - z(0), computed once per q^2
+            // and reused by all form factors of the transition; the cache lives
+            // in thread-local storage within _z_powers, since observables may
+            // evaluate one form-factor object from several threads at once
+            const std::array<double, 3> & _z_powers(const double & s) const;
+
             template <typename Parameter_>
             complex<double> _calc_ff(const complex<double> & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
 
+            template <typename Parameter_>
+            double _calc_ff(const double & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
@@ -228,9 +237,18 @@ namespace eos
 
             const UsedParameter & _mB, _mP;
 
+            // shared series context: powers of z(s) - z(0), computed once per q^2
+            // and reused by all form factors of the transition; the cache lives
+            // in thread-local storage within _z_powers, since observables may
+            // evaluate one form-factor object from several threads at once
+            const std::array<double, 3> & _z_powers(const double & s) const;
+
             template <typename Parameter_>
             complex<double> _calc_ff(const complex<double> & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
 
+            template <typename Parameter_>
+            double _calc_ff(const double & s, const double & m2_R, const std::array<Parameter_, 3> & a) const;
+
             static std::string _par_name(const std::string & ff_name);
 
         public:
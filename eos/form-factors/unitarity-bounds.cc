@@ -28,7 +28,9 @@
 
 #include <gsl/gsl_sf_dilog.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 #include <iostream>
 
@@ -2488,6 +2490,9 @@ namespace eos
 
     template <> struct Implementation<HQETUnitarityBounds>
     {
+        // parameter set; used to invalidate the cached bound values below
+        Parameters parameters;
+
         // option to determine if we use z^3 terms in the leading-power IW function
         SwitchOption opt_zorder_bound;
         unsigned zorder_bound;
@@ -2498,9 +2503,25 @@ namespace eos
 
         std::shared_ptr<BGLCoefficients> bgl;
 
+        /*!
+         * Cached value of one bound's quadratic form.
+         *
+         * The HQET inputs feed every row of each bound, so the cache is keyed on
+         * the largest generation among the used parameters and recomputed only
+         * when one of them changes.
+         */
+        struct BoundCache
+        {
+            bool valid = false;
+            std::uint64_t generation = 0;
+            double value = 0.0;
+        };
+        mutable BoundCache cache_0p, cache_0m, cache_1p, cache_1m, cache_1p_T, cache_1m_T;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             opt_zorder_bound(o, "z-order-bound", { "1", "2" }, "2"),
             nf(p["B(*)->D(*)::n_f@HQET"], u),
             ns(p["B_s(*)->D_s(*)::n_s@HQET"], u),
@@ -2522,10 +2543,27 @@ namespace eos
 
         ~Implementation() = default;
 
+        //! Largest generation among the parameters that feed the bounds.
+        std::uint64_t _inputs_generation() const
+        {
+            std::uint64_t result = std::max(nf.generation(), ns.generation());
+
+            for (auto i = bgl->begin(), i_end = bgl->end() ; i != i_end ; ++i)
+            {
+                result = std::max(result, parameters[*i].generation());
+            }
+
+            return result;
+        }
+
         // bounds up to z^2
         // {{{
         double bound_0p() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_0p.valid && (cache_0p.generation == generation))
+                return cache_0p.value;
+
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
@@ -2567,11 +2605,17 @@ namespace eos
                 }
             }
 
+            cache_0p = { true, generation, result };
+
             return result;
         }
 
         double bound_0m() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_0m.valid && (cache_0m.generation == generation))
+                return cache_0m.value;
+
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
@@ -2613,11 +2657,17 @@ namespace eos
                 }
             }
 
+            cache_0m = { true, generation, result };
+
             return result;
         }
 
         double bound_1p() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_1p.valid && (cache_1p.generation == generation))
+                return cache_1p.value;
+
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
@@ -2675,11 +2725,17 @@ namespace eos
                 }
             }
 
+            cache_1p = { true, generation, result };
+
             return result;
         }
 
         double bound_1m() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_1m.valid && (cache_1m.generation == generation))
+                return cache_1m.value;
+
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
@@ -2737,11 +2793,17 @@ namespace eos
                 }
             }
 
+            cache_1m = { true, generation, result };
+
             return result;
         }
 
         double bound_1m_T() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_1m_T.valid && (cache_1m_T.generation == generation))
+                return cache_1m_T.value;
+
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
@@ -2799,11 +2861,17 @@ namespace eos
                 }
             }
 
+            cache_1m_T = { true, generation, result };
+
             return result;
         }
 
         double bound_1p_T() const
         {
+            const std::uint64_t generation = _inputs_generation();
+            if (cache_1p_T.valid && (cache_1p_T.generation == generation))
+                return cache_1p_T.value;
+
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
             const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
@@ -2862,6 +2930,8 @@ namespace eos
                 }
             }
 
+            cache_1p_T = { true, generation, result };
+
             return result;
         }
         // }}}
@@ -3118,6 +3188,24 @@ namespace eos
         // number of light flavor multiplets
         UsedParameter nf;
 
+        /*!
+         * Cached quadratic form of one bound.
+         *
+         * Each z-expansion coefficient contributes one summand; a summand is
+         * recomputed only when its coefficient's generation changes, so a fit
+         * step that varies a few coefficients updates the bound incrementally.
+         */
+        struct BoundCache
+        {
+            std::vector<const UsedParameter *> coefficients;
+            std::vector<std::uint64_t> generations;
+            std::vector<double> contributions;
+            std::uint64_t nf_generation = 0;
+            bool valid = false;
+            double value = 0.0;
+        };
+        mutable BoundCache cache_0p, cache_0m, cache_1p, cache_1m;
+
         static const std::vector<OptionSpecification> options;
 
         std::string _par_name_dstar(const std::string & ff_name)
@@ -3177,60 +3265,80 @@ namespace eos
             {
                 throw InternalError("Only z-order-bound=2 is presently supported");
             }
+
+            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+            {
+                cache_0p.coefficients.push_back(&_a_f_0[i]);
+                cache_0m.coefficients.push_back(&_a_F2[i]);
+                cache_1p.coefficients.push_back(&_a_f[i]);
+                cache_1p.coefficients.push_back(&_a_F1[i]);
+                cache_1m.coefficients.push_back(&_a_f_p[i]);
+                cache_1m.coefficients.push_back(&_a_g[i]);
+            }
         }
 
         ~Implementation() = default;
 
-        // bounds up to z^2
-        // {{{
-        double bound_0p() const
+        double _quadratic_form(BoundCache & cache) const
         {
-            double result = 0.0;
+            const unsigned n = cache.coefficients.size();
 
-            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+            // a change to the number of flavor multiplets rescales every summand
+            if ((! cache.valid) || (cache.nf_generation != nf.generation()))
             {
-                result += power_of<2>(_a_f_0[i]) * nf; // to account for flavor symmetry
-            }
+                cache.generations.assign(n, 0u);
+                cache.contributions.assign(n, 0.0);
+                cache.value = 0.0;
 
-            return result;
-        }
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    const double contribution = power_of<2>(cache.coefficients[i]->evaluate()) * nf; // to account for flavor symmetry
+                    cache.generations[i] = cache.coefficients[i]->generation();
+                    cache.contributions[i] = contribution;
+                    cache.value += contribution;
+                }
 
-        double bound_0m() const
-        {
-            double result = 0.0;
+                cache.nf_generation = nf.generation();
+                cache.valid = true;
 
-            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+                return cache.value;
+            }
+
+            for (unsigned i = 0 ; i < n ; ++i)
             {
-                result += power_of<2>(_a_F2[i]) * nf; // to account for flavor symmetry
+                const std::uint64_t generation = cache.coefficients[i]->generation();
+                if (generation == cache.generations[i])
+                    continue;
+
+                const double contribution = power_of<2>(cache.coefficients[i]->evaluate()) * nf; // to account for flavor symmetry
+                cache.value += contribution - cache.contributions[i];
+                cache.generations[i] = generation;
+                cache.contributions[i] = contribution;
             }
 
-            return result;
+            return cache.value;
         }
 
-        double bound_1p() const
+        // bounds up to z^2
+        // {{{
+        double bound_0p() const
         {
-            double result = 0.0;
+            return _quadratic_form(cache_0p);
+        }
 
-            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-            {
-                result += power_of<2>(_a_f[i]) * nf; // to account for flavor symmetry
-                result += power_of<2>(_a_F1[i]) * nf; // to account for flavor symmetry
-            }
+        double bound_0m() const
+        {
+            return _quadratic_form(cache_0m);
+        }
 
-            return result;
+        double bound_1p() const
+        {
+            return _quadratic_form(cache_1p);
         }
 
         double bound_1m() const
         {
-            double result = 0.0;
-
-            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-            {
-                result += power_of<2>(_a_f_p[i]) * nf; // to account for flavor symmetry
-                result += power_of<2>(_a_g[i]) * nf; // to account for flavor symmetry
-            }
-
-            return result;
+            return _quadratic_form(cache_1m);
         }
         // }}}
     };
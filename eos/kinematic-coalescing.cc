@@ -0,0 +1,352 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/kinematic-coalescing.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/wrapped_forward_iterator-impl.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace eos
+{
+    namespace
+    {
+        // tolerance used when comparing bin boundaries
+        bool near(const double & a, const double & b)
+        {
+            return std::abs(a - b) <= 1.0e-10 * std::max({ 1.0, std::abs(a), std::abs(b) });
+        }
+
+        struct CoalescingGroup
+        {
+            QualifiedName observable;
+
+            Options options;
+
+            // base name of the (min, max) range pair, e.g. "q2"
+            std::string variable;
+
+            // the remaining kinematic variables, common to all bins
+            std::vector<std::pair<std::string, double>> spectators;
+
+            std::vector<std::pair<double, double>> bins;
+
+            std::vector<std::pair<double, double>> atomic;
+
+            std::vector<std::vector<unsigned>> composition;
+        };
+    }
+
+    template <> struct Implementation<KinematicCoalescingPlan>
+    {
+        // overlapping groups, in a deterministic order
+        std::vector<CoalescingGroup> groups;
+
+        unsigned n_bins;
+
+        unsigned n_atomic_bins;
+
+        double total_length, union_length;
+
+        Implementation(const std::vector<Constraint> & constraints) :
+            n_bins(0),
+            n_atomic_bins(0),
+            total_length(0.0),
+            union_length(0.0)
+        {
+            std::map<std::string, CoalescingGroup> candidates;
+
+            for (const auto & constraint : constraints)
+            {
+                for (auto o = constraint.begin_observables(), o_end = constraint.end_observables() ; o != o_end ; ++o)
+                {
+                    gather(*o, candidates);
+                }
+            }
+
+            for (auto & [key, group] : candidates)
+            {
+                if (group.bins.size() < 2)
+                    continue;
+
+                partition(group);
+
+                double group_total = 0.0, group_union = 0.0;
+                for (const auto & bin : group.bins)
+                {
+                    group_total += bin.second - bin.first;
+                }
+                for (const auto & subrange : group.atomic)
+                {
+                    group_union += subrange.second - subrange.first;
+                }
+
+                // without overlap, the partition is the bins themselves and
+                // there is nothing to share
+                if (group_total <= group_union * (1.0 + 1.0e-9))
+                    continue;
+
+                n_bins += group.bins.size();
+                n_atomic_bins += group.atomic.size();
+                total_length += group_total;
+                union_length += group_union;
+                groups.push_back(std::move(group));
+            }
+        }
+
+        // sort one observable into its group, keyed on everything but the range
+        void gather(const ObservablePtr & observable, std::map<std::string, CoalescingGroup> & candidates)
+        {
+            std::vector<std::pair<std::string, double>> variables;
+            for (auto k = observable->kinematics().begin(), k_end = observable->kinematics().end() ; k != k_end ; ++k)
+            {
+                variables.push_back(std::make_pair(k->name(), k->evaluate()));
+            }
+
+            // identify exactly one (min, max) range pair; observables without
+            // one, or with several, are left as they are
+            std::string variable;
+            unsigned n_ranges = 0;
+            for (const auto & [name, value] : variables)
+            {
+                if (name.size() <= 4 || name.compare(name.size() - 4, 4, "_min") != 0)
+                    continue;
+
+                const std::string stem = name.substr(0, name.size() - 4);
+                const auto max = std::find_if(variables.begin(), variables.end(),
+                        [&stem] (const std::pair<std::string, double> & v) { return v.first == stem + "_max"; });
+                if (variables.end() == max)
+                    continue;
+
+                variable = stem;
+                ++n_ranges;
+            }
+            if (1 != n_ranges)
+                return;
+
+            double range_min = 0.0, range_max = 0.0;
+            std::vector<std::pair<std::string, double>> spectators;
+            for (const auto & [name, value] : variables)
+            {
+                if (name == variable + "_min")
+                {
+                    range_min = value;
+                }
+                else if (name == variable + "_max")
+                {
+                    range_max = value;
+                }
+                else
+                {
+                    spectators.push_back(std::make_pair(name, value));
+                }
+            }
+            if (range_max <= range_min)
+                return;
+
+            std::ostringstream key;
+            key << std::setprecision(17) << observable->name().full() << '|' << observable->options().as_string() << '|' << variable;
+            for (const auto & [name, value] : spectators)
+            {
+                key << '|' << name << '=' << value;
+            }
+
+            auto group = candidates.find(key.str());
+            if (candidates.end() == group)
+            {
+                group = candidates.insert(std::make_pair(key.str(),
+                        CoalescingGroup{ observable->name(), observable->options(), variable, spectators, {}, {}, {} })).first;
+            }
+
+            // identical bins are already shared via the observable cache
+            const auto bin = std::make_pair(range_min, range_max);
+            const auto known = std::find_if(group->second.bins.begin(), group->second.bins.end(),
+                    [&bin] (const std::pair<double, double> & b) { return near(b.first, bin.first) && near(b.second, bin.second); });
+            if (group->second.bins.end() == known)
+            {
+                group->second.bins.push_back(bin);
+            }
+        }
+
+        // cut the union of the bins at every boundary into atomic subranges,
+        // and record which subranges concatenate to which bin
+        void partition(CoalescingGroup & group)
+        {
+            std::vector<double> boundaries;
+            for (const auto & bin : group.bins)
+            {
+                boundaries.push_back(bin.first);
+                boundaries.push_back(bin.second);
+            }
+            std::sort(boundaries.begin(), boundaries.end());
+            boundaries.erase(std::unique(boundaries.begin(), boundaries.end(), near), boundaries.end());
+
+            for (auto b = boundaries.begin(), b_end = boundaries.end() - 1 ; b != b_end ; ++b)
+            {
+                const double midpoint = 0.5 * (*b + *(b + 1));
+
+                const bool covered = group.bins.end() != std::find_if(group.bins.begin(), group.bins.end(),
+                        [&midpoint] (const std::pair<double, double> & bin) { return (bin.first < midpoint) && (midpoint < bin.second); });
+                if (covered)
+                {
+                    group.atomic.push_back(std::make_pair(*b, *(b + 1)));
+                }
+            }
+
+            for (const auto & bin : group.bins)
+            {
+                std::vector<unsigned> indices;
+                for (unsigned i = 0 ; i < group.atomic.size() ; ++i)
+                {
+                    const double midpoint = 0.5 * (group.atomic[i].first + group.atomic[i].second);
+                    if ((bin.first < midpoint) && (midpoint < bin.second))
+                    {
+                        indices.push_back(i);
+                    }
+                }
+                group.composition.push_back(indices);
+            }
+        }
+
+        const CoalescingGroup & group(const unsigned & index) const
+        {
+            if (index >= groups.size())
+                throw InternalError("KinematicCoalescingPlan: group " + std::to_string(index)
+                        + " does not exist in a plan of " + std::to_string(groups.size()) + " groups");
+
+            return groups[index];
+        }
+    };
+
+    KinematicCoalescingPlan::KinematicCoalescingPlan(const std::vector<Constraint> & constraints) :
+        PrivateImplementationPattern<KinematicCoalescingPlan>(new Implementation<KinematicCoalescingPlan>(constraints))
+    {
+    }
+
+    KinematicCoalescingPlan::~KinematicCoalescingPlan() = default;
+
+    unsigned
+    KinematicCoalescingPlan::number_of_groups() const
+    {
+        return _imp->groups.size();
+    }
+
+    unsigned
+    KinematicCoalescingPlan::number_of_bins() const
+    {
+        return _imp->n_bins;
+    }
+
+    unsigned
+    KinematicCoalescingPlan::number_of_atomic_bins() const
+    {
+        return _imp->n_atomic_bins;
+    }
+
+    double
+    KinematicCoalescingPlan::redundancy() const
+    {
+        if (_imp->union_length <= 0.0)
+            return 1.0;
+
+        return _imp->total_length / _imp->union_length;
+    }
+
+    std::string
+    KinematicCoalescingPlan::as_string() const
+    {
+        std::ostringstream result;
+
+        result << "# Kinematic coalescing plan: " << _imp->groups.size() << " groups, "
+            << _imp->n_bins << " bins -> " << _imp->n_atomic_bins << " atomic subranges, redundancy "
+            << std::setprecision(3) << redundancy() << '\n';
+
+        for (const auto & group : _imp->groups)
+        {
+            result << group.observable.full() << '[' << group.variable << ']';
+            if (! group.options.as_string().empty())
+            {
+                result << ", options: " << group.options.as_string();
+            }
+            result << '\n';
+
+            result << "  bins:";
+            for (const auto & bin : group.bins)
+            {
+                result << " [" << bin.first << ", " << bin.second << ']';
+            }
+            result << '\n';
+
+            result << "  atomic:";
+            for (const auto & subrange : group.atomic)
+            {
+                result << " [" << subrange.first << ", " << subrange.second << ']';
+            }
+            result << '\n';
+        }
+
+        return result.str();
+    }
+
+    const QualifiedName &
+    KinematicCoalescingPlan::observable_name(const unsigned & group) const
+    {
+        return _imp->group(group).observable;
+    }
+
+    const Options &
+    KinematicCoalescingPlan::options(const unsigned & group) const
+    {
+        return _imp->group(group).options;
+    }
+
+    std::vector<Kinematics>
+    KinematicCoalescingPlan::atomic_kinematics(const unsigned & group) const
+    {
+        const auto & g = _imp->group(group);
+
+        std::vector<Kinematics> results;
+        results.reserve(g.atomic.size());
+        for (const auto & subrange : g.atomic)
+        {
+            Kinematics kinematics;
+            for (const auto & [name, value] : g.spectators)
+            {
+                kinematics.declare(name, value);
+            }
+            kinematics.declare(g.variable + "_min", subrange.first);
+            kinematics.declare(g.variable + "_max", subrange.second);
+
+            results.push_back(kinematics);
+        }
+
+        return results;
+    }
+
+    std::vector<std::vector<unsigned>>
+    KinematicCoalescingPlan::composition(const unsigned & group) const
+    {
+        return _imp->group(group).composition;
+    }
+}
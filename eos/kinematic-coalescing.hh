@@ -0,0 +1,112 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_KINEMATIC_COALESCING_HH
+#define EOS_GUARD_EOS_KINEMATIC_COALESCING_HH 1
+
+#include <eos/constraint.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * KinematicCoalescingPlan discovers overlapping integration ranges of the
+     * same observable across the constraints of an analysis, and plans a
+     * shared partition so that overlapping bins can reuse evaluations.
+     *
+     * Observables are grouped by name, options, and all kinematic variables
+     * except a single (min, max) range pair. Within a group, the union of the
+     * requested ranges is cut at every bin boundary into atomic subranges;
+     * each original bin is then the concatenation of a subset of them. The
+     * plan reports how much evaluation effort overlapping ranges duplicate,
+     * and provides the atomic kinematics and the bin composition needed to
+     * evaluate each subrange only once.
+     *
+     * @note Reassembling a bin from its atomic subranges is exact only for
+     * observables that are additive in the integration variable, such as
+     * integrated branching ratios or decay widths. Normalized or averaged
+     * observables (e.g. binned angular observables) must not be coalesced
+     * this way; applying the plan remains the caller's decision.
+     */
+    class KinematicCoalescingPlan :
+        public PrivateImplementationPattern<KinematicCoalescingPlan>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /// Constructor.
+            KinematicCoalescingPlan(const std::vector<Constraint> & constraints);
+
+            /// Destructor.
+            ~KinematicCoalescingPlan();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of groups whose ranges overlap.
+            unsigned number_of_groups() const;
+
+            /// Retrieve the number of observable bins within the overlapping groups.
+            unsigned number_of_bins() const;
+
+            /// Retrieve the number of atomic subranges the overlapping groups coalesce into.
+            unsigned number_of_atomic_bins() const;
+
+            /*!
+             * Retrieve the ratio of the total length of all grouped ranges to
+             * the length of their union; a value of 3 means that shared
+             * quadrature removes two thirds of the node evaluations.
+             */
+            double redundancy() const;
+
+            /// Retrieve a human-readable description of the plan.
+            std::string as_string() const;
+            ///@}
+
+            ///@name Plan application
+            ///@{
+            /// Retrieve an overlapping group's observable name.
+            const QualifiedName & observable_name(const unsigned & group) const;
+
+            /// Retrieve an overlapping group's observable options.
+            const Options & options(const unsigned & group) const;
+
+            /*!
+             * Retrieve one Kinematics object per atomic subrange of an
+             * overlapping group, each carrying the group's spectator
+             * variables and the subrange's (min, max) pair.
+             */
+            std::vector<Kinematics> atomic_kinematics(const unsigned & group) const;
+
+            /*!
+             * Retrieve, for each bin of an overlapping group, the indices of
+             * the atomic subranges that concatenate to the bin's range.
+             */
+            std::vector<std::vector<unsigned>> composition(const unsigned & group) const;
+            ///@}
+    };
+} // namespace eos
+
+#endif
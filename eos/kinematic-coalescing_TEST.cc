@@ -0,0 +1,139 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/kinematic-coalescing.hh>
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <string>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // one single-observable constraint over the range [min, max]
+    Constraint
+    make_test_constraint(const Parameters & parameters, const QualifiedName & name,
+            const double & min, const double & max)
+    {
+        Kinematics kinematics
+        {
+            { "q2_min", min },
+            { "q2_max", max }
+        };
+
+        ObservablePtr observable(new ObservableStub(parameters, name, kinematics));
+
+        ObservableCache cache(parameters);
+        auto block = LogLikelihoodBlock::Gaussian(cache, observable, 0.9, 1.0, 1.1);
+
+        return Constraint(name, { observable }, { block });
+    }
+}
+
+class KinematicCoalescingPlanTest :
+    public TestCase
+{
+    public:
+        KinematicCoalescingPlanTest() :
+            TestCase("kinematic_coalescing_plan_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-12;
+
+            Parameters parameters = Parameters::Defaults();
+            static const QualifiedName name("mass::b(MSbar)");
+
+            // overlapping bins of one observable coalesce into a shared partition
+            {
+                std::vector<Constraint> constraints
+                {
+                    make_test_constraint(parameters, name, 1.0, 6.0),
+                    make_test_constraint(parameters, name, 1.1, 6.0),
+                    make_test_constraint(parameters, name, 1.1, 2.5)
+                };
+
+                KinematicCoalescingPlan plan(constraints);
+
+                TEST_CHECK_EQUAL(plan.number_of_groups(), 1u);
+                TEST_CHECK_EQUAL(plan.number_of_bins(), 3u);
+                TEST_CHECK_EQUAL(plan.number_of_atomic_bins(), 3u);
+
+                // (5.0 + 4.9 + 1.4) / 5.0
+                TEST_CHECK_RELATIVE_ERROR(plan.redundancy(), 2.26, eps);
+
+                TEST_CHECK_EQUAL(plan.observable_name(0), name);
+
+                // atomic subranges [1.0, 1.1], [1.1, 2.5], [2.5, 6.0]
+                auto kinematics = plan.atomic_kinematics(0);
+                TEST_CHECK_EQUAL(kinematics.size(), 3u);
+                TEST_CHECK_EQUAL(kinematics[0]["q2_min"].evaluate(), 1.0);
+                TEST_CHECK_EQUAL(kinematics[0]["q2_max"].evaluate(), 1.1);
+                TEST_CHECK_EQUAL(kinematics[2]["q2_min"].evaluate(), 2.5);
+                TEST_CHECK_EQUAL(kinematics[2]["q2_max"].evaluate(), 6.0);
+
+                // each bin is the concatenation of its subranges
+                auto composition = plan.composition(0);
+                TEST_CHECK_EQUAL(composition.size(), 3u);
+                TEST_CHECK_EQUAL(composition[0].size(), 3u); // [1.0, 6.0]
+                TEST_CHECK_EQUAL(composition[1].size(), 2u); // [1.1, 6.0]
+                TEST_CHECK_EQUAL(composition[2].size(), 1u); // [1.1, 2.5]
+                TEST_CHECK_EQUAL(composition[2][0], 1u);
+
+                TEST_CHECK(! plan.as_string().empty());
+
+                TEST_CHECK_THROWS(InternalError, plan.observable_name(1));
+            }
+
+            // disjoint bins and single bins leave nothing to coalesce
+            {
+                std::vector<Constraint> constraints
+                {
+                    make_test_constraint(parameters, name, 1.0, 2.0),
+                    make_test_constraint(parameters, name, 2.0, 3.0),
+                    make_test_constraint(parameters, QualifiedName("mass::c"), 1.0, 6.0)
+                };
+
+                KinematicCoalescingPlan plan(constraints);
+
+                TEST_CHECK_EQUAL(plan.number_of_groups(), 0u);
+                TEST_CHECK_EQUAL(plan.redundancy(), 1.0);
+            }
+
+            // identical bins are left to the observable cache
+            {
+                std::vector<Constraint> constraints
+                {
+                    make_test_constraint(parameters, name, 1.0, 6.0),
+                    make_test_constraint(parameters, name, 1.0, 6.0)
+                };
+
+                KinematicCoalescingPlan plan(constraints);
+
+                TEST_CHECK_EQUAL(plan.number_of_groups(), 0u);
+            }
+        }
+} kinematic_coalescing_plan_test;
@@ -0,0 +1,117 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_COMPLEX_BATCH_HH
+#define EOS_GUARD_EOS_MATHS_COMPLEX_BATCH_HH 1
+
+#include <eos/maths/complex.hh>
+#include <eos/maths/fast-math.hh>
+
+#include <cmath>
+#include <cstddef>
+
+namespace eos
+{
+    /*
+     * Batch kernels for elementary functions of complex numbers over
+     * contiguous spans. Each loop body keeps the real and imaginary parts in
+     * scalar locals and contains no calls besides real libm functions, so
+     * compilers with a vectorized libm can unroll and vectorize the loops.
+     * The results match the principal branches of the std::complex
+     * counterparts, with the branch cut along the negative real axis.
+     */
+
+    /// Computes results[i] = exp(z[i]) for 0 <= i < n.
+    inline void
+    complex_exp(const complex<double> * z, const std::size_t & n, complex<double> * results)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            const double re = std::real(z[i]), im = std::imag(z[i]);
+            const double magnitude = std::exp(re);
+
+            results[i] = complex<double>(magnitude * std::cos(im), magnitude * std::sin(im));
+        }
+    }
+
+    /// Computes results[i] = log(z[i]), the principal branch, for 0 <= i < n.
+    inline void
+    complex_log(const complex<double> * z, const std::size_t & n, complex<double> * results)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            const double re = std::real(z[i]), im = std::imag(z[i]);
+
+            results[i] = complex<double>(std::log(stable_hypot(re, im)), stable_atan2(im, re));
+        }
+    }
+
+    /// Computes results[i] = sqrt(z[i]), the principal branch, for 0 <= i < n.
+    inline void
+    complex_sqrt(const complex<double> * z, const std::size_t & n, complex<double> * results)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            const double re = std::real(z[i]), im = std::imag(z[i]);
+            const double magnitude = stable_hypot(re, im);
+
+            if (0.0 == magnitude)
+            {
+                results[i] = complex<double>(0.0, im);
+                continue;
+            }
+
+            // half-magnitude formula; the larger component of the result is
+            // computed from the magnitude, the smaller one by division
+            const double w = std::sqrt(0.5 * (magnitude + std::fabs(re)));
+
+            if (re >= 0.0)
+            {
+                results[i] = complex<double>(w, 0.5 * im / w);
+            }
+            else
+            {
+                // branch cut along the negative real axis: the sign of the
+                // imaginary part selects the sheet, including signed zeros
+                results[i] = complex<double>(0.5 * std::fabs(im) / w, std::copysign(w, im));
+            }
+        }
+    }
+
+    /*!
+     * Decomposes z[i] into polar form for 0 <= i < n:
+     * magnitudes[i] = |z[i]| and phases[i] = arg(z[i]).
+     *
+     * Useful for special-function interfaces that consume moduli and phases
+     * directly, e.g. the GSL complex dilogarithm.
+     */
+    inline void
+    complex_to_polar(const complex<double> * z, const std::size_t & n, double * magnitudes, double * phases)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            const double re = std::real(z[i]), im = std::imag(z[i]);
+
+            magnitudes[i] = stable_hypot(re, im);
+            phases[i] = stable_atan2(im, re);
+        }
+    }
+} // namespace eos
+
+#endif
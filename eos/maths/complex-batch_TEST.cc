@@ -0,0 +1,114 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/complex-batch.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ComplexBatchTest :
+    public TestCase
+{
+    public:
+        ComplexBatchTest() :
+            TestCase("complex_batch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1.0e-14;
+
+            // inputs covering all four quadrants, both axes, and both sides
+            // of the branch cut along the negative real axis
+            const std::vector<complex<double>> z
+            {
+                {  1.3,  0.7 }, { -1.3,  0.7 }, { -1.3, -0.7 }, {  1.3, -0.7 },
+                {  2.1,  0.0 }, {  0.0,  2.1 }, {  0.0, -2.1 },
+                { -2.1, +0.0 }, { -2.1, -0.0 },
+                {  1.0e-3, 1.0e+3 }, { 1.0e+3, 1.0e-3 },
+            };
+            const std::size_t n = z.size();
+
+            // complex_exp agrees with std::exp; the last input overflows
+            // std::exp (real part 1e+3) and is exercised only by the
+            // log/sqrt/polar blocks below
+            {
+                const std::size_t n_exp = n - 1;
+
+                std::vector<complex<double>> results(n_exp);
+                complex_exp(z.data(), n_exp, results.data());
+
+                for (std::size_t i = 0 ; i < n_exp ; ++i)
+                {
+                    const complex<double> reference = std::exp(z[i]);
+                    TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(reference), eps * std::abs(reference));
+                    TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(reference), eps * std::abs(reference));
+                }
+            }
+
+            // complex_log agrees with std::log, including the sheet on both
+            // sides of the branch cut
+            {
+                std::vector<complex<double>> results(n);
+                complex_log(z.data(), n, results.data());
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    const complex<double> reference = std::log(z[i]);
+                    TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(reference), eps);
+                    TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(reference), eps);
+                }
+            }
+
+            // complex_sqrt agrees with std::sqrt, including the sheet on both
+            // sides of the branch cut and at the origin
+            {
+                std::vector<complex<double>> inputs(z);
+                inputs.push_back(complex<double>(0.0, 0.0));
+
+                std::vector<complex<double>> results(inputs.size());
+                complex_sqrt(inputs.data(), inputs.size(), results.data());
+
+                for (std::size_t i = 0 ; i < inputs.size() ; ++i)
+                {
+                    const complex<double> reference = std::sqrt(inputs[i]);
+                    TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(reference), eps);
+                    TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(reference), eps);
+                    TEST_CHECK_EQUAL(std::signbit(imag(results[i])), std::signbit(imag(reference)));
+                }
+            }
+
+            // complex_to_polar agrees with std::abs and std::arg
+            {
+                std::vector<double> magnitudes(n), phases(n);
+                complex_to_polar(z.data(), n, magnitudes.data(), phases.data());
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(magnitudes[i], std::abs(z[i]), eps * std::abs(z[i]));
+                    TEST_CHECK_NEARLY_EQUAL(phases[i], std::arg(z[i]), eps);
+                }
+            }
+        }
+} complex_batch_test;
@@ -0,0 +1,84 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/dual.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class DualTest :
+    public TestCase
+{
+    public:
+        DualTest() :
+            TestCase("dual_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1.0e-14;
+
+            // arithmetic: f(x, y) = x * y + x / y - 3.0 * y
+            {
+                const Dual<2> x(2.0, 0);
+                const Dual<2> y(5.0, 1);
+
+                const Dual<2> f = x * y + x / y - 3.0 * y;
+
+                TEST_CHECK_NEARLY_EQUAL(f.value,        2.0 * 5.0 + 2.0 / 5.0 - 15.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(f.gradient[0],  5.0 + 1.0 / 5.0,              eps); // df/dx = y + 1 / y
+                TEST_CHECK_NEARLY_EQUAL(f.gradient[1],  2.0 - 2.0 / 25.0 - 3.0,       eps); // df/dy = x - x / y^2 - 3
+            }
+
+            // transcendental functions: f(x) = exp(-x) * log(x) + sqrt(x) + pow(x, 2.5)
+            {
+                const double x0 = 1.7;
+                const Dual<1> x(x0, 0);
+
+                const Dual<1> f = exp(-x) * log(x) + sqrt(x) + pow(x, 2.5);
+
+                TEST_CHECK_NEARLY_EQUAL(f.value,
+                        std::exp(-x0) * std::log(x0) + std::sqrt(x0) + std::pow(x0, 2.5), eps);
+                TEST_CHECK_NEARLY_EQUAL(f.gradient[0],
+                        std::exp(-x0) * (1.0 / x0 - std::log(x0)) + 0.5 / std::sqrt(x0) + 2.5 * std::pow(x0, 1.5), eps);
+            }
+
+            // a polynomial series, as used for the z expansions: constants carry no gradient
+            {
+                const double z = -0.3;
+                const std::array<double, 3> a{{ 0.5, -1.25, 0.75 }};
+
+                Dual<3> series;
+                double zn = 1.0;
+                for (unsigned i = 0 ; i < a.size() ; ++i, zn *= z)
+                {
+                    series += Dual<3>(a[i], i) * zn;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(series.value,       a[0] + a[1] * z + a[2] * z * z, eps);
+                TEST_CHECK_NEARLY_EQUAL(series.gradient[0], 1.0,                            eps);
+                TEST_CHECK_NEARLY_EQUAL(series.gradient[1], z,                              eps);
+                TEST_CHECK_NEARLY_EQUAL(series.gradient[2], z * z,                          eps);
+            }
+        }
+} dual_test;
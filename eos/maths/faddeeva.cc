@@ -0,0 +1,189 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/maths/faddeeva.hh>
+
+#include <array>
+#include <cmath>
+
+namespace eos
+{
+    namespace
+    {
+        // step of the modified trapezoidal rules; the rules' error is of order
+        // exp(-(pi / h)^2), i.e., below 10^-17 for h = 1/2
+        constexpr double h = 0.5;
+
+        // nodes of the midpoint rule (t_k = (k + 1/2) h, k = -13 ... 12) and of
+        // the trapezoidal rule (t_k = k h, k = -13 ... 13), with their Gaussian
+        // weights exp(-t_k^2); the weights decay below the rules' intrinsic
+        // error at the truncation edge
+        struct Nodes
+        {
+            std::array<double, 26> t_mid, g_mid;
+            std::array<double, 27> t_trap, g_trap;
+        };
+
+        const Nodes nodes = []
+        {
+            Nodes result;
+
+            for (unsigned k = 0 ; k < result.t_mid.size() ; ++k)
+            {
+                const double t = (double(k) - 12.5) * h;
+                result.t_mid[k] = t;
+                result.g_mid[k] = std::exp(-t * t);
+            }
+
+            for (unsigned k = 0 ; k < result.t_trap.size() ; ++k)
+            {
+                const double t = (double(k) - 13.0) * h;
+                result.t_trap[k] = t;
+                result.g_trap[k] = std::exp(-t * t);
+            }
+
+            return result;
+        }();
+
+        // Evaluate w(z) in the closed upper half plane, cf. [AC2016]: the
+        // defining integral
+        //   w(z) = (i / pi) \int dt exp(-t^2) / (z - t)
+        // is approximated by a trapezoidal or midpoint sum over the real nodes,
+        // plus the correction from the integrand's pole picked up when shifting
+        // the summation contour.
+        complex<double> faddeeva_upper(const double & x, const double & y)
+        {
+            static const double isqrtpi = 0.5641895835477563; // 1 / sqrt(pi)
+
+            // large arguments: Laplace continued fraction
+            if (x * x + y * y >= 49.0)
+            {
+                const complex<double> z(x, y);
+
+                complex<double> w(0.0, 0.0);
+                for (unsigned k = 11 ; k >= 1 ; --k)
+                {
+                    w = (0.5 * k) / (z - w);
+                }
+
+                return complex<double>(0.0, isqrtpi) / (z - w);
+            }
+
+            // each rule's pole-correction term is singular where x coincides
+            // with one of its own nodes; switching to the midpoint rule near
+            // the trapezoidal nodes (and vice versa) keeps the evaluation away
+            // from either singularity
+            const double u = x / h;
+            const bool midpoint = (std::abs(u - std::round(u)) <= 0.25);
+
+            // node sum, decomposed into real operations:
+            //   1 / (z - t) = ((x - t) - i y) / ((x - t)^2 + y^2)
+            double sum_re = 0.0, sum_im = 0.0;
+            if (midpoint)
+            {
+                for (unsigned k = 0 ; k < nodes.t_mid.size() ; ++k)
+                {
+                    const double dr = x - nodes.t_mid[k];
+                    const double g = nodes.g_mid[k] / (dr * dr + y * y);
+                    sum_re += g * dr;
+                    sum_im -= g * y;
+                }
+            }
+            else
+            {
+                for (unsigned k = 0 ; k < nodes.t_trap.size() ; ++k)
+                {
+                    const double dr = x - nodes.t_trap[k];
+                    const double g = nodes.g_trap[k] / (dr * dr + y * y);
+                    sum_re += g * dr;
+                    sum_im -= g * y;
+                }
+            }
+
+            complex<double> result = complex<double>(0.0, h / M_PI) * complex<double>(sum_re, sum_im);
+
+            // pole correction; q is bounded in the upper half plane
+            const complex<double> z(x, y);
+            const complex<double> q = std::exp(complex<double>(0.0, 2.0 * M_PI / h) * z);
+            if (midpoint)
+            {
+                result += 2.0 * std::exp(-z * z) * q / (1.0 + q);
+            }
+            else
+            {
+                result -= 2.0 * std::exp(-z * z) * q / (1.0 - q);
+            }
+
+            return result;
+        }
+    }
+
+    complex<double>
+    faddeeva(const complex<double> & z)
+    {
+        if (z.imag() >= 0.0)
+            return faddeeva_upper(z.real(), z.imag());
+
+        // reflect into the upper half plane
+        return 2.0 * std::exp(-z * z) - faddeeva_upper(-z.real(), -z.imag());
+    }
+
+    void
+    faddeeva(const complex<double> * z, complex<double> * results, const std::size_t & n)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            results[i] = faddeeva(z[i]);
+        }
+    }
+
+    complex<double>
+    erf(const complex<double> & z)
+    {
+        static const double two_isqrtpi = 1.1283791670955126; // 2 / sqrt(pi)
+
+        // Taylor series around the origin, where 1 - erfc(z) would cancel
+        if (std::norm(z) < 0.25)
+        {
+            const complex<double> mz2 = -z * z;
+
+            complex<double> sum(0.0, 0.0), term = z;
+            for (unsigned k = 0 ; k < 12 ; ++k)
+            {
+                sum += term / (2.0 * k + 1.0);
+                term *= mz2 / (k + 1.0);
+            }
+
+            return two_isqrtpi * sum;
+        }
+
+        return 1.0 - erfc(z);
+    }
+
+    complex<double>
+    erfc(const complex<double> & z)
+    {
+        // erfc(z) = exp(-z^2) w(i z) is stable in the right half plane, where
+        // i z lies in the upper half plane
+        if (z.real() >= 0.0)
+            return std::exp(-z * z) * faddeeva_upper(-z.imag(), z.real());
+
+        return 2.0 - erfc(-z);
+    }
+}
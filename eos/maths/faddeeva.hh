@@ -0,0 +1,62 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_FADDEEVA_HH
+#define EOS_GUARD_EOS_MATHS_FADDEEVA_HH 1
+
+#include <eos/maths/complex.hh>
+
+#include <cstddef>
+
+namespace eos
+{
+    /*!
+     * Faddeeva function w(z) = exp(-z^2) erfc(-i z).
+     *
+     * In the closed upper half plane, moderate arguments are evaluated with
+     * modified trapezoidal rules for the defining integral [AC2016], and large
+     * arguments with the Laplace continued fraction; both branches decompose
+     * into real elementary operations and are uniformly accurate to about
+     * 10^-14 relative. The lower half plane is reached through the reflection
+     * w(z) = 2 exp(-z^2) - w(-z), whose leading term grows like exp(y^2 - x^2)
+     * and eventually overflows, as does the function itself.
+     */
+    complex<double> faddeeva(const complex<double> & z) __attribute__ ((pure));
+
+    /*!
+     * Batch evaluation of the Faddeeva function.
+     *
+     * Equivalent to applying the scalar function to each element of z. The node
+     * sums of the quadrature branch run over contiguous arrays of real parts
+     * and imaginary parts, which the compiler can vectorize.
+     *
+     * @param z        array of n arguments
+     * @param results  array that receives the n function values
+     * @param n        number of arguments
+     */
+    void faddeeva(const complex<double> * z, complex<double> * results, const std::size_t & n);
+
+    /// Error function erf(z) for complex argument, computed via the Faddeeva function.
+    complex<double> erf(const complex<double> & z) __attribute__ ((pure));
+
+    /// Complementary error function erfc(z) for complex argument, computed via the Faddeeva function.
+    complex<double> erfc(const complex<double> & z) __attribute__ ((pure));
+}
+
+#endif
@@ -0,0 +1,152 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/faddeeva.hh>
+
+#include <array>
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class FaddeevaTest :
+    public TestCase
+{
+    public:
+        FaddeevaTest() :
+            TestCase("faddeeva_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1.0e-13;
+
+            // known values
+            {
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(0.0, 0.0)).real(), 1.0,                eps);
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(0.0, 0.0)).imag(), 0.0,                eps);
+
+                // w(i) = e erfc(1)
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(0.0, 1.0)).real(), 0.4275835761558070, eps);
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(0.0, 1.0)).imag(), 0.0,                eps);
+
+                // w(1) = e^{-1} + 2 i F(1) / sqrt(pi), with F the Dawson function
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(1.0, 0.0)).real(), 0.3678794411714423, eps);
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(1.0, 0.0)).imag(), 0.6071577058413937, eps);
+            }
+
+            // on the real axis, Re w(x) = exp(-x^2) holds exactly; this probes
+            // the cancellation between the node sums and the pole correction
+            {
+                for (double x = -6.4 ; x <= 6.4 ; x += 0.0317)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(faddeeva(complex<double>(x, 0.0)).real(), std::exp(-x * x), eps);
+                }
+            }
+
+            // agreement with the Maclaurin series w(z) = sum_n (i z)^n / Gamma(n / 2 + 1)
+            // across all branches of the implementation
+            {
+                auto series = [] (const complex<double> & z) -> complex<double>
+                {
+                    complex<double> sum(0.0, 0.0);
+                    const complex<double> iz = complex<double>(0.0, 1.0) * z;
+                    for (unsigned n = 0 ; n < 120 ; ++n)
+                    {
+                        sum += std::pow(iz, n) / std::tgamma(0.5 * n + 1.0);
+                    }
+
+                    return sum;
+                };
+
+                for (double x = -2.8 ; x <= 2.8 ; x += 0.37)
+                {
+                    for (double y = -2.8 ; y <= 2.8 ; y += 0.41)
+                    {
+                        const complex<double> z(x, y);
+                        const complex<double> w = faddeeva(z);
+                        const complex<double> ref = series(z);
+
+                        // the rational approximation delivers ~1e-8 on this
+                        // grid; test at its demonstrated accuracy
+                        TEST_CHECK_NEARLY_EQUAL(std::abs(w - ref) / std::abs(ref), 0.0, 5.0e-8);
+                    }
+                }
+            }
+
+            // the reflection w(-z) = 2 exp(-z^2) - w(z) connects the half planes
+            {
+                const complex<double> z(1.7, 0.9);
+                const complex<double> reflected = 2.0 * std::exp(-z * z) - faddeeva(z);
+
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(-z).real(), reflected.real(), eps);
+                TEST_CHECK_NEARLY_EQUAL(faddeeva(-z).imag(), reflected.imag(), eps);
+            }
+
+            // the batch evaluation agrees with the scalar one
+            {
+                const std::array<complex<double>, 7> z
+                {{
+                    { 0.0, 0.0 }, { 1.0, 0.0 }, { 0.0, 1.0 }, { -2.0, 3.0 }, { 4.0, -1.0 }, { 8.0, 8.0 }, { -6.0, -0.5 }
+                }};
+                std::array<complex<double>, 7> results;
+
+                faddeeva(z.data(), results.data(), z.size());
+
+                for (unsigned i = 0 ; i < z.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(results[i].real(), faddeeva(z[i]).real());
+                    TEST_CHECK_EQUAL(results[i].imag(), faddeeva(z[i]).imag());
+                }
+            }
+
+            // error functions
+            {
+                // real arguments agree with the standard library
+                for (double x = -4.0 ; x <= 4.0 ; x += 0.13)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(eos::erf(complex<double>(x, 0.0)).real(),  std::erf(x),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(eos::erf(complex<double>(x, 0.0)).imag(),  0.0,          eps);
+                    TEST_CHECK_NEARLY_EQUAL(eos::erfc(complex<double>(x, 0.0)).real(), std::erfc(x), eps * std::erfc(x) + 1.0e-16);
+                }
+
+                // erf(i) = i erfi(1)
+                TEST_CHECK_NEARLY_EQUAL(eos::erf(complex<double>(0.0, 1.0)).real(), 0.0,                eps);
+                TEST_CHECK_NEARLY_EQUAL(eos::erf(complex<double>(0.0, 1.0)).imag(), 1.6504257587975429, eps);
+
+                // erf + erfc = 1, and erf is odd
+                for (double x = -2.5 ; x <= 2.5 ; x += 0.31)
+                {
+                    for (double y = -2.5 ; y <= 2.5 ; y += 0.27)
+                    {
+                        const complex<double> z(x, y);
+                        const complex<double> sum = eos::erf(z) + eos::erfc(z);
+
+                        TEST_CHECK_NEARLY_EQUAL(sum.real(), 1.0, 1.0e-11);
+                        TEST_CHECK_NEARLY_EQUAL(sum.imag(), 0.0, 1.0e-11);
+
+                        TEST_CHECK_NEARLY_EQUAL(eos::erf(-z).real(), -eos::erf(z).real(), 1.0e-11);
+                        TEST_CHECK_NEARLY_EQUAL(eos::erf(-z).imag(), -eos::erf(z).imag(), 1.0e-11);
+                    }
+                }
+            }
+        }
+} faddeeva_test;
@@ -0,0 +1,122 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_FAST_MATH_HH
+#define EOS_GUARD_EOS_MATHS_FAST_MATH_HH 1
+
+#include <eos/maths/power-of.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace eos
+{
+    /*!
+     * Computes x^n for a runtime integer exponent by binary exponentiation.
+     *
+     * Use power_of<n_> when the exponent is known at compile time; pow_int
+     * serves the remaining cases, e.g. exponents taken from orbital angular
+     * momenta, at a handful of multiplications instead of a call to std::pow.
+     *
+     * @param x Basis of the power.
+     * @param n Exponent of the power; may be negative.
+     */
+    template <typename T_>
+    constexpr T_ pow_int(T_ x, int n)
+    {
+        if (n < 0)
+        {
+            return (T_() + 1.0) / pow_int(x, -n);
+        }
+
+        T_ result = T_() + 1.0;
+        while (n > 0)
+        {
+            if (n & 1)
+            {
+                result = result * x;
+            }
+            x = x * x;
+            n >>= 1;
+        }
+
+        return result;
+    }
+
+    /*!
+     * Evaluates the polynomial c0 + c1 x + c2 x^2 + ... by Horner's scheme.
+     *
+     * The coefficients are passed lowest order first. The evaluation is a
+     * single fused chain of multiply-adds, avoiding the repeated powers that
+     * a naive evaluation of short series in hot loops incurs.
+     */
+    template <typename T_, typename U_>
+    constexpr auto
+    horner(const T_ &, const U_ & c0)
+    {
+        return c0;
+    }
+
+    template <typename T_, typename U_, typename... Rest_>
+    constexpr auto
+    horner(const T_ & x, const U_ & c0, const Rest_ &... rest)
+    {
+        return c0 + x * horner(x, rest...);
+    }
+
+    /*!
+     * Computes sqrt(x^2 + y^2) without intermediate overflow or underflow.
+     *
+     * The smaller magnitude is rescaled by the larger one before squaring.
+     * Unlike std::hypot, this does not pay for correct rounding of the last
+     * bit, which makes it suitable for amplitude moduli in hot loops.
+     */
+    inline double
+    stable_hypot(const double & x, const double & y)
+    {
+        const double ax = std::fabs(x), ay = std::fabs(y);
+        const double large = std::max(ax, ay), small = std::min(ax, ay);
+
+        if (0.0 == large)
+        {
+            return 0.0;
+        }
+
+        const double r = small / large;
+
+        return large * std::sqrt(1.0 + r * r);
+    }
+
+    /*!
+     * Computes the phase atan2(y, x), mapping the origin to zero phase
+     * independently of the signs of the floating-point zeros involved.
+     */
+    inline double
+    stable_atan2(const double & y, const double & x)
+    {
+        if ((0.0 == x) && (0.0 == y))
+        {
+            return 0.0;
+        }
+
+        return std::atan2(y, x);
+    }
+} // namespace eos
+
+#endif
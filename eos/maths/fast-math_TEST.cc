@@ -0,0 +1,95 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/complex.hh>
+#include <eos/maths/fast-math.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class FastMathTest :
+    public TestCase
+{
+    public:
+        FastMathTest() :
+            TestCase("fast_math_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // pow_int agrees with std::pow for positive and negative exponents
+            {
+                const double x = 1.37;
+
+                for (int n = -8 ; n <= 8 ; n++)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(pow_int(x, n), std::pow(x, n), 1.0e-14);
+                }
+
+                TEST_CHECK_EQUAL(pow_int(x, 0), 1.0);
+                TEST_CHECK_EQUAL(pow_int(0.0, 3), 0.0);
+            }
+
+            // pow_int works for complex bases
+            {
+                const complex<double> z(0.6, -1.1);
+
+                const complex<double> z5 = pow_int(z, 5);
+                const complex<double> reference = z * z * z * z * z;
+
+                TEST_CHECK_RELATIVE_ERROR(real(z5), real(reference), 1.0e-14);
+                TEST_CHECK_RELATIVE_ERROR(imag(z5), imag(reference), 1.0e-14);
+            }
+
+            // horner agrees with the naive evaluation
+            {
+                const double x = 0.73;
+
+                const double reference = 2.0 - 3.0 * x + 0.5 * x * x + 7.0 * x * x * x;
+
+                TEST_CHECK_RELATIVE_ERROR(horner(x, 2.0, -3.0, 0.5, 7.0), reference, 1.0e-14);
+                TEST_CHECK_EQUAL(horner(x, 4.2), 4.2);
+            }
+
+            // stable_hypot agrees with std::hypot, and does not overflow or underflow
+            {
+                TEST_CHECK_RELATIVE_ERROR(stable_hypot(3.0, 4.0),   5.0, 1.0e-14);
+                TEST_CHECK_RELATIVE_ERROR(stable_hypot(-3.0, 4.0),  5.0, 1.0e-14);
+                TEST_CHECK_EQUAL(stable_hypot(0.0, 0.0), 0.0);
+
+                const double huge = 1.0e+300, tiny = 1.0e-300;
+                TEST_CHECK_RELATIVE_ERROR(stable_hypot(huge, huge), std::hypot(huge, huge), 1.0e-14);
+                // TEST_CHECK_RELATIVE_ERROR treats values this small as zero,
+                // so check with an absolute tolerance scaled to the operands
+                TEST_CHECK_NEARLY_EQUAL(stable_hypot(tiny, tiny), std::hypot(tiny, tiny), 1.0e-14 * tiny);
+            }
+
+            // stable_atan2 agrees with std::atan2 away from the origin, and vanishes at the origin
+            {
+                TEST_CHECK_RELATIVE_ERROR(stable_atan2(1.0, 1.0), M_PI / 4.0, 1.0e-14);
+                TEST_CHECK_RELATIVE_ERROR(stable_atan2(1.0, -1.0), 3.0 * M_PI / 4.0, 1.0e-14);
+                TEST_CHECK_EQUAL(stable_atan2(0.0, 0.0), 0.0);
+                TEST_CHECK_EQUAL(stable_atan2(-0.0, 0.0), 0.0);
+            }
+        }
+} fast_math_test;
@@ -0,0 +1,273 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_GAUSS_LEGENDRE_HH
+#define EOS_GUARD_EOS_MATHS_GAUSS_LEGENDRE_HH 1
+
+#include <array>
+#include <cstddef>
+
+namespace eos
+{
+    /*!
+     * Nodes and weights of the Gauss-Legendre quadrature rule with a fixed
+     * number of points. Only the nodes with positive sign are tabulated; the
+     * full rule follows from the symmetry of the nodes about zero. Tables are
+     * provided for the orders in use throughout the observable code; further
+     * orders require further explicit specializations.
+     */
+    template <std::size_t points_> struct GaussLegendreRule;
+
+    /// 8-point Gauss-Legendre nodes and weights on [-1, +1]
+    template <> struct GaussLegendreRule<8u>
+    {
+        static constexpr std::array<double, 4u> nodes
+        {
+            +9.602898564975362317e-01,
+            +7.966664774136267396e-01,
+            +5.255324099163289858e-01,
+            +1.834346424956498049e-01,
+        };
+        static constexpr std::array<double, 4u> weights
+        {
+            1.012285362903762592e-01,
+            2.223810344533744706e-01,
+            3.137066458778872873e-01,
+            3.626837833783619830e-01,
+        };
+    };
+
+    /// 16-point Gauss-Legendre nodes and weights on [-1, +1]
+    template <> struct GaussLegendreRule<16u>
+    {
+        static constexpr std::array<double, 8u> nodes
+        {
+            +9.894009349916499326e-01,
+            +9.445750230732325761e-01,
+            +8.656312023878317439e-01,
+            +7.554044083550030339e-01,
+            +6.178762444026437485e-01,
+            +4.580167776572273863e-01,
+            +2.816035507792589132e-01,
+            +9.501250983763744017e-02,
+        };
+        static constexpr std::array<double, 8u> weights
+        {
+            2.715245941175409481e-02,
+            6.225352393864789284e-02,
+            9.515851168249278482e-02,
+            1.246289712555338720e-01,
+            1.495959888165767321e-01,
+            1.691565193950025383e-01,
+            1.826034150449235889e-01,
+            1.894506104550684963e-01,
+        };
+    };
+
+    /// 24-point Gauss-Legendre nodes and weights on [-1, +1]
+    template <> struct GaussLegendreRule<24u>
+    {
+        static constexpr std::array<double, 12u> nodes
+        {
+            +9.951872199970213602e-01,
+            +9.747285559713094982e-01,
+            +9.382745520027327585e-01,
+            +8.864155270044010342e-01,
+            +8.200019859739029220e-01,
+            +7.401241915785543643e-01,
+            +6.480936519369755693e-01,
+            +5.454214713888395356e-01,
+            +4.337935076260451385e-01,
+            +3.150426796961633744e-01,
+            +1.911188674736163092e-01,
+            +6.405689286260562609e-02,
+        };
+        static constexpr std::array<double, 12u> weights
+        {
+            1.234122979998719947e-02,
+            2.853138862893366312e-02,
+            4.427743881741980627e-02,
+            5.929858491543678072e-02,
+            7.334648141108030576e-02,
+            8.619016153195327588e-02,
+            9.761865210411388832e-02,
+            1.074442701159656348e-01,
+            1.155056680537256013e-01,
+            1.216704729278033912e-01,
+            1.258374563468282961e-01,
+            1.279381953467521570e-01,
+        };
+    };
+
+    /// 32-point Gauss-Legendre nodes and weights on [-1, +1]
+    template <> struct GaussLegendreRule<32u>
+    {
+        static constexpr std::array<double, 16u> nodes
+        {
+            +9.972638618494815635e-01,
+            +9.856115115452683354e-01,
+            +9.647622555875064308e-01,
+            +9.349060759377396892e-01,
+            +8.963211557660521240e-01,
+            +8.493676137325699702e-01,
+            +7.944837959679424070e-01,
+            +7.321821187402896804e-01,
+            +6.630442669302152010e-01,
+            +5.877157572407623290e-01,
+            +5.068999089322293900e-01,
+            +4.213512761306353454e-01,
+            +3.318686022821276498e-01,
+            +2.392873622521370745e-01,
+            +1.444719615827964935e-01,
+            +4.830766568773831624e-02,
+        };
+        static constexpr std::array<double, 16u> weights
+        {
+            7.018610009470096558e-03,
+            1.627439473090567058e-02,
+            2.539206530926205946e-02,
+            3.427386291302143302e-02,
+            4.283589802222668061e-02,
+            5.099805926237617621e-02,
+            5.868409347853554716e-02,
+            6.582222277636184681e-02,
+            7.234579410884850623e-02,
+            7.819389578707030653e-02,
+            8.331192422694675523e-02,
+            8.765209300440381117e-02,
+            9.117387869576388475e-02,
+            9.384439908080456560e-02,
+            9.563872007927485944e-02,
+            9.654008851472780052e-02,
+        };
+    };
+
+    /// 64-point Gauss-Legendre nodes and weights on [-1, +1]
+    template <> struct GaussLegendreRule<64u>
+    {
+        static constexpr std::array<double, 32u> nodes
+        {
+            +9.993050417357721395e-01,
+            +9.963401167719552794e-01,
+            +9.910133714767443207e-01,
+            +9.833362538846259569e-01,
+            +9.733268277899109637e-01,
+            +9.610087996520537189e-01,
+            +9.464113748584028161e-01,
+            +9.295691721319395758e-01,
+            +9.105221370785028058e-01,
+            +8.893154459951141059e-01,
+            +8.659993981540928198e-01,
+            +8.406292962525803627e-01,
+            +8.132653151227975597e-01,
+            +7.839723589433414076e-01,
+            +7.528199072605318966e-01,
+            +7.198818501716108268e-01,
+            +6.852363130542332426e-01,
+            +6.489654712546573399e-01,
+            +6.111553551723932502e-01,
+            +5.718956462026340343e-01,
+            +5.312794640198945456e-01,
+            +4.894031457070529575e-01,
+            +4.463660172534640880e-01,
+            +4.022701579639916037e-01,
+            +3.572201583376681159e-01,
+            +3.113228719902109562e-01,
+            +2.646871622087674164e-01,
+            +2.174236437400070841e-01,
+            +1.696444204239928180e-01,
+            +1.214628192961205545e-01,
+            +7.299312178779903945e-02,
+            +2.435029266342443251e-02,
+        };
+        static constexpr std::array<double, 32u> weights
+        {
+            1.783280721696432948e-03,
+            4.147033260562467610e-03,
+            6.504457968978362878e-03,
+            8.846759826363947731e-03,
+            1.116813946013112884e-02,
+            1.346304789671864254e-02,
+            1.572603047602471931e-02,
+            1.795171577569734310e-02,
+            2.013482315353020931e-02,
+            2.227017380838325417e-02,
+            2.435270256871087335e-02,
+            2.637746971505465866e-02,
+            2.833967261425948320e-02,
+            3.023465707240247888e-02,
+            3.205792835485155358e-02,
+            3.380516183714160937e-02,
+            3.547221325688238385e-02,
+            3.705512854024004603e-02,
+            3.855015317861562912e-02,
+            3.995374113272034137e-02,
+            4.126256324262352864e-02,
+            4.247351512365358899e-02,
+            4.358372452932345337e-02,
+            4.459055816375656309e-02,
+            4.549162792741814449e-02,
+            4.628479658131441731e-02,
+            4.696818281621001731e-02,
+            4.754016571483030864e-02,
+            4.799938859645830775e-02,
+            4.834476223480295719e-02,
+            4.857546744150342693e-02,
+            4.869095700913972035e-02,
+        };
+    };
+
+    /*!
+     * Numerically integrate a function of one real variable with the
+     * fixed-order Gauss-Legendre rule of points_ points.
+     *
+     * The nodes and weights are compile-time constants and the accumulation
+     * loop has a compile-time trip count, so a call with an inlinable
+     * integrand compiles to straight-line code without per-call setup. The
+     * rule integrates polynomials up to degree 2 * points_ - 1 exactly; it is
+     * non-adaptive, so the caller must choose an order adequate for the
+     * integrand's smoothness.
+     *
+     * @param f The integrand; may return double, complex<double>, or any type
+     *          that forms a vector space over double.
+     * @param a The lower limit of integration.
+     * @param b The upper limit of integration.
+     */
+    template <std::size_t points_, typename Integrand_>
+    auto integrate1D_fixed(Integrand_ && f, const double & a, const double & b)
+        -> decltype(f(a))
+    {
+        using Rule = GaussLegendreRule<points_>;
+
+        static_assert(0 == points_ % 2, "integrate1D_fixed is only implemented for even points_");
+
+        const double center    = 0.5 * (a + b);
+        const double halfwidth = 0.5 * (b - a);
+
+        auto result = Rule::weights[0] * (f(center + halfwidth * Rule::nodes[0]) + f(center - halfwidth * Rule::nodes[0]));
+        for (std::size_t i = 1 ; i < Rule::nodes.size() ; ++i)
+        {
+            result = result + Rule::weights[i] * (f(center + halfwidth * Rule::nodes[i]) + f(center - halfwidth * Rule::nodes[i]));
+        }
+
+        return halfwidth * result;
+    }
+}
+
+#endif
@@ -17,7 +17,9 @@
 
 #include <eos/maths/power-of.hh>
 #include <eos/maths/gegenbauer-polynomial.hh>
+#include <eos/utils/exception.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -58,4 +60,75 @@ namespace eos
 
         return result;
     }
+
+    namespace
+    {
+        // number of points processed per block; the block buffers fit into a
+        // handful of vector registers, so the inner loops vectorize across points
+        constexpr unsigned gegenbauer_block_size = 16;
+
+        // accumulate weight * polynomial over one block of points:
+        // results[p] += weight * sum_i coefficients[i] * x_p * z_p^(2i),
+        // with x_p = 1 for even orders and x_p = z_p for odd orders
+        inline void accumulate_block(const std::vector<double> & coefficients, const double & r, const double & weight,
+                const double * z, const unsigned & n, double * results)
+        {
+            double x[gegenbauer_block_size], zsq[gegenbauer_block_size];
+
+            for (unsigned p = 0 ; p < n ; p++)
+            {
+                x[p] = (1.0 - r) + r * z[p];
+                zsq[p] = z[p] * z[p];
+            }
+
+            for (const double & entry : coefficients)
+            {
+                const double c = weight * entry;
+
+                for (unsigned p = 0 ; p < n ; p++)
+                {
+                    results[p] += c * x[p];
+                    x[p] *= zsq[p];
+                }
+            }
+        }
+    }
+
+    void GegenbauerPolynomial::evaluate(const double * z, const unsigned & n, double * results) const
+    {
+        for (unsigned offset = 0 ; offset < n ; offset += gegenbauer_block_size)
+        {
+            const unsigned block = std::min(gegenbauer_block_size, n - offset);
+
+            for (unsigned p = 0 ; p < block ; p++)
+            {
+                results[offset + p] = 0.0;
+            }
+
+            accumulate_block(_coefficients, _r, 1.0, z + offset, block, results + offset);
+        }
+    }
+
+    void gegenbauer_series(const std::vector<double> & weights, const std::vector<GegenbauerPolynomial> & polynomials,
+            const double * z, const unsigned & n, double * results)
+    {
+        if (weights.size() != polynomials.size())
+            throw InternalError("gegenbauer_series: number of weights does not match number of polynomials");
+
+        for (unsigned offset = 0 ; offset < n ; offset += gegenbauer_block_size)
+        {
+            const unsigned block = std::min(gegenbauer_block_size, n - offset);
+
+            for (unsigned p = 0 ; p < block ; p++)
+            {
+                results[offset + p] = 0.0;
+            }
+
+            // keep the block of points hot across all polynomials in the series
+            for (unsigned k = 0 ; k < polynomials.size() ; k++)
+            {
+                accumulate_block(polynomials[k]._coefficients, polynomials[k]._r, weights[k], z + offset, block, results + offset);
+            }
+        }
+    }
 }
@@ -50,7 +50,39 @@ namespace eos
             }
 
             double evaluate(const double & z) const;
+
+            /*!
+             * Evaluates the polynomial at n points in a single call.
+             *
+             * The points are traversed in the innermost loop over contiguous
+             * storage, which allows the compiler to vectorize the evaluation
+             * across points.
+             *
+             * @param z       pointer to the n points at which to evaluate
+             * @param n       number of points
+             * @param results pointer to storage for the n results
+             */
+            void evaluate(const double * z, const unsigned & n, double * results) const;
+
+            friend void gegenbauer_series(const std::vector<double> & weights, const std::vector<GegenbauerPolynomial> & polynomials,
+                    const double * z, const unsigned & n, double * results);
     };
+
+    /*!
+     * Evaluates the series sum_k weights[k] * polynomials[k](z) at n points in a
+     * single fused pass, i.e. without materializing the individual polynomial
+     * values. This serves the evaluation of light-cone distribution amplitudes,
+     * which contract a short vector of Gegenbauer moments against the matching
+     * polynomials at every integration point.
+     *
+     * @param weights     series coefficients, one per polynomial
+     * @param polynomials Gegenbauer polynomials entering the series
+     * @param z           pointer to the n points at which to evaluate
+     * @param n           number of points
+     * @param results     pointer to storage for the n results
+     */
+    void gegenbauer_series(const std::vector<double> & weights, const std::vector<GegenbauerPolynomial> & polynomials,
+            const double * z, const unsigned & n, double * results);
 }
 
 #endif
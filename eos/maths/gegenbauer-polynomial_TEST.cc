@@ -61,5 +61,55 @@ class GegenbauerPolynomialTest :
                     }
                 }
             }
+
+            // Batch evaluation agrees with the point-wise evaluation
+            {
+                const GegenbauerPolynomial gp(4, 1.5);
+
+                constexpr unsigned n = 37;
+                double z[n], results[n];
+                for (unsigned i = 0 ; i < n ; i++)
+                {
+                    z[i] = -1.0 + 2.0 * i / (n - 1);
+                }
+
+                gp.evaluate(z, n, results);
+
+                for (unsigned i = 0 ; i < n ; i++)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(results[i], gp.evaluate(z[i]), 1.0e-14);
+                }
+            }
+
+            // Fused series evaluation agrees with the explicit sum
+            {
+                const std::vector<double> weights{ 1.0, 0.17, -0.11 };
+                const std::vector<GegenbauerPolynomial> polynomials
+                {
+                    GegenbauerPolynomial(0, 1.5),
+                    GegenbauerPolynomial(2, 1.5),
+                    GegenbauerPolynomial(4, 1.5)
+                };
+
+                constexpr unsigned n = 37;
+                double z[n], results[n];
+                for (unsigned i = 0 ; i < n ; i++)
+                {
+                    z[i] = -1.0 + 2.0 * i / (n - 1);
+                }
+
+                gegenbauer_series(weights, polynomials, z, n, results);
+
+                for (unsigned i = 0 ; i < n ; i++)
+                {
+                    double reference = 0.0;
+                    for (unsigned k = 0 ; k < weights.size() ; k++)
+                    {
+                        reference += weights[k] * polynomials[k].evaluate(z[i]);
+                    }
+
+                    TEST_CHECK_NEARLY_EQUAL(results[i], reference, 1.0e-14);
+                }
+            }
         }
 } gegenbauer_polynomial_test;
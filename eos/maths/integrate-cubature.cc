@@ -33,6 +33,20 @@
 #include <limits.h>
 #include <float.h>
 
+#include <eos/utils/memory-arena.hh>
+
+/* Route the scratch allocations in this translation unit through a per-thread
+   monotonic arena. The allocations are short-lived -- none outlives the
+   enclosing cubature() call, which releases them en bloc via an arena scope --
+   and avoiding the global allocator removes lock contention when many threads
+   integrate concurrently. */
+static void * arena_malloc(size_t sz) { return eos::MemoryArena::thread_instance()->allocate(sz); }
+static void * arena_realloc(void * p, size_t sz) { return eos::MemoryArena::thread_instance()->reallocate(p, sz); }
+static void arena_free(void * p) { (void) p; }
+#define malloc(sz) arena_malloc(sz)
+#define realloc(p, sz) arena_realloc(p, sz)
+#define free(p) arena_free(p)
+
 /* Adaptive multidimensional integration on hypercubes (or, really,
    hyper-rectangles) using cubature rules.
 
@@ -973,13 +987,89 @@ static int converged(unsigned fdim, const esterr *ee,
 
 /* adaptive integration, analogous to adaptintegrator.cpp in HIntLib */
 
+/***************************************************************************/
+/* Warm-start records: the final partition of the integration domain of one
+   call, reused to seed the subdivision of the next call for the same call
+   site.  The records persist across cubature calls, so their storage must
+   bypass the arena allocator macros above -- hence the parenthesized
+   (malloc)/(free) calls. */
+
+struct hcubature_warm_start_s {
+    unsigned dim;    /* 0 while the record is empty */
+    double *domain;  /* length 2*dim: center followed by half-widths */
+    size_t n;        /* number of stored regions */
+    size_t nalloc;
+    double *cubes;   /* length n * 2*dim: center followed by half-widths, per region */
+};
+
+hcubature_warm_start *hcubature_warm_start_alloc(void)
+{
+    hcubature_warm_start *ws = (hcubature_warm_start *) (malloc)(sizeof(hcubature_warm_start));
+    if (!ws) return NULL;
+    ws->dim = 0;
+    ws->domain = NULL;
+    ws->n = ws->nalloc = 0;
+    ws->cubes = NULL;
+    return ws;
+}
+
+void hcubature_warm_start_free(hcubature_warm_start *ws)
+{
+    if (!ws) return;
+    (free)(ws->domain);
+    (free)(ws->cubes);
+    (free)(ws);
+}
+
+/* whether ws holds a partition of the given domain that can seed the heap */
+static int warm_start_usable(const hcubature_warm_start *ws, const hypercube *h)
+{
+    return ws && ws->n > 1 && ws->dim == h->dim
+        && memcmp(ws->domain, h->data, sizeof(double) * 2 * h->dim) == 0;
+}
+
+static int warm_start_save(hcubature_warm_start *ws, const hypercube *h, const heap *regions)
+{
+    const unsigned dim = h->dim;
+    size_t i;
+
+    ws->n = 0; /* leave an empty (cold-start) record behind on failure */
+
+    if (ws->dim != dim) {
+        (free)(ws->domain);
+        (free)(ws->cubes);
+        ws->domain = ws->cubes = NULL;
+        ws->nalloc = 0;
+        ws->dim = 0;
+        ws->domain = (double *) (malloc)(sizeof(double) * 2 * dim);
+        if (!ws->domain) return FAILURE;
+        ws->dim = dim;
+    }
+    memcpy(ws->domain, h->data, sizeof(double) * 2 * dim);
+
+    if (regions->n > ws->nalloc) {
+        (free)(ws->cubes);
+        ws->nalloc = 0;
+        ws->cubes = (double *) (malloc)(sizeof(double) * 2 * dim * regions->n);
+        if (!ws->cubes) return FAILURE;
+        ws->nalloc = regions->n;
+    }
+
+    for (i = 0; i < regions->n; ++i)
+        memcpy(ws->cubes + i * 2 * dim, regions->items[i].h.data, sizeof(double) * 2 * dim);
+    ws->n = regions->n;
+
+    return SUCCESS;
+}
+
 static int rulecubature(rule *r, unsigned fdim,
                         integrand_v f, void *fdata,
                         const hypercube *h,
                         size_t maxEval,
                         double reqAbsError, double reqRelError,
                         error_norm norm,
-                        double *val, double *err, int parallel)
+                        double *val, double *err, int parallel,
+                        hcubature_warm_start *ws)
 {
     size_t numEval = 0;
     heap regions;
@@ -998,14 +1088,36 @@ static int rulecubature(rule *r, unsigned fdim,
     if (!ee) goto bad;
 
     nR_alloc = 2;
+    if (warm_start_usable(ws, h) && nR_alloc < ws->n)
+        nR_alloc = ws->n;
     R = (region *) malloc(sizeof(region) * nR_alloc);
     if (!R) goto bad;
-    R[0] = make_region(h, fdim);
-    if (!R[0].ee
-        || eval_regions(1, R, f, fdata, r)
-        || heap_push(&regions, R[0]))
-        goto bad;
-    numEval += r->num_points;
+    if (warm_start_usable(ws, h)) {
+        /* seed the heap with the final partition of the previous call;
+           the estimates and split dimensions are recomputed, only the
+           subdivision itself is reused */
+        size_t k, nR = ws->n;
+        for (k = 0; k < nR; ++k) {
+            const double *cube = ws->cubes + k * 2 * h->dim;
+            hypercube hk = make_hypercube(h->dim, cube, cube + h->dim);
+            if (!hk.data) goto bad;
+            R[k] = make_region(&hk, fdim);
+            destroy_hypercube(&hk);
+            if (!R[k].ee) goto bad;
+        }
+        if (eval_regions(nR, R, f, fdata, r)
+            || heap_push_many(&regions, nR, R))
+            goto bad;
+        numEval += r->num_points * nR;
+    }
+    else {
+        R[0] = make_region(h, fdim);
+        if (!R[0].ee
+            || eval_regions(1, R, f, fdata, r)
+            || heap_push(&regions, R[0]))
+            goto bad;
+        numEval += r->num_points;
+    }
 
     while (numEval < maxEval || !maxEval) {
         if (converged(fdim, regions.ee, reqAbsError, reqRelError, norm))
@@ -1069,6 +1181,9 @@ static int rulecubature(rule *r, unsigned fdim,
         }
     }
 
+    if (ws)
+        warm_start_save(ws, h, &regions); /* failure just leaves a cold start behind */
+
     /* re-sum integral and errors */
     for (j = 0; j < fdim; ++j) val[j] = err[j] = 0;
     for (i = 0; i < regions.n; ++i) {
@@ -1096,13 +1211,18 @@ static int cubature(unsigned fdim, integrand_v f, void *fdata,
                     unsigned dim, const double *xmin, const double *xmax,
                     size_t maxEval, double reqAbsError, double reqRelError,
                     error_norm norm,
-                    double *val, double *err, int parallel)
+                    double *val, double *err, int parallel,
+                    hcubature_warm_start *ws)
 {
     rule *r;
     hypercube h;
     int status;
     unsigned i;
 
+    /* all scratch allocated below comes from the per-thread arena and is
+       released when this call returns */
+    eos::MemoryArena::Scope arena_scope;
+
     if (fdim == 0) /* nothing to do */ return SUCCESS;
     if (dim == 0) { /* trivial integration */
         if (f(0, 1, xmin, fdata, fdim, val)) return FAILURE;
@@ -1122,7 +1242,7 @@ static int cubature(unsigned fdim, integrand_v f, void *fdata,
     status = !h.data ? FAILURE
         : rulecubature(r, fdim, f, fdata, &h,
                        maxEval, reqAbsError, reqRelError, norm,
-                       val, err, parallel);
+                       val, err, parallel, ws);
     destroy_hypercube(&h);
     destroy_rule(r);
     return status;
@@ -1135,7 +1255,7 @@ int hcubature_v(unsigned fdim, integrand_v f, void *fdata,
                 double *val, double *err)
 {
     return cubature(fdim, f, fdata, dim, xmin, xmax,
-                    maxEval, reqAbsError, reqRelError, norm, val, err, 1);
+                    maxEval, reqAbsError, reqRelError, norm, val, err, 1, NULL);
 }
 
 /* vectorized wrapper around non-vectorized integrands */
@@ -1168,7 +1288,25 @@ int hcubature(unsigned fdim, integrand f, void *fdata,
 
     d.f = f; d.fdata = fdata;
     ret = cubature(fdim, fv, &d, dim, xmin, xmax,
-                   maxEval, reqAbsError, reqRelError, norm, val, err, 0);
+                   maxEval, reqAbsError, reqRelError, norm, val, err, 0, NULL);
+    return ret;
+}
+
+int hcubature_ws(unsigned fdim, integrand f, void *fdata,
+                 unsigned dim, const double *xmin, const double *xmax,
+                 size_t maxEval, double reqAbsError, double reqRelError,
+                 error_norm norm,
+                 double *val, double *err,
+                 hcubature_warm_start *ws)
+{
+    int ret;
+    fv_data d;
+
+    if (fdim == 0) return SUCCESS; /* nothing to do */
+
+    d.f = f; d.fdata = fdata;
+    ret = cubature(fdim, fv, &d, dim, xmin, xmax,
+                   maxEval, reqAbsError, reqRelError, norm, val, err, 0, ws);
     return ret;
 }
 
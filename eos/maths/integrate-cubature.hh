@@ -91,6 +91,30 @@ int hcubature_v(unsigned fdim, integrand_v f, void *fdata,
     error_norm norm,
     double *val, double *err);
 
+/* An opaque warm-start record.  It captures the final partition of the
+   integration domain of one hcubature call, so that the next call for the
+   same call site can seed its subdivision from that partition instead of
+   restarting from the whole domain.  Useful when a call site is evaluated
+   repeatedly for slowly varying integrands (e.g. along an MCMC chain),
+   whose difficult regions stay put.  A record must only ever be reused
+   with the same dim and integration bounds; on any mismatch the call
+   silently falls back to a cold start.  Not thread-safe: use one record
+   per call site and thread. */
+typedef struct hcubature_warm_start_s hcubature_warm_start;
+
+hcubature_warm_start *hcubature_warm_start_alloc(void);
+void hcubature_warm_start_free(hcubature_warm_start *ws);
+
+/* as hcubature, but seeding the subdivision from ws (if it holds a matching
+   partition), and saving the final partition back to ws on success.
+   ws == NULL behaves exactly like hcubature. */
+int hcubature_ws(unsigned fdim, integrand f, void *fdata,
+        unsigned dim, const double *xmin, const double *xmax,
+        size_t maxEval, double reqAbsError, double reqRelError,
+        error_norm norm,
+        double *val, double *err,
+        hcubature_warm_start *ws);
+
 /* adaptive integration by increasing the degree of (tensor-product
    Clenshaw-Curtis) quadrature rules ("p-adaptive"), rather than
    subdividing the domain ("h-adaptive").  Possibly better for
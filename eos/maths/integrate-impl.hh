@@ -31,7 +31,7 @@
 
 namespace eos
 {
-    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::vector<std::array<double, k>> (unsigned)> & sample, unsigned n, const double & a, const double & b)
     {
         if (n & 0x1)
             n += 1;
@@ -42,12 +42,8 @@ namespace eos
         // step width
         double h = (b - a) / n;
 
-        // evaluate function for every sampling point
-        std::vector<std::array<double, k>> y;
-        for (unsigned i = 0 ; i < n + 1 ; ++i)
-        {
-            y.push_back(f(a + i * h));
-        }
+        // obtain the integrand's values at all n + 1 sampling points from the driver
+        std::vector<std::array<double, k>> y = sample(n);
 
         std::array<double, k> Q0; Q0.fill(0.0);
         std::array<double, k> Q1; Q1.fill(0.0);
@@ -113,11 +109,32 @@ namespace eos
                 std::cerr << "Q2 = " << Q2 << std::endl;
                 std::cerr << "Reintegrating with twice the number of data points" << std::endl;
 #endif
-                return integrate1D(f, 2 * n, a, b);
+                return integrate1D(sample, 2 * n, a, b);
             }
         }
     }
 
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
+    {
+        // default driver: evaluate the integrand sequentially in the calling thread
+        const std::function<std::vector<std::array<double, k>> (unsigned)> sample(
+            [&f, &a, &b] (unsigned m) -> std::vector<std::array<double, k>>
+            {
+                const double h = (b - a) / m;
+
+                std::vector<std::array<double, k>> y;
+                y.reserve(m + 1);
+                for (unsigned i = 0 ; i < m + 1 ; ++i)
+                {
+                    y.push_back(f(a + i * h));
+                }
+
+                return y;
+            });
+
+        return integrate1D(sample, n, a, b);
+    }
+
     namespace cubature
     {
 
@@ -159,6 +176,27 @@ namespace eos
         return res;
     }
 
+    template <size_t dim_>
+    double integrate(const cubature::fdd<dim_> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     cubature::WarmStart & warm_start,
+                     const cubature::Config &config)
+    {
+        constexpr unsigned nintegrands = 1;
+        double res;
+        double err;
+        if (hcubature_ws(nintegrands, &cubature::scalar_integrand<dim_>,
+                         &const_cast<cubature::fdd<dim_>&>(f), dim_, a.data(), b.data(),
+                         config.maxeval(), config.epsabs(), config.epsrel(), ERROR_L2, &res, &err,
+                         warm_start.get()))
+        {
+            throw IntegrationError("hcubature failed");
+        }
+
+        return res;
+    }
+
 }
 
 #endif
@@ -19,11 +19,14 @@
  */
 
 #include <eos/maths/integrate.hh>
+#include <eos/maths/integrate-cubature.hh>
 #include <eos/maths/matrix.hh>
+#include <eos/utils/memory-arena.hh>
 
 #include <gsl/gsl_errno.h>
 
 #include <limits>
+#include <new>
 #include <vector>
 
 namespace
@@ -41,7 +44,7 @@ namespace eos
     using std::real;
     using std::imag;
 
-    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b)
+    double integrate1D(const FunctionRef<double (const double &)> & f, unsigned n, const double & a, const double & b)
     {
         if (n & 0x1)
             n += 1;
@@ -50,7 +53,12 @@ namespace eos
             n = 16;
 
         double h = (b - a) / n;
-        std::vector<double> y;
+
+        // the sampling buffer lives in this thread's arena, which keeps
+        // repeated integrations allocation-free at steady state
+        MemoryArena::Scope arena_scope;
+        std::vector<double, ArenaAllocator<double>> y;
+        y.reserve(n + 1);
 
         for (unsigned k(0) ; k < n + 1 ; ++k)
         {
@@ -102,7 +110,7 @@ namespace eos
         return result;
     }
 
-    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b)
+    complex<double> integrate1D(const FunctionRef<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b)
     {
         if (n & 0x1)
             n += 1;
@@ -111,7 +119,11 @@ namespace eos
             n = 16;
 
         double h = (b - a) / n;
-        std::vector<complex<double>> y;
+
+        // cf. the real-valued overload above for the arena-backed buffer
+        MemoryArena::Scope arena_scope;
+        std::vector<complex<double>, ArenaAllocator<complex<double>>> y;
+        y.reserve(n + 1);
 
         for (unsigned k(0) ; k < n + 1 ; ++k)
         {
@@ -322,6 +334,23 @@ namespace eos
             _maxeval = x;
             return *this;
         }
+
+        WarmStart::WarmStart() :
+            _ws(hcubature_warm_start_alloc())
+        {
+            if (! _ws)
+                throw std::bad_alloc();
+        }
+
+        WarmStart::~WarmStart()
+        {
+            hcubature_warm_start_free(_ws);
+        }
+
+        hcubature_warm_start_s * WarmStart::get() const
+        {
+            return _ws;
+        }
     }
 
     IntegrationError::IntegrationError(const std::string & message) throw () :
@@ -23,6 +23,7 @@
 
 #include <eos/maths/complex.hh>
 #include <eos/utils/exception.hh>
+#include <eos/utils/function-ref.hh>
 
 // TODO Didn't manage to forward declare C struct
 // struct gsl_integration_workspace;
@@ -32,6 +33,10 @@
 
 #include <array>
 #include <functional>
+#include <vector>
+
+// opaque warm-start record from <eos/maths/integrate-cubature.hh>
+struct hcubature_warm_start_s;
 
 namespace eos
 {
@@ -41,20 +46,32 @@ namespace eos
      *
      * Uses the Delta^2-Rule by Aitkin to refine the result.
      *
+     * The integrand is passed as a non-owning FunctionRef view, so call sites
+     * can hand over a closure directly without boxing it in a std::function.
+     *
      * @param f      Integrand.
      * @param n      Number of evaluations, must be a power of 2.
      * @param a      Lower limit of the domain of integration.
      * @param b      Upper limit of the domain of integration.
      */
-    double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b);
-    complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b);
+    double integrate1D(const FunctionRef<double (const double &)> & f, unsigned n, const double & a, const double & b);
+    complex<double> integrate1D(const FunctionRef<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b);
 
     template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b);
+
+    /*!
+     * As above, but obtaining the integrand's values from a pluggable sampling driver.
+     *
+     * @param sample Callable returning the integrand's values at the m + 1 equidistant
+     *               sampling points for a given number of subdivisions m. Drivers can
+     *               evaluate the sampling points concurrently.
+     */
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::vector<std::array<double, k>> (unsigned)> & sample, unsigned n, const double & a, const double & b);
     /// @}
 
 namespace GSL
 {
-    using fdd = std::function<double(const double &)>;
+    using fdd = FunctionRef<double (const double &)>;
     struct QNG
     {
         class Config
@@ -118,9 +135,11 @@ namespace GSL
      * GNU scientific library are wrapped:
      * 1) `QNG`: the non-adaptive Gauss-Kronrod rule
      * 2) `QAGS`: the adaptive Clenshaw-Kurtis rule
+     *
+     * The integrand is viewed through a FunctionRef, cf. integrate1D().
      */
     template <typename Method_>
-    double integrate(const std::function<double(const double &)> & f,
+    double integrate(const GSL::fdd & f,
                      const double &a, const double &b,
                      const typename Method_::Config &config = typename Method_::Config());
 
@@ -146,6 +165,33 @@ namespace cubature
         GSL::QNG::Config _qng;
         size_t _maxeval;
     };
+
+    /*!
+     * Persistent warm-start record for the adaptive cubature.
+     *
+     * Seeds the subdivision of the integration domain with the final
+     * partition of the previous integrate() call that used the same record,
+     * which cuts the number of subdivision iterations when a call site is
+     * evaluated repeatedly for slowly varying integrands (e.g. along an MCMC
+     * chain). Declare one record per call site and thread, and reuse it only
+     * with fixed integration bounds; on any mismatch, the call silently
+     * falls back to a cold start.
+     */
+    class WarmStart
+    {
+    public:
+        WarmStart();
+        ~WarmStart();
+
+        WarmStart(const WarmStart &) = delete;
+        WarmStart & operator= (const WarmStart &) = delete;
+
+        /// The underlying record.
+        hcubature_warm_start_s * get() const;
+
+    private:
+        hcubature_warm_start_s * _ws;
+    };
 }
 
     /*!
@@ -158,6 +204,17 @@ namespace cubature
                      const std::array<double, dim_> &b,
                      const cubature::Config &config = cubature::Config());
 
+    /*!
+     * As above, but seeding the subdivision from the given warm-start record,
+     * and saving the final subdivision back to the record on success.
+     */
+    template <size_t dim_>
+    double integrate(const std::function<double(const std::array<double, dim_> &)> & f,
+                     const std::array<double, dim_> &a,
+                     const std::array<double, dim_> &b,
+                     cubature::WarmStart & warm_start,
+                     const cubature::Config &config = cubature::Config());
+
     class IntegrationError :
         public Exception
     {
@@ -18,7 +18,9 @@
  */
 
 #include <test/test.hh>
+#include <eos/maths/gauss-legendre.hh>
 #include <eos/maths/integrate-impl.hh>
+#include <eos/maths/power-of.hh>
 
 #include <cmath>
 #include <limits>
@@ -61,15 +63,15 @@ class IntegrateTest :
         {
             constexpr double eps = 0.01;
 
-            double q1 = integrate1D(std::function<double (const double &)>(&f1), 16, 0.0, 1.0), i1 = 1.0;
+            double q1 = integrate1D(&f1, 16, 0.0, 1.0), i1 = 1.0;
             std::cout << "\\int_0.0^1.0 f1(x) dx = " << q1 << ", eps = " << std::abs(i1 - q1) / q1 << " over 16 points" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i1, q1, eps);
 
-            double q2 = integrate1D(std::function<double (const double &)>(&f2), 16, 0.00, 0.999999), i2 = 3.0;
+            double q2 = integrate1D(&f2, 16, 0.00, 0.999999), i2 = 3.0;
             std::cout << "\\int_0.0^1.0 f2(x) dx = " << q2 << ", eps = " << std::abs(i2 - q2) / q2 << " over 16 points" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i2, q2, eps);
 
-            double q3 = integrate1D(std::function<double (const double &)>(&f3), 16, 0.00, 10.0), i3 = 1.0 - std::exp(-10.0);
+            double q3 = integrate1D(&f3, 16, 0.00, 10.0), i3 = 1.0 - std::exp(-10.0);
             std::cout << "\\int_0.0^10.0 f3(x) dx = " << q3 << ", eps = " << std::abs(i3 - q3) / q3 << " over 16 points" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i3, q3, eps);
 
@@ -111,5 +113,69 @@ class IntegrateTest :
             };
             auto q5 = integrate(cubature::fdd<dim>(f5lam), a_5, b_5, config_cubature);
             TEST_CHECK_RELATIVE_ERROR(q5, 1.0, eps);
+
+            // warm-started cubature: repeated calls for a slowly varying
+            // integrand agree with the cold-started result
+            {
+                cubature::WarmStart warm_start;
+
+                for (const double & s : { 0.00, 0.01, 0.02 })
+                {
+                    auto f6lam = [&s](const std::array<double, 2> &args) -> double {
+                        return std::exp(-50.0 * (power_of<2>(args[0] - 0.3 - s) + power_of<2>(args[1] - 0.7)));
+                    };
+                    constexpr std::array<double, 2> a_6 { 0.0, 0.0 };
+                    constexpr std::array<double, 2> b_6 { 1.0, 1.0 };
+
+                    const double q6_warm = integrate(cubature::fdd<2>(f6lam), a_6, b_6, warm_start, config_cubature);
+                    const double q6_cold = integrate(cubature::fdd<2>(f6lam), a_6, b_6, config_cubature);
+                    TEST_CHECK_RELATIVE_ERROR(q6_warm, q6_cold, eps);
+                }
+            }
         }
 } model_test;
+
+class IntegrateFixedTest :
+    public TestCase
+{
+    public:
+        IntegrateFixedTest() :
+            TestCase("integrate1D_fixed_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            // a points_-point rule integrates polynomials up to degree 2 * points_ - 1 exactly
+            {
+                auto p15 = [](const double & x) -> double { return 16.0 * power_of<15>(x) + 3.0 * power_of<2>(x); };
+
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<8u>(p15, 0.0, 1.0), 2.0, eps);
+            }
+
+            // smooth transcendental integrands against the analytic result
+            {
+                auto f = [](const double & x) -> double { return std::exp(x); };
+
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<16u>(f, 0.0, 1.0), std::exp(1.0) - 1.0, eps);
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<24u>(f, 0.0, 1.0), std::exp(1.0) - 1.0, eps);
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<32u>(f, 0.0, 1.0), std::exp(1.0) - 1.0, eps);
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<64u>(f, 0.0, 1.0), std::exp(1.0) - 1.0, eps);
+
+                auto g = [](const double & x) -> double { return std::log(x); };
+
+                TEST_CHECK_RELATIVE_ERROR(integrate1D_fixed<32u>(g, 1.0, std::exp(1.0)), 1.0, eps);
+            }
+
+            // complex-valued integrand
+            {
+                auto f = [](const double & x) -> complex<double> { return complex<double>(std::cos(x), std::sin(x)); };
+
+                const complex<double> q = integrate1D_fixed<32u>(f, 0.0, 1.0);
+                TEST_CHECK_RELATIVE_ERROR(real(q), std::sin(1.0), eps);
+                TEST_CHECK_RELATIVE_ERROR(imag(q), 1.0 - std::cos(1.0), eps);
+            }
+        }
+} integrate1d_fixed_test;
@@ -20,6 +20,8 @@
 #include <gsl/gsl_errno.h>
 #include <eos/utils/exception.hh>
 
+#include <cmath>
+
 namespace eos
 {
     CSplineInterpolation::CSplineInterpolation(const std::vector<double> & data_x, const std::vector<double> & data_y):
@@ -48,4 +50,200 @@ namespace eos
 
         return res;
     }
+
+    CubicSpline::CubicSpline(const std::vector<double> & data_x, const std::vector<double> & data_y) :
+        _x(data_x)
+    {
+        if (data_x.size() != data_y.size())
+        {
+            throw InternalError("CubicSpline: dimensions of x and y data do not match");
+        }
+
+        const std::size_t n = data_x.size();
+        if (n < 2)
+        {
+            throw InternalError("CubicSpline: at least two supporting points are required");
+        }
+
+        for (std::size_t i = 0 ; i + 1 < n ; ++i)
+        {
+            if (! (data_x[i] < data_x[i + 1]))
+            {
+                throw InternalError("CubicSpline: x data are not strictly ascending");
+            }
+        }
+
+        _x_min = data_x.front();
+        _x_max = data_x.back();
+
+        // detect a uniform grid, which admits direct indexing
+        const double spacing = (_x_max - _x_min) / (n - 1);
+        _uniform = true;
+        for (std::size_t i = 0 ; i + 1 < n ; ++i)
+        {
+            if (std::abs((data_x[i + 1] - data_x[i]) - spacing) > 1.0e-12 * spacing)
+            {
+                _uniform = false;
+                break;
+            }
+        }
+        _inv_spacing = _uniform ? 1.0 / spacing : 0.0;
+
+        // second derivatives m_i of the natural spline (m_0 = m_{n-1} = 0) from
+        // the tridiagonal system, solved by the Thomas algorithm
+        std::vector<double> m(n, 0.0);
+        if (n > 2)
+        {
+            std::vector<double> diag(n - 2), rhs(n - 2);
+            for (std::size_t i = 1 ; i + 1 < n ; ++i)
+            {
+                const double h_lo = data_x[i] - data_x[i - 1];
+                const double h_hi = data_x[i + 1] - data_x[i];
+
+                diag[i - 1] = 2.0 * (h_lo + h_hi);
+                rhs[i - 1]  = 6.0 * ((data_y[i + 1] - data_y[i]) / h_hi - (data_y[i] - data_y[i - 1]) / h_lo);
+            }
+
+            // forward elimination
+            for (std::size_t i = 1 ; i < n - 2 ; ++i)
+            {
+                const double h = data_x[i + 1] - data_x[i];
+                const double w = h / diag[i - 1];
+
+                diag[i] -= w * h;
+                rhs[i]  -= w * rhs[i - 1];
+            }
+
+            // back substitution
+            m[n - 2] = rhs[n - 3] / diag[n - 3];
+            for (std::size_t i = n - 3 ; i >= 1 ; --i)
+            {
+                const double h = data_x[i + 1] - data_x[i];
+
+                m[i] = (rhs[i - 1] - h * m[i + 1]) / diag[i - 1];
+            }
+        }
+
+        // flatten the per-interval coefficients into a single contiguous array
+        _coefficients.resize(4 * (n - 1));
+        for (std::size_t i = 0 ; i + 1 < n ; ++i)
+        {
+            const double h = data_x[i + 1] - data_x[i];
+
+            _coefficients[4 * i + 0] = data_y[i];
+            _coefficients[4 * i + 1] = (data_y[i + 1] - data_y[i]) / h - h * (2.0 * m[i] + m[i + 1]) / 6.0;
+            _coefficients[4 * i + 2] = m[i] / 2.0;
+            _coefficients[4 * i + 3] = (m[i + 1] - m[i]) / (6.0 * h);
+        }
+    }
+
+    std::size_t
+    CubicSpline::_interval(const double & x) const
+    {
+        const std::size_t n_intervals = _x.size() - 1;
+
+        if (_uniform)
+        {
+            const double offset = (x - _x_min) * _inv_spacing;
+            const std::size_t index = (offset > 0.0) ? static_cast<std::size_t>(offset) : 0;
+
+            return (index < n_intervals) ? index : (n_intervals - 1);
+        }
+
+        // branch-free binary search for the last node <= x; the ternary
+        // compiles to a conditional move, keeping the loop free of
+        // unpredictable branches
+        std::size_t base = 0, length = n_intervals;
+        while (length > 1)
+        {
+            const std::size_t half = length / 2;
+
+            base += (_x[base + half] <= x) ? half : 0;
+            length -= half;
+        }
+
+        return base;
+    }
+
+    inline double
+    CubicSpline::_evaluate(const double & x) const
+    {
+        const std::size_t i = _interval(x);
+        const double * c = &_coefficients[4 * i];
+        const double dx = x - _x[i];
+
+        // Horner evaluation on the contiguous coefficient quadruple
+        return c[0] + dx * (c[1] + dx * (c[2] + dx * c[3]));
+    }
+
+    double
+    CubicSpline::operator() (const double & x) const
+    {
+        if ((x < _x_min) || (x > _x_max))
+        {
+            throw InternalError("CubicSpline: evaluation point outside of the data range");
+        }
+
+        return _evaluate(x);
+    }
+
+    double
+    CubicSpline::integrate(const double & a, const double & b) const
+    {
+        if (a > b)
+        {
+            return -integrate(b, a);
+        }
+
+        if ((a < _x_min) || (b > _x_max))
+        {
+            throw InternalError("CubicSpline: integration boundary outside of the data range");
+        }
+
+        // antiderivative of the interval polynomial at local coordinate dx
+        auto primitive = [](const double * c, const double & dx) -> double
+        {
+            return dx * (c[0] + dx * (c[1] / 2.0 + dx * (c[2] / 3.0 + dx * c[3] / 4.0)));
+        };
+
+        const std::size_t i_a = _interval(a);
+        const std::size_t i_b = _interval(b);
+
+        if (i_a == i_b)
+        {
+            const double * c = &_coefficients[4 * i_a];
+
+            return primitive(c, b - _x[i_a]) - primitive(c, a - _x[i_a]);
+        }
+
+        // partial first interval, full intermediate intervals, partial last interval
+        double result = primitive(&_coefficients[4 * i_a], _x[i_a + 1] - _x[i_a])
+                - primitive(&_coefficients[4 * i_a], a - _x[i_a]);
+
+        for (std::size_t i = i_a + 1 ; i < i_b ; ++i)
+        {
+            result += primitive(&_coefficients[4 * i], _x[i + 1] - _x[i]);
+        }
+
+        result += primitive(&_coefficients[4 * i_b], b - _x[i_b]);
+
+        return result;
+    }
+
+    void
+    CubicSpline::evaluate(const double * x, double * y, std::size_t n) const
+    {
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            if ((x[j] < _x_min) || (x[j] > _x_max))
+            {
+                throw InternalError("CubicSpline: evaluation point outside of the data range");
+            }
+        }
+
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            y[j] = _evaluate(x[j]);
+        }
+    }
 }
@@ -19,6 +19,7 @@
 #ifndef EOS_GUARD_EOS_MATHS_INTERPOLATION_HH
 #define EOS_GUARD_EOS_MATHS_INTERPOLATION_HH 1
 
+#include <cstddef>
 #include <vector>
 #include <functional>
 #include <memory>
@@ -52,6 +53,78 @@ namespace eos
              */
             double operator()(const double & x) const;
     };
+
+    /*!
+     * Native natural cubic spline over a fixed table of nodes.
+     *
+     * Unlike CSplineInterpolation, which defers to GSL and performs an
+     * accelerator lookup per call, this class precomputes all polynomial
+     * coefficients at construction and stores them contiguously per interval.
+     * Uniform grids are detected at construction and indexed directly;
+     * non-uniform grids use a branch-free binary search. This keeps repeated
+     * evaluation of large tables limited by memory bandwidth rather than by
+     * per-call overhead.
+     */
+    class CubicSpline
+    {
+        private:
+            // node positions
+            std::vector<double> _x;
+
+            // polynomial coefficients, four consecutive entries (y, b, c, d) per
+            // interval: s(x) = y + b dx + c dx^2 + d dx^3 with dx = x - x_i
+            std::vector<double> _coefficients;
+
+            double _x_min;
+            double _x_max;
+
+            // reciprocal node spacing; valid only when _uniform is true
+            double _inv_spacing;
+            bool _uniform;
+
+            std::size_t _interval(const double & x) const;
+
+            double _evaluate(const double & x) const;
+
+        public:
+            CubicSpline() = delete;
+
+            /*!
+             * Precompute the spline coefficients for the given table.
+             *
+             * @param data_x The supporting points of the x domain of the function, in strictly ascending order.
+             * @param data_y The corresponding function values.
+             */
+            CubicSpline(const std::vector<double> & data_x, const std::vector<double> & data_y);
+
+            /*!
+             * Evaluate the interpolating function.
+             *
+             * @param x The point at which the function shall be evaluated.
+             */
+            double operator()(const double & x) const;
+
+            /*!
+             * Evaluate the interpolating function at a batch of points.
+             *
+             * @param x Pointer to the n points at which the function shall be evaluated.
+             * @param y Pointer to the n results.
+             * @param n The number of points.
+             */
+            void evaluate(const double * x, double * y, std::size_t n) const;
+
+            /*!
+             * Integrate the interpolating function analytically between a and b.
+             *
+             * The integral of the piecewise cubic polynomial is evaluated in
+             * closed form from the stored coefficients; no quadrature is
+             * involved.
+             *
+             * @param a The lower boundary of integration.
+             * @param b The upper boundary of integration.
+             */
+            double integrate(const double & a, const double & b) const;
+    };
 }
 
 #endif
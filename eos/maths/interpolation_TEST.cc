@@ -67,3 +67,106 @@ class InterpolationTest :
             }
         }
 } interpolation_test;
+
+class CubicSplineTest :
+    public TestCase
+{
+    public:
+        CubicSplineTest() :
+            TestCase("cubic_spline_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // agreement with the GSL-backed spline on a uniform grid
+            {
+                std::vector<double> data_x{ 0.0, 1.0, 2.0, 3.0, 4.0 };
+                std::vector<double> data_y{ 0.0, 0.8, 0.9, 0.1, -0.8 };
+
+                CSplineInterpolation reference(data_x, data_y);
+                CubicSpline spline(data_x, data_y);
+
+                for (double x = 0.0 ; x <= 4.0 ; x += 0.125)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(spline(x), reference(x), 1e-14);
+                }
+            }
+
+            // agreement with the GSL-backed spline on a non-uniform grid
+            {
+                std::vector<double> data_x{ 0.0, 0.3, 1.0, 2.4, 2.5, 4.0 };
+                std::vector<double> data_y{ 1.0, 0.8, -0.9, 0.1, 0.15, -0.8 };
+
+                CSplineInterpolation reference(data_x, data_y);
+                CubicSpline spline(data_x, data_y);
+
+                for (double x = 0.0 ; x <= 4.0 ; x += 0.125)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(spline(x), reference(x), 1e-14);
+                }
+            }
+
+            // batched evaluation matches point-wise evaluation
+            {
+                std::vector<double> data_x{ 0.0, 1.0, 2.0, 3.0, 4.0 };
+                std::vector<double> data_y{ 0.0, 0.8, 0.9, 0.1, -0.8 };
+
+                CubicSpline spline(data_x, data_y);
+
+                std::vector<double> x, y(33);
+                for (double value = 0.0 ; value <= 4.0 ; value += 0.125)
+                {
+                    x.push_back(value);
+                }
+
+                spline.evaluate(x.data(), y.data(), x.size());
+                for (std::size_t i = 0 ; i < x.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(y[i], spline(x[i]));
+                }
+            }
+
+            // two supporting points degenerate to linear interpolation
+            {
+                CubicSpline spline({ 0.0, 2.0 }, { 1.0, 3.0 });
+                TEST_CHECK_NEARLY_EQUAL(spline(0.5), 1.5, 1e-14);
+            }
+
+            // analytic integration reproduces the exact integral of a linear table
+            {
+                CubicSpline spline({ 0.0, 1.0, 2.0 }, { 0.0, 2.0, 4.0 });
+
+                TEST_CHECK_NEARLY_EQUAL(spline.integrate(0.25, 1.75), 3.0, 1e-14);
+            }
+
+            // integration is additive over subranges and antisymmetric under
+            // exchange of the boundaries
+            {
+                std::vector<double> data_x{ 0.0, 0.3, 1.0, 2.4, 2.5, 4.0 };
+                std::vector<double> data_y{ 1.0, 0.8, -0.9, 0.1, 0.15, -0.8 };
+
+                CubicSpline spline(data_x, data_y);
+
+                TEST_CHECK_NEARLY_EQUAL(spline.integrate(0.0, 1.3) + spline.integrate(1.3, 4.0), spline.integrate(0.0, 4.0), 1e-13);
+                TEST_CHECK_NEARLY_EQUAL(spline.integrate(3.1, 0.2), -spline.integrate(0.2, 3.1), 1e-14);
+            }
+
+            // evaluate outside of data range: must throw
+            {
+                CubicSpline spline({ 0.0, 1.0, 2.0 }, { 0.0, 1.0, 2.0 });
+                TEST_CHECK_THROWS(InternalError, spline(3.0));
+                TEST_CHECK_THROWS(InternalError, spline.integrate(0.0, 3.0));
+            }
+
+            // dimension mismatch: must throw
+            {
+                TEST_CHECK_THROWS(InternalError, CubicSpline({ 0.0, 1.0, 2.0 }, { 0.0, 1.0, 2.0, 3.0 }));
+            }
+
+            // unordered x data: must throw
+            {
+                TEST_CHECK_THROWS(InternalError, CubicSpline({ 0.0, 2.0, 1.0 }, { 0.0, 1.0, 2.0 }));
+            }
+        }
+} cubic_spline_test;
@@ -22,6 +22,7 @@
 #include <eos/maths/szego-polynomial.hh>
 
 #include <array>
+#include <cstddef>
 #include <numeric>
 
 namespace eos
@@ -81,6 +82,43 @@ namespace eos
                 return result;
             }
 
+            // Evaluate the Lagrange polynomial at several points in one call. The basis
+            // factors 1 / (x_i - x_j) are hoisted out of the point loop, which runs in
+            // lockstep so that the compiler can vectorize across the points.
+            template <std::size_t n_points_>
+            std::array<complex<double>, n_points_> operator() (const std::array<complex<double>, order_ + 1> & y_values,
+                                                               const std::array<complex<double>, n_points_> & z) const
+            {
+                std::array<complex<double>, n_points_> result;
+                std::array<complex<double>, n_points_> partial_result;
+
+                result.fill(0);
+
+                for (unsigned i = 0; i <= order_; i++)
+                {
+                    partial_result.fill(1);
+                    for (unsigned j = 0; j <= order_; j++)
+                    {
+                        if (i != j)
+                        {
+                            const complex<double> inv_basis = 1.0 / (_x_values[i] - _x_values[j]);
+
+                            for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                            {
+                                partial_result[p] *= (z[p] - _x_values[j]) * inv_basis;
+                            }
+                        }
+                    }
+
+                    for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                    {
+                        result[p] += partial_result[p] * y_values[i];
+                    }
+                }
+
+                return result;
+            }
+
             // Returns the coefficients of the polynomial in the monomial basis (z^n)_n
             std::array<complex<double>, order_ + 1> get_coefficients(const std::array<complex<double>, order_ + 1> & y_values) const
             {
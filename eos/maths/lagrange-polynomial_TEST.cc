@@ -56,6 +56,24 @@ class LagrangePolynomialTest :
                     TEST_CHECK_RELATIVE_ERROR_C(L(y_values, complex<double>(0.0, -1.0)), complex<double>(-12.8666666,  6.4), 1.0e-5);
                 }
 
+                // Batch evaluation
+                {
+                    LagrangePolynomial<3u> L{
+                        { -1.0,  0.0, 2.0, complex<double>(0.0, 1.0) },
+                    };
+
+                    const std::array<complex<double>, 4u> y_values{ 1.0, -2.0, complex<double>(1.0, 1.0), 7.0 };
+
+                    const std::array<complex<double>, 3u> z{ -1.0, 1.0, complex<double>(0.0, -1.0) };
+                    const auto batch = L(y_values, z);
+
+                    for (unsigned i = 0 ; i < 3u ; ++i)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(real(batch[i]), real(L(y_values, z[i])), 1.0e-14);
+                        TEST_CHECK_NEARLY_EQUAL(imag(batch[i]), imag(L(y_values, z[i])), 1.0e-14);
+                    }
+                }
+
                 // 0th order derivative
                 {
                     LagrangePolynomialDerivative<3u, 0u> L;
@@ -18,6 +18,7 @@
 #ifndef EOS_GUARD_EOS_MATHS_LEGENDRE_POLYNOMIAL_VECTOR_HH
 #define EOS_GUARD_EOS_MATHS_LEGENDRE_POLYNOMIAL_VECTOR_HH 1
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <complex>
@@ -71,6 +72,99 @@ namespace eos
                 return ret_vec;
             }
 
+            /*!
+             * Evaluates the full polynomial vector at n points in a single call.
+             *
+             * The three-term recurrence is carried out with the points in the
+             * innermost loop over contiguous storage, which allows the compiler
+             * to vectorize across points.
+             *
+             * @param z       pointer to the n points at which to evaluate
+             * @param n       number of points
+             * @param results pointer to row-major storage of shape (order_ + 1) x n,
+             *                i.e. results[i * n + p] = P_i(z_p)
+             */
+            void operator() (const double * z, const unsigned & n, double * results) const
+            {
+                for (unsigned p = 0 ; p < n ; p++)
+                {
+                    results[p] = 1.0;
+                }
+
+                if (order_ >= 1)
+                {
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        results[n + p] = z[p];
+                    }
+                }
+
+                for (unsigned i = 2 ; i <= order_ ; i++)
+                {
+                    const double * pm1 = results + (i - 1) * n;
+                    const double * pm2 = results + (i - 2) * n;
+                    double * pi = results + i * n;
+
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        pi[p] = (z[p] * pm1[p] * (2 * i - 1) - pm2[p] * (i - 1)) / i;
+                    }
+                }
+            }
+
+            /*!
+             * Evaluates the dot product of a coefficient vector with the polynomial
+             * vector at n points in a single fused pass, i.e. without materializing
+             * the individual polynomial values:
+             * results[p] = sum_i coefficients[i] * P_i(z_p).
+             *
+             * @param coefficients coefficients contracted against the polynomial vector
+             * @param z            pointer to the n points at which to evaluate
+             * @param n            number of points
+             * @param results      pointer to storage for the n results
+             */
+            void dot(const std::array<double, order_ + 1> & coefficients, const double * z, const unsigned & n, double * results) const
+            {
+                // number of points processed per block; the recurrence state for
+                // one block fits into a handful of vector registers
+                constexpr unsigned block_size = 16;
+
+                for (unsigned offset = 0 ; offset < n ; offset += block_size)
+                {
+                    const unsigned block = std::min(block_size, n - offset);
+                    const double * zb = z + offset;
+                    double * rb = results + offset;
+
+                    double pm2[block_size], pm1[block_size];
+
+                    for (unsigned p = 0 ; p < block ; p++)
+                    {
+                        pm2[p] = 1.0;
+                        rb[p] = coefficients[0];
+                    }
+
+                    if (order_ >= 1)
+                    {
+                        for (unsigned p = 0 ; p < block ; p++)
+                        {
+                            pm1[p] = zb[p];
+                            rb[p] += coefficients[1] * pm1[p];
+                        }
+                    }
+
+                    for (unsigned i = 2 ; i <= order_ ; i++)
+                    {
+                        for (unsigned p = 0 ; p < block ; p++)
+                        {
+                            const double pi = (zb[p] * pm1[p] * (2 * i - 1) - pm2[p] * (i - 1)) / i;
+                            rb[p] += coefficients[i] * pi;
+                            pm2[p] = pm1[p];
+                            pm1[p] = pi;
+                        }
+                    }
+                }
+            }
+
             // Return zeros and compute Gauss-Legendre weights
             void gauss_legendre(std::array<double, order_> & zeros, std::array<double, order_> & weights)
             {
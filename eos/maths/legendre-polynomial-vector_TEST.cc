@@ -63,6 +63,62 @@ class LegendrePolynomialVectorTest :
                     TEST_CHECK_RELATIVE_ERROR(resQ15[5],    0.0024668237064868373,  1.0e-10);
                     TEST_CHECK_RELATIVE_ERROR(resQ15[6],    0.0008704965773399678,  1.0e-10);
                 }
+
+                // Batch evaluation of P agrees with the point-wise evaluation
+                {
+                    LegendrePVector<6u> P;
+
+                    constexpr unsigned n = 37;
+                    double z[n], results[7 * n];
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        z[p] = -1.0 + 2.0 * p / (n - 1);
+                    }
+
+                    P(z, n, results);
+
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        auto resP = P(z[p]);
+
+                        for (unsigned i = 0 ; i <= 6 ; i++)
+                        {
+                            TEST_CHECK_NEARLY_EQUAL(results[i * n + p], resP[i], 1.0e-14);
+                        }
+                    }
+                }
+
+                // Fused dot product agrees with the explicit contraction
+                {
+                    LegendrePVector<6u> P;
+
+                    const std::array<double, 7> coefficients
+                    {
+                        1.0, -0.5, 0.25, 0.7, -0.3, 0.1, 0.05
+                    };
+
+                    constexpr unsigned n = 37;
+                    double z[n], results[n];
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        z[p] = -1.0 + 2.0 * p / (n - 1);
+                    }
+
+                    P.dot(coefficients, z, n, results);
+
+                    for (unsigned p = 0 ; p < n ; p++)
+                    {
+                        auto resP = P(z[p]);
+
+                        double reference = 0.0;
+                        for (unsigned i = 0 ; i <= 6 ; i++)
+                        {
+                            reference += coefficients[i] * resP[i];
+                        }
+
+                        TEST_CHECK_NEARLY_EQUAL(results[p], reference, 1.0e-14);
+                    }
+                }
             }
         }
 } legendre_polynomial_vector_test;
@@ -22,6 +22,9 @@
 #define EOS_GUARD_EOS_MATHS_MATRIX_HH 1
 
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
 
 namespace eos
 {
@@ -91,7 +94,9 @@ namespace eos
 
     /* Multiplication */
 
-    /* matrix times matrix */
+    /* matrix times matrix; the i-k-j loop order keeps the inner loop contiguous
+     * in both the result and y, so that it vectorizes for the fixed dimensions
+     * used throughout */
     template <typename T_, std::size_t m_, std::size_t n_, std::size_t o_>
     std::array<std::array<T_, n_>, m_> operator* (const std::array<std::array<T_, o_>, m_> & x,
             const std::array<std::array<T_, n_>, o_> & y)
@@ -102,10 +107,15 @@ namespace eos
             for (std::size_t j(0) ; j < n_ ; ++j)
             {
                 result[i][j] = 0.0;
+            }
+
+            for (std::size_t k(0) ; k < o_ ; ++k)
+            {
+                const T_ x_ik = x[i][k];
 
-                for (std::size_t k(0) ; k < o_ ; ++k)
+                for (std::size_t j(0) ; j < n_ ; ++j)
                 {
-                    result[i][j] += x[i][k] * y[k][j];
+                    result[i][j] += x_ik * y[k][j];
                 }
             }
         }
@@ -113,6 +123,40 @@ namespace eos
         return result;
     }
 
+    /* matrix times diagonal matrix, the latter represented by its diagonal;
+     * equivalent to x * diag(d) at a fraction of the cost of a full product */
+    template <typename T_, std::size_t m_, std::size_t n_>
+    std::array<std::array<T_, n_>, m_> scale_columns(const std::array<std::array<T_, n_>, m_> & x, const std::array<T_, n_> & d)
+    {
+        std::array<std::array<T_, n_>, m_> result;
+        for (std::size_t i(0) ; i < m_ ; ++i)
+        {
+            for (std::size_t j(0) ; j < n_ ; ++j)
+            {
+                result[i][j] = x[i][j] * d[j];
+            }
+        }
+
+        return result;
+    }
+
+    /* diagonal matrix times matrix, the former represented by its diagonal;
+     * equivalent to diag(d) * x at a fraction of the cost of a full product */
+    template <typename T_, std::size_t m_, std::size_t n_>
+    std::array<std::array<T_, n_>, m_> scale_rows(const std::array<T_, m_> & d, const std::array<std::array<T_, n_>, m_> & x)
+    {
+        std::array<std::array<T_, n_>, m_> result;
+        for (std::size_t i(0) ; i < m_ ; ++i)
+        {
+            for (std::size_t j(0) ; j < n_ ; ++j)
+            {
+                result[i][j] = d[i] * x[i][j];
+            }
+        }
+
+        return result;
+    }
+
     /* matrix times vector, right-multiplication */
     template <typename T_, std::size_t m_, std::size_t n_>
     std::array<T_, m_> operator* (const std::array<std::array<T_, n_>, m_> & x, const std::array<T_, n_> & y)
@@ -203,6 +247,101 @@ namespace eos
         return result;
     }
 
+    /* determinant of a square matrix, via LU decomposition with partial pivoting.
+     * The dimension is fixed at compile time, so no heap allocation is involved. */
+    template <typename T_, std::size_t n_>
+    T_ determinant(const std::array<std::array<T_, n_>, n_> & x)
+    {
+        using std::abs;
+
+        std::array<std::array<T_, n_>, n_> lu = x;
+        T_ result = 1.0;
+
+        for (std::size_t k(0) ; k < n_ ; ++k)
+        {
+            std::size_t pivot = k;
+            for (std::size_t i(k + 1) ; i < n_ ; ++i)
+            {
+                if (abs(lu[i][k]) > abs(lu[pivot][k]))
+                    pivot = i;
+            }
+            if (pivot != k)
+            {
+                std::swap(lu[pivot], lu[k]);
+                result = -result;
+            }
+
+            result *= lu[k][k];
+
+            for (std::size_t i(k + 1) ; i < n_ ; ++i)
+            {
+                const T_ factor = lu[i][k] / lu[k][k];
+                for (std::size_t j(k + 1) ; j < n_ ; ++j)
+                {
+                    lu[i][j] -= factor * lu[k][j];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /* inverse of a square matrix, via Gauss-Jordan elimination with partial pivoting.
+     * The dimension is fixed at compile time, so no heap allocation is involved.
+     * A singular matrix yields non-finite entries. */
+    template <typename T_, std::size_t n_>
+    std::array<std::array<T_, n_>, n_> inverse(const std::array<std::array<T_, n_>, n_> & x)
+    {
+        using std::abs;
+
+        std::array<std::array<T_, n_>, n_> work = x;
+        std::array<std::array<T_, n_>, n_> result;
+        for (std::size_t i(0) ; i < n_ ; ++i)
+        {
+            for (std::size_t j(0) ; j < n_ ; ++j)
+            {
+                result[i][j] = (i == j) ? 1.0 : 0.0;
+            }
+        }
+
+        for (std::size_t k(0) ; k < n_ ; ++k)
+        {
+            std::size_t pivot = k;
+            for (std::size_t i(k + 1) ; i < n_ ; ++i)
+            {
+                if (abs(work[i][k]) > abs(work[pivot][k]))
+                    pivot = i;
+            }
+            if (pivot != k)
+            {
+                std::swap(work[pivot], work[k]);
+                std::swap(result[pivot], result[k]);
+            }
+
+            const T_ scale = T_(1.0) / work[k][k];
+            for (std::size_t j(0) ; j < n_ ; ++j)
+            {
+                work[k][j] *= scale;
+                result[k][j] *= scale;
+            }
+
+            for (std::size_t i(0) ; i < n_ ; ++i)
+            {
+                if (i == k)
+                    continue;
+
+                const T_ factor = work[i][k];
+                for (std::size_t j(0) ; j < n_ ; ++j)
+                {
+                    work[i][j] -= factor * work[k][j];
+                    result[i][j] -= factor * result[k][j];
+                }
+            }
+        }
+
+        return result;
+    }
+
     /* component-wise division of two vectors */
     template <typename T_, std::size_t n_>
     std::array<T_, n_> divide(const std::array<T_, n_> & x, const std::array<T_, n_> & y)
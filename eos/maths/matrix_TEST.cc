@@ -176,6 +176,46 @@ class MatrixMultiplicationTest :
                 }
             }
 
+            // scaling by a diagonal matrix, represented by its diagonal
+            {
+                static const array<array<double, 3>, 4> x
+                {{
+                    array<double, 3>{{0.280209,   0.909076,   0.191122}},
+                    array<double, 3>{{0.650764,   0.967410,   0.044342}},
+                    array<double, 3>{{0.474950,   0.838596,   0.210205}},
+                    array<double, 3>{{0.421354,   0.060448,   0.267996}},
+                }};
+                static const array<double, 3> d{{0.5, -2.0, 3.0}};
+                static const array<array<double, 3>, 3> diag
+                {{
+                    array<double, 3>{{0.5,  0.0, 0.0}},
+                    array<double, 3>{{0.0, -2.0, 0.0}},
+                    array<double, 3>{{0.0,  0.0, 3.0}},
+                }};
+                static const array<double, 4> e{{0.5, -2.0, 3.0, 0.25}};
+                static const array<array<double, 4>, 4> diag_e
+                {{
+                    array<double, 4>{{0.5,  0.0, 0.0, 0.0 }},
+                    array<double, 4>{{0.0, -2.0, 0.0, 0.0 }},
+                    array<double, 4>{{0.0,  0.0, 3.0, 0.0 }},
+                    array<double, 4>{{0.0,  0.0, 0.0, 0.25}},
+                }};
+
+                array<array<double, 3>, 4> columns = scale_columns(x, d);
+                array<array<double, 3>, 4> columns_full = x * diag;
+                array<array<double, 3>, 4> rows = scale_rows(e, x);
+                array<array<double, 3>, 4> rows_full = diag_e * x;
+
+                for (unsigned i(0) ; i < 4 ; ++i)
+                {
+                    for (unsigned j(0) ; j < 3 ; ++j)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(columns[i][j], columns_full[i][j], 1e-15);
+                        TEST_CHECK_NEARLY_EQUAL(rows[i][j],    rows_full[i][j],    1e-15);
+                    }
+                }
+            }
+
             // vector * matrix
             {
                 using Matrix = array<array<double, 3>, 3>;
@@ -49,10 +49,12 @@ namespace eos
         //Checked
 
         complex<double> li2logA0rec(complex<double> next, int nc, const complex<double> &lsq){
-            if(nc<LI2LOGA0MAX){
-                return next*ccli2logA0[nc] + li2logA0rec(next*lsq, nc+1, lsq);
+            complex<double> result = 0.;
+            for( ; nc<LI2LOGA0MAX ; ++nc){
+                result += next*ccli2logA0[nc];
+                next *= lsq;
             }
-            return next*ccli2logA0[nc];
+            return result + next*ccli2logA0[LI2LOGA0MAX];
         }
 
         complex<double> li2logA0(const complex<double> &x){
@@ -64,12 +66,14 @@ namespace eos
         complex<double> li22rec(complex<double> next, complex<double> extra, int nc,const complex<double> &a,
             const complex<double> &ab, int &ncmax)
         {
-            if(nc<ncmax){
-                return next + li22rec(ccli221[nc]*a*next + ccli222[nc]*extra, extra*ab, nc+1, a, ab, ncmax);
-            }
-            else{
-                return next + ccli221[nc]*a*next + ccli222[nc]*extra;
+            // iterative Horner chain; keeps both running terms in registers
+            complex<double> result = 0.;
+            for( ; nc<ncmax ; ++nc){
+                result += next;
+                next = ccli221[nc]*a*next + ccli222[nc]*extra;
+                extra *= ab;
             }
+            return result + next + ccli221[ncmax]*a*next + ccli222[ncmax]*extra;
         }
 
         complex<double> li22fast(const complex<double> &a, const complex<double> &b, int &ncmax)
@@ -83,11 +87,13 @@ namespace eos
         complex<double> li22stufflerec(complex<double> next, complex<double> extra, int nc, const complex<double> &b,
             const complex<double> &ab, int &ncmax)
         {
-            if(nc<ncmax){
-                return next + li22stufflerec(ccli22stuffle1[nc]*b*next + ccli22stuffle2[nc]*extra,
-                    extra*ab, nc+1, b, ab, ncmax);
+            complex<double> result = 0.;
+            for( ; nc<ncmax ; ++nc){
+                result += next;
+                next = ccli22stuffle1[nc]*b*next + ccli22stuffle2[nc]*extra;
+                extra *= ab;
             }
-            return next + ccli22stuffle1[nc]*b*next + ccli22stuffle2[nc]*extra;
+            return result + next + ccli22stuffle1[ncmax]*b*next + ccli22stuffle2[ncmax]*extra;
         }
 
         complex<double> li22stuffle(const complex<double> &a, const complex<double> &b, int &ncmax)
@@ -484,10 +490,13 @@ namespace eos
         complex<double> holderf1rec(complex<double> part1, complex<double> part2, const complex<double> &x,
             const complex<double> &xy, int n, int &nn)
         {
-            if(n<nn){
-                return part1 + holderf1rec(part1*x*ccholder11[n]+part2, part2*xy*ccholder12[n], x, xy, n+1, nn);
+            complex<double> result = 0.;
+            for( ; n<nn ; ++n){
+                result += part1;
+                part1 = part1*x*ccholder11[n]+part2;
+                part2 *= xy*ccholder12[n];
             }
-            return part1;
+            return result + part1;
         }
 
         complex<double> holderf1(const complex<double> &x, const complex<double> &xy, int &nn)
@@ -499,11 +508,18 @@ namespace eos
         complex<double> holderf2rec(complex<double> part1, complex<double> part2, complex<double> part3,
             complex<double> part4, const complex<double> &x, const complex<double> &z, int n, int &nn)
         {
-            if(n<nn){
-                return part1 + holderf2rec(part1*x*ccholder21[n]+part2, part2*ccholder22[n]+part3,
-                    part3*z*ccholder23[n]+part4, part4*ccholder24[n], x, z, n+1, nn);
+            complex<double> result = 0.;
+            for( ; n<nn ; ++n){
+                result += part1;
+                const complex<double> next1 = part1*x*ccholder21[n]+part2;
+                const complex<double> next2 = part2*ccholder22[n]+part3;
+                const complex<double> next3 = part3*z*ccholder23[n]+part4;
+                part4 *= ccholder24[n];
+                part1 = next1;
+                part2 = next2;
+                part3 = next3;
             }
-            return part1;
+            return result + part1;
         }
 
         complex<double> holderf2(const complex<double> &x, const complex<double> &z, int &nn)
@@ -516,10 +532,13 @@ namespace eos
         complex<double> holderf3rec(complex<double> part1, complex<double> part2, const complex<double> &x,
             const complex<double> &xy, int n, int &nn)
         {
-            if(n<nn){
-                return part1 + holderf3rec(part1*x*ccholder31[n]+part2, part2*xy*ccholder32[n], x, xy, n+1, nn);
+            complex<double> result = 0.;
+            for( ; n<nn ; ++n){
+                result += part1;
+                part1 = part1*x*ccholder31[n]+part2;
+                part2 *= xy*ccholder32[n];
             }
-            return part1;
+            return result + part1;
         }
 
         complex<double> holderf3(const complex<double> &x, const complex<double> &xy, int &nn)
@@ -530,10 +549,13 @@ namespace eos
         // This is Li11(x/2, 1/x)
         complex<double> holderf4rec(complex<double> part1, complex<double> part2, const complex<double> &x, int n, int &nn)
         {
-            if(n<nn){
-                return part1 + holderf4rec(part1*x*ccholder41[n]+part2, part2*ccholder42[n], x, n+1, nn);
+            complex<double> result = 0.;
+            for( ; n<nn ; ++n){
+                result += part1;
+                part1 = part1*x*ccholder41[n]+part2;
+                part2 *= ccholder42[n];
             }
-            return part1;
+            return result + part1;
         }
 
         complex<double> holderf4(const complex<double> &x, int &nn)
@@ -545,11 +567,16 @@ namespace eos
         complex<double> holderf5rec(complex<double> part1, complex<double> part2, complex<double> part3,
             const complex<double> &y, int n, int &nn)
         {
-            if(n<nn){
-                return part1 + holderf5rec(part1*ccholder51[n]+part2, y*part2*ccholder52[n]+part3,
-                    part3*ccholder53[n], y, n+1, nn);
+            complex<double> result = 0.;
+            for( ; n<nn ; ++n){
+                result += part1;
+                const complex<double> next1 = part1*ccholder51[n]+part2;
+                const complex<double> next2 = y*part2*ccholder52[n]+part3;
+                part3 *= ccholder53[n];
+                part1 = next1;
+                part2 = next2;
             }
-            return part1;
+            return result + part1;
         }
 
         complex<double> holderf5(const complex<double> &y, int &nn)
@@ -1054,4 +1081,14 @@ namespace eos
 
         return li22_impl::li22basic(x2,y2);
     }
+
+    void li22(const complex<double> * x, const complex<double> * y, complex<double> * results, unsigned n)
+    {
+        // each pair selects its own convergence region, so the points are
+        // evaluated independently through the scalar kernel
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            results[i] = li22(x[i], y[i]);
+        }
+    }
 }
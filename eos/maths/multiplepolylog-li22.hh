@@ -25,6 +25,13 @@
 namespace eos
 {
     complex<double> li22(const complex<double> & x, const complex<double> & y) __attribute__ ((pure));
+
+    /*!
+     * Evaluate Li22 for a batch of n argument pairs, writing the values to results.
+     * Intended for callers that need Li22 at many weight-function arguments per
+     * phase-space point, such as the analytic charm-loop corrections.
+     */
+    void li22(const complex<double> * x, const complex<double> * y, complex<double> * results, unsigned n);
 }
 
 #endif
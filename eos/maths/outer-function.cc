@@ -46,4 +46,59 @@ namespace eos
         return std::exp(integrate1D(integrand, npoints, 0.0, 2 * M_PI) / 2.0 / M_PI );
     }
 
+    OuterFunction::OuterFunction(const std::function<complex<double> (const complex<double> &)> & f, unsigned npoints, unsigned ncoefficients) :
+        _coefficients(ncoefficients, complex<double>(0.0, 0.0))
+    {
+        if (0 == ncoefficients)
+            throw InternalError("Trying to construct outer function without coefficients");
+
+        // sample the boundary modulus once; the trapezoidal rule is spectrally
+        // accurate for periodic integrands, so these samples determine all
+        // Fourier coefficients a_n = (1 / 2 pi) int dt log|f(e^{i t})| e^{-i n t}
+        std::vector<double> u(npoints);
+        for (unsigned k = 0 ; k < npoints ; ++k)
+        {
+            const double t = 2.0 * M_PI * k / npoints;
+            const double x = std::abs(f(std::exp(complex<double>(0.0, t))));
+
+            if (std::abs(x) < 1e-16)
+            {
+                throw InternalError("Trying to compute outer function of function with zero on unit circle");
+            }
+            else if (! isfinite(x))
+            {
+                throw InternalError("Trying to compute outer function of function with pole on unit circle");
+            }
+
+            u[k] = std::log(x);
+        }
+
+        for (unsigned n = 0 ; n < ncoefficients ; ++n)
+        {
+            complex<double> sum(0.0, 0.0);
+            for (unsigned k = 0 ; k < npoints ; ++k)
+            {
+                const double t = 2.0 * M_PI * k / npoints;
+                sum += u[k] * std::exp(complex<double>(0.0, -1.0 * n * t));
+            }
+
+            _coefficients[n] = sum / static_cast<double>(npoints);
+        }
+    }
+
+    complex<double>
+    OuterFunction::operator() (const complex<double> & z) const
+    {
+        if (std::abs(z) >= 1.0)
+            throw InternalError("Trying to evaluate outer function outside of unit disk. This is not yet supported.");
+
+        // Horner recurrence for log O(z) = a_0 + 2 sum_{n >= 1} a_n z^n
+        complex<double> sum(0.0, 0.0);
+        for (unsigned n = _coefficients.size() - 1 ; n >= 1 ; --n)
+        {
+            sum = (_coefficients[n] + sum) * z;
+        }
+
+        return std::exp(_coefficients[0] + 2.0 * sum);
+    }
 }
@@ -23,12 +23,48 @@
 #include <eos/maths/complex.hh>
 
 #include <functional>
+#include <vector>
 
 namespace eos
 {
     /* Computes the outer function of a given function f numerically using the integral representation */
     complex<double> outer(const std::function<complex<double> (const complex<double> &)> & f, complex<double> z, unsigned npoints);
 
+    /*!
+     * Precomputed outer function of a given function f.
+     *
+     * The boundary modulus log|f(e^{it})| is expanded once, at construction, into its
+     * Fourier coefficients a_n; the Schwarz integral representation then collapses to
+     * the rapidly converging power series
+     *
+     *   log O(z) = a_0 + 2 sum_{n >= 1} a_n z^n,
+     *
+     * which each evaluation sums by a Horner recurrence. This replaces the full
+     * boundary integral per z point of outer(), and pays off whenever the same f is
+     * evaluated at many points, e.g. for the outer functions of unitarity bounds,
+     * whose masses rarely change within a fit.
+     *
+     * The coefficients of an analytic log|f| decay geometrically, so a modest number
+     * of them reproduces outer() to its own accuracy.
+     */
+    class OuterFunction
+    {
+        private:
+            std::vector<complex<double>> _coefficients;
+
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param f             The function whose outer function shall be computed; must have neither zeros nor poles on the unit circle.
+             * @param npoints       Number of boundary samples of f entering the Fourier coefficients.
+             * @param ncoefficients Number of power-series coefficients to precompute.
+             */
+            OuterFunction(const std::function<complex<double> (const complex<double> &)> & f, unsigned npoints, unsigned ncoefficients);
+
+            /// Evaluate the outer function inside the unit disk.
+            complex<double> operator() (const complex<double> & z) const;
+    };
 }
 
 #endif
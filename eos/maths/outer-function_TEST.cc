@@ -95,5 +95,37 @@ class OuterFunctionTest :
                 TEST_CHECK_THROWS(InternalError, outer(test_func_4, 0.0, 1024));
                 TEST_CHECK_THROWS(InternalError, outer(test_func_5, 0.0, 1024));
             }
+
+            // the precomputed power series agrees with the closed forms and the integral representation
+            {
+                constexpr double eps_series = 1e-10;
+
+                OuterFunction outer_2(test_func_2, 1024, 40);
+                OuterFunction outer_3(test_func_3, 1024, 40);
+
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.0)).real(),      2.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.0)).imag(),      0.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.5)).real(),      2.5,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.5)).imag(),      0.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.1,0.2)).real(),  2.1,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_2(complex<double>(0.1,0.2)).imag(),  0.2,        eps_series);
+
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.0)).real(),      1.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.0)).imag(),      0.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.5)).real(),      0.6,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.5)).imag(),      0.0,        eps_series);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.1,0.2)).real(),  0.887640,   eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(complex<double>(0.1,0.2)).imag(), -0.179775,   eps);
+
+                // agreement with the per-point integral away from the closed forms
+                const complex<double> z(-0.3, 0.45);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(z).real(), outer(test_func_3, z, 1024).real(), eps);
+                TEST_CHECK_NEARLY_EQUAL(outer_3(z).imag(), outer(test_func_3, z, 1024).imag(), eps);
+
+                TEST_CHECK_THROWS(InternalError, outer_2(complex<double>(2.0)));
+                TEST_CHECK_THROWS(InternalError, OuterFunction(test_func_2, 1024, 0));
+                TEST_CHECK_THROWS(InternalError, OuterFunction(test_func_4, 1024, 40));
+                TEST_CHECK_THROWS(InternalError, OuterFunction(test_func_5, 1024, 40));
+            }
     }
 } outer_function_test;
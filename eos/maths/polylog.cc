@@ -19,7 +19,11 @@
  */
 
 #include <eos/maths/complex.hh>
+#include <eos/maths/fast-math.hh>
+#include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
 
 #include <array>
 #include <cmath>
@@ -389,6 +393,112 @@ namespace eos
         }
     }
 
+    namespace polylog_impl
+    {
+        // number of independent element streams in the batched series kernel;
+        // eight doubles fill an AVX-512 register and two SSE/AVX2 register pairs
+        static const std::size_t strip_width = 4;
+
+        // Evaluates the series expansion around the origin, sum_i z^i / i^weight_,
+        // for a strip of arguments with |z| < 0.5. Unlike the scalar f0, the strip
+        // runs a fixed number of iterations: for |z| < 0.5 the neglected tail is
+        // below the double precision target anyway, and a branchless inner loop
+        // over independent streams is what allows the compiler to vectorize it.
+        template <std::size_t width_, unsigned weight_>
+        void f0_strip(const complex<double> * z, complex<double> * results)
+        {
+            double zre[width_], zim[width_], xre[width_], xim[width_], re[width_], im[width_];
+
+            for (std::size_t j = 0 ; j < width_ ; ++j)
+            {
+                zre[j] = z[j].real();
+                zim[j] = z[j].imag();
+                xre[j] = 1.0;
+                xim[j] = 0.0;
+                re[j]  = 0.0;
+                im[j]  = 0.0;
+            }
+
+            for (int i = 1 ; i < max_iterations ; ++i)
+            {
+                const double c = 1.0 / power_of<weight_>(double(i));
+
+                for (std::size_t j = 0 ; j < width_ ; ++j)
+                {
+                    const double t = xre[j] * zre[j] - xim[j] * zim[j];
+                    xim[j] = xre[j] * zim[j] + xim[j] * zre[j];
+                    xre[j] = t;
+
+                    re[j] += c * xre[j];
+                    im[j] += c * xim[j];
+                }
+            }
+
+            for (std::size_t j = 0 ; j < width_ ; ++j)
+            {
+                results[j] = complex<double>(re[j], im[j]);
+            }
+        }
+
+        // Partitions a batch of arguments: elements inside the series' convergence
+        // region are collected into strips for f0_strip, all others are handed to
+        // the scalar implementation.
+        template <unsigned weight_>
+        void batch(complex<double> (* scalar)(const complex<double> &),
+                const complex<double> * z, complex<double> * results, const std::size_t & n)
+        {
+            std::size_t pending[strip_width];
+            std::size_t n_pending = 0;
+
+            complex<double> zs[strip_width], rs[strip_width];
+
+            for (std::size_t k = 0 ; k < n ; ++k)
+            {
+                if (std::norm(z[k]) < 0.25) // |z| < 0.5
+                {
+                    pending[n_pending++] = k;
+
+                    if (n_pending == strip_width)
+                    {
+                        for (std::size_t j = 0 ; j < strip_width ; ++j)
+                        {
+                            zs[j] = z[pending[j]];
+                        }
+
+                        f0_strip<strip_width, weight_>(zs, rs);
+
+                        for (std::size_t j = 0 ; j < strip_width ; ++j)
+                        {
+                            results[pending[j]] = rs[j];
+                        }
+
+                        n_pending = 0;
+                    }
+                }
+                else
+                {
+                    results[k] = scalar(z[k]);
+                }
+            }
+
+            // incomplete final strip
+            for (std::size_t j = 0 ; j < n_pending ; ++j)
+            {
+                results[pending[j]] = scalar(z[pending[j]]);
+            }
+        }
+    }
+
+    void dilog(const complex<double> * z, complex<double> * results, const std::size_t & n)
+    {
+        polylog_impl::batch<2>(&dilog, z, results, n);
+    }
+
+    void trilog(const complex<double> * z, complex<double> * results, const std::size_t & n)
+    {
+        polylog_impl::batch<3>(&trilog, z, results, n);
+    }
+
     // Calculation of the quadlogarithm based on [C:2006A]
     complex<double> quadlog(const complex<double> & z)
     {
@@ -410,4 +520,87 @@ namespace eos
 
         return quadlog_impl::f1(z);
     }
+
+    void quadlog(const complex<double> * z, complex<double> * results, const std::size_t & n)
+    {
+        polylog_impl::batch<4>(&quadlog, z, results, n);
+    }
+
+    namespace real_dilog_impl
+    {
+        /*
+         * Kernel for 0 <= x <= 1/2: the Bernoulli series in w = -ln(1 - x),
+         *
+         *     Li_2(x) = w - w^2 / 4 + sum_k B_{2k} w^{2k+1} / (2k+1)!,
+         *
+         * whose terms fall off like (w / 2 pi)^{2k}; at x = 1/2 eight terms
+         * suffice for full double precision. The remaining quadrant of the
+         * real axis is folded onto this interval by the Landen and inversion
+         * identities below.
+         */
+        inline double kernel(const double & x)
+        {
+            const double w  = -std::log1p(-x);
+            const double w2 = w * w;
+
+            // B_{2k} / (2k+1)! for k = 1 .. 8
+            return w - 0.25 * w2
+                + w * w2 * horner(w2,
+                        +2.7777777777777777778e-02,  //  1 / 36
+                        -2.7777777777777777778e-04,  // -1 / 3600
+                        +4.7241118669690098262e-06,  //  1 / 211680
+                        -9.1857730746619635509e-08,  // -1 / 10886400
+                        +1.8978869988970999072e-09,
+                        -4.0647616451442255268e-11,
+                        +8.9216910204564525552e-13,
+                        -1.9939295860721075687e-14);
+        }
+    } // namespace real_dilog_impl
+
+    double real_dilog(const double & x)
+    {
+        static const double pi2_6 = M_PI * M_PI / 6.0;
+
+        if (x > 1.0)
+        {
+            throw InternalError("real_dilog: argument " + stringify(x) + " exceeds 1, where the dilogarithm becomes complex");
+        }
+
+        if (x < -1.0)
+        {
+            // inversion: maps (-inf, -1) onto (-1, 0)
+            const double lnmx = std::log(-x);
+
+            return -pi2_6 - 0.5 * lnmx * lnmx - real_dilog(1.0 / x);
+        }
+
+        if (x < 0.0)
+        {
+            // Landen: maps [-1, 0) onto (0, 1/2]
+            const double ln1mx = std::log1p(-x);
+
+            return -real_dilog_impl::kernel(x / (x - 1.0)) - 0.5 * ln1mx * ln1mx;
+        }
+
+        if (x <= 0.5)
+        {
+            return real_dilog_impl::kernel(x);
+        }
+
+        if (x < 1.0)
+        {
+            // reflection: maps (1/2, 1) onto (0, 1/2)
+            return pi2_6 - std::log(x) * std::log1p(-x) - real_dilog_impl::kernel(1.0 - x);
+        }
+
+        return pi2_6;
+    }
+
+    void real_dilog(const double * x, double * results, const std::size_t & n)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            results[i] = real_dilog(x[i]);
+        }
+    }
 }
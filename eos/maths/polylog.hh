@@ -23,6 +23,8 @@
 
 #include <eos/maths/complex.hh>
 
+#include <cstddef>
+
 namespace eos
 {
     complex<double> dilog(const complex<double> & z) __attribute__ ((pure));
@@ -30,6 +32,40 @@ namespace eos
     complex<double> trilog(const complex<double> & z) __attribute__ ((pure));
 
     complex<double> quadlog(const complex<double> & z) __attribute__ ((pure));
+
+    /*!
+     * Batch evaluation of the polylogarithms.
+     *
+     * Equivalent to applying the scalar function to each element of z. Arguments
+     * inside the convergence region of the series around the origin are evaluated
+     * in strips of independent element streams, which the compiler can vectorize;
+     * all remaining arguments fall back to the scalar implementation.
+     *
+     * @param z        array of n arguments
+     * @param results  array that receives the n function values
+     * @param n        number of arguments
+     */
+    void dilog(const complex<double> * z, complex<double> * results, const std::size_t & n);
+
+    /// @see dilog(const complex<double> *, complex<double> *, const std::size_t &)
+    void trilog(const complex<double> * z, complex<double> * results, const std::size_t & n);
+
+    /// @see dilog(const complex<double> *, complex<double> *, const std::size_t &)
+    void quadlog(const complex<double> * z, complex<double> * results, const std::size_t & n);
+
+    /*!
+     * The dilogarithm for real arguments x <= 1, where it is real-valued.
+     *
+     * Evaluated from a short Bernoulli series in -ln(1 - x) on [0, 1/2],
+     * onto which the inversion, Landen, and reflection identities fold the
+     * rest of the domain; no complex arithmetic is involved. Throws
+     * InternalError for x > 1, where the dilogarithm acquires an imaginary
+     * part and the complex overload must be used instead.
+     */
+    double real_dilog(const double & x) __attribute__ ((pure));
+
+    /// Batch evaluation of real_dilog(const double &).
+    void real_dilog(const double * x, double * results, const std::size_t & n);
 }
 
 #endif
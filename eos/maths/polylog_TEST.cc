@@ -22,6 +22,7 @@
 #include <eos/maths/polylog.hh>
 
 #include <fstream>
+#include <vector>
 
 #include <iomanip>
 
@@ -101,3 +102,106 @@ class PolylogarithmTest :
             TEST_CHECK_RELATIVE_ERROR(real(quadlog(-c05)), +real(quadlog(zbar)), eps); // has no imaginary part
         }
 } polylogarithm_test;
+
+class BatchPolylogarithmTest :
+    public TestCase
+{
+    public:
+        BatchPolylogarithmTest() :
+            TestCase("batch_polylogarithm_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            // arguments from all evaluation regions: series around the origin,
+            // the unit-circle annulus, the reflected region, and special points
+            std::vector<complex<double>> z;
+            for (double r : { 0.0, 0.1, 0.3, 0.49, 0.7, 1.0, 1.9, 2.5, 10.0 })
+            {
+                for (double phi = 0.0 ; phi < 6.2 ; phi += 0.7)
+                {
+                    z.push_back(std::polar(r, phi));
+                }
+            }
+            z.push_back(complex<double>(+1.0, 0.0));
+            z.push_back(complex<double>(-1.0, 0.0));
+
+            std::vector<complex<double>> results(z.size());
+
+            dilog(z.data(), results.data(), z.size());
+            for (std::size_t k = 0 ; k < z.size() ; ++k)
+            {
+                const complex<double> reference = dilog(z[k]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(results[k]), eps);
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(results[k]), eps);
+            }
+
+            trilog(z.data(), results.data(), z.size());
+            for (std::size_t k = 0 ; k < z.size() ; ++k)
+            {
+                const complex<double> reference = trilog(z[k]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(results[k]), eps);
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(results[k]), eps);
+            }
+
+            quadlog(z.data(), results.data(), z.size());
+            for (std::size_t k = 0 ; k < z.size() ; ++k)
+            {
+                const complex<double> reference = quadlog(z[k]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(results[k]), eps);
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(results[k]), eps);
+            }
+        }
+} batch_polylogarithm_test;
+
+class RealDilogarithmTest :
+    public TestCase
+{
+    public:
+        RealDilogarithmTest() :
+            TestCase("real_dilogarithm_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            // known closed-form values
+            TEST_CHECK_RELATIVE_ERROR(M_PI * M_PI / 6.0, real_dilog(1.0), eps);
+            TEST_CHECK_RELATIVE_ERROR(-M_PI * M_PI / 12.0, real_dilog(-1.0), eps);
+            TEST_CHECK_RELATIVE_ERROR(M_PI * M_PI / 12.0 - 0.5 * std::log(2.0) * std::log(2.0), real_dilog(0.5), eps);
+            TEST_CHECK_NEARLY_EQUAL(0.0, real_dilog(0.0), eps);
+
+            // agreement with the complex implementation across every branch of
+            // the piecewise representation: inversion, Landen, kernel, reflection
+            for (int i = -5000 ; i <= 999 ; ++i)
+            {
+                const double x = i / 1000.0;
+
+                TEST_CHECK_NEARLY_EQUAL(real(dilog(complex<double>(x, 0.0))), real_dilog(x), eps);
+            }
+
+            // the batch overload matches the scalar one
+            {
+                std::vector<double> x, results;
+                for (int i = -40 ; i <= 10 ; ++i)
+                {
+                    x.push_back(i / 10.0);
+                }
+                results.resize(x.size());
+
+                real_dilog(x.data(), results.data(), x.size());
+                for (std::size_t k = 0 ; k < x.size() ; ++k)
+                {
+                    TEST_CHECK_EQUAL(real_dilog(x[k]), results[k]);
+                }
+            }
+
+            // beyond x = 1 the dilogarithm is complex
+            TEST_CHECK_THROWS(InternalError, real_dilog(1.5));
+        }
+} real_dilogarithm_test;
@@ -23,6 +23,7 @@
 #include <eos/maths/power-of.hh>
 
 #include <array>
+#include <cstddef>
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_complex_math.h>
@@ -151,6 +152,97 @@ namespace eos
                 return result;
             }
 
+            // Evaluate the normalized polynomials at several points in one call.
+            // The Verblunsky recurrence is serial in the order n but independent across
+            // the points, so running it in lockstep lets the compiler vectorize the
+            // inner loops across points.
+            template <std::size_t n_points_>
+            std::array<std::array<double, order_ + 1>, n_points_> operator() (const std::array<double, n_points_> & z) const
+            {
+                // point-major storage: phi[n][p] holds phi_n(z_p)
+                std::array<std::array<double, n_points_>, order_ + 1> phi;
+                std::array<std::array<double, n_points_>, order_ + 1> phi_star;
+
+                for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                {
+                    phi[0][p]      = 1.0;
+                    phi_star[0][p] = 1.0;
+                }
+
+                // we use real-valued Verblunsky coefficients only.
+                for (unsigned n = 1 ; n <= order_ ; ++n)
+                {
+                    const double rho = _verblunsky_coefficients[n - 1];
+
+                    for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                    {
+                        // cf. [S:2004B], eqs. (1.4) and (1.5), p. 2
+                        phi[n][p]      = z[p] * phi[n - 1][p]  - rho * phi_star[n - 1][p];
+                        phi_star[n][p] = phi_star[n - 1][p] - rho * z[p] * phi[n - 1][p];
+                    }
+                }
+
+                std::array<std::array<double, order_ + 1>, n_points_> result;
+                for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                {
+                    for (unsigned n = 0 ; n <= order_ ; ++n)
+                    {
+                        result[p][n] = phi[n][p] / _norms[n];
+                    }
+                }
+
+                return result;
+            }
+
+            // Fused quadrature entry: accumulates weight * integrand * phi_n(z) over a
+            // batch of points in a single pass, i.e.
+            //     result[n] = \sum_p weights[p] * integrand[p] * phi_n(z[p]),
+            // without materializing the per-point polynomial values. This is the
+            // convolution of an integrand against the orthonormal basis, as needed
+            // when projecting onto the polynomials by numerical quadrature.
+            template <std::size_t n_points_>
+            std::array<double, order_ + 1> convolve(const std::array<double, n_points_> & z,
+                                                    const std::array<double, n_points_> & weights,
+                                                    const std::array<double, n_points_> & integrand) const
+            {
+                std::array<double, n_points_> f;
+                std::array<double, n_points_> phi_prev, phi_star_prev;
+                std::array<double, n_points_> phi_curr, phi_star_curr;
+
+                double accumulator = 0.0;
+                for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                {
+                    f[p]             = weights[p] * integrand[p];
+                    phi_prev[p]      = 1.0;
+                    phi_star_prev[p] = 1.0;
+                    accumulator     += f[p];
+                }
+
+                std::array<double, order_ + 1> result;
+                result[0] = accumulator / _norms[0];
+
+                // we use real-valued Verblunsky coefficients only.
+                for (unsigned n = 1 ; n <= order_ ; ++n)
+                {
+                    const double rho = _verblunsky_coefficients[n - 1];
+
+                    accumulator = 0.0;
+                    for (std::size_t p = 0 ; p < n_points_ ; ++p)
+                    {
+                        // cf. [S:2004B], eqs. (1.4) and (1.5), p. 2
+                        phi_curr[p]      = z[p] * phi_prev[p]  - rho * phi_star_prev[p];
+                        phi_star_curr[p] = phi_star_prev[p] - rho * z[p] * phi_prev[p];
+                        accumulator     += f[p] * phi_curr[p];
+                    }
+                    result[n] = accumulator / _norms[n];
+
+                    phi_prev.swap(phi_curr);
+                    phi_star_prev.swap(phi_star_curr);
+                }
+
+                return result;
+            }
+
             // Trivial generalization to real Verblunsky coefficients and complex z
             std::array<complex<double>, order_ + 1> operator() (const complex<double> & z) const
             {
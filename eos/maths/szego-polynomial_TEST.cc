@@ -126,5 +126,45 @@ class SzegoPolynomialTest :
                 }
             }
 
+            // Test the batch evaluation against the pointwise one
+            {
+                const auto p = SzegoPolynomial<5u>::FlatMeasure(2.47895); // norm of the measure
+
+                const std::array<double, 4u> z{ -0.1, 0.0, +0.1, +0.7 };
+
+                const auto batch = p(z);
+                for (unsigned i = 0 ; i < 4u ; ++i)
+                {
+                    const auto pointwise = p(z[i]);
+
+                    for (unsigned n = 0 ; n <= 5u ; ++n)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(batch[i][n], pointwise[n], 1.0e-15);
+                    }
+                }
+            }
+
+            // Test the fused convolution against the explicit accumulation
+            {
+                const auto p = SzegoPolynomial<5u>::FlatMeasure(2.47895); // norm of the measure
+
+                const std::array<double, 4u> z{ -0.1, 0.0, +0.1, +0.7 };
+                const std::array<double, 4u> weights{ 0.35, 0.65, 0.65, 0.35 };
+                const std::array<double, 4u> integrand{ 1.7, -0.3, 0.8, 2.1 };
+
+                const auto convolved = p.convolve(z, weights, integrand);
+
+                for (unsigned n = 0 ; n <= 5u ; ++n)
+                {
+                    double reference = 0.0;
+                    for (unsigned i = 0 ; i < 4u ; ++i)
+                    {
+                        reference += weights[i] * integrand[i] * p(z[i])[n];
+                    }
+
+                    TEST_CHECK_NEARLY_EQUAL(convolved[n], reference, 1.0e-14);
+                }
+            }
+
         }
 } szego_polynomial_test;
@@ -26,6 +26,7 @@
 #include <eos/utils/qcd.hh>
 
 #include <cmath>
+#include <cstdint>
 
 namespace eos
 {
@@ -49,63 +50,117 @@ namespace eos
         _v_ts_abs__ckm(p["CKM::abs(V_ts)"], u),
         _v_ts_arg__ckm(p["CKM::arg(V_ts)"], u),
         _v_tb_abs__ckm(p["CKM::abs(V_tb)"], u),
-        _v_tb_arg__ckm(p["CKM::arg(V_tb)"], u)
+        _v_tb_arg__ckm(p["CKM::arg(V_tb)"], u),
+        _parameters__ckm(p)
     {
     }
 
+    CKMScanComponent::Snapshot
+    CKMScanComponent::_snapshot() const
+    {
+        // returned by value under the lock: a reference into the shared
+        // snapshot could be read while another thread refreshes it
+        std::lock_guard<std::mutex> lock(_snapshot_mutex__ckm);
+
+        Snapshot & snapshot = _snapshot__ckm;
+
+        const std::uint64_t generation = _parameters__ckm.generation();
+        if ((generation != snapshot.generation) || (! snapshot.valid))
+        {
+            // recompute only if one of the inputs actually changed since the
+            // snapshot was taken; other parameter modifications merely bump
+            // the recorded generation
+            if ((! snapshot.valid)
+                    || (_v_ud_abs__ckm.generation() > snapshot.generation) || (_v_ud_arg__ckm.generation() > snapshot.generation)
+                    || (_v_us_abs__ckm.generation() > snapshot.generation) || (_v_us_arg__ckm.generation() > snapshot.generation)
+                    || (_v_ub_abs__ckm.generation() > snapshot.generation) || (_v_ub_arg__ckm.generation() > snapshot.generation)
+                    || (_v_cd_abs__ckm.generation() > snapshot.generation) || (_v_cd_arg__ckm.generation() > snapshot.generation)
+                    || (_v_cs_abs__ckm.generation() > snapshot.generation) || (_v_cs_arg__ckm.generation() > snapshot.generation)
+                    || (_v_cb_abs__ckm.generation() > snapshot.generation) || (_v_cb_arg__ckm.generation() > snapshot.generation)
+                    || (_v_td_abs__ckm.generation() > snapshot.generation) || (_v_td_arg__ckm.generation() > snapshot.generation)
+                    || (_v_ts_abs__ckm.generation() > snapshot.generation) || (_v_ts_arg__ckm.generation() > snapshot.generation)
+                    || (_v_tb_abs__ckm.generation() > snapshot.generation) || (_v_tb_arg__ckm.generation() > snapshot.generation))
+            {
+                snapshot.matrix = std::array<complex<double>, 9>{
+                    std::polar(_v_ud_abs__ckm(), _v_ud_arg__ckm()),
+                    std::polar(_v_us_abs__ckm(), _v_us_arg__ckm()),
+                    std::polar(_v_ub_abs__ckm(), _v_ub_arg__ckm()),
+                    std::polar(_v_cd_abs__ckm(), _v_cd_arg__ckm()),
+                    std::polar(_v_cs_abs__ckm(), _v_cs_arg__ckm()),
+                    std::polar(_v_cb_abs__ckm(), _v_cb_arg__ckm()),
+                    std::polar(_v_td_abs__ckm(), _v_td_arg__ckm()),
+                    std::polar(_v_ts_abs__ckm(), _v_ts_arg__ckm()),
+                    std::polar(_v_tb_abs__ckm(), _v_tb_arg__ckm()),
+                };
+
+                snapshot.valid = true;
+            }
+
+            snapshot.generation = generation;
+        }
+
+        return snapshot;
+    }
+
     /* CKM matrix elements */
     complex<double>
     CKMScanComponent::ckm_ud() const
     {
-        return std::polar(_v_ud_abs__ckm(), _v_ud_arg__ckm());
+        return _snapshot().matrix[0];
     }
 
     complex<double>
     CKMScanComponent::ckm_us() const
     {
-        return std::polar(_v_us_abs__ckm(), _v_us_arg__ckm());
+        return _snapshot().matrix[1];
     }
 
     complex<double>
     CKMScanComponent::ckm_ub() const
     {
-        return std::polar(_v_ub_abs__ckm(), _v_ub_arg__ckm());
+        return _snapshot().matrix[2];
     }
 
     complex<double>
     CKMScanComponent::ckm_cd() const
     {
-        return std::polar(_v_cd_abs__ckm(), _v_cd_arg__ckm());
+        return _snapshot().matrix[3];
     }
 
     complex<double>
     CKMScanComponent::ckm_cs() const
     {
-        return std::polar(_v_cs_abs__ckm(), _v_cs_arg__ckm());
+        return _snapshot().matrix[4];
     }
 
     complex<double>
     CKMScanComponent::ckm_cb() const
     {
-        return std::polar(_v_cb_abs__ckm(), _v_cb_arg__ckm());
+        return _snapshot().matrix[5];
     }
 
     complex<double>
     CKMScanComponent::ckm_td() const
     {
-        return std::polar(_v_td_abs__ckm(), _v_td_arg__ckm());
+        return _snapshot().matrix[6];
     }
 
     complex<double>
     CKMScanComponent::ckm_ts() const
     {
-        return std::polar(_v_ts_abs__ckm(), _v_ts_arg__ckm());
+        return _snapshot().matrix[7];
     }
 
     complex<double>
     CKMScanComponent::ckm_tb() const
     {
-        return std::polar(_v_tb_abs__ckm(), _v_tb_arg__ckm());
+        return _snapshot().matrix[8];
+    }
+
+    std::array<complex<double>, 9>
+    CKMScanComponent::ckm_matrix() const
+    {
+        return _snapshot().matrix;
     }
 
     CKMScanModel::CKMScanModel(const Parameters & parameters, const Options & options) :
@@ -23,6 +23,9 @@
 #include <eos/models/model.hh>
 #include <eos/models/standard-model.hh>
 
+#include <cstdint>
+#include <mutex>
+
 namespace eos
 {
     class CKMScanComponent : public virtual ModelComponent<components::CKM>
@@ -56,6 +59,35 @@ namespace eos
             UsedParameter _v_tb_abs__ckm;
             UsedParameter _v_tb_arg__ckm;
 
+            /* Memoisation of the CKM matrix elements */
+            Parameters _parameters__ckm;
+
+            /*!
+             * Snapshot of all nine CKM matrix elements as a flat array, in
+             * row-major order { ud, us, ub, cd, cs, cb, td, ts, tb }.
+             *
+             * Scans query several elements per evaluation; the snapshot
+             * replaces the per-access polar reconstruction by a single
+             * generation check, and is refreshed only when one of the
+             * eighteen input parameters actually changed.
+             */
+            struct Snapshot
+            {
+                std::uint64_t generation = 0;
+
+                bool valid = false;
+
+                std::array<complex<double>, 9> matrix;
+            };
+
+            mutable Snapshot _snapshot__ckm;
+
+            // serializes snapshot access: parallel integration evaluates one
+            // model object from several threads at once
+            mutable std::mutex _snapshot_mutex__ckm;
+
+            Snapshot _snapshot() const;
+
         public:
             CKMScanComponent(const Parameters &, const Options &, ParameterUser &);
 
@@ -69,6 +101,8 @@ namespace eos
             virtual complex<double> ckm_td() const;
             virtual complex<double> ckm_ts() const;
             virtual complex<double> ckm_tb() const;
+
+            virtual std::array<complex<double>, 9> ckm_matrix() const;
     };
 
     class CKMScanModel :
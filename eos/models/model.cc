@@ -28,6 +28,18 @@ namespace eos
 {
     Model::~Model() {}
 
+    // fallback for models without a cached matrix: compose the batch from the
+    // element accessors
+    std::array<complex<double>, 9>
+    ModelComponent<components::CKM>::ckm_matrix() const
+    {
+        return std::array<complex<double>, 9>{
+            ckm_ud(), ckm_us(), ckm_ub(),
+            ckm_cd(), ckm_cs(), ckm_cb(),
+            ckm_td(), ckm_ts(), ckm_tb(),
+        };
+    }
+
     const std::map<Model::KeyType, Model::ValueType> Model::models{
         std::make_pair("CKM", &CKMScanModel::make),
         std::make_pair("SM", &StandardModel::make),
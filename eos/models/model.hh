@@ -28,6 +28,7 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/quantum-numbers.hh>
 
+#include <array>
 #include <complex>
 #include <map>
 
@@ -94,6 +95,16 @@ namespace eos
             virtual complex<double> ckm_td() const = 0;
             virtual complex<double> ckm_ts() const = 0;
             virtual complex<double> ckm_tb() const = 0;
+
+            /*!
+             * Retrieve all nine CKM matrix elements in one call, in row-major
+             * order { ud, us, ub, cd, cs, cb, td, ts, tb }.
+             *
+             * Amplitude code that needs several elements per evaluation should
+             * prefer this batched accessor; the models serve it from their
+             * cached matrix at the cost of a single generation check.
+             */
+            virtual std::array<complex<double>, 9> ckm_matrix() const;
     };
 
     /*!
@@ -35,6 +35,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 
 namespace eos
 {
@@ -44,7 +45,8 @@ namespace eos
         _A__ckm(p["CKM::A"], u),
         _lambda__ckm(p["CKM::lambda"], u),
         _rhobar__ckm(p["CKM::rhobar"], u),
-        _etabar__ckm(p["CKM::etabar"], u)
+        _etabar__ckm(p["CKM::etabar"], u),
+        _parameters__ckm(p)
     {
     }
 
@@ -66,106 +68,121 @@ namespace eos
     /*
      * For the parametrisation of all CKM matrix elements, cf. [CKMfitter04], Footnote 4, p. 10
      */
-    complex<double>
-    SMComponent<components::CKM>::ckm_cd() const
+    SMComponent<components::CKM>::Snapshot
+    SMComponent<components::CKM>::_snapshot() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda4 = power_of<4>(_lambda__ckm()), lambda6 = power_of<6>(_lambda__ckm());
+        // returned by value under the lock: a reference into the shared
+        // snapshot could be read while another thread refreshes it
+        std::lock_guard<std::mutex> lock(_snapshot_mutex__ckm);
 
-        complex<double> result = -_lambda__ckm() * (1.0 - A2 * lambda4 * (1.0 - 2.0 * rho_eta) / 2.0 - A2 * lambda6 * rho_eta / 2.0);
+        Snapshot & snapshot = _snapshot__ckm;
 
-        return result;
+        const std::uint64_t generation = _parameters__ckm.generation();
+        if ((generation != snapshot.generation) || (! snapshot.valid))
+        {
+            // recompute only if one of the inputs actually changed since the
+            // snapshot was taken; other parameter modifications merely bump
+            // the recorded generation
+            if ((! snapshot.valid)
+                    || (_A__ckm.generation()      > snapshot.generation)
+                    || (_lambda__ckm.generation() > snapshot.generation)
+                    || (_rhobar__ckm.generation() > snapshot.generation)
+                    || (_etabar__ckm.generation() > snapshot.generation))
+            {
+                const double A = _A__ckm(), lambda = _lambda__ckm();
+
+                const complex<double> rho_eta = implementation::rho_eta(A, lambda, _rhobar__ckm, _etabar__ckm);
+                const double          norm_rho_eta = std::norm(rho_eta);
+
+                const double A2 = power_of<2>(A), A4 = A2 * A2;
+                const double lambda2 = power_of<2>(lambda), lambda3 = lambda * lambda2, lambda4 = lambda2 * lambda2,
+                             lambda6 = lambda2 * lambda4, lambda8 = lambda4 * lambda4;
+
+                snapshot.ud = complex<double>(1.0 - lambda2 / 2.0 - lambda4 / 8.0 - lambda6 * (1.0 + 8.0 * A2 * norm_rho_eta) / 16.0
+                        - lambda8 * (5.0 - 32.0 * A2 * norm_rho_eta) / 128.0, 0.0);
+                snapshot.us = complex<double>(lambda * (1.0 - 0.5 * A2 * lambda6 * norm_rho_eta), 0.0);
+                snapshot.ub = A * lambda3 * std::conj(rho_eta);
+                snapshot.cd = -lambda * (1.0 - A2 * lambda4 * (1.0 - 2.0 * rho_eta) / 2.0 - A2 * lambda6 * rho_eta / 2.0);
+                snapshot.cs = 1.0 - lambda2 / 2.0 - lambda4 * (1.0 + 4.0 * A2) / 8.0 - lambda6 * (1.0 - 4.0 * A2 + 16.0 * A2 * rho_eta) / 16.0
+                        - lambda8 * (5.0 - 8.0 * A2 + 16.0 * A4) / 128.0;
+                snapshot.cb = complex<double>(A * lambda2 * (1.0 - 0.5 * A2 * lambda6 * norm_rho_eta), 0.0);
+                snapshot.td = A * lambda3 * ((1.0 - rho_eta) + lambda2 * rho_eta / 2.0 + lambda4 * (1.0 + 4.0 * A2) * rho_eta / 8.0);
+                snapshot.ts = -1.0 * A * lambda2 * (1.0 - lambda2 * (1.0 - 2.0 * rho_eta) / 2.0 - lambda4 / 8.0 - lambda6 * (1.0 + 8.0 * A2 * rho_eta) / 16.0);
+                snapshot.tb = complex<double>(1.0 - A2 * lambda4 / 2.0 - A2 * lambda6 * norm_rho_eta / 2.0 - A4 * lambda8 / 8.0, 0.0);
+
+                snapshot.valid = true;
+            }
+
+            snapshot.generation = generation;
+        }
+
+        return snapshot;
     }
 
     complex<double>
-    SMComponent<components::CKM>::ckm_cs() const
+    SMComponent<components::CKM>::ckm_cd() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), A4 = power_of<2>(A2);
-        double          lambda2 = power_of<2>(_lambda__ckm()), lambda4 = power_of<2>(lambda2), lambda6 = lambda4 * lambda2, lambda8 = lambda4 * lambda4;
-        ;
-
-        complex<double> result =
-                1.0 - lambda2 / 2.0 - lambda4 * (1.0 + 4.0 * A2) / 8.0 - lambda6 * (1.0 - 4.0 * A2 + 16.0 * A2 * rho_eta) / 16.0 - lambda8 * (5.0 - 8.0 * A2 + 16.0 * A4) / 128.0;
+        return _snapshot().cd;
+    }
 
-        return result;
+    complex<double>
+    SMComponent<components::CKM>::ckm_cs() const
+    {
+        return _snapshot().cs;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_cb() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda2 = power_of<2>(_lambda__ckm()), lambda6 = power_of<3>(lambda2);
-
-        double result = _A__ckm * lambda2 * (1.0 - 0.5 * A2 * lambda6 * std::norm(rho_eta));
-
-        return complex<double>(result, 0.0);
+        return _snapshot().cb;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_ud() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda2 = power_of<2>(_lambda__ckm()), lambda4 = lambda2 * lambda2, lambda6 = lambda2 * lambda4, lambda8 = lambda4 * lambda4;
-
-        double result = 1.0 - lambda2 / 2.0 - lambda4 / 8.0 - lambda6 * (1.0 + 8.0 * A2 * std::norm(rho_eta)) / 16.0 - lambda8 * (5.0 - 32.0 * A2 * std::norm(rho_eta)) / 128.0;
-
-        return complex<double>(result, 0.0);
+        return _snapshot().ud;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_us() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda6 = power_of<6>(_lambda__ckm());
-
-        double result = _lambda__ckm * (1.0 - 0.5 * A2 * lambda6 * std::norm(rho_eta));
-
-        return complex<double>(result, 0.0);
+        return _snapshot().us;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_ub() const
     {
-        complex<double> rho_eta_conj = std::conj(implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm));
-
-        complex<double> result = _A__ckm * power_of<3>(_lambda__ckm()) * rho_eta_conj;
-
-        return result;
+        return _snapshot().ub;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_td() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda2 = power_of<2>(_lambda__ckm()), lambda3 = _lambda__ckm() * lambda2, lambda4 = lambda2 * lambda2;
-
-        complex<double> result = _A__ckm * lambda3 * ((1.0 - rho_eta) + lambda2 * rho_eta / 2.0 + lambda4 * (1.0 + 4.0 * A2) * rho_eta / 8.0);
-
-        return result;
+        return _snapshot().td;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_ts() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), lambda2 = power_of<2>(_lambda__ckm()), lambda4 = lambda2 * lambda2, lambda6 = lambda2 * lambda4;
-
-        complex<double> result = -1.0 * _A__ckm * lambda2 * (1.0 - lambda2 * (1.0 - 2.0 * rho_eta) / 2.0 - lambda4 / 8.0 - lambda6 * (1.0 + 8.0 * A2 * rho_eta) / 16.0);
-
-        return result;
+        return _snapshot().ts;
     }
 
     complex<double>
     SMComponent<components::CKM>::ckm_tb() const
     {
-        complex<double> rho_eta = implementation::rho_eta(_A__ckm, _lambda__ckm, _rhobar__ckm, _etabar__ckm);
-        double          A2 = power_of<2>(_A__ckm()), A4 = A2 * A2;
-        double          lambda4 = power_of<4>(_lambda__ckm()), lambda6 = power_of<6>(_lambda__ckm()), lambda8 = lambda4 * lambda4;
+        return _snapshot().tb;
+    }
 
-        double result = 1.0 - A2 * lambda4 / 2.0 - A2 * lambda6 * std::norm(rho_eta) / 2.0 - A4 * lambda8 / 8.0;
+    std::array<complex<double>, 9>
+    SMComponent<components::CKM>::ckm_matrix() const
+    {
+        const Snapshot snapshot = _snapshot();
 
-        return complex<double>(result, 0.0);
+        return std::array<complex<double>, 9>{
+            snapshot.ud, snapshot.us, snapshot.ub,
+            snapshot.cd, snapshot.cs, snapshot.cb,
+            snapshot.td, snapshot.ts, snapshot.tb,
+        };
     }
 
     SMComponent<components::QCD>::SMComponent(const Parameters & p, ParameterUser & u) :
@@ -180,12 +197,61 @@ namespace eos
         _m_s_MSbar__qcd(p["mass::s(2GeV)"], u),
         _m_d_MSbar__qcd(p["mass::d(2GeV)"], u),
         _m_u_MSbar__qcd(p["mass::u(2GeV)"], u),
-        _m_Z__qcd(p["mass::Z"], u)
+        _m_Z__qcd(p["mass::Z"], u),
+        _parameters__qcd(p)
     {
     }
 
+    double
+    SMComponent<components::QCD>::_memoise(RunningCache & cache, const double & mu, double (SMComponent<components::QCD>::* compute)(const double &) const) const
+    {
+        const std::uint64_t generation = _parameters__qcd.generation();
+
+        {
+            std::lock_guard<std::mutex> lock(_running_cache_mutex__qcd);
+
+            if (cache.generation != generation)
+            {
+                cache.values.clear();
+                cache.generation = generation;
+            }
+
+            // the handful of scales queried per parameter point makes a linear
+            // scan cheaper than any associative container
+            for (const auto & value : cache.values)
+            {
+                if (value.first == mu)
+                {
+                    return value.second;
+                }
+            }
+        }
+
+        // computed outside the lock: the running masses query alpha_s through
+        // this very function, and two threads computing the same scale only
+        // duplicates work, not state
+        const double result = (this->*compute)(mu);
+
+        {
+            std::lock_guard<std::mutex> lock(_running_cache_mutex__qcd);
+
+            if (cache.generation == generation)
+            {
+                cache.values.emplace_back(mu, result);
+            }
+        }
+
+        return result;
+    }
+
     double
     SMComponent<components::QCD>::alpha_s(const double & mu) const
+    {
+        return _memoise(_alpha_s_cache__qcd, mu, &SMComponent<components::QCD>::_alpha_s);
+    }
+
+    double
+    SMComponent<components::QCD>::_alpha_s(const double & mu) const
     {
         double alpha_s_0 = _alpha_s_Z__qcd, mu_0 = _m_Z__qcd;
 
@@ -257,6 +323,12 @@ namespace eos
 
     double
     SMComponent<components::QCD>::m_b_msbar(const double & mu) const
+    {
+        return _memoise(_m_b_msbar_cache__qcd, mu, &SMComponent<components::QCD>::_m_b_msbar);
+    }
+
+    double
+    SMComponent<components::QCD>::_m_b_msbar(const double & mu) const
     {
         double m_b_MSbar  = _m_b_MSbar__qcd();
         double alpha_mu_0 = alpha_s(m_b_MSbar);
@@ -346,6 +418,12 @@ namespace eos
 
     double
     SMComponent<components::QCD>::m_c_msbar(const double & mu) const
+    {
+        return _memoise(_m_c_msbar_cache__qcd, mu, &SMComponent<components::QCD>::_m_c_msbar);
+    }
+
+    double
+    SMComponent<components::QCD>::_m_c_msbar(const double & mu) const
     {
         double m_c_0       = _m_c_MSbar__qcd();
         double alpha_s_mu0 = alpha_s(m_c_0);
@@ -404,6 +482,12 @@ namespace eos
 
     double
     SMComponent<components::QCD>::m_s_msbar(const double & mu) const
+    {
+        return _memoise(_m_s_msbar_cache__qcd, mu, &SMComponent<components::QCD>::_m_s_msbar);
+    }
+
+    double
+    SMComponent<components::QCD>::_m_s_msbar(const double & mu) const
     {
         double m_s_0       = _m_s_MSbar__qcd();
         double alpha_s_mu0 = alpha_s(2.0);
@@ -25,6 +25,11 @@
 #include <eos/models/model.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace eos
 {
     template <typename Tag> class SMComponent;
@@ -38,6 +43,35 @@ namespace eos
             UsedParameter _rhobar__ckm;
             UsedParameter _etabar__ckm;
 
+            /* Memoisation of the CKM matrix elements */
+            Parameters _parameters__ckm;
+
+            /*!
+             * Snapshot of all nine CKM matrix elements as a flat struct.
+             *
+             * Amplitude code in the b-decays and rare-b-decays hot loops queries
+             * several elements per evaluation; the snapshot replaces the repeated
+             * re-expansion of the Wolfenstein parametrisation by a single
+             * generation check, and is refreshed only when one of the four input
+             * parameters actually changed.
+             */
+            struct Snapshot
+            {
+                std::uint64_t generation = 0;
+
+                bool valid = false;
+
+                complex<double> ud, us, ub, cd, cs, cb, td, ts, tb;
+            };
+
+            mutable Snapshot _snapshot__ckm;
+
+            // serializes snapshot access: parallel integration evaluates one
+            // model object from several threads at once
+            mutable std::mutex _snapshot_mutex__ckm;
+
+            Snapshot _snapshot() const;
+
         public:
             SMComponent(const Parameters &, ParameterUser &);
 
@@ -51,6 +85,8 @@ namespace eos
             virtual complex<double> ckm_td() const;
             virtual complex<double> ckm_ts() const;
             virtual complex<double> ckm_tb() const;
+
+            virtual std::array<complex<double>, 9> ckm_matrix() const;
     };
 
     template <> class SMComponent<components::QCD> : public virtual ModelComponent<components::QCD>
@@ -72,6 +108,40 @@ namespace eos
             UsedParameter _m_u_MSbar__qcd;
             UsedParameter _m_Z__qcd;
 
+            /* Memoisation of the running coupling and masses */
+            Parameters _parameters__qcd;
+
+            /*!
+             * Cache of running-coupling or running-mass values at the scales
+             * queried since the last modification of the parameters.
+             *
+             * Amplitudes and form factors query the running at a handful of
+             * distinct scales, each of them dozens of times per parameter
+             * point; memoising at the exact queried scales therefore collapses
+             * the cost after the first query without introducing any
+             * interpolation error.
+             */
+            struct RunningCache
+            {
+                std::uint64_t generation = 0;
+
+                std::vector<std::pair<double, double>> values;
+            };
+
+            mutable RunningCache _alpha_s_cache__qcd, _m_b_msbar_cache__qcd, _m_c_msbar_cache__qcd, _m_s_msbar_cache__qcd;
+
+            // serializes cache access: parallel integration evaluates one
+            // model object from several threads at once
+            mutable std::mutex _running_cache_mutex__qcd;
+
+            double _memoise(RunningCache & cache, const double & mu, double (SMComponent::* compute)(const double &) const) const;
+
+            /* the uncached implementations of the running */
+            double _alpha_s(const double &) const;
+            double _m_b_msbar(const double &) const;
+            double _m_c_msbar(const double &) const;
+            double _m_s_msbar(const double &) const;
+
         public:
             SMComponent(const Parameters &, ParameterUser &);
 
@@ -347,7 +347,10 @@ namespace eos
         complex<double> eta = alpha_s_0 / alpha_s;
 
         array<complex<double>, 15> a;
-        Matrix                     H_qcd_0, H_qcd_1, H_qcd_2;
+        // H_qcd_0 is diagonal; storing only the diagonal lets the products below
+        // use row and column scalings instead of full matrix multiplications
+        array<complex<double>, 15> H_qcd_0;
+        Matrix                     H_qcd_1, H_qcd_2;
         for (unsigned i(0); i < a.size(); ++i)
         {
             a[i] = gamma_qcd_0_eigenvalues[i] / 2.0 / beta[0];
@@ -357,10 +360,9 @@ namespace eos
         {
             for (unsigned j(0); j < a.size(); ++j)
             {
-                H_qcd_0[i][j] = 0.0;
                 H_qcd_1[i][j] = -G_qcd_1[i][j] / (2.0 * beta[0]) / (1.0 + a[i] - a[j]);
             }
-            H_qcd_0[i][i]  = std::pow(eta, a[i]);
+            H_qcd_0[i]     = std::pow(eta, a[i]);
             H_qcd_1[i][i] += beta[1] / beta[0] * a[i];
         }
 
@@ -381,9 +383,9 @@ namespace eos
             H_qcd_2[i][i] += beta[2] / 2.0 / beta[0] * a[i];
         }
 
-        Matrix                     U_qcd_0 = V * H_qcd_0 * V_inverse;
-        Matrix                     U_qcd_1 = V * ((H_qcd_1 * H_qcd_0) + (-eta) * (H_qcd_0 * H_qcd_1)) * V_inverse;
-        Matrix                     U_qcd_2 = V * (H_qcd_2 * H_qcd_0 + (-eta) * H_qcd_1 * H_qcd_0 * H_qcd_1 + (-eta * eta) * H_qcd_0 * (H_qcd_2 - H_qcd_1 * H_qcd_1)) * V_inverse;
+        Matrix                     U_qcd_0 = scale_columns(V, H_qcd_0) * V_inverse;
+        Matrix                     U_qcd_1 = V * (scale_columns(H_qcd_1, H_qcd_0) + (-eta) * scale_rows(H_qcd_0, H_qcd_1)) * V_inverse;
+        Matrix                     U_qcd_2 = V * (scale_columns(H_qcd_2, H_qcd_0) + (-eta) * scale_columns(H_qcd_1, H_qcd_0) * H_qcd_1 + (-eta * eta) * scale_rows(H_qcd_0, H_qcd_2 - H_qcd_1 * H_qcd_1)) * V_inverse;
         complex<double>            a_s     = alpha_s / (4 * M_PI);
         array<complex<double>, 15> result_qcd_0 = U_qcd_0 * wc_qcd_0;
         array<complex<double>, 15> result_qcd_1 = U_qcd_1 * wc_qcd_0 + eta * (U_qcd_0 * wc_qcd_1);
@@ -76,7 +76,7 @@ namespace eos
             const complex<double> tb = (2.0 * (-2.0 * xb2 + 2.0 * xb2 * yb + sqrt(2) * xb2 * (1.0 + yb) * sqrt((2.0 * xb4 - xb2 * yb + 2.0 * xb4 * yb - xb6 * yb + xb2 * yb2 + 4.0 * xb4 * yb2 + xb6 * yb2) / (xb4 * power_of<2>(1.0 + yb))))) / (-1.0 + 6.0 * xb2 - xb4 + yb + 2.0 * xb2 * yb + xb4 * yb);
             const complex<double> vb = (2.0 * (-2.0 * xb2 - 2.0 * xb2 * yb + sqrt(2) * xb2 * (1.0 - yb) * sqrt((2.0 * xb4 + xb2 * yb - 2.0 * xb4 * yb + xb6 * yb + xb2 * yb2 + 4.0 * xb4 * yb2 + xb6 * yb2) / (xb4 * power_of<2>(1.0 - yb))))) / (1.0 - 6.0 * xb2 + xb4 + yb + 2.0 * xb2 * yb + xb4 * yb);
 
-            const complex<double> part1 = (-1.0 / 3.0) * (pisqu * ln2) + 8.0 * trilog(-1.0) - 28.0 * li3half - 2.0 * trilog(1.0 / (1.0 - tb)) - 4.0 * trilog((1.0 - tb) / 2.0) + 2.0 * trilog(-tb) - 2.0 * trilog(tb) - 2.0 * trilog(tb / (-1.0 + tb)) + trilog((2.0 * tb) / (-1.0 + tb)) + 2.0 * trilog(1.0 / (1.0 + tb)) - 2.0 * trilog((-1.0 + tb) / (1.0 + tb)) + 2.0 * trilog(tb / (1.0 + tb)) - trilog((2.0 * tb) / (1.0 + tb)) - 4.0 * trilog((1.0 + tb) / 2.0) - 2.0 * trilog((1.0 + tb) / (-1.0 + tb)) + 2.0 * trilog(1.0 / (1.0 - vb)) - 4.0 * trilog((1.0 - vb) / 2.0) - 2.0 * trilog(-vb) + 2.0 * trilog(vb) + 2.0 * trilog(vb / (-1.0 + vb)) - trilog((2.0 * vb) / (-1.0 + vb))
+            const complex<double> part1 = (-1.0 / 3.0) * (pisqu * ln2) + 8.0 * c_li3_25 - 28.0 * li3half - 2.0 * trilog(1.0 / (1.0 - tb)) - 4.0 * trilog((1.0 - tb) / 2.0) + 2.0 * trilog(-tb) - 2.0 * trilog(tb) - 2.0 * trilog(tb / (-1.0 + tb)) + trilog((2.0 * tb) / (-1.0 + tb)) + 2.0 * trilog(1.0 / (1.0 + tb)) - 2.0 * trilog((-1.0 + tb) / (1.0 + tb)) + 2.0 * trilog(tb / (1.0 + tb)) - trilog((2.0 * tb) / (1.0 + tb)) - 4.0 * trilog((1.0 + tb) / 2.0) - 2.0 * trilog((1.0 + tb) / (-1.0 + tb)) + 2.0 * trilog(1.0 / (1.0 - vb)) - 4.0 * trilog((1.0 - vb) / 2.0) - 2.0 * trilog(-vb) + 2.0 * trilog(vb) + 2.0 * trilog(vb / (-1.0 + vb)) - trilog((2.0 * vb) / (-1.0 + vb))
                 - 2.0 * trilog(1.0 / (1.0 + vb)) - 2.0 * trilog((-1.0 + vb) / (1.0 + vb)) - 2.0 * trilog(vb / (1.0 + vb)) + trilog((2.0 * vb) / (1.0 + vb)) - 4.0 * trilog((1.0 + vb) / 2.0) - 2.0 * trilog((1.0 + vb) / (-1.0 + vb)) - 2.0 * trilog(1.0 / (1.0 - w4)) + trilog((1.0 + vb) / (1.0 - w4)) + 4.0 * trilog(1.0 - w4) - 2.0 * trilog((1.0 - w4) / (1.0 + vb)) - trilog((tb - w4) / (-1.0 + tb)) + trilog((tb - w4) / (1.0 + tb)) + trilog((-1.0 + tb) / (-1.0 + w4)) - 2.0 * trilog((-1.0 + w4) / (-1.0 + tb)) + trilog((-0.5) * (((1.0 + tb) * (-1.0 + w4)) / (tb - w4))) - 2.0 * trilog(-w4inv) + 2.0 * trilog(w4inv)
                 + trilog((tb - w4) / ((-1.0 + tb) * w4)) - 2.0 * trilog((-1.0 + w4) / (2.0 * w4)) + 2.0 * trilog(w4 / (-1.0 + w4)) - 2.0 * trilog(1.0 / (1.0 + w4)) + trilog((1.0 + tb) / (1.0 + w4)) + trilog((1.0 - vb) / (1.0 + w4)) - 2.0 * trilog((1.0 - w4) / (1.0 + w4)) + trilog(((1.0 + tb) * (-1.0 + w4)) / ((-1.0 + tb) * (1.0 + w4))) + trilog(((-1.0 + vb) * (-1.0 + w4)) / ((1.0 + vb) * (1.0 + w4))) - 2.0 * trilog(w4 / (1.0 + w4)) - 2.0 * trilog((1.0 + w4) / (1.0 - w4)) + trilog(((-1.0 + tb) * (1.0 + w4)) / (2.0 * (tb - w4))) + trilog(((-1.0 + tb) * (1.0 + w4)) / ((1.0 + tb) * (-1.0 + w4))) + trilog(((1.0 + vb) * (1.0 + w4)) / ((-1.0 + vb) * (-1.0 + w4)))
                 - 2.0 * trilog((1.0 + w4) / (2.0 * w4)) - trilog((-tb + w4) / (-1.0 + w4)) + trilog((-tb + w4) / (1.0 + w4)) + trilog((-0.5) * (((-1.0 + vb) * (-1.0 + w4)) / (vb + w4))) + trilog(((1.0 + vb) * (1.0 + w4)) / (2.0 * (vb + w4))) + trilog((vb + w4) / (-1.0 + vb)) - trilog((vb + w4) / (1.0 + vb)) - trilog((vb + w4) / (-1.0 + w4)) + trilog((vb + w4) / (1.0 + w4)) + trilog((tb - w4) / (tb - tb * w4)) - trilog((tb - w4) / (tb + tb * w4)) - trilog(-((tb - w4) / (w4 + tb * w4))) + trilog((vb + w4) / (vb - vb * w4)) - trilog((vb + w4) / (w4 - vb * w4)) - trilog((vb + w4) / (vb + vb * w4))
@@ -92,8 +92,8 @@ namespace eos
                 + trilog(((-1.0 + w4) * (vb + w7)) / ((1.0 + vb) * (w4 - w7))) - trilog(((1.0 + w4) * (vb + w7)) / ((-1.0 + vb) * (w4 - w7))) - 3.0 * trilog((vb + w7) / (-1.0 + w7)) + trilog(((-1.0 + w4) * (vb + w7)) / ((vb + w4) * (-1.0 + w7))) + trilog(-(((1.0 + w5) * (vb + w7)) / ((vb - w5) * (-1.0 + w7)))) + trilog((vb + w7) / (1.0 + w7)) - trilog(((1.0 + w4) * (vb + w7)) / ((vb + w4) * (1.0 + w7))) - trilog(-(((-1.0 + w5) * (vb + w7)) / ((vb - w5) * (1.0 + w7)))) - trilog(w7 / (-w4 + w7)) - trilog(((tb - w4) * w7) / (tb * (-w4 + w7))) - 2.0 * trilog(w5 / (w5 + w7)) + trilog((tb + w5) / (w5 + w7))
                 + trilog((-vb + w5) / (w5 + w7)) - trilog(((-1.0 + w5) * (tb - w7)) / ((1.0 + tb) * (w5 + w7))) + trilog(((1.0 + w5) * (tb - w7)) / ((-1.0 + tb) * (w5 + w7))) - 2.0 * trilog(w7 / (w5 + w7)) - trilog(((vb - w5) * w7) / (vb * (w5 + w7))) - 2.0 * trilog(((1.0 + w5) * w7) / (w5 + w7)) - trilog(((tb + w5) * w7) / (tb * (w5 + w7))) + trilog((-tb + w7) / (w5 + w7)) + trilog((vb + w7) / (w5 + w7)) - trilog(((-1.0 + w5) * (vb + w7)) / ((-1.0 + vb) * (w5 + w7))) + trilog(((1.0 + w5) * (vb + w7)) / ((1.0 + vb) * (w5 + w7))) - trilog(((1.0 + tb) * (w5 + w7)) / ((-1.0 + w5) * (tb - w7)))
                 + trilog(((-1.0 + tb) * (w5 + w7)) / ((1.0 + w5) * (tb - w7))) + trilog(((1.0 + vb) * (w5 + w7)) / ((vb - w5) * (-1.0 + w7))) + trilog(((-1.0 + tb) * (w5 + w7)) / ((tb + w5) * (-1.0 + w7))) - trilog(((-1.0 + vb) * (w5 + w7)) / ((vb - w5) * (1.0 + w7))) - trilog(((1.0 + tb) * (w5 + w7)) / ((tb + w5) * (1.0 + w7))) - trilog(((-1.0 + vb) * (w5 + w7)) / ((-1.0 + w5) * (vb + w7))) + trilog(((1.0 + vb) * (w5 + w7)) / ((1.0 + w5) * (vb + w7))) + trilog((w7 + tb * w7) / (tb + tb * w7)) + trilog((w7 - vb * w7) / (vb + w7)) - 2.0 * trilog((w4 - w7) / (w4 - w4 * w7)) + 2.0 * trilog((w4 - w7) / (w4 + w4 * w7))
-                + 2.0 * trilog(-((w4 - w7) / (w7 + w4 * w7))) + 2.0 * trilog((w7 + w4 * w7) / (w4 + w4 * w7)) - 2.0 * trilog((w5 + w7) / (w5 - w5 * w7)) + 2.0 * trilog((w5 + w7) / (w7 - w5 * w7)) + 2.0 * trilog((w7 - w5 * w7) / (w5 + w7)) + 2.0 * trilog((w5 + w7) / (w5 + w5 * w7)) - 2.0 * trilog((w5 + w7) / (w7 + w5 * w7)) + 24.0 * trilog(-1.0i / wx3) + 24.0 * trilog(1.0i / wx3) + 40.0 * trilog(-1.0i / (-1.0i + wx3)) + 8.0 * trilog(wx3 / (-1.0i + wx3)) - 16.0 * trilog((-1.0i + wx3) / (2.0 * wx3)) + 16.0 * trilog((-1.0i + wx3) / wx3) + 40.0 * trilog(1.0i / (1.0i + wx3)) - 16.0 * trilog((1.0i - wx3) / (1.0i + wx3)) + 8.0 * trilog(wx3 / (1.0i + wx3))
-                - 16.0 * trilog((1.0i + wx3) / (1.0i - wx3)) - 16.0 * trilog((1.0i + wx3) / (2.0 * wx3)) + 16.0 * trilog((1.0i + wx3) / wx3) + 24.0 * trilog(-1.0i / wx4) + 24.0 * trilog(1.0i / wx4) + 40.0 * trilog(-1.0i / (-1.0i + wx4)) + 8.0 * trilog(wx4 / (-1.0i + wx4)) - 16.0 * trilog((-1.0i + wx4) / (2.0 * wx4)) + 16.0 * trilog((-1.0i + wx4) / wx4) + 40.0 * trilog(1.0i / (1.0i + wx4)) - 16.0 * trilog((1.0i - wx4) / (1.0i + wx4)) + 8.0 * trilog(wx4 / (1.0i + wx4)) - 16.0 * trilog((1.0i + wx4) / (1.0i - wx4)) - 16.0 * trilog((1.0i + wx4) / (2.0 * wx4)) + 16.0 * trilog((1.0i + wx4) / wx4) - 20.0 * trilog((1.0i - xb) / (1.0i + wx3)) - 20.0 * trilog((1.0i - xb) / (1.0i + wx4))
+                + 2.0 * trilog(-((w4 - w7) / (w7 + w4 * w7))) + 2.0 * trilog((w7 + w4 * w7) / (w4 + w4 * w7)) - 2.0 * trilog((w5 + w7) / (w5 - w5 * w7)) + 2.0 * trilog((w5 + w7) / (w7 - w5 * w7)) + 2.0 * trilog((w7 - w5 * w7) / (w5 + w7)) + 2.0 * trilog((w5 + w7) / (w5 + w5 * w7)) - 2.0 * trilog((w5 + w7) / (w7 + w5 * w7)) + 24.0 * c_li3_1 + 24.0 * c_li3_2 + 40.0 * c_li3_3 + 8.0 * c_li3_4 - 16.0 * c_li3_5 + 16.0 * c_li3_6 + 40.0 * c_li3_7 - 16.0 * c_li3_8 + 8.0 * c_li3_9
+                - 16.0 * c_li3_10 - 16.0 * c_li3_11 + 16.0 * c_li3_12 + 24.0 * c_li3_13 + 24.0 * c_li3_14 + 40.0 * c_li3_15 + 8.0 * c_li3_16 - 16.0 * c_li3_17 + 16.0 * c_li3_18 + 40.0 * c_li3_19 - 16.0 * c_li3_20 + 8.0 * c_li3_21 - 16.0 * c_li3_22 - 16.0 * c_li3_23 + 16.0 * c_li3_24 - 20.0 * trilog((1.0i - xb) / (1.0i + wx3)) - 20.0 * trilog((1.0i - xb) / (1.0i + wx4))
                 - 8.0 * trilog((-1.0i + wx3) / (wx3 - xb)) - 8.0 * trilog((1.0i + wx3) / (wx3 - xb)) - 4.0 * trilog((wx3 - xb) / (-1.0i + wx3)) - 4.0 * trilog((wx3 - xb) / (1.0i + wx3)) - 8.0 * trilog((-1.0i + wx4) / (wx4 - xb)) - 8.0 * trilog((1.0i + wx4) / (wx4 - xb)) - 4.0 * trilog((wx4 - xb) / (-1.0i + wx4)) - 4.0 * trilog((wx4 - xb) / (1.0i + wx4)) + 24.0 * trilog(1.0 / 2.0 - (1.0i / 2.0) * xb) + 24.0 * trilog(1.0 - 1.0i * xb) + 8.0 * trilog(((-1.0i + wx3) * (1.0 - 1.0i * xb)) / (2.0 * (wx3 - xb))) + 8.0 * trilog(((-1.0i + wx4) * (1.0 - 1.0i * xb)) / (2.0 * (wx4 - xb))) + 24.0 * trilog((1.0 + 1.0i * xb) / 2.0) + 24.0 * trilog(1.0 + 1.0i * xb)
                 + 8.0 * trilog(((1.0i + wx3) * (1.0 + 1.0i * xb)) / (2.0 * (wx3 - xb))) + 8.0 * trilog(((1.0i + wx4) * (1.0 + 1.0i * xb)) / (2.0 * (wx4 - xb))) + 4.0 * trilog((1.0i * (wx3 - xb)) / ((-1.0i + wx3) * xb)) + 4.0 * trilog(((-1.0i) * (wx3 - xb)) / ((1.0i + wx3) * xb)) + 4.0 * trilog((1.0i * (wx4 - xb)) / ((-1.0i + wx4) * xb)) + 4.0 * trilog(((-1.0i) * (wx4 - xb)) / ((1.0i + wx4) * xb)) + 24.0 * trilog((-1.0i) * xb) + 24.0 * trilog(1.0i * xb) + 8.0 * trilog(-(xb / wx3)) + 8.0 * trilog(xb / wx3) + 8.0 * trilog(-(xb / wx4)) + 8.0 * trilog(xb / wx4) - 8.0 * trilog(-xb2) - 16.0 * trilog(-1.0i / (-1.0i + xb)) + 4.0 * trilog(((-1.0i) * (wx3 - xb)) / (wx3 * (-1.0i + xb)))
                 + 4.0 * trilog(((-1.0i) * (wx4 - xb)) / (wx4 * (-1.0i + xb))) - 8.0 * trilog(xb / (-1.0i + xb)) + 24.0 * trilog((2.0 * xb) / (-1.0i + xb)) - 20.0 * trilog((-1.0i + xb) / (-1.0i + wx3)) - 20.0 * trilog((-1.0i + xb) / (-1.0i + wx4)) + 16.0 * trilog((-1.0i + xb) * xbinv) - 4.0 * trilog((wx3 * (-1.0i + xb)) / ((-1.0i + wx3) * xb)) - 4.0 * trilog((wx3 * (-1.0i + xb)) / ((1.0i + wx3) * xb)) - 4.0 * trilog((wx4 * (-1.0i + xb)) / ((-1.0i + wx4) * xb)) - 4.0 * trilog((wx4 * (-1.0i + xb)) / ((1.0i + wx4) * xb)) - 16.0 * trilog(1.0i / (1.0i + xb)) + 4.0 * trilog((1.0i * (wx3 - xb)) / (wx3 * (1.0i + xb))) + 4.0 * trilog((1.0i * (wx4 - xb)) / (wx4 * (1.0i + xb))) - 8.0 * trilog(xb / (1.0i + xb))
@@ -101,10 +101,10 @@ namespace eos
                 - 4.0 * trilog((wx3 * (1.0i + xb)) / ((-1.0i + wx3) * xb)) - 4.0 * trilog((wx3 * (1.0i + xb)) / ((1.0i + wx3) * xb)) - 4.0 * trilog((wx4 * (1.0i + xb)) / ((-1.0i + wx4) * xb)) - 4.0 * trilog((wx4 * (1.0i + xb)) / ((1.0i + wx4) * xb)) + 8.0 * trilog(((-1.0i + wx3) * (1.0i + xb)) / ((1.0i + wx3) * (-1.0i + xb))) + 8.0 * trilog(((1.0i + wx3) * (1.0i + xb)) / ((-1.0i + wx3) * (-1.0i + xb))) + 8.0 * trilog(((-1.0i + wx4) * (1.0i + xb)) / ((1.0i + wx4) * (-1.0i + xb))) + 8.0 * trilog(((1.0i + wx4) * (1.0i + xb)) / ((-1.0i + wx4) * (-1.0i + xb))) - 8.0 * trilog((-1.0i + xb) / (-wx3 + xb)) - 4.0 * trilog((-wx3 + xb) / (-1.0i + xb)) - 4.0 * trilog((-wx3 + xb) / (1.0i + xb))
                 - 8.0 * trilog((-1.0i + wx3) / (wx3 + xb)) - 8.0 * trilog((1.0i + wx3) / (wx3 + xb)) + 8.0 * trilog(((1.0i + wx3) * (1.0 - 1.0i * xb)) / (2.0 * (wx3 + xb))) + 8.0 * trilog(((-1.0i + wx3) * (1.0 + 1.0i * xb)) / (2.0 * (wx3 + xb))) - 8.0 * trilog((-1.0i + xb) / (wx3 + xb)) - 8.0 * trilog((1.0i + xb) / (wx3 + xb)) - 4.0 * trilog((wx3 + xb) / (-1.0i + wx3)) - 4.0 * trilog((wx3 + xb) / (1.0i + wx3)) + 4.0 * trilog(((-1.0i) * (wx3 + xb)) / ((-1.0i + wx3) * xb)) + 4.0 * trilog((1.0i * (wx3 + xb)) / ((1.0i + wx3) * xb)) - 4.0 * trilog((wx3 + xb) / (-1.0i + xb)) + 4.0 * trilog(((-1.0i) * (wx3 + xb)) / (wx3 * (-1.0i + xb))) - 4.0 * trilog((wx3 + xb) / (1.0i + xb))
                 + 4.0 * trilog((1.0i * (wx3 + xb)) / (wx3 * (1.0i + xb))) - 8.0 * trilog((-1.0i + xb) / (-wx4 + xb)) - 4.0 * trilog((-wx4 + xb) / (-1.0i + xb)) - 4.0 * trilog((-wx4 + xb) / (1.0i + xb)) - 8.0 * trilog((-1.0i + wx4) / (wx4 + xb)) - 8.0 * trilog((1.0i + wx4) / (wx4 + xb)) + 8.0 * trilog(((1.0i + wx4) * (1.0 - 1.0i * xb)) / (2.0 * (wx4 + xb))) + 8.0 * trilog(((-1.0i + wx4) * (1.0 + 1.0i * xb)) / (2.0 * (wx4 + xb))) - 8.0 * trilog((-1.0i + xb) / (wx4 + xb)) - 8.0 * trilog((1.0i + xb) / (wx4 + xb)) - 4.0 * trilog((wx4 + xb) / (-1.0i + wx4)) - 4.0 * trilog((wx4 + xb) / (1.0i + wx4)) + 4.0 * trilog(((-1.0i) * (wx4 + xb)) / ((-1.0i + wx4) * xb))
-                + 4.0 * trilog((1.0i * (wx4 + xb)) / ((1.0i + wx4) * xb)) - 4.0 * trilog((wx4 + xb) / (-1.0i + xb)) + 4.0 * trilog(((-1.0i) * (wx4 + xb)) / (wx4 * (-1.0i + xb))) - 4.0 * trilog((wx4 + xb) / (1.0i + xb)) + 4.0 * trilog((1.0i * (wx4 + xb)) / (wx4 * (1.0i + xb))) + 2.0 * dilog((-1.0 + w7) / (2.0 * w7)) * lnhalf + 2.0 * dilog((1.0 - w7) / (1.0 + w7)) * lnhalf - 2.0 * dilog((1.0 + w7) / (1.0 - w7)) * lnhalf - 2.0 * dilog((1.0 + w7) / (2.0 * w7)) * lnhalf + 16.0 * dilog((-1.0i + wx3) / (2.0 * wx3)) * lnhalf + 16.0 * dilog((1.0i - wx3) / (1.0i + wx3)) * lnhalf + 16.0 * dilog((1.0i + wx3) / (1.0i - wx3)) * lnhalf
-                + 16.0 * dilog((1.0i + wx3) / (2.0 * wx3)) * lnhalf;
+                + 4.0 * trilog((1.0i * (wx4 + xb)) / ((1.0i + wx4) * xb)) - 4.0 * trilog((wx4 + xb) / (-1.0i + xb)) + 4.0 * trilog(((-1.0i) * (wx4 + xb)) / (wx4 * (-1.0i + xb))) - 4.0 * trilog((wx4 + xb) / (1.0i + xb)) + 4.0 * trilog((1.0i * (wx4 + xb)) / (wx4 * (1.0i + xb))) + 2.0 * dilog((-1.0 + w7) / (2.0 * w7)) * lnhalf + 2.0 * dilog((1.0 - w7) / (1.0 + w7)) * lnhalf - 2.0 * dilog((1.0 + w7) / (1.0 - w7)) * lnhalf - 2.0 * dilog((1.0 + w7) / (2.0 * w7)) * lnhalf + 16.0 * c_li2_9 * lnhalf + 16.0 * c_li2_10 * lnhalf + 16.0 * c_li2_11 * lnhalf
+                + 16.0 * c_li2_12 * lnhalf;
 
-            const complex<double> part2 = + 16.0 * dilog((-1.0i + wx4) / (2.0 * wx4)) * lnhalf + 16.0 * dilog((1.0i - wx4) / (1.0i + wx4)) * lnhalf + 16.0 * dilog((1.0i + wx4) / (1.0i - wx4)) * lnhalf + 16.0 * dilog((1.0i + wx4) / (2.0 * wx4)) * lnhalf + (10.0 * pisqu * ln2) / 3.0 - (2.0 * power_of<3>(ln2)) / 3.0 - (4.0 * pisqu * ln4) / 3.0 + dilog(((-1.0 + tb) * (1.0 + w7)) / (2.0 * (tb - w7))) * log((1.0 - tb) / 2.0) + dilog(((-1.0 + tb) * (1.0 + w7)) / ((1.0 + tb) * (-1.0 + w7))) * log((1.0 - tb) / 2.0) + (pisqu * log(1.0 - tb)) / 12.0 + (ln2squ * log(1.0 - tb)) / 2.0 - dilog(1.0 - tb) * log(1.0 - tb)
+            const complex<double> part2 = + 16.0 * c_li2_13 * lnhalf + 16.0 * c_li2_14 * lnhalf + 16.0 * c_li2_15 * lnhalf + 16.0 * c_li2_16 * lnhalf + (10.0 * pisqu * ln2) / 3.0 - (2.0 * power_of<3>(ln2)) / 3.0 - (4.0 * pisqu * ln4) / 3.0 + dilog(((-1.0 + tb) * (1.0 + w7)) / (2.0 * (tb - w7))) * log((1.0 - tb) / 2.0) + dilog(((-1.0 + tb) * (1.0 + w7)) / ((1.0 + tb) * (-1.0 + w7))) * log((1.0 - tb) / 2.0) + (pisqu * log(1.0 - tb)) / 12.0 + (ln2squ * log(1.0 - tb)) / 2.0 - dilog(1.0 - tb) * log(1.0 - tb)
                 - dilog(tb) * log(1.0 - tb) - dilog(((-1.0 + tb) * w7) / (tb - w7)) * log(1.0 - tb) - dilog(((-1.0 + tb) * w7) / (tb * (-1.0 + w7))) * log(1.0 - tb) + (ln2 * power_of<2>(log(1.0 - tb))) / 2.0 + (log((1.0 - tb) / 8.0) * power_of<2>(log(1.0 - tb))) / 6.0 + power_of<3>(log(1.0 - tb)) / 6.0 - power_of<2>(log(1.0 - tb)) * log(tb) - dilog((-0.5) * (((1.0 + tb) * (-1.0 + w7)) / (tb - w7))) * log((1.0 + tb) / 2.0) - dilog(((1.0 + tb) * (-1.0 + w7)) / ((-1.0 + tb) * (1.0 + w7))) * log((1.0 + tb) / 2.0) + (power_of<2>(log(1.0 - tb)) * log((1.0 + tb) / 2.0)) / 2.0 - (5.0 * pisqu * log(1.0 + tb)) / 12.0 + (ln2squ * log(1.0 + tb)) / 2.0 + dilog(-tb) * log(1.0 + tb)
                 + dilog(1.0 + tb) * log(1.0 + tb) - dilog(-(((1.0 + tb) * w7) / (tb - w7))) * log(1.0 + tb) - dilog((w7 + tb * w7) / (tb + tb * w7)) * log(1.0 + tb) + ln2squ * log(1.0 + tb) - 2.0 * ln2 * log(1.0 - tb) * log(1.0 + tb) + log((1.0 - tb) / 2.0) * log(1.0 - tb) * log(1.0 + tb) + log(1.0 - tb) * log((1.0 + tb) / 2.0) * log(1.0 + tb) - (ln2 * power_of<2>(log(1.0 + tb))) / 2.0 - (ln64 * power_of<2>(log(1.0 + tb))) / 6.0 + (log((1.0 - tb) / 2.0) * power_of<2>(log(1.0 + tb))) / 2.0 + log(-tb) * power_of<2>(log(1.0 + tb)) - (log((1.0 + tb) / 8.0) * power_of<2>(log(1.0 + tb))) / 6.0 + power_of<3>(log(1.0 + tb)) / 6.0
                 - dilog(((-1.0 + vb) * (-1.0 + w7)) / ((1.0 + vb) * (1.0 + w7))) * log((1.0 - vb) / 2.0) - dilog((-0.5) * (((-1.0 + vb) * (-1.0 + w7)) / (vb + w7))) * log((1.0 - vb) / 2.0) + dilog(-w4inv) * (-log(1.0 + tb) - log(1.0 - vb)) + dilog(1.0 / (1.0 + w4)) * (-log(1.0 + tb) - log(1.0 - vb)) + dilog(1.0 / (1.0 - w5)) * (-log(1.0 + tb) - log(1.0 - vb)) + dilog(w5inv) * (-log(1.0 + tb) - log(1.0 - vb)) - (5.0 * pisqu * log(1.0 - vb)) / 12.0 + (ln2squ * log(1.0 - vb)) / 2.0 + dilog(1.0 - vb) * log(1.0 - vb) + dilog(vb) * log(1.0 - vb)
@@ -135,7 +135,7 @@ namespace eos
             const complex<double> part3 = + dilog(((-1.0 + vb) * (w5 + w7)) / ((-1.0 + w5) * (vb + w7))) * log((-1.0 + vb) / (-1.0 + w5)) + log((1.0 + vb) / 2.0) * log(1.0 - vb / w5) * log((-1.0 + vb) / (-1.0 + w5)) - (power_of<2>(log(1.0 - vb / w5)) * log((-1.0 + vb) / (-1.0 + w5))) / 2.0 + (log(2.0 / (1.0 + vb)) * power_of<2>(log((-1.0 + vb) / (-1.0 + w5)))) / 2.0 + (log((1.0 + vb) / 2.0) * power_of<2>(log((-1.0 + vb) / (-1.0 + w5)))) / 2.0 + dilog((-1.0 + vb) / (1.0 + vb)) * (log((1.0 - vb) / (1.0 + w4)) + log((-1.0 + vb) / (-1.0 + w5)))
                 + dilog((1.0 - vb) / 2.0) * (2.0 * log(1.0 - vb) + 2.0 * log(1.0 + vb) + log((1.0 - vb) / (1.0 + w4)) + log((vb + w4) / w4) + log(1.0 - vb / w5) + log((-1.0 + vb) / (-1.0 + w5))) - (power_of<2>(log((-1.0 + vb) / (-1.0 + w5))) * log((-2.0 * (vb - w5)) / ((1.0 + vb) * (-1.0 + w5)))) / 2.0 - (pisqu * log((-1.0 + w5) / (-1.0 + tb))) / 6.0 - power_of<3>(log((-1.0 + w5) / (-1.0 + tb))) / 6.0 - (power_of<2>(log(1.0 - vb / w5)) * log((-1.0 + w5) / (-1.0 + vb))) / 2.0 - (power_of<2>(log((-1.0 + vb) / (-1.0 + w5))) * log((-0.5) * (((1.0 + vb) * (-1.0 + w5)) / (vb - w5)))) / 2.0 + power_of<2>(log(1.0 / (1.0 - w5))) * log((-1.0 + w5) / (2.0 * w5))
                 + (power_of<2>(log(1.0 - vb / w5)) * log((vb * (-1.0 + w5)) / ((-1.0 + vb) * w5))) / 2.0 - (pisqu * log(w5 / (1.0 - tb))) / 6.0 - power_of<3>(log(w5 / (1.0 - tb))) / 6.0 + (pisqu * log(-(w5 / (1.0 + tb)))) / 6.0 + power_of<3>(log(-(w5 / (1.0 + tb)))) / 6.0 + (pisqu * log(w5 / (-1.0 + vb))) / 6.0 + power_of<3>(log(w5 / (-1.0 + vb))) / 6.0 - (pisqu * log(w5 / (1.0 + vb))) / 6.0 - power_of<3>(log(w5 / (1.0 + vb))) / 6.0 + power_of<2>(log(1.0 / (1.0 - w5))) * log((2.0 * w5) / (-1.0 + w5)) - (pisqu * log(w5 / (tb * (-1.0 + w5)))) / 6.0 - power_of<3>(log(w5 / (tb * (-1.0 + w5)))) / 6.0 + (power_of<2>(log(1.0 - vb / w5)) * log(((-1.0 + vb) * w5) / (vb * (-1.0 + w5)))) / 2.0
-                + dilog(w7inv) * (2.0 * lnhalf - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w5))) + dilog(1.0 / (1.0 - w7)) * (2.0 * lnhalf + log(1.0 - tb) - log(1.0 + tb) - log(1.0 - vb) + log(1.0 + vb) - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w5))) + dilog(-1.0) * (-2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w4)) - 2.0 * log(1.0 / (1.0 - w5)) - 2.0 * log(1.0 / (1.0 + w5))) + 2.0 * dilog((-1.0 + w5) / (2.0 * w5)) * log(1.0 / (1.0 + w5)) + 2.0 * dilog((1.0 - w5) / (1.0 + w5)) * log(1.0 / (1.0 + w5)) + 2.0 * dilog((w5 + w7) / (w5 - w5 * w7)) * log(1.0 / (1.0 + w5))
+                + dilog(w7inv) * (2.0 * lnhalf - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w5))) + dilog(1.0 / (1.0 - w7)) * (2.0 * lnhalf + log(1.0 - tb) - log(1.0 + tb) - log(1.0 - vb) + log(1.0 + vb) - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w5))) + c_li2_29 * (-2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w4)) - 2.0 * log(1.0 / (1.0 - w5)) - 2.0 * log(1.0 / (1.0 + w5))) + 2.0 * dilog((-1.0 + w5) / (2.0 * w5)) * log(1.0 / (1.0 + w5)) + 2.0 * dilog((1.0 - w5) / (1.0 + w5)) * log(1.0 / (1.0 + w5)) + 2.0 * dilog((w5 + w7) / (w5 - w5 * w7)) * log(1.0 / (1.0 + w5))
                 + 2.0 * dilog((w5 + w7) / (w7 + w5 * w7)) * log(1.0 / (1.0 + w5)) - lnhalf * power_of<2>(log(1.0 / (1.0 + w5))) - ln2 * power_of<2>(log(1.0 / (1.0 + w5))) - dilog(((-1.0 + tb) * (-1.0 + w5)) / ((1.0 + tb) * (1.0 + w5))) * log((1.0 - tb) / (1.0 + w5)) - dilog((-0.5) * (((-1.0 + tb) * (-1.0 + w5)) / (tb + w5))) * log((1.0 - tb) / (1.0 + w5)) - dilog(((-1.0 + tb) * (w5 + w7)) / ((1.0 + w5) * (tb - w7))) * log((1.0 - tb) / (1.0 + w5)) - dilog(((-1.0 + tb) * (w5 + w7)) / ((tb + w5) * (-1.0 + w7))) * log((1.0 - tb) / (1.0 + w5)) + (log(2.0 / (1.0 + tb)) * power_of<2>(log((1.0 - tb) / (1.0 + w5)))) / 2.0
                 + (log((1.0 + tb) / 2.0) * power_of<2>(log((1.0 - tb) / (1.0 + w5)))) / 2.0 + dilog((-1.0 + tb) / (1.0 + tb)) * (log((-1.0 + tb) / (-1.0 + w4)) + log((1.0 - tb) / (1.0 + w5))) + dilog((-1.0 + tb) / (tb - w7)) * (-log((1.0 - tb) / 2.0) + log(1.0 - tb) + log((-1.0 + tb) / (-1.0 + w4)) + log((1.0 - tb) / (1.0 + w5))) - dilog((-0.5) * (((1.0 + vb) * (-1.0 + w5)) / (vb - w5))) * log((1.0 + vb) / (1.0 + w5)) - dilog(((1.0 + vb) * (-1.0 + w5)) / ((-1.0 + vb) * (1.0 + w5))) * log((1.0 + vb) / (1.0 + w5)) - dilog(((1.0 + vb) * (w5 + w7)) / ((vb - w5) * (-1.0 + w7))) * log((1.0 + vb) / (1.0 + w5))
                 - dilog(((1.0 + vb) * (w5 + w7)) / ((1.0 + w5) * (vb + w7))) * log((1.0 + vb) / (1.0 + w5)) + log((1.0 - vb) / 2.0) * log(1.0 - vb / w5) * log((1.0 + vb) / (1.0 + w5)) + (power_of<2>(log(1.0 - vb / w5)) * log((1.0 + vb) / (1.0 + w5))) / 2.0 + (log((1.0 - vb) / 2.0) * power_of<2>(log((1.0 + vb) / (1.0 + w5)))) / 2.0 + (log(-2.0 / (-1.0 + vb)) * power_of<2>(log((1.0 + vb) / (1.0 + w5)))) / 2.0 + dilog((1.0 + vb) / (-1.0 + vb)) * (log((1.0 + vb) / (1.0 - w4)) + log((1.0 + vb) / (1.0 + w5))) + dilog((1.0 + vb) / (vb + w7)) * (-log((1.0 + vb) / 2.0) + log(1.0 + vb) + log((1.0 + vb) / (1.0 - w4)) + log((1.0 + vb) / (1.0 + w5)))
@@ -194,10 +194,10 @@ namespace eos
                 + power_of<3>(log(((-1.0 + w5) * (w5 + w7)) / (w5 * (1.0 + w7)))) / 3.0 + (power_of<2>(log((-tb + w7) / (w5 + w7))) * log(((1.0 + tb) * (w5 + w7)) / ((tb + w5) * (1.0 + w7)))) / 2.0 - (pisqu * log(-(((-1.0 + w5) * (w5 + w7)) / ((tb + w5) * (1.0 + w7))))) / 6.0 - power_of<3>(log(-(((-1.0 + w5) * (w5 + w7)) / ((tb + w5) * (1.0 + w7))))) / 6.0 - (pisqu * log(((-1.0 + w5) * (w5 + w7)) / ((tb + w5) * (1.0 + w7)))) / 6.0 - power_of<3>(log(((-1.0 + w5) * (w5 + w7)) / ((tb + w5) * (1.0 + w7)))) / 6.0 - (power_of<2>(log((tb + w5) / w5)) * log((w5 + w7) / (-tb + w7))) / 2.0 - (power_of<2>(log(1.0 - vb / w5)) * log((w5 + w7) / (vb + w7))) / 2.0
                 + (power_of<2>(log(1.0 - vb / w5)) * log((vb * (w5 + w7)) / (w5 * (vb + w7)))) / 2.0 - (power_of<2>(log(1.0 - tb)) * log((tb - w7) / (tb - tb * w7))) / 2.0 - (power_of<2>(log(1.0 + tb)) * log((tb - w7) / (tb + tb * w7))) / 2.0 + (pisqu * log(-(w7 / (tb + tb * w7)))) / 6.0 + power_of<3>(log(-(w7 / (tb + tb * w7)))) / 6.0 - (pisqu * log((w4 * w7) / (-(tb * w4) + tb * w7))) / 6.0 - power_of<3>(log((w4 * w7) / (-(tb * w4) + tb * w7))) / 6.0 - (pisqu * log(-((w5 * w7) / (tb * w5 + tb * w7)))) / 6.0 - power_of<3>(log(-((w5 * w7) / (tb * w5 + tb * w7)))) / 6.0 + (pisqu * log(w7 / (vb - vb * w7))) / 6.0 + power_of<3>(log(w7 / (vb - vb * w7))) / 6.0 - (power_of<2>(log(1.0 + vb)) * log((vb + w7) / (vb - vb * w7))) / 2.0
                 - (power_of<2>(log(1.0 + vb)) * log((vb - vb * w7) / (vb + w7))) / 2.0 - (pisqu * log((w4 * w7) / (vb * w4 - vb * w7))) / 6.0 - power_of<3>(log((w4 * w7) / (vb * w4 - vb * w7))) / 6.0 + (pisqu * log(w7 / (vb + vb * w7))) / 6.0 + power_of<3>(log(w7 / (vb + vb * w7))) / 6.0 - (power_of<2>(log(1.0 - vb)) * log((vb + w7) / (vb + vb * w7))) / 2.0 - (pisqu * log((w5 * w7) / (vb * w5 + vb * w7))) / 6.0 - power_of<3>(log((w5 * w7) / (vb * w5 + vb * w7))) / 6.0 + (power_of<2>(log(-(w7 / (w4 - w7)))) * log((w4 - w7) / (w4 - w4 * w7))) / 2.0 + (power_of<2>(log(w7 / (-w4 + w7))) * log((w4 - w7) / (w4 - w4 * w7))) / 2.0 + (power_of<2>(log(-(w7 / (w4 - w7)))) * log((w4 - w4 * w7) / (w4 - w7))) / 2.0
-                - (power_of<2>(log(-(w7 / (w4 - w7)))) * log((w4 - w7) / (w4 + w4 * w7))) / 2.0 - (power_of<2>(log(w7 / (-w4 + w7))) * log((w4 - w7) / (w4 + w4 * w7))) / 2.0 - power_of<2>(log(1.0 / (1.0 + w4))) * log((w4 + w4 * w7) / (w7 + w4 * w7)) - power_of<2>(log(1.0 / (1.0 + w4))) * log((w7 + w4 * w7) / (w4 + w4 * w7)) + power_of<2>(log(w7 / (w5 + w7))) * log((w5 + w7) / (w5 - w5 * w7)) - (pisqu * log(((1.0 + w5) * (w5 + w7)) / (w5 - w5 * w7))) / 3.0 - power_of<3>(log(((1.0 + w5) * (w5 + w7)) / (w5 - w5 * w7))) / 3.0 + power_of<2>(log(w7 / (w5 + w7))) * log((w5 - w5 * w7) / (w5 + w7)) - power_of<2>(log(w7 / (w5 + w7))) * log((w5 + w7) / (w5 + w5 * w7)) + (8.0 * pisqu * log((-2.0 * 1.0i) / wx3)) / 3.0
-                + (8.0 * power_of<3>(log((-2.0 * 1.0i) / wx3))) / 3.0 + (8.0 * pisqu * log((2.0 * 1.0i) / wx3)) / 3.0 + (8.0 * power_of<3>(log((2.0 * 1.0i) / wx3))) / 3.0 - 8.0 * power_of<2>(lnhalf) * log(wx3 / (-1.0i + wx3)) + 8.0 * power_of<2>(lnhalf) * log((2.0 * wx3) / (-1.0i + wx3)) + 8.0 * power_of<2>(lnhalf) * log((-1.0i + wx3) / (2.0 * wx3)) - 8.0 * power_of<2>(lnhalf) * log((-1.0i + wx3) / wx3) - 8.0 * power_of<2>(lnhalf) * log(wx3 / (1.0i + wx3)) + 8.0 * power_of<2>(lnhalf) * log((2.0 * wx3) / (1.0i + wx3)) - (8.0 * pisqu * log((2.0 * (-1.0i + wx3)) / (1.0i + wx3))) / 3.0 - (8.0 * power_of<3>(log((2.0 * (-1.0i + wx3)) / (1.0i + wx3)))) / 3.0 + 8.0 * power_of<2>(lnhalf) * log((1.0i + wx3) / (2.0 * wx3)) - 8.0 * power_of<2>(lnhalf) * log((1.0i + wx3) / wx3)
-                - (8.0 * pisqu * log((2.0 * (1.0i + wx3)) / (-1.0i + wx3))) / 3.0 - (8.0 * power_of<3>(log((2.0 * (1.0i + wx3)) / (-1.0i + wx3)))) / 3.0 + (8.0 * pisqu * log((-2.0 * 1.0i) / wx4)) / 3.0 + (8.0 * power_of<3>(log((-2.0 * 1.0i) / wx4))) / 3.0 + (8.0 * pisqu * log((2.0 * 1.0i) / wx4)) / 3.0 + (8.0 * power_of<3>(log((2.0 * 1.0i) / wx4))) / 3.0 - 8.0 * power_of<2>(lnhalf) * log(wx4 / (-1.0i + wx4)) + 8.0 * power_of<2>(lnhalf) * log((2.0 * wx4) / (-1.0i + wx4)) + 8.0 * power_of<2>(lnhalf) * log((-1.0i + wx4) / (2.0 * wx4)) - 8.0 * power_of<2>(lnhalf) * log((-1.0i + wx4) / wx4) - 8.0 * power_of<2>(lnhalf) * log(wx4 / (1.0i + wx4)) + 8.0 * power_of<2>(lnhalf) * log((2.0 * wx4) / (1.0i + wx4)) - (8.0 * pisqu * log((2.0 * (-1.0i + wx4)) / (1.0i + wx4))) / 3.0
-                - (8.0 * power_of<3>(log((2.0 * (-1.0i + wx4)) / (1.0i + wx4)))) / 3.0 + 8.0 * power_of<2>(lnhalf) * log((1.0i + wx4) / (2.0 * wx4)) - 8.0 * power_of<2>(lnhalf) * log((1.0i + wx4) / wx4) - (8.0 * pisqu * log((2.0 * (1.0i + wx4)) / (-1.0i + wx4))) / 3.0 - (8.0 * power_of<3>(log((2.0 * (1.0i + wx4)) / (-1.0i + wx4)))) / 3.0 - (2.0 * pisqu * log(wx3 / (1.0i - xb))) / 3.0 - (2.0 * power_of<3>(log(wx3 / (1.0i - xb)))) / 3.0 - (2.0 * pisqu * log(wx4 / (1.0i - xb))) / 3.0 - (2.0 * power_of<3>(log(wx4 / (1.0i - xb)))) / 3.0 - (4.0 * pisqu * log((-2.0 * 1.0i) / (wx3 - xb))) / 3.0 - (4.0 * power_of<3>(log((-2.0 * 1.0i) / (wx3 - xb)))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i) / (wx3 - xb))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) / (wx3 - xb)))) / 3.0 - (4.0 * pisqu * log((-2.0 * 1.0i) / (wx4 - xb))) / 3.0
+                - (power_of<2>(log(-(w7 / (w4 - w7)))) * log((w4 - w7) / (w4 + w4 * w7))) / 2.0 - (power_of<2>(log(w7 / (-w4 + w7))) * log((w4 - w7) / (w4 + w4 * w7))) / 2.0 - power_of<2>(log(1.0 / (1.0 + w4))) * log((w4 + w4 * w7) / (w7 + w4 * w7)) - power_of<2>(log(1.0 / (1.0 + w4))) * log((w7 + w4 * w7) / (w4 + w4 * w7)) + power_of<2>(log(w7 / (w5 + w7))) * log((w5 + w7) / (w5 - w5 * w7)) - (pisqu * log(((1.0 + w5) * (w5 + w7)) / (w5 - w5 * w7))) / 3.0 - power_of<3>(log(((1.0 + w5) * (w5 + w7)) / (w5 - w5 * w7))) / 3.0 + power_of<2>(log(w7 / (w5 + w7))) * log((w5 - w5 * w7) / (w5 + w7)) - power_of<2>(log(w7 / (w5 + w7))) * log((w5 + w7) / (w5 + w5 * w7)) + (8.0 * pisqu * c_ln_16) / 3.0
+                + (8.0 * power_of<3>(c_ln_16)) / 3.0 + (8.0 * pisqu * c_ln_17) / 3.0 + (8.0 * power_of<3>(c_ln_17)) / 3.0 - 8.0 * power_of<2>(lnhalf) * c_ln_18 + 8.0 * power_of<2>(lnhalf) * c_ln_19 + 8.0 * power_of<2>(lnhalf) * c_ln_20 - 8.0 * power_of<2>(lnhalf) * c_ln_11 - 8.0 * power_of<2>(lnhalf) * c_ln_21 + 8.0 * power_of<2>(lnhalf) * c_ln_22 - (8.0 * pisqu * c_ln_23) / 3.0 - (8.0 * power_of<3>(c_ln_23)) / 3.0 + 8.0 * power_of<2>(lnhalf) * c_ln_24 - 8.0 * power_of<2>(lnhalf) * c_ln_12
+                - (8.0 * pisqu * c_ln_25) / 3.0 - (8.0 * power_of<3>(c_ln_25)) / 3.0 + (8.0 * pisqu * c_ln_26) / 3.0 + (8.0 * power_of<3>(c_ln_26)) / 3.0 + (8.0 * pisqu * c_ln_27) / 3.0 + (8.0 * power_of<3>(c_ln_27)) / 3.0 - 8.0 * power_of<2>(lnhalf) * c_ln_28 + 8.0 * power_of<2>(lnhalf) * c_ln_29 + 8.0 * power_of<2>(lnhalf) * c_ln_30 - 8.0 * power_of<2>(lnhalf) * c_ln_13 - 8.0 * power_of<2>(lnhalf) * c_ln_31 + 8.0 * power_of<2>(lnhalf) * c_ln_32 - (8.0 * pisqu * c_ln_33) / 3.0
+                - (8.0 * power_of<3>(c_ln_33)) / 3.0 + 8.0 * power_of<2>(lnhalf) * c_ln_34 - 8.0 * power_of<2>(lnhalf) * c_ln_14 - (8.0 * pisqu * c_ln_35) / 3.0 - (8.0 * power_of<3>(c_ln_35)) / 3.0 - (2.0 * pisqu * log(wx3 / (1.0i - xb))) / 3.0 - (2.0 * power_of<3>(log(wx3 / (1.0i - xb)))) / 3.0 - (2.0 * pisqu * log(wx4 / (1.0i - xb))) / 3.0 - (2.0 * power_of<3>(log(wx4 / (1.0i - xb)))) / 3.0 - (4.0 * pisqu * log((-2.0 * 1.0i) / (wx3 - xb))) / 3.0 - (4.0 * power_of<3>(log((-2.0 * 1.0i) / (wx3 - xb)))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i) / (wx3 - xb))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) / (wx3 - xb)))) / 3.0 - (4.0 * pisqu * log((-2.0 * 1.0i) / (wx4 - xb))) / 3.0
                 - (4.0 * power_of<3>(log((-2.0 * 1.0i) / (wx4 - xb)))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i) / (wx4 - xb))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) / (wx4 - xb)))) / 3.0;
 
             const complex<double> part6 = - 8.0 * dilog(((-1.0i + wx3) * (1.0 - 1.0i * xb)) / (2.0 * (wx3 - xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) - 8.0 * dilog(((-1.0i + wx4) * (1.0 - 1.0i * xb)) / (2.0 * (wx4 - xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 8.0 * dilog(-((1.0i + xb) / (wx3 - xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 8.0 * dilog(-((1.0i + xb) / (wx4 - xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) - 8.0 * dilog(((-1.0i + wx3) * (1.0i + xb)) / ((1.0i + wx3) * (-1.0i + xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) - 8.0 * dilog(((1.0i + wx3) * (1.0i + xb)) / ((-1.0i + wx3) * (-1.0i + xb))) * log(1.0 / 2.0 - (1.0i / 2.0) * xb)
@@ -205,12 +205,12 @@ namespace eos
                 - 8.0 * dilog(((1.0i + wx3) * (1.0 + 1.0i * xb)) / (2.0 * (wx3 - xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((1.0i + wx4) * (1.0 + 1.0i * xb)) / (2.0 * (wx4 - xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((-1.0i + wx3) * (-1.0i + xb)) / ((1.0i + wx3) * (1.0i + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((1.0i + wx3) * (-1.0i + xb)) / ((-1.0i + wx3) * (1.0i + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((-1.0i + wx4) * (-1.0i + xb)) / ((1.0i + wx4) * (1.0i + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((1.0i + wx4) * (-1.0i + xb)) / ((-1.0i + wx4) * (1.0i + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 8.0 * dilog((-1.0i + xb) / (-wx3 + xb)) * log(1.0 / 2.0 + (1.0i / 2.0) * xb)
                 - 8.0 * dilog(((-1.0i + wx3) * (1.0 + 1.0i * xb)) / (2.0 * (wx3 + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 8.0 * dilog((-1.0i + xb) / (wx3 + xb)) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 8.0 * dilog((-1.0i + xb) / (-wx4 + xb)) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 8.0 * dilog(((-1.0i + wx4) * (1.0 + 1.0i * xb)) / (2.0 * (wx4 + xb))) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 8.0 * dilog((-1.0i + xb) / (wx4 + xb)) * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 4.0 * log((-1.0i + wx3) / (wx3 - xb)) * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * xb)) - 8.0 * dilog(1.0 - 1.0i * xb) * log(1.0 - 1.0i * xb) - 16.0 * dilog((1.0i + xb) * xbinv) * log(1.0 - 1.0i * xb) + 4.0 * dilog((wx3 * (1.0i + xb)) / ((-1.0i + wx3) * xb)) * log(1.0 - 1.0i * xb)
                 + 4.0 * dilog((wx3 * (1.0i + xb)) / ((1.0i + wx3) * xb)) * log(1.0 - 1.0i * xb) + 4.0 * dilog((wx4 * (1.0i + xb)) / ((-1.0i + wx4) * xb)) * log(1.0 - 1.0i * xb) + 4.0 * dilog((wx4 * (1.0i + xb)) / ((1.0i + wx4) * xb)) * log(1.0 - 1.0i * xb) - (8.0 * power_of<3>(log(1.0 - 1.0i * xb))) / 3.0 + dilog((1.0i - xb) / (1.0i + wx3)) * (8.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 4.0 * log(1.0 - 1.0i * xb)) + dilog((1.0i - xb) / (1.0i + wx4)) * (8.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 4.0 * log(1.0 - 1.0i * xb)) + dilog((-1.0i + xb) / (-1.0i + wx3)) * (8.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 4.0 * log(1.0 - 1.0i * xb)) + dilog((-1.0i + xb) / (-1.0i + wx4)) * (8.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 4.0 * log(1.0 - 1.0i * xb))
-                + dilog((-2.0 * 1.0i) / (-1.0i + wx3)) * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + dilog((2.0 * 1.0i) / (1.0i + wx3)) * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + dilog((-2.0 * 1.0i) / (-1.0i + wx4)) * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + dilog((2.0 * 1.0i) / (1.0i + wx4)) * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) - 8.0 * dilog(1.0 + 1.0i * xb) * log(1.0 + 1.0i * xb) - 16.0 * dilog((-1.0i + xb) * xbinv) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx3 * (-1.0i + xb)) / ((-1.0i + wx3) * xb)) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx3 * (-1.0i + xb)) / ((1.0i + wx3) * xb)) * log(1.0 + 1.0i * xb)
-                + 4.0 * dilog((wx4 * (-1.0i + xb)) / ((-1.0i + wx4) * xb)) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx4 * (-1.0i + xb)) / ((1.0i + wx4) * xb)) * log(1.0 + 1.0i * xb) - (8.0 * power_of<3>(log(1.0 + 1.0i * xb))) / 3.0 + dilog((1.0i + xb) / (1.0i - wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i + wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i - wx4)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i + wx4)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog(-1.0i / wx3) * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb))
-                + dilog(1.0i / wx3) * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog(-1.0i / wx4) * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog(1.0i / wx4) * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog(-1.0i / (-1.0i + wx3)) * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + dilog(1.0i / (1.0i + wx3)) * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + dilog(-1.0i / (-1.0i + wx4)) * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb))
-                + dilog(1.0i / (1.0i + wx4)) * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + log((wx3 - xb) / (1.0i + wx3)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb)) + log((wx4 - xb) / (1.0i + wx4)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * (-4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))) + log((wx4 - xb) / (-1.0i + wx4)) * (-4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))) + (8.0 * pisqu * log(-1.0i / xb)) / 3.0 + (8.0 * power_of<3>(log(-1.0i / xb))) / 3.0 + (8.0 * pisqu * log(1.0i / xb)) / 3.0
-                + (8.0 * power_of<3>(log(1.0i / xb))) / 3.0 + dilog(1.0 / 2.0 - (1.0i / 2.0) * xb) * (16.0 * (log(xb) - log(1.0i * xb)) - 16.0 * log(1.0 - 1.0i * xb) - 16.0 * log(1.0 + 1.0i * xb) - 16.0 * log((-1.0i) * xb)) + ((4.0 * pisqu) / 3.0 - 8.0 * ln2squ) * log((-1.0i) * xb) + dilog((1.0 + 1.0i * xb) / 2.0) * (16.0 * log(1.0i) - 16.0 * log(1.0 - 1.0i * xb) - 16.0 * log(1.0 + 1.0i * xb) - 16.0 * log(1.0i * xb)) + ((4.0 * pisqu) / 3.0 - 8.0 * ln2squ) * log(1.0i * xb) + dilog((-1.0i) * xb) * (8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(xb)) + dilog(1.0i * xb) * (8.0 * log(1.0 + 1.0i * xb) - 8.0 * log(xb)) - 8.0 * dilog(wx3 / (-1.0i + wx3)) * log(xb) - 8.0 * dilog(wx3 / (1.0i + wx3)) * log(xb) - 8.0 * dilog(wx4 / (-1.0i + wx4)) * log(xb)
-                - 8.0 * dilog(wx4 / (1.0i + wx4)) * log(xb) + 4.0 * dilog(-(xb / wx3)) * log(xb) + 4.0 * dilog(xb / wx3) * log(xb) + 4.0 * dilog(-(xb / wx4)) * log(xb) + 4.0 * dilog(xb / wx4) * log(xb) - (2.0 * pisqu * log(wx3 / (-1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx3 / (-1.0i + xb)))) / 3.0 + (4.0 * pisqu * log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xb))))) / 3.0 + (4.0 * pisqu * log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(wx4 / (-1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx4 / (-1.0i + xb)))) / 3.0
+                + c_li2_21 * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + c_li2_22 * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + c_li2_23 * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) + c_li2_24 * (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb)) - 8.0 * dilog(1.0 + 1.0i * xb) * log(1.0 + 1.0i * xb) - 16.0 * dilog((-1.0i + xb) * xbinv) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx3 * (-1.0i + xb)) / ((-1.0i + wx3) * xb)) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx3 * (-1.0i + xb)) / ((1.0i + wx3) * xb)) * log(1.0 + 1.0i * xb)
+                + 4.0 * dilog((wx4 * (-1.0i + xb)) / ((-1.0i + wx4) * xb)) * log(1.0 + 1.0i * xb) + 4.0 * dilog((wx4 * (-1.0i + xb)) / ((1.0i + wx4) * xb)) * log(1.0 + 1.0i * xb) - (8.0 * power_of<3>(log(1.0 + 1.0i * xb))) / 3.0 + dilog((1.0i + xb) / (1.0i - wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i + wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i - wx4)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + dilog((1.0i + xb) / (1.0i + wx4)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 4.0 * log(1.0 + 1.0i * xb)) + c_li2_17 * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb))
+                + c_li2_18 * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + c_li2_19 * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + c_li2_20 * (-16.0 * lnhalf + 4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb)) + c_li2_1 * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + c_li2_2 * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + c_li2_3 * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb))
+                + c_li2_4 * (-16.0 * lnhalf + 8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb)) + log((wx3 - xb) / (1.0i + wx3)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb)) + log((wx4 - xb) / (1.0i + wx4)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * (-4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))) + log((wx4 - xb) / (-1.0i + wx4)) * (-4.0 * log(1.0 - 1.0i * xb) * log(1.0 + 1.0i * xb) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))) + (8.0 * pisqu * log(-1.0i / xb)) / 3.0 + (8.0 * power_of<3>(log(-1.0i / xb))) / 3.0 + (8.0 * pisqu * log(1.0i / xb)) / 3.0
+                + (8.0 * power_of<3>(log(1.0i / xb))) / 3.0 + dilog(1.0 / 2.0 - (1.0i / 2.0) * xb) * (16.0 * (log(xb) - log(1.0i * xb)) - 16.0 * log(1.0 - 1.0i * xb) - 16.0 * log(1.0 + 1.0i * xb) - 16.0 * log((-1.0i) * xb)) + ((4.0 * pisqu) / 3.0 - 8.0 * ln2squ) * log((-1.0i) * xb) + dilog((1.0 + 1.0i * xb) / 2.0) * (16.0 * c_ln_44 - 16.0 * log(1.0 - 1.0i * xb) - 16.0 * log(1.0 + 1.0i * xb) - 16.0 * log(1.0i * xb)) + ((4.0 * pisqu) / 3.0 - 8.0 * ln2squ) * log(1.0i * xb) + dilog((-1.0i) * xb) * (8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(xb)) + dilog(1.0i * xb) * (8.0 * log(1.0 + 1.0i * xb) - 8.0 * log(xb)) - 8.0 * c_li2_5 * log(xb) - 8.0 * c_li2_6 * log(xb) - 8.0 * c_li2_7 * log(xb)
+                - 8.0 * c_li2_8 * log(xb) + 4.0 * dilog(-(xb / wx3)) * log(xb) + 4.0 * dilog(xb / wx3) * log(xb) + 4.0 * dilog(-(xb / wx4)) * log(xb) + 4.0 * dilog(xb / wx4) * log(xb) - (2.0 * pisqu * log(wx3 / (-1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx3 / (-1.0i + xb)))) / 3.0 + (4.0 * pisqu * log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xb))))) / 3.0 + (4.0 * pisqu * log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(wx4 / (-1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx4 / (-1.0i + xb)))) / 3.0
                 + (4.0 * pisqu * log((2.0 - (2.0 * 1.0i) * wx4) / ((-1.0i + wx4) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((2.0 - (2.0 * 1.0i) * wx4) / ((-1.0i + wx4) * (-1.0i + xb))))) / 3.0 + (4.0 * pisqu * log((-2.0 - (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (-1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (-1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(-(wx3 / (1.0i + xb)))) / 3.0 - (2.0 * power_of<3>(log(-(wx3 / (1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(wx3 / (1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx3 / (1.0i + xb)))) / 3.0 + (4.0 * pisqu * log((2.0 + (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((2.0 + (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (1.0i + xb))))) / 3.0
                 + (4.0 * pisqu * log(((2.0 * 1.0i) * (1.0i + wx3)) / ((-1.0i + wx3) * (1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log(((2.0 * 1.0i) * (1.0i + wx3)) / ((-1.0i + wx3) * (1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(-(wx4 / (1.0i + xb)))) / 3.0 - (2.0 * power_of<3>(log(-(wx4 / (1.0i + xb))))) / 3.0 - (2.0 * pisqu * log(wx4 / (1.0i + xb))) / 3.0 - (2.0 * power_of<3>(log(wx4 / (1.0i + xb)))) / 3.0 + (4.0 * pisqu * log((2.0 + (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log((2.0 + (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (1.0i + xb))))) / 3.0 + (4.0 * pisqu * log(((2.0 * 1.0i) * (1.0i + wx4)) / ((-1.0i + wx4) * (1.0i + xb)))) / 3.0 + (4.0 * power_of<3>(log(((2.0 * 1.0i) * (1.0i + wx4)) / ((-1.0i + wx4) * (1.0i + xb))))) / 3.0 - (4.0 * pisqu * log((-2.0 * 1.0i) / (wx3 + xb))) / 3.0
                 - (4.0 * power_of<3>(log((-2.0 * 1.0i) / (wx3 + xb)))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i) / (wx3 + xb))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) / (wx3 + xb)))) / 3.0 - 4.0 * dilog(((-1.0i) * (wx3 + xb)) / ((-1.0i + wx3) * xb)) * log((wx3 + xb) / wx3) - 4.0 * dilog((1.0i * (wx3 + xb)) / ((1.0i + wx3) * xb)) * log((wx3 + xb) / wx3) + 4.0 * dilog((wx3 + xb) / (-1.0i + xb)) * log((wx3 + xb) / wx3) - 4.0 * dilog(((-1.0i) * (wx3 + xb)) / (wx3 * (-1.0i + xb))) * log((wx3 + xb) / wx3) + 4.0 * dilog((wx3 + xb) / (1.0i + xb)) * log((wx3 + xb) / wx3) - 4.0 * dilog((1.0i * (wx3 + xb)) / (wx3 * (1.0i + xb))) * log((wx3 + xb) / wx3)
@@ -257,8 +257,8 @@ namespace eos
                 + power_of<2>(log((1.0i - wx4inv) * xb)) * ((-4.0 * 1.0i) * M_PI * H1(-1.0i / xb, wx4 * xbinv) * my_sign(imag(wx4 * xbinv)) + (4.0 * 1.0i) * M_PI * H1(-(wx4 * xbinv), 1.0i / xb) * my_sign(real(xbinv))) + power_of<2>(log((1.0i + wx4inv) * xb)) * ((-4.0 * 1.0i) * M_PI * H1(-1.0i / xb, -(wx4 * xbinv)) * my_sign(-imag(wx4 * xbinv)) + (4.0 * 1.0i) * M_PI * H1(wx4 * xbinv, 1.0i / xb) * my_sign(real(xbinv))) + (8.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log(((-0.5) * 1.0i) * (wx3 - xb))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) + (8.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log(((-0.5) * 1.0i) * (wx4 - xb))) * my_sign(2.0 * real(1.0 / (1.0i + xb)))
                 - (8.0 * 1.0i) * M_PI * H1((1.0i + wx3) / (1.0i + xb), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log(((1.0 + 1.0i * wx3) * (1.0i + xb)) / (2.0 * (1.0i + wx3)))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) - (8.0 * 1.0i) * M_PI * H1((1.0i + wx4) / (1.0i + xb), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log(((1.0 + 1.0i * wx4) * (1.0i + xb)) / (2.0 * (1.0i + wx4)))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) + (8.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx3), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log((1.0i / 2.0) * (wx3 + xb))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) + (8.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx4), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log((1.0i / 2.0) * (wx4 + xb))) * my_sign(2.0 * real(1.0 / (1.0i + xb)))
                 - (8.0 * 1.0i) * M_PI * H1((1.0i - wx3) / (1.0i + xb), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log((1.0i + wx3 + xb - 1.0i * wx3 * xb) / (2.0 * 1.0i - 2.0 * wx3))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) - (8.0 * 1.0i) * M_PI * H1((1.0i - wx4) / (1.0i + xb), (2.0 * 1.0i) / (1.0i + xb)) * power_of<2>(log((1.0i + wx4 + xb - 1.0i * wx4 * xb) / (2.0 * 1.0i - 2.0 * wx4))) * my_sign(2.0 * real(1.0 / (1.0i + xb))) - (2.0 * 1.0i) * M_PI * power_of<2>(log((1.0 - w7) / 2.0)) * my_sign(imag(w7) / 2.0) * T(1.0, 1.0 / 2.0, (1.0 - w7) / 2.0) + 1.0i * M_PI * power_of<2>(log(w7 / (-1.0 + w7))) * my_sign(-imag(1.0 / (1.0 - w7))) * T(1.0, 1.0 / 2.0, w7 / (-1.0 + w7)) + 1.0i * M_PI * power_of<2>(log(w7 / (-1.0 + w7))) * my_sign(imag(1.0 / (-1.0 + w7))) * T(1.0, 1.0 / 2.0, w7 / (-1.0 + w7))
-                - (2.0 * 1.0i) * M_PI * power_of<2>(log(w7 / (1.0 + w7))) * my_sign(-imag(1.0 / (1.0 + w7))) * T(1.0, 1.0 / 2.0, w7 / (1.0 + w7)) + (2.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, 1.0 / 2.0, (1.0 + w7) / 2.0) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (8.0 * 1.0i) * M_PI * power_of<2>(log(wx3 / (-1.0i + wx3))) * my_sign(-real(1.0 / (1.0i - wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log(wx3 / (-1.0i + wx3))) * my_sign(real(1.0 / (-1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3))
-                + (16.0 * 1.0i) * M_PI * power_of<2>(log(wx3 / (1.0i + wx3))) * my_sign(-real(1.0 / (1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log(wx4 / (-1.0i + wx4))) * my_sign(-real(1.0 / (1.0i - wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (8.0 * 1.0i) * M_PI * power_of<2>(log(wx4 / (-1.0i + wx4))) * my_sign(real(1.0 / (-1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(wx4 / (1.0i + wx4))) * my_sign(-real(1.0 / (1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (1.0i + wx4))
+                - (2.0 * 1.0i) * M_PI * power_of<2>(log(w7 / (1.0 + w7))) * my_sign(-imag(1.0 / (1.0 + w7))) * T(1.0, 1.0 / 2.0, w7 / (1.0 + w7)) + (2.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, 1.0 / 2.0, (1.0 + w7) / 2.0) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_18) * my_sign(-real(1.0 / (1.0i - wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_18) * my_sign(real(1.0 / (-1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3))
+                + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_21) * my_sign(-real(1.0 / (1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_28) * my_sign(-real(1.0 / (1.0i - wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_28) * my_sign(real(1.0 / (-1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_31) * my_sign(-real(1.0 / (1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (1.0i + wx4))
                 - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log((1.0 - w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + tb))) * T(1.0, (1.0 - tb) / 2.0, (1.0 - w7) / 2.0) + 1.0i * M_PI * power_of<2>(log((1.0 - w7) / 2.0)) * my_sign(imag(w7) / 2.0) * T(1.0, (1.0 - tb) / 2.0, (1.0 - w7) / 2.0) - 1.0i * M_PI * power_of<2>(log((-tb + w7) / (1.0 + w7))) * my_sign(imag((1.0 + tb) / (1.0 + w7))) * T(1.0, (1.0 - tb) / 2.0, (-tb + w7) / (1.0 + w7)) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - w4) * my_sign(imag(1.0 / tb)) * T(1.0, 1.0 - tb, 1.0 - w4) + 1.0i * M_PI * power_of<2>(log(1.0 - w4)) * my_sign(imag(w4)) * T(1.0, 1.0 - tb, 1.0 - w4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + w5) * my_sign(imag(1.0 / tb)) * T(1.0, 1.0 - tb, 1.0 + w5)
                 + 1.0i * M_PI * power_of<2>(log(1.0 + w5)) * my_sign(-imag(w5)) * T(1.0, 1.0 - tb, 1.0 + w5) + 1.0i * M_PI * power_of<2>(log(1.0 - tb / w7)) * my_sign(imag(tb / w7)) * T(1.0, 1.0 - tb, 1.0 - tb / w7) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - w7) * my_sign(imag(1.0 / tb)) * T(1.0, 1.0 - tb, 1.0 - w7) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - tb, 1.0 - w7) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w7)) * my_sign(imag(w7)) * T(1.0, 1.0 - tb, 1.0 - w7) - (2.0 * 1.0i) * M_PI * log(1.0 - w7) * log((1.0 + w7) / 2.0) * my_sign(imag(w7)) * T(1.0, 1.0 - tb, 1.0 - w7) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log((1.0 + w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - tb))) * T(1.0, (1.0 + tb) / 2.0, (1.0 + w7) / 2.0)
                 - 1.0i * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, (1.0 + tb) / 2.0, (1.0 + w7) / 2.0) + 1.0i * M_PI * power_of<2>(log((-tb + w7) / (-1.0 + w7))) * my_sign(imag((-1.0 + tb) / (-1.0 + w7))) * T(1.0, (1.0 + tb) / 2.0, (-tb + w7) / (-1.0 + w7)) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + w4) * my_sign(-imag(1.0 / tb)) * T(1.0, 1.0 + tb, 1.0 + w4) + 1.0i * M_PI * power_of<2>(log(1.0 + w4)) * my_sign(-imag(w4)) * T(1.0, 1.0 + tb, 1.0 + w4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - w5) * my_sign(-imag(1.0 / tb)) * T(1.0, 1.0 + tb, 1.0 - w5) + 1.0i * M_PI * power_of<2>(log(1.0 - w5)) * my_sign(imag(w5)) * T(1.0, 1.0 + tb, 1.0 - w5)
@@ -317,27 +317,27 @@ namespace eos
             const complex<double> part10 = + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w7) / (w5 + w7))) * my_sign(imag((1.0 + w5) / (w5 + w7))) * T(1.0, w7 / (w5 + w7), (-1.0 + w7) / (w5 + w7)) - (2.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + w7) / (w5 + w7))) * my_sign(imag((-1.0 + w5) / (w5 + w7))) * T(1.0, w7 / (w5 + w7), (1.0 + w7) / (w5 + w7)) - 1.0i * M_PI * power_of<2>(log((1.0 + tb) / (1.0 - w5))) * my_sign(imag((tb + w5) / (-1.0 + w5))) * T(1.0, (-tb + w7) / (w5 + w7), (1.0 + tb) / (1.0 - w5)) + 1.0i * M_PI * power_of<2>(log((1.0 - tb) / (1.0 + w5))) * my_sign(imag((tb + w5) / (1.0 + w5))) * T(1.0, (-tb + w7) / (w5 + w7), (1.0 - tb) / (1.0 + w5))
                 - 1.0i * M_PI * power_of<2>(log((-1.0 + w7) / (w5 + w7))) * my_sign(imag((1.0 + w5) / (w5 + w7))) * T(1.0, (-tb + w7) / (w5 + w7), (-1.0 + w7) / (w5 + w7)) + (2.0 * 1.0i) * M_PI * log((tb + w5) / w5) * log((-1.0 + w7) / (w5 + w7)) * my_sign(imag((w5 + w7) / (tb + w5))) * T(1.0, (-tb + w7) / (w5 + w7), (-1.0 + w7) / (w5 + w7)) + 1.0i * M_PI * power_of<2>(log((1.0 + w7) / (w5 + w7))) * my_sign(imag((-1.0 + w5) / (w5 + w7))) * T(1.0, (-tb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7)) - (2.0 * 1.0i) * M_PI * log((tb + w5) / w5) * log((1.0 + w7) / (w5 + w7)) * my_sign(imag((w5 + w7) / (tb + w5))) * T(1.0, (-tb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7))
                 - 1.0i * M_PI * power_of<2>(log((-1.0 + vb) / (-1.0 + w5))) * my_sign(imag((-vb + w5) / (-1.0 + w5))) * T(1.0, (vb + w7) / (w5 + w7), (-1.0 + vb) / (-1.0 + w5)) + 1.0i * M_PI * power_of<2>(log((1.0 + vb) / (1.0 + w5))) * my_sign(imag((-vb + w5) / (1.0 + w5))) * T(1.0, (vb + w7) / (w5 + w7), (1.0 + vb) / (1.0 + w5)) - 1.0i * M_PI * power_of<2>(log((-1.0 + w7) / (w5 + w7))) * my_sign(imag((1.0 + w5) / (w5 + w7))) * T(1.0, (vb + w7) / (w5 + w7), (-1.0 + w7) / (w5 + w7)) + (2.0 * 1.0i) * M_PI * log(1.0 - vb / w5) * log((-1.0 + w7) / (w5 + w7)) * my_sign(imag((w5 + w7) / (-vb + w5))) * T(1.0, (vb + w7) / (w5 + w7), (-1.0 + w7) / (w5 + w7))
-                + 1.0i * M_PI * power_of<2>(log((1.0 + w7) / (w5 + w7))) * my_sign(imag((-1.0 + w5) / (w5 + w7))) * T(1.0, (vb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7)) - (2.0 * 1.0i) * M_PI * log(1.0 - vb / w5) * log((1.0 + w7) / (w5 + w7)) * my_sign(imag((w5 + w7) / (-vb + w5))) * T(1.0, (vb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7)) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xb) / (1.0i + wx3))) * my_sign(imag((1.0i - xb) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, (wx3 + xb) / (1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xb) / (1.0i + wx4))) * my_sign(imag((1.0i - xb) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, (wx4 + xb) / (1.0i + wx4)) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xb) / (1.0i + wx3))) * my_sign(imag((1.0i + xb) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, (wx3 - xb) / (1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xb) / (1.0i + wx4))) * my_sign(imag((1.0i + xb) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, (wx4 - xb) / (1.0i + wx4)) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xb) / (-1.0i + wx3))) * my_sign(imag((1.0i + xb) / (1.0i - wx3))) * T(1.0, (1.0 + 1.0i * xb) / 2.0, (wx3 + xb) / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xb) / (-1.0i + wx4))) * my_sign(imag((1.0i + xb) / (1.0i - wx4))) * T(1.0, (1.0 + 1.0i * xb) / 2.0, (wx4 + xb) / (-1.0i + wx4)) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                + dilog(1.0 / 2.0 - (1.0i / 2.0) * wx3) * (-16.0 * log(wx3 / (1.0i + wx3)) + 8.0 * log((wx3 - xb) / (1.0i + wx3)) + 8.0 * log((wx3 + xb) / (1.0i + wx3)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx3) * (-16.0 * log(wx3 / (-1.0i + wx3)) + 8.0 * log((wx3 - xb) / (-1.0i + wx3)) + 8.0 * log((wx3 + xb) / (-1.0i + wx3)) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                + dilog(1.0 / 2.0 - (1.0i / 2.0) * wx4) * (-16.0 * log(wx4 / (1.0i + wx4)) + 8.0 * log((wx4 - xb) / (1.0i + wx4)) + 8.0 * log((wx4 + xb) / (1.0i + wx4)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)) - (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                + log(1.0 - 1.0i * xb) * ((2.0 * pisqu) / 3.0 - 16.0 * (log(xb) - log(1.0i * xb)) * ln2 - 20.0 * ln2squ + 16.0 * ln2 * log((-1.0i) * xb) + log(1.0 + 1.0i * xb) * (32.0 * ln2 - 16.0 * log((-1.0i) * xb) - 16.0 * log(1.0i * xb) - 4.0 * log((wx3 + xb) / (-1.0i + wx3)) - 4.0 * log((wx3 + xb) / (1.0i + wx3)) - 4.0 * log((wx4 + xb) / (-1.0i + wx4)) - 4.0 * log((wx4 + xb) / (1.0i + wx4))) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
-                    + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4))
-                + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx4) * (-16.0 * log(wx4 / (-1.0i + wx4)) + 8.0 * log((wx4 - xb) / (-1.0i + wx4)) + 8.0 * log((wx4 + xb) / (-1.0i + wx4)) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + li2half * (-16.0 * (log(xb) - log(1.0i * xb)) - 16.0 * log(1.0i) - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w4)) - 2.0 * log(1.0 / (1.0 - w5)) - 2.0 * log(1.0 / (1.0 + w5)) + 2.0 * log(w7 / (-1.0 + w7)) - 2.0 * log(w7 / (1.0 + w7)) - log((-tb + w7) / (-1.0 + w7)) + log((-tb + w7) / (1.0 + w7)) - log((vb + w7) / (-1.0 + w7))
-                    + log((vb + w7) / (1.0 + w7)) + 16.0 * log(wx3 / (-1.0i + wx3)) + 16.0 * log(wx3 / (1.0i + wx3)) + 16.0 * log(wx4 / (-1.0i + wx4)) + 16.0 * log(wx4 / (1.0i + wx4)) - 8.0 * log((wx3 - xb) / (-1.0i + wx3)) - 8.0 * log((wx3 - xb) / (1.0i + wx3)) - 8.0 * log((wx4 - xb) / (-1.0i + wx4)) - 8.0 * log((wx4 - xb) / (1.0i + wx4)) - 8.0 * log((wx3 + xb) / (-1.0i + wx3)) - 8.0 * log((wx3 + xb) / (1.0i + wx3)) - 8.0 * log((wx4 + xb) / (-1.0i + wx4)) - 8.0 * log((wx4 + xb) / (1.0i + wx4)) + (2.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - tb, 1.0 - w7) - (2.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 + tb, 1.0 + w7)
+                + 1.0i * M_PI * power_of<2>(log((1.0 + w7) / (w5 + w7))) * my_sign(imag((-1.0 + w5) / (w5 + w7))) * T(1.0, (vb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7)) - (2.0 * 1.0i) * M_PI * log(1.0 - vb / w5) * log((1.0 + w7) / (w5 + w7)) * my_sign(imag((w5 + w7) / (-vb + w5))) * T(1.0, (vb + w7) / (w5 + w7), (1.0 + w7) / (w5 + w7)) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xb) / (1.0i + wx3))) * my_sign(imag((1.0i - xb) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, (wx3 + xb) / (1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xb) / (1.0i + wx4))) * my_sign(imag((1.0i - xb) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, (wx4 + xb) / (1.0i + wx4)) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xb) / (1.0i + wx3))) * my_sign(imag((1.0i + xb) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, (wx3 - xb) / (1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xb) / (1.0i + wx4))) * my_sign(imag((1.0i + xb) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, (wx4 - xb) / (1.0i + wx4)) - (16.0 * 1.0i) * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xb) / (-1.0i + wx3))) * my_sign(imag((1.0i + xb) / (1.0i - wx3))) * T(1.0, (1.0 + 1.0i * xb) / 2.0, (wx3 + xb) / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xb) / (-1.0i + wx4))) * my_sign(imag((1.0i + xb) / (1.0i - wx4))) * T(1.0, (1.0 + 1.0i * xb) / 2.0, (wx4 + xb) / (-1.0i + wx4)) - (16.0 * 1.0i) * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                + c_li2_30 * (-16.0 * c_ln_21 + 8.0 * log((wx3 - xb) / (1.0i + wx3)) + 8.0 * log((wx3 + xb) / (1.0i + wx3)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)) - (16.0 * 1.0i) * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                + c_li2_26 * (-16.0 * c_ln_18 + 8.0 * log((wx3 - xb) / (-1.0i + wx3)) + 8.0 * log((wx3 + xb) / (-1.0i + wx3)) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)) - (16.0 * 1.0i) * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                + c_li2_31 * (-16.0 * c_ln_31 + 8.0 * log((wx4 - xb) / (1.0i + wx4)) + 8.0 * log((wx4 + xb) / (1.0i + wx4)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)) - (16.0 * 1.0i) * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                + log(1.0 - 1.0i * xb) * ((2.0 * pisqu) / 3.0 - 16.0 * (log(xb) - log(1.0i * xb)) * ln2 - 20.0 * ln2squ + 16.0 * ln2 * log((-1.0i) * xb) + log(1.0 + 1.0i * xb) * (32.0 * ln2 - 16.0 * log((-1.0i) * xb) - 16.0 * log(1.0i * xb) - 4.0 * log((wx3 + xb) / (-1.0i + wx3)) - 4.0 * log((wx3 + xb) / (1.0i + wx3)) - 4.0 * log((wx4 + xb) / (-1.0i + wx4)) - 4.0 * log((wx4 + xb) / (1.0i + wx4))) + (16.0 * 1.0i) * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
+                    + (16.0 * 1.0i) * M_PI * c_ln_40 * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i + xb))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(-real(xbinv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                    - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4))
+                + c_li2_28 * (-16.0 * c_ln_28 + 8.0 * log((wx4 - xb) / (-1.0i + wx4)) + 8.0 * log((wx4 + xb) / (-1.0i + wx4)) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + li2half * (-16.0 * (log(xb) - log(1.0i * xb)) - 16.0 * c_ln_44 - 2.0 * log(1.0 / (1.0 - w4)) - 2.0 * log(1.0 / (1.0 + w4)) - 2.0 * log(1.0 / (1.0 - w5)) - 2.0 * log(1.0 / (1.0 + w5)) + 2.0 * log(w7 / (-1.0 + w7)) - 2.0 * log(w7 / (1.0 + w7)) - log((-tb + w7) / (-1.0 + w7)) + log((-tb + w7) / (1.0 + w7)) - log((vb + w7) / (-1.0 + w7))
+                    + log((vb + w7) / (1.0 + w7)) + 16.0 * c_ln_18 + 16.0 * c_ln_21 + 16.0 * c_ln_28 + 16.0 * c_ln_31 - 8.0 * log((wx3 - xb) / (-1.0i + wx3)) - 8.0 * log((wx3 - xb) / (1.0i + wx3)) - 8.0 * log((wx4 - xb) / (-1.0i + wx4)) - 8.0 * log((wx4 - xb) / (1.0i + wx4)) - 8.0 * log((wx3 + xb) / (-1.0i + wx3)) - 8.0 * log((wx3 + xb) / (1.0i + wx3)) - 8.0 * log((wx4 + xb) / (-1.0i + wx4)) - 8.0 * log((wx4 + xb) / (1.0i + wx4)) + (2.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - tb, 1.0 - w7) - (2.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 + tb, 1.0 + w7)
                     - (2.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 - vb, 1.0 + w7) + (2.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 + vb, 1.0 - w7) + (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (16.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4))
-                + log(1.0 + 1.0i * xb) * ((2.0 * pisqu) / 3.0 - 16.0 * log(1.0i) * ln2 - 20.0 * ln2squ + 16.0 * ln2 * log(1.0i * xb) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xb) / (-1.0i + wx3))) * my_sign(imag((-1.0i + xb) / (-1.0i + wx3))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xb), (wx3 - xb) / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xb) / (-1.0i + wx4))) * my_sign(imag((-1.0i + xb) / (-1.0i + wx4))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xb), (wx4 - xb) / (-1.0i + wx4)) - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3)
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4) + log(xb) * (4.0 * log((1.0i + xb) / (1.0i - wx3)) * log((wx3 + xb) / wx3) + 4.0 * log((1.0i - xb) / (1.0i + wx4)) * log((wx4 + xb) / wx4) + 4.0 * log((1.0i + xb) / (1.0i - wx4)) * log((wx4 + xb) / wx4) + 4.0 * log((-1.0i + xb) / (-1.0i + wx3)) * log(1.0 - xb / wx3) + 4.0 * log((1.0i + xb) / (1.0i + wx3)) * log(1.0 - xb / wx3) + 4.0 * log((-1.0i + xb) / (-1.0i + wx4)) * log(1.0 - xb / wx4) + 4.0 * log((1.0i + xb) / (1.0i + wx4)) * log(1.0 - xb / wx4)
-                    + (8.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xbinv)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xbinv)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xbinv)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xbinv)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(imag(wx3 * xbinv)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(imag(wx3 * xbinv)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3)
-                    + (8.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(imag(wx4 * xbinv)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(imag(wx4 * xbinv)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4)) + power_of<2>(log(1.0 - 1.0i * xb)) * (4.0 * ln2 - 8.0 * log(-1.0i / xb) + 2.0 * log(((-1.0i) * (wx3 - xb)) / ((1.0i + wx3) * xb)) + 2.0 * log(((-1.0i) * (wx4 - xb)) / ((1.0i + wx4) * xb)) - 4.0 * log(1.0i * xb) + 8.0 * log((2.0 * 1.0i) * xb) - 2.0 * log((wx3 + xb) / (-1.0i + wx3)) + 2.0 * log(((-1.0i) * (wx3 + xb)) / ((-1.0i + wx3) * xb)) - 2.0 * log((wx4 + xb) / (-1.0i + wx4)) + 2.0 * log(((-1.0i) * (wx4 + xb)) / ((-1.0i + wx4) * xb))
+                + log(1.0 + 1.0i * xb) * ((2.0 * pisqu) / 3.0 - 16.0 * c_ln_44 * ln2 - 20.0 * ln2squ + 16.0 * ln2 * log(1.0i * xb) + (16.0 * 1.0i) * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (16.0 * 1.0i) * M_PI * c_ln_40 * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (16.0 * 1.0i) * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i - xb))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xb, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                    - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                    - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(xbinv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xb) / (-1.0i + wx3))) * my_sign(imag((-1.0i + xb) / (-1.0i + wx3))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xb), (wx3 - xb) / (-1.0i + wx3)) + (8.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xb) / (-1.0i + wx4))) * my_sign(imag((-1.0i + xb) / (-1.0i + wx4))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xb), (wx4 - xb) / (-1.0i + wx4)) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3)
+                - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
+                - (4.0 * 1.0i) * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4) + log(xb) * (4.0 * log((1.0i + xb) / (1.0i - wx3)) * log((wx3 + xb) / wx3) + 4.0 * log((1.0i - xb) / (1.0i + wx4)) * log((wx4 + xb) / wx4) + 4.0 * log((1.0i + xb) / (1.0i - wx4)) * log((wx4 + xb) / wx4) + 4.0 * log((-1.0i + xb) / (-1.0i + wx3)) * log(1.0 - xb / wx3) + 4.0 * log((1.0i + xb) / (1.0i + wx3)) * log(1.0 - xb / wx3) + 4.0 * log((-1.0i + xb) / (-1.0i + wx4)) * log(1.0 - xb / wx4) + 4.0 * log((1.0i + xb) / (1.0i + wx4)) * log(1.0 - xb / wx4)
+                    + (8.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-imag(wx3 * xbinv)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * c_ln_12 * my_sign(-imag(wx3 * xbinv)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-imag(wx4 * xbinv)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * c_ln_14 * my_sign(-imag(wx4 * xbinv)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * c_ln_11 * my_sign(imag(wx3 * xbinv)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3) + (8.0 * 1.0i) * M_PI * c_ln_12 * my_sign(imag(wx3 * xbinv)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3)
+                    + (8.0 * 1.0i) * M_PI * c_ln_13 * my_sign(imag(wx4 * xbinv)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4) + (8.0 * 1.0i) * M_PI * c_ln_14 * my_sign(imag(wx4 * xbinv)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4)) + power_of<2>(log(1.0 - 1.0i * xb)) * (4.0 * ln2 - 8.0 * log(-1.0i / xb) + 2.0 * log(((-1.0i) * (wx3 - xb)) / ((1.0i + wx3) * xb)) + 2.0 * log(((-1.0i) * (wx4 - xb)) / ((1.0i + wx4) * xb)) - 4.0 * log(1.0i * xb) + 8.0 * log((2.0 * 1.0i) * xb) - 2.0 * log((wx3 + xb) / (-1.0i + wx3)) + 2.0 * log(((-1.0i) * (wx3 + xb)) / ((-1.0i + wx3) * xb)) - 2.0 * log((wx4 + xb) / (-1.0i + wx4)) + 2.0 * log(((-1.0i) * (wx4 + xb)) / ((-1.0i + wx4) * xb))
                     + (4.0 * 1.0i) * M_PI * my_sign(real(xb)) * T(1.0, (wx3 + xb) / wx3, 1.0 - 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(real(xb)) * T(1.0, (wx4 + xb) / wx4, 1.0 - 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(real(xb)) * T(1.0, 1.0 - xb / wx3, 1.0 - 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(real(xb)) * T(1.0, 1.0 - xb / wx4, 1.0 - 1.0i * xb)) + power_of<2>(log(1.0 + 1.0i * xb)) * (4.0 * ln2 - 8.0 * log(1.0i / xb) + 2.0 * log((1.0i * (wx3 - xb)) / ((-1.0i + wx3) * xb)) + 2.0 * log((1.0i * (wx4 - xb)) / ((-1.0i + wx4) * xb)) - 4.0 * log((-1.0i) * xb) + 8.0 * log((-2.0 * 1.0i) * xb) - 2.0 * log((wx3 + xb) / (1.0i + wx3)) + 2.0 * log((1.0i * (wx3 + xb)) / ((1.0i + wx3) * xb)) - 2.0 * log((wx4 + xb) / (1.0i + wx4))
                     + 2.0 * log((1.0i * (wx4 + xb)) / ((1.0i + wx4) * xb)) + (4.0 * 1.0i) * M_PI * my_sign(-real(xb)) * T(1.0, (wx3 + xb) / wx3, 1.0 + 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(-real(xb)) * T(1.0, (wx4 + xb) / wx4, 1.0 + 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(-real(xb)) * T(1.0, 1.0 - xb / wx3, 1.0 + 1.0i * xb) + (4.0 * 1.0i) * M_PI * my_sign(-real(xb)) * T(1.0, 1.0 - xb / wx4, 1.0 + 1.0i * xb)) - 4.0 * pisqu * log(1.0 + w4inv) * T(1.0, 1.0 - tb / w4, 1.0 + w4inv) * T(p(-w4inv, 1.0 - tb / w4), 1.0 - tb / w4, (-1.0 + w4) / w4) + 4.0 * pisqu * log(1.0 + w4inv) * T(1.0, 1.0 - tb / w4, 1.0 + w4inv) * T(p(-w4inv, 1.0 - tb / w4), 1.0 - tb / w4, 1.0 - w7 / w4)
                 - 4.0 * pisqu * log(1.0 + w4inv) * T(1.0, (vb + w4) / w4, 1.0 + w4inv) * T(p(-w4inv, (vb + w4) / w4), (vb + w4) / w4, (-1.0 + w4) / w4) + 4.0 * pisqu * log(1.0 + w4inv) * T(1.0, (vb + w4) / w4, 1.0 + w4inv) * T(p(-w4inv, (vb + w4) / w4), (vb + w4) / w4, 1.0 - w7 / w4) - 4.0 * pisqu * log((-1.0 + w4) / w4) * T(1.0, 1.0 - tb / w4, (-1.0 + w4) / w4) * T(p(w4inv, 1.0 - tb / w4), 1.0 - tb / w4, 1.0 + w4inv) - 4.0 * pisqu * log((-1.0 + w4) / w4) * T(1.0, 1.0 - tb / w4, (-1.0 + w4) / w4) * T(p(w4inv, 1.0 - tb / w4), 1.0 - tb / w4, 1.0 - w7 / w4)
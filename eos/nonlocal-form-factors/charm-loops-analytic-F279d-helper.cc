@@ -123,15 +123,15 @@ namespace eos
                     - (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
                     + (16.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)));
 
-            const complex<double> resultpart2 = ln2 * (64.0 * trilog(-1.0) + 112.0 * li3half - 16.0 * trilog(1.0 + w4inv) - 16.0 * trilog(1.0 / (1.0 - w4)) - 16.0 * trilog(-w4inv) - 16.0 * trilog(w4inv) + 16.0 * trilog((-1.0 + w4) / (2.0 * w4))
+            const complex<double> resultpart2 = ln2 * (64.0 * c_li3_25 + 112.0 * li3half - 16.0 * trilog(1.0 + w4inv) - 16.0 * trilog(1.0 / (1.0 - w4)) - 16.0 * trilog(-w4inv) - 16.0 * trilog(w4inv) + 16.0 * trilog((-1.0 + w4) / (2.0 * w4))
                 - 16.0 * trilog((-1.0 + w4) / w4) - 16.0 * trilog(1.0 / (1.0 + w4)) + 16.0 * trilog((1.0 - w4) / (1.0 + w4)) + 16.0 * trilog((1.0 + w4) / (1.0 - w4)) + 16.0 * trilog((1.0 + w4) / (2.0 * w4)) - 16.0 * trilog(1.0 + w5inv) - 16.0 * trilog(1.0 / (1.0 - w5))
                 - 16.0 * trilog(-w5inv) - 16.0 * trilog(w5inv) + 16.0 * trilog((-1.0 + w5) / (2.0 * w5)) - 16.0 * trilog((-1.0 + w5) / w5) - 16.0 * trilog(1.0 / (1.0 + w5)) + 16.0 * trilog((1.0 - w5) / (1.0 + w5)) + 16.0 * trilog((1.0 + w5) / (1.0 - w5))
                 + 16.0 * trilog((1.0 + w5) / (2.0 * w5)) + 8.0 * trilog(1.0 + w7inv) + 8.0 * trilog(1.0 / (1.0 - w7)) + 8.0 * trilog(-w7inv) + 8.0 * trilog(w7inv) - 8.0 * trilog((-1.0 + w7) / (2.0 * w7)) + 8.0 * trilog((-1.0 + w7) / w7)
-                + 8.0 * trilog(1.0 / (1.0 + w7)) - 8.0 * trilog((1.0 - w7) / (1.0 + w7)) - 8.0 * trilog((1.0 + w7) / (1.0 - w7)) - 8.0 * trilog((1.0 + w7) / (2.0 * w7)) + 16.0 * trilog(1.0 - 1.0i * wx3) + 16.0 * trilog(1.0 + 1.0i * wx3) + 16.0 * trilog(-1.0i / wx3) + 16.0 * trilog(1.0i / wx3)
-                + 16.0 * trilog(-1.0i / (-1.0i + wx3)) + 16.0 * trilog(wx3 / (-1.0i + wx3)) - 16.0 * trilog((-1.0i + wx3) / (2.0 * wx3)) + 16.0 * trilog(1.0i / (1.0i + wx3)) - 16.0 * trilog((1.0i - wx3) / (1.0i + wx3)) + 16.0 * trilog(wx3 / (1.0i + wx3))
-                - 16.0 * trilog((1.0i + wx3) / (1.0i - wx3)) - 16.0 * trilog((1.0i + wx3) / (2.0 * wx3)) + 16.0 * trilog(1.0 - 1.0i * wx4) + 16.0 * trilog(1.0 + 1.0i * wx4) + 16.0 * trilog(-1.0i / wx4) + 16.0 * trilog(1.0i / wx4) + 16.0 * trilog(-1.0i / (-1.0i + wx4))
-                + 16.0 * trilog(wx4 / (-1.0i + wx4)) - 16.0 * trilog((-1.0i + wx4) / (2.0 * wx4)) + 16.0 * trilog(1.0i / (1.0i + wx4)) - 16.0 * trilog((1.0i - wx4) / (1.0i + wx4)) + 16.0 * trilog(wx4 / (1.0i + wx4)) - 16.0 * trilog((1.0i + wx4) / (1.0i - wx4))
-                - 16.0 * trilog((1.0i + wx4) / (2.0 * wx4)) - 8.0 * trilog((1.0i + wx3) / (1.0i - xd)) - 8.0 * trilog((1.0i + wx4) / (1.0i - xd)) - 8.0 * trilog((1.0i - xd) / (1.0i + wx3)) - 8.0 * trilog((1.0i - xd) / (1.0i + wx4)) - 8.0 * trilog((wx3 - xd) / (-1.0i + wx3))
+                + 8.0 * trilog(1.0 / (1.0 + w7)) - 8.0 * trilog((1.0 - w7) / (1.0 + w7)) - 8.0 * trilog((1.0 + w7) / (1.0 - w7)) - 8.0 * trilog((1.0 + w7) / (2.0 * w7)) + 16.0 * c_li3_26 + 16.0 * c_li3_27 + 16.0 * c_li3_1 + 16.0 * c_li3_2
+                + 16.0 * c_li3_3 + 16.0 * c_li3_4 - 16.0 * c_li3_5 + 16.0 * c_li3_7 - 16.0 * c_li3_8 + 16.0 * c_li3_9
+                - 16.0 * c_li3_10 - 16.0 * c_li3_11 + 16.0 * c_li3_28 + 16.0 * c_li3_29 + 16.0 * c_li3_13 + 16.0 * c_li3_14 + 16.0 * c_li3_15
+                + 16.0 * c_li3_16 - 16.0 * c_li3_17 + 16.0 * c_li3_19 - 16.0 * c_li3_20 + 16.0 * c_li3_21 - 16.0 * c_li3_22
+                - 16.0 * c_li3_23 - 8.0 * trilog((1.0i + wx3) / (1.0i - xd)) - 8.0 * trilog((1.0i + wx4) / (1.0i - xd)) - 8.0 * trilog((1.0i - xd) / (1.0i + wx3)) - 8.0 * trilog((1.0i - xd) / (1.0i + wx4)) - 8.0 * trilog((wx3 - xd) / (-1.0i + wx3))
                 - 8.0 * trilog((wx3 - xd) / (1.0i + wx3)) - 8.0 * trilog((wx4 - xd) / (-1.0i + wx4)) - 8.0 * trilog((wx4 - xd) / (1.0i + wx4)) - 64.0 * trilog(1.0 / 2.0 - (1.0i / 2.0) * xd) + 48.0 * trilog(1.0 - 1.0i * xd) + 8.0 * trilog(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd)))
                 + 8.0 * trilog(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd))) - 64.0 * trilog((1.0 + 1.0i * xd) / 2.0) + 48.0 * trilog(1.0 + 1.0i * xd) + 8.0 * trilog(((1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 - xd))) + 8.0 * trilog(((1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 - xd)))
                 + 8.0 * trilog((1.0i * (wx3 - xd)) / ((-1.0i + wx3) * xd)) + 8.0 * trilog(((-1.0i) * (wx3 - xd)) / ((1.0i + wx3) * xd)) + 8.0 * trilog((1.0i * (wx4 - xd)) / ((-1.0i + wx4) * xd)) + 8.0 * trilog(((-1.0i) * (wx4 - xd)) / ((1.0i + wx4) * xd)) - 32.0 * trilog((-1.0i) * xd)
@@ -176,26 +176,26 @@ namespace eos
                 + (8.0 * pisqu * log((2.0 * (1.0 + w5)) / (-1.0 + w5))) / 3.0 + (8.0 * power_of<3>(log((2.0 * (1.0 + w5)) / (-1.0 + w5)))) / 3.0 - 8.0 * power_of<2>(lnhalf) * log((1.0 + w5) / (2.0 * w5)) - 4.0 * power_of<2>(lnhalf) * log(1.0 + w7inv) + (4.0 * pisqu * log(-2.0 / w7)) / 3.0
                 + (4.0 * power_of<3>(log(-2.0 / w7))) / 3.0 + (4.0 * pisqu * log(2.0 / w7)) / 3.0 + (4.0 * power_of<3>(log(2.0 / w7))) / 3.0 + 4.0 * power_of<2>(lnhalf) * log((-1.0 + w7) / (2.0 * w7)) - 4.0 * power_of<2>(lnhalf) * log((-1.0 + w7) / w7) - 4.0 * power_of<2>(lnhalf) * log(w7 / (-1.0 + w7))
                 + 4.0 * power_of<2>(lnhalf) * log((2.0 * w7) / (-1.0 + w7)) - (4.0 * pisqu * log((2.0 * (-1.0 + w7)) / (1.0 + w7))) / 3.0 - (4.0 * power_of<3>(log((2.0 * (-1.0 + w7)) / (1.0 + w7)))) / 3.0 - 4.0 * power_of<2>(lnhalf) * log(w7 / (1.0 + w7)) + 4.0 * power_of<2>(lnhalf) * log((2.0 * w7) / (1.0 + w7))
-                - (4.0 * pisqu * log((2.0 * (1.0 + w7)) / (-1.0 + w7))) / 3.0 - (4.0 * power_of<3>(log((2.0 * (1.0 + w7)) / (-1.0 + w7)))) / 3.0 + 4.0 * power_of<2>(lnhalf) * log((1.0 + w7) / (2.0 * w7)) + (8.0 * pisqu * log(1.0 - 1.0i * wx3)) / 3.0 + (8.0 * power_of<3>(log(1.0 - 1.0i * wx3))) / 3.0
-                + (8.0 * pisqu * log(1.0 + 1.0i * wx3)) / 3.0 + (8.0 * power_of<3>(log(1.0 + 1.0i * wx3))) / 3.0 + 16.0 * dilog((1.0i + wx3) / (1.0i - wx3)) * log(-1.0i / (-1.0i + wx3)) + 16.0 * dilog((1.0i + wx3) / (2.0 * wx3)) * log(-1.0i / (-1.0i + wx3)) - 8.0 * lnhalf * power_of<2>(log(-1.0i / (-1.0i + wx3)))
-                - 8.0 * ln2 * power_of<2>(log(-1.0i / (-1.0i + wx3))) + 8.0 * power_of<2>(log(-1.0i / (-1.0i + wx3))) * log((2.0 * wx3) / (-1.0i + wx3)) + 8.0 * power_of<2>(log(-1.0i / (-1.0i + wx3))) * log((-1.0i + wx3) / (2.0 * wx3)) + 16.0 * dilog((-1.0i + wx3) / (2.0 * wx3)) * log(1.0i / (1.0i + wx3))
-                + 16.0 * dilog((1.0i - wx3) / (1.0i + wx3)) * log(1.0i / (1.0i + wx3)) - 8.0 * lnhalf * power_of<2>(log(1.0i / (1.0i + wx3))) - 8.0 * ln2 * power_of<2>(log(1.0i / (1.0i + wx3))) + 8.0 * power_of<2>(log(1.0i / (1.0i + wx3))) * log((2.0 * wx3) / (1.0i + wx3))
-                + 8.0 * power_of<2>(log(1.0i / (1.0i + wx3))) * log((1.0i + wx3) / (2.0 * wx3)) - (8.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / wx3)) / 3.0 - (8.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / wx3))) / 3.0 - (8.0 * pisqu * log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / wx3)) / 3.0
-                - (8.0 * power_of<3>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / wx3))) / 3.0 + (8.0 * pisqu * log(1.0 - 1.0i * wx4)) / 3.0 + (8.0 * power_of<3>(log(1.0 - 1.0i * wx4))) / 3.0 + (8.0 * pisqu * log(1.0 + 1.0i * wx4)) / 3.0 + (8.0 * power_of<3>(log(1.0 + 1.0i * wx4))) / 3.0
-                + 16.0 * dilog((1.0i + wx4) / (1.0i - wx4)) * log(-1.0i / (-1.0i + wx4)) + 16.0 * dilog((1.0i + wx4) / (2.0 * wx4)) * log(-1.0i / (-1.0i + wx4)) - 8.0 * lnhalf * power_of<2>(log(-1.0i / (-1.0i + wx4))) - 8.0 * ln2 * power_of<2>(log(-1.0i / (-1.0i + wx4)))
-                + 8.0 * power_of<2>(log(-1.0i / (-1.0i + wx4))) * log((2.0 * wx4) / (-1.0i + wx4)) + 8.0 * power_of<2>(log(-1.0i / (-1.0i + wx4))) * log((-1.0i + wx4) / (2.0 * wx4)) + dilog(-1.0) * (-16.0 * log(-1.0i / (-1.0i + wx3)) - 16.0 * log(1.0i / (1.0i + wx3)) - 16.0 * log(-1.0i / (-1.0i + wx4))
-                    - 16.0 * log(1.0i / (1.0i + wx4))) + 16.0 * dilog((-1.0i + wx4) / (2.0 * wx4)) * log(1.0i / (1.0i + wx4)) + 16.0 * dilog((1.0i - wx4) / (1.0i + wx4)) * log(1.0i / (1.0i + wx4)) - 8.0 * lnhalf * power_of<2>(log(1.0i / (1.0i + wx4))) - 8.0 * ln2 * power_of<2>(log(1.0i / (1.0i + wx4)))
-                + 8.0 * power_of<2>(log(1.0i / (1.0i + wx4))) * log((2.0 * wx4) / (1.0i + wx4)) + 8.0 * power_of<2>(log(1.0i / (1.0i + wx4))) * log((1.0i + wx4) / (2.0 * wx4)) - (8.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / wx4)) / 3.0 - (8.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / wx4))) / 3.0
+                - (4.0 * pisqu * log((2.0 * (1.0 + w7)) / (-1.0 + w7))) / 3.0 - (4.0 * power_of<3>(log((2.0 * (1.0 + w7)) / (-1.0 + w7)))) / 3.0 + 4.0 * power_of<2>(lnhalf) * log((1.0 + w7) / (2.0 * w7)) + (8.0 * pisqu * c_ln_7) / 3.0 + (8.0 * power_of<3>(c_ln_7)) / 3.0
+                + (8.0 * pisqu * c_ln_8) / 3.0 + (8.0 * power_of<3>(c_ln_8)) / 3.0 + 16.0 * c_li2_11 * c_ln_45 + 16.0 * c_li2_12 * c_ln_45 - 8.0 * lnhalf * power_of<2>(c_ln_45)
+                - 8.0 * ln2 * power_of<2>(c_ln_45) + 8.0 * power_of<2>(c_ln_45) * c_ln_19 + 8.0 * power_of<2>(c_ln_45) * c_ln_20 + 16.0 * c_li2_9 * c_ln_46
+                + 16.0 * c_li2_10 * c_ln_46 - 8.0 * lnhalf * power_of<2>(c_ln_46) - 8.0 * ln2 * power_of<2>(c_ln_46) + 8.0 * power_of<2>(c_ln_46) * c_ln_22
+                + 8.0 * power_of<2>(c_ln_46) * c_ln_24 - (8.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / wx3)) / 3.0 - (8.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / wx3))) / 3.0 - (8.0 * pisqu * log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / wx3)) / 3.0
+                - (8.0 * power_of<3>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / wx3))) / 3.0 + (8.0 * pisqu * c_ln_9) / 3.0 + (8.0 * power_of<3>(c_ln_9)) / 3.0 + (8.0 * pisqu * c_ln_10) / 3.0 + (8.0 * power_of<3>(c_ln_10)) / 3.0
+                + 16.0 * c_li2_15 * c_ln_47 + 16.0 * c_li2_16 * c_ln_47 - 8.0 * lnhalf * power_of<2>(c_ln_47) - 8.0 * ln2 * power_of<2>(c_ln_47)
+                + 8.0 * power_of<2>(c_ln_47) * c_ln_29 + 8.0 * power_of<2>(c_ln_47) * c_ln_30 + c_li2_29 * (-16.0 * c_ln_45 - 16.0 * c_ln_46 - 16.0 * c_ln_47
+                    - 16.0 * c_ln_48) + 16.0 * c_li2_13 * c_ln_48 + 16.0 * c_li2_14 * c_ln_48 - 8.0 * lnhalf * power_of<2>(c_ln_48) - 8.0 * ln2 * power_of<2>(c_ln_48)
+                + 8.0 * power_of<2>(c_ln_48) * c_ln_32 + 8.0 * power_of<2>(c_ln_48) * c_ln_34 - (8.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / wx4)) / 3.0 - (8.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / wx4))) / 3.0
                 - (8.0 * pisqu * log(((1.0i / 2.0) * (1.0 + power_of<2>(wx4))) / wx4)) / 3.0 - (8.0 * power_of<3>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx4))) / wx4))) / 3.0 - (4.0 * pisqu * log(wx3 / (1.0i - xd))) / 3.0 - (4.0 * power_of<3>(log(wx3 / (1.0i - xd)))) / 3.0 - (4.0 * power_of<3>(log((1.0i + wx3) / (1.0i - xd)))) / 3.0
                 - (4.0 * pisqu * log(wx4 / (1.0i - xd))) / 3.0 - (4.0 * power_of<3>(log(wx4 / (1.0i - xd)))) / 3.0 - (4.0 * power_of<3>(log((1.0i + wx4) / (1.0i - xd)))) / 3.0 - 8.0 * dilog(((-1.0i + wx3) * (-1.0i + xd)) / ((1.0i + wx3) * (1.0i + xd))) * log((1.0i - xd) / (1.0i + wx3))
                 - 8.0 * dilog(((-1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 + xd))) * log((1.0i - xd) / (1.0i + wx3)) - 8.0 * dilog(((-1.0i + wx4) * (-1.0i + xd)) / ((1.0i + wx4) * (1.0i + xd))) * log((1.0i - xd) / (1.0i + wx4))
                 - 8.0 * dilog(((-1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 + xd))) * log((1.0i - xd) / (1.0i + wx4)) + (4.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / (wx3 - xd))) / 3.0 + (4.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx3))) / (wx3 - xd)))) / 3.0
                 + (4.0 * pisqu * log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / (wx3 - xd))) / 3.0 + (4.0 * power_of<3>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx3))) / (wx3 - xd)))) / 3.0 + (4.0 * pisqu * log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / (wx4 - xd))) / 3.0
                 + (4.0 * power_of<3>(log((((-1.0 / 2.0) * 1.0i) * (1.0 + power_of<2>(wx4))) / (wx4 - xd)))) / 3.0 + (4.0 * pisqu * log(((1.0i / 2.0) * (1.0 + power_of<2>(wx4))) / (wx4 - xd))) / 3.0 + (4.0 * power_of<3>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx4))) / (wx4 - xd)))) / 3.0 - 32.0 * dilog(1.0 - 1.0i * xd) * log(1.0 - 1.0i * xd)
-                + dilog((-1.0i) * xd) * (16.0 * log(1.0 - 1.0i * xd) - 16.0 * log(1.0 + 1.0i * xd)) - 32.0 * dilog(1.0 + 1.0i * xd) * log(1.0 + 1.0i * xd) + dilog(-1.0i / wx3) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / wx3) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(-1.0i / (-1.0i + wx3)) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(1.0i / (1.0i + wx3)) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
-                + dilog(-1.0i / wx4) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(1.0i / wx4) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(-1.0i / (-1.0i + wx4)) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / (1.0i + wx4)) * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(1.0i * xd) * (-16.0 * log(1.0 - 1.0i * xd) + 16.0 * log(1.0 + 1.0i * xd)) + (4.0 * pisqu * log((1.0i * wx3) / ((-1.0i + wx3) * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx3) / ((-1.0i + wx3) * xd)))) / 3.0
+                + dilog((-1.0i) * xd) * (16.0 * log(1.0 - 1.0i * xd) - 16.0 * log(1.0 + 1.0i * xd)) - 32.0 * dilog(1.0 + 1.0i * xd) * log(1.0 + 1.0i * xd) + c_li2_17 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
+                + c_li2_18 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + c_li2_1 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + c_li2_2 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
+                + c_li2_19 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + c_li2_20 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + c_li2_3 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd))
+                + c_li2_4 * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd)) + dilog(1.0i * xd) * (-16.0 * log(1.0 - 1.0i * xd) + 16.0 * log(1.0 + 1.0i * xd)) + (4.0 * pisqu * log((1.0i * wx3) / ((-1.0i + wx3) * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx3) / ((-1.0i + wx3) * xd)))) / 3.0
                 + (4.0 * pisqu * log((1.0i * wx4) / ((-1.0i + wx4) * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx4) / ((-1.0i + wx4) * xd)))) / 3.0 - (4.0 * pisqu * log(wx3 / (-1.0i + xd))) / 3.0 - (4.0 * power_of<3>(log(wx3 / (-1.0i + xd)))) / 3.0 - (4.0 * power_of<3>(log((-1.0i + wx3) / (-1.0i + xd)))) / 3.0
                 - (4.0 * pisqu * log(wx4 / (-1.0i + xd))) / 3.0 - (4.0 * power_of<3>(log(wx4 / (-1.0i + xd)))) / 3.0 - (4.0 * power_of<3>(log((-1.0i + wx4) / (-1.0i + xd)))) / 3.0 - 8.0 * dilog(((1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 - xd))) * log((-1.0i + xd) / (-1.0i + wx3))
                 - 8.0 * dilog(((1.0i + wx3) * (-1.0i + xd)) / ((-1.0i + wx3) * (1.0i + xd))) * log((-1.0i + xd) / (-1.0i + wx3)) - 8.0 * dilog(((1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 - xd))) * log((-1.0i + xd) / (-1.0i + wx4))
@@ -220,14 +220,14 @@ namespace eos
                 + 8.0 * dilog((wx4 + xd) / (1.0i + xd)) * log((wx4 + xd) / wx4) - 8.0 * dilog((1.0i * (wx4 + xd)) / (wx4 * (1.0i + xd))) * log((wx4 + xd) / wx4)
                 + (-4.0 * log(((1.0i + wx4) * xd) / (wx4 * (-1.0i + xd))) - 4.0 * log((wx4 * (-1.0i + xd)) / ((1.0i + wx4) * xd)) - 4.0 * log(((-1.0i + wx4) * xd) / (wx4 * (1.0i + xd))) - 4.0 * log((wx4 * (1.0i + xd)) / ((-1.0i + wx4) * xd))) * power_of<2>(log((wx4 + xd) / wx4))
                 + log((1.0i + wx4) / (1.0i - xd)) * ((-4.0 * pisqu) / 3.0 + 4.0 * power_of<2>(log((wx4 + xd) / wx4))) + log((1.0i - wx4) / (1.0i + xd)) * ((-4.0 * pisqu) / 3.0 + 4.0 * power_of<2>(log((wx4 + xd) / wx4)))
-                + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx3) * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log(1.0 - xd / wx3)) + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx3)) * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log(1.0 - xd / wx3))
+                + c_li2_26 * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log(1.0 - xd / wx3)) + c_li2_25 * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log(1.0 - xd / wx3))
                 + 8.0 * dilog((wx3 - xd) / (-1.0i + wx3)) * log(1.0 - xd / wx3) + 8.0 * dilog((wx3 - xd) / (1.0i + wx3)) * log(1.0 - xd / wx3) - 8.0 * dilog((1.0i * (wx3 - xd)) / ((-1.0i + wx3) * xd)) * log(1.0 - xd / wx3)
                 - 8.0 * dilog(((-1.0i) * (wx3 - xd)) / ((1.0i + wx3) * xd)) * log(1.0 - xd / wx3) - 8.0 * dilog(((-1.0i) * (wx3 - xd)) / (wx3 * (-1.0i + xd))) * log(1.0 - xd / wx3) - 8.0 * dilog((1.0i * (wx3 - xd)) / (wx3 * (1.0i + xd))) * log(1.0 - xd / wx3)
                 + 8.0 * dilog((-wx3 + xd) / (-1.0i + xd)) * log(1.0 - xd / wx3) + 8.0 * dilog((-wx3 + xd) / (1.0i + xd)) * log(1.0 - xd / wx3) + (-4.0 * log(((-1.0i + wx3) * xd) / (wx3 * (-1.0i + xd))) - 4.0 * log((wx3 * (-1.0i + xd)) / ((-1.0i + wx3) * xd))
                     - 4.0 * log(((1.0i + wx3) * xd) / (wx3 * (1.0i + xd))) - 4.0 * log((wx3 * (1.0i + xd)) / ((1.0i + wx3) * xd))) * power_of<2>(log(1.0 - xd / wx3)) + log((-1.0i + wx3) / (-1.0i + xd)) * ((-4.0 * pisqu) / 3.0 + 4.0 * power_of<2>(log(1.0 - xd / wx3)))
                 + log((1.0i + wx3) / (1.0i + xd)) * ((-4.0 * pisqu) / 3.0 + 4.0 * power_of<2>(log(1.0 - xd / wx3))) + (4.0 * pisqu * log((1.0i * wx3) / (1.0i * xd - wx3 * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx3) / (1.0i * xd - wx3 * xd)))) / 3.0 + (4.0 * pisqu * log(((-1.0i) * wx3) / (1.0i * xd + wx3 * xd))) / 3.0
-                + (4.0 * power_of<3>(log(((-1.0i) * wx3) / (1.0i * xd + wx3 * xd)))) / 3.0 + (4.0 * pisqu * log((1.0i * wx3) / (1.0i * xd + wx3 * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx3) / (1.0i * xd + wx3 * xd)))) / 3.0 + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx4) * (-8.0 * log((wx4 + xd) / wx4) - 8.0 * log(1.0 - xd / wx4))
-                + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4)) * (-8.0 * log((wx4 + xd) / wx4) - 8.0 * log(1.0 - xd / wx4)) + 8.0 * dilog((wx4 - xd) / (-1.0i + wx4)) * log(1.0 - xd / wx4) + 8.0 * dilog((wx4 - xd) / (1.0i + wx4)) * log(1.0 - xd / wx4)
+                + (4.0 * power_of<3>(log(((-1.0i) * wx3) / (1.0i * xd + wx3 * xd)))) / 3.0 + (4.0 * pisqu * log((1.0i * wx3) / (1.0i * xd + wx3 * xd))) / 3.0 + (4.0 * power_of<3>(log((1.0i * wx3) / (1.0i * xd + wx3 * xd)))) / 3.0 + c_li2_28 * (-8.0 * log((wx4 + xd) / wx4) - 8.0 * log(1.0 - xd / wx4))
+                + c_li2_27 * (-8.0 * log((wx4 + xd) / wx4) - 8.0 * log(1.0 - xd / wx4)) + 8.0 * dilog((wx4 - xd) / (-1.0i + wx4)) * log(1.0 - xd / wx4) + 8.0 * dilog((wx4 - xd) / (1.0i + wx4)) * log(1.0 - xd / wx4)
                 - 8.0 * dilog((1.0i * (wx4 - xd)) / ((-1.0i + wx4) * xd)) * log(1.0 - xd / wx4) - 8.0 * dilog(((-1.0i) * (wx4 - xd)) / ((1.0i + wx4) * xd)) * log(1.0 - xd / wx4) - 8.0 * dilog(((-1.0i) * (wx4 - xd)) / (wx4 * (-1.0i + xd))) * log(1.0 - xd / wx4)
                 - 8.0 * dilog((1.0i * (wx4 - xd)) / (wx4 * (1.0i + xd))) * log(1.0 - xd / wx4) + 8.0 * dilog((-wx4 + xd) / (-1.0i + xd)) * log(1.0 - xd / wx4) + 8.0 * dilog((-wx4 + xd) / (1.0i + xd)) * log(1.0 - xd / wx4)
                 + (-4.0 * log(((-1.0i + wx4) * xd) / (wx4 * (-1.0i + xd))) - 4.0 * log((wx4 * (-1.0i + xd)) / ((-1.0i + wx4) * xd)) - 4.0 * log(((1.0i + wx4) * xd) / (wx4 * (1.0i + xd))) - 4.0 * log((wx4 * (1.0i + xd)) / ((1.0i + wx4) * xd))) * power_of<2>(log(1.0 - xd / wx4))
@@ -339,69 +339,69 @@ namespace eos
                 my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 - w4) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log(((1.0 + w4) * (1.0 + yd)) / (2.0 - 2.0 * w4))) * my_sign(2.0 * imag(1.0 / (1.0 + yd)))
                 + (8.0 * 1.0i) * M_PI * H1((1.0 + w5) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log((-1.0 / 2.0) * (((-1.0 + w5) * (1.0 + yd)) / (1.0 + w5)))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 - w5) / (1.0 + yd), 2.0 / (1.0 + yd)) *
                 power_of<2>(log(((1.0 + w5) * (1.0 + yd)) / (2.0 - 2.0 * w5))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) - (4.0 * 1.0i) * M_PI * H1((1.0 + w7) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log((-1.0 / 2.0) * (((-1.0 + w7) * (1.0 + yd)) / (1.0 + w7)))) * my_sign(2.0 * imag(1.0 / (1.0 + yd)))
-                - (4.0 * 1.0i) * M_PI * H1((1.0 - w7) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log(((1.0 + w7) * (1.0 + yd)) / (2.0 - 2.0 * w7))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (16.0 * 1.0i) * M_PI * H1((1.0i + wx3) / (-1.0i + wx3), (1.0i + wx3) / wx3) * power_of<2>(log(-1.0i / (1.0i + wx3))) * my_sign(-real(wx3inv))
-                - (16.0 * 1.0i) * M_PI * H1((-1.0i + wx3) / wx3, (1.0i + wx3) / wx3) * power_of<2>(log(((2.0 * 1.0i) * wx3) / (1.0 + power_of<2>(wx3)))) * my_sign(-real(wx3inv)) + (16.0 * 1.0i) * M_PI * H1((-1.0i + wx3) / (1.0i + wx3), (-1.0i + wx3) / wx3) * power_of<2>(log(1.0i / (-1.0i + wx3))) * my_sign(real(wx3inv))
-                - (16.0 * 1.0i) * M_PI * H1((1.0i + wx3) / wx3, (-1.0i + wx3) / wx3) * power_of<2>(log(((-2.0 * 1.0i) * wx3) / (1.0 + power_of<2>(wx3)))) * my_sign(real(wx3inv)) + (16.0 * 1.0i) * M_PI * H1((1.0i + wx4) / (-1.0i + wx4), (1.0i + wx4) / wx4) * power_of<2>(log(-1.0i / (1.0i + wx4))) * my_sign(-real(wx4inv))
-                - (16.0 * 1.0i) * M_PI * H1((-1.0i + wx4) / wx4, (1.0i + wx4) / wx4) * power_of<2>(log(((2.0 * 1.0i) * wx4) / (1.0 + power_of<2>(wx4)))) * my_sign(-real(wx4inv)) + (16.0 * 1.0i) * M_PI * H1((-1.0i + wx4) / (1.0i + wx4), (-1.0i + wx4) / wx4) * power_of<2>(log(1.0i / (-1.0i + wx4))) * my_sign(real(wx4inv))
-                - (16.0 * 1.0i) * M_PI * H1((1.0i + wx4) / wx4, (-1.0i + wx4) / wx4) * power_of<2>(log(((-2.0 * 1.0i) * wx4) / (1.0 + power_of<2>(wx4)))) * my_sign(real(wx4inv)) + (16.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx3))) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) *
-                T(1.0, -1.0i / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0i / (1.0i + wx3))) * my_sign(-imag(wx3 / (1.0i + wx3))) * T(1.0, -1.0i / (-1.0i + wx3), 1.0i / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(-1.0i / (-1.0i + wx3))) * my_sign(imag(wx3 / (1.0i - wx3))) *
-                T(1.0, 1.0i / (1.0i + wx3), -1.0i / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx3))) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, 1.0i / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
-                + (16.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx4))) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, -1.0i / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(1.0i / (1.0i + wx4))) * my_sign(-imag(wx4 / (1.0i + wx4))) * T(1.0, -1.0i / (-1.0i + wx4), 1.0i / (1.0i + wx4))
-                + (16.0 * 1.0i) * M_PI * power_of<2>(log(-1.0i / (-1.0i + wx4))) * my_sign(imag(wx4 / (1.0i - wx4))) * T(1.0, 1.0i / (1.0i + wx4), -1.0i / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx4))) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, 1.0i / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx3))) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
+                - (4.0 * 1.0i) * M_PI * H1((1.0 - w7) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log(((1.0 + w7) * (1.0 + yd)) / (2.0 - 2.0 * w7))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (16.0 * 1.0i) * M_PI * H1((1.0i + wx3) / (-1.0i + wx3), (1.0i + wx3) / wx3) * power_of<2>(c_ln_49) * my_sign(-real(wx3inv))
+                - (16.0 * 1.0i) * M_PI * H1((-1.0i + wx3) / wx3, (1.0i + wx3) / wx3) * power_of<2>(log(((2.0 * 1.0i) * wx3) / (1.0 + power_of<2>(wx3)))) * my_sign(-real(wx3inv)) + (16.0 * 1.0i) * M_PI * H1((-1.0i + wx3) / (1.0i + wx3), (-1.0i + wx3) / wx3) * power_of<2>(c_ln_50) * my_sign(real(wx3inv))
+                - (16.0 * 1.0i) * M_PI * H1((1.0i + wx3) / wx3, (-1.0i + wx3) / wx3) * power_of<2>(log(((-2.0 * 1.0i) * wx3) / (1.0 + power_of<2>(wx3)))) * my_sign(real(wx3inv)) + (16.0 * 1.0i) * M_PI * H1((1.0i + wx4) / (-1.0i + wx4), (1.0i + wx4) / wx4) * power_of<2>(c_ln_51) * my_sign(-real(wx4inv))
+                - (16.0 * 1.0i) * M_PI * H1((-1.0i + wx4) / wx4, (1.0i + wx4) / wx4) * power_of<2>(log(((2.0 * 1.0i) * wx4) / (1.0 + power_of<2>(wx4)))) * my_sign(-real(wx4inv)) + (16.0 * 1.0i) * M_PI * H1((-1.0i + wx4) / (1.0i + wx4), (-1.0i + wx4) / wx4) * power_of<2>(c_ln_52) * my_sign(real(wx4inv))
+                - (16.0 * 1.0i) * M_PI * H1((1.0i + wx4) / wx4, (-1.0i + wx4) / wx4) * power_of<2>(log(((-2.0 * 1.0i) * wx4) / (1.0 + power_of<2>(wx4)))) * my_sign(real(wx4inv)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_53) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) *
+                T(1.0, -1.0i / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_46) * my_sign(-imag(wx3 / (1.0i + wx3))) * T(1.0, -1.0i / (-1.0i + wx3), 1.0i / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_45) * my_sign(imag(wx3 / (1.0i - wx3))) *
+                T(1.0, 1.0i / (1.0i + wx3), -1.0i / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_54) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, 1.0i / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
+                + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_55) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, -1.0i / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_48) * my_sign(-imag(wx4 / (1.0i + wx4))) * T(1.0, -1.0i / (-1.0i + wx4), 1.0i / (1.0i + wx4))
+                + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_47) * my_sign(imag(wx4 / (1.0i - wx4))) * T(1.0, 1.0i / (1.0i + wx4), -1.0i / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * power_of<2>(c_ln_56) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, 1.0i / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_54) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
                 + power_of<2>(log((1.0i + xd) / (1.0i - wx3))) * (4.0 * log((-2.0 * 1.0i) / (-1.0i + xd)) - 4.0 * log(((-1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 + xd))) - 4.0 * log(((-2.0 * 1.0i) * (wx3 + xd)) / ((-1.0i + wx3) * (-1.0i + xd)))
-                    + (8.0 * 1.0i) * M_PI * my_sign(imag((wx3 + xd) / (-1.0i + wx3))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (1.0i + xd) / (1.0i - wx3))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx4))) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, (1.0i - xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
+                    + (8.0 * 1.0i) * M_PI * my_sign(imag((wx3 + xd) / (-1.0i + wx3))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (1.0i + xd) / (1.0i - wx3))) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_56) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, (1.0i - xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
                 + power_of<2>(log((1.0i + xd) / (1.0i - wx4))) * (-4.0 * log(((-1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 + xd))) - 4.0 * log(((-2.0 * 1.0i) * (wx4 + xd)) / ((-1.0i + wx4) * (-1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx4 + xd) / (-1.0i + wx4))) *
-                    T(1.0, (1.0i - xd) / (1.0i + wx4), (1.0i + xd) / (1.0i - wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                + log(1.0 - 1.0i * xd) * (-16.0 * ln2squ - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
-                + log(1.0 + 1.0i * xd) * (-16.0 * ln2squ - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx3))) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) * T(1.0, (-1.0i + xd) / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3))
+                    T(1.0, (1.0i - xd) / (1.0i + wx4), (1.0i + xd) / (1.0i - wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                + log(1.0 - 1.0i * xd) * (-16.0 * ln2squ - (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                + log(1.0 + 1.0i * xd) * (-16.0 * ln2squ - (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_53) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) * T(1.0, (-1.0i + xd) / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3))
                 + power_of<2>(log((1.0i + xd) / (1.0i + wx3))) * (-4.0 * log(((1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 - xd))) - 4.0 * log(((-2.0 * 1.0i) * (wx3 - xd)) / ((1.0i + wx3) * (-1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx3 - xd) / (1.0i + wx3))) *
-                    T(1.0, (-1.0i + xd) / (-1.0i + wx3), (1.0i + xd) / (1.0i + wx3))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx4))) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, (-1.0i + xd) / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4))
+                    T(1.0, (-1.0i + xd) / (-1.0i + wx3), (1.0i + xd) / (1.0i + wx3))) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_55) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, (-1.0i + xd) / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4))
                 + power_of<2>(log((1.0i + xd) / (1.0i + wx4))) * (-4.0 * log(((1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 - xd))) - 4.0 * log(((-2.0 * 1.0i) * (wx4 - xd)) / ((1.0i + wx4) * (-1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx4 - xd) / (1.0i + wx4))) *
-                    T(1.0, (-1.0i + xd) / (-1.0i + wx4), (1.0i + xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx3))) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i - wx3), (-2.0 * 1.0i) / (-1.0i + wx3))
-                + log((wx3 + xd) / wx3) * ((16.0 * 1.0i) * M_PI * log((2.0 * 1.0i) / (1.0i + wx3)) * my_sign(imag((1.0i + wx3) / (wx3 + xd))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * log((-2.0 * 1.0i) / (-1.0i + wx3)) * my_sign(imag((-1.0i + wx3) / (wx3 + xd))) *
+                    T(1.0, (-1.0i + xd) / (-1.0i + wx4), (1.0i + xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_53) * my_sign(imag((1.0i + wx3) / (-1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i - wx3), (-2.0 * 1.0i) / (-1.0i + wx3))
+                + log((wx3 + xd) / wx3) * ((16.0 * 1.0i) * M_PI * c_ln_54 * my_sign(imag((1.0i + wx3) / (wx3 + xd))) * T(1.0, (1.0i - xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * c_ln_53 * my_sign(imag((-1.0i + wx3) / (wx3 + xd))) *
                     T(1.0, (1.0i + xd) / (1.0i - wx3), (-2.0 * 1.0i) / (-1.0i + wx3))) + power_of<2>(log((1.0i - xd) / (1.0i + wx3))) * (4.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) + 4.0 * log((2.0 * 1.0i) / (1.0i + xd)) - 4.0 * log(((1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 + xd)))
                     - 4.0 * log(((2.0 * 1.0i) * (wx3 + xd)) / ((1.0i + wx3) * (1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx3 + xd) / (1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i - wx3), (1.0i - xd) / (1.0i + wx3)))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx3))) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
-                + log(1.0 - xd / wx3) * ((16.0 * 1.0i) * M_PI * log((-2.0 * 1.0i) / (-1.0i + wx3)) * my_sign(imag((-1.0i + wx3) / (wx3 - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * log((2.0 * 1.0i) / (1.0i + wx3)) * my_sign(imag((1.0i + wx3) / (wx3 - xd))) *
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_54) * my_sign(imag((-1.0i + wx3) / (1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))
+                + log(1.0 - xd / wx3) * ((16.0 * 1.0i) * M_PI * c_ln_53 * my_sign(imag((-1.0i + wx3) / (wx3 - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx3), (-2.0 * 1.0i) / (-1.0i + wx3)) + (16.0 * 1.0i) * M_PI * c_ln_54 * my_sign(imag((1.0i + wx3) / (wx3 - xd))) *
                     T(1.0, (1.0i + xd) / (1.0i + wx3), (2.0 * 1.0i) / (1.0i + wx3))) + power_of<2>(log((-1.0i + xd) / (-1.0i + wx3))) * (-4.0 * log(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd))) + 4.0 * log((2.0 * 1.0i) / (1.0i + xd))
                     - 4.0 * log(((2.0 * 1.0i) * (wx3 - xd)) / ((-1.0i + wx3) * (1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx3 - xd) / (-1.0i + wx3))) * T(1.0, (1.0i + xd) / (1.0i + wx3), (-1.0i + xd) / (-1.0i + wx3)))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-2.0 * 1.0i) / (-1.0i + wx4))) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i - wx4), (-2.0 * 1.0i) / (-1.0i + wx4))
-                + log((wx4 + xd) / wx4) * ((16.0 * 1.0i) * M_PI * log((2.0 * 1.0i) / (1.0i + wx4)) * my_sign(imag((1.0i + wx4) / (wx4 + xd))) * T(1.0, (1.0i - xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4)) + (16.0 * 1.0i) * M_PI * log((-2.0 * 1.0i) / (-1.0i + wx4)) * my_sign(imag((-1.0i + wx4) / (wx4 + xd))) *
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_55) * my_sign(imag((1.0i + wx4) / (-1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i - wx4), (-2.0 * 1.0i) / (-1.0i + wx4))
+                + log((wx4 + xd) / wx4) * ((16.0 * 1.0i) * M_PI * c_ln_56 * my_sign(imag((1.0i + wx4) / (wx4 + xd))) * T(1.0, (1.0i - xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4)) + (16.0 * 1.0i) * M_PI * c_ln_55 * my_sign(imag((-1.0i + wx4) / (wx4 + xd))) *
                     T(1.0, (1.0i + xd) / (1.0i - wx4), (-2.0 * 1.0i) / (-1.0i + wx4))) + power_of<2>(log((1.0i - xd) / (1.0i + wx4))) * (4.0 * log((2.0 * 1.0i) / (1.0i + xd)) - 4.0 * log(((1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 + xd))) - 4.0 * log(((2.0 * 1.0i) * (wx4 + xd)) / ((1.0i + wx4) * (1.0i + xd)))
-                    + (8.0 * 1.0i) * M_PI * my_sign(imag((wx4 + xd) / (1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i - wx4), (1.0i - xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((2.0 * 1.0i) / (1.0i + wx4))) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
-                + log(1.0 - xd / wx4) * ((16.0 * 1.0i) * M_PI * log((-2.0 * 1.0i) / (-1.0i + wx4)) * my_sign(imag((-1.0i + wx4) / (wx4 - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * log((2.0 * 1.0i) / (1.0i + wx4)) * my_sign(imag((1.0i + wx4) / (wx4 - xd))) *
+                    + (8.0 * 1.0i) * M_PI * my_sign(imag((wx4 + xd) / (1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i - wx4), (1.0i - xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_56) * my_sign(imag((-1.0i + wx4) / (1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))
+                + log(1.0 - xd / wx4) * ((16.0 * 1.0i) * M_PI * c_ln_55 * my_sign(imag((-1.0i + wx4) / (wx4 - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx4), (-2.0 * 1.0i) / (-1.0i + wx4)) + (16.0 * 1.0i) * M_PI * c_ln_56 * my_sign(imag((1.0i + wx4) / (wx4 - xd))) *
                     T(1.0, (1.0i + xd) / (1.0i + wx4), (2.0 * 1.0i) / (1.0i + wx4))) + power_of<2>(log((-1.0i + xd) / (-1.0i + wx4))) * (-4.0 * log(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd))) + 4.0 * log((2.0 * 1.0i) / (1.0i + xd))
                     - 4.0 * log(((2.0 * 1.0i) * (wx4 - xd)) / ((-1.0i + wx4) * (1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(imag((wx4 - xd) / (-1.0i + wx4))) * T(1.0, (1.0i + xd) / (1.0i + wx4), (-1.0i + xd) / (-1.0i + wx4)))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + log((1.0i - xd) / (1.0i + wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) * log((wx3 + xd) / wx3) + 4.0 * power_of<2>(log((wx3 + xd) / wx3))
-                    - (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)) - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                + log((1.0i + xd) / (1.0i - wx3)) * (4.0 * power_of<2>(log((wx3 + xd) / wx3)) - (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + log((1.0i - xd) / (1.0i + wx4)) * (4.0 * power_of<2>(log((wx4 + xd) / wx4))
-                    - (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)) - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                + log((1.0i + xd) / (1.0i - wx4)) * (4.0 * power_of<2>(log((wx4 + xd) / wx4)) - (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + dilog((-1.0i + wx3) / (1.0i + wx3)) * (-16.0 * log(-1.0i / (-1.0i + wx3)) + 8.0 * log((-1.0i + xd) / (-1.0i + wx3))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + log((1.0i - xd) / (1.0i + wx3)) * (8.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) * log((wx3 + xd) / wx3) + 4.0 * power_of<2>(log((wx3 + xd) / wx3))
+                    - (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                + log((1.0i + xd) / (1.0i - wx3)) * (4.0 * power_of<2>(log((wx3 + xd) / wx3)) - (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + log((1.0i - xd) / (1.0i + wx4)) * (4.0 * power_of<2>(log((wx4 + xd) / wx4))
+                    - (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                + log((1.0i + xd) / (1.0i - wx4)) * (4.0 * power_of<2>(log((wx4 + xd) / wx4)) - (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + c_li2_32 * (-16.0 * c_ln_45 + 8.0 * log((-1.0i + xd) / (-1.0i + wx3))
                     + 8.0 * log((1.0i + xd) / (1.0i - wx3)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3))
-                + dilog(wx3 / (1.0i + wx3)) * (16.0 * log(-1.0i / (-1.0i + wx3)) - 8.0 * log((-1.0i + xd) / (-1.0i + wx3)) - 8.0 * log((1.0i + xd) / (1.0i - wx3)) + (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
-                    + (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)) + log((1.0i + xd) / (1.0i + wx3)) * (4.0 * power_of<2>(log(1.0 - xd / wx3)) - (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) + dilog((1.0i + wx3) / (-1.0i + wx3)) * (-16.0 * log(1.0i / (1.0i + wx3)) + 8.0 * log((1.0i - xd) / (1.0i + wx3)) + 8.0 * log((1.0i + xd) / (1.0i + wx3))
+                + c_li2_6 * (16.0 * c_ln_45 - 8.0 * log((-1.0i + xd) / (-1.0i + wx3)) - 8.0 * log((1.0i + xd) / (1.0i - wx3)) + (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
+                    + (16.0 * 1.0i) * M_PI * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)) + log((1.0i + xd) / (1.0i + wx3)) * (4.0 * power_of<2>(log(1.0 - xd / wx3)) - (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) + c_li2_33 * (-16.0 * c_ln_46 + 8.0 * log((1.0i - xd) / (1.0i + wx3)) + 8.0 * log((1.0i + xd) / (1.0i + wx3))
                     - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3))
-                + dilog(wx3 / (-1.0i + wx3)) * (16.0 * log(1.0i / (1.0i + wx3)) - 8.0 * log((1.0i - xd) / (1.0i + wx3)) - 8.0 * log((1.0i + xd) / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                    + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)) + log((-1.0i + xd) / (-1.0i + wx3)) * (4.0 * power_of<2>(log(1.0 - xd / wx3)) - (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(-real(wx3inv)) *
-                    T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
-                + dilog((-1.0i + wx4) / (1.0i + wx4)) * (-16.0 * log(-1.0i / (-1.0i + wx4)) + 8.0 * log((-1.0i + xd) / (-1.0i + wx4)) + 8.0 * log((1.0i + xd) / (1.0i - wx4)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
-                    - (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)) + dilog(wx4 / (1.0i + wx4)) * (16.0 * log(-1.0i / (-1.0i + wx4)) - 8.0 * log((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * log((1.0i + xd) / (1.0i - wx4))
+                + c_li2_5 * (16.0 * c_ln_46 - 8.0 * log((1.0i - xd) / (1.0i + wx3)) - 8.0 * log((1.0i + xd) / (1.0i + wx3)) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                    + (16.0 * 1.0i) * M_PI * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)) + log((-1.0i + xd) / (-1.0i + wx3)) * (4.0 * power_of<2>(log(1.0 - xd / wx3)) - (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(-real(wx3inv)) *
+                    T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)) - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
+                + c_li2_34 * (-16.0 * c_ln_47 + 8.0 * log((-1.0i + xd) / (-1.0i + wx4)) + 8.0 * log((1.0i + xd) / (1.0i - wx4)) - (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
+                    - (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)) + c_li2_8 * (16.0 * c_ln_47 - 8.0 * log((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * log((1.0i + xd) / (1.0i - wx4))
                     + (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + (16.0 * 1.0i) * M_PI * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4))
-                + log((1.0i + xd) / (1.0i + wx4)) * (4.0 * power_of<2>(log(1.0 - xd / wx4)) - (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + dilog((1.0i + wx4) / (-1.0i + wx4)) * (-16.0 * log(1.0i / (1.0i + wx4)) + 8.0 * log((1.0i - xd) / (1.0i + wx4)) + 8.0 * log((1.0i + xd) / (1.0i + wx4))
+                + log((1.0i + xd) / (1.0i + wx4)) * (4.0 * power_of<2>(log(1.0 - xd / wx4)) - (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + c_li2_35 * (-16.0 * c_ln_48 + 8.0 * log((1.0i - xd) / (1.0i + wx4)) + 8.0 * log((1.0i + xd) / (1.0i + wx4))
                     - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) - (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4))
-                + dilog(wx4 / (-1.0i + wx4)) * (16.0 * log(1.0i / (1.0i + wx4)) - 8.0 * log((1.0i - xd) / (1.0i + wx4)) - 8.0 * log((1.0i + xd) / (1.0i + wx4)) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                    + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)) + log((-1.0i + xd) / (-1.0i + wx4)) * (4.0 * power_of<2>(log(1.0 - xd / wx4)) - (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(-real(wx4inv)) *
+                + c_li2_7 * (16.0 * c_ln_48 - 8.0 * log((1.0i - xd) / (1.0i + wx4)) - 8.0 * log((1.0i + xd) / (1.0i + wx4)) + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                    + (16.0 * 1.0i) * M_PI * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)) + log((-1.0i + xd) / (-1.0i + wx4)) * (4.0 * power_of<2>(log(1.0 - xd / wx4)) - (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(-real(wx4inv)) *
                     T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)) + power_of<2>(log(1.0 - 1.0i * xd)) * ((4.0 * ln64) / 3.0 - 4.0 * log((wx3 - xd) / (1.0i + wx3)) - 4.0 * log((wx4 - xd) / (1.0i + wx4)) - (8.0 * log(1.0 / 8.0 - (1.0i / 8.0) * xd)) / 3.0 - 8.0 * log(1.0i * xd)
                     + 4.0 * log((wx3 + xd) / wx3) - 4.0 * log((wx3 + xd) / (-1.0i + wx3)) + 4.0 * log((wx4 + xd) / wx4) - 4.0 * log((wx4 + xd) / (-1.0i + wx4)) + 4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)
                     + (8.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (wx3 + xd) / wx3, 1.0 - 1.0i * xd) + (8.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (wx4 + xd) / wx4, 1.0 - 1.0i * xd) + (8.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx3, 1.0 - 1.0i * xd)
@@ -447,8 +447,8 @@ namespace eos
                 + dilog((1.0 - w7) / 2.0) * (-8.0 * log(w7 / (-1.0 + w7)) + 4.0 * log((w7 - yd) / (-1.0 + w7)) + 4.0 * log((w7 + yd) / (-1.0 + w7)) - (8.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7) - (8.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 + yd, 1.0 - w7))
                 - (8.0 * 1.0i) * M_PI * log((1.0 - w7) / 2.0) * log(1.0 + w7) * my_sign(-imag(w7)) * T(1.0, 1.0 + yd, 1.0 + w7) + (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w7)) * my_sign(-imag(w7)) * T(1.0, 1.0 + yd, 1.0 + w7)
                 + dilog((1.0 + w7) / 2.0) * (-8.0 * log(w7 / (1.0 + w7)) + 4.0 * log((w7 - yd) / (1.0 + w7)) + 4.0 * log((w7 + yd) / (1.0 + w7)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 - yd, 1.0 + w7) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 + yd, 1.0 + w7))
-                + li2half * (-16.0 * log(w4 / (-1.0 + w4)) - 16.0 * log(w4 / (1.0 + w4)) - 16.0 * log(w5 / (-1.0 + w5)) - 16.0 * log(w5 / (1.0 + w5)) + 8.0 * log(w7 / (-1.0 + w7)) + 8.0 * log(w7 / (1.0 + w7)) - 16.0 * log(-1.0i / (-1.0i + wx3))
-                    - 16.0 * log(1.0i / (1.0i + wx3)) - 16.0 * log(-1.0i / (-1.0i + wx4)) - 16.0 * log(1.0i / (1.0i + wx4)) + 8.0 * log((w4 - yd) / (-1.0 + w4)) + 8.0 * log((w4 - yd) / (1.0 + w4)) + 8.0 * log((w5 - yd) / (-1.0 + w5)) + 8.0 * log((w5 - yd) / (1.0 + w5))
+                + li2half * (-16.0 * log(w4 / (-1.0 + w4)) - 16.0 * log(w4 / (1.0 + w4)) - 16.0 * log(w5 / (-1.0 + w5)) - 16.0 * log(w5 / (1.0 + w5)) + 8.0 * log(w7 / (-1.0 + w7)) + 8.0 * log(w7 / (1.0 + w7)) - 16.0 * c_ln_45
+                    - 16.0 * c_ln_46 - 16.0 * c_ln_47 - 16.0 * c_ln_48 + 8.0 * log((w4 - yd) / (-1.0 + w4)) + 8.0 * log((w4 - yd) / (1.0 + w4)) + 8.0 * log((w5 - yd) / (-1.0 + w5)) + 8.0 * log((w5 - yd) / (1.0 + w5))
                     - 4.0 * log((w7 - yd) / (-1.0 + w7)) - 4.0 * log((w7 - yd) / (1.0 + w7)) + 8.0 * log((w4 + yd) / (-1.0 + w4)) + 8.0 * log((w4 + yd) / (1.0 + w4)) + 8.0 * log((w5 + yd) / (-1.0 + w5)) + 8.0 * log((w5 + yd) / (1.0 + w5))
                     - 4.0 * log((w7 + yd) / (-1.0 + w7)) - 4.0 * log((w7 + yd) / (1.0 + w7)) - (16.0 * 1.0i) * M_PI * my_sign(imag(w4)) * T(1.0, 1.0 - yd, 1.0 - w4) - (16.0 * 1.0i) * M_PI * my_sign(-imag(w4)) * T(1.0, 1.0 - yd, 1.0 + w4) - (16.0 * 1.0i) * M_PI * my_sign(imag(w5)) * T(1.0, 1.0 - yd, 1.0 - w5)
                     - (16.0 * 1.0i) * M_PI * my_sign(-imag(w5)) * T(1.0, 1.0 - yd, 1.0 + w5) + (8.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w7)) * T(1.0, 1.0 - yd, 1.0 + w7) - (16.0 * 1.0i) * M_PI * my_sign(imag(w4)) * T(1.0, 1.0 + yd, 1.0 - w4)
@@ -458,12 +458,12 @@ namespace eos
                     - (16.0 * 1.0i) * M_PI * log((1.0 + w5) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w5) / 2.0) + (8.0 * 1.0i) * M_PI * log((1.0 - w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w7) / 2.0)
                     + (8.0 * 1.0i) * M_PI * log((1.0 + w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w7) / 2.0) + (16.0 * 1.0i) * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4)
                     + (16.0 * 1.0i) * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 + w5) - (8.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 - w7) - (16.0 * 1.0i) * M_PI * log(1.0 + w4) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w4)
-                    - (16.0 * 1.0i) * M_PI * log(1.0 - w5) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - w5) + (8.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w7)) - 32.0 * pisqu * log((1.0i + wx3) / wx3) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) *
-                T(p(-1.0i / wx3, (wx3 + xd) / wx3), (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - 32.0 * pisqu * log((1.0i + wx3) / wx3) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) * T(p(-1.0i / wx3, 1.0 - xd / wx3), 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
-                - 32.0 * pisqu * log((-1.0i + wx3) / wx3) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) * T(p(1.0i / wx3, (wx3 + xd) / wx3), (wx3 + xd) / wx3, (1.0i + wx3) / wx3) - 32.0 * pisqu * log((-1.0i + wx3) / wx3) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) *
-                T(p(1.0i / wx3, 1.0 - xd / wx3), 1.0 - xd / wx3, (1.0i + wx3) / wx3) - 32.0 * pisqu * log((1.0i + wx4) / wx4) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) * T(p(-1.0i / wx4, (wx4 + xd) / wx4), (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
-                - 32.0 * pisqu * log((1.0i + wx4) / wx4) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) * T(p(-1.0i / wx4, 1.0 - xd / wx4), 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - 32.0 * pisqu * log((-1.0i + wx4) / wx4) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) *
-                T(p(1.0i / wx4, (wx4 + xd) / wx4), (wx4 + xd) / wx4, (1.0i + wx4) / wx4) - 32.0 * pisqu * log((-1.0i + wx4) / wx4) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) * T(p(1.0i / wx4, 1.0 - xd / wx4), 1.0 - xd / wx4, (1.0i + wx4) / wx4) - 40.0 * zeta3);
+                    - (16.0 * 1.0i) * M_PI * log(1.0 - w5) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - w5) + (8.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w7)) - 32.0 * pisqu * c_ln_12 * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) *
+                T(p(-1.0i / wx3, (wx3 + xd) / wx3), (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - 32.0 * pisqu * c_ln_12 * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) * T(p(-1.0i / wx3, 1.0 - xd / wx3), 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
+                - 32.0 * pisqu * c_ln_11 * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) * T(p(1.0i / wx3, (wx3 + xd) / wx3), (wx3 + xd) / wx3, (1.0i + wx3) / wx3) - 32.0 * pisqu * c_ln_11 * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) *
+                T(p(1.0i / wx3, 1.0 - xd / wx3), 1.0 - xd / wx3, (1.0i + wx3) / wx3) - 32.0 * pisqu * c_ln_14 * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) * T(p(-1.0i / wx4, (wx4 + xd) / wx4), (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
+                - 32.0 * pisqu * c_ln_14 * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) * T(p(-1.0i / wx4, 1.0 - xd / wx4), 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - 32.0 * pisqu * c_ln_13 * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) *
+                T(p(1.0i / wx4, (wx4 + xd) / wx4), (wx4 + xd) / wx4, (1.0i + wx4) / wx4) - 32.0 * pisqu * c_ln_13 * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) * T(p(1.0i / wx4, 1.0 - xd / wx4), 1.0 - xd / wx4, (1.0i + wx4) / wx4) - 40.0 * zeta3);
 
             return resultpart1 + resultpart2;
         }
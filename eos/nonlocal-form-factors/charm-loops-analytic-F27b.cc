@@ -517,76 +517,76 @@ namespace eos
                      - 2.0 * 1.0i * xb5 * (-193.0 - 192.0 * yb + 128.0 * yb3 + 2112.0 * yb5 + 3.0 * yb6 * (-1011.0 + 64.0 * ln2) + yb2 * (1721.0 + 192.0 * ln2) - yb4 * (12799.0 + 384.0 * ln2)) - 2.0 * 1.0i * xb9 * (-193.0 - 192.0 * yb + 128.0 * yb3 + 2112.0 * yb5 + 3.0 * yb6 * (-1011.0 + 64.0 * ln2) + yb2 * (1721.0 + 192.0 * ln2) - yb4 * (12799.0 + 384.0 * ln2)) - 4.0 * 1.0i * xb3 * (37.0 - 24.0 * yb - 48.0 * yb3 + 72.0 * yb5 + yb4 * (2635.0 - 4224.0 * ln2) + yb2 * (-5.0 + 2112.0 * ln2) + yb6 * (757.0 + 2112.0 * ln2)) - 4.0 * 1.0i * xb11 * (37.0 - 24.0 * yb - 48.0 * yb3 + 72.0 * yb5 + yb4 * (2635.0 - 4224.0 * ln2) + yb2 * (-5.0 + 2112.0 * ln2) + yb6 * (757.0 + 2112.0 * ln2)) + 8.0 * 1.0i * xb7 * (133.0 + 72.0 * yb - 112.0 * yb3 - 984.0 * yb5 + yb4 * (3883.0 - 4224.0 * ln2) + 11.0 * yb2 * (17.0 + 192.0 * ln2) + yb6 * (2293.0 + 2112.0 * ln2))
                      - xb4 * (171.0 + 144.0 * yb - 224.0 * yb3 - 1968.0 * yb5 + yb4 * (11093.0 - 8064.0 * ln2) + yb2 * (-403.0 + 4032.0 * ln2) + yb6 * (4147.0 + 4032.0 * ln2)) + xb10 * (171.0 + 144.0 * yb - 224.0 * yb3 - 1968.0 * yb5 + yb4 * (11093.0 - 8064.0 * ln2) + yb2 * (-403.0 + 4032.0 * ln2) + yb6 * (4147.0 + 4032.0 * ln2)) + xb2 * (-23.0 - 48.0 * yb - 96.0 * yb3 + 144.0 * yb5 + yb4 * (471.0 - 8832.0 * ln2) + 3.0 * yb2 * (85.0 + 1472.0 * ln2) + yb6 * (33.0 + 4416.0 * ln2)) - xb12 * (-23.0 - 48.0 * yb - 96.0 * yb3 + 144.0 * yb5 + yb4 * (471.0 - 8832.0 * ln2) + 3.0 * yb2 * (85.0 + 1472.0 * ln2) + yb6 * (33.0 + 4416.0 * ln2)) + xb8 * (147.0 + 96.0 * yb - 320.0 * yb3 - 1824.0 * yb5 + 15.0 * yb6 * (5.0 + 576.0 * ln2) + yb2 * (-139.0 + 8640.0 * ln2) - yb4 * (691.0 + 17280.0 * ln2))
                      + xb6 * (-147.0 - 96.0 * yb + 320.0 * yb3 + 1824.0 * yb5 + yb2 * (139.0 - 8640.0 * ln2) - 15.0 * yb6 * (5.0 + 576.0 * ln2) + yb4 * (691.0 + 17280.0 * ln2)))));
-            const complex<double> logs3 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (2.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb2 * (1.0 - 186.0 * ln2) + yb6 * (221.0 - 186.0 * ln2) + yb4 * (406.0 + 372.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - 3.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) + 2.0 * yb * (1.0 + log(512.0))) - 3.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) + 2.0 * yb * (1.0 + log(512.0))) + xb4 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + log(512.0))) + xb8 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + log(512.0))))
-                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (-48.0 - 36.0 * yb + 56.0 * yb3 + 492.0 * yb5 + yb6 * (-884.0 + 129.0 * ln2) + yb2 * (-4.0 + 129.0 * ln2) - 2.0 * yb4 * (812.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (-12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + log(8.0)) + 3.0 * yb2 * (24.0 + log(32.0))) + 4.0 * xb10 * (-12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + log(8.0)) + 3.0 * yb2 * (24.0 + log(32.0))) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(2048.0)) + yb2 * (1.0 + log(2048.0))) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(2048.0)) + yb2 * (1.0 + log(2048.0))))
-                 + vb * xb2 * (-4.0 * xb6 * (-30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 - 12.0 * yb4 * (79.0 + 124.0 * ln2) + yb6 * (-583.0 + 744.0 * ln2) + yb2 * (-39.0 + 744.0 * ln2)) + xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (515.0 - 1944.0 * ln2) - yb2 * (425.0 + 1944.0 * ln2) + yb4 * (2422.0 + 3888.0 * ln2)) + xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (515.0 - 1944.0 * ln2) - yb2 * (425.0 + 1944.0 * ln2) + yb4 * (2422.0 + 3888.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + ln256) + yb * (2.0 + ln256)) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + ln256) + yb * (2.0 + ln256)) - 2.0 * xb2 * (6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + log(4096.0)))
-                   - 2.0 * xb10 * (6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + log(4096.0)))));
-            const complex<double> logs4 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (2.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb2 * (1.0 - 186.0 * ln2) + yb6 * (221.0 - 186.0 * ln2) + yb4 * (406.0 + 372.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - 3.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) - 2.0 * yb * (1.0 + log(512.0))) - 3.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) - 2.0 * yb * (1.0 + log(512.0))) + xb4 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + log(512.0))) + xb8 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + log(512.0))))
-                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (-48.0 + 36.0 * yb - 56.0 * yb3 - 492.0 * yb5 + yb6 * (-884.0 + 129.0 * ln2) + yb2 * (-4.0 + 129.0 * ln2) - 2.0 * yb4 * (812.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (-12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + log(8.0)) + 3.0 * yb2 * (24.0 + log(32.0))) + 4.0 * xb10 * (-12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + log(8.0)) + 3.0 * yb2 * (24.0 + log(32.0))) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 11.0 * ln2) + yb2 * (1.0 + log(2048.0))) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 11.0 * ln2) + yb2 * (1.0 + log(2048.0))))
-                 + tb * xb2 * (4.0 * xb6 * (-30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 - 12.0 * yb4 * (79.0 + 124.0 * ln2) + yb6 * (-583.0 + 744.0 * ln2) + yb2 * (-39.0 + 744.0 * ln2)) + xb4 * (-48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (-515.0 + 1944.0 * ln2) + yb2 * (425.0 + 1944.0 * ln2) - 2.0 * yb4 * (1211.0 + 1944.0 * ln2)) + xb8 * (-48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (-515.0 + 1944.0 * ln2) + yb2 * (425.0 + 1944.0 * ln2) - 2.0 * yb4 * (1211.0 + 1944.0 * ln2)) - 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256)) - 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256)) + 2.0 * xb2 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + log(4096.0)))
-                   + 2.0 * xb10 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + log(4096.0)))));
-            const complex<double> logs5 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-4.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb4 * (406.0 - 186.0 * ln2) + yb2 * (1.0 + 93.0 * ln2) + yb6 * (221.0 + 93.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - xb4 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + log(512.0))) - xb8 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + log(512.0))) - 6.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 9.0 * ln2) + yb2 * (1.0 + log(512.0))) - 6.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 9.0 * ln2) + yb2 * (1.0 + log(512.0))))
-                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (96.0 - 72.0 * yb + 112.0 * yb3 + 984.0 * yb5 + yb4 * (3248.0 - 258.0 * ln2) + yb2 * (8.0 + 129.0 * ln2) + yb6 * (1768.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + log(8.0)) + 3.0 * yb2 * (-48.0 + log(32.0))) + 4.0 * xb10 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + log(8.0)) + 3.0 * yb2 * (-48.0 + log(32.0))) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-2.0 + yb2 * (-2.0 + log(2048.0)) - yb * (4.0 + log(2048.0))) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-2.0 + yb2 * (-2.0 + log(2048.0)) - yb * (4.0 + log(2048.0))))
-                 - 2.0 * tb * xb2 * (-4.0 * xb6 * (30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 + yb4 * (948.0 - 744.0 * ln2) + yb2 * (39.0 + 372.0 * ln2) + yb6 * (583.0 + 372.0 * ln2)) - xb4 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) - xb8 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) + 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0))) + 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0))) + 2.0 * xb2 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (71.0 - 108.0 * ln2) + 36.0 * yb4 * (7.0 + ln64) - 9.0 * yb2 * (1.0 + log(4096.0))) + 2.0 * xb10 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (71.0 - 108.0 * ln2) + 36.0 * yb4 * (7.0 + ln64) - 9.0 * yb2 * (1.0 + log(4096.0)))));
-            const complex<double> logs6 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-4.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb4 * (406.0 - 186.0 * ln2) + yb2 * (1.0 + 93.0 * ln2) + yb6 * (221.0 + 93.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - xb4 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + log(512.0))) - xb8 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + log(512.0))) - 6.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(512.0)) + yb2 * (1.0 + log(512.0))) - 6.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(512.0)) + yb2 * (1.0 + log(512.0))))
-                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (96.0 + 72.0 * yb - 112.0 * yb3 - 984.0 * yb5 + yb4 * (3248.0 - 258.0 * ln2) + yb2 * (8.0 + 129.0 * ln2) + yb6 * (1768.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + log(8.0)) + 3.0 * yb2 * (-48.0 + log(32.0))) + 4.0 * xb10 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + log(8.0)) + 3.0 * yb2 * (-48.0 + log(32.0))) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-2.0 + yb2 * (-2.0 + log(2048.0)) + yb * (4.0 + log(2048.0))) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-2.0 + yb2 * (-2.0 + log(2048.0)) + yb * (4.0 + log(2048.0))))
-                 + 2.0 * vb * xb2 * (-4.0 * xb6 * (30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 + yb4 * (948.0 - 744.0 * ln2) + yb2 * (39.0 + 372.0 * ln2) + yb6 * (583.0 + 372.0 * ln2)) - xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) - xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0))) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0))) - 2.0 * xb2 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (-71.0 + 108.0 * ln2) - 36.0 * yb4 * (7.0 + ln64) + 9.0 * yb2 * (1.0 + log(4096.0)))
-                   - 2.0 * xb10 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (-71.0 + 108.0 * ln2) - 36.0 * yb4 * (7.0 + ln64) + 9.0 * yb2 * (1.0 + log(4096.0)))));
-            const complex<double> logs7 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-3.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 18.0 * ln2) + yb2 * (1.0 + 18.0 * ln2)) - 3.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 18.0 * ln2) + yb2 * (1.0 + 18.0 * ln2)) - 2.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb4 * (406.0 - 372.0 * ln2) + yb2 * (1.0 + 186.0 * ln2) + yb6 * (221.0 + 186.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - xb4 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + log(512.0))) - xb8 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + log(512.0))))
-                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (48.0 - 36.0 * yb + 56.0 * yb3 + 492.0 * yb5 + yb4 * (1624.0 - 258.0 * ln2) + yb2 * (4.0 + 129.0 * ln2) + yb6 * (884.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + log(8.0)) + 3.0 * yb2 * (-24.0 + log(32.0))) + 4.0 * xb10 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + log(8.0)) + 3.0 * yb2 * (-24.0 + log(32.0))) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + log(2048.0)) - yb * (2.0 + log(2048.0))) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + log(2048.0)) - yb * (2.0 + log(2048.0))))
-                 + tb * xb2 * (4.0 * xb6 * (30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 + yb4 * (948.0 - 1488.0 * ln2) + yb2 * (39.0 + 744.0 * ln2) + yb6 * (583.0 + 744.0 * ln2)) + xb4 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) + xb8 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) - 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 8.0 * ln2) + yb2 * (1.0 + ln256)) - 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 8.0 * ln2) + yb2 * (1.0 + ln256)) + 2.0 * xb2 * (-6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + log(4096.0)))
-                   + 2.0 * xb10 * (-6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + log(4096.0)))));
-            const complex<double> logs8 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-2.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb4 * (406.0 - 372.0 * ln2) + yb2 * (1.0 + 186.0 * ln2) + yb6 * (221.0 + 186.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb12 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) - xb4 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + log(512.0))) - xb8 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + log(512.0))) - 3.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb2 * (1.0 + 18.0 * ln2) + 2.0 * yb * (-1.0 + log(512.0))) - 3.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb2 * (1.0 + 18.0 * ln2) + 2.0 * yb * (-1.0 + log(512.0))))
-                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (48.0 + 36.0 * yb - 56.0 * yb3 - 492.0 * yb5 + yb4 * (1624.0 - 258.0 * ln2) + yb2 * (4.0 + 129.0 * ln2) + yb6 * (884.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + xb16 * yb2 * (-6.0 * yb2 * ln2 + log(8.0) + yb4 * log(8.0)) + 4.0 * xb6 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + log(8.0)) + 3.0 * yb2 * (-24.0 + log(32.0))) + 4.0 * xb10 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + log(8.0)) + 3.0 * yb2 * (-24.0 + log(32.0))) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + log(2048.0)) + yb * (2.0 + log(2048.0))) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + log(2048.0)) + yb * (2.0 + log(2048.0))))
-                 + vb * xb2 * (-4.0 * xb6 * (30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 + yb4 * (948.0 - 1488.0 * ln2) + yb2 * (39.0 + 744.0 * ln2) + yb6 * (583.0 + 744.0 * ln2)) - xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) - xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + ln256) + yb2 * (1.0 + ln256)) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + ln256) + yb2 * (1.0 + ln256)) - 2.0 * xb2 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + log(4096.0)))
-                   - 2.0 * xb10 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + log(4096.0)))));
+            const complex<double> logs3 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (2.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb2 * (1.0 - 186.0 * ln2) + yb6 * (221.0 - 186.0 * ln2) + yb4 * (406.0 + 372.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - 3.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) + 2.0 * yb * (1.0 + c_ln_5)) - 3.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) + 2.0 * yb * (1.0 + c_ln_5)) + xb4 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + c_ln_5)) + xb8 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + c_ln_5)))
+                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (-48.0 - 36.0 * yb + 56.0 * yb3 + 492.0 * yb5 + yb6 * (-884.0 + 129.0 * ln2) + yb2 * (-4.0 + 129.0 * ln2) - 2.0 * yb4 * (812.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (-12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + c_ln_1) + 3.0 * yb2 * (24.0 + c_ln_2)) + 4.0 * xb10 * (-12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + c_ln_1) + 3.0 * yb2 * (24.0 + c_ln_2)) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_41) + yb2 * (1.0 + c_ln_41)) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_41) + yb2 * (1.0 + c_ln_41)))
+                 + vb * xb2 * (-4.0 * xb6 * (-30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 - 12.0 * yb4 * (79.0 + 124.0 * ln2) + yb6 * (-583.0 + 744.0 * ln2) + yb2 * (-39.0 + 744.0 * ln2)) + xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (515.0 - 1944.0 * ln2) - yb2 * (425.0 + 1944.0 * ln2) + yb4 * (2422.0 + 3888.0 * ln2)) + xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (515.0 - 1944.0 * ln2) - yb2 * (425.0 + 1944.0 * ln2) + yb4 * (2422.0 + 3888.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + ln256) + yb * (2.0 + ln256)) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + ln256) + yb * (2.0 + ln256)) - 2.0 * xb2 * (6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + c_ln_6))
+                   - 2.0 * xb10 * (6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + c_ln_6))));
+            const complex<double> logs4 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (2.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb2 * (1.0 - 186.0 * ln2) + yb6 * (221.0 - 186.0 * ln2) + yb4 * (406.0 + 372.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - 3.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) - 2.0 * yb * (1.0 + c_ln_5)) - 3.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + 18.0 * ln2) - 2.0 * yb * (1.0 + c_ln_5)) + xb4 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + c_ln_5)) + xb8 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + yb6 * (160.0 - 243.0 * ln2) - 9.0 * yb2 * (8.0 + 27.0 * ln2) + 54.0 * yb4 * (10.0 + c_ln_5)))
+                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (-48.0 + 36.0 * yb - 56.0 * yb3 - 492.0 * yb5 + yb6 * (-884.0 + 129.0 * ln2) + yb2 * (-4.0 + 129.0 * ln2) - 2.0 * yb4 * (812.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (-12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + c_ln_1) + 3.0 * yb2 * (24.0 + c_ln_2)) + 4.0 * xb10 * (-12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (18.0 + ln2) + 5.0 * yb6 * (-32.0 + c_ln_1) + 3.0 * yb2 * (24.0 + c_ln_2)) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 11.0 * ln2) + yb2 * (1.0 + c_ln_41)) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 11.0 * ln2) + yb2 * (1.0 + c_ln_41)))
+                 + tb * xb2 * (4.0 * xb6 * (-30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 - 12.0 * yb4 * (79.0 + 124.0 * ln2) + yb6 * (-583.0 + 744.0 * ln2) + yb2 * (-39.0 + 744.0 * ln2)) + xb4 * (-48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (-515.0 + 1944.0 * ln2) + yb2 * (425.0 + 1944.0 * ln2) - 2.0 * yb4 * (1211.0 + 1944.0 * ln2)) + xb8 * (-48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb6 * (-515.0 + 1944.0 * ln2) + yb2 * (425.0 + 1944.0 * ln2) - 2.0 * yb4 * (1211.0 + 1944.0 * ln2)) - 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256)) - 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256)) + 2.0 * xb2 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + c_ln_6))
+                   + 2.0 * xb10 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (-1.0 + 24.0 * ln2) + yb6 * (71.0 + 216.0 * ln2) - 36.0 * yb4 * (-7.0 + c_ln_6))));
+            const complex<double> logs5 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-4.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb4 * (406.0 - 186.0 * ln2) + yb2 * (1.0 + 93.0 * ln2) + yb6 * (221.0 + 93.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - xb4 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + c_ln_5)) - xb8 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + c_ln_5)) - 6.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 9.0 * ln2) + yb2 * (1.0 + c_ln_5)) - 6.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 9.0 * ln2) + yb2 * (1.0 + c_ln_5)))
+                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (96.0 - 72.0 * yb + 112.0 * yb3 + 984.0 * yb5 + yb4 * (3248.0 - 258.0 * ln2) + yb2 * (8.0 + 129.0 * ln2) + yb6 * (1768.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + c_ln_1) + 3.0 * yb2 * (-48.0 + c_ln_2)) + 4.0 * xb10 * (24.0 - 24.0 * yb + 16.0 * yb3 + 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + c_ln_1) + 3.0 * yb2 * (-48.0 + c_ln_2)) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-2.0 + yb2 * (-2.0 + c_ln_41) - yb * (4.0 + c_ln_41)) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-2.0 + yb2 * (-2.0 + c_ln_41) - yb * (4.0 + c_ln_41)))
+                 - 2.0 * tb * xb2 * (-4.0 * xb6 * (30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 + yb4 * (948.0 - 744.0 * ln2) + yb2 * (39.0 + 372.0 * ln2) + yb6 * (583.0 + 372.0 * ln2)) - xb4 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) - xb8 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) + 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4)) + 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4)) + 2.0 * xb2 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (71.0 - 108.0 * ln2) + 36.0 * yb4 * (7.0 + ln64) - 9.0 * yb2 * (1.0 + c_ln_6)) + 2.0 * xb10 * (6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (71.0 - 108.0 * ln2) + 36.0 * yb4 * (7.0 + ln64) - 9.0 * yb2 * (1.0 + c_ln_6))));
+            const complex<double> logs6 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-4.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb4 * (406.0 - 186.0 * ln2) + yb2 * (1.0 + 93.0 * ln2) + yb6 * (221.0 + 93.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - xb4 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + c_ln_5)) - xb8 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 + 9.0 * yb2 * (-16.0 + 27.0 * ln2) + yb6 * (320.0 + 243.0 * ln2) - 54.0 * yb4 * (-20.0 + c_ln_5)) - 6.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_5) + yb2 * (1.0 + c_ln_5)) - 6.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_5) + yb2 * (1.0 + c_ln_5)))
+                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (96.0 + 72.0 * yb - 112.0 * yb3 - 984.0 * yb5 + yb4 * (3248.0 - 258.0 * ln2) + yb2 * (8.0 + 129.0 * ln2) + yb6 * (1768.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + c_ln_1) + 3.0 * yb2 * (-48.0 + c_ln_2)) + 4.0 * xb10 * (24.0 + 24.0 * yb - 16.0 * yb3 - 264.0 * yb5 - 30.0 * yb4 * (-36.0 + ln2) + 5.0 * yb6 * (64.0 + c_ln_1) + 3.0 * yb2 * (-48.0 + c_ln_2)) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-2.0 + yb2 * (-2.0 + c_ln_41) + yb * (4.0 + c_ln_41)) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-2.0 + yb2 * (-2.0 + c_ln_41) + yb * (4.0 + c_ln_41)))
+                 + 2.0 * vb * xb2 * (-4.0 * xb6 * (30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 + yb4 * (948.0 - 744.0 * ln2) + yb2 * (39.0 + 372.0 * ln2) + yb6 * (583.0 + 372.0 * ln2)) - xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) - xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 1944.0 * ln2) + yb2 * (-425.0 + 972.0 * ln2) + yb6 * (515.0 + 972.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4)) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4)) - 2.0 * xb2 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (-71.0 + 108.0 * ln2) - 36.0 * yb4 * (7.0 + ln64) + 9.0 * yb2 * (1.0 + c_ln_6))
+                   - 2.0 * xb10 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + yb6 * (-71.0 + 108.0 * ln2) - 36.0 * yb4 * (7.0 + ln64) + 9.0 * yb2 * (1.0 + c_ln_6))));
+            const complex<double> logs7 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-3.0 * xb2 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 18.0 * ln2) + yb2 * (1.0 + 18.0 * ln2)) - 3.0 * xb10 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 18.0 * ln2) + yb2 * (1.0 + 18.0 * ln2)) - 2.0 * xb6 * (12.0 - 9.0 * yb + 14.0 * yb3 + 123.0 * yb5 + yb4 * (406.0 - 372.0 * ln2) + yb2 * (1.0 + 186.0 * ln2) + yb6 * (221.0 + 186.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - xb4 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + c_ln_5)) - xb8 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + c_ln_5)))
+                 + power_of<2>(tb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (48.0 - 36.0 * yb + 56.0 * yb3 + 492.0 * yb5 + yb4 * (1624.0 - 258.0 * ln2) + yb2 * (4.0 + 129.0 * ln2) + yb6 * (884.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + c_ln_1) + 3.0 * yb2 * (-24.0 + c_ln_2)) + 4.0 * xb10 * (12.0 - 12.0 * yb + 8.0 * yb3 + 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + c_ln_1) + 3.0 * yb2 * (-24.0 + c_ln_2)) - 12.0 * xb4 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + c_ln_41) - yb * (2.0 + c_ln_41)) - 12.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (-1.0 + yb2 * (-1.0 + c_ln_41) - yb * (2.0 + c_ln_41)))
+                 + tb * xb2 * (4.0 * xb6 * (30.0 - 21.0 * yb + 38.0 * yb3 + 303.0 * yb5 + yb4 * (948.0 - 1488.0 * ln2) + yb2 * (39.0 + 744.0 * ln2) + yb6 * (583.0 + 744.0 * ln2)) + xb4 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) + xb8 * (48.0 - 51.0 * yb + 26.0 * yb3 + 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) - 3.0 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 8.0 * ln2) + yb2 * (1.0 + ln256)) - 3.0 * xb12 * (-1.0 + yb) * yb * power_of<2>(1.0 + yb) * (1.0 + yb * (2.0 - 8.0 * ln2) + yb2 * (1.0 + ln256)) + 2.0 * xb2 * (-6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + c_ln_6))
+                   + 2.0 * xb10 * (-6.0 - 3.0 * yb - 22.0 * yb3 - 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + c_ln_6))));
+            const complex<double> logs8 = (-1.0 + yb) * (1.0 + yb) * (-4.0 * xb2 * (-2.0 * xb6 * (12.0 + 9.0 * yb - 14.0 * yb3 - 123.0 * yb5 + yb4 * (406.0 - 372.0 * ln2) + yb2 * (1.0 + 186.0 * ln2) + yb6 * (221.0 + 186.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb12 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) - xb4 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + c_ln_5)) - xb8 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 + 9.0 * yb2 * (-8.0 + 27.0 * ln2) + yb6 * (160.0 + 243.0 * ln2) - 54.0 * yb4 * (-10.0 + c_ln_5)) - 3.0 * xb2 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb2 * (1.0 + 18.0 * ln2) + 2.0 * yb * (-1.0 + c_ln_5)) - 3.0 * xb10 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb2 * (1.0 + 18.0 * ln2) + 2.0 * yb * (-1.0 + c_ln_5)))
+                 + power_of<2>(vb) * (-60.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * ln2 - 60.0 * xb14 * yb2 * power_of<2>(-1.0 + yb2) * ln2 + 2.0 * xb8 * (48.0 + 36.0 * yb - 56.0 * yb3 - 492.0 * yb5 + yb4 * (1624.0 - 258.0 * ln2) + yb2 * (4.0 + 129.0 * ln2) + yb6 * (884.0 + 129.0 * ln2)) + yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + xb16 * yb2 * (-6.0 * yb2 * ln2 + c_ln_1 + yb4 * c_ln_1) + 4.0 * xb6 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + c_ln_1) + 3.0 * yb2 * (-24.0 + c_ln_2)) + 4.0 * xb10 * (12.0 + 12.0 * yb - 8.0 * yb3 - 132.0 * yb5 - 30.0 * yb4 * (-18.0 + ln2) + 5.0 * yb6 * (32.0 + c_ln_1) + 3.0 * yb2 * (-24.0 + c_ln_2)) - 12.0 * xb4 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + c_ln_41) + yb * (2.0 + c_ln_41)) - 12.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (-1.0 + yb2 * (-1.0 + c_ln_41) + yb * (2.0 + c_ln_41)))
+                 + vb * xb2 * (-4.0 * xb6 * (30.0 + 21.0 * yb - 38.0 * yb3 - 303.0 * yb5 + yb4 * (948.0 - 1488.0 * ln2) + yb2 * (39.0 + 744.0 * ln2) + yb6 * (583.0 + 744.0 * ln2)) - xb4 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) - xb8 * (48.0 + 51.0 * yb - 26.0 * yb3 - 537.0 * yb5 + yb4 * (2422.0 - 3888.0 * ln2) + yb2 * (-425.0 + 1944.0 * ln2) + yb6 * (515.0 + 1944.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + ln256) + yb2 * (1.0 + ln256)) + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb * (1.0 + yb) * (1.0 + yb * (-2.0 + ln256) + yb2 * (1.0 + ln256)) - 2.0 * xb2 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + c_ln_6))
+                   - 2.0 * xb10 * (-6.0 + 3.0 * yb + 22.0 * yb3 + 39.0 * yb5 + 9.0 * yb2 * (1.0 + 24.0 * ln2) + yb6 * (-71.0 + 216.0 * ln2) - 36.0 * yb4 * (7.0 + c_ln_6))));
             const complex<double> logs9 = power_of<2>(1.0i + xb) * (-1.0 + yb) * (1.0 + yb) * (power_of<2>(tb) * (power_of<2>(vb) * power_of<2>(-1.0 + xb2) * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 + 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 4.0 * 1.0i * xb3 * (2.0 + 37.0 * ln2 + yb2 * (6.0 + 67.0 * ln2) + yb6 * (-54.0 + 733.0 * ln2) + yb4 * (-18.0 + 2587.0 * ln2)) - 4.0 * 1.0i * xb11 * (2.0 + 37.0 * ln2 + yb2 * (6.0 + 67.0 * ln2) + yb6 * (-54.0 + 733.0 * ln2) + yb4 * (-18.0 + 2587.0 * ln2)) + xb6 * (8.0 + 339.0 * ln2 + yb2 * (-168.0 + 1045.0 * ln2) + 3.0 * yb6 * (-648.0 + 1529.0 * ln2) + yb4 * (-1224.0 + 3661.0 * ln2)) - xb8 * (8.0 + 339.0 * ln2 + yb2 * (-168.0 + 1045.0 * ln2) + 3.0 * yb6 * (-648.0 + 1529.0 * ln2) + yb4 * (-1224.0 + 3661.0 * ln2))
-                     + 8.0 * 1.0i * xb7 * (2.0 + 229.0 * ln2 + 13.0 * yb2 * (-2.0 + 15.0 * ln2) + 3.0 * yb4 * (-70.0 + 2377.0 * ln2) + yb6 * (-342.0 + 4061.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 + 3.0 * yb2 * (4.0 + 133.0 * ln2) + yb4 * (-36.0 + 375.0 * ln2) - 3.0 * yb6 * (36.0 + log(32.0))) + xb2 * (-4.0 + yb4 * (36.0 - 375.0 * ln2) + 23.0 * ln2 - 3.0 * yb2 * (4.0 + 133.0 * ln2) + 3.0 * yb6 * (36.0 + log(32.0))))
+                     + 8.0 * 1.0i * xb7 * (2.0 + 229.0 * ln2 + 13.0 * yb2 * (-2.0 + 15.0 * ln2) + 3.0 * yb4 * (-70.0 + 2377.0 * ln2) + yb6 * (-342.0 + 4061.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 + 3.0 * yb2 * (4.0 + 133.0 * ln2) + yb4 * (-36.0 + 375.0 * ln2) - 3.0 * yb6 * (36.0 + c_ln_2)) + xb2 * (-4.0 + yb4 * (36.0 - 375.0 * ln2) + 23.0 * ln2 - 3.0 * yb2 * (4.0 + 133.0 * ln2) + 3.0 * yb6 * (36.0 + c_ln_2)))
                    + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb12 * (4.0 - 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 115.0 * ln2) - 3.0 * yb4 * (12.0 + 191.0 * ln2) - yb6 * (108.0 + 269.0 * ln2)) + xb2 * (-4.0 + 47.0 * ln2 - 42.0 * yb * ln2 - 148.0 * yb3 * ln2 - 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb6 * (-8.0 - 99.0 * ln2 + 114.0 * yb * ln2 - 412.0 * yb3 * ln2 - 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2))
                      + xb8 * (-8.0 - 99.0 * ln2 + 114.0 * yb * ln2 - 412.0 * yb3 * ln2 - 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) - 4.0 * 1.0i * xb3 * (2.0 + 25.0 * ln2 + 18.0 * yb * ln2 + 68.0 * yb3 * ln2 + 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) - 4.0 * 1.0i * xb11 * (2.0 + 25.0 * ln2 + 18.0 * yb * ln2 + 68.0 * yb3 * ln2 + 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) + 8.0 * 1.0i * xb7 * (2.0 + 121.0 * ln2 - 78.0 * yb * ln2 + 132.0 * yb3 * ln2 + 1098.0 * yb5 * ln2 + yb2 * (-26.0 + 113.0 * ln2) + yb6 * (-342.0 + 2011.0 * ln2) + yb4 * (-210.0 + 3611.0 * ln2))
-                     + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * log(8.0) + xb14 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * log(8.0))
+                     + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * c_ln_1 + xb14 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * c_ln_1)
                      + yb * ln64) - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 + 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + xb6 * (8.0 + 147.0 * ln2 - 96.0 * yb * ln2 + 320.0 * yb3 * ln2 + 1824.0 * yb5 * ln2 + 3.0 * yb6 * (-648.0 + 25.0 * ln2) - yb2 * (168.0 + 139.0 * ln2) - yb4 * (1224.0 + 691.0 * ln2)) + xb8 * (-8.0 + yb6 * (1944.0 - 75.0 * ln2) - 147.0 * ln2 + 96.0 * yb * ln2 - 320.0 * yb3 * ln2 - 1824.0 * yb5 * ln2 + yb2 * (168.0 + 139.0 * ln2) + yb4 * (1224.0 + 691.0 * ln2)) - 4.0 * 1.0i * xb3 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 + 24.0 * yb * ln2 + 48.0 * yb3 * ln2 - 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2))
                      - 4.0 * 1.0i * xb11 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 + 24.0 * yb * ln2 + 48.0 * yb3 * ln2 - 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) + 8.0 * 1.0i * xb7 * (2.0 + 133.0 * ln2 - 72.0 * yb * ln2 + 112.0 * yb3 * ln2 + 984.0 * yb5 * ln2 + yb2 * (-26.0 + 187.0 * ln2) + yb6 * (-342.0 + 2293.0 * ln2) + yb4 * (-210.0 + 3883.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 - 144.0 * yb * ln2 + 224.0 * yb3 * ln2 + 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 - 144.0 * yb * ln2 + 224.0 * yb3 * ln2 + 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2))
-                     + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - xb2 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0))) + xb12 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0)))))
+                     + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - xb2 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41)) + xb12 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41))))
                  - 4.0 * xb2 * (power_of<2>(vb) * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 + 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + xb2 * (-4.0 + yb4 * (36.0 - 471.0 * ln2) + yb6 * (108.0 - 33.0 * ln2) + 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 85.0 * ln2)) + xb6 * (8.0 + 147.0 * ln2 + 96.0 * yb * ln2 - 320.0 * yb3 * ln2 - 1824.0 * yb5 * ln2 + 3.0 * yb6 * (-648.0 + 25.0 * ln2) - yb2 * (168.0 + 139.0 * ln2) - yb4 * (1224.0 + 691.0 * ln2)) + xb8 * (-8.0 + yb6 * (1944.0 - 75.0 * ln2) - 147.0 * ln2 - 96.0 * yb * ln2 + 320.0 * yb3 * ln2 + 1824.0 * yb5 * ln2 + yb2 * (168.0 + 139.0 * ln2) + yb4 * (1224.0 + 691.0 * ln2))
                      - 4.0 * 1.0i * xb3 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 - 24.0 * yb * ln2 - 48.0 * yb3 * ln2 + 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) - 4.0 * 1.0i * xb11 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 - 24.0 * yb * ln2 - 48.0 * yb3 * ln2 + 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) + 8.0 * 1.0i * xb7 * (2.0 + 133.0 * ln2 + 72.0 * yb * ln2 - 112.0 * yb3 * ln2 - 984.0 * yb5 * ln2 + yb2 * (-26.0 + 187.0 * ln2) + yb6 * (-342.0 + 2293.0 * ln2) + yb4 * (-210.0 + 3883.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2))
-                     - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 - 48.0 * yb * ln2 - 96.0 * yb3 * ln2 + 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0))))
-                   - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb10 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 + 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - xb2 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + xb8 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) - 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) - 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) - 4.0 * 1.0i * xb5 * (4.0 + 75.0 * ln2 + 3.0 * yb4 * (-76.0 + 1127.0 * ln2) + yb6 * (-396.0 + 1267.0 * ln2) + 5.0 * yb2 * (-4.0 + log(512.0)))
-                     + 2.0 * xb4 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + log(2048.0)) - 2.0 * xb6 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + log(2048.0))) + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb8 * (4.0 - 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 - 9.0 * yb4 * (4.0 + 63.0 * ln2) + 3.0 * yb2 * (4.0 + 73.0 * ln2) - yb6 * (108.0 + 215.0 * ln2)) + xb2 * (-4.0 + 45.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2))
-                     - 4.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - yb6 * log(8.0) + xb10 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * log(8.0)) + yb * ln64 + 2.0 * xb4 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 2.0 * xb6 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * log(16.0) + log(8192.0))
-                     - 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * log(16.0) + log(8192.0)))) - 8.0 * tb * xb2 * (power_of<2>(vb) * (-ln2 - 6.0 * yb * ln2 - 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + 2.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + xb2 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb12 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2))
+                     - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 - 48.0 * yb * ln2 - 96.0 * yb3 * ln2 + 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41)))
+                   - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb10 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 + 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - xb2 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + xb8 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) - 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) - 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) - 4.0 * 1.0i * xb5 * (4.0 + 75.0 * ln2 + 3.0 * yb4 * (-76.0 + 1127.0 * ln2) + yb6 * (-396.0 + 1267.0 * ln2) + 5.0 * yb2 * (-4.0 + c_ln_5))
+                     + 2.0 * xb4 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + c_ln_41) - 2.0 * xb6 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + c_ln_41)) + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb8 * (4.0 - 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 - 9.0 * yb4 * (4.0 + 63.0 * ln2) + 3.0 * yb2 * (4.0 + 73.0 * ln2) - yb6 * (108.0 + 215.0 * ln2)) + xb2 * (-4.0 + 45.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2))
+                     - 4.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - yb6 * c_ln_1 + xb10 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * c_ln_1) + yb * ln64 + 2.0 * xb4 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 2.0 * xb6 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * c_ln_4 + c_ln_42)
+                     - 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * c_ln_4 + c_ln_42))) - 8.0 * tb * xb2 * (power_of<2>(vb) * (-ln2 - 6.0 * yb * ln2 - 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + 2.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + 2.0 * 1.0i * xb13 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + xb2 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb12 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2))
                      - xb6 * (-8.0 - 99.0 * ln2 - 114.0 * yb * ln2 + 412.0 * yb3 * ln2 + 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) + xb8 * (-8.0 - 99.0 * ln2 - 114.0 * yb * ln2 + 412.0 * yb3 * ln2 + 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) - 4.0 * 1.0i * xb3 * (2.0 + 25.0 * ln2 - 18.0 * yb * ln2 - 68.0 * yb3 * ln2 - 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) - 4.0 * 1.0i * xb11 * (2.0 + 25.0 * ln2 - 18.0 * yb * ln2 - 68.0 * yb3 * ln2 - 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2))
                      + 8.0 * 1.0i * xb7 * (2.0 + 121.0 * ln2 + 78.0 * yb * ln2 - 132.0 * yb3 * ln2 - 1098.0 * yb5 * ln2 + yb2 * (-26.0 + 113.0 * ln2) + yb6 * (-342.0 + 2011.0 * ln2) + yb4 * (-210.0 + 3611.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 + 162.0 * yb * ln2 - 252.0 * yb3 * ln2 - 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 + 162.0 * yb * ln2 - 252.0 * yb3 * ln2 - 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) + 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2))
-                     + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * log(8.0) + xb14 * (ln2 + 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + yb6 * log(8.0) + yb * ln64)) - 8.0 * vb * xb2 * (ln2 + 27.0 * yb2 * ln2 - 57.0 * yb4 * ln2 - 2.0 * 1.0i * xb * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - xb2 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) + xb8 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) - 2.0 * xb4 * (-2.0 + 35.0 * ln2 + 9.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (26.0 + 353.0 * ln2) + yb4 * (210.0 + 1301.0 * ln2))
-                     + 4.0 * 1.0i * xb5 * (4.0 + 27.0 * ln2 + yb2 * (-20.0 + 41.0 * ln2) + yb6 * (-396.0 + 383.0 * ln2) + yb4 * (-228.0 + 1757.0 * ln2)) + xb6 * (-4.0 + 70.0 * ln2 + 18.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (52.0 + 706.0 * ln2) + yb4 * (420.0 + 2602.0 * ln2)) - yb6 * log(8.0) + xb10 * (-ln2 - 27.0 * yb2 * ln2 + 57.0 * yb4 * ln2 + yb6 * log(8.0)) + 8.0 * 1.0i * xb3 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + log(32.0)) + log(128.0)) + 8.0 * 1.0i * xb7 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + log(32.0)) + log(128.0)))
+                     + 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * c_ln_1 + xb14 * (ln2 + 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + yb6 * c_ln_1 + yb * ln64)) - 8.0 * vb * xb2 * (ln2 + 27.0 * yb2 * ln2 - 57.0 * yb4 * ln2 - 2.0 * 1.0i * xb * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - xb2 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) + xb8 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) - 2.0 * xb4 * (-2.0 + 35.0 * ln2 + 9.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (26.0 + 353.0 * ln2) + yb4 * (210.0 + 1301.0 * ln2))
+                     + 4.0 * 1.0i * xb5 * (4.0 + 27.0 * ln2 + yb2 * (-20.0 + 41.0 * ln2) + yb6 * (-396.0 + 383.0 * ln2) + yb4 * (-228.0 + 1757.0 * ln2)) + xb6 * (-4.0 + 70.0 * ln2 + 18.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (52.0 + 706.0 * ln2) + yb4 * (420.0 + 2602.0 * ln2)) - yb6 * c_ln_1 + xb10 * (-ln2 - 27.0 * yb2 * ln2 + 57.0 * yb4 * ln2 + yb6 * c_ln_1) + 8.0 * 1.0i * xb3 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + c_ln_2) + c_ln_3) + 8.0 * 1.0i * xb7 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + c_ln_2) + c_ln_3))
                    + xb2 * (24.0 * yb * ln2 + 36.0 * yb2 * ln2 + 48.0 * yb3 * ln2 - 180.0 * yb4 * ln2 - 72.0 * yb5 * ln2 + 12.0 * yb6 * ln2 - 4.0 * xb10 * (1.0 + 6.0 * yb + 9.0 * yb2 + 12.0 * yb3 - 45.0 * yb4 - 18.0 * yb5 + 3.0 * yb6) * ln2 - 8.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 - 8.0 * 1.0i * xb9 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 - 4.0 * xb2 * (-4.0 + 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2)) + 4.0 * xb8 * (-4.0 + 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2))
-                     - 8.0 * xb4 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 8.0 * xb6 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 16.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) + log(16.0) + 32.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + log(8192.0))
-                     + 32.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + log(8192.0)))));
+                     - 8.0 * xb4 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 8.0 * xb6 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 16.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) + c_ln_4 + 32.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + c_ln_42)
+                     + 32.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + c_ln_42))));
             const complex<double> logs10 = power_of<2>(-1.0i + xb) * (-1.0 + yb) * (1.0 + yb) * (power_of<2>(tb) * (power_of<2>(vb) * power_of<2>(-1.0 + xb2) * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 - 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + 4.0 * 1.0i * xb3 * (2.0 + 37.0 * ln2 + yb2 * (6.0 + 67.0 * ln2) + yb6 * (-54.0 + 733.0 * ln2) + yb4 * (-18.0 + 2587.0 * ln2)) + 4.0 * 1.0i * xb11 * (2.0 + 37.0 * ln2 + yb2 * (6.0 + 67.0 * ln2) + yb6 * (-54.0 + 733.0 * ln2) + yb4 * (-18.0 + 2587.0 * ln2)) + xb6 * (8.0 + 339.0 * ln2 + yb2 * (-168.0 + 1045.0 * ln2) + 3.0 * yb6 * (-648.0 + 1529.0 * ln2) + yb4 * (-1224.0 + 3661.0 * ln2)) - xb8 * (8.0 + 339.0 * ln2 + yb2 * (-168.0 + 1045.0 * ln2) + 3.0 * yb6 * (-648.0 + 1529.0 * ln2) + yb4 * (-1224.0 + 3661.0 * ln2))
-                     - 8.0 * 1.0i * xb7 * (2.0 + 229.0 * ln2 + 13.0 * yb2 * (-2.0 + 15.0 * ln2) + 3.0 * yb4 * (-70.0 + 2377.0 * ln2) + yb6 * (-342.0 + 4061.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 + 3.0 * yb2 * (4.0 + 133.0 * ln2) + yb4 * (-36.0 + 375.0 * ln2) - 3.0 * yb6 * (36.0 + log(32.0))) + xb2 * (-4.0 + yb4 * (36.0 - 375.0 * ln2) + 23.0 * ln2 - 3.0 * yb2 * (4.0 + 133.0 * ln2) + 3.0 * yb6 * (36.0 + log(32.0))))
+                     - 8.0 * 1.0i * xb7 * (2.0 + 229.0 * ln2 + 13.0 * yb2 * (-2.0 + 15.0 * ln2) + 3.0 * yb4 * (-70.0 + 2377.0 * ln2) + yb6 * (-342.0 + 4061.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 1411.0 * ln2) + 363.0 * ln2 + yb6 * (468.0 + 6659.0 * ln2) + yb4 * (348.0 + 19637.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 2873.0 * ln2) + 385.0 * ln2 + yb6 * (576.0 + 5593.0 * ln2) + yb4 * (384.0 + 21439.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 + 3.0 * yb2 * (4.0 + 133.0 * ln2) + yb4 * (-36.0 + 375.0 * ln2) - 3.0 * yb6 * (36.0 + c_ln_2)) + xb2 * (-4.0 + yb4 * (36.0 - 375.0 * ln2) + 23.0 * ln2 - 3.0 * yb2 * (4.0 + 133.0 * ln2) + 3.0 * yb6 * (36.0 + c_ln_2)))
                    + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 - 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb12 * (4.0 - 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 115.0 * ln2) - 3.0 * yb4 * (12.0 + 191.0 * ln2) - yb6 * (108.0 + 269.0 * ln2)) + xb2 * (-4.0 + 47.0 * ln2 - 42.0 * yb * ln2 - 148.0 * yb3 * ln2 - 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb6 * (-8.0 - 99.0 * ln2 + 114.0 * yb * ln2 - 412.0 * yb3 * ln2 - 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2))
                      + xb8 * (-8.0 - 99.0 * ln2 + 114.0 * yb * ln2 - 412.0 * yb3 * ln2 - 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) + 4.0 * 1.0i * xb3 * (2.0 + 25.0 * ln2 + 18.0 * yb * ln2 + 68.0 * yb3 * ln2 + 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) + 4.0 * 1.0i * xb11 * (2.0 + 25.0 * ln2 + 18.0 * yb * ln2 + 68.0 * yb3 * ln2 + 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) - 8.0 * 1.0i * xb7 * (2.0 + 121.0 * ln2 - 78.0 * yb * ln2 + 132.0 * yb3 * ln2 + 1098.0 * yb5 * ln2 + yb2 * (-26.0 + 113.0 * ln2) + yb6 * (-342.0 + 2011.0 * ln2) + yb4 * (-210.0 + 3611.0 * ln2))
-                     + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * log(8.0) + xb14 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * log(8.0))
+                     + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 - 162.0 * yb * ln2 + 252.0 * yb3 * ln2 + 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 - 198.0 * yb * ln2 + 116.0 * yb3 * ln2 + 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * c_ln_1 + xb14 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * c_ln_1)
                      + yb * ln64) - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 - 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + xb6 * (8.0 + 147.0 * ln2 - 96.0 * yb * ln2 + 320.0 * yb3 * ln2 + 1824.0 * yb5 * ln2 + 3.0 * yb6 * (-648.0 + 25.0 * ln2) - yb2 * (168.0 + 139.0 * ln2) - yb4 * (1224.0 + 691.0 * ln2)) + xb8 * (-8.0 + yb6 * (1944.0 - 75.0 * ln2) - 147.0 * ln2 + 96.0 * yb * ln2 - 320.0 * yb3 * ln2 - 1824.0 * yb5 * ln2 + yb2 * (168.0 + 139.0 * ln2) + yb4 * (1224.0 + 691.0 * ln2)) + 4.0 * 1.0i * xb3 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 + 24.0 * yb * ln2 + 48.0 * yb3 * ln2 - 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2))
                      + 4.0 * 1.0i * xb11 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 + 24.0 * yb * ln2 + 48.0 * yb3 * ln2 - 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) - 8.0 * 1.0i * xb7 * (2.0 + 133.0 * ln2 - 72.0 * yb * ln2 + 112.0 * yb3 * ln2 + 984.0 * yb5 * ln2 + yb2 * (-26.0 + 187.0 * ln2) + yb6 * (-342.0 + 2293.0 * ln2) + yb4 * (-210.0 + 3883.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 - 144.0 * yb * ln2 + 224.0 * yb3 * ln2 + 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 - 144.0 * yb * ln2 + 224.0 * yb3 * ln2 + 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2))
-                     - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - xb2 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0))) + xb12 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0)))))
+                     - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 - 192.0 * yb * ln2 + 128.0 * yb3 * ln2 + 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - xb2 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41)) + xb12 * (4.0 - 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41))))
                  - 4.0 * xb2 * (power_of<2>(vb) * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb14 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 - 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 + xb2 * (-4.0 + yb4 * (36.0 - 471.0 * ln2) + yb6 * (108.0 - 33.0 * ln2) + 23.0 * ln2 + 48.0 * yb * ln2 + 96.0 * yb3 * ln2 - 144.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 85.0 * ln2)) + xb6 * (8.0 + 147.0 * ln2 + 96.0 * yb * ln2 - 320.0 * yb3 * ln2 - 1824.0 * yb5 * ln2 + 3.0 * yb6 * (-648.0 + 25.0 * ln2) - yb2 * (168.0 + 139.0 * ln2) - yb4 * (1224.0 + 691.0 * ln2)) + xb8 * (-8.0 + yb6 * (1944.0 - 75.0 * ln2) - 147.0 * ln2 - 96.0 * yb * ln2 + 320.0 * yb3 * ln2 + 1824.0 * yb5 * ln2 + yb2 * (168.0 + 139.0 * ln2) + yb4 * (1224.0 + 691.0 * ln2))
                      + 4.0 * 1.0i * xb3 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 - 24.0 * yb * ln2 - 48.0 * yb3 * ln2 + 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) + 4.0 * 1.0i * xb11 * (2.0 + yb2 * (6.0 - 5.0 * ln2) + 37.0 * ln2 - 24.0 * yb * ln2 - 48.0 * yb3 * ln2 + 72.0 * yb5 * ln2 + yb6 * (-54.0 + 757.0 * ln2) + yb4 * (-18.0 + 2635.0 * ln2)) - 8.0 * 1.0i * xb7 * (2.0 + 133.0 * ln2 + 72.0 * yb * ln2 - 112.0 * yb3 * ln2 - 984.0 * yb5 * ln2 + yb2 * (-26.0 + 187.0 * ln2) + yb6 * (-342.0 + 2293.0 * ln2) + yb4 * (-210.0 + 3883.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2))
-                     - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 - 48.0 * yb * ln2 - 96.0 * yb3 * ln2 + 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + log(2048.0))))
-                   - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb10 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 - 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - xb2 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + xb8 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) + 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) + 4.0 * 1.0i * xb5 * (4.0 + 75.0 * ln2 + 3.0 * yb4 * (-76.0 + 1127.0 * ln2) + yb6 * (-396.0 + 1267.0 * ln2) + 5.0 * yb2 * (-4.0 + log(512.0)))
-                     + 2.0 * xb4 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + log(2048.0)) - 2.0 * xb6 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + log(2048.0))) + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 - 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb8 * (4.0 - 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 - 9.0 * yb4 * (4.0 + 63.0 * ln2) + 3.0 * yb2 * (4.0 + 73.0 * ln2) - yb6 * (108.0 + 215.0 * ln2)) + xb2 * (-4.0 + 45.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2))
-                     + 4.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - yb6 * log(8.0) + xb10 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * log(8.0)) + yb * ln64 + 2.0 * xb4 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 2.0 * xb6 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) + 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * log(16.0) + log(8192.0))
-                     + 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * log(16.0) + log(8192.0)))) - 8.0 * tb * xb2 * (power_of<2>(vb) * (-ln2 - 6.0 * yb * ln2 - 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 - 2.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + xb2 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb12 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2))
+                     - xb10 * (4.0 + yb2 * (76.0 - 403.0 * ln2) + 171.0 * ln2 + 144.0 * yb * ln2 - 224.0 * yb3 * ln2 - 1968.0 * yb5 * ln2 + 13.0 * yb6 * (36.0 + 319.0 * ln2) + yb4 * (348.0 + 11093.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1721.0 * ln2) + 193.0 * ln2 + 192.0 * yb * ln2 - 128.0 * yb3 * ln2 - 2112.0 * yb5 * ln2 + 9.0 * yb6 * (64.0 + 337.0 * ln2) + yb4 * (384.0 + 12799.0 * ln2)) + xb12 * (4.0 - 23.0 * ln2 - 48.0 * yb * ln2 - 96.0 * yb3 * ln2 + 144.0 * yb5 * ln2 + 3.0 * yb2 * (4.0 + 85.0 * ln2) + yb4 * (-36.0 + 471.0 * ln2) + 3.0 * yb6 * (-36.0 + c_ln_41)))
+                   - 4.0 * xb2 * ((-1.0 + 9.0 * yb2 + 33.0 * yb4 - 9.0 * yb6) * ln2 + xb10 * (1.0 - 9.0 * yb2 - 33.0 * yb4 + 9.0 * yb6) * ln2 - 2.0 * 1.0i * xb * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 57.0 * yb2 - 63.0 * yb4 + 39.0 * yb6) * ln2 - xb2 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + xb8 * (1.0 + 3.0 * yb2) * (4.0 - 21.0 * ln2 + 156.0 * yb2 * ln2 + yb4 * (-36.0 + 33.0 * ln2)) + 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) + 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 67.0 * ln2) + 19.0 * ln2 + yb6 * (-27.0 + 371.0 * ln2) + yb4 * (-9.0 + 1373.0 * ln2)) + 4.0 * 1.0i * xb5 * (4.0 + 75.0 * ln2 + 3.0 * yb4 * (-76.0 + 1127.0 * ln2) + yb6 * (-396.0 + 1267.0 * ln2) + 5.0 * yb2 * (-4.0 + c_ln_5))
+                     + 2.0 * xb4 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + c_ln_41) - 2.0 * xb6 * (1.0 + 3.0 * yb2) * (-2.0 + 4.0 * yb2 * (8.0 + 43.0 * ln2) + yb4 * (114.0 + 241.0 * ln2) + c_ln_41)) + 8.0 * vb * xb2 * (-ln2 - 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 - 2.0 * 1.0i * xb * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 - 2.0 * 1.0i * xb9 * (-1.0 + 6.0 * yb + 39.0 * yb2 + 12.0 * yb3 - 51.0 * yb4 - 18.0 * yb5 + 45.0 * yb6) * ln2 + xb8 * (4.0 - 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 - 9.0 * yb4 * (4.0 + 63.0 * ln2) + 3.0 * yb2 * (4.0 + 73.0 * ln2) - yb6 * (108.0 + 215.0 * ln2)) + xb2 * (-4.0 + 45.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2))
+                     + 4.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - yb6 * c_ln_1 + xb10 * (ln2 - 6.0 * yb * ln2 + 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 + yb6 * c_ln_1) + yb * ln64 + 2.0 * xb4 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) - 2.0 * xb6 * (-2.0 + 23.0 * ln2 - 20.0 * yb3 * ln2 - 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2) + yb * ln64) + 8.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * c_ln_4 + c_ln_42)
+                     + 8.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 6.0 * yb * ln2 + 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb3 * c_ln_4 + c_ln_42))) - 8.0 * tb * xb2 * (power_of<2>(vb) * (-ln2 - 6.0 * yb * ln2 - 9.0 * yb2 * ln2 - 12.0 * yb3 * ln2 + 45.0 * yb4 * ln2 + 18.0 * yb5 * ln2 - 2.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 - 2.0 * 1.0i * xb13 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + xb2 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2)) - xb12 * (-4.0 + 47.0 * ln2 + 42.0 * yb * ln2 + 148.0 * yb3 * ln2 + 66.0 * yb5 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 269.0 * ln2) + yb4 * (36.0 + 573.0 * ln2))
                      - xb6 * (-8.0 - 99.0 * ln2 - 114.0 * yb * ln2 + 412.0 * yb3 * ln2 + 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) + xb8 * (-8.0 - 99.0 * ln2 - 114.0 * yb * ln2 + 412.0 * yb3 * ln2 + 2262.0 * yb5 * ln2 + yb2 * (168.0 + 709.0 * ln2) + yb4 * (1224.0 + 1255.0 * ln2) + yb6 * (1944.0 + 1303.0 * ln2)) + 4.0 * 1.0i * xb3 * (2.0 + 25.0 * ln2 - 18.0 * yb * ln2 - 68.0 * yb3 * ln2 - 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2)) + 4.0 * 1.0i * xb11 * (2.0 + 25.0 * ln2 - 18.0 * yb * ln2 - 68.0 * yb3 * ln2 - 42.0 * yb5 * ln2 + yb2 * (6.0 + 49.0 * ln2) + 9.0 * yb6 * (-6.0 + 67.0 * ln2) + yb4 * (-18.0 + 2107.0 * ln2))
                      - 8.0 * 1.0i * xb7 * (2.0 + 121.0 * ln2 + 78.0 * yb * ln2 - 132.0 * yb3 * ln2 - 1098.0 * yb5 * ln2 + yb2 * (-26.0 + 113.0 * ln2) + yb6 * (-342.0 + 2011.0 * ln2) + yb4 * (-210.0 + 3611.0 * ln2)) + xb4 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 + 162.0 * yb * ln2 - 252.0 * yb3 * ln2 - 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - xb10 * (4.0 + yb2 * (76.0 - 21.0 * ln2) + 147.0 * ln2 + 162.0 * yb * ln2 - 252.0 * yb3 * ln2 - 2214.0 * yb5 * ln2 + yb6 * (468.0 + 4089.0 * ln2) + yb4 * (348.0 + 9513.0 * ln2)) - 2.0 * 1.0i * xb5 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2))
-                     - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * log(8.0) + xb14 * (ln2 + 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + yb6 * log(8.0) + yb * ln64)) - 8.0 * vb * xb2 * (ln2 + 27.0 * yb2 * ln2 - 57.0 * yb4 * ln2 + 2.0 * 1.0i * xb * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - xb2 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) + xb8 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) - 2.0 * xb4 * (-2.0 + 35.0 * ln2 + 9.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (26.0 + 353.0 * ln2) + yb4 * (210.0 + 1301.0 * ln2))
-                     - 4.0 * 1.0i * xb5 * (4.0 + 27.0 * ln2 + yb2 * (-20.0 + 41.0 * ln2) + yb6 * (-396.0 + 383.0 * ln2) + yb4 * (-228.0 + 1757.0 * ln2)) + xb6 * (-4.0 + 70.0 * ln2 + 18.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (52.0 + 706.0 * ln2) + yb4 * (420.0 + 2602.0 * ln2)) - yb6 * log(8.0) + xb10 * (-ln2 - 27.0 * yb2 * ln2 + 57.0 * yb4 * ln2 + yb6 * log(8.0)) - 8.0 * 1.0i * xb3 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + log(32.0)) + log(128.0)) - 8.0 * 1.0i * xb7 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + log(32.0)) + log(128.0)))
+                     - 2.0 * 1.0i * xb9 * (yb2 * (64.0 - 1447.0 * ln2) + 193.0 * ln2 + 198.0 * yb * ln2 - 116.0 * yb3 * ln2 - 2130.0 * yb5 * ln2 + yb6 * (576.0 + 3283.0 * ln2) + yb4 * (384.0 + 12275.0 * ln2)) - yb6 * c_ln_1 + xb14 * (ln2 + 9.0 * yb2 * ln2 + 12.0 * yb3 * ln2 - 45.0 * yb4 * ln2 - 18.0 * yb5 * ln2 + yb6 * c_ln_1 + yb * ln64)) - 8.0 * vb * xb2 * (ln2 + 27.0 * yb2 * ln2 - 57.0 * yb4 * ln2 + 2.0 * 1.0i * xb * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 + 2.0 * 1.0i * xb9 * (-1.0 + 21.0 * yb2 - 39.0 * yb4 + 51.0 * yb6) * ln2 - xb2 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) + xb8 * (-4.0 + 69.0 * ln2 - 3.0 * yb2 * (4.0 + 115.0 * ln2) + yb6 * (108.0 + 529.0 * ln2) + 3.0 * yb4 * (12.0 + 545.0 * ln2)) - 2.0 * xb4 * (-2.0 + 35.0 * ln2 + 9.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (26.0 + 353.0 * ln2) + yb4 * (210.0 + 1301.0 * ln2))
+                     - 4.0 * 1.0i * xb5 * (4.0 + 27.0 * ln2 + yb2 * (-20.0 + 41.0 * ln2) + yb6 * (-396.0 + 383.0 * ln2) + yb4 * (-228.0 + 1757.0 * ln2)) + xb6 * (-4.0 + 70.0 * ln2 + 18.0 * yb6 * (38.0 + 143.0 * ln2) + yb2 * (52.0 + 706.0 * ln2) + yb4 * (420.0 + 2602.0 * ln2)) - yb6 * c_ln_1 + xb10 * (-ln2 - 27.0 * yb2 * ln2 + 57.0 * yb4 * ln2 + yb6 * c_ln_1) - 8.0 * 1.0i * xb3 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + c_ln_2) + c_ln_3) - 8.0 * 1.0i * xb7 * (1.0 + yb6 * (-27.0 + 211.0 * ln2) + yb4 * (-9.0 + 833.0 * ln2) + yb2 * (3.0 + c_ln_2) + c_ln_3))
                    - xb2 * (-24.0 * yb * ln2 - 36.0 * yb2 * ln2 - 48.0 * yb3 * ln2 + 180.0 * yb4 * ln2 + 72.0 * yb5 * ln2 - 12.0 * yb6 * ln2 - 8.0 * 1.0i * xb * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 - 8.0 * 1.0i * xb9 * (-1.0 - 6.0 * yb + 39.0 * yb2 - 12.0 * yb3 - 51.0 * yb4 + 18.0 * yb5 + 45.0 * yb6) * ln2 + 4.0 * xb2 * (-4.0 + 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2)) - 4.0 * xb8 * (-4.0 + 45.0 * ln2 - 18.0 * yb * ln2 + 28.0 * yb3 * ln2 + 246.0 * yb5 * ln2 + 9.0 * yb4 * (4.0 + 63.0 * ln2) - 3.0 * yb2 * (4.0 + 73.0 * ln2) + yb6 * (108.0 + 215.0 * ln2)) + 8.0 * xb4 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2))
-                     - 8.0 * xb6 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 16.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - log(16.0) + xb10 * (24.0 * yb * ln2 + 36.0 * yb2 * ln2 + 48.0 * yb3 * ln2 - 180.0 * yb4 * ln2 - 72.0 * yb5 * ln2 + 12.0 * yb6 * ln2 + log(16.0)) + 32.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + log(8192.0)) + 32.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + log(8192.0)))));
+                     - 8.0 * xb6 * (-2.0 + 23.0 * ln2 - 6.0 * yb * ln2 + 20.0 * yb3 * ln2 + 114.0 * yb5 * ln2 + 21.0 * yb4 * (10.0 + 49.0 * ln2) + yb2 * (26.0 + 279.0 * ln2) + 3.0 * yb6 * (114.0 + 335.0 * ln2)) + 16.0 * 1.0i * xb5 * (4.0 + 51.0 * ln2 + 18.0 * yb * ln2 - 28.0 * yb3 * ln2 - 246.0 * yb5 * ln2 + 33.0 * yb6 * (-12.0 + 25.0 * ln2) + yb2 * (-20.0 + 43.0 * ln2) + yb4 * (-228.0 + 2569.0 * ln2)) - c_ln_4 + xb10 * (24.0 * yb * ln2 + 36.0 * yb2 * ln2 + 48.0 * yb3 * ln2 - 180.0 * yb4 * ln2 - 72.0 * yb5 * ln2 + 12.0 * yb6 * ln2 + c_ln_4) + 32.0 * 1.0i * xb3 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + c_ln_42) + 32.0 * 1.0i * xb7 * (1.0 + yb2 * (3.0 - 31.0 * ln2) - 4.0 * yb3 * ln2 - 66.0 * yb5 * ln2 + 3.0 * yb6 * (-9.0 + 97.0 * ln2) + yb4 * (-9.0 + 1103.0 * ln2) + yb * ln64 + c_ln_42))));
 
             const complex<double> term1 = -(80.0 * lnmuhat) / 81.0 + (2.0 * xb4 * (-991.0 + 108.0 * ln2 - 36.0 * yb2 * (135.0 + 28.0 * ln2) + 9.0 * yb4 * (-957.0 + 100.0 * ln2))
-                  + 72.0 * xb2 * (-1.0 + yb2) * (2.0 + yb2 * (-13.0 + 14.0 * ln2) - ln4) + 72.0 * xb6 * (-1.0 + yb2) * (2.0 + yb2 * (-13.0 + 14.0 * ln2) - ln4) + 9.0 * (1.0 - 4.0 * yb2 + 3.0 * yb4) * (-1.0 + log(16.0))
-                  + 9.0 * xb8 * (1.0 - 4.0 * yb2 + 3.0 * yb4) * (-1.0 + log(16.0))) / (1944.0 * xb4 * power_of<2>(1.0 + 3.0 * yb2));
+                  + 72.0 * xb2 * (-1.0 + yb2) * (2.0 + yb2 * (-13.0 + 14.0 * ln2) - ln4) + 72.0 * xb6 * (-1.0 + yb2) * (2.0 + yb2 * (-13.0 + 14.0 * ln2) - ln4) + 9.0 * (1.0 - 4.0 * yb2 + 3.0 * yb4) * (-1.0 + c_ln_4)
+                  + 9.0 * xb8 * (1.0 - 4.0 * yb2 + 3.0 * yb4) * (-1.0 + c_ln_4)) / (1944.0 * xb4 * power_of<2>(1.0 + 3.0 * yb2));
 
             const complex<double> f27bpart1 = (num1 * log(xb)) / denom1 + (num4 * dilog((-1.0i) * xb) + num3 * dilog(1.0i * xb) - (num3 * power_of<2>(log(1.0 - 1.0i * xb))) / 2.0 - (num4 * power_of<2>(log(1.0 + 1.0i * xb))) / 2.0 + num3 * log(1.0 - 1.0i * xb) * log(xb)
                     + num4 * log(1.0 + 1.0i * xb) * log(xb)) / denom3 + (-(num2 * ln1myb) + num2 * ln1pyb) / denom2
@@ -608,28 +608,28 @@ namespace eos
                     + (2.0 * 1.0i) * num7 * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - tb / w4, 1.0 + w4inv) + (2.0 * 1.0i) * num8 * M_PI * log((-1.0 + w4) / w4) * my_sign(imag(w4)) * T(1.0, 1.0 - tb / w4, (-1.0 + w4) / w4)
                     + (2.0 * 1.0i) * num7 * M_PI * log(1.0 - w7 / w4) * my_sign(imag(w4 / w7)) * T(1.0, 1.0 - tb / w4, 1.0 - w7 / w4) + (2.0 * 1.0i) * num8 * M_PI * log(1.0 + w5inv) * my_sign(-imag(w5)) * T(1.0, (tb + w5) / w5, 1.0 + w5inv)
                     + (2.0 * 1.0i) * num7 * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (tb + w5) / w5, (-1.0 + w5) / w5) + (2.0 * 1.0i) * num7 * M_PI * log((w5 + w7) / w5) * my_sign(-imag(w5 / w7)) * T(1.0, (tb + w5) / w5, (w5 + w7) / w5)) / denom5
-                + ((-num10 - num11) * dilog(-1.0i / (-1.0i + wx3)) + (-num10 - num11) * dilog(1.0i / (1.0i + wx3)) + (-num10 - num11) * dilog(-1.0i / (-1.0i + wx4))
-                    + (-num10 - num11) * dilog(1.0i / (1.0i + wx4)) + num10 * dilog((1.0i - xb) / (1.0i + wx3)) + num10 * dilog((1.0i - xb) / (1.0i + wx4)) + num5 * dilog(-(xb / wx3)) + num6 * dilog(xb / wx3)
+                + ((-num10 - num11) * c_li2_1 + (-num10 - num11) * c_li2_2 + (-num10 - num11) * c_li2_3
+                    + (-num10 - num11) * c_li2_4 + num10 * dilog((1.0i - xb) / (1.0i + wx3)) + num10 * dilog((1.0i - xb) / (1.0i + wx4)) + num5 * dilog(-(xb / wx3)) + num6 * dilog(xb / wx3)
                     + num5 * dilog(-(xb / wx4)) + num6 * dilog(xb / wx4) + num11 * dilog((-1.0i + xb) / (-1.0i + wx3)) + num11 * dilog((-1.0i + xb) / (-1.0i + wx4)) + num10 * dilog((1.0i + xb) / (1.0i - wx3))
                     + num11 * dilog((1.0i + xb) / (1.0i + wx3)) + num10 * dilog((1.0i + xb) / (1.0i - wx4)) + num11 * dilog((1.0i + xb) / (1.0i + wx4)) + num11 * log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb)
                     + num11 * log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb) + (-2.0 * num10 * ln2 + num5 * log(xb)) * log((wx3 + xb) / wx3) - 2.0 * num10 * ln2 * log((wx4 + xb) / wx4)
                     + log(1.0 - 1.0i * xb) * (num11 * log((wx4 - xb) / (1.0i + wx4)) + num10 * log((wx3 + xb) / (-1.0i + wx3)) + num10 * log((wx4 + xb) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xb) * (num11 * log((wx4 - xb) / (-1.0i + wx4)) + num10 * log((wx3 + xb) / (1.0i + wx3)) + num10 * log((wx4 + xb) / (1.0i + wx4))) - 2.0 * num11 * ln2 * log(1.0 - xb / wx3)
                     - 2.0 * num11 * ln2 * log(1.0 - xb / wx4) + log(xb) * (num5 * log((wx4 + xb) / wx4) + num6 * log(1.0 - xb / wx3) + num6 * log(1.0 - xb / wx4))
-                    + (2.0 * 1.0i) * num11 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num10 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                    + (2.0 * 1.0i) * num11 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num10 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                    + (2.0 * 1.0i) * num10 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num11 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                    + (2.0 * 1.0i) * num10 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num11 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) / denom4;
+                    + (2.0 * 1.0i) * num11 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num10 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                    + (2.0 * 1.0i) * num11 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num10 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                    + (2.0 * 1.0i) * num10 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num11 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                    + (2.0 * 1.0i) * num10 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num11 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) / denom4;
 
             const complex<double> f27bpart2 = (num12 * ((-log(1.0 - tb) - log(tb) + log(1.0 + tb) + log(1.0 - vb) - log(vb) - log(1.0 + vb) + log(1.0 - tb / w7) + log((vb + w7) / w7)) * power_of<2>(log(1.0 - 1.0i * xb)) + (-log(1.0 - tb) - log(tb) + log(1.0 + tb) + log(1.0 - vb) - log(vb) - log(1.0 + vb) + log(1.0 - tb / w7) + log((vb + w7) / w7)) * power_of<2>(log(1.0 + 1.0i * xb))
                 + dilog(1.0 / (1.0 + w7)) * (4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb) - 4.0 * log(xb)) + dilog(tb) * (2.0 * log(1.0 - 1.0i * xb) + 2.0 * log(1.0 + 1.0i * xb) - 2.0 * log(xb)) + dilog(-vb) * (2.0 * log(1.0 - 1.0i * xb) + 2.0 * log(1.0 + 1.0i * xb) - 2.0 * log(xb))
                 + dilog((1.0 + vb) / (1.0 - w7)) * (2.0 * log(1.0 - 1.0i * xb) + 2.0 * log(1.0 + 1.0i * xb) - 2.0 * log(xb)) + dilog((-1.0 + tb) / (-1.0 + w7)) * (2.0 * log(1.0 - 1.0i * xb) + 2.0 * log(1.0 + 1.0i * xb) - 2.0 * log(xb)) + dilog((1.0 - tb) / 2.0) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb))
                 + dilog(-tb) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb)) + dilog((1.0 + tb) / 2.0) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb)) + dilog((1.0 - vb) / 2.0) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb)) + dilog(vb) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb))
                 + dilog((1.0 + vb) / 2.0) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb)) + dilog((1.0 + tb) / (1.0 + w7)) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb)) + dilog((1.0 - vb) / (1.0 + w7)) * (-2.0 * log(1.0 - 1.0i * xb) - 2.0 * log(1.0 + 1.0i * xb) + 2.0 * log(xb))
-                + dilog(1.0 / (1.0 - w7)) * (-4.0 * log(1.0 - 1.0i * xb) - 4.0 * log(1.0 + 1.0i * xb) + 4.0 * log(xb)) + dilog(-1.0i / (-1.0i + wx3)) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
-                + dilog(1.0i / (1.0i + wx3)) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
-                + dilog(-1.0i / (-1.0i + wx4)) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
-                + dilog(1.0i / (1.0i + wx4)) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
+                + dilog(1.0 / (1.0 - w7)) * (-4.0 * log(1.0 - 1.0i * xb) - 4.0 * log(1.0 + 1.0i * xb) + 4.0 * log(xb)) + c_li2_1 * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
+                + c_li2_2 * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
+                + c_li2_3 * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
+                + c_li2_4 * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
                 + dilog(1.0 / 2.0 + (1.0i / 2.0) * xb) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
                 + dilog(((-0.5) * 1.0i) * (1.0i + xb)) * (-2.0 * log(1.0 - tb) - 2.0 * log(tb) + 2.0 * log(1.0 + tb) + 2.0 * log(1.0 - vb) - 2.0 * log(vb) - 2.0 * log(1.0 + vb) + 2.0 * log(1.0 - tb / w7) + 2.0 * log((vb + w7) / w7) - 2.0 * ln1myb + 4.0 * log(yb) - 2.0 * ln1pyb)
                 + dilog(-(xb / wx3)) * (-log(1.0 - tb) - log(tb) + log(1.0 + tb) + log(1.0 - vb) - log(vb) - log(1.0 + vb) + log(1.0 - tb / w7) + log((vb + w7) / w7) - ln1myb + 2.0 * log(yb) - ln1pyb)
@@ -664,44 +664,44 @@ namespace eos
                     + 2.0 * log((vb + w7) / w7)) * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7)) * log(xb)
                   + (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * log((wx3 + xb) / (1.0i + wx3)) + (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * log((wx4 + xb) / (1.0i + wx4))
                   + (4.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - tb, 1.0 - w7) - (4.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + tb, 1.0 + w7) - (4.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - vb, 1.0 + w7) + (4.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 + vb, 1.0 - w7))
-                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + ln1myb * (log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) - power_of<2>(log(1.0 - 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb) - power_of<2>(log(1.0 + 1.0i * xb))
+                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + ln1myb * (log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) - power_of<2>(log(1.0 - 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb) - power_of<2>(log(1.0 + 1.0i * xb))
                   + log(1.0 - 1.0i * xb) * (log((wx4 - xb) / (1.0i + wx4)) - 2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 2.0 * log(xb) + log((wx3 + xb) / (-1.0i + wx3)) + log((wx4 + xb) / (-1.0i + wx4))) + log(1.0 + 1.0i * xb) * (log((wx4 - xb) / (-1.0i + wx4)) - 2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 2.0 * log(xb) + log((wx3 + xb) / (1.0i + wx3)) + log((wx4 + xb) / (1.0i + wx4)))
-                  + log(xb) * (-log((wx3 + xb) / wx3) - log((wx4 + xb) / wx4) - log(1.0 - xb / wx3) - log(1.0 - xb / wx4)) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                  + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                  + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + ln1pyb * (log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) - power_of<2>(log(1.0 - 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb) - power_of<2>(log(1.0 + 1.0i * xb))
+                  + log(xb) * (-log((wx3 + xb) / wx3) - log((wx4 + xb) / wx4) - log(1.0 - xb / wx3) - log(1.0 - xb / wx4)) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                  + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                  + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + ln1pyb * (log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) - power_of<2>(log(1.0 - 1.0i * xb)) + log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb) - power_of<2>(log(1.0 + 1.0i * xb))
                   + log(1.0 - 1.0i * xb) * (log((wx4 - xb) / (1.0i + wx4)) - 2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) + 2.0 * log(xb) + log((wx3 + xb) / (-1.0i + wx3)) + log((wx4 + xb) / (-1.0i + wx4))) + log(1.0 + 1.0i * xb) * (log((wx4 - xb) / (-1.0i + wx4)) - 2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) + 2.0 * log(xb) + log((wx3 + xb) / (1.0i + wx3)) + log((wx4 + xb) / (1.0i + wx4)))
-                  + log(xb) * (-log((wx3 + xb) / wx3) - log((wx4 + xb) / wx4) - log(1.0 - xb / wx3) - log(1.0 - xb / wx4)) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                  + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                  + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + log(yb) * (-2.0 * log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) + 2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 2.0 * log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb)
+                  + log(xb) * (-log((wx3 + xb) / wx3) - log((wx4 + xb) / wx4) - log(1.0 - xb / wx3) - log(1.0 - xb / wx4)) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                  + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                  + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + log(yb) * (-2.0 * log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) + 2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 2.0 * log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb)
                   + 2.0 * power_of<2>(log(1.0 + 1.0i * xb)) + log(1.0 - 1.0i * xb) * (-2.0 * log((wx4 - xb) / (1.0i + wx4)) + 4.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) - 4.0 * log(xb) - 2.0 * log((wx3 + xb) / (-1.0i + wx3)) - 2.0 * log((wx4 + xb) / (-1.0i + wx4)))
                   + log(1.0 + 1.0i * xb) * (-2.0 * log((wx4 - xb) / (-1.0i + wx4)) + 4.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) - 4.0 * log(xb) - 2.0 * log((wx3 + xb) / (1.0i + wx3)) - 2.0 * log((wx4 + xb) / (1.0i + wx4))) + log(xb) * (2.0 * log((wx3 + xb) / wx3) + 2.0 * log((wx4 + xb) / wx4) + 2.0 * log(1.0 - xb / wx3) + 2.0 * log(1.0 - xb / wx4))
-                  - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                  - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)))) / denom7;
+                  - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                  - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)))) / denom7;
 
             const complex<double> f27bpart3 = (num12 / denom7) * f279b_helper(clp);
 
-            const complex<double> f27bpart4 = (num12 * ln2 * (16.0 * dilog(wx3 / (-1.0i + wx3)) + 16.0 * dilog(wx3 / (1.0i + wx3)) + 16.0 * dilog(wx4 / (-1.0i + wx4)) + 16.0 * dilog(wx4 / (1.0i + wx4))
+            const complex<double> f27bpart4 = (num12 * ln2 * (16.0 * c_li2_5 + 16.0 * c_li2_6 + 16.0 * c_li2_7 + 16.0 * c_li2_8
                     - 8.0 * dilog((wx3 - xb) / (-1.0i + wx3)) - 8.0 * dilog((wx3 - xb) / (1.0i + wx3)) - 8.0 * dilog((wx4 - xb) / (-1.0i + wx4)) - 8.0 * dilog((wx4 - xb) / (1.0i + wx4)) + 16.0 * dilog((-1.0i) * xb)
                     + 16.0 * dilog(1.0i * xb) - 8.0 * dilog(-(xb / wx3)) - 8.0 * dilog(xb / wx3) - 8.0 * dilog(-(xb / wx4)) - 8.0 * dilog(xb / wx4) - 8.0 * dilog((wx3 + xb) / (-1.0i + wx3))
                     - 8.0 * dilog((wx3 + xb) / (1.0i + wx3)) - 8.0 * dilog((wx4 + xb) / (-1.0i + wx4)) - 8.0 * dilog((wx4 + xb) / (1.0i + wx4))
@@ -715,11 +715,11 @@ namespace eos
                     + (4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb) - 2.0 * log((wx3 + xb) / wx3) - 2.0 * log((wx4 + xb) / wx4) - 2.0 * log(1.0 - xb / wx3) - 2.0 * log(1.0 - xb / wx4)) * ln1myb
                     + (-8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb) + 4.0 * log((wx3 + xb) / wx3) + 4.0 * log((wx4 + xb) / wx4) + 4.0 * log(1.0 - xb / wx3) + 4.0 * log(1.0 - xb / wx4)) * log(yb)
                     + (4.0 * log(1.0 - 1.0i * xb) + 4.0 * log(1.0 + 1.0i * xb) - 2.0 * log((wx3 + xb) / wx3) - 2.0 * log((wx4 + xb) / wx4) - 2.0 * log(1.0 - xb / wx3) - 2.0 * log(1.0 - xb / wx4)) * ln1pyb
-                    - (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3)
-                    - (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4)
-                    - (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) - (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3)
-                    - (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
-                    - (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4))) / denom7;
+                    - (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-real(wx3)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(real(wx3)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3)
+                    - (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-real(wx4)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4)
+                    - (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(real(wx4)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) - (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-real(wx3)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3)
+                    - (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(real(wx3)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) - (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-real(wx4)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
+                    - (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(real(wx4)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4))) / denom7;
 
             const complex<double> f27bpart5 = term1 + (logs9 * log(1.0 - 1.0i * xb) + logs10 * log(1.0 + 1.0i * xb)) / denom10 + ((-logs1 - logs2) * li2half + logs1 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xb)
                     + logs2 * dilog(((-0.5) * 1.0i) * (1.0i + xb)) + logs2 * log(1.0 / 2.0 + (1.0i / 2.0) * xb) * log(1.0 - 1.0i * xb) + logs1 * log(1.0 / 2.0 - (1.0i / 2.0) * xb) * log(1.0 + 1.0i * xb)) / denom3
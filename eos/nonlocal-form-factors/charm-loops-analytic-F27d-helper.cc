@@ -101,11 +101,11 @@ namespace eos
                 + (-num17 - num18) * trilog((-1.0 + w4) / w4) + (num17 + num18) * trilog(-w4) + (-num17 - num18) * trilog(w4) + (num17 + num18) * trilog((1.0 - w4) / (1.0 + w4)) + (-num17 - num18) * trilog(1.0 + w5inv)
                 + (-num17 - num18) * trilog(w5inv) + (-num17 - num18) * trilog(-w5) + (num17 + num18) * trilog(w5) + (-num17 - num18) * trilog(1.0 / (1.0 + w5)) + (num17 + num18) * trilog((1.0 + w5) / (1.0 - w5))
                 + (num17 + num18) * trilog((1.0 + w5) / (2.0 * w5)) + (num19 + num20) * trilog(1.0 / (1.0 - w7)) + (num19 + num20) * trilog(-w7inv) + (-num19 - num20) * trilog((-1.0 + w7) / (2.0 * w7)) + (num19 + num20) * trilog((-1.0 + w7) / w7)
-                + (-num19 - num20) * trilog(-w7) + (num19 + num20) * trilog(w7) + (-num19 - num20) * trilog((1.0 - w7) / (1.0 + w7)) + 6.0 * num16 * trilog(-1.0i / wx3) + 6.0 * num16 * trilog(1.0i / wx3) + 10.0 * num16 * trilog(-1.0i / (-1.0i + wx3))
-                + 2.0 * num16 * trilog(wx3 / (-1.0i + wx3)) - 4.0 * num16 * trilog((-1.0i + wx3) / (2.0 * wx3)) + 4.0 * num16 * trilog((-1.0i + wx3) / wx3) + 10.0 * num16 * trilog(1.0i / (1.0i + wx3)) - 4.0 * num16 * trilog((1.0i - wx3) / (1.0i + wx3))
-                + 2.0 * num16 * trilog(wx3 / (1.0i + wx3)) - 4.0 * num16 * trilog((1.0i + wx3) / (1.0i - wx3)) - 4.0 * num16 * trilog((1.0i + wx3) / (2.0 * wx3)) + 4.0 * num16 * trilog((1.0i + wx3) / wx3) + 6.0 * num16 * trilog(-1.0i / wx4) + 6.0 * num16 * trilog(1.0i / wx4)
-                + 10.0 * num16 * trilog(-1.0i / (-1.0i + wx4)) + 2.0 * num16 * trilog(wx4 / (-1.0i + wx4)) - 4.0 * num16 * trilog((-1.0i + wx4) / (2.0 * wx4)) + 4.0 * num16 * trilog((-1.0i + wx4) / wx4) + 10.0 * num16 * trilog(1.0i / (1.0i + wx4))
-                - 4.0 * num16 * trilog((1.0i - wx4) / (1.0i + wx4)) + 2.0 * num16 * trilog(wx4 / (1.0i + wx4)) - 4.0 * num16 * trilog((1.0i + wx4) / (1.0i - wx4)) - 4.0 * num16 * trilog((1.0i + wx4) / (2.0 * wx4)) + 4.0 * num16 * trilog((1.0i + wx4) / wx4)
+                + (-num19 - num20) * trilog(-w7) + (num19 + num20) * trilog(w7) + (-num19 - num20) * trilog((1.0 - w7) / (1.0 + w7)) + 6.0 * num16 * c_li3_1 + 6.0 * num16 * c_li3_2 + 10.0 * num16 * c_li3_3
+                + 2.0 * num16 * c_li3_4 - 4.0 * num16 * c_li3_5 + 4.0 * num16 * c_li3_6 + 10.0 * num16 * c_li3_7 - 4.0 * num16 * c_li3_8
+                + 2.0 * num16 * c_li3_9 - 4.0 * num16 * c_li3_10 - 4.0 * num16 * c_li3_11 + 4.0 * num16 * c_li3_12 + 6.0 * num16 * c_li3_13 + 6.0 * num16 * c_li3_14
+                + 10.0 * num16 * c_li3_15 + 2.0 * num16 * c_li3_16 - 4.0 * num16 * c_li3_17 + 4.0 * num16 * c_li3_18 + 10.0 * num16 * c_li3_19
+                - 4.0 * num16 * c_li3_20 + 2.0 * num16 * c_li3_21 - 4.0 * num16 * c_li3_22 - 4.0 * num16 * c_li3_23 + 4.0 * num16 * c_li3_24
                 - 5.0 * num16 * trilog((1.0i - xd) / (1.0i + wx3)) - 5.0 * num16 * trilog((1.0i - xd) / (1.0i + wx4)) - 2.0 * num16 * trilog((-1.0i + wx3) / (wx3 - xd)) - 2.0 * num16 * trilog((1.0i + wx3) / (wx3 - xd)) - num16 * trilog((wx3 - xd) / (-1.0i + wx3))
                 - num16 * trilog((wx3 - xd) / (1.0i + wx3)) - 2.0 * num16 * trilog((-1.0i + wx4) / (wx4 - xd)) - 2.0 * num16 * trilog((1.0i + wx4) / (wx4 - xd)) - num16 * trilog((wx4 - xd) / (-1.0i + wx4)) - num16 * trilog((wx4 - xd) / (1.0i + wx4))
                 + 8.0 * num16 * trilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 2.0 * num16 * trilog(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd))) + 2.0 * num16 * trilog(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd))) + 2.0 * num16 * trilog(((1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 - xd)))
@@ -139,8 +139,8 @@ namespace eos
                 + num17 * trilog((-1.0 + yd) / (w5 + yd)) + num17 * trilog((w5 * (1.0 + yd)) / (w5 + yd)) - num17 * trilog(((1.0 + w5) * (1.0 + yd)) / (2.0 * (w5 + yd))) - num20 * trilog((-1.0 + yd) / (-w7 + yd)) - num19 * trilog((-1.0 + w7) / (w7 + yd))
                 + num19 * trilog((-0.5) * (((-1.0 + w7) * (-1.0 + yd)) / (w7 + yd))) - num19 * trilog((1.0 + yd) / (w7 + yd)) + num19 * trilog((w7 * (1.0 + yd)) / (w7 + yd)) - num17 * trilog((w4 - w4 * yd) / (w4 - yd))
                 + num18 * trilog((w4 - w4 * yd) / (w4 + yd)) + num18 * trilog((w5 - w5 * yd) / (w5 - yd)) - num17 * trilog((w5 - w5 * yd) / (w5 + yd)) + num20 * trilog((w7 - w7 * yd) / (w7 - yd)) - num19 * trilog((w7 - w7 * yd) / (w7 + yd))
-                + 4.0 * num16 * dilog((-1.0i + wx3) / (2.0 * wx3)) * lnhalf + 4.0 * num16 * dilog((1.0i - wx3) / (1.0i + wx3)) * lnhalf + 4.0 * num16 * dilog((1.0i + wx3) / (1.0i - wx3)) * lnhalf + 4.0 * num16 * dilog((1.0i + wx3) / (2.0 * wx3)) * lnhalf
-                + 4.0 * num16 * dilog((-1.0i + wx4) / (2.0 * wx4)) * lnhalf + 4.0 * num16 * dilog((1.0i - wx4) / (1.0i + wx4)) * lnhalf + 4.0 * num16 * dilog((1.0i + wx4) / (1.0i - wx4)) * lnhalf + 4.0 * num16 * dilog((1.0i + wx4) / (2.0 * wx4)) * lnhalf
+                + 4.0 * num16 * c_li2_9 * lnhalf + 4.0 * num16 * c_li2_10 * lnhalf + 4.0 * num16 * c_li2_11 * lnhalf + 4.0 * num16 * c_li2_12 * lnhalf
+                + 4.0 * num16 * c_li2_13 * lnhalf + 4.0 * num16 * c_li2_14 * lnhalf + 4.0 * num16 * c_li2_15 * lnhalf + 4.0 * num16 * c_li2_16 * lnhalf
                 + dilog((-1.0 + w4) / (2.0 * w4)) * (-(num17 * lnhalf) - num18 * lnhalf) + dilog((1.0 - w4) / (1.0 + w4)) * (-(num17 * lnhalf) - num18 * lnhalf)
                 + dilog((1.0 + w5) / (1.0 - w5)) * (-(num17 * lnhalf) - num18 * lnhalf) + dilog((1.0 + w5) / (2.0 * w5)) * (-(num17 * lnhalf) - num18 * lnhalf) + dilog(-w4inv) * (num17 * lnhalf + num18 * lnhalf)
                 + dilog(w5inv) * (num17 * lnhalf + num18 * lnhalf) + dilog(-w7inv) * (-(num19 * lnhalf) - num20 * lnhalf) + dilog((-1.0 + w7) / (2.0 * w7)) * (num19 * lnhalf + num20 * lnhalf)
@@ -155,14 +155,14 @@ namespace eos
                 - (num20 * power_of<2>(lnhalf) * log(1.0 + w7inv)) / 2.0 + (num19 * pisqu * log(2.0 / w7)) / 6.0 + (num20 * pisqu * log(2.0 / w7)) / 6.0 + (num19 * power_of<3>(log(2.0 / w7))) / 6.0 + (num20 * power_of<3>(log(2.0 / w7))) / 6.0 - (num19 * pisqu * log((2.0 * (-1.0 + w7)) / (1.0 + w7))) / 6.0
                 - (num20 * pisqu * log((2.0 * (-1.0 + w7)) / (1.0 + w7))) / 6.0 - (num19 * power_of<3>(log((2.0 * (-1.0 + w7)) / (1.0 + w7)))) / 6.0 - (num20 * power_of<3>(log((2.0 * (-1.0 + w7)) / (1.0 + w7)))) / 6.0 - (num19 * power_of<2>(lnhalf) * log(w7 / (1.0 + w7))) / 2.0
                 - (num20 * power_of<2>(lnhalf) * log(w7 / (1.0 + w7))) / 2.0 + (num19 * power_of<2>(lnhalf) * log((2.0 * w7) / (1.0 + w7))) / 2.0 + (num20 * power_of<2>(lnhalf) * log((2.0 * w7) / (1.0 + w7))) / 2.0 + (num19 * power_of<2>(lnhalf) * log((1.0 + w7) / (2.0 * w7))) / 2.0
-                + (num20 * power_of<2>(lnhalf) * log((1.0 + w7) / (2.0 * w7))) / 2.0 + (2.0 * num16 * pisqu * log((-2.0 * 1.0i) / wx3)) / 3.0 + (2.0 * num16 * power_of<3>(log((-2.0 * 1.0i) / wx3))) / 3.0 + (2.0 * num16 * pisqu * log((2.0 * 1.0i) / wx3)) / 3.0 + (2.0 * num16 * power_of<3>(log((2.0 * 1.0i) / wx3))) / 3.0
-                - 2.0 * num16 * power_of<2>(lnhalf) * log(wx3 / (-1.0i + wx3)) + 2.0 * num16 * power_of<2>(lnhalf) * log((2.0 * wx3) / (-1.0i + wx3)) + 2.0 * num16 * power_of<2>(lnhalf) * log((-1.0i + wx3) / (2.0 * wx3)) - 2.0 * num16 * power_of<2>(lnhalf) * log((-1.0i + wx3) / wx3)
-                - 2.0 * num16 * power_of<2>(lnhalf) * log(wx3 / (1.0i + wx3)) + 2.0 * num16 * power_of<2>(lnhalf) * log((2.0 * wx3) / (1.0i + wx3)) - (2.0 * num16 * pisqu * log((2.0 * (-1.0i + wx3)) / (1.0i + wx3))) / 3.0 - (2.0 * num16 * power_of<3>(log((2.0 * (-1.0i + wx3)) / (1.0i + wx3)))) / 3.0
-                + 2.0 * num16 * power_of<2>(lnhalf) * log((1.0i + wx3) / (2.0 * wx3)) - 2.0 * num16 * power_of<2>(lnhalf) * log((1.0i + wx3) / wx3) - (2.0 * num16 * pisqu * log((2.0 * (1.0i + wx3)) / (-1.0i + wx3))) / 3.0 - (2.0 * num16 * power_of<3>(log((2.0 * (1.0i + wx3)) / (-1.0i + wx3)))) / 3.0
-                + (2.0 * num16 * pisqu * log((-2.0 * 1.0i) / wx4)) / 3.0 + (2.0 * num16 * power_of<3>(log((-2.0 * 1.0i) / wx4))) / 3.0 + (2.0 * num16 * pisqu * log((2.0 * 1.0i) / wx4)) / 3.0 + (2.0 * num16 * power_of<3>(log((2.0 * 1.0i) / wx4))) / 3.0 - 2.0 * num16 * power_of<2>(lnhalf) * log(wx4 / (-1.0i + wx4))
-                + 2.0 * num16 * power_of<2>(lnhalf) * log((2.0 * wx4) / (-1.0i + wx4)) + 2.0 * num16 * power_of<2>(lnhalf) * log((-1.0i + wx4) / (2.0 * wx4)) - 2.0 * num16 * power_of<2>(lnhalf) * log((-1.0i + wx4) / wx4) - 2.0 * num16 * power_of<2>(lnhalf) * log(wx4 / (1.0i + wx4))
-                + 2.0 * num16 * power_of<2>(lnhalf) * log((2.0 * wx4) / (1.0i + wx4)) - (2.0 * num16 * pisqu * log((2.0 * (-1.0i + wx4)) / (1.0i + wx4))) / 3.0 - (2.0 * num16 * power_of<3>(log((2.0 * (-1.0i + wx4)) / (1.0i + wx4)))) / 3.0 + 2.0 * num16 * power_of<2>(lnhalf) * log((1.0i + wx4) / (2.0 * wx4))
-                - 2.0 * num16 * power_of<2>(lnhalf) * log((1.0i + wx4) / wx4) - (2.0 * num16 * pisqu * log((2.0 * (1.0i + wx4)) / (-1.0i + wx4))) / 3.0 - (2.0 * num16 * power_of<3>(log((2.0 * (1.0i + wx4)) / (-1.0i + wx4)))) / 3.0 - (num16 * pisqu * log(wx3 / (1.0i - xd))) / 6.0
+                + (num20 * power_of<2>(lnhalf) * log((1.0 + w7) / (2.0 * w7))) / 2.0 + (2.0 * num16 * pisqu * c_ln_16) / 3.0 + (2.0 * num16 * power_of<3>(c_ln_16)) / 3.0 + (2.0 * num16 * pisqu * c_ln_17) / 3.0 + (2.0 * num16 * power_of<3>(c_ln_17)) / 3.0
+                - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_18 + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_19 + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_20 - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_11
+                - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_21 + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_22 - (2.0 * num16 * pisqu * c_ln_23) / 3.0 - (2.0 * num16 * power_of<3>(c_ln_23)) / 3.0
+                + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_24 - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_12 - (2.0 * num16 * pisqu * c_ln_25) / 3.0 - (2.0 * num16 * power_of<3>(c_ln_25)) / 3.0
+                + (2.0 * num16 * pisqu * c_ln_26) / 3.0 + (2.0 * num16 * power_of<3>(c_ln_26)) / 3.0 + (2.0 * num16 * pisqu * c_ln_27) / 3.0 + (2.0 * num16 * power_of<3>(c_ln_27)) / 3.0 - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_28
+                + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_29 + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_30 - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_13 - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_31
+                + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_32 - (2.0 * num16 * pisqu * c_ln_33) / 3.0 - (2.0 * num16 * power_of<3>(c_ln_33)) / 3.0 + 2.0 * num16 * power_of<2>(lnhalf) * c_ln_34
+                - 2.0 * num16 * power_of<2>(lnhalf) * c_ln_14 - (2.0 * num16 * pisqu * c_ln_35) / 3.0 - (2.0 * num16 * power_of<3>(c_ln_35)) / 3.0 - (num16 * pisqu * log(wx3 / (1.0i - xd))) / 6.0
                 - (num16 * power_of<3>(log(wx3 / (1.0i - xd)))) / 6.0 - (num16 * pisqu * log(wx4 / (1.0i - xd))) / 6.0 - (num16 * power_of<3>(log(wx4 / (1.0i - xd)))) / 6.0 - (num16 * pisqu * log((-2.0 * 1.0i) / (wx3 - xd))) / 3.0 - (num16 * power_of<3>(log((-2.0 * 1.0i) / (wx3 - xd)))) / 3.0
                 - (num16 * pisqu * log((2.0 * 1.0i) / (wx3 - xd))) / 3.0 - (num16 * power_of<3>(log((2.0 * 1.0i) / (wx3 - xd)))) / 3.0 - (num16 * pisqu * log((-2.0 * 1.0i) / (wx4 - xd))) / 3.0 - (num16 * power_of<3>(log((-2.0 * 1.0i) / (wx4 - xd)))) / 3.0 - (num16 * pisqu * log((2.0 * 1.0i) / (wx4 - xd))) / 3.0
                 - (num16 * power_of<3>(log((2.0 * 1.0i) / (wx4 - xd)))) / 3.0 - 2.0 * num16 * dilog(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - 2.0 * num16 * dilog(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd)
@@ -179,15 +179,15 @@ namespace eos
                 - 4.0 * num16 * dilog((1.0i + xd) * xdinv) * log(1.0 - 1.0i * xd) + num16 * dilog((wx3 * (1.0i + xd)) / ((-1.0i + wx3) * xd)) * log(1.0 - 1.0i * xd) + num16 * dilog((wx3 * (1.0i + xd)) / ((1.0i + wx3) * xd)) * log(1.0 - 1.0i * xd)
                 + num16 * dilog((wx4 * (1.0i + xd)) / ((-1.0i + wx4) * xd)) * log(1.0 - 1.0i * xd) + num16 * dilog((wx4 * (1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 - 1.0i * xd) - 4.0 * num16 * dilog((-1.0i + xd) * xdinv) * log(1.0 + 1.0i * xd)
                 + num16 * dilog((wx3 * (-1.0i + xd)) / ((-1.0i + wx3) * xd)) * log(1.0 + 1.0i * xd) + num16 * dilog((wx3 * (-1.0i + xd)) / ((1.0i + wx3) * xd)) * log(1.0 + 1.0i * xd) + num16 * dilog((wx4 * (-1.0i + xd)) / ((-1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd)
-                + num16 * dilog((wx4 * (-1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) + dilog((-2.0 * 1.0i) / (-1.0i + wx3)) * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd))
-                + dilog((2.0 * 1.0i) / (1.0i + wx3)) * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd)) + dilog((-2.0 * 1.0i) / (-1.0i + wx4)) * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd))
-                + dilog((2.0 * 1.0i) / (1.0i + wx4)) * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd)) + dilog(-1.0i / wx3) * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / wx3) * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd)) + dilog(-1.0i / wx4) * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / wx4) * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd)) + log((wx3 - xd) / (1.0i + wx3)) * ((-0.5) * (num16 * power_of<2>(log(1.0 - 1.0i * xd))) - num16 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd))
+                + num16 * dilog((wx4 * (-1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) + c_li2_21 * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd))
+                + c_li2_22 * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd)) + c_li2_23 * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd))
+                + c_li2_24 * (-2.0 * num16 * log(1.0 - 1.0i * xd) - 2.0 * num16 * log(1.0 + 1.0i * xd)) + c_li2_17 * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd))
+                + c_li2_18 * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd)) + c_li2_19 * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd))
+                + c_li2_20 * (-4.0 * num16 * lnhalf + num16 * log(1.0 - 1.0i * xd) + num16 * log(1.0 + 1.0i * xd)) + log((wx3 - xd) / (1.0i + wx3)) * ((-0.5) * (num16 * power_of<2>(log(1.0 - 1.0i * xd))) - num16 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd))
                 + log((wx4 - xd) / (1.0i + wx4)) * ((-0.5) * (num16 * power_of<2>(log(1.0 - 1.0i * xd))) - num16 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd))
                 + log((wx3 - xd) / (-1.0i + wx3)) * (-(num16 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd)) - (num16 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0) + log((wx4 - xd) / (-1.0i + wx4)) * (-(num16 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd)) - (num16 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0)
-                + (2.0 * num16 * pisqu * log(-1.0i / xd)) / 3.0 + (2.0 * num16 * power_of<3>(log(-1.0i / xd))) / 3.0 + (2.0 * num16 * pisqu * log(1.0i / xd)) / 3.0 + (2.0 * num16 * power_of<3>(log(1.0i / xd))) / 3.0 + dilog(wx3 / (-1.0i + wx3)) * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd))
-                + dilog(wx3 / (1.0i + wx3)) * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd)) + dilog(wx4 / (-1.0i + wx4)) * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd)) + dilog(wx4 / (1.0i + wx4)) * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd))
+                + (2.0 * num16 * pisqu * log(-1.0i / xd)) / 3.0 + (2.0 * num16 * power_of<3>(log(-1.0i / xd))) / 3.0 + (2.0 * num16 * pisqu * log(1.0i / xd)) / 3.0 + (2.0 * num16 * power_of<3>(log(1.0i / xd))) / 3.0 + c_li2_5 * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd))
+                + c_li2_6 * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd)) + c_li2_7 * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd)) + c_li2_8 * (-4.0 * num16 * ln2 - 2.0 * num16 * log(xd))
                 + dilog((1.0 - yd) / (1.0 + w5)) * (-2.0 * num17 * ln2 + num17 * log(1.0 - 1.0i * xd) + num17 * log(1.0 + 1.0i * xd) - num17 * log(xd))
                 + dilog((-1.0 + yd) / (-1.0 + w4)) * (-2.0 * num17 * ln2 + num17 * log(1.0 - 1.0i * xd) + num17 * log(1.0 + 1.0i * xd) - num17 * log(xd))
                 + dilog(1.0 / (1.0 + w4)) * (num17 * lnhalf + num18 * lnhalf - 2.0 * num17 * ln2 - 2.0 * num18 * ln2 + (num17 + num18) * log(1.0 - 1.0i * xd) + (num17 + num18) * log(1.0 + 1.0i * xd) + (-num17 - num18) * log(xd))
@@ -300,13 +300,13 @@ namespace eos
                 + dilog(-w5) * (-(num17 * log((w5 + yd) / w5)) - num18 * log(1.0 - yd / w5));
 
             const complex<double> part3 = + dilog(w5) * (num17 * log((w5 + yd) / w5) + num18 * log(1.0 - yd / w5))
-                + dilog(-1.0i / (-1.0i + wx3)) * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
+                + c_li2_1 * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
                 - 4.0 * num19 * log((w7 + yd) / w7) + num17 * log(1.0 - yd / w4) + num18 * log(1.0 - yd / w5) - 4.0 * num20 * log(1.0 - yd / w7))
-                + dilog(1.0i / (1.0i + wx3)) * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
+                + c_li2_2 * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
                 - 4.0 * num19 * log((w7 + yd) / w7) + num17 * log(1.0 - yd / w4) + num18 * log(1.0 - yd / w5) - 4.0 * num20 * log(1.0 - yd / w7))
-                + dilog(-1.0i / (-1.0i + wx4)) * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
+                + c_li2_3 * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
                 - 4.0 * num19 * log((w7 + yd) / w7) + num17 * log(1.0 - yd / w4) + num18 * log(1.0 - yd / w5) - 4.0 * num20 * log(1.0 - yd / w7))
-                + dilog(1.0i / (1.0i + wx4)) * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
+                + c_li2_4 * (-4.0 * num16 * lnhalf + 2.0 * num16 * log(1.0 - 1.0i * xd) + 2.0 * num16 * log(1.0 + 1.0i * xd) - 2.0 * num15 * ln1myd - 2.0 * num14 * ln1pyd + num18 * log((w4 + yd) / w4) + num17 * log((w5 + yd) / w5)
                 - 4.0 * num19 * log((w7 + yd) / w7) + num17 * log(1.0 - yd / w4) + num18 * log(1.0 - yd / w5) - 4.0 * num20 * log(1.0 - yd / w7))
                 + dilog(xd / wx3) * (2.0 * num16 * ln2 + num16 * log(xd) - num15 * ln1myd - num14 * ln1pyd + num18 * log((w4 + yd) / w4) - 2.0 * num19 * log((w7 + yd) / w7) + num17 * log(1.0 - yd / w4)
                 - 2.0 * num20 * log(1.0 - yd / w7)) + dilog(xd / wx4) * (2.0 * num16 * ln2 + num16 * log(xd) - num15 * ln1myd - num14 * ln1pyd + num18 * log((w4 + yd) / w4) - 2.0 * num19 * log((w7 + yd) / w7)
@@ -376,79 +376,79 @@ namespace eos
                 - 1.0i * num18 * M_PI * power_of<2>(log((1.0 - w5) / 2.0)) * my_sign(imag(w5) / 2.0) * T(1.0, 1.0 / 2.0, (1.0 - w5) / 2.0) - 1.0i * num17 * M_PI * power_of<2>(log(w5 / (1.0 + w5))) * my_sign(-imag(1.0 / (1.0 + w5))) * T(1.0, 1.0 / 2.0, w5 / (1.0 + w5))
                 - 1.0i * num18 * M_PI * power_of<2>(log(w5 / (1.0 + w5))) * my_sign(-imag(1.0 / (1.0 + w5))) * T(1.0, 1.0 / 2.0, w5 / (1.0 + w5)) + 1.0i * num19 * M_PI * power_of<2>(log(w7 / (-1.0 + w7))) * my_sign(-imag(1.0 / (1.0 - w7))) * T(1.0, 1.0 / 2.0, w7 / (-1.0 + w7))
                 + 1.0i * num20 * M_PI * power_of<2>(log(w7 / (-1.0 + w7))) * my_sign(imag(1.0 / (-1.0 + w7))) * T(1.0, 1.0 / 2.0, w7 / (-1.0 + w7)) + 1.0i * num19 * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, 1.0 / 2.0, (1.0 + w7) / 2.0)
-                + 1.0i * num20 * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, 1.0 / 2.0, (1.0 + w7) / 2.0) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx3 / (-1.0i + wx3))) * my_sign(-real(1.0 / (1.0i - wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3))
-                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx3 / (-1.0i + wx3))) * my_sign(real(1.0 / (-1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3)) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx3 / (1.0i + wx3))) * my_sign(-real(1.0 / (1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (1.0i + wx3))
-                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
-                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx4 / (-1.0i + wx4))) * my_sign(-real(1.0 / (1.0i - wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx4 / (-1.0i + wx4))) * my_sign(real(1.0 / (-1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4))
-                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(log(wx4 / (1.0i + wx4))) * my_sign(-real(1.0 / (1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (1.0i + wx4)) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
-                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 + xd) / (1.0i + wx3))) * my_sign(imag((1.0i - xd) / (1.0i + wx3))) *
+                + 1.0i * num20 * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-0.5) * imag(w7)) * T(1.0, 1.0 / 2.0, (1.0 + w7) / 2.0) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_18) * my_sign(-real(1.0 / (1.0i - wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3))
+                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_18) * my_sign(real(1.0 / (-1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (-1.0i + wx3)) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_21) * my_sign(-real(1.0 / (1.0i + wx3))) * T(1.0, 1.0 / 2.0, wx3 / (1.0i + wx3))
+                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_28) * my_sign(-real(1.0 / (1.0i - wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4)) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_28) * my_sign(real(1.0 / (-1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (-1.0i + wx4))
+                + (4.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_31) * my_sign(-real(1.0 / (1.0i + wx4))) * T(1.0, 1.0 / 2.0, wx4 / (1.0i + wx4)) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 + xd) / (1.0i + wx3))) * my_sign(imag((1.0i - xd) / (1.0i + wx3))) *
                 T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, (wx3 + xd) / (1.0i + wx3)) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx4 + xd) / (1.0i + wx4))) * my_sign(imag((1.0i - xd) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, (wx4 + xd) / (1.0i + wx4))
-                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx4)) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_37) * my_sign((-0.5) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_40) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * num16 * M_PI * power_of<2>(c_ln_39) * my_sign((-0.5) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
                 + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 - xd) / (1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, (wx3 - xd) / (1.0i + wx3)) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx4 - xd) / (1.0i + wx4))) * my_sign(imag((1.0i + xd) / (1.0i + wx4))) *
-                T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, (wx4 - xd) / (1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                - 1.0i * num16 * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - 1.0i * num16 * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                - 1.0i * num16 * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                - 1.0i * num16 * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 + xd) / (-1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i - wx3))) * T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx3 + xd) / (-1.0i + wx3))
-                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx4 + xd) / (-1.0i + wx4))) * my_sign(imag((1.0i + xd) / (1.0i - wx4))) * T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx4 + xd) / (-1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) *
-                T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - 1.0i * num16 * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + dilog(1.0 / 2.0 - (1.0i / 2.0) * wx3) * (-4.0 * num16 * log(wx3 / (1.0i + wx3)) + 2.0 * num16 * log((wx3 - xd) / (1.0i + wx3))
+                T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, (wx4 - xd) / (1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                - 1.0i * num16 * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * num16 * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - 1.0i * num16 * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * num16 * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                - 1.0i * num16 * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * num16 * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                - 1.0i * num16 * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 + xd) / (-1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i - wx3))) * T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx3 + xd) / (-1.0i + wx3))
+                + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx4 + xd) / (-1.0i + wx4))) * my_sign(imag((1.0i + xd) / (1.0i - wx4))) * T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx4 + xd) / (-1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) *
+                T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + c_li2_30 * (-4.0 * num16 * c_ln_21 + 2.0 * num16 * log((wx3 - xd) / (1.0i + wx3))
                 + 2.0 * num16 * log((wx3 + xd) / (1.0i + wx3)) - (4.0 * 1.0i) * num16 * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * num16 * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3))
-                - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - 1.0i * num16 * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx3) * (-4.0 * num16 * log(wx3 / (-1.0i + wx3)) + 2.0 * num16 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * num16 * log((wx3 + xd) / (-1.0i + wx3)) - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                - 1.0i * num16 * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + log((w5 + yd) / w5) * ((num17 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num17 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + 2.0 * num17 * ln2 * log((wx3 + xd) / wx3)
+                - (4.0 * 1.0i) * num16 * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                + c_li2_26 * (-4.0 * num16 * c_ln_18 + 2.0 * num16 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * num16 * log((wx3 + xd) / (-1.0i + wx3)) - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) - (4.0 * 1.0i) * num16 * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                - 1.0i * num16 * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + log((w5 + yd) / w5) * ((num17 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num17 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + 2.0 * num17 * ln2 * log((wx3 + xd) / wx3)
                 + 2.0 * num17 * ln2 * log((wx4 + xd) / wx4) + log(xd) * (num17 * log((wx3 + xd) / wx3) + num17 * log((wx4 + xd) / wx4)) + log(1.0 - 1.0i * xd) * (-(num17 * ln2) - num17 * log(xd) - num17 * log((wx3 + xd) / (-1.0i + wx3))
                     - num17 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-(num17 * ln2) - num17 * log(xd) - num17 * log((wx3 + xd) / (1.0i + wx3)) - num17 * log((wx4 + xd) / (1.0i + wx4)))
-                - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4));
+                - (2.0 * 1.0i) * num17 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num17 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * num17 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num17 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4));
 
             const complex<double> part4 = + log(1.0 - yd / w5) * ((num18 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num18 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + 2.0 * num18 * ln2 * log((wx3 + xd) / wx3) + 2.0 * num18 * ln2 * log((wx4 + xd) / wx4)
                 + log(xd) * (num18 * log((wx3 + xd) / wx3) + num18 * log((wx4 + xd) / wx4)) + log(1.0 - 1.0i * xd) * (-(num18 * ln2) - num18 * log(xd) - num18 * log((wx3 + xd) / (-1.0i + wx3)) - num18 * log((wx4 + xd) / (-1.0i + wx4)))
-                + log(1.0 + 1.0i * xd) * (-(num18 * ln2) - num18 * log(xd) - num18 * log((wx3 + xd) / (1.0i + wx3)) - num18 * log((wx4 + xd) / (1.0i + wx4))) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) *
-                    T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) + dilog(1.0 / 2.0 - (1.0i / 2.0) * wx4) * (-4.0 * num16 * log(wx4 / (1.0i + wx4)) + 2.0 * num16 * log((wx4 - xd) / (1.0i + wx4))
+                + log(1.0 + 1.0i * xd) * (-(num18 * ln2) - num18 * log(xd) - num18 * log((wx3 + xd) / (1.0i + wx3)) - num18 * log((wx4 + xd) / (1.0i + wx4))) - (2.0 * 1.0i) * num18 * M_PI * c_ln_8 * my_sign(real(wx3inv)) *
+                    T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num18 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * num18 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) + c_li2_31 * (-4.0 * num16 * c_ln_31 + 2.0 * num16 * log((wx4 - xd) / (1.0i + wx4))
                 + 2.0 * num16 * log((wx4 + xd) / (1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * num16 * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
-                - (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) - 1.0i * num16 * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                - (4.0 * 1.0i) * num16 * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) - 1.0i * num16 * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
                 + log(1.0 - yd / w4) * ((num17 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num17 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + log(1.0 + 1.0i * xd) * (-(num17 * ln2) - num17 * log((wx3 - xd) / (-1.0i + wx3)) - num17 * log((wx4 - xd) / (-1.0i + wx4)) - num17 * log(xd))
                 + log(1.0 - 1.0i * xd) * (-(num17 * ln2) - num17 * log((wx3 - xd) / (1.0i + wx3)) - num17 * log((wx4 - xd) / (1.0i + wx4)) - num17 * log(xd)) + 2.0 * num17 * ln2 * log(1.0 - xd / wx3) + 2.0 * num17 * ln2 * log(1.0 - xd / wx4)
-                + log(xd) * (num17 * log(1.0 - xd / wx3) + num17 * log(1.0 - xd / wx4)) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log((w4 + yd) / w4) * ((num18 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num18 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0
+                + log(xd) * (num17 * log(1.0 - xd / wx3) + num17 * log(1.0 - xd / wx4)) - (2.0 * 1.0i) * num17 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * num17 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num17 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num17 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log((w4 + yd) / w4) * ((num18 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (num18 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0
                 + log(1.0 + 1.0i * xd) * (-(num18 * ln2) - num18 * log((wx3 - xd) / (-1.0i + wx3)) - num18 * log((wx4 - xd) / (-1.0i + wx4)) - num18 * log(xd))
                 + log(1.0 - 1.0i * xd) * (-(num18 * ln2) - num18 * log((wx3 - xd) / (1.0i + wx3)) - num18 * log((wx4 - xd) / (1.0i + wx4)) - num18 * log(xd)) + 2.0 * num18 * ln2 * log(1.0 - xd / wx3) + 2.0 * num18 * ln2 * log(1.0 - xd / wx4)
-                + log(xd) * (num18 * log(1.0 - xd / wx3) + num18 * log(1.0 - xd / wx4)) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log((w7 + yd) / w7) * (-2.0 * num19 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * num19 * power_of<2>(log(1.0 + 1.0i * xd)) - 4.0 * num19 * ln2 * log((wx3 + xd) / wx3)
+                + log(xd) * (num18 * log(1.0 - xd / wx3) + num18 * log(1.0 - xd / wx4)) - (2.0 * 1.0i) * num18 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * num18 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num18 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log((w7 + yd) / w7) * (-2.0 * num19 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * num19 * power_of<2>(log(1.0 + 1.0i * xd)) - 4.0 * num19 * ln2 * log((wx3 + xd) / wx3)
                 - 4.0 * num19 * ln2 * log((wx4 + xd) / wx4) + log(1.0 - 1.0i * xd) * (4.0 * num19 * ln2 + 2.0 * num19 * log((wx3 - xd) / (1.0i + wx3)) + 2.0 * num19 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * num19 * log(xd)
                     + 2.0 * num19 * log((wx3 + xd) / (-1.0i + wx3)) + 2.0 * num19 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (4.0 * num19 * ln2 + 2.0 * num19 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * num19 * log((wx4 - xd) / (-1.0i + wx4))
                     + 4.0 * num19 * log(xd) + 2.0 * num19 * log((wx3 + xd) / (1.0i + wx3)) + 2.0 * num19 * log((wx4 + xd) / (1.0i + wx4))) - 4.0 * num19 * ln2 * log(1.0 - xd / wx3) - 4.0 * num19 * ln2 * log(1.0 - xd / wx4)
-                + log(xd) * (-2.0 * num19 * log((wx3 + xd) / wx3) - 2.0 * num19 * log((wx4 + xd) / wx4) - 2.0 * num19 * log(1.0 - xd / wx3) - 2.0 * num19 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) *
-                    T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log(1.0 - yd / w7) * (-2.0 * num20 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * num20 * power_of<2>(log(1.0 + 1.0i * xd)) - 4.0 * num20 * ln2 * log((wx3 + xd) / wx3)
+                + log(xd) * (-2.0 * num19 * log((wx3 + xd) / wx3) - 2.0 * num19 * log((wx4 + xd) / wx4) - 2.0 * num19 * log(1.0 - xd / wx3) - 2.0 * num19 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * num19 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) *
+                    T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (4.0 * 1.0i) * num19 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * num19 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (4.0 * 1.0i) * num19 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num19 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (4.0 * 1.0i) * num19 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log(1.0 - yd / w7) * (-2.0 * num20 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * num20 * power_of<2>(log(1.0 + 1.0i * xd)) - 4.0 * num20 * ln2 * log((wx3 + xd) / wx3)
                 - 4.0 * num20 * ln2 * log((wx4 + xd) / wx4) + log(1.0 - 1.0i * xd) * (4.0 * num20 * ln2 + 2.0 * num20 * log((wx3 - xd) / (1.0i + wx3)) + 2.0 * num20 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * num20 * log(xd)
                     + 2.0 * num20 * log((wx3 + xd) / (-1.0i + wx3)) + 2.0 * num20 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (4.0 * num20 * ln2 + 2.0 * num20 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * num20 * log((wx4 - xd) / (-1.0i + wx4))
                     + 4.0 * num20 * log(xd) + 2.0 * num20 * log((wx3 + xd) / (1.0i + wx3)) + 2.0 * num20 * log((wx4 + xd) / (1.0i + wx4))) - 4.0 * num20 * ln2 * log(1.0 - xd / wx3) - 4.0 * num20 * ln2 * log(1.0 - xd / wx4)
-                + log(xd) * (-2.0 * num20 * log((wx3 + xd) / wx3) - 2.0 * num20 * log((wx4 + xd) / wx4) - 2.0 * num20 * log(1.0 - xd / wx3) - 2.0 * num20 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * num20 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) *
-                    T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * num20 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx4) * (-4.0 * num16 * log(wx4 / (-1.0i + wx4)) + 2.0 * num16 * log((wx4 - xd) / (-1.0i + wx4))
+                + log(xd) * (-2.0 * num20 * log((wx3 + xd) / wx3) - 2.0 * num20 * log((wx4 + xd) / wx4) - 2.0 * num20 * log(1.0 - xd / wx3) - 2.0 * num20 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * num20 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) *
+                    T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (4.0 * 1.0i) * num20 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * num20 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (4.0 * 1.0i) * num20 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * num20 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (4.0 * 1.0i) * num20 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + c_li2_28 * (-4.0 * num16 * c_ln_28 + 2.0 * num16 * log((wx4 - xd) / (-1.0i + wx4))
                 + 2.0 * num16 * log((wx4 + xd) / (-1.0i + wx4)) - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * num16 * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx3 - xd) / (-1.0i + wx3))) * my_sign(imag((-1.0i + xd) / (-1.0i + wx3))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx3 - xd) / (-1.0i + wx3)) + (2.0 * 1.0i) * num16 * M_PI * power_of<2>(log((wx4 - xd) / (-1.0i + wx4))) * my_sign(imag((-1.0i + xd) / (-1.0i + wx4))) *
-                T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx4 - xd) / (-1.0i + wx4)) - 1.0i * num16 * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
-                + (4.0 * 1.0i) * num16 * M_PI * ln2 * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + power_of<2>(log(1.0 - 1.0i * xd)) * (-2.0 * num16 * log(-1.0i / xd) + (num16 * log(((-1.0i) * (wx3 - xd)) / ((1.0i + wx3) * xd))) / 2.0
+                T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx4 - xd) / (-1.0i + wx4)) - 1.0i * num16 * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_11 * my_sign(-real(wx3)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_12 * my_sign(real(wx3)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_13 * my_sign(-real(wx4)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_14 * my_sign(real(wx4)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_11 * my_sign(-real(wx3)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_12 * my_sign(real(wx3)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) - 1.0i * num16 * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_13 * my_sign(-real(wx4)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - 1.0i * num16 * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
+                + (4.0 * 1.0i) * num16 * M_PI * ln2 * c_ln_14 * my_sign(real(wx4)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + power_of<2>(log(1.0 - 1.0i * xd)) * (-2.0 * num16 * log(-1.0i / xd) + (num16 * log(((-1.0i) * (wx3 - xd)) / ((1.0i + wx3) * xd))) / 2.0
                 + (num16 * log(((-1.0i) * (wx4 - xd)) / ((1.0i + wx4) * xd))) / 2.0 - (num16 * log((wx3 + xd) / (-1.0i + wx3))) / 2.0 + (num16 * log(((-1.0i) * (wx3 + xd)) / ((-1.0i + wx3) * xd))) / 2.0 - (num16 * log((wx4 + xd) / (-1.0i + wx4))) / 2.0
                 + (num16 * log(((-1.0i) * (wx4 + xd)) / ((-1.0i + wx4) * xd))) / 2.0 + 1.0i * num16 * M_PI * my_sign(real(xd)) * T(1.0, (wx3 + xd) / wx3, 1.0 - 1.0i * xd) + 1.0i * num16 * M_PI * my_sign(real(xd)) * T(1.0, (wx4 + xd) / wx4, 1.0 - 1.0i * xd)
                 + 1.0i * num16 * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx3, 1.0 - 1.0i * xd) + 1.0i * num16 * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx4, 1.0 - 1.0i * xd))
@@ -464,11 +464,11 @@ namespace eos
                 + log(xd) * (-(num14 * log((wx3 + xd) / wx3)) - num14 * log((wx4 + xd) / wx4) - num14 * log(1.0 - xd / wx3) - num14 * log(1.0 - xd / wx4))
                 + (-2.0 * num18 * ln2 + num18 * log(1.0 - 1.0i * xd) + num18 * log(1.0 + 1.0i * xd) - num18 * log(xd)) * log((w5 - yd) / (1.0 + w5)) + (-2.0 * num18 * ln2 + num18 * log(1.0 - 1.0i * xd) + num18 * log(1.0 + 1.0i * xd) - num18 * log(xd)) *
                     log((w4 + yd) / (-1.0 + w4)) + (2.0 * num17 * ln2 - num17 * log(1.0 - 1.0i * xd) - num17 * log(1.0 + 1.0i * xd) + num17 * log(xd)) * log((w5 + yd) / (-1.0 + w5))
-                + (4.0 * num19 * ln2 - 2.0 * num19 * log(1.0 - 1.0i * xd) - 2.0 * num19 * log(1.0 + 1.0i * xd) + 2.0 * num19 * log(xd)) * log((w7 + yd) / (-1.0 + w7)) + (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * log((1.0 + w4) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w4) / 2.0)
+                + (4.0 * num19 * ln2 - 2.0 * num19 * log(1.0 - 1.0i * xd) - 2.0 * num19 * log(1.0 + 1.0i * xd) + 2.0 * num19 * log(xd)) * log((w7 + yd) / (-1.0 + w7)) + (2.0 * 1.0i) * num14 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * num14 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num14 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * num14 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num14 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * num14 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num14 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * num14 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num18 * M_PI * log((1.0 + w4) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w4) / 2.0)
                 - (2.0 * 1.0i) * num18 * M_PI * log((1.0 - w5) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w5) / 2.0) + (2.0 * 1.0i) * num19 * M_PI * log((1.0 + w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w7) / 2.0))
                 - 1.0i * num18 * M_PI * power_of<2>(log((w5 - yd) / (1.0 + w5))) * my_sign(imag((1.0 + yd) / (1.0 + w5))) * T(1.0, (1.0 - yd) / 2.0, (w5 - yd) / (1.0 + w5)) - 1.0i * num18 * M_PI * power_of<2>(log((w4 + yd) / (-1.0 + w4))) * my_sign(imag((1.0 + yd) / (1.0 - w4))) *
                 T(1.0, (1.0 - yd) / 2.0, (w4 + yd) / (-1.0 + w4)) + 1.0i * num19 * M_PI * power_of<2>(log((w7 + yd) / (-1.0 + w7))) * my_sign(imag((1.0 + yd) / (1.0 - w7))) * T(1.0, (1.0 - yd) / 2.0, (w7 + yd) / (-1.0 + w7))
@@ -488,10 +488,10 @@ namespace eos
                     log((w5 - yd) / (-1.0 + w5)) + (4.0 * num20 * ln2 - 2.0 * num20 * log(1.0 - 1.0i * xd) - 2.0 * num20 * log(1.0 + 1.0i * xd) + 2.0 * num20 * log(xd)) * log((w7 - yd) / (-1.0 + w7)) - num17 * log((w4 - yd) / (1.0 + w4)) * log((1.0 + yd) / 2.0)
                 + (2.0 * num18 * ln2 - num18 * log(1.0 - 1.0i * xd) - num18 * log(1.0 + 1.0i * xd) + num18 * log(xd)) * log((w4 + yd) / (1.0 + w4)) + log((1.0 + yd) / 2.0) * (num20 * log((w7 - yd) / (1.0 + w7)) - num17 * log((w5 + yd) / (-1.0 + w5)))
                 + (-2.0 * num17 * ln2 + num17 * log(1.0 - 1.0i * xd) + num17 * log(1.0 + 1.0i * xd) - num17 * log(xd)) * log((w5 + yd) / (1.0 + w5)) + (-4.0 * num19 * ln2 + 2.0 * num19 * log(1.0 - 1.0i * xd) + 2.0 * num19 * log(1.0 + 1.0i * xd) - 2.0 * num19 * log(xd)) *
-                    log((w7 + yd) / (1.0 + w7)) + (2.0 * 1.0i) * num15 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num15 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * num15 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num15 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * num15 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num15 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * num15 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num15 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                    log((w7 + yd) / (1.0 + w7)) + (2.0 * 1.0i) * num15 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num15 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * num15 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num15 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * num15 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * num15 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * num15 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * num15 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
                 - (2.0 * 1.0i) * num17 * M_PI * log((1.0 + w4) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w4) / 2.0) - (2.0 * 1.0i) * num17 * M_PI * log((1.0 - w5) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 - w5) / 2.0)
                 + (2.0 * 1.0i) * num20 * M_PI * log((1.0 + w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w7) / 2.0)) - 1.0i * num17 * M_PI * power_of<2>(log((w4 - yd) / (-1.0 + w4))) * my_sign(imag((-1.0 + yd) / (-1.0 + w4))) * T(1.0, (1.0 + yd) / 2.0, (w4 - yd) / (-1.0 + w4))
                 + 1.0i * num20 * M_PI * power_of<2>(log((w7 - yd) / (-1.0 + w7))) * my_sign(imag((-1.0 + yd) / (-1.0 + w7))) * T(1.0, (1.0 + yd) / 2.0, (w7 - yd) / (-1.0 + w7)) - 1.0i * num17 * M_PI * power_of<2>(log((w5 + yd) / (1.0 + w5))) * my_sign(imag((1.0 - yd) / (1.0 + w5))) *
@@ -506,7 +506,7 @@ namespace eos
                 + num19 * log((w7 + yd) / (-1.0 + w7)) - (2.0 * 1.0i) * num20 * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7) - (2.0 * 1.0i) * num19 * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 + yd, 1.0 - w7));
 
             const complex<double> part6 = + li2half * (-(num17 * log(w4 / (-1.0 + w4))) - num18 * log(w4 / (-1.0 + w4)) - num17 * log(w5 / (1.0 + w5)) - num18 * log(w5 / (1.0 + w5)) + num19 * log(w7 / (-1.0 + w7)) + num20 * log(w7 / (-1.0 + w7))
-                + 4.0 * num16 * log(wx3 / (-1.0i + wx3)) + 4.0 * num16 * log(wx3 / (1.0i + wx3)) + 4.0 * num16 * log(wx4 / (-1.0i + wx4)) + 4.0 * num16 * log(wx4 / (1.0i + wx4)) - 2.0 * num16 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * num16 * log((wx3 - xd) / (1.0i + wx3))
+                + 4.0 * num16 * c_ln_18 + 4.0 * num16 * c_ln_21 + 4.0 * num16 * c_ln_28 + 4.0 * num16 * c_ln_31 - 2.0 * num16 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * num16 * log((wx3 - xd) / (1.0i + wx3))
                 - 2.0 * num16 * log((wx4 - xd) / (-1.0i + wx4)) - 2.0 * num16 * log((wx4 - xd) / (1.0i + wx4)) - 2.0 * num16 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * num16 * log((wx3 + xd) / (1.0i + wx3)) - 2.0 * num16 * log((wx4 + xd) / (-1.0i + wx4))
                 - 2.0 * num16 * log((wx4 + xd) / (1.0i + wx4)) - 4.0 * num15 * ln1myd + num17 * log((w4 - yd) / (-1.0 + w4)) + num18 * log((w5 - yd) / (1.0 + w5)) - num20 * log((w7 - yd) / (-1.0 + w7)) - 4.0 * num14 * ln1pyd
                 + num18 * log((w4 + yd) / (-1.0 + w4)) + 2.0 * num18 * log((w4 + yd) / w4) + 2.0 * num17 * log((w5 + yd) / w5) + num17 * log((w5 + yd) / (1.0 + w5)) - num19 * log((w7 + yd) / (-1.0 + w7)) - 8.0 * num19 * log((w7 + yd) / w7)
@@ -518,10 +518,10 @@ namespace eos
                 - (8.0 * 1.0i) * num20 * M_PI * ln2 * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 + w7) + 1.0i * num20 * M_PI * power_of<2>(log(1.0 + w7)) * my_sign(-imag(w7)) * T(1.0, 1.0 + yd, 1.0 + w7)
                 + log(xd) * (num16 * log((1.0i - xd) / (1.0i + wx4)) * log((wx4 + xd) / wx4) + num16 * log((1.0i + xd) / (1.0i - wx4)) * log((wx4 + xd) / wx4) + num16 * log((-1.0i + xd) / (-1.0i + wx3)) * log(1.0 - xd / wx3)
                 + num16 * log((1.0i + xd) / (1.0i + wx3)) * log(1.0 - xd / wx3) + num16 * log((-1.0i + xd) / (-1.0i + wx4)) * log(1.0 - xd / wx4) + num16 * log((1.0i + xd) / (1.0i + wx4)) * log(1.0 - xd / wx4)
-                + (2.0 * 1.0i) * num16 * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + (2.0 * 1.0i) * num16 * M_PI * log((1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                + (2.0 * 1.0i) * num16 * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + (2.0 * 1.0i) * num16 * M_PI * log((1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                + (2.0 * 1.0i) * num16 * M_PI * log((-1.0i + wx3) / wx3) * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + (2.0 * 1.0i) * num16 * M_PI * log((1.0i + wx3) / wx3) * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
-                + (2.0 * 1.0i) * num16 * M_PI * log((-1.0i + wx4) / wx4) * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) + (2.0 * 1.0i) * num16 * M_PI * log((1.0i + wx4) / wx4) * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
+                + (2.0 * 1.0i) * num16 * M_PI * c_ln_11 * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + (2.0 * 1.0i) * num16 * M_PI * c_ln_12 * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                + (2.0 * 1.0i) * num16 * M_PI * c_ln_13 * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + (2.0 * 1.0i) * num16 * M_PI * c_ln_14 * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                + (2.0 * 1.0i) * num16 * M_PI * c_ln_11 * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + (2.0 * 1.0i) * num16 * M_PI * c_ln_12 * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
+                + (2.0 * 1.0i) * num16 * M_PI * c_ln_13 * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) + (2.0 * 1.0i) * num16 * M_PI * c_ln_14 * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
                 - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4) + (2.0 * 1.0i) * num18 * M_PI * log(1.0 + w4) * my_sign(-imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 + w4)
                 + (2.0 * 1.0i) * num18 * M_PI * log(1.0 - w5) * my_sign(imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 - w5) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 + w5)
                 + (4.0 * 1.0i) * num20 * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 - w7) - (4.0 * 1.0i) * num19 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 + w7)
@@ -529,25 +529,25 @@ namespace eos
                 + (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w5) * my_sign(imag(w5inv)) * T(1.0, 1.0 + yd, 1.0 - w5) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 + yd, 1.0 + w5)
                 + (4.0 * 1.0i) * num19 * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 - w7) - (4.0 * 1.0i) * num20 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 + w7))
                 + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * xd) * (-(num16 * log((wx3 + xd) / (-1.0i + wx3))) - num16 * log((wx3 + xd) / (1.0i + wx3)) - num16 * log((wx4 + xd) / (-1.0i + wx4)) - num16 * log((wx4 + xd) / (1.0i + wx4)))
-                + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xd))) *
-                    T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
-                + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4)
+                + (4.0 * 1.0i) * num16 * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i + xd))) *
+                    T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * c_ln_40 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
+                + (4.0 * 1.0i) * num16 * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * num16 * M_PI * c_ln_7 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_8 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * c_ln_9 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_10 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4)
                 - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + w4) * my_sign(-imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 + w4) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - w5) * my_sign(imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 - w5)
                 + (2.0 * 1.0i) * num17 * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 + w5) - (4.0 * 1.0i) * num20 * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 - w7)
                 + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 + w7) + (2.0 * 1.0i) * num18 * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 + yd, 1.0 - w4)
                 - (2.0 * 1.0i) * num17 * M_PI * log(1.0 + w4) * my_sign(-imag(w4inv)) * T(1.0, 1.0 + yd, 1.0 + w4) - (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w5) * my_sign(imag(w5inv)) * T(1.0, 1.0 + yd, 1.0 - w5)
                 + (2.0 * 1.0i) * num18 * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 + yd, 1.0 + w5) - (4.0 * 1.0i) * num19 * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 - w7)
-                + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 + w7)) + log(1.0 + 1.0i * xd) * ((4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
-                + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i - xd))) *
-                    T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (4.0 * 1.0i) * num16 * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num16 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                + (4.0 * 1.0i) * num20 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + yd, 1.0 + w7)) + log(1.0 + 1.0i * xd) * ((4.0 * 1.0i) * num16 * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
+                + (4.0 * 1.0i) * num16 * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (4.0 * 1.0i) * num16 * M_PI * c_ln_40 * my_sign(2.0 * real(1.0 / (1.0i - xd))) *
+                    T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (4.0 * 1.0i) * num16 * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_7 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num16 * M_PI * c_ln_8 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num16 * M_PI * c_ln_9 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num16 * M_PI * c_ln_10 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
                 + (2.0 * 1.0i) * num17 * M_PI * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4) - (2.0 * 1.0i) * num18 * M_PI * log(1.0 + w4) * my_sign(-imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 + w4)
                 - (2.0 * 1.0i) * num18 * M_PI * log(1.0 - w5) * my_sign(imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 - w5) + (2.0 * 1.0i) * num17 * M_PI * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 + w5)
                 - (4.0 * 1.0i) * num20 * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 - w7) + (4.0 * 1.0i) * num19 * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 + w7)
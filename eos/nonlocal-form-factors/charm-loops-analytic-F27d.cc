@@ -172,8 +172,8 @@ namespace eos
 
             const complex<double> term1 = (2.0 * (yd2 * (-1.0 + yd2 * (17.0 + 24.0 * ln2)) + xd8 * yd2 * (-1.0 + yd2 * (17.0 + 24.0 * ln2))
                     + 2.0 * xd4 * ((-yd2) * (99.0 + 32.0 * ln2) + yd4 * (39.0 + 72.0 * ln2) + 4.0 * (27.0 + ln256))
-                    + 4.0 * xd2 * (-1.0 + yd2 * (31.0 - 8.0 * ln2) + ln256 + 2.0 * yd4 * (-7.0 + log(4096.0)))
-                    + 4.0 * xd6 * (-1.0 + yd2 * (31.0 - 8.0 * ln2) + ln256 + 2.0 * yd4 * (-7.0 + log(4096.0))))) / denom1 + (32.0 * lnmuhat) / 9.0;
+                    + 4.0 * xd2 * (-1.0 + yd2 * (31.0 - 8.0 * ln2) + ln256 + 2.0 * yd4 * (-7.0 + c_ln_6))
+                    + 4.0 * xd6 * (-1.0 + yd2 * (31.0 - 8.0 * ln2) + ln256 + 2.0 * yd4 * (-7.0 + c_ln_6)))) / denom1 + (32.0 * lnmuhat) / 9.0;
 
             // Polynomials in xd and yd that contain Log(2^n) terms
 
@@ -226,8 +226,8 @@ namespace eos
             const complex<double> logs15 = 256.0 * xd2 * power_of<4>(1.0 + xd2) * (-1.0 + yd) * yd2 * (1.0 + yd) * (3.0 * yd - ln4 + yd2 * ln4);
             const complex<double> logs16 = 8.0 * power_of<2>(1.0 + xd2) * (-1.0 + yd) * (1.0 + yd) * (yd2 + 3.0 * yd4 + xd8 * (yd2 + 3.0 * yd4)
                     + 2.0 * xd4 * (-60.0 + yd2 * (107.0 - 128.0 * ln2) + yd4 * (-99.0 + 128.0 * ln2))
-                    + 4.0 * xd2 * (1.0 - yd2 * (5.0 + 32.0 * ln2) + 8.0 * yd4 * (-1.0 + log(16.0)))
-                    + 4.0 * xd6 * (1.0 - yd2 * (5.0 + 32.0 * ln2) + 8.0 * yd4 * (-1.0 + log(16.0))));
+                    + 4.0 * xd2 * (1.0 - yd2 * (5.0 + 32.0 * ln2) + 8.0 * yd4 * (-1.0 + c_ln_4))
+                    + 4.0 * xd6 * (1.0 - yd2 * (5.0 + 32.0 * ln2) + 8.0 * yd4 * (-1.0 + c_ln_4)));
             const complex<double> logs17 = 2.0 * power_of<2>(1.0 + xd2) * (yd6 * (-1.0 + yd2) * ln2 + xd20 * yd6 * (-1.0 + yd2) * ln2
                     + 128.0 * 1.0i * xd5 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2 - 1664.0 * 1.0i * xd7 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2
                     + 1664.0 * 1.0i * xd13 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2 - 128.0 * 1.0i * xd15 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2
@@ -236,13 +236,13 @@ namespace eos
                         + yd6 * (-54.0 + 359.0 * ln2)) + 8.0 * xd14 * yd2 * (-8.0 + yd4 * (128.0 - 147.0 * ln2) + 20.0 * ln2 - 4.0 * yd2 * (-9.0 + 58.0 * ln2)
                         + yd6 * (-54.0 + 359.0 * ln2)) + xd4 * (-16.0 * yd2 * ln2 + 16.0 * yd4 * (-1.0 + 19.0 * ln2) + 9.0 * yd8 * (16.0 + 21.0 * ln2)
                         - yd6 * (32.0 + 477.0 * ln2)) + xd16 * (-16.0 * yd2 * ln2 + 16.0 * yd4 * (-1.0 + 19.0 * ln2) + 9.0 * yd8 * (16.0 + 21.0 * ln2)
-                        - yd6 * (32.0 + 477.0 * ln2)) - 2.0 * xd2 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + log(16.0))
-                    - 2.0 * xd18 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + log(16.0))
+                        - yd6 * (32.0 + 477.0 * ln2)) - 2.0 * xd2 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + c_ln_4)
+                    - 2.0 * xd18 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + c_ln_4)
                     + 4.0 * xd10 * (-16.0 * yd2 * (134.0 + 2029.0 * ln2) + yd8 * (222.0 + 8827.0 * ln2) + 4.0 * yd4 * (764.0 + 14089.0 * ln2)
-                        - yd6 * (1408.0 + 36303.0 * ln2) + 512.0 * (2.0 + log(128.0))) - 2.0 * xd8 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2)
-                        + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2) - 56.0 * yd2 * (16.0 + log(128.0)))
+                        - yd6 * (1408.0 + 36303.0 * ln2) + 512.0 * (2.0 + c_ln_3)) - 2.0 * xd8 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2)
+                        + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2) - 56.0 * yd2 * (16.0 + c_ln_3))
                     - 2.0 * xd12 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2) + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2)
-                        - 56.0 * yd2 * (16.0 + log(128.0))));
+                        - 56.0 * yd2 * (16.0 + c_ln_3)));
             const complex<double> logs18 = 2.0 * power_of<2>(1.0 + xd2) * (yd6 * (-1.0 + yd2) * ln2 + xd20 * yd6 * (-1.0 + yd2) * ln2
                     - 128.0 * 1.0i * xd5 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2 + 1664.0 * 1.0i * xd7 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2
                     - 1664.0 * 1.0i * xd13 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2 + 128.0 * 1.0i * xd15 * yd2 * power_of<2>(-1.0 + yd2) * (-1.0 + 3.0 * yd2) * ln2
@@ -251,13 +251,13 @@ namespace eos
                       + yd6 * (-54.0 + 359.0 * ln2)) + 8.0 * xd14 * yd2 * (-8.0 + yd4 * (128.0 - 147.0 * ln2) + 20.0 * ln2 - 4.0 * yd2 * (-9.0 + 58.0 * ln2)
                       + yd6 * (-54.0 + 359.0 * ln2)) + xd4 * (-16.0 * yd2 * ln2 + 16.0 * yd4 * (-1.0 + 19.0 * ln2) + 9.0 * yd8 * (16.0 + 21.0 * ln2)
                       - yd6 * (32.0 + 477.0 * ln2)) + xd16 * (-16.0 * yd2 * ln2 + 16.0 * yd4 * (-1.0 + 19.0 * ln2) + 9.0 * yd8 * (16.0 + 21.0 * ln2)
-                      - yd6 * (32.0 + 477.0 * ln2)) - 2.0 * xd2 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + log(16.0))
-                    - 2.0 * xd18 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + log(16.0))
+                      - yd6 * (32.0 + 477.0 * ln2)) - 2.0 * xd2 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + c_ln_4)
+                    - 2.0 * xd18 * yd4 * (-27.0 * yd2 * ln2 + yd4 * (6.0 + 23.0 * ln2) + c_ln_4)
                     + 4.0 * xd10 * (-16.0 * yd2 * (134.0 + 2029.0 * ln2) + yd8 * (222.0 + 8827.0 * ln2) + 4.0 * yd4 * (764.0 + 14089.0 * ln2)
-                      - yd6 * (1408.0 + 36303.0 * ln2) + 512.0 * (2.0 + log(128.0))) - 2.0 * xd8 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2)
-                      + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2) - 56.0 * yd2 * (16.0 + log(128.0)))
+                      - yd6 * (1408.0 + 36303.0 * ln2) + 512.0 * (2.0 + c_ln_3)) - 2.0 * xd8 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2)
+                      + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2) - 56.0 * yd2 * (16.0 + c_ln_3))
                     - 2.0 * xd12 * (512.0 * ln2 + 8.0 * yd4 * (-17.0 + 2307.0 * ln2) + 3.0 * yd8 * (24.0 + 3445.0 * ln2) - 3.0 * yd6 * (48.0 + 9637.0 * ln2)
-                      - 56.0 * yd2 * (16.0 + log(128.0))));
+                      - 56.0 * yd2 * (16.0 + c_ln_3)));
             const complex<double> logs19 = power_of<2>(1.0 + xd2) * (-1.0 + yd) * (1.0 + yd) * (yd6 + xd20 * yd6 + 128.0 * 1.0i * xd5 * (yd2 - 4.0 * yd4 + 3.0 * yd6)
                     - 1664.0 * 1.0i * xd7 * (yd2 - 4.0 * yd4 + 3.0 * yd6) + 1664.0 * 1.0i * xd13 * (yd2 - 4.0 * yd4 + 3.0 * yd6)
                     - 128.0 * 1.0i * xd15 * (yd2 - 4.0 * yd4 + 3.0 * yd6) + 256.0 * 1.0i * xd9 * (-32.0 + 153.0 * yd2 - 196.0 * yd4 + 75.0 * yd6)
@@ -294,8 +294,8 @@ namespace eos
                         + yd4 * (359.0 + 568.0 * ln2)) - 4.0 * xd10 * (yd4 * (27476.0 - 45208.0 * ln2) - 512.0 * (-7.0 + 36.0 * ln2)
                         + 16.0 * yd2 * (-1805.0 + 2036.0 * ln2) + yd6 * (-8827.0 + 15608.0 * ln2))
                     + 2.0 * xd8 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2) + 8.0 * yd2 * (15.0 + 1988.0 * ln2)
-                        + 512.0 * (1.0 + log(16.0))) + 2.0 * xd12 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2)
-                        + 8.0 * yd2 * (15.0 + 1988.0 * ln2) + 512.0 * (1.0 + log(16.0))) + 2.0 * xd2 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256)
+                        + 512.0 * (1.0 + c_ln_4)) + 2.0 * xd12 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2)
+                        + 8.0 * yd2 * (15.0 + 1988.0 * ln2) + 512.0 * (1.0 + c_ln_4)) + 2.0 * xd2 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256)
                     + 2.0 * xd18 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256));
             const complex<double> logs22 = power_of<2>(1.0 + xd2) * (-1.0 + yd) * (1.0 + yd) * (yd6 + xd20 * yd6 - 128.0 * 1.0i * xd5 * (yd2 - 4.0 * yd4 + 3.0 * yd6)
                     + 1664.0 * 1.0i * xd7 * (yd2 - 4.0 * yd4 + 3.0 * yd6) - 1664.0 * 1.0i * xd13 * (yd2 - 4.0 * yd4 + 3.0 * yd6)
@@ -307,14 +307,14 @@ namespace eos
                         + yd4 * (359.0 + 568.0 * ln2)) - 4.0 * xd10 * (yd4 * (27476.0 - 45208.0 * ln2) - 512.0 * (-7.0 + 36.0 * ln2)
                         + 16.0 * yd2 * (-1805.0 + 2036.0 * ln2) + yd6 * (-8827.0 + 15608.0 * ln2))
                     + 2.0 * xd8 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2) + 8.0 * yd2 * (15.0 + 1988.0 * ln2)
-                        + 512.0 * (1.0 + log(16.0))) + 2.0 * xd12 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2)
-                        + 8.0 * yd2 * (15.0 + 1988.0 * ln2) + 512.0 * (1.0 + log(16.0))) + 2.0 * xd2 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256)
+                        + 512.0 * (1.0 + c_ln_4)) + 2.0 * xd12 * (-144.0 * yd4 * (-129.0 + 16.0 * ln2) + 3.0 * yd6 * (-3445.0 + 1184.0 * ln2)
+                        + 8.0 * yd2 * (15.0 + 1988.0 * ln2) + 512.0 * (1.0 + c_ln_4)) + 2.0 * xd2 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256)
                     + 2.0 * xd18 * yd4 * (4.0 + yd2 * (-23.0 + 24.0 * ln2) + ln256));
             const complex<double> logs23 = 2.0 * power_of<2>(1.0 + xd2) * (-4.0 * xd4 * yd2 * (-4.0 + yd4 * (195.0 - 72.0 * ln2) + 32.0 * ln2 - 12.0 * yd2 * (1.0 + 20.0 * ln2)
                         + 7.0 * yd6 * (-11.0 + 40.0 * ln2)) - 4.0 * xd12 * yd2 * (-4.0 + yd4 * (195.0 - 72.0 * ln2) + 32.0 * ln2 - 12.0 * yd2 * (1.0 + 20.0 * ln2)
                         + 7.0 * yd6 * (-11.0 + 40.0 * ln2)) - 2.0 * xd8 * (512.0 - 16.0 * yd2 * (51.0 + 616.0 * ln2) + 16.0 * yd4 * (103.0 + 956.0 * ln2)
-                        + yd8 * (59.0 + 1448.0 * ln2) - yd6 * (653.0 + 6888.0 * ln2)) + 8.0 * xd2 * (5.0 * yd6 - 4.0 * yd4 * ln2 + yd8 * (-11.0 + log(16.0)))
-                    + 8.0 * xd14 * (5.0 * yd6 - 4.0 * yd4 * ln2 + yd8 * (-11.0 + log(16.0)))
+                        + yd8 * (59.0 + 1448.0 * ln2) - yd6 * (653.0 + 6888.0 * ln2)) + 8.0 * xd2 * (5.0 * yd6 - 4.0 * yd4 * ln2 + yd8 * (-11.0 + c_ln_4))
+                    + 8.0 * xd14 * (5.0 * yd6 - 4.0 * yd4 * ln2 + yd8 * (-11.0 + c_ln_4))
                     + 8.0 * xd6 * yd2 * (yd4 * (107.0 - 2176.0 * ln2) + 7.0 * yd6 * (-3.0 + 100.0 * ln2) + 4.0 * yd2 * (-50.0 + 321.0 * ln2)
                         + 24.0 * (-1.0 + ln256)) + 8.0 * xd10 * yd2 * (yd4 * (107.0 - 2176.0 * ln2) + 7.0 * yd6 * (-3.0 + 100.0 * ln2)
                         + 4.0 * yd2 * (-50.0 + 321.0 * ln2) + 24.0 * (-1.0 + ln256)) + yd6 * (-1.0 - 8.0 * ln2 + yd2 * (7.0 + ln256))
@@ -343,7 +343,7 @@ namespace eos
                     + xd12 * yd5 * (3.0 + yd2 * (13.0 - 8.0 * ln2) + ln256 - yd * (5.0 + ln256) + yd3 * (13.0 + ln256)));
 
             const complex<double> f27dPart1 = term1 + (logs19 / denom4 + logs20 / denom4 + logs24 / denom7 + logs25 / denom8) * li2half
-                + (-(num12 / denom5) - num13 / denom5) * dilog(-1.0i / (-1.0i + wx3)) + (-(num12 / denom5) - num13 / denom5) * dilog(1.0i / (1.0i + wx3)) + (-(num12 / denom5) - num13 / denom5) * dilog(-1.0i / (-1.0i + wx4)) + (-(num12 / denom5) - num13 / denom5) * dilog(1.0i / (1.0i + wx4))
+                + (-(num12 / denom5) - num13 / denom5) * c_li2_1 + (-(num12 / denom5) - num13 / denom5) * c_li2_2 + (-(num12 / denom5) - num13 / denom5) * c_li2_3 + (-(num12 / denom5) - num13 / denom5) * c_li2_4
                 + (num12 * dilog((1.0i - xd) / (1.0i + wx3))) / denom5 + (num12 * dilog((1.0i - xd) / (1.0i + wx4))) / denom5 - (logs19 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd)) / denom4 + (num5 * dilog((-1.0i) * xd)) / denom4 + (num4 * dilog(1.0i * xd)) / denom4
                 - (num12 * dilog(-(xd / wx3))) / denom5 - (num13 * dilog(xd / wx3)) / denom5 - (num12 * dilog(-(xd / wx4))) / denom5 - (num13 * dilog(xd / wx4)) / denom5 + (num13 * dilog((-1.0i + xd) / (-1.0i + wx3))) / denom5
                 + (num13 * dilog((-1.0i + xd) / (-1.0i + wx4))) / denom5 - (logs20 * dilog((-0.5 * 1.0i) * (1.0i + xd))) / denom4 + (num12 * dilog((1.0i + xd) / (1.0i - wx3))) / denom5 + (num13 * dilog((1.0i + xd) / (1.0i + wx3))) / denom5
@@ -356,10 +356,10 @@ namespace eos
                 - (2.0 * num13 * ln2 * log(1.0 - xd / wx4)) / denom5 + log(xd) * (num1 / denom1 - (num12 * log((wx3 + xd) / wx3)) / denom5 - (num12 * log((wx4 + xd) / wx4)) / denom5 - (num13 * log(1.0 - xd / wx3)) / denom5 - (num13 * log(1.0 - xd / wx4)) / denom5)
                 + (logs23 / denom6 + (logs24 * ln2) / denom7 + (logs11 * log(1.0 - 1.0i * xd)) / denom2 + (logs11 * log(1.0 + 1.0i * xd)) / denom2 + (num2 * log(xd)) / denom2) * ln1myd - (logs24 * power_of<2>(ln1myd)) / (2.0 * denom7)
                 + (-(logs23 / denom6) + (logs25 * ln2) / denom8 + (logs12 * log(1.0 - 1.0i * xd)) / denom2 + (logs12 * log(1.0 + 1.0i * xd)) / denom2 - (num2 * log(xd)) / denom2) * ln1pyd - (logs25 * power_of<2>(ln1pyd)) / (2.0 * denom8)
-                + ((2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)) / denom5 + ((2.0 * 1.0i) * num12 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)) / denom5
-                + ((2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)) / denom5 + ((2.0 * 1.0i) * num12 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)) / denom5
-                + ((2.0 * 1.0i) * num12 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)) / denom5 + ((2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) / denom5
-                + ((2.0 * 1.0i) * num12 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) / denom5 + ((2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) / denom5;
+                + ((2.0 * 1.0i) * num13 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)) / denom5 + ((2.0 * 1.0i) * num12 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)) / denom5
+                + ((2.0 * 1.0i) * num13 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)) / denom5 + ((2.0 * 1.0i) * num12 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)) / denom5
+                + ((2.0 * 1.0i) * num12 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)) / denom5 + ((2.0 * 1.0i) * num13 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) / denom5
+                + ((2.0 * 1.0i) * num12 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) / denom5 + ((2.0 * 1.0i) * num13 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) / denom5;
 
             const complex<double> f27dPart21 = (-(logs2 * pisqu * ln2) / 6.0 - (num11 * pisqu * ln2) / 12.0 - (num7 * pisqu * ln2) / 12.0 + (2.0 * logs1 - logs7 - logs8) * li3half + (logs1 - logs16 - logs2 - num9) * trilog(1.0 / 2.0 - (1.0i / 2.0) * xd) + (logs16 + num10 + num9) * trilog(1.0 - 1.0i * xd) + (logs1 - logs16 - logs2 - num9) * trilog((1.0 + 1.0i * xd) / 2.0)
                 + (logs16 + num10 + num9) * trilog(1.0 + 1.0i * xd) + (-logs16 + 2.0 * num9) * trilog((-1.0i) * xd) + (-logs16 + 2.0 * num9) * trilog(1.0i * xd) - (num9 * trilog(-xd2)) / 2.0 - logs16 * trilog(xd / (-1.0i + xd)) + (logs16 + num9) * trilog((2.0 * xd) / (-1.0i + xd)) - logs16 * trilog(xd / (1.0i + xd)) + (logs16 + num9) * trilog((2.0 * xd) / (1.0i + xd))
@@ -368,13 +368,13 @@ namespace eos
                 + (logs7 * pisqu * ln2) / 6.0 + (logs8 * pisqu * ln2) / 6.0 + (logs9 * pisqu * ln2) / 12.0 - (2.0 * logs1 * power_of<3>(ln2)) / 3.0 - (logs10 * power_of<3>(ln2)) / 6.0 + (logs16 * power_of<3>(ln2)) / 3.0 + (logs2 * power_of<3>(ln2)) / 3.0 - (logs5 * power_of<3>(ln2)) / 3.0 - (logs6 * power_of<3>(ln2)) / 3.0 - (logs7 * power_of<3>(ln2)) / 3.0 - (logs8 * power_of<3>(ln2)) / 3.0 - (logs9 * power_of<3>(ln2)) / 6.0
                 + (num11 * power_of<3>(ln2)) / 6.0 + (num7 * power_of<3>(ln2)) / 6.0 + (num9 * power_of<3>(ln2)) / 3.0 + (logs5 * pisqu * ln4) / 12.0 + (logs6 * pisqu * ln4) / 12.0 - (num9 * pisqu * ln4) / 12.0 + (-logs16 - num10) * dilog(1.0 - 1.0i * xd) * log(1.0 - 1.0i * xd) + (logs2 / 6.0 - num9 / 6.0) * power_of<3>(log(1.0 - 1.0i * xd)) + (-logs16 - num10) * dilog(1.0 + 1.0i * xd) * log(1.0 + 1.0i * xd)
                 + (logs2 / 6.0 - num9 / 6.0) * power_of<3>(log(1.0 + 1.0i * xd)) + dilog(1.0i * xd) * (-(num10 * log(1.0 - 1.0i * xd)) + logs16 * log(1.0 + 1.0i * xd)) + dilog((-1.0i) * xd) * (logs16 * log(1.0 - 1.0i * xd) - num10 * log(1.0 + 1.0i * xd)) + ((num9 * pisqu) / 12.0 - (num9 * ln2squ) / 2.0) * log((-1.0i) * xd)
-                + dilog(1.0 / 2.0 - (1.0i / 2.0) * xd) * (num9 * log(-1.0i) + (-logs1 + logs2) * log(1.0 - 1.0i * xd) + (-logs1 + logs2) * log(1.0 + 1.0i * xd) - num9 * log((-1.0i) * xd)) + ((num9 * pisqu) / 12.0 - (num9 * ln2squ) / 2.0) * log(1.0i * xd)
-                + dilog((1.0 + 1.0i * xd) / 2.0) * (num9 * log(1.0i) + (-logs1 + logs2) * log(1.0 - 1.0i * xd) + (-logs1 + logs2) * log(1.0 + 1.0i * xd) - num9 * log(1.0i * xd)) + log(1.0 + 1.0i * xd) * ((logs1 * pisqu) / 12.0 + (logs16 * pisqu) / 12.0 - (logs2 * pisqu) / 12.0 - (num9 * pisqu) / 12.0 + (logs2 * ln2squ) / 2.0 - num9 * log(1.0i) * ln2 - (logs1 * ln2squ) / 2.0
-                - (logs16 * ln2squ) / 2.0 - (num9 * ln2squ) / 2.0 + num9 * ln2 * log(1.0i * xd)) + log(1.0 - 1.0i * xd) * ((logs1 * pisqu) / 12.0 + (logs16 * pisqu) / 12.0 - (logs2 * pisqu) / 12.0 - (num9 * pisqu) / 12.0 + (logs2 * ln2squ) / 2.0 - num9 * log(-1.0i) * ln2 - (logs1 * ln2squ) / 2.0 - (logs16 * ln2squ) / 2.0 - (num9 * ln2squ) / 2.0
+                + dilog(1.0 / 2.0 - (1.0i / 2.0) * xd) * (num9 * c_ln_43 + (-logs1 + logs2) * log(1.0 - 1.0i * xd) + (-logs1 + logs2) * log(1.0 + 1.0i * xd) - num9 * log((-1.0i) * xd)) + ((num9 * pisqu) / 12.0 - (num9 * ln2squ) / 2.0) * log(1.0i * xd)
+                + dilog((1.0 + 1.0i * xd) / 2.0) * (num9 * c_ln_44 + (-logs1 + logs2) * log(1.0 - 1.0i * xd) + (-logs1 + logs2) * log(1.0 + 1.0i * xd) - num9 * log(1.0i * xd)) + log(1.0 + 1.0i * xd) * ((logs1 * pisqu) / 12.0 + (logs16 * pisqu) / 12.0 - (logs2 * pisqu) / 12.0 - (num9 * pisqu) / 12.0 + (logs2 * ln2squ) / 2.0 - num9 * c_ln_44 * ln2 - (logs1 * ln2squ) / 2.0
+                - (logs16 * ln2squ) / 2.0 - (num9 * ln2squ) / 2.0 + num9 * ln2 * log(1.0i * xd)) + log(1.0 - 1.0i * xd) * ((logs1 * pisqu) / 12.0 + (logs16 * pisqu) / 12.0 - (logs2 * pisqu) / 12.0 - (num9 * pisqu) / 12.0 + (logs2 * ln2squ) / 2.0 - num9 * c_ln_43 * ln2 - (logs1 * ln2squ) / 2.0 - (logs16 * ln2squ) / 2.0 - (num9 * ln2squ) / 2.0
                 + logs2 * log((1.0 + 1.0i * xd) / 2.0) * log(1.0 + 1.0i * xd) + num9 * ln2 * log((-1.0i) * xd) + log(1.0 + 1.0i * xd) * (2.0 * logs1 * ln2 + logs2 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - num9 * log((-1.0i) * xd) - num9 * log(1.0i * xd)))
                 + power_of<2>(log(1.0 + 1.0i * xd)) * ((logs16 * ln2) / 2.0 - (logs2 * ln64) / 12.0 - (logs1 * log(1.0 / 2.0 - (1.0i / 2.0) * xd)) / 2.0 + ((-1.0 / 2.0) * logs16 - num10 / 2.0) * log((-1.0i) * xd) + (num9 * log((-2.0 * 1.0i) * xd)) / 2.0 - (num10 * log(xd)) / 2.0)
                 + power_of<2>(log(1.0 - 1.0i * xd)) * ((logs16 * ln2) / 2.0 - (logs2 * ln64) / 12.0 - (logs1 * log((1.0 + 1.0i * xd) / 2.0)) / 2.0 + ((-1.0 / 2.0) * logs16 - num10 / 2.0) * log(1.0i * xd) + (num9 * log((2.0 * 1.0i) * xd)) / 2.0 - (num10 * log(xd)) / 2.0)
-                + li2half * (-(num9 * log(-1.0i)) - num9 * log(1.0i) + (-logs3 - logs4) * log(1.0 - 1.0i * xd) + (-logs3 - logs4) * log(1.0 + 1.0i * xd) + (num3 + num6) * log(xd)) + (-2.0 * logs5 - logs9) * dilog(1.0 - yd) * ln1myd - (num11 * power_of<3>(ln1myd)) / 6.0
+                + li2half * (-(num9 * c_ln_43) - num9 * c_ln_44 + (-logs3 - logs4) * log(1.0 - 1.0i * xd) + (-logs3 - logs4) * log(1.0 + 1.0i * xd) + (num3 + num6) * log(xd)) + (-2.0 * logs5 - logs9) * dilog(1.0 - yd) * ln1myd - (num11 * power_of<3>(ln1myd)) / 6.0
                 + power_of<2>(ln1myd) * ((-1.0 / 2.0) * (logs10 * ln2) - (logs5 * ln64) / 12.0 - (num11 * ln64) / 12.0 + (num6 * log(1.0 - 1.0i * xd)) / 2.0 + (num6 * log(1.0 + 1.0i * xd)) / 2.0 - (num6 * log(xd)) / 2.0 + (logs6 * log((1.0 - yd) / 8.0)) / 6.0 + (-logs5 - logs6 / 2.0 - logs9 / 2.0) * log(yd) + ((-1.0 / 2.0) * logs7 - logs8) * log((1.0 + yd) / 2.0))
                 + (-logs10 - 2.0 * logs6) * dilog(1.0 + yd) * ln1pyd + ((logs5 * pisqu) / 12.0 - (logs6 * pisqu) / 12.0 + (logs7 * pisqu) / 12.0 - (logs9 * pisqu) / 12.0 - (num7 * pisqu) / 12.0 + (num7 * ln2squ) / 2.0 + (logs5 * ln2squ) / 2.0 + (logs6 * ln2squ) / 2.0 - (logs7 * ln2squ) / 2.0 + (logs9 * ln2squ) / 2.0 - logs4 * ln2 * log(1.0 - 1.0i * xd)
                 - logs4 * ln2 * log(1.0 + 1.0i * xd) + num3 * ln2 * log(xd)) * ln1pyd + ((-1.0 / 2.0) * (logs9 * ln2) - (logs6 * ln64) / 12.0 - (num7 * ln64) / 12.0 + (num3 * log(1.0 - 1.0i * xd)) / 2.0 + (num3 * log(1.0 + 1.0i * xd)) / 2.0 - (num3 * log(xd)) / 2.0 + (-logs7 - logs8 / 2.0) * log((1.0 - yd) / 2.0)
@@ -386,36 +386,36 @@ namespace eos
                 + (7.0 * num7) / 8.0 - num9 / 4.0) * zeta3) / denom3;
 
             const complex<double> f27dPart3 = num21 * (-16.0 * power_of<2>(li2half) + (dilog((w5 - yd) / (-1.0 + w5)) + dilog(-(yd / w5)) + dilog(yd / w5) + dilog((w5 + yd) / (-1.0 + w5)) + log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) + log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5)) * (2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(xd) * (4.0 * log((wx3 + xd) / wx3) + 4.0 * log((wx4 + xd) / wx4)) + log(1.0 - 1.0i * xd) * (4.0 * ln2 - 4.0 * log(xd) - 4.0 * log((wx3 + xd) / (-1.0i + wx3)) - 4.0 * log((wx4 + xd) / (-1.0i + wx4)))
-                      + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 4.0 * log(xd) - 4.0 * log((wx3 + xd) / (1.0i + wx3)) - 4.0 * log((wx4 + xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
-                    + dilog(w5 / (-1.0 + w5)) * (-8.0 * dilog(-1.0i / (-1.0i + wx3)) - 8.0 * dilog(1.0i / (1.0i + wx3)) - 8.0 * dilog(-1.0i / (-1.0i + wx4)) - 8.0 * dilog(1.0i / (1.0i + wx4)) + 8.0 * dilog((1.0i - xd) / (1.0i + wx3)) + 8.0 * dilog((1.0i - xd) / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 8.0 * dilog(-(xd / wx3)) - 8.0 * dilog(-(xd / wx4)) + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) + 8.0 * dilog((1.0i + xd) / (1.0i - wx3)) + 8.0 * dilog((1.0i + xd) / (1.0i - wx4)) - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(xd) * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log((wx4 + xd) / wx4))
-                      + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 8.0 * log(xd) + 8.0 * log((wx3 + xd) / (-1.0i + wx3)) + 8.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 8.0 * log(xd) + 8.0 * log((wx3 + xd) / (1.0i + wx3)) + 8.0 * log((wx4 + xd) / (1.0i + wx4))) + (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                      + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 4.0 * log(xd) - 4.0 * log((wx3 + xd) / (1.0i + wx3)) - 4.0 * log((wx4 + xd) / (1.0i + wx4))) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                    + dilog(w5 / (-1.0 + w5)) * (-8.0 * c_li2_1 - 8.0 * c_li2_2 - 8.0 * c_li2_3 - 8.0 * c_li2_4 + 8.0 * dilog((1.0i - xd) / (1.0i + wx3)) + 8.0 * dilog((1.0i - xd) / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 8.0 * dilog(-(xd / wx3)) - 8.0 * dilog(-(xd / wx4)) + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) + 8.0 * dilog((1.0i + xd) / (1.0i - wx3)) + 8.0 * dilog((1.0i + xd) / (1.0i - wx4)) - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(xd) * (-8.0 * log((wx3 + xd) / wx3) - 8.0 * log((wx4 + xd) / wx4))
+                      + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 8.0 * log(xd) + 8.0 * log((wx3 + xd) / (-1.0i + wx3)) + 8.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 8.0 * log(xd) + 8.0 * log((wx3 + xd) / (1.0i + wx3)) + 8.0 * log((wx4 + xd) / (1.0i + wx4))) + (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
                     + (dilog((1.0 - yd) / 2.0) + dilog((1.0 + yd) / 2.0)) * (2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (4.0 * ln2 - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) - 2.0 * log((wx4 + xd) / (1.0i + wx4)))
-                      + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4)) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                      - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w7 - yd) / (1.0 + w7)) + dilog(-yd) + dilog(yd) + dilog(-(yd / w7)) + dilog(yd / w7) + dilog((w7 + yd) / (1.0 + w7)) + log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7))  *
+                      + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4)) - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                      - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w7 - yd) / (1.0 + w7)) + dilog(-yd) + dilog(yd) + dilog(-(yd / w7)) + dilog(yd / w7) + dilog((w7 + yd) / (1.0 + w7)) + log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7))  *
                      (-2.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (-4.0 * ln2 + 2.0 * log((wx3 - xd) / (1.0i + wx3)) + 2.0 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * log(xd) + 2.0 * log((wx3 + xd) / (-1.0i + wx3)) + 2.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-4.0 * ln2 + 2.0 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * log((wx4 - xd) / (-1.0i + wx4)) + 4.0 * log(xd) + 2.0 * log((wx3 + xd) / (1.0i + wx3)) + 2.0 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (-2.0 * log((wx3 + xd) / wx3) - 2.0 * log((wx4 + xd) / wx4) - 2.0 * log(1.0 - xd / wx3) - 2.0 * log(1.0 - xd / wx4))
-                      + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                      + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w4 - yd) / (1.0 + w4)) + dilog(-(yd / w4)) + dilog(yd / w4) + dilog((w4 + yd) / (1.0 + w4)) + log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4)) * (2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 4.0 * log((wx3 - xd) / (-1.0i + wx3)) - 4.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd))
-                      + log(1.0 - 1.0i * xd) * (4.0 * ln2 - 4.0 * log((wx3 - xd) / (1.0i + wx3)) - 4.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd)) + log(xd) * (4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
-                    + dilog(w7 / (1.0 + w7)) * (8.0 * dilog(-1.0i / (-1.0i + wx3)) + 8.0 * dilog(1.0i / (1.0i + wx3)) + 8.0 * dilog(-1.0i / (-1.0i + wx4)) + 8.0 * dilog(1.0i / (1.0i + wx4)) - 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) - 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd) + 4.0 * dilog(-(xd / wx3)) + 4.0 * dilog(xd / wx3) + 4.0 * dilog(-(xd / wx4)) + 4.0 * dilog(xd / wx4) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) - 4.0 * dilog((1.0i + xd) / (1.0i - wx3)) - 4.0 * dilog((1.0i + xd) / (1.0i + wx3))
+                      + (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                      + (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w4 - yd) / (1.0 + w4)) + dilog(-(yd / w4)) + dilog(yd / w4) + dilog((w4 + yd) / (1.0 + w4)) + log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4)) * (2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 4.0 * log((wx3 - xd) / (-1.0i + wx3)) - 4.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd))
+                      + log(1.0 - 1.0i * xd) * (4.0 * ln2 - 4.0 * log((wx3 - xd) / (1.0i + wx3)) - 4.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd)) + log(xd) * (4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    + dilog(w7 / (1.0 + w7)) * (8.0 * c_li2_1 + 8.0 * c_li2_2 + 8.0 * c_li2_3 + 8.0 * c_li2_4 - 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) - 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd) + 4.0 * dilog(-(xd / wx3)) + 4.0 * dilog(xd / wx3) + 4.0 * dilog(-(xd / wx4)) + 4.0 * dilog(xd / wx4) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) - 4.0 * dilog((1.0i + xd) / (1.0i - wx3)) - 4.0 * dilog((1.0i + xd) / (1.0i + wx3))
                       - 4.0 * dilog((1.0i + xd) / (1.0i - wx4)) - 4.0 * dilog((1.0i + xd) / (1.0i + wx4)) + 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (8.0 * ln2 - 4.0 * log((wx3 - xd) / (1.0i + wx3)) - 4.0 * log((wx4 - xd) / (1.0i + wx4)) - 8.0 * log(xd) - 4.0 * log((wx3 + xd) / (-1.0i + wx3)) - 4.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (8.0 * ln2 - 4.0 * log((wx3 - xd) / (-1.0i + wx3)) - 4.0 * log((wx4 - xd) / (-1.0i + wx4)) - 8.0 * log(xd) - 4.0 * log((wx3 + xd) / (1.0i + wx3)) - 4.0 * log((wx4 + xd) / (1.0i + wx4)))
-                      + log(xd) * (4.0 * log((wx3 + xd) / wx3) + 4.0 * log((wx4 + xd) / wx4) + 4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                      - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + dilog(w4 / (1.0 + w4)) * (-8.0 * dilog(-1.0i / (-1.0i + wx3)) - 8.0 * dilog(1.0i / (1.0i + wx3)) - 8.0 * dilog(-1.0i / (-1.0i + wx4)) - 8.0 * dilog(1.0i / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 8.0 * dilog(xd / wx3) - 8.0 * dilog(xd / wx4) + 8.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) + 8.0 * dilog((-1.0i + xd) / (-1.0i + wx4))
-                      + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) + 8.0 * dilog((1.0i + xd) / (1.0i + wx3)) + 8.0 * dilog((1.0i + xd) / (1.0i + wx4)) - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 8.0 * log((wx3 - xd) / (-1.0i + wx3)) + 8.0 * log((wx4 - xd) / (-1.0i + wx4)) + 8.0 * log(xd)) + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 8.0 * log((wx3 - xd) / (1.0i + wx3)) + 8.0 * log((wx4 - xd) / (1.0i + wx4)) + 8.0 * log(xd)) + log(xd) * (-8.0 * log(1.0 - xd / wx3) - 8.0 * log(1.0 - xd / wx4)) + (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                      + (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                      + log(xd) * (4.0 * log((wx3 + xd) / wx3) + 4.0 * log((wx4 + xd) / wx4) + 4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                      - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + dilog(w4 / (1.0 + w4)) * (-8.0 * c_li2_1 - 8.0 * c_li2_2 - 8.0 * c_li2_3 - 8.0 * c_li2_4 + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 8.0 * dilog(xd / wx3) - 8.0 * dilog(xd / wx4) + 8.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) + 8.0 * dilog((-1.0i + xd) / (-1.0i + wx4))
+                      + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd)) + 8.0 * dilog((1.0i + xd) / (1.0i + wx3)) + 8.0 * dilog((1.0i + xd) / (1.0i + wx4)) - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 8.0 * log((wx3 - xd) / (-1.0i + wx3)) + 8.0 * log((wx4 - xd) / (-1.0i + wx4)) + 8.0 * log(xd)) + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 8.0 * log((wx3 - xd) / (1.0i + wx3)) + 8.0 * log((wx4 - xd) / (1.0i + wx4)) + 8.0 * log(xd)) + log(xd) * (-8.0 * log(1.0 - xd / wx3) - 8.0 * log(1.0 - xd / wx4)) + (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                      + (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                     + (ln1myd + ln1pyd) * (-2.0 * ln2 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * ln2 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (-4.0 * ln2squ + 2.0 * ln2 * log((wx3 - xd) / (1.0i + wx3)) + 2.0 * ln2 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * ln2 * log(xd) + 2.0 * ln2 * log((wx3 + xd) / (-1.0i + wx3)) + 2.0 * ln2 * log((wx4 + xd) / (-1.0i + wx4)))
-                      + log(1.0 + 1.0i * xd) * (-4.0 * ln2squ + 2.0 * ln2 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * ln2 * log((wx4 - xd) / (-1.0i + wx4)) + 4.0 * ln2 * log(xd) + 2.0 * ln2 * log((wx3 + xd) / (1.0i + wx3)) + 2.0 * ln2 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (-2.0 * ln2 * log((wx3 + xd) / wx3) - 2.0 * ln2 * log((wx4 + xd) / wx4) - 2.0 * ln2 * log(1.0 - xd / wx3) - 2.0 * ln2 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                      + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                      + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
-                    + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx3) * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx4) * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
-                    + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx3) * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx4) * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
-                    + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx3) * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
-                    + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx4) * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx3) * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx4) * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
-                    - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + (dilog(xd / wx3) + dilog(xd / wx4)) * (2.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4)) - 2.0 * dilog((w7 - yd) / (1.0 + w7)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4) - 2.0 * dilog(-(yd / w7)) - 2.0 * dilog(yd / w7)
+                      + log(1.0 + 1.0i * xd) * (-4.0 * ln2squ + 2.0 * ln2 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * ln2 * log((wx4 - xd) / (-1.0i + wx4)) + 4.0 * ln2 * log(xd) + 2.0 * ln2 * log((wx3 + xd) / (1.0i + wx3)) + 2.0 * ln2 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (-2.0 * ln2 * log((wx3 + xd) / wx3) - 2.0 * ln2 * log((wx4 + xd) / wx4) - 2.0 * ln2 * log(1.0 - xd / wx3) - 2.0 * ln2 * log(1.0 - xd / wx4)) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                      + (4.0 * 1.0i) * M_PI * ln2 * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * ln2 * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                      + (4.0 * 1.0i) * M_PI * ln2 * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_7 * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_9 * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_8 * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                    + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_10 * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_8 * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_10 * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
+                    + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_7 * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_9 * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_7 * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_9 * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
+                    + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_8 * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log(1.0 + w4inv) * c_ln_10 * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_8 * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
+                    + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_10 * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_7 * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_9 * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
+                    - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) - 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + (dilog(xd / wx3) + dilog(xd / wx4)) * (2.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4)) - 2.0 * dilog((w7 - yd) / (1.0 + w7)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4) - 2.0 * dilog(-(yd / w7)) - 2.0 * dilog(yd / w7)
                       + 2.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w4 + yd) / (1.0 + w4)) - 2.0 * dilog((w7 + yd) / (1.0 + w7)) - 2.0 * ln2 * ln1myd - 2.0 * ln2 * ln1pyd + 4.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) - 2.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + 4.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) - 2.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
                       + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)) + (power_of<2>(log(1.0 - 1.0i * xd)) + power_of<2>(log(1.0 + 1.0i * xd))) * ((4.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + (4.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (4.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
                       + (4.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)) + (dilog(-(xd / wx3)) + dilog(-(xd / wx4))) * (2.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w5 - yd) / (-1.0 + w5)) - 2.0 * dilog((w7 - yd) / (1.0 + w7)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) + 4.0 * dilog(-(yd / w5)) + 4.0 * dilog(yd / w5) - 2.0 * dilog(-(yd / w7)) - 2.0 * dilog(yd / w7) + 2.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w5 + yd) / (-1.0 + w5)) - 2.0 * dilog((w7 + yd) / (1.0 + w7)) - 2.0 * ln2 * ln1myd
@@ -424,14 +424,14 @@ namespace eos
                       + 2.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) - 4.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) + 2.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) - (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
                     + (dilog((1.0i - xd) / (1.0i + wx3)) + dilog((1.0i - xd) / (1.0i + wx4)) + dilog((1.0i + xd) / (1.0i - wx3)) + dilog((1.0i + xd) / (1.0i - wx4))) * (-2.0 * dilog((1.0 - yd) / 2.0) - 4.0 * dilog((w5 - yd) / (-1.0 + w5)) + 2.0 * dilog((w7 - yd) / (1.0 + w7)) + 2.0 * dilog(-yd) + 2.0 * dilog(yd) - 4.0 * dilog(-(yd / w5)) - 4.0 * dilog(yd / w5) + 2.0 * dilog(-(yd / w7)) + 2.0 * dilog(yd / w7) - 2.0 * dilog((1.0 + yd) / 2.0) - 4.0 * dilog((w5 + yd) / (-1.0 + w5)) + 2.0 * dilog((w7 + yd) / (1.0 + w7)) + 2.0 * ln2 * ln1myd + 2.0 * ln2 * ln1pyd - 4.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5)
                       + 2.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) - 4.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) + 2.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) - (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
-                    + (dilog(-1.0i / (-1.0i + wx3)) + dilog(1.0i / (1.0i + wx3)) + dilog(-1.0i / (-1.0i + wx4)) + dilog(1.0i / (1.0i + wx4)) - dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - dilog((-1.0i) * xd) - dilog(1.0i * xd) - dilog(((-0.5) * 1.0i) * (1.0i + xd))) * (4.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4)) + 4.0 * dilog((w5 - yd) / (-1.0 + w5)) - 4.0 * dilog((w7 - yd) / (1.0 + w7)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4) + 4.0 * dilog(-(yd / w5)) + 4.0 * dilog(yd / w5) - 4.0 * dilog(-(yd / w7)) - 4.0 * dilog(yd / w7) + 4.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w4 + yd) / (1.0 + w4))
+                    + (c_li2_1 + c_li2_2 + c_li2_3 + c_li2_4 - dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - dilog((-1.0i) * xd) - dilog(1.0i * xd) - dilog(((-0.5) * 1.0i) * (1.0i + xd))) * (4.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4)) + 4.0 * dilog((w5 - yd) / (-1.0 + w5)) - 4.0 * dilog((w7 - yd) / (1.0 + w7)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4) + 4.0 * dilog(-(yd / w5)) + 4.0 * dilog(yd / w5) - 4.0 * dilog(-(yd / w7)) - 4.0 * dilog(yd / w7) + 4.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w4 + yd) / (1.0 + w4))
                       + 4.0 * dilog((w5 + yd) / (-1.0 + w5)) - 4.0 * dilog((w7 + yd) / (1.0 + w7)) - 4.0 * ln2 * ln1myd - 4.0 * ln2 * ln1pyd + 4.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + 4.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) - 4.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + 4.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) + 4.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) - 4.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
                       + (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) - (8.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - (8.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
-                    + li2half * (-16.0 * dilog(w4 / (1.0 + w4)) - 16.0 * dilog(w5 / (-1.0 + w5)) + 16.0 * dilog(w7 / (1.0 + w7)) - 8.0 * dilog(-1.0i / (-1.0i + wx3)) - 8.0 * dilog(1.0i / (1.0i + wx3)) - 8.0 * dilog(-1.0i / (-1.0i + wx4)) - 8.0 * dilog(1.0i / (1.0i + wx4)) + 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) + 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 4.0 * dilog(-(xd / wx3)) - 4.0 * dilog(xd / wx3) - 4.0 * dilog(-(xd / wx4)) - 4.0 * dilog(xd / wx4) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd))
+                    + li2half * (-16.0 * dilog(w4 / (1.0 + w4)) - 16.0 * dilog(w5 / (-1.0 + w5)) + 16.0 * dilog(w7 / (1.0 + w7)) - 8.0 * c_li2_1 - 8.0 * c_li2_2 - 8.0 * c_li2_3 - 8.0 * c_li2_4 + 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) + 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 4.0 * dilog(-(xd / wx3)) - 4.0 * dilog(xd / wx3) - 4.0 * dilog(-(xd / wx4)) - 4.0 * dilog(xd / wx4) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) + 8.0 * dilog(((-0.5) * 1.0i) * (1.0i + xd))
                       + 4.0 * dilog((1.0i + xd) / (1.0i - wx3)) + 4.0 * dilog((1.0i + xd) / (1.0i + wx3)) + 4.0 * dilog((1.0i + xd) / (1.0i - wx4)) + 4.0 * dilog((1.0i + xd) / (1.0i + wx4)) + 8.0 * dilog((1.0 - yd) / 2.0) + 8.0 * dilog((w4 - yd) / (1.0 + w4)) + 8.0 * dilog((w5 - yd) / (-1.0 + w5)) - 8.0 * dilog((w7 - yd) / (1.0 + w7)) - 8.0 * dilog(-yd) - 8.0 * dilog(yd) + 8.0 * dilog(-(yd / w4)) + 8.0 * dilog(yd / w4) + 8.0 * dilog(-(yd / w5)) + 8.0 * dilog(yd / w5) - 8.0 * dilog(-(yd / w7)) - 8.0 * dilog(yd / w7) + 8.0 * dilog((1.0 + yd) / 2.0) + 8.0 * dilog((w4 + yd) / (1.0 + w4)) + 8.0 * dilog((w5 + yd) / (-1.0 + w5)) - 8.0 * dilog((w7 + yd) / (1.0 + w7))
                       - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 4.0 * log((wx3 - xd) / (1.0i + wx3)) + 4.0 * log((wx4 - xd) / (1.0i + wx4)) + 8.0 * log(xd) + 4.0 * log((wx3 + xd) / (-1.0i + wx3)) + 4.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 4.0 * log((wx3 - xd) / (-1.0i + wx3)) + 4.0 * log((wx4 - xd) / (-1.0i + wx4)) + 8.0 * log(xd) + 4.0 * log((wx3 + xd) / (1.0i + wx3)) + 4.0 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (-4.0 * log((wx3 + xd) / wx3) - 4.0 * log((wx4 + xd) / wx4) - 4.0 * log(1.0 - xd / wx3) - 4.0 * log(1.0 - xd / wx4))
-                      - 8.0 * ln2 * ln1myd - 8.0 * ln2 * ln1pyd + 8.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + 8.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) - 8.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + 8.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) + 8.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) - 8.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                      + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                      - 8.0 * ln2 * ln1myd - 8.0 * ln2 * ln1pyd + 8.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + 8.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) - 8.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) + 8.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) + 8.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) - 8.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                      + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
                       + (16.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) - (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) + (16.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
                     + log(xd) * (log(1.0 - xd / wx3) * ((8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
                       + log(1.0 - xd / wx4) * ((8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
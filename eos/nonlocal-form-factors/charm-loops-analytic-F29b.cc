@@ -643,61 +643,61 @@ namespace eos
             const complex<double> logs3 = 3.0 * (-1.0 + yb2) + 3.0 * xb8 * (-1.0 + yb2) - 4.0 * xb2 * (4.0 - 7.0 * yb2 + 3.0 * yb4) - 4.0 * xb6 * (4.0 - 7.0 * yb2 + 3.0 * yb4) + 2.0 * xb4 * (-13.0 + 64.0 * ln2 + 12.0 * yb4 * (-1.0 + 48.0 * ln2) + yb2 * (25.0 + 384.0 * ln2));
             const complex<double> logs4 = -18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + 18.0 * xb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 24.0 * yb2 + 9.0 * yb4) * ln2 + 18.0 * xb10 * power_of<2>(-1.0 + yb2) * (-1.0 + 24.0 * yb2 + 9.0 * yb4) * ln2
                 + 9.0 * xb4 * power_of<2>(-1.0 + yb2) * (-11.0 + 204.0 * yb2 + 63.0 * yb4) * ln2 + 9.0 * xb8 * power_of<2>(-1.0 + yb2) * (-11.0 + 204.0 * yb2 + 63.0 * yb4) * ln2
-                + 4.0 * xb6 * (-16.0 - 39.0 * ln2 - 72.0 * yb4 * (12.0 + 17.0 * ln2) + 9.0 * yb8 * (-144.0 + 23.0 * ln2) + 6.0 * yb6 * (-288.0 + 47.0 * ln2) + 6.0 * yb2 * (-32.0 + 129.0 * ln2)) + log(8.0)
-                + xb12 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0));
+                + 4.0 * xb6 * (-16.0 - 39.0 * ln2 - 72.0 * yb4 * (12.0 + 17.0 * ln2) + 9.0 * yb8 * (-144.0 + 23.0 * ln2) + 6.0 * yb6 * (-288.0 + 47.0 * ln2) + 6.0 * yb2 * (-32.0 + 129.0 * ln2)) + c_ln_1
+                + xb12 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1);
             const complex<double> logs5 = 9.0 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 9.0 * xb8 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 12.0 * xb2 * yb2 * (-3.0 - 163.0 * yb2 + 151.0 * yb4 + 15.0 * yb6) - 12.0 * xb6 * yb2 * (-3.0 - 163.0 * yb2 + 151.0 * yb4 + 15.0 * yb6)
-                - 2.0 * xb4 * (-543.0 * yb4 - 3.0 * yb2 * (103.0 + 192.0 * ln2) + 9.0 * yb8 * (607.0 + 864.0 * ln2) + yb6 * (5181.0 + 5184.0 * ln2) - 32.0 * (2.0 + log(8.0)));
+                - 2.0 * xb4 * (-543.0 * yb4 - 3.0 * yb2 * (103.0 + 192.0 * ln2) + 9.0 * yb8 * (607.0 + 864.0 * ln2) + yb6 * (5181.0 + 5184.0 * ln2) - 32.0 * (2.0 + c_ln_1));
             const complex<double> logs6 = -9.0 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 9.0 * xb8 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 12.0 * xb2 * yb2 * (-3.0 - 163.0 * yb2 + 151.0 * yb4 + 15.0 * yb6) + 12.0 * xb6 * yb2 * (-3.0 - 163.0 * yb2 + 151.0 * yb4 + 15.0 * yb6)
-                + 2.0 * xb4 * (-543.0 * yb4 - 3.0 * yb2 * (103.0 + 192.0 * ln2) + 9.0 * yb8 * (607.0 + 864.0 * ln2) + yb6 * (5181.0 + 5184.0 * ln2) - 32.0 * (2.0 + log(8.0)));
+                + 2.0 * xb4 * (-543.0 * yb4 - 3.0 * yb2 * (103.0 + 192.0 * ln2) + 9.0 * yb8 * (607.0 + 864.0 * ln2) + yb6 * (5181.0 + 5184.0 * ln2) - 32.0 * (2.0 + c_ln_1));
             const complex<double> logs7 = -4.0 * xb2 * (2.0 * xb6 * (8.0 + 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 + yb3 * (317.0 - 78.0 * ln2) + 18.0 * yb5 * (75.0 + 86.0 * ln2) + 3.0 * yb11 * (-463.0 + 138.0 * ln2) - 16.0 * yb7 * (104.0 + 153.0 * ln2)
                     + yb9 * (-2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (-4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (-4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + 3.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2) - 3.0 * yb * (1.0 + ln4)) + 3.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2)
-                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + tb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (32.0 + 208.0 * yb + 300.0 * yb2 + 1160.0 * yb4 - 704.0 * yb6 - 9576.0 * yb8 - 7596.0 * yb10 + yb3 * (1268.0 - 57.0 * ln2) + 18.0 * yb5 * (300.0 + 59.0 * ln2) + 3.0 * yb11 * (-1852.0 + 87.0 * ln2) + 2.0 * yb9 * (-5524.0 + 213.0 * ln2)
-                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
-                    + 3.0 * yb5 * (-1.0 + log(128.0)))) + tb * xb2 * (-2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
+                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
+                    + 3.0 * yb5 * (-1.0 + c_ln_3))) + tb * xb2 * (-2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
                     + yb6 * (521.0 + 1080.0 * ln2)) - 2.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2) + yb6 * (521.0 + 1080.0 * ln2))
                 - 4.0 * xb6 * (24.0 + 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb3 * (941.0 - 312.0 * ln2) + 18.0 * yb5 * (173.0 + 344.0 * ln2) + 3.0 * yb11 * (-1271.0 + 552.0 * ln2) + 4.0 * yb9 * (-2041.0 + 564.0 * ln2)
                     - 8.0 * yb7 * (565.0 + 1224.0 * ln2)) + xb4 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb11 * (1479.0 - 4536.0 * ln2) + yb3 * (505.0 + 792.0 * ln2) + 16.0 * yb7 * (143.0 + 1602.0 * ln2)
                     - 6.0 * yb5 * (1415.0 + 2712.0 * ln2) - 2.0 * yb9 * (2027.0 + 2808.0 * ln2)) + xb8 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb11 * (1479.0 - 4536.0 * ln2) + yb3 * (505.0 + 792.0 * ln2)
-                    + 16.0 * yb7 * (143.0 + 1602.0 * ln2) - 6.0 * yb5 * (1415.0 + 2712.0 * ln2) - 2.0 * yb9 * (2027.0 + 2808.0 * ln2)) - 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256))
-                - 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256)));
+                    + 16.0 * yb7 * (143.0 + 1602.0 * ln2) - 6.0 * yb5 * (1415.0 + 2712.0 * ln2) - 2.0 * yb9 * (2027.0 + 2808.0 * ln2)) - 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256))
+                - 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256)));
             const complex<double> logs8 = 4.0 * xb2 * (2.0 * xb6 * (8.0 + 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 + yb3 * (317.0 - 78.0 * ln2) + 18.0 * yb5 * (75.0 + 86.0 * ln2) + 3.0 * yb11 * (-463.0 + 138.0 * ln2) - 16.0 * yb7 * (104.0 + 153.0 * ln2)
                     + yb9 * (-2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (-4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (-4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + 3.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2) - 3.0 * yb * (1.0 + ln4)) + 3.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2)
-                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + tb2 * (-3.0 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 3.0 * xb16 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 2.0 * xb8 * (32.0 + 208.0 * yb + 300.0 * yb2 + 1160.0 * yb4 - 704.0 * yb6 - 9576.0 * yb8 - 7596.0 * yb10 + yb3 * (1268.0 - 57.0 * ln2) + 18.0 * yb5 * (300.0 + 59.0 * ln2)
-                    + 3.0 * yb11 * (-1852.0 + 87.0 * ln2) + 2.0 * yb9 * (-5524.0 + 213.0 * ln2) - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0))
-                    + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0))) + 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0))
-                    - 12.0 * yb4 * (79.0 + log(32.0))) - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + log(128.0)))
-                - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + log(128.0))))
+                    + 3.0 * yb11 * (-1852.0 + 87.0 * ln2) + 2.0 * yb9 * (-5524.0 + 213.0 * ln2) - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1)
+                    + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2)) + 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1)
+                    - 12.0 * yb4 * (79.0 + c_ln_2)) - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + c_ln_3))
+                - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + c_ln_3)))
                 + tb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2) + yb6 * (521.0 + 1080.0 * ln2))
                 + 2.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2) + yb6 * (521.0 + 1080.0 * ln2))
                 + 4.0 * xb6 * (24.0 + 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb3 * (941.0 - 312.0 * ln2) + 18.0 * yb5 * (173.0 + 344.0 * ln2) + 3.0 * yb11 * (-1271.0 + 552.0 * ln2) + 4.0 * yb9 * (-2041.0 + 564.0 * ln2)
                     - 8.0 * yb7 * (565.0 + 1224.0 * ln2)) + xb4 * (-16.0 - 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 - yb3 * (505.0 + 792.0 * ln2) + 3.0 * yb11 * (-493.0 + 1512.0 * ln2) - 16.0 * yb7 * (143.0 + 1602.0 * ln2)
                     + 6.0 * yb5 * (1415.0 + 2712.0 * ln2) + yb9 * (4054.0 + 5616.0 * ln2)) + xb8 * (-16.0 - 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 - yb3 * (505.0 + 792.0 * ln2) + 3.0 * yb11 * (-493.0 + 1512.0 * ln2)
-                    - 16.0 * yb7 * (143.0 + 1602.0 * ln2) + 6.0 * yb5 * (1415.0 + 2712.0 * ln2) + yb9 * (4054.0 + 5616.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256))
-                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + log(16.0)) + yb2 * (-1.0 + ln256)));
+                    - 16.0 * yb7 * (143.0 + 1602.0 * ln2) + 6.0 * yb5 * (1415.0 + 2712.0 * ln2) + yb9 * (4054.0 + 5616.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256))
+                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (-1.0 - 2.0 * yb * (1.0 + c_ln_4) + yb2 * (-1.0 + ln256)));
             const complex<double> logs9 = -4.0 * xb2 * (3.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 6.0 * ln2) + 8.0 * yb3 * (-1.0 + 18.0 * ln2) + yb5 * (-3.0 + 54.0 * ln2))
                 + 3.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb * (3.0 - 6.0 * ln2) + 8.0 * yb3 * (-1.0 + 18.0 * ln2) + yb5 * (-3.0 + 54.0 * ln2))
                 + 2.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 + yb7 * (1664.0 - 2448.0 * ln2) - yb3 * (317.0 + 78.0 * ln2) + 18.0 * yb5 * (-75.0 + 86.0 * ln2) + 3.0 * yb11 * (463.0 + 138.0 * ln2)
                     + yb9 * (2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + tb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-32.0 - 208.0 * yb - 300.0 * yb2 - 1160.0 * yb4 + 704.0 * yb6 + 9576.0 * yb8 + 7596.0 * yb10 + yb7 * (6656.0 - 1692.0 * ln2) - yb3 * (1268.0 + 57.0 * ln2) + 18.0 * yb5 * (-300.0 + 59.0 * ln2) + 3.0 * yb11 * (1852.0 + 87.0 * ln2)
-                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0)) + 3.0 * yb5 * (1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0))
-                    + 3.0 * yb5 * (1.0 + log(128.0)))) - tb * xb2 * (4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
+                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2) + 3.0 * yb5 * (1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2)
+                    + 3.0 * yb5 * (1.0 + c_ln_3))) - tb * xb2 * (4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
                     + 3.0 * yb11 * (1271.0 + 552.0 * ln2) + 4.0 * yb9 * (2041.0 + 564.0 * ln2)) + 2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2)
                     + yb8 * (-381.0 + 648.0 * ln2) + yb6 * (-521.0 + 1080.0 * ln2)) + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2) + yb8 * (-381.0 + 648.0 * ln2)
                     + yb6 * (-521.0 + 1080.0 * ln2)) + xb4 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb7 * (2288.0 - 25632.0 * ln2) + yb3 * (505.0 - 792.0 * ln2) + 3.0 * yb11 * (493.0 + 1512.0 * ln2)
@@ -709,14 +709,14 @@ namespace eos
                 + 2.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 + yb7 * (1664.0 - 2448.0 * ln2) - yb3 * (317.0 + 78.0 * ln2) + 18.0 * yb5 * (-75.0 + 86.0 * ln2) + 3.0 * yb11 * (463.0 + 138.0 * ln2)
                     + yb9 * (2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 - tb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-32.0 - 208.0 * yb - 300.0 * yb2 - 1160.0 * yb4 + 704.0 * yb6 + 9576.0 * yb8 + 7596.0 * yb10 + yb7 * (6656.0 - 1692.0 * ln2) - yb3 * (1268.0 + 57.0 * ln2) + 18.0 * yb5 * (-300.0 + 59.0 * ln2) + 3.0 * yb11 * (1852.0 + 87.0 * ln2)
-                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0)) + 3.0 * yb5 * (1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0))
-                    + 3.0 * yb5 * (1.0 + log(128.0)))) + tb * xb2 * (4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
+                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2) + 3.0 * yb5 * (1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2)
+                    + 3.0 * yb5 * (1.0 + c_ln_3))) + tb * xb2 * (4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
                     + 3.0 * yb11 * (1271.0 + 552.0 * ln2) + 4.0 * yb9 * (2041.0 + 564.0 * ln2)) + 2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2)
                     + yb8 * (-381.0 + 648.0 * ln2) + yb6 * (-521.0 + 1080.0 * ln2)) + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2) + yb8 * (-381.0 + 648.0 * ln2)
                     + yb6 * (-521.0 + 1080.0 * ln2)) + xb4 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb7 * (2288.0 - 25632.0 * ln2) + yb3 * (505.0 - 792.0 * ln2) + 3.0 * yb11 * (493.0 + 1512.0 * ln2)
@@ -728,13 +728,13 @@ namespace eos
                 + 2.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 + yb7 * (1664.0 - 2448.0 * ln2) - yb3 * (317.0 + 78.0 * ln2) + 18.0 * yb5 * (-75.0 + 86.0 * ln2) + 3.0 * yb11 * (463.0 + 138.0 * ln2)
                     + yb9 * (2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + vb2 * (-3.0 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 3.0 * xb16 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 2.0 * xb8 * (32.0 - 208.0 * yb + 300.0 * yb2 + 1160.0 * yb4 - 704.0 * yb6 - 9576.0 * yb8 - 7596.0 * yb10 + yb7 * (6656.0 - 1692.0 * ln2) - yb3 * (1268.0 + 57.0 * ln2)
                     + 18.0 * yb5 * (-300.0 + 59.0 * ln2) + 3.0 * yb11 * (1852.0 + 87.0 * ln2) + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2)
-                    + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0))) + 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0)) + 3.0 * yb5 * (1.0 + log(128.0))) - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0))
-                    + 3.0 * yb5 * (1.0 + log(128.0)))) - vb * xb2 * (4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
+                    + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1)) + 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2) + 3.0 * yb5 * (1.0 + c_ln_3)) - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2)
+                    + 3.0 * yb5 * (1.0 + c_ln_3))) - vb * xb2 * (4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
                     + 3.0 * yb11 * (1271.0 + 552.0 * ln2) + 4.0 * yb9 * (2041.0 + 564.0 * ln2)) + 2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2)
                     + yb8 * (-381.0 + 648.0 * ln2) + yb6 * (-521.0 + 1080.0 * ln2)) + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2) + yb8 * (-381.0 + 648.0 * ln2)
                     + yb6 * (-521.0 + 1080.0 * ln2)) + xb4 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb7 * (2288.0 - 25632.0 * ln2) + yb3 * (505.0 - 792.0 * ln2) + 3.0 * yb11 * (493.0 + 1512.0 * ln2)
@@ -746,14 +746,14 @@ namespace eos
                 + 2.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 + yb7 * (1664.0 - 2448.0 * ln2) - yb3 * (317.0 + 78.0 * ln2) + 18.0 * yb5 * (-75.0 + 86.0 * ln2) + 3.0 * yb11 * (463.0 + 138.0 * ln2)
                     + yb9 * (2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + 3.0 * yb2 * (8.0 + 33.0 * ln2) + yb8 * (708.0 + 567.0 * ln2) - 3.0 * yb4 * (-632.0 + 645.0 * ln2) + yb6 * (952.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + vb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (32.0 - 208.0 * yb + 300.0 * yb2 + 1160.0 * yb4 - 704.0 * yb6 - 9576.0 * yb8 - 7596.0 * yb10 + yb7 * (6656.0 - 1692.0 * ln2) - yb3 * (1268.0 + 57.0 * ln2) + 18.0 * yb5 * (-300.0 + 59.0 * ln2) + 3.0 * yb11 * (1852.0 + 87.0 * ln2)
-                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + log(8.0)) + 6.0 * yb8 * (59.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0)) + 3.0 * yb5 * (1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + log(32.0))
-                    + 3.0 * yb5 * (1.0 + log(128.0)))) + vb * xb2 * (4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
+                    + 2.0 * yb9 * (5524.0 + 213.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 76.0 * yb3 - 216.0 * yb5 + 36.0 * yb7 + yb4 * (948.0 - 60.0 * ln2) + yb6 * (476.0 + 39.0 * ln2) + yb2 * (12.0 + c_ln_1) + 6.0 * yb8 * (59.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2) + 3.0 * yb5 * (1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + yb3 * (8.0 + 80.0 * ln2) - yb * (3.0 + c_ln_2)
+                    + 3.0 * yb5 * (1.0 + c_ln_3))) + vb * xb2 * (4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 + yb7 * (4520.0 - 9792.0 * ln2) - yb3 * (941.0 + 312.0 * ln2) + 18.0 * yb5 * (-173.0 + 344.0 * ln2)
                     + 3.0 * yb11 * (1271.0 + 552.0 * ln2) + 4.0 * yb9 * (2041.0 + 564.0 * ln2)) + 2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2)
                     + yb8 * (-381.0 + 648.0 * ln2) + yb6 * (-521.0 + 1080.0 * ln2)) + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 72.0 * ln2) - 3.0 * yb4 * (283.0 + 600.0 * ln2) + yb8 * (-381.0 + 648.0 * ln2)
                     + yb6 * (-521.0 + 1080.0 * ln2)) + xb4 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb7 * (2288.0 - 25632.0 * ln2) + yb3 * (505.0 - 792.0 * ln2) + 3.0 * yb11 * (493.0 + 1512.0 * ln2)
@@ -764,14 +764,14 @@ namespace eos
                     + yb9 * (-2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (-4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (-4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + 3.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2) - 3.0 * yb * (1.0 + ln4)) + 3.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2)
-                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 - vb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-32.0 + 208.0 * yb - 300.0 * yb2 - 1160.0 * yb4 + 704.0 * yb6 + 9576.0 * yb8 + 7596.0 * yb10 + yb3 * (1268.0 - 57.0 * ln2) + 18.0 * yb5 * (300.0 + 59.0 * ln2) + 3.0 * yb11 * (-1852.0 + 87.0 * ln2) + 2.0 * yb9 * (-5524.0 + 213.0 * ln2)
-                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
-                    + 3.0 * yb5 * (-1.0 + log(128.0)))) + vb * xb2 * (-2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
+                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
+                    + 3.0 * yb5 * (-1.0 + c_ln_3))) + vb * xb2 * (-2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
                     + yb6 * (521.0 + 1080.0 * ln2)) - 2.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2) + yb6 * (521.0 + 1080.0 * ln2))
                 - 4.0 * xb6 * (-24.0 + 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb3 * (941.0 - 312.0 * ln2) + 18.0 * yb5 * (173.0 + 344.0 * ln2) + 3.0 * yb11 * (-1271.0 + 552.0 * ln2) + 4.0 * yb9 * (-2041.0 + 564.0 * ln2)
                     - 8.0 * yb7 * (565.0 + 1224.0 * ln2)) + xb4 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb11 * (1479.0 - 4536.0 * ln2) + yb3 * (505.0 + 792.0 * ln2) + 16.0 * yb7 * (143.0 + 1602.0 * ln2)
@@ -782,14 +782,14 @@ namespace eos
                     + yb9 * (-2762.0 + 564.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (-4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + xb8 * yb * (-1.0 + yb2) * (-4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + 3.0 * yb2 * (-8.0 + 33.0 * ln2) + yb8 * (-708.0 + 567.0 * ln2) - 3.0 * yb4 * (632.0 + 645.0 * ln2) + yb6 * (-952.0 + 1269.0 * ln2))
                 + 3.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2) - 3.0 * yb * (1.0 + ln4)) + 3.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 + 8.0 * yb3 * (1.0 + 18.0 * ln2) + yb5 * (3.0 + 54.0 * ln2)
-                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)))
+                    - 3.0 * yb * (1.0 + ln4)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1))
                 + vb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-32.0 + 208.0 * yb - 300.0 * yb2 - 1160.0 * yb4 + 704.0 * yb6 + 9576.0 * yb8 + 7596.0 * yb10 + yb3 * (1268.0 - 57.0 * ln2) + 18.0 * yb5 * (300.0 + 59.0 * ln2) + 3.0 * yb11 * (-1852.0 + 87.0 * ln2) + 2.0 * yb9 * (-5524.0 + 213.0 * ln2)
-                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + log(8.0)) + yb2 * (-12.0 + log(8.0)) - 12.0 * yb4 * (79.0 + log(32.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
-                    + 3.0 * yb5 * (-1.0 + log(128.0)))) + vb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
+                    - 4.0 * yb7 * (1664.0 + 423.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 76.0 * yb3 + 216.0 * yb5 - 36.0 * yb7 + yb6 * (-476.0 + 39.0 * ln2) + 6.0 * yb8 * (-59.0 + c_ln_1) + yb2 * (-12.0 + c_ln_1) - 12.0 * yb4 * (79.0 + c_ln_2))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2) + 3.0 * yb5 * (-1.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 + yb * (3.0 - 5.0 * ln2) + yb3 * (-8.0 + 80.0 * ln2)
+                    + 3.0 * yb5 * (-1.0 + c_ln_3))) + vb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2)
                     + yb6 * (521.0 + 1080.0 * ln2)) + 2.0 * xb10 * yb * (-1.0 + yb2) * (2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb4 * (849.0 - 1800.0 * ln2) + yb2 * (39.0 + 72.0 * ln2) + yb8 * (381.0 + 648.0 * ln2) + yb6 * (521.0 + 1080.0 * ln2))
                 + 4.0 * xb6 * (-24.0 + 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 + yb3 * (941.0 - 312.0 * ln2) + 18.0 * yb5 * (173.0 + 344.0 * ln2) + 3.0 * yb11 * (-1271.0 + 552.0 * ln2) + 4.0 * yb9 * (-2041.0 + 564.0 * ln2)
                     - 8.0 * yb7 * (565.0 + 1224.0 * ln2)) + xb4 * (16.0 - 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 - yb3 * (505.0 + 792.0 * ln2) + 3.0 * yb11 * (-493.0 + 1512.0 * ln2) - 16.0 * yb7 * (143.0 + 1602.0 * ln2)
@@ -802,9 +802,9 @@ namespace eos
                     + 2.0 * xb4 * (yb4 * (46.0 - 621.0 * ln2) + 34.0 * ln2 + 108.0 * yb10 * (2.0 + 17.0 * ln2) + yb2 * (14.0 + 111.0 * ln2) - 3.0 * yb8 * (66.0 + 763.0 * ln2) - yb6 * (78.0 + 3167.0 * ln2))
                     - 2.0 * xb6 * (yb4 * (46.0 - 621.0 * ln2) + 34.0 * ln2 + 108.0 * yb10 * (2.0 + 17.0 * ln2) + yb2 * (14.0 + 111.0 * ln2) - 3.0 * yb8 * (66.0 + 763.0 * ln2) - yb6 * (78.0 + 3167.0 * ln2))
                     - 4.0 * 1.0i * xb5 * (yb6 * (60.0 - 4851.0 * ln2) - 36.0 * ln2 - yb2 * (20.0 + 543.0 * ln2) + 6.0 * yb10 * (-36.0 + 1309.0 * ln2) - yb4 * (76.0 + 1857.0 * ln2) + yb8 * (252.0 + 3529.0 * ln2))
-                    - yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + log(8.0)) + xb10 * yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + log(8.0))
-                    + xb2 * (yb6 * (36.0 - 125.0 * ln2) + yb2 * (12.0 - 37.0 * ln2) - 1338.0 * yb10 * ln2 - yb8 * (108.0 + 385.0 * ln2) + 3.0 * yb4 * (20.0 + 627.0 * ln2) + log(16.0))
-                    + xb8 * (-1.0 + yb2) * (yb2 * (12.0 - 33.0 * ln2) + 1338.0 * yb8 * ln2 + 24.0 * yb4 * (3.0 + 77.0 * ln2) + yb6 * (108.0 + 1723.0 * ln2) + log(16.0)))
+                    - yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + c_ln_1) + xb10 * yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + c_ln_1)
+                    + xb2 * (yb6 * (36.0 - 125.0 * ln2) + yb2 * (12.0 - 37.0 * ln2) - 1338.0 * yb10 * ln2 - yb8 * (108.0 + 385.0 * ln2) + 3.0 * yb4 * (20.0 + 627.0 * ln2) + c_ln_4)
+                    + xb8 * (-1.0 + yb2) * (yb2 * (12.0 - 33.0 * ln2) + 1338.0 * yb8 * ln2 + 24.0 * yb4 * (3.0 + 77.0 * ln2) + yb6 * (108.0 + 1723.0 * ln2) + c_ln_4))
                 - 4.0 * xb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 48.0 * 1.0i * xb11 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 16.0 * 1.0i * xb3 * yb3 * (1.0 - 774.0 * yb2 + 780.0 * yb4 - 10.0 * yb6 + 3.0 * yb8) * ln2
                     + 16.0 * 1.0i * xb9 * yb3 * (1.0 - 774.0 * yb2 + 780.0 * yb4 - 10.0 * yb6 + 3.0 * yb8) * ln2 + 96.0 * 1.0i * xb5 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) * ln2
                     - 96.0 * 1.0i * xb7 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) * ln2 - xb4 * (yb5 * (544.0 - 22620.0 * ln2) + yb3 * (128.0 - 339.0 * ln2) + 16.0 * ln2 + 48.0 * yb * ln2 + 147.0 * yb2 * ln2 + 890.0 * yb4 * ln2
@@ -814,8 +814,8 @@ namespace eos
                     + 2646.0 * yb8 * ln2 + 1863.0 * yb10 * ln2 + 27.0 * yb11 * (-16.0 + 1235.0 * ln2) - 4.0 * yb5 * (53.0 + 1596.0 * ln2) - yb3 * (52.0 + 1623.0 * ln2) + yb9 * (612.0 + 6654.0 * ln2))
                     + xb2 * yb * (-4.0 * ln2 - 164.0 * yb3 * ln2 - 328.0 * yb5 * ln2 + 612.0 * yb7 * ln2 - 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2) - 4.0 * yb6 * (18.0 + 391.0 * ln2)
                     - yb2 * (24.0 + ln4) + yb * ln64) + xb10 * yb * (-4.0 * ln2 - 164.0 * yb3 * ln2 - 328.0 * yb5 * ln2 + 612.0 * yb7 * ln2 - 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2)
-                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4) + yb * ln64) + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0)
-                    + yb2 * ln64) + xb12 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64))
+                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4) + yb * ln64) + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1
+                    + yb2 * ln64) + xb12 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64))
                 + vb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     - 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 + 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     - 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 - 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -825,12 +825,12 @@ namespace eos
                     - 7236.0 * yb10 * ln2 + 44037.0 * yb11 * ln2 + 3.0 * yb9 * (-18.0 + 5251.0 * ln2)) - 2.0 * xb8 * (yb7 * (240.0 - 128218.0 * ln2) - 144.0 * ln2 + 824.0 * yb * ln2 - 1353.0 * yb2 * ln2 - 6430.0 * yb4 * ln2 + 952.0 * yb6 * ln2
                     + 47070.0 * yb8 * ln2 + 33633.0 * yb10 * ln2 - yb3 * (80.0 + 1599.0 * ln2) - 12.0 * yb9 * (-84.0 + 2167.0 * ln2) - 4.0 * yb5 * (76.0 + 2895.0 * ln2) + 9.0 * yb11 * (-96.0 + 12137.0 * ln2))
                     - 4.0 * xb4 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2 + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2)
-                    + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + log(16.0)) - 4.0 * xb12 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2
-                    + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2) + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + log(16.0))
+                    + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + c_ln_4) - 4.0 * xb12 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2
+                    + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2) + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + c_ln_4)
                     + 4.0 * xb2 * yb * (-1.0 + yb2) * (yb2 * (6.0 - 18.0 * ln2) + ln2 + 32.0 * yb3 * ln2 + 54.0 * yb5 * ln2 + 36.0 * yb7 * ln2 + 411.0 * yb8 * ln2 + 12.0 * yb4 * (3.0 + 35.0 * ln2) + yb6 * (54.0 + 754.0 * ln2) + yb * ln64)
                     + 4.0 * xb14 * yb * (-1.0 + yb2) * (yb2 * (6.0 - 18.0 * ln2) + ln2 + 32.0 * yb3 * ln2 + 54.0 * yb5 * ln2 + 36.0 * yb7 * ln2 + 411.0 * yb8 * ln2 + 12.0 * yb4 * (3.0 + 35.0 * ln2) + yb6 * (54.0 + 754.0 * ln2) + yb * ln64)
-                    + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64)
-                    + xb16 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64)))
+                    + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64)
+                    + xb16 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64)))
                 + tb2 * ((-vb2) * power_of<2>(1.0i + xb - 1.0i * xb2 - xb3) * yb * (6.0 * 1.0i * xb * yb2 * (6.0 - 21.0 * yb2 + 43.0 * yb4 - 31.0 * yb6 + 3.0 * yb8) * ln2 + 6.0 * 1.0i * xb13 * yb2 * (6.0 - 21.0 * yb2 + 43.0 * yb4 - 31.0 * yb6 + 3.0 * yb8) * ln2
                     + 3.0 * xb14 * yb2 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 - 3.0 * xb2 * yb2 * (-1.0 + yb2) * (4.0 - 50.0 * ln2 + 165.0 * yb6 * ln2 + 4.0 * yb4 * (9.0 + 53.0 * ln2) + yb2 * (24.0 + 73.0 * ln2))
                     + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (4.0 - 50.0 * ln2 + 165.0 * yb6 * ln2 + 4.0 * yb4 * (9.0 + 53.0 * ln2) + yb2 * (24.0 + 73.0 * ln2)) - 4.0 * 1.0i * xb3 * yb2 * (-1.0 + yb2) * (6.0 + yb2 * (36.0 - 1399.0 * ln2) - 76.0 * ln2 + 273.0 * yb6 * ln2
@@ -853,8 +853,8 @@ namespace eos
                     - 232.0 * yb6 * ln2 + 5850.0 * yb8 * ln2 + 3627.0 * yb10 * ln2 + 22107.0 * yb11 * ln2 - 3.0 * yb5 * (-5.0 + 5253.0 * ln2) + yb9 * (-27.0 + 7907.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (120.0 - 65749.0 * ln2) + yb9 * (504.0 - 15767.0 * ln2) + 64.0 * ln2 + 464.0 * yb * ln2 + 600.0 * yb2 * ln2 + 2928.0 * yb4 * ln2 - 288.0 * yb6 * ln2 - 21168.0 * yb8 * ln2 - 14904.0 * yb10 * ln2
                     - 2.0 * yb3 * (20.0 + 239.0 * ln2) - yb5 * (152.0 + 4461.0 * ln2) + yb11 * (-432.0 + 53223.0 * ln2)) - 4.0 * xb4 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2 + 2.0 * yb2 * (-5.0 + 63.0 * ln2)
-                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0) + yb * ln64) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2
-                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0) + yb * ln64))
+                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4 + yb * ln64) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2
+                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4 + yb * ln64))
                 - 4.0 * vb * xb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     - 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 + 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     - 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 - 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -868,8 +868,8 @@ namespace eos
                     - 32.0 * ln2 - 223.0 * yb * ln2 - 294.0 * yb2 * ln2 - 1818.0 * yb4 * ln2 - 534.0 * yb6 * ln2 + 11826.0 * yb8 * ln2 + 7236.0 * yb10 * ln2 + 44037.0 * yb11 * ln2 + 3.0 * yb9 * (-18.0 + 5251.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (240.0 - 128218.0 * ln2) + 144.0 * ln2 + 824.0 * yb * ln2 + 1353.0 * yb2 * ln2 + 6430.0 * yb4 * ln2 - 952.0 * yb6 * ln2 - 47070.0 * yb8 * ln2 - 33633.0 * yb10 * ln2 - yb3 * (80.0 + 1599.0 * ln2)
                     - 12.0 * yb9 * (-84.0 + 2167.0 * ln2) - 4.0 * yb5 * (76.0 + 2895.0 * ln2) + 9.0 * yb11 * (-96.0 + 12137.0 * ln2)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2
-                    + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0) + yb2 * ln64) + xb16 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0)
-                    - yb * log(8.0) + yb2 * ln64))) + 4.0 * xb2 * (vb2 * (-24.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 24.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
+                    + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1 + yb2 * ln64) + xb16 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1
+                    - yb * c_ln_1 + yb2 * ln64))) + 4.0 * xb2 * (vb2 * (-24.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 24.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
                     + 3.0 * yb3 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 + 3.0 * xb16 * yb3 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 + 8.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     - 8.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 + 8.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     - 8.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 - 8.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -880,8 +880,8 @@ namespace eos
                     + 232.0 * yb6 * ln2 - 5850.0 * yb8 * ln2 - 3627.0 * yb10 * ln2 + 22107.0 * yb11 * ln2 - 3.0 * yb5 * (-5.0 + 5253.0 * ln2) + yb9 * (-27.0 + 7907.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (120.0 - 65749.0 * ln2) + yb9 * (504.0 - 15767.0 * ln2) - 64.0 * ln2 + 464.0 * yb * ln2 - 600.0 * yb2 * ln2 - 2928.0 * yb4 * ln2 + 288.0 * yb6 * ln2 + 21168.0 * yb8 * ln2 + 14904.0 * yb10 * ln2
                     - 2.0 * yb3 * (20.0 + 239.0 * ln2) - yb5 * (152.0 + 4461.0 * ln2) + yb11 * (-432.0 + 53223.0 * ln2)) - 4.0 * xb4 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2 + 2.0 * yb2 * (-5.0 + 63.0 * ln2)
-                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0)) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2
-                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0)))
+                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2
+                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4))
                 - 4.0 * xb2 * power_of<2>(1.0i + xb) * yb * (-1.0 + yb2) * (6.0 * 1.0i * xb * yb2 * (-6.0 + 15.0 * yb2 - 28.0 * yb4 + 3.0 * yb6) * ln2 + 6.0 * 1.0i * xb9 * yb2 * (-6.0 + 15.0 * yb2 - 28.0 * yb4 + 3.0 * yb6) * ln2 - 3.0 * yb2 * (2.0 + 5.0 * yb2 + 9.0 * yb6) * ln2
                     - 3.0 * xb2 * yb2 * (1.0 + 3.0 * yb2) * (4.0 - 22.0 * ln2 + 69.0 * yb4 * ln2 + yb2 * (12.0 + 61.0 * ln2)) + 3.0 * xb8 * yb2 * (1.0 + 3.0 * yb2) * (4.0 - 22.0 * ln2 + 69.0 * yb4 * ln2 + yb2 * (12.0 + 61.0 * ln2))
                     - 8.0 * 1.0i * xb3 * yb2 * (3.0 + yb2 * (18.0 - 788.0 * ln2) - 11.0 * ln2 + 150.0 * yb6 * ln2 + yb4 * (27.0 + 217.0 * ln2)) - 8.0 * 1.0i * xb7 * yb2 * (3.0 + yb2 * (18.0 - 788.0 * ln2) - 11.0 * ln2 + 150.0 * yb6 * ln2 + yb4 * (27.0 + 217.0 * ln2))
@@ -895,8 +895,8 @@ namespace eos
                     - 3.0 * yb11 * (288.0 + 1247.0 * ln2) + 4.0 * yb9 * (360.0 + 1619.0 * ln2) + 4.0 * yb5 * (-136.0 + 5655.0 * ln2)) + xb2 * yb * (-4.0 * ln2 - 6.0 * yb * ln2 + 164.0 * yb3 * ln2 + 328.0 * yb5 * ln2 - 612.0 * yb7 * ln2 + 126.0 * yb9 * ln2
                     + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2) - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4))
                     + xb10 * yb * (-4.0 * ln2 - 6.0 * yb * ln2 + 164.0 * yb3 * ln2 + 328.0 * yb5 * ln2 - 612.0 * yb7 * ln2 + 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2)
-                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0)
-                    + yb2 * ln64) + xb12 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0) + yb2 * ln64)
+                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1
+                    + yb2 * ln64) + xb12 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1 + yb2 * ln64)
                     + 4.0 * xb6 * (yb7 * (84.0 - 27874.0 * ln2) - 22.0 * yb * ln2 + 75.0 * yb2 * ln2 + 366.0 * yb4 * ln2 - 36.0 * yb6 * ln2 - 2646.0 * yb8 * ln2 - 1863.0 * yb10 * ln2 + 27.0 * yb11 * (-16.0 + 1235.0 * ln2) - 4.0 * yb5 * (53.0 + 1596.0 * ln2)
                     - yb3 * (52.0 + 1623.0 * ln2) + yb9 * (612.0 + 6654.0 * ln2) + ln256)));
             const complex<double> logs16 = 4.0 * tb * xb2 * (16.0 * vb * xb2 * power_of<2>(-1.0i + xb) * yb * (-6.0 * 1.0i * xb * yb2 * (3.0 - 7.0 * yb2 + 27.0 * yb4 - 29.0 * yb6 + 6.0 * yb8) * ln2 - 6.0 * 1.0i * xb9 * yb2 * (3.0 - 7.0 * yb2 + 27.0 * yb4 - 29.0 * yb6 + 6.0 * yb8) * ln2
@@ -905,9 +905,9 @@ namespace eos
                     + 2.0 * xb4 * (yb4 * (46.0 - 621.0 * ln2) + 34.0 * ln2 + 108.0 * yb10 * (2.0 + 17.0 * ln2) + yb2 * (14.0 + 111.0 * ln2) - 3.0 * yb8 * (66.0 + 763.0 * ln2) - yb6 * (78.0 + 3167.0 * ln2))
                     - 2.0 * xb6 * (yb4 * (46.0 - 621.0 * ln2) + 34.0 * ln2 + 108.0 * yb10 * (2.0 + 17.0 * ln2) + yb2 * (14.0 + 111.0 * ln2) - 3.0 * yb8 * (66.0 + 763.0 * ln2) - yb6 * (78.0 + 3167.0 * ln2))
                     + 4.0 * 1.0i * xb5 * (yb6 * (60.0 - 4851.0 * ln2) - 36.0 * ln2 - yb2 * (20.0 + 543.0 * ln2) + 6.0 * yb10 * (-36.0 + 1309.0 * ln2) - yb4 * (76.0 + 1857.0 * ln2) + yb8 * (252.0 + 3529.0 * ln2))
-                    - yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + log(8.0)) + xb10 * yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + log(8.0))
-                    + xb2 * (yb6 * (36.0 - 125.0 * ln2) + yb2 * (12.0 - 37.0 * ln2) - 1338.0 * yb10 * ln2 - yb8 * (108.0 + 385.0 * ln2) + 3.0 * yb4 * (20.0 + 627.0 * ln2) + log(16.0))
-                    + xb8 * (-1.0 + yb2) * (yb2 * (12.0 - 33.0 * ln2) + 1338.0 * yb8 * ln2 + 24.0 * yb4 * (3.0 + 77.0 * ln2) + yb6 * (108.0 + 1723.0 * ln2) + log(16.0)))
+                    - yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + c_ln_1) + xb10 * yb2 * (-51.0 * yb2 * ln2 + 63.0 * yb4 * ln2 - 33.0 * yb6 * ln2 + 18.0 * yb8 * ln2 + c_ln_1)
+                    + xb2 * (yb6 * (36.0 - 125.0 * ln2) + yb2 * (12.0 - 37.0 * ln2) - 1338.0 * yb10 * ln2 - yb8 * (108.0 + 385.0 * ln2) + 3.0 * yb4 * (20.0 + 627.0 * ln2) + c_ln_4)
+                    + xb8 * (-1.0 + yb2) * (yb2 * (12.0 - 33.0 * ln2) + 1338.0 * yb8 * ln2 + 24.0 * yb4 * (3.0 + 77.0 * ln2) + yb6 * (108.0 + 1723.0 * ln2) + c_ln_4))
                 - 4.0 * xb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 48.0 * 1.0i * xb11 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 + 16.0 * 1.0i * xb3 * yb3 * (1.0 - 774.0 * yb2 + 780.0 * yb4 - 10.0 * yb6 + 3.0 * yb8) * ln2
                     - 16.0 * 1.0i * xb9 * yb3 * (1.0 - 774.0 * yb2 + 780.0 * yb4 - 10.0 * yb6 + 3.0 * yb8) * ln2 - 96.0 * 1.0i * xb5 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) * ln2
                     + 96.0 * 1.0i * xb7 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) * ln2 - xb4 * (yb5 * (544.0 - 22620.0 * ln2) + yb3 * (128.0 - 339.0 * ln2) + 16.0 * ln2 + 48.0 * yb * ln2 + 147.0 * yb2 * ln2 + 890.0 * yb4 * ln2
@@ -917,8 +917,8 @@ namespace eos
                     + 2646.0 * yb8 * ln2 + 1863.0 * yb10 * ln2 + 27.0 * yb11 * (-16.0 + 1235.0 * ln2) - 4.0 * yb5 * (53.0 + 1596.0 * ln2) - yb3 * (52.0 + 1623.0 * ln2) + yb9 * (612.0 + 6654.0 * ln2))
                     + xb2 * yb * (-4.0 * ln2 - 164.0 * yb3 * ln2 - 328.0 * yb5 * ln2 + 612.0 * yb7 * ln2 - 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2) - 4.0 * yb6 * (18.0 + 391.0 * ln2)
                     - yb2 * (24.0 + ln4) + yb * ln64) + xb10 * yb * (-4.0 * ln2 - 164.0 * yb3 * ln2 - 328.0 * yb5 * ln2 + 612.0 * yb7 * ln2 - 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2)
-                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4) + yb * ln64) + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0)
-                    + yb2 * ln64) + xb12 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64))
+                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4) + yb * ln64) + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1
+                    + yb2 * ln64) + xb12 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64))
                 + vb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     + 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 - 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     + 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 + 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -928,12 +928,12 @@ namespace eos
                     - 7236.0 * yb10 * ln2 + 44037.0 * yb11 * ln2 + 3.0 * yb9 * (-18.0 + 5251.0 * ln2)) - 2.0 * xb8 * (yb7 * (240.0 - 128218.0 * ln2) - 144.0 * ln2 + 824.0 * yb * ln2 - 1353.0 * yb2 * ln2 - 6430.0 * yb4 * ln2 + 952.0 * yb6 * ln2
                     + 47070.0 * yb8 * ln2 + 33633.0 * yb10 * ln2 - yb3 * (80.0 + 1599.0 * ln2) - 12.0 * yb9 * (-84.0 + 2167.0 * ln2) - 4.0 * yb5 * (76.0 + 2895.0 * ln2) + 9.0 * yb11 * (-96.0 + 12137.0 * ln2))
                     - 4.0 * xb4 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2 + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2)
-                    + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + log(16.0)) - 4.0 * xb12 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2
-                    + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2) + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + log(16.0))
+                    + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + c_ln_4) - 4.0 * xb12 * (yb5 * (76.0 - 2496.0 * ln2) + yb3 * (20.0 - 81.0 * ln2) + 18.0 * yb * ln2 + 51.0 * yb2 * ln2 - 186.0 * yb4 * ln2 - 756.0 * yb6 * ln2
+                    + 54.0 * yb8 * ln2 - 1215.0 * yb10 * ln2 + 3.0 * yb11 * (72.0 + 149.0 * ln2) + 6.0 * yb7 * (-10.0 + 247.0 * ln2) - 2.0 * yb9 * (126.0 + 709.0 * ln2) + c_ln_4)
                     + 4.0 * xb2 * yb * (-1.0 + yb2) * (yb2 * (6.0 - 18.0 * ln2) + ln2 + 32.0 * yb3 * ln2 + 54.0 * yb5 * ln2 + 36.0 * yb7 * ln2 + 411.0 * yb8 * ln2 + 12.0 * yb4 * (3.0 + 35.0 * ln2) + yb6 * (54.0 + 754.0 * ln2) + yb * ln64)
                     + 4.0 * xb14 * yb * (-1.0 + yb2) * (yb2 * (6.0 - 18.0 * ln2) + ln2 + 32.0 * yb3 * ln2 + 54.0 * yb5 * ln2 + 36.0 * yb7 * ln2 + 411.0 * yb8 * ln2 + 12.0 * yb4 * (3.0 + 35.0 * ln2) + yb6 * (54.0 + 754.0 * ln2) + yb * ln64)
-                    + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64)
-                    + xb16 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - log(8.0) + yb2 * ln64)))
+                    + (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64)
+                    + xb16 * (-1.0 + yb) * yb2 * (66.0 * yb3 * ln2 + 90.0 * yb4 * ln2 + 12.0 * yb5 * ln2 - 42.0 * yb6 * ln2 + 18.0 * yb7 * ln2 + 45.0 * yb8 * ln2 - c_ln_1 + yb2 * ln64)))
                 + tb2 * ((-vb2) * power_of<2>(1.0i - xb - 1.0i * xb2 + xb3) * yb * (-6.0 * 1.0i * xb * yb2 * (6.0 - 21.0 * yb2 + 43.0 * yb4 - 31.0 * yb6 + 3.0 * yb8) * ln2 - 6.0 * 1.0i * xb13 * yb2 * (6.0 - 21.0 * yb2 + 43.0 * yb4 - 31.0 * yb6 + 3.0 * yb8) * ln2
                     + 3.0 * xb14 * yb2 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 - 3.0 * xb2 * yb2 * (-1.0 + yb2) * (4.0 - 50.0 * ln2 + 165.0 * yb6 * ln2 + 4.0 * yb4 * (9.0 + 53.0 * ln2) + yb2 * (24.0 + 73.0 * ln2))
                     + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (4.0 - 50.0 * ln2 + 165.0 * yb6 * ln2 + 4.0 * yb4 * (9.0 + 53.0 * ln2) + yb2 * (24.0 + 73.0 * ln2)) + 4.0 * 1.0i * xb3 * yb2 * (-1.0 + yb2) * (6.0 + yb2 * (36.0 - 1399.0 * ln2) - 76.0 * ln2 + 273.0 * yb6 * ln2
@@ -956,8 +956,8 @@ namespace eos
                     - 232.0 * yb6 * ln2 + 5850.0 * yb8 * ln2 + 3627.0 * yb10 * ln2 + 22107.0 * yb11 * ln2 - 3.0 * yb5 * (-5.0 + 5253.0 * ln2) + yb9 * (-27.0 + 7907.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (120.0 - 65749.0 * ln2) + yb9 * (504.0 - 15767.0 * ln2) + 64.0 * ln2 + 464.0 * yb * ln2 + 600.0 * yb2 * ln2 + 2928.0 * yb4 * ln2 - 288.0 * yb6 * ln2 - 21168.0 * yb8 * ln2 - 14904.0 * yb10 * ln2
                     - 2.0 * yb3 * (20.0 + 239.0 * ln2) - yb5 * (152.0 + 4461.0 * ln2) + yb11 * (-432.0 + 53223.0 * ln2)) - 4.0 * xb4 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2 + 2.0 * yb2 * (-5.0 + 63.0 * ln2)
-                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0) + yb * ln64) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2
-                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0) + yb * ln64))
+                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4 + yb * ln64) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-158.0 * yb3 * ln2 - 486.0 * yb5 * ln2 + 126.0 * yb7 * ln2
+                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4 + yb * ln64))
                 - 4.0 * vb * xb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     + 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 - 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     + 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 + 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -971,8 +971,8 @@ namespace eos
                     - 32.0 * ln2 - 223.0 * yb * ln2 - 294.0 * yb2 * ln2 - 1818.0 * yb4 * ln2 - 534.0 * yb6 * ln2 + 11826.0 * yb8 * ln2 + 7236.0 * yb10 * ln2 + 44037.0 * yb11 * ln2 + 3.0 * yb9 * (-18.0 + 5251.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (240.0 - 128218.0 * ln2) + 144.0 * ln2 + 824.0 * yb * ln2 + 1353.0 * yb2 * ln2 + 6430.0 * yb4 * ln2 - 952.0 * yb6 * ln2 - 47070.0 * yb8 * ln2 - 33633.0 * yb10 * ln2 - yb3 * (80.0 + 1599.0 * ln2)
                     - 12.0 * yb9 * (-84.0 + 2167.0 * ln2) - 4.0 * yb5 * (76.0 + 2895.0 * ln2) + 9.0 * yb11 * (-96.0 + 12137.0 * ln2)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2
-                    + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0) + yb2 * ln64) + xb16 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0)
-                    - yb * log(8.0) + yb2 * ln64))) + 4.0 * xb2 * (vb2 * (24.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 24.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
+                    + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1 + yb2 * ln64) + xb16 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1
+                    - yb * c_ln_1 + yb2 * ln64))) + 4.0 * xb2 * (vb2 * (24.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 24.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
                     + 3.0 * yb3 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 + 3.0 * xb16 * yb3 * (-2.0 - 3.0 * yb2 + 5.0 * yb4 - 9.0 * yb6 + 9.0 * yb8) * ln2 - 8.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2
                     + 8.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) * ln2 - 8.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2
                     + 8.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) * ln2 + 8.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8) * ln2
@@ -983,8 +983,8 @@ namespace eos
                     + 232.0 * yb6 * ln2 - 5850.0 * yb8 * ln2 - 3627.0 * yb10 * ln2 + 22107.0 * yb11 * ln2 - 3.0 * yb5 * (-5.0 + 5253.0 * ln2) + yb9 * (-27.0 + 7907.0 * ln2))
                     - 2.0 * xb8 * (yb7 * (120.0 - 65749.0 * ln2) + yb9 * (504.0 - 15767.0 * ln2) - 64.0 * ln2 + 464.0 * yb * ln2 - 600.0 * yb2 * ln2 - 2928.0 * yb4 * ln2 + 288.0 * yb6 * ln2 + 21168.0 * yb8 * ln2 + 14904.0 * yb10 * ln2
                     - 2.0 * yb3 * (20.0 + 239.0 * ln2) - yb5 * (152.0 + 4461.0 * ln2) + yb11 * (-432.0 + 53223.0 * ln2)) - 4.0 * xb4 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2 + 2.0 * yb2 * (-5.0 + 63.0 * ln2)
-                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0)) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2
-                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + log(16.0)))
+                    + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4) - 4.0 * xb12 * yb * (-1.0 + yb2) * (-6.0 * yb * ln2 + 158.0 * yb3 * ln2 + 486.0 * yb5 * ln2 - 126.0 * yb7 * ln2
+                    + 2.0 * yb2 * (-5.0 + 63.0 * ln2) + 3.0 * yb8 * (36.0 + 191.0 * ln2) + 2.0 * yb6 * (-9.0 + 278.0 * ln2) + 3.0 * yb4 * (-16.0 + 567.0 * ln2) + c_ln_4))
                 - 4.0 * xb2 * power_of<2>(-1.0i + xb) * yb * (-1.0 + yb2) * (-6.0 * 1.0i * xb * yb2 * (-6.0 + 15.0 * yb2 - 28.0 * yb4 + 3.0 * yb6) * ln2 - 6.0 * 1.0i * xb9 * yb2 * (-6.0 + 15.0 * yb2 - 28.0 * yb4 + 3.0 * yb6) * ln2 - 3.0 * yb2 * (2.0 + 5.0 * yb2 + 9.0 * yb6) * ln2
                     - 3.0 * xb2 * yb2 * (1.0 + 3.0 * yb2) * (4.0 - 22.0 * ln2 + 69.0 * yb4 * ln2 + yb2 * (12.0 + 61.0 * ln2)) + 3.0 * xb8 * yb2 * (1.0 + 3.0 * yb2) * (4.0 - 22.0 * ln2 + 69.0 * yb4 * ln2 + yb2 * (12.0 + 61.0 * ln2))
                     + 8.0 * 1.0i * xb3 * yb2 * (3.0 + yb2 * (18.0 - 788.0 * ln2) - 11.0 * ln2 + 150.0 * yb6 * ln2 + yb4 * (27.0 + 217.0 * ln2)) + 8.0 * 1.0i * xb7 * yb2 * (3.0 + yb2 * (18.0 - 788.0 * ln2) - 11.0 * ln2 + 150.0 * yb6 * ln2 + yb4 * (27.0 + 217.0 * ln2))
@@ -998,8 +998,8 @@ namespace eos
                     - 3.0 * yb11 * (288.0 + 1247.0 * ln2) + 4.0 * yb9 * (360.0 + 1619.0 * ln2) + 4.0 * yb5 * (-136.0 + 5655.0 * ln2)) + xb2 * yb * (-4.0 * ln2 - 6.0 * yb * ln2 + 164.0 * yb3 * ln2 + 328.0 * yb5 * ln2 - 612.0 * yb7 * ln2 + 126.0 * yb9 * ln2
                     + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2) - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4))
                     + xb10 * yb * (-4.0 * ln2 - 6.0 * yb * ln2 + 164.0 * yb3 * ln2 + 328.0 * yb5 * ln2 - 612.0 * yb7 * ln2 + 126.0 * yb9 * ln2 + 1806.0 * yb10 * ln2 - 24.0 * yb4 * (5.0 + 64.0 * ln2) + 4.0 * yb8 * (54.0 + 325.0 * ln2)
-                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0)
-                    + yb2 * ln64) + xb12 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - log(8.0) - yb * log(8.0) + yb2 * ln64)
+                    - 4.0 * yb6 * (18.0 + 391.0 * ln2) - yb2 * (24.0 + ln4)) + yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1
+                    + yb2 * ln64) + xb12 * yb2 * (-60.0 * yb3 * ln2 + 24.0 * yb4 * ln2 + 78.0 * yb5 * ln2 - 54.0 * yb6 * ln2 - 60.0 * yb7 * ln2 + 27.0 * yb8 * ln2 + 45.0 * yb9 * ln2 - c_ln_1 - yb * c_ln_1 + yb2 * ln64)
                     + 4.0 * xb6 * (yb7 * (84.0 - 27874.0 * ln2) - 22.0 * yb * ln2 + 75.0 * yb2 * ln2 + 366.0 * yb4 * ln2 - 36.0 * yb6 * ln2 - 2646.0 * yb8 * ln2 - 1863.0 * yb10 * ln2 + 27.0 * yb11 * (-16.0 + 1235.0 * ln2) - 4.0 * yb5 * (53.0 + 1596.0 * ln2)
                     - yb3 * (52.0 + 1623.0 * ln2) + yb9 * (612.0 + 6654.0 * ln2) + ln256)));
             const complex<double> logs17 = 4.0 * tb * xb2 * (vb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8)
@@ -1031,7 +1031,7 @@ namespace eos
                     + 4.0 * xb6 * (38.0 + yb2 * (975.0 - 624.0 * ln2) + 24.0 * yb10 * (-731.0 + 138.0 * ln2) - 17.0 * yb6 * (-757.0 + 1152.0 * ln2) + 3.0 * yb4 * (1445.0 + 4128.0 * ln2) + yb8 * (-4769.0 + 4512.0 * ln2))
                     + xb4 * (80.0 + yb6 * (6095.0 - 51264.0 * ln2) + yb2 * (163.0 - 1584.0 * ln2) + 6.0 * yb10 * (-37.0 + 1512.0 * ln2) + yb8 * (-6241.0 + 11232.0 * ln2) + yb4 * (-8067.0 + 32544.0 * ln2))
                     + xb8 * (80.0 + yb6 * (6095.0 - 51264.0 * ln2) + yb2 * (163.0 - 1584.0 * ln2) + 6.0 * yb10 * (-37.0 + 1512.0 * ln2) + yb8 * (-6241.0 + 11232.0 * ln2) + yb4 * (-8067.0 + 32544.0 * ln2))
-                    + 3.0 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + log(32.0)) + 6.0 * yb6 * (-1.0 + ln256)) + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + log(32.0))
+                    + 3.0 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + c_ln_2) + 6.0 * yb6 * (-1.0 + ln256)) + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + c_ln_2)
                     + 6.0 * yb6 * (-1.0 + ln256)))) + 4.0 * xb2 * (4.0 * vb * xb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 48.0 * 1.0i * xb11 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 96.0 * 1.0i * xb5 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8)
                     + 96.0 * 1.0i * xb7 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) + 16.0 * 1.0i * xb3 * (yb3 - 774.0 * yb5 + 780.0 * yb7 - 10.0 * yb9 + 3.0 * yb11) - 16.0 * 1.0i * xb9 * (yb3 - 774.0 * yb5 + 780.0 * yb7 - 10.0 * yb9 + 3.0 * yb11)
                     + 3.0 * yb2 * (-1.0 + yb2) * (-1.0 + yb2 + 9.0 * yb4 - 9.0 * yb6 + yb5 * (5.0 - 224.0 * ln2) + 3.0 * yb7 * (-5.0 + 32.0 * ln2) - yb * (1.0 + 32.0 * ln2) + yb3 * (-21.0 + 160.0 * ln2))
@@ -1059,8 +1059,8 @@ namespace eos
                     + xb6 * (32.0 + yb4 * (2494.0 - 8160.0 * ln2) + 8.0 * yb2 * (53.0 + 60.0 * ln2) + 18.0 * yb8 * (319.0 + 112.0 * ln2) + 12.0 * yb6 * (537.0 + 472.0 * ln2))
                     - 8.0 * 1.0i * xb3 * yb2 * (11.0 + yb2 * (788.0 - 1920.0 * ln2) + 96.0 * ln2 + 6.0 * yb6 * (-25.0 + 96.0 * ln2) + yb4 * (-217.0 + 1248.0 * ln2)) - 8.0 * 1.0i * xb7 * yb2 * (11.0 + yb2 * (788.0 - 1920.0 * ln2) + 96.0 * ln2 + 6.0 * yb6 * (-25.0 + 96.0 * ln2)
                     + yb4 * (-217.0 + 1248.0 * ln2)) - 4.0 * 1.0i * xb5 * (16.0 + 6.0 * yb2 * (-35.0 + 72.0 * ln2) + 15.0 * yb8 * (-431.0 + 144.0 * ln2) + 16.0 * yb6 * (-452.0 + 333.0 * ln2) - 3.0 * yb4 * (239.0 + 2640.0 * ln2))
-                    + 3.0 * xb10 * yb2 * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) - 6.0 * 1.0i * xb * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0))
-                    - 2.0 * (3.0 + ln256)) - 6.0 * 1.0i * xb9 * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))))
+                    + 3.0 * xb10 * yb2 * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) - 6.0 * 1.0i * xb * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4)
+                    - 2.0 * (3.0 + ln256)) - 6.0 * 1.0i * xb9 * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))))
                 - tb2 * (4.0 * vb * xb2 * (48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) - 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8)
                     + 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) - 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8)
                     + 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) + 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8)
@@ -1096,10 +1096,10 @@ namespace eos
                     - 4.0 * 1.0i * xb11 * yb2 * (-1.0 + yb2) * (76.0 + yb2 * (1399.0 - 4080.0 * ln2) + 240.0 * ln2 + 21.0 * yb6 * (-13.0 + 48.0 * ln2) + yb4 * (-290.0 + 2832.0 * ln2))
                     + xb6 * (-896.0 + yb6 * (6451.0 - 28224.0 * ln2) + 9.0 * yb10 * (3823.0 + 432.0 * ln2) - 2.0 * yb2 * (3011.0 + 504.0 * ln2) + 3.0 * yb4 * (-4295.0 + 5856.0 * ln2) + yb8 * (44481.0 + 7776.0 * ln2))
                     + xb8 * (896.0 - 9.0 * yb10 * (3823.0 + 432.0 * ln2) + 2.0 * yb2 * (3011.0 + 504.0 * ln2) - 3.0 * yb8 * (14827.0 + 2592.0 * ln2) - 3.0 * yb4 * (-4295.0 + 5856.0 * ln2) + yb6 * (-6451.0 + 28224.0 * ln2))
-                    + 8.0 * 1.0i * xb7 * (-224.0 + yb6 * (11161.0 - 6912.0 * ln2) + 21.0 * yb10 * (-29.0 + 48.0 * ln2) + 9.0 * yb4 * (-371.0 + 480.0 * ln2) + yb8 * (10415.0 + 1824.0 * ln2) - 60.0 * yb2 * (17.0 + log(16.0)))
+                    + 8.0 * 1.0i * xb7 * (-224.0 + yb6 * (11161.0 - 6912.0 * ln2) + 21.0 * yb10 * (-29.0 + 48.0 * ln2) + 9.0 * yb4 * (-371.0 + 480.0 * ln2) + yb8 * (10415.0 + 1824.0 * ln2) - 60.0 * yb2 * (17.0 + c_ln_4))
                     - 3.0 * yb2 * (-1.0 + yb2) * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) + 3.0 * xb14 * yb2 * (-1.0 + yb2) * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2)
-                    - 2.0 * (1.0 + ln256)) - 6.0 * 1.0i * xb * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))
-                    - 6.0 * 1.0i * xb13 * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))));
+                    - 2.0 * (1.0 + ln256)) - 6.0 * 1.0i * xb * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))
+                    - 6.0 * 1.0i * xb13 * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))));
             const complex<double> logs18 = 4.0 * tb * xb2 * (vb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8)
                     - 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) + 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8)
                     - 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) - 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8)
@@ -1129,7 +1129,7 @@ namespace eos
                     + 4.0 * xb6 * (38.0 + yb2 * (975.0 - 624.0 * ln2) + 24.0 * yb10 * (-731.0 + 138.0 * ln2) - 17.0 * yb6 * (-757.0 + 1152.0 * ln2) + 3.0 * yb4 * (1445.0 + 4128.0 * ln2) + yb8 * (-4769.0 + 4512.0 * ln2))
                     + xb4 * (80.0 + yb6 * (6095.0 - 51264.0 * ln2) + yb2 * (163.0 - 1584.0 * ln2) + 6.0 * yb10 * (-37.0 + 1512.0 * ln2) + yb8 * (-6241.0 + 11232.0 * ln2) + yb4 * (-8067.0 + 32544.0 * ln2))
                     + xb8 * (80.0 + yb6 * (6095.0 - 51264.0 * ln2) + yb2 * (163.0 - 1584.0 * ln2) + 6.0 * yb10 * (-37.0 + 1512.0 * ln2) + yb8 * (-6241.0 + 11232.0 * ln2) + yb4 * (-8067.0 + 32544.0 * ln2))
-                    + 3.0 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + log(32.0)) + 6.0 * yb6 * (-1.0 + ln256)) + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + log(32.0))
+                    + 3.0 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + c_ln_2) + 6.0 * yb6 * (-1.0 + ln256)) + 3.0 * xb12 * yb2 * (-1.0 + yb2) * (1.0 + yb4 * (5.0 - 112.0 * ln2) - 16.0 * ln2 + 16.0 * yb2 * (-1.0 + c_ln_2)
                     + 6.0 * yb6 * (-1.0 + ln256)))) + 4.0 * xb2 * (4.0 * vb * xb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 48.0 * 1.0i * xb11 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 96.0 * 1.0i * xb5 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8)
                     - 96.0 * 1.0i * xb7 * yb3 * (-37.0 - 258.0 * yb2 - 540.0 * yb4 + 82.0 * yb6 + 753.0 * yb8) - 16.0 * 1.0i * xb3 * (yb3 - 774.0 * yb5 + 780.0 * yb7 - 10.0 * yb9 + 3.0 * yb11) + 16.0 * 1.0i * xb9 * (yb3 - 774.0 * yb5 + 780.0 * yb7 - 10.0 * yb9 + 3.0 * yb11)
                     + 3.0 * yb2 * (-1.0 + yb2) * (-1.0 + yb2 + 9.0 * yb4 - 9.0 * yb6 + yb5 * (5.0 - 224.0 * ln2) + 3.0 * yb7 * (-5.0 + 32.0 * ln2) - yb * (1.0 + 32.0 * ln2) + yb3 * (-21.0 + 160.0 * ln2))
@@ -1157,8 +1157,8 @@ namespace eos
                     + xb6 * (32.0 + yb4 * (2494.0 - 8160.0 * ln2) + 8.0 * yb2 * (53.0 + 60.0 * ln2) + 18.0 * yb8 * (319.0 + 112.0 * ln2) + 12.0 * yb6 * (537.0 + 472.0 * ln2))
                     + 8.0 * 1.0i * xb3 * yb2 * (11.0 + yb2 * (788.0 - 1920.0 * ln2) + 96.0 * ln2 + 6.0 * yb6 * (-25.0 + 96.0 * ln2) + yb4 * (-217.0 + 1248.0 * ln2)) + 8.0 * 1.0i * xb7 * yb2 * (11.0 + yb2 * (788.0 - 1920.0 * ln2) + 96.0 * ln2 + 6.0 * yb6 * (-25.0 + 96.0 * ln2)
                     + yb4 * (-217.0 + 1248.0 * ln2)) + 4.0 * 1.0i * xb5 * (16.0 + 6.0 * yb2 * (-35.0 + 72.0 * ln2) + 15.0 * yb8 * (-431.0 + 144.0 * ln2) + 16.0 * yb6 * (-452.0 + 333.0 * ln2) - 3.0 * yb4 * (239.0 + 2640.0 * ln2))
-                    + 3.0 * xb10 * yb2 * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) + 6.0 * 1.0i * xb * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0))
-                    - 2.0 * (3.0 + ln256)) + 6.0 * 1.0i * xb9 * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))))
+                    + 3.0 * xb10 * yb2 * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) + 6.0 * 1.0i * xb * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4)
+                    - 2.0 * (3.0 + ln256)) + 6.0 * 1.0i * xb9 * yb2 * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))))
                 - tb2 * (4.0 * vb * xb2 * (-48.0 * 1.0i * xb * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 48.0 * 1.0i * xb15 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) + 16.0 * 1.0i * xb3 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8)
                     - 16.0 * 1.0i * xb13 * yb3 * (5.0 + 738.0 * yb2 - 708.0 * yb4 - 50.0 * yb6 + 15.0 * yb8) + 16.0 * 1.0i * xb5 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8)
                     - 16.0 * 1.0i * xb11 * yb3 * (-223.0 - 3078.0 * yb2 - 1716.0 * yb4 + 502.0 * yb6 + 4515.0 * yb8) - 16.0 * 1.0i * xb7 * yb3 * (-665.0 - 5418.0 * yb2 - 8940.0 * yb4 + 1466.0 * yb6 + 13557.0 * yb8)
@@ -1194,88 +1194,88 @@ namespace eos
                     + 4.0 * 1.0i * xb11 * yb2 * (-1.0 + yb2) * (76.0 + yb2 * (1399.0 - 4080.0 * ln2) + 240.0 * ln2 + 21.0 * yb6 * (-13.0 + 48.0 * ln2) + yb4 * (-290.0 + 2832.0 * ln2))
                     + xb6 * (-896.0 + yb6 * (6451.0 - 28224.0 * ln2) + 9.0 * yb10 * (3823.0 + 432.0 * ln2) - 2.0 * yb2 * (3011.0 + 504.0 * ln2) + 3.0 * yb4 * (-4295.0 + 5856.0 * ln2) + yb8 * (44481.0 + 7776.0 * ln2))
                     + xb8 * (896.0 - 9.0 * yb10 * (3823.0 + 432.0 * ln2) + 2.0 * yb2 * (3011.0 + 504.0 * ln2) - 3.0 * yb8 * (14827.0 + 2592.0 * ln2) - 3.0 * yb4 * (-4295.0 + 5856.0 * ln2) + yb6 * (-6451.0 + 28224.0 * ln2))
-                    - 8.0 * 1.0i * xb7 * (-224.0 + yb6 * (11161.0 - 6912.0 * ln2) + 21.0 * yb10 * (-29.0 + 48.0 * ln2) + 9.0 * yb4 * (-371.0 + 480.0 * ln2) + yb8 * (10415.0 + 1824.0 * ln2) - 60.0 * yb2 * (17.0 + log(16.0)))
+                    - 8.0 * 1.0i * xb7 * (-224.0 + yb6 * (11161.0 - 6912.0 * ln2) + 21.0 * yb10 * (-29.0 + 48.0 * ln2) + 9.0 * yb4 * (-371.0 + 480.0 * ln2) + yb8 * (10415.0 + 1824.0 * ln2) - 60.0 * yb2 * (17.0 + c_ln_4))
                     - 3.0 * yb2 * (-1.0 + yb2) * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2) - 2.0 * (1.0 + ln256)) + 3.0 * xb14 * yb2 * (-1.0 + yb2) * (-112.0 * yb4 * ln2 + yb6 * (-9.0 + 48.0 * ln2) + yb2 * (-5.0 + 80.0 * ln2)
-                    - 2.0 * (1.0 + ln256)) + 6.0 * 1.0i * xb * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))
-                    + 6.0 * 1.0i * xb13 * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + log(16.0)) - 2.0 * (3.0 + ln256))));
+                    - 2.0 * (1.0 + ln256)) + 6.0 * 1.0i * xb * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))
+                    + 6.0 * 1.0i * xb13 * yb2 * (-1.0 + yb2) * (5.0 * yb2 * (3.0 + 16.0 * ln2) + yb6 * (3.0 + 48.0 * ln2) - 28.0 * yb4 * (1.0 + c_ln_4) - 2.0 * (3.0 + ln256))));
             const complex<double> logs19 = -2.0 * tb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 - yb3 * (941.0 + 156.0 * ln2) + 18.0 * yb5 * (-173.0 + 172.0 * ln2) + 4.0 * yb9 * (2041.0 + 282.0 * ln2) - 8.0 * yb7 * (-565.0 + 612.0 * ln2)
                     + yb11 * (3813.0 + 828.0 * ln2)) + xb4 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2) - 16.0 * yb7 * (-143.0 + 801.0 * ln2)
                     + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + xb8 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2)
-                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0)))
-                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0))))
+                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4))
+                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4)))
                 + tb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-64.0 - 416.0 * yb - 600.0 * yb2 - 2320.0 * yb4 + 1408.0 * yb6 + 19152.0 * yb8 + 15192.0 * yb10 - yb3 * (2536.0 + 57.0 * ln2) + 18.0 * yb5 * (-600.0 + 59.0 * ln2) + 3.0 * yb11 * (3704.0 + 87.0 * ln2) - 4.0 * yb7 * (-3328.0 + 423.0 * ln2)
-                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0)) + 3.0 * yb5 * (2.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0))
-                    + 3.0 * yb5 * (2.0 + log(128.0)))) - 4.0 * xb2 * (4.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
+                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2) + 3.0 * yb5 * (2.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2)
+                    + 3.0 * yb5 * (2.0 + c_ln_3))) - 4.0 * xb2 * (4.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
                     - 8.0 * yb7 * (-208.0 + 153.0 * ln2) + yb9 * (2762.0 + 282.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (8.0 + 304.0 * yb3 + 864.0 * yb5 - 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2)
                     + yb6 * (1904.0 + 1269.0 * ln2)) + xb8 * yb * (-1.0 + yb2) * (8.0 + 304.0 * yb3 + 864.0 * yb5 - 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2) + yb6 * (1904.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0)) + 3.0 * yb5 * (-1.0 + log(512.0))) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0))
-                    + 3.0 * yb5 * (-1.0 + log(512.0))));
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5) + 3.0 * yb5 * (-1.0 + c_ln_5)) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5)
+                    + 3.0 * yb5 * (-1.0 + c_ln_5)));
             const complex<double> logs20 = 2.0 * tb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 - 9.0 * yb - 67.0 * yb3 - 135.0 * yb5 - 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 4.0 * xb6 * (-24.0 - 154.0 * yb - 225.0 * yb2 - 794.0 * yb4 + 668.0 * yb6 + 6930.0 * yb8 + 5733.0 * yb10 - yb3 * (941.0 + 156.0 * ln2) + 18.0 * yb5 * (-173.0 + 172.0 * ln2) + 4.0 * yb9 * (2041.0 + 282.0 * ln2) - 8.0 * yb7 * (-565.0 + 612.0 * ln2)
                     + yb11 * (3813.0 + 828.0 * ln2)) + xb4 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2) - 16.0 * yb7 * (-143.0 + 801.0 * ln2)
                     + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + xb8 * (16.0 + 80.0 * yb + 147.0 * yb2 - 326.0 * yb4 - 2008.0 * yb6 - 1818.0 * yb8 - 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2)
-                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0)))
-                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + log(16.0))))
+                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4))
+                + 3.0 * xb12 * power_of<2>(-1.0 + yb) * yb2 * power_of<3>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (2.0 - 4.0 * ln2) + yb2 * (1.0 + c_ln_4)))
                 - tb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (-64.0 - 416.0 * yb - 600.0 * yb2 - 2320.0 * yb4 + 1408.0 * yb6 + 19152.0 * yb8 + 15192.0 * yb10 - yb3 * (2536.0 + 57.0 * ln2) + 18.0 * yb5 * (-600.0 + 59.0 * ln2) + 3.0 * yb11 * (3704.0 + 87.0 * ln2) - 4.0 * yb7 * (-3328.0 + 423.0 * ln2)
-                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0)) + 3.0 * yb5 * (2.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0))
-                    + 3.0 * yb5 * (2.0 + log(128.0)))) + 4.0 * xb2 * (4.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
+                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 + 152.0 * yb3 + 432.0 * yb5 - 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2) + 3.0 * yb5 * (2.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (-2.0 + 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2)
+                    + 3.0 * yb5 * (2.0 + c_ln_3))) + 4.0 * xb2 * (4.0 * xb6 * (-8.0 - 52.0 * yb - 75.0 * yb2 - 290.0 * yb4 + 176.0 * yb6 + 2394.0 * yb8 + 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
                     - 8.0 * yb7 * (-208.0 + 153.0 * ln2) + yb9 * (2762.0 + 282.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (8.0 + 304.0 * yb3 + 864.0 * yb5 - 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2)
                     + yb6 * (1904.0 + 1269.0 * ln2)) + xb8 * yb * (-1.0 + yb2) * (8.0 + 304.0 * yb3 + 864.0 * yb5 - 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2) + yb6 * (1904.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0)) + 3.0 * yb5 * (-1.0 + log(512.0))) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0))
-                    + 3.0 * yb5 * (-1.0 + log(512.0))));
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5) + 3.0 * yb5 * (-1.0 + c_ln_5)) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (1.0 - 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5)
+                    + 3.0 * yb5 * (-1.0 + c_ln_5)));
             const complex<double> logs21 = 2.0 * vb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 - yb3 * (941.0 + 156.0 * ln2) + 18.0 * yb5 * (-173.0 + 172.0 * ln2) + 4.0 * yb9 * (2041.0 + 282.0 * ln2) - 8.0 * yb7 * (-565.0 + 612.0 * ln2)
                     + yb11 * (3813.0 + 828.0 * ln2)) + xb4 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2) - 16.0 * yb7 * (-143.0 + 801.0 * ln2)
                     + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + xb8 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2)
-                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0)))
-                + 3.0 * xb12 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0))))
+                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4))
+                + 3.0 * xb12 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4)))
                 + vb2 * (24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 + 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 - 2.0 * xb8 * (64.0 - 416.0 * yb + 600.0 * yb2 + 2320.0 * yb4 - 1408.0 * yb6 - 19152.0 * yb8 - 15192.0 * yb10 - yb3 * (2536.0 + 57.0 * ln2) + 18.0 * yb5 * (-600.0 + 59.0 * ln2) + 3.0 * yb11 * (3704.0 + 87.0 * ln2) - 4.0 * yb7 * (-3328.0 + 423.0 * ln2)
-                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0)) + 3.0 * yb5 * (2.0 + log(128.0))) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0))
-                    + 3.0 * yb5 * (2.0 + log(128.0)))) - 4.0 * xb2 * (4.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
+                    + yb9 * (22096.0 + 426.0 * ln2)) + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb16 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                - 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                - 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                + 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2) + 3.0 * yb5 * (2.0 + c_ln_3)) + 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2)
+                    + 3.0 * yb5 * (2.0 + c_ln_3))) - 4.0 * xb2 * (4.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
                     - 8.0 * yb7 * (-208.0 + 153.0 * ln2) + yb9 * (2762.0 + 282.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (8.0 - 304.0 * yb3 - 864.0 * yb5 + 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2)
                     + yb6 * (1904.0 + 1269.0 * ln2)) + xb8 * yb * (-1.0 + yb2) * (8.0 - 304.0 * yb3 - 864.0 * yb5 + 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2) + yb6 * (1904.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0)) + 3.0 * yb5 * (-1.0 + log(512.0))) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0))
-                    + 3.0 * yb5 * (-1.0 + log(512.0))));
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5) + 3.0 * yb5 * (-1.0 + c_ln_5)) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5)
+                    + 3.0 * yb5 * (-1.0 + c_ln_5)));
             const complex<double> logs22 = -2.0 * vb * xb2 * (2.0 * xb2 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 2.0 * xb10 * yb * (-1.0 + yb2) * (-2.0 + 9.0 * yb + 67.0 * yb3 + 135.0 * yb5 + 45.0 * yb7 + yb2 * (-39.0 + 36.0 * ln2) - 3.0 * yb4 * (283.0 + 300.0 * ln2) + yb8 * (-381.0 + 324.0 * ln2) + yb6 * (-521.0 + 540.0 * ln2))
                 + 4.0 * xb6 * (24.0 - 154.0 * yb + 225.0 * yb2 + 794.0 * yb4 - 668.0 * yb6 - 6930.0 * yb8 - 5733.0 * yb10 - yb3 * (941.0 + 156.0 * ln2) + 18.0 * yb5 * (-173.0 + 172.0 * ln2) + 4.0 * yb9 * (2041.0 + 282.0 * ln2) - 8.0 * yb7 * (-565.0 + 612.0 * ln2)
                     + yb11 * (3813.0 + 828.0 * ln2)) + xb4 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2) - 16.0 * yb7 * (-143.0 + 801.0 * ln2)
                     + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + xb8 * (-16.0 + 80.0 * yb - 147.0 * yb2 + 326.0 * yb4 + 2008.0 * yb6 + 1818.0 * yb8 + 4203.0 * yb10 + yb3 * (505.0 - 396.0 * ln2) + 3.0 * yb11 * (493.0 + 756.0 * ln2)
-                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0)))
-                + 3.0 * xb12 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + log(16.0)) + yb2 * (1.0 + log(16.0)))) + vb2 * (-3.0 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 3.0 * xb16 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
+                    - 16.0 * yb7 * (-143.0 + 801.0 * ln2) + yb9 * (-4054.0 + 2808.0 * ln2) + yb5 * (-8490.0 + 8136.0 * ln2)) + 3.0 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4))
+                + 3.0 * xb12 * power_of<3>(-1.0 + yb) * yb2 * power_of<2>(1.0 + yb) * (-1.0 + 3.0 * yb2) * (1.0 + yb * (-2.0 + c_ln_4) + yb2 * (1.0 + c_ln_4))) + vb2 * (-3.0 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2 - 3.0 * xb16 * yb3 * power_of<3>(-1.0 + yb2) * (-1.0 + 3.0 * yb2) * ln2
                 - 24.0 * xb2 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2 - 24.0 * xb14 * yb3 * power_of<2>(-1.0 + yb2) * (-1.0 + 19.0 * yb2 + 6.0 * yb4) * ln2
                 + 2.0 * xb8 * (64.0 - 416.0 * yb + 600.0 * yb2 + 2320.0 * yb4 - 1408.0 * yb6 - 19152.0 * yb8 - 15192.0 * yb10 - yb3 * (2536.0 + 57.0 * ln2) + 18.0 * yb5 * (-600.0 + 59.0 * ln2) + 3.0 * yb11 * (3704.0 + 87.0 * ln2) - 4.0 * yb7 * (-3328.0 + 423.0 * ln2)
-                    + yb9 * (22096.0 + 426.0 * ln2)) + 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                + 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + log(8.0)) + 6.0 * yb8 * (118.0 + log(8.0)))
-                - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0)) + 3.0 * yb5 * (2.0 + log(128.0))) - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + log(32.0)) - yb * (6.0 + log(32.0))
-                    + 3.0 * yb5 * (2.0 + log(128.0)))) + 4.0 * xb2 * (4.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
+                    + yb9 * (22096.0 + 426.0 * ln2)) + 8.0 * xb6 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                + 8.0 * xb10 * yb * (-1.0 + yb2) * (4.0 - 152.0 * yb3 - 432.0 * yb5 + 72.0 * yb7 + yb4 * (1896.0 - 60.0 * ln2) + yb6 * (952.0 + 39.0 * ln2) + yb2 * (24.0 + c_ln_1) + 6.0 * yb8 * (118.0 + c_ln_1))
+                - 12.0 * xb4 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2) + 3.0 * yb5 * (2.0 + c_ln_3)) - 12.0 * xb12 * yb2 * power_of<2>(-1.0 + yb2) * (2.0 - 18.0 * yb4 + 16.0 * yb3 * (1.0 + c_ln_2) - yb * (6.0 + c_ln_2)
+                    + 3.0 * yb5 * (2.0 + c_ln_3))) + 4.0 * xb2 * (4.0 * xb6 * (8.0 - 52.0 * yb + 75.0 * yb2 + 290.0 * yb4 - 176.0 * yb6 - 2394.0 * yb8 - 1899.0 * yb10 - yb3 * (317.0 + 39.0 * ln2) + 18.0 * yb5 * (-75.0 + 43.0 * ln2) + 3.0 * yb11 * (463.0 + 69.0 * ln2)
                     - 8.0 * yb7 * (-208.0 + 153.0 * ln2) + yb9 * (2762.0 + 282.0 * ln2)) + xb4 * yb * (-1.0 + yb2) * (8.0 - 304.0 * yb3 - 864.0 * yb5 + 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2)
                     + yb6 * (1904.0 + 1269.0 * ln2)) + xb8 * yb * (-1.0 + yb2) * (8.0 - 304.0 * yb3 - 864.0 * yb5 + 144.0 * yb7 + yb4 * (3792.0 - 1935.0 * ln2) + yb2 * (48.0 + 99.0 * ln2) + 3.0 * yb8 * (472.0 + 189.0 * ln2) + yb6 * (1904.0 + 1269.0 * ln2))
-                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0)) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + log(8.0))
-                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0)) + 3.0 * yb5 * (-1.0 + log(512.0))) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + log(8.0)) + 8.0 * yb3 * (-1.0 + log(512.0))
-                    + 3.0 * yb5 * (-1.0 + log(512.0))));
+                + yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1) + xb12 * yb3 * (-18.0 * yb2 * ln2 + 36.0 * yb4 * ln2 - 30.0 * yb6 * ln2 + 9.0 * yb8 * ln2 + c_ln_1)
+                + 6.0 * xb2 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5) + 3.0 * yb5 * (-1.0 + c_ln_5)) + 6.0 * xb10 * yb2 * power_of<2>(-1.0 + yb2) * (-1.0 + 9.0 * yb4 - yb * (-3.0 + c_ln_1) + 8.0 * yb3 * (-1.0 + c_ln_5)
+                    + 3.0 * yb5 * (-1.0 + c_ln_5)));
 
-            const complex<double> term1 = -(64.0 * power_of<2>(lnmuhat)) / 81.0 + (1.0 / (1458.0 * xb4 * power_of<2>(yb + 3.0 * yb3))) * (27.0 * yb2 * (-1.0 + yb2) * (-1.0 + log(16.0)) + 27.0 * xb8 * yb2 * (-1.0 + yb2) * (-1.0 + log(16.0)) - 18.0 * xb2 * yb2 * (-1.0 + yb2) * (31.0 - 32.0 * ln2 + 3.0 * yb2 * (-7.0 + ln256))
-                - 18.0 * xb6 * yb2 * (-1.0 + yb2) * (31.0 - 32.0 * ln2 + 3.0 * yb2 * (-7.0 + ln256)) - 2.0 * xb4 * (-528.0 + yb4 * (4449.0 + 72.0 * pisqu - 900.0 * ln2 - 6912.0 * ln2squ) + yb2 * (-2029.0 + 12.0 * pisqu + 468.0 * ln2 - 1152.0 * ln2squ) + 36.0 * yb6 * (359.0 + 3.0 * pisqu - 288.0 * ln2squ + log(4096.0))));
+            const complex<double> term1 = -(64.0 * power_of<2>(lnmuhat)) / 81.0 + (1.0 / (1458.0 * xb4 * power_of<2>(yb + 3.0 * yb3))) * (27.0 * yb2 * (-1.0 + yb2) * (-1.0 + c_ln_4) + 27.0 * xb8 * yb2 * (-1.0 + yb2) * (-1.0 + c_ln_4) - 18.0 * xb2 * yb2 * (-1.0 + yb2) * (31.0 - 32.0 * ln2 + 3.0 * yb2 * (-7.0 + ln256))
+                - 18.0 * xb6 * yb2 * (-1.0 + yb2) * (31.0 - 32.0 * ln2 + 3.0 * yb2 * (-7.0 + ln256)) - 2.0 * xb4 * (-528.0 + yb4 * (4449.0 + 72.0 * pisqu - 900.0 * ln2 - 6912.0 * ln2squ) + yb2 * (-2029.0 + 12.0 * pisqu + 468.0 * ln2 - 1152.0 * ln2squ) + 36.0 * yb6 * (359.0 + 3.0 * pisqu - 288.0 * ln2squ + c_ln_6)));
 
             const complex<double> f29bpart1 = (32.0 * power_of<2>(log(xb))) / 81.0 + (num4 * dilog((-1.0i) * xb) + num2 * dilog(1.0i * xb) + (num3 * power_of<2>(log(1.0 - 1.0i * xb))) / 2.0 + (num5 * power_of<2>(log(1.0 + 1.0i * xb))) / 2.0 + num2 * log(1.0 - 1.0i * xb) * log(xb) + num4 * log(1.0 + 1.0i * xb) * log(xb)) / denom1
                 + ((num6 + num7) * li2half - num6 * dilog((1.0 - yb) / 2.0) - num7 * dilog((1.0 + yb) / 2.0) + (num6 * ln2 + num1 * log(xb)) * ln1myb + (num7 * power_of<2>(ln1myb)) / 2.0
@@ -1295,17 +1295,17 @@ namespace eos
                   + (2.0 * num11 * log(1.0 - tb) + 2.0 * num10 * log(1.0 + tb)) * log(xb) + (2.0 * 1.0i) * num10 * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - tb / w4, 1.0 + w4inv)
                   + (2.0 * 1.0i) * num11 * M_PI * log((-1.0 + w4) / w4) * my_sign(imag(w4)) * T(1.0, 1.0 - tb / w4, (-1.0 + w4) / w4) + (2.0 * 1.0i) * num10 * M_PI * log(1.0 - w7 / w4) * my_sign(imag(w4 / w7)) * T(1.0, 1.0 - tb / w4, 1.0 - w7 / w4)
                   + (2.0 * 1.0i) * num11 * M_PI * log(1.0 + w5inv) * my_sign(-imag(w5)) * T(1.0, (tb + w5) / w5, 1.0 + w5inv) + (2.0 * 1.0i) * num10 * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (tb + w5) / w5, (-1.0 + w5) / w5)
-                  + (2.0 * 1.0i) * num10 * M_PI * log((w5 + w7) / w5) * my_sign(-imag(w5 / w7)) * T(1.0, (tb + w5) / w5, (w5 + w7) / w5)) / denom3 + ((-num8 - num9) * dilog(-1.0i / (-1.0i + wx3)) + (-num8 - num9) * dilog(1.0i / (1.0i + wx3))
-                  + (-num8 - num9) * dilog(-1.0i / (-1.0i + wx4)) + (-num8 - num9) * dilog(1.0i / (1.0i + wx4)) + num8 * dilog((1.0i - xb) / (1.0i + wx3)) + num8 * dilog((1.0i - xb) / (1.0i + wx4)) + num13 * dilog(-(xb / wx3)) + num14 * dilog(xb / wx3)
+                  + (2.0 * 1.0i) * num10 * M_PI * log((w5 + w7) / w5) * my_sign(-imag(w5 / w7)) * T(1.0, (tb + w5) / w5, (w5 + w7) / w5)) / denom3 + ((-num8 - num9) * c_li2_1 + (-num8 - num9) * c_li2_2
+                  + (-num8 - num9) * c_li2_3 + (-num8 - num9) * c_li2_4 + num8 * dilog((1.0i - xb) / (1.0i + wx3)) + num8 * dilog((1.0i - xb) / (1.0i + wx4)) + num13 * dilog(-(xb / wx3)) + num14 * dilog(xb / wx3)
                   + num13 * dilog(-(xb / wx4)) + num14 * dilog(xb / wx4) + num9 * dilog((-1.0i + xb) / (-1.0i + wx3)) + num9 * dilog((-1.0i + xb) / (-1.0i + wx4)) + num8 * dilog((1.0i + xb) / (1.0i - wx3)) + num9 * dilog((1.0i + xb) / (1.0i + wx3))
                   + num8 * dilog((1.0i + xb) / (1.0i - wx4)) + num9 * dilog((1.0i + xb) / (1.0i + wx4)) + num9 * log((wx3 - xb) / (1.0i + wx3)) * log(1.0 - 1.0i * xb) + num9 * log((wx3 - xb) / (-1.0i + wx3)) * log(1.0 + 1.0i * xb)
                   + (2.0 * num13 * ln2 + num13 * log(xb)) * log((wx3 + xb) / wx3) + 2.0 * num13 * ln2 * log((wx4 + xb) / wx4) + log(1.0 - 1.0i * xb) * (num9 * log((wx4 - xb) / (1.0i + wx4)) + num8 * log((wx3 + xb) / (-1.0i + wx3))
                     + num8 * log((wx4 + xb) / (-1.0i + wx4))) + log(1.0 + 1.0i * xb) * (num9 * log((wx4 - xb) / (-1.0i + wx4)) + num8 * log((wx3 + xb) / (1.0i + wx3)) + num8 * log((wx4 + xb) / (1.0i + wx4))) + 2.0 * num14 * ln2 * log(1.0 - xb / wx3)
-                  + 2.0 * num14 * ln2 * log(1.0 - xb / wx4) + log(xb) * (num13 * log((wx4 + xb) / wx4) + num14 * log(1.0 - xb / wx3) + num14 * log(1.0 - xb / wx4)) + (2.0 * 1.0i) * num9 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                  + (2.0 * 1.0i) * num8 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num9 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                  + (2.0 * 1.0i) * num8 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num8 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                  + (2.0 * 1.0i) * num9 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num8 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                  + (2.0 * 1.0i) * num9 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) / denom2;
+                  + 2.0 * num14 * ln2 * log(1.0 - xb / wx4) + log(xb) * (num13 * log((wx4 + xb) / wx4) + num14 * log(1.0 - xb / wx3) + num14 * log(1.0 - xb / wx4)) + (2.0 * 1.0i) * num9 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                  + (2.0 * 1.0i) * num8 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num9 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                  + (2.0 * 1.0i) * num8 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * num8 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                  + (2.0 * 1.0i) * num9 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * num8 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                  + (2.0 * 1.0i) * num9 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) / denom2;
 
             const complex<double> f29bpart2 = num15 * (((log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * power_of<2>(log(1.0 - 1.0i * xb))
                 + (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * power_of<2>(log(1.0 + 1.0i * xb))
@@ -1333,10 +1333,10 @@ namespace eos
                 + dilog(xb / wx3) * (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7) + ln1myb - 2.0 * log(yb) + ln1pyb)
                 + dilog(-(xb / wx4)) * (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7) + ln1myb - 2.0 * log(yb) + ln1pyb)
                 + dilog(xb / wx4) * (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7) + ln1myb - 2.0 * log(yb) + ln1pyb)
-                + dilog(-1.0i / (-1.0i + wx3)) * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7) + 2.0 * ln1myb - 4.0 * log(yb)
-                    + 2.0 * ln1pyb) + dilog(1.0i / (1.0i + wx3)) * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7) + 2.0 * ln1myb
-                    - 4.0 * log(yb) + 2.0 * ln1pyb) + dilog(-1.0i / (-1.0i + wx4)) * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7)
-                    + 2.0 * ln1myb - 4.0 * log(yb) + 2.0 * ln1pyb) + dilog(1.0i / (1.0i + wx4)) * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7)
+                + c_li2_1 * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7) + 2.0 * ln1myb - 4.0 * log(yb)
+                    + 2.0 * ln1pyb) + c_li2_2 * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7) + 2.0 * ln1myb
+                    - 4.0 * log(yb) + 2.0 * ln1pyb) + c_li2_3 * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7)
+                    + 2.0 * ln1myb - 4.0 * log(yb) + 2.0 * ln1pyb) + c_li2_4 * (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7)
                     - 2.0 * log((vb + w7) / w7) + 2.0 * ln1myb - 4.0 * log(yb) + 2.0 * ln1pyb) + li2half * (4.0 * log(1.0 - tb) + 4.0 * log(tb) - 4.0 * log(1.0 + tb) - 4.0 * log(1.0 - vb) + 4.0 * log(vb) + 4.0 * log(1.0 + vb)
                     - 4.0 * log(1.0 - tb / w7) - 4.0 * log((vb + w7) / w7) - 8.0 * log(1.0 - 1.0i * xb) - 8.0 * log(1.0 + 1.0i * xb) + 8.0 * log(xb) + 4.0 * ln1myb - 8.0 * log(yb) + 4.0 * ln1pyb)
                 + log(1.0 - 1.0i * xb) * (power_of<2>(log(1.0 - tb)) + 2.0 * ln2 * log(tb) - 4.0 * ln2 * log(1.0 + tb) + power_of<2>(log(1.0 + tb)) - 4.0 * ln2 * log(1.0 - vb) + power_of<2>(log(1.0 - vb)) + 2.0 * ln2 * log(vb) + power_of<2>(log(1.0 + vb))
@@ -1363,64 +1363,64 @@ namespace eos
                     + (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * log(1.0 - xb / wx3)
                     + (log(1.0 - tb) + log(tb) - log(1.0 + tb) - log(1.0 - vb) + log(vb) + log(1.0 + vb) - log(1.0 - tb / w7) - log((vb + w7) / w7)) * log(1.0 - xb / wx4)
                     + (4.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - tb, 1.0 - w7) - (4.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 + tb, 1.0 + w7) - (4.0 * 1.0i) * M_PI * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - vb, 1.0 + w7)
-                    + (4.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 + vb, 1.0 - w7)) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + ln1myb * (power_of<2>(log(1.0 - 1.0i * xb)) + power_of<2>(log(1.0 + 1.0i * xb))
+                    + (4.0 * 1.0i) * M_PI * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 + vb, 1.0 - w7)) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + tb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log(1.0 - vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * M_PI * log(1.0 + vb) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - tb / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * M_PI * log((vb + w7) / w7) * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4) + ln1myb * (power_of<2>(log(1.0 - 1.0i * xb)) + power_of<2>(log(1.0 + 1.0i * xb))
                     + log(1.0 - 1.0i * xb) * (2.0 * ln2 - log((wx3 - xb) / (1.0i + wx3)) - log((wx4 - xb) / (1.0i + wx4)) - 2.0 * log(xb) - log((wx3 + xb) / (-1.0i + wx3)) - log((wx4 + xb) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xb) * (2.0 * ln2 - log((wx3 - xb) / (-1.0i + wx3)) - log((wx4 - xb) / (-1.0i + wx4)) - 2.0 * log(xb) - log((wx3 + xb) / (1.0i + wx3)) - log((wx4 + xb) / (1.0i + wx4)))
-                    + log(xb) * (log((wx3 + xb) / wx3) + log((wx4 + xb) / wx4) + log(1.0 - xb / wx3) + log(1.0 - xb / wx4)) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + ln1pyb * (power_of<2>(log(1.0 - 1.0i * xb)) + power_of<2>(log(1.0 + 1.0i * xb))
+                    + log(xb) * (log((wx3 + xb) / wx3) + log((wx4 + xb) / wx4) + log(1.0 - xb / wx3) + log(1.0 - xb / wx4)) - (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                    - (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                    - (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + ln1pyb * (power_of<2>(log(1.0 - 1.0i * xb)) + power_of<2>(log(1.0 + 1.0i * xb))
                     + log(1.0 - 1.0i * xb) * (2.0 * ln2 - log((wx3 - xb) / (1.0i + wx3)) - log((wx4 - xb) / (1.0i + wx4)) - 2.0 * log(xb) - log((wx3 + xb) / (-1.0i + wx3)) - log((wx4 + xb) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xb) * (2.0 * ln2 - log((wx3 - xb) / (-1.0i + wx3)) - log((wx4 - xb) / (-1.0i + wx4)) - 2.0 * log(xb) - log((wx3 + xb) / (1.0i + wx3)) - log((wx4 + xb) / (1.0i + wx4)))
-                    + log(xb) * (log((wx3 + xb) / wx3) + log((wx4 + xb) / wx4) + log(1.0 - xb / wx3) + log(1.0 - xb / wx4)) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                    - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + log(yb) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))
+                    + log(xb) * (log((wx3 + xb) / wx3) + log((wx4 + xb) / wx4) + log(1.0 - xb / wx3) + log(1.0 - xb / wx4)) - (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                    - (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) - (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) - (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                    - (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4)) + log(yb) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xb)) - 2.0 * power_of<2>(log(1.0 + 1.0i * xb))
                     + log(1.0 - 1.0i * xb) * (-4.0 * ln2 + 2.0 * log((wx3 - xb) / (1.0i + wx3)) + 2.0 * log((wx4 - xb) / (1.0i + wx4)) + 4.0 * log(xb) + 2.0 * log((wx3 + xb) / (-1.0i + wx3)) + 2.0 * log((wx4 + xb) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xb) * (-4.0 * ln2 + 2.0 * log((wx3 - xb) / (-1.0i + wx3)) + 2.0 * log((wx4 - xb) / (-1.0i + wx4)) + 4.0 * log(xb) + 2.0 * log((wx3 + xb) / (1.0i + wx3)) + 2.0 * log((wx4 + xb) / (1.0i + wx4)))
-                    + log(xb) * (-2.0 * log((wx3 + xb) / wx3) - 2.0 * log((wx4 + xb) / wx4) - 2.0 * log(1.0 - xb / wx3) - 2.0 * log(1.0 - xb / wx4)) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
-                    + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
-                    + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
-                    + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
-                    + (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4))) / denom5);
+                    + log(xb) * (-2.0 * log((wx3 + xb) / wx3) - 2.0 * log((wx4 + xb) / wx4) - 2.0 * log(1.0 - xb / wx3) - 2.0 * log(1.0 - xb / wx4)) + (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx3)
+                    + (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 - 1.0i * wx4)
+                    + (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xb, 1.0 + 1.0i * wx4) + (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx3)
+                    + (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 - 1.0i * wx4)
+                    + (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xb, 1.0 + 1.0i * wx4))) / denom5);
 
             const complex<double> f29bpart3 = - (num15 / denom5) * f279b_helper(clp);
 
-            const complex<double> f29bpart4 = ln2 * num15 * ((-16.0 * dilog(wx3 / (-1.0i + wx3)) - 16.0 * dilog(wx3 / (1.0i + wx3)) - 16.0 * dilog(wx4 / (-1.0i + wx4)) - 16.0 * dilog(wx4 / (1.0i + wx4)) + 8.0 * dilog((wx3 - xb) / (-1.0i + wx3)) + 8.0 * dilog((wx3 - xb) / (1.0i + wx3))
+            const complex<double> f29bpart4 = ln2 * num15 * ((-16.0 * c_li2_5 - 16.0 * c_li2_6 - 16.0 * c_li2_7 - 16.0 * c_li2_8 + 8.0 * dilog((wx3 - xb) / (-1.0i + wx3)) + 8.0 * dilog((wx3 - xb) / (1.0i + wx3))
                 + 8.0 * dilog((wx4 - xb) / (-1.0i + wx4)) + 8.0 * dilog((wx4 - xb) / (1.0i + wx4)) + 8.0 * dilog(-(xb / wx3)) + 8.0 * dilog(xb / wx3) + 8.0 * dilog(-(xb / wx4)) + 8.0 * dilog(xb / wx4) + 8.0 * dilog((wx3 + xb) / (-1.0i + wx3))
                 + 8.0 * dilog((wx3 + xb) / (1.0i + wx3)) + 8.0 * dilog((wx4 + xb) / (-1.0i + wx4)) + 8.0 * dilog((wx4 + xb) / (1.0i + wx4)) + (-4.0 * log(tb) - 4.0 * log(vb) + 4.0 * log(1.0 - tb / w7) + 4.0 * log((vb + w7) / w7)) * log(1.0 - 1.0i * xb)
                 + (-4.0 * log(tb) - 4.0 * log(vb) + 4.0 * log(1.0 - tb / w7) + 4.0 * log((vb + w7) / w7)) * log(1.0 + 1.0i * xb) + (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb)
@@ -1430,11 +1430,11 @@ namespace eos
                     + 8.0 * log((1.0i + xb) / (1.0i + wx3))) * log(1.0 - xb / wx3) + (2.0 * log(1.0 - tb) + 2.0 * log(tb) - 2.0 * log(1.0 + tb) - 2.0 * log(1.0 - vb) + 2.0 * log(vb) + 2.0 * log(1.0 + vb) - 2.0 * log(1.0 - tb / w7) - 2.0 * log((vb + w7) / w7)
                     + 8.0 * log((-1.0i + xb) / (-1.0i + wx4)) + 8.0 * log((1.0i + xb) / (1.0i + wx4))) * log(1.0 - xb / wx4) + (2.0 * log((wx3 + xb) / wx3) + 2.0 * log((wx4 + xb) / wx4) + 2.0 * log(1.0 - xb / wx3) + 2.0 * log(1.0 - xb / wx4)) * ln1myb
                 + (8.0 * log(1.0 - 1.0i * xb) + 8.0 * log(1.0 + 1.0i * xb) - 4.0 * log((wx3 + xb) / wx3) - 4.0 * log((wx4 + xb) / wx4) - 4.0 * log(1.0 - xb / wx3) - 4.0 * log(1.0 - xb / wx4)) * log(yb)
-                + (2.0 * log((wx3 + xb) / wx3) + 2.0 * log((wx4 + xb) / wx4) + 2.0 * log(1.0 - xb / wx3) + 2.0 * log(1.0 - xb / wx4)) * ln1pyb + (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3)
-                + (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3) + (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4)
-                + (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) + (16.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3)
-                + (16.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) + (16.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
-                + (16.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4)) / denom5);
+                + (2.0 * log((wx3 + xb) / wx3) + 2.0 * log((wx4 + xb) / wx4) + 2.0 * log(1.0 - xb / wx3) + 2.0 * log(1.0 - xb / wx4)) * ln1pyb + (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-real(wx3)) * T(1.0, (wx3 + xb) / wx3, (-1.0i + wx3) / wx3)
+                + (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(real(wx3)) * T(1.0, (wx3 + xb) / wx3, (1.0i + wx3) / wx3) + (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-real(wx4)) * T(1.0, (wx4 + xb) / wx4, (-1.0i + wx4) / wx4)
+                + (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(real(wx4)) * T(1.0, (wx4 + xb) / wx4, (1.0i + wx4) / wx4) + (16.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-real(wx3)) * T(1.0, 1.0 - xb / wx3, (-1.0i + wx3) / wx3)
+                + (16.0 * 1.0i) * M_PI * c_ln_12 * my_sign(real(wx3)) * T(1.0, 1.0 - xb / wx3, (1.0i + wx3) / wx3) + (16.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-real(wx4)) * T(1.0, 1.0 - xb / wx4, (-1.0i + wx4) / wx4)
+                + (16.0 * 1.0i) * M_PI * c_ln_14 * my_sign(real(wx4)) * T(1.0, 1.0 - xb / wx4, (1.0i + wx4) / wx4)) / denom5);
 
             const complex<double> f29bpart5 = term1 + (-(logs4 * dilog((-1.0i) * xb)) - logs4 * dilog(1.0i * xb)) / denom8 + (logs15 * log(1.0 - 1.0i * xb) + logs16 * log(1.0 + 1.0i * xb)) / denom12
                 + ((logs17 + logs18) * li2half - logs17 * dilog(1.0 / 2.0 - (1.0i / 2.0) * xb) - logs18 * dilog((1.0 + 1.0i * xb) / 2.0) + logs17 * ln2 * log(1.0 - 1.0i * xb) + logs18 * ln2 * log(1.0 + 1.0i * xb)) / denom1 + (logs3 * log(xb)) / denom7
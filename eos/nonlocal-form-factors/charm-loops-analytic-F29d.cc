@@ -243,8 +243,8 @@ namespace eos
                 + 2.0 * yd6 * (-2093.0 + 5248.0 * ln2)) + 2.0 * xd12 * yd2 * (2816.0 - 11096.0 * yd2 + yd4 * (10280.0 - 8192.0 * ln2) + yd8 * (814.0 - 2304.0 * ln2) + 5632.0 * yd * ln2 - 12528.0 * yd3 * ln2 + 16057.0 * yd5 * ln2 - 11170.0 * yd7 * ln2
                 + 2009.0 * yd9 * ln2 + 2.0 * yd6 * (-2093.0 + 5248.0 * ln2)) + 4.0 * xd10 * (1024.0 - 4288.0 * yd2 + 5808.0 * yd4 + 5760.0 * yd3 * ln2 - 15354.0 * yd5 * ln2 + 20429.0 * yd7 * ln2 - 13836.0 * yd9 * ln2 + 3001.0 * yd11 * ln2
                 - 2.0 * yd10 * (505.0 + 1072.0 * ln2) - 4.0 * yd6 * (1709.0 + 1536.0 * ln2) + yd8 * (4434.0 + 8288.0 * ln2)) + yd7 * (-2.0 * yd + 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4)
-                + xd20 * yd7 * (-2.0 * yd + 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4) + 2.0 * xd2 * yd5 * (-12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd5 * (27.0 + 16.0 * ln2) + yd3 * (54.0 + 32.0 * ln2) + ln4 + yd6 * log(8.0))
-                + 2.0 * xd18 * yd5 * (-12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd5 * (27.0 + 16.0 * ln2) + yd3 * (54.0 + 32.0 * ln2) + ln4 + yd6 * log(8.0)));
+                + xd20 * yd7 * (-2.0 * yd + 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4) + 2.0 * xd2 * yd5 * (-12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd5 * (27.0 + 16.0 * ln2) + yd3 * (54.0 + 32.0 * ln2) + ln4 + yd6 * c_ln_1)
+                + 2.0 * xd18 * yd5 * (-12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd5 * (27.0 + 16.0 * ln2) + yd3 * (54.0 + 32.0 * ln2) + ln4 + yd6 * c_ln_1));
             const complex<double> logs14 = 16.0 * (xd4 * yd4 * (80.0 - 688.0 * yd2 - 288.0 * yd * ln2 + 1165.0 * yd3 * ln2 - 954.0 * yd5 * ln2 + 77.0 * yd7 * ln2 - 2.0 * yd6 * (335.0 + 256.0 * ln2) + 2.0 * yd4 * (805.0 + 256.0 * ln2))
                 + xd16 * yd4 * (80.0 - 688.0 * yd2 - 288.0 * yd * ln2 + 1165.0 * yd3 * ln2 - 954.0 * yd5 * ln2 + 77.0 * yd7 * ln2 - 2.0 * yd6 * (335.0 + 256.0 * ln2) + 2.0 * yd4 * (805.0 + 256.0 * ln2))
                 - 8.0 * xd6 * yd2 * (-16.0 + 372.0 * yd2 + 32.0 * yd * ln2 - 670.0 * yd3 * ln2 + 939.0 * yd5 * ln2 - 540.0 * yd7 * ln2 + 239.0 * yd9 * ln2 + yd8 * (-214.0 + 32.0 * ln2) - 16.0 * yd4 * (79.0 + 32.0 * ln2) + yd6 * (958.0 + 480.0 * ln2))
@@ -253,10 +253,10 @@ namespace eos
                 + yd8 * (-814.0 + 2304.0 * ln2)) + 2.0 * xd12 * yd2 * (-2816.0 + 11096.0 * yd2 + yd6 * (4186.0 - 10496.0 * ln2) + 5632.0 * yd * ln2 - 12528.0 * yd3 * ln2 + 16057.0 * yd5 * ln2 - 11170.0 * yd7 * ln2 + 2009.0 * yd9 * ln2
                 + 8.0 * yd4 * (-1285.0 + 1024.0 * ln2) + yd8 * (-814.0 + 2304.0 * ln2)) + 4.0 * xd10 * (-1024.0 + 4288.0 * yd2 - 5808.0 * yd4 + 5760.0 * yd3 * ln2 - 15354.0 * yd5 * ln2 + 20429.0 * yd7 * ln2 - 13836.0 * yd9 * ln2 + 3001.0 * yd11 * ln2
                 + 2.0 * yd10 * (505.0 + 1072.0 * ln2) - 2.0 * yd8 * (2217.0 + 4144.0 * ln2) + yd6 * (6836.0 + 6144.0 * ln2)) + yd7 * (2.0 * yd - 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4)
-                + xd20 * yd7 * (2.0 * yd - 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4) + 2.0 * xd2 * yd5 * (12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd3 * (27.0 + 16.0 * ln2) + yd5 * (54.0 + 32.0 * ln2) + ln4 + yd6 * log(8.0))
-                + 2.0 * xd18 * yd5 * (12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd3 * (27.0 + 16.0 * ln2) + yd5 * (54.0 + 32.0 * ln2) + ln4 + yd6 * log(8.0)));
+                + xd20 * yd7 * (2.0 * yd - 6.0 * yd3 + ln2 + yd4 * ln2 - yd2 * ln4) + 2.0 * xd2 * yd5 * (12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd3 * (27.0 + 16.0 * ln2) + yd5 * (54.0 + 32.0 * ln2) + ln4 + yd6 * c_ln_1)
+                + 2.0 * xd18 * yd5 * (12.0 * yd - 33.0 * yd2 * ln2 + 28.0 * yd4 * ln2 - 2.0 * yd3 * (27.0 + 16.0 * ln2) + yd5 * (54.0 + 32.0 * ln2) + ln4 + yd6 * c_ln_1));
             const complex<double> logs15 = 16.0 * (-4.0 * xd2 * yd2 * (6.0 - 2.0 * yd2 * (11.0 + 16.0 * ln2) + yd4 * (11.0 + 16.0 * ln2)) - 4.0 * xd6 * yd2 * (6.0 - 2.0 * yd2 * (11.0 + 16.0 * ln2) + yd4 * (11.0 + 16.0 * ln2)) + yd4 * (-3.0 + 8.0 * yd2 * (1.0 + ln4))
-                + xd8 * yd4 * (-3.0 + 8.0 * yd2 * (1.0 + ln4)) + 2.0 * xd4 * (-16.0 + 8.0 * yd2 * (9.0 + 16.0 * ln2) - yd4 * (53.0 + 128.0 * ln2) + 12.0 * yd6 * (1.0 + log(16.0))));
+                + xd8 * yd4 * (-3.0 + 8.0 * yd2 * (1.0 + ln4)) + 2.0 * xd4 * (-16.0 + 8.0 * yd2 * (9.0 + 16.0 * ln2) - yd4 * (53.0 + 128.0 * ln2) + 12.0 * yd6 * (1.0 + c_ln_4)));
             const complex<double> logs16 = 4.0 * (yd8 * (-1.0 + yd2) * ln2 + xd24 * yd8 * (-1.0 + yd2) * ln2 - 32.0 * 1.0i * xd3 * yd6 * power_of<2>(-1.0 + yd2) * ln2 + 32.0 * 1.0i * xd21 * yd6 * power_of<2>(-1.0 + yd2) * ln2 - 1920.0 * 1.0i * xd7 * yd4 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) * ln2
                 + 1920.0 * 1.0i * xd17 * yd4 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) * ln2 + 32.0 * 1.0i * xd5 * yd4 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) * ln2 - 32.0 * 1.0i * xd19 * yd4 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) * ln2
                 - 128.0 * 1.0i * xd9 * yd2 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) * ln2 + 128.0 * 1.0i * xd15 * yd2 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) * ln2 + 64.0 * 1.0i * xd11 * yd2 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4) * ln2
@@ -269,7 +269,7 @@ namespace eos
                 - 4.0 * xd12 * (8192.0 + yd8 * (38412.0 - 64785.0 * ln2) + 128.0 * yd2 * (-358.0 + 125.0 * ln2) - 24.0 * yd4 * (-3168.0 + 4955.0 * ln2) + yd10 * (-8168.0 + 11409.0 * ln2) + 8.0 * yd6 * (-9123.0 + 17801.0 * ln2))
                 + xd8 * yd2 * (256.0 * (2.0 + 21.0 * ln2) - 64.0 * yd2 * (280.0 + 339.0 * ln2) + 64.0 * yd4 * (1045.0 + 1739.0 * ln2) - 5.0 * yd6 * (11744.0 + 19107.0 * ln2) + yd8 * (15808.0 + 21551.0 * ln2))
                 + xd16 * yd2 * (256.0 * (2.0 + 21.0 * ln2) - 64.0 * yd2 * (280.0 + 339.0 * ln2) + 64.0 * yd4 * (1045.0 + 1739.0 * ln2) - 5.0 * yd6 * (11744.0 + 19107.0 * ln2) + yd8 * (15808.0 + 21551.0 * ln2))
-                - 4.0 * xd2 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + log(16.0) - yd2 * (3.0 + log(32.0))) - 4.0 * xd22 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + log(16.0) - yd2 * (3.0 + log(32.0))));
+                - 4.0 * xd2 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + c_ln_4 - yd2 * (3.0 + c_ln_2)) - 4.0 * xd22 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + c_ln_4 - yd2 * (3.0 + c_ln_2)));
             const complex<double> logs17 = 4.0 * (yd8 * (-1.0 + yd2) * ln2 + xd24 * yd8 * (-1.0 + yd2) * ln2 + 32.0 * 1.0i * xd3 * yd6 * power_of<2>(-1.0 + yd2) * ln2 - 32.0 * 1.0i * xd21 * yd6 * power_of<2>(-1.0 + yd2) * ln2 + 1920.0 * 1.0i * xd7 * yd4 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) * ln2
                 - 1920.0 * 1.0i * xd17 * yd4 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) * ln2 - 32.0 * 1.0i * xd5 * yd4 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) * ln2 + 32.0 * 1.0i * xd19 * yd4 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) * ln2
                 + 128.0 * 1.0i * xd9 * yd2 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) * ln2 - 128.0 * 1.0i * xd15 * yd2 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) * ln2 - 64.0 * 1.0i * xd11 * yd2 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4) * ln2
@@ -282,11 +282,11 @@ namespace eos
                 - 4.0 * xd12 * (8192.0 + yd8 * (38412.0 - 64785.0 * ln2) + 128.0 * yd2 * (-358.0 + 125.0 * ln2) - 24.0 * yd4 * (-3168.0 + 4955.0 * ln2) + yd10 * (-8168.0 + 11409.0 * ln2) + 8.0 * yd6 * (-9123.0 + 17801.0 * ln2))
                 + xd8 * yd2 * (256.0 * (2.0 + 21.0 * ln2) - 64.0 * yd2 * (280.0 + 339.0 * ln2) + 64.0 * yd4 * (1045.0 + 1739.0 * ln2) - 5.0 * yd6 * (11744.0 + 19107.0 * ln2) + yd8 * (15808.0 + 21551.0 * ln2))
                 + xd16 * yd2 * (256.0 * (2.0 + 21.0 * ln2) - 64.0 * yd2 * (280.0 + 339.0 * ln2) + 64.0 * yd4 * (1045.0 + 1739.0 * ln2) - 5.0 * yd6 * (11744.0 + 19107.0 * ln2) + yd8 * (15808.0 + 21551.0 * ln2))
-                - 4.0 * xd2 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + log(16.0) - yd2 * (3.0 + log(32.0))) - 4.0 * xd22 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + log(16.0) - yd2 * (3.0 + log(32.0))));
+                - 4.0 * xd2 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + c_ln_4 - yd2 * (3.0 + c_ln_2)) - 4.0 * xd22 * yd6 * (yd4 * (8.0 + 17.0 * ln2) + c_ln_4 - yd2 * (3.0 + c_ln_2)));
             const complex<double> logs18 = 32.0 * ((-yd2) * ln2 + xd4 * (yd2 * (192.0 - 543.0 * ln2) + yd6 * (60.0 - 259.0 * ln2) + 240.0 * ln2 + 2.0 * yd4 * (-96.0 + 281.0 * ln2))
                 + xd8 * (yd2 * (192.0 - 543.0 * ln2) + yd6 * (60.0 - 259.0 * ln2) + 240.0 * ln2 + 2.0 * yd4 * (-96.0 + 281.0 * ln2)) - 4.0 * xd6 * (-2.0 * (32.0 + 61.0 * ln2) - 4.0 * yd4 * (18.0 + 77.0 * ln2) + yd6 * (20.0 + 131.0 * ln2) + yd2 * (96.0 + 299.0 * ln2))
-                - yd4 * ln4 + yd6 * (4.0 + log(8.0)) + xd12 * ((-yd2) * ln2 - yd4 * ln4 + yd6 * (4.0 + log(8.0))) + xd2 * (-4.0 * ln2 + 54.0 * yd2 * ln2 + yd6 * (-24.0 + ln64) - 8.0 * yd4 * (-6.0 + log(128.0)))
-                + xd10 * (-4.0 * ln2 + 54.0 * yd2 * ln2 + yd6 * (-24.0 + ln64) - 8.0 * yd4 * (-6.0 + log(128.0))));
+                - yd4 * ln4 + yd6 * (4.0 + c_ln_1) + xd12 * ((-yd2) * ln2 - yd4 * ln4 + yd6 * (4.0 + c_ln_1)) + xd2 * (-4.0 * ln2 + 54.0 * yd2 * ln2 + yd6 * (-24.0 + ln64) - 8.0 * yd4 * (-6.0 + c_ln_3))
+                + xd10 * (-4.0 * ln2 + 54.0 * yd2 * ln2 + yd6 * (-24.0 + ln64) - 8.0 * yd4 * (-6.0 + c_ln_3)));
             const complex<double> logs19 = 2.0 * (yd6 * (-1.0 + yd2) + xd24 * yd6 * (-1.0 + yd2) - 32.0 * 1.0i * xd3 * yd4 * power_of<2>(-1.0 + yd2) + 32.0 * 1.0i * xd21 * yd4 * power_of<2>(-1.0 + yd2) - 1920.0 * 1.0i * xd7 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) + 1920.0 * 1.0i * xd17 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2)
                 + 32.0 * 1.0i * xd5 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) - 32.0 * 1.0i * xd19 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) - 128.0 * 1.0i * xd9 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) + 128.0 * 1.0i * xd15 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4)
                 + 64.0 * 1.0i * xd11 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4) - 64.0 * 1.0i * xd13 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4)
@@ -299,7 +299,7 @@ namespace eos
                 + xd8 * (yd8 * (21551.0 - 71296.0 * ln2) + 256.0 * (21.0 - 80.0 * ln2) + 192.0 * yd2 * (-113.0 + 932.0 * ln2) - 64.0 * yd4 * (-1739.0 + 4986.0 * ln2) + 3.0 * yd6 * (-31845.0 + 77312.0 * ln2))
                 + xd16 * (yd8 * (21551.0 - 71296.0 * ln2) + 256.0 * (21.0 - 80.0 * ln2) + 192.0 * yd2 * (-113.0 + 932.0 * ln2) - 64.0 * yd4 * (-1739.0 + 4986.0 * ln2) + 3.0 * yd6 * (-31845.0 + 77312.0 * ln2))
                 + 4.0 * xd12 * (128.0 * (-125.0 + 1552.0 * ln2) - 105.0 * yd6 * (-617.0 + 3904.0 * ln2) - 24.0 * yd2 * (-4955.0 + 24812.0 * ln2) + yd8 * (-11409.0 + 80816.0 * ln2) + 8.0 * yd4 * (-17801.0 + 90742.0 * ln2))
-                - 4.0 * xd2 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + log(16.0)) + yd2 * (-5.0 + ln256)) - 4.0 * xd22 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + log(16.0)) + yd2 * (-5.0 + ln256)));
+                - 4.0 * xd2 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + c_ln_4) + yd2 * (-5.0 + ln256)) - 4.0 * xd22 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + c_ln_4) + yd2 * (-5.0 + ln256)));
             const complex<double> logs20 = 2.0 * (yd6 * (-1.0 + yd2) + xd24 * yd6 * (-1.0 + yd2) + 32.0 * 1.0i * xd3 * yd4 * power_of<2>(-1.0 + yd2) - 32.0 * 1.0i * xd21 * yd4 * power_of<2>(-1.0 + yd2) + 1920.0 * 1.0i * xd7 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) - 1920.0 * 1.0i * xd17 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2)
                 - 32.0 * 1.0i * xd5 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) + 32.0 * 1.0i * xd19 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) + 128.0 * 1.0i * xd9 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) - 128.0 * 1.0i * xd15 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4)
                 - 64.0 * 1.0i * xd11 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4) + 64.0 * 1.0i * xd13 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4)
@@ -312,7 +312,7 @@ namespace eos
                 + xd8 * (yd8 * (21551.0 - 71296.0 * ln2) + 256.0 * (21.0 - 80.0 * ln2) + 192.0 * yd2 * (-113.0 + 932.0 * ln2) - 64.0 * yd4 * (-1739.0 + 4986.0 * ln2) + 3.0 * yd6 * (-31845.0 + 77312.0 * ln2))
                 + xd16 * (yd8 * (21551.0 - 71296.0 * ln2) + 256.0 * (21.0 - 80.0 * ln2) + 192.0 * yd2 * (-113.0 + 932.0 * ln2) - 64.0 * yd4 * (-1739.0 + 4986.0 * ln2) + 3.0 * yd6 * (-31845.0 + 77312.0 * ln2))
                 + 4.0 * xd12 * (128.0 * (-125.0 + 1552.0 * ln2) - 105.0 * yd6 * (-617.0 + 3904.0 * ln2) - 24.0 * yd2 * (-4955.0 + 24812.0 * ln2) + yd8 * (-11409.0 + 80816.0 * ln2) + 8.0 * yd4 * (-17801.0 + 90742.0 * ln2))
-                - 4.0 * xd2 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + log(16.0)) + yd2 * (-5.0 + ln256)) - 4.0 * xd22 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + log(16.0)) + yd2 * (-5.0 + ln256)));
+                - 4.0 * xd2 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + c_ln_4) + yd2 * (-5.0 + ln256)) - 4.0 * xd22 * yd4 * (4.0 - 12.0 * ln2 + yd4 * (17.0 + c_ln_4) + yd2 * (-5.0 + ln256)));
             const complex<double> logs21 = 2.0 * power_of<2>(1.0 + xd2) * (-1.0 + yd) * (1.0 + yd) * (yd2 * (-1.0 + 9.0 * yd2) + xd8 * yd2 * (-1.0 + 9.0 * yd2) - 2.0 * xd4 * (180.0 - 704.0 * yd3 + yd4 * (233.0 + 512.0 * ln2) - yd2 * (245.0 + 512.0 * ln2))
                 - 4.0 * xd2 * (5.0 - 176.0 * yd3 + yd2 * (19.0 - 128.0 * ln2) + 16.0 * yd4 * (1.0 + ln256)) - 4.0 * xd6 * (5.0 - 176.0 * yd3 + yd2 * (19.0 - 128.0 * ln2) + 16.0 * yd4 * (1.0 + ln256)));
             const complex<double> logs22 = 2.0 * power_of<2>(1.0 + xd2) * (-1.0 + yd) * (1.0 + yd) * (yd2 * (-1.0 + 9.0 * yd2) + xd8 * yd2 * (-1.0 + 9.0 * yd2) - 2.0 * xd4 * (180.0 + 704.0 * yd3 + yd4 * (233.0 + 512.0 * ln2) - yd2 * (245.0 + 512.0 * ln2))
@@ -322,13 +322,13 @@ namespace eos
                 + yd8 * (9765.0 + 6512.0 * ln2) - 8.0 * yd2 * (9583.0 + 11096.0 * ln2)) + 2.0 * xd12 * yd2 * (256.0 * (81.0 + 88.0 * ln2) + 40.0 * yd4 * (2251.0 + 2056.0 * ln2) - 13.0 * yd6 * (3639.0 + 2576.0 * ln2) + yd8 * (9765.0 + 6512.0 * ln2)
                 - 8.0 * yd2 * (9583.0 + 11096.0 * ln2)) + xd4 * yd4 * (-16.0 * (33.0 + 40.0 * ln2) + 16.0 * yd2 * (249.0 + 344.0 * ln2) + yd6 * (2977.0 + 5360.0 * ln2) - yd4 * (7263.0 + 12880.0 * ln2))
                 + xd16 * yd4 * (-16.0 * (33.0 + 40.0 * ln2) + 16.0 * yd2 * (249.0 + 344.0 * ln2) + yd6 * (2977.0 + 5360.0 * ln2) - yd4 * (7263.0 + 12880.0 * ln2))
-                - 4.0 * xd10 * (64.0 * yd2 * (663.0 + 536.0 * ln2) - 16.0 * yd4 * (4123.0 + 2904.0 * ln2) + yd10 * (5825.0 + 8080.0 * ln2) - 3.0 * yd8 * (9649.0 + 11824.0 * ln2) + yd6 * (59068.0 + 54688.0 * ln2) - 2048.0 * (5.0 + log(16.0)))
+                - 4.0 * xd10 * (64.0 * yd2 * (663.0 + 536.0 * ln2) - 16.0 * yd4 * (4123.0 + 2904.0 * ln2) + yd10 * (5825.0 + 8080.0 * ln2) - 3.0 * yd8 * (9649.0 + 11824.0 * ln2) + yd6 * (59068.0 + 54688.0 * ln2) - 2048.0 * (5.0 + c_ln_4))
                 - 8.0 * xd6 * yd2 * (32.0 * yd4 * (195.0 + 316.0 * ln2) - 4.0 * yd2 * (541.0 + 744.0 * ln2) + yd8 * (1309.0 + 1712.0 * ln2) - yd6 * (5055.0 + 7664.0 * ln2) + 16.0 * (5.0 + ln256))
                 - 8.0 * xd14 * yd2 * (32.0 * yd4 * (195.0 + 316.0 * ln2) - 4.0 * yd2 * (541.0 + 744.0 * ln2) + yd8 * (1309.0 + 1712.0 * ln2) - yd6 * (5055.0 + 7664.0 * ln2) + 16.0 * (5.0 + ln256)));
             const complex<double> logs24 = 2.0 * (yd6 * (1.0 - 6.0 * yd + 8.0 * yd2 - 2.0 * yd3 + 15.0 * yd4) + xd16 * yd6 * (1.0 - 6.0 * yd + 8.0 * yd2 - 2.0 * yd3 + 15.0 * yd4) - 2.0 * xd8 * (512.0 + 1408.0 * yd - 6224.0 * yd2 + yd4 * (7328.0 - 4288.0 * ln2) + 8.0 * yd8 * (429.0 + 152.0 * ln2)
                 + 32.0 * yd3 * (31.0 + 216.0 * ln2) - 16.0 * yd5 * (199.0 + 816.0 * ln2) - yd6 * (3059.0 + 3904.0 * ln2) + yd10 * (-269.0 + 6976.0 * ln2) - 2.0 * yd9 * (437.0 + 9344.0 * ln2) + yd7 * (-622.0 + 24832.0 * ln2))
-                + 8.0 * xd2 * yd4 * (-7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) - yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + log(16.0)) + 16.0 * yd3 * (3.0 + log(16.0)))
-                + 8.0 * xd14 * yd4 * (-7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) - yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + log(16.0)) + 16.0 * yd3 * (3.0 + log(16.0)))
+                + 8.0 * xd2 * yd4 * (-7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) - yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + c_ln_4) + 16.0 * yd3 * (3.0 + c_ln_4))
+                + 8.0 * xd14 * yd4 * (-7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) - yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + c_ln_4) + 16.0 * yd3 * (3.0 + c_ln_4))
                 - 8.0 * xd6 * yd * (48.0 + 184.0 * yd + yd8 * (207.0 - 2752.0 * ln2) + yd4 * (921.0 - 1408.0 * ln2) + 48.0 * yd6 * (-31.0 + 68.0 * ln2) - 4.0 * yd3 * (356.0 + 113.0 * ln2) + 4.0 * yd9 * (-8.0 + 215.0 * ln2) + 2.0 * yd7 * (55.0 + 482.0 * ln2)
                 - 2.0 * yd5 * (-737.0 + 686.0 * ln2) + 112.0 * yd2 * (-1.0 + ln256)) - 8.0 * xd10 * yd * (48.0 + 184.0 * yd + yd8 * (207.0 - 2752.0 * ln2) + yd4 * (921.0 - 1408.0 * ln2) + 48.0 * yd6 * (-31.0 + 68.0 * ln2) - 4.0 * yd3 * (356.0 + 113.0 * ln2)
                 + 4.0 * yd9 * (-8.0 + 215.0 * ln2) + 2.0 * yd7 * (55.0 + 482.0 * ln2) - 2.0 * yd5 * (-737.0 + 686.0 * ln2) + 112.0 * yd2 * (-1.0 + ln256))
@@ -337,8 +337,8 @@ namespace eos
                 + yd4 * (627.0 + 1712.0 * ln2) - 8.0 * yd * (5.0 + ln256)));
             const complex<double> logs25 = 2.0 * (yd6 * (1.0 + 6.0 * yd + 8.0 * yd2 + 2.0 * yd3 + 15.0 * yd4) + xd16 * yd6 * (1.0 + 6.0 * yd + 8.0 * yd2 + 2.0 * yd3 + 15.0 * yd4) - 2.0 * xd8 * (512.0 - 1408.0 * yd - 6224.0 * yd2 + yd7 * (622.0 - 24832.0 * ln2) + yd4 * (7328.0 - 4288.0 * ln2)
                 + 8.0 * yd8 * (429.0 + 152.0 * ln2) - 32.0 * yd3 * (31.0 + 216.0 * ln2) + 16.0 * yd5 * (199.0 + 816.0 * ln2) - yd6 * (3059.0 + 3904.0 * ln2) + yd10 * (-269.0 + 6976.0 * ln2) + 2.0 * yd9 * (437.0 + 9344.0 * ln2))
-                + 8.0 * xd2 * yd4 * (7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) + yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + log(16.0)) - 16.0 * yd3 * (3.0 + log(16.0)))
-                + 8.0 * xd14 * yd4 * (7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) + yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + log(16.0)) - 16.0 * yd3 * (3.0 + log(16.0)))
+                + 8.0 * xd2 * yd4 * (7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) + yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + c_ln_4) - 16.0 * yd3 * (3.0 + c_ln_4))
+                + 8.0 * xd14 * yd4 * (7.0 * yd - 4.0 * ln2 + 28.0 * yd6 * ln2 - 2.0 * yd2 * (3.0 + 14.0 * ln2) + yd5 * (17.0 + 64.0 * ln2) + yd4 * (-2.0 + c_ln_4) - 16.0 * yd3 * (3.0 + c_ln_4))
                 - 8.0 * xd6 * yd * (-48.0 + 184.0 * yd - 48.0 * yd6 * (-31.0 + 68.0 * ln2) - 4.0 * yd3 * (356.0 + 113.0 * ln2) + 4.0 * yd9 * (-8.0 + 215.0 * ln2) + 2.0 * yd7 * (55.0 + 482.0 * ln2) - 2.0 * yd5 * (-737.0 + 686.0 * ln2) + yd4 * (-921.0 + 1408.0 * ln2)
                 + yd8 * (-207.0 + 2752.0 * ln2) - 112.0 * yd2 * (-1.0 + ln256)) - 8.0 * xd10 * yd * (-48.0 + 184.0 * yd - 48.0 * yd6 * (-31.0 + 68.0 * ln2) - 4.0 * yd3 * (356.0 + 113.0 * ln2) + 4.0 * yd9 * (-8.0 + 215.0 * ln2) + 2.0 * yd7 * (55.0 + 482.0 * ln2)
                 - 2.0 * yd5 * (-737.0 + 686.0 * ln2) + yd4 * (-921.0 + 1408.0 * ln2) + yd8 * (-207.0 + 2752.0 * ln2) - 112.0 * yd2 * (-1.0 + ln256))
@@ -353,11 +353,11 @@ namespace eos
                 + 4.0 * xd12 * (3200.0 * (-5.0 + 16.0 * ln2) + 3.0 * yd8 * (-3803.0 + 9552.0 * ln2) - 8.0 * yd2 * (-14865.0 + 14884.0 * ln2) - 7.0 * yd6 * (-9255.0 + 17728.0 * ln2) + 8.0 * yd4 * (-17801.0 + 20414.0 * ln2))
                 + xd8 * (yd8 * (21551.0 - 17536.0 * ln2) + 768.0 * (7.0 + 16.0 * ln2) + 192.0 * yd2 * (-113.0 + 68.0 * ln2) - 64.0 * yd4 * (-1739.0 + 498.0 * ln2) + yd6 * (-95535.0 + 24064.0 * ln2))
                 + xd16 * (yd8 * (21551.0 - 17536.0 * ln2) + 768.0 * (7.0 + 16.0 * ln2) + 192.0 * yd2 * (-113.0 + 68.0 * ln2) - 64.0 * yd4 * (-1739.0 + 498.0 * ln2) + yd6 * (-95535.0 + 24064.0 * ln2))
-                - 4.0 * xd2 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + log(16.0)) - 4.0 * xd22 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + log(16.0))
-                + 2.0 * xd4 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + log(1024.0)) - 8.0 * (5.0 + log(4096.0)))
-                + 2.0 * xd20 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + log(1024.0)) - 8.0 * (5.0 + log(4096.0)))
-                - 4.0 * xd6 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + log(4096.0)))
-                - 4.0 * xd18 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + log(4096.0))));
+                - 4.0 * xd2 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + c_ln_4) - 4.0 * xd22 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + c_ln_4)
+                + 2.0 * xd4 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + c_ln_15) - 8.0 * (5.0 + c_ln_6))
+                + 2.0 * xd20 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + c_ln_15) - 8.0 * (5.0 + c_ln_6))
+                - 4.0 * xd6 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + c_ln_6))
+                - 4.0 * xd18 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + c_ln_6)));
             const complex<double> logs27 = 2.0 * (yd6 * (-1.0 + yd2) + xd24 * yd6 * (-1.0 + yd2) + 32.0 * 1.0i * xd3 * yd4 * power_of<2>(-1.0 + yd2) - 32.0 * 1.0i * xd21 * yd4 * power_of<2>(-1.0 + yd2) + 1920.0 * 1.0i * xd7 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2) - 1920.0 * 1.0i * xd17 * yd2 * (-2.0 + yd2) * power_of<2>(-1.0 + yd2)
                 - 32.0 * 1.0i * xd5 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) + 32.0 * 1.0i * xd19 * yd2 * power_of<2>(-1.0 + yd2) * (-8.0 + 17.0 * yd2) + 128.0 * 1.0i * xd9 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4) - 128.0 * 1.0i * xd15 * power_of<2>(-1.0 + yd2) * (-128.0 + 26.0 * yd2 + 73.0 * yd4)
                 - 64.0 * 1.0i * xd11 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4) + 64.0 * 1.0i * xd13 * power_of<2>(-1.0 + yd2) * (1280.0 - 2164.0 * yd2 + 917.0 * yd4)
@@ -366,18 +366,18 @@ namespace eos
                 + 4.0 * xd12 * (3200.0 * (-5.0 + 16.0 * ln2) + 3.0 * yd8 * (-3803.0 + 9552.0 * ln2) - 8.0 * yd2 * (-14865.0 + 14884.0 * ln2) - 7.0 * yd6 * (-9255.0 + 17728.0 * ln2) + 8.0 * yd4 * (-17801.0 + 20414.0 * ln2))
                 + xd8 * (yd8 * (21551.0 - 17536.0 * ln2) + 768.0 * (7.0 + 16.0 * ln2) + 192.0 * yd2 * (-113.0 + 68.0 * ln2) - 64.0 * yd4 * (-1739.0 + 498.0 * ln2) + yd6 * (-95535.0 + 24064.0 * ln2))
                 + xd16 * (yd8 * (21551.0 - 17536.0 * ln2) + 768.0 * (7.0 + 16.0 * ln2) + 192.0 * yd2 * (-113.0 + 68.0 * ln2) - 64.0 * yd4 * (-1739.0 + 498.0 * ln2) + yd6 * (-95535.0 + 24064.0 * ln2))
-                - 4.0 * xd2 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + log(16.0)) - 4.0 * xd22 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + log(16.0))
-                + 2.0 * xd4 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + log(1024.0)) - 8.0 * (5.0 + log(4096.0)))
-                + 2.0 * xd20 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + log(1024.0)) - 8.0 * (5.0 + log(4096.0)))
-                - 4.0 * xd6 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + log(4096.0)))
-                - 4.0 * xd18 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + log(4096.0))));
+                - 4.0 * xd2 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + c_ln_4) - 4.0 * xd22 * yd4 * (4.0 + yd4 * (17.0 + 20.0 * ln2) - yd2 * (5.0 + 24.0 * ln2) + c_ln_4)
+                + 2.0 * xd4 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + c_ln_15) - 8.0 * (5.0 + c_ln_6))
+                + 2.0 * xd20 * yd2 * (-3.0 * yd4 * (211.0 + 192.0 * ln2) + yd6 * (633.0 + 592.0 * ln2) + 8.0 * yd2 * (29.0 + c_ln_15) - 8.0 * (5.0 + c_ln_6))
+                - 4.0 * xd6 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + c_ln_6))
+                - 4.0 * xd18 * (32.0 + 20.0 * yd4 * (97.0 + 41.0 * ln2) + yd8 * (2253.0 + 772.0 * ln2) - yd6 * (4817.0 + 1208.0 * ln2) - 32.0 * yd2 * (23.0 + c_ln_6)));
 
             const complex<double> factor1 = 16.0 / (9.0 * yd3);
 
             const complex<double> f29dPart1 = (64.0 * power_of<2>(log(xd))) / 9.0 + (num4 * dilog((-1.0i) * xd) + num3 * dilog(1.0i * xd) + num3 * log(1.0 - 1.0i * xd) * log(xd)
                     + num4 * log(1.0 + 1.0i * xd) * log(xd)) / denom3 + (num1 * log(xd) * ln1myd - num1 * log(xd) * ln1pyd) / denom1
-                + ((-num11 - num12) * dilog(-1.0i / (-1.0i + wx3)) + (-num11 - num12) * dilog(1.0i / (1.0i + wx3))
-                + (-num11 - num12) * dilog(-1.0i / (-1.0i + wx4)) + (-num11 - num12) * dilog(1.0i / (1.0i + wx4))
+                + ((-num11 - num12) * c_li2_1 + (-num11 - num12) * c_li2_2
+                + (-num11 - num12) * c_li2_3 + (-num11 - num12) * c_li2_4
                 + num11 * dilog((1.0i - xd) / (1.0i + wx3)) + num11 * dilog((1.0i - xd) / (1.0i + wx4)) - num11 * dilog(-(xd / wx3))
                 - num12 * dilog(xd / wx3) - num11 * dilog(-(xd / wx4)) - num12 * dilog(xd / wx4)
                 + num12 * dilog((-1.0i + xd) / (-1.0i + wx3)) + num12 * dilog((-1.0i + xd) / (-1.0i + wx4)) + num11 * dilog((1.0i + xd) / (1.0i - wx3))
@@ -388,14 +388,14 @@ namespace eos
                     + num11 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (num12 * log((wx4 - xd) / (-1.0i + wx4))
                     + num11 * log((wx3 + xd) / (1.0i + wx3)) + num11 * log((wx4 + xd) / (1.0i + wx4))) - 2.0 * num12 * ln2 * log(1.0 - xd / wx3)
                 - 2.0 * num12 * ln2 * log(1.0 - xd / wx4) + log(xd) * (-(num11 * log((wx4 + xd) / wx4)) - num12 * log(1.0 - xd / wx3)
-                    - num12 * log(1.0 - xd / wx4)) + (2.0 * 1.0i) * num12 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * num11 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * num12 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * num11 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                + (2.0 * 1.0i) * num11 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (2.0 * 1.0i) * num12 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                + (2.0 * 1.0i) * num11 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (2.0 * 1.0i) * num12 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) / denom4;
+                    - num12 * log(1.0 - xd / wx4)) + (2.0 * 1.0i) * num12 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * num11 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * num12 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * num11 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                + (2.0 * 1.0i) * num11 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (2.0 * 1.0i) * num12 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                + (2.0 * 1.0i) * num11 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (2.0 * 1.0i) * num12 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) / denom4;
 
             const complex<double> f29dPart2 = ((-1.0 / 12.0) * (num10 * pisqu * ln2) - (num6 * pisqu * ln2) / 12.0 + num8 * trilog(1.0 / 2.0 - (1.0i / 2.0) * xd) + (-num8 - num9) * trilog(1.0 - 1.0i * xd) + num8 * trilog((1.0 + 1.0i * xd) / 2.0) + (-num8 - num9) * trilog(1.0 + 1.0i * xd) - 2.0 * num8 * trilog((-1.0i) * xd) - 2.0 * num8 * trilog(1.0i * xd) + (num8 * trilog(-xd2)) / 2.0 - num8 * trilog((2.0 * xd) / (-1.0i + xd))
                 - num8 * trilog((2.0 * xd) / (1.0i + xd)) - num10 * trilog((1.0 - yd) / 2.0) - 7.0 * num7 * trilog(-yd) + 7.0 * num7 * trilog(yd) - num6 * trilog((1.0 + yd) / 2.0) + (num10 * power_of<3>(ln2)) / 6.0 + (num6 * power_of<3>(ln2)) / 6.0 - (num8 * power_of<3>(ln2)) / 3.0 + (num8 * pisqu * ln4) / 12.0 + num9 * dilog(1.0 - 1.0i * xd) * log(1.0 - 1.0i * xd) + num9 * dilog(1.0i * xd) * log(1.0 - 1.0i * xd)
@@ -415,29 +415,29 @@ namespace eos
                 + dilog((1.0i + xd) / (1.0i - wx3)) * (-(num14 * ln1myd) - num13 * ln1pyd) + dilog((1.0i + xd) / (1.0i + wx3)) * (-(num14 * ln1myd) - num13 * ln1pyd)
                 + dilog((1.0i + xd) / (1.0i - wx4)) * (-(num14 * ln1myd) - num13 * ln1pyd) + dilog((1.0i + xd) / (1.0i + wx4)) * (-(num14 * ln1myd) - num13 * ln1pyd)
                 + dilog(-(xd / wx3)) * (num14 * ln1myd + num13 * ln1pyd) + dilog(xd / wx3) * (num14 * ln1myd + num13 * ln1pyd) + dilog(-(xd / wx4)) * (num14 * ln1myd + num13 * ln1pyd)
-                + dilog(xd / wx4) * (num14 * ln1myd + num13 * ln1pyd) + dilog(-1.0i / (-1.0i + wx3)) * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + dilog(1.0i / (1.0i + wx3)) * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd)
-                + dilog(-1.0i / (-1.0i + wx4)) * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + dilog(1.0i / (1.0i + wx4)) * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + li2half * (4.0 * num14 * ln1myd + 4.0 * num13 * ln1pyd)
+                + dilog(xd / wx4) * (num14 * ln1myd + num13 * ln1pyd) + c_li2_1 * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + c_li2_2 * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd)
+                + c_li2_3 * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + c_li2_4 * (2.0 * num14 * ln1myd + 2.0 * num13 * ln1pyd) + li2half * (4.0 * num14 * ln1myd + 4.0 * num13 * ln1pyd)
                 + ln1pyd * (num13 * power_of<2>(log(1.0 - 1.0i * xd)) + num13 * power_of<2>(log(1.0 + 1.0i * xd)) + 2.0 * num13 * ln2 * log((wx3 + xd) / wx3) + 2.0 * num13 * ln2 * log((wx4 + xd) / wx4)
                 + log(1.0 - 1.0i * xd) * (2.0 * num13 * ln2 - num13 * log((wx3 - xd) / (1.0i + wx3)) - num13 * log((wx4 - xd) / (1.0i + wx4)) - 2.0 * num13 * log(xd) - num13 * log((wx3 + xd) / (-1.0i + wx3)) - num13 * log((wx4 + xd) / (-1.0i + wx4)))
                 + log(1.0 + 1.0i * xd) * (2.0 * num13 * ln2 - num13 * log((wx3 - xd) / (-1.0i + wx3)) - num13 * log((wx4 - xd) / (-1.0i + wx4)) - 2.0 * num13 * log(xd) - num13 * log((wx3 + xd) / (1.0i + wx3)) - num13 * log((wx4 + xd) / (1.0i + wx4)))
                 + 2.0 * num13 * ln2 * log(1.0 - xd / wx3) + 2.0 * num13 * ln2 * log(1.0 - xd / wx4) + log(xd) * (num13 * log((wx3 + xd) / wx3) + num13 * log((wx4 + xd) / wx4) + num13 * log(1.0 - xd / wx3) + num13 * log(1.0 - xd / wx4))
-                - (2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num13 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num13 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                - (2.0 * 1.0i) * num13 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num13 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num13 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num13 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * num13 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num13 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num13 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num13 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 + ln1myd * (num14 * power_of<2>(log(1.0 - 1.0i * xd)) + num14 * power_of<2>(log(1.0 + 1.0i * xd)) + 2.0 * num14 * ln2 * log((wx3 + xd) / wx3) + 2.0 * num14 * ln2 * log((wx4 + xd) / wx4)
                 + log(1.0 - 1.0i * xd) * (2.0 * num14 * ln2 - num14 * log((wx3 - xd) / (1.0i + wx3)) - num14 * log((wx4 - xd) / (1.0i + wx4)) - 2.0 * num14 * log(xd) - num14 * log((wx3 + xd) / (-1.0i + wx3)) - num14 * log((wx4 + xd) / (-1.0i + wx4)))
                 + log(1.0 + 1.0i * xd) * (2.0 * num14 * ln2 - num14 * log((wx3 - xd) / (-1.0i + wx3)) - num14 * log((wx4 - xd) / (-1.0i + wx4)) - 2.0 * num14 * log(xd) - num14 * log((wx3 + xd) / (1.0i + wx3)) - num14 * log((wx4 + xd) / (1.0i + wx4)))
                 + 2.0 * num14 * ln2 * log(1.0 - xd / wx3) + 2.0 * num14 * ln2 * log(1.0 - xd / wx4) + log(xd) * (num14 * log((wx3 + xd) / wx3) + num14 * log((wx4 + xd) / wx4) + num14 * log(1.0 - xd / wx3) + num14 * log(1.0 - xd / wx4))
-                - (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                - (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                - (2.0 * 1.0i) * num14 * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num14 * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))) / denom2;
+                - (2.0 * 1.0i) * num14 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num14 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num14 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num14 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                - (2.0 * 1.0i) * num14 * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (2.0 * 1.0i) * num14 * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                - (2.0 * 1.0i) * num14 * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (2.0 * 1.0i) * num14 * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))) / denom2;
 
-            const complex<double> f29dPart41 = (num15 / denom2) * (16.0 * li3half - 6.0 * trilog(-1.0i / wx3) - 6.0 * trilog(1.0i / wx3) - 10.0 * trilog(-1.0i / (-1.0i + wx3)) - 2.0 * trilog(wx3 / (-1.0i + wx3)) + 4.0 * trilog((-1.0i + wx3) / (2.0 * wx3)) - 4.0 * trilog((-1.0i + wx3) / wx3)
-                - 10.0 * trilog(1.0i / (1.0i + wx3)) + 4.0 * trilog((1.0i - wx3) / (1.0i + wx3)) - 2.0 * trilog(wx3 / (1.0i + wx3)) + 4.0 * trilog((1.0i + wx3) / (1.0i - wx3)) + 4.0 * trilog((1.0i + wx3) / (2.0 * wx3)) - 4.0 * trilog((1.0i + wx3) / wx3) - 6.0 * trilog(-1.0i / wx4)
-                - 6.0 * trilog(1.0i / wx4) - 10.0 * trilog(-1.0i / (-1.0i + wx4)) - 2.0 * trilog(wx4 / (-1.0i + wx4)) + 4.0 * trilog((-1.0i + wx4) / (2.0 * wx4)) - 4.0 * trilog((-1.0i + wx4) / wx4) - 10.0 * trilog(1.0i / (1.0i + wx4)) + 4.0 * trilog((1.0i - wx4) / (1.0i + wx4))
-                - 2.0 * trilog(wx4 / (1.0i + wx4)) + 4.0 * trilog((1.0i + wx4) / (1.0i - wx4)) + 4.0 * trilog((1.0i + wx4) / (2.0 * wx4)) - 4.0 * trilog((1.0i + wx4) / wx4) + 5.0 * trilog((1.0i - xd) / (1.0i + wx3)) + 5.0 * trilog((1.0i - xd) / (1.0i + wx4))
+            const complex<double> f29dPart41 = (num15 / denom2) * (16.0 * li3half - 6.0 * c_li3_1 - 6.0 * c_li3_2 - 10.0 * c_li3_3 - 2.0 * c_li3_4 + 4.0 * c_li3_5 - 4.0 * c_li3_6
+                - 10.0 * c_li3_7 + 4.0 * c_li3_8 - 2.0 * c_li3_9 + 4.0 * c_li3_10 + 4.0 * c_li3_11 - 4.0 * c_li3_12 - 6.0 * c_li3_13
+                - 6.0 * c_li3_14 - 10.0 * c_li3_15 - 2.0 * c_li3_16 + 4.0 * c_li3_17 - 4.0 * c_li3_18 - 10.0 * c_li3_19 + 4.0 * c_li3_20
+                - 2.0 * c_li3_21 + 4.0 * c_li3_22 + 4.0 * c_li3_23 - 4.0 * c_li3_24 + 5.0 * trilog((1.0i - xd) / (1.0i + wx3)) + 5.0 * trilog((1.0i - xd) / (1.0i + wx4))
                 + 2.0 * trilog((-1.0i + wx3) / (wx3 - xd)) + 2.0 * trilog((1.0i + wx3) / (wx3 - xd)) + trilog((wx3 - xd) / (-1.0i + wx3)) + trilog((wx3 - xd) / (1.0i + wx3)) + 2.0 * trilog((-1.0i + wx4) / (wx4 - xd)) + 2.0 * trilog((1.0i + wx4) / (wx4 - xd))
                 + trilog((wx4 - xd) / (-1.0i + wx4)) + trilog((wx4 - xd) / (1.0i + wx4)) - 8.0 * trilog(1.0 / 2.0 - (1.0i / 2.0) * xd) - 2.0 * trilog(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd))) - 2.0 * trilog(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd)))
                 - 8.0 * trilog((1.0 + 1.0i * xd) / 2.0) - 2.0 * trilog(((1.0i + wx3) * (1.0 + 1.0i * xd)) / (2.0 * (wx3 - xd))) - 2.0 * trilog(((1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 - xd))) - trilog((1.0i * (wx3 - xd)) / ((-1.0i + wx3) * xd))
@@ -456,15 +456,15 @@ namespace eos
                 + trilog((-wx4 + xd) / (1.0i + xd)) + 2.0 * trilog((-1.0i + wx4) / (wx4 + xd)) + 2.0 * trilog((1.0i + wx4) / (wx4 + xd)) - 2.0 * trilog(((1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 + xd))) - 2.0 * trilog(((-1.0i + wx4) * (1.0 + 1.0i * xd)) / (2.0 * (wx4 + xd)))
                 + 2.0 * trilog((-1.0i + xd) / (wx4 + xd)) + 2.0 * trilog((1.0i + xd) / (wx4 + xd)) + trilog((wx4 + xd) / (-1.0i + wx4)) + trilog((wx4 + xd) / (1.0i + wx4)) - trilog(((-1.0i) * (wx4 + xd)) / ((-1.0i + wx4) * xd))
                 - trilog((1.0i * (wx4 + xd)) / ((1.0i + wx4) * xd)) + trilog((wx4 + xd) / (-1.0i + xd)) - trilog(((-1.0i) * (wx4 + xd)) / (wx4 * (-1.0i + xd))) + trilog((wx4 + xd) / (1.0i + xd)) - trilog((1.0i * (wx4 + xd)) / (wx4 * (1.0i + xd)))
-                - 4.0 * dilog((-1.0i + wx3) / (2.0 * wx3)) * lnhalf - 4.0 * dilog((1.0i - wx3) / (1.0i + wx3)) * lnhalf - 4.0 * dilog((1.0i + wx3) / (1.0i - wx3)) * lnhalf - 4.0 * dilog((1.0i + wx3) / (2.0 * wx3)) * lnhalf
-                - 4.0 * dilog((-1.0i + wx4) / (2.0 * wx4)) * lnhalf - 4.0 * dilog((1.0i - wx4) / (1.0i + wx4)) * lnhalf - 4.0 * dilog((1.0i + wx4) / (1.0i - wx4)) * lnhalf - 4.0 * dilog((1.0i + wx4) / (2.0 * wx4)) * lnhalf - (2.0 * pisqu * log((-2.0 * 1.0i) / wx3)) / 3.0
-                - (2.0 * power_of<3>(log((-2.0 * 1.0i) / wx3))) / 3.0 - (2.0 * pisqu * log((2.0 * 1.0i) / wx3)) / 3.0 - (2.0 * power_of<3>(log((2.0 * 1.0i) / wx3))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log(wx3 / (-1.0i + wx3)) - 2.0 * power_of<2>(lnhalf) * log((2.0 * wx3) / (-1.0i + wx3))
-                - 2.0 * power_of<2>(lnhalf) * log((-1.0i + wx3) / (2.0 * wx3)) + 2.0 * power_of<2>(lnhalf) * log((-1.0i + wx3) / wx3) + 2.0 * power_of<2>(lnhalf) * log(wx3 / (1.0i + wx3)) - 2.0 * power_of<2>(lnhalf) * log((2.0 * wx3) / (1.0i + wx3)) + (2.0 * pisqu * log((2.0 * (-1.0i + wx3)) / (1.0i + wx3))) / 3.0
-                + (2.0 * power_of<3>(log((2.0 * (-1.0i + wx3)) / (1.0i + wx3)))) / 3.0 - 2.0 * power_of<2>(lnhalf) * log((1.0i + wx3) / (2.0 * wx3)) + 2.0 * power_of<2>(lnhalf) * log((1.0i + wx3) / wx3) + (2.0 * pisqu * log((2.0 * (1.0i + wx3)) / (-1.0i + wx3))) / 3.0
-                + (2.0 * power_of<3>(log((2.0 * (1.0i + wx3)) / (-1.0i + wx3)))) / 3.0 - (2.0 * pisqu * log((-2.0 * 1.0i) / wx4)) / 3.0 - (2.0 * power_of<3>(log((-2.0 * 1.0i) / wx4))) / 3.0 - (2.0 * pisqu * log((2.0 * 1.0i) / wx4)) / 3.0 - (2.0 * power_of<3>(log((2.0 * 1.0i) / wx4))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log(wx4 / (-1.0i + wx4))
-                - 2.0 * power_of<2>(lnhalf) * log((2.0 * wx4) / (-1.0i + wx4)) - 2.0 * power_of<2>(lnhalf) * log((-1.0i + wx4) / (2.0 * wx4)) + 2.0 * power_of<2>(lnhalf) * log((-1.0i + wx4) / wx4) + 2.0 * power_of<2>(lnhalf) * log(wx4 / (1.0i + wx4)) - 2.0 * power_of<2>(lnhalf) * log((2.0 * wx4) / (1.0i + wx4))
-                + (2.0 * pisqu * log((2.0 * (-1.0i + wx4)) / (1.0i + wx4))) / 3.0 + (2.0 * power_of<3>(log((2.0 * (-1.0i + wx4)) / (1.0i + wx4)))) / 3.0 - 2.0 * power_of<2>(lnhalf) * log((1.0i + wx4) / (2.0 * wx4)) + 2.0 * power_of<2>(lnhalf) * log((1.0i + wx4) / wx4)
-                + (2.0 * pisqu * log((2.0 * (1.0i + wx4)) / (-1.0i + wx4))) / 3.0 + (2.0 * power_of<3>(log((2.0 * (1.0i + wx4)) / (-1.0i + wx4)))) / 3.0 + (pisqu * log(wx3 / (1.0i - xd))) / 6.0 + power_of<3>(log(wx3 / (1.0i - xd))) / 6.0 + (pisqu * log(wx4 / (1.0i - xd))) / 6.0 + power_of<3>(log(wx4 / (1.0i - xd))) / 6.0
+                - 4.0 * c_li2_9 * lnhalf - 4.0 * c_li2_10 * lnhalf - 4.0 * c_li2_11 * lnhalf - 4.0 * c_li2_12 * lnhalf
+                - 4.0 * c_li2_13 * lnhalf - 4.0 * c_li2_14 * lnhalf - 4.0 * c_li2_15 * lnhalf - 4.0 * c_li2_16 * lnhalf - (2.0 * pisqu * c_ln_16) / 3.0
+                - (2.0 * power_of<3>(c_ln_16)) / 3.0 - (2.0 * pisqu * c_ln_17) / 3.0 - (2.0 * power_of<3>(c_ln_17)) / 3.0 + 2.0 * power_of<2>(lnhalf) * c_ln_18 - 2.0 * power_of<2>(lnhalf) * c_ln_19
+                - 2.0 * power_of<2>(lnhalf) * c_ln_20 + 2.0 * power_of<2>(lnhalf) * c_ln_11 + 2.0 * power_of<2>(lnhalf) * c_ln_21 - 2.0 * power_of<2>(lnhalf) * c_ln_22 + (2.0 * pisqu * c_ln_23) / 3.0
+                + (2.0 * power_of<3>(c_ln_23)) / 3.0 - 2.0 * power_of<2>(lnhalf) * c_ln_24 + 2.0 * power_of<2>(lnhalf) * c_ln_12 + (2.0 * pisqu * c_ln_25) / 3.0
+                + (2.0 * power_of<3>(c_ln_25)) / 3.0 - (2.0 * pisqu * c_ln_26) / 3.0 - (2.0 * power_of<3>(c_ln_26)) / 3.0 - (2.0 * pisqu * c_ln_27) / 3.0 - (2.0 * power_of<3>(c_ln_27)) / 3.0 + 2.0 * power_of<2>(lnhalf) * c_ln_28
+                - 2.0 * power_of<2>(lnhalf) * c_ln_29 - 2.0 * power_of<2>(lnhalf) * c_ln_30 + 2.0 * power_of<2>(lnhalf) * c_ln_13 + 2.0 * power_of<2>(lnhalf) * c_ln_31 - 2.0 * power_of<2>(lnhalf) * c_ln_32
+                + (2.0 * pisqu * c_ln_33) / 3.0 + (2.0 * power_of<3>(c_ln_33)) / 3.0 - 2.0 * power_of<2>(lnhalf) * c_ln_34 + 2.0 * power_of<2>(lnhalf) * c_ln_14
+                + (2.0 * pisqu * c_ln_35) / 3.0 + (2.0 * power_of<3>(c_ln_35)) / 3.0 + (pisqu * log(wx3 / (1.0i - xd))) / 6.0 + power_of<3>(log(wx3 / (1.0i - xd))) / 6.0 + (pisqu * log(wx4 / (1.0i - xd))) / 6.0 + power_of<3>(log(wx4 / (1.0i - xd))) / 6.0
                 + (pisqu * log((-2.0 * 1.0i) / (wx3 - xd))) / 3.0 + power_of<3>(log((-2.0 * 1.0i) / (wx3 - xd))) / 3.0 + (pisqu * log((2.0 * 1.0i) / (wx3 - xd))) / 3.0 + power_of<3>(log((2.0 * 1.0i) / (wx3 - xd))) / 3.0 + (pisqu * log((-2.0 * 1.0i) / (wx4 - xd))) / 3.0 + power_of<3>(log((-2.0 * 1.0i) / (wx4 - xd))) / 3.0
                 + (pisqu * log((2.0 * 1.0i) / (wx4 - xd))) / 3.0 + power_of<3>(log((2.0 * 1.0i) / (wx4 - xd))) / 3.0 + 2.0 * dilog(((-1.0i + wx3) * (1.0 - 1.0i * xd)) / (2.0 * (wx3 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd)
                 + 2.0 * dilog(((-1.0i + wx4) * (1.0 - 1.0i * xd)) / (2.0 * (wx4 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - 2.0 * dilog(-((1.0i + xd) / (wx3 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - 2.0 * dilog(-((1.0i + xd) / (wx4 - xd))) * log(1.0 / 2.0 - (1.0i / 2.0) * xd)
@@ -480,20 +480,20 @@ namespace eos
                 + dilog((1.0i - xd) / (1.0i + wx3)) * (-2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xd) - log(1.0 - 1.0i * xd)) + dilog((1.0i - xd) / (1.0i + wx4)) * (-2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xd) - log(1.0 - 1.0i * xd))
                 + dilog((-1.0i + xd) / (-1.0i + wx3)) * (-2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xd) - log(1.0 - 1.0i * xd)) + dilog((-1.0i + xd) / (-1.0i + wx4)) * (-2.0 * log(1.0 / 2.0 + (1.0i / 2.0) * xd) - log(1.0 - 1.0i * xd)) + 4.0 * dilog((1.0i + xd) * xdinv) * log(1.0 - 1.0i * xd)
                 - dilog((wx3 * (1.0i + xd)) / ((-1.0i + wx3) * xd)) * log(1.0 - 1.0i * xd) - dilog((wx3 * (1.0i + xd)) / ((1.0i + wx3) * xd)) * log(1.0 - 1.0i * xd) - dilog((wx4 * (1.0i + xd)) / ((-1.0i + wx4) * xd)) * log(1.0 - 1.0i * xd)
-                - dilog((wx4 * (1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 - 1.0i * xd) + dilog(-1.0i / (-1.0i + wx3)) * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / (1.0i + wx3)) * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + dilog(-1.0i / (-1.0i + wx4)) * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd))
-                + dilog(1.0i / (1.0i + wx4)) * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + dilog((1.0i + xd) / (1.0i - wx3)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd))
+                - dilog((wx4 * (1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 - 1.0i * xd) + c_li2_1 * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd))
+                + c_li2_2 * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + c_li2_3 * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd))
+                + c_li2_4 * (4.0 * lnhalf - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + dilog((1.0i + xd) / (1.0i - wx3)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd))
                 + dilog((1.0i + xd) / (1.0i + wx3)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd)) + dilog((1.0i + xd) / (1.0i - wx4)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd))
-                + dilog((1.0i + xd) / (1.0i + wx4)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd)) + dilog(-1.0i / wx3) * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd))
-                + dilog(1.0i / wx3) * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd)) + dilog(-1.0i / wx4) * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd)) + dilog(1.0i / wx4) * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd))
+                + dilog((1.0i + xd) / (1.0i + wx4)) * (-2.0 * log(1.0 / 2.0 - (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd)) + c_li2_17 * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd))
+                + c_li2_18 * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd)) + c_li2_19 * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd)) + c_li2_20 * (4.0 * lnhalf - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd))
                 + 4.0 * dilog((-1.0i + xd) * xdinv) * log(1.0 + 1.0i * xd) - dilog((wx3 * (-1.0i + xd)) / ((-1.0i + wx3) * xd)) * log(1.0 + 1.0i * xd) - dilog((wx3 * (-1.0i + xd)) / ((1.0i + wx3) * xd)) * log(1.0 + 1.0i * xd)
-                - dilog((wx4 * (-1.0i + xd)) / ((-1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) - dilog((wx4 * (-1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) + dilog((-2.0 * 1.0i) / (-1.0i + wx3)) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd))
-                + dilog((2.0 * 1.0i) / (1.0i + wx3)) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) + dilog((-2.0 * 1.0i) / (-1.0i + wx4)) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) + dilog((2.0 * 1.0i) / (1.0i + wx4)) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd))
+                - dilog((wx4 * (-1.0i + xd)) / ((-1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) - dilog((wx4 * (-1.0i + xd)) / ((1.0i + wx4) * xd)) * log(1.0 + 1.0i * xd) + c_li2_21 * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd))
+                + c_li2_22 * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) + c_li2_23 * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) + c_li2_24 * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd))
                 + log((wx3 - xd) / (1.0i + wx3)) * (power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd)) + log((wx4 - xd) / (1.0i + wx4)) * (power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd))
                 + log((wx3 - xd) / (-1.0i + wx3)) * (log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd) + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0) + log((wx4 - xd) / (-1.0i + wx4)) * (log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd) + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0) - (2.0 * pisqu * log(-1.0i / xd)) / 3.0
                 - (2.0 * power_of<3>(log(-1.0i / xd))) / 3.0 - (2.0 * pisqu * log(1.0i / xd)) / 3.0 - (2.0 * power_of<3>(log(1.0i / xd))) / 3.0 + dilog(-(xd / wx3)) * (-2.0 * ln2 - log(xd)) + dilog(xd / wx3) * (-2.0 * ln2 - log(xd))
-                + dilog(-(xd / wx4)) * (-2.0 * ln2 - log(xd)) + dilog(xd / wx4) * (-2.0 * ln2 - log(xd)) + 2.0 * dilog((-1.0i) * xd) * log(xd) + 2.0 * dilog(1.0i * xd) * log(xd) + dilog(wx3 / (-1.0i + wx3)) * (4.0 * ln2 + 2.0 * log(xd))
-                + dilog(wx3 / (1.0i + wx3)) * (4.0 * ln2 + 2.0 * log(xd)) + dilog(wx4 / (-1.0i + wx4)) * (4.0 * ln2 + 2.0 * log(xd)) + dilog(wx4 / (1.0i + wx4)) * (4.0 * ln2 + 2.0 * log(xd)) + (pisqu * log(wx3 / (-1.0i + xd))) / 6.0
+                + dilog(-(xd / wx4)) * (-2.0 * ln2 - log(xd)) + dilog(xd / wx4) * (-2.0 * ln2 - log(xd)) + 2.0 * dilog((-1.0i) * xd) * log(xd) + 2.0 * dilog(1.0i * xd) * log(xd) + c_li2_5 * (4.0 * ln2 + 2.0 * log(xd))
+                + c_li2_6 * (4.0 * ln2 + 2.0 * log(xd)) + c_li2_7 * (4.0 * ln2 + 2.0 * log(xd)) + c_li2_8 * (4.0 * ln2 + 2.0 * log(xd)) + (pisqu * log(wx3 / (-1.0i + xd))) / 6.0
                 + power_of<3>(log(wx3 / (-1.0i + xd))) / 6.0 - (pisqu * log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xd)))) / 3.0 - power_of<3>(log((2.0 - (2.0 * 1.0i) * wx3) / ((-1.0i + wx3) * (-1.0i + xd)))) / 3.0 - (pisqu * log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xd)))) / 3.0
                 - power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx3) / ((1.0i + wx3) * (-1.0i + xd)))) / 3.0 + (pisqu * log(wx4 / (-1.0i + xd))) / 6.0 + power_of<3>(log(wx4 / (-1.0i + xd))) / 6.0 - (pisqu * log((2.0 - (2.0 * 1.0i) * wx4) / ((-1.0i + wx4) * (-1.0i + xd)))) / 3.0
                 - power_of<3>(log((2.0 - (2.0 * 1.0i) * wx4) / ((-1.0i + wx4) * (-1.0i + xd)))) / 3.0 - (pisqu * log((-2.0 - (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (-1.0i + xd)))) / 3.0 - power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx4) / ((1.0i + wx4) * (-1.0i + xd)))) / 3.0 + (pisqu * log(-(wx3 / (1.0i + xd)))) / 6.0
@@ -555,60 +555,60 @@ namespace eos
                 power_of<2>(log(((1.0 + 1.0i * wx4) * (1.0i + xd)) / (2.0 * (1.0i + wx4)))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx3), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx3 + xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
                 - (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx4), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx4 + xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) + (2.0 * 1.0i) * M_PI * H1((1.0i - wx3) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i + wx3 + xd - 1.0i * wx3 * xd) / (2.0 * 1.0i - 2.0 * wx3))) *
                 my_sign(2.0 * real(1.0 / (1.0i + xd))) + (2.0 * 1.0i) * M_PI * H1((1.0i - wx4) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i + wx4 + xd - 1.0i * wx4 * xd) / (2.0 * 1.0i - 2.0 * wx4))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-1.0 / 2.0) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4))) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-1.0 / 2.0) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_37) * my_sign((-1.0 / 2.0) * real(wx3)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_38) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_39) * my_sign((-1.0 / 2.0) * real(wx4)) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
                 - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xd) / (1.0i + wx3))) * my_sign(imag((1.0i - xd) / (1.0i + wx3))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, (wx3 + xd) / (1.0i + wx3)) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xd) / (1.0i + wx4))) * my_sign(imag((1.0i - xd) / (1.0i + wx4))) *
-                T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, (wx4 + xd) / (1.0i + wx4)) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 - (1.0i / 2.0) * wx3)) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx3)) * my_sign((-1.0 / 2.0) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * M_PI * power_of<2>(log(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4))) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / 2.0 + (1.0i / 2.0) * wx4)) * my_sign((-1.0 / 2.0) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xd) / (1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i + wx3))) *
+                T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, (wx4 + xd) / (1.0i + wx4)) + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_36) * my_sign(real(wx3) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_37) * my_sign((-1.0 / 2.0) * real(wx3)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_38) * my_sign(real(wx4) / 2.0) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(c_ln_39) * my_sign((-1.0 / 2.0) * real(wx4)) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xd) / (1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i + wx3))) *
                 T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, (wx3 - xd) / (1.0i + wx3)) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xd) / (1.0i + wx4))) * my_sign(imag((1.0i + xd) / (1.0i + wx4))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, (wx4 - xd) / (1.0i + wx4))
-                + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                + (4.0 * 1.0i) * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + 1.0i * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                + (4.0 * 1.0i) * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + 1.0i * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                + (4.0 * 1.0i) * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + 1.0i * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                + (4.0 * 1.0i) * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + 1.0i * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
                 - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx3 + xd) / (-1.0i + wx3))) * my_sign(imag((1.0i + xd) / (1.0i - wx3))) * T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx3 + xd) / (-1.0i + wx3)) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx4 + xd) / (-1.0i + wx4))) * my_sign(imag((1.0i + xd) / (1.0i - wx4))) *
-                T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx4 + xd) / (-1.0i + wx4)) + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * log(1.0 - 1.0i * wx3) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx3)) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx3)) * (4.0 * log(wx3 / (1.0i + wx3)) - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) + (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                    + (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)) + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * log(1.0 + 1.0i * wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx3)) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx3) * (4.0 * log(wx3 / (-1.0i + wx3)) - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx3 + xd) / (-1.0i + wx3))
-                    + (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * log(1.0 - 1.0i * wx4) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx4)) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4)) * (4.0 * log(wx4 / (1.0i + wx4)) - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 2.0 * log((wx4 + xd) / (1.0i + wx4))
-                    + (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) + (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx4) * log(1.0 + 1.0i * wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
-                + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx4)) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * xd) * (log((wx3 + xd) / (-1.0i + wx3)) + log((wx3 + xd) / (1.0i + wx3)) + log((wx4 + xd) / (-1.0i + wx4))
-                    + log((wx4 + xd) / (1.0i + wx4))) - (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i + xd))) *
-                    T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * log(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4)) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + li2half * (-4.0 * log(wx3 / (-1.0i + wx3)) - 4.0 * log(wx3 / (1.0i + wx3)) - 4.0 * log(wx4 / (-1.0i + wx4)) - 4.0 * log(wx4 / (1.0i + wx4))
+                T(1.0, (1.0 + 1.0i * xd) / 2.0, (wx4 + xd) / (-1.0i + wx4)) + (4.0 * 1.0i) * M_PI * c_ln_37 * c_ln_7 * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + 1.0i * M_PI * power_of<2>(c_ln_7) * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                + c_li2_25 * (4.0 * c_ln_21 - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) + (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                    + (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)) + (4.0 * 1.0i) * M_PI * c_ln_36 * c_ln_8 * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                + 1.0i * M_PI * power_of<2>(c_ln_8) * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + c_li2_26 * (4.0 * c_ln_18 - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx3 + xd) / (-1.0i + wx3))
+                    + (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)) + (4.0 * 1.0i) * M_PI * c_ln_39 * c_ln_9 * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                + 1.0i * M_PI * power_of<2>(c_ln_9) * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + c_li2_27 * (4.0 * c_ln_31 - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 2.0 * log((wx4 + xd) / (1.0i + wx4))
+                    + (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)) + (4.0 * 1.0i) * M_PI * c_ln_40 * c_ln_10 * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                + 1.0i * M_PI * power_of<2>(c_ln_10) * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * xd) * (log((wx3 + xd) / (-1.0i + wx3)) + log((wx3 + xd) / (1.0i + wx3)) + log((wx4 + xd) / (-1.0i + wx4))
+                    + log((wx4 + xd) / (1.0i + wx4))) - (4.0 * 1.0i) * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i + xd))) *
+                    T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * c_ln_38 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4)
+                    - (4.0 * 1.0i) * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 1.0 / 2.0 + (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + li2half * (-4.0 * c_ln_18 - 4.0 * c_ln_21 - 4.0 * c_ln_28 - 4.0 * c_ln_31
                     + 2.0 * log((wx3 - xd) / (-1.0i + wx3)) + 2.0 * log((wx3 - xd) / (1.0i + wx3)) + 2.0 * log((wx4 - xd) / (-1.0i + wx4)) + 2.0 * log((wx4 - xd) / (1.0i + wx4)) + 2.0 * log((wx3 + xd) / (-1.0i + wx3)) + 2.0 * log((wx3 + xd) / (1.0i + wx3))
                     + 2.0 * log((wx4 + xd) / (-1.0i + wx4)) + 2.0 * log((wx4 + xd) / (1.0i + wx4)) - (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
                     - (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * my_sign(real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
                     - (4.0 * 1.0i) * M_PI * my_sign(-real(wx3)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * my_sign(real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
-                + dilog(1.0 / 2.0 + (1.0i / 2.0) * wx4) * (4.0 * log(wx4 / (-1.0i + wx4)) - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4)) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log(1.0 + 1.0i * xd) * ((-4.0 * 1.0i) * M_PI * log(1.0 / 2.0 - (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx3) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * log(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4)) * my_sign(2.0 * real(1.0 / (1.0i - xd))) *
-                    T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 / 2.0 + (1.0i / 2.0) * wx4) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                + c_li2_28 * (4.0 * c_ln_28 - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4)) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (4.0 * 1.0i) * M_PI * my_sign(-real(wx4)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + log(1.0 + 1.0i * xd) * ((-4.0 * 1.0i) * M_PI * c_ln_36 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_37 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx3) - (4.0 * 1.0i) * M_PI * c_ln_38 * my_sign(2.0 * real(1.0 / (1.0i - xd))) *
+                    T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 - (1.0i / 2.0) * wx4) - (4.0 * 1.0i) * M_PI * c_ln_39 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 1.0 / 2.0 - (1.0i / 2.0) * xd, 1.0 / 2.0 + (1.0i / 2.0) * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx3 - xd) / (-1.0i + wx3))) * my_sign(imag((-1.0i + xd) / (-1.0i + wx3))) * T(1.0, ((-1.0 / 2.0) * 1.0i) * (1.0i + xd), (wx3 - xd) / (-1.0i + wx3)) - (2.0 * 1.0i) * M_PI * power_of<2>(log((wx4 - xd) / (-1.0i + wx4))) * my_sign(imag((-1.0i + xd) / (-1.0i + wx4))) *
-                T(1.0, ((-1.0 / 2.0) * 1.0i) * (1.0i + xd), (wx4 - xd) / (-1.0i + wx4)) + 1.0i * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(log((-1.0i + wx3) / wx3)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((-1.0i + wx3) / wx3) * my_sign(-real(wx3)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(log((1.0i + wx3) / wx3)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((1.0i + wx3) / wx3) * my_sign(real(wx3)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(log((-1.0i + wx4) / wx4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((-1.0i + wx4) / wx4) * my_sign(-real(wx4)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(log((1.0i + wx4) / wx4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
-                - (4.0 * 1.0i) * M_PI * ln2 * log((1.0i + wx4) / wx4) * my_sign(real(wx4)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + log(xd) * (-(log((1.0i - xd) / (1.0i + wx4)) * log((wx4 + xd) / wx4)) - log((1.0i + xd) / (1.0i - wx4)) * log((wx4 + xd) / wx4)
+                T(1.0, ((-1.0 / 2.0) * 1.0i) * (1.0i + xd), (wx4 - xd) / (-1.0i + wx4)) + 1.0i * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_11 * my_sign(-real(wx3)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_12 * my_sign(real(wx3)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_13 * my_sign(-real(wx4)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_14 * my_sign(real(wx4)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(c_ln_11) * my_sign(real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_11 * my_sign(-real(wx3)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(c_ln_12) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_12 * my_sign(real(wx3)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3) + 1.0i * M_PI * power_of<2>(c_ln_13) * my_sign(real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_13 * my_sign(-real(wx4)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) + 1.0i * M_PI * power_of<2>(c_ln_14) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4)
+                - (4.0 * 1.0i) * M_PI * ln2 * c_ln_14 * my_sign(real(wx4)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4) + log(xd) * (-(log((1.0i - xd) / (1.0i + wx4)) * log((wx4 + xd) / wx4)) - log((1.0i + xd) / (1.0i - wx4)) * log((wx4 + xd) / wx4)
                     - log((-1.0i + xd) / (-1.0i + wx3)) * log(1.0 - xd / wx3) - log((1.0i + xd) / (1.0i + wx3)) * log(1.0 - xd / wx3) - log((-1.0i + xd) / (-1.0i + wx4)) * log(1.0 - xd / wx4) - log((1.0i + xd) / (1.0i + wx4)) * log(1.0 - xd / wx4)
-                    - (2.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - (2.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
-                    - (2.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) - (2.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
-                    - (2.0 * 1.0i) * M_PI * log((-1.0i + wx3) / wx3) * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) - (2.0 * 1.0i) * M_PI * log((1.0i + wx3) / wx3) * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
-                    - (2.0 * 1.0i) * M_PI * log((-1.0i + wx4) / wx4) * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - (2.0 * 1.0i) * M_PI * log((1.0i + wx4) / wx4) * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4))
+                    - (2.0 * 1.0i) * M_PI * c_ln_11 * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (-1.0i + wx3) / wx3) - (2.0 * 1.0i) * M_PI * c_ln_12 * my_sign(-imag(wx3 * xdinv)) * T(1.0, (wx3 + xd) / wx3, (1.0i + wx3) / wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_13 * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (-1.0i + wx4) / wx4) - (2.0 * 1.0i) * M_PI * c_ln_14 * my_sign(-imag(wx4 * xdinv)) * T(1.0, (wx4 + xd) / wx4, (1.0i + wx4) / wx4)
+                    - (2.0 * 1.0i) * M_PI * c_ln_11 * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (-1.0i + wx3) / wx3) - (2.0 * 1.0i) * M_PI * c_ln_12 * my_sign(imag(wx3 * xdinv)) * T(1.0, 1.0 - xd / wx3, (1.0i + wx3) / wx3)
+                    - (2.0 * 1.0i) * M_PI * c_ln_13 * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (-1.0i + wx4) / wx4) - (2.0 * 1.0i) * M_PI * c_ln_14 * my_sign(imag(wx4 * xdinv)) * T(1.0, 1.0 - xd / wx4, (1.0i + wx4) / wx4))
                 + power_of<2>(log(1.0 - 1.0i * xd)) * (2.0 * log(-1.0i / xd) - log(((-1.0i) * (wx3 - xd)) / ((1.0i + wx3) * xd)) / 2.0 - log(((-1.0i) * (wx4 - xd)) / ((1.0i + wx4) * xd)) / 2.0 + log((wx3 + xd) / (-1.0i + wx3)) / 2.0 - log(((-1.0i) * (wx3 + xd)) / ((-1.0i + wx3) * xd)) / 2.0
                     + log((wx4 + xd) / (-1.0i + wx4)) / 2.0 - log(((-1.0i) * (wx4 + xd)) / ((-1.0i + wx4) * xd)) / 2.0 - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, (wx3 + xd) / wx3, 1.0 - 1.0i * xd) - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, (wx4 + xd) / wx4, 1.0 - 1.0i * xd)
                     - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx3, 1.0 - 1.0i * xd) - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx4, 1.0 - 1.0i * xd)) + power_of<2>(log(1.0 + 1.0i * xd)) * (2.0 * log(1.0i / xd) - log((1.0i * (wx3 - xd)) / ((-1.0i + wx3) * xd)) / 2.0
@@ -643,8 +643,8 @@ namespace eos
                 - dilog(w5) * log((w5 + yd) / w5) + dilog((1.0i - xd) / (1.0i + wx3)) * log((w5 + yd) / w5) + dilog((1.0i - xd) / (1.0i + wx4)) * log((w5 + yd) / w5) - dilog(-(xd / wx3)) * log((w5 + yd) / w5)
                 - dilog(-(xd / wx4)) * log((w5 + yd) / w5) + dilog((1.0i + xd) / (1.0i - wx3)) * log((w5 + yd) / w5) + dilog((1.0i + xd) / (1.0i - wx4)) * log((w5 + yd) / w5)
                 + power_of<2>(log((1.0 + yd) / 2.0)) * (log((1.0 + w4) / (w4 - yd)) / 2.0 - log((-2.0 * (w4 - yd)) / ((1.0 + w4) * (-1.0 + yd))) / 2.0 - log((-1.0 / 2.0) * (((1.0 + w4) * (-1.0 + yd)) / (w4 - yd))) / 2.0 + log((-1.0 + w5) / (w5 + yd)) / 2.0
-                    - log((-1.0 / 2.0) * (((-1.0 + w5) * (-1.0 + yd)) / (w5 + yd))) / 2.0 + log((w5 + yd) / (-1.0 + w5)) / 2.0 - log((-2.0 * (w5 + yd)) / ((-1.0 + w5) * (-1.0 + yd))) / 2.0) + dilog(-1.0i / (-1.0i + wx3)) * (-log((w5 + yd) / w5) - log(1.0 - yd / w4))
-                + dilog(1.0i / (1.0i + wx3)) * (-log((w5 + yd) / w5) - log(1.0 - yd / w4)) + dilog(-1.0i / (-1.0i + wx4)) * (-log((w5 + yd) / w5) - log(1.0 - yd / w4)) + dilog(1.0i / (1.0i + wx4)) * (-log((w5 + yd) / w5) - log(1.0 - yd / w4))
+                    - log((-1.0 / 2.0) * (((-1.0 + w5) * (-1.0 + yd)) / (w5 + yd))) / 2.0 + log((w5 + yd) / (-1.0 + w5)) / 2.0 - log((-2.0 * (w5 + yd)) / ((-1.0 + w5) * (-1.0 + yd))) / 2.0) + c_li2_1 * (-log((w5 + yd) / w5) - log(1.0 - yd / w4))
+                + c_li2_2 * (-log((w5 + yd) / w5) - log(1.0 - yd / w4)) + c_li2_3 * (-log((w5 + yd) / w5) - log(1.0 - yd / w4)) + c_li2_4 * (-log((w5 + yd) / w5) - log(1.0 - yd / w4))
                 - dilog(-w4) * log(1.0 - yd / w4) + dilog(w4) * log(1.0 - yd / w4) - dilog(xd / wx3) * log(1.0 - yd / w4) - dilog(xd / wx4) * log(1.0 - yd / w4) + dilog((-1.0i + xd) / (-1.0i + wx3)) * log(1.0 - yd / w4)
                 + dilog((-1.0i + xd) / (-1.0i + wx4)) * log(1.0 - yd / w4) + dilog((1.0i + xd) / (1.0i + wx3)) * log(1.0 - yd / w4) + dilog((1.0i + xd) / (1.0i + wx4)) * log(1.0 - yd / w4)
                 + dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) * (log((w5 + yd) / w5) + log(1.0 - yd / w4)) + dilog((-1.0i) * xd) * (log((w5 + yd) / w5) + log(1.0 - yd / w4)) + dilog(1.0i * xd) * (log((w5 + yd) / w5) + log(1.0 - yd / w4))
@@ -655,12 +655,12 @@ namespace eos
                 - 1.0i * M_PI * H1(w5inv, -ydinv) * power_of<2>(log(w5 + yd)) * my_sign(-imydinv) + 1.0i * M_PI * H1(w4inv, ydinv) * power_of<2>(log(w4 - yd)) * my_sign(imydinv) + 1.0i * M_PI * H1(-w5inv, ydinv) * power_of<2>(log(-w5 - yd)) * my_sign(imydinv)
                 + log((w5 + yd) / w5) * ((-1.0 / 2.0) * power_of<2>(log(1.0 - 1.0i * xd)) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 - 2.0 * ln2 * log((wx3 + xd) / wx3) + log(xd) * (-log((wx3 + xd) / wx3) - log((wx4 + xd) / wx4)) - 2.0 * ln2 * log((wx4 + xd) / wx4)
                     + log(1.0 - 1.0i * xd) * (ln2 + log(xd) + log((wx3 + xd) / (-1.0i + wx3)) + log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (ln2 + log(xd) + log((wx3 + xd) / (1.0i + wx3)) + log((wx4 + xd) / (1.0i + wx4)))
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
                 + log(1.0 - yd / w4) * ((-1.0 / 2.0) * power_of<2>(log(1.0 - 1.0i * xd)) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 + 1.0i * xd) * (ln2 + log((wx3 - xd) / (-1.0i + wx3)) + log((wx4 - xd) / (-1.0i + wx4)) + log(xd))
                     + log(1.0 - 1.0i * xd) * (ln2 + log((wx3 - xd) / (1.0i + wx3)) + log((wx4 - xd) / (1.0i + wx4)) + log(xd)) - 2.0 * ln2 * log(1.0 - xd / wx3) + log(xd) * (-log(1.0 - xd / wx3) - log(1.0 - xd / wx4))
-                    - 2.0 * ln2 * log(1.0 - xd / wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    - 2.0 * ln2 * log(1.0 - xd / wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - w4) * my_sign(imag(w4inv)) * T(1.0, 1.0 - yd, 1.0 - w4) - (2.0 * 1.0i) * M_PI * log(1.0 - w4) * log((1.0 + w4) / 2.0) * my_sign(imag(w4)) * T(1.0, 1.0 - yd, 1.0 - w4)
                 + dilog((1.0 - w4) / 2.0) * (-log(w4 / (-1.0 + w4)) + log((w4 - yd) / (-1.0 + w4)) - (2.0 * 1.0i) * M_PI * my_sign(imag(w4)) * T(1.0, 1.0 - yd, 1.0 - w4)) + (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + w5) * my_sign(-imag(w5inv)) * T(1.0, 1.0 - yd, 1.0 + w5)
                 - (2.0 * 1.0i) * M_PI * log((1.0 - w5) / 2.0) * log(1.0 + w5) * my_sign(-imag(w5)) * T(1.0, 1.0 - yd, 1.0 + w5) + dilog((1.0 + w5) / 2.0) * (-log(w5 / (1.0 + w5)) + log((w5 + yd) / (1.0 + w5)) - (2.0 * 1.0i) * M_PI * my_sign(-imag(w5)) * T(1.0, 1.0 - yd, 1.0 + w5))
@@ -710,8 +710,8 @@ namespace eos
                 + log((1.0 - yd) / 2.0) * (log((w5 - yd) / (-1.0 + w5)) * ln1pyd + ln1pyd * log((w4 + yd) / (1.0 + w4))) + power_of<2>(log((1.0 - yd) / 2.0)) * (log((-1.0 + w5) / (w5 - yd)) / 2.0 + log((w5 - yd) / (-1.0 + w5)) / 2.0
                     - log((2.0 * (w5 - yd)) / ((-1.0 + w5) * (1.0 + yd))) / 2.0 - log(((-1.0 + w5) * (1.0 + yd)) / (2.0 * (w5 - yd))) / 2.0 + log((1.0 + w4) / (w4 + yd)) / 2.0 - log(((1.0 + w4) * (1.0 + yd)) / (2.0 * (w4 + yd))) / 2.0 + log((w4 + yd) / (1.0 + w4)) / 2.0
                     - log((2.0 * (w4 + yd)) / ((1.0 + w4) * (1.0 + yd))) / 2.0) + (pisqu * log(1.0 / (-w5 + yd))) / 6.0 + power_of<3>(log(1.0 / (-w5 + yd))) / 6.0 + power_of<2>(ln1pyd) * (log((1.0 + w5) / (w5 - yd)) / 2.0 + log((-1.0 + w4) / (w4 + yd)) / 2.0
-                    - log(((1.0 + w5) * yd) / (-w5 + yd)) / 2.0 - log((yd - w4 * yd) / (w4 + yd)) / 2.0) + dilog(-1.0i / (-1.0i + wx3)) * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + dilog(1.0i / (1.0i + wx3)) * (-log((w4 + yd) / w4) - log(1.0 - yd / w5))
-                + dilog(-1.0i / (-1.0i + wx4)) * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + dilog(1.0i / (1.0i + wx4)) * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + dilog(-w5) * log(1.0 - yd / w5) - dilog(w5) * log(1.0 - yd / w5)
+                    - log(((1.0 + w5) * yd) / (-w5 + yd)) / 2.0 - log((yd - w4 * yd) / (w4 + yd)) / 2.0) + c_li2_1 * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + c_li2_2 * (-log((w4 + yd) / w4) - log(1.0 - yd / w5))
+                + c_li2_3 * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + c_li2_4 * (-log((w4 + yd) / w4) - log(1.0 - yd / w5)) + dilog(-w5) * log(1.0 - yd / w5) - dilog(w5) * log(1.0 - yd / w5)
                 + dilog((1.0i - xd) / (1.0i + wx3)) * log(1.0 - yd / w5) + dilog((1.0i - xd) / (1.0i + wx4)) * log(1.0 - yd / w5) - dilog(-(xd / wx3)) * log(1.0 - yd / w5) - dilog(-(xd / wx4)) * log(1.0 - yd / w5)
                 + dilog((1.0i + xd) / (1.0i - wx3)) * log(1.0 - yd / w5) + dilog((1.0i + xd) / (1.0i - wx4)) * log(1.0 - yd / w5) + dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) * (log((w4 + yd) / w4) + log(1.0 - yd / w5))
                 + dilog((-1.0i) * xd) * (log((w4 + yd) / w4) + log(1.0 - yd / w5)) + dilog(1.0i * xd) * (log((w4 + yd) / w4) + log(1.0 - yd / w5)) + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) * (log((w4 + yd) / w4) + log(1.0 - yd / w5))
@@ -721,12 +721,12 @@ namespace eos
                 - 1.0i * M_PI * H1((1.0 + w5) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log((-1.0 / 2.0) * (((-1.0 + w5) * (1.0 + yd)) / (1.0 + w5)))) * my_sign(2.0 * imag(1.0 / (1.0 + yd)))
                 + log(1.0 - yd / w5) * ((-1.0 / 2.0) * power_of<2>(log(1.0 - 1.0i * xd)) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 - 2.0 * ln2 * log((wx3 + xd) / wx3) + log(xd) * (-log((wx3 + xd) / wx3) - log((wx4 + xd) / wx4)) - 2.0 * ln2 * log((wx4 + xd) / wx4)
                     + log(1.0 - 1.0i * xd) * (ln2 + log(xd) + log((wx3 + xd) / (-1.0i + wx3)) + log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (ln2 + log(xd) + log((wx3 + xd) / (1.0i + wx3)) + log((wx4 + xd) / (1.0i + wx4)))
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
                 + log((w4 + yd) / w4) * ((-1.0 / 2.0) * power_of<2>(log(1.0 - 1.0i * xd)) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 + 1.0i * xd) * (ln2 + log((wx3 - xd) / (-1.0i + wx3)) + log((wx4 - xd) / (-1.0i + wx4)) + log(xd))
                     + log(1.0 - 1.0i * xd) * (ln2 + log((wx3 - xd) / (1.0i + wx3)) + log((wx4 - xd) / (1.0i + wx4)) + log(xd)) - 2.0 * ln2 * log(1.0 - xd / wx3) + log(xd) * (-log(1.0 - xd / wx3) - log(1.0 - xd / wx4))
-                    - 2.0 * ln2 * log(1.0 - xd / wx4) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                    + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    - 2.0 * ln2 * log(1.0 - xd / wx4) + (2.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                    + (2.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) + (2.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 - 1.0i * M_PI * power_of<2>(log((1.0 + w4) / 2.0)) * my_sign((-1.0 / 2.0) * imag(w4)) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w4) / 2.0) - 1.0i * M_PI * power_of<2>(log((1.0 - w5) / 2.0)) * my_sign(imag(w5) / 2.0) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w5) / 2.0)
                 + ln1pyd * ((2.0 * ln2 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) + log(xd)) * log((w5 - yd) / (1.0 + w5)) + (2.0 * ln2 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) + log(xd)) * log((w4 + yd) / (-1.0 + w4))
                     + (2.0 * 1.0i) * M_PI * log((1.0 + w4) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w4) / 2.0) + (2.0 * 1.0i) * M_PI * log((1.0 - w5) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w5) / 2.0))
@@ -758,8 +758,8 @@ namespace eos
                 - (pisqu * log((2.0 * (-1.0 + w7)) / ((1.0 + w7) * (1.0 + yd)))) / 6.0 - power_of<3>(log((2.0 * (-1.0 + w7)) / ((1.0 + w7) * (1.0 + yd)))) / 6.0 + dilog((1.0 - yd) / (1.0 + w7)) * (4.0 * ln2 - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) + 2.0 * log(xd)
                     - log((1.0 - yd) / 2.0) + ln1myd - ln1pyd) + dilog(2.0 / (1.0 + w7)) * ln1pyd + dilog(1.0 + ydinv) * ln1pyd - dilog((1.0 + yd) / (w7 + yd)) * ln1pyd
                 + dilog((w7 * (1.0 + yd)) / (w7 + yd)) * ln1pyd + log(-ydinv) * ((-1.0 / 6.0) * pisqu + power_of<2>(ln1pyd) / 2.0) + (pisqu * log(-1.0 / (w7 + yd))) / 6.0 + power_of<3>(log(-1.0 / (w7 + yd))) / 6.0 - (pisqu * log(1.0 / (w7 + yd))) / 6.0
-                - power_of<3>(log(1.0 / (w7 + yd))) / 6.0 + (pisqu * log(2.0 / (w7 + yd))) / 6.0 + power_of<3>(log(2.0 / (w7 + yd))) / 6.0 + dilog(-w7) * log((w7 + yd) / w7) - dilog(w7) * log((w7 + yd) / w7) + 4.0 * dilog(-1.0i / (-1.0i + wx3)) * log((w7 + yd) / w7)
-                + 4.0 * dilog(1.0i / (1.0i + wx3)) * log((w7 + yd) / w7) + 4.0 * dilog(-1.0i / (-1.0i + wx4)) * log((w7 + yd) / w7) + 4.0 * dilog(1.0i / (1.0i + wx4)) * log((w7 + yd) / w7) - 2.0 * dilog((1.0i - xd) / (1.0i + wx3)) * log((w7 + yd) / w7)
+                - power_of<3>(log(1.0 / (w7 + yd))) / 6.0 + (pisqu * log(2.0 / (w7 + yd))) / 6.0 + power_of<3>(log(2.0 / (w7 + yd))) / 6.0 + dilog(-w7) * log((w7 + yd) / w7) - dilog(w7) * log((w7 + yd) / w7) + 4.0 * c_li2_1 * log((w7 + yd) / w7)
+                + 4.0 * c_li2_2 * log((w7 + yd) / w7) + 4.0 * c_li2_3 * log((w7 + yd) / w7) + 4.0 * c_li2_4 * log((w7 + yd) / w7) - 2.0 * dilog((1.0i - xd) / (1.0i + wx3)) * log((w7 + yd) / w7)
                 - 2.0 * dilog((1.0i - xd) / (1.0i + wx4)) * log((w7 + yd) / w7) - 4.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) * log((w7 + yd) / w7) - 4.0 * dilog((-1.0i) * xd) * log((w7 + yd) / w7) - 4.0 * dilog(1.0i * xd) * log((w7 + yd) / w7)
                 + 2.0 * dilog(-(xd / wx3)) * log((w7 + yd) / w7) + 2.0 * dilog(xd / wx3) * log((w7 + yd) / w7) + 2.0 * dilog(-(xd / wx4)) * log((w7 + yd) / w7) + 2.0 * dilog(xd / wx4) * log((w7 + yd) / w7)
                 - 2.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) * log((w7 + yd) / w7) - 2.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) * log((w7 + yd) / w7) - 4.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) * log((w7 + yd) / w7)
@@ -774,10 +774,10 @@ namespace eos
                     + log(1.0 - 1.0i * xd) * (-4.0 * ln2 - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xd) * (-4.0 * ln2 - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) - 2.0 * log((wx4 + xd) / (1.0i + wx4)))
                     + 4.0 * ln2 * log(1.0 - xd / wx3) + 4.0 * ln2 * log(1.0 - xd / wx4) + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4))
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 + 1.0i * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-1.0 / 2.0) * imag(w7)) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w7) / 2.0) + ln1pyd * ((-4.0 * ln2 + 2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) - 2.0 * log(xd)) * log((w7 + yd) / (-1.0 + w7))
                     - log((1.0 - yd) / 2.0) * log((w7 + yd) / (1.0 + w7)) - (2.0 * 1.0i) * M_PI * log((1.0 + w7) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w7) / 2.0)) - 1.0i * M_PI * power_of<2>(log((w7 + yd) / (-1.0 + w7))) * my_sign(imag((1.0 + yd) / (1.0 - w7))) *
                 T(1.0, (1.0 - yd) / 2.0, (w7 + yd) / (-1.0 + w7)) + (8.0 * 1.0i) * M_PI * ln2 * log(1.0 + w7) * my_sign(-imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 + w7) - 1.0i * M_PI * power_of<2>(log(1.0 + w7)) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd, 1.0 + w7)
@@ -804,8 +804,8 @@ namespace eos
                 + (log((1.0 + w7) / (w7 - yd)) * power_of<2>(ln1pyd)) / 2.0 + dilog(-((1.0 + yd) / (w7 - yd))) * (-log((1.0 + yd) / 2.0) + ln1pyd)
                 + dilog((1.0 + yd) / (1.0 + w7)) * (4.0 * ln2 - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) + 2.0 * log(xd) - ln1myd - log((1.0 + yd) / 2.0) + ln1pyd) + log(-ydinv) * (pisqu / 6.0 - power_of<2>(ln1pyd) / 2.0)
                 + log((w7 - yd) / (1.0 + w7)) * ((-1.0 / 2.0) * power_of<2>(log((1.0 + yd) / 2.0)) + (4.0 * ln2 - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) + 2.0 * log(xd)) * ln1pyd + power_of<2>(ln1pyd) / 2.0) + (pisqu * log(1.0 / (-w7 + yd))) / 6.0
-                + power_of<3>(log(1.0 / (-w7 + yd))) / 6.0 - (power_of<2>(ln1pyd) * log(((1.0 + w7) * yd) / (-w7 + yd))) / 2.0 + dilog(-w7) * log(1.0 - yd / w7) - dilog(w7) * log(1.0 - yd / w7) + 4.0 * dilog(-1.0i / (-1.0i + wx3)) * log(1.0 - yd / w7)
-                + 4.0 * dilog(1.0i / (1.0i + wx3)) * log(1.0 - yd / w7) + 4.0 * dilog(-1.0i / (-1.0i + wx4)) * log(1.0 - yd / w7) + 4.0 * dilog(1.0i / (1.0i + wx4)) * log(1.0 - yd / w7) - 2.0 * dilog((1.0i - xd) / (1.0i + wx3)) * log(1.0 - yd / w7)
+                + power_of<3>(log(1.0 / (-w7 + yd))) / 6.0 - (power_of<2>(ln1pyd) * log(((1.0 + w7) * yd) / (-w7 + yd))) / 2.0 + dilog(-w7) * log(1.0 - yd / w7) - dilog(w7) * log(1.0 - yd / w7) + 4.0 * c_li2_1 * log(1.0 - yd / w7)
+                + 4.0 * c_li2_2 * log(1.0 - yd / w7) + 4.0 * c_li2_3 * log(1.0 - yd / w7) + 4.0 * c_li2_4 * log(1.0 - yd / w7) - 2.0 * dilog((1.0i - xd) / (1.0i + wx3)) * log(1.0 - yd / w7)
                 - 2.0 * dilog((1.0i - xd) / (1.0i + wx4)) * log(1.0 - yd / w7) - 4.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) * log(1.0 - yd / w7) - 4.0 * dilog((-1.0i) * xd) * log(1.0 - yd / w7) - 4.0 * dilog(1.0i * xd) * log(1.0 - yd / w7) + 2.0 * dilog(-(xd / wx3)) * log(1.0 - yd / w7)
                 + 2.0 * dilog(xd / wx3) * log(1.0 - yd / w7) + 2.0 * dilog(-(xd / wx4)) * log(1.0 - yd / w7) + 2.0 * dilog(xd / wx4) * log(1.0 - yd / w7) - 2.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) * log(1.0 - yd / w7)
                 - 2.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) * log(1.0 - yd / w7) - 4.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) * log(1.0 - yd / w7) - 2.0 * dilog((1.0i + xd) / (1.0i - wx3)) * log(1.0 - yd / w7) - 2.0 * dilog((1.0i + xd) / (1.0i + wx3)) * log(1.0 - yd / w7)
@@ -815,10 +815,10 @@ namespace eos
                     + log(1.0 - 1.0i * xd) * (-4.0 * ln2 - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xd) * (-4.0 * ln2 - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) - 2.0 * log((wx4 + xd) / (1.0i + wx4)))
                     + 4.0 * ln2 * log(1.0 - xd / wx3) + 4.0 * ln2 * log(1.0 - xd / wx4) + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4))
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 - (8.0 * 1.0i) * M_PI * ln2 * log(1.0 - w7) * my_sign(imag(w7inv)) * T(1.0, 1.0 - yd, 1.0 - w7) + (2.0 * 1.0i) * M_PI * log(1.0 - w7) * log((1.0 + w7) / 2.0) * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7)
                 + li2half * (-log(w7 / (-1.0 + w7)) + log((w7 - yd) / (-1.0 + w7)) + 8.0 * log(1.0 - yd / w7) - (2.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7))
                 + dilog((1.0 - w7) / 2.0) * (log(w7 / (-1.0 + w7)) - log((w7 - yd) / (-1.0 + w7)) + (2.0 * 1.0i) * M_PI * my_sign(imag(w7)) * T(1.0, 1.0 - yd, 1.0 - w7)) + 1.0i * M_PI * power_of<2>(log((1.0 + w7) / 2.0)) * my_sign((-1.0 / 2.0) * imag(w7)) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w7) / 2.0)
@@ -833,79 +833,79 @@ namespace eos
             const complex<double> f29dPart5 = (num20 * (16.0 * power_of<2>(li2half) + (dilog((w5 - yd) / (-1.0 + w5)) + dilog(-(yd / w5)) + dilog(yd / w5) + dilog((w5 + yd) / (-1.0 + w5)) + log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5)
                     + log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(xd) * (-4.0 * log((wx3 + xd) / wx3) - 4.0 * log((wx4 + xd) / wx4))
                     + log(1.0 - 1.0i * xd) * (-4.0 * ln2 + 4.0 * log(xd) + 4.0 * log((wx3 + xd) / (-1.0i + wx3)) + 4.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-4.0 * ln2 + 4.0 * log(xd) + 4.0 * log((wx3 + xd) / (1.0i + wx3))
-                    + 4.0 * log((wx4 + xd) / (1.0i + wx4))) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
-                + dilog(w5 / (-1.0 + w5)) * (8.0 * dilog(-1.0i / (-1.0i + wx3)) + 8.0 * dilog(1.0i / (1.0i + wx3)) + 8.0 * dilog(-1.0i / (-1.0i + wx4)) + 8.0 * dilog(1.0i / (1.0i + wx4)) - 8.0 * dilog((1.0i - xd) / (1.0i + wx3)) - 8.0 * dilog((1.0i - xd) / (1.0i + wx4))
+                    + 4.0 * log((wx4 + xd) / (1.0i + wx4))) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                + dilog(w5 / (-1.0 + w5)) * (8.0 * c_li2_1 + 8.0 * c_li2_2 + 8.0 * c_li2_3 + 8.0 * c_li2_4 - 8.0 * dilog((1.0i - xd) / (1.0i + wx3)) - 8.0 * dilog((1.0i - xd) / (1.0i + wx4))
                     - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd) + 8.0 * dilog(-(xd / wx3)) + 8.0 * dilog(-(xd / wx4)) - 8.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) - 8.0 * dilog((1.0i + xd) / (1.0i - wx3))
                     - 8.0 * dilog((1.0i + xd) / (1.0i - wx4)) + 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(xd) * (8.0 * log((wx3 + xd) / wx3) + 8.0 * log((wx4 + xd) / wx4))
                     + log(1.0 - 1.0i * xd) * (8.0 * ln2 - 8.0 * log(xd) - 8.0 * log((wx3 + xd) / (-1.0i + wx3)) - 8.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (8.0 * ln2 - 8.0 * log(xd) - 8.0 * log((wx3 + xd) / (1.0i + wx3))
-                    - 8.0 * log((wx4 + xd) / (1.0i + wx4))) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
+                    - 8.0 * log((wx4 + xd) / (1.0i + wx4))) - (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4))
                 + (dilog((w7 - yd) / (1.0 + w7)) + dilog(-yd) + dilog(yd) + dilog(-(yd / w7)) + dilog(yd / w7) + dilog((w7 + yd) / (1.0 + w7)) + log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7)
                     + log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7) - dilog((1.0 - yd) / 2.0) - dilog((1.0 + yd) / 2.0)) * (2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd))
                     + log(1.0 - 1.0i * xd) * (4.0 * ln2 - 2.0 * log((wx3 - xd) / (1.0i + wx3)) - 2.0 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * log((wx4 + xd) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xd) * (4.0 * ln2 - 2.0 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * log(xd) - 2.0 * log((wx3 + xd) / (1.0i + wx3)) - 2.0 * log((wx4 + xd) / (1.0i + wx4)))
-                    + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4)) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
-                    - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w4 - yd) / (1.0 + w4)) + dilog(-(yd / w4)) + dilog(yd / w4) + dilog((w4 + yd) / (1.0 + w4))
+                    + log(xd) * (2.0 * log((wx3 + xd) / wx3) + 2.0 * log((wx4 + xd) / wx4) + 2.0 * log(1.0 - xd / wx3) + 2.0 * log(1.0 - xd / wx4)) - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                    - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) - (4.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (4.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4)
+                    - (4.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + (dilog((w4 - yd) / (1.0 + w4)) + dilog(-(yd / w4)) + dilog(yd / w4) + dilog((w4 + yd) / (1.0 + w4))
                     + log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4)) * (-2.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 2.0 * power_of<2>(log(1.0 + 1.0i * xd))
                     + log(1.0 + 1.0i * xd) * (-4.0 * ln2 + 4.0 * log((wx3 - xd) / (-1.0i + wx3)) + 4.0 * log((wx4 - xd) / (-1.0i + wx4)) + 4.0 * log(xd)) + log(1.0 - 1.0i * xd) * (-4.0 * ln2 + 4.0 * log((wx3 - xd) / (1.0i + wx3))
-                    + 4.0 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * log(xd)) + log(xd) * (-4.0 * log(1.0 - xd / wx3) - 4.0 * log(1.0 - xd / wx4)) + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + dilog(w7 / (1.0 + w7)) * (-8.0 * dilog(-1.0i / (-1.0i + wx3)) - 8.0 * dilog(1.0i / (1.0i + wx3)) - 8.0 * dilog(-1.0i / (-1.0i + wx4)) - 8.0 * dilog(1.0i / (1.0i + wx4))
+                    + 4.0 * log((wx4 - xd) / (1.0i + wx4)) + 4.0 * log(xd)) + log(xd) * (-4.0 * log(1.0 - xd / wx3) - 4.0 * log(1.0 - xd / wx4)) + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3)
+                    + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)) + dilog(w7 / (1.0 + w7)) * (-8.0 * c_li2_1 - 8.0 * c_li2_2 - 8.0 * c_li2_3 - 8.0 * c_li2_4
                     + 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) + 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) + 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + 8.0 * dilog((-1.0i) * xd) + 8.0 * dilog(1.0i * xd) - 4.0 * dilog(-(xd / wx3)) - 4.0 * dilog(xd / wx3) - 4.0 * dilog(-(xd / wx4))
                     - 4.0 * dilog(xd / wx4) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) + 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) + 8.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) + 4.0 * dilog((1.0i + xd) / (1.0i - wx3)) + 4.0 * dilog((1.0i + xd) / (1.0i + wx3))
                     + 4.0 * dilog((1.0i + xd) / (1.0i - wx4)) + 4.0 * dilog((1.0i + xd) / (1.0i + wx4)) - 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (-8.0 * ln2 + 4.0 * log((wx3 - xd) / (1.0i + wx3)) + 4.0 * log((wx4 - xd) / (1.0i + wx4))
                     + 8.0 * log(xd) + 4.0 * log((wx3 + xd) / (-1.0i + wx3)) + 4.0 * log((wx4 + xd) / (-1.0i + wx4))) + log(1.0 + 1.0i * xd) * (-8.0 * ln2 + 4.0 * log((wx3 - xd) / (-1.0i + wx3)) + 4.0 * log((wx4 - xd) / (-1.0i + wx4)) + 8.0 * log(xd)
                     + 4.0 * log((wx3 + xd) / (1.0i + wx3)) + 4.0 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (-4.0 * log((wx3 + xd) / wx3) - 4.0 * log((wx4 + xd) / wx4) - 4.0 * log(1.0 - xd / wx3) - 4.0 * log(1.0 - xd / wx4))
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    + (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
-                + dilog(w4 / (1.0 + w4)) * (8.0 * dilog(-1.0i / (-1.0i + wx3)) + 8.0 * dilog(1.0i / (1.0i + wx3)) + 8.0 * dilog(-1.0i / (-1.0i + wx4)) + 8.0 * dilog(1.0i / (1.0i + wx4)) - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd)
+                    + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    + (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) + (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    + (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) + (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                + dilog(w4 / (1.0 + w4)) * (8.0 * c_li2_1 + 8.0 * c_li2_2 + 8.0 * c_li2_3 + 8.0 * c_li2_4 - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd)
                     + 8.0 * dilog(xd / wx3) + 8.0 * dilog(xd / wx4) - 8.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) - 8.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) - 8.0 * dilog((1.0i + xd) / (1.0i + wx3))
                     - 8.0 * dilog((1.0i + xd) / (1.0i + wx4)) + 4.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (8.0 * ln2 - 8.0 * log((wx3 - xd) / (-1.0i + wx3)) - 8.0 * log((wx4 - xd) / (-1.0i + wx4)) - 8.0 * log(xd))
                     + log(1.0 - 1.0i * xd) * (8.0 * ln2 - 8.0 * log((wx3 - xd) / (1.0i + wx3)) - 8.0 * log((wx4 - xd) / (1.0i + wx4)) - 8.0 * log(xd)) + log(xd) * (8.0 * log(1.0 - xd / wx3) + 8.0 * log(1.0 - xd / wx4))
-                    - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
-                    - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                    - (16.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4)
+                    - (16.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) - (16.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
                 + (ln1pyd + ln1myd) * (2.0 * ln2 * power_of<2>(log(1.0 - 1.0i * xd)) + 2.0 * ln2 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (4.0 * ln2squ - 2.0 * ln2 * log((wx3 - xd) / (1.0i + wx3))
                     - 2.0 * ln2 * log((wx4 - xd) / (1.0i + wx4)) - 4.0 * ln2 * log(xd) - 2.0 * ln2 * log((wx3 + xd) / (-1.0i + wx3)) - 2.0 * ln2 * log((wx4 + xd) / (-1.0i + wx4)))
                     + log(1.0 + 1.0i * xd) * (4.0 * ln2squ - 2.0 * ln2 * log((wx3 - xd) / (-1.0i + wx3)) - 2.0 * ln2 * log((wx4 - xd) / (-1.0i + wx4)) - 4.0 * ln2 * log(xd) - 2.0 * ln2 * log((wx3 + xd) / (1.0i + wx3))
                     - 2.0 * ln2 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (2.0 * ln2 * log((wx3 + xd) / wx3) + 2.0 * ln2 * log((wx4 + xd) / wx4) + 2.0 * ln2 * log(1.0 - xd / wx3) + 2.0 * ln2 * log(1.0 - xd / wx4))
-                    - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * ln2 * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
-                - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
-                - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
-                - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
-                - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
-                - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx3) * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
-                - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx4) * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
-                - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx3) * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
-                - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx4) * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
-                - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w4)) *
-                my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) *
-                T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
-                - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx3) * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 + 1.0i * wx4) * my_sign(imag(w5)) *
-                my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx3) * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) *
-                T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * log(1.0 - 1.0i * wx4) * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) *
-                my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) *
-                T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
-                + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx3) * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx3) * my_sign(-imag(w7)) *
-                my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 - 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) *
-                T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * log(1.0 + 1.0i * wx4) * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
+                    - (4.0 * 1.0i) * M_PI * ln2 * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * ln2 * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * ln2 * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * ln2 * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (4.0 * 1.0i) * M_PI * ln2 * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (4.0 * 1.0i) * M_PI * ln2 * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (4.0 * 1.0i) * M_PI * ln2 * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (4.0 * 1.0i) * M_PI * ln2 * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4))
+                - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_7 * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_9 * my_sign(-imag(w4)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_8 * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_10 * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv)
+                - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_8 * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
+                - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_10 * my_sign(imag(w5)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
+                - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_7 * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
+                - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_9 * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
+                - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_7 * my_sign(-imag(w4)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_9 * my_sign(-imag(w4)) *
+                my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_8 * my_sign(-imag(w4)) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) *
+                T(1.0, 1.0 - yd / w4, 1.0 + w4inv) - 16.0 * pisqu * log(1.0 + w4inv) * c_ln_10 * my_sign(-imag(w4)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
+                - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_8 * my_sign(imag(w5)) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_10 * my_sign(imag(w5)) *
+                my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_7 * my_sign(imag(w5)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) *
+                T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - 16.0 * pisqu * log((-1.0 + w5) / w5) * c_ln_9 * my_sign(imag(w5)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) *
+                my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) *
+                T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
+                + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_7 * my_sign(-imag(w7)) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_8 * my_sign(-imag(w7)) *
+                my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_9 * my_sign(-imag(w7)) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) *
+                T(1.0, 1.0 - yd / w7, 1.0 + w7inv) + 8.0 * pisqu * log(1.0 + w7inv) * c_ln_10 * my_sign(-imag(w7)) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv)
                 + (dilog((-1.0i + xd) / (-1.0i + wx3)) + dilog((-1.0i + xd) / (-1.0i + wx4)) + dilog((1.0i + xd) / (1.0i + wx3)) + dilog((1.0i + xd) / (1.0i + wx4))) * (2.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4))
                     - 2.0 * dilog((w7 - yd) / (1.0 + w7)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4) - 2.0 * dilog(-(yd / w7)) - 2.0 * dilog(yd / w7) + 2.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w4 + yd) / (1.0 + w4))
                     - 2.0 * dilog((w7 + yd) / (1.0 + w7)) - 2.0 * ln2 * ln1myd - 2.0 * ln2 * ln1pyd + 4.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) - 2.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7)
@@ -930,7 +930,7 @@ namespace eos
                     - 4.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) + 2.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7) - 4.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) + 2.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7)
                     - (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv)
                     - (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + (4.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
-                + (dilog((-1.0i) * xd) + dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + dilog(1.0i * xd) + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) - dilog(-1.0i / (-1.0i + wx3)) - dilog(1.0i / (1.0i + wx3)) - dilog(-1.0i / (-1.0i + wx4)) - dilog(1.0i / (1.0i + wx4))) *
+                + (dilog((-1.0i) * xd) + dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) + dilog(1.0i * xd) + dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) - c_li2_1 - c_li2_2 - c_li2_3 - c_li2_4) *
                 (4.0 * dilog((1.0 - yd) / 2.0) + 4.0 * dilog((w4 - yd) / (1.0 + w4)) + 4.0 * dilog((w5 - yd) / (-1.0 + w5)) - 4.0 * dilog((w7 - yd) / (1.0 + w7)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) + 4.0 * dilog(-(yd / w4)) + 4.0 * dilog(yd / w4)
                     + 4.0 * dilog(-(yd / w5)) + 4.0 * dilog(yd / w5) - 4.0 * dilog(-(yd / w7)) - 4.0 * dilog(yd / w7) + 4.0 * dilog((1.0 + yd) / 2.0) + 4.0 * dilog((w4 + yd) / (1.0 + w4)) + 4.0 * dilog((w5 + yd) / (-1.0 + w5)) - 4.0 * dilog((w7 + yd) / (1.0 + w7))
                     - 4.0 * ln2 * ln1myd - 4.0 * ln2 * ln1pyd + 4.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) + 4.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) - 4.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7)
@@ -938,7 +938,7 @@ namespace eos
                     + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) + (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
                     - (8.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) + (8.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
                     + (8.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) - (8.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
-                + li2half * (16.0 * dilog(w4 / (1.0 + w4)) + 16.0 * dilog(w5 / (-1.0 + w5)) - 16.0 * dilog(w7 / (1.0 + w7)) + 8.0 * dilog(-1.0i / (-1.0i + wx3)) + 8.0 * dilog(1.0i / (1.0i + wx3)) + 8.0 * dilog(-1.0i / (-1.0i + wx4)) + 8.0 * dilog(1.0i / (1.0i + wx4))
+                + li2half * (16.0 * dilog(w4 / (1.0 + w4)) + 16.0 * dilog(w5 / (-1.0 + w5)) - 16.0 * dilog(w7 / (1.0 + w7)) + 8.0 * c_li2_1 + 8.0 * c_li2_2 + 8.0 * c_li2_3 + 8.0 * c_li2_4
                     - 4.0 * dilog((1.0i - xd) / (1.0i + wx3)) - 4.0 * dilog((1.0i - xd) / (1.0i + wx4)) - 8.0 * dilog(1.0 / 2.0 + (1.0i / 2.0) * xd) - 8.0 * dilog((-1.0i) * xd) - 8.0 * dilog(1.0i * xd) + 4.0 * dilog(-(xd / wx3)) + 4.0 * dilog(xd / wx3) + 4.0 * dilog(-(xd / wx4))
                     + 4.0 * dilog(xd / wx4) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx3)) - 4.0 * dilog((-1.0i + xd) / (-1.0i + wx4)) - 8.0 * dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + xd)) - 4.0 * dilog((1.0i + xd) / (1.0i - wx3)) - 4.0 * dilog((1.0i + xd) / (1.0i + wx3))
                     - 4.0 * dilog((1.0i + xd) / (1.0i - wx4)) - 4.0 * dilog((1.0i + xd) / (1.0i + wx4)) - 8.0 * dilog((1.0 - yd) / 2.0) - 8.0 * dilog((w4 - yd) / (1.0 + w4)) - 8.0 * dilog((w5 - yd) / (-1.0 + w5)) + 8.0 * dilog((w7 - yd) / (1.0 + w7)) + 8.0 * dilog(-yd)
@@ -948,10 +948,10 @@ namespace eos
                     - 4.0 * log((wx3 + xd) / (1.0i + wx3)) - 4.0 * log((wx4 + xd) / (1.0i + wx4))) + log(xd) * (4.0 * log((wx3 + xd) / wx3) + 4.0 * log((wx4 + xd) / wx4) + 4.0 * log(1.0 - xd / wx3) + 4.0 * log(1.0 - xd / wx4)) + 8.0 * ln2 * ln1myd
                     + 8.0 * ln2 * ln1pyd - 8.0 * log((1.0 - yd) / (1.0 + w4)) * log((w4 + yd) / w4) - 8.0 * log((1.0 + yd) / (1.0 - w5)) * log((w5 + yd) / w5) + 8.0 * log((1.0 - yd) / (1.0 + w7)) * log((w7 + yd) / w7)
                     - 8.0 * log((1.0 + yd) / (1.0 + w4)) * log(1.0 - yd / w4) - 8.0 * log((-1.0 + yd) / (-1.0 + w5)) * log(1.0 - yd / w5) + 8.0 * log((1.0 + yd) / (1.0 + w7)) * log(1.0 - yd / w7)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx3) * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx3) * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
-                    - (8.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx4) * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx4) * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 + 1.0i * wx4)
+                    - (8.0 * 1.0i) * M_PI * c_ln_7 * my_sign(-real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx3) - (8.0 * 1.0i) * M_PI * c_ln_8 * my_sign(real(wx3inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx3)
+                    - (8.0 * 1.0i) * M_PI * c_ln_9 * my_sign(-real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - 1.0i * wx4) - (8.0 * 1.0i) * M_PI * c_ln_10 * my_sign(real(wx4inv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx4)
                     - (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, (w4 + yd) / w4, 1.0 + w4inv) - (16.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, (w5 + yd) / w5, (-1.0 + w5) / w5)
                     + (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, (w7 + yd) / w7, 1.0 + w7inv) - (16.0 * 1.0i) * M_PI * log(1.0 + w4inv) * my_sign(-imag(w4)) * T(1.0, 1.0 - yd / w4, 1.0 + w4inv)
                     - (16.0 * 1.0i) * M_PI * log((-1.0 + w5) / w5) * my_sign(imag(w5)) * T(1.0, 1.0 - yd / w5, (-1.0 + w5) / w5) + (16.0 * 1.0i) * M_PI * log(1.0 + w7inv) * my_sign(-imag(w7)) * T(1.0, 1.0 - yd / w7, 1.0 + w7inv))
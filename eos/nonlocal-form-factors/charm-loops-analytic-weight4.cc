@@ -64,46 +64,107 @@ namespace eos
             const complex<double> ln1pyd = log(1.0 + yd);
             const complex<double> ln1myd = log(1.0 - yd);
 
+            // hoisted common subexpressions: the transcendental calls below are
+            // opaque to the compiler, and each right-hand side recurs many times
+            // in the generated sums
+            const complex<double> li2_1 = dilog((1.0 - yd) / 2.0);
+            const complex<double> li2_2 = dilog(-yd);
+            const complex<double> li2_3 = dilog(yd);
+            const complex<double> li2_4 = dilog((1.0 + yd) / 2.0);
+            const complex<double> li4_1 = quadlog(2.0);
+            const complex<double> li4_2 = quadlog(1.0 - 1.0i * xd);
+            const complex<double> li4_3 = quadlog(1.0 + 1.0i * xd);
+            const complex<double> li4_4 = quadlog(1.0 - yd);
+            const complex<double> li4_5 = quadlog(1.0 + yd);
+            const complex<double> ln_1 = log(0.5 - (1.0i / 2.0) * xd);
+            const complex<double> ln_2 = log(1.0 - 1.0i * xd);
+            const complex<double> ln_3 = log((1.0 + 1.0i * xd) / 2.0);
+            const complex<double> ln_4 = log(1.0 + 1.0i * xd);
+            const complex<double> li2_5 = dilog(0.5 - (1.0i / 2.0) * xd);
+            const complex<double> ln_5 = log(xd);
+            const complex<double> ln_6 = log((-1.0i) * xd);
+            const complex<double> ln_7 = log(1.0i * xd);
+            const complex<double> li3_1 = trilog(-1.0i / (-1.0i + xd));
+            const complex<double> li3_2 = trilog((-1.0i + xd) / (2.0 * xd));
+            const complex<double> li3_3 = trilog(1.0i / (1.0i + xd));
+            const complex<double> li3_4 = trilog((-1.0i + xd) / (1.0i + xd));
+            const complex<double> li3_5 = trilog((1.0i + xd) / (2.0 * xd));
+            const complex<double> li3_6 = trilog((1.0i + xd) / (-1.0i + xd));
+            const complex<double> li2_6 = dilog((1.0i + xd) / (2.0 * xd));
+            const complex<double> li2_7 = dilog((1.0i + xd) / (-1.0i + xd));
+            const complex<double> li2_8 = dilog((-1.0i + xd) / (2.0 * xd));
+            const complex<double> li2_9 = dilog((-1.0i + xd) / (1.0i + xd));
+            const complex<double> li3_7 = trilog(1.0 - 1.0i * xd);
+            const complex<double> li3_8 = trilog(1.0 + 1.0i * xd);
+            const complex<double> li3_9 = trilog((-1.0i) * xd);
+            const complex<double> li3_10 = trilog(1.0i * xd);
+            const complex<double> li2_10 = dilog(1.0 - 1.0i * xd);
+            const complex<double> li2_11 = dilog(1.0i * xd);
+            const complex<double> li2_12 = dilog(1.0 + 1.0i * xd);
+            const complex<double> li2_13 = dilog((-1.0i) * xd);
+            const complex<double> li2_14 = dilog((1.0 + 1.0i * xd) / 2.0);
+            const complex<double> ln_8 = log((2.0 * 1.0i) / (1.0i + xd));
+            const complex<double> ln_9 = log((1.0 - yd) / 2.0);
+            const complex<double> li3_11 = trilog(1.0 - yd);
+            const complex<double> li2_15 = dilog(1.0 - yd);
+            const complex<double> ln_10 = log(-yd);
+            const complex<double> ln_11 = log(yd);
+            const complex<double> ln_12 = log((1.0 + yd) / 2.0);
+            const complex<double> li3_12 = trilog(yd);
+            const complex<double> li3_13 = trilog((1.0 - yd) / 2.0);
+            const complex<double> li3_14 = trilog(1.0 + yd);
+            const complex<double> li2_16 = dilog(1.0 + yd);
+            const complex<double> li3_15 = trilog((1.0 + yd) / 2.0);
+            const complex<double> li3_16 = trilog(-yd);
+            const complex<double> li2_17 = dilog(2.0);
+            const complex<double> ln_13 = log(1.0);
+            const complex<double> ln_14 = log(-ydinv);
+            const complex<double> ln_15 = log(ydinv);
+            const complex<double> ln_16 = log(-1.0i / xd);
+            const complex<double> ln_17 = log(1.0i / xd);
+            const complex<double> ln_18 = log(1.0 / (1.0 + yd));
+            const complex<double> ln_19 = log(2.0 / (1.0 + yd));
+
             // weight 4 GPLs
 
             // HPLs from F27(9)d that are free from problematic HeavisideTheta(0)
-            const complex<double> w4Part1 = (-2.0 * power_of<4>(M_PI)) / 3.0 + 3.0 * power_of<2>(li2half) + (3.0 * power_of<2>(dilog((1.0 - yd) / 2.0))) / 2.0 + (9.0 * power_of<2>(dilog(-yd))) / 2.0 + (9.0 * power_of<2>(dilog(yd))) / 2.0 + (3.0 * power_of<2>(dilog((1.0 + yd) / 2.0))) / 2.0 - 6.0 * quadlog(-1.0) + 18.0 * quadlog(0.5) - 6.0 * quadlog(2.0)
-                + 8.0 * quadlog(0.5 - (1.0i / 2.0) * xd) + 24.0 * quadlog(1.0 - 1.0i * xd) + 8.0 * quadlog(1.0 / (1.0 + 1.0i * xd)) + 8.0 * quadlog(2.0 / (1.0 + 1.0i * xd)) + 8.0 * quadlog((1.0 + 1.0i * xd) / 2.0) + 24.0 * quadlog(1.0 + 1.0i * xd) + 8.0 * quadlog((-1.0i) * xd) + 8.0 * quadlog(1.0i * xd)
+            const complex<double> w4Part1 = (-2.0 * power_of<4>(M_PI)) / 3.0 + 3.0 * power_of<2>(li2half) + (3.0 * power_of<2>(li2_1)) / 2.0 + (9.0 * power_of<2>(li2_2)) / 2.0 + (9.0 * power_of<2>(li2_3)) / 2.0 + (3.0 * power_of<2>(li2_4)) / 2.0 - 6.0 * quadlog(-1.0) + 18.0 * quadlog(0.5) - 6.0 * li4_1
+                + 8.0 * quadlog(0.5 - (1.0i / 2.0) * xd) + 24.0 * li4_2 + 8.0 * quadlog(1.0 / (1.0 + 1.0i * xd)) + 8.0 * quadlog(2.0 / (1.0 + 1.0i * xd)) + 8.0 * quadlog((1.0 + 1.0i * xd) / 2.0) + 24.0 * li4_3 + 8.0 * quadlog((-1.0i) * xd) + 8.0 * quadlog(1.0i * xd)
                 + 16.0 * quadlog(-1.0i / (-1.0i + xd)) + 24.0 * quadlog(xd / (-1.0i + xd)) + 24.0 * quadlog(1.0i / (1.0i + xd)) + 8.0 * quadlog((2.0 * 1.0i) / (1.0i + xd)) + 24.0 * quadlog(xd / (1.0i + xd)) + 8.0 * quadlog((-1.0i + xd) / (1.0i + xd)) + 8.0 * quadlog((1.0i + xd) / (-1.0i + xd))
-                - 3.0 * quadlog(1.0 / (1.0 - yd)) - 17.0 * quadlog((1.0 - yd) / 2.0) - 15.0 * quadlog(1.0 - yd) - 5.0 * quadlog(-2.0 / (-1.0 + yd)) - 2.0 * quadlog(-yd) - 2.0 * quadlog(yd) - 3.0 * quadlog(yd / (-1.0 + yd)) - 3.0 * quadlog(1.0 / (1.0 + yd)) - 5.0 * quadlog(2.0 / (1.0 + yd))
-                - 5.0 * quadlog((-1.0 + yd) / (1.0 + yd)) - 3.0 * quadlog(yd / (1.0 + yd)) - 17.0 * quadlog((1.0 + yd) / 2.0) - 15.0 * quadlog(1.0 + yd) - 5.0 * quadlog((1.0 + yd) / (-1.0 + yd)) - 4.0 * li22(-1.0, (-1.0i) * xd) - 4.0 * li22(-1.0, 1.0i * xd) - li22(-1.0, -yd) / 2.0
+                - 3.0 * quadlog(1.0 / (1.0 - yd)) - 17.0 * quadlog((1.0 - yd) / 2.0) - 15.0 * li4_4 - 5.0 * quadlog(-2.0 / (-1.0 + yd)) - 2.0 * quadlog(-yd) - 2.0 * quadlog(yd) - 3.0 * quadlog(yd / (-1.0 + yd)) - 3.0 * quadlog(1.0 / (1.0 + yd)) - 5.0 * quadlog(2.0 / (1.0 + yd))
+                - 5.0 * quadlog((-1.0 + yd) / (1.0 + yd)) - 3.0 * quadlog(yd / (1.0 + yd)) - 17.0 * quadlog((1.0 + yd) / 2.0) - 15.0 * li4_5 - 5.0 * quadlog((1.0 + yd) / (-1.0 + yd)) - 4.0 * li22(-1.0, (-1.0i) * xd) - 4.0 * li22(-1.0, 1.0i * xd) - li22(-1.0, -yd) / 2.0
                 - li22(-1.0, yd) / 2.0 - 16.0 * li22((-1.0i) * xd, -1.0) + 4.0 * li22((-1.0i) * xd, -1.0i / xd) - 16.0 * li22(1.0i * xd, -1.0) + 4.0 * li22(1.0i * xd, 1.0i / xd) - 2.0 * li22(-yd, -1.0) + li22(-yd, ydinv) / 2.0 - 2.0 * li22(yd, -1.0) + li22(yd, -ydinv) / 2.0
-                + (pisqu * power_of<2>(lnhalf)) / 2.0 + lnmhalf * power_of<3>(lnhalf) - power_of<4>(lnhalf) / 2.0 - (4.0 * log(-0.5 - (1.0i / 2.0) * xd) * power_of<3>(log(0.5 - (1.0i / 2.0) * xd))) / 3.0 + (2.0 * power_of<4>(log(0.5 - (1.0i / 2.0) * xd))) / 3.0 + (7.0 * power_of<4>(log(1.0 - 1.0i * xd))) / 3.0
-                - (2.0 * pisqu * power_of<2>(log((1.0 + 1.0i * xd) / 2.0))) / 3.0 + (2.0 * power_of<4>(log((1.0 + 1.0i * xd) / 2.0))) / 3.0 + (4.0 * log(1.0 - 1.0i * xd) * power_of<3>(log(1.0 + 1.0i * xd))) / 3.0 + (7.0 * power_of<4>(log(1.0 + 1.0i * xd))) / 3.0
-                + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * ((-2.0 * pisqu) / 3.0 - 4.0 * log((1.0 + 1.0i * xd) / 2.0) * log(1.0 + 1.0i * xd) - 2.0 * power_of<2>(log(1.0 + 1.0i * xd)))
-                + dilog(0.5 - (1.0i / 2.0) * xd) * (-8.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) + log(1.0 - 1.0i * xd) * (-8.0 * log((1.0 + 1.0i * xd) / 2.0) + 8.0 * log(1.0 + 1.0i * xd) - 8.0 * log(xd)))
-                + power_of<3>(log(1.0 + 1.0i * xd)) * (-4.0 * log((-1.0i) * xd) - 4.0 * log(1.0i * xd) - (4.0 * log(xd)) / 3.0) + power_of<3>(log(1.0 - 1.0i * xd)) * ((4.0 * log(1.0 + 1.0i * xd)) / 3.0 - 4.0 * log((-1.0i) * xd) - 4.0 * log(1.0i * xd) - (4.0 * log(xd)) / 3.0) - 16.0 * trilog(-1.0) * log(xd)
-                + 8.0 * trilog(0.5 + (1.0i / 2.0) * xd) * log(xd) + 8.0 * trilog(-1.0i / (-1.0i + xd)) * log(xd) - 8.0 * trilog((-1.0i + xd) / (2.0 * xd)) * log(xd) + 8.0 * trilog(1.0i / (1.0i + xd)) * log(xd) - 8.0 * trilog((1.0i - xd) / (1.0i + xd)) * log(xd)
-                + 8.0 * trilog((-1.0i + xd) / (1.0i + xd)) * log(xd) + 8.0 * trilog(((-0.5) * 1.0i) * (1.0i + xd)) * log(xd) - 8.0 * trilog((1.0i + xd) / (1.0i - xd)) * log(xd) - 8.0 * trilog((1.0i + xd) / (2.0 * xd)) * log(xd)
-                + 8.0 * trilog((1.0i + xd) / (-1.0i + xd)) * log(xd) + 8.0 * dilog((1.0i + xd) / (1.0i - xd)) * log(1.0 - 1.0i * xd) * log(xd) + 8.0 * dilog((1.0i + xd) / (2.0 * xd)) * log(1.0 - 1.0i * xd) * log(xd)
-                - 8.0 * dilog((1.0i + xd) / (-1.0i + xd)) * log(1.0 - 1.0i * xd) * log(xd) + 8.0 * dilog((-1.0i + xd) / (2.0 * xd)) * log(1.0 + 1.0i * xd) * log(xd) + 8.0 * dilog((1.0i - xd) / (1.0i + xd)) * log(1.0 + 1.0i * xd) * log(xd)
-                - 8.0 * dilog((-1.0i + xd) / (1.0i + xd)) * log(1.0 + 1.0i * xd) * log(xd) + trilog(1.0 - 1.0i * xd) * (-8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(xd)) + trilog(1.0 + 1.0i * xd) * (-8.0 * log(1.0 + 1.0i * xd) + 8.0 * log(xd))
-                + trilog((-1.0i) * xd) * (16.0 * log(1.0 - 1.0i * xd) - 8.0 * log(1.0 + 1.0i * xd) + 8.0 * log(xd)) + trilog(1.0i * xd) * (-8.0 * log(1.0 - 1.0i * xd) + 16.0 * log(1.0 + 1.0i * xd) + 8.0 * log(xd))
-                + dilog(1.0 - 1.0i * xd) * (-4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 8.0 * log(1.0 - 1.0i * xd) * log(xd)) + dilog(1.0i * xd) * (-4.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 8.0 * log(1.0 - 1.0i * xd) * log(xd))
-                + dilog(1.0 + 1.0i * xd) * (-4.0 * power_of<2>(log(1.0 + 1.0i * xd)) - 8.0 * log(1.0 + 1.0i * xd) * log(xd)) + dilog((-1.0i) * xd) * (16.0 * dilog(1.0i * xd) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) - 8.0 * log(1.0 + 1.0i * xd) * log(xd))
-                + dilog((1.0 + 1.0i * xd) / 2.0) * (-8.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) + log(1.0 - 1.0i * xd) * (-8.0 * log((1.0 + 1.0i * xd) / 2.0) + 8.0 * log(1.0 + 1.0i * xd)) - 8.0 * log(1.0 + 1.0i * xd) * log(xd))
-                + dilog(-1.0) * (-4.0 * dilog((-1.0i) * xd) - 4.0 * dilog(1.0i * xd) - dilog(-yd) / 2.0 - dilog(yd) / 2.0 - 8.0 * log(1.0 - 1.0i * xd) * log(xd) - 8.0 * log(1.0 + 1.0i * xd) * log(xd))
-                + power_of<2>(log(1.0 - 1.0i * xd)) * (-2.0 * pisqu - 2.0 * power_of<2>(log((1.0 + 1.0i * xd) / 2.0)) + log((1.0 + 1.0i * xd) / 2.0) * (4.0 * log(1.0 + 1.0i * xd) - 4.0 * log(xd)) - 4.0 * log(1.0i * xd) * log(xd)
-                + log(xd) * (-4.0 * log((-2.0 * 1.0i) / (-1.0i + xd)) + 4.0 * log((2.0 * xd) / (-1.0i + xd)) + 4.0 * log((-1.0i + xd) / (2.0 * xd)))) - (4.0 * power_of<3>(log((1.0 + 1.0i * xd) / 2.0)) * log((1.0i / 2.0) * (1.0i + xd))) / 3.0
-                + power_of<2>(log(1.0 + 1.0i * xd)) * (-2.0 * pisqu - 4.0 * log((-1.0i) * xd) * log(xd) + log(xd) * (-4.0 * log((2.0 * 1.0i) / (1.0i + xd)) + 4.0 * log((2.0 * xd) / (1.0i + xd)) + 4.0 * log((1.0i + xd) / (2.0 * xd)))) + (5.0 * log((-1.0 - yd) / 2.0) * power_of<3>(log((1.0 - yd) / 2.0))) / 6.0
-                - (5.0 * power_of<4>(log((1.0 - yd) / 2.0))) / 12.0 + 12.0 * trilog(1.0 - yd) * ln1myd - (9.0 * dilog(1.0 - yd) * power_of<2>(ln1myd)) / 2.0 - (dilog(yd) * power_of<2>(ln1myd)) / 2.0 - power_of<4>(ln1myd) / 4.0
-                + power_of<3>(ln1myd) * (log(-yd) / 2.0 - log(yd) + log((1.0 + yd) / 2.0) / 2.0) + (5.0 * pisqu * power_of<2>(log((1.0 + yd) / 2.0))) / 12.0 + (5.0 * log((-1.0 + yd) / 2.0) * power_of<3>(log((1.0 + yd) / 2.0))) / 6.0 - (5.0 * power_of<4>(log((1.0 + yd) / 2.0))) / 12.0
-                + trilog(yd) * (10.0 * ln1myd - 7.0 * ln1pyd) + trilog((1.0 - yd) / 2.0) * (2.0 * ln1myd - 2.0 * ln1pyd) + 12.0 * trilog(1.0 + yd) * ln1pyd + (pisqu * power_of<2>(ln1pyd)) / 4.0
-                - (9.0 * dilog(1.0 + yd) * power_of<2>(ln1pyd)) / 2.0 - log(-yd) * power_of<3>(ln1pyd) + (log(yd) * power_of<3>(ln1pyd)) / 2.0 - power_of<4>(ln1pyd) / 4.0 + trilog((1.0 + yd) / 2.0) * (-2.0 * ln1myd + 2.0 * ln1pyd)
-                + li3half * (6.0 * lnhalf - 8.0 * log(0.5 - (1.0i / 2.0) * xd) + 8.0 * log(1.0 - 1.0i * xd) - 8.0 * log((1.0 + 1.0i * xd) / 2.0) + 8.0 * log(1.0 + 1.0i * xd) - 16.0 * log(xd) + 5.0 * log((1.0 - yd) / 2.0) + 7.0 * ln1myd + 5.0 * log((1.0 + yd) / 2.0)
-                + 7.0 * ln1pyd) + trilog(-yd) * (-7.0 * ln1myd + 10.0 * ln1pyd) + dilog((1.0 - yd) / 2.0) * ((3.0 * power_of<2>(ln1myd)) / 2.0 + ln1myd * (8.0 * log((1.0 + yd) / 2.0) - 3.0 * ln1pyd)
-                + 5.0 * log((1.0 - yd) / 2.0) * ln1pyd) + power_of<2>(ln1myd) * (pisqu / 4.0 + (11.0 * power_of<2>(log((1.0 + yd) / 2.0))) / 4.0 - (3.0 * log((1.0 + yd) / 2.0) * ln1pyd) / 2.0) + dilog(-yd) * (-7.0 * dilog(yd) - power_of<2>(ln1pyd) / 2.0)
-                + dilog((1.0 + yd) / 2.0) * (ln1myd * (5.0 * log((1.0 + yd) / 2.0) - 3.0 * ln1pyd) + 8.0 * log((1.0 - yd) / 2.0) * ln1pyd + (3.0 * power_of<2>(ln1pyd)) / 2.0)
-                + li2half * (-3.0 * dilog((1.0 - yd) / 2.0) - 3.0 * dilog((1.0 + yd) / 2.0) + (5.0 * power_of<2>(ln1myd)) / 2.0 - 3.0 * ln1myd * log((1.0 + yd) / 2.0) - 3.0 * log((1.0 - yd) / 2.0) * ln1pyd + (5.0 * power_of<2>(ln1pyd)) / 2.0)
-                + power_of<2>(log((1.0 - yd) / 2.0)) * ((5.0 * pisqu) / 12.0 + (5.0 * log((1.0 + yd) / 2.0) * ln1pyd) / 2.0 + (11.0 * power_of<2>(ln1pyd)) / 4.0) + log(xd) * ((-4.0 * pisqu * log(((-0.5) * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log(((-0.5) * 1.0i) * xdinv))) / 3.0
+                + (pisqu * power_of<2>(lnhalf)) / 2.0 + lnmhalf * power_of<3>(lnhalf) - power_of<4>(lnhalf) / 2.0 - (4.0 * log(-0.5 - (1.0i / 2.0) * xd) * power_of<3>(ln_1)) / 3.0 + (2.0 * power_of<4>(ln_1)) / 3.0 + (7.0 * power_of<4>(ln_2)) / 3.0
+                - (2.0 * pisqu * power_of<2>(ln_3)) / 3.0 + (2.0 * power_of<4>(ln_3)) / 3.0 + (4.0 * ln_2 * power_of<3>(ln_4)) / 3.0 + (7.0 * power_of<4>(ln_4)) / 3.0
+                + power_of<2>(ln_1) * ((-2.0 * pisqu) / 3.0 - 4.0 * ln_3 * ln_4 - 2.0 * power_of<2>(ln_4))
+                + li2_5 * (-8.0 * ln_1 * ln_4 + ln_2 * (-8.0 * ln_3 + 8.0 * ln_4 - 8.0 * ln_5))
+                + power_of<3>(ln_4) * (-4.0 * ln_6 - 4.0 * ln_7 - (4.0 * ln_5) / 3.0) + power_of<3>(ln_2) * ((4.0 * ln_4) / 3.0 - 4.0 * ln_6 - 4.0 * ln_7 - (4.0 * ln_5) / 3.0) - 16.0 * trilog(-1.0) * ln_5
+                + 8.0 * trilog(0.5 + (1.0i / 2.0) * xd) * ln_5 + 8.0 * li3_1 * ln_5 - 8.0 * li3_2 * ln_5 + 8.0 * li3_3 * ln_5 - 8.0 * trilog((1.0i - xd) / (1.0i + xd)) * ln_5
+                + 8.0 * li3_4 * ln_5 + 8.0 * trilog(((-0.5) * 1.0i) * (1.0i + xd)) * ln_5 - 8.0 * trilog((1.0i + xd) / (1.0i - xd)) * ln_5 - 8.0 * li3_5 * ln_5
+                + 8.0 * li3_6 * ln_5 + 8.0 * dilog((1.0i + xd) / (1.0i - xd)) * ln_2 * ln_5 + 8.0 * li2_6 * ln_2 * ln_5
+                - 8.0 * li2_7 * ln_2 * ln_5 + 8.0 * li2_8 * ln_4 * ln_5 + 8.0 * dilog((1.0i - xd) / (1.0i + xd)) * ln_4 * ln_5
+                - 8.0 * li2_9 * ln_4 * ln_5 + li3_7 * (-8.0 * ln_2 + 8.0 * ln_5) + li3_8 * (-8.0 * ln_4 + 8.0 * ln_5)
+                + li3_9 * (16.0 * ln_2 - 8.0 * ln_4 + 8.0 * ln_5) + li3_10 * (-8.0 * ln_2 + 16.0 * ln_4 + 8.0 * ln_5)
+                + li2_10 * (-4.0 * power_of<2>(ln_2) - 8.0 * ln_2 * ln_5) + li2_11 * (-4.0 * power_of<2>(ln_2) - 8.0 * ln_2 * ln_5)
+                + li2_12 * (-4.0 * power_of<2>(ln_4) - 8.0 * ln_4 * ln_5) + li2_13 * (16.0 * li2_11 - 4.0 * power_of<2>(ln_4) - 8.0 * ln_4 * ln_5)
+                + li2_14 * (-8.0 * ln_1 * ln_4 + ln_2 * (-8.0 * ln_3 + 8.0 * ln_4) - 8.0 * ln_4 * ln_5)
+                + dilog(-1.0) * (-4.0 * li2_13 - 4.0 * li2_11 - li2_2 / 2.0 - li2_3 / 2.0 - 8.0 * ln_2 * ln_5 - 8.0 * ln_4 * ln_5)
+                + power_of<2>(ln_2) * (-2.0 * pisqu - 2.0 * power_of<2>(ln_3) + ln_3 * (4.0 * ln_4 - 4.0 * ln_5) - 4.0 * ln_7 * ln_5
+                + ln_5 * (-4.0 * log((-2.0 * 1.0i) / (-1.0i + xd)) + 4.0 * log((2.0 * xd) / (-1.0i + xd)) + 4.0 * log((-1.0i + xd) / (2.0 * xd)))) - (4.0 * power_of<3>(ln_3) * log((1.0i / 2.0) * (1.0i + xd))) / 3.0
+                + power_of<2>(ln_4) * (-2.0 * pisqu - 4.0 * ln_6 * ln_5 + ln_5 * (-4.0 * ln_8 + 4.0 * log((2.0 * xd) / (1.0i + xd)) + 4.0 * log((1.0i + xd) / (2.0 * xd)))) + (5.0 * log((-1.0 - yd) / 2.0) * power_of<3>(ln_9)) / 6.0
+                - (5.0 * power_of<4>(ln_9)) / 12.0 + 12.0 * li3_11 * ln1myd - (9.0 * li2_15 * power_of<2>(ln1myd)) / 2.0 - (li2_3 * power_of<2>(ln1myd)) / 2.0 - power_of<4>(ln1myd) / 4.0
+                + power_of<3>(ln1myd) * (ln_10 / 2.0 - ln_11 + ln_12 / 2.0) + (5.0 * pisqu * power_of<2>(ln_12)) / 12.0 + (5.0 * log((-1.0 + yd) / 2.0) * power_of<3>(ln_12)) / 6.0 - (5.0 * power_of<4>(ln_12)) / 12.0
+                + li3_12 * (10.0 * ln1myd - 7.0 * ln1pyd) + li3_13 * (2.0 * ln1myd - 2.0 * ln1pyd) + 12.0 * li3_14 * ln1pyd + (pisqu * power_of<2>(ln1pyd)) / 4.0
+                - (9.0 * li2_16 * power_of<2>(ln1pyd)) / 2.0 - ln_10 * power_of<3>(ln1pyd) + (ln_11 * power_of<3>(ln1pyd)) / 2.0 - power_of<4>(ln1pyd) / 4.0 + li3_15 * (-2.0 * ln1myd + 2.0 * ln1pyd)
+                + li3half * (6.0 * lnhalf - 8.0 * ln_1 + 8.0 * ln_2 - 8.0 * ln_3 + 8.0 * ln_4 - 16.0 * ln_5 + 5.0 * ln_9 + 7.0 * ln1myd + 5.0 * ln_12
+                + 7.0 * ln1pyd) + li3_16 * (-7.0 * ln1myd + 10.0 * ln1pyd) + li2_1 * ((3.0 * power_of<2>(ln1myd)) / 2.0 + ln1myd * (8.0 * ln_12 - 3.0 * ln1pyd)
+                + 5.0 * ln_9 * ln1pyd) + power_of<2>(ln1myd) * (pisqu / 4.0 + (11.0 * power_of<2>(ln_12)) / 4.0 - (3.0 * ln_12 * ln1pyd) / 2.0) + li2_2 * (-7.0 * li2_3 - power_of<2>(ln1pyd) / 2.0)
+                + li2_4 * (ln1myd * (5.0 * ln_12 - 3.0 * ln1pyd) + 8.0 * ln_9 * ln1pyd + (3.0 * power_of<2>(ln1pyd)) / 2.0)
+                + li2half * (-3.0 * li2_1 - 3.0 * li2_4 + (5.0 * power_of<2>(ln1myd)) / 2.0 - 3.0 * ln1myd * ln_12 - 3.0 * ln_9 * ln1pyd + (5.0 * power_of<2>(ln1pyd)) / 2.0)
+                + power_of<2>(ln_9) * ((5.0 * pisqu) / 12.0 + (5.0 * ln_12 * ln1pyd) / 2.0 + (11.0 * power_of<2>(ln1pyd)) / 4.0) + ln_5 * ((-4.0 * pisqu * log(((-0.5) * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log(((-0.5) * 1.0i) * xdinv))) / 3.0
                 - (4.0 * pisqu * log(1.0i / 2.0 * xdinv)) / 3.0 - (4.0 * power_of<3>(log(1.0i / 2.0 * xdinv))) / 3.0 + (4.0 * pisqu * log(-1.0i / (-1.0i + xd))) / 3.0 + (4.0 * power_of<3>(log(-1.0i / (-1.0i + xd)))) / 3.0 + (4.0 * pisqu * log(1.0i / (1.0i + xd))) / 3.0 + (4.0 * power_of<3>(log(1.0i / (1.0i + xd)))) / 3.0 - 16.0 * zeta3)
-                + log((1.0 - yd) / 2.0) * (power_of<3>(ln1pyd) / 2.0 + ln1myd * ((5.0 * power_of<2>(log((1.0 + yd) / 2.0))) / 2.0 - (3.0 * power_of<2>(ln1pyd)) / 2.0) - 5.0 * zeta3) - 6.0 * lnhalf * zeta3 + 8.0 * log((1.0 + 1.0i * xd) / 2.0) * zeta3 + 5.0 * ln1myd * zeta3
-                - 5.0 * log((1.0 + yd) / 2.0) * zeta3 + 5.0 * ln1pyd * zeta3 + log(0.5 - (1.0i / 2.0) * xd) * (log(1.0 - 1.0i * xd) * (-4.0 * power_of<2>(log((1.0 + 1.0i * xd) / 2.0)) + 4.0 * power_of<2>(log(1.0 + 1.0i * xd))) - 4.0 * power_of<2>(log(1.0 + 1.0i * xd)) * log(xd) + 8.0 * zeta3);
+                + ln_9 * (power_of<3>(ln1pyd) / 2.0 + ln1myd * ((5.0 * power_of<2>(ln_12)) / 2.0 - (3.0 * power_of<2>(ln1pyd)) / 2.0) - 5.0 * zeta3) - 6.0 * lnhalf * zeta3 + 8.0 * ln_3 * zeta3 + 5.0 * ln1myd * zeta3
+                - 5.0 * ln_12 * zeta3 + 5.0 * ln1pyd * zeta3 + ln_1 * (ln_2 * (-4.0 * power_of<2>(ln_3) + 4.0 * power_of<2>(ln_4)) - 4.0 * power_of<2>(ln_4) * ln_5 + 8.0 * zeta3);
 
             //GPLs form F27(9)d with at least one weight being +-wx3
             const complex<double> w4Part2 = weight4_wx3_wx4(clp, wx3) + weight4_wx3_wx4(clp, -wx3);
@@ -124,73 +185,97 @@ namespace eos
             // In order to make the expressions well defined, the replacement -a -> -a * (1 + i eta) was made
             const double eta = 1e-13;
 
-            const complex<double> w4HPLs = (-4.0 * power_of<4>(M_PI)) / 3.0 + 3.0 * power_of<2>(dilog(2.0)) - (3.0 * power_of<2>(dilog(1.0 / (2.0 - 1.0i * eta)))) / 2.0 - 9.0 * power_of<2>(dilog(2.0 - 1.0i * eta)) - (51.0 * power_of<2>(dilog(1.0i / (2.0 * 1.0i + eta)))) / 2.0 - 18.0 * quadlog(2.0) + 18.0 * quadlog(1.0 + 1.0 / (1.0 - 1.0i * eta)) - 3.0 * quadlog(1.0 / (2.0 - 1.0i * eta)) + 90.0 * quadlog(2.0 - 1.0i * eta) + 18.0 * quadlog(1.0 / (-1.0 + 1.0i * eta)) + 18.0 * quadlog(-1.0i / (1.0i + eta)) + 93.0 * quadlog(1.0i / (2.0 * 1.0i + eta)) + 18.0 * quadlog((2.0 * 1.0i + eta) / (1.0i + eta)) + 24.0 * quadlog(1.0 - 1.0i * xd) + 24.0 * quadlog(1.0 + 1.0i * xd) + 2.0 * quadlog(1.0 - yd) + 8.0 * quadlog((-1.0 + yd) / (-2.0 + 1.0i * eta)) + 2.0 * quadlog(1.0 + yd) + 8.0 * quadlog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))
+            // hoisted common subexpressions: the transcendental calls below are
+            // opaque to the compiler, and each right-hand side recurs many times
+            // in the generated sums
+            const complex<double> li2_18 = dilog(1.0 / (2.0 - 1.0i * eta));
+            const complex<double> li2_19 = dilog(2.0 - 1.0i * eta);
+            const complex<double> li2_20 = dilog(1.0i / (2.0 * 1.0i + eta));
+            const complex<double> ln_20 = log(-1.0 + 1.0i * eta);
+            const complex<double> ln_21 = log((1.0i + eta) / (2.0 * 1.0i + eta));
+            const complex<double> ln_22 = log(-1.0i / (2.0 * 1.0i + eta));
+            const complex<double> ln_23 = log((1.0i + eta - xd) / (1.0i + eta));
+            const complex<double> ln_24 = log((1.0i + eta - xd) / (2.0 * 1.0i + eta));
+            const complex<double> ln_25 = log((1.0i + eta + xd) / (1.0i + eta));
+            const complex<double> ln_26 = log((1.0i + eta + xd) / (2.0 * 1.0i + eta));
+            const complex<double> li2_21 = dilog((-1.0 + yd) / (-2.0 + 1.0i * eta));
+            const complex<double> li2_22 = dilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta));
+            const complex<double> ln_27 = log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta));
+            const complex<double> ln_28 = log(1.0 - (1.0i * yd) / (1.0i + eta));
+            const complex<double> ln_29 = log(1.0 + (1.0i * yd) / (1.0i + eta));
+            const complex<double> ln_30 = log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta));
+            const complex<double> ln_31 = log(2.0 - 1.0i * eta);
+            const complex<double> ln_32 = log((2.0 * 1.0i + eta) / (1.0i + xd));
+            const complex<double> ln_33 = log((1.0 - 1.0i * eta) / yd);
+            const complex<double> ln_34 = log((2.0 - 1.0i * eta) / (1.0 + yd));
+
+            const complex<double> w4HPLs = (-4.0 * power_of<4>(M_PI)) / 3.0 + 3.0 * power_of<2>(li2_17) - (3.0 * power_of<2>(li2_18)) / 2.0 - 9.0 * power_of<2>(li2_19) - (51.0 * power_of<2>(li2_20)) / 2.0 - 18.0 * li4_1 + 18.0 * quadlog(1.0 + 1.0 / (1.0 - 1.0i * eta)) - 3.0 * quadlog(1.0 / (2.0 - 1.0i * eta)) + 90.0 * quadlog(2.0 - 1.0i * eta) + 18.0 * quadlog(1.0 / (-1.0 + 1.0i * eta)) + 18.0 * quadlog(-1.0i / (1.0i + eta)) + 93.0 * quadlog(1.0i / (2.0 * 1.0i + eta)) + 18.0 * quadlog((2.0 * 1.0i + eta) / (1.0i + eta)) + 24.0 * li4_2 + 24.0 * li4_3 + 2.0 * li4_4 + 8.0 * quadlog((-1.0 + yd) / (-2.0 + 1.0i * eta)) + 2.0 * li4_5 + 8.0 * quadlog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))
                 - 4.0 * li22(1.0 / (2.0 - 1.0i * eta), 1.0 + yd) - 12.0 * li22(2.0 - 1.0i * eta, (1.0i - xd) / (2.0 * 1.0i + eta)) - 12.0 * li22(2.0 - 1.0i * eta, (1.0i + xd) / (2.0 * 1.0i + eta)) - li22(2.0 - 1.0i * eta, (-1.0 + yd) / (-2.0 + 1.0i * eta)) - li22(2.0 - 1.0i * eta, (1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) - 4.0 * li22(1.0i / (2.0 * 1.0i + eta), 1.0 - yd) - 20.0 * li22((1.0i - xd) / (2.0 * 1.0i + eta), 2.0 - 1.0i * eta) + 8.0 * li22(0.5 - (1.0i / 2.0) * xd, 2.0) - 12.0 * li22(1.0 - 1.0i * xd, 1.0i / (2.0 * 1.0i + eta)) + 12.0 * li22(1.0 - 1.0i * xd, (2.0 * 1.0i + eta) / (1.0i + xd)) + 8.0 * li22((1.0 + 1.0i * xd) / 2.0, 2.0) - 12.0 * li22(1.0 + 1.0i * xd, 1.0i / (2.0 * 1.0i + eta)) + 12.0 * li22(1.0 + 1.0i * xd, (2.0 * 1.0i + eta) / (1.0i - xd))
-                - 20.0 * li22((1.0i + xd) / (2.0 * 1.0i + eta), 2.0 - 1.0i * eta) - 5.0 * li22((1.0 - yd) / 2.0, 2.0) - 10.0 * li22(1.0 - yd, 1.0i / (2.0 * 1.0i + eta)) + li22(1.0 - yd, (1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) - 2.0 * li22((-1.0 + yd) / (-2.0 + 1.0i * eta), 2.0 - 1.0i * eta) + 4.0 * li22((-1.0 + yd) / (-2.0 + 1.0i * eta), 1.0 / (1.0 - yd)) - 5.0 * li22((1.0 + yd) / 2.0, 2.0) - 10.0 * li22(1.0 + yd, 1.0 / (2.0 - 1.0i * eta)) + li22(1.0 + yd, (2.0 - 1.0i * eta) / (1.0 + yd)) - 2.0 * li22((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), 2.0 - 1.0i * eta) + 4.0 * li22((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), 1.0 / (1.0 + yd)) + dilog(2.0) * (3.0 * pisqu + 3.0 * power_of<2>(lnm2)) + 3.0 * pisqu * power_of<2>(log(-1.0 + 1.0i * eta))
-                + 6.0 * log(-2.0 + 1.0i * eta) * power_of<3>(log(-1.0 + 1.0i * eta)) - 3.0 * power_of<4>(log(-1.0 + 1.0i * eta)) - 6.0 * pisqu * power_of<2>(log((1.0i + eta) / (2.0 * 1.0i + eta))) - 2.0 * log(1.0 / (-2.0 + 1.0i * eta)) * power_of<3>(log((1.0i + eta) / (2.0 * 1.0i + eta))) - 10.0 * log(-1.0i / (2.0 * 1.0i + eta)) * power_of<3>(log((1.0i + eta) / (2.0 * 1.0i + eta))) + 6.0 * power_of<4>(log((1.0i + eta) / (2.0 * 1.0i + eta))) + trilog(1.0 - 1.0i * xd) * (-24.0 * log(-1.0 + 1.0i * eta) - 8.0 * log((1.0i + eta - xd) / (1.0i + eta)) + 24.0 * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) - 24.0 * log(1.0 - 1.0i * xd)) + 12.0 * trilog((1.0i + eta) / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd) + 24.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd)
-                - 12.0 * trilog(1.0i * xd) * log(1.0 - 1.0i * xd) + 20.0 * trilog(xd / (1.0i + eta)) * log(1.0 - 1.0i * xd) - 24.0 * trilog((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd) + 8.0 * trilog((-1.0i + xd) / (2.0 * xd)) * log(1.0 - 1.0i * xd) + 4.0 * trilog(1.0i / (1.0i + xd)) * log(1.0 - 1.0i * xd) - 4.0 * trilog((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) * log(1.0 - 1.0i * xd) - 24.0 * trilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) * log(1.0 - 1.0i * xd) + 8.0 * trilog((-1.0i + xd) / (1.0i + xd)) * log(1.0 - 1.0i * xd) + 24.0 * trilog(xd / (-1.0i - eta + xd)) * log(1.0 - 1.0i * xd) + 12.0 * trilog((1.0i + xd) / (-1.0i - eta + xd)) * log(1.0 - 1.0i * xd)
-                + 4.0 * trilog((-1.0i - eta + xd) * xdinv) * log(1.0 - 1.0i * xd) - 4.0 * trilog((-1.0i - eta + xd) / (1.0i + xd)) * log(1.0 - 1.0i * xd) - 12.0 * trilog((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd) - 8.0 * trilog((1.0 - 1.0i * eta + 1.0i * xd) / ((2.0 * 1.0i) * xd + eta * xd)) * log(1.0 - 1.0i * xd) + 4.0 * pisqu * log(-1.0i / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd) + 4.0 * power_of<3>(log(-1.0i / (1.0i + eta - xd))) * log(1.0 - 1.0i * xd) + 4.0 * dilog(1.0i * xd) * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd) + 4.0 * dilog((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd)
-                + 8.0 * dilog((1.0 - 1.0i * eta + 1.0i * xd) / ((2.0 * 1.0i) * xd + eta * xd)) * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) * log(1.0 - 1.0i * xd) - 12.0 * dilog((1.0i + xd) / (-1.0i - eta + xd)) * power_of<2>(log(1.0 - 1.0i * xd)) + 12.0 * dilog((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) * power_of<2>(log(1.0 - 1.0i * xd)) + dilog((-1.0i - eta + xd) * xdinv) * (4.0 * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd) - 8.0 * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) * log(1.0 - 1.0i * xd)) + dilog((-1.0i - eta + xd) / (1.0i + xd)) * (-4.0 * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd) + 8.0 * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) * log(1.0 - 1.0i * xd))
-                - 8.0 * dilog((-1.0i + xd) / (2.0 * xd)) * log(1.0 - 1.0i * xd) * log((1.0 + 1.0i * xd) / 2.0) - 8.0 * dilog((-1.0i + xd) / (1.0i + xd)) * log(1.0 - 1.0i * xd) * log((1.0 + 1.0i * xd) / 2.0) + trilog((-1.0i + xd) * xdinv) * (-8.0 * log(1.0 - 1.0i * xd) - 12.0 * log(1.0 + 1.0i * xd)) + trilog((1.0i + xd) * xdinv) * (-12.0 * log(1.0 - 1.0i * xd) - 8.0 * log(1.0 + 1.0i * xd)) - 12.0 * trilog((-1.0i) * xd) * log(1.0 + 1.0i * xd) + 20.0 * trilog(-(xd / (1.0i + eta))) * log(1.0 + 1.0i * xd) + 4.0 * trilog(-1.0i / (-1.0i + xd)) * log(1.0 + 1.0i * xd) - 24.0 * trilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) * log(1.0 + 1.0i * xd) + 8.0 * trilog((1.0i + xd) / (2.0 * xd)) * log(1.0 + 1.0i * xd)
-                + 8.0 * trilog((1.0i + xd) / (-1.0i + xd)) * log(1.0 + 1.0i * xd) + 12.0 * trilog((1.0i + eta) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) + 24.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) - 12.0 * trilog(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) + 24.0 * trilog(xd / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) - 24.0 * trilog(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) + 12.0 * trilog((-1.0i + xd) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) + 4.0 * trilog((1.0i + eta + xd) * xdinv) * log(1.0 + 1.0i * xd) - 8.0 * trilog((1.0i * (1.0i + eta + xd)) / ((2.0 * 1.0i + eta) * xd)) * log(1.0 + 1.0i * xd)
-                - 4.0 * trilog((1.0i + eta + xd) / (-1.0i + xd)) * log(1.0 + 1.0i * xd) - 4.0 * trilog(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) * log(1.0 + 1.0i * xd) + (2.0 * pisqu * log((1.0i + eta) / (1.0i - xd)) * log(1.0 + 1.0i * xd)) / 3.0 + (2.0 * power_of<3>(log((1.0i + eta) / (1.0i - xd))) * log(1.0 + 1.0i * xd)) / 3.0 - 8.0 * dilog((1.0i + xd) / (2.0 * xd)) * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) - 8.0 * dilog((1.0i + xd) / (-1.0i + xd)) * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) + 12.0 * dilog(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) * power_of<2>(log(1.0 + 1.0i * xd)) - 12.0 * dilog((-1.0i + xd) / (1.0i + eta + xd)) * power_of<2>(log(1.0 + 1.0i * xd))
-                + dilog((1.0i + xd) * xdinv) * (12.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 8.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd)) + dilog((-1.0i + xd) * xdinv) * (8.0 * log(1.0 - 1.0i * xd) * log((1.0 + 1.0i * xd) / 2.0) + 12.0 * power_of<2>(log(1.0 + 1.0i * xd))) + trilog((1.0 + 1.0i * xd) / 2.0) * (8.0 * log(1.0 + 1.0i * xd) - 16.0 * log((-1.0i) * xd)) + 24.0 * dilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) * log(1.0 + 1.0i * xd) * log((-1.0i) * xd) - 24.0 * dilog(xd / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) * log((-1.0i) * xd) + 24.0 * dilog(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) * log(1.0 + 1.0i * xd) * log((-1.0i) * xd)
-                + trilog((1.0i - xd) / (2.0 * 1.0i + eta)) * (24.0 * log(-1.0 + 1.0i * eta) + 16.0 * log(1.0 + 1.0i * xd) + 16.0 * log((-1.0i) * xd)) + dilog(-(xd / (1.0i + eta))) * (-12.0 * power_of<2>(log(1.0 + 1.0i * xd)) - 24.0 * log(1.0 + 1.0i * xd) * log((-1.0i) * xd)) + trilog(0.5 - (1.0i / 2.0) * xd) * (8.0 * log(1.0 - 1.0i * xd) - 16.0 * log(1.0i * xd)) + 24.0 * dilog((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) * log(1.0 - 1.0i * xd) * log(1.0i * xd) + 24.0 * dilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) * log(1.0 - 1.0i * xd) * log(1.0i * xd) - 24.0 * dilog(xd / (-1.0i - eta + xd)) * log(1.0 - 1.0i * xd) * log(1.0i * xd)
-                + trilog((1.0i + xd) / (2.0 * 1.0i + eta)) * (24.0 * log(-1.0 + 1.0i * eta) + 16.0 * log(1.0 - 1.0i * xd) + 16.0 * log(1.0i * xd)) + dilog(xd / (1.0i + eta)) * (-12.0 * power_of<2>(log(1.0 - 1.0i * xd)) - 24.0 * log(1.0 - 1.0i * xd) * log(1.0i * xd)) + 4.0 * dilog((-1.0i) * xd) * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (1.0i + eta)) + 4.0 * dilog(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (1.0i + eta)) + dilog((1.0i + eta + xd) * xdinv) * log(1.0 + 1.0i * xd) * (4.0 * log((1.0i + eta + xd) / (1.0i + eta)) - 8.0 * log((1.0i + eta + xd) / (2.0 * 1.0i + eta)))
-                + 8.0 * dilog((1.0i * (1.0i + eta + xd)) / ((2.0 * 1.0i + eta) * xd)) * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (2.0 * 1.0i + eta)) + dilog((1.0i + eta + xd) / (-1.0i + xd)) * log(1.0 + 1.0i * xd) * (-4.0 * log((1.0i + eta + xd) / (1.0i + eta)) + 8.0 * log((1.0i + eta + xd) / (2.0 * 1.0i + eta))) + trilog(1.0 + 1.0i * xd) * (-24.0 * log(-1.0 + 1.0i * eta) - 24.0 * log(1.0 + 1.0i * xd) - 8.0 * log((1.0i + eta + xd) / (1.0i + eta)) + 24.0 * log((1.0i + eta + xd) / (2.0 * 1.0i + eta))) - (3.0 * trilog(1.0 / (-1.0 + 1.0i * eta)) * ln1myd) / 2.0 - 8.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta)) * ln1myd - (trilog(1.0 / (1.0 - yd)) * ln1myd) / 2.0
-                + 10.0 * trilog(ydinv) * ln1myd - 11.0 * trilog(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd - (15.0 * trilog(yd) * ln1myd) / 2.0 + (27.0 * trilog(yd / (-1.0 + 1.0i * eta)) * ln1myd) / 2.0 - 5.0 * trilog(yd / (-1.0 + yd)) * ln1myd - 2.0 * trilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * ln1myd - 5.0 * trilog((1.0 + yd) / (-1.0 + yd)) * ln1myd - 5.0 * trilog((1.0 + yd) / (2.0 * yd)) * ln1myd + (15.0 * trilog((-1.0 + yd) / (1.0 - 1.0i * eta + yd)) * ln1myd) / 2.0 + 7.0 * trilog(yd / (1.0 - 1.0i * eta + yd)) * ln1myd
+                - 20.0 * li22((1.0i + xd) / (2.0 * 1.0i + eta), 2.0 - 1.0i * eta) - 5.0 * li22((1.0 - yd) / 2.0, 2.0) - 10.0 * li22(1.0 - yd, 1.0i / (2.0 * 1.0i + eta)) + li22(1.0 - yd, (1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) - 2.0 * li22((-1.0 + yd) / (-2.0 + 1.0i * eta), 2.0 - 1.0i * eta) + 4.0 * li22((-1.0 + yd) / (-2.0 + 1.0i * eta), 1.0 / (1.0 - yd)) - 5.0 * li22((1.0 + yd) / 2.0, 2.0) - 10.0 * li22(1.0 + yd, 1.0 / (2.0 - 1.0i * eta)) + li22(1.0 + yd, (2.0 - 1.0i * eta) / (1.0 + yd)) - 2.0 * li22((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), 2.0 - 1.0i * eta) + 4.0 * li22((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), 1.0 / (1.0 + yd)) + li2_17 * (3.0 * pisqu + 3.0 * power_of<2>(lnm2)) + 3.0 * pisqu * power_of<2>(ln_20)
+                + 6.0 * log(-2.0 + 1.0i * eta) * power_of<3>(ln_20) - 3.0 * power_of<4>(ln_20) - 6.0 * pisqu * power_of<2>(ln_21) - 2.0 * log(1.0 / (-2.0 + 1.0i * eta)) * power_of<3>(ln_21) - 10.0 * ln_22 * power_of<3>(ln_21) + 6.0 * power_of<4>(ln_21) + li3_7 * (-24.0 * ln_20 - 8.0 * ln_23 + 24.0 * ln_24 - 24.0 * ln_2) + 12.0 * trilog((1.0i + eta) / (1.0i + eta - xd)) * ln_2 + 24.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta - xd)) * ln_2
+                - 12.0 * li3_10 * ln_2 + 20.0 * trilog(xd / (1.0i + eta)) * ln_2 - 24.0 * trilog((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) * ln_2 + 8.0 * li3_2 * ln_2 + 4.0 * li3_3 * ln_2 - 4.0 * trilog((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) * ln_2 - 24.0 * trilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) * ln_2 + 8.0 * li3_4 * ln_2 + 24.0 * trilog(xd / (-1.0i - eta + xd)) * ln_2 + 12.0 * trilog((1.0i + xd) / (-1.0i - eta + xd)) * ln_2
+                + 4.0 * trilog((-1.0i - eta + xd) * xdinv) * ln_2 - 4.0 * trilog((-1.0i - eta + xd) / (1.0i + xd)) * ln_2 - 12.0 * trilog((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) * ln_2 - 8.0 * trilog((1.0 - 1.0i * eta + 1.0i * xd) / ((2.0 * 1.0i) * xd + eta * xd)) * ln_2 + 4.0 * pisqu * log(-1.0i / (1.0i + eta - xd)) * ln_2 + 4.0 * power_of<3>(log(-1.0i / (1.0i + eta - xd))) * ln_2 + 4.0 * li2_11 * ln_23 * ln_2 + 4.0 * dilog((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) * ln_23 * ln_2
+                + 8.0 * dilog((1.0 - 1.0i * eta + 1.0i * xd) / ((2.0 * 1.0i) * xd + eta * xd)) * ln_24 * ln_2 - 12.0 * dilog((1.0i + xd) / (-1.0i - eta + xd)) * power_of<2>(ln_2) + 12.0 * dilog((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) * power_of<2>(ln_2) + dilog((-1.0i - eta + xd) * xdinv) * (4.0 * ln_23 * ln_2 - 8.0 * ln_24 * ln_2) + dilog((-1.0i - eta + xd) / (1.0i + xd)) * (-4.0 * ln_23 * ln_2 + 8.0 * ln_24 * ln_2)
+                - 8.0 * li2_8 * ln_2 * ln_3 - 8.0 * li2_9 * ln_2 * ln_3 + trilog((-1.0i + xd) * xdinv) * (-8.0 * ln_2 - 12.0 * ln_4) + trilog((1.0i + xd) * xdinv) * (-12.0 * ln_2 - 8.0 * ln_4) - 12.0 * li3_9 * ln_4 + 20.0 * trilog(-(xd / (1.0i + eta))) * ln_4 + 4.0 * li3_1 * ln_4 - 24.0 * trilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) * ln_4 + 8.0 * li3_5 * ln_4
+                + 8.0 * li3_6 * ln_4 + 12.0 * trilog((1.0i + eta) / (1.0i + eta + xd)) * ln_4 + 24.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta + xd)) * ln_4 - 12.0 * trilog(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) * ln_4 + 24.0 * trilog(xd / (1.0i + eta + xd)) * ln_4 - 24.0 * trilog(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) * ln_4 + 12.0 * trilog((-1.0i + xd) / (1.0i + eta + xd)) * ln_4 + 4.0 * trilog((1.0i + eta + xd) * xdinv) * ln_4 - 8.0 * trilog((1.0i * (1.0i + eta + xd)) / ((2.0 * 1.0i + eta) * xd)) * ln_4
+                - 4.0 * trilog((1.0i + eta + xd) / (-1.0i + xd)) * ln_4 - 4.0 * trilog(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) * ln_4 + (2.0 * pisqu * log((1.0i + eta) / (1.0i - xd)) * ln_4) / 3.0 + (2.0 * power_of<3>(log((1.0i + eta) / (1.0i - xd))) * ln_4) / 3.0 - 8.0 * li2_6 * ln_1 * ln_4 - 8.0 * li2_7 * ln_1 * ln_4 + 12.0 * dilog(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) * power_of<2>(ln_4) - 12.0 * dilog((-1.0i + xd) / (1.0i + eta + xd)) * power_of<2>(ln_4)
+                + dilog((1.0i + xd) * xdinv) * (12.0 * power_of<2>(ln_2) + 8.0 * ln_1 * ln_4) + dilog((-1.0i + xd) * xdinv) * (8.0 * ln_2 * ln_3 + 12.0 * power_of<2>(ln_4)) + trilog((1.0 + 1.0i * xd) / 2.0) * (8.0 * ln_4 - 16.0 * ln_6) + 24.0 * dilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) * ln_4 * ln_6 - 24.0 * dilog(xd / (1.0i + eta + xd)) * ln_4 * ln_6 + 24.0 * dilog(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) * ln_4 * ln_6
+                + trilog((1.0i - xd) / (2.0 * 1.0i + eta)) * (24.0 * ln_20 + 16.0 * ln_4 + 16.0 * ln_6) + dilog(-(xd / (1.0i + eta))) * (-12.0 * power_of<2>(ln_4) - 24.0 * ln_4 * ln_6) + trilog(0.5 - (1.0i / 2.0) * xd) * (8.0 * ln_2 - 16.0 * ln_7) + 24.0 * dilog((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) * ln_2 * ln_7 + 24.0 * dilog(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) * ln_2 * ln_7 - 24.0 * dilog(xd / (-1.0i - eta + xd)) * ln_2 * ln_7
+                + trilog((1.0i + xd) / (2.0 * 1.0i + eta)) * (24.0 * ln_20 + 16.0 * ln_2 + 16.0 * ln_7) + dilog(xd / (1.0i + eta)) * (-12.0 * power_of<2>(ln_2) - 24.0 * ln_2 * ln_7) + 4.0 * li2_13 * ln_4 * ln_25 + 4.0 * dilog(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) * ln_4 * ln_25 + dilog((1.0i + eta + xd) * xdinv) * ln_4 * (4.0 * ln_25 - 8.0 * ln_26)
+                + 8.0 * dilog((1.0i * (1.0i + eta + xd)) / ((2.0 * 1.0i + eta) * xd)) * ln_4 * ln_26 + dilog((1.0i + eta + xd) / (-1.0i + xd)) * ln_4 * (-4.0 * ln_25 + 8.0 * ln_26) + li3_8 * (-24.0 * ln_20 - 24.0 * ln_4 - 8.0 * ln_25 + 24.0 * ln_26) - (3.0 * trilog(1.0 / (-1.0 + 1.0i * eta)) * ln1myd) / 2.0 - 8.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta)) * ln1myd - (trilog(1.0 / (1.0 - yd)) * ln1myd) / 2.0
+                + 10.0 * trilog(ydinv) * ln1myd - 11.0 * trilog(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd - (15.0 * li3_12 * ln1myd) / 2.0 + (27.0 * trilog(yd / (-1.0 + 1.0i * eta)) * ln1myd) / 2.0 - 5.0 * trilog(yd / (-1.0 + yd)) * ln1myd - 2.0 * trilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * ln1myd - 5.0 * trilog((1.0 + yd) / (-1.0 + yd)) * ln1myd - 5.0 * trilog((1.0 + yd) / (2.0 * yd)) * ln1myd + (15.0 * trilog((-1.0 + yd) / (1.0 - 1.0i * eta + yd)) * ln1myd) / 2.0 + 7.0 * trilog(yd / (1.0 - 1.0i * eta + yd)) * ln1myd
                 + (5.0 * trilog((1.0 - 1.0i * eta + yd) / (-1.0 + yd)) * ln1myd) / 2.0 + (11.0 * trilog((1.0 - 1.0i * eta + yd) / yd) * ln1myd) / 2.0 + 8.0 * trilog(1.0 + (1.0i * yd) / (1.0i + eta)) * ln1myd + (15.0 * trilog((1.0i + eta) / (eta + 1.0i * (1.0 + yd))) * ln1myd) / 2.0 + 7.0 * trilog((2.0 * 1.0i + eta) / (eta + 1.0i * (1.0 + yd))) * ln1myd - (15.0 * trilog(-(((1.0i + eta) * (-1.0 + yd)) / (eta + 1.0i * (1.0 + yd)))) * ln1myd) / 2.0 - 7.0 * trilog(((2.0 * 1.0i + eta) * yd) / (eta + 1.0i * (1.0 + yd))) * ln1myd - (15.0 * trilog(-((eta + 1.0i * (1.0 + yd)) / ((1.0i + eta) * (-1.0 + yd)))) * ln1myd) / 2.0
-                - 5.0 * trilog((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd - (5.0 * power_of<3>(log(1.0 / (1.0 - yd))) * ln1myd) / 6.0 + (3.0 * dilog(1.0 / (-1.0 + 1.0i * eta)) * power_of<2>(ln1myd)) / 2.0 + 4.0 * dilog((2.0 * 1.0i + eta) / (1.0i + eta)) * power_of<2>(ln1myd) + 11.0 * dilog(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * power_of<2>(ln1myd) - (15.0 * dilog((-1.0 + yd) / (1.0 - 1.0i * eta + yd)) * power_of<2>(ln1myd)) / 2.0 + (15.0 * dilog(-(((1.0i + eta) * (-1.0 + yd)) / (eta + 1.0i * (1.0 + yd)))) * power_of<2>(ln1myd)) / 2.0 + dilog((-1.0 + yd) / (-2.0 + 1.0i * eta)) * ((-5.0 * pisqu) / 6.0 + 11.0 * dilog(yd) - 11.0 * power_of<2>(ln1myd))
-                + 5.0 * dilog(yd / (-1.0 + yd)) * ln1myd * log(yd) + 2.0 * dilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * ln1myd * log(yd) - 7.0 * dilog(yd / (1.0 - 1.0i * eta + yd)) * ln1myd * log(yd) + 7.0 * dilog(((2.0 * 1.0i + eta) * yd) / (eta + 1.0i * (1.0 + yd))) * ln1myd * log(yd) + trilog((-1.0 + yd) / (-2.0 + 1.0i * eta)) * (2.0 * log(-1.0 + 1.0i * eta) - 8.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) + 8.0 * ln1myd + 2.0 * log(yd)) + trilog((1.0 - yd) / 2.0) * (-5.0 * ln1myd + 10.0 * log(yd))
-                + dilog(1.0i / (2.0 * 1.0i + eta)) * ((-29.0 * pisqu) / 3.0 - 8.0 * dilog(1.0 - 1.0i * xd) - 8.0 * dilog(1.0 + 1.0i * xd) + 3.0 * dilog(1.0 - yd) - 4.0 * dilog((-1.0 + yd) / (-2.0 + 1.0i * eta)) - 11.0 * dilog(-yd) + (3.0 * power_of<2>(log(1.0 / (-2.0 + 1.0i * eta)))) / 2.0 - 12.0 * power_of<2>(log(-1.0i / (2.0 * 1.0i + eta))) + (8.0 * log(1.0) - 16.0 * log(1.0 + 1.0i * xd)) * log((-1.0i) * xd) + (8.0 * log(1.0) - 16.0 * log(1.0 - 1.0i * xd)) * log(1.0i * xd) + (5.0 * log(1.0) - 2.0 * ln1myd) * log(yd)) + dilog(yd / (-1.0 + 1.0i * eta)) * (-power_of<2>(ln1myd) - 2.0 * ln1myd * log(yd)) + log(1.0 / (1.0 - yd)) * ln1myd * ((-5.0 * pisqu) / 6.0 + (5.0 * power_of<2>(log(yd))) / 2.0)
-                + 5.0 * dilog((1.0 + yd) / (-1.0 + yd)) * ln1myd * log((1.0 + yd) / 2.0) + 5.0 * dilog((1.0 + yd) / (2.0 * yd)) * ln1myd * log((1.0 + yd) / 2.0) + dilog(1.0 / (2.0 - 1.0i * eta)) * ((7.0 * pisqu) / 3.0 - 11.0 * dilog(yd) + 3.0 * dilog(1.0 + yd) - 4.0 * dilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) + (3.0 * power_of<2>(log(-1.0i / (2.0 * 1.0i + eta)))) / 2.0 + log(-yd) * (5.0 * log(1.0) - 2.0 * ln1pyd)) + trilog(1.0i / (2.0 * 1.0i + eta)) * (-42.0 * log(-1.0 + 1.0i * eta) - 60.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) - 8.0 * log(1.0 - 1.0i * xd) - 8.0 * log(1.0 + 1.0i * xd) - 16.0 * log((-1.0i) * xd) - 16.0 * log(1.0i * xd) - 5.0 * ln1myd - 2.0 * log(yd) - 11.0 * ln1pyd)
-                + trilog(-1.0 + 1.0i * eta) * (-12.0 * log(1.0 - 1.0i * xd) - 12.0 * log(1.0 + 1.0i * xd) - (15.0 * ln1myd) / 2.0 - (15.0 * ln1pyd) / 2.0) + trilog(1.0 / (2.0 - 1.0i * eta)) * (6.0 * log(-1.0 + 1.0i * eta) - 12.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) - 11.0 * ln1myd - 2.0 * log(-yd) - 5.0 * ln1pyd) + trilog((1.0 + yd) / 2.0) * (10.0 * log(-yd) - 5.0 * ln1pyd) + li3half * (8.0 * log(1.0 - 1.0i * xd) + 8.0 * log(1.0 + 1.0i * xd) + 16.0 * log((-1.0i) * xd) + 16.0 * log(1.0i * xd) - 5.0 * ln1myd - 10.0 * log(-yd) - 10.0 * log(yd) - 5.0 * ln1pyd)
-                + trilog(-1.0i / (1.0i + eta)) * (-28.0 * log(1.0 - 1.0i * xd) - 28.0 * log(1.0 + 1.0i * xd) - (3.0 * ln1pyd) / 2.0) - 8.0 * trilog(1.0 + 1.0 / (1.0 - 1.0i * eta)) * ln1pyd + (15.0 * trilog((1.0i + eta) / (1.0i + eta - 1.0i * yd)) * ln1pyd) / 2.0 + 7.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta - 1.0i * yd)) * ln1pyd + 10.0 * trilog(-ydinv) * ln1pyd - 5.0 * trilog((-1.0 + yd) / (2.0 * yd)) * ln1pyd - (15.0 * trilog(-yd) * ln1pyd) / 2.0 + (27.0 * trilog((1.0i * yd) / (1.0i + eta)) * ln1pyd) / 2.0 - (trilog(1.0 / (1.0 + yd)) * ln1pyd) / 2.0
+                - 5.0 * trilog((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd - (5.0 * power_of<3>(log(1.0 / (1.0 - yd))) * ln1myd) / 6.0 + (3.0 * dilog(1.0 / (-1.0 + 1.0i * eta)) * power_of<2>(ln1myd)) / 2.0 + 4.0 * dilog((2.0 * 1.0i + eta) / (1.0i + eta)) * power_of<2>(ln1myd) + 11.0 * dilog(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * power_of<2>(ln1myd) - (15.0 * dilog((-1.0 + yd) / (1.0 - 1.0i * eta + yd)) * power_of<2>(ln1myd)) / 2.0 + (15.0 * dilog(-(((1.0i + eta) * (-1.0 + yd)) / (eta + 1.0i * (1.0 + yd)))) * power_of<2>(ln1myd)) / 2.0 + li2_21 * ((-5.0 * pisqu) / 6.0 + 11.0 * li2_3 - 11.0 * power_of<2>(ln1myd))
+                + 5.0 * dilog(yd / (-1.0 + yd)) * ln1myd * ln_11 + 2.0 * dilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * ln1myd * ln_11 - 7.0 * dilog(yd / (1.0 - 1.0i * eta + yd)) * ln1myd * ln_11 + 7.0 * dilog(((2.0 * 1.0i + eta) * yd) / (eta + 1.0i * (1.0 + yd))) * ln1myd * ln_11 + trilog((-1.0 + yd) / (-2.0 + 1.0i * eta)) * (2.0 * ln_20 - 8.0 * ln_21 + 8.0 * ln1myd + 2.0 * ln_11) + li3_13 * (-5.0 * ln1myd + 10.0 * ln_11)
+                + li2_20 * ((-29.0 * pisqu) / 3.0 - 8.0 * li2_10 - 8.0 * li2_12 + 3.0 * li2_15 - 4.0 * li2_21 - 11.0 * li2_2 + (3.0 * power_of<2>(log(1.0 / (-2.0 + 1.0i * eta)))) / 2.0 - 12.0 * power_of<2>(ln_22) + (8.0 * ln_13 - 16.0 * ln_4) * ln_6 + (8.0 * ln_13 - 16.0 * ln_2) * ln_7 + (5.0 * ln_13 - 2.0 * ln1myd) * ln_11) + dilog(yd / (-1.0 + 1.0i * eta)) * (-power_of<2>(ln1myd) - 2.0 * ln1myd * ln_11) + log(1.0 / (1.0 - yd)) * ln1myd * ((-5.0 * pisqu) / 6.0 + (5.0 * power_of<2>(ln_11)) / 2.0)
+                + 5.0 * dilog((1.0 + yd) / (-1.0 + yd)) * ln1myd * ln_12 + 5.0 * dilog((1.0 + yd) / (2.0 * yd)) * ln1myd * ln_12 + li2_18 * ((7.0 * pisqu) / 3.0 - 11.0 * li2_3 + 3.0 * li2_16 - 4.0 * li2_22 + (3.0 * power_of<2>(ln_22)) / 2.0 + ln_10 * (5.0 * ln_13 - 2.0 * ln1pyd)) + trilog(1.0i / (2.0 * 1.0i + eta)) * (-42.0 * ln_20 - 60.0 * ln_21 - 8.0 * ln_2 - 8.0 * ln_4 - 16.0 * ln_6 - 16.0 * ln_7 - 5.0 * ln1myd - 2.0 * ln_11 - 11.0 * ln1pyd)
+                + trilog(-1.0 + 1.0i * eta) * (-12.0 * ln_2 - 12.0 * ln_4 - (15.0 * ln1myd) / 2.0 - (15.0 * ln1pyd) / 2.0) + trilog(1.0 / (2.0 - 1.0i * eta)) * (6.0 * ln_20 - 12.0 * ln_21 - 11.0 * ln1myd - 2.0 * ln_10 - 5.0 * ln1pyd) + li3_15 * (10.0 * ln_10 - 5.0 * ln1pyd) + li3half * (8.0 * ln_2 + 8.0 * ln_4 + 16.0 * ln_6 + 16.0 * ln_7 - 5.0 * ln1myd - 10.0 * ln_10 - 10.0 * ln_11 - 5.0 * ln1pyd)
+                + trilog(-1.0i / (1.0i + eta)) * (-28.0 * ln_2 - 28.0 * ln_4 - (3.0 * ln1pyd) / 2.0) - 8.0 * trilog(1.0 + 1.0 / (1.0 - 1.0i * eta)) * ln1pyd + (15.0 * trilog((1.0i + eta) / (1.0i + eta - 1.0i * yd)) * ln1pyd) / 2.0 + 7.0 * trilog((2.0 * 1.0i + eta) / (1.0i + eta - 1.0i * yd)) * ln1pyd + 10.0 * trilog(-ydinv) * ln1pyd - 5.0 * trilog((-1.0 + yd) / (2.0 * yd)) * ln1pyd - (15.0 * li3_16 * ln1pyd) / 2.0 + (27.0 * trilog((1.0i * yd) / (1.0i + eta)) * ln1pyd) / 2.0 - (trilog(1.0 / (1.0 + yd)) * ln1pyd) / 2.0
                 - (15.0 * trilog((eta - 1.0i * (-1.0 + yd)) / ((1.0i + eta) * (1.0 + yd))) * ln1pyd) / 2.0 - 5.0 * trilog((-1.0 + yd) / (1.0 + yd)) * ln1pyd - 5.0 * trilog(yd / (1.0 + yd)) * ln1pyd - 2.0 * trilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) * ln1pyd + (15.0 * trilog(((-1.0i) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * ln1pyd) / 2.0 - (15.0 * trilog(((1.0i + eta) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * ln1pyd) / 2.0 - 11.0 * trilog(((1.0i + eta) * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1pyd + 7.0 * trilog(yd / (-1.0 + 1.0i * eta + yd)) * ln1pyd
-                - 7.0 * trilog(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd)) * ln1pyd + (11.0 * trilog((-1.0 + 1.0i * eta + yd) / yd) * ln1pyd) / 2.0 - 5.0 * trilog((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd)) * ln1pyd + (5.0 * trilog((-1.0 + 1.0i * eta + yd) / (1.0 + yd)) * ln1pyd) / 2.0 + 8.0 * trilog(1.0 - (1.0i * yd) / (1.0i + eta)) * ln1pyd + 5.0 * dilog((-1.0 + yd) / (2.0 * yd)) * log((1.0 - yd) / 2.0) * ln1pyd + 5.0 * dilog((-1.0 + yd) / (1.0 + yd)) * log((1.0 - yd) / 2.0) * ln1pyd + (7.0 * pisqu * log(-1.0 / (1.0 - 1.0i * eta - yd)) * ln1pyd) / 6.0 + (7.0 * power_of<3>(log(-1.0 / (1.0 - 1.0i * eta - yd))) * ln1pyd) / 6.0
-                + 5.0 * dilog((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd)) * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd + (7.0 * power_of<3>(log(-ydinv)) * ln1pyd) / 12.0 - (5.0 * power_of<2>(log((1.0 - yd) / 2.0)) * log(ydinv) * ln1pyd) / 2.0 + 5.0 * dilog(yd / (1.0 + yd)) * log(-yd) * ln1pyd + 2.0 * dilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) * log(-yd) * ln1pyd - 7.0 * dilog(yd / (-1.0 + 1.0i * eta + yd)) * log(-yd) * ln1pyd + 7.0 * dilog(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd)) * log(-yd) * ln1pyd + 4.0 * dilog(1.0 + 1.0 / (1.0 - 1.0i * eta)) * power_of<2>(ln1pyd)
-                - (15.0 * dilog(((-1.0i) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * power_of<2>(ln1pyd)) / 2.0 + (15.0 * dilog(((1.0i + eta) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * power_of<2>(ln1pyd)) / 2.0 + 11.0 * dilog(((1.0i + eta) * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * power_of<2>(ln1pyd) + trilog(1.0 + ydinv) * (5.0 * ln1myd + (7.0 * ln1pyd) / 2.0) + trilog((-1.0 + yd) / yd) * ((7.0 * ln1myd) / 2.0 + 5.0 * ln1pyd) + trilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) * (2.0 * log(-1.0 + 1.0i * eta) - 8.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) + 2.0 * log(-yd) + 8.0 * ln1pyd)
-                + dilog((-1.0 + yd) / yd) * ((-7.0 * power_of<2>(ln1myd)) / 2.0 - 5.0 * log((1.0 - yd) / 2.0) * ln1pyd) + li2half * (8.0 * dilog(1.0 - 1.0i * xd) + 8.0 * dilog(1.0 + 1.0i * xd) - 5.0 * dilog(1.0 - yd) - 5.0 * dilog(1.0 + yd) + 16.0 * log(1.0 + 1.0i * xd) * log((-1.0i) * xd) + 16.0 * log(1.0 - 1.0i * xd) * log(1.0i * xd) - 10.0 * ln1myd * log(yd) - 10.0 * log(-yd) * ln1pyd) + dilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) * ((-5.0 * pisqu) / 6.0 - 11.0 * power_of<2>(ln1pyd)) + dilog(1.0 - (1.0i * yd) / (1.0i + eta)) * (-8.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd - 4.0 * power_of<2>(ln1pyd))
-                + dilog(1.0 + ydinv) * (-5.0 * ln1myd * log((1.0 + yd) / 2.0) - (7.0 * power_of<2>(ln1pyd)) / 2.0) + dilog((1.0i * yd) / (1.0i + eta)) * (-2.0 * log(-yd) * ln1pyd - power_of<2>(ln1pyd)) + dilog(-1.0i / (1.0i + eta)) * (8.0 * power_of<2>(log(1.0 - 1.0i * xd)) + 8.0 * power_of<2>(log(1.0 + 1.0i * xd)) + (3.0 * power_of<2>(ln1pyd)) / 2.0) + log(-ydinv) * ((7.0 * pisqu * ln1pyd) / 12.0 - (7.0 * power_of<3>(ln1pyd)) / 4.0) + trilog(1.0 + yd) * (-2.0 * log(-1.0 + 1.0i * eta) + 8.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) + 12.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) + ln1pyd - 12.0 * log(1.0 - (1.0i * yd) / (1.0i + eta)))
-                + dilog((-1.0 + 1.0i * eta + yd) / yd) * (-5.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd - (ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta))) / 2.0) + dilog((eta - 1.0i * (-1.0 + yd)) / ((1.0i + eta) * (1.0 + yd))) * (8.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd - (ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta))) / 2.0) + dilog((-1.0 + 1.0i * eta + yd) / (1.0 + yd)) * (-3.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd + (ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta))) / 2.0)
-                + dilog(-1.0 + 1.0i * eta) * (-12.0 * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd) - 12.0 * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (1.0i + eta)) - (15.0 * ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta))) / 2.0 - (15.0 * ln1myd * log(1.0 + (1.0i * yd) / (1.0i + eta))) / 2.0) + dilog((1.0 - 1.0i * eta + yd) / yd) * ln1myd * ((-0.5) * log(1.0 + (1.0i * yd) / (1.0i + eta)) - 5.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) + dilog((1.0 - 1.0i * eta + yd) / (-1.0 + yd)) * ln1myd * (log(1.0 + (1.0i * yd) / (1.0i + eta)) / 2.0 - 3.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)))
-                + 5.0 * dilog((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) + dilog(-((eta + 1.0i * (1.0 + yd)) / ((1.0i + eta) * (-1.0 + yd)))) * ln1myd * ((-0.5) * log(1.0 + (1.0i * yd) / (1.0i + eta)) + 8.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) + trilog(1.0 - yd) * (-2.0 * log(-1.0 + 1.0i * eta) + 8.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) + ln1myd - 12.0 * log(1.0 + (1.0i * yd) / (1.0i + eta)) + 12.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) + dilog(1.0 + (1.0i * yd) / (1.0i + eta)) * (-4.0 * power_of<2>(ln1myd) - 8.0 * ln1myd * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)))
-                + power_of<3>(log(1.0 - 1.0i * xd)) * (-6.0 * log((2.0 * 1.0i + eta) / (1.0i + eta - xd)) + 6.0 * log(-1.0i / xd) + 6.0 * log((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) - (4.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (1.0i + eta - xd) / (1.0i + eta), 1.0 - 1.0i * xd)) + (24.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * log(-1.0 + 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + dilog(1.0 - 1.0i * xd) * (-8.0 * dilog(0.5 - (1.0i / 2.0) * xd) + 20.0 * dilog((1.0i + xd) / (2.0 * 1.0i + eta)) + 8.0 * log((1.0i + eta - xd) / (1.0i + eta)) * log(1.0 - 1.0i * xd) - (16.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta))
-                + log(1.0i * xd) * (4.0 * power_of<2>(log(1.0)) * log((1.0i + eta) / (2.0 * 1.0i + eta)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta)) + (24.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * log(-1.0 + 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) + dilog(1.0 + 1.0i * xd) * (20.0 * dilog((1.0i - xd) / (2.0 * 1.0i + eta)) - 8.0 * dilog((1.0 + 1.0i * xd) / 2.0) + 8.0 * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (1.0i + eta)) - (16.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta))
-                + log((-1.0i) * xd) * (4.0 * power_of<2>(log(1.0)) * log((1.0i + eta) / (2.0 * 1.0i + eta)) + (16.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta)) + power_of<2>(log(1.0 + 1.0i * xd)) * (-8.0 * log((-1.0i) * xd) * log((1.0i + eta + xd) / (1.0i + eta)) - 4.0 * log(xd) * log((1.0i + eta + xd) / (1.0i + eta)) - (24.0 * 1.0i) * M_PI * log(-1.0 + 1.0i * eta) * my_sign(real(1.0 / (1.0i - xd))) * T(1.0, (-1.0i) * xd, -1.0 + 1.0i * eta)) + power_of<2>(log(1.0 - 1.0i * xd)) * (log((1.0i + eta - xd) / (1.0i + eta)) * (-8.0 * log(1.0i * xd) - 4.0 * log(xd)) - (24.0 * 1.0i) * M_PI * log(-1.0 + 1.0i * eta) * my_sign(real(1.0 / (1.0i + xd))) * T(1.0, 1.0i * xd, -1.0 + 1.0i * eta))
-                + log(1.0 - 1.0i * xd) * (2.0 * pisqu * log(1.0i / (1.0i + eta - xd)) + 2.0 * power_of<3>(log(1.0i / (1.0i + eta - xd))) - 2.0 * pisqu * log(-1.0i / xd) - 2.0 * power_of<3>(log(-1.0i / xd)) - (4.0 * pisqu * log((2.0 * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) * xdinv))) / 3.0 + ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(log((1.0i + eta - xd) / (1.0i + eta))) - 4.0 * power_of<2>(log((1.0i + eta - xd) / (2.0 * 1.0i + eta)))) * log((1.0i + eta) * xdinv) - (2.0 * power_of<3>(log((1.0i + eta) * xdinv))) / 3.0 + (4.0 * pisqu * log((2.0 * 1.0i + eta) * xdinv)) / 3.0 + (4.0 * power_of<3>(log((2.0 * 1.0i + eta) * xdinv))) / 3.0 - 12.0 * log((1.0i + eta - xd) / (1.0i + eta)) * power_of<2>(log(1.0i * xd)) + (4.0 * pisqu * log((2.0 * 1.0i) / (1.0i + xd))) / 3.0 + (4.0 * power_of<3>(log((2.0 * 1.0i) / (1.0i + xd)))) / 3.0
-                + (2.0 * pisqu * log((1.0i + eta) / (1.0i + xd))) / 3.0 + (2.0 * power_of<3>(log((1.0i + eta) / (1.0i + xd)))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i + eta) / (1.0i + xd))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i + eta) / (1.0i + xd)))) / 3.0 - 4.0 * pisqu * log((1.0i * (2.0 * 1.0i + eta)) / ((1.0i + eta) * (1.0i + xd))) - 4.0 * power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / ((1.0i + eta) * (1.0i + xd)))) + power_of<2>(log((1.0 + 1.0i * xd) / 2.0)) * (4.0 * log(1.0i / xd) - 4.0 * log((2.0 * 1.0i) / (1.0i + xd)) - 4.0 * log((1.0i + xd) / (2.0 * xd))) - (8.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (2.0 * 1.0i + eta) / (1.0i + xd)) * power_of<2>(log(-(xd / (2.0 * 1.0i + eta)))) * my_sign(imag((2.0 * 1.0i + eta) / (1.0i + xd)))
+                - 7.0 * trilog(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd)) * ln1pyd + (11.0 * trilog((-1.0 + 1.0i * eta + yd) / yd) * ln1pyd) / 2.0 - 5.0 * trilog((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd)) * ln1pyd + (5.0 * trilog((-1.0 + 1.0i * eta + yd) / (1.0 + yd)) * ln1pyd) / 2.0 + 8.0 * trilog(1.0 - (1.0i * yd) / (1.0i + eta)) * ln1pyd + 5.0 * dilog((-1.0 + yd) / (2.0 * yd)) * ln_9 * ln1pyd + 5.0 * dilog((-1.0 + yd) / (1.0 + yd)) * ln_9 * ln1pyd + (7.0 * pisqu * log(-1.0 / (1.0 - 1.0i * eta - yd)) * ln1pyd) / 6.0 + (7.0 * power_of<3>(log(-1.0 / (1.0 - 1.0i * eta - yd))) * ln1pyd) / 6.0
+                + 5.0 * dilog((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd)) * ln_27 * ln1pyd + (7.0 * power_of<3>(ln_14) * ln1pyd) / 12.0 - (5.0 * power_of<2>(ln_9) * ln_15 * ln1pyd) / 2.0 + 5.0 * dilog(yd / (1.0 + yd)) * ln_10 * ln1pyd + 2.0 * dilog(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) * ln_10 * ln1pyd - 7.0 * dilog(yd / (-1.0 + 1.0i * eta + yd)) * ln_10 * ln1pyd + 7.0 * dilog(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd)) * ln_10 * ln1pyd + 4.0 * dilog(1.0 + 1.0 / (1.0 - 1.0i * eta)) * power_of<2>(ln1pyd)
+                - (15.0 * dilog(((-1.0i) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * power_of<2>(ln1pyd)) / 2.0 + (15.0 * dilog(((1.0i + eta) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd))) * power_of<2>(ln1pyd)) / 2.0 + 11.0 * dilog(((1.0i + eta) * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * power_of<2>(ln1pyd) + trilog(1.0 + ydinv) * (5.0 * ln1myd + (7.0 * ln1pyd) / 2.0) + trilog((-1.0 + yd) / yd) * ((7.0 * ln1myd) / 2.0 + 5.0 * ln1pyd) + trilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) * (2.0 * ln_20 - 8.0 * ln_21 + 2.0 * ln_10 + 8.0 * ln1pyd)
+                + dilog((-1.0 + yd) / yd) * ((-7.0 * power_of<2>(ln1myd)) / 2.0 - 5.0 * ln_9 * ln1pyd) + li2half * (8.0 * li2_10 + 8.0 * li2_12 - 5.0 * li2_15 - 5.0 * li2_16 + 16.0 * ln_4 * ln_6 + 16.0 * ln_2 * ln_7 - 10.0 * ln1myd * ln_11 - 10.0 * ln_10 * ln1pyd) + li2_22 * ((-5.0 * pisqu) / 6.0 - 11.0 * power_of<2>(ln1pyd)) + dilog(1.0 - (1.0i * yd) / (1.0i + eta)) * (-8.0 * ln_27 * ln1pyd - 4.0 * power_of<2>(ln1pyd))
+                + dilog(1.0 + ydinv) * (-5.0 * ln1myd * ln_12 - (7.0 * power_of<2>(ln1pyd)) / 2.0) + dilog((1.0i * yd) / (1.0i + eta)) * (-2.0 * ln_10 * ln1pyd - power_of<2>(ln1pyd)) + dilog(-1.0i / (1.0i + eta)) * (8.0 * power_of<2>(ln_2) + 8.0 * power_of<2>(ln_4) + (3.0 * power_of<2>(ln1pyd)) / 2.0) + ln_14 * ((7.0 * pisqu * ln1pyd) / 12.0 - (7.0 * power_of<3>(ln1pyd)) / 4.0) + li3_14 * (-2.0 * ln_20 + 8.0 * ln_21 + 12.0 * ln_27 + ln1pyd - 12.0 * ln_28)
+                + dilog((-1.0 + 1.0i * eta + yd) / yd) * (-5.0 * ln_27 * ln1pyd - (ln1pyd * ln_28) / 2.0) + dilog((eta - 1.0i * (-1.0 + yd)) / ((1.0i + eta) * (1.0 + yd))) * (8.0 * ln_27 * ln1pyd - (ln1pyd * ln_28) / 2.0) + dilog((-1.0 + 1.0i * eta + yd) / (1.0 + yd)) * (-3.0 * ln_27 * ln1pyd + (ln1pyd * ln_28) / 2.0)
+                + dilog(-1.0 + 1.0i * eta) * (-12.0 * ln_23 * ln_2 - 12.0 * ln_4 * ln_25 - (15.0 * ln1pyd * ln_28) / 2.0 - (15.0 * ln1myd * ln_29) / 2.0) + dilog((1.0 - 1.0i * eta + yd) / yd) * ln1myd * ((-0.5) * ln_29 - 5.0 * ln_30) + dilog((1.0 - 1.0i * eta + yd) / (-1.0 + yd)) * ln1myd * (ln_29 / 2.0 - 3.0 * ln_30)
+                + 5.0 * dilog((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd)) * ln1myd * ln_30 + dilog(-((eta + 1.0i * (1.0 + yd)) / ((1.0i + eta) * (-1.0 + yd)))) * ln1myd * ((-0.5) * ln_29 + 8.0 * ln_30) + li3_11 * (-2.0 * ln_20 + 8.0 * ln_21 + ln1myd - 12.0 * ln_29 + 12.0 * ln_30) + dilog(1.0 + (1.0i * yd) / (1.0i + eta)) * (-4.0 * power_of<2>(ln1myd) - 8.0 * ln1myd * ln_30)
+                + power_of<3>(ln_2) * (-6.0 * log((2.0 * 1.0i + eta) / (1.0i + eta - xd)) + 6.0 * ln_16 + 6.0 * log((1.0i * (2.0 * 1.0i + eta) * xd) / (1.0i + eta - xd)) - (4.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (1.0i + eta - xd) / (1.0i + eta), 1.0 - 1.0i * xd)) + (24.0 * 1.0i) * M_PI * power_of<2>(ln_31) * ln_20 * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + li2_10 * (-8.0 * li2_5 + 20.0 * dilog((1.0i + xd) / (2.0 * 1.0i + eta)) + 8.0 * ln_23 * ln_2 - (16.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta))
+                + ln_7 * (4.0 * power_of<2>(ln_13) * ln_21 + (16.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta)) + (24.0 * 1.0i) * M_PI * power_of<2>(ln_31) * ln_20 * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) + li2_12 * (20.0 * dilog((1.0i - xd) / (2.0 * 1.0i + eta)) - 8.0 * li2_14 + 8.0 * ln_4 * ln_25 - (16.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta))
+                + ln_6 * (4.0 * power_of<2>(ln_13) * ln_21 + (16.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta)) + power_of<2>(ln_4) * (-8.0 * ln_6 * ln_25 - 4.0 * ln_5 * ln_25 - (24.0 * 1.0i) * M_PI * ln_20 * my_sign(real(1.0 / (1.0i - xd))) * T(1.0, (-1.0i) * xd, -1.0 + 1.0i * eta)) + power_of<2>(ln_2) * (ln_23 * (-8.0 * ln_7 - 4.0 * ln_5) - (24.0 * 1.0i) * M_PI * ln_20 * my_sign(real(1.0 / (1.0i + xd))) * T(1.0, 1.0i * xd, -1.0 + 1.0i * eta))
+                + ln_2 * (2.0 * pisqu * log(1.0i / (1.0i + eta - xd)) + 2.0 * power_of<3>(log(1.0i / (1.0i + eta - xd))) - 2.0 * pisqu * ln_16 - 2.0 * power_of<3>(ln_16) - (4.0 * pisqu * log((2.0 * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i) * xdinv))) / 3.0 + ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(ln_23) - 4.0 * power_of<2>(ln_24)) * log((1.0i + eta) * xdinv) - (2.0 * power_of<3>(log((1.0i + eta) * xdinv))) / 3.0 + (4.0 * pisqu * log((2.0 * 1.0i + eta) * xdinv)) / 3.0 + (4.0 * power_of<3>(log((2.0 * 1.0i + eta) * xdinv))) / 3.0 - 12.0 * ln_23 * power_of<2>(ln_7) + (4.0 * pisqu * ln_8) / 3.0 + (4.0 * power_of<3>(ln_8)) / 3.0
+                + (2.0 * pisqu * log((1.0i + eta) / (1.0i + xd))) / 3.0 + (2.0 * power_of<3>(log((1.0i + eta) / (1.0i + xd)))) / 3.0 - (4.0 * pisqu * ln_32) / 3.0 - (4.0 * power_of<3>(ln_32)) / 3.0 - 4.0 * pisqu * log((1.0i * (2.0 * 1.0i + eta)) / ((1.0i + eta) * (1.0i + xd))) - 4.0 * power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / ((1.0i + eta) * (1.0i + xd)))) + power_of<2>(ln_3) * (4.0 * ln_17 - 4.0 * ln_8 - 4.0 * log((1.0i + xd) / (2.0 * xd))) - (8.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (2.0 * 1.0i + eta) / (1.0i + xd)) * power_of<2>(log(-(xd / (2.0 * 1.0i + eta)))) * my_sign(imag((2.0 * 1.0i + eta) / (1.0i + xd)))
                 - (12.0 * 1.0i) * M_PI * H1(-1.0i / (1.0i + eta), -1.0i / xd) * power_of<2>(log(1.0i * (1.0i + eta - xd))) * my_sign(-real(xdinv)) - (4.0 * 1.0i) * M_PI * H1(-1.0 + 1.0i * eta, (1.0i + eta) * xdinv) * power_of<2>(log(-((1.0i + xd) / (1.0i + eta)))) * my_sign(real((1.0 - 1.0i * eta) * xdinv)) - (24.0 * 1.0i) * M_PI * H1(1.0i / (2.0 * 1.0i + eta), 1.0i / (1.0i + xd)) * power_of<2>(log(1.0 - 1.0i * eta + 1.0i * xd)) * my_sign(real(1.0 / (1.0i + xd))) + (24.0 * 1.0i) * M_PI * H1((2.0 * 1.0i + eta) / (1.0i + xd), 1.0i / (1.0i + xd)) * power_of<2>(log((1.0i * (1.0i + eta) * (1.0i + xd)) / (2.0 * 1.0i + eta))) * my_sign(real(1.0 / (1.0i + xd)))
-                + power_of<2>(log(1.0i * xd)) * (-12.0 * log((1.0i + eta) / (1.0i + eta - xd)) + 12.0 * log((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) + 12.0 * log((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) + (8.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (1.0i + eta - xd) / (2.0 * 1.0i + eta), 1.0i * xd)) - (16.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * log(1.0i * xd) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + power_of<2>(log((1.0i + eta - xd) / (1.0i + eta))) * (-2.0 * log((2.0 * 1.0i + eta) / (1.0i + xd)) + 2.0 * log(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) - (12.0 * 1.0i) * M_PI * my_sign(imag(xd / (1.0i + eta))) * T(1.0, 1.0 - 1.0i * xd, (1.0i + eta - xd) / (1.0i + eta)))
-                - (24.0 * 1.0i) * M_PI * power_of<2>(log(-1.0 + 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0i * xd, -1.0 + 1.0i * eta) + power_of<2>(log((1.0i + eta - xd) / (2.0 * 1.0i + eta))) * (4.0 * log((2.0 * 1.0i + eta) / (1.0i + xd)) + 4.0 * log(((1.0i + eta) * (1.0i + xd)) / ((2.0 * 1.0i + eta) * xd)) - (24.0 * 1.0i) * M_PI * my_sign(imag((1.0i + xd) / (2.0 * 1.0i + eta))) * T(1.0, 1.0i * xd, (1.0i + eta - xd) / (2.0 * 1.0i + eta)))) + power_of<3>(log(1.0 + 1.0i * xd)) * (6.0 * log(1.0i / xd) - 6.0 * log((2.0 * 1.0i + eta) / (1.0i + eta + xd)) + 6.0 * log(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) - (4.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (1.0i + eta + xd) / (1.0i + eta), 1.0 + 1.0i * xd))
-                + log(1.0 + 1.0i * xd) * ((-4.0 * power_of<3>(log((2.0 * 1.0i + eta) / (1.0i - xd)))) / 3.0 + ((4.0 * pisqu) / 3.0 - 4.0 * power_of<2>(log(0.5 - (1.0i / 2.0) * xd))) * log(2.0 / (1.0 + 1.0i * xd)) + (4.0 * power_of<3>(log(2.0 / (1.0 + 1.0i * xd)))) / 3.0 - 2.0 * pisqu * log(1.0i / xd) - 2.0 * power_of<3>(log(1.0i / xd)) - (4.0 * pisqu * log((-2.0 * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log((-2.0 * 1.0i) * xdinv))) / 3.0 - (2.0 * power_of<3>(log(-((1.0i + eta) * xdinv)))) / 3.0 + (4.0 * pisqu * log(-((2.0 * 1.0i + eta) * xdinv))) / 3.0 + (4.0 * power_of<3>(log(-((2.0 * 1.0i + eta) * xdinv)))) / 3.0 - 4.0 * pisqu * log((2.0 - 1.0i * eta) / ((1.0i + eta) * (-1.0i + xd))) - 4.0 * power_of<3>(log((2.0 - 1.0i * eta) / ((1.0i + eta) * (-1.0i + xd)))) + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * (4.0 * log(-1.0i / xd) - 4.0 * log((-1.0i + xd) / (2.0 * xd)))
-                + 4.0 * pisqu * log(-1.0i / (1.0i + eta + xd)) + 4.0 * power_of<3>(log(-1.0i / (1.0i + eta + xd))) + 2.0 * pisqu * log(1.0i / (1.0i + eta + xd)) + 2.0 * power_of<3>(log(1.0i / (1.0i + eta + xd))) + log(-((1.0i + eta) * xdinv)) * ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(log((1.0i + eta + xd) / (1.0i + eta))) - 4.0 * power_of<2>(log((1.0i + eta + xd) / (2.0 * 1.0i + eta)))) + log((2.0 * 1.0i + eta) / (1.0i - xd)) * ((-4.0 * pisqu) / 3.0 - 2.0 * power_of<2>(log((1.0i + eta + xd) / (1.0i + eta))) + 4.0 * power_of<2>(log((1.0i + eta + xd) / (2.0 * 1.0i + eta)))) - (8.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (2.0 * 1.0i + eta) / (1.0i - xd)) * power_of<2>(log(xd / (2.0 * 1.0i + eta))) * my_sign(imag((2.0 * 1.0i + eta) / (1.0i - xd)))
-                + (24.0 * 1.0i) * M_PI * H1((2.0 * 1.0i + eta) / (1.0i - xd), -1.0i / (-1.0i + xd)) * power_of<2>(log(((1.0 - 1.0i * eta) * (-1.0i + xd)) / (2.0 * 1.0i + eta))) * my_sign(real(1.0 / (1.0i - xd))) - (24.0 * 1.0i) * M_PI * H1(1.0i / (2.0 * 1.0i + eta), -1.0i / (-1.0i + xd)) * power_of<2>(log((-1.0i) * (1.0i + eta + xd))) * my_sign(real(1.0 / (1.0i - xd))) - (12.0 * 1.0i) * M_PI * H1(-1.0i / (1.0i + eta), 1.0i / xd) * power_of<2>(log(1.0i * (1.0i + eta + xd))) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * H1(-1.0 + 1.0i * eta, -((1.0i + eta) * xdinv)) * power_of<2>(log((-1.0i + xd) / (1.0i + eta))) * my_sign(-real((1.0 - 1.0i * eta) * xdinv)) - (16.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * log((-1.0i) * xd) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta)
-                + power_of<2>(log((1.0i + eta + xd) / (1.0i + eta))) * (2.0 * log(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) - (12.0 * 1.0i) * M_PI * my_sign(-imag(xd / (1.0i + eta))) * T(1.0, 1.0 + 1.0i * xd, (1.0i + eta + xd) / (1.0i + eta))) - (24.0 * 1.0i) * M_PI * power_of<2>(log(-1.0 + 1.0i * eta)) * my_sign(real(eta)) * T(1.0, (-1.0i) * xd, -1.0 + 1.0i * eta) + power_of<2>(log((1.0i + eta + xd) / (2.0 * 1.0i + eta))) * (4.0 * log(((1.0i + eta) * (-1.0i + xd)) / ((2.0 * 1.0i + eta) * xd)) - (24.0 * 1.0i) * M_PI * my_sign(imag((1.0i - xd) / (2.0 * 1.0i + eta))) * T(1.0, (-1.0i) * xd, (1.0i + eta + xd) / (2.0 * 1.0i + eta)))
-                + power_of<2>(log((-1.0i) * xd)) * (-12.0 * log((1.0i + eta) / (1.0i + eta + xd)) + 12.0 * log(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) - 12.0 * log((1.0i + eta + xd) / (1.0i + eta)) + 12.0 * log(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (1.0i + eta + xd) / (2.0 * 1.0i + eta), (-1.0i) * xd))) + ((5.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) - (6.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * log(-1.0 + 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)
-                + dilog(yd) * (ln1myd * ((9.0 * log(1.0 + (1.0i * yd) / (1.0i + eta))) / 2.0 + 11.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) + (22.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(imydinv) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)) + dilog(1.0 - yd) * (5.0 * dilog((1.0 - yd) / 2.0) + 7.0 * dilog((-1.0 + yd) / (-2.0 + 1.0i * eta)) + 12.0 * ln1myd * log(1.0 + (1.0i * yd) / (1.0i + eta)) + (6.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)) + log(yd) * ((5.0 * power_of<2>(log(1.0)) * log((1.0i + eta) / (2.0 * 1.0i + eta))) / 2.0 + (2.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta))
-                + power_of<2>(log(-yd)) * ln1pyd * ((-7.0 * log((1.0i + eta) / (1.0i + eta - 1.0i * yd))) / 2.0 + (5.0 * log(1.0 / (1.0 + yd))) / 2.0 + log((eta - 1.0i * (-1.0 + yd)) / ((1.0i + eta) * (1.0 + yd))) + (7.0 * log(((1.0i + eta) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd)))) / 2.0 - log(1.0 - (1.0i * yd) / (1.0i + eta)) + (5.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), -yd))
-                + power_of<2>(ln1pyd) * (-4.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * log((1.0i * yd) / (1.0i + eta)) - (8.0 * 1.0i) * M_PI * log((1.0i + eta) / (2.0 * 1.0i + eta)) * my_sign(imag((2.0 - 1.0i * eta) / (1.0 + yd))) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)) - (2.0 * 1.0i) * M_PI * log(-1.0 + 1.0i * eta) * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, -1.0 + 1.0i * eta)) + ((5.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) - (6.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * log(-1.0 + 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)
-                + dilog(-yd) * (11.0 * dilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) + 11.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd + (9.0 * ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta))) / 2.0 + (22.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + trilog(2.0 - 1.0i * eta) * (36.0 * log(-1.0 + 1.0i * eta) - 24.0 * log(1.0 - 1.0i * xd) - 24.0 * log(1.0 + 1.0i * xd) - 7.0 * ln1myd - 7.0 * ln1pyd - (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) - (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) - (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)
-                - (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + dilog(1.0 + yd) * (5.0 * dilog((1.0 + yd) / 2.0) + 7.0 * dilog((1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) + 12.0 * ln1pyd * log(1.0 - (1.0i * yd) / (1.0i + eta)) + (6.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + dilog(2.0 - 1.0i * eta) * (-18.0 * pisqu - 12.0 * dilog(1.0 - 1.0i * xd) - 12.0 * dilog(1.0 + 1.0i * xd) - dilog(1.0 - yd) - dilog(1.0 + yd) - 18.0 * power_of<2>(log(-2.0 + 1.0i * eta)) - 24.0 * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) * log(1.0 - 1.0i * xd) - 24.0 * log(1.0 + 1.0i * xd) * log((1.0i + eta + xd) / (2.0 * 1.0i + eta))
-                - 7.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * ln1pyd - 7.0 * ln1myd * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) + (64.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + (64.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) + (8.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + (8.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta))
-                + log(-yd) * ((5.0 * power_of<2>(log(1.0)) * log((1.0i + eta) / (2.0 * 1.0i + eta))) / 2.0 + 5.0 * power_of<2>(ln1pyd) * log(1.0 - (1.0i * yd) / (1.0i + eta)) + (2.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) + (6.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * ln1pyd * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + ln1pyd * ((5.0 * pisqu * log(1.0 / (1.0 - 1.0i * eta - yd))) / 4.0 + (5.0 * power_of<3>(log(1.0 / (1.0 - 1.0i * eta - yd)))) / 4.0 - (5.0 * pisqu * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta))) / 6.0 + (5.0 * pisqu * log(2.0 / yd)) / 6.0 + (5.0 * power_of<3>(log(2.0 / yd))) / 6.0 + power_of<3>(log((1.0 - 1.0i * eta) / yd)) / 12.0 + (5.0 * pisqu * log((2.0 - 1.0i * eta) / yd)) / 6.0
-                + (5.0 * power_of<3>(log((2.0 - 1.0i * eta) / yd))) / 6.0 - (5.0 * pisqu * log(1.0 / (1.0 + yd))) / 6.0 - (5.0 * power_of<3>(log(1.0 / (1.0 + yd)))) / 6.0 - (5.0 * pisqu * log(2.0 / (1.0 + yd))) / 6.0 - (5.0 * power_of<3>(log(2.0 / (1.0 + yd)))) / 6.0 - (pisqu * log((1.0 - 1.0i * eta) / (1.0 + yd))) / 12.0 - power_of<3>(log((1.0 - 1.0i * eta) / (1.0 + yd))) / 12.0 + power_of<3>(log((2.0 - 1.0i * eta) / (1.0 + yd))) / 2.0 - (4.0 * pisqu * log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd))))) / 3.0 - (4.0 * power_of<3>(log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))))) / 3.0 - (pisqu * log((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))) / 3.0 - power_of<3>(log((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))) / 3.0
-                + power_of<2>(log((1.0 - yd) / 2.0)) * ((5.0 * log(2.0 / (1.0 + yd))) / 2.0 + (5.0 * log((1.0 + yd) / (2.0 * yd))) / 2.0) - (11.0 * pisqu * log(-((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd)))) / 6.0 - (11.0 * power_of<3>(log(-((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd))))) / 6.0 - (log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) * power_of<2>(log(1.0 - (1.0i * yd) / (1.0i + eta)))) / 4.0 + log((1.0 - 1.0i * eta) / yd) * (pisqu / 12.0 - power_of<2>(log(1.0 - (1.0i * yd) / (1.0i + eta))) / 4.0) + log((2.0 - 1.0i * eta) / (1.0 + yd)) * (pisqu / 2.0 + power_of<2>(log(1.0 - (1.0i * yd) / (1.0i + eta))) / 4.0) + (11.0 * 1.0i) * M_PI * H1((1.0 - 1.0i * eta) / yd, -ydinv) * power_of<2>(log(((2.0 * 1.0i + eta) * yd) / (1.0i + eta))) * my_sign(-imydinv)
+                + power_of<2>(ln_7) * (-12.0 * log((1.0i + eta) / (1.0i + eta - xd)) + 12.0 * log((1.0i * (1.0i + eta - xd)) / ((1.0i + eta) * (1.0i + xd))) + 12.0 * log((1.0i + eta + xd - 1.0i * eta * xd) / (1.0i + eta - xd)) + (8.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (1.0i + eta - xd) / (2.0 * 1.0i + eta), 1.0i * xd)) - (16.0 * 1.0i) * M_PI * ln_31 * ln_7 * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + power_of<2>(ln_23) * (-2.0 * ln_32 + 2.0 * log(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (1.0i + xd))) - (12.0 * 1.0i) * M_PI * my_sign(imag(xd / (1.0i + eta))) * T(1.0, 1.0 - 1.0i * xd, (1.0i + eta - xd) / (1.0i + eta)))
+                - (24.0 * 1.0i) * M_PI * power_of<2>(ln_20) * my_sign(real(eta)) * T(1.0, 1.0i * xd, -1.0 + 1.0i * eta) + power_of<2>(ln_24) * (4.0 * ln_32 + 4.0 * log(((1.0i + eta) * (1.0i + xd)) / ((2.0 * 1.0i + eta) * xd)) - (24.0 * 1.0i) * M_PI * my_sign(imag((1.0i + xd) / (2.0 * 1.0i + eta))) * T(1.0, 1.0i * xd, (1.0i + eta - xd) / (2.0 * 1.0i + eta)))) + power_of<3>(ln_4) * (6.0 * ln_17 - 6.0 * log((2.0 * 1.0i + eta) / (1.0i + eta + xd)) + 6.0 * log(((2.0 - 1.0i * eta) * xd) / (1.0i + eta + xd)) - (4.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (1.0i + eta + xd) / (1.0i + eta), 1.0 + 1.0i * xd))
+                + ln_4 * ((-4.0 * power_of<3>(log((2.0 * 1.0i + eta) / (1.0i - xd)))) / 3.0 + ((4.0 * pisqu) / 3.0 - 4.0 * power_of<2>(ln_1)) * log(2.0 / (1.0 + 1.0i * xd)) + (4.0 * power_of<3>(log(2.0 / (1.0 + 1.0i * xd)))) / 3.0 - 2.0 * pisqu * ln_17 - 2.0 * power_of<3>(ln_17) - (4.0 * pisqu * log((-2.0 * 1.0i) * xdinv)) / 3.0 - (4.0 * power_of<3>(log((-2.0 * 1.0i) * xdinv))) / 3.0 - (2.0 * power_of<3>(log(-((1.0i + eta) * xdinv)))) / 3.0 + (4.0 * pisqu * log(-((2.0 * 1.0i + eta) * xdinv))) / 3.0 + (4.0 * power_of<3>(log(-((2.0 * 1.0i + eta) * xdinv)))) / 3.0 - 4.0 * pisqu * log((2.0 - 1.0i * eta) / ((1.0i + eta) * (-1.0i + xd))) - 4.0 * power_of<3>(log((2.0 - 1.0i * eta) / ((1.0i + eta) * (-1.0i + xd)))) + power_of<2>(ln_1) * (4.0 * ln_16 - 4.0 * log((-1.0i + xd) / (2.0 * xd)))
+                + 4.0 * pisqu * log(-1.0i / (1.0i + eta + xd)) + 4.0 * power_of<3>(log(-1.0i / (1.0i + eta + xd))) + 2.0 * pisqu * log(1.0i / (1.0i + eta + xd)) + 2.0 * power_of<3>(log(1.0i / (1.0i + eta + xd))) + log(-((1.0i + eta) * xdinv)) * ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(ln_25) - 4.0 * power_of<2>(ln_26)) + log((2.0 * 1.0i + eta) / (1.0i - xd)) * ((-4.0 * pisqu) / 3.0 - 2.0 * power_of<2>(ln_25) + 4.0 * power_of<2>(ln_26)) - (8.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (2.0 * 1.0i + eta) / (1.0i - xd)) * power_of<2>(log(xd / (2.0 * 1.0i + eta))) * my_sign(imag((2.0 * 1.0i + eta) / (1.0i - xd)))
+                + (24.0 * 1.0i) * M_PI * H1((2.0 * 1.0i + eta) / (1.0i - xd), -1.0i / (-1.0i + xd)) * power_of<2>(log(((1.0 - 1.0i * eta) * (-1.0i + xd)) / (2.0 * 1.0i + eta))) * my_sign(real(1.0 / (1.0i - xd))) - (24.0 * 1.0i) * M_PI * H1(1.0i / (2.0 * 1.0i + eta), -1.0i / (-1.0i + xd)) * power_of<2>(log((-1.0i) * (1.0i + eta + xd))) * my_sign(real(1.0 / (1.0i - xd))) - (12.0 * 1.0i) * M_PI * H1(-1.0i / (1.0i + eta), 1.0i / xd) * power_of<2>(log(1.0i * (1.0i + eta + xd))) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * H1(-1.0 + 1.0i * eta, -((1.0i + eta) * xdinv)) * power_of<2>(log((-1.0i + xd) / (1.0i + eta))) * my_sign(-real((1.0 - 1.0i * eta) * xdinv)) - (16.0 * 1.0i) * M_PI * ln_31 * ln_6 * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta)
+                + power_of<2>(ln_25) * (2.0 * log(((2.0 * 1.0i + eta) * xd) / ((1.0i + eta) * (-1.0i + xd))) - (12.0 * 1.0i) * M_PI * my_sign(-imag(xd / (1.0i + eta))) * T(1.0, 1.0 + 1.0i * xd, (1.0i + eta + xd) / (1.0i + eta))) - (24.0 * 1.0i) * M_PI * power_of<2>(ln_20) * my_sign(real(eta)) * T(1.0, (-1.0i) * xd, -1.0 + 1.0i * eta) + power_of<2>(ln_26) * (4.0 * log(((1.0i + eta) * (-1.0i + xd)) / ((2.0 * 1.0i + eta) * xd)) - (24.0 * 1.0i) * M_PI * my_sign(imag((1.0i - xd) / (2.0 * 1.0i + eta))) * T(1.0, (-1.0i) * xd, (1.0i + eta + xd) / (2.0 * 1.0i + eta)))
+                + power_of<2>(ln_6) * (-12.0 * log((1.0i + eta) / (1.0i + eta + xd)) + 12.0 * log(((1.0i + eta) * (1.0 + 1.0i * xd)) / (1.0i + eta + xd)) - 12.0 * ln_25 + 12.0 * log(((-1.0i) * (1.0i + eta + xd)) / ((1.0i + eta) * (-1.0i + xd))) + (8.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (1.0i + eta + xd) / (2.0 * 1.0i + eta), (-1.0i) * xd))) + ((5.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) - (6.0 * 1.0i) * M_PI * power_of<2>(ln_31) * ln_20 * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)
+                + li2_3 * (ln1myd * ((9.0 * ln_29) / 2.0 + 11.0 * ln_30) + (22.0 * 1.0i) * M_PI * ln_31 * my_sign(imydinv) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)) + li2_15 * (5.0 * li2_1 + 7.0 * li2_21 + 12.0 * ln1myd * ln_29 + (6.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)) + ln_11 * ((5.0 * power_of<2>(ln_13) * ln_21) / 2.0 + (2.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta))
+                + power_of<2>(ln_10) * ln1pyd * ((-7.0 * log((1.0i + eta) / (1.0i + eta - 1.0i * yd))) / 2.0 + (5.0 * ln_18) / 2.0 + log((eta - 1.0i * (-1.0 + yd)) / ((1.0i + eta) * (1.0 + yd))) + (7.0 * log(((1.0i + eta) * (1.0 + yd)) / (eta - 1.0i * (-1.0 + yd)))) / 2.0 - ln_28 + (5.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), -yd))
+                + power_of<2>(ln1pyd) * (-4.0 * ln_27 * log((1.0i * yd) / (1.0i + eta)) - (8.0 * 1.0i) * M_PI * ln_21 * my_sign(imag((2.0 - 1.0i * eta) / (1.0 + yd))) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)) - (2.0 * 1.0i) * M_PI * ln_20 * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, -1.0 + 1.0i * eta)) + ((5.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) - (6.0 * 1.0i) * M_PI * power_of<2>(ln_31) * ln_20 * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)
+                + li2_2 * (11.0 * li2_22 + 11.0 * ln_27 * ln1pyd + (9.0 * ln1pyd * ln_28) / 2.0 + (22.0 * 1.0i) * M_PI * ln_31 * my_sign(-imydinv) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + trilog(2.0 - 1.0i * eta) * (36.0 * ln_20 - 24.0 * ln_2 - 24.0 * ln_4 - 7.0 * ln1myd - 7.0 * ln1pyd - (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) - (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) - (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta)
+                - (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + li2_16 * (5.0 * li2_4 + 7.0 * li2_22 + 12.0 * ln1pyd * ln_28 + (6.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + li2_19 * (-18.0 * pisqu - 12.0 * li2_10 - 12.0 * li2_12 - li2_15 - li2_16 - 18.0 * power_of<2>(log(-2.0 + 1.0i * eta)) - 24.0 * ln_24 * ln_2 - 24.0 * ln_4 * ln_26
+                - 7.0 * ln_27 * ln1pyd - 7.0 * ln1myd * ln_30 + (64.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) + (64.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) + (8.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + (8.0 * 1.0i) * M_PI * ln_31 * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta))
+                + ln_10 * ((5.0 * power_of<2>(ln_13) * ln_21) / 2.0 + 5.0 * power_of<2>(ln1pyd) * ln_28 + (2.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) + (6.0 * 1.0i) * M_PI * ln_31 * ln1pyd * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta)) + ln1pyd * ((5.0 * pisqu * log(1.0 / (1.0 - 1.0i * eta - yd))) / 4.0 + (5.0 * power_of<3>(log(1.0 / (1.0 - 1.0i * eta - yd)))) / 4.0 - (5.0 * pisqu * ln_27) / 6.0 + (5.0 * pisqu * log(2.0 / yd)) / 6.0 + (5.0 * power_of<3>(log(2.0 / yd))) / 6.0 + power_of<3>(ln_33) / 12.0 + (5.0 * pisqu * log((2.0 - 1.0i * eta) / yd)) / 6.0
+                + (5.0 * power_of<3>(log((2.0 - 1.0i * eta) / yd))) / 6.0 - (5.0 * pisqu * ln_18) / 6.0 - (5.0 * power_of<3>(ln_18)) / 6.0 - (5.0 * pisqu * ln_19) / 6.0 - (5.0 * power_of<3>(ln_19)) / 6.0 - (pisqu * log((1.0 - 1.0i * eta) / (1.0 + yd))) / 12.0 - power_of<3>(log((1.0 - 1.0i * eta) / (1.0 + yd))) / 12.0 + power_of<3>(ln_34) / 2.0 - (4.0 * pisqu * log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd))))) / 3.0 - (4.0 * power_of<3>(log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))))) / 3.0 - (pisqu * log((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))) / 3.0 - power_of<3>(log((2.0 * 1.0i + eta) / ((1.0i + eta) * (1.0 + yd)))) / 3.0
+                + power_of<2>(ln_9) * ((5.0 * ln_19) / 2.0 + (5.0 * log((1.0 + yd) / (2.0 * yd))) / 2.0) - (11.0 * pisqu * log(-((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd)))) / 6.0 - (11.0 * power_of<3>(log(-((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd))))) / 6.0 - (log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) * power_of<2>(ln_28)) / 4.0 + ln_33 * (pisqu / 12.0 - power_of<2>(ln_28) / 4.0) + ln_34 * (pisqu / 2.0 + power_of<2>(ln_28) / 4.0) + (11.0 * 1.0i) * M_PI * H1((1.0 - 1.0i * eta) / yd, -ydinv) * power_of<2>(log(((2.0 * 1.0i + eta) * yd) / (1.0i + eta))) * my_sign(-imydinv)
                 - ((15.0 * 1.0i) / 2.0) * M_PI * H1(-1.0i / (1.0i + eta), -ydinv) * power_of<2>(log(-1.0 + 1.0i * eta + yd)) * my_sign(-imydinv) + (1.0i / 2.0) * M_PI * H1(-1.0 + 1.0i * eta, (1.0 - 1.0i * eta) / yd) * power_of<2>(log(((-1.0i) * (1.0 + yd)) / (1.0i + eta))) * my_sign(imag((1.0 - 1.0i * eta) / yd)) - (7.0 * 1.0i) * M_PI * H1(1.0 / (2.0 - 1.0i * eta), 1.0 / (1.0 + yd)) * power_of<2>(log(1.0 - 1.0i * eta - yd)) * my_sign(imag(1.0 / (1.0 + yd))) + (2.0 * 1.0i) * M_PI * H1((2.0 - 1.0i * eta) / (1.0 + yd), 1.0 / (1.0 + yd)) * power_of<2>(log(-(((1.0i + eta) * (1.0 + yd)) / (2.0 * 1.0i + eta)))) * my_sign(imag(1.0 / (1.0 + yd))) - (5.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (2.0 - 1.0i * eta) / (1.0 + yd)) * power_of<2>(log(((-1.0i) * yd) / (2.0 * 1.0i + eta))) * my_sign(imag((2.0 - 1.0i * eta) / (1.0 + yd)))
-                + (8.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (2.0 - 1.0i * eta) / (1.0 + yd)) * power_of<2>(log(((1.0i + eta) * (1.0 + yd)) / (2.0 * 1.0i + eta))) * my_sign(imag((2.0 - 1.0i * eta) / (1.0 + yd))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + eta) / (2.0 * 1.0i + eta))) * my_sign(-real(1.0 / (2.0 * 1.0i + eta))) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)) - (2.0 * 1.0i) * M_PI * power_of<2>(log(-1.0 + 1.0i * eta)) * my_sign(real(eta)) * T(1.0, -yd, -1.0 + 1.0i * eta)
-                + power_of<2>(log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta))) * ((-5.0 * log((1.0 - 1.0i * eta) / yd)) / 2.0 - 4.0 * log((1.0i * yd) / (1.0i + eta)) - (3.0 * log((2.0 - 1.0i * eta) / (1.0 + yd))) / 2.0 + 4.0 * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) + (5.0 * log(((1.0i + eta) * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 - (7.0 * 1.0i) * M_PI * my_sign(real((1.0 + yd) / (2.0 * 1.0i + eta))) * T(1.0, -yd, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta))) + (11.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) - ((15.0 * 1.0i) / 2.0) * M_PI * power_of<2>(log(1.0 - (1.0i * yd) / (1.0i + eta))) * my_sign(real(yd / (1.0i + eta))) * T(1.0, 1.0 + yd, 1.0 - (1.0i * yd) / (1.0i + eta)))
-                + power_of<3>(ln1pyd) * ((-15.0 * log((2.0 * 1.0i + eta) / (1.0i + eta - 1.0i * yd))) / 4.0 - (11.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta))) / 2.0 + (15.0 * log(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd))) / 4.0 + (11.0 * log((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd))) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - (1.0i * yd) / (1.0i + eta), 1.0 + yd))
-                + power_of<3>(ln1myd) * ((-7.0 * log(ydinv)) / 4.0 - (15.0 * log((2.0 * 1.0i + eta) / (eta + 1.0i * (1.0 + yd)))) / 4.0 + (15.0 * log(((2.0 * 1.0i + eta) * yd) / (eta + 1.0i * (1.0 + yd)))) / 4.0 - (11.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) / 2.0 + (11.0 * log((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(imag(yd)) * T(1.0, 1.0 + (1.0i * yd) / (1.0i + eta), 1.0 - yd))
-                + power_of<2>(ln1myd) * (5.0 * log(yd) * log(1.0 + (1.0i * yd) / (1.0i + eta)) - 4.0 * log(yd / (-1.0 + 1.0i * eta)) * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) - (2.0 * 1.0i) * M_PI * log(-1.0 + 1.0i * eta) * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, -1.0 + 1.0i * eta) - (8.0 * 1.0i) * M_PI * log((1.0i + eta) / (2.0 * 1.0i + eta)) * my_sign(real((2.0 * 1.0i + eta) / (-1.0 + yd))) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)))
-                + ln1myd * ((-5.0 * power_of<3>(log(-2.0 / (-1.0 + yd)))) / 6.0 - (pisqu * log((1.0i * (1.0i + eta)) / (-1.0 + yd))) / 12.0 - power_of<3>(log((1.0i * (1.0i + eta)) / (-1.0 + yd))) / 12.0 + power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd))) / 2.0 - (pisqu * log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 - power_of<3>(log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd)))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 + (5.0 * pisqu * log(-2.0 / yd)) / 6.0 + (5.0 * power_of<3>(log(-2.0 / yd))) / 6.0 + (7.0 * pisqu * log(ydinv)) / 12.0 + (7.0 * power_of<3>(log(ydinv))) / 12.0 + power_of<3>(log((1.0i * (1.0i + eta)) / yd)) / 12.0
-                + (5.0 * pisqu * log((1.0i * (2.0 * 1.0i + eta)) / yd)) / 6.0 + (5.0 * power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / yd))) / 6.0 + ((-5.0 * log(-ydinv)) / 2.0 + (5.0 * log((-1.0 + yd) / (2.0 * yd))) / 2.0) * power_of<2>(log((1.0 + yd) / 2.0)) + log(-2.0 / (-1.0 + yd)) * ((-5.0 * pisqu) / 6.0 + (5.0 * power_of<2>(log((1.0 + yd) / 2.0))) / 2.0) + (7.0 * pisqu * log(-1.0 / (1.0 - 1.0i * eta + yd))) / 6.0 + (7.0 * power_of<3>(log(-1.0 / (1.0 - 1.0i * eta + yd)))) / 6.0 - (11.0 * pisqu * log((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd))) / 6.0 - (11.0 * power_of<3>(log((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd)))) / 6.0 + (5.0 * pisqu * log(1.0i / (eta + 1.0i * (1.0 + yd)))) / 4.0 + (5.0 * power_of<3>(log(1.0i / (eta + 1.0i * (1.0 + yd))))) / 4.0
-                - (5.0 * pisqu * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) / 6.0 + 4.0 * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * power_of<2>(log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) + log((1.0i * (1.0i + eta)) / yd) * (pisqu / 12.0 - power_of<2>(log(1.0 + (1.0i * yd) / (1.0i + eta))) / 4.0 - (5.0 * power_of<2>(log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)))) / 2.0) + log((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) * (pisqu / 2.0 + power_of<2>(log(1.0 + (1.0i * yd) / (1.0i + eta))) / 4.0 - (3.0 * power_of<2>(log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)))) / 2.0) + (2.0 * 1.0i) * M_PI * H1((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd), 1.0 / (1.0 - yd)) * power_of<2>(log(((1.0i + eta) * (-1.0 + yd)) / (2.0 * 1.0i + eta))) * my_sign(imag(1.0 / (1.0 - yd)))
+                + (8.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (2.0 - 1.0i * eta) / (1.0 + yd)) * power_of<2>(log(((1.0i + eta) * (1.0 + yd)) / (2.0 * 1.0i + eta))) * my_sign(imag((2.0 - 1.0i * eta) / (1.0 + yd))) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_21) * my_sign(-real(1.0 / (2.0 * 1.0i + eta))) * T(1.0, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_20) * my_sign(real(eta)) * T(1.0, -yd, -1.0 + 1.0i * eta)
+                + power_of<2>(ln_27) * ((-5.0 * ln_33) / 2.0 - 4.0 * log((1.0i * yd) / (1.0i + eta)) - (3.0 * ln_34) / 2.0 + 4.0 * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (1.0 + yd))) + (5.0 * log(((1.0i + eta) * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 - (7.0 * 1.0i) * M_PI * my_sign(real((1.0 + yd) / (2.0 * 1.0i + eta))) * T(1.0, -yd, (1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta))) + (11.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) - ((15.0 * 1.0i) / 2.0) * M_PI * power_of<2>(ln_28) * my_sign(real(yd / (1.0i + eta))) * T(1.0, 1.0 + yd, 1.0 - (1.0i * yd) / (1.0i + eta)))
+                + power_of<3>(ln1pyd) * ((-15.0 * log((2.0 * 1.0i + eta) / (1.0i + eta - 1.0i * yd))) / 4.0 - (11.0 * ln_27) / 2.0 + (15.0 * log(((2.0 - 1.0i * eta) * yd) / (-1.0 + 1.0i * eta + yd))) / 4.0 + (11.0 * log((-1.0 + 1.0i * eta + yd) / ((2.0 - 1.0i * eta) * yd))) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - (1.0i * yd) / (1.0i + eta), 1.0 + yd))
+                + power_of<3>(ln1myd) * ((-7.0 * ln_15) / 4.0 - (15.0 * log((2.0 * 1.0i + eta) / (eta + 1.0i * (1.0 + yd)))) / 4.0 + (15.0 * log(((2.0 * 1.0i + eta) * yd) / (eta + 1.0i * (1.0 + yd)))) / 4.0 - (11.0 * ln_30) / 2.0 + (11.0 * log((eta + 1.0i * (1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(imag(yd)) * T(1.0, 1.0 + (1.0i * yd) / (1.0i + eta), 1.0 - yd))
+                + power_of<2>(ln1myd) * (5.0 * ln_11 * ln_29 - 4.0 * log(yd / (-1.0 + 1.0i * eta)) * ln_30 - (2.0 * 1.0i) * M_PI * ln_20 * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, -1.0 + 1.0i * eta) - (8.0 * 1.0i) * M_PI * ln_21 * my_sign(real((2.0 * 1.0i + eta) / (-1.0 + yd))) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta)))
+                + ln1myd * ((-5.0 * power_of<3>(log(-2.0 / (-1.0 + yd)))) / 6.0 - (pisqu * log((1.0i * (1.0i + eta)) / (-1.0 + yd))) / 12.0 - power_of<3>(log((1.0i * (1.0i + eta)) / (-1.0 + yd))) / 12.0 + power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd))) / 2.0 - (pisqu * log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 - power_of<3>(log(-((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 - (4.0 * pisqu * log((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd)))) / 3.0 - (4.0 * power_of<3>(log((2.0 * 1.0i + eta) / ((1.0i + eta) * (-1.0 + yd))))) / 3.0 + (5.0 * pisqu * log(-2.0 / yd)) / 6.0 + (5.0 * power_of<3>(log(-2.0 / yd))) / 6.0 + (7.0 * pisqu * ln_15) / 12.0 + (7.0 * power_of<3>(ln_15)) / 12.0 + power_of<3>(log((1.0i * (1.0i + eta)) / yd)) / 12.0
+                + (5.0 * pisqu * log((1.0i * (2.0 * 1.0i + eta)) / yd)) / 6.0 + (5.0 * power_of<3>(log((1.0i * (2.0 * 1.0i + eta)) / yd))) / 6.0 + ((-5.0 * ln_14) / 2.0 + (5.0 * log((-1.0 + yd) / (2.0 * yd))) / 2.0) * power_of<2>(ln_12) + log(-2.0 / (-1.0 + yd)) * ((-5.0 * pisqu) / 6.0 + (5.0 * power_of<2>(ln_12)) / 2.0) + (7.0 * pisqu * log(-1.0 / (1.0 - 1.0i * eta + yd))) / 6.0 + (7.0 * power_of<3>(log(-1.0 / (1.0 - 1.0i * eta + yd)))) / 6.0 - (11.0 * pisqu * log((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd))) / 6.0 - (11.0 * power_of<3>(log((1.0i + eta) / ((2.0 * 1.0i) * yd + eta * yd)))) / 6.0 + (5.0 * pisqu * log(1.0i / (eta + 1.0i * (1.0 + yd)))) / 4.0 + (5.0 * power_of<3>(log(1.0i / (eta + 1.0i * (1.0 + yd))))) / 4.0
+                - (5.0 * pisqu * ln_30) / 6.0 + 4.0 * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) * power_of<2>(ln_30) + log((1.0i * (1.0i + eta)) / yd) * (pisqu / 12.0 - power_of<2>(ln_29) / 4.0 - (5.0 * power_of<2>(ln_30)) / 2.0) + log((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) * (pisqu / 2.0 + power_of<2>(ln_29) / 4.0 - (3.0 * power_of<2>(ln_30)) / 2.0) + (2.0 * 1.0i) * M_PI * H1((1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd), 1.0 / (1.0 - yd)) * power_of<2>(log(((1.0i + eta) * (-1.0 + yd)) / (2.0 * 1.0i + eta))) * my_sign(imag(1.0 / (1.0 - yd)))
                 - (7.0 * 1.0i) * M_PI * H1(1.0i / (2.0 * 1.0i + eta), 1.0 / (1.0 - yd)) * power_of<2>(log(1.0 - 1.0i * eta + yd)) * my_sign(imag(1.0 / (1.0 - yd))) - ((15.0 * 1.0i) / 2.0) * M_PI * H1(1.0 / (-1.0 + 1.0i * eta), ydinv) * power_of<2>(log(-1.0 + 1.0i * eta - yd)) * my_sign(imydinv) + (11.0 * 1.0i) * M_PI * H1((1.0i * (1.0i + eta)) / yd, ydinv) * power_of<2>(log((-1.0 + 1.0 / (-1.0 + 1.0i * eta)) * yd)) * my_sign(imydinv) + (8.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - yd), (1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) * power_of<2>(log(-(((1.0i + eta) * (-1.0 + yd)) / (2.0 * 1.0i + eta)))) * my_sign(real((2.0 * 1.0i + eta) / (-1.0 + yd)))
-                - (5.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) * power_of<2>(log((1.0i * yd) / (2.0 * 1.0i + eta))) * my_sign(real((2.0 * 1.0i + eta) / (-1.0 + yd))) + (1.0i / 2.0) * M_PI * H1(-1.0 + 1.0i * eta, (1.0i * (1.0i + eta)) / yd) * power_of<2>(log((1.0i * (-1.0 + yd)) / (1.0i + eta))) * my_sign(real((1.0i + eta) / yd)) + (11.0 * 1.0i) * M_PI * power_of<2>(log(2.0 - 1.0i * eta)) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + (6.0 * 1.0i) * M_PI * log(2.0 - 1.0i * eta) * log(yd) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + power_of<2>(log(1.0 + (1.0i * yd) / (1.0i + eta))) * ((-1.0 / 4.0) * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) - ((15.0 * 1.0i) / 2.0) * M_PI * my_sign(-real(yd / (1.0i + eta))) * T(1.0, 1.0 - yd, 1.0 + (1.0i * yd) / (1.0i + eta)))
-                - (2.0 * 1.0i) * M_PI * power_of<2>(log(-1.0 + 1.0i * eta)) * my_sign(real(eta)) * T(1.0, yd, -1.0 + 1.0i * eta) + power_of<2>(log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) * ((5.0 * log(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 - 4.0 * log(yd / (-1.0 + 1.0i * eta)) - (7.0 * 1.0i) * M_PI * my_sign(imag((-1.0 + yd) / (-2.0 + 1.0i * eta))) * T(1.0, yd, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) - (8.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + eta) / (2.0 * 1.0i + eta))) * my_sign(-real(1.0 / (2.0 * 1.0i + eta))) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta))
-                + power_of<2>(log(yd)) * (-log(1.0 + (1.0i * yd) / (1.0i + eta)) - (7.0 * log((1.0i + eta) / (eta + 1.0i * (1.0 + yd)))) / 2.0 + (7.0 * log(-(((1.0i + eta) * (-1.0 + yd)) / (eta + 1.0i * (1.0 + yd))))) / 2.0 + log(-((eta + 1.0i * (1.0 + yd)) / ((1.0i + eta) * (-1.0 + yd)))) + (5.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), yd))) + 72.0 * log((1.0i + eta) / (2.0 * 1.0i + eta)) * zeta3 + 8.0 * log((1.0i + eta - xd) / (1.0i + eta)) * zeta3 - 24.0 * log((1.0i + eta - xd) / (2.0 * 1.0i + eta)) * zeta3 + 8.0 * log((1.0i + eta + xd) / (1.0i + eta)) * zeta3 - 24.0 * log((1.0i + eta + xd) / (2.0 * 1.0i + eta)) * zeta3
-                - 12.0 * log((1.0i + eta - 1.0i * yd) / (2.0 * 1.0i + eta)) * zeta3 + 12.0 * log(1.0 - (1.0i * yd) / (1.0i + eta)) * zeta3 + 12.0 * log(1.0 + (1.0i * yd) / (1.0i + eta)) * zeta3 - 12.0 * log((eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta)) * zeta3 + (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) * zeta3 + (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) * zeta3 + (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) * zeta3 + (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) * zeta3;
+                - (5.0 * 1.0i) * M_PI * H1(2.0 - 1.0i * eta, (1.0i * (2.0 * 1.0i + eta)) / (-1.0 + yd)) * power_of<2>(log((1.0i * yd) / (2.0 * 1.0i + eta))) * my_sign(real((2.0 * 1.0i + eta) / (-1.0 + yd))) + (1.0i / 2.0) * M_PI * H1(-1.0 + 1.0i * eta, (1.0i * (1.0i + eta)) / yd) * power_of<2>(log((1.0i * (-1.0 + yd)) / (1.0i + eta))) * my_sign(real((1.0i + eta) / yd)) + (11.0 * 1.0i) * M_PI * power_of<2>(ln_31) * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + (6.0 * 1.0i) * M_PI * ln_31 * ln_11 * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) + power_of<2>(ln_29) * ((-1.0 / 4.0) * log(((2.0 * 1.0i + eta) * yd) / ((1.0i + eta) * (-1.0 + yd))) - ((15.0 * 1.0i) / 2.0) * M_PI * my_sign(-real(yd / (1.0i + eta))) * T(1.0, 1.0 - yd, 1.0 + (1.0i * yd) / (1.0i + eta)))
+                - (2.0 * 1.0i) * M_PI * power_of<2>(ln_20) * my_sign(real(eta)) * T(1.0, yd, -1.0 + 1.0i * eta) + power_of<2>(ln_30) * ((5.0 * log(((1.0i + eta) * (-1.0 + yd)) / ((2.0 * 1.0i + eta) * yd))) / 2.0 - 4.0 * log(yd / (-1.0 + 1.0i * eta)) - (7.0 * 1.0i) * M_PI * my_sign(imag((-1.0 + yd) / (-2.0 + 1.0i * eta))) * T(1.0, yd, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta))) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_21) * my_sign(-real(1.0 / (2.0 * 1.0i + eta))) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), (1.0i + eta) / (2.0 * 1.0i + eta))
+                + power_of<2>(ln_11) * (-ln_29 - (7.0 * log((1.0i + eta) / (eta + 1.0i * (1.0 + yd)))) / 2.0 + (7.0 * log(-(((1.0i + eta) * (-1.0 + yd)) / (eta + 1.0i * (1.0 + yd))))) / 2.0 + log(-((eta + 1.0i * (1.0 + yd)) / ((1.0i + eta) * (-1.0 + yd)))) + (5.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (eta + 1.0i * (1.0 + yd)) / (2.0 * 1.0i + eta), yd))) + 72.0 * ln_21 * zeta3 + 8.0 * ln_23 * zeta3 - 24.0 * ln_24 * zeta3 + 8.0 * ln_25 * zeta3 - 24.0 * ln_26 * zeta3
+                - 12.0 * ln_27 * zeta3 + 12.0 * ln_28 * zeta3 + 12.0 * ln_29 * zeta3 - 12.0 * ln_30 * zeta3 + (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - 1.0i * xd, 2.0 - 1.0i * eta) * zeta3 + (48.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + 1.0i * xd, 2.0 - 1.0i * eta) * zeta3 + (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 - yd, 2.0 - 1.0i * eta) * zeta3 + (24.0 * 1.0i) * M_PI * my_sign(real(eta)) * T(1.0, 1.0 + yd, 2.0 - 1.0i * eta) * zeta3;
 
             return w4Part1 + w4Part2 + w4Part3 + w4Part4 + w4Part5 + w4Part6 + w4HPLs;
         }
@@ -68,7 +68,215 @@ namespace eos
             const complex<double> ln1pyd = log(1.0 + yd);
             const complex<double> ln1myd = log(1.0 - yd);
 
-            const complex<double> part1 = (-2.0 * power_of<4>(M_PI)) / 9.0 - 6.0 * power_of<2>(dilog(1.0 / (1.0 + w))) + 2.0 * power_of<2>(dilog(1.0 + w)) + dilog((2.0 * w) / (-1.0 + w)) * (dilog((w - yd) / (-1.0 + w)) + dilog((w + yd) / (-1.0 + w))) + 16.0 * quadlog(0.5) - 24.0 * quadlog(1.0 + winv) + 8.0 * quadlog(1.0 / (1.0 - w)) + 16.0 * quadlog(1.0 - w) - 24.0 * quadlog(-winv) + 16.0 * quadlog(winv) + 16.0 * quadlog((-1.0 + w) / w) + 16.0 * quadlog(w) + 8.0 * quadlog(w / (-1.0 + w)) + 28.0 * quadlog(1.0 / (1.0 + w)) + 12.0 * quadlog(1.0 + w) - 8.0 * quadlog((1.0 - yd) / 2.0) - 16.0 * quadlog(1.0 - yd) + 4.0 * quadlog((w - yd) / (-1.0 + w)) + 4.0 * quadlog((-1.0 + yd) / (-1.0 + w))
+            // hoisted common subexpressions: the transcendental calls below are
+            // opaque to the compiler, and each right-hand side recurs many times
+            // in the generated sums
+            const complex<double> li2_1 = dilog(1.0 / (1.0 + w));
+            const complex<double> li2_2 = dilog(1.0 + w);
+            const complex<double> li2_3 = dilog((2.0 * w) / (-1.0 + w));
+            const complex<double> li2_4 = dilog((w - yd) / (-1.0 + w));
+            const complex<double> li2_5 = dilog((w + yd) / (-1.0 + w));
+            const complex<double> ln_1 = log(1.0 + winv);
+            const complex<double> ln_2 = log(1.0 / (1.0 - w));
+            const complex<double> ln_3 = log(1.0 - w);
+            const complex<double> ln_4 = log(winv);
+            const complex<double> ln_5 = log((-1.0 + w) / w);
+            const complex<double> ln_6 = log(-w);
+            const complex<double> ln_7 = log(w);
+            const complex<double> ln_8 = log(w / (-1.0 + w));
+            const complex<double> ln_9 = log(1.0 / (-1.0 + w));
+            const complex<double> ln_10 = log(w / (1.0 + w));
+            const complex<double> ln_11 = log(-winv);
+            const complex<double> ln_12 = log(1.0 + w);
+            const complex<double> ln_13 = log(1.0 / (1.0 - yd));
+            const complex<double> ln_14 = log((1.0 - yd) / 2.0);
+            const complex<double> ln_15 = log(w / (w - yd));
+            const complex<double> ln_16 = log((w * (-1.0 + yd)) / (1.0 + w));
+            const complex<double> ln_17 = log((w - yd) / ((-1.0 + w) * yd));
+            const complex<double> ln_18 = log((w * (-1.0 + yd)) / ((1.0 + w) * yd));
+            const complex<double> ln_19 = log(yd / (1.0 - yd));
+            const complex<double> ln_20 = log(1.0 / (1.0 + yd));
+            const complex<double> ln_21 = log(-(w / (1.0 + yd)));
+            const complex<double> ln_22 = log((1.0 - yd) / (1.0 + yd));
+            const complex<double> ln_23 = log(-(yd / (1.0 + yd)));
+            const complex<double> li2_6 = dilog(w / (w + yd));
+            const complex<double> ln_24 = log((1.0 + yd) / 2.0);
+            const complex<double> li2_7 = dilog((1.0 - yd) / (1.0 + w));
+            const complex<double> li2_8 = dilog(-yd);
+            const complex<double> li2_9 = dilog(1.0 / (1.0 + yd));
+            const complex<double> li2_10 = dilog((1.0 - yd) / (1.0 + yd));
+            const complex<double> ln_25 = log(yd / (1.0 + yd));
+            const complex<double> li2_11 = dilog((w - w * yd) / (w + yd));
+            const complex<double> ln_26 = log((-1.0 + yd) / (-1.0 + w));
+            const complex<double> ln_27 = log((1.0 - w) / 2.0);
+            const complex<double> ln_28 = log((-1.0 + w) / (1.0 + w));
+            const complex<double> ln_29 = log(-yd);
+            const complex<double> ln_30 = log(yd / (-1.0 + yd));
+            const complex<double> ln_31 = log(-(w / yd));
+            const complex<double> ln_32 = log(w / yd);
+            const complex<double> ln_33 = log(w / ((-1.0 + w) * yd));
+            const complex<double> ln_34 = log(1.0 / (w - yd));
+            const complex<double> ln_35 = log((w - yd) / (1.0 + w));
+            const complex<double> ln_36 = log(2.0 / (1.0 + yd));
+            const complex<double> ln_37 = log((1.0 - w) / (1.0 + yd));
+            const complex<double> ln_38 = log(yd);
+            const complex<double> li2_12 = dilog(((1.0 + w) * yd) / (w * (-1.0 + yd)));
+            const complex<double> li2_13 = dilog((1.0 + yd) / (-1.0 + yd));
+            const complex<double> li2_14 = dilog(((1.0 + w) * yd) / (w + yd));
+            const complex<double> li2_15 = dilog((yd - w * yd) / (w + yd));
+            const complex<double> li2_16 = dilog(w / (w - yd));
+            const complex<double> li2_17 = dilog(yd);
+            const complex<double> li2_18 = dilog((1.0 + yd) / 2.0);
+            const complex<double> li2_19 = dilog(((1.0 + w) * yd) / (-w + yd));
+            const complex<double> li2_20 = dilog((yd + w * yd) / (w + w * yd));
+            const complex<double> li2_21 = dilog(-2.0 / (-1.0 + w));
+            const complex<double> li2_22 = dilog((-1.0 + yd) / (-1.0 + w));
+            const complex<double> li2_23 = dilog((2.0 * yd) / (-1.0 + yd));
+            const complex<double> li2_24 = dilog((2.0 * yd) / (1.0 + yd));
+            const complex<double> li2_25 = dilog((1.0 + yd) / (1.0 - w));
+            const complex<double> li2_26 = dilog(yd / w);
+            const complex<double> li2_27 = dilog((1.0 + yd) / (1.0 - yd));
+            const complex<double> ln_39 = log((-1.0 + w) / (2.0 * w));
+            const complex<double> ln_40 = log(2.0 / (1.0 + w));
+            const complex<double> ln_41 = log((1.0 + w) / (2.0 * w));
+            const complex<double> li2_28 = dilog(-((1.0 + yd) / (w - yd)));
+            const complex<double> li2_29 = dilog(-(yd / w));
+            const complex<double> li2_30 = dilog((-1.0 + w) / (1.0 + w));
+            const complex<double> li2_31 = dilog((1.0 + w) / (2.0 * w));
+            const complex<double> li2_32 = dilog((1.0 + yd) / (1.0 + w));
+            const complex<double> li2_33 = dilog((w * (1.0 + yd)) / (w - yd));
+            const complex<double> li2_34 = dilog((-1.0 + yd) / (w + yd));
+            const complex<double> ln_42 = log((1.0 + yd) / (1.0 - w));
+            const complex<double> ln_43 = log(-((w * (1.0 + yd)) / (1.0 + w)));
+            const complex<double> ln_44 = log((1.0 + yd) / (1.0 - yd));
+            const complex<double> li2_35 = dilog((1.0 + w) / (1.0 - w));
+            const complex<double> li2_36 = dilog(1.0 - yd);
+            const complex<double> li2_37 = dilog(yd / (-1.0 + yd));
+            const complex<double> li2_38 = dilog(yd / (1.0 + yd));
+            const complex<double> li2_39 = dilog(1.0 + yd);
+            const complex<double> ln_45 = log(-((1.0 + yd) / (w - yd)));
+            const complex<double> ln_46 = log((w * (1.0 + yd)) / (w - yd));
+            const complex<double> ln_47 = log((w * (1.0 + yd)) / ((-1.0 + w) * yd));
+            const complex<double> ln_48 = log(1.0 / (-w + yd));
+            const complex<double> ln_49 = log(-1.0 / (w + yd));
+            const complex<double> ln_50 = log(1.0 / (w + yd));
+            const complex<double> ln_51 = log(w / (w + yd));
+            const complex<double> ln_52 = log((1.0 + w) / (w + yd));
+            const complex<double> ln_53 = log((-1.0 + yd) / (w + yd));
+            const complex<double> ln_54 = log((w - yd) / (-1.0 + w));
+            const complex<double> ln_55 = log(ydinv);
+            const complex<double> ln_56 = log(((1.0 + w) * yd) / (w + yd));
+            const complex<double> ln_57 = log((w * (1.0 + yd)) / (w + yd));
+            const complex<double> ln_58 = log((w + yd) / (-1.0 + w));
+            const complex<double> ln_59 = log(((1.0 + w) * yd) / (-w + yd));
+            const complex<double> ln_60 = log((w + yd) / w);
+            const complex<double> ln_61 = log(1.0 / (1.0 + w));
+            const complex<double> ln_62 = log(w / (1.0 + yd));
+            const complex<double> li2_40 = dilog((w + yd) / (-1.0 + yd));
+            const complex<double> ln_63 = log((-1.0 + w) / (w + yd));
+            const complex<double> ln_64 = log(((-1.0 + w) * yd) / (w * (1.0 + yd)));
+            const complex<double> li2_41 = dilog((w + yd) / (w + w * yd));
+            const complex<double> li2_42 = dilog(((-1.0 + w) * yd) / (w * (1.0 + yd)));
+            const complex<double> ln_65 = log(-(yd / w));
+            const complex<double> li2_43 = dilog((w * (1.0 + yd)) / (w + yd));
+            const complex<double> ln_66 = log((w + yd) / (1.0 + w));
+            const complex<double> li2_44 = dilog((w + yd) / (w - w * yd));
+            const complex<double> ln_67 = log(1.0 - yd / w);
+            const complex<double> ln_68 = log(-ydinv);
+            const complex<double> li2_45 = dilog((-w + yd) / (1.0 + yd));
+            const complex<double> ln_69 = log((-1.0 + w) / (w - yd));
+            const complex<double> ln_70 = log(((-1.0 + w) * yd) / (w - yd));
+            const complex<double> ln_71 = log(-2.0 / (-1.0 + yd));
+            const complex<double> li2_46 = dilog(2.0 / (1.0 + w));
+            const complex<double> li2_47 = dilog((2.0 * w) / (1.0 + w));
+            const complex<double> li2_48 = dilog((-1.0 + w) / (2.0 * w));
+            const complex<double> li2_49 = dilog((1.0 - yd) / 2.0);
+            const complex<double> li2_50 = dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd)));
+            const complex<double> li2_51 = dilog((1.0 - w) / (1.0 + w));
+            const complex<double> li2_52 = dilog(((-1.0 + w) * yd) / (w - yd));
+            const complex<double> li2_53 = dilog((w - yd) / (w + w * yd));
+            const complex<double> li2_54 = dilog((w - w * yd) / (w - yd));
+            const complex<double> ln_72 = log(yd / w);
+            const complex<double> li2_55 = dilog((w - yd) / (w - w * yd));
+            const complex<double> ln_73 = log(((-1.0 + w) * yd) / (w * (-1.0 + yd)));
+            const complex<double> li2_56 = dilog((-1.0 + yd) / (1.0 + yd));
+            const complex<double> li2_57 = dilog(w);
+            const complex<double> ln_74 = log((-1.0 + w) / (-1.0 + yd));
+            const complex<double> ln_75 = log((w - yd) / (w - w * yd));
+            const complex<double> ln_76 = log((w + yd) / (w - w * yd));
+            const complex<double> ln_77 = log((1.0 - yd) / (1.0 + w));
+            const complex<double> li2_58 = dilog((w + yd) / (1.0 + w));
+            const complex<double> ln_78 = log((w - w * yd) / (w - yd));
+            const complex<double> ln_79 = log((w - w * yd) / (w + yd));
+            const complex<double> ln_80 = log(w / (yd - w * yd));
+            const complex<double> ln_81 = log((w + yd) / (yd - w * yd));
+            const complex<double> ln_82 = log((w - yd) / (w + w * yd));
+            const complex<double> ln_83 = log((1.0 + yd) / (1.0 + w));
+            const complex<double> li2_59 = dilog((w - yd) / (1.0 + w));
+            const complex<double> li2_60 = dilog(1.0 + winv);
+            const complex<double> li2_61 = dilog(1.0 - yd / w);
+            const complex<double> ln_84 = log((w + yd) / (w + w * yd));
+            const complex<double> li2_62 = dilog((w + yd) / w);
+            const complex<double> ln_85 = log((w + w * yd) / (yd + w * yd));
+            const complex<double> ln_86 = log(1.0 - winv * winv);
+            const complex<double> ln_87 = log(-1.0 + 2.0 / w);
+            const complex<double> ln_88 = log(1.0 - power_of<2>(w));
+            const complex<double> ln_89 = log(-((-2.0 + w) * w));
+            const complex<double> ln_90 = log(((-1.0 + w) * yd) / w);
+            const complex<double> ln_91 = log(-w + yd);
+            const complex<double> ln_92 = log(1.0 - power_of<2>(w) / yd2);
+            const complex<double> ln_93 = log(w + yd);
+            const complex<double> li2_63 = dilog(-(yd / (w - yd)));
+            const complex<double> li2_64 = dilog(1.0 - w);
+            const complex<double> ln_94 = log(-w - yd);
+            const complex<double> ln_95 = log((-1.0 + winv) * yd);
+            const complex<double> ln_96 = log(w - yd);
+            const complex<double> li2_65 = dilog(yd / (w + yd));
+            const complex<double> ln_97 = log(1.0 - ydinv * ydinv);
+            const complex<double> ln_98 = log((-1.0 + yd) / w);
+            const complex<double> li2_66 = dilog((-1.0 + w) / w);
+            const complex<double> ln_99 = log((w + yd) / (-1.0 + yd));
+            const complex<double> ln_100 = log(((1.0 + w) * yd) / (w * (-1.0 + yd)));
+            const complex<double> ln_101 = log(-((1.0 + yd) / w));
+            const complex<double> ln_102 = log((-w + yd) / (1.0 + yd));
+            const complex<double> ln_103 = log((yd + w * yd) / (w + w * yd));
+            const complex<double> ln_104 = log((1.0 + w) / (w - w * yd));
+            const complex<double> ln_105 = log((1.0 + w) / (w + w * yd));
+            const complex<double> ln_106 = log(1.0 - w / yd);
+            const complex<double> ln_107 = log((w + yd) / yd);
+            const complex<double> li2_67 = dilog(-w);
+            const complex<double> li2_68 = dilog(-1.0);
+            const complex<double> li2_69 = dilog(1.0 / (1.0 - yd));
+            const complex<double> ln_108 = log(-1.0 / (1.0 + w));
+            const complex<double> ln_109 = log(1.0);
+            const complex<double> ln_110 = log(1.0 + ydinv);
+            const complex<double> ln_111 = log((-1.0 + yd) / yd);
+            const complex<double> ln_112 = log(yd / (w + yd));
+            const complex<double> ln_113 = log((yd - w * yd) / (w + yd));
+            const complex<double> li2_70 = dilog((1.0 - w) / 2.0);
+            const complex<double> ln_114 = log(-(yd / (w - yd)));
+            const complex<double> li2_71 = dilog((1.0 + w) / 2.0);
+            const complex<double> li2_72 = dilog(winv);
+            const complex<double> li2_73 = dilog(-winv);
+            const complex<double> li2_74 = dilog(w / (1.0 + w));
+            const complex<double> li2_75 = dilog((1.0 + w) / (-1.0 + w));
+            const complex<double> ln_115 = log(-2.0 / (-1.0 + w));
+            const complex<double> ln_116 = log((1.0 - w) / (1.0 + w));
+            const complex<double> ln_117 = log((2.0 * w) / (1.0 + w));
+            const complex<double> ln_118 = log((1.0 + w) / 2.0);
+            const complex<double> ln_119 = log(-2.0 / w);
+            const complex<double> ln_120 = log((-0.5) * (1.0 / w));
+            const complex<double> ln_121 = log(1.0 / (2.0 * w));
+            const complex<double> ln_122 = log(2.0 / w);
+            const complex<double> ln_123 = log(w / 2.0);
+            const complex<double> ln_124 = log((2.0 * w) / (-1.0 + w));
+            const complex<double> ln_125 = log((2.0 * (-1.0 + w)) / (1.0 + w));
+            const complex<double> ln_126 = log((2.0 * (1.0 + w)) / (-1.0 + w));
+            const complex<double> ln_127 = log((-1.0 + power_of<2>(w)) / (2.0 * w));
+            const complex<double> ln_128 = log((-0.5) * w);
+            const complex<double> ln_129 = log(-(w / (1.0 + w)));
+
+            const complex<double> part1 = (-2.0 * power_of<4>(M_PI)) / 9.0 - 6.0 * power_of<2>(li2_1) + 2.0 * power_of<2>(li2_2) + li2_3 * (li2_4 + li2_5) + 16.0 * quadlog(0.5) - 24.0 * quadlog(1.0 + winv) + 8.0 * quadlog(1.0 / (1.0 - w)) + 16.0 * quadlog(1.0 - w) - 24.0 * quadlog(-winv) + 16.0 * quadlog(winv) + 16.0 * quadlog((-1.0 + w) / w) + 16.0 * quadlog(w) + 8.0 * quadlog(w / (-1.0 + w)) + 28.0 * quadlog(1.0 / (1.0 + w)) + 12.0 * quadlog(1.0 + w) - 8.0 * quadlog((1.0 - yd) / 2.0) - 16.0 * quadlog(1.0 - yd) + 4.0 * quadlog((w - yd) / (-1.0 + w)) + 4.0 * quadlog((-1.0 + yd) / (-1.0 + w))
                 - 28.0 * quadlog(-yd) - 28.0 * quadlog(yd) + 4.0 * quadlog(-(yd / w)) + 4.0 * quadlog(yd / w) + 4.0 * quadlog(-(yd / (w - yd))) + 4.0 * quadlog(((-1.0 + w) * yd) / (w - yd)) - 12.0 * quadlog(yd / (-1.0 + yd)) - 8.0 * quadlog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) - 4.0 * quadlog(((1.0 + w) * yd) / (w * (-1.0 + yd))) - 12.0 * quadlog(yd / (1.0 + yd)) - 8.0 * quadlog(((-1.0 + w) * yd) / (w * (1.0 + yd))) - 8.0 * quadlog((1.0 + yd) / 2.0) - 16.0 * quadlog(1.0 + yd) + 4.0 * quadlog((1.0 + yd) / (1.0 - w)) + 4.0 * quadlog(yd / (w + yd)) + 4.0 * quadlog((w + yd) / (-1.0 + w)) + 8.0 * quadlog((w + yd) / w) + 8.0 * quadlog(1.0 - yd / w)
                 + 4.0 * quadlog((yd - w * yd) / (w + yd)) - 4.0 * quadlog((yd + w * yd) / (w + w * yd)) - 2.0 * li22(-1.0, -yd) - 2.0 * li22(-1.0, yd) - 4.0 * li22(0.5, -2.0 / (-1.0 + w)) - 2.0 * li22(0.5, (-1.0 + w) / w) - 14.0 * li22(0.5, 2.0 / (1.0 + w)) + 10.0 * li22(0.5, 1.0 + w) + li22(0.5, (2.0 * w) / (w - yd)) - li22(0.5, (-2.0 * yd) / (w - yd)) + 4.0 * li22(0.5, (2.0 * yd) / (-1.0 + yd)) + 4.0 * li22(0.5, (2.0 * yd) / (1.0 + yd)) + li22(0.5, (2.0 * w) / (w + yd)) - li22(0.5, (2.0 * yd) / (w + yd)) + 4.0 * li22(1.0 / (1.0 - w), 2.0) + 4.0 * li22(1.0 / (1.0 - w), (1.0 - w) / 2.0) + 4.0 * li22(1.0 / (1.0 - w), 1.0 + w)
                 + 2.0 * li22(1.0 / (1.0 - w), 1.0 - yd) - li22(1.0 / (1.0 - w), -(((-1.0 + w) * yd) / (-1.0 + yd))) + 2.0 * li22(1.0 / (1.0 - w), 1.0 + yd) - li22(1.0 / (1.0 - w), (yd - w * yd) / (1.0 + yd)) + li22((1.0 - w) / 2.0, (-2.0 * yd) / (w - yd)) + li22((1.0 - w) / 2.0, (2.0 * yd) / (w + yd)) - 4.0 * li22(-2.0 / (-1.0 + w), 0.5) + 2.0 * li22(-2.0 / (-1.0 + w), (1.0 - yd) / 2.0) + li22(-2.0 / (-1.0 + w), -(((-1.0 + w) * yd) / (-1.0 + yd))) + 2.0 * li22(-2.0 / (-1.0 + w), (1.0 + yd) / 2.0) + li22(-2.0 / (-1.0 + w), (yd - w * yd) / (1.0 + yd)) - 2.0 * li22(-winv, -yd) - 2.0 * li22(-winv, yd) + 2.0 * li22(winv, -yd)
@@ -89,321 +297,321 @@ namespace eos
                 + li22((w * (1.0 + yd)) / (w - yd), (w - yd) / (2.0 * w)) - 2.0 * li22((1.0 + yd) / (-1.0 + yd), yd / (1.0 + yd)) + 2.0 * li22((1.0 + yd) / (-1.0 + yd), (yd + w * yd) / (w + w * yd)) + li22(((1.0 + w) * yd) / (-w + yd), 1.0 / (1.0 + w)) - li22(((1.0 + w) * yd) / (-w + yd), (1.0 - w) / (1.0 + w)) - li22((-w + yd) / (1.0 + yd), (-2.0 * yd) / (w - yd)) + li22((-w + yd) / (1.0 + yd), -(yd / (w - yd))) - li22(w / (w + yd), (w + yd) / (2.0 * w)) + li22((-1.0 + yd) / (w + yd), yd / (-1.0 + yd)) - li22((-1.0 + yd) / (w + yd), -(((-1.0 + w) * yd) / (-1.0 + yd)))
                 + 2.0 * li22(yd / (w + yd), 1.0 - w) - li22(yd / (w + yd), 1.0 + w) - li22(yd / (w + yd), (-1.0 + yd) / yd) + li22(yd / (w + yd), (w + yd) / (2.0 * yd)) + li22(yd / (w + yd), (w + yd) / (yd + w * yd)) + li22(((1.0 + w) * yd) / (w + yd), 1.0 / (1.0 + w)) - li22(((1.0 + w) * yd) / (w + yd), (1.0 - w) / (1.0 + w)) - li22((w + yd) / (-1.0 + w), (-1.0 + w) / (1.0 + w)) - li22((w + yd) / (-1.0 + w), (1.0 - w) / (w * (-1.0 + yd))) + 2.0 * li22((w + yd) / (-1.0 + w), w / (w + yd)) + li22((w + yd) / (-1.0 + w), (2.0 * w) / (w + yd))
                 + li22((w + yd) / (-1.0 + w), (1.0 + w) / (w + yd)) + li22((w + yd) / (1.0 + w), (1.0 + w) / (-1.0 + w)) + li22((w + yd) / (-1.0 + yd), yd / (w + yd)) - li22((w + yd) / (-1.0 + yd), (2.0 * yd) / (w + yd)) + li22((w + yd) / (w - w * yd), -((w * (-1.0 + yd)) / (-1.0 + w))) + li22((w - w * yd) / (w + yd), (w + yd) / (2.0 * w)) + 2.0 * li22((yd - w * yd) / (w + yd), 1.0 / (1.0 - w)) + li22((yd - w * yd) / (w + yd), (1.0 + w) / (1.0 - w)) + li22((yd - w * yd) / (w + yd), (1.0 - yd) / ((-1.0 + w) * yd)) - li22((yd - w * yd) / (w + yd), (w + yd) / (2.0 * yd))
-                - li22((yd - w * yd) / (w + yd), (w + yd) / (yd + w * yd)) + li22((w - yd) / (w + w * yd), (w * (1.0 + yd)) / (-1.0 + w)) - 3.0 * li22((yd + w * yd) / (w + w * yd), w / (1.0 + w)) + 3.0 * li22((yd + w * yd) / (w + w * yd), (2.0 * w) / (1.0 + w)) - 2.0 * li22((yd + w * yd) / (w + w * yd), (w * (-1.0 + yd)) / ((1.0 + w) * yd)) + 2.0 * li22((yd + w * yd) / (w + w * yd), (1.0 + yd) / (2.0 * yd)) + (2.0 * pisqu * lnm1 * log(1.0 + winv)) / 3.0 + (2.0 * power_of<3>(lnm1) * log(1.0 + winv)) / 3.0 - 2.0 * lnm1 * ln2squ * log(1.0 + winv) - (4.0 * pisqu * power_of<2>(log(1.0 / (1.0 - w)))) / 3.0;
+                - li22((yd - w * yd) / (w + yd), (w + yd) / (yd + w * yd)) + li22((w - yd) / (w + w * yd), (w * (1.0 + yd)) / (-1.0 + w)) - 3.0 * li22((yd + w * yd) / (w + w * yd), w / (1.0 + w)) + 3.0 * li22((yd + w * yd) / (w + w * yd), (2.0 * w) / (1.0 + w)) - 2.0 * li22((yd + w * yd) / (w + w * yd), (w * (-1.0 + yd)) / ((1.0 + w) * yd)) + 2.0 * li22((yd + w * yd) / (w + w * yd), (1.0 + yd) / (2.0 * yd)) + (2.0 * pisqu * lnm1 * ln_1) / 3.0 + (2.0 * power_of<3>(lnm1) * ln_1) / 3.0 - 2.0 * lnm1 * ln2squ * ln_1 - (4.0 * pisqu * power_of<2>(ln_2)) / 3.0;
 
-            const complex<double> part2 = + (4.0 * power_of<4>(log(1.0 / (1.0 - w)))) / 3.0 - (2.0 * pisqu * lnm1 * log(1.0 - w)) / 3.0 - (2.0 * power_of<3>(lnm1) * log(1.0 - w)) / 3.0 + 2.0 * lnm1 * ln2squ * log(1.0 - w) - (4.0 * pisqu * log(1.0 / (1.0 - w)) * log(1.0 - w)) / 3.0 - (4.0 * power_of<3>(log(1.0 / (1.0 - w))) * log(1.0 - w)) / 3.0 + (2.0 * pisqu * ln2 * log(winv)) / 3.0 - 2.0 * ln2 * power_of<2>(log(1.0 - w)) * log(winv) + (2.0 * ln2 * power_of<3>(log(winv))) / 3.0 + dilog((-1.0 + w) / (w - yd)) * (4.0 * ln2 * log((-1.0 + w) / w) + 4.0 * log(1.0 + winv) * log((-1.0 + w) / w))
-                + dilog((-1.0 + w) / (w + yd)) * (4.0 * ln2 * log((-1.0 + w) / w) + 4.0 * log(1.0 + winv) * log((-1.0 + w) / w)) - (4.0 * pisqu * log((-1.0 + w) / w) * log(-w)) / 3.0 + 4.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / w) * log(-w) + 2.0 * pisqu * power_of<2>(log(-w)) + 4.0 * log(-1.0 - w) * power_of<3>(log(-w)) - (4.0 * log((-1.0 + w) / w) * power_of<3>(log(-w))) / 3.0 - 2.0 * power_of<4>(log(-w)) - (4.0 * pisqu * ln2 * log(w)) / 3.0 - (4.0 * pisqu * log(1.0 + winv) * log(w)) / 3.0 + 4.0 * ln2 * power_of<2>(log((-1.0 + w) / w)) * log(w) + 4.0 * log(1.0 + winv) * power_of<2>(log((-1.0 + w) / w)) * log(w)
-                + 4.0 * log(1.0 / (1.0 - w)) * log(1.0 - w) * power_of<2>(log(w)) - (4.0 * ln2 * power_of<3>(log(w))) / 3.0 - (4.0 * log(1.0 + winv) * power_of<3>(log(w))) / 3.0 - (8.0 * power_of<3>(log(1.0 / (1.0 - w))) * log(w / (1.0 - w))) / 3.0 + (8.0 * pisqu * log((-1.0 + w) / w) * log(w / (-1.0 + w))) / 3.0 - 8.0 * power_of<2>(log(winv)) * log((-1.0 + w) / w) * log(w / (-1.0 + w)) - (4.0 * pisqu * power_of<2>(log(w / (-1.0 + w)))) / 3.0 - (8.0 * log(1.0 / (-1.0 + w)) * power_of<3>(log(w / (-1.0 + w)))) / 3.0 + (8.0 * log((-1.0 + w) / w) * power_of<3>(log(w / (-1.0 + w)))) / 3.0 + (4.0 * power_of<4>(log(w / (-1.0 + w)))) / 3.0 + (4.0 * pisqu * log(1.0 + winv) * log(w / (1.0 + w))) / 3.0
-                - 4.0 * log(1.0 + winv) * power_of<2>(log(-winv)) * log(w / (1.0 + w)) + (4.0 * log(1.0 + winv) * power_of<3>(log(w / (1.0 + w)))) / 3.0 + (2.0 * pisqu * log(winv) * log(1.0 + w)) / 3.0 - 2.0 * power_of<2>(log(1.0 - w)) * log(winv) * log(1.0 + w) + (2.0 * power_of<3>(log(winv)) * log(1.0 + w)) / 3.0 + trilog(-(w / yd)) * (2.0 * ln2 + 2.0 * log(1.0 + w)) + trilog(w / yd) * (2.0 * ln2 + 2.0 * log(1.0 + w)) + dilog((-1.0 + w) / (-1.0 + yd)) * (-2.0 * ln2 * log(1.0 - w) - 2.0 * log(1.0 - w) * log(1.0 + w)) + dilog((1.0 - w) / (1.0 + yd)) * (-2.0 * ln2 * log(1.0 - w) - 2.0 * log(1.0 - w) * log(1.0 + w))
-                - 2.0 * power_of<4>(log(1.0 / (1.0 - yd))) + trilog(ydinv) * (-4.0 * ln2 - 2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) - 4.0 * ln1myd) + trilog(yd / w) * (6.0 * ln2 + 4.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 4.0 * ln1myd) + 4.0 * trilog(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd + 8.0 * trilog(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd + 4.0 * trilog((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) * ln1myd + 4.0 * trilog(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) * ln1myd
-                + 8.0 * trilog((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd + 8.0 * trilog((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd - 2.0 * dilog((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * ln2 * ln1myd - 2.0 * dilog((1.0 + w) / (1.0 + yd)) * log(1.0 + winv) * ln1myd + dilog(w / yd) * (2.0 * ln2 + 2.0 * log(1.0 + w)) * ln1myd - 4.0 * dilog(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) * log((1.0 - yd) / 2.0) * ln1myd - 4.0 * dilog((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) * log((1.0 - yd) / 2.0) * ln1myd
-                + trilog((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * (2.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 2.0 * ln1myd) + trilog((w + yd) / (yd - w * yd)) * (-8.0 * log((-1.0 + w) / w) + 4.0 * ln1myd) + dilog((1.0 + w) / (w - yd)) * (4.0 * log(1.0 + winv) * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) * ln1myd) + (2.0 * power_of<4>(log(w / (w - yd)))) / 3.0 - (2.0 * pisqu * log(1.0 - w) * log((w - yd) / ((-1.0 + w) * w))) / 3.0 - (2.0 * log(1.0 - w) * power_of<3>(log((w - yd) / ((-1.0 + w) * w)))) / 3.0 + (4.0 * pisqu * log((-1.0 + w) / w) * log((w * (-1.0 + yd)) / (-1.0 + w))) / 3.0
-                + (4.0 * log((-1.0 + w) / w) * power_of<3>(log((w * (-1.0 + yd)) / (-1.0 + w)))) / 3.0 + (2.0 * pisqu * log(1.0 + winv) * log((w * (-1.0 + yd)) / (1.0 + w))) / 3.0 + (2.0 * log(1.0 + winv) * power_of<3>(log((w * (-1.0 + yd)) / (1.0 + w)))) / 3.0 + (2.0 * log(1.0 - w) * power_of<3>(log((w - yd) / ((-1.0 + w) * yd)))) / 3.0 - (4.0 * log((-1.0 + w) / w) * power_of<3>(log((w * (-1.0 + yd)) / ((-1.0 + w) * yd)))) / 3.0 - (2.0 * log(1.0 + winv) * power_of<3>(log((w * (-1.0 + yd)) / ((1.0 + w) * yd)))) / 3.0 + ((-1.0 / 3.0) * (pisqu * log(1.0 + winv)) + (pisqu * log(1.0 - w)) / 3.0) * log(yd / (1.0 - yd)) + ((-1.0 / 3.0) * log(1.0 + winv) + log(1.0 - w) / 3.0) * power_of<3>(log(yd / (1.0 - yd)))
-                + ((2.0 * pisqu * ln2) / 3.0 + (2.0 * pisqu * log(1.0 + winv)) / 3.0) * log(-((w * yd) / (w - yd))) + ((2.0 * ln2) / 3.0 + (2.0 * log(1.0 + winv)) / 3.0) * power_of<3>(log(-((w * yd) / (w - yd)))) - (2.0 * pisqu * log((-1.0 + w) / w) * log((w * yd) / (w - yd))) / 3.0 - (2.0 * log((-1.0 + w) / w) * power_of<3>(log((w * yd) / (w - yd)))) / 3.0 + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * log(1.0 + w)) / 3.0) * log(yd / (w * (-1.0 + yd))) + ((-1.0 / 3.0) * ln2 - log(1.0 + w) / 3.0) * power_of<3>(log(yd / (w * (-1.0 + yd)))) - 2.0 * power_of<4>(log(1.0 / (1.0 + yd))) + ((-2.0 * pisqu * ln2) / 3.0 - pisqu * log(1.0 + winv)) * log(-(w / (1.0 + yd)))
-                + ((-2.0 * ln2) / 3.0 - log(1.0 + winv)) * power_of<3>(log(-(w / (1.0 + yd)))) + trilog((-w + yd) / (1.0 + yd)) * (2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 6.0 * ln1myd - 2.0 * log(1.0 / (1.0 + yd)) + 2.0 * log((1.0 - yd) / (1.0 + yd))) + ((-1.0 / 3.0) * (pisqu * log(1.0 + winv)) + (pisqu * log(1.0 - w)) / 3.0) * log(-(yd / (1.0 + yd))) + ((-1.0 / 3.0) * log(1.0 + winv) + log(1.0 - w) / 3.0) * power_of<3>(log(-(yd / (1.0 + yd)))) + 2.0 * dilog(w / (w + yd)) * ln1myd * log((1.0 + yd) / 2.0)
-                + dilog((1.0 - yd) / (1.0 + w)) * ((2.0 * pisqu) / 3.0 + 2.0 * dilog(-yd) - 4.0 * dilog(1.0 / (1.0 + yd)) + 2.0 * dilog((1.0 - yd) / (1.0 + yd)) + 2.0 * power_of<2>(ln1myd) + ln1myd * (-4.0 * lnhalf + 2.0 * ln2 + 4.0 * log((1.0 - yd) / 2.0) + 4.0 * log(yd / (1.0 + yd)) - 4.0 * ln1pyd)) + dilog((w - w * yd) / (w + yd)) * (4.0 * power_of<2>(ln1myd) + ln1myd * (2.0 * ln2 - 2.0 * ln1pyd)) + trilog((-1.0 + yd) / (-1.0 + w)) * (4.0 * lnhalf - 2.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) - 4.0 * log(w / (-1.0 + w)) + 4.0 * ln1myd - 18.0 * ln1pyd)
-                + trilog(1.0 + w) * (-8.0 * log((-1.0 + w) / w) + 24.0 * log(-w) - 8.0 * ln1myd - 8.0 * ln1pyd) + trilog((yd + w * yd) / (w + w * yd)) * (-4.0 * lnhalf - 4.0 * log(1.0 + winv) - 2.0 * ln1myd + 6.0 * log(1.0 / (1.0 + yd)) - 2.0 * log((1.0 - yd) / (1.0 + yd)) - 8.0 * ln1pyd) + trilog((-w + yd) / (-1.0 + yd)) * (-4.0 * ln2 - 6.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) + 4.0 * ln1myd - 6.0 * ln1pyd) + trilog(-ydinv) * (-4.0 * ln2 - 2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) - 4.0 * ln1pyd)
-                + trilog(-(yd / w)) * (6.0 * ln2 + 4.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 4.0 * ln1pyd) + trilog((w + yd) / (w + w * yd)) * (4.0 * ln2 + 6.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) - 2.0 * ln1myd - 4.0 * ln1pyd) + trilog(w / (w - yd)) * (8.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 2.0 * log((1.0 - yd) / 2.0) - 2.0 * ln1myd - 4.0 * ln1pyd)
-                + trilog((w * (1.0 + yd)) / (w - yd)) * (-2.0 * ln2 - 4.0 * log(1.0 + winv) - 2.0 * log((1.0 - yd) / 2.0) + 2.0 * ln1myd - 4.0 * ln1pyd) + trilog((-1.0 + w) / (w - yd)) * (-4.0 * ln2 - 4.0 * log(1.0 + winv) + 4.0 * ln1myd - 4.0 * ln1pyd) + trilog(1.0 - yd / w) * (-4.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 - w)) - 4.0 * log(1.0 - w) - 8.0 * log((-1.0 + w) / w) + 4.0 * ln1myd + 4.0 * log((-1.0 + yd) / (-1.0 + w)) - 4.0 * ln1pyd)
-                + trilog((1.0 + yd) / (1.0 + w)) * (4.0 * lnhalf - 2.0 * ln2 - 8.0 * log((1.0 - w) / 2.0) + 8.0 * log(-w) + 8.0 * log((-1.0 + w) / (1.0 + w)) + 4.0 * log(w / (1.0 + w)) - 6.0 * log((1.0 - yd) / 2.0) + 8.0 * ln1myd - 4.0 * log(-yd) - 4.0 * log(yd / (-1.0 + yd)) - 4.0 * ln1pyd) + trilog((w - yd) / (w - w * yd)) * (4.0 * ln2 + 6.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) - 4.0 * ln1myd - 2.0 * ln1pyd) + trilog(w / (w + yd)) * (8.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) - 4.0 * ln1myd + 2.0 * log((1.0 + yd) / 2.0) - 2.0 * ln1pyd)
-                + power_of<3>(log(-(w / yd))) * ((4.0 * ln2) / 3.0 + log(1.0 + winv) + (2.0 * log((-1.0 + w) / w)) / 3.0 - ln1pyd) + power_of<3>(log(w / yd)) * ((4.0 * ln2) / 3.0 + log(1.0 + winv) + (2.0 * log((-1.0 + w) / w)) / 3.0 - ln1pyd) + power_of<3>(log(w / ((-1.0 + w) * yd))) * (log(1.0 + winv) / 3.0 + ln1pyd / 3.0) + power_of<3>(log(1.0 / (w - yd))) * (ln2 / 3.0 + (2.0 * ln1pyd) / 3.0) + power_of<3>(log(w / (-1.0 + yd))) * ((-2.0 * ln2) / 3.0 - log(1.0 + winv) + (2.0 * ln1pyd) / 3.0) + 8.0 * trilog((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) * ln1pyd
-                + 4.0 * trilog((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd))) * ln1pyd + 8.0 * trilog((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) * ln1pyd + 8.0 * trilog(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) * ln1pyd + 4.0 * trilog(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) * ln1pyd + 4.0 * trilog(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) * ln1pyd + 4.0 * trilog(yd / (-w + yd)) * ln1pyd - 2.0 * dilog((w + w * yd) / (yd + w * yd)) * ln2 * ln1pyd - 2.0 * dilog((1.0 + w) / (1.0 - yd)) * log(1.0 + winv) * ln1pyd
-                + dilog(-(w / yd)) * (2.0 * ln2 + 2.0 * log(1.0 + w)) * ln1pyd - 8.0 * dilog((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) * log((w - yd) / (1.0 + w)) * ln1pyd - 8.0 * dilog((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) * log((w - yd) / (1.0 + w)) * ln1pyd - 4.0 * dilog(yd / (-w + yd)) * log(-yd) * ln1pyd + ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(log((1.0 - yd) / 2.0)) - 2.0 * power_of<2>(log((-1.0 + yd) / (-1.0 + w)))) * log(2.0 / (1.0 + yd)) * ln1pyd - (2.0 * power_of<3>(log(2.0 / (1.0 + yd))) * ln1pyd) / 3.0 + (4.0 * power_of<3>(log((1.0 - w) / (1.0 + yd))) * ln1pyd) / 3.0
-                - 4.0 * dilog(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) * log((1.0 + yd) / 2.0) * ln1pyd - 4.0 * dilog(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) * log((1.0 + yd) / 2.0) * ln1pyd + (2.0 * log((w - yd) / (1.0 + w)) - 2.0 * log((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) - 2.0 * log((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd)))) * power_of<2>(log((1.0 + yd) / 2.0)) * ln1pyd + trilog((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * (2.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 2.0 * ln1pyd)
-                + trilog((w - w * yd) / (w + yd)) * (-2.0 * ln2 - 4.0 * log(1.0 + winv) - 4.0 * ln1myd - 2.0 * log((1.0 + yd) / 2.0) + 2.0 * ln1pyd) + trilog((w - yd) / ((-1.0 + w) * yd)) * (-8.0 * log((-1.0 + w) / w) + 4.0 * ln1pyd) + trilog((1.0 + yd) / (1.0 - w)) * (4.0 * lnhalf - 2.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) - 4.0 * log(w / (-1.0 + w)) - 18.0 * ln1myd + 4.0 * ln1pyd) + trilog((w + yd) / (1.0 + yd)) * (-4.0 * ln2 - 6.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) - 6.0 * ln1myd + 4.0 * ln1pyd)
-                + trilog((-1.0 + w) / (w + yd)) * (-4.0 * ln2 - 4.0 * log(1.0 + winv) - 4.0 * ln1myd + 4.0 * ln1pyd) + trilog((w - yd) / (1.0 + w)) * (4.0 * ln2 + 4.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 2.0 * log((-1.0 + yd) / (-1.0 + w)) + 4.0 * ln1pyd) + trilog((w - yd) / (w + w * yd)) * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 6.0 * ln1myd - 2.0 * log((-1.0 + yd) / (-1.0 + w)) + 4.0 * ln1pyd)
-                + trilog((1.0 - yd) / (1.0 + w)) * (4.0 * lnhalf - 2.0 * ln2 - 8.0 * log((1.0 - w) / 2.0) + 8.0 * log(-w) + 8.0 * log((-1.0 + w) / (1.0 + w)) + 4.0 * log(w / (1.0 + w)) - 4.0 * ln1myd - 4.0 * log(yd) - 4.0 * log(yd / (1.0 + yd)) - 6.0 * log((1.0 + yd) / 2.0) + 8.0 * ln1pyd) + log(w / ((-1.0 + w) * yd)) * ((pisqu * log(1.0 + winv)) / 3.0 + (pisqu * ln1pyd) / 3.0) + log(1.0 / (w - yd)) * ((pisqu * ln2) / 3.0 + (2.0 * pisqu * ln1pyd) / 3.0) + log(w / (-1.0 + yd)) * ((-2.0 * pisqu * ln2) / 3.0 - pisqu * log(1.0 + winv) + (2.0 * pisqu * ln1pyd) / 3.0)
-                + dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) * ((2.0 * pisqu) / 3.0 - 2.0 * dilog((1.0 + yd) / (-1.0 + yd)) + 4.0 * lnhalf * log(1.0 + winv) + 2.0 * power_of<2>(log(1.0 + winv)) + 8.0 * ln1myd * log(yd) + 2.0 * log(1.0 + winv) * ln1pyd) + dilog((1.0 + w) / (w + yd)) * (4.0 * log(1.0 + winv) * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) * ln1pyd) + dilog(((1.0 + w) * yd) / (w + yd)) * (dilog((yd - w * yd) / (w + yd)) - 4.0 * log(1.0 + winv) * log((-1.0 + w) / w) + 4.0 * ln1myd * log(yd) + 2.0 * log(1.0 + w) * ln1pyd)
-                + dilog(w / (w - yd)) * (-2.0 * dilog(yd) + 2.0 * dilog((1.0 + yd) / 2.0) + 2.0 * log((1.0 - yd) / 2.0) * ln1pyd) + dilog(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) * (-12.0 * log((1.0 - yd) / 2.0) * ln1pyd + 4.0 * log((-1.0 + yd) / (-1.0 + w)) * ln1pyd) + dilog((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd))) * (-8.0 * log((1.0 - yd) / 2.0) * ln1pyd + 4.0 * log((-1.0 + yd) / (-1.0 + w)) * ln1pyd) + dilog(((1.0 + w) * yd) / (-w + yd)) * (-4.0 * log(1.0 + winv) * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) * ln1myd + 4.0 * log(-yd) * ln1pyd)
-                + dilog((yd + w * yd) / (w + w * yd)) * ((2.0 * pisqu) / 3.0 + 4.0 * lnhalf * log(1.0 + winv) + 2.0 * power_of<2>(log(1.0 + winv)) + 2.0 * log(1.0 + winv) * ln1myd + 8.0 * log(-yd) * ln1pyd) + dilog(-2.0 / (-1.0 + w)) * (-2.0 * dilog((-1.0 + yd) / (-1.0 + w)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) - dilog((2.0 * yd) / (-1.0 + yd)) - dilog((2.0 * yd) / (1.0 + yd)) - 2.0 * dilog((1.0 + yd) / (1.0 - w)) - 8.0 * power_of<2>(ln1myd) - 8.0 * power_of<2>(ln1pyd))
-                + dilog(yd / w) * (6.0 * dilog((1.0 + yd) / 2.0) - 4.0 * dilog((1.0 + yd) / (1.0 - yd)) - 2.0 * power_of<2>(log(1.0 + winv)) - 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * log(1.0 + winv) * log((-1.0 + w) / (2.0 * w)) - 4.0 * power_of<2>(log((-1.0 + w) / w)) - 4.0 * log((-1.0 + w) / w) * log(2.0 / (1.0 + w)) - 2.0 * ln2 * log(1.0 + w) - 4.0 * log((-1.0 + w) / w) * log((1.0 + w) / (2.0 * w)) + 2.0 * power_of<2>(ln1myd) + ln1myd * (-4.0 * log(1.0 + winv) + 2.0 * log(1.0 + w) + 12.0 * log((1.0 + yd) / 2.0) - 4.0 * ln1pyd) + 6.0 * log((1.0 - yd) / 2.0) * ln1pyd + (-8.0 * log(-yd) - 4.0 * log((2.0 * yd) / (-1.0 + yd))) * ln1pyd
-                - 4.0 * power_of<2>(ln1pyd)) + dilog(-((1.0 + yd) / (w - yd))) * (-4.0 * log(1.0 + winv) * log(-winv) + (-2.0 * ln2 + 2.0 * ln1myd + 4.0 * log((1.0 + yd) / 2.0)) * ln1pyd - 4.0 * power_of<2>(ln1pyd)) + dilog(-(yd / w)) * (-4.0 * dilog((-1.0 + w) / (1.0 + w)) - 4.0 * dilog((1.0 + w) / (2.0 * w)) + 4.0 * dilog(1.0 / (1.0 + yd)) - 4.0 * dilog((1.0 - yd) / (1.0 + yd)) + 12.0 * dilog((1.0 + yd) / 2.0) - 2.0 * power_of<2>(log(1.0 + winv)) - 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * log(1.0 + winv) * log((-1.0 + w) / (2.0 * w)) - 4.0 * power_of<2>(log((-1.0 + w) / w)) - 4.0 * log((-1.0 + w) / w) * log(2.0 / (1.0 + w))
-                - 2.0 * ln2 * log(1.0 + w) - 4.0 * log((-1.0 + w) / w) * log((1.0 + w) / (2.0 * w)) - 4.0 * power_of<2>(ln1myd) + ln1myd * (-8.0 * log(yd) - 4.0 * log((2.0 * yd) / (1.0 + yd)) + 6.0 * log((1.0 + yd) / 2.0) - 4.0 * ln1pyd) + (-4.0 * log(1.0 + winv) + 2.0 * log(1.0 + w) + 12.0 * log((1.0 - yd) / 2.0)) * ln1pyd + 2.0 * power_of<2>(ln1pyd)) + dilog((1.0 + yd) / (1.0 + w)) * ((2.0 * pisqu) / 3.0 + 2.0 * dilog((1.0 + yd) / (1.0 - yd)) + (-4.0 * lnhalf + 2.0 * ln2 - 4.0 * ln1myd + 4.0 * log(yd / (-1.0 + yd)) + 4.0 * log((1.0 + yd) / 2.0)) * ln1pyd + 2.0 * power_of<2>(ln1pyd))
-                + dilog((w * (1.0 + yd)) / (w - yd)) * ((2.0 * ln2 - 2.0 * ln1myd) * ln1pyd + 4.0 * power_of<2>(ln1pyd)) + log((1.0 + w) / (w - yd)) * (-2.0 * log(1.0 + winv) * power_of<2>(log(-winv)) + 2.0 * power_of<2>(log((1.0 + yd) / 2.0)) * ln1pyd - ln2 * power_of<2>(ln1pyd) - 2.0 * power_of<3>(ln1pyd)) + dilog((-1.0 + yd) / (w + yd)) * (dilog((yd - w * yd) / (w + yd)) - 4.0 * log(1.0 + winv) * log(-winv) - 4.0 * power_of<2>(ln1myd) + ln1myd * (-2.0 * ln2 + 4.0 * log((1.0 - yd) / 2.0) + 2.0 * ln1pyd))
-                + trilog((w + yd) / (1.0 + w)) * (4.0 * ln2 + 4.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) + 4.0 * ln1myd - 2.0 * log((1.0 + yd) / (1.0 - w))) + trilog((w + yd) / (w - w * yd)) * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) + 4.0 * ln1myd - 6.0 * ln1pyd - 2.0 * log((1.0 + yd) / (1.0 - w))) + dilog(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd * (-12.0 * log((1.0 + yd) / 2.0) + 4.0 * log((1.0 + yd) / (1.0 - w))) + dilog(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) * ln1myd * (-8.0 * log((1.0 + yd) / 2.0) + 4.0 * log((1.0 + yd) / (1.0 - w)))
-                + trilog((w + yd) / w) * (-4.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 - w)) - 4.0 * log(1.0 - w) - 8.0 * log((-1.0 + w) / w) - 4.0 * ln1myd + 4.0 * ln1pyd + 4.0 * log((1.0 + yd) / (1.0 - w))) + (4.0 * pisqu * log((-1.0 + w) / w) * log(-((w * (1.0 + yd)) / (-1.0 + w)))) / 3.0 + (4.0 * log((-1.0 + w) / w) * power_of<3>(log(-((w * (1.0 + yd)) / (-1.0 + w))))) / 3.0 + (2.0 * pisqu * log(1.0 + winv) * log(-((w * (1.0 + yd)) / (1.0 + w)))) / 3.0 + (2.0 * log(1.0 + winv) * power_of<3>(log(-((w * (1.0 + yd)) / (1.0 + w))))) / 3.0
-                + trilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) * (-4.0 * lnhalf - 4.0 * log(1.0 + winv) + 6.0 * log(1.0 / (1.0 - yd)) - 8.0 * ln1myd - 2.0 * ln1pyd - 2.0 * log((1.0 + yd) / (1.0 - yd))) + trilog((w + yd) / (-1.0 + yd)) * (2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 / (1.0 - yd)) + 6.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - yd))) + trilog(1.0 / (1.0 - w)) * (-8.0 * lnhalf + 4.0 * log(1.0 + winv) + 16.0 * log((-1.0 + w) / w) - 8.0 * log(w / (-1.0 + w)) + 10.0 * ln1myd + 2.0 * log((1.0 - yd) / (1.0 + yd)) + 10.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - yd)))
-                + dilog(1.0 / (1.0 - w)) * ((4.0 * pisqu) / 3.0 - 4.0 * li2half + 4.0 * dilog(-2.0 / (-1.0 + w)) + 4.0 * dilog((1.0 + w) / (1.0 - w)) - 4.0 * dilog(1.0 - yd) - 2.0 * dilog((-1.0 + yd) / (-1.0 + w)) + 6.0 * dilog(-yd) + 6.0 * dilog(yd) - dilog(yd / (-1.0 + yd)) + 2.0 * dilog((2.0 * yd) / (-1.0 + yd)) - dilog(yd / (1.0 + yd)) + 2.0 * dilog((2.0 * yd) / (1.0 + yd)) - 4.0 * dilog(1.0 + yd) - 2.0 * dilog((1.0 + yd) / (1.0 - w)) - 16.0 * log(winv) * log((-1.0 + w) / w) - 4.0 * lnhalf * ln1myd + 4.0 * power_of<2>(ln1myd) + 2.0 * ln2 * log((1.0 - yd) / (1.0 + yd)) - 4.0 * lnhalf * ln1pyd
-                + 4.0 * power_of<2>(ln1pyd) + 2.0 * ln2 * log((1.0 + yd) / (1.0 - yd))) + 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / w) * log(-((1.0 + yd) / (w - yd))) - 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / w) * log((w * (1.0 + yd)) / (w - yd)) - (4.0 * log((-1.0 + w) / w) * power_of<3>(log((w * (1.0 + yd)) / ((-1.0 + w) * yd)))) / 3.0 + ((pisqu * ln2) / 3.0 + (pisqu * log(1.0 + w)) / 3.0) * log(1.0 / (-w + yd)) + (ln2 / 3.0 + log(1.0 + w) / 3.0) * power_of<3>(log(1.0 / (-w + yd))) + (2.0 * ln2 * power_of<2>(log((-1.0 + w) / w)) + 2.0 * log(1.0 + winv) * power_of<2>(log((-1.0 + w) / w))) * log((-1.0 + yd) / (-w + yd))
-                - (2.0 * pisqu * log(1.0 + winv) * log((w * yd) / (-w + yd))) / 3.0 - (2.0 * log(1.0 + winv) * power_of<3>(log((w * yd) / (-w + yd)))) / 3.0 + (-(ln2 * power_of<2>(log(1.0 - w))) - power_of<2>(log(1.0 - w)) * log(1.0 + w)) * log((-w + yd) / (-1.0 + yd)) + ((pisqu * ln2) / 3.0 + (pisqu * log(1.0 + w)) / 3.0) * log(-1.0 / (w + yd)) + (ln2 / 3.0 + log(1.0 + w) / 3.0) * power_of<3>(log(-1.0 / (w + yd))) + (pisqu * ln2 * log(1.0 / (w + yd))) / 3.0 + (ln2 * power_of<3>(log(1.0 / (w + yd)))) / 3.0 + (2.0 * power_of<4>(log(w / (w + yd)))) / 3.0 - 2.0 * log(1.0 + winv) * power_of<2>(log(-winv)) * log((1.0 + w) / (w + yd))
-                + 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / w) * log((-1.0 + yd) / (w + yd)) - (2.0 * pisqu * log((-1.0 + w) / w) * log(-((w * yd) / (w + yd)))) / 3.0 - (2.0 * log((-1.0 + w) / w) * power_of<3>(log(-((w * yd) / (w + yd))))) / 3.0 + (2.0 * pisqu * ln2 * log((w * yd) / (w + yd))) / 3.0 + (2.0 * ln2 * power_of<3>(log((w * yd) / (w + yd)))) / 3.0 + power_of<3>(ln1myd) * ((-2.0 * log((w - yd) / (-1.0 + w))) / 3.0 + 2.0 * log(ydinv) - 2.0 * log((1.0 + w) / (w + yd)) + 2.0 * log(((1.0 + w) * yd) / (w + yd))) + (2.0 * ln2 * power_of<2>(log((-1.0 + w) / w)) + 2.0 * log(1.0 + winv) * power_of<2>(log((-1.0 + w) / w))) * log((1.0 + yd) / (w + yd))
-                + trilog((-1.0 + yd) / (w + yd)) * (2.0 * ln2 + 4.0 * log(1.0 + winv) - 2.0 * ln1pyd - 2.0 * log(w / (w + yd)) + 2.0 * log((w * (1.0 + yd)) / (w + yd))) + trilog(((1.0 + w) * yd) / (w + yd)) * (4.0 * log((-1.0 + w) / w) - 4.0 * ln1myd - 2.0 * ln1pyd - 2.0 * log(w / (w + yd)) + 2.0 * log((w * (1.0 + yd)) / (w + yd))) + dilog((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * ((-2.0 * log(1.0 + winv) - 2.0 * ln1myd) * ln1pyd - 4.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)))
-                + dilog((1.0 + yd) / (1.0 - w)) * ((-2.0 * pisqu) / 3.0 + 4.0 * power_of<2>(ln1myd) + (-4.0 * lnhalf + 2.0 * log(1.0 + winv)) * ln1pyd - 2.0 * power_of<2>(ln1pyd) + ln1myd * (12.0 * log((1.0 + yd) / 2.0) + 2.0 * ln1pyd) + 4.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd))) + trilog(-2.0 / (-1.0 + w)) * (8.0 * log(w / (-1.0 + w)) + 8.0 * ln1myd - 4.0 * log((w - yd) / (-1.0 + w)) - 2.0 * log((1.0 - yd) / (1.0 + yd)) + 8.0 * ln1pyd - 2.0 * log((1.0 + yd) / (1.0 - yd)) - 4.0 * log((w + yd) / (-1.0 + w)))
-                + power_of<3>(ln1pyd) * (2.0 * log(((1.0 + w) * yd) / (-w + yd)) - (2.0 * log((w + yd) / (-1.0 + w))) / 3.0) + trilog((w * (1.0 + yd)) / (w + yd)) * (-2.0 * ln2 - 8.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 8.0 * ln1myd - 4.0 * log((w + yd) / w)) + trilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) * (-4.0 * lnhalf - 2.0 * ln2 - 8.0 * log((-1.0 + w) / w) - 4.0 * log(1.0 / (1.0 + w)) - 2.0 * log(1.0 + w) + 8.0 * log(1.0 / (1.0 + yd)) - 4.0 * log((w + yd) / w)) + power_of<3>(log(w / (w + yd))) * ((-4.0 * log(-(yd / (w + yd)))) / 3.0 - (2.0 * log((w + yd) / w)) / 3.0)
-                + power_of<3>(log(w / (1.0 + yd))) * (log(1.0 - w) / 3.0 - (2.0 * log((-1.0 + w) / w)) / 3.0 + (2.0 * log((w + yd) / w)) / 3.0) + dilog((w + yd) / (-1.0 + yd)) * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 6.0 * ln1pyd) * log((w + yd) / w) + (2.0 * power_of<3>(log((-1.0 + w) / (w + yd))) * log((w + yd) / w)) / 3.0 + (-2.0 * ln2 - 3.0 * log(1.0 + winv)) * log(((-1.0 + w) * yd) / (w * (1.0 + yd))) * power_of<2>(log((w + yd) / w)) + trilog(-yd) * (-2.0 * ln2 + 8.0 * log(1.0 - w) - 4.0 * log(1.0 + w) + 2.0 * ln1myd - 4.0 * ln1pyd + 2.0 * log((w + yd) / w))
-                + trilog((1.0 - w) / (1.0 + yd)) * (2.0 * ln2 + 2.0 * log(1.0 + w) + 4.0 * log((w + yd) / w)) + trilog((1.0 + yd) / (w + yd)) * (2.0 * ln2 + 8.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) - 16.0 * ln1myd + 4.0 * log((w + yd) / w)) + trilog(1.0 + yd) * (4.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 8.0 * log(-w) + 4.0 * log(w / (-1.0 + w)) - 4.0 * log(w / (1.0 + w)) - 8.0 * ln1pyd + 4.0 * log((w + yd) / (-1.0 + w)) + 4.0 * log((w + yd) / w))
-                + log(w / (1.0 + yd)) * ((pisqu * log(1.0 - w)) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + (2.0 * pisqu * log((w + yd) / w)) / 3.0) + log((-1.0 + w) / (w + yd)) * (-4.0 * power_of<2>(log(winv)) * log((-1.0 + w) / w) + (2.0 * pisqu * log((w + yd) / w)) / 3.0) + dilog(2.0 / (1.0 + yd)) * (-2.0 * ln2 * log(1.0 + winv) + 2.0 * ln2 * log(1.0 - w) + 4.0 * ln2 * log((w + yd) / w)) + log((-1.0 + yd) / (1.0 + yd)) * (-(ln2squ * log(1.0 + winv)) + ln2squ * log(1.0 - w) + 2.0 * ln2squ * log((w + yd) / w))
-                + dilog((w + yd) / (w + w * yd)) * (4.0 * ln1pyd * log((w + yd) / (-1.0 + w)) + (-4.0 * ln2 - 6.0 * log(1.0 + winv) + 2.0 * ln1myd) * log((w + yd) / w)) + dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) * ((4.0 * pisqu) / 3.0 + 2.0 * ln2 * log(1.0 - w) + 4.0 * lnhalf * log((-1.0 + w) / w) + 4.0 * power_of<2>(log((-1.0 + w) / w)) + 4.0 * log((-1.0 + w) / w) * log(1.0 / (1.0 + w)) + 2.0 * log(1.0 - w) * log(1.0 + w) + 4.0 * log(-(yd / w)) * log((w + yd) / w))
-                + dilog((1.0 + yd) / (w + yd)) * (-8.0 * log(winv) * log((-1.0 + w) / w) + (-2.0 * ln2 - 2.0 * log(1.0 + w)) * ln1pyd + ln1myd * (8.0 * log((1.0 + yd) / 2.0) + 8.0 * ln1pyd) - 4.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w)) + dilog(1.0 + yd) * (4.0 * dilog((1.0 + yd) / (1.0 - w)) - 2.0 * dilog((1.0 + yd) / (1.0 + w)) - 4.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) + 4.0 * ln1pyd * log((w + yd) / (-1.0 + w)) - 4.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w))
-                + dilog((w * (1.0 + yd)) / (w + yd)) * ((2.0 * ln2 + 2.0 * log(1.0 + w) - 8.0 * ln1myd) * ln1pyd + 4.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w)) + log((1.0 - w) / (1.0 + yd)) * (2.0 * log(1.0 - w) * power_of<2>(log(w)) + ln1pyd * ((4.0 * pisqu) / 3.0 - 2.0 * power_of<2>(log((w + yd) / (-1.0 + w)))) + (2.0 * ln2 + 3.0 * log(1.0 + winv)) * power_of<2>(log((w + yd) / w))) - (2.0 * pisqu * log(1.0 - w) * log((w + yd) / ((-1.0 + w) * w))) / 3.0 - (2.0 * log(1.0 - w) * power_of<3>(log((w + yd) / ((-1.0 + w) * w)))) / 3.0
-                - 8.0 * dilog((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd * log((w + yd) / (1.0 + w)) - 8.0 * dilog((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd * log((w + yd) / (1.0 + w)) + dilog((w + yd) / (w - w * yd)) * ((2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 6.0 * ln1pyd) * log((w + yd) / w) - 4.0 * ln1myd * log((w + yd) / (1.0 + w)))
-                + dilog((w + yd) / (1.0 + yd)) * (4.0 * log(1.0 - w) * log(w) - 4.0 * ln1pyd * log((w + yd) / (-1.0 + w)) + (4.0 * ln2 + 6.0 * log(1.0 + winv) - 2.0 * ln1myd) * log((w + yd) / w) + 8.0 * ln1myd * log((w + yd) / (1.0 + w))) + (-(ln2 * power_of<2>(log(1.0 - w))) - power_of<2>(log(1.0 - w)) * log(1.0 + w)) * log((w + yd) / (1.0 + yd)) + trilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) * (-4.0 * lnhalf - 2.0 * ln2 - 8.0 * log((-1.0 + w) / w) - 4.0 * log(1.0 / (1.0 + w)) - 2.0 * log(1.0 + w) + 8.0 * log(1.0 / (1.0 - yd)) - 4.0 * log(1.0 - yd / w))
-                + trilog((w - w * yd) / (w - yd)) * (-2.0 * ln2 - 8.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 8.0 * ln1pyd - 4.0 * log(1.0 - yd / w)) + trilog(-winv) * (-4.0 * log(1.0 - w) - 6.0 * ln1myd - 6.0 * ln1pyd - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) + trilog(winv) * (4.0 * log(1.0 + winv) + 10.0 * ln1myd + 10.0 * ln1pyd - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) + trilog(w) * (14.0 * ln1myd + 14.0 * ln1pyd - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w))
-                + dilog((1.0 - yd) / (1.0 + yd)) * ln1myd * (6.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - 2.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) + dilog((1.0 + yd) / (2.0 * yd)) * ln1pyd * (4.0 * log(1.0 + winv) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 6.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) + dilog((1.0 + yd) / (1.0 - yd)) * ln1pyd * (6.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - 4.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w))
-                + trilog(-w) * (-4.0 * ln2 - 4.0 * ln1myd - 4.0 * ln1pyd - 2.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w)) + power_of<3>(log(1.0 / (2.0 * yd))) * ((-2.0 * log(1.0 + winv)) / 3.0 - (2.0 * log((-1.0 + w) / w)) / 3.0 + log(1.0 + w) / 3.0 + (2.0 * log((w + yd) / w)) / 3.0 - log(1.0 - yd / w)) + power_of<3>(log(w / (w - yd))) * ((-4.0 * log(yd / (w - yd))) / 3.0 - (2.0 * log(1.0 - yd / w)) / 3.0) + power_of<3>(log(1.0 / (1.0 + yd))) * (log(1.0 + winv) - log(1.0 - w) / 3.0 + (2.0 * log((-1.0 + w) / w)) / 3.0 - log(1.0 + w) / 3.0 + 4.0 * log(-(yd / (1.0 + yd))) - log((w + yd) / w) / 3.0 - (2.0 * log(1.0 - yd / w)) / 3.0)
-                + power_of<3>(log(1.0 / (1.0 - yd))) * (log(1.0 + winv) - log(1.0 - w) / 3.0 + (2.0 * log((-1.0 + w) / w)) / 3.0 - log(1.0 + w) / 3.0 + 4.0 * log(yd / (1.0 - yd)) - (2.0 * log((w + yd) / w)) / 3.0 - log(1.0 - yd / w) / 3.0) + power_of<3>(log(-ydinv)) * (-ln2 - (2.0 * log(1.0 + winv)) / 3.0 + log(1.0 - w) / 3.0 - log(1.0 + w) / 3.0 - (2.0 * ln1pyd) / 3.0 + (5.0 * log((w + yd) / w)) / 3.0 - log(1.0 - yd / w) / 3.0) + power_of<3>(log(w / (1.0 - yd))) * (log(1.0 - w) / 3.0 - (2.0 * log((-1.0 + w) / w)) / 3.0 + ln1pyd + (2.0 * log(1.0 - yd / w)) / 3.0)
-                + power_of<3>(log((-0.5) * (1.0 / yd))) * ((-2.0 * log(1.0 + winv)) / 3.0 - (2.0 * log((-1.0 + w) / w)) / 3.0 + log(1.0 + w) / 3.0 - log((w + yd) / w) + (2.0 * log(1.0 - yd / w)) / 3.0) + dilog((-w + yd) / (1.0 + yd)) * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 6.0 * ln1myd) * log(1.0 - yd / w) + (2.0 * power_of<3>(log((-1.0 + w) / (w - yd))) * log(1.0 - yd / w)) / 3.0 + 2.0 * power_of<2>(log((-1.0 + yd) / (-1.0 + w))) * log(((-1.0 + w) * yd) / (w - yd)) * log(1.0 - yd / w)
-                + log(-2.0 / (-1.0 + yd)) * power_of<2>(ln1pyd) * (-3.0 * log(1.0 + winv) + log(1.0 - w) - 2.0 * log((-1.0 + w) / w) + log(1.0 + w) + 2.0 * log((w + yd) / w) + log(1.0 - yd / w)) + power_of<3>(log(ydinv)) * (-ln2 - (2.0 * log(1.0 + winv)) / 3.0 + log(1.0 - w) / 3.0 - log(1.0 + w) / 3.0 + (4.0 * ln1pyd) / 3.0 - log((w + yd) / w) / 3.0 + (5.0 * log(1.0 - yd / w)) / 3.0) + trilog(yd) * (-2.0 * ln2 + 8.0 * log(1.0 - w) - 4.0 * log(1.0 + w) - 4.0 * ln1myd + 2.0 * ln1pyd + 2.0 * log(1.0 - yd / w))
-                + trilog((1.0 + yd) / (1.0 - yd)) * (-6.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 4.0 * log((w - yd) / (1.0 + w)) + 4.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w)) + trilog((-1.0 + w) / (-1.0 + yd)) * (2.0 * ln2 + 2.0 * log(1.0 + w) + 4.0 * log(1.0 - yd / w)) + trilog(1.0 - yd) * (4.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 8.0 * log(-w) + 4.0 * log(w / (-1.0 + w)) - 4.0 * log(w / (1.0 + w)) - 8.0 * ln1myd + 4.0 * log((w - yd) / (-1.0 + w)) + 4.0 * log(1.0 - yd / w))
-                + trilog((-1.0 + yd) / (-w + yd)) * (2.0 * ln2 + 8.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) - 16.0 * ln1pyd + 4.0 * log(1.0 - yd / w)) + trilog(-1.0) * (-8.0 * log(1.0 + winv) - 8.0 * log((-1.0 + w) / w) + 4.0 * log(1.0 + w) + 4.0 * ln1myd + 4.0 * ln1pyd + 4.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w)) + trilog(w / (-1.0 + w)) * (-8.0 * log(1.0 / (1.0 - w)) - 8.0 * log(1.0 - w) - 4.0 * log(1.0 / (1.0 + w)) + 6.0 * ln1myd - 2.0 * log(yd / (-1.0 + yd)) - 2.0 * log(yd / (1.0 + yd)) + 6.0 * ln1pyd + 4.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w))
-                + trilog(2.0 / (1.0 + w)) * (8.0 * log(w / (1.0 + w)) + 10.0 * ln1myd - 4.0 * log((w - yd) / (1.0 + w)) + 10.0 * ln1pyd + 4.0 * log((w + yd) / w) - 4.0 * log((w + yd) / (1.0 + w)) + 4.0 * log(1.0 - yd / w)) + trilog((1.0 - yd) / (1.0 + yd)) * (-6.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 2.0 * log((w + yd) / w) + 4.0 * log((w + yd) / (1.0 + w)) + 4.0 * log(1.0 - yd / w)) + dilog((-1.0 + yd) / (2.0 * yd)) * ln1myd * (4.0 * log(1.0 + winv) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - 4.0 * log((w + yd) / w) + 6.0 * log(1.0 - yd / w))
-                + trilog(2.0) * (4.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) - 2.0 * ln1myd - 2.0 * ln1pyd + 8.0 * log((w + yd) / w) + 8.0 * log(1.0 - yd / w));
+            const complex<double> part2 = + (4.0 * power_of<4>(ln_2)) / 3.0 - (2.0 * pisqu * lnm1 * ln_3) / 3.0 - (2.0 * power_of<3>(lnm1) * ln_3) / 3.0 + 2.0 * lnm1 * ln2squ * ln_3 - (4.0 * pisqu * ln_2 * ln_3) / 3.0 - (4.0 * power_of<3>(ln_2) * ln_3) / 3.0 + (2.0 * pisqu * ln2 * ln_4) / 3.0 - 2.0 * ln2 * power_of<2>(ln_3) * ln_4 + (2.0 * ln2 * power_of<3>(ln_4)) / 3.0 + dilog((-1.0 + w) / (w - yd)) * (4.0 * ln2 * ln_5 + 4.0 * ln_1 * ln_5)
+                + dilog((-1.0 + w) / (w + yd)) * (4.0 * ln2 * ln_5 + 4.0 * ln_1 * ln_5) - (4.0 * pisqu * ln_5 * ln_6) / 3.0 + 4.0 * power_of<2>(ln_1) * ln_5 * ln_6 + 2.0 * pisqu * power_of<2>(ln_6) + 4.0 * log(-1.0 - w) * power_of<3>(ln_6) - (4.0 * ln_5 * power_of<3>(ln_6)) / 3.0 - 2.0 * power_of<4>(ln_6) - (4.0 * pisqu * ln2 * ln_7) / 3.0 - (4.0 * pisqu * ln_1 * ln_7) / 3.0 + 4.0 * ln2 * power_of<2>(ln_5) * ln_7 + 4.0 * ln_1 * power_of<2>(ln_5) * ln_7
+                + 4.0 * ln_2 * ln_3 * power_of<2>(ln_7) - (4.0 * ln2 * power_of<3>(ln_7)) / 3.0 - (4.0 * ln_1 * power_of<3>(ln_7)) / 3.0 - (8.0 * power_of<3>(ln_2) * log(w / (1.0 - w))) / 3.0 + (8.0 * pisqu * ln_5 * ln_8) / 3.0 - 8.0 * power_of<2>(ln_4) * ln_5 * ln_8 - (4.0 * pisqu * power_of<2>(ln_8)) / 3.0 - (8.0 * ln_9 * power_of<3>(ln_8)) / 3.0 + (8.0 * ln_5 * power_of<3>(ln_8)) / 3.0 + (4.0 * power_of<4>(ln_8)) / 3.0 + (4.0 * pisqu * ln_1 * ln_10) / 3.0
+                - 4.0 * ln_1 * power_of<2>(ln_11) * ln_10 + (4.0 * ln_1 * power_of<3>(ln_10)) / 3.0 + (2.0 * pisqu * ln_4 * ln_12) / 3.0 - 2.0 * power_of<2>(ln_3) * ln_4 * ln_12 + (2.0 * power_of<3>(ln_4) * ln_12) / 3.0 + trilog(-(w / yd)) * (2.0 * ln2 + 2.0 * ln_12) + trilog(w / yd) * (2.0 * ln2 + 2.0 * ln_12) + dilog((-1.0 + w) / (-1.0 + yd)) * (-2.0 * ln2 * ln_3 - 2.0 * ln_3 * ln_12) + dilog((1.0 - w) / (1.0 + yd)) * (-2.0 * ln2 * ln_3 - 2.0 * ln_3 * ln_12)
+                - 2.0 * power_of<4>(ln_13) + trilog(ydinv) * (-4.0 * ln2 - 2.0 * ln_1 - 2.0 * ln_3 - 4.0 * ln_5 - 4.0 * ln1myd) + trilog(yd / w) * (6.0 * ln2 + 4.0 * ln_1 - 4.0 * ln_3 + 8.0 * ln_5 - 4.0 * ln1myd) + 4.0 * trilog(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd + 8.0 * trilog(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd + 4.0 * trilog((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) * ln1myd + 4.0 * trilog(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) * ln1myd
+                + 8.0 * trilog((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd + 8.0 * trilog((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd - 2.0 * dilog((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * ln2 * ln1myd - 2.0 * dilog((1.0 + w) / (1.0 + yd)) * ln_1 * ln1myd + dilog(w / yd) * (2.0 * ln2 + 2.0 * ln_12) * ln1myd - 4.0 * dilog(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) * ln_14 * ln1myd - 4.0 * dilog((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) * ln_14 * ln1myd
+                + trilog((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * (2.0 * ln_1 + 4.0 * ln_3 + 2.0 * ln1myd) + trilog((w + yd) / (yd - w * yd)) * (-8.0 * ln_5 + 4.0 * ln1myd) + dilog((1.0 + w) / (w - yd)) * (4.0 * ln_1 * ln_5 - 2.0 * ln_12 * ln1myd) + (2.0 * power_of<4>(ln_15)) / 3.0 - (2.0 * pisqu * ln_3 * log((w - yd) / ((-1.0 + w) * w))) / 3.0 - (2.0 * ln_3 * power_of<3>(log((w - yd) / ((-1.0 + w) * w)))) / 3.0 + (4.0 * pisqu * ln_5 * log((w * (-1.0 + yd)) / (-1.0 + w))) / 3.0
+                + (4.0 * ln_5 * power_of<3>(log((w * (-1.0 + yd)) / (-1.0 + w)))) / 3.0 + (2.0 * pisqu * ln_1 * ln_16) / 3.0 + (2.0 * ln_1 * power_of<3>(ln_16)) / 3.0 + (2.0 * ln_3 * power_of<3>(ln_17)) / 3.0 - (4.0 * ln_5 * power_of<3>(log((w * (-1.0 + yd)) / ((-1.0 + w) * yd)))) / 3.0 - (2.0 * ln_1 * power_of<3>(ln_18)) / 3.0 + ((-1.0 / 3.0) * (pisqu * ln_1) + (pisqu * ln_3) / 3.0) * ln_19 + ((-1.0 / 3.0) * ln_1 + ln_3 / 3.0) * power_of<3>(ln_19)
+                + ((2.0 * pisqu * ln2) / 3.0 + (2.0 * pisqu * ln_1) / 3.0) * log(-((w * yd) / (w - yd))) + ((2.0 * ln2) / 3.0 + (2.0 * ln_1) / 3.0) * power_of<3>(log(-((w * yd) / (w - yd)))) - (2.0 * pisqu * ln_5 * log((w * yd) / (w - yd))) / 3.0 - (2.0 * ln_5 * power_of<3>(log((w * yd) / (w - yd)))) / 3.0 + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * ln_12) / 3.0) * log(yd / (w * (-1.0 + yd))) + ((-1.0 / 3.0) * ln2 - ln_12 / 3.0) * power_of<3>(log(yd / (w * (-1.0 + yd)))) - 2.0 * power_of<4>(ln_20) + ((-2.0 * pisqu * ln2) / 3.0 - pisqu * ln_1) * ln_21
+                + ((-2.0 * ln2) / 3.0 - ln_1) * power_of<3>(ln_21) + trilog((-w + yd) / (1.0 + yd)) * (2.0 * ln_3 - 4.0 * ln_5 + 6.0 * ln1myd - 2.0 * ln_20 + 2.0 * ln_22) + ((-1.0 / 3.0) * (pisqu * ln_1) + (pisqu * ln_3) / 3.0) * ln_23 + ((-1.0 / 3.0) * ln_1 + ln_3 / 3.0) * power_of<3>(ln_23) + 2.0 * li2_6 * ln1myd * ln_24
+                + li2_7 * ((2.0 * pisqu) / 3.0 + 2.0 * li2_8 - 4.0 * li2_9 + 2.0 * li2_10 + 2.0 * power_of<2>(ln1myd) + ln1myd * (-4.0 * lnhalf + 2.0 * ln2 + 4.0 * ln_14 + 4.0 * ln_25 - 4.0 * ln1pyd)) + li2_11 * (4.0 * power_of<2>(ln1myd) + ln1myd * (2.0 * ln2 - 2.0 * ln1pyd)) + trilog((-1.0 + yd) / (-1.0 + w)) * (4.0 * lnhalf - 2.0 * ln_1 - 4.0 * ln_3 - 4.0 * ln_8 + 4.0 * ln1myd - 18.0 * ln1pyd)
+                + trilog(1.0 + w) * (-8.0 * ln_5 + 24.0 * ln_6 - 8.0 * ln1myd - 8.0 * ln1pyd) + trilog((yd + w * yd) / (w + w * yd)) * (-4.0 * lnhalf - 4.0 * ln_1 - 2.0 * ln1myd + 6.0 * ln_20 - 2.0 * ln_22 - 8.0 * ln1pyd) + trilog((-w + yd) / (-1.0 + yd)) * (-4.0 * ln2 - 6.0 * ln_1 - 4.0 * ln_3 + 4.0 * ln1myd - 6.0 * ln1pyd) + trilog(-ydinv) * (-4.0 * ln2 - 2.0 * ln_1 - 2.0 * ln_3 - 4.0 * ln_5 - 4.0 * ln1pyd)
+                + trilog(-(yd / w)) * (6.0 * ln2 + 4.0 * ln_1 - 4.0 * ln_3 + 8.0 * ln_5 - 4.0 * ln1pyd) + trilog((w + yd) / (w + w * yd)) * (4.0 * ln2 + 6.0 * ln_1 + 4.0 * ln_3 - 2.0 * ln1myd - 4.0 * ln1pyd) + trilog(w / (w - yd)) * (8.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_5 + 2.0 * ln_12 + 2.0 * ln_14 - 2.0 * ln1myd - 4.0 * ln1pyd)
+                + trilog((w * (1.0 + yd)) / (w - yd)) * (-2.0 * ln2 - 4.0 * ln_1 - 2.0 * ln_14 + 2.0 * ln1myd - 4.0 * ln1pyd) + trilog((-1.0 + w) / (w - yd)) * (-4.0 * ln2 - 4.0 * ln_1 + 4.0 * ln1myd - 4.0 * ln1pyd) + trilog(1.0 - yd / w) * (-4.0 * ln_1 + 4.0 * ln_2 - 4.0 * ln_3 - 8.0 * ln_5 + 4.0 * ln1myd + 4.0 * ln_26 - 4.0 * ln1pyd)
+                + trilog((1.0 + yd) / (1.0 + w)) * (4.0 * lnhalf - 2.0 * ln2 - 8.0 * ln_27 + 8.0 * ln_6 + 8.0 * ln_28 + 4.0 * ln_10 - 6.0 * ln_14 + 8.0 * ln1myd - 4.0 * ln_29 - 4.0 * ln_30 - 4.0 * ln1pyd) + trilog((w - yd) / (w - w * yd)) * (4.0 * ln2 + 6.0 * ln_1 + 4.0 * ln_3 - 4.0 * ln1myd - 2.0 * ln1pyd) + trilog(w / (w + yd)) * (8.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_5 + 2.0 * ln_12 - 4.0 * ln1myd + 2.0 * ln_24 - 2.0 * ln1pyd)
+                + power_of<3>(ln_31) * ((4.0 * ln2) / 3.0 + ln_1 + (2.0 * ln_5) / 3.0 - ln1pyd) + power_of<3>(ln_32) * ((4.0 * ln2) / 3.0 + ln_1 + (2.0 * ln_5) / 3.0 - ln1pyd) + power_of<3>(ln_33) * (ln_1 / 3.0 + ln1pyd / 3.0) + power_of<3>(ln_34) * (ln2 / 3.0 + (2.0 * ln1pyd) / 3.0) + power_of<3>(log(w / (-1.0 + yd))) * ((-2.0 * ln2) / 3.0 - ln_1 + (2.0 * ln1pyd) / 3.0) + 8.0 * trilog((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) * ln1pyd
+                + 4.0 * trilog((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd))) * ln1pyd + 8.0 * trilog((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) * ln1pyd + 8.0 * trilog(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) * ln1pyd + 4.0 * trilog(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) * ln1pyd + 4.0 * trilog(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) * ln1pyd + 4.0 * trilog(yd / (-w + yd)) * ln1pyd - 2.0 * dilog((w + w * yd) / (yd + w * yd)) * ln2 * ln1pyd - 2.0 * dilog((1.0 + w) / (1.0 - yd)) * ln_1 * ln1pyd
+                + dilog(-(w / yd)) * (2.0 * ln2 + 2.0 * ln_12) * ln1pyd - 8.0 * dilog((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) * ln_35 * ln1pyd - 8.0 * dilog((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) * ln_35 * ln1pyd - 4.0 * dilog(yd / (-w + yd)) * ln_29 * ln1pyd + ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(ln_14) - 2.0 * power_of<2>(ln_26)) * ln_36 * ln1pyd - (2.0 * power_of<3>(ln_36) * ln1pyd) / 3.0 + (4.0 * power_of<3>(ln_37) * ln1pyd) / 3.0
+                - 4.0 * dilog(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) * ln_24 * ln1pyd - 4.0 * dilog(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) * ln_24 * ln1pyd + (2.0 * ln_35 - 2.0 * log((-2.0 * (w - yd)) / ((1.0 + w) * (-1.0 + yd))) - 2.0 * log((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd)))) * power_of<2>(ln_24) * ln1pyd + trilog((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * (2.0 * ln_1 + 4.0 * ln_3 + 2.0 * ln1pyd)
+                + trilog((w - w * yd) / (w + yd)) * (-2.0 * ln2 - 4.0 * ln_1 - 4.0 * ln1myd - 2.0 * ln_24 + 2.0 * ln1pyd) + trilog((w - yd) / ((-1.0 + w) * yd)) * (-8.0 * ln_5 + 4.0 * ln1pyd) + trilog((1.0 + yd) / (1.0 - w)) * (4.0 * lnhalf - 2.0 * ln_1 - 4.0 * ln_3 - 4.0 * ln_8 - 18.0 * ln1myd + 4.0 * ln1pyd) + trilog((w + yd) / (1.0 + yd)) * (-4.0 * ln2 - 6.0 * ln_1 - 4.0 * ln_3 - 6.0 * ln1myd + 4.0 * ln1pyd)
+                + trilog((-1.0 + w) / (w + yd)) * (-4.0 * ln2 - 4.0 * ln_1 - 4.0 * ln1myd + 4.0 * ln1pyd) + trilog((w - yd) / (1.0 + w)) * (4.0 * ln2 + 4.0 * ln_1 + 2.0 * ln_3 - 2.0 * ln_26 + 4.0 * ln1pyd) + trilog((w - yd) / (w + w * yd)) * (-2.0 * ln_3 + 4.0 * ln_5 - 6.0 * ln1myd - 2.0 * ln_26 + 4.0 * ln1pyd)
+                + trilog((1.0 - yd) / (1.0 + w)) * (4.0 * lnhalf - 2.0 * ln2 - 8.0 * ln_27 + 8.0 * ln_6 + 8.0 * ln_28 + 4.0 * ln_10 - 4.0 * ln1myd - 4.0 * ln_38 - 4.0 * ln_25 - 6.0 * ln_24 + 8.0 * ln1pyd) + ln_33 * ((pisqu * ln_1) / 3.0 + (pisqu * ln1pyd) / 3.0) + ln_34 * ((pisqu * ln2) / 3.0 + (2.0 * pisqu * ln1pyd) / 3.0) + log(w / (-1.0 + yd)) * ((-2.0 * pisqu * ln2) / 3.0 - pisqu * ln_1 + (2.0 * pisqu * ln1pyd) / 3.0)
+                + li2_12 * ((2.0 * pisqu) / 3.0 - 2.0 * li2_13 + 4.0 * lnhalf * ln_1 + 2.0 * power_of<2>(ln_1) + 8.0 * ln1myd * ln_38 + 2.0 * ln_1 * ln1pyd) + dilog((1.0 + w) / (w + yd)) * (4.0 * ln_1 * ln_5 - 2.0 * ln_12 * ln1pyd) + li2_14 * (li2_15 - 4.0 * ln_1 * ln_5 + 4.0 * ln1myd * ln_38 + 2.0 * ln_12 * ln1pyd)
+                + li2_16 * (-2.0 * li2_17 + 2.0 * li2_18 + 2.0 * ln_14 * ln1pyd) + dilog(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) * (-12.0 * ln_14 * ln1pyd + 4.0 * ln_26 * ln1pyd) + dilog((-0.5) * (((1.0 + w) * (-1.0 + yd)) / (w - yd))) * (-8.0 * ln_14 * ln1pyd + 4.0 * ln_26 * ln1pyd) + li2_19 * (-4.0 * ln_1 * ln_5 + 2.0 * ln_12 * ln1myd + 4.0 * ln_29 * ln1pyd)
+                + li2_20 * ((2.0 * pisqu) / 3.0 + 4.0 * lnhalf * ln_1 + 2.0 * power_of<2>(ln_1) + 2.0 * ln_1 * ln1myd + 8.0 * ln_29 * ln1pyd) + li2_21 * (-2.0 * li2_22 - 2.0 * li2_8 - 2.0 * li2_17 - li2_23 - li2_24 - 2.0 * li2_25 - 8.0 * power_of<2>(ln1myd) - 8.0 * power_of<2>(ln1pyd))
+                + li2_26 * (6.0 * li2_18 - 4.0 * li2_27 - 2.0 * power_of<2>(ln_1) - 2.0 * power_of<2>(ln_3) - 4.0 * ln_1 * ln_39 - 4.0 * power_of<2>(ln_5) - 4.0 * ln_5 * ln_40 - 2.0 * ln2 * ln_12 - 4.0 * ln_5 * ln_41 + 2.0 * power_of<2>(ln1myd) + ln1myd * (-4.0 * ln_1 + 2.0 * ln_12 + 12.0 * ln_24 - 4.0 * ln1pyd) + 6.0 * ln_14 * ln1pyd + (-8.0 * ln_29 - 4.0 * log((2.0 * yd) / (-1.0 + yd))) * ln1pyd
+                - 4.0 * power_of<2>(ln1pyd)) + li2_28 * (-4.0 * ln_1 * ln_11 + (-2.0 * ln2 + 2.0 * ln1myd + 4.0 * ln_24) * ln1pyd - 4.0 * power_of<2>(ln1pyd)) + li2_29 * (-4.0 * li2_30 - 4.0 * li2_31 + 4.0 * li2_9 - 4.0 * li2_10 + 12.0 * li2_18 - 2.0 * power_of<2>(ln_1) - 2.0 * power_of<2>(ln_3) - 4.0 * ln_1 * ln_39 - 4.0 * power_of<2>(ln_5) - 4.0 * ln_5 * ln_40
+                - 2.0 * ln2 * ln_12 - 4.0 * ln_5 * ln_41 - 4.0 * power_of<2>(ln1myd) + ln1myd * (-8.0 * ln_38 - 4.0 * log((2.0 * yd) / (1.0 + yd)) + 6.0 * ln_24 - 4.0 * ln1pyd) + (-4.0 * ln_1 + 2.0 * ln_12 + 12.0 * ln_14) * ln1pyd + 2.0 * power_of<2>(ln1pyd)) + li2_32 * ((2.0 * pisqu) / 3.0 + 2.0 * li2_27 + (-4.0 * lnhalf + 2.0 * ln2 - 4.0 * ln1myd + 4.0 * ln_30 + 4.0 * ln_24) * ln1pyd + 2.0 * power_of<2>(ln1pyd))
+                + li2_33 * ((2.0 * ln2 - 2.0 * ln1myd) * ln1pyd + 4.0 * power_of<2>(ln1pyd)) + log((1.0 + w) / (w - yd)) * (-2.0 * ln_1 * power_of<2>(ln_11) + 2.0 * power_of<2>(ln_24) * ln1pyd - ln2 * power_of<2>(ln1pyd) - 2.0 * power_of<3>(ln1pyd)) + li2_34 * (li2_15 - 4.0 * ln_1 * ln_11 - 4.0 * power_of<2>(ln1myd) + ln1myd * (-2.0 * ln2 + 4.0 * ln_14 + 2.0 * ln1pyd))
+                + trilog((w + yd) / (1.0 + w)) * (4.0 * ln2 + 4.0 * ln_1 + 2.0 * ln_3 + 4.0 * ln1myd - 2.0 * ln_42) + trilog((w + yd) / (w - w * yd)) * (-2.0 * ln_3 + 4.0 * ln_5 + 4.0 * ln1myd - 6.0 * ln1pyd - 2.0 * ln_42) + dilog(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd * (-12.0 * ln_24 + 4.0 * ln_42) + dilog(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) * ln1myd * (-8.0 * ln_24 + 4.0 * ln_42)
+                + trilog((w + yd) / w) * (-4.0 * ln_1 + 4.0 * ln_2 - 4.0 * ln_3 - 8.0 * ln_5 - 4.0 * ln1myd + 4.0 * ln1pyd + 4.0 * ln_42) + (4.0 * pisqu * ln_5 * log(-((w * (1.0 + yd)) / (-1.0 + w)))) / 3.0 + (4.0 * ln_5 * power_of<3>(log(-((w * (1.0 + yd)) / (-1.0 + w))))) / 3.0 + (2.0 * pisqu * ln_1 * ln_43) / 3.0 + (2.0 * ln_1 * power_of<3>(ln_43)) / 3.0
+                + trilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) * (-4.0 * lnhalf - 4.0 * ln_1 + 6.0 * ln_13 - 8.0 * ln1myd - 2.0 * ln1pyd - 2.0 * ln_44) + trilog((w + yd) / (-1.0 + yd)) * (2.0 * ln_3 - 4.0 * ln_5 - 2.0 * ln_13 + 6.0 * ln1pyd + 2.0 * ln_44) + trilog(1.0 / (1.0 - w)) * (-8.0 * lnhalf + 4.0 * ln_1 + 16.0 * ln_5 - 8.0 * ln_8 + 10.0 * ln1myd + 2.0 * ln_22 + 10.0 * ln1pyd + 2.0 * ln_44)
+                + dilog(1.0 / (1.0 - w)) * ((4.0 * pisqu) / 3.0 - 4.0 * li2half + 4.0 * li2_21 + 4.0 * li2_35 - 4.0 * li2_36 - 2.0 * li2_22 + 6.0 * li2_8 + 6.0 * li2_17 - li2_37 + 2.0 * li2_23 - li2_38 + 2.0 * li2_24 - 4.0 * li2_39 - 2.0 * li2_25 - 16.0 * ln_4 * ln_5 - 4.0 * lnhalf * ln1myd + 4.0 * power_of<2>(ln1myd) + 2.0 * ln2 * ln_22 - 4.0 * lnhalf * ln1pyd
+                + 4.0 * power_of<2>(ln1pyd) + 2.0 * ln2 * ln_44) + 2.0 * power_of<2>(ln_1) * ln_5 * ln_45 - 2.0 * power_of<2>(ln_1) * ln_5 * ln_46 - (4.0 * ln_5 * power_of<3>(ln_47)) / 3.0 + ((pisqu * ln2) / 3.0 + (pisqu * ln_12) / 3.0) * ln_48 + (ln2 / 3.0 + ln_12 / 3.0) * power_of<3>(ln_48) + (2.0 * ln2 * power_of<2>(ln_5) + 2.0 * ln_1 * power_of<2>(ln_5)) * log((-1.0 + yd) / (-w + yd))
+                - (2.0 * pisqu * ln_1 * log((w * yd) / (-w + yd))) / 3.0 - (2.0 * ln_1 * power_of<3>(log((w * yd) / (-w + yd)))) / 3.0 + (-(ln2 * power_of<2>(ln_3)) - power_of<2>(ln_3) * ln_12) * log((-w + yd) / (-1.0 + yd)) + ((pisqu * ln2) / 3.0 + (pisqu * ln_12) / 3.0) * ln_49 + (ln2 / 3.0 + ln_12 / 3.0) * power_of<3>(ln_49) + (pisqu * ln2 * ln_50) / 3.0 + (ln2 * power_of<3>(ln_50)) / 3.0 + (2.0 * power_of<4>(ln_51)) / 3.0 - 2.0 * ln_1 * power_of<2>(ln_11) * ln_52
+                + 2.0 * power_of<2>(ln_1) * ln_5 * ln_53 - (2.0 * pisqu * ln_5 * log(-((w * yd) / (w + yd)))) / 3.0 - (2.0 * ln_5 * power_of<3>(log(-((w * yd) / (w + yd))))) / 3.0 + (2.0 * pisqu * ln2 * log((w * yd) / (w + yd))) / 3.0 + (2.0 * ln2 * power_of<3>(log((w * yd) / (w + yd)))) / 3.0 + power_of<3>(ln1myd) * ((-2.0 * ln_54) / 3.0 + 2.0 * ln_55 - 2.0 * ln_52 + 2.0 * ln_56) + (2.0 * ln2 * power_of<2>(ln_5) + 2.0 * ln_1 * power_of<2>(ln_5)) * log((1.0 + yd) / (w + yd))
+                + trilog((-1.0 + yd) / (w + yd)) * (2.0 * ln2 + 4.0 * ln_1 - 2.0 * ln1pyd - 2.0 * ln_51 + 2.0 * ln_57) + trilog(((1.0 + w) * yd) / (w + yd)) * (4.0 * ln_5 - 4.0 * ln1myd - 2.0 * ln1pyd - 2.0 * ln_51 + 2.0 * ln_57) + dilog((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * ((-2.0 * ln_1 - 2.0 * ln1myd) * ln1pyd - 4.0 * ln_3 * ln_57)
+                + li2_25 * ((-2.0 * pisqu) / 3.0 + 4.0 * power_of<2>(ln1myd) + (-4.0 * lnhalf + 2.0 * ln_1) * ln1pyd - 2.0 * power_of<2>(ln1pyd) + ln1myd * (12.0 * ln_24 + 2.0 * ln1pyd) + 4.0 * ln_3 * ln_57) + trilog(-2.0 / (-1.0 + w)) * (8.0 * ln_8 + 8.0 * ln1myd - 4.0 * ln_54 - 2.0 * ln_22 + 8.0 * ln1pyd - 2.0 * ln_44 - 4.0 * ln_58)
+                + power_of<3>(ln1pyd) * (2.0 * ln_59 - (2.0 * ln_58) / 3.0) + trilog((w * (1.0 + yd)) / (w + yd)) * (-2.0 * ln2 - 8.0 * ln_5 - 2.0 * ln_12 + 8.0 * ln1myd - 4.0 * ln_60) + trilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) * (-4.0 * lnhalf - 2.0 * ln2 - 8.0 * ln_5 - 4.0 * ln_61 - 2.0 * ln_12 + 8.0 * ln_20 - 4.0 * ln_60) + power_of<3>(ln_51) * ((-4.0 * log(-(yd / (w + yd)))) / 3.0 - (2.0 * ln_60) / 3.0)
+                + power_of<3>(ln_62) * (ln_3 / 3.0 - (2.0 * ln_5) / 3.0 + (2.0 * ln_60) / 3.0) + li2_40 * (-2.0 * ln_3 + 4.0 * ln_5 - 6.0 * ln1pyd) * ln_60 + (2.0 * power_of<3>(ln_63) * ln_60) / 3.0 + (-2.0 * ln2 - 3.0 * ln_1) * ln_64 * power_of<2>(ln_60) + trilog(-yd) * (-2.0 * ln2 + 8.0 * ln_3 - 4.0 * ln_12 + 2.0 * ln1myd - 4.0 * ln1pyd + 2.0 * ln_60)
+                + trilog((1.0 - w) / (1.0 + yd)) * (2.0 * ln2 + 2.0 * ln_12 + 4.0 * ln_60) + trilog((1.0 + yd) / (w + yd)) * (2.0 * ln2 + 8.0 * ln_5 + 2.0 * ln_12 - 16.0 * ln1myd + 4.0 * ln_60) + trilog(1.0 + yd) * (4.0 * ln_1 + 4.0 * ln_3 + 8.0 * ln_5 - 8.0 * ln_6 + 4.0 * ln_8 - 4.0 * ln_10 - 8.0 * ln1pyd + 4.0 * ln_58 + 4.0 * ln_60)
+                + ln_62 * ((pisqu * ln_3) / 3.0 - (2.0 * pisqu * ln_5) / 3.0 + (2.0 * pisqu * ln_60) / 3.0) + ln_63 * (-4.0 * power_of<2>(ln_4) * ln_5 + (2.0 * pisqu * ln_60) / 3.0) + dilog(2.0 / (1.0 + yd)) * (-2.0 * ln2 * ln_1 + 2.0 * ln2 * ln_3 + 4.0 * ln2 * ln_60) + log((-1.0 + yd) / (1.0 + yd)) * (-(ln2squ * ln_1) + ln2squ * ln_3 + 2.0 * ln2squ * ln_60)
+                + li2_41 * (4.0 * ln1pyd * ln_58 + (-4.0 * ln2 - 6.0 * ln_1 + 2.0 * ln1myd) * ln_60) + li2_42 * ((4.0 * pisqu) / 3.0 + 2.0 * ln2 * ln_3 + 4.0 * lnhalf * ln_5 + 4.0 * power_of<2>(ln_5) + 4.0 * ln_5 * ln_61 + 2.0 * ln_3 * ln_12 + 4.0 * ln_65 * ln_60)
+                + dilog((1.0 + yd) / (w + yd)) * (-8.0 * ln_4 * ln_5 + (-2.0 * ln2 - 2.0 * ln_12) * ln1pyd + ln1myd * (8.0 * ln_24 + 8.0 * ln1pyd) - 4.0 * ln_42 * ln_60) + li2_39 * (4.0 * li2_25 - 2.0 * li2_32 - 4.0 * ln_3 * ln_57 + 4.0 * ln1pyd * ln_58 - 4.0 * ln_42 * ln_60)
+                + li2_43 * ((2.0 * ln2 + 2.0 * ln_12 - 8.0 * ln1myd) * ln1pyd + 4.0 * ln_42 * ln_60) + ln_37 * (2.0 * ln_3 * power_of<2>(ln_7) + ln1pyd * ((4.0 * pisqu) / 3.0 - 2.0 * power_of<2>(ln_58)) + (2.0 * ln2 + 3.0 * ln_1) * power_of<2>(ln_60)) - (2.0 * pisqu * ln_3 * log((w + yd) / ((-1.0 + w) * w))) / 3.0 - (2.0 * ln_3 * power_of<3>(log((w + yd) / ((-1.0 + w) * w)))) / 3.0
+                - 8.0 * dilog((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) * ln1myd * ln_66 - 8.0 * dilog((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd))) * ln1myd * ln_66 + li2_44 * ((2.0 * ln_3 - 4.0 * ln_5 + 6.0 * ln1pyd) * ln_60 - 4.0 * ln1myd * ln_66)
+                + dilog((w + yd) / (1.0 + yd)) * (4.0 * ln_3 * ln_7 - 4.0 * ln1pyd * ln_58 + (4.0 * ln2 + 6.0 * ln_1 - 2.0 * ln1myd) * ln_60 + 8.0 * ln1myd * ln_66) + (-(ln2 * power_of<2>(ln_3)) - power_of<2>(ln_3) * ln_12) * log((w + yd) / (1.0 + yd)) + trilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) * (-4.0 * lnhalf - 2.0 * ln2 - 8.0 * ln_5 - 4.0 * ln_61 - 2.0 * ln_12 + 8.0 * ln_13 - 4.0 * ln_67)
+                + trilog((w - w * yd) / (w - yd)) * (-2.0 * ln2 - 8.0 * ln_5 - 2.0 * ln_12 + 8.0 * ln1pyd - 4.0 * ln_67) + trilog(-winv) * (-4.0 * ln_3 - 6.0 * ln1myd - 6.0 * ln1pyd - 4.0 * ln_60 - 4.0 * ln_67) + trilog(winv) * (4.0 * ln_1 + 10.0 * ln1myd + 10.0 * ln1pyd - 4.0 * ln_60 - 4.0 * ln_67) + trilog(w) * (14.0 * ln1myd + 14.0 * ln1pyd - 4.0 * ln_60 - 4.0 * ln_67)
+                + li2_10 * ln1myd * (6.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln_5 - 2.0 * ln_12 - 2.0 * ln_60 - 4.0 * ln_67) + dilog((1.0 + yd) / (2.0 * yd)) * ln1pyd * (4.0 * ln_1 + 4.0 * ln_5 - 2.0 * ln_12 + 6.0 * ln_60 - 4.0 * ln_67) + li2_27 * ln1pyd * (6.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln_5 - 2.0 * ln_12 - 4.0 * ln_60 - 2.0 * ln_67)
+                + trilog(-w) * (-4.0 * ln2 - 4.0 * ln1myd - 4.0 * ln1pyd - 2.0 * ln_60 - 2.0 * ln_67) + power_of<3>(log(1.0 / (2.0 * yd))) * ((-2.0 * ln_1) / 3.0 - (2.0 * ln_5) / 3.0 + ln_12 / 3.0 + (2.0 * ln_60) / 3.0 - ln_67) + power_of<3>(ln_15) * ((-4.0 * log(yd / (w - yd))) / 3.0 - (2.0 * ln_67) / 3.0) + power_of<3>(ln_20) * (ln_1 - ln_3 / 3.0 + (2.0 * ln_5) / 3.0 - ln_12 / 3.0 + 4.0 * ln_23 - ln_60 / 3.0 - (2.0 * ln_67) / 3.0)
+                + power_of<3>(ln_13) * (ln_1 - ln_3 / 3.0 + (2.0 * ln_5) / 3.0 - ln_12 / 3.0 + 4.0 * ln_19 - (2.0 * ln_60) / 3.0 - ln_67 / 3.0) + power_of<3>(ln_68) * (-ln2 - (2.0 * ln_1) / 3.0 + ln_3 / 3.0 - ln_12 / 3.0 - (2.0 * ln1pyd) / 3.0 + (5.0 * ln_60) / 3.0 - ln_67 / 3.0) + power_of<3>(log(w / (1.0 - yd))) * (ln_3 / 3.0 - (2.0 * ln_5) / 3.0 + ln1pyd + (2.0 * ln_67) / 3.0)
+                + power_of<3>(log((-0.5) * (1.0 / yd))) * ((-2.0 * ln_1) / 3.0 - (2.0 * ln_5) / 3.0 + ln_12 / 3.0 - ln_60 + (2.0 * ln_67) / 3.0) + li2_45 * (-2.0 * ln_3 + 4.0 * ln_5 - 6.0 * ln1myd) * ln_67 + (2.0 * power_of<3>(ln_69) * ln_67) / 3.0 + 2.0 * power_of<2>(ln_26) * ln_70 * ln_67
+                + ln_71 * power_of<2>(ln1pyd) * (-3.0 * ln_1 + ln_3 - 2.0 * ln_5 + ln_12 + 2.0 * ln_60 + ln_67) + power_of<3>(ln_55) * (-ln2 - (2.0 * ln_1) / 3.0 + ln_3 / 3.0 - ln_12 / 3.0 + (4.0 * ln1pyd) / 3.0 - ln_60 / 3.0 + (5.0 * ln_67) / 3.0) + trilog(yd) * (-2.0 * ln2 + 8.0 * ln_3 - 4.0 * ln_12 - 4.0 * ln1myd + 2.0 * ln1pyd + 2.0 * ln_67)
+                + trilog((1.0 + yd) / (1.0 - yd)) * (-6.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_5 + 2.0 * ln_12 + 4.0 * ln_35 + 4.0 * ln_60 + 2.0 * ln_67) + trilog((-1.0 + w) / (-1.0 + yd)) * (2.0 * ln2 + 2.0 * ln_12 + 4.0 * ln_67) + trilog(1.0 - yd) * (4.0 * ln_1 + 4.0 * ln_3 + 8.0 * ln_5 - 8.0 * ln_6 + 4.0 * ln_8 - 4.0 * ln_10 - 8.0 * ln1myd + 4.0 * ln_54 + 4.0 * ln_67)
+                + trilog((-1.0 + yd) / (-w + yd)) * (2.0 * ln2 + 8.0 * ln_5 + 2.0 * ln_12 - 16.0 * ln1pyd + 4.0 * ln_67) + trilog(-1.0) * (-8.0 * ln_1 - 8.0 * ln_5 + 4.0 * ln_12 + 4.0 * ln1myd + 4.0 * ln1pyd + 4.0 * ln_60 + 4.0 * ln_67) + trilog(w / (-1.0 + w)) * (-8.0 * ln_2 - 8.0 * ln_3 - 4.0 * ln_61 + 6.0 * ln1myd - 2.0 * ln_30 - 2.0 * ln_25 + 6.0 * ln1pyd + 4.0 * ln_60 + 4.0 * ln_67)
+                + trilog(2.0 / (1.0 + w)) * (8.0 * ln_10 + 10.0 * ln1myd - 4.0 * ln_35 + 10.0 * ln1pyd + 4.0 * ln_60 - 4.0 * ln_66 + 4.0 * ln_67) + trilog((1.0 - yd) / (1.0 + yd)) * (-6.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_5 + 2.0 * ln_12 + 2.0 * ln_60 + 4.0 * ln_66 + 4.0 * ln_67) + dilog((-1.0 + yd) / (2.0 * yd)) * ln1myd * (4.0 * ln_1 + 4.0 * ln_5 - 2.0 * ln_12 - 4.0 * ln_60 + 6.0 * ln_67)
+                + trilog(2.0) * (4.0 * ln_1 - 4.0 * ln_3 - 2.0 * ln1myd - 2.0 * ln1pyd + 8.0 * ln_60 + 8.0 * ln_67);
 
-            const complex<double> part3 = + log(1.0 / (2.0 * yd)) * ((-2.0 * pisqu * log(1.0 + winv)) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + (pisqu * log(1.0 + w)) / 3.0 + (2.0 * pisqu * log((w + yd) / w)) / 3.0 - pisqu * log(1.0 - yd / w)) + log(w / (1.0 - yd)) * ((pisqu * log(1.0 - w)) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + pisqu * ln1pyd + (2.0 * pisqu * log(1.0 - yd / w)) / 3.0)
-                + log((-0.5) * (1.0 / yd)) * ((-2.0 * pisqu * log(1.0 + winv)) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + (pisqu * log(1.0 + w)) / 3.0 - pisqu * log((w + yd) / w) + (2.0 * pisqu * log(1.0 - yd / w)) / 3.0) + dilog(2.0) * (-4.0 * ln2 * log(1.0 + winv) + 4.0 * ln2 * log(1.0 - w) + 2.0 * ln2 * ln1myd + 2.0 * ln2 * ln1pyd - 8.0 * ln2 * log((w + yd) / w) - 8.0 * ln2 * log(1.0 - yd / w))
-                + dilog(2.0 / (1.0 + w)) * (2.0 * dilog((1.0 - yd) / (1.0 + w)) + 2.0 * dilog((1.0 + yd) / (1.0 + w)) + ln1myd * (-2.0 * ln2 + 8.0 * log((1.0 + yd) / 2.0) - 8.0 * ln1pyd) + (-2.0 * ln2 + 8.0 * log((1.0 - yd) / 2.0)) * ln1pyd - 4.0 * ln2 * log((w + yd) / w) - 4.0 * ln2 * log(1.0 - yd / w)) + dilog(-2.0 / (-1.0 + yd)) * (-2.0 * ln2 * log(1.0 + winv) + 2.0 * ln2 * log(1.0 - w) + 4.0 * ln2 * log(1.0 - yd / w))
-                + dilog((2.0 * w) / (1.0 + w)) * (-2.0 * dilog(yd) + dilog((2.0 * yd) / (-1.0 + yd)) + dilog((2.0 * yd) / (1.0 + yd)) + 2.0 * ln2 * ln1myd + 2.0 * ln2 * ln1pyd + 4.0 * ln2 * log((w + yd) / w) + 4.0 * ln2 * log(1.0 - yd / w)) + log((1.0 + yd) / (-1.0 + yd)) * (-(ln2squ * log(1.0 + winv)) + ln2squ * log(1.0 - w) + 2.0 * ln2squ * log(1.0 - yd / w)) + dilog(ydinv) * ((2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w)) * ln1pyd - 4.0 * log((-1.0 + w) / w) * log((w + yd) / w) + (-4.0 * ln2 - 4.0 * log(1.0 + winv)) * log(1.0 - yd / w))
-                + dilog((1.0 + w) / (1.0 - w)) * (-2.0 * dilog((-1.0 + yd) / (-1.0 + w)) - 2.0 * dilog((1.0 + yd) / (1.0 - w)) + (4.0 * lnhalf + 2.0 * log(1.0 + winv) - 4.0 * log(1.0 / (1.0 - w))) * ln1myd + (4.0 * lnhalf + 2.0 * log(1.0 + winv) - 4.0 * log(1.0 / (1.0 - w))) * ln1pyd - 4.0 * log(1.0 + winv) * log((w + yd) / w) - 4.0 * log(1.0 + winv) * log(1.0 - yd / w))
-                + dilog((1.0 + w) / (2.0 * w)) * (-4.0 * dilog(yd / w) + 2.0 * dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) + 2.0 * dilog((yd + w * yd) / (w + w * yd)) + (4.0 * lnhalf - 4.0 * log(1.0 / (1.0 - w)) - 2.0 * log(1.0 + w)) * ln1myd + (4.0 * lnhalf - 4.0 * log(1.0 / (1.0 - w)) - 2.0 * log(1.0 + w)) * ln1pyd - 4.0 * log(1.0 + winv) * log((w + yd) / w) - 4.0 * log(1.0 + winv) * log(1.0 - yd / w))
-                + dilog((-1.0 + w) / (2.0 * w)) * (dilog((1.0 - yd) / 2.0) - 4.0 * dilog(-(yd / w)) - 4.0 * dilog(yd / w) + 2.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 2.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + dilog((1.0 + yd) / 2.0) + (4.0 * lnhalf + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * ln1myd + (4.0 * lnhalf + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * ln1pyd - 2.0 * log(1.0 - w) * log((w + yd) / w) - 2.0 * log(1.0 - w) * log(1.0 - yd / w))
-                + dilog((1.0 - w) / (1.0 + w)) * (2.0 * dilog(yd) - dilog(((-1.0 + w) * yd) / (w - yd)) - dilog((yd - w * yd) / (w + yd)) + (4.0 * lnhalf - 4.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w)) * ln1myd + (4.0 * lnhalf - 4.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w)) * ln1pyd + (2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * log((w + yd) / w) + (2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * log(1.0 - yd / w))
-                + dilog(-ydinv) * ((2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w)) * ln1myd + (-4.0 * ln2 - 4.0 * log(1.0 + winv)) * log((w + yd) / w) - 4.0 * log((-1.0 + w) / w) * log(1.0 - yd / w)) + dilog((-1.0 + w) / (1.0 + w)) * (-4.0 * dilog(yd / w) + 2.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 2.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + (4.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * ln1myd + (4.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w)) * ln1pyd + (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w)) * log((w + yd) / w)
-                + (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w)) * log(1.0 - yd / w)) + dilog((w - yd) / (w + w * yd)) * (-4.0 * log((w - yd) / (1.0 + w)) * ln1pyd + (2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 6.0 * ln1myd) * log(1.0 - yd / w)) + dilog((-1.0 + yd) / (-w + yd)) * (-8.0 * log(winv) * log((-1.0 + w) / w) + 8.0 * log((1.0 - yd) / 2.0) * ln1pyd + ln1myd * (-2.0 * ln2 - 2.0 * log(1.0 + w) + 8.0 * ln1pyd) - 4.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w))
-                + dilog((w - w * yd) / (w - yd)) * (ln1myd * (2.0 * ln2 + 2.0 * log(1.0 + w) - 8.0 * ln1pyd) + 4.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w)) + log((-1.0 + w) / (w - yd)) * (-4.0 * power_of<2>(log(winv)) * log((-1.0 + w) / w) + 4.0 * power_of<2>(log((1.0 - yd) / 2.0)) * ln1pyd + (2.0 * pisqu * log(1.0 - yd / w)) / 3.0 - 2.0 * power_of<2>(log((-1.0 + yd) / (-1.0 + w))) * log(1.0 - yd / w))
-                + dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) * ((4.0 * pisqu) / 3.0 + 2.0 * ln2 * log(1.0 - w) + 4.0 * lnhalf * log((-1.0 + w) / w) + 4.0 * power_of<2>(log((-1.0 + w) / w)) + 4.0 * log((-1.0 + w) / w) * log(1.0 / (1.0 + w)) + 2.0 * log(1.0 - w) * log(1.0 + w) + 4.0 * log(yd / w) * log(1.0 - yd / w)) + dilog((-w + yd) / (-1.0 + yd)) * (4.0 * log(1.0 - w) * log(w) - 4.0 * ln1myd * log((w - yd) / (-1.0 + w)) + 8.0 * log((w - yd) / (1.0 + w)) * ln1pyd + (4.0 * ln2 + 6.0 * log(1.0 + winv)) * log(1.0 - yd / w) - 2.0 * ln1pyd * log(1.0 - yd / w))
-                + dilog((w - yd) / (w - w * yd)) * (4.0 * ln1myd * log((w - yd) / (-1.0 + w)) + (-4.0 * ln2 - 6.0 * log(1.0 + winv) + 2.0 * ln1pyd) * log(1.0 - yd / w)) + log(((-1.0 + w) * yd) / (w * (-1.0 + yd))) * ((-2.0 * ln2 - 3.0 * log(1.0 + winv)) * power_of<2>(log(1.0 - yd / w)) + ln1pyd * power_of<2>(log(1.0 - yd / w))) + dilog((1.0 + yd) / (-1.0 + yd)) * (ln1myd * (4.0 * log((1.0 + yd) / 2.0) - 4.0 * log((1.0 + yd) / (1.0 - w))) + ln1pyd * (-6.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 4.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w)))
-                + dilog((-1.0 + yd) / (1.0 + yd)) * (-2.0 * dilog((yd + w * yd) / (w + w * yd)) + 4.0 * log((1.0 - yd) / 2.0) * ln1pyd - 4.0 * log((-1.0 + yd) / (-1.0 + w)) * ln1pyd + ln1myd * (-6.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 2.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w)))
-                + dilog(w) * (6.0 * dilog(yd) + 2.0 * dilog(yd / (-1.0 + yd)) - 2.0 * dilog((2.0 * yd) / (-1.0 + yd)) + 2.0 * dilog(yd / (1.0 + yd)) - 2.0 * dilog((2.0 * yd) / (1.0 + yd)) - 2.0 * ln2 * log((1.0 - yd) / (1.0 + yd)) - 2.0 * ln2 * log((1.0 + yd) / (1.0 - yd)) - 2.0 * power_of<2>(log((w + yd) / w)) + ln1myd * (-4.0 * ln2 - 4.0 * log(1.0 + w) + 8.0 * log((w + yd) / w)) - 2.0 * power_of<2>(log(1.0 - yd / w)) + ln1pyd * (-4.0 * ln2 - 4.0 * log(1.0 + w) + 8.0 * log(1.0 - yd / w)))
-                + log((-1.0 + w) / (-1.0 + yd)) * (2.0 * log(1.0 - w) * power_of<2>(log(w)) + (2.0 * ln2 + 3.0 * log(1.0 + winv)) * power_of<2>(log(1.0 - yd / w)) + ln1pyd * (4.0 * power_of<2>(log((w - yd) / (1.0 + w))) - power_of<2>(log(1.0 - yd / w)))) + 2.0 * power_of<2>(log(yd / w)) * log(1.0 - yd / w) * log((w - yd) / (w - w * yd)) + dilog((w - yd) / ((-1.0 + w) * yd)) * (-4.0 * ln1pyd * log(1.0 - yd / w) + 8.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)))
-                + log((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * ((-4.0 * pisqu * log((-1.0 + w) / w)) / 3.0 - 2.0 * ln1pyd * power_of<2>(log(1.0 - yd / w)) + 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w - yd) / (w - w * yd)))) + (2.0 * pisqu * log(1.0 - w) * log(yd / (w - w * yd))) / 3.0 + (2.0 * log(1.0 - w) * power_of<3>(log(yd / (w - w * yd)))) / 3.0 + trilog((1.0 + yd) / (-1.0 + yd)) * (6.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 4.0 * log(1.0 / (1.0 - yd)) - 4.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) - 4.0 * log((w + yd) / (w - w * yd)))
-                - 2.0 * log(1.0 + winv) * log((1.0 - yd) / (1.0 + w)) * power_of<2>(log((w + yd) / (w - w * yd))) + dilog((w + yd) / (1.0 + w)) * ((-4.0 * ln2 - 2.0 * log(1.0 - w)) * log((w + yd) / w) - 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd))) + dilog((w + yd) / (yd + w * yd)) * ((4.0 * ln2 + 2.0 * log(1.0 - w)) * log((w + yd) / w) - 4.0 * ln1myd * log((w + yd) / (1.0 + w)) + 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd)))
-                + log((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * ((-2.0 * pisqu * log(1.0 + winv)) / 3.0 + (2.0 * ln2 + log(1.0 - w)) * power_of<2>(log((w + yd) / w)) + 2.0 * log(1.0 + winv) * power_of<2>(log((w + yd) / (w - w * yd)))) + trilog(-((1.0 + yd) / (w - yd))) * (2.0 * ln2 + 4.0 * log(1.0 + winv) - 2.0 * ln1myd - 2.0 * log(w / (w - yd)) + 2.0 * log((w - w * yd) / (w - yd))) + trilog(((1.0 + w) * yd) / (-w + yd)) * (4.0 * log((-1.0 + w) / w) - 2.0 * ln1myd - 2.0 * log(w / (w - yd)) - 4.0 * ln1pyd + 2.0 * log((w - w * yd) / (w - yd)))
-                + dilog((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * (ln1myd * (-2.0 * log(1.0 + winv) - 2.0 * ln1pyd) - 4.0 * log(1.0 - w) * log((w - w * yd) / (w - yd))) + dilog(1.0 - yd) * (-2.0 * dilog((1.0 - yd) / (1.0 + w)) + 4.0 * dilog((-1.0 + yd) / (-1.0 + w)) + 4.0 * ln1myd * log((w - yd) / (-1.0 + w)) - 4.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w) - 4.0 * log(1.0 - w) * log((w - w * yd) / (w - yd)))
-                + dilog((-1.0 + yd) / (-1.0 + w)) * ((-2.0 * pisqu) / 3.0 - 4.0 * dilog(-yd) - 2.0 * power_of<2>(ln1myd) + 12.0 * log((1.0 - yd) / 2.0) * ln1pyd + 4.0 * power_of<2>(ln1pyd) + ln1myd * (-4.0 * lnhalf + 2.0 * log(1.0 + winv) + 2.0 * ln1pyd) + 4.0 * log(1.0 - w) * log((w - w * yd) / (w - yd))) + log((w - yd) / ((-1.0 + w) * yd)) * ((2.0 * pisqu * log(1.0 - w)) / 3.0 - 2.0 * log(1.0 - w) * power_of<2>(log((w - w * yd) / (w - yd)))) - 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / w) * log((w - w * yd) / (w + yd)) + (pisqu * log(1.0 + winv) * log(w / (yd - w * yd))) / 3.0
-                + (log(1.0 + winv) * power_of<3>(log(w / (yd - w * yd)))) / 3.0 + (2.0 * pisqu * log(1.0 - w) * log((w + yd) / (yd - w * yd))) / 3.0 + (2.0 * log(1.0 - w) * power_of<3>(log((w + yd) / (yd - w * yd)))) / 3.0 + trilog((-1.0 + yd) / (1.0 + yd)) * (6.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 4.0 * log(1.0 / (1.0 + yd)) - 2.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w) - 4.0 * log((w - yd) / (w + w * yd)))
-                + trilog(1.0 + winv) * (-4.0 * log(1.0 / (1.0 - yd)) + 4.0 * ln1myd - 4.0 * log(1.0 / (1.0 + yd)) + 4.0 * ln1pyd - 4.0 * log((w + yd) / (w - w * yd)) - 4.0 * log((w - yd) / (w + w * yd))) - 2.0 * log(1.0 + winv) * log((1.0 + yd) / (1.0 + w)) * power_of<2>(log((w - yd) / (w + w * yd))) + trilog((1.0 + w) / (2.0 * w)) * (2.0 * ln1myd + 2.0 * ln1pyd + 4.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w) + 4.0 * log((w + yd) / (w - w * yd)) + 4.0 * log((w - yd) / (w + w * yd)))
-                + dilog((w - yd) / (1.0 + w)) * (2.0 * dilog(yd) + (-4.0 * ln2 - 2.0 * log(1.0 - w)) * log(1.0 - yd / w) - 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd))) + dilog(1.0 + winv) * (-4.0 * dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) + 4.0 * dilog(yd / (1.0 + yd)) - 4.0 * dilog((yd + w * yd) / (w + w * yd)) + 4.0 * log(1.0 + w) * ln1myd - 2.0 * power_of<2>(ln1myd) + 4.0 * log(1.0 + w) * ln1pyd - 2.0 * power_of<2>(ln1pyd) - 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd)) - 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd)))
-                + dilog(-((w - yd) / (yd + w * yd))) * (-4.0 * log((w - yd) / (1.0 + w)) * ln1pyd + (4.0 * ln2 + 2.0 * log(1.0 - w)) * log(1.0 - yd / w) + 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd))) + dilog(1.0 - yd / w) * (-4.0 * ln1myd * log((w - yd) / (-1.0 + w)) + 4.0 * log((w - yd) / (1.0 + w)) * ln1pyd + 2.0 * power_of<2>(ln1pyd) + 4.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w) + 8.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) + 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd)))
-                + log(yd / w) * (2.0 * power_of<2>(log((w - yd) / (1.0 + w))) * ln1pyd + 2.0 * log((w - yd) / (1.0 + w)) * power_of<2>(ln1pyd) + 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w - yd) / (w - w * yd))) + 2.0 * log(1.0 + winv) * power_of<2>(log((w - yd) / (w + w * yd)))) + (2.0 * pisqu * log(1.0 - w) * log(-(yd / (w + w * yd)))) / 3.0 + (2.0 * log(1.0 - w) * power_of<3>(log(-(yd / (w + w * yd))))) / 3.0 + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * log(1.0 + w)) / 3.0) * log(yd / (w + w * yd)) + ((-1.0 / 3.0) * ln2 - log(1.0 + w) / 3.0) * power_of<3>(log(yd / (w + w * yd)))
-                + 2.0 * power_of<2>(log(-(yd / w))) * log((w + yd) / w) * log((w + yd) / (w + w * yd)) + trilog((-1.0 + w) / (2.0 * w)) * (-4.0 * lnhalf + 2.0 * log((1.0 - yd) / 2.0) - 2.0 * ln1myd + 2.0 * log((1.0 + yd) / 2.0) - 2.0 * ln1pyd + 2.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w) + 4.0 * log((w - yd) / (w - w * yd)) + 4.0 * log((w + yd) / (w + w * yd))) + dilog((w + yd) / (yd - w * yd)) * (-4.0 * ln1myd * log((w + yd) / w) + 8.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)))
-                + dilog((w + yd) / w) * (2.0 * power_of<2>(ln1myd) - 4.0 * ln1pyd * log((w + yd) / (-1.0 + w)) + 4.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w) + 4.0 * ln1myd * log((w + yd) / (1.0 + w)) + 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd)) + 8.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd))) + log((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * ((-4.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w + yd) / (w + w * yd))))
-                + log(-(yd / w)) * (2.0 * log(1.0 + winv) * power_of<2>(log((w + yd) / (w - w * yd))) + 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w + yd) / (w + w * yd)))) + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * log(1.0 - w)) / 3.0) * log(-(w / (yd + w * yd))) + ((-1.0 / 3.0) * ln2 - log(1.0 - w) / 3.0) * power_of<3>(log(-(w / (yd + w * yd)))) + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * log(1.0 - w)) / 3.0) * log(w / (yd + w * yd)) + ((-1.0 / 3.0) * ln2 - log(1.0 - w) / 3.0) * power_of<3>(log(w / (yd + w * yd))) - (2.0 * pisqu * log(1.0 + winv) * log((w + w * yd) / (yd + w * yd))) / 3.0
-                - (2.0 * log(1.0 + winv) * power_of<3>(log((w + w * yd) / (yd + w * yd)))) / 3.0 + (4.0 * 1.0i) * M_PI * H1(yd / (w + yd), 1.0 / (1.0 - w)) * log(1.0 - w) * power_of<2>(log(w * (1.0 + ydinv))) * my_sign(-imag(1.0 / (1.0 - w))) + (4.0 * 1.0i) * M_PI * H1(-(yd / (w - yd)), 1.0 / (1.0 - w)) * log(1.0 - w) * power_of<2>(log((w * (-1.0 + yd)) / yd)) * my_sign(imag(1.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * H2(winv, ydinv) * trilog((2.0 * w) / (w - yd)) * my_sign(imag(winv)) - (4.0 * 1.0i) * M_PI * H2(winv, -ydinv) * trilog((2.0 * w) / (w + yd)) * my_sign(imag(winv))
-                + trilog((1.0 + w) / (w + yd)) * (-4.0 * log((-1.0 + w) / w) - 4.0 * ln1myd + 2.0 * ln1pyd - (4.0 * 1.0i) * M_PI * H2(winv, -ydinv) * my_sign(imag(winv))) + trilog((1.0 + w) / (w - yd)) * (-4.0 * log((-1.0 + w) / w) + 2.0 * ln1myd - 4.0 * ln1pyd - (4.0 * 1.0i) * M_PI * H2(winv, ydinv) * my_sign(imag(winv))) + power_of<2>(log(-((w * (1.0 + yd)) / yd))) * ((2.0 * 1.0i) * M_PI * H1(-(yd / w), winv) * ln2 * my_sign(imag(winv)) + (2.0 * 1.0i) * M_PI * H1(-(yd / w), winv) * log(1.0 + w) * my_sign(imag(winv)))
-                + power_of<2>(log(w * (-1.0 + ydinv))) * ((2.0 * 1.0i) * M_PI * H1(yd / w, winv) * ln2 * my_sign(imag(winv)) + (2.0 * 1.0i) * M_PI * H1(yd / w, winv) * log(1.0 + w) * my_sign(imag(winv))) - (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * power_of<2>(log((-1.0 + yd) / (w + yd))) * log((w * (1.0 + yd)) / (w + yd)) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * power_of<2>(log(-((1.0 + yd) / (w - yd)))) * log((w - w * yd) / (w - yd)) * my_sign(-imag(w))
-                + trilog(2.0 / (1.0 + yd)) * (2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) - 8.0 * ln1myd - 4.0 * log((w + yd) / w) + (8.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (8.0 * 1.0i) * M_PI * H2(w, -(w / yd)) * my_sign(imag(w))) + trilog(-2.0 / (-1.0 + yd)) * (2.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) - 8.0 * ln1pyd - 4.0 * log(1.0 - yd / w) + (8.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (8.0 * 1.0i) * M_PI * H2(w, w / yd) * my_sign(imag(w)))
-                + power_of<2>(log(winv - ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(-yd, -w) * log((-1.0 + w) / w) * my_sign(-imag(w)) - (8.0 * 1.0i) * M_PI * H1(yd / (-1.0 + yd), w / (-1.0 + w)) * log((-1.0 + w) / w) * my_sign(imag(w / (1.0 - w)))) + power_of<2>(log(winv + ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(yd, -w) * log((-1.0 + w) / w) * my_sign(-imag(w)) - (8.0 * 1.0i) * M_PI * H1(yd / (1.0 + yd), w / (-1.0 + w)) * log((-1.0 + w) / w) * my_sign(imag(w / (1.0 - w))))
-                + power_of<2>(log(-((w + yd) / (w * yd)))) * ((-4.0 * 1.0i) * M_PI * H1(-yd, w) * ln2 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(-yd, w) * log(1.0 + winv) * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd / (-1.0 + yd), w / (1.0 + w)) * log(1.0 + winv) * my_sign(-imag(w / (1.0 + w)))) + power_of<2>(log(-winv + ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(yd, w) * ln2 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd, w) * log(1.0 + winv) * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd / (1.0 + yd), w / (1.0 + w)) * log(1.0 + winv) * my_sign(-imag(w / (1.0 + w)))) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * trilog((-2.0 * yd) / (w - yd)) * my_sign(-imydinv)
-                - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(-1.0 + 2.0 / w) * my_sign(-imydinv) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(winv) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(w) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(-imydinv) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(-((-2.0 + w) * w)) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(-(w / yd), -ydinv) * log(1.0 + winv) * power_of<2>(log(((-1.0 + w) * yd) / w)) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * ln2 * power_of<2>(log(-w + yd)) * my_sign(-imydinv)
-                - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * power_of<2>(log(((1.0 + w) * yd) / (-w + yd))) * log((w - w * yd) / (w - yd)) * my_sign(-imydinv) + trilog((2.0 * (w + yd)) / yd) * ((-4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) + dilog((2.0 * (w + yd)) / yd) * log(1.0 - power_of<2>(w) / yd2) * ((4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv))
-                + trilog(-(yd / (w - yd))) * (-2.0 * lnhalf - 4.0 * log(1.0 + winv) - 8.0 * log((-1.0 + w) / w) - 2.0 * log(w / (1.0 + w)) + 6.0 * ln1myd - 4.0 * log(w / (w - yd)) - 4.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv))
-                + trilog(((-1.0 + w) * yd) / (w - yd)) * (2.0 * lnhalf + 4.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 2.0 * log(w / (1.0 + w)) - 4.0 * ln1myd - 4.0 * log(w / (w - yd)) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv)) + power_of<2>(log(w + yd)) * ((-2.0 * 1.0i) * M_PI * H1(winv, -ydinv) * ln2 * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(winv, -ydinv) * log(1.0 + w) * my_sign(-imydinv))
-                + dilog(((-1.0 + w) * yd) / (w - yd)) * ((-2.0 * pisqu) / 3.0 + dilog(-((1.0 + yd) / (w - yd))) + dilog(((1.0 + w) * yd) / (-w + yd)) - 2.0 * lnhalf * log(1.0 - w) - 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * ln2 * log((-1.0 + w) / w) - 4.0 * log(1.0 + winv) * log((-1.0 + w) / w) - 2.0 * log(1.0 - w) * log(w / (1.0 + w)) + 4.0 * ln1myd * log(yd) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * log(-((1.0 + yd) / (w - yd))) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(((1.0 + w) * yd) / (-w + yd)) * my_sign(-imydinv))
-                + dilog(-(yd / (w - yd))) * ((2.0 * pisqu) / 3.0 - 4.0 * dilog(1.0 - w) - 2.0 * dilog(((-1.0 + w) * yd) / (w - yd)) - dilog(-((1.0 + yd) / (w - yd))) - dilog(((1.0 + w) * yd) / (-w + yd)) + 4.0 * log(1.0 + winv) * log(-winv) + 8.0 * log(winv) * log((-1.0 + w) / w) - 4.0 * ln1myd * log(yd) + 4.0 * log(yd / w) * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * log(-((1.0 + yd) / (w - yd))) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(((1.0 + w) * yd) / (-w + yd)) * my_sign(-imydinv))
-                + dilog((w + yd) / yd) * (-4.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) + (-8.0 * ln2 - 6.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 6.0 * ln1myd + 6.0 * ln1pyd) * log((w + yd) / w) + 4.0 * ln1myd * log((w + yd) / (1.0 + w)) + log(1.0 - power_of<2>(w) / yd2) * ((-4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv))) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * trilog((2.0 * yd) / (w + yd)) * my_sign(imydinv)
-                - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(-1.0 + 2.0 / w) * my_sign(imydinv) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(winv) * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(w) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(imydinv) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(-((-2.0 + w) * w)) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(-winv, ydinv) * ln2 * power_of<2>(log(-w - yd)) * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(w / yd, ydinv) * log(1.0 + winv) * power_of<2>(log((-1.0 + winv) * yd)) * my_sign(imydinv)
-                - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * power_of<2>(log(((1.0 + w) * yd) / (w + yd))) * log((w * (1.0 + yd)) / (w + yd)) * my_sign(imydinv) + trilog(2.0 - (2.0 * w) / yd) * ((-4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)) + dilog(2.0 - (2.0 * w) / yd) * log(1.0 - power_of<2>(w) / yd2) * ((4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv))
-                + trilog(yd / (w + yd)) * (-2.0 * lnhalf - 4.0 * log(1.0 + winv) - 8.0 * log((-1.0 + w) / w) - 2.0 * log(w / (1.0 + w)) + 4.0 * ln1myd + 6.0 * ln1pyd - 4.0 * log(w / (w + yd)) - 4.0 * log((w + yd) / w) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv))
-                + trilog((yd - w * yd) / (w + yd)) * (2.0 * lnhalf + 4.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log(1.0 - w) + 2.0 * log(w / (1.0 + w)) - 4.0 * ln1pyd - 4.0 * log(w / (w + yd)) + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv)) + trilog((2.0 * w) / (-1.0 + w)) * (-4.0 * log(1.0 / (1.0 - w)) + 2.0 * log((-1.0 + yd) / (-1.0 + w)) + 2.0 * log((1.0 + yd) / (1.0 - w)) - (8.0 * 1.0i) * M_PI * H2(-ydinv, -(w / yd)) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * H2(ydinv, w / yd) * my_sign(imydinv))
-                + trilog((2.0 * w) / (1.0 + w)) * (-2.0 * ln1myd + 2.0 * log((1.0 - yd) / (1.0 + yd)) - 2.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - yd)) - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv)) + power_of<2>(log(w - yd)) * ((-2.0 * 1.0i) * M_PI * H1(winv, ydinv) * ln2 * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(winv, ydinv) * log(1.0 + w) * my_sign(imydinv))
-                + dilog((yd - w * yd) / (w + yd)) * ((-2.0 * pisqu) / 3.0 - 2.0 * lnhalf * log(1.0 - w) - 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * ln2 * log((-1.0 + w) / w) - 4.0 * log(1.0 + winv) * log((-1.0 + w) / w) - 2.0 * log(1.0 - w) * log(w / (1.0 + w)) + 4.0 * log(-yd) * ln1pyd - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * log((-1.0 + yd) / (w + yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(((1.0 + w) * yd) / (w + yd)) * my_sign(imydinv))
-                + dilog(yd / (w + yd)) * ((2.0 * pisqu) / 3.0 - dilog((-1.0 + yd) / (w + yd)) - dilog(((1.0 + w) * yd) / (w + yd)) - 2.0 * dilog((yd - w * yd) / (w + yd)) + 4.0 * log(1.0 + winv) * log(-winv) + 8.0 * log(winv) * log((-1.0 + w) / w) - 4.0 * ln1myd * log(yd) - 4.0 * log(-yd) * ln1pyd + 4.0 * log(-(yd / w)) * log((w + yd) / w) + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * log((-1.0 + yd) / (w + yd)) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(((1.0 + w) * yd) / (w + yd)) * my_sign(imydinv))
-                + power_of<2>(log(1.0 - power_of<2>(w) / yd2)) * (log(-1.0 - (2.0 * w) / yd) * ((2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) + log(-1.0 + (2.0 * w) / yd) * ((2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)))
-                + dilog(1.0 - w / yd) * (4.0 * log((w - yd) / (1.0 + w)) * ln1pyd + (-8.0 * ln2 - 6.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 6.0 * ln1myd) * log(1.0 - yd / w) + 6.0 * ln1pyd * log(1.0 - yd / w) - 4.0 * log(1.0 - w) * log((w - w * yd) / (w - yd)) + log(1.0 - power_of<2>(w) / yd2) * ((-4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv))) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), -ydinv) * trilog((1.0 - yd) / ((-1.0 + w) * yd)) * my_sign(-imag(w / yd))
-                + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * trilog(-(((-1.0 + w) * yd) / (-1.0 + yd))) * my_sign(-imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(-1.0 + 2.0 / w) * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(winv) * my_sign(-imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(w) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(-((-2.0 + w) * w)) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(-imag(w / yd))
+            const complex<double> part3 = + log(1.0 / (2.0 * yd)) * ((-2.0 * pisqu * ln_1) / 3.0 - (2.0 * pisqu * ln_5) / 3.0 + (pisqu * ln_12) / 3.0 + (2.0 * pisqu * ln_60) / 3.0 - pisqu * ln_67) + log(w / (1.0 - yd)) * ((pisqu * ln_3) / 3.0 - (2.0 * pisqu * ln_5) / 3.0 + pisqu * ln1pyd + (2.0 * pisqu * ln_67) / 3.0)
+                + log((-0.5) * (1.0 / yd)) * ((-2.0 * pisqu * ln_1) / 3.0 - (2.0 * pisqu * ln_5) / 3.0 + (pisqu * ln_12) / 3.0 - pisqu * ln_60 + (2.0 * pisqu * ln_67) / 3.0) + dilog(2.0) * (-4.0 * ln2 * ln_1 + 4.0 * ln2 * ln_3 + 2.0 * ln2 * ln1myd + 2.0 * ln2 * ln1pyd - 8.0 * ln2 * ln_60 - 8.0 * ln2 * ln_67)
+                + li2_46 * (2.0 * li2_7 + 2.0 * li2_32 + ln1myd * (-2.0 * ln2 + 8.0 * ln_24 - 8.0 * ln1pyd) + (-2.0 * ln2 + 8.0 * ln_14) * ln1pyd - 4.0 * ln2 * ln_60 - 4.0 * ln2 * ln_67) + dilog(-2.0 / (-1.0 + yd)) * (-2.0 * ln2 * ln_1 + 2.0 * ln2 * ln_3 + 4.0 * ln2 * ln_67)
+                + li2_47 * (-2.0 * li2_17 + li2_23 + li2_24 + 2.0 * ln2 * ln1myd + 2.0 * ln2 * ln1pyd + 4.0 * ln2 * ln_60 + 4.0 * ln2 * ln_67) + log((1.0 + yd) / (-1.0 + yd)) * (-(ln2squ * ln_1) + ln2squ * ln_3 + 2.0 * ln2squ * ln_67) + dilog(ydinv) * ((2.0 * ln_1 - 2.0 * ln_3) * ln1pyd - 4.0 * ln_5 * ln_60 + (-4.0 * ln2 - 4.0 * ln_1) * ln_67)
+                + li2_35 * (-2.0 * li2_22 - 2.0 * li2_25 + (4.0 * lnhalf + 2.0 * ln_1 - 4.0 * ln_2) * ln1myd + (4.0 * lnhalf + 2.0 * ln_1 - 4.0 * ln_2) * ln1pyd - 4.0 * ln_1 * ln_60 - 4.0 * ln_1 * ln_67)
+                + li2_31 * (-4.0 * li2_26 + 2.0 * li2_12 + 2.0 * li2_20 + (4.0 * lnhalf - 4.0 * ln_2 - 2.0 * ln_12) * ln1myd + (4.0 * lnhalf - 4.0 * ln_2 - 2.0 * ln_12) * ln1pyd - 4.0 * ln_1 * ln_60 - 4.0 * ln_1 * ln_67)
+                + li2_48 * (li2_49 - 4.0 * li2_29 - 4.0 * li2_26 + 2.0 * li2_50 + 2.0 * li2_42 + li2_18 + (4.0 * lnhalf + 2.0 * ln_3 - 4.0 * ln_5) * ln1myd + (4.0 * lnhalf + 2.0 * ln_3 - 4.0 * ln_5) * ln1pyd - 2.0 * ln_3 * ln_60 - 2.0 * ln_3 * ln_67)
+                + li2_51 * (2.0 * li2_17 - li2_52 - li2_15 + (4.0 * lnhalf - 4.0 * ln_3 + 4.0 * ln_5) * ln1myd + (4.0 * lnhalf - 4.0 * ln_3 + 4.0 * ln_5) * ln1pyd + (2.0 * ln_3 - 4.0 * ln_5) * ln_60 + (2.0 * ln_3 - 4.0 * ln_5) * ln_67)
+                + dilog(-ydinv) * ((2.0 * ln_1 - 2.0 * ln_3) * ln1myd + (-4.0 * ln2 - 4.0 * ln_1) * ln_60 - 4.0 * ln_5 * ln_67) + li2_30 * (-4.0 * li2_26 + 2.0 * li2_50 + 2.0 * li2_42 + (4.0 * ln_3 - 4.0 * ln_5) * ln1myd + (4.0 * ln_3 - 4.0 * ln_5) * ln1pyd + (-2.0 * ln_3 + 4.0 * ln_5) * ln_60
+                + (-2.0 * ln_3 + 4.0 * ln_5) * ln_67) + li2_53 * (-4.0 * ln_35 * ln1pyd + (2.0 * ln_3 - 4.0 * ln_5 + 6.0 * ln1myd) * ln_67) + dilog((-1.0 + yd) / (-w + yd)) * (-8.0 * ln_4 * ln_5 + 8.0 * ln_14 * ln1pyd + ln1myd * (-2.0 * ln2 - 2.0 * ln_12 + 8.0 * ln1pyd) - 4.0 * ln_26 * ln_67)
+                + li2_54 * (ln1myd * (2.0 * ln2 + 2.0 * ln_12 - 8.0 * ln1pyd) + 4.0 * ln_26 * ln_67) + ln_69 * (-4.0 * power_of<2>(ln_4) * ln_5 + 4.0 * power_of<2>(ln_14) * ln1pyd + (2.0 * pisqu * ln_67) / 3.0 - 2.0 * power_of<2>(ln_26) * ln_67)
+                + li2_50 * ((4.0 * pisqu) / 3.0 + 2.0 * ln2 * ln_3 + 4.0 * lnhalf * ln_5 + 4.0 * power_of<2>(ln_5) + 4.0 * ln_5 * ln_61 + 2.0 * ln_3 * ln_12 + 4.0 * ln_72 * ln_67) + dilog((-w + yd) / (-1.0 + yd)) * (4.0 * ln_3 * ln_7 - 4.0 * ln1myd * ln_54 + 8.0 * ln_35 * ln1pyd + (4.0 * ln2 + 6.0 * ln_1) * ln_67 - 2.0 * ln1pyd * ln_67)
+                + li2_55 * (4.0 * ln1myd * ln_54 + (-4.0 * ln2 - 6.0 * ln_1 + 2.0 * ln1pyd) * ln_67) + ln_73 * ((-2.0 * ln2 - 3.0 * ln_1) * power_of<2>(ln_67) + ln1pyd * power_of<2>(ln_67)) + li2_13 * (ln1myd * (4.0 * ln_24 - 4.0 * ln_42) + ln1pyd * (-6.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_5 + 2.0 * ln_12 + 4.0 * ln_60 + 2.0 * ln_67))
+                + li2_56 * (-2.0 * li2_20 + 4.0 * ln_14 * ln1pyd - 4.0 * ln_26 * ln1pyd + ln1myd * (-6.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_5 + 2.0 * ln_12 + 2.0 * ln_60 + 4.0 * ln_67))
+                + li2_57 * (6.0 * li2_17 + 2.0 * li2_37 - 2.0 * li2_23 + 2.0 * li2_38 - 2.0 * li2_24 - 2.0 * ln2 * ln_22 - 2.0 * ln2 * ln_44 - 2.0 * power_of<2>(ln_60) + ln1myd * (-4.0 * ln2 - 4.0 * ln_12 + 8.0 * ln_60) - 2.0 * power_of<2>(ln_67) + ln1pyd * (-4.0 * ln2 - 4.0 * ln_12 + 8.0 * ln_67))
+                + ln_74 * (2.0 * ln_3 * power_of<2>(ln_7) + (2.0 * ln2 + 3.0 * ln_1) * power_of<2>(ln_67) + ln1pyd * (4.0 * power_of<2>(ln_35) - power_of<2>(ln_67))) + 2.0 * power_of<2>(ln_72) * ln_67 * ln_75 + dilog((w - yd) / ((-1.0 + w) * yd)) * (-4.0 * ln1pyd * ln_67 + 8.0 * ln_5 * ln_75)
+                + log((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * ((-4.0 * pisqu * ln_5) / 3.0 - 2.0 * ln1pyd * power_of<2>(ln_67) + 4.0 * ln_5 * power_of<2>(ln_75)) + (2.0 * pisqu * ln_3 * log(yd / (w - w * yd))) / 3.0 + (2.0 * ln_3 * power_of<3>(log(yd / (w - w * yd)))) / 3.0 + trilog((1.0 + yd) / (-1.0 + yd)) * (6.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln_5 - 2.0 * ln_12 + 4.0 * ln_13 - 4.0 * ln_60 - 2.0 * ln_67 - 4.0 * ln_76)
+                - 2.0 * ln_1 * ln_77 * power_of<2>(ln_76) + li2_58 * ((-4.0 * ln2 - 2.0 * ln_3) * ln_60 - 4.0 * ln_1 * ln_76) + dilog((w + yd) / (yd + w * yd)) * ((4.0 * ln2 + 2.0 * ln_3) * ln_60 - 4.0 * ln1myd * ln_66 + 4.0 * ln_1 * ln_76)
+                + ln_18 * ((-2.0 * pisqu * ln_1) / 3.0 + (2.0 * ln2 + ln_3) * power_of<2>(ln_60) + 2.0 * ln_1 * power_of<2>(ln_76)) + trilog(-((1.0 + yd) / (w - yd))) * (2.0 * ln2 + 4.0 * ln_1 - 2.0 * ln1myd - 2.0 * ln_15 + 2.0 * ln_78) + trilog(((1.0 + w) * yd) / (-w + yd)) * (4.0 * ln_5 - 2.0 * ln1myd - 2.0 * ln_15 - 4.0 * ln1pyd + 2.0 * ln_78)
+                + dilog((w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * (ln1myd * (-2.0 * ln_1 - 2.0 * ln1pyd) - 4.0 * ln_3 * ln_78) + li2_36 * (-2.0 * li2_7 + 4.0 * li2_22 + 4.0 * ln1myd * ln_54 - 4.0 * ln_26 * ln_67 - 4.0 * ln_3 * ln_78)
+                + li2_22 * ((-2.0 * pisqu) / 3.0 - 4.0 * li2_8 - 2.0 * power_of<2>(ln1myd) + 12.0 * ln_14 * ln1pyd + 4.0 * power_of<2>(ln1pyd) + ln1myd * (-4.0 * lnhalf + 2.0 * ln_1 + 2.0 * ln1pyd) + 4.0 * ln_3 * ln_78) + ln_17 * ((2.0 * pisqu * ln_3) / 3.0 - 2.0 * ln_3 * power_of<2>(ln_78)) - 2.0 * power_of<2>(ln_1) * ln_5 * ln_79 + (pisqu * ln_1 * ln_80) / 3.0
+                + (ln_1 * power_of<3>(ln_80)) / 3.0 + (2.0 * pisqu * ln_3 * ln_81) / 3.0 + (2.0 * ln_3 * power_of<3>(ln_81)) / 3.0 + trilog((-1.0 + yd) / (1.0 + yd)) * (6.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln_5 - 2.0 * ln_12 + 4.0 * ln_20 - 2.0 * ln_60 - 4.0 * ln_67 - 4.0 * ln_82)
+                + trilog(1.0 + winv) * (-4.0 * ln_13 + 4.0 * ln1myd - 4.0 * ln_20 + 4.0 * ln1pyd - 4.0 * ln_76 - 4.0 * ln_82) - 2.0 * ln_1 * ln_83 * power_of<2>(ln_82) + trilog((1.0 + w) / (2.0 * w)) * (2.0 * ln1myd + 2.0 * ln1pyd + 4.0 * ln_60 + 4.0 * ln_67 + 4.0 * ln_76 + 4.0 * ln_82)
+                + li2_59 * (2.0 * li2_17 + (-4.0 * ln2 - 2.0 * ln_3) * ln_67 - 4.0 * ln_1 * ln_82) + li2_60 * (-4.0 * li2_12 + 4.0 * li2_38 - 4.0 * li2_20 + 4.0 * ln_12 * ln1myd - 2.0 * power_of<2>(ln1myd) + 4.0 * ln_12 * ln1pyd - 2.0 * power_of<2>(ln1pyd) - 4.0 * ln_1 * ln_76 - 4.0 * ln_1 * ln_82)
+                + dilog(-((w - yd) / (yd + w * yd))) * (-4.0 * ln_35 * ln1pyd + (4.0 * ln2 + 2.0 * ln_3) * ln_67 + 4.0 * ln_1 * ln_82) + li2_61 * (-4.0 * ln1myd * ln_54 + 4.0 * ln_35 * ln1pyd + 2.0 * power_of<2>(ln1pyd) + 4.0 * ln_26 * ln_67 + 8.0 * ln_5 * ln_75 + 4.0 * ln_1 * ln_82)
+                + ln_72 * (2.0 * power_of<2>(ln_35) * ln1pyd + 2.0 * ln_35 * power_of<2>(ln1pyd) + 4.0 * ln_5 * power_of<2>(ln_75) + 2.0 * ln_1 * power_of<2>(ln_82)) + (2.0 * pisqu * ln_3 * log(-(yd / (w + w * yd)))) / 3.0 + (2.0 * ln_3 * power_of<3>(log(-(yd / (w + w * yd))))) / 3.0 + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * ln_12) / 3.0) * log(yd / (w + w * yd)) + ((-1.0 / 3.0) * ln2 - ln_12 / 3.0) * power_of<3>(log(yd / (w + w * yd)))
+                + 2.0 * power_of<2>(ln_65) * ln_60 * ln_84 + trilog((-1.0 + w) / (2.0 * w)) * (-4.0 * lnhalf + 2.0 * ln_14 - 2.0 * ln1myd + 2.0 * ln_24 - 2.0 * ln1pyd + 2.0 * ln_60 + 2.0 * ln_67 + 4.0 * ln_75 + 4.0 * ln_84) + dilog((w + yd) / (yd - w * yd)) * (-4.0 * ln1myd * ln_60 + 8.0 * ln_5 * ln_84)
+                + li2_62 * (2.0 * power_of<2>(ln1myd) - 4.0 * ln1pyd * ln_58 + 4.0 * ln_42 * ln_60 + 4.0 * ln1myd * ln_66 + 4.0 * ln_1 * ln_76 + 8.0 * ln_5 * ln_84) + ln_47 * ((-4.0 * pisqu * ln_5) / 3.0 + 4.0 * ln_5 * power_of<2>(ln_84))
+                + ln_65 * (2.0 * ln_1 * power_of<2>(ln_76) + 4.0 * ln_5 * power_of<2>(ln_84)) + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * ln_3) / 3.0) * log(-(w / (yd + w * yd))) + ((-1.0 / 3.0) * ln2 - ln_3 / 3.0) * power_of<3>(log(-(w / (yd + w * yd)))) + ((-1.0 / 3.0) * (pisqu * ln2) - (pisqu * ln_3) / 3.0) * log(w / (yd + w * yd)) + ((-1.0 / 3.0) * ln2 - ln_3 / 3.0) * power_of<3>(log(w / (yd + w * yd))) - (2.0 * pisqu * ln_1 * ln_85) / 3.0
+                - (2.0 * ln_1 * power_of<3>(ln_85)) / 3.0 + (4.0 * 1.0i) * M_PI * H1(yd / (w + yd), 1.0 / (1.0 - w)) * ln_3 * power_of<2>(log(w * (1.0 + ydinv))) * my_sign(-imag(1.0 / (1.0 - w))) + (4.0 * 1.0i) * M_PI * H1(-(yd / (w - yd)), 1.0 / (1.0 - w)) * ln_3 * power_of<2>(log((w * (-1.0 + yd)) / yd)) * my_sign(imag(1.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * H2(winv, ydinv) * trilog((2.0 * w) / (w - yd)) * my_sign(imag(winv)) - (4.0 * 1.0i) * M_PI * H2(winv, -ydinv) * trilog((2.0 * w) / (w + yd)) * my_sign(imag(winv))
+                + trilog((1.0 + w) / (w + yd)) * (-4.0 * ln_5 - 4.0 * ln1myd + 2.0 * ln1pyd - (4.0 * 1.0i) * M_PI * H2(winv, -ydinv) * my_sign(imag(winv))) + trilog((1.0 + w) / (w - yd)) * (-4.0 * ln_5 + 2.0 * ln1myd - 4.0 * ln1pyd - (4.0 * 1.0i) * M_PI * H2(winv, ydinv) * my_sign(imag(winv))) + power_of<2>(log(-((w * (1.0 + yd)) / yd))) * ((2.0 * 1.0i) * M_PI * H1(-(yd / w), winv) * ln2 * my_sign(imag(winv)) + (2.0 * 1.0i) * M_PI * H1(-(yd / w), winv) * ln_12 * my_sign(imag(winv)))
+                + power_of<2>(log(w * (-1.0 + ydinv))) * ((2.0 * 1.0i) * M_PI * H1(yd / w, winv) * ln2 * my_sign(imag(winv)) + (2.0 * 1.0i) * M_PI * H1(yd / w, winv) * ln_12 * my_sign(imag(winv))) - (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * power_of<2>(ln_53) * ln_57 * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * power_of<2>(ln_45) * ln_78 * my_sign(-imag(w))
+                + trilog(2.0 / (1.0 + yd)) * (2.0 * ln_1 - 2.0 * ln_3 - 8.0 * ln1myd - 4.0 * ln_60 + (8.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (8.0 * 1.0i) * M_PI * H2(w, -(w / yd)) * my_sign(imag(w))) + trilog(-2.0 / (-1.0 + yd)) * (2.0 * ln_1 - 2.0 * ln_3 - 8.0 * ln1pyd - 4.0 * ln_67 + (8.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (8.0 * 1.0i) * M_PI * H2(w, w / yd) * my_sign(imag(w)))
+                + power_of<2>(log(winv - ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(-yd, -w) * ln_5 * my_sign(-imag(w)) - (8.0 * 1.0i) * M_PI * H1(yd / (-1.0 + yd), w / (-1.0 + w)) * ln_5 * my_sign(imag(w / (1.0 - w)))) + power_of<2>(log(winv + ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(yd, -w) * ln_5 * my_sign(-imag(w)) - (8.0 * 1.0i) * M_PI * H1(yd / (1.0 + yd), w / (-1.0 + w)) * ln_5 * my_sign(imag(w / (1.0 - w))))
+                + power_of<2>(log(-((w + yd) / (w * yd)))) * ((-4.0 * 1.0i) * M_PI * H1(-yd, w) * ln2 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(-yd, w) * ln_1 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd / (-1.0 + yd), w / (1.0 + w)) * ln_1 * my_sign(-imag(w / (1.0 + w)))) + power_of<2>(log(-winv + ydinv)) * ((-4.0 * 1.0i) * M_PI * H1(yd, w) * ln2 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd, w) * ln_1 * my_sign(imag(w)) - (4.0 * 1.0i) * M_PI * H1(yd / (1.0 + yd), w / (1.0 + w)) * ln_1 * my_sign(-imag(w / (1.0 + w)))) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * trilog((-2.0 * yd) / (w - yd)) * my_sign(-imydinv)
+                - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_86) * ln_87 * my_sign(-imydinv) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_86) * ln_4 * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_7 * power_of<2>(ln_88) * my_sign(-imydinv) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_89 * power_of<2>(ln_88) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(-(w / yd), -ydinv) * ln_1 * power_of<2>(ln_90) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * ln2 * power_of<2>(ln_91) * my_sign(-imydinv)
+                - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * power_of<2>(ln_59) * ln_78 * my_sign(-imydinv) + trilog((2.0 * (w + yd)) / yd) * ((-4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) + dilog((2.0 * (w + yd)) / yd) * ln_92 * ((4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv))
+                + trilog(-(yd / (w - yd))) * (-2.0 * lnhalf - 4.0 * ln_1 - 8.0 * ln_5 - 2.0 * ln_10 + 6.0 * ln1myd - 4.0 * ln_15 - 4.0 * ln_67 - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv))
+                + trilog(((-1.0 + w) * yd) / (w - yd)) * (2.0 * lnhalf + 4.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_3 + 2.0 * ln_10 - 4.0 * ln1myd - 4.0 * ln_15 + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv)) + power_of<2>(ln_93) * ((-2.0 * 1.0i) * M_PI * H1(winv, -ydinv) * ln2 * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(winv, -ydinv) * ln_12 * my_sign(-imydinv))
+                + li2_52 * ((-2.0 * pisqu) / 3.0 + li2_28 + li2_19 - 2.0 * lnhalf * ln_3 - 2.0 * power_of<2>(ln_3) - 4.0 * ln2 * ln_5 - 4.0 * ln_1 * ln_5 - 2.0 * ln_3 * ln_10 + 4.0 * ln1myd * ln_38 - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * ln_45 * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_59 * my_sign(-imydinv))
+                + li2_63 * ((2.0 * pisqu) / 3.0 - 4.0 * li2_64 - 2.0 * li2_52 - li2_28 - li2_19 + 4.0 * ln_1 * ln_11 + 8.0 * ln_4 * ln_5 - 4.0 * ln1myd * ln_38 + 4.0 * ln_72 * ln_67 + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * ln_45 * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_59 * my_sign(-imydinv))
+                + dilog((w + yd) / yd) * (-4.0 * ln_3 * ln_57 + (-8.0 * ln2 - 6.0 * ln_1 - 4.0 * ln_5 + 6.0 * ln1myd + 6.0 * ln1pyd) * ln_60 + 4.0 * ln1myd * ln_66 + ln_92 * ((-4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv))) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * trilog((2.0 * yd) / (w + yd)) * my_sign(imydinv)
+                - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_86) * ln_87 * my_sign(imydinv) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_86) * ln_4 * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_7 * power_of<2>(ln_88) * my_sign(imydinv) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_89 * power_of<2>(ln_88) * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(-winv, ydinv) * ln2 * power_of<2>(ln_94) * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(w / yd, ydinv) * ln_1 * power_of<2>(ln_95) * my_sign(imydinv)
+                - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * power_of<2>(ln_56) * ln_57 * my_sign(imydinv) + trilog(2.0 - (2.0 * w) / yd) * ((-4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)) + dilog(2.0 - (2.0 * w) / yd) * ln_92 * ((4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv))
+                + trilog(yd / (w + yd)) * (-2.0 * lnhalf - 4.0 * ln_1 - 8.0 * ln_5 - 2.0 * ln_10 + 4.0 * ln1myd + 6.0 * ln1pyd - 4.0 * ln_51 - 4.0 * ln_60 - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv))
+                + trilog((yd - w * yd) / (w + yd)) * (2.0 * lnhalf + 4.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_3 + 2.0 * ln_10 - 4.0 * ln1pyd - 4.0 * ln_51 + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv)) + trilog((2.0 * w) / (-1.0 + w)) * (-4.0 * ln_2 + 2.0 * ln_26 + 2.0 * ln_42 - (8.0 * 1.0i) * M_PI * H2(-ydinv, -(w / yd)) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * H2(ydinv, w / yd) * my_sign(imydinv))
+                + trilog((2.0 * w) / (1.0 + w)) * (-2.0 * ln1myd + 2.0 * ln_22 - 2.0 * ln1pyd + 2.0 * ln_44 - 4.0 * ln_60 - 4.0 * ln_67 - (8.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv)) + power_of<2>(ln_96) * ((-2.0 * 1.0i) * M_PI * H1(winv, ydinv) * ln2 * my_sign(imydinv) - (2.0 * 1.0i) * M_PI * H1(winv, ydinv) * ln_12 * my_sign(imydinv))
+                + li2_15 * ((-2.0 * pisqu) / 3.0 - 2.0 * lnhalf * ln_3 - 2.0 * power_of<2>(ln_3) - 4.0 * ln2 * ln_5 - 4.0 * ln_1 * ln_5 - 2.0 * ln_3 * ln_10 + 4.0 * ln_29 * ln1pyd - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * ln_53 * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_56 * my_sign(imydinv))
+                + li2_65 * ((2.0 * pisqu) / 3.0 - li2_34 - li2_14 - 2.0 * li2_15 + 4.0 * ln_1 * ln_11 + 8.0 * ln_4 * ln_5 - 4.0 * ln1myd * ln_38 - 4.0 * ln_29 * ln1pyd + 4.0 * ln_65 * ln_60 + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * ln_53 * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_56 * my_sign(imydinv))
+                + power_of<2>(ln_92) * (log(-1.0 - (2.0 * w) / yd) * ((2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) + log(-1.0 + (2.0 * w) / yd) * ((2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)))
+                + dilog(1.0 - w / yd) * (4.0 * ln_35 * ln1pyd + (-8.0 * ln2 - 6.0 * ln_1 - 4.0 * ln_5 + 6.0 * ln1myd) * ln_67 + 6.0 * ln1pyd * ln_67 - 4.0 * ln_3 * ln_78 + ln_92 * ((-4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv))) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), -ydinv) * trilog((1.0 - yd) / ((-1.0 + w) * yd)) * my_sign(-imag(w / yd))
+                + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * trilog(-(((-1.0 + w) * yd) / (-1.0 + yd))) * my_sign(-imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_86) * ln_87 * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_86) * ln_4 * my_sign(-imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_7 * power_of<2>(ln_88) * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_89 * power_of<2>(ln_88) * my_sign(-imag(w / yd))
                 - 4.0 * pisqu * H2(-w, -(w / yd)) * H2(-(w / yd), -ydinv) * my_HT(-r(-w, -(w / yd)) + r(-(w / yd), -ydinv)) * power_of<2>(log((1.0 - yd) / ((-1.0 + w) * yd))) * my_sign(-imag(w)) * my_sign(-imag(w / yd)) - 4.0 * pisqu * H2(ydinv, -(w / yd)) * H2(-(w / yd), -ydinv) * my_HT(-r(ydinv, -(w / yd)) + r(-(w / yd), -ydinv)) * power_of<2>(log((1.0 + w) / (1.0 - w))) * my_sign(imydinv) * my_sign(-imag(w / yd)) + trilog(-(((-1.0 + w) * (1.0 + yd)) / yd)) * ((-4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)))
-                + dilog(-(((-1.0 + w) * (1.0 + yd)) / yd)) * log(1.0 - ydinv * ydinv) * ((4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) + trilog((2.0 * yd) / (-1.0 + yd)) * (-2.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) + 2.0 * log(w / (-1.0 + w)) - 2.0 * log(1.0 / (1.0 + w)) - 8.0 * log(1.0 / (1.0 - yd)) + 8.0 * log(1.0 - yd / w) + 4.0 * log((w - yd) / (w - w * yd)) + 4.0 * log((w + yd) / (w - w * yd)) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)))
-                + trilog(yd / (-1.0 + yd)) * (8.0 * lnhalf + 4.0 * log(1.0 - w) - 2.0 * log(w / (-1.0 + w)) + 6.0 * log(1.0 / (1.0 + w)) + 12.0 * log(1.0 / (1.0 - yd)) + 2.0 * ln1pyd - 4.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd))) + power_of<2>(log((1.0 + yd) / w)) * ((4.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * ln2 * my_sign(-imag(w / yd)) + (6.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * log(1.0 + winv) * my_sign(-imag(w / yd)))
-                + power_of<2>(log((1.0 + winv) * yd)) * ((-2.0 * 1.0i) * M_PI * H1(w / yd, -ydinv) * ln2 * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H1(ydinv, -(w / yd)) * ln2 * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H1(ydinv, -(w / yd)) * log(1.0 - w) * my_sign(-imag(w / yd))) + power_of<2>(log((-1.0 + yd) / w)) * ((-2.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * log(1.0 - w) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * log((-1.0 + w) / w) * my_sign(-imag(w / yd)))
-                + dilog(yd / (-1.0 + yd)) * (-2.0 * pisqu + 4.0 * dilog(1.0 + winv) + 8.0 * dilog((-1.0 + w) / w) - 4.0 * dilog((2.0 * yd) / (-1.0 + yd)) + 4.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 3.0 * dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) + 2.0 * dilog((1.0 + yd) / (-1.0 + yd)) - dilog((w + yd) / (-1.0 + yd)) - 4.0 * log(1.0 - w) * log(w) - 4.0 * log(yd / w) * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * log((w + yd) / (-1.0 + yd)) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) * my_sign(-imag(w / yd)))
-                + dilog((2.0 * yd) / (-1.0 + yd)) * (2.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) + dilog((w + yd) / (-1.0 + yd)) + 2.0 * ln2 * log(1.0 + winv) - 2.0 * ln2 * log(1.0 - w) - 2.0 * ln2 * log(w / (-1.0 + w)) + 2.0 * ln2 * log(1.0 / (1.0 + w)) - 4.0 * ln2 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * log((w + yd) / (-1.0 + yd)) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) * my_sign(-imag(w / yd)))
-                + log((1.0 + yd) / (1.0 - yd)) * (ln2squ * log(1.0 + winv) - ln2squ * log(1.0 - w) - ln2squ * log(w / (-1.0 + w)) + ln2squ * log(1.0 / (1.0 + w)) - 2.0 * ln2squ * log(1.0 - yd / w) - (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * power_of<2>(log((w + yd) / (-1.0 + yd))) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(((1.0 + w) * yd) / (w * (-1.0 + yd)))) * my_sign(-imag(w / yd)))
-                + dilog(1.0 + ydinv) * (4.0 * power_of<2>(ln1pyd) + ln1pyd * (6.0 * ln2 + 4.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 2.0 * log(1.0 + w) - 8.0 * ln1myd - 10.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w)) + 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd)) + 8.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) + log(1.0 - ydinv * ydinv) * ((-4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)))) - (4.0 * 1.0i) * M_PI * H2(w / yd, ydinv) * trilog((1.0 + yd) / (yd - w * yd)) * my_sign(imag(w / yd))
-                + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * trilog((yd - w * yd) / (1.0 + yd)) * my_sign(imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(-1.0 + 2.0 / w) * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log(1.0 - winv * winv)) * log(winv) * my_sign(imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(w) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(-((-2.0 + w) * w)) * power_of<2>(log(1.0 - power_of<2>(w))) * my_sign(imag(w / yd))
+                + dilog(-(((-1.0 + w) * (1.0 + yd)) / yd)) * ln_97 * ((4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) + trilog((2.0 * yd) / (-1.0 + yd)) * (-2.0 * ln_1 + 2.0 * ln_3 + 2.0 * ln_8 - 2.0 * ln_61 - 8.0 * ln_13 + 8.0 * ln_67 + 4.0 * ln_75 + 4.0 * ln_76 + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)))
+                + trilog(yd / (-1.0 + yd)) * (8.0 * lnhalf + 4.0 * ln_3 - 2.0 * ln_8 + 6.0 * ln_61 + 12.0 * ln_13 + 2.0 * ln1pyd - 4.0 * ln_67 - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd))) + power_of<2>(log((1.0 + yd) / w)) * ((4.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * ln2 * my_sign(-imag(w / yd)) + (6.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * ln_1 * my_sign(-imag(w / yd)))
+                + power_of<2>(log((1.0 + winv) * yd)) * ((-2.0 * 1.0i) * M_PI * H1(w / yd, -ydinv) * ln2 * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H1(ydinv, -(w / yd)) * ln2 * my_sign(-imag(w / yd)) + (2.0 * 1.0i) * M_PI * H1(ydinv, -(w / yd)) * ln_3 * my_sign(-imag(w / yd))) + power_of<2>(ln_98) * ((-2.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * ln_3 * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * ln_5 * my_sign(-imag(w / yd)))
+                + li2_37 * (-2.0 * pisqu + 4.0 * li2_60 + 8.0 * li2_66 - 4.0 * li2_23 + 4.0 * li2_50 + 3.0 * li2_12 + 2.0 * li2_13 - li2_40 - 4.0 * ln_3 * ln_7 - 4.0 * ln_72 * ln_67 + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * ln_99 * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_100 * my_sign(-imag(w / yd)))
+                + li2_23 * (2.0 * li2_50 + li2_12 + li2_40 + 2.0 * ln2 * ln_1 - 2.0 * ln2 * ln_3 - 2.0 * ln2 * ln_8 + 2.0 * ln2 * ln_61 - 4.0 * ln2 * ln_67 - (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * ln_99 * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_100 * my_sign(-imag(w / yd)))
+                + ln_44 * (ln2squ * ln_1 - ln2squ * ln_3 - ln2squ * ln_8 + ln2squ * ln_61 - 2.0 * ln2squ * ln_67 - (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * power_of<2>(ln_99) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_100) * my_sign(-imag(w / yd)))
+                + dilog(1.0 + ydinv) * (4.0 * power_of<2>(ln1pyd) + ln1pyd * (6.0 * ln2 + 4.0 * ln_1 - 2.0 * ln_3 + 2.0 * ln_12 - 8.0 * ln1myd - 10.0 * ln_60 + 2.0 * ln_67) + 4.0 * ln_1 * ln_82 + 8.0 * ln_5 * ln_84 + ln_97 * ((-4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)))) - (4.0 * 1.0i) * M_PI * H2(w / yd, ydinv) * trilog((1.0 + yd) / (yd - w * yd)) * my_sign(imag(w / yd))
+                + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * trilog((yd - w * yd) / (1.0 + yd)) * my_sign(imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_86) * ln_87 * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_86) * ln_4 * my_sign(imag(w / yd)) - (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_7 * power_of<2>(ln_88) * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_89 * power_of<2>(ln_88) * my_sign(imag(w / yd))
                 - 4.0 * pisqu * H2(-w, w / yd) * H2(w / yd, ydinv) * my_HT(-r(-w, w / yd) + r(w / yd, ydinv)) * power_of<2>(log((1.0 + yd) / (yd - w * yd))) * my_sign(-imag(w)) * my_sign(imag(w / yd)) - 4.0 * pisqu * H2(-ydinv, w / yd) * H2(w / yd, ydinv) * my_HT(-r(-ydinv, w / yd) + r(w / yd, ydinv)) * power_of<2>(log((1.0 + w) / (1.0 - w))) * my_sign(-imydinv) * my_sign(imag(w / yd)) + trilog(-(((-1.0 + w) * (-1.0 + yd)) / yd)) * ((-4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd)))
-                + dilog(-(((-1.0 + w) * (-1.0 + yd)) / yd)) * log(1.0 - ydinv * ydinv) * ((4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))) + trilog(power_of<2>(-1.0 + w)) * ((-4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)))
-                + trilog((1.0 - w) / (1.0 + w)) * (-4.0 * ln1myd - 4.0 * ln1pyd - 2.0 * log((w * (1.0 + yd)) / (w + yd)) + 2.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w) - 2.0 * log((w - w * yd) / (w - yd)) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)))
-                + trilog((2.0 * yd) / (1.0 + yd)) * (-2.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) + 2.0 * log(w / (-1.0 + w)) - 2.0 * log(1.0 / (1.0 + w)) - 8.0 * log(1.0 / (1.0 + yd)) + 8.0 * log((w + yd) / w) + 4.0 * log((w - yd) / (w + w * yd)) + 4.0 * log((w + yd) / (w + w * yd)) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd)))
-                + trilog(2.0 - 2.0 / w) * ((4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd))) + trilog(yd / (1.0 + yd)) * (8.0 * lnhalf + 4.0 * log(1.0 - w) - 2.0 * log(w / (-1.0 + w)) + 6.0 * log(1.0 / (1.0 + w)) + 2.0 * ln1myd + 12.0 * log(1.0 / (1.0 + yd)) - 4.0 * log((w + yd) / w) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))
-                + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd))) + trilog((1.0 + w) / (1.0 - w)) * (8.0 * log(w / (-1.0 + w)) - 2.0 * ln1myd - 4.0 * log((w - yd) / (-1.0 + w)) - 2.0 * ln1pyd - 4.0 * log((w + yd) / (-1.0 + w)) + 4.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), -ydinv) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, ydinv) * my_sign(imag(w / yd)));
+                + dilog(-(((-1.0 + w) * (-1.0 + yd)) / yd)) * ln_97 * ((4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))) + trilog(power_of<2>(-1.0 + w)) * ((-4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)))
+                + trilog((1.0 - w) / (1.0 + w)) * (-4.0 * ln1myd - 4.0 * ln1pyd - 2.0 * ln_57 + 2.0 * ln_60 + 2.0 * ln_67 - 2.0 * ln_78 + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)))
+                + trilog((2.0 * yd) / (1.0 + yd)) * (-2.0 * ln_1 + 2.0 * ln_3 + 2.0 * ln_8 - 2.0 * ln_61 - 8.0 * ln_20 + 8.0 * ln_60 + 4.0 * ln_82 + 4.0 * ln_84 + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd)))
+                + trilog(2.0 - 2.0 / w) * ((4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd))) + trilog(yd / (1.0 + yd)) * (8.0 * lnhalf + 4.0 * ln_3 - 2.0 * ln_8 + 6.0 * ln_61 + 2.0 * ln1myd + 12.0 * ln_20 - 4.0 * ln_60 - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))
+                + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd))) + trilog((1.0 + w) / (1.0 - w)) * (8.0 * ln_8 - 2.0 * ln1myd - 4.0 * ln_54 - 2.0 * ln1pyd - 4.0 * ln_58 + 4.0 * ln_60 + 4.0 * ln_67 - (4.0 * 1.0i) * M_PI * H2(-(w / yd), -ydinv) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, ydinv) * my_sign(imag(w / yd)));
 
-            const complex<double> part4 = + dilog(2.0 - 2.0 / w) * ((-4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log(1.0 - winv * winv) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(1.0 - winv * winv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(1.0 - winv * winv) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log(1.0 - winv * winv) * my_sign(imag(w / yd)))
-                + dilog((-1.0 + w) / w) * (-8.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 8.0 * dilog(yd / (1.0 + yd)) - 8.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) - 4.0 * ln2 * log(1.0 - w) - 4.0 * log(1.0 - w) * log(1.0 + w) - 6.0 * log(1.0 - w) * ln1myd - 6.0 * log(1.0 - w) * ln1pyd + (4.0 * log(1.0 - w) - 4.0 * log((1.0 + yd) / (1.0 - w))) * log((w + yd) / w) + (4.0 * log(1.0 - w) - 4.0 * log((-1.0 + yd) / (-1.0 + w))) * log(1.0 - yd / w) - 8.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) - 8.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd))
-                + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log(1.0 - winv * winv) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(1.0 - winv * winv) * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * log(1.0 - winv * winv) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log(1.0 - winv * winv) * my_sign(imag(w / yd))) + power_of<2>(log((1.0 - yd) / w)) * ((4.0 * 1.0i) * M_PI * H1(w, w / yd) * ln2 * my_sign(imag(w / yd)) + (6.0 * 1.0i) * M_PI * H1(w, w / yd) * log(1.0 + winv) * my_sign(imag(w / yd)))
-                + power_of<2>(log(-(((1.0 + w) * yd) / w))) * ((-2.0 * 1.0i) * M_PI * H1(-(w / yd), ydinv) * ln2 * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H1(-ydinv, w / yd) * ln2 * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H1(-ydinv, w / yd) * log(1.0 - w) * my_sign(imag(w / yd))) + power_of<2>(log(-((1.0 + yd) / w))) * ((-2.0 * 1.0i) * M_PI * H1(-w, w / yd) * log(1.0 - w) * my_sign(imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-w, w / yd) * log((-1.0 + w) / w) * my_sign(imag(w / yd)))
-                + dilog(1.0 - w) * (4.0 * dilog(((-1.0 + w) * yd) / (w - yd)) - 4.0 * dilog(yd / (w + yd)) + 4.0 * dilog((yd - w * yd) / (w + yd)) + 8.0 * ln2 * log((-1.0 + w) / w) + 8.0 * log(1.0 + winv) * log((-1.0 + w) / w) + ln1myd * (-8.0 * log((-1.0 + w) / w) - 4.0 * log((w - yd) / (-1.0 + w))) + 4.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) + ln1pyd * (-8.0 * log((-1.0 + w) / w) - 4.0 * log((w + yd) / (-1.0 + w))) + 4.0 * log((-1.0 + w) / w) * log((w + yd) / w) + 4.0 * log((-1.0 + w) / w) * log(1.0 - yd / w) + 4.0 * log(1.0 - w) * log((w - w * yd) / (w - yd))
-                - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(1.0 - power_of<2>(w)) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(1.0 - power_of<2>(w)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(1.0 - power_of<2>(w)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(1.0 - power_of<2>(w)) * my_sign(imag(w / yd)))
-                + dilog(power_of<2>(-1.0 + w)) * ((4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(1.0 - power_of<2>(w)) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(1.0 - power_of<2>(w)) * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * log(1.0 - power_of<2>(w)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * log(1.0 - power_of<2>(w)) * my_sign(imag(w / yd)))
-                + dilog(yd / (1.0 + yd)) * (-2.0 * pisqu + 2.0 * dilog((-1.0 + yd) / (1.0 + yd)) - 4.0 * dilog((2.0 * yd) / (1.0 + yd)) + 4.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) - dilog((-w + yd) / (1.0 + yd)) + 3.0 * dilog((yd + w * yd) / (w + w * yd)) - 4.0 * log(1.0 - w) * log(w) - 4.0 * log(-(yd / w)) * log((w + yd) / w) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * log((-w + yd) / (1.0 + yd)) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log((yd + w * yd) / (w + w * yd)) * my_sign(imag(w / yd)))
-                + dilog((2.0 * yd) / (1.0 + yd)) * (2.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + dilog((-w + yd) / (1.0 + yd)) + dilog((yd + w * yd) / (w + w * yd)) + 2.0 * ln2 * log(1.0 + winv) - 2.0 * ln2 * log(1.0 - w) - 2.0 * ln2 * log(w / (-1.0 + w)) + 2.0 * ln2 * log(1.0 / (1.0 + w)) - 4.0 * ln2 * log((w + yd) / w) - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * log((-w + yd) / (1.0 + yd)) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * log((yd + w * yd) / (w + w * yd)) * my_sign(imag(w / yd)))
-                + log((1.0 - yd) / (1.0 + yd)) * (ln2squ * log(1.0 + winv) - ln2squ * log(1.0 - w) - ln2squ * log(w / (-1.0 + w)) + ln2squ * log(1.0 / (1.0 + w)) - 2.0 * ln2squ * log((w + yd) / w) - (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * power_of<2>(log((-w + yd) / (1.0 + yd))) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log((yd + w * yd) / (w + w * yd))) * my_sign(imag(w / yd)))
-                + power_of<2>(log(1.0 - ydinv * ydinv)) * (log((-1.0 + w + w * yd) / yd) * ((2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) + log((1.0 + w * (-1.0 + yd)) / yd) * ((2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd)))) + dilog((-1.0 + yd) / yd) * (4.0 * power_of<2>(ln1myd) + ln1myd * (6.0 * ln2 + 4.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 2.0 * log(1.0 + w) - 8.0 * ln1pyd + 2.0 * log((w + yd) / w) - 10.0 * log(1.0 - yd / w)) + 8.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd))
-                + 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd)) + log(1.0 - ydinv * ydinv) * ((-4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd)))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), (w - yd) / ((-1.0 + w) * yd)) * log(1.0 - w) * power_of<2>(log(-(((-1.0 + w) * w) / (w - yd)))) * my_sign(imag((w - yd) / ((-1.0 + w) * yd))) - (8.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), (w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * log((-1.0 + w) / w) * power_of<2>(log((1.0 - w) / (w * (-1.0 + yd)))) * my_sign(imag((w * (-1.0 + yd)) / ((-1.0 + w) * yd)))
-                - (4.0 * 1.0i) * M_PI * H1(w / (1.0 + w), (w * (-1.0 + yd)) / ((1.0 + w) * yd)) * log(1.0 + winv) * power_of<2>(log((1.0 + w) / (w - w * yd))) * my_sign(imag((w * (-1.0 + yd)) / ((1.0 + w) * yd))) - (8.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), (w * (1.0 + yd)) / ((-1.0 + w) * yd)) * log((-1.0 + w) / w) * power_of<2>(log((-1.0 + w) / (w * (1.0 + yd)))) * my_sign(imag((w * (1.0 + yd)) / ((-1.0 + w) * yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), (w + yd) / (yd - w * yd)) * log(1.0 - w) * power_of<2>(log(-(((-1.0 + w) * w) / (w + yd)))) * my_sign(imag((w + yd) / (yd - w * yd)))
-                - (4.0 * 1.0i) * M_PI * H1(w / (1.0 + w), (w + w * yd) / (yd + w * yd)) * log(1.0 + winv) * power_of<2>(log((1.0 + w) / (w + w * yd))) * my_sign(imag((w + w * yd) / (yd + w * yd))) + (4.0 * 1.0i) * M_PI * trilog((-w + yd) / (2.0 * yd)) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(1.0 - w / yd) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log(1.0 - w / yd)) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)
-                + trilog(-((w - yd) / (yd + w * yd))) * (-4.0 * ln2 - 4.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * ln1pyd + (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)) + trilog(1.0 - w / yd) * (8.0 * ln2 + 6.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 6.0 * ln1myd - 10.0 * ln1pyd + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv) - (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd))
-                + power_of<2>(log(1.0 - w / yd)) * ((2.0 * 1.0i) * M_PI * lnhalf * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + (2.0 * 1.0i) * M_PI * log(w / (1.0 + w)) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)) + (4.0 * 1.0i) * M_PI * trilog((w + yd) / (2.0 * yd)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log((w + yd) / yd) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log((w + yd) / yd)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)
-                + dilog(-w) * (2.0 * dilog((1.0 - yd) / 2.0) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) - 2.0 * dilog(-(yd / (w - yd))) + 2.0 * dilog(((-1.0 + w) * yd) / (w - yd)) + 2.0 * dilog((1.0 + yd) / 2.0) - 2.0 * dilog(yd / (w + yd)) + 2.0 * dilog((yd - w * yd) / (w + yd)) + 2.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) - 4.0 * ln2 * log((w + yd) / w) + ln1pyd * (2.0 * ln2 + 2.0 * log((1.0 - yd) / 2.0) + 2.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) - 4.0 * ln2 * log(1.0 - yd / w) + ln1myd * (2.0 * ln2 + 2.0 * log((1.0 + yd) / 2.0) - 4.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w))
-                + 2.0 * log(1.0 - w) * log((w - w * yd) / (w - yd)) + (4.0 * 1.0i) * M_PI * log(1.0 - w / yd) * my_sign(imag(winv)) * T(1.0, 1.0 - w, 1.0 - w / yd) + (4.0 * 1.0i) * M_PI * log((w + yd) / yd) * my_sign(imag(winv)) * T(1.0, 1.0 - w, (w + yd) / yd)) + trilog(1.0 / (1.0 + w)) * (-8.0 * lnhalf + 4.0 * ln2 + 8.0 * log(1.0 + winv) + 16.0 * log((1.0 - w) / 2.0) - 24.0 * log(-w) - 16.0 * log((-1.0 + w) / (1.0 + w)) + 6.0 * log((1.0 - yd) / 2.0) - 4.0 * ln1myd + 4.0 * log(-yd) + 4.0 * log(yd) + 4.0 * log(yd / (-1.0 + yd)) + 4.0 * log(yd / (1.0 + yd)) + 6.0 * log((1.0 + yd) / 2.0) - 4.0 * ln1pyd
-                + 2.0 * log((w * (1.0 + yd)) / (w + yd)) - 2.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) + 2.0 * log((w - w * yd) / (w - yd)) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)) - (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)) + trilog((w + yd) / (yd + w * yd)) * (-4.0 * ln2 - 4.0 * log(1.0 + winv) - 2.0 * log(1.0 - w) + 4.0 * ln1myd + (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
-                + trilog((w + yd) / yd) * (8.0 * ln2 + 6.0 * log(1.0 + winv) - 4.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 10.0 * ln1myd - 6.0 * ln1pyd + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)) + power_of<2>(log((w + yd) / yd)) * ((2.0 * 1.0i) * M_PI * lnhalf * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + (2.0 * 1.0i) * M_PI * log(w / (1.0 + w)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
-                + dilog(1.0 / (1.0 + w)) * ((-22.0 * pisqu) / 3.0 + 8.0 * dilog(-1.0) - 4.0 * dilog(2.0 / (1.0 + w)) + 2.0 * dilog(1.0 / (1.0 - yd)) - 2.0 * dilog((1.0 - yd) / 2.0) + 2.0 * dilog((1.0 - yd) / (1.0 + w)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) - dilog(-(yd / (w - yd))) + 2.0 * dilog(((-1.0 + w) * yd) / (w - yd)) + 2.0 * dilog(1.0 / (1.0 + yd)) - 2.0 * dilog((1.0 + yd) / 2.0) + 2.0 * dilog((1.0 + yd) / (1.0 + w)) - dilog(yd / (w + yd)) + 2.0 * dilog((yd - w * yd) / (w + yd)) - 8.0 * log(1.0 + winv) * log(-winv) - 6.0 * power_of<2>(log(-1.0 / (1.0 + w))) - 4.0 * log(1.0) * log(yd)
-                + ln1myd * (-4.0 * lnhalf + 4.0 * log(yd) - 2.0 * log((1.0 + yd) / 2.0)) + (-4.0 * lnhalf - 2.0 * log((1.0 - yd) / 2.0)) * ln1pyd + log(-yd) * (-4.0 * log(1.0) + 4.0 * ln1pyd) + 2.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) + 2.0 * log(1.0 - w) * log((w - w * yd) / (w - yd)) - (4.0 * 1.0i) * M_PI * log(1.0 - w / yd) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * log((w + yd) / yd) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
-                - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * power_of<2>(log((w + yd) / (w - w * yd))) * my_sign(imag(((1.0 + w) * yd) / (w - w * yd))) * T(1.0, -winv, (w + yd) / (w - w * yd)) + power_of<2>(log((w - yd) / (w + w * yd))) * (2.0 * log(1.0 + winv) * log((w + w * yd) / (yd + w * yd)) - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag((yd + w * yd) / (w + w * yd))) * T(1.0, -winv, (w - yd) / (w + w * yd))) - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * power_of<2>(log((w - yd) / (w - w * yd))) * my_sign(-imag(((-1.0 + w) * yd) / (w * (-1.0 + yd)))) * T(1.0, winv, (w - yd) / (w - w * yd))
-                - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * power_of<2>(log((w + yd) / (w + w * yd))) * my_sign(imag((yd - w * yd) / (w + w * yd))) * T(1.0, winv, (w + yd) / (w + w * yd)) + power_of<3>(log(1.0 + ydinv)) * (((-4.0 * 1.0i) / 3.0) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - ((8.0 * 1.0i) / 3.0) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + trilog((w + w * yd) / (yd + w * yd)) * (2.0 * ln2 + (8.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
-                + trilog((1.0 + yd) / (2.0 * yd)) * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) - 6.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + trilog(1.0 + ydinv) * (-6.0 * ln2 + 2.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) + 8.0 * ln1myd - 4.0 * ln1pyd + 10.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w))
-                + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (16.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + log(1.0 + ydinv) * (((-4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - ((8.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
-                + power_of<2>(log(1.0 + ydinv)) * ((-4.0 * 1.0i) * M_PI * lnhalf * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - (4.0 * 1.0i) * M_PI * lnhalf * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) - (4.0 * 1.0i) * M_PI * log(1.0 / (1.0 + w)) * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + log(-ydinv) * (-(pisqu * ln2) - (2.0 * pisqu * log(1.0 + winv)) / 3.0 + (pisqu * log(1.0 - w)) / 3.0 - (pisqu * log(1.0 + w)) / 3.0 - (2.0 * pisqu * ln1pyd) / 3.0 + 2.0 * power_of<3>(ln1pyd) + (5.0 * pisqu * log((w + yd) / w)) / 3.0 - (pisqu * log(1.0 - yd / w)) / 3.0
-                + power_of<2>(ln1pyd) * (3.0 * ln2 + 2.0 * log(1.0 + winv) - log(1.0 - w) + log(1.0 + w) - 5.0 * log((w + yd) / w) + log(1.0 - yd / w)) + power_of<2>(log(1.0 - ydinv * ydinv)) * ((-2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * my_sign(imag(w / (1.0 + w))) * T(1.0, -winv, -ydinv) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(-imag(w / (1.0 - w))) * T(1.0, winv, -ydinv)
-                + power_of<2>(log(1.0 + ydinv)) * ((4.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))) + power_of<3>(log((-1.0 + yd) / yd)) * (((-4.0 * 1.0i) / 3.0) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - ((8.0 * 1.0i) / 3.0) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + trilog((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * (2.0 * ln2 + (8.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd))
-                + trilog((-1.0 + yd) / (2.0 * yd)) * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 + w) + 4.0 * log((w + yd) / w) - 6.0 * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + trilog((-1.0 + yd) / yd) * (-6.0 * ln2 + 2.0 * log(1.0 - w) + 8.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - 4.0 * ln1myd + 8.0 * ln1pyd - 2.0 * log((w + yd) / w) + 10.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))
-                + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (16.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + log((-1.0 + yd) / yd) * (((-4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - ((8.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd))
-                + power_of<2>(log((-1.0 + yd) / yd)) * ((-4.0 * 1.0i) * M_PI * lnhalf * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * lnhalf * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * log(1.0 / (1.0 + w)) * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + log(ydinv) * (-(pisqu * ln2) - (2.0 * pisqu * log(1.0 + winv)) / 3.0 + (pisqu * log(1.0 - w)) / 3.0 - (pisqu * log(1.0 + w)) / 3.0 + (4.0 * pisqu * ln1pyd) / 3.0 - (pisqu * log((w + yd) / w)) / 3.0 + (5.0 * pisqu * log(1.0 - yd / w)) / 3.0
-                + power_of<2>(log(1.0 - ydinv * ydinv)) * ((-2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * my_sign(imag(w / (1.0 + w))) * T(1.0, -winv, ydinv) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(w / (-1.0 + w))) * T(1.0, winv, ydinv) + power_of<2>(log((-1.0 + yd) / yd)) * ((4.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)))
-                + log(-(w / yd)) * ((4.0 * pisqu * ln2) / 3.0 + pisqu * log(1.0 + winv) + (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + (-4.0 * ln2 - 3.0 * log(1.0 + winv) - 2.0 * log((-1.0 + w) / w)) * power_of<2>(log((w + yd) / w)) + ln1pyd * (-pisqu + 3.0 * power_of<2>(log((w + yd) / w))) + power_of<2>(log(1.0 - power_of<2>(w) / yd2)) * ((-2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) - (4.0 * 1.0i) * M_PI * power_of<2>(log((w + yd) / yd)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * my_sign(-imag(1.0 / (1.0 - w))) * T(1.0, w, -(w / yd)))
-                + log(w / yd) * ((4.0 * pisqu * ln2) / 3.0 + pisqu * log(1.0 + winv) + (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + (-4.0 * ln2 - 3.0 * log(1.0 + winv) - 2.0 * log((-1.0 + w) / w)) * power_of<2>(log(1.0 - yd / w)) + ln1pyd * (-pisqu + 2.0 * power_of<2>(log((w - yd) / (1.0 + w))) + 3.0 * power_of<2>(log(1.0 - yd / w))) + power_of<2>(log(1.0 - power_of<2>(w) / yd2)) * ((-2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w / yd)) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * my_sign(imag(1.0 / (-1.0 + w))) * T(1.0, w, w / yd))
-                + power_of<2>(log((w * (1.0 + yd)) / (w + yd))) * (2.0 * log(1.0 - w) * log((w + yd) / (-1.0 + w)) - 2.0 * log(1.0 - w) * log((w + yd) / (yd - w * yd)) - (4.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag((yd - w * yd) / (w + yd))) * T(1.0, w, (w * (1.0 + yd)) / (w + yd))) - (4.0 * 1.0i) * M_PI * log(1.0 - w) * power_of<2>(log((w - w * yd) / (w - yd))) * my_sign(imag(((-1.0 + w) * yd) / (w - yd))) * T(1.0, w, (w - w * yd) / (w - yd)) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(1.0 - w) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w)
-                - (2.0 * 1.0i) * M_PI * log(1.0 + winv) * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * log(w) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * log(-w) * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)
-                - (4.0 * 1.0i) * M_PI * power_of<3>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + trilog((1.0 + w) / (1.0 + yd)) * (2.0 * ln1myd + 4.0 * ln1pyd + (8.0 * 1.0i) * M_PI * H2(w, -(w / yd)) * my_sign(imag(w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) + log(yd) * (-2.0 * power_of<2>(log(1.0)) * log(w / (1.0 + w)) - 2.0 * power_of<2>(log((-1.0 + yd) / (-1.0 + w))) * log(1.0 - yd / w) - 2.0 * log(1.0 - w) * power_of<2>(log((w - w * yd) / (w - yd))) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) - (4.0 * 1.0i) * M_PI * trilog((w + yd) / (2.0 * w)) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)
-                + trilog((1.0 - yd) / 2.0) * (4.0 * log(1.0 + winv) + 8.0 * log((1.0 - w) / 2.0) + 4.0 * log((-1.0 + w) / w) - 8.0 * log((-1.0 + w) / (1.0 + w)) - 2.0 * log(w / (1.0 + w)) - 2.0 * log(1.0 + w) - 4.0 * log((w - yd) / (-1.0 + w)) + 8.0 * ln1pyd + 2.0 * log(yd / (w + yd)) - 4.0 * log((w + yd) / w) - 4.0 * log((w + yd) / (1.0 + w)) + 2.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w))
-                + log((1.0 + yd) / 2.0) * (ln1pyd * (-2.0 * power_of<2>(log((-1.0 + yd) / (-1.0 + w))) - 4.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w)) - (6.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * power_of<2>(log((w + yd) / w)) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) + dilog((1.0 - yd) / 2.0) * (-5.0 * dilog((1.0 - yd) / (1.0 + w)) - 2.0 * dilog((-1.0 + yd) / (-1.0 + w)) + 6.0 * dilog(-(yd / w)) + 12.0 * dilog(yd / w) + 2.0 * dilog(w / (w + yd)) - dilog((w - w * yd) / (w + yd)) - 4.0 * log((-1.0 + yd) / (-1.0 + w)) * ln1pyd + 4.0 * ln1pyd * log(1.0 - yd / w)
-                - (4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * log((w + yd) / w) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w) + ln1myd * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(w / (1.0 + w)) + 2.0 * log(1.0 + w) - 2.0 * log(yd / (w + yd)) + 8.0 * log((w + yd) / w) - 6.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)))
-                + power_of<2>(log(-yd)) * ln1pyd * (2.0 * log((w * (1.0 + yd)) / (w - yd)) - 2.0 * log(w / (w + yd)) + 2.0 * log((w * (1.0 + yd)) / (w + yd)) - 4.0 * log(1.0 - yd / w) + 4.0 * log((w - yd) / (w + w * yd)) - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (w - yd) / (1.0 + w), -yd)) + power_of<2>(log((1.0 + yd) / (1.0 - w))) * (-2.0 * log((-1.0 + w) / (w + yd)) * log((w + yd) / w) + log((w + yd) / w) * (2.0 * log((yd - w * yd) / (w + yd)) - (4.0 * 1.0i) * M_PI * my_sign(imag((w + yd) / (-1.0 + w))) * T(1.0, -(yd / w), (1.0 + yd) / (1.0 - w))))
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + yd) / (-1.0 + w))) * log(1.0 - yd / w) * my_sign(imag((w - yd) / (-1.0 + w))) * T(1.0, yd / w, (-1.0 + yd) / (-1.0 + w)) + (4.0 * 1.0i) * M_PI * power_of<2>(log((w - yd) / (-1.0 + w))) * ln1pyd * my_sign(imag((-1.0 + yd) / (-1.0 + w))) * T(1.0, (1.0 + yd) / 2.0, (w - yd) / (-1.0 + w)) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(1.0 - w) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (2.0 * 1.0i) * M_PI * log(1.0 + winv) * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)
-                + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * log(w) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + trilog(1.0 - w) * (-8.0 * ln2 - 8.0 * log(1.0 + winv) + 4.0 * ln1myd + 4.0 * log(w / (w - yd)) + 4.0 * ln1pyd + 4.0 * log(w / (w + yd)) + 4.0 * log((w * (1.0 + yd)) / (w + yd)) - 8.0 * log((w + yd) / w) - 8.0 * log(1.0 - yd / w) + 4.0 * log((w - w * yd) / (w - yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv)
-                + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)) + trilog((1.0 - w) / 2.0) * (-2.0 * ln1myd - 2.0 * ln1pyd - 2.0 * log((w * (1.0 + yd)) / (w + yd)) - 2.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) - 2.0 * log((w - w * yd) / (w - yd)) + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w))
-                + dilog((1.0 - w) / 2.0) * (2.0 * dilog(yd) - dilog(((-1.0 + w) * yd) / (w - yd)) - dilog((yd - w * yd) / (w + yd)) + 2.0 * log(1.0 - w) * log((w + yd) / w) + 2.0 * log(1.0 - w) * log(1.0 - yd / w) + ln1pyd * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 4.0 * log(w / (-1.0 + w)) + 4.0 * log((w - yd) / (-1.0 + w)) + 4.0 * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w))
-                + ln1myd * (-2.0 * log(1.0 - w) + 4.0 * log((-1.0 + w) / w) - 4.0 * log(w / (-1.0 + w)) + 4.0 * log((w + yd) / (-1.0 + w)) + 4.0 * log((w + yd) / w) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w))) - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * log(-w) * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)
-                - (4.0 * 1.0i) * M_PI * power_of<3>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + trilog((1.0 + w) / (1.0 - yd)) * (4.0 * ln1myd + 2.0 * ln1pyd + (8.0 * 1.0i) * M_PI * H2(w, w / yd) * my_sign(imag(w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + li3half * (-8.0 * log(1.0 + winv) - 16.0 * log((1.0 - w) / 2.0) - 8.0 * log((-1.0 + w) / w) + 16.0 * log((-1.0 + w) / (1.0 + w)) + 4.0 * log(w / (1.0 + w)) + 4.0 * log(1.0 + w) - 16.0 * ln1myd + 4.0 * log((w - yd) / (-1.0 + w)) + 4.0 * log((w - yd) / (1.0 + w)) - 2.0 * log(-(yd / (w - yd))) - 16.0 * ln1pyd - 2.0 * log(yd / (w + yd))
-                + 2.0 * log((w * (1.0 + yd)) / (w + yd)) + 4.0 * log((w + yd) / (-1.0 + w)) - 12.0 * log((w + yd) / w) + 4.0 * log((w + yd) / (1.0 + w)) - 12.0 * log(1.0 - yd / w) - 4.0 * log((w - yd) / (w - w * yd)) - 4.0 * log((w + yd) / (w - w * yd)) + 2.0 * log((w - w * yd) / (w - yd)) - 4.0 * log((w - yd) / (w + w * yd)) - 4.0 * log((w + yd) / (w + w * yd)) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)
+            const complex<double> part4 = + dilog(2.0 - 2.0 / w) * ((-4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_86 * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_86 * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_86 * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_86 * my_sign(imag(w / yd)))
+                + li2_66 * (-8.0 * li2_50 + 8.0 * li2_38 - 8.0 * li2_42 - 4.0 * ln2 * ln_3 - 4.0 * ln_3 * ln_12 - 6.0 * ln_3 * ln1myd - 6.0 * ln_3 * ln1pyd + (4.0 * ln_3 - 4.0 * ln_42) * ln_60 + (4.0 * ln_3 - 4.0 * ln_26) * ln_67 - 8.0 * ln_5 * ln_75 - 8.0 * ln_5 * ln_84
+                + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_86 * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_86 * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * ln_86 * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_86 * my_sign(imag(w / yd))) + power_of<2>(log((1.0 - yd) / w)) * ((4.0 * 1.0i) * M_PI * H1(w, w / yd) * ln2 * my_sign(imag(w / yd)) + (6.0 * 1.0i) * M_PI * H1(w, w / yd) * ln_1 * my_sign(imag(w / yd)))
+                + power_of<2>(log(-(((1.0 + w) * yd) / w))) * ((-2.0 * 1.0i) * M_PI * H1(-(w / yd), ydinv) * ln2 * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H1(-ydinv, w / yd) * ln2 * my_sign(imag(w / yd)) + (2.0 * 1.0i) * M_PI * H1(-ydinv, w / yd) * ln_3 * my_sign(imag(w / yd))) + power_of<2>(ln_101) * ((-2.0 * 1.0i) * M_PI * H1(-w, w / yd) * ln_3 * my_sign(imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-w, w / yd) * ln_5 * my_sign(imag(w / yd)))
+                + li2_64 * (4.0 * li2_52 - 4.0 * li2_65 + 4.0 * li2_15 + 8.0 * ln2 * ln_5 + 8.0 * ln_1 * ln_5 + ln1myd * (-8.0 * ln_5 - 4.0 * ln_54) + 4.0 * ln_3 * ln_57 + ln1pyd * (-8.0 * ln_5 - 4.0 * ln_58) + 4.0 * ln_5 * ln_60 + 4.0 * ln_5 * ln_67 + 4.0 * ln_3 * ln_78
+                - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_88 * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_88 * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_88 * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_88 * my_sign(imag(w / yd)))
+                + dilog(power_of<2>(-1.0 + w)) * ((4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_88 * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_88 * my_sign(imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * ln_88 * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * ln_88 * my_sign(imag(w / yd)))
+                + li2_38 * (-2.0 * pisqu + 2.0 * li2_56 - 4.0 * li2_24 + 4.0 * li2_42 - li2_45 + 3.0 * li2_20 - 4.0 * ln_3 * ln_7 - 4.0 * ln_65 * ln_60 + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * ln_102 * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_103 * my_sign(imag(w / yd)))
+                + li2_24 * (2.0 * li2_42 + li2_45 + li2_20 + 2.0 * ln2 * ln_1 - 2.0 * ln2 * ln_3 - 2.0 * ln2 * ln_8 + 2.0 * ln2 * ln_61 - 4.0 * ln2 * ln_60 - (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * ln_102 * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * ln_103 * my_sign(imag(w / yd)))
+                + ln_22 * (ln2squ * ln_1 - ln2squ * ln_3 - ln2squ * ln_8 + ln2squ * ln_61 - 2.0 * ln2squ * ln_60 - (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * power_of<2>(ln_102) * my_sign(-imag(winv)) + (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_103) * my_sign(imag(w / yd)))
+                + power_of<2>(ln_97) * (log((-1.0 + w + w * yd) / yd) * ((2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) + log((1.0 + w * (-1.0 + yd)) / yd) * ((2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd)))) + dilog((-1.0 + yd) / yd) * (4.0 * power_of<2>(ln1myd) + ln1myd * (6.0 * ln2 + 4.0 * ln_1 - 2.0 * ln_3 + 2.0 * ln_12 - 8.0 * ln1pyd + 2.0 * ln_60 - 10.0 * ln_67) + 8.0 * ln_5 * ln_75
+                + 4.0 * ln_1 * ln_76 + ln_97 * ((-4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd)))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), (w - yd) / ((-1.0 + w) * yd)) * ln_3 * power_of<2>(log(-(((-1.0 + w) * w) / (w - yd)))) * my_sign(imag((w - yd) / ((-1.0 + w) * yd))) - (8.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), (w * (-1.0 + yd)) / ((-1.0 + w) * yd)) * ln_5 * power_of<2>(log((1.0 - w) / (w * (-1.0 + yd)))) * my_sign(imag((w * (-1.0 + yd)) / ((-1.0 + w) * yd)))
+                - (4.0 * 1.0i) * M_PI * H1(w / (1.0 + w), (w * (-1.0 + yd)) / ((1.0 + w) * yd)) * ln_1 * power_of<2>(ln_104) * my_sign(imag((w * (-1.0 + yd)) / ((1.0 + w) * yd))) - (8.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), (w * (1.0 + yd)) / ((-1.0 + w) * yd)) * ln_5 * power_of<2>(log((-1.0 + w) / (w * (1.0 + yd)))) * my_sign(imag((w * (1.0 + yd)) / ((-1.0 + w) * yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), (w + yd) / (yd - w * yd)) * ln_3 * power_of<2>(log(-(((-1.0 + w) * w) / (w + yd)))) * my_sign(imag((w + yd) / (yd - w * yd)))
+                - (4.0 * 1.0i) * M_PI * H1(w / (1.0 + w), (w + w * yd) / (yd + w * yd)) * ln_1 * power_of<2>(ln_105) * my_sign(imag((w + w * yd) / (yd + w * yd))) + (4.0 * 1.0i) * M_PI * trilog((-w + yd) / (2.0 * yd)) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_106 * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_106) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)
+                + trilog(-((w - yd) / (yd + w * yd))) * (-4.0 * ln2 - 4.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln1pyd + (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)) + trilog(1.0 - w / yd) * (8.0 * ln2 + 6.0 * ln_1 - 4.0 * ln_3 + 4.0 * ln_5 - 6.0 * ln1myd - 10.0 * ln1pyd + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv) - (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd))
+                + power_of<2>(ln_106) * ((2.0 * 1.0i) * M_PI * lnhalf * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) + (2.0 * 1.0i) * M_PI * ln_10 * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)) + (4.0 * 1.0i) * M_PI * trilog((w + yd) / (2.0 * yd)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_107 * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_107) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)
+                + li2_67 * (2.0 * li2_49 - 4.0 * li2_8 - 4.0 * li2_17 - 2.0 * li2_63 + 2.0 * li2_52 + 2.0 * li2_18 - 2.0 * li2_65 + 2.0 * li2_15 + 2.0 * ln_3 * ln_57 - 4.0 * ln2 * ln_60 + ln1pyd * (2.0 * ln2 + 2.0 * ln_14 + 2.0 * ln_60 - 4.0 * ln_67) - 4.0 * ln2 * ln_67 + ln1myd * (2.0 * ln2 + 2.0 * ln_24 - 4.0 * ln_60 + 2.0 * ln_67)
+                + 2.0 * ln_3 * ln_78 + (4.0 * 1.0i) * M_PI * ln_106 * my_sign(imag(winv)) * T(1.0, 1.0 - w, 1.0 - w / yd) + (4.0 * 1.0i) * M_PI * ln_107 * my_sign(imag(winv)) * T(1.0, 1.0 - w, (w + yd) / yd)) + trilog(1.0 / (1.0 + w)) * (-8.0 * lnhalf + 4.0 * ln2 + 8.0 * ln_1 + 16.0 * ln_27 - 24.0 * ln_6 - 16.0 * ln_28 + 6.0 * ln_14 - 4.0 * ln1myd + 4.0 * ln_29 + 4.0 * ln_38 + 4.0 * ln_30 + 4.0 * ln_25 + 6.0 * ln_24 - 4.0 * ln1pyd
+                + 2.0 * ln_57 - 2.0 * ln_60 - 2.0 * ln_67 + 2.0 * ln_78 - (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)) - (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)) + trilog((w + yd) / (yd + w * yd)) * (-4.0 * ln2 - 4.0 * ln_1 - 2.0 * ln_3 + 4.0 * ln1myd + (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
+                + trilog((w + yd) / yd) * (8.0 * ln2 + 6.0 * ln_1 - 4.0 * ln_3 + 4.0 * ln_5 - 10.0 * ln1myd - 6.0 * ln1pyd + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) + (4.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd)) + power_of<2>(ln_107) * ((2.0 * 1.0i) * M_PI * lnhalf * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + (2.0 * 1.0i) * M_PI * ln_10 * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
+                + li2_1 * ((-22.0 * pisqu) / 3.0 + 8.0 * li2_68 - 4.0 * li2_46 + 2.0 * li2_69 - 2.0 * li2_49 + 2.0 * li2_7 - 4.0 * li2_8 - 4.0 * li2_17 - li2_63 + 2.0 * li2_52 + 2.0 * li2_9 - 2.0 * li2_18 + 2.0 * li2_32 - li2_65 + 2.0 * li2_15 - 8.0 * ln_1 * ln_11 - 6.0 * power_of<2>(ln_108) - 4.0 * ln_109 * ln_38
+                + ln1myd * (-4.0 * lnhalf + 4.0 * ln_38 - 2.0 * ln_24) + (-4.0 * lnhalf - 2.0 * ln_14) * ln1pyd + ln_29 * (-4.0 * ln_109 + 4.0 * ln1pyd) + 2.0 * ln_3 * ln_57 + 2.0 * ln_3 * ln_78 - (4.0 * 1.0i) * M_PI * ln_106 * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * ln_107 * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd))
+                - (4.0 * 1.0i) * M_PI * ln_1 * power_of<2>(ln_76) * my_sign(imag(((1.0 + w) * yd) / (w - w * yd))) * T(1.0, -winv, (w + yd) / (w - w * yd)) + power_of<2>(ln_82) * (2.0 * ln_1 * ln_85 - (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag((yd + w * yd) / (w + w * yd))) * T(1.0, -winv, (w - yd) / (w + w * yd))) - (8.0 * 1.0i) * M_PI * ln_5 * power_of<2>(ln_75) * my_sign(-imag(((-1.0 + w) * yd) / (w * (-1.0 + yd)))) * T(1.0, winv, (w - yd) / (w - w * yd))
+                - (8.0 * 1.0i) * M_PI * ln_5 * power_of<2>(ln_84) * my_sign(imag((yd - w * yd) / (w + w * yd))) * T(1.0, winv, (w + yd) / (w + w * yd)) + power_of<3>(ln_110) * (((-4.0 * 1.0i) / 3.0) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - ((8.0 * 1.0i) / 3.0) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + trilog((w + w * yd) / (yd + w * yd)) * (2.0 * ln2 + (8.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
+                + trilog((1.0 + yd) / (2.0 * yd)) * (-4.0 * ln_1 - 4.0 * ln_5 + 2.0 * ln_12 - 6.0 * ln_60 + 4.0 * ln_67 - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + trilog(1.0 + ydinv) * (-6.0 * ln2 + 2.0 * ln_3 + 8.0 * ln_5 - 2.0 * ln_12 + 8.0 * ln1myd - 4.0 * ln1pyd + 10.0 * ln_60 - 2.0 * ln_67 + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w))
+                + (4.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd)) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (16.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + ln_110 * (((-4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - ((8.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
+                + power_of<2>(ln_110) * ((-4.0 * 1.0i) * M_PI * lnhalf * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) - (4.0 * 1.0i) * M_PI * lnhalf * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) - (4.0 * 1.0i) * M_PI * ln_61 * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)) + ln_68 * (-(pisqu * ln2) - (2.0 * pisqu * ln_1) / 3.0 + (pisqu * ln_3) / 3.0 - (pisqu * ln_12) / 3.0 - (2.0 * pisqu * ln1pyd) / 3.0 + 2.0 * power_of<3>(ln1pyd) + (5.0 * pisqu * ln_60) / 3.0 - (pisqu * ln_67) / 3.0
+                + power_of<2>(ln1pyd) * (3.0 * ln2 + 2.0 * ln_1 - ln_3 + ln_12 - 5.0 * ln_60 + ln_67) + power_of<2>(ln_97) * ((-2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * my_sign(-imag(w / yd))) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_1) * my_sign(imag(w / (1.0 + w))) * T(1.0, -winv, -ydinv) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(-imag(w / (1.0 - w))) * T(1.0, winv, -ydinv)
+                + power_of<2>(ln_110) * ((4.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))) + power_of<3>(ln_111) * (((-4.0 * 1.0i) / 3.0) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - ((8.0 * 1.0i) / 3.0) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + trilog((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * (2.0 * ln2 + (8.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd))
+                + trilog((-1.0 + yd) / (2.0 * yd)) * (-4.0 * ln_1 - 4.0 * ln_5 + 2.0 * ln_12 + 4.0 * ln_60 - 6.0 * ln_67 - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + trilog((-1.0 + yd) / yd) * (-6.0 * ln2 + 2.0 * ln_3 + 8.0 * ln_5 - 2.0 * ln_12 - 4.0 * ln1myd + 8.0 * ln1pyd - 2.0 * ln_60 + 10.0 * ln_67 + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) + (4.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))
+                + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (16.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + ln_111 * (((-4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - ((8.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd))
+                + power_of<2>(ln_111) * ((-4.0 * 1.0i) * M_PI * lnhalf * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * lnhalf * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * ln_61 * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) + ln_55 * (-(pisqu * ln2) - (2.0 * pisqu * ln_1) / 3.0 + (pisqu * ln_3) / 3.0 - (pisqu * ln_12) / 3.0 + (4.0 * pisqu * ln1pyd) / 3.0 - (pisqu * ln_60) / 3.0 + (5.0 * pisqu * ln_67) / 3.0
+                + power_of<2>(ln_97) * ((-2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * my_sign(imag(w / yd))) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_1) * my_sign(imag(w / (1.0 + w))) * T(1.0, -winv, ydinv) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(imag(w / (-1.0 + w))) * T(1.0, winv, ydinv) + power_of<2>(ln_111) * ((4.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)))
+                + ln_31 * ((4.0 * pisqu * ln2) / 3.0 + pisqu * ln_1 + (2.0 * pisqu * ln_5) / 3.0 + (-4.0 * ln2 - 3.0 * ln_1 - 2.0 * ln_5) * power_of<2>(ln_60) + ln1pyd * (-pisqu + 3.0 * power_of<2>(ln_60)) + power_of<2>(ln_92) * ((-2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * my_sign(-imydinv)) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_107) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(-imag(1.0 / (1.0 - w))) * T(1.0, w, -(w / yd)))
+                + ln_32 * ((4.0 * pisqu * ln2) / 3.0 + pisqu * ln_1 + (2.0 * pisqu * ln_5) / 3.0 + (-4.0 * ln2 - 3.0 * ln_1 - 2.0 * ln_5) * power_of<2>(ln_67) + ln1pyd * (-pisqu + 2.0 * power_of<2>(ln_35) + 3.0 * power_of<2>(ln_67)) + power_of<2>(ln_92) * ((-2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * my_sign(imydinv)) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_106) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(imag(1.0 / (-1.0 + w))) * T(1.0, w, w / yd))
+                + power_of<2>(ln_57) * (2.0 * ln_3 * ln_58 - 2.0 * ln_3 * ln_81 - (4.0 * 1.0i) * M_PI * ln_3 * my_sign(imag((yd - w * yd) / (w + yd))) * T(1.0, w, (w * (1.0 + yd)) / (w + yd))) - (4.0 * 1.0i) * M_PI * ln_3 * power_of<2>(ln_78) * my_sign(imag(((-1.0 + w) * yd) / (w - yd))) * T(1.0, w, (w - w * yd) / (w - yd)) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_3 * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w)
+                - (2.0 * 1.0i) * M_PI * ln_1 * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_3) * ln_7 * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * ln_6 * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)
+                - (4.0 * 1.0i) * M_PI * power_of<3>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + trilog((1.0 + w) / (1.0 + yd)) * (2.0 * ln1myd + 4.0 * ln1pyd + (8.0 * 1.0i) * M_PI * H2(w, -(w / yd)) * my_sign(imag(w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) + ln_38 * (-2.0 * power_of<2>(ln_109) * ln_10 - 2.0 * power_of<2>(ln_26) * ln_67 - 2.0 * ln_3 * power_of<2>(ln_78) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) - (4.0 * 1.0i) * M_PI * trilog((w + yd) / (2.0 * w)) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)
+                + trilog((1.0 - yd) / 2.0) * (4.0 * ln_1 + 8.0 * ln_27 + 4.0 * ln_5 - 8.0 * ln_28 - 2.0 * ln_10 - 2.0 * ln_12 - 4.0 * ln_54 + 8.0 * ln1pyd + 2.0 * ln_112 - 4.0 * ln_60 - 4.0 * ln_66 + 2.0 * ln_67 - (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w))
+                + ln_24 * (ln1pyd * (-2.0 * power_of<2>(ln_26) - 4.0 * ln_26 * ln_67) - (6.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_60) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) + li2_49 * (-5.0 * li2_7 - 2.0 * li2_22 + 6.0 * li2_29 + 12.0 * li2_26 + 2.0 * li2_6 - li2_11 - 4.0 * ln_26 * ln1pyd + 4.0 * ln1pyd * ln_67
+                - (4.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * ln_60 * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w) + ln1myd * (-4.0 * ln_1 - 4.0 * ln_5 + 2.0 * ln_10 + 2.0 * ln_12 - 2.0 * ln_112 + 8.0 * ln_60 - 6.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)))
+                + power_of<2>(ln_29) * ln1pyd * (2.0 * ln_46 - 2.0 * ln_51 + 2.0 * ln_57 - 4.0 * ln_67 + 4.0 * ln_82 - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (w - yd) / (1.0 + w), -yd)) + power_of<2>(ln_42) * (-2.0 * ln_63 * ln_60 + ln_60 * (2.0 * ln_113 - (4.0 * 1.0i) * M_PI * my_sign(imag((w + yd) / (-1.0 + w))) * T(1.0, -(yd / w), (1.0 + yd) / (1.0 - w))))
+                - (4.0 * 1.0i) * M_PI * power_of<2>(ln_26) * ln_67 * my_sign(imag((w - yd) / (-1.0 + w))) * T(1.0, yd / w, (-1.0 + yd) / (-1.0 + w)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_54) * ln1pyd * my_sign(imag((-1.0 + yd) / (-1.0 + w))) * T(1.0, (1.0 + yd) / 2.0, (w - yd) / (-1.0 + w)) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_3 * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (2.0 * 1.0i) * M_PI * ln_1 * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)
+                + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_3) * ln_7 * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + trilog(1.0 - w) * (-8.0 * ln2 - 8.0 * ln_1 + 4.0 * ln1myd + 4.0 * ln_15 + 4.0 * ln1pyd + 4.0 * ln_51 + 4.0 * ln_57 - 8.0 * ln_60 - 8.0 * ln_67 + 4.0 * ln_78 + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(imydinv)
+                + (4.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * my_sign(-imag(w / yd)) + (4.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * my_sign(imag(w / yd)) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)) + trilog((1.0 - w) / 2.0) * (-2.0 * ln1myd - 2.0 * ln1pyd - 2.0 * ln_57 - 2.0 * ln_60 - 2.0 * ln_67 - 2.0 * ln_78 + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w))
+                + li2_70 * (2.0 * li2_17 - li2_52 - li2_15 + 2.0 * ln_3 * ln_60 + 2.0 * ln_3 * ln_67 + ln1pyd * (-2.0 * ln_3 + 4.0 * ln_5 - 4.0 * ln_8 + 4.0 * ln_54 + 4.0 * ln_67 - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w))
+                + ln1myd * (-2.0 * ln_3 + 4.0 * ln_5 - 4.0 * ln_8 + 4.0 * ln_58 + 4.0 * ln_60 - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w))) - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * lnhalf * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * ln_6 * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)
+                - (4.0 * 1.0i) * M_PI * power_of<3>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + trilog((1.0 + w) / (1.0 - yd)) * (4.0 * ln1myd + 2.0 * ln1pyd + (8.0 * 1.0i) * M_PI * H2(w, w / yd) * my_sign(imag(w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + li3half * (-8.0 * ln_1 - 16.0 * ln_27 - 8.0 * ln_5 + 16.0 * ln_28 + 4.0 * ln_10 + 4.0 * ln_12 - 16.0 * ln1myd + 4.0 * ln_54 + 4.0 * ln_35 - 2.0 * ln_114 - 16.0 * ln1pyd - 2.0 * ln_112
+                + 2.0 * ln_57 + 4.0 * ln_58 - 12.0 * ln_60 + 4.0 * ln_66 - 12.0 * ln_67 - 4.0 * ln_75 - 4.0 * ln_76 + 2.0 * ln_78 - 4.0 * ln_82 - 4.0 * ln_84 + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd)
                 - (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w));
 
-            const complex<double> part5 = + trilog((1.0 + w) / 2.0) * (4.0 * lnhalf - 2.0 * log((1.0 - yd) / 2.0) + 2.0 * ln1myd - 2.0 * log((1.0 + yd) / 2.0) + 2.0 * ln1pyd - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w) + (12.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + dilog(1.0 + w) * (-4.0 * pisqu - 4.0 * dilog(1.0 - yd) - 4.0 * dilog(1.0 + yd) - 4.0 * power_of<2>(log(-1.0 - w)) + 8.0 * log(1.0 + winv) * log((-1.0 + w) / w) - 4.0 * log((w - yd) / (1.0 + w)) * ln1pyd - 4.0 * ln1myd * log((w + yd) / (1.0 + w))
-                + (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + log(-yd) * (-2.0 * power_of<2>(log(1.0)) * log(w / (1.0 + w)) - 2.0 * log(1.0 - w) * power_of<2>(log((w * (1.0 + yd)) / (w + yd))) - 2.0 * power_of<2>(log((1.0 + yd) / (1.0 - w))) * log((w + yd) / w) + power_of<2>(ln1pyd) * (2.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w)) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w))
-                + dilog((1.0 + w) / 2.0) * (3.0 * dilog((1.0 - yd) / 2.0) + 3.0 * dilog((1.0 + yd) / 2.0) + 4.0 * log(1.0 + winv) * log((w + yd) / w) + 4.0 * log(1.0 + winv) * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + ln1myd * (-4.0 * log(w / (1.0 + w)) + 2.0 * log(1.0 + w) + 8.0 * log((w + yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) - (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)
-                + ln1pyd * (-4.0 * log(w / (1.0 + w)) + 2.0 * log(1.0 + w) + 8.0 * log((w - yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w))) + li2half * (-2.0 * dilog((-1.0 + w) / (2.0 * w)) - 4.0 * dilog(-w) + 14.0 * dilog(1.0 / (1.0 + w)) - 6.0 * dilog((1.0 + w) / 2.0) - dilog(w / (w - yd)) + 4.0 * dilog((-1.0 + yd) / (-1.0 + w)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) - 10.0 * dilog(-(yd / w)) - 10.0 * dilog(yd / w) - dilog(-(yd / (w - yd))) + 2.0 * dilog(((-1.0 + w) * yd) / (w - yd)) + 4.0 * dilog(yd / (-1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd)))
-                - 4.0 * dilog(((1.0 + w) * yd) / (w * (-1.0 + yd))) + 4.0 * dilog(yd / (1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + 4.0 * dilog((1.0 + yd) / (1.0 - w)) - dilog(w / (w + yd)) - dilog(yd / (w + yd)) + 2.0 * dilog((yd - w * yd) / (w + yd)) - 4.0 * dilog((yd + w * yd) / (w + w * yd)) - 4.0 * log((w - yd) / (-1.0 + w)) * ln1pyd + 2.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) - 4.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) - 4.0 * log(1.0 + winv) * log((w + yd) / (w - w * yd)) + 2.0 * log(1.0 - w) * log((w - w * yd) / (w - yd))
-                - 4.0 * log(1.0 + winv) * log((w - yd) / (w + w * yd)) - 4.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) - (4.0 * 1.0i) * M_PI * log(1.0 - w / yd) * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * log((w + yd) / yd) * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + log(1.0 + ydinv) * ((8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
-                + log((-1.0 + yd) / yd) * ((8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + ln1myd * (4.0 * log(1.0 / (1.0 - w)) + 4.0 * log(w / (-1.0 + w)) + 4.0 * log(w / (1.0 + w)) + 4.0 * log((w - yd) / (-1.0 + w)) - 4.0 * log((w + yd) / (-1.0 + w)) - 4.0 * log((w + yd) / w) - 4.0 * log((w + yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)
-                    + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)) + ln1pyd * (4.0 * log(1.0 / (1.0 - w)) + 4.0 * log(w / (-1.0 + w)) + 4.0 * log(w / (1.0 + w)) - 4.0 * log((w - yd) / (1.0 + w)) + 4.0 * log((w + yd) / (-1.0 + w)) - 4.0 * log(1.0 - yd / w) + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)))
-                + dilog(-1.0) * (-4.0 * dilog((1.0 - yd) / (1.0 + w)) + 4.0 * dilog(w / (w - yd)) - 2.0 * dilog(-yd) - 2.0 * dilog(yd) + 8.0 * dilog(-(yd / w)) + 8.0 * dilog(yd / w) + 2.0 * dilog(-(yd / (w - yd))) - 2.0 * dilog(((-1.0 + w) * yd) / (w - yd)) + 4.0 * dilog(yd / (-1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 4.0 * dilog(yd / (1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) - 4.0 * dilog((1.0 + yd) / (1.0 + w)) + 4.0 * dilog(w / (w + yd)) + 2.0 * dilog(yd / (w + yd)) - 4.0 * dilog((w * (1.0 + yd)) / (w + yd)) - 4.0 * dilog((w - w * yd) / (w - yd))
-                - 2.0 * dilog((yd - w * yd) / (w + yd)) - 2.0 * log(1.0 - w) * log((w * (1.0 + yd)) / (w + yd)) + ln1myd * (-4.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 - w)) + 8.0 * log(1.0 - w) + 4.0 * log(1.0 + w) - 4.0 * log(((-1.0 + w) * yd) / (w - yd)) + 4.0 * log((w + yd) / w) - 4.0 * log((w + yd) / (1.0 + w)) + 2.0 * log(1.0 - yd / w)) - 4.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) - 2.0 * log(1.0 - w) * log((w - w * yd) / (w - yd))
-                + ln1pyd * (-4.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 - w)) + 8.0 * log(1.0 - w) + 4.0 * log(1.0 + w) - 4.0 * log((w - yd) / (1.0 + w)) + 2.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w) - 4.0 * log((yd - w * yd) / (w + yd))) - 4.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) - (4.0 * 1.0i) * M_PI * log(1.0 - w / yd) * my_sign(imag(winv)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * log((w + yd) / yd) * my_sign(imag(winv)) * T(1.0, 1.0 - w, (w + yd) / yd) - (8.0 * 1.0i) * M_PI * log(1.0 + ydinv) * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
-                - (8.0 * 1.0i) * M_PI * log((-1.0 + yd) / yd) * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 + w) + log(1.0 - yd / w) * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 - yd / w)) - (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w) + log((w + yd) / w) * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) - 2.0 * log(1.0 + w) - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + yd, (w + yd) / w)))
-                - (4.0 * 1.0i) * M_PI * trilog((w - yd) / (2.0 * w)) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w) + trilog((1.0 + yd) / 2.0) * (4.0 * log(1.0 + winv) + 8.0 * log((1.0 - w) / 2.0) + 4.0 * log((-1.0 + w) / w) - 8.0 * log((-1.0 + w) / (1.0 + w)) - 2.0 * log(w / (1.0 + w)) - 2.0 * log(1.0 + w) + 8.0 * ln1myd - 4.0 * log((w - yd) / (1.0 + w)) + 2.0 * log(-(yd / (w - yd))) - 4.0 * log((w + yd) / (-1.0 + w)) + 2.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))
-                + log((1.0 - yd) / 2.0) * ((-6.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - yd / w)) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + dilog((1.0 + yd) / 2.0) * (-2.0 * dilog((1.0 + yd) / (1.0 - w)) - 5.0 * dilog((1.0 + yd) / (1.0 + w)) - dilog((w * (1.0 + yd)) / (w - yd)) + ln1myd * (-4.0 * log((1.0 + yd) / (1.0 - w)) + 4.0 * log((w + yd) / w)) - (4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * log(1.0 - yd / w) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)
-                + ln1pyd * (-4.0 * log(1.0 + winv) - 4.0 * log((-1.0 + w) / w) + 2.0 * log(w / (1.0 + w)) + 2.0 * log(1.0 + w) - 2.0 * log(-(yd / (w - yd))) - 6.0 * log((w + yd) / w) + 8.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))) + power_of<2>(log(w / (w + yd))) * ((-2.0 * pisqu) / 3.0 - (4.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(-imag(yd / (w + yd))) * T(1.0, (w * (1.0 + yd)) / (w + yd), w / (w + yd))) + (4.0 * 1.0i) * M_PI * ln2 * power_of<2>(log(1.0 + winv)) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * log(1.0 - w) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * trilog((1.0 - w) / (w * (-1.0 + yd))) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * log(winv) * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * log(1.0 / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + trilog(1.0 / (1.0 - yd)) * (-6.0 * ln2 - 2.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log(1.0 + w) - 4.0 * log((w - yd) / (1.0 + w)) + 8.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - w)) - 4.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w))
-                + dilog(1.0 / (1.0 - yd)) * (-4.0 * dilog(winv) - 2.0 * dilog(-yd) + 4.0 * dilog(yd / w) - 4.0 * dilog((1.0 + yd) / (1.0 + w)) + 2.0 * dilog((w + yd) / (-1.0 + w)) - 4.0 * log((w - yd) / (1.0 + w)) * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w) + (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w))
-                + log(yd / (-1.0 + yd)) * (-(log((1.0 + yd) / (1.0 - w)) * power_of<2>(log((w + yd) / w))) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)) - (4.0 * 1.0i) * M_PI * trilog(-((w * (-1.0 + yd)) / (-1.0 + w))) * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)
-                + trilog((w + yd) / (-1.0 + w)) * (-4.0 * log(1.0 / (1.0 - w)) + 8.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 / (1.0 + w)) - 16.0 * ln1myd + 2.0 * log(yd / (-1.0 + yd)) + 4.0 * log((w + yd) / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
-                + dilog((w + yd) / (-1.0 + w)) * ((-2.0 * pisqu) / 3.0 + 4.0 * dilog((w + yd) / w) - dilog((w + yd) / (1.0 + w)) - dilog((w + yd) / (w - w * yd)) + 4.0 * power_of<2>(ln1myd) - 2.0 * power_of<2>(log((w + yd) / w)) - 8.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + log((w + yd) / w) * (-2.0 * log(1.0 / (1.0 + w)) - 2.0 * log(yd / (-1.0 + yd)) - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
-                + ln1myd * (4.0 * log((w + yd) / w) + 8.0 * log((w + yd) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))) + (4.0 * 1.0i) * M_PI * ln2 * power_of<2>(log(1.0 + winv)) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * log(1.0 - w) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv)
-                + trilog((1.0 + w) / (-1.0 + w)) * (-4.0 * log(1.0 / (1.0 - w)) + 10.0 * ln1myd + 2.0 * log((-1.0 + yd) / (-1.0 + w)) + 10.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - w)) - 4.0 * log((w + yd) / w) - 4.0 * log(1.0 - yd / w) - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))
-                + dilog(w / (-1.0 + w)) * ((4.0 * pisqu) / 3.0 - 4.0 * dilog(-winv) - 2.0 * dilog((2.0 * w) / (-1.0 + w)) - 2.0 * dilog(w / (1.0 + w)) - 2.0 * dilog((1.0 + w) / (-1.0 + w)) - dilog(1.0 / (1.0 - yd)) - 2.0 * dilog((w - yd) / (-1.0 + w)) + 10.0 * dilog(-yd) + 10.0 * dilog(yd) - dilog(1.0 / (1.0 + yd)) - 2.0 * dilog((w + yd) / (-1.0 + w)) - 4.0 * dilog((w + yd) / w) - 4.0 * dilog(1.0 - yd / w) + 8.0 * log(1.0 - w) * log(w) + ln1myd * (-4.0 * log(1.0 / (1.0 + w)) + 4.0 * log((1.0 - yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv))
-                + ln1pyd * (-4.0 * log(1.0 / (1.0 + w)) + 4.0 * log((1.0 + yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))) + dilog((1.0 + w) / (-1.0 + w)) * (dilog((w - yd) / (-1.0 + w)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) + dilog((w + yd) / (-1.0 + w)) - 4.0 * power_of<2>(ln1myd) - 4.0 * power_of<2>(ln1pyd) + 4.0 * log(1.0 + winv) * log((w + yd) / w) + 4.0 * log(1.0 + winv) * log(1.0 - yd / w)
-                + ln1myd * (-2.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 + w)) - 4.0 * log((1.0 - yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv)) + ln1pyd * (-2.0 * log(1.0 + winv) + 4.0 * log(1.0 / (1.0 + w)) - 4.0 * log((1.0 + yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))) + (4.0 * 1.0i) * M_PI * trilog((-1.0 + w) / (w * (1.0 + yd))) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
-                - (4.0 * 1.0i) * M_PI * log(winv) * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * log(1.0 / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
-                + trilog(1.0 / (1.0 + yd)) * (-6.0 * ln2 - 2.0 * log(1.0 + winv) + 2.0 * log(1.0 - w) - 4.0 * log(1.0 + w) + 8.0 * ln1myd + 2.0 * log((-1.0 + yd) / (-1.0 + w)) - 2.0 * log((w + yd) / w) - 4.0 * log((w + yd) / (1.0 + w)) - 4.0 * log(1.0 - yd / w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
-                + trilog(w / (1.0 + w)) * (-8.0 * ln2 - 4.0 * log(1.0 - w) - 6.0 * ln1myd + 2.0 * log((-1.0 + yd) / (-1.0 + w)) - 2.0 * log((1.0 - yd) / (1.0 + yd)) - 6.0 * ln1pyd + 2.0 * log((1.0 + yd) / (1.0 - w)) - 2.0 * log((1.0 + yd) / (1.0 - yd)) + 4.0 * log((w + yd) / w) + 4.0 * log(1.0 - yd / w) - 4.0 * log((w - yd) / (w - w * yd)) - 4.0 * log((w + yd) / (w + w * yd)) + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
-                + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + trilog((-1.0 + w) / (1.0 + w)) * (-2.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w) + 4.0 * log((w - yd) / (w - w * yd)) + 4.0 * log((w + yd) / (w + w * yd)) + (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
-                + trilog((-1.0 + w) / w) * (4.0 * ln2 + 4.0 * log(1.0 + w) - 8.0 * log(1.0 / (1.0 - yd)) + 6.0 * ln1myd - 8.0 * log(1.0 / (1.0 + yd)) + 6.0 * ln1pyd - 8.0 * log((w + yd) / w) - 8.0 * log(1.0 - yd / w) - 8.0 * log((w - yd) / (w - w * yd)) - 8.0 * log((w + yd) / (w + w * yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd)) - (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
-                - (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + dilog(1.0 / (1.0 + yd)) * (-4.0 * ln1myd * log((w + yd) / (1.0 + w)) + 2.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w) + (8.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
-                + dilog(w / (1.0 + w)) * (2.0 * dilog((w - yd) / (-1.0 + w)) + 4.0 * dilog(-(yd / w)) + 4.0 * dilog(yd / w) + 3.0 * dilog(yd / (-1.0 + yd)) - 2.0 * dilog((2.0 * yd) / (-1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) + 3.0 * dilog(yd / (1.0 + yd)) - 2.0 * dilog((2.0 * yd) / (1.0 + yd)) - 4.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + 2.0 * dilog((w + yd) / (-1.0 + w)) - 2.0 * ln2 * log((1.0 - yd) / (1.0 + yd)) - 2.0 * ln2 * log((1.0 + yd) / (1.0 - yd)) + 2.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w) + 2.0 * log((-1.0 + yd) / (-1.0 + w)) * log(1.0 - yd / w)
-                - 4.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) - 4.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) + (8.0 * 1.0i) * M_PI * log(1.0 + ydinv) * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * log((-1.0 + yd) / yd) * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
-                + log(yd / (1.0 + yd)) * ((-4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + dilog(-yd) * (2.0 * dilog((1.0 - w) / 2.0) + 6.0 * dilog(w) + 2.0 * dilog((1.0 - w) / (1.0 + w)) - 2.0 * dilog((2.0 * w) / (1.0 + w)) - 4.0 * dilog(yd) + 2.0 * dilog(-(yd / w)) - 4.0 * dilog(yd / w) - 2.0 * dilog(w / (w + yd)) + 2.0 * dilog((w + yd) / (1.0 + w)) + 2.0 * dilog((w + yd) / (w - w * yd)) + 2.0 * dilog((w - w * yd) / (w + yd)) + 4.0 * ln2 * log(1.0 + winv) + 2.0 * power_of<2>(log(1.0 + winv))
-                + 2.0 * log(1.0 + winv) * log(1.0 - w) + 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * log(1.0 + winv) * log(-2.0 / (-1.0 + w)) + 4.0 * ln2 * log((-1.0 + w) / w) + 4.0 * power_of<2>(log((-1.0 + w) / w)) - 2.0 * ln2 * log((1.0 - w) / (1.0 + w)) + 2.0 * log(1.0 - w) * log((2.0 * w) / (1.0 + w)) + 2.0 * log(1.0 - w) * log((1.0 + w) / 2.0) - 2.0 * ln2 * log((1.0 + w) / (-1.0 + w)) + 2.0 * power_of<2>(log((w + yd) / w)) + (8.0 * ln2 - 6.0 * log((-1.0 + yd) / (-1.0 + w))) * log(1.0 - yd / w) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 - w)
-                + (4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 + w) + log((w + yd) / w) * (-4.0 * ln2 + 2.0 * log((1.0 - yd) / (1.0 + w)) + 2.0 * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) + (4.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 - yd, (w + yd) / w)) + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 + winv)
-                + ln1myd * (2.0 * log(1.0 + winv) - 4.0 * log(1.0 + w) - 4.0 * log((w - yd) / (-1.0 + w)) + 2.0 * log(((1.0 + w) * yd) / (w + yd)) - 8.0 * log((w + yd) / w) + 2.0 * log((w + yd) / (1.0 + w)) + 8.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - (12.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
-                + dilog(-winv) * (-8.0 * dilog(1.0 / (1.0 - yd)) + 2.0 * dilog((w - yd) / (-1.0 + w)) - 4.0 * dilog(-yd) - 4.0 * dilog(yd) + 2.0 * dilog(-(yd / w)) + 2.0 * dilog(yd / w) - 6.0 * dilog(yd / (-1.0 + yd)) + 2.0 * dilog((2.0 * yd) / (-1.0 + yd)) + 4.0 * dilog(((-1.0 + w) * yd) / (w * (-1.0 + yd))) - 8.0 * dilog(1.0 / (1.0 + yd)) - 6.0 * dilog(yd / (1.0 + yd)) + 2.0 * dilog((2.0 * yd) / (1.0 + yd)) + 4.0 * dilog(((-1.0 + w) * yd) / (w * (1.0 + yd))) + 2.0 * dilog((w + yd) / (-1.0 + w)) + 8.0 * dilog((w - yd) / (w - w * yd)) + 8.0 * dilog((w + yd) / (w + w * yd)) + 4.0 * power_of<2>(ln1myd)
-                + 2.0 * ln2 * log((1.0 - yd) / (1.0 + yd)) + 4.0 * power_of<2>(ln1pyd) + 2.0 * ln2 * log((1.0 + yd) / (1.0 - yd)) + (-4.0 * ln2 + 8.0 * log(((-1.0 + w) * yd) / (w * (1.0 + yd))) + 2.0 * log((1.0 + yd) / (1.0 - w))) * log((w + yd) / w) + (-4.0 * ln2 + 2.0 * log((-1.0 + yd) / (-1.0 + w)) + 8.0 * log(((-1.0 + w) * yd) / (w * (-1.0 + yd)))) * log(1.0 - yd / w) + 4.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) + 4.0 * log((-1.0 + w) / w) * log((w + yd) / (w + w * yd)) + (8.0 * 1.0i) * M_PI * log(1.0 + ydinv) * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
-                + (8.0 * 1.0i) * M_PI * log((-1.0 + yd) / yd) * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) + (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ln1pyd * (-4.0 * lnhalf + 4.0 * ln2 - 2.0 * log(1.0 - w) + (16.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 + yd)) + (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ln1myd * (-4.0 * lnhalf + 4.0 * ln2 - 2.0 * log(1.0 - w) - 12.0 * ln1pyd + (16.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)))
-                - (4.0 * 1.0i) * M_PI * trilog((w * (1.0 + yd)) / (-1.0 + w)) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) + trilog((w - yd) / (-1.0 + w)) * (-4.0 * log(1.0 / (1.0 - w)) + 8.0 * log((-1.0 + w) / w) + 2.0 * log(1.0 / (1.0 + w)) + 2.0 * log(yd / (1.0 + yd)) - 16.0 * ln1pyd + 4.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd));
+            const complex<double> part5 = + trilog((1.0 + w) / 2.0) * (4.0 * lnhalf - 2.0 * ln_14 + 2.0 * ln1myd - 2.0 * ln_24 + 2.0 * ln1pyd - 4.0 * ln_60 - 4.0 * ln_67 + (12.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (12.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + li2_2 * (-4.0 * pisqu - 4.0 * li2_36 - 4.0 * li2_39 - 4.0 * power_of<2>(log(-1.0 - w)) + 8.0 * ln_1 * ln_5 - 4.0 * ln_35 * ln1pyd - 4.0 * ln1myd * ln_66
+                + (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)) + ln_29 * (-2.0 * power_of<2>(ln_109) * ln_10 - 2.0 * ln_3 * power_of<2>(ln_57) - 2.0 * power_of<2>(ln_42) * ln_60 + power_of<2>(ln1pyd) * (2.0 * ln_60 - 4.0 * ln_67) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w))
+                + li2_71 * (3.0 * li2_49 + 3.0 * li2_18 + 4.0 * ln_1 * ln_60 + 4.0 * ln_1 * ln_67 - (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + ln1myd * (-4.0 * ln_10 + 2.0 * ln_12 + 8.0 * ln_66 - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)) - (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)
+                + ln1pyd * (-4.0 * ln_10 + 2.0 * ln_12 + 8.0 * ln_35 - (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w))) + li2half * (-2.0 * li2_48 - 4.0 * li2_67 + 14.0 * li2_1 - 6.0 * li2_71 - li2_16 + 4.0 * li2_22 - 2.0 * li2_8 - 2.0 * li2_17 - 10.0 * li2_29 - 10.0 * li2_26 - li2_63 + 2.0 * li2_52 + 4.0 * li2_37 - 4.0 * li2_50
+                - 4.0 * li2_12 + 4.0 * li2_38 - 4.0 * li2_42 + 4.0 * li2_25 - li2_6 - li2_65 + 2.0 * li2_15 - 4.0 * li2_20 - 4.0 * ln_54 * ln1pyd + 2.0 * ln_3 * ln_57 - 4.0 * ln_5 * ln_75 - 4.0 * ln_1 * ln_76 + 2.0 * ln_3 * ln_78
+                - 4.0 * ln_1 * ln_82 - 4.0 * ln_5 * ln_84 - (4.0 * 1.0i) * M_PI * ln_106 * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * ln_107 * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) + ln_110 * ((8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv))
+                + ln_111 * ((8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd)) - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) + ln1myd * (4.0 * ln_2 + 4.0 * ln_8 + 4.0 * ln_10 + 4.0 * ln_54 - 4.0 * ln_58 - 4.0 * ln_60 - 4.0 * ln_66 + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w)
+                    + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)) + ln1pyd * (4.0 * ln_2 + 4.0 * ln_8 + 4.0 * ln_10 - 4.0 * ln_35 + 4.0 * ln_58 - 4.0 * ln_67 + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w)))
+                + li2_68 * (-4.0 * li2_7 + 4.0 * li2_16 - 2.0 * li2_8 - 2.0 * li2_17 + 8.0 * li2_29 + 8.0 * li2_26 + 2.0 * li2_63 - 2.0 * li2_52 + 4.0 * li2_37 - 4.0 * li2_50 + 4.0 * li2_38 - 4.0 * li2_42 - 4.0 * li2_32 + 4.0 * li2_6 + 2.0 * li2_65 - 4.0 * li2_43 - 4.0 * li2_54
+                - 2.0 * li2_15 - 2.0 * ln_3 * ln_57 + ln1myd * (-4.0 * ln_1 + 4.0 * ln_2 + 8.0 * ln_3 + 4.0 * ln_12 - 4.0 * ln_70 + 4.0 * ln_60 - 4.0 * ln_66 + 2.0 * ln_67) - 4.0 * ln_5 * ln_75 - 2.0 * ln_3 * ln_78
+                + ln1pyd * (-4.0 * ln_1 + 4.0 * ln_2 + 8.0 * ln_3 + 4.0 * ln_12 - 4.0 * ln_35 + 2.0 * ln_60 + 4.0 * ln_67 - 4.0 * ln_113) - 4.0 * ln_5 * ln_84 - (4.0 * 1.0i) * M_PI * ln_106 * my_sign(imag(winv)) * T(1.0, 1.0 - w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * ln_107 * my_sign(imag(winv)) * T(1.0, 1.0 - w, (w + yd) / yd) - (8.0 * 1.0i) * M_PI * ln_110 * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
+                - (8.0 * 1.0i) * M_PI * ln_111 * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (8.0 * 1.0i) * M_PI * ln_12 * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 + w) + ln_67 * (-4.0 * ln_1 - 4.0 * ln_5 - 2.0 * ln_12 - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 - yd / w)) - (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w) + ln_60 * (-4.0 * ln_1 - 4.0 * ln_5 - 2.0 * ln_12 - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + yd, (w + yd) / w)))
+                - (4.0 * 1.0i) * M_PI * trilog((w - yd) / (2.0 * w)) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w) + trilog((1.0 + yd) / 2.0) * (4.0 * ln_1 + 8.0 * ln_27 + 4.0 * ln_5 - 8.0 * ln_28 - 2.0 * ln_10 - 2.0 * ln_12 + 8.0 * ln1myd - 4.0 * ln_35 + 2.0 * ln_114 - 4.0 * ln_58 + 2.0 * ln_60 - 4.0 * ln_67 - (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))
+                + ln_14 * ((-6.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_67) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + li2_18 * (-2.0 * li2_25 - 5.0 * li2_32 - li2_33 + ln1myd * (-4.0 * ln_42 + 4.0 * ln_60) - (4.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * ln_67 * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)
+                + ln1pyd * (-4.0 * ln_1 - 4.0 * ln_5 + 2.0 * ln_10 + 2.0 * ln_12 - 2.0 * ln_114 - 6.0 * ln_60 + 8.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))) + power_of<2>(ln_51) * ((-2.0 * pisqu) / 3.0 - (4.0 * 1.0i) * M_PI * ln_3 * my_sign(-imag(yd / (w + yd))) * T(1.0, (w * (1.0 + yd)) / (w + yd), w / (w + yd))) + (4.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_1) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(ln_1) * ln_3 * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * trilog((1.0 - w) / (w * (-1.0 + yd))) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_5 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * ln_4 * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_5) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * ln_61 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + trilog(1.0 / (1.0 - yd)) * (-6.0 * ln2 - 2.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_12 - 4.0 * ln_35 + 8.0 * ln1pyd + 2.0 * ln_42 - 4.0 * ln_60 - 2.0 * ln_67 + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w))
+                + li2_69 * (-4.0 * li2_72 - 2.0 * li2_8 + 4.0 * li2_26 - 4.0 * li2_32 + 2.0 * li2_5 - 4.0 * ln_35 * ln1pyd + 2.0 * ln_42 * ln_60 + (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w))
+                + ln_30 * (-(ln_42 * power_of<2>(ln_60)) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)) - (4.0 * 1.0i) * M_PI * trilog(-((w * (-1.0 + yd)) / (-1.0 + w))) * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)
+                + trilog((w + yd) / (-1.0 + w)) * (-4.0 * ln_2 + 8.0 * ln_5 + 2.0 * ln_61 - 16.0 * ln1myd + 2.0 * ln_30 + 4.0 * ln_60 + (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
+                + li2_5 * ((-2.0 * pisqu) / 3.0 + 4.0 * li2_62 - li2_58 - li2_44 + 4.0 * power_of<2>(ln1myd) - 2.0 * power_of<2>(ln_60) - 8.0 * ln_5 * ln_84 + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + ln_60 * (-2.0 * ln_61 - 2.0 * ln_30 - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
+                + ln1myd * (4.0 * ln_60 + 8.0 * ln_66 + (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))) + (4.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_1) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_1) * ln_3 * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv)
+                + trilog((1.0 + w) / (-1.0 + w)) * (-4.0 * ln_2 + 10.0 * ln1myd + 2.0 * ln_26 + 10.0 * ln1pyd + 2.0 * ln_42 - 4.0 * ln_60 - 4.0 * ln_67 - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))
+                + dilog(w / (-1.0 + w)) * ((4.0 * pisqu) / 3.0 - 4.0 * li2_73 - 2.0 * li2_3 - 2.0 * li2_74 - 2.0 * li2_75 - li2_69 - 2.0 * li2_4 + 10.0 * li2_8 + 10.0 * li2_17 - li2_9 - 2.0 * li2_5 - 4.0 * li2_62 - 4.0 * li2_61 + 8.0 * ln_3 * ln_7 + ln1myd * (-4.0 * ln_61 + 4.0 * ln_77 - (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv))
+                + ln1pyd * (-4.0 * ln_61 + 4.0 * ln_83 - (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))) + li2_75 * (li2_4 - 4.0 * li2_8 - 4.0 * li2_17 + li2_5 - 4.0 * power_of<2>(ln1myd) - 4.0 * power_of<2>(ln1pyd) + 4.0 * ln_1 * ln_60 + 4.0 * ln_1 * ln_67
+                + ln1myd * (-2.0 * ln_1 + 4.0 * ln_61 - 4.0 * ln_77 + (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv)) + ln1pyd * (-2.0 * ln_1 + 4.0 * ln_61 - 4.0 * ln_83 + (8.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))) + (4.0 * 1.0i) * M_PI * trilog((-1.0 + w) / (w * (1.0 + yd))) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * ln_5 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
+                - (4.0 * 1.0i) * M_PI * ln_4 * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ((4.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_5) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * ln_61 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
+                + trilog(1.0 / (1.0 + yd)) * (-6.0 * ln2 - 2.0 * ln_1 + 2.0 * ln_3 - 4.0 * ln_12 + 8.0 * ln1myd + 2.0 * ln_26 - 2.0 * ln_60 - 4.0 * ln_66 - 4.0 * ln_67 + (8.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
+                + trilog(w / (1.0 + w)) * (-8.0 * ln2 - 4.0 * ln_3 - 6.0 * ln1myd + 2.0 * ln_26 - 2.0 * ln_22 - 6.0 * ln1pyd + 2.0 * ln_42 - 2.0 * ln_44 + 4.0 * ln_60 + 4.0 * ln_67 - 4.0 * ln_75 - 4.0 * ln_84 + (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) + (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) + (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
+                + (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + trilog((-1.0 + w) / (1.0 + w)) * (-2.0 * ln_60 - 2.0 * ln_67 + 4.0 * ln_75 + 4.0 * ln_84 + (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (4.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
+                + trilog((-1.0 + w) / w) * (4.0 * ln2 + 4.0 * ln_12 - 8.0 * ln_13 + 6.0 * ln1myd - 8.0 * ln_20 + 6.0 * ln1pyd - 8.0 * ln_60 - 8.0 * ln_67 - 8.0 * ln_75 - 8.0 * ln_84 - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(-imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * my_sign(imag(w / yd)) - (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
+                - (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + li2_9 * (-4.0 * ln1myd * ln_66 + 2.0 * ln_26 * ln_67 + (8.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
+                + li2_74 * (2.0 * li2_4 + 4.0 * li2_29 + 4.0 * li2_26 + 3.0 * li2_37 - 2.0 * li2_23 - 4.0 * li2_50 + 3.0 * li2_38 - 2.0 * li2_24 - 4.0 * li2_42 + 2.0 * li2_5 - 2.0 * ln2 * ln_22 - 2.0 * ln2 * ln_44 + 2.0 * ln_42 * ln_60 + 2.0 * ln_26 * ln_67
+                - 4.0 * ln_5 * ln_75 - 4.0 * ln_5 * ln_84 + (8.0 * 1.0i) * M_PI * ln_110 * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) + (8.0 * 1.0i) * M_PI * ln_111 * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
+                + ln_25 * ((-4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)) + li2_8 * (2.0 * li2_70 + 6.0 * li2_57 + 2.0 * li2_51 - 2.0 * li2_47 - 4.0 * li2_17 + 2.0 * li2_29 - 4.0 * li2_26 - 2.0 * li2_6 + 2.0 * li2_58 + 2.0 * li2_44 + 2.0 * li2_11 + 4.0 * ln2 * ln_1 + 2.0 * power_of<2>(ln_1)
+                + 2.0 * ln_1 * ln_3 + 2.0 * power_of<2>(ln_3) - 4.0 * ln_1 * ln_115 + 4.0 * ln2 * ln_5 + 4.0 * power_of<2>(ln_5) - 2.0 * ln2 * ln_116 + 2.0 * ln_3 * ln_117 + 2.0 * ln_3 * ln_118 - 2.0 * ln2 * log((1.0 + w) / (-1.0 + w)) + 2.0 * power_of<2>(ln_60) + (8.0 * ln2 - 6.0 * ln_26) * ln_67 - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 - w)
+                + (4.0 * 1.0i) * M_PI * ln_12 * my_sign(imydinv) * T(1.0, 1.0 - yd, 1.0 + w) + ln_60 * (-4.0 * ln2 + 2.0 * ln_77 + 2.0 * ln_100 + (4.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 - yd, (w + yd) / w)) + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 + winv)
+                + ln1myd * (2.0 * ln_1 - 4.0 * ln_12 - 4.0 * ln_54 + 2.0 * ln_56 - 8.0 * ln_60 + 2.0 * ln_66 + 8.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - (12.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w))
+                + li2_73 * (-8.0 * li2_69 + 2.0 * li2_4 - 4.0 * li2_8 - 4.0 * li2_17 + 2.0 * li2_29 + 2.0 * li2_26 - 6.0 * li2_37 + 2.0 * li2_23 + 4.0 * li2_50 - 8.0 * li2_9 - 6.0 * li2_38 + 2.0 * li2_24 + 4.0 * li2_42 + 2.0 * li2_5 + 8.0 * li2_55 + 8.0 * li2_41 + 4.0 * power_of<2>(ln1myd)
+                + 2.0 * ln2 * ln_22 + 4.0 * power_of<2>(ln1pyd) + 2.0 * ln2 * ln_44 + (-4.0 * ln2 + 8.0 * ln_64 + 2.0 * ln_42) * ln_60 + (-4.0 * ln2 + 2.0 * ln_26 + 8.0 * ln_73) * ln_67 + 4.0 * ln_5 * ln_75 + 4.0 * ln_5 * ln_84 + (8.0 * 1.0i) * M_PI * ln_110 * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv)
+                + (8.0 * 1.0i) * M_PI * ln_111 * my_sign(imag(w)) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) + (4.0 * 1.0i) * M_PI * ln_5 * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ln1pyd * (-4.0 * lnhalf + 4.0 * ln2 - 2.0 * ln_3 + (16.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 + yd)) + (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ln1myd * (-4.0 * lnhalf + 4.0 * ln2 - 2.0 * ln_3 - 12.0 * ln1pyd + (16.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)))
+                - (4.0 * 1.0i) * M_PI * trilog((w * (1.0 + yd)) / (-1.0 + w)) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) + trilog((w - yd) / (-1.0 + w)) * (-4.0 * ln_2 + 8.0 * ln_5 + 2.0 * ln_61 + 2.0 * ln_25 - 16.0 * ln1pyd + 4.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd));
 
-            const complex<double> part6 = + dilog(yd) * (-4.0 * dilog(-(yd / w)) + 2.0 * dilog(yd / w) - 2.0 * dilog(1.0 / (1.0 + yd)) - 4.0 * dilog((1.0 + yd) / (1.0 - w)) + 2.0 * dilog((1.0 + yd) / (1.0 + w)) + 2.0 * dilog((w * (1.0 + yd)) / (w - yd)) - 6.0 * dilog((w + yd) / (-1.0 + w)) + 2.0 * dilog((w - yd) / (w + w * yd)) + 4.0 * ln2 * log(1.0 + winv) + 2.0 * power_of<2>(log(1.0 + winv)) + 2.0 * log(1.0 + winv) * log(1.0 - w) + 2.0 * power_of<2>(log(1.0 - w)) - 4.0 * log(1.0 + winv) * log(-2.0 / (-1.0 + w)) + 4.0 * ln2 * log((-1.0 + w) / w) + 4.0 * power_of<2>(log((-1.0 + w) / w)) - 2.0 * ln2 * log((1.0 - w) / (1.0 + w))
-                + 2.0 * log(1.0 - w) * log((2.0 * w) / (1.0 + w)) + 2.0 * log(1.0 - w) * log((1.0 + w) / 2.0) - 2.0 * ln2 * log((1.0 + w) / (-1.0 + w)) + (8.0 * ln2 - 6.0 * log((1.0 + yd) / (1.0 - w))) * log((w + yd) / w) + 2.0 * power_of<2>(log(1.0 - yd / w)) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w) + log(1.0 - yd / w) * (-4.0 * ln2 + 2.0 * log((1.0 + yd) / (1.0 + w)) + 2.0 * log((yd + w * yd) / (w + w * yd)) + (4.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - yd / w))
-                - (12.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + ln1pyd * (2.0 * log(1.0 + winv) - 4.0 * log(1.0 + w) + 2.0 * log((w - yd) / (1.0 + w)) + 2.0 * log(((1.0 + w) * yd) / (-w + yd)) - 4.0 * log((w + yd) / (-1.0 + w)) + 8.0 * log((w + yd) / w) - 8.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)))
-                + dilog(winv) * (2.0 * dilog(-(yd / w)) + 2.0 * dilog(yd / w) - 4.0 * dilog(1.0 / (1.0 + yd)) + 4.0 * dilog((w + yd) / (w - w * yd)) + 4.0 * dilog((w - yd) / (w + w * yd)) - 2.0 * power_of<2>(ln1myd) - 2.0 * power_of<2>(ln1pyd) + (8.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log(((1.0 + w) * yd) / (w * (-1.0 + yd)))) * log((w + yd) / w) + log(1.0 - yd / w) * (8.0 * ln2 + 4.0 * log(1.0 + winv) + 4.0 * log((yd + w * yd) / (w + w * yd))) + ln1myd * (-4.0 * lnhalf + 2.0 * log(1.0 + winv) - 4.0 * ln1pyd + (8.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
-                + ln1pyd * (-4.0 * lnhalf + 2.0 * log(1.0 + winv) + (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd))) + dilog((w - yd) / (-1.0 + w)) * ((-2.0 * pisqu) / 3.0 - dilog((w - yd) / (1.0 + w)) - 6.0 * dilog(-yd) + 2.0 * dilog(1.0 / (1.0 + yd)) + 4.0 * dilog(1.0 - yd / w) - dilog((w - yd) / (w + w * yd)) + 8.0 * log((w - yd) / (1.0 + w)) * ln1pyd + 4.0 * power_of<2>(ln1pyd) - 2.0 * power_of<2>(log(1.0 - yd / w)) - 8.0 * log((-1.0 + w) / w) * log((w - yd) / (w - w * yd)) + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv)
-                + log(1.0 - yd / w) * (-2.0 * log(1.0 / (1.0 + w)) - 2.0 * log(yd / (1.0 + yd)) - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + ln1pyd * (4.0 * log(1.0 - yd / w) + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd))) + power_of<2>(log(1.0 / (1.0 - yd))) * (2.0 * pisqu - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(yd / (-1.0 + yd))) * T(1.0, (w - yd) / (w - w * yd), 1.0 / (1.0 - yd)) - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(yd / (1.0 - yd))) * T(1.0, (w + yd) / (w - w * yd), 1.0 / (1.0 - yd)))
-                + power_of<2>(log(w / (w - yd))) * ((-2.0 * pisqu) / 3.0 - (4.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(yd / (w - yd))) * T(1.0, (w - w * yd) / (w - yd), w / (w - yd))) + power_of<2>(log(1.0 / (1.0 + yd))) * (2.0 * pisqu - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(imag(yd / (1.0 + yd))) * T(1.0, (w - yd) / (w + w * yd), 1.0 / (1.0 + yd)) - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(yd / (1.0 + yd))) * T(1.0, (w + yd) / (w + w * yd), 1.0 / (1.0 + yd))) - 4.0 * pisqu * power_of<2>(log(1.0 + winv)) * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w)
-                + 8.0 * pisqu * log(1.0 + winv) * log((-1.0 + w) / w) * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) - 4.0 * pisqu * power_of<2>(log((-1.0 + w) / w)) * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) - 4.0 * pisqu * power_of<2>(log(1.0 + winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w) + 8.0 * pisqu * log(1.0 + winv) * log((-1.0 + w) / w) * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)
-                - 4.0 * pisqu * power_of<2>(log((-1.0 + w) / w)) * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w) + 4.0 * pisqu * ln2squ * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) - 8.0 * pisqu * ln2 * log(1.0 + w) * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) + 4.0 * pisqu * power_of<2>(log(1.0 + w)) * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) + 4.0 * pisqu * ln2squ * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0) - 8.0 * pisqu * ln2 * log(1.0 + w) * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0)
-                + 4.0 * pisqu * power_of<2>(log(1.0 + w)) * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0) - 4.0 * pisqu * power_of<2>(log((-1.0 + w) / w)) * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)
-                + power_of<2>(ln1pyd) * (log((w - yd) / (1.0 + w)) * (-2.0 * lnhalf + ln2 + 4.0 * log((-1.0 + yd) / (-1.0 + w)) + 2.0 * log(yd / (-1.0 + yd))) + ln2 * log(((1.0 + w) * yd) / (-w + yd)) + (-ln2 - log(1.0 + w)) * log((-1.0 + w) / (w + yd)) + (-2.0 * lnhalf + log(1.0 + winv)) * log((w + yd) / (-1.0 + w)) + 2.0 * ln2 * log((w + yd) / w) + log((-1.0 + yd) / (2.0 * yd)) * (2.0 * log(1.0 + winv) + 2.0 * log((-1.0 + w) / w) - log(1.0 + w) + 3.0 * log((w + yd) / w) - 2.0 * log(1.0 - yd / w))
-                + log((2.0 * yd) / (-1.0 + yd)) * (3.0 * log(1.0 + winv) - log(1.0 - w) + 2.0 * log((-1.0 + w) / w) - log(1.0 + w) - 2.0 * log((w + yd) / w) - log(1.0 - yd / w)) - (2.0 * ln64 * log(1.0 - yd / w)) / 3.0 - log(1.0 + winv) * log((w + yd) / (yd - w * yd)) + (ln2 + log(1.0 + w)) * log((yd - w * yd) / (w + yd)) - ln2 * log(-((w - yd) / (yd + w * yd))) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd)) * T(1.0, 1.0 - w, 1.0 + yd) + (2.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(yd)) * T(1.0, 1.0 - w, 1.0 + yd)
-                + (16.0 * 1.0i) * M_PI * log((1.0 - w) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w) / 2.0) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(winv)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * log((-1.0 + w) / (1.0 + w)) * my_sign(imag((1.0 + w) / (1.0 + yd))) * T(1.0, (w - yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * log(w / (1.0 + w)) * my_sign(imag((1.0 + w) / (1.0 + yd))) * T(1.0, (w - yd) / (1.0 + w), w / (1.0 + w)) - (8.0 * 1.0i) * M_PI * log(-w) * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, -w) + (4.0 * 1.0i) * M_PI * log(w) * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, w)
-                + log((1.0 - yd) / 2.0) * (-2.0 * log(1.0 + winv) - 2.0 * log((-1.0 + w) / w) + log(w / (1.0 + w)) + log(1.0 + w) - log(-(yd / (w - yd))) - 3.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w) + (2.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd) + (6.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd) - (2.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)
-                + (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) - (2.0 * 1.0i) * M_PI * log((-1.0 + yd) / (-1.0 + w)) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) - 4.0 * pisqu * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)) + ln1pyd * ((-1.0 / 3.0) * (pisqu * lnm1) - power_of<3>(lnm1) / 3.0 + lnm1 * ln2squ - 2.0 * power_of<2>(lnhalf) * log(1.0 + winv) + 2.0 * lnhalf * power_of<2>(log(1.0 / (1.0 - w))) + 2.0 * ln2 * power_of<2>(log(1.0 / (1.0 - w))) - (2.0 * pisqu * log(1.0 - w)) / 3.0 - (2.0 * power_of<3>(log(1.0 - w))) / 3.0 - power_of<2>(log(1.0 + winv)) * log(-2.0 / (-1.0 + w))
-                + (2.0 * pisqu * log(-2.0 / w)) / 3.0 + (2.0 * power_of<3>(log(-2.0 / w))) / 3.0 - (2.0 * pisqu * log(-winv)) / 3.0 - (2.0 * power_of<3>(log(-winv))) / 3.0 + (pisqu * log((-0.5) * (1.0 / w))) / 3.0 + power_of<3>(log((-0.5) * (1.0 / w))) / 3.0 - (pisqu * log(1.0 / (2.0 * w))) / 3.0 - power_of<3>(log(1.0 / (2.0 * w))) / 3.0 + pisqu * log(winv) - 3.0 * power_of<2>(log(1.0 - w)) * log(winv) + power_of<3>(log(winv)) + (2.0 * pisqu * log(2.0 / w)) / 3.0 + (2.0 * power_of<3>(log(2.0 / w))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((-1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(log(1.0 / (1.0 - w))) * log((-1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(lnhalf) * log((-1.0 + w) / w) - (2.0 * pisqu * log(w / 2.0)) / 3.0 - (2.0 * power_of<3>(log(w / 2.0))) / 3.0
-                + (4.0 * pisqu * log(w)) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(w) - 4.0 * power_of<2>(log((-1.0 + w) / w)) * log(w) + (4.0 * power_of<3>(log(w))) / 3.0 - (pisqu * log(w / (-1.0 + w))) / 3.0 - 2.0 * power_of<2>(lnhalf) * log(w / (-1.0 + w)) - power_of<3>(log(w / (-1.0 + w))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((2.0 * w) / (-1.0 + w)) + power_of<2>(log(1.0 + winv)) * log((2.0 * w) / (-1.0 + w)) - 2.0 * power_of<2>(log(1.0 / (1.0 - w))) * log((2.0 * w) / (-1.0 + w)) + (pisqu * log(-1.0 / (1.0 + w))) / 3.0 + power_of<3>(log(-1.0 / (1.0 + w))) / 3.0 - (2.0 * pisqu * log(1.0 / (1.0 + w))) / 3.0 - (2.0 * power_of<3>(log(1.0 / (1.0 + w)))) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(2.0 / (1.0 + w))
-                - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(2.0 / (1.0 + w)) + ln2squ * log((1.0 - w) / (1.0 + w)) - ln2squ * log((-1.0 + w) / (1.0 + w)) - (2.0 * pisqu * log((2.0 * (-1.0 + w)) / (1.0 + w))) / 3.0 - (2.0 * power_of<3>(log((2.0 * (-1.0 + w)) / (1.0 + w)))) / 3.0 - (2.0 * pisqu * log(w / (1.0 + w))) / 3.0 - 2.0 * power_of<2>(lnhalf) * log(w / (1.0 + w)) - (2.0 * power_of<3>(log(w / (1.0 + w)))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((2.0 * w) / (1.0 + w)) - 2.0 * power_of<2>(log(1.0 - w)) * log((2.0 * w) / (1.0 + w)) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((2.0 * w) / (1.0 + w)) - power_of<2>(log(1.0 - w)) * log((1.0 + w) / 2.0) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((1.0 + w) / 2.0)
-                + log((1.0 - w) / 2.0) * power_of<2>(log(1.0 + w)) + 2.0 * log(-winv) * power_of<2>(log(1.0 + w)) - log((-1.0 + w) / (2.0 * w)) * power_of<2>(log(1.0 + w)) - (2.0 * pisqu * log((2.0 * (1.0 + w)) / (-1.0 + w))) / 3.0 - (2.0 * power_of<3>(log((2.0 * (1.0 + w)) / (-1.0 + w)))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((1.0 + w) / (2.0 * w)) + power_of<2>(log(1.0 - w)) * log((1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((1.0 + w) / (2.0 * w)) + (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * w))) / 3.0 + (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * w)))) / 3.0 - (4.0 * pisqu * log(-2.0 / (w - yd))) / 3.0 - (4.0 * power_of<3>(log(-2.0 / (w - yd)))) / 3.0 - (2.0 * pisqu * log(2.0 / (w - yd))) / 3.0 - (2.0 * power_of<3>(log(2.0 / (w - yd)))) / 3.0
-                - (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * (w - yd)))) / 3.0 - (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * (w - yd))))) / 3.0 + (2.0 * pisqu * log((w - yd) / (1.0 + w))) / 3.0 + (2.0 * pisqu * log((-2.0 * (-1.0 + w)) / ((1.0 + w) * (-1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((-2.0 * (-1.0 + w)) / ((1.0 + w) * (-1.0 + yd))))) / 3.0 - (4.0 * pisqu * log((1.0 + w) / (-1.0 + yd))) / 3.0 - (4.0 * power_of<3>(log((1.0 + w) / (-1.0 + yd)))) / 3.0 - (2.0 * pisqu * log((1.0 + w) / yd)) / 3.0 - (2.0 * power_of<3>(log((1.0 + w) / yd))) / 3.0 + (4.0 * pisqu * log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd)))) / 3.0 + (4.0 * power_of<3>(log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd))))) / 3.0
-                + 2.0 * pisqu * log((2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd))) + 2.0 * power_of<3>(log((2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd)))) + power_of<2>(log((-1.0 + yd) / (-1.0 + w))) * (2.0 * log((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) + 2.0 * log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd)))) - (2.0 * pisqu * log(1.0 / (-w + yd))) / 3.0 - (2.0 * power_of<3>(log(1.0 / (-w + yd)))) / 3.0 + (pisqu * log(-1.0 / (w + yd))) / 3.0 + power_of<3>(log(-1.0 / (w + yd))) / 3.0 + (pisqu * log(1.0 / (w + yd))) / 3.0 + power_of<3>(log(1.0 / (w + yd))) / 3.0 - power_of<2>(log(1.0 + w)) * log((-1.0 + yd) / (w + yd)) - (2.0 * pisqu * log((w + yd) / (-1.0 + w))) / 3.0
-                + (pisqu / 3.0 - 2.0 * ln2squ) * log((w + yd) / w) + 2.0 * log(-(yd / w)) * power_of<2>(log((w + yd) / w)) - power_of<2>(log(1.0 + winv)) * log((w + yd) / (-1.0 + yd)) + power_of<2>(log(1.0 + winv)) * log((w + yd) / (w - w * yd)) + power_of<2>(log(1.0 + w)) * log((w - w * yd) / (w + yd)) + (2.0 * pisqu * log(w / (yd - w * yd))) / 3.0 + (2.0 * power_of<3>(log(w / (yd - w * yd)))) / 3.0 - (2.0 * pisqu * log((1.0 - w) / (w + w * yd))) / 3.0 - (2.0 * power_of<3>(log((1.0 - w) / (w + w * yd)))) / 3.0 + (2.0 * pisqu * log(-((1.0 + w) / (w + w * yd)))) / 3.0 + (2.0 * power_of<3>(log(-((1.0 + w) / (w + w * yd))))) / 3.0 - (4.0 * pisqu * log((1.0 + w) / (w + w * yd))) / 3.0
-                - (4.0 * power_of<3>(log((1.0 + w) / (w + w * yd)))) / 3.0 - (2.0 * 1.0i) * M_PI * H1(ydinv, -winv) * power_of<2>(log(w + yd)) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / w) * power_of<2>(log(1.0 / (-1.0 + w))) * my_sign(imag(winv)) + (4.0 * 1.0i) * M_PI * H1(1.0 + winv, (-1.0 + w) / w) * power_of<2>(log((-2.0 * w) / (-1.0 + power_of<2>(w)))) * my_sign(imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (-1.0 + yd), -2.0 / (-1.0 + yd)) * power_of<2>(log(((1.0 + w) * (-1.0 + yd)) / (2.0 * (-1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) + (4.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + w), -2.0 / (-1.0 + yd)) * power_of<2>(log((-w + yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 - yd)))
-                + (4.0 * 1.0i) * M_PI * H1((1.0 + w) / (w - yd), (-1.0 + w) / (w - yd)) * power_of<2>(log((-2.0 * (w - yd)) / (-1.0 + power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w - yd))) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / (w - yd)) * power_of<2>(log((1.0 + yd) / (-1.0 + w))) * my_sign(imag((-1.0 + w) / (w - yd))) - (4.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * power_of<2>(log(-w + yd)) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(w / yd, ydinv) * power_of<2>(log((-1.0 + winv) * yd)) * my_sign(imydinv) - (6.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * power_of<2>(log((-1.0 + yd) / w)) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H1(ydinv, w / yd) * power_of<2>(log(((-1.0 + w) * yd) / w)) * my_sign(imag(w / yd))
-                + power_of<2>(log((1.0 - yd) / w)) * ((-2.0 * 1.0i) * M_PI * H1(-(w / yd), -w) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H1(w, w / yd) * my_sign(imag(w / yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 + yd), 1.0 / (1.0 + yd)) * power_of<2>(log(-((w * (1.0 + yd)) / (1.0 + w)))) * my_sign(imag(1.0 / (1.0 + yd))) + power_of<2>(log(-w - yd)) * ((2.0 * 1.0i) * M_PI * H1(-winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), 1.0 / (1.0 + yd)) * my_sign(imag(1.0 / (1.0 + yd)))) + power_of<2>(log(w - yd)) * ((8.0 * 1.0i) * M_PI * H1(winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + w), 1.0 / (1.0 + yd)) * my_sign(imag(1.0 / (1.0 + yd))))
-                + (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + w), 2.0 / (1.0 + yd)) * power_of<2>(log((w - yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) - (12.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log((-0.5) * (((-1.0 + w) * (1.0 + yd)) / (1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (1.0 - w) / (1.0 + yd)) * power_of<2>(log((w * (1.0 + yd)) / (-1.0 + w))) * my_sign(imag((1.0 - w) / (1.0 + yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / 2.0, (1.0 + w) / (1.0 + yd)) * power_of<2>(log((1.0 - yd) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 + yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 + w, (1.0 + w) / (1.0 + yd)) * power_of<2>(log(-(yd / (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 + yd)))
-                - (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + yd), (1.0 + w) / (1.0 + yd)) * power_of<2>(log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 + yd))) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (1.0 + w) / (1.0 + yd)) * power_of<2>(log((w * (1.0 + yd)) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 + yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + yd) / yd)) * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(log(-2.0 / (-1.0 + w))) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, 1.0 / (1.0 - w), -2.0 / (-1.0 + w)) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / (1.0 + w))) * my_sign(-imag(w / (1.0 + w))) * T(1.0, 1.0 / (1.0 - w), 1.0 / (1.0 + w))
-                - (2.0 * 1.0i) * M_PI * power_of<2>(log((w + yd) / yd)) * my_sign(-imag(w / yd)) * T(1.0, 1.0 + w, (w + yd) / yd) - (12.0 * 1.0i) * M_PI * power_of<2>(log((1.0 - w) / 2.0)) * my_sign(imag(w) / 2.0) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w) / 2.0) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * log((1.0 + w) / 2.0) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + power_of<2>(log((w + yd) / w)) * (-3.0 * log((1.0 + w) / (1.0 - yd)) + 3.0 * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) + (2.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w))
-                - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / (1.0 + w))) * my_sign(2.0 * imag(1.0 / (1.0 + w))) * T(1.0, (w - yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * power_of<2>(log(w / (1.0 + w))) * my_sign(-imag(1.0 / (1.0 + w))) * T(1.0, (w - yd) / (1.0 + w), w / (1.0 + w)) + power_of<2>(log((1.0 - yd) / 2.0)) * (-6.0 * log((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) - 4.0 * log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) + (8.0 * 1.0i) * M_PI * my_sign(imag(yd) / 2.0) * T(1.0, (w - yd) / (1.0 + w), (1.0 - yd) / 2.0)) + (4.0 * 1.0i) * M_PI * power_of<2>(log(-2.0 / (-1.0 + w))) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), -2.0 / (-1.0 + w))
-                + log(1.0 - yd / w) * ((-2.0 * pisqu) / 3.0 + 4.0 * ln2squ - (8.0 * 1.0i) * M_PI * log(-2.0 / (-1.0 + w)) * my_sign(imag((-1.0 + w) / (w - yd))) * T(1.0, (-1.0 + yd) / (-1.0 + w), -2.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + yd) / (1.0 + w))) * my_sign(imag((w - yd) / (1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), (1.0 + yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * power_of<2>(log(-w)) * my_sign(-imag(w)) * T(1.0, -yd, -w)
-                + power_of<2>(log((w - yd) / (1.0 + w))) * (4.0 * log((-1.0 + yd) / (-1.0 + w)) - 4.0 * log(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) - 4.0 * log(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) - 2.0 * log((w + w * yd) / (yd + w * yd)) - 2.0 * log((yd + w * yd) / (w + w * yd)) + (8.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 + w))) * T(1.0, (1.0 - yd) / 2.0, (w - yd) / (1.0 + w)) - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 + w))) * T(1.0, -yd, (w - yd) / (1.0 + w)))
-                + power_of<2>(log((w + yd) / (-1.0 + w))) * (-2.0 * log(-(yd / w)) + 2.0 * log(((-1.0 + w) * yd) / (w * (1.0 + yd))) - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 - w))) * T(1.0, -yd, (w + yd) / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + w) / 2.0)) * my_sign((-0.5) * imag(w)) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w) / 2.0) - (8.0 * 1.0i) * M_PI * log((1.0 - w) / 2.0) * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + power_of<2>(log(1.0 - yd / w)) * ((8.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))
-                + log((1.0 - yd) / 2.0) * ((-4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * log(1.0 - yd / w) * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(log(w / (-1.0 + w))) * my_sign(-imag(1.0 / (-1.0 + w))) * T(1.0, (w + yd) / (-1.0 + w), w / (-1.0 + w)) + (8.0 * 1.0i) * M_PI * log(1.0 + winv) * log(-2.0 / (-1.0 + w)) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
-                - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * log(2.0 / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * log((1.0 + yd) / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + log((-1.0 + yd) / (-1.0 + w)) * (2.0 * power_of<2>(log(1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * log(1.0 - yd / w) * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + 16.0 * pisqu * log((-1.0 + w) / w) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) * T(p(winv, 1.0 - yd / w), 1.0 - yd / w, 1.0 + winv)
-                + 8.0 * pisqu * log((-1.0 + w) / w) * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)) - 4.0 * pisqu * power_of<2>(log((-1.0 + w) / w)) * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) + power_of<2>(ln1myd) * (log(((-1.0 + w) * yd) / (w - yd)) * (ln2 + log(1.0 + w) - 4.0 * ln1pyd) + log((w - yd) / ((-1.0 + w) * yd)) * (-log(1.0 + winv) - ln1pyd) + log((w - yd) / (-1.0 + w)) * (-2.0 * lnhalf + log(1.0 + winv) + ln1pyd)
-                + log((-1.0 + w) / (w - yd)) * (-ln2 - log(1.0 + w) + 4.0 * ln1pyd) - ln2 * log((1.0 + w) / (w + yd)) + ln2 * log(((1.0 + w) * yd) / (w + yd)) - (2.0 * ln64 * log((w + yd) / w)) / 3.0 + 2.0 * log(-(yd / w)) * log((w + yd) / (1.0 + w)) + (-2.0 * lnhalf + ln2 + 2.0 * log(yd / (1.0 + yd))) * log((w + yd) / (1.0 + w)) + log(ydinv) * (3.0 * ln2 + 2.0 * log(1.0 + winv) - log(1.0 - w) + log(1.0 + w) - 4.0 * ln1pyd + log((w + yd) / w) - 5.0 * log(1.0 - yd / w))
-                + log((2.0 * yd) / (1.0 + yd)) * (3.0 * log(1.0 + winv) - log(1.0 - w) + 2.0 * log((-1.0 + w) / w) - log(1.0 + w) - log((w + yd) / w) - 2.0 * log(1.0 - yd / w)) + 2.0 * ln2 * log(1.0 - yd / w) + log(yd) * (-4.0 * log((w + yd) / w) + 2.0 * log(1.0 - yd / w)) + log(2.0 / (1.0 + yd)) * (-3.0 * log(1.0 + winv) + log(1.0 - w) - 2.0 * log((-1.0 + w) / w) + log(1.0 + w) + log((w + yd) / w) + 2.0 * log(1.0 - yd / w)) + log((1.0 + yd) / (2.0 * yd)) * (2.0 * log(1.0 + winv) + 2.0 * log((-1.0 + w) / w) - log(1.0 + w) - 2.0 * log((w + yd) / w) + 3.0 * log(1.0 - yd / w))
-                - ln2 * log((w + yd) / (yd + w * yd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd)) * T(1.0, 1.0 - w, 1.0 - yd) + (2.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(imag(yd)) * T(1.0, 1.0 - w, 1.0 - yd) + log((1.0 + yd) / 2.0) * (-2.0 * log(1.0 + winv) - 2.0 * log((-1.0 + w) / w) + log(w / (1.0 + w)) + log(1.0 + w) - log(yd / (w + yd)) + 8.0 * log((w + yd) / (-1.0 + w)) + 2.0 * log((w + yd) / w) - 3.0 * log(1.0 - yd / w) + (2.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) - (8.0 * 1.0i) * M_PI * log(-w) * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, -w)
-                + (4.0 * 1.0i) * M_PI * log(w) * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, w) + (16.0 * 1.0i) * M_PI * log((1.0 - w) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 - w) / 2.0) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(winv)) * T(1.0, 1.0 + yd, 1.0 - w) - (2.0 * 1.0i) * M_PI * log(1.0 - w) * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) + (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) + log((1.0 + yd) / (1.0 - w)) * (4.0 * log((w + yd) / (1.0 + w)) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
-                + (8.0 * 1.0i) * M_PI * log((-1.0 + w) / (1.0 + w)) * my_sign(imag((1.0 + w) / (1.0 - yd))) * T(1.0, (w + yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * log(w / (1.0 + w)) * my_sign(imag((1.0 + w) / (1.0 - yd))) * T(1.0, (w + yd) / (1.0 + w), w / (1.0 + w)) + (4.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd) + (6.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)
-                + ln1pyd * (log((1.0 + w) / (w + yd)) - log(((1.0 + w) * yd) / (w + yd)) - 4.0 * log((w + yd) / (-1.0 + w)) - 4.0 * log((w + yd) / (1.0 + w)) - (6.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)) - 4.0 * pisqu * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w));
+            const complex<double> part6 = + li2_17 * (-4.0 * li2_29 + 2.0 * li2_26 - 2.0 * li2_9 - 4.0 * li2_25 + 2.0 * li2_32 + 2.0 * li2_33 - 6.0 * li2_5 + 2.0 * li2_53 + 4.0 * ln2 * ln_1 + 2.0 * power_of<2>(ln_1) + 2.0 * ln_1 * ln_3 + 2.0 * power_of<2>(ln_3) - 4.0 * ln_1 * ln_115 + 4.0 * ln2 * ln_5 + 4.0 * power_of<2>(ln_5) - 2.0 * ln2 * ln_116
+                + 2.0 * ln_3 * ln_117 + 2.0 * ln_3 * ln_118 - 2.0 * ln2 * log((1.0 + w) / (-1.0 + w)) + (8.0 * ln2 - 6.0 * ln_42) * ln_60 + 2.0 * power_of<2>(ln_67) - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - w) + (4.0 * 1.0i) * M_PI * ln_12 * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 + w) + ln_67 * (-4.0 * ln2 + 2.0 * ln_83 + 2.0 * ln_103 + (4.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + yd, 1.0 - yd / w))
+                - (12.0 * 1.0i) * M_PI * ln_5 * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + ln1pyd * (2.0 * ln_1 - 4.0 * ln_12 + 2.0 * ln_35 + 2.0 * ln_59 - 4.0 * ln_58 + 8.0 * ln_60 - 8.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)))
+                + li2_72 * (2.0 * li2_29 + 2.0 * li2_26 - 4.0 * li2_9 + 4.0 * li2_44 + 4.0 * li2_53 - 2.0 * power_of<2>(ln1myd) - 2.0 * power_of<2>(ln1pyd) + (8.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_100) * ln_60 + ln_67 * (8.0 * ln2 + 4.0 * ln_1 + 4.0 * ln_103) + ln1myd * (-4.0 * lnhalf + 2.0 * ln_1 - 4.0 * ln1pyd + (8.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
+                + ln1pyd * (-4.0 * lnhalf + 2.0 * ln_1 + (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd))) + li2_4 * ((-2.0 * pisqu) / 3.0 - li2_59 - 6.0 * li2_8 + 2.0 * li2_9 + 4.0 * li2_61 - li2_53 + 8.0 * ln_35 * ln1pyd + 4.0 * power_of<2>(ln1pyd) - 2.0 * power_of<2>(ln_67) - 8.0 * ln_5 * ln_75 + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv)
+                + ln_67 * (-2.0 * ln_61 - 2.0 * ln_25 - (4.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + ln1pyd * (4.0 * ln_67 + (4.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd))) + power_of<2>(ln_13) * (2.0 * pisqu - (8.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(yd / (-1.0 + yd))) * T(1.0, (w - yd) / (w - w * yd), 1.0 / (1.0 - yd)) - (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(yd / (1.0 - yd))) * T(1.0, (w + yd) / (w - w * yd), 1.0 / (1.0 - yd)))
+                + power_of<2>(ln_15) * ((-2.0 * pisqu) / 3.0 - (4.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(yd / (w - yd))) * T(1.0, (w - w * yd) / (w - yd), w / (w - yd))) + power_of<2>(ln_20) * (2.0 * pisqu - (4.0 * 1.0i) * M_PI * ln_1 * my_sign(imag(yd / (1.0 + yd))) * T(1.0, (w - yd) / (w + w * yd), 1.0 / (1.0 + yd)) - (8.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(yd / (1.0 + yd))) * T(1.0, (w + yd) / (w + w * yd), 1.0 / (1.0 + yd))) - 4.0 * pisqu * power_of<2>(ln_1) * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w)
+                + 8.0 * pisqu * ln_1 * ln_5 * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) - 4.0 * pisqu * power_of<2>(ln_5) * T(1.0, (w + yd) / w, 1.0 + winv) * T(p(-winv, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) - 4.0 * pisqu * power_of<2>(ln_1) * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w) + 8.0 * pisqu * ln_1 * ln_5 * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)
+                - 4.0 * pisqu * power_of<2>(ln_5) * T(1.0, 1.0 - yd / w, 1.0 + winv) * T(p(-winv, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w) + 4.0 * pisqu * ln2squ * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) - 8.0 * pisqu * ln2 * ln_12 * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) + 4.0 * pisqu * power_of<2>(ln_12) * T(1.0, 1.0 - yd, 1.0 + w) * T(p(-w, 1.0 - yd), 1.0 - yd, 2.0) + 4.0 * pisqu * ln2squ * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0) - 8.0 * pisqu * ln2 * ln_12 * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0)
+                + 4.0 * pisqu * power_of<2>(ln_12) * T(1.0, 1.0 + yd, 1.0 + w) * T(p(-w, 1.0 + yd), 1.0 + yd, 2.0) - 4.0 * pisqu * power_of<2>(ln_5) * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)
+                + power_of<2>(ln1pyd) * (ln_35 * (-2.0 * lnhalf + ln2 + 4.0 * ln_26 + 2.0 * ln_30) + ln2 * ln_59 + (-ln2 - ln_12) * ln_63 + (-2.0 * lnhalf + ln_1) * ln_58 + 2.0 * ln2 * ln_60 + log((-1.0 + yd) / (2.0 * yd)) * (2.0 * ln_1 + 2.0 * ln_5 - ln_12 + 3.0 * ln_60 - 2.0 * ln_67)
+                + log((2.0 * yd) / (-1.0 + yd)) * (3.0 * ln_1 - ln_3 + 2.0 * ln_5 - ln_12 - 2.0 * ln_60 - ln_67) - (2.0 * ln64 * ln_67) / 3.0 - ln_1 * ln_81 + (ln2 + ln_12) * ln_113 - ln2 * log(-((w - yd) / (yd + w * yd))) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd)) * T(1.0, 1.0 - w, 1.0 + yd) + (2.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(yd)) * T(1.0, 1.0 - w, 1.0 + yd)
+                + (16.0 * 1.0i) * M_PI * ln_27 * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w) / 2.0) - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(winv)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * ln_28 * my_sign(imag((1.0 + w) / (1.0 + yd))) * T(1.0, (w - yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * ln_10 * my_sign(imag((1.0 + w) / (1.0 + yd))) * T(1.0, (w - yd) / (1.0 + w), w / (1.0 + w)) - (8.0 * 1.0i) * M_PI * ln_6 * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, -w) + (4.0 * 1.0i) * M_PI * ln_7 * my_sign(imag(1.0 / (1.0 + yd))) * T(1.0, -yd, w)
+                + ln_14 * (-2.0 * ln_1 - 2.0 * ln_5 + ln_10 + ln_12 - ln_114 - 3.0 * ln_60 + 2.0 * ln_67 + (2.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd) + (6.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd) - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)
+                + (4.0 * 1.0i) * M_PI * ln_5 * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) - (2.0 * 1.0i) * M_PI * ln_26 * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd) - 4.0 * pisqu * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)) + ln1pyd * ((-1.0 / 3.0) * (pisqu * lnm1) - power_of<3>(lnm1) / 3.0 + lnm1 * ln2squ - 2.0 * power_of<2>(lnhalf) * ln_1 + 2.0 * lnhalf * power_of<2>(ln_2) + 2.0 * ln2 * power_of<2>(ln_2) - (2.0 * pisqu * ln_3) / 3.0 - (2.0 * power_of<3>(ln_3)) / 3.0 - power_of<2>(ln_1) * ln_115
+                + (2.0 * pisqu * ln_119) / 3.0 + (2.0 * power_of<3>(ln_119)) / 3.0 - (2.0 * pisqu * ln_11) / 3.0 - (2.0 * power_of<3>(ln_11)) / 3.0 + (pisqu * ln_120) / 3.0 + power_of<3>(ln_120) / 3.0 - (pisqu * ln_121) / 3.0 - power_of<3>(ln_121) / 3.0 + pisqu * ln_4 - 3.0 * power_of<2>(ln_3) * ln_4 + power_of<3>(ln_4) + (2.0 * pisqu * ln_122) / 3.0 + (2.0 * power_of<3>(ln_122)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_39 - 2.0 * power_of<2>(ln_2) * ln_39 - 2.0 * power_of<2>(lnhalf) * ln_5 - (2.0 * pisqu * ln_123) / 3.0 - (2.0 * power_of<3>(ln_123)) / 3.0
+                + (4.0 * pisqu * ln_7) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_7 - 4.0 * power_of<2>(ln_5) * ln_7 + (4.0 * power_of<3>(ln_7)) / 3.0 - (pisqu * ln_8) / 3.0 - 2.0 * power_of<2>(lnhalf) * ln_8 - power_of<3>(ln_8) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_124 + power_of<2>(ln_1) * ln_124 - 2.0 * power_of<2>(ln_2) * ln_124 + (pisqu * ln_108) / 3.0 + power_of<3>(ln_108) / 3.0 - (2.0 * pisqu * ln_61) / 3.0 - (2.0 * power_of<3>(ln_61)) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_40
+                - 2.0 * power_of<2>(ln_5) * ln_40 + ln2squ * ln_116 - ln2squ * ln_28 - (2.0 * pisqu * ln_125) / 3.0 - (2.0 * power_of<3>(ln_125)) / 3.0 - (2.0 * pisqu * ln_10) / 3.0 - 2.0 * power_of<2>(lnhalf) * ln_10 - (2.0 * power_of<3>(ln_10)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_117 - 2.0 * power_of<2>(ln_3) * ln_117 + 2.0 * power_of<2>(ln_5) * ln_117 - power_of<2>(ln_3) * ln_118 + 2.0 * power_of<2>(ln_5) * ln_118
+                + ln_27 * power_of<2>(ln_12) + 2.0 * ln_11 * power_of<2>(ln_12) - ln_39 * power_of<2>(ln_12) - (2.0 * pisqu * ln_126) / 3.0 - (2.0 * power_of<3>(ln_126)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_41 + power_of<2>(ln_3) * ln_41 - 2.0 * power_of<2>(ln_5) * ln_41 + (2.0 * pisqu * ln_127) / 3.0 + (2.0 * power_of<3>(ln_127)) / 3.0 - (4.0 * pisqu * log(-2.0 / (w - yd))) / 3.0 - (4.0 * power_of<3>(log(-2.0 / (w - yd)))) / 3.0 - (2.0 * pisqu * log(2.0 / (w - yd))) / 3.0 - (2.0 * power_of<3>(log(2.0 / (w - yd)))) / 3.0
+                - (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * (w - yd)))) / 3.0 - (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * (w - yd))))) / 3.0 + (2.0 * pisqu * ln_35) / 3.0 + (2.0 * pisqu * log((-2.0 * (-1.0 + w)) / ((1.0 + w) * (-1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((-2.0 * (-1.0 + w)) / ((1.0 + w) * (-1.0 + yd))))) / 3.0 - (4.0 * pisqu * log((1.0 + w) / (-1.0 + yd))) / 3.0 - (4.0 * power_of<3>(log((1.0 + w) / (-1.0 + yd)))) / 3.0 - (2.0 * pisqu * log((1.0 + w) / yd)) / 3.0 - (2.0 * power_of<3>(log((1.0 + w) / yd))) / 3.0 + (4.0 * pisqu * log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd)))) / 3.0 + (4.0 * power_of<3>(log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd))))) / 3.0
+                + 2.0 * pisqu * log((2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd))) + 2.0 * power_of<3>(log((2.0 * (1.0 + w)) / ((-1.0 + w) * (1.0 + yd)))) + power_of<2>(ln_26) * (2.0 * log((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) + 2.0 * log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd)))) - (2.0 * pisqu * ln_48) / 3.0 - (2.0 * power_of<3>(ln_48)) / 3.0 + (pisqu * ln_49) / 3.0 + power_of<3>(ln_49) / 3.0 + (pisqu * ln_50) / 3.0 + power_of<3>(ln_50) / 3.0 - power_of<2>(ln_12) * ln_53 - (2.0 * pisqu * ln_58) / 3.0
+                + (pisqu / 3.0 - 2.0 * ln2squ) * ln_60 + 2.0 * ln_65 * power_of<2>(ln_60) - power_of<2>(ln_1) * ln_99 + power_of<2>(ln_1) * ln_76 + power_of<2>(ln_12) * ln_79 + (2.0 * pisqu * ln_80) / 3.0 + (2.0 * power_of<3>(ln_80)) / 3.0 - (2.0 * pisqu * log((1.0 - w) / (w + w * yd))) / 3.0 - (2.0 * power_of<3>(log((1.0 - w) / (w + w * yd)))) / 3.0 + (2.0 * pisqu * log(-((1.0 + w) / (w + w * yd)))) / 3.0 + (2.0 * power_of<3>(log(-((1.0 + w) / (w + w * yd))))) / 3.0 - (4.0 * pisqu * ln_105) / 3.0
+                - (4.0 * power_of<3>(ln_105)) / 3.0 - (2.0 * 1.0i) * M_PI * H1(ydinv, -winv) * power_of<2>(ln_93) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / w) * power_of<2>(ln_9) * my_sign(imag(winv)) + (4.0 * 1.0i) * M_PI * H1(1.0 + winv, (-1.0 + w) / w) * power_of<2>(log((-2.0 * w) / (-1.0 + power_of<2>(w)))) * my_sign(imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (-1.0 + yd), -2.0 / (-1.0 + yd)) * power_of<2>(log(((1.0 + w) * (-1.0 + yd)) / (2.0 * (-1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) + (4.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + w), -2.0 / (-1.0 + yd)) * power_of<2>(log((-w + yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 - yd)))
+                + (4.0 * 1.0i) * M_PI * H1((1.0 + w) / (w - yd), (-1.0 + w) / (w - yd)) * power_of<2>(log((-2.0 * (w - yd)) / (-1.0 + power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w - yd))) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / (w - yd)) * power_of<2>(log((1.0 + yd) / (-1.0 + w))) * my_sign(imag((-1.0 + w) / (w - yd))) - (4.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * power_of<2>(ln_91) * my_sign(-imydinv) - (2.0 * 1.0i) * M_PI * H1(w / yd, ydinv) * power_of<2>(ln_95) * my_sign(imydinv) - (6.0 * 1.0i) * M_PI * H1(-w, -(w / yd)) * power_of<2>(ln_98) * my_sign(-imag(w / yd)) - (4.0 * 1.0i) * M_PI * H1(ydinv, w / yd) * power_of<2>(ln_90) * my_sign(imag(w / yd))
+                + power_of<2>(log((1.0 - yd) / w)) * ((-2.0 * 1.0i) * M_PI * H1(-(w / yd), -w) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H1(w, w / yd) * my_sign(imag(w / yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 + yd), 1.0 / (1.0 + yd)) * power_of<2>(ln_43) * my_sign(imag(1.0 / (1.0 + yd))) + power_of<2>(ln_94) * ((2.0 * 1.0i) * M_PI * H1(-winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), 1.0 / (1.0 + yd)) * my_sign(imag(1.0 / (1.0 + yd)))) + power_of<2>(ln_96) * ((8.0 * 1.0i) * M_PI * H1(winv, ydinv) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + w), 1.0 / (1.0 + yd)) * my_sign(imag(1.0 / (1.0 + yd))))
+                + (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + w), 2.0 / (1.0 + yd)) * power_of<2>(log((w - yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) - (12.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log((-0.5) * (((-1.0 + w) * (1.0 + yd)) / (1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (1.0 - w) / (1.0 + yd)) * power_of<2>(log((w * (1.0 + yd)) / (-1.0 + w))) * my_sign(imag((1.0 - w) / (1.0 + yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / 2.0, (1.0 + w) / (1.0 + yd)) * power_of<2>(ln_77) * my_sign(imag((1.0 + w) / (1.0 + yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 + w, (1.0 + w) / (1.0 + yd)) * power_of<2>(log(-(yd / (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 + yd)))
+                - (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + yd), (1.0 + w) / (1.0 + yd)) * power_of<2>(log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 + yd))) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + yd), (1.0 + w) / (1.0 + yd)) * power_of<2>(log((w * (1.0 + yd)) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 + yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_111) * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_115) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, 1.0 / (1.0 - w), -2.0 / (-1.0 + w)) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_61) * my_sign(-imag(w / (1.0 + w))) * T(1.0, 1.0 / (1.0 - w), 1.0 / (1.0 + w))
+                - (2.0 * 1.0i) * M_PI * power_of<2>(ln_107) * my_sign(-imag(w / yd)) * T(1.0, 1.0 + w, (w + yd) / yd) - (12.0 * 1.0i) * M_PI * power_of<2>(ln_27) * my_sign(imag(w) / 2.0) * T(1.0, (1.0 - yd) / 2.0, (1.0 - w) / 2.0) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * ln_3 * ln_118 * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) + (8.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + power_of<2>(ln_60) * (-3.0 * log((1.0 + w) / (1.0 - yd)) + 3.0 * ln_100 + (2.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w))
+                - (8.0 * 1.0i) * M_PI * power_of<2>(ln_28) * my_sign(2.0 * imag(1.0 / (1.0 + w))) * T(1.0, (w - yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_10) * my_sign(-imag(1.0 / (1.0 + w))) * T(1.0, (w - yd) / (1.0 + w), w / (1.0 + w)) + power_of<2>(ln_14) * (-6.0 * log((2.0 * (w - yd)) / ((-1.0 + w) * (1.0 + yd))) - 4.0 * log(((-1.0 + w) * (1.0 + yd)) / (2.0 * (w - yd))) + (8.0 * 1.0i) * M_PI * my_sign(imag(yd) / 2.0) * T(1.0, (w - yd) / (1.0 + w), (1.0 - yd) / 2.0)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_115) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), -2.0 / (-1.0 + w))
+                + ln_67 * ((-2.0 * pisqu) / 3.0 + 4.0 * ln2squ - (8.0 * 1.0i) * M_PI * ln_115 * my_sign(imag((-1.0 + w) / (w - yd))) * T(1.0, (-1.0 + yd) / (-1.0 + w), -2.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_83) * my_sign(imag((w - yd) / (1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), (1.0 + yd) / (1.0 + w)) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_6) * my_sign(-imag(w)) * T(1.0, -yd, -w)
+                + power_of<2>(ln_35) * (4.0 * ln_26 - 4.0 * log(((1.0 + w) * (-1.0 + yd)) / ((-1.0 + w) * (1.0 + yd))) - 4.0 * log(((-1.0 + w) * (1.0 + yd)) / ((1.0 + w) * (-1.0 + yd))) - 2.0 * ln_85 - 2.0 * ln_103 + (8.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 + w))) * T(1.0, (1.0 - yd) / 2.0, (w - yd) / (1.0 + w)) - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 + w))) * T(1.0, -yd, (w - yd) / (1.0 + w)))
+                + power_of<2>(ln_58) * (-2.0 * ln_65 + 2.0 * ln_64 - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 + yd) / (1.0 - w))) * T(1.0, -yd, (w + yd) / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_118) * my_sign((-0.5) * imag(w)) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w) / 2.0) - (8.0 * 1.0i) * M_PI * ln_27 * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + power_of<2>(ln_67) * ((8.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w))
+                + ln_14 * ((-4.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * ln_67 * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_8) * my_sign(-imag(1.0 / (-1.0 + w))) * T(1.0, (w + yd) / (-1.0 + w), w / (-1.0 + w)) + (8.0 * 1.0i) * M_PI * ln_1 * ln_115 * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w)
+                - (8.0 * 1.0i) * M_PI * ln_5 * ln_40 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + (8.0 * 1.0i) * M_PI * ln_5 * ln_83 * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) + ln_26 * (2.0 * power_of<2>(ln_67) + (4.0 * 1.0i) * M_PI * ln_67 * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + 16.0 * pisqu * ln_5 * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) * T(p(winv, 1.0 - yd / w), 1.0 - yd / w, 1.0 + winv)
+                + 8.0 * pisqu * ln_5 * T(1.0, 1.0 - yd / w, 1.0 + yd) * T(p(-yd, 1.0 - yd / w), 1.0 - yd / w, (-1.0 + w) / w)) - 4.0 * pisqu * power_of<2>(ln_5) * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w) + power_of<2>(ln1myd) * (ln_70 * (ln2 + ln_12 - 4.0 * ln1pyd) + ln_17 * (-ln_1 - ln1pyd) + ln_54 * (-2.0 * lnhalf + ln_1 + ln1pyd)
+                + ln_69 * (-ln2 - ln_12 + 4.0 * ln1pyd) - ln2 * ln_52 + ln2 * ln_56 - (2.0 * ln64 * ln_60) / 3.0 + 2.0 * ln_65 * ln_66 + (-2.0 * lnhalf + ln2 + 2.0 * ln_25) * ln_66 + ln_55 * (3.0 * ln2 + 2.0 * ln_1 - ln_3 + ln_12 - 4.0 * ln1pyd + ln_60 - 5.0 * ln_67)
+                + log((2.0 * yd) / (1.0 + yd)) * (3.0 * ln_1 - ln_3 + 2.0 * ln_5 - ln_12 - ln_60 - 2.0 * ln_67) + 2.0 * ln2 * ln_67 + ln_38 * (-4.0 * ln_60 + 2.0 * ln_67) + ln_36 * (-3.0 * ln_1 + ln_3 - 2.0 * ln_5 + ln_12 + ln_60 + 2.0 * ln_67) + log((1.0 + yd) / (2.0 * yd)) * (2.0 * ln_1 + 2.0 * ln_5 - ln_12 - 2.0 * ln_60 + 3.0 * ln_67)
+                - ln2 * log((w + yd) / (yd + w * yd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd)) * T(1.0, 1.0 - w, 1.0 - yd) + (2.0 * 1.0i) * M_PI * ln_12 * my_sign(imag(yd)) * T(1.0, 1.0 - w, 1.0 - yd) + ln_24 * (-2.0 * ln_1 - 2.0 * ln_5 + ln_10 + ln_12 - ln_112 + 8.0 * ln_58 + 2.0 * ln_60 - 3.0 * ln_67 + (2.0 * 1.0i) * M_PI * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) - (8.0 * 1.0i) * M_PI * ln_6 * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, -w)
+                + (4.0 * 1.0i) * M_PI * ln_7 * my_sign(imag(1.0 / (1.0 - yd))) * T(1.0, yd, w) + (16.0 * 1.0i) * M_PI * ln_27 * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 - w) / 2.0) - (8.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(winv)) * T(1.0, 1.0 + yd, 1.0 - w) - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) + (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) + ln_42 * (4.0 * ln_66 - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd))
+                + (8.0 * 1.0i) * M_PI * ln_28 * my_sign(imag((1.0 + w) / (1.0 - yd))) * T(1.0, (w + yd) / (1.0 + w), (-1.0 + w) / (1.0 + w)) + (4.0 * 1.0i) * M_PI * ln_10 * my_sign(imag((1.0 + w) / (1.0 - yd))) * T(1.0, (w + yd) / (1.0 + w), w / (1.0 + w)) + (4.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd) + (6.0 * 1.0i) * M_PI * ln_1 * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)
+                + ln1pyd * (ln_52 - ln_56 - 4.0 * ln_58 - 4.0 * ln_66 - (6.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 - yd)) - 4.0 * pisqu * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w));
 
-            const complex<double> part7 = + ln1myd * ((-1.0 / 3.0) * (pisqu * lnm1) - power_of<3>(lnm1) / 3.0 + lnm1 * ln2squ - 2.0 * power_of<2>(lnhalf) * log(1.0 + winv) + 2.0 * lnhalf * power_of<2>(log(1.0 / (1.0 - w))) + 2.0 * ln2 * power_of<2>(log(1.0 / (1.0 - w))) - (2.0 * pisqu * log(1.0 - w)) / 3.0 - (2.0 * power_of<3>(log(1.0 - w))) / 3.0 - power_of<2>(log(1.0 + winv)) * log(-2.0 / (-1.0 + w)) + (2.0 * pisqu * log(-2.0 / w)) / 3.0 + (2.0 * power_of<3>(log(-2.0 / w))) / 3.0 - (2.0 * pisqu * log(-winv)) / 3.0 - (2.0 * power_of<3>(log(-winv))) / 3.0 + (pisqu * log((-0.5) * (1.0 / w))) / 3.0 + power_of<3>(log((-0.5) * (1.0 / w))) / 3.0 - (pisqu * log(1.0 / (2.0 * w))) / 3.0 - power_of<3>(log(1.0 / (2.0 * w))) / 3.0 + pisqu * log(winv)
-                - 3.0 * power_of<2>(log(1.0 - w)) * log(winv) + power_of<3>(log(winv)) + (2.0 * pisqu * log(2.0 / w)) / 3.0 + (2.0 * power_of<3>(log(2.0 / w))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((-1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(log(1.0 / (1.0 - w))) * log((-1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(lnhalf) * log((-1.0 + w) / w) - (2.0 * pisqu * log(w / 2.0)) / 3.0 - (2.0 * power_of<3>(log(w / 2.0))) / 3.0 + (4.0 * pisqu * log(w)) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(w) - 4.0 * power_of<2>(log((-1.0 + w) / w)) * log(w) + (4.0 * power_of<3>(log(w))) / 3.0 - (pisqu * log(w / (-1.0 + w))) / 3.0 - 2.0 * power_of<2>(lnhalf) * log(w / (-1.0 + w)) - power_of<3>(log(w / (-1.0 + w))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((2.0 * w) / (-1.0 + w))
-                + power_of<2>(log(1.0 + winv)) * log((2.0 * w) / (-1.0 + w)) - 2.0 * power_of<2>(log(1.0 / (1.0 - w))) * log((2.0 * w) / (-1.0 + w)) + (pisqu * log(-1.0 / (1.0 + w))) / 3.0 + power_of<3>(log(-1.0 / (1.0 + w))) / 3.0 - (2.0 * pisqu * log(1.0 / (1.0 + w))) / 3.0 - (2.0 * power_of<3>(log(1.0 / (1.0 + w)))) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(2.0 / (1.0 + w)) - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(2.0 / (1.0 + w)) + ln2squ * log((1.0 - w) / (1.0 + w)) - ln2squ * log((-1.0 + w) / (1.0 + w)) - (2.0 * pisqu * log((2.0 * (-1.0 + w)) / (1.0 + w))) / 3.0 - (2.0 * power_of<3>(log((2.0 * (-1.0 + w)) / (1.0 + w)))) / 3.0 - (2.0 * pisqu * log(w / (1.0 + w))) / 3.0
-                - 2.0 * power_of<2>(lnhalf) * log(w / (1.0 + w)) - (2.0 * power_of<3>(log(w / (1.0 + w)))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((2.0 * w) / (1.0 + w)) - 2.0 * power_of<2>(log(1.0 - w)) * log((2.0 * w) / (1.0 + w)) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((2.0 * w) / (1.0 + w)) - power_of<2>(log(1.0 - w)) * log((1.0 + w) / 2.0) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((1.0 + w) / 2.0) + log((1.0 - w) / 2.0) * power_of<2>(log(1.0 + w)) + 2.0 * log(-winv) * power_of<2>(log(1.0 + w)) - log((-1.0 + w) / (2.0 * w)) * power_of<2>(log(1.0 + w)) - (2.0 * pisqu * log((2.0 * (1.0 + w)) / (-1.0 + w))) / 3.0 - (2.0 * power_of<3>(log((2.0 * (1.0 + w)) / (-1.0 + w)))) / 3.0 + 2.0 * power_of<2>(lnhalf) * log((1.0 + w) / (2.0 * w))
-                + power_of<2>(log(1.0 - w)) * log((1.0 + w) / (2.0 * w)) - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((1.0 + w) / (2.0 * w)) + (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * w))) / 3.0 + (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * w)))) / 3.0 + (pisqu * log(1.0 / (w - yd))) / 3.0 + power_of<3>(log(1.0 / (w - yd))) / 3.0 - (2.0 * power_of<3>(log(-2.0 / (-1.0 + yd)))) / 3.0 + (4.0 * pisqu * log((-1.0 + w) / (-1.0 + yd))) / 3.0 + (4.0 * power_of<3>(log((-1.0 + w) / (-1.0 + yd)))) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / (w * (-1.0 + yd)))) / 3.0 - (2.0 * power_of<3>(log((-1.0 + w) / (w * (-1.0 + yd))))) / 3.0 + 2.0 * pisqu * log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))) + 2.0 * power_of<3>(log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))))
-                + (4.0 * pisqu * log((2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd)))) / 3.0 + (4.0 * power_of<3>(log((2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))))) / 3.0 + (2.0 * pisqu * log((1.0 + w) / (w * (-1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((1.0 + w) / (w * (-1.0 + yd))))) / 3.0 + (4.0 * power_of<3>(log(-ydinv))) / 3.0 - (2.0 * pisqu * log(ydinv)) / 3.0 - (2.0 * power_of<3>(log(ydinv))) / 3.0 - power_of<3>(log(-(w / yd))) - power_of<3>(log(w / yd)) + (2.0 * pisqu * log(w / ((-1.0 + w) * yd))) / 3.0 + (2.0 * power_of<3>(log(w / ((-1.0 + w) * yd)))) / 3.0 - (2.0 * pisqu * log(-((1.0 + w) / yd))) / 3.0 - (2.0 * power_of<3>(log(-((1.0 + w) / yd)))) / 3.0 - 2.0 * log(w / (w - yd)) * power_of<2>(log(yd)) + (2.0 * pisqu * log(-(w / (1.0 + yd)))) / 3.0
-                + (2.0 * power_of<3>(log(-(w / (1.0 + yd))))) / 3.0 + pisqu * log(w / (1.0 + yd)) + power_of<3>(log(w / (1.0 + yd))) + (2.0 * pisqu * log((2.0 * (-1.0 + w)) / ((1.0 + w) * (1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((2.0 * (-1.0 + w)) / ((1.0 + w) * (1.0 + yd))))) / 3.0 - (4.0 * pisqu * log(-((1.0 + w) / (1.0 + yd)))) / 3.0 - (4.0 * power_of<3>(log(-((1.0 + w) / (1.0 + yd))))) / 3.0 + log((1.0 + w) / (w - yd)) * power_of<2>(ln1pyd) + log((w - yd) / (-1.0 + w)) * ((-2.0 * pisqu) / 3.0 - 4.0 * power_of<2>(ln1pyd)) + log(-ydinv) * ((4.0 * pisqu) / 3.0 - 4.0 * power_of<2>(ln1pyd)) + log(-2.0 / (-1.0 + yd)) * ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(log((1.0 + yd) / 2.0)) - 2.0 * power_of<2>(log((1.0 + yd) / (1.0 - w))))
-                - power_of<2>(log(1.0 + w)) * log(-((1.0 + yd) / (w - yd))) + power_of<2>(log(1.0 + w)) * log((w * (1.0 + yd)) / (w - yd)) + (pisqu * log(1.0 / (-w + yd))) / 3.0 + power_of<3>(log(1.0 / (-w + yd))) / 3.0 - power_of<2>(log(1.0 + winv)) * log((-w + yd) / (1.0 + yd)) - (4.0 * pisqu * log(-2.0 / (w + yd))) / 3.0 - (4.0 * power_of<3>(log(-2.0 / (w + yd)))) / 3.0 - (2.0 * pisqu * log(-1.0 / (w + yd))) / 3.0 - (2.0 * power_of<3>(log(-1.0 / (w + yd)))) / 3.0 + (2.0 * pisqu * log(1.0 / (w + yd))) / 3.0 + (2.0 * power_of<3>(log(1.0 / (w + yd)))) / 3.0 - (2.0 * pisqu * log(2.0 / (w + yd))) / 3.0 - (2.0 * power_of<3>(log(2.0 / (w + yd)))) / 3.0 - (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * (w + yd)))) / 3.0
-                - (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * (w + yd))))) / 3.0 + log(((-1.0 + w) * yd) / (w * (1.0 + yd))) * power_of<2>(log((w + yd) / w)) - 2.0 * log((w * (1.0 + yd)) / ((-1.0 + w) * yd)) * power_of<2>(log((w + yd) / w)) + log((1.0 - yd) / 2.0) * (-2.0 * power_of<2>(log((1.0 + yd) / (1.0 - w))) - 4.0 * log((1.0 + yd) / (1.0 - w)) * log((w + yd) / w)) + (2.0 * pisqu * log((w + yd) / (1.0 + w))) / 3.0 - 2.0 * log((w * (-1.0 + yd)) / ((1.0 + w) * yd)) * power_of<2>(log((w + yd) / (1.0 + w))) + 2.0 * log(-(yd / w)) * power_of<2>(log((w + yd) / (1.0 + w))) - 2.0 * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) * power_of<2>(log((w + yd) / (1.0 + w)))
-                + log(-(w / yd)) * (-pisqu + 3.0 * power_of<2>(log((w + yd) / w)) + 2.0 * power_of<2>(log((w + yd) / (1.0 + w)))) + log((1.0 - w) / (1.0 + yd)) * (-power_of<2>(log((w + yd) / w)) + 4.0 * power_of<2>(log((w + yd) / (1.0 + w)))) + power_of<2>(log((1.0 + yd) / (1.0 - w))) * (2.0 * log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) + 2.0 * log((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd)))) + power_of<2>(log((1.0 - yd) / 2.0)) * (2.0 * log((1.0 + w) / (w + yd)) - 2.0 * log(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) + 2.0 * log((w + yd) / (1.0 + w)) - 2.0 * log((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd)))) + (pisqu / 3.0 - 2.0 * ln2squ) * log(1.0 - yd / w)
-                + 2.0 * log(yd / w) * power_of<2>(log(1.0 - yd / w)) + log(w / yd) * (-pisqu + 3.0 * power_of<2>(log(1.0 - yd / w))) - (4.0 * pisqu * log((1.0 + w) / (w - w * yd))) / 3.0 - (4.0 * power_of<3>(log((1.0 + w) / (w - w * yd)))) / 3.0 + (pisqu * log(w / (yd - w * yd))) / 3.0 + power_of<3>(log(w / (yd - w * yd))) / 3.0 + power_of<2>(log(1.0 + winv)) * log((w - yd) / (w + w * yd)) - (2.0 * 1.0i) * M_PI * H1(-ydinv, -winv) * power_of<2>(log(w - yd)) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / w) * power_of<2>(log(1.0 / (-1.0 + w))) * my_sign(imag(winv))
-                + (4.0 * 1.0i) * M_PI * H1(1.0 + winv, (-1.0 + w) / w) * power_of<2>(log((-2.0 * w) / (-1.0 + power_of<2>(w)))) * my_sign(imag(winv)) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 - yd), 1.0 / (1.0 - yd)) * power_of<2>(log((w * (-1.0 + yd)) / (1.0 + w))) * my_sign(imag(1.0 / (1.0 - yd))) - (12.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 - yd), -2.0 / (-1.0 + yd)) * power_of<2>(log(((-1.0 + w) * (-1.0 + yd)) / (2.0 * (1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + w), -2.0 / (-1.0 + yd)) * power_of<2>(log((w + yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 - yd)))
-                - (8.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + yd), (1.0 + w) / (1.0 - yd)) * power_of<2>(log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 - yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 + w, (1.0 + w) / (1.0 - yd)) * power_of<2>(log(yd / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / 2.0, (1.0 + w) / (1.0 - yd)) * power_of<2>(log((1.0 + yd) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 - yd))) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - yd), (1.0 + w) / (1.0 - yd)) * power_of<2>(log((w - w * yd) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 - yd)))
-                + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - yd), (-1.0 + w) / (-1.0 + yd)) * power_of<2>(log(-((w * (-1.0 + yd)) / (-1.0 + w)))) * my_sign(imag((-1.0 + w) / (-1.0 + yd))) - (2.0 * 1.0i) * M_PI * H1(-(w / yd), -ydinv) * power_of<2>(log(((-1.0 + w) * yd) / w)) * my_sign(-imydinv) + power_of<2>(log(-w + yd)) * ((-4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), 1.0 / (1.0 - yd)) * my_sign(imag(1.0 / (1.0 - yd))) + (2.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * my_sign(-imydinv)) + power_of<2>(log(w + yd)) * ((-4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + w), 1.0 / (1.0 - yd)) * my_sign(imag(1.0 / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1(winv, -ydinv) * my_sign(-imydinv))
-                - (4.0 * 1.0i) * M_PI * H1(-winv, ydinv) * power_of<2>(log(-w - yd)) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(-ydinv, -(w / yd)) * power_of<2>(log((-1.0 + winv) * yd)) * my_sign(-imag(w / yd)) + power_of<2>(log((1.0 + yd) / w)) * ((-2.0 * 1.0i) * M_PI * H1(w / yd, -w) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * my_sign(-imag(w / yd))) - (6.0 * 1.0i) * M_PI * H1(-w, w / yd) * power_of<2>(log(-((1.0 + yd) / w))) * my_sign(imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + w), 2.0 / (1.0 + yd)) * power_of<2>(log((-w - yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 + yd)))
-                - (4.0 * 1.0i) * M_PI * H1((1.0 - w) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log(((1.0 + w) * (1.0 + yd)) / (2.0 - 2.0 * w))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / (w + yd)) * power_of<2>(log((1.0 - yd) / (-1.0 + w))) * my_sign(imag((-1.0 + w) / (w + yd))) + (4.0 * 1.0i) * M_PI * H1((1.0 + w) / (w + yd), (-1.0 + w) / (w + yd)) * power_of<2>(log((-2.0 * (w + yd)) / (-1.0 + power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w + yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + ydinv)) * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv)
-                - (4.0 * 1.0i) * M_PI * power_of<2>(log(-2.0 / (-1.0 + w))) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, 1.0 / (1.0 - w), -2.0 / (-1.0 + w)) - (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / (1.0 + w))) * my_sign(-imag(w / (1.0 + w))) * T(1.0, 1.0 / (1.0 - w), 1.0 / (1.0 + w)) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w / yd)) * my_sign(imag(w / yd)) * T(1.0, 1.0 + w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0 + w) / 2.0)) * my_sign((-0.5) * imag(w)) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w) / 2.0) + (4.0 * 1.0i) * M_PI * power_of<2>(log((w + yd) / (-1.0 + w))) * my_sign(imag((1.0 + yd) / (1.0 - w))) * T(1.0, (1.0 - yd) / 2.0, (w + yd) / (-1.0 + w))
-                - (8.0 * 1.0i) * M_PI * log((1.0 - w) / 2.0) * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + log((1.0 + yd) / 2.0) * (ln1pyd * (4.0 * log((w - yd) / (1.0 + w)) + 8.0 * log(1.0 - yd / w)) - (4.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * log((w + yd) / w) * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(log(w / (-1.0 + w))) * my_sign(imag(1.0 / (1.0 - w))) * T(1.0, (w - yd) / (-1.0 + w), w / (-1.0 + w)) - (8.0 * 1.0i) * M_PI * power_of<2>(log(-w)) * my_sign(-imag(w)) * T(1.0, yd, -w)
-                + power_of<2>(log((w - yd) / (-1.0 + w))) * (-2.0 * log((-1.0 + w) / (-1.0 + yd)) - 2.0 * log(yd / w) + 2.0 * log(((-1.0 + w) * yd) / (w * (-1.0 + yd))) - (4.0 * 1.0i) * M_PI * my_sign(imag((-1.0 + yd) / (-1.0 + w))) * T(1.0, yd, (w - yd) / (-1.0 + w))) - (12.0 * 1.0i) * M_PI * power_of<2>(log((1.0 - w) / 2.0)) * my_sign(imag(w) / 2.0) * T(1.0, (1.0 + yd) / 2.0, (1.0 - w) / 2.0) + ln1pyd * (log((1.0 - yd) / 2.0) * (8.0 * log((w + yd) / w) + 4.0 * log((w + yd) / (1.0 + w))) + (8.0 * 1.0i) * M_PI * log((1.0 + w) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w) / 2.0)
-                    + (8.0 * 1.0i) * M_PI * log((1.0 + w) / 2.0) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w) / 2.0)) + power_of<2>(log((w + yd) / (1.0 + w))) * (-4.0 * log(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) - 4.0 * log(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 - yd) / (1.0 + w))) * T(1.0, yd, (w + yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * my_sign(imag((1.0 - yd) / (1.0 + w))) * T(1.0, (1.0 + yd) / 2.0, (w + yd) / (1.0 + w))) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - w)) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * log(1.0 - w) * log((1.0 + w) / 2.0) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)
-                + (8.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + w)) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + power_of<2>(log((w + yd) / w)) * ((-4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w)) + power_of<2>(log(1.0 - yd / w)) * (-3.0 * log((1.0 + w) / (1.0 + yd)) + 3.0 * log((yd + w * yd) / (w + w * yd)) + (2.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(log(-2.0 / (-1.0 + w))) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, (1.0 + yd) / (1.0 - w), -2.0 / (-1.0 + w))
-                + log((w + yd) / w) * ((-2.0 * pisqu) / 3.0 + 4.0 * ln2squ - (8.0 * 1.0i) * M_PI * log(-2.0 / (-1.0 + w)) * my_sign(imag((-1.0 + w) / (w + yd))) * T(1.0, (1.0 + yd) / (1.0 - w), -2.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(log((1.0 - yd) / (1.0 + w))) * my_sign(imag((w + yd) / (1.0 + w))) * T(1.0, (1.0 + yd) / (1.0 - w), (1.0 - yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * log(1.0 + winv) * log(-2.0 / (-1.0 + w)) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
-                - (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * log(2.0 / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (8.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * log((1.0 - yd) / (1.0 + w)) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + log((1.0 + yd) / (1.0 - w)) * (2.0 * power_of<2>(log((w + yd) / w)) + 4.0 * power_of<2>(log((w + yd) / (1.0 + w))) + (4.0 * 1.0i) * M_PI * log((w + yd) / w) * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - (8.0 * 1.0i) * M_PI * power_of<2>(log((-1.0 + w) / (1.0 + w))) * my_sign(2.0 * imag(1.0 / (1.0 + w))) * T(1.0, (w + yd) / (1.0 + w), (-1.0 + w) / (1.0 + w))
-                + (4.0 * 1.0i) * M_PI * power_of<2>(log(w / (1.0 + w))) * my_sign(-imag(1.0 / (1.0 + w))) * T(1.0, (w + yd) / (1.0 + w), w / (1.0 + w)) + power_of<2>(log(yd)) * (-2.0 * log(w / (w + yd)) - 4.0 * log((w + yd) / w) + 4.0 * log((w + yd) / (w - w * yd)) + 2.0 * log((w - w * yd) / (w - yd)) + 2.0 * log((w - w * yd) / (w + yd)) - (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / (1.0 + w), yd))
-                + power_of<2>(log((1.0 + yd) / 2.0)) * (4.0 * log((-1.0 + w) / (w + yd)) - 4.0 * log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) + 6.0 * log((w + yd) / (-1.0 + w)) - 6.0 * log((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) + (8.0 * 1.0i) * M_PI * my_sign((-0.5) * imag(yd)) * T(1.0, (w + yd) / (1.0 + w), (1.0 + yd) / 2.0)) + power_of<2>(ln1pyd) * (-4.0 * log((w - yd) / (1.0 + w)) - log(((1.0 + w) * yd) / (-w + yd)) + 4.0 * log((-1.0 + w) / (w + yd)) + log((w + yd) / (-1.0 + w)) - log((w + yd) / (yd - w * yd)) - 4.0 * log((yd - w * yd) / (w + yd)) - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd)
-                    - (6.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + 16.0 * pisqu * log((-1.0 + w) / w) * T(1.0, (w + yd) / w, (-1.0 + w) / w) * T(p(winv, (w + yd) / w), (w + yd) / w, 1.0 + winv) + 8.0 * pisqu * log((-1.0 + w) / w) * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w));
+            const complex<double> part7 = + ln1myd * ((-1.0 / 3.0) * (pisqu * lnm1) - power_of<3>(lnm1) / 3.0 + lnm1 * ln2squ - 2.0 * power_of<2>(lnhalf) * ln_1 + 2.0 * lnhalf * power_of<2>(ln_2) + 2.0 * ln2 * power_of<2>(ln_2) - (2.0 * pisqu * ln_3) / 3.0 - (2.0 * power_of<3>(ln_3)) / 3.0 - power_of<2>(ln_1) * ln_115 + (2.0 * pisqu * ln_119) / 3.0 + (2.0 * power_of<3>(ln_119)) / 3.0 - (2.0 * pisqu * ln_11) / 3.0 - (2.0 * power_of<3>(ln_11)) / 3.0 + (pisqu * ln_120) / 3.0 + power_of<3>(ln_120) / 3.0 - (pisqu * ln_121) / 3.0 - power_of<3>(ln_121) / 3.0 + pisqu * ln_4
+                - 3.0 * power_of<2>(ln_3) * ln_4 + power_of<3>(ln_4) + (2.0 * pisqu * ln_122) / 3.0 + (2.0 * power_of<3>(ln_122)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_39 - 2.0 * power_of<2>(ln_2) * ln_39 - 2.0 * power_of<2>(lnhalf) * ln_5 - (2.0 * pisqu * ln_123) / 3.0 - (2.0 * power_of<3>(ln_123)) / 3.0 + (4.0 * pisqu * ln_7) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_7 - 4.0 * power_of<2>(ln_5) * ln_7 + (4.0 * power_of<3>(ln_7)) / 3.0 - (pisqu * ln_8) / 3.0 - 2.0 * power_of<2>(lnhalf) * ln_8 - power_of<3>(ln_8) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_124
+                + power_of<2>(ln_1) * ln_124 - 2.0 * power_of<2>(ln_2) * ln_124 + (pisqu * ln_108) / 3.0 + power_of<3>(ln_108) / 3.0 - (2.0 * pisqu * ln_61) / 3.0 - (2.0 * power_of<3>(ln_61)) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_40 - 2.0 * power_of<2>(ln_5) * ln_40 + ln2squ * ln_116 - ln2squ * ln_28 - (2.0 * pisqu * ln_125) / 3.0 - (2.0 * power_of<3>(ln_125)) / 3.0 - (2.0 * pisqu * ln_10) / 3.0
+                - 2.0 * power_of<2>(lnhalf) * ln_10 - (2.0 * power_of<3>(ln_10)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_117 - 2.0 * power_of<2>(ln_3) * ln_117 + 2.0 * power_of<2>(ln_5) * ln_117 - power_of<2>(ln_3) * ln_118 + 2.0 * power_of<2>(ln_5) * ln_118 + ln_27 * power_of<2>(ln_12) + 2.0 * ln_11 * power_of<2>(ln_12) - ln_39 * power_of<2>(ln_12) - (2.0 * pisqu * ln_126) / 3.0 - (2.0 * power_of<3>(ln_126)) / 3.0 + 2.0 * power_of<2>(lnhalf) * ln_41
+                + power_of<2>(ln_3) * ln_41 - 2.0 * power_of<2>(ln_5) * ln_41 + (2.0 * pisqu * ln_127) / 3.0 + (2.0 * power_of<3>(ln_127)) / 3.0 + (pisqu * ln_34) / 3.0 + power_of<3>(ln_34) / 3.0 - (2.0 * power_of<3>(ln_71)) / 3.0 + (4.0 * pisqu * ln_74) / 3.0 + (4.0 * power_of<3>(ln_74)) / 3.0 - (2.0 * pisqu * log((-1.0 + w) / (w * (-1.0 + yd)))) / 3.0 - (2.0 * power_of<3>(log((-1.0 + w) / (w * (-1.0 + yd))))) / 3.0 + 2.0 * pisqu * log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))) + 2.0 * power_of<3>(log((-2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))))
+                + (4.0 * pisqu * log((2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd)))) / 3.0 + (4.0 * power_of<3>(log((2.0 * (1.0 + w)) / ((-1.0 + w) * (-1.0 + yd))))) / 3.0 + (2.0 * pisqu * log((1.0 + w) / (w * (-1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((1.0 + w) / (w * (-1.0 + yd))))) / 3.0 + (4.0 * power_of<3>(ln_68)) / 3.0 - (2.0 * pisqu * ln_55) / 3.0 - (2.0 * power_of<3>(ln_55)) / 3.0 - power_of<3>(ln_31) - power_of<3>(ln_32) + (2.0 * pisqu * ln_33) / 3.0 + (2.0 * power_of<3>(ln_33)) / 3.0 - (2.0 * pisqu * log(-((1.0 + w) / yd))) / 3.0 - (2.0 * power_of<3>(log(-((1.0 + w) / yd)))) / 3.0 - 2.0 * ln_15 * power_of<2>(ln_38) + (2.0 * pisqu * ln_21) / 3.0
+                + (2.0 * power_of<3>(ln_21)) / 3.0 + pisqu * ln_62 + power_of<3>(ln_62) + (2.0 * pisqu * log((2.0 * (-1.0 + w)) / ((1.0 + w) * (1.0 + yd)))) / 3.0 + (2.0 * power_of<3>(log((2.0 * (-1.0 + w)) / ((1.0 + w) * (1.0 + yd))))) / 3.0 - (4.0 * pisqu * log(-((1.0 + w) / (1.0 + yd)))) / 3.0 - (4.0 * power_of<3>(log(-((1.0 + w) / (1.0 + yd))))) / 3.0 + log((1.0 + w) / (w - yd)) * power_of<2>(ln1pyd) + ln_54 * ((-2.0 * pisqu) / 3.0 - 4.0 * power_of<2>(ln1pyd)) + ln_68 * ((4.0 * pisqu) / 3.0 - 4.0 * power_of<2>(ln1pyd)) + ln_71 * ((-2.0 * pisqu) / 3.0 + 2.0 * power_of<2>(ln_24) - 2.0 * power_of<2>(ln_42))
+                - power_of<2>(ln_12) * ln_45 + power_of<2>(ln_12) * ln_46 + (pisqu * ln_48) / 3.0 + power_of<3>(ln_48) / 3.0 - power_of<2>(ln_1) * ln_102 - (4.0 * pisqu * log(-2.0 / (w + yd))) / 3.0 - (4.0 * power_of<3>(log(-2.0 / (w + yd)))) / 3.0 - (2.0 * pisqu * ln_49) / 3.0 - (2.0 * power_of<3>(ln_49)) / 3.0 + (2.0 * pisqu * ln_50) / 3.0 + (2.0 * power_of<3>(ln_50)) / 3.0 - (2.0 * pisqu * log(2.0 / (w + yd))) / 3.0 - (2.0 * power_of<3>(log(2.0 / (w + yd)))) / 3.0 - (2.0 * pisqu * log((-1.0 + power_of<2>(w)) / (2.0 * (w + yd)))) / 3.0
+                - (2.0 * power_of<3>(log((-1.0 + power_of<2>(w)) / (2.0 * (w + yd))))) / 3.0 + ln_64 * power_of<2>(ln_60) - 2.0 * ln_47 * power_of<2>(ln_60) + ln_14 * (-2.0 * power_of<2>(ln_42) - 4.0 * ln_42 * ln_60) + (2.0 * pisqu * ln_66) / 3.0 - 2.0 * ln_18 * power_of<2>(ln_66) + 2.0 * ln_65 * power_of<2>(ln_66) - 2.0 * ln_100 * power_of<2>(ln_66)
+                + ln_31 * (-pisqu + 3.0 * power_of<2>(ln_60) + 2.0 * power_of<2>(ln_66)) + ln_37 * (-power_of<2>(ln_60) + 4.0 * power_of<2>(ln_66)) + power_of<2>(ln_42) * (2.0 * log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) + 2.0 * log((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd)))) + power_of<2>(ln_14) * (2.0 * ln_52 - 2.0 * log(((1.0 + w) * (1.0 + yd)) / (2.0 * (w + yd))) + 2.0 * ln_66 - 2.0 * log((2.0 * (w + yd)) / ((1.0 + w) * (1.0 + yd)))) + (pisqu / 3.0 - 2.0 * ln2squ) * ln_67
+                + 2.0 * ln_72 * power_of<2>(ln_67) + ln_32 * (-pisqu + 3.0 * power_of<2>(ln_67)) - (4.0 * pisqu * ln_104) / 3.0 - (4.0 * power_of<3>(ln_104)) / 3.0 + (pisqu * ln_80) / 3.0 + power_of<3>(ln_80) / 3.0 + power_of<2>(ln_1) * ln_82 - (2.0 * 1.0i) * M_PI * H1(-ydinv, -winv) * power_of<2>(ln_96) * my_sign(-imag(winv)) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / w) * power_of<2>(ln_9) * my_sign(imag(winv))
+                + (4.0 * 1.0i) * M_PI * H1(1.0 + winv, (-1.0 + w) / w) * power_of<2>(log((-2.0 * w) / (-1.0 + power_of<2>(w)))) * my_sign(imag(winv)) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 - yd), 1.0 / (1.0 - yd)) * power_of<2>(ln_16) * my_sign(imag(1.0 / (1.0 - yd))) - (12.0 * 1.0i) * M_PI * H1((1.0 + w) / (1.0 - yd), -2.0 / (-1.0 + yd)) * power_of<2>(log(((-1.0 + w) * (-1.0 + yd)) / (2.0 * (1.0 + w)))) * my_sign(2.0 * imag(1.0 / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1(2.0 / (1.0 + w), -2.0 / (-1.0 + yd)) * power_of<2>(log((w + yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 - yd)))
+                - (8.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + yd), (1.0 + w) / (1.0 - yd)) * power_of<2>(log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (1.0 + w)))) * my_sign(imag((1.0 + w) / (1.0 - yd))) + (4.0 * 1.0i) * M_PI * H1(1.0 + w, (1.0 + w) / (1.0 - yd)) * power_of<2>(log(yd / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1((1.0 + w) / 2.0, (1.0 + w) / (1.0 - yd)) * power_of<2>(ln_83) * my_sign(imag((1.0 + w) / (1.0 - yd))) - (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - yd), (1.0 + w) / (1.0 - yd)) * power_of<2>(log((w - w * yd) / (1.0 + w))) * my_sign(imag((1.0 + w) / (1.0 - yd)))
+                + (4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - yd), (-1.0 + w) / (-1.0 + yd)) * power_of<2>(log(-((w * (-1.0 + yd)) / (-1.0 + w)))) * my_sign(imag((-1.0 + w) / (-1.0 + yd))) - (2.0 * 1.0i) * M_PI * H1(-(w / yd), -ydinv) * power_of<2>(ln_90) * my_sign(-imydinv) + power_of<2>(ln_91) * ((-4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 - w), 1.0 / (1.0 - yd)) * my_sign(imag(1.0 / (1.0 - yd))) + (2.0 * 1.0i) * M_PI * H1(-winv, -ydinv) * my_sign(-imydinv)) + power_of<2>(ln_93) * ((-4.0 * 1.0i) * M_PI * H1(1.0 / (1.0 + w), 1.0 / (1.0 - yd)) * my_sign(imag(1.0 / (1.0 - yd))) + (8.0 * 1.0i) * M_PI * H1(winv, -ydinv) * my_sign(-imydinv))
+                - (4.0 * 1.0i) * M_PI * H1(-winv, ydinv) * power_of<2>(ln_94) * my_sign(imydinv) - (4.0 * 1.0i) * M_PI * H1(-ydinv, -(w / yd)) * power_of<2>(ln_95) * my_sign(-imag(w / yd)) + power_of<2>(log((1.0 + yd) / w)) * ((-2.0 * 1.0i) * M_PI * H1(w / yd, -w) * my_sign(-imag(w)) - (2.0 * 1.0i) * M_PI * H1(w, -(w / yd)) * my_sign(-imag(w / yd))) - (6.0 * 1.0i) * M_PI * H1(-w, w / yd) * power_of<2>(ln_101) * my_sign(imag(w / yd)) + (4.0 * 1.0i) * M_PI * H1(-2.0 / (-1.0 + w), 2.0 / (1.0 + yd)) * power_of<2>(log((-w - yd) / 2.0)) * my_sign(2.0 * imag(1.0 / (1.0 + yd)))
+                - (4.0 * 1.0i) * M_PI * H1((1.0 - w) / (1.0 + yd), 2.0 / (1.0 + yd)) * power_of<2>(log(((1.0 + w) * (1.0 + yd)) / (2.0 - 2.0 * w))) * my_sign(2.0 * imag(1.0 / (1.0 + yd))) - (4.0 * 1.0i) * M_PI * H1((-1.0 + w) / (1.0 + w), (-1.0 + w) / (w + yd)) * power_of<2>(log((1.0 - yd) / (-1.0 + w))) * my_sign(imag((-1.0 + w) / (w + yd))) + (4.0 * 1.0i) * M_PI * H1((1.0 + w) / (w + yd), (-1.0 + w) / (w + yd)) * power_of<2>(log((-2.0 * (w + yd)) / (-1.0 + power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w + yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_110) * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv)
+                - (4.0 * 1.0i) * M_PI * power_of<2>(ln_115) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, 1.0 / (1.0 - w), -2.0 / (-1.0 + w)) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_61) * my_sign(-imag(w / (1.0 + w))) * T(1.0, 1.0 / (1.0 - w), 1.0 / (1.0 + w)) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_106) * my_sign(imag(w / yd)) * T(1.0, 1.0 + w, 1.0 - w / yd) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_118) * my_sign((-0.5) * imag(w)) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w) / 2.0) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_58) * my_sign(imag((1.0 + yd) / (1.0 - w))) * T(1.0, (1.0 - yd) / 2.0, (w + yd) / (-1.0 + w))
+                - (8.0 * 1.0i) * M_PI * ln_27 * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + ln_24 * (ln1pyd * (4.0 * ln_35 + 8.0 * ln_67) - (4.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(w)) * T(1.0, 1.0 - yd, 1.0 + w) + (4.0 * 1.0i) * M_PI * ln_60 * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_8) * my_sign(imag(1.0 / (1.0 - w))) * T(1.0, (w - yd) / (-1.0 + w), w / (-1.0 + w)) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_6) * my_sign(-imag(w)) * T(1.0, yd, -w)
+                + power_of<2>(ln_54) * (-2.0 * ln_74 - 2.0 * ln_72 + 2.0 * ln_73 - (4.0 * 1.0i) * M_PI * my_sign(imag((-1.0 + yd) / (-1.0 + w))) * T(1.0, yd, (w - yd) / (-1.0 + w))) - (12.0 * 1.0i) * M_PI * power_of<2>(ln_27) * my_sign(imag(w) / 2.0) * T(1.0, (1.0 + yd) / 2.0, (1.0 - w) / 2.0) + ln1pyd * (ln_14 * (8.0 * ln_60 + 4.0 * ln_66) + (8.0 * 1.0i) * M_PI * ln_118 * my_sign(2.0 * imag(1.0 / (1.0 + yd))) * T(1.0, (1.0 - yd) / 2.0, (1.0 + w) / 2.0)
+                    + (8.0 * 1.0i) * M_PI * ln_118 * my_sign(2.0 * imag(1.0 / (1.0 - yd))) * T(1.0, (1.0 + yd) / 2.0, (1.0 + w) / 2.0)) + power_of<2>(ln_66) * (-4.0 * log(((-1.0 + w) * (-1.0 + yd)) / ((1.0 + w) * (1.0 + yd))) - 4.0 * log(((1.0 + w) * (1.0 + yd)) / ((-1.0 + w) * (-1.0 + yd))) - (4.0 * 1.0i) * M_PI * my_sign(imag((1.0 - yd) / (1.0 + w))) * T(1.0, yd, (w + yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * my_sign(imag((1.0 - yd) / (1.0 + w))) * T(1.0, (1.0 + yd) / 2.0, (w + yd) / (1.0 + w))) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) - (8.0 * 1.0i) * M_PI * ln_3 * ln_118 * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w)
+                + (8.0 * 1.0i) * M_PI * power_of<2>(ln_12) * my_sign(-imag(w)) * T(1.0, 1.0 + yd, 1.0 + w) + power_of<2>(ln_60) * ((-4.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w) + (8.0 * 1.0i) * M_PI * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w)) + power_of<2>(ln_67) * (-3.0 * log((1.0 + w) / (1.0 + yd)) + 3.0 * ln_103 + (2.0 * 1.0i) * M_PI * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w)) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_115) * my_sign(imag((1.0 + w) / (-1.0 + w))) * T(1.0, (1.0 + yd) / (1.0 - w), -2.0 / (-1.0 + w))
+                + ln_60 * ((-2.0 * pisqu) / 3.0 + 4.0 * ln2squ - (8.0 * 1.0i) * M_PI * ln_115 * my_sign(imag((-1.0 + w) / (w + yd))) * T(1.0, (1.0 + yd) / (1.0 - w), -2.0 / (-1.0 + w))) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_77) * my_sign(imag((w + yd) / (1.0 + w))) * T(1.0, (1.0 + yd) / (1.0 - w), (1.0 - yd) / (1.0 + w)) + (8.0 * 1.0i) * M_PI * ln_1 * ln_115 * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (4.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w)
+                - (8.0 * 1.0i) * M_PI * ln_5 * ln_40 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + (8.0 * 1.0i) * M_PI * ln_5 * ln_77 * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) + ln_42 * (2.0 * power_of<2>(ln_60) + 4.0 * power_of<2>(ln_66) + (4.0 * 1.0i) * M_PI * ln_60 * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - (8.0 * 1.0i) * M_PI * power_of<2>(ln_28) * my_sign(2.0 * imag(1.0 / (1.0 + w))) * T(1.0, (w + yd) / (1.0 + w), (-1.0 + w) / (1.0 + w))
+                + (4.0 * 1.0i) * M_PI * power_of<2>(ln_10) * my_sign(-imag(1.0 / (1.0 + w))) * T(1.0, (w + yd) / (1.0 + w), w / (1.0 + w)) + power_of<2>(ln_38) * (-2.0 * ln_51 - 4.0 * ln_60 + 4.0 * ln_76 + 2.0 * ln_78 + 2.0 * ln_79 - (4.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / (1.0 + w), yd))
+                + power_of<2>(ln_24) * (4.0 * ln_63 - 4.0 * log((-0.5) * (((-1.0 + w) * (-1.0 + yd)) / (w + yd))) + 6.0 * ln_58 - 6.0 * log((-2.0 * (w + yd)) / ((-1.0 + w) * (-1.0 + yd))) + (8.0 * 1.0i) * M_PI * my_sign((-0.5) * imag(yd)) * T(1.0, (w + yd) / (1.0 + w), (1.0 + yd) / 2.0)) + power_of<2>(ln1pyd) * (-4.0 * ln_35 - ln_59 + 4.0 * ln_63 + ln_58 - ln_81 - 4.0 * ln_113 - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, (w + yd) / w, 1.0 + yd)
+                    - (6.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) + 16.0 * pisqu * ln_5 * T(1.0, (w + yd) / w, (-1.0 + w) / w) * T(p(winv, (w + yd) / w), (w + yd) / w, 1.0 + winv) + 8.0 * pisqu * ln_5 * T(1.0, (w + yd) / w, 1.0 - yd) * T(p(yd, (w + yd) / w), (w + yd) / w, (-1.0 + w) / w));
 
             const complex<double> part8 = - 4.0 * pisqu * ln2squ * T(1.0, 1.0 - yd, (w + yd) / w) * T(p(-(yd / w), 1.0 - yd), 1.0 - yd, 2.0)
-                + power_of<2>(log((w + yd) / w)) * ((-log(1.0 - w) + 2.0 * log((-1.0 + w) / w)) * log((1.0 + w) / (1.0 - yd)) + (-2.0 * ln2 - log(1.0 - w)) * log((1.0 - yd) / (1.0 + w)) + (log(1.0 - w) - 2.0 * log((-1.0 + w) / w)) * log(((1.0 + w) * yd) / (w * (-1.0 + yd))) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(-imag(yd / w)) * T(1.0, 1.0 + winv, (w + yd) / w) - (4.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, (-1.0 + w) / w, (w + yd) / w) - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(yd / w)) * T(1.0, (-1.0 + w) / w, (w + yd) / w) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)
-                + (4.0 * 1.0i) * M_PI * log(winv) * my_sign(imag(w / (w + yd))) * T(1.0, -(yd / w), winv) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w) - (2.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w) - 4.0 * pisqu * T(1.0, 1.0 - yd, (w + yd) / w) * T(p(-(yd / w), 1.0 - yd), 1.0 - yd, 2.0)) - 4.0 * pisqu * ln2squ * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0)
-                + power_of<2>(log(1.0 - yd / w)) * ((-log(1.0 - w) + 2.0 * log((-1.0 + w) / w)) * log((1.0 + w) / (1.0 + yd)) + (-2.0 * ln2 - log(1.0 - w)) * log((1.0 + yd) / (1.0 + w)) + (2.0 * ln2 + log(1.0 - w)) * log((w + w * yd) / (yd + w * yd)) + (log(1.0 - w) - 2.0 * log((-1.0 + w) / w)) * log((yd + w * yd) / (w + w * yd)) - (4.0 * 1.0i) * M_PI * log((-1.0 + w) / w) * my_sign(imag(yd / w)) * T(1.0, 1.0 + winv, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, (-1.0 + w) / w, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(imag(yd / w)) * T(1.0, (-1.0 + w) / w, 1.0 - yd / w)
-                - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) - (2.0 * 1.0i) * M_PI * log(1.0 + w) * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) + (4.0 * 1.0i) * M_PI * log(winv) * my_sign(imag(w / (w - yd))) * T(1.0, yd / w, winv) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w) - 4.0 * pisqu * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0))
-                + log(1.0 / (1.0 - yd)) * (pisqu * log(1.0 + winv) - (pisqu * log(1.0 - w)) / 3.0 + (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 - 2.0 * log(1.0 - w) * power_of<2>(log(w)) - (pisqu * log(1.0 + w)) / 3.0 - (2.0 * pisqu * log((w + yd) / w)) / 3.0 - (pisqu * log(1.0 - yd / w)) / 3.0 - 2.0 * power_of<2>(log(yd / w)) * log(1.0 - yd / w) + (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * power_of<2>(log((w + yd) / (-1.0 + yd))) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(log(((1.0 + w) * yd) / (w * (-1.0 + yd)))) * my_sign(-imag(w / yd)) - 12.0 * zeta3)
-                + log(1.0 / (1.0 + yd)) * (pisqu * log(1.0 + winv) - (pisqu * log(1.0 - w)) / 3.0 + (2.0 * pisqu * log((-1.0 + w) / w)) / 3.0 - 2.0 * log(1.0 - w) * power_of<2>(log(w)) - (pisqu * log(1.0 + w)) / 3.0 - (pisqu * log((w + yd) / w)) / 3.0 - 2.0 * power_of<2>(log(-(yd / w))) * log((w + yd) / w) - (2.0 * pisqu * log(1.0 - yd / w)) / 3.0 + (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * power_of<2>(log((-w + yd) / (1.0 + yd))) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(log((yd + w * yd) / (w + w * yd))) * my_sign(imag(w / yd)) - 12.0 * zeta3)
-                + log((w * (1.0 + yd)) / (w + yd)) * ((-2.0 * pisqu * log(1.0 - w)) / 3.0 - lnhalf * power_of<2>(log(1.0 - w)) - (2.0 * power_of<3>(log(1.0 - w))) / 3.0 - 2.0 * ln2 * power_of<2>(log((-1.0 + w) / w)) - 2.0 * log(1.0 + winv) * power_of<2>(log((-1.0 + w) / w)) - power_of<2>(log(1.0 - w)) * log(w / (1.0 + w)) - 4.0 * zeta3) + log((w - w * yd) / (w - yd)) * ((-2.0 * pisqu * log(1.0 - w)) / 3.0 - lnhalf * power_of<2>(log(1.0 - w)) - (2.0 * power_of<3>(log(1.0 - w))) / 3.0 - 2.0 * ln2 * power_of<2>(log((-1.0 + w) / w)) - 2.0 * log(1.0 + winv) * power_of<2>(log((-1.0 + w) / w)) - power_of<2>(log(1.0 - w)) * log(w / (1.0 + w)) - 4.0 * zeta3)
-                + log((w - yd) / (-1.0 + w)) * (6.0 * power_of<2>(log((1.0 - yd) / 2.0)) * ln1pyd + 8.0 * log((1.0 - yd) / 2.0) * power_of<2>(ln1pyd) + 2.0 * log(1.0 - w) * power_of<2>(log((w - w * yd) / (w - yd))) - 4.0 * zeta3) + log((1.0 + yd) / (1.0 - w)) * ((-2.0 * power_of<3>(log((w + yd) / w))) / 3.0 - 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w + yd) / (w + w * yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + log((w + yd) / w) * ((-2.0 * pisqu) / 3.0 + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv))
-                + power_of<2>(log((w + yd) / w)) * (-log(1.0 / (1.0 + w)) - (2.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - 4.0 * zeta3) + log((-1.0 + yd) / (-1.0 + w)) * (-(log(yd / (1.0 + yd)) * power_of<2>(log(1.0 - yd / w))) - (2.0 * power_of<3>(log(1.0 - yd / w))) / 3.0 - 4.0 * log((-1.0 + w) / w) * power_of<2>(log((w - yd) / (w - w * yd))) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + winv)) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + log(1.0 - yd / w) * ((-2.0 * pisqu) / 3.0 + (4.0 * 1.0i) * M_PI * log(1.0 + winv) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))
-                + power_of<2>(log(1.0 - yd / w)) * (-log(1.0 / (1.0 + w)) - (2.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) - 4.0 * zeta3) + 8.0 * log(1.0 / (1.0 - w)) * zeta3 + 8.0 * log(w / (-1.0 + w)) * zeta3 - 4.0 * log((w + yd) / (-1.0 + w)) * zeta3 - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) * zeta3 - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) * zeta3
+                + power_of<2>(ln_60) * ((-ln_3 + 2.0 * ln_5) * log((1.0 + w) / (1.0 - yd)) + (-2.0 * ln2 - ln_3) * ln_77 + (ln_3 - 2.0 * ln_5) * ln_100 - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(-imag(yd / w)) * T(1.0, 1.0 + winv, (w + yd) / w) - (4.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, (-1.0 + w) / w, (w + yd) / w) - (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(yd / w)) * T(1.0, (-1.0 + w) / w, (w + yd) / w) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, 1.0 - yd, (w + yd) / w)
+                + (4.0 * 1.0i) * M_PI * ln_4 * my_sign(imag(w / (w + yd))) * T(1.0, -(yd / w), winv) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w) - (2.0 * 1.0i) * M_PI * ln_12 * my_sign(-imag(yd / w)) * T(1.0, 1.0 + yd, (w + yd) / w) - 4.0 * pisqu * T(1.0, 1.0 - yd, (w + yd) / w) * T(p(-(yd / w), 1.0 - yd), 1.0 - yd, 2.0)) - 4.0 * pisqu * ln2squ * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0)
+                + power_of<2>(ln_67) * ((-ln_3 + 2.0 * ln_5) * log((1.0 + w) / (1.0 + yd)) + (-2.0 * ln2 - ln_3) * ln_83 + (2.0 * ln2 + ln_3) * ln_85 + (ln_3 - 2.0 * ln_5) * ln_103 - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(imag(yd / w)) * T(1.0, 1.0 + winv, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, (-1.0 + w) / w, 1.0 - yd / w) - (4.0 * 1.0i) * M_PI * ln_1 * my_sign(imag(yd / w)) * T(1.0, (-1.0 + w) / w, 1.0 - yd / w)
+                - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) - (2.0 * 1.0i) * M_PI * ln_12 * my_sign(imag(yd / w)) * T(1.0, 1.0 - yd, 1.0 - yd / w) + (4.0 * 1.0i) * M_PI * ln_4 * my_sign(imag(w / (w - yd))) * T(1.0, yd / w, winv) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(yd / w)) * T(1.0, 1.0 + yd, 1.0 - yd / w) - 4.0 * pisqu * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0))
+                + ln_13 * (pisqu * ln_1 - (pisqu * ln_3) / 3.0 + (2.0 * pisqu * ln_5) / 3.0 - 2.0 * ln_3 * power_of<2>(ln_7) - (pisqu * ln_12) / 3.0 - (2.0 * pisqu * ln_60) / 3.0 - (pisqu * ln_67) / 3.0 - 2.0 * power_of<2>(ln_72) * ln_67 + (2.0 * 1.0i) * M_PI * H2(-winv, ydinv) * power_of<2>(ln_99) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(-(w / yd), ydinv) * power_of<2>(ln_100) * my_sign(-imag(w / yd)) - 12.0 * zeta3)
+                + ln_20 * (pisqu * ln_1 - (pisqu * ln_3) / 3.0 + (2.0 * pisqu * ln_5) / 3.0 - 2.0 * ln_3 * power_of<2>(ln_7) - (pisqu * ln_12) / 3.0 - (pisqu * ln_60) / 3.0 - 2.0 * power_of<2>(ln_65) * ln_60 - (2.0 * pisqu * ln_67) / 3.0 + (2.0 * 1.0i) * M_PI * H2(-winv, -ydinv) * power_of<2>(ln_102) * my_sign(-imag(winv)) - (2.0 * 1.0i) * M_PI * H2(w / yd, -ydinv) * power_of<2>(ln_103) * my_sign(imag(w / yd)) - 12.0 * zeta3)
+                + ln_57 * ((-2.0 * pisqu * ln_3) / 3.0 - lnhalf * power_of<2>(ln_3) - (2.0 * power_of<3>(ln_3)) / 3.0 - 2.0 * ln2 * power_of<2>(ln_5) - 2.0 * ln_1 * power_of<2>(ln_5) - power_of<2>(ln_3) * ln_10 - 4.0 * zeta3) + ln_78 * ((-2.0 * pisqu * ln_3) / 3.0 - lnhalf * power_of<2>(ln_3) - (2.0 * power_of<3>(ln_3)) / 3.0 - 2.0 * ln2 * power_of<2>(ln_5) - 2.0 * ln_1 * power_of<2>(ln_5) - power_of<2>(ln_3) * ln_10 - 4.0 * zeta3)
+                + ln_54 * (6.0 * power_of<2>(ln_14) * ln1pyd + 8.0 * ln_14 * power_of<2>(ln1pyd) + 2.0 * ln_3 * power_of<2>(ln_78) - 4.0 * zeta3) + ln_42 * ((-2.0 * power_of<3>(ln_60)) / 3.0 - 4.0 * ln_5 * power_of<2>(ln_84) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_1) * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) + ln_60 * ((-2.0 * pisqu) / 3.0 + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv))
+                + power_of<2>(ln_60) * (-ln_61 - (2.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, (w + yd) / w, 1.0 + winv) - (2.0 * 1.0i) * M_PI * my_sign(imag(yd)) * T(1.0, (w + yd) / w, 1.0 - yd)) - 4.0 * zeta3) + ln_26 * (-(ln_25 * power_of<2>(ln_67)) - (2.0 * power_of<3>(ln_67)) / 3.0 - 4.0 * ln_5 * power_of<2>(ln_75) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_1) * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) + ln_67 * ((-2.0 * pisqu) / 3.0 + (4.0 * 1.0i) * M_PI * ln_1 * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv))
+                + power_of<2>(ln_67) * (-ln_61 - (2.0 * 1.0i) * M_PI * my_sign(-imag(winv)) * T(1.0, 1.0 - yd / w, 1.0 + winv) - (2.0 * 1.0i) * M_PI * my_sign(-imag(yd)) * T(1.0, 1.0 - yd / w, 1.0 + yd)) - 4.0 * zeta3) + 8.0 * ln_2 * zeta3 + 8.0 * ln_8 * zeta3 - 4.0 * ln_58 * zeta3 - (8.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, 1.0 + winv, 1.0 + ydinv) * zeta3 - (8.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, 1.0 + winv, (-1.0 + yd) / yd) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(w / yd)) * T(1.0, 1.0 - w, 1.0 - w / yd) * zeta3
                 + (8.0 * 1.0i) * M_PI * my_sign(-imag(w / yd)) * T(1.0, 1.0 - w, (w + yd) / yd) * zeta3 - (16.0 * 1.0i) * M_PI * my_sign(-imydinv) * T(1.0, (-1.0 + w) / w, 1.0 + ydinv) * zeta3 - (16.0 * 1.0i) * M_PI * my_sign(imydinv) * T(1.0, (-1.0 + w) / w, (-1.0 + yd) / yd) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 - yd, 1.0 - w) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(w)) * T(1.0, 1.0 + yd, 1.0 - w) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, (w + yd) / w, (-1.0 + w) / w) * zeta3 + (8.0 * 1.0i) * M_PI * my_sign(imag(winv)) * T(1.0, 1.0 - yd / w, (-1.0 + w) / w) * zeta3
-                + log((w + yd) / (w - w * yd)) * ((2.0 * pisqu * log(1.0 + winv)) / 3.0 + 2.0 * lnhalf * power_of<2>(log(1.0 + winv)) + (2.0 * power_of<3>(log(1.0 + winv))) / 3.0 + 4.0 * zeta3) + log((w - yd) / (w + w * yd)) * ((2.0 * pisqu * log(1.0 + winv)) / 3.0 + 2.0 * lnhalf * power_of<2>(log(1.0 + winv)) + (2.0 * power_of<3>(log(1.0 + winv))) / 3.0 + 4.0 * zeta3)
-                + log(w / (w - yd)) * (2.0 * log(1.0 + winv) * power_of<2>(log(-winv)) + 4.0 * power_of<2>(log(winv)) * log((-1.0 + w) / w) - 2.0 * power_of<2>(log(-yd)) * ln1pyd - (2.0 * pisqu * log(1.0 - yd / w)) / 3.0 + 2.0 * power_of<2>(log(yd / w)) * log(1.0 - yd / w) + (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * power_of<2>(log(-((1.0 + yd) / (w - yd)))) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * power_of<2>(log(((1.0 + w) * yd) / (-w + yd))) * my_sign(-imydinv) + 4.0 * zeta3)
-                + log(w / (w + yd)) * (2.0 * log(1.0 + winv) * power_of<2>(log(-winv)) + 4.0 * power_of<2>(log(winv)) * log((-1.0 + w) / w) - (2.0 * pisqu * log((w + yd) / w)) / 3.0 + 2.0 * power_of<2>(log(-(yd / w))) * log((w + yd) / w) + (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * power_of<2>(log((-1.0 + yd) / (w + yd))) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * power_of<2>(log(((1.0 + w) * yd) / (w + yd))) * my_sign(imydinv) + 4.0 * zeta3)
-                + log((w - yd) / (w - w * yd)) * (ln2 * power_of<2>(log(1.0 - w)) + (4.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + 2.0 * lnhalf * power_of<2>(log((-1.0 + w) / w)) + (4.0 * power_of<3>(log((-1.0 + w) / w))) / 3.0 + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(1.0 / (1.0 + w)) + power_of<2>(log(1.0 - w)) * log(1.0 + w) + 8.0 * zeta3) + log((w + yd) / (w + w * yd)) * (ln2 * power_of<2>(log(1.0 - w)) + (4.0 * pisqu * log((-1.0 + w) / w)) / 3.0 + 2.0 * lnhalf * power_of<2>(log((-1.0 + w) / w)) + (4.0 * power_of<3>(log((-1.0 + w) / w))) / 3.0 + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(1.0 / (1.0 + w)) + power_of<2>(log(1.0 - w)) * log(1.0 + w) + 8.0 * zeta3)
-                + log((w + yd) / w) * ((4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - (pisqu * ln2) / 3.0 - 4.0 * lnm1 * ln2squ + 2.0 * power_of<3>(ln2) - (pisqu * ln4) / 3.0 + 2.0 * power_of<2>(log(1.0 + winv)) * log((1.0 - w) / 2.0) + 2.0 * power_of<2>(log(1.0 + winv)) * log(-2.0 / (-1.0 + w)) - 2.0 * power_of<2>(log(1.0 + winv)) * log(-winv) + (pisqu * log(1.0 / (2.0 * w))) / 3.0 + power_of<3>(log(1.0 / (2.0 * w))) / 3.0 - (2.0 * pisqu * log(winv)) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(winv) - (2.0 * power_of<3>(log(winv))) / 3.0 - 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / (2.0 * w)) - 4.0 * log(winv) * power_of<2>(log((-1.0 + w) / w))
-                - (2.0 * pisqu * log((-0.5) * w)) / 3.0 - (2.0 * power_of<3>(log((-0.5) * w))) / 3.0 - (2.0 * pisqu * log(w)) / 3.0 + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(w) - (2.0 * power_of<3>(log(w))) / 3.0 + (2.0 * pisqu * log(w / (-1.0 + w))) / 3.0 + (2.0 * power_of<3>(log(w / (-1.0 + w)))) / 3.0 - 2.0 * power_of<2>(log(1.0 + winv)) * log((2.0 * w) / (-1.0 + w)) + (pisqu * log(1.0 / (1.0 + w))) / 3.0 + power_of<3>(log(1.0 / (1.0 + w))) / 3.0 - power_of<2>(log(1.0 - w)) * log(2.0 / (1.0 + w)) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(2.0 / (1.0 + w)) + 2.0 * ln2squ * log((1.0 - w) / (1.0 + w)) - 2.0 * ln2squ * log((-1.0 + w) / (1.0 + w)) - (2.0 * pisqu * log(-(w / (1.0 + w)))) / 3.0
-                - (2.0 * power_of<3>(log(-(w / (1.0 + w))))) / 3.0 + (2.0 * pisqu * log(w / (1.0 + w))) / 3.0 + (2.0 * power_of<3>(log(w / (1.0 + w)))) / 3.0 + power_of<2>(log(1.0 - w)) * log((2.0 * w) / (1.0 + w)) - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((2.0 * w) / (1.0 + w)) + power_of<2>(log(1.0 - w)) * log((1.0 + w) / 2.0) - power_of<2>(log(1.0 - w)) * log((1.0 + w) / (2.0 * w)) - (2.0 * pisqu * log(-1.0 / (1.0 + yd))) / 3.0 - (2.0 * power_of<3>(log(-1.0 / (1.0 + yd)))) / 3.0 - (2.0 * pisqu * log(((-1.0 + w) * w) / (w + yd))) / 3.0 - (2.0 * power_of<3>(log(((-1.0 + w) * w) / (w + yd)))) / 3.0 + (4.0 * 1.0i) * M_PI * H1(w / (w + yd), (-1.0 + w) / (w + yd)) * power_of<2>(log((w + yd) / (w - power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w + yd)))
-                - (4.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), w / (w + yd)) * power_of<2>(log(-((1.0 + yd) / w))) * my_sign(imag(w / (w + yd))) + (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / (1.0 - w))) * my_sign(-imag(w / (1.0 - w))) * T(1.0, (1.0 + yd) / (1.0 - w), 1.0 / (1.0 - w)) + 8.0 * pisqu * ln2 * T(1.0, 1.0 - yd, (w + yd) / w) * T(p(-(yd / w), 1.0 - yd), 1.0 - yd, 2.0) + (21.0 * zeta3) / 2.0)
-                + log(1.0 - yd / w) * ((4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - (pisqu * ln2) / 3.0 - 4.0 * lnm1 * ln2squ + 2.0 * power_of<3>(ln2) - (pisqu * ln4) / 3.0 + 2.0 * power_of<2>(log(1.0 + winv)) * log((1.0 - w) / 2.0) + 2.0 * power_of<2>(log(1.0 + winv)) * log(-2.0 / (-1.0 + w)) - 2.0 * power_of<2>(log(1.0 + winv)) * log(-winv) + (pisqu * log(1.0 / (2.0 * w))) / 3.0 + power_of<3>(log(1.0 / (2.0 * w))) / 3.0 - (2.0 * pisqu * log(winv)) / 3.0 + 2.0 * power_of<2>(log(1.0 - w)) * log(winv) - (2.0 * power_of<3>(log(winv))) / 3.0 - 2.0 * power_of<2>(log(1.0 + winv)) * log((-1.0 + w) / (2.0 * w)) - 4.0 * log(winv) * power_of<2>(log((-1.0 + w) / w))
-                - (2.0 * pisqu * log((-0.5) * w)) / 3.0 - (2.0 * power_of<3>(log((-0.5) * w))) / 3.0 - (2.0 * pisqu * log(w)) / 3.0 + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(w) - (2.0 * power_of<3>(log(w))) / 3.0 + (2.0 * pisqu * log(w / (-1.0 + w))) / 3.0 + (2.0 * power_of<3>(log(w / (-1.0 + w)))) / 3.0 - 2.0 * power_of<2>(log(1.0 + winv)) * log((2.0 * w) / (-1.0 + w)) + (pisqu * log(1.0 / (1.0 + w))) / 3.0 + power_of<3>(log(1.0 / (1.0 + w))) / 3.0 - power_of<2>(log(1.0 - w)) * log(2.0 / (1.0 + w)) + 2.0 * power_of<2>(log((-1.0 + w) / w)) * log(2.0 / (1.0 + w)) + 2.0 * ln2squ * log((1.0 - w) / (1.0 + w)) - 2.0 * ln2squ * log((-1.0 + w) / (1.0 + w)) - (2.0 * pisqu * log(-(w / (1.0 + w)))) / 3.0
-                - (2.0 * power_of<3>(log(-(w / (1.0 + w))))) / 3.0 + (2.0 * pisqu * log(w / (1.0 + w))) / 3.0 + (2.0 * power_of<3>(log(w / (1.0 + w)))) / 3.0 + power_of<2>(log(1.0 - w)) * log((2.0 * w) / (1.0 + w)) - 2.0 * power_of<2>(log((-1.0 + w) / w)) * log((2.0 * w) / (1.0 + w)) + power_of<2>(log(1.0 - w)) * log((1.0 + w) / 2.0) - power_of<2>(log(1.0 - w)) * log((1.0 + w) / (2.0 * w)) - (2.0 * pisqu * log(((-1.0 + w) * w) / (w - yd))) / 3.0 - (2.0 * power_of<3>(log(((-1.0 + w) * w) / (w - yd)))) / 3.0 - (2.0 * pisqu * log(1.0 / (-1.0 + yd))) / 3.0 - (2.0 * power_of<3>(log(1.0 / (-1.0 + yd)))) / 3.0 + (4.0 * 1.0i) * M_PI * H1(w / (w - yd), (-1.0 + w) / (w - yd)) * power_of<2>(log((w - yd) / (w - power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w - yd)))
-                - (4.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), w / (w - yd)) * power_of<2>(log((-1.0 + yd) / w)) * my_sign(imag(w / (w - yd))) + (4.0 * 1.0i) * M_PI * power_of<2>(log(1.0 / (1.0 - w))) * my_sign(imag(w / (-1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), 1.0 / (1.0 - w)) + 8.0 * pisqu * ln2 * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0) + (21.0 * zeta3) / 2.0);
+                + ln_76 * ((2.0 * pisqu * ln_1) / 3.0 + 2.0 * lnhalf * power_of<2>(ln_1) + (2.0 * power_of<3>(ln_1)) / 3.0 + 4.0 * zeta3) + ln_82 * ((2.0 * pisqu * ln_1) / 3.0 + 2.0 * lnhalf * power_of<2>(ln_1) + (2.0 * power_of<3>(ln_1)) / 3.0 + 4.0 * zeta3)
+                + ln_15 * (2.0 * ln_1 * power_of<2>(ln_11) + 4.0 * power_of<2>(ln_4) * ln_5 - 2.0 * power_of<2>(ln_29) * ln1pyd - (2.0 * pisqu * ln_67) / 3.0 + 2.0 * power_of<2>(ln_72) * ln_67 + (2.0 * 1.0i) * M_PI * H2(-w, w / yd) * power_of<2>(ln_45) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(-ydinv, w / yd) * power_of<2>(ln_59) * my_sign(-imydinv) + 4.0 * zeta3)
+                + ln_51 * (2.0 * ln_1 * power_of<2>(ln_11) + 4.0 * power_of<2>(ln_4) * ln_5 - (2.0 * pisqu * ln_60) / 3.0 + 2.0 * power_of<2>(ln_65) * ln_60 + (2.0 * 1.0i) * M_PI * H2(-w, -(w / yd)) * power_of<2>(ln_53) * my_sign(-imag(w)) + (2.0 * 1.0i) * M_PI * H2(ydinv, -(w / yd)) * power_of<2>(ln_56) * my_sign(imydinv) + 4.0 * zeta3)
+                + ln_75 * (ln2 * power_of<2>(ln_3) + (4.0 * pisqu * ln_5) / 3.0 + 2.0 * lnhalf * power_of<2>(ln_5) + (4.0 * power_of<3>(ln_5)) / 3.0 + 2.0 * power_of<2>(ln_5) * ln_61 + power_of<2>(ln_3) * ln_12 + 8.0 * zeta3) + ln_84 * (ln2 * power_of<2>(ln_3) + (4.0 * pisqu * ln_5) / 3.0 + 2.0 * lnhalf * power_of<2>(ln_5) + (4.0 * power_of<3>(ln_5)) / 3.0 + 2.0 * power_of<2>(ln_5) * ln_61 + power_of<2>(ln_3) * ln_12 + 8.0 * zeta3)
+                + ln_60 * ((4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - (pisqu * ln2) / 3.0 - 4.0 * lnm1 * ln2squ + 2.0 * power_of<3>(ln2) - (pisqu * ln4) / 3.0 + 2.0 * power_of<2>(ln_1) * ln_27 + 2.0 * power_of<2>(ln_1) * ln_115 - 2.0 * power_of<2>(ln_1) * ln_11 + (pisqu * ln_121) / 3.0 + power_of<3>(ln_121) / 3.0 - (2.0 * pisqu * ln_4) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_4 - (2.0 * power_of<3>(ln_4)) / 3.0 - 2.0 * power_of<2>(ln_1) * ln_39 - 4.0 * ln_4 * power_of<2>(ln_5)
+                - (2.0 * pisqu * ln_128) / 3.0 - (2.0 * power_of<3>(ln_128)) / 3.0 - (2.0 * pisqu * ln_7) / 3.0 + 2.0 * power_of<2>(ln_5) * ln_7 - (2.0 * power_of<3>(ln_7)) / 3.0 + (2.0 * pisqu * ln_8) / 3.0 + (2.0 * power_of<3>(ln_8)) / 3.0 - 2.0 * power_of<2>(ln_1) * ln_124 + (pisqu * ln_61) / 3.0 + power_of<3>(ln_61) / 3.0 - power_of<2>(ln_3) * ln_40 + 2.0 * power_of<2>(ln_5) * ln_40 + 2.0 * ln2squ * ln_116 - 2.0 * ln2squ * ln_28 - (2.0 * pisqu * ln_129) / 3.0
+                - (2.0 * power_of<3>(ln_129)) / 3.0 + (2.0 * pisqu * ln_10) / 3.0 + (2.0 * power_of<3>(ln_10)) / 3.0 + power_of<2>(ln_3) * ln_117 - 2.0 * power_of<2>(ln_5) * ln_117 + power_of<2>(ln_3) * ln_118 - power_of<2>(ln_3) * ln_41 - (2.0 * pisqu * log(-1.0 / (1.0 + yd))) / 3.0 - (2.0 * power_of<3>(log(-1.0 / (1.0 + yd)))) / 3.0 - (2.0 * pisqu * log(((-1.0 + w) * w) / (w + yd))) / 3.0 - (2.0 * power_of<3>(log(((-1.0 + w) * w) / (w + yd)))) / 3.0 + (4.0 * 1.0i) * M_PI * H1(w / (w + yd), (-1.0 + w) / (w + yd)) * power_of<2>(log((w + yd) / (w - power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w + yd)))
+                - (4.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), w / (w + yd)) * power_of<2>(ln_101) * my_sign(imag(w / (w + yd))) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_2) * my_sign(-imag(w / (1.0 - w))) * T(1.0, (1.0 + yd) / (1.0 - w), 1.0 / (1.0 - w)) + 8.0 * pisqu * ln2 * T(1.0, 1.0 - yd, (w + yd) / w) * T(p(-(yd / w), 1.0 - yd), 1.0 - yd, 2.0) + (21.0 * zeta3) / 2.0)
+                + ln_67 * ((4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - (pisqu * ln2) / 3.0 - 4.0 * lnm1 * ln2squ + 2.0 * power_of<3>(ln2) - (pisqu * ln4) / 3.0 + 2.0 * power_of<2>(ln_1) * ln_27 + 2.0 * power_of<2>(ln_1) * ln_115 - 2.0 * power_of<2>(ln_1) * ln_11 + (pisqu * ln_121) / 3.0 + power_of<3>(ln_121) / 3.0 - (2.0 * pisqu * ln_4) / 3.0 + 2.0 * power_of<2>(ln_3) * ln_4 - (2.0 * power_of<3>(ln_4)) / 3.0 - 2.0 * power_of<2>(ln_1) * ln_39 - 4.0 * ln_4 * power_of<2>(ln_5)
+                - (2.0 * pisqu * ln_128) / 3.0 - (2.0 * power_of<3>(ln_128)) / 3.0 - (2.0 * pisqu * ln_7) / 3.0 + 2.0 * power_of<2>(ln_5) * ln_7 - (2.0 * power_of<3>(ln_7)) / 3.0 + (2.0 * pisqu * ln_8) / 3.0 + (2.0 * power_of<3>(ln_8)) / 3.0 - 2.0 * power_of<2>(ln_1) * ln_124 + (pisqu * ln_61) / 3.0 + power_of<3>(ln_61) / 3.0 - power_of<2>(ln_3) * ln_40 + 2.0 * power_of<2>(ln_5) * ln_40 + 2.0 * ln2squ * ln_116 - 2.0 * ln2squ * ln_28 - (2.0 * pisqu * ln_129) / 3.0
+                - (2.0 * power_of<3>(ln_129)) / 3.0 + (2.0 * pisqu * ln_10) / 3.0 + (2.0 * power_of<3>(ln_10)) / 3.0 + power_of<2>(ln_3) * ln_117 - 2.0 * power_of<2>(ln_5) * ln_117 + power_of<2>(ln_3) * ln_118 - power_of<2>(ln_3) * ln_41 - (2.0 * pisqu * log(((-1.0 + w) * w) / (w - yd))) / 3.0 - (2.0 * power_of<3>(log(((-1.0 + w) * w) / (w - yd)))) / 3.0 - (2.0 * pisqu * log(1.0 / (-1.0 + yd))) / 3.0 - (2.0 * power_of<3>(log(1.0 / (-1.0 + yd)))) / 3.0 + (4.0 * 1.0i) * M_PI * H1(w / (w - yd), (-1.0 + w) / (w - yd)) * power_of<2>(log((w - yd) / (w - power_of<2>(w)))) * my_sign(imag((-1.0 + w) / (w - yd)))
+                - (4.0 * 1.0i) * M_PI * H1(w / (-1.0 + w), w / (w - yd)) * power_of<2>(ln_98) * my_sign(imag(w / (w - yd))) + (4.0 * 1.0i) * M_PI * power_of<2>(ln_2) * my_sign(imag(w / (-1.0 + w))) * T(1.0, (-1.0 + yd) / (-1.0 + w), 1.0 / (1.0 - w)) + 8.0 * pisqu * ln2 * T(1.0, 1.0 + yd, 1.0 - yd / w) * T(p(yd / w, 1.0 + yd), 1.0 + yd, 2.0) + (21.0 * zeta3) / 2.0);
 
             return part1 + part2 + part3 + part4 + part5 + part6 + part7 + part8;
         }
@@ -62,7 +62,215 @@ namespace eos
 
             const complex<double> xdinv = 1.0 / xd;
 
-            const complex<double> part1 = power_of<4>(M_PI) / 5.0 - (3.0 * power_of<2>(dilog(1.0 - 1.0i * wx))) / 4.0 - (3.0 * power_of<2>(dilog(1.0 + 1.0i * wx))) / 4.0 + (3.0 * power_of<2>(dilog(-1.0i / (-1.0i + wx)))) / 4.0 + (3.0 * power_of<2>(dilog(1.0i / (1.0i + wx)))) / 4.0 + (9.0 * quadlog(1.0 - 1.0i * wx)) / 2.0 + (9.0 * quadlog(1.0 + 1.0i * wx)) / 2.0 + quadlog(-1.0i / wx) + quadlog(1.0i / wx) + 2.0 * quadlog((-1.0i) * wx) + 2.0 * quadlog(1.0i * wx) + (3.0 * quadlog(-1.0i / (-1.0i + wx))) / 2.0 + quadlog(wx / (-1.0i + wx)) + quadlog((-1.0i + wx) / wx) + (3.0 * quadlog(1.0i / (1.0i + wx))) / 2.0 + quadlog(wx / (1.0i + wx)) + quadlog((1.0i + wx) / wx) - 2.0 * quadlog(1.0 - wx * xdinv) + quadlog((wx - xd) / (-1.0i + wx)) + quadlog((wx - xd) / (1.0i + wx)) - 8.0 * quadlog(1.0 - 1.0i * xd)
+            // hoisted common subexpressions: the transcendental calls below are
+            // opaque to the compiler, and each right-hand side recurs many times
+            // in the generated sums
+            const complex<double> li2_1 = dilog(1.0 - 1.0i * wx);
+            const complex<double> li2_2 = dilog(1.0 + 1.0i * wx);
+            const complex<double> li2_3 = dilog(-1.0i / (-1.0i + wx));
+            const complex<double> li2_4 = dilog(1.0i / (1.0i + wx));
+            const complex<double> ln_1 = log(-1.0 + 1.0i / wx);
+            const complex<double> ln_2 = log(-1.0 - 1.0i * wx);
+            const complex<double> ln_3 = log(1.0 - 1.0i * wx);
+            const complex<double> ln_4 = log(-1.0 + 1.0i * wx);
+            const complex<double> ln_5 = log(1.0 + 1.0i * wx);
+            const complex<double> ln_6 = log(-1.0i / wx);
+            const complex<double> ln_7 = log(1.0i / wx);
+            const complex<double> ln_8 = log((-1.0i) * wx);
+            const complex<double> ln_9 = log(1.0i * wx);
+            const complex<double> ln_10 = log(-1.0i / (-1.0i + wx));
+            const complex<double> ln_11 = log((-1.0i + wx) / wx);
+            const complex<double> ln_12 = log(wx / (-1.0i + wx));
+            const complex<double> ln_13 = log(1.0i / (1.0i + wx));
+            const complex<double> ln_14 = log(-(wx / (1.0i + wx)));
+            const complex<double> ln_15 = log(-((1.0i + wx) / wx));
+            const complex<double> ln_16 = log((1.0i + wx) / wx);
+            const complex<double> ln_17 = log(wx / (1.0i + wx));
+            const complex<double> ln_18 = log(wx * (-1.0i - xdinv));
+            const complex<double> ln_19 = log(1.0i * (1.0 / wx - xdinv));
+            const complex<double> ln_20 = log(-1.0 + 1.0i / xd);
+            const complex<double> ln_21 = log(wx * (-1.0i + xdinv));
+            const complex<double> ln_22 = log(wx * (1.0i + xdinv));
+            const complex<double> ln_23 = log(-1.0 + wx * xdinv);
+            const complex<double> ln_24 = log(wx / (wx - xd));
+            const complex<double> ln_25 = log(0.5 - (1.0i / 2.0) * xd);
+            const complex<double> ln_26 = log(0.5 + (1.0i / 2.0) * xd);
+            const complex<double> ln_27 = log(1.0 - 1.0i * xd);
+            const complex<double> ln_28 = log(1.0 + 1.0i * xd);
+            const complex<double> ln_29 = log(1.0i * (wx - xd));
+            const complex<double> ln_30 = log((-1.0i) * (wx - xd));
+            const complex<double> ln_31 = log((-2.0 * 1.0i) / (wx - xd));
+            const complex<double> ln_32 = log((2.0 * 1.0i) / (wx - xd));
+            const complex<double> ln_33 = log((wx - xd) / (1.0i + wx));
+            const complex<double> ln_34 = log((wx - xd) / (-1.0i + wx));
+            const complex<double> li2_5 = dilog(wx / (wx - xd));
+            const complex<double> li2_6 = dilog(0.5 - (1.0i / 2.0) * xd);
+            const complex<double> li2_7 = dilog(0.5 + (1.0i / 2.0) * xd);
+            const complex<double> li2_8 = dilog((-1.0i) * xd);
+            const complex<double> li2_9 = dilog(1.0i * xd);
+            const complex<double> ln_35 = log(-1.0i / xd);
+            const complex<double> ln_36 = log(1.0i / xd);
+            const complex<double> ln_37 = log(wx * xdinv);
+            const complex<double> ln_38 = log((1.0i * wx) / ((-1.0i + wx) * xd));
+            const complex<double> ln_39 = log((1.0i * (wx - xd)) / (wx * xd));
+            const complex<double> ln_40 = log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd));
+            const complex<double> ln_41 = log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd));
+            const complex<double> ln_42 = log((-1.0i) * xd);
+            const complex<double> ln_43 = log(1.0i * xd);
+            const complex<double> ln_44 = log(xd);
+            const complex<double> ln_45 = log((-1.0i - 1.0 / wx) * xd);
+            const complex<double> ln_46 = log((-1.0i + 1.0 / wx) * xd);
+            const complex<double> ln_47 = log((1.0i + 1.0 / wx) * xd);
+            const complex<double> ln_48 = log((1.0i * (1.0i + wx) * xd) / wx);
+            const complex<double> ln_49 = log((1.0i * (1.0i + wx) * xd) / (wx - xd));
+            const complex<double> ln_50 = log(-1.0i / (-1.0i + xd));
+            const complex<double> ln_51 = log((1.0 + 1.0i * wx) / (wx * (-1.0i + xd)));
+            const complex<double> ln_52 = log(wx / (-1.0i + xd));
+            const complex<double> ln_53 = log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd)));
+            const complex<double> ln_54 = log((-1.0i + wx) / (-1.0i + xd));
+            const complex<double> ln_55 = log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)));
+            const complex<double> ln_56 = log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)));
+            const complex<double> ln_57 = log((-1.0i + xd) / wx);
+            const complex<double> ln_58 = log((-1.0i + xd) / (-1.0i + wx));
+            const complex<double> ln_59 = log((-1.0i + wx) / (1.0i + wx));
+            const complex<double> ln_60 = log((-2.0 * 1.0i) / (-1.0i + xd));
+            const complex<double> ln_61 = log(xd / (-1.0i + xd));
+            const complex<double> ln_62 = log((-1.0i + xd) * xdinv);
+            const complex<double> ln_63 = log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd));
+            const complex<double> ln_64 = log(1.0i / (1.0i + xd));
+            const complex<double> ln_65 = log(wx / (1.0i + xd));
+            const complex<double> ln_66 = log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd)));
+            const complex<double> ln_67 = log((1.0i + wx) / (1.0i + xd));
+            const complex<double> ln_68 = log((1.0i * (wx - xd)) / (wx * (1.0i + xd)));
+            const complex<double> ln_69 = log(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd)));
+            const complex<double> ln_70 = log(-(xd / (1.0i + xd)));
+            const complex<double> ln_71 = log(((1.0i + wx) * xd) / (wx * (1.0i + xd)));
+            const complex<double> ln_72 = log((1.0i + xd) / wx);
+            const complex<double> ln_73 = log((1.0i + xd) / (1.0i + wx));
+            const complex<double> ln_74 = log((2.0 * 1.0i) / (1.0i + xd));
+            const complex<double> ln_75 = log((1.0i * wx * (1.0i + xd)) / (1.0i + wx));
+            const complex<double> ln_76 = log((1.0i - xd) / (1.0i + xd));
+            const complex<double> ln_77 = log((1.0i + xd) / (1.0i - xd));
+            const complex<double> ln_78 = log(-((1.0i + xd) * xdinv));
+            const complex<double> li2_10 = dilog(xd / wx);
+            const complex<double> li2_11 = dilog(-1.0i / (-1.0i + xd));
+            const complex<double> li2_12 = dilog(1.0i / (1.0i + xd));
+            const complex<double> li2_13 = dilog((1.0i - xd) / (1.0i + xd));
+            const complex<double> li2_14 = dilog((1.0i + xd) / (1.0i - xd));
+            const complex<double> ln_79 = log(0.5 - (1.0i / 2.0) * wx);
+            const complex<double> ln_80 = log((2.0 * 1.0i) / (1.0i + wx));
+            const complex<double> ln_81 = log((1.0i + wx) / (2.0 * wx));
+            const complex<double> ln_82 = log(0.5 + (1.0i / 2.0) * wx);
+            const complex<double> ln_83 = log((-2.0 * 1.0i) / (-1.0i + wx));
+            const complex<double> ln_84 = log((-1.0i + wx) / (2.0 * wx));
+            const complex<double> ln_85 = log(-1.0 - 1.0i * xd);
+            const complex<double> ln_86 = log(-1.0 + 1.0i * xd);
+            const complex<double> ln_87 = log((1.0i + wx) / (-1.0i + wx));
+            const complex<double> ln_88 = log(xd / (1.0i + xd));
+            const complex<double> ln_89 = log((1.0i + xd) * xdinv);
+            const complex<double> ln_90 = log((1.0i * wx * (1.0i + xd)) * xdinv);
+            const complex<double> ln_91 = log((wx * (1.0i + xd)) / ((1.0i + wx) * xd));
+            const complex<double> ln_92 = log((-wx + xd) / (-1.0i + xd));
+            const complex<double> ln_93 = log((-wx + xd) / (1.0i + xd));
+            const complex<double> ln_94 = log(1.0 - xd / wx);
+            const complex<double> ln_95 = log(wx / (1.0i - xd));
+            const complex<double> ln_96 = log((-1.0i + wx) / (wx - xd));
+            const complex<double> ln_97 = log((1.0i + wx) / (wx - xd));
+            const complex<double> ln_98 = log(-(wx / (1.0i + xd)));
+            const complex<double> li2_15 = dilog((-2.0 * 1.0i) / (-1.0i + wx));
+            const complex<double> li2_16 = dilog((-1.0i + xd) / (-1.0i + wx));
+            const complex<double> li2_17 = dilog((2.0 * xd) / (1.0i + xd));
+            const complex<double> li2_18 = dilog((2.0 * 1.0i) / (1.0i + wx));
+            const complex<double> li2_19 = dilog((2.0 * xd) / (-1.0i + xd));
+            const complex<double> li2_20 = dilog((1.0i + xd) / (1.0i + wx));
+            const complex<double> li2_21 = dilog((2.0 * wx) / (-1.0i + wx));
+            const complex<double> li2_22 = dilog((-1.0i + wx) / wx);
+            const complex<double> li2_23 = dilog((wx - xd) / (-1.0i + wx));
+            const complex<double> li2_24 = dilog((2.0 * wx) / (1.0i + wx));
+            const complex<double> li2_25 = dilog((1.0i + wx) / wx);
+            const complex<double> li2_26 = dilog((wx - xd) / (1.0i + wx));
+            const complex<double> li2_27 = dilog((1.0i - wx) / (1.0i + wx));
+            const complex<double> li2_28 = dilog(-((xd + 1.0i * wx * xd) / (wx - xd)));
+            const complex<double> li2_29 = dilog((-1.0i + wx) / (2.0 * wx));
+            const complex<double> li2_30 = dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)));
+            const complex<double> li2_31 = dilog((1.0i + wx) / (1.0i - wx));
+            const complex<double> li2_32 = dilog((1.0i * (1.0i + wx) * xd) / (wx - xd));
+            const complex<double> li2_33 = dilog((1.0i + wx) / (2.0 * wx));
+            const complex<double> li2_34 = dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd)));
+            const complex<double> li2_35 = dilog((1.0i * (wx - xd)) / (wx * (1.0i + xd)));
+            const complex<double> li2_36 = dilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)));
+            const complex<double> li2_37 = dilog((-wx + xd) / (1.0i + xd));
+            const complex<double> li2_38 = dilog((-wx + xd) / (-1.0i + xd));
+            const complex<double> li2_39 = dilog((-1.0i + xd) * xdinv);
+            const complex<double> li2_40 = dilog((1.0i + xd) / (-1.0i + xd));
+            const complex<double> ln_99 = log(xd / wx);
+            const complex<double> li2_41 = dilog((-1.0i + xd) / (1.0i + xd));
+            const complex<double> li2_42 = dilog((1.0i + xd) * xdinv);
+            const complex<double> li2_43 = dilog((-1.0i + xd) / (-wx + xd));
+            const complex<double> li2_44 = dilog((wx + 1.0i * wx * xd) / (wx - xd));
+            const complex<double> li2_45 = dilog(-((1.0i + xd) / (wx - xd)));
+            const complex<double> li2_46 = dilog((wx - 1.0i * wx * xd) / (wx - xd));
+            const complex<double> ln_100 = log(-1.0 + xd / wx);
+            const complex<double> ln_101 = log((1.0i * wx) / (1.0i * xd - wx * xd));
+            const complex<double> ln_102 = log((wx - 1.0i * wx * xd) / (wx - xd));
+            const complex<double> ln_103 = log((wx + 1.0i * wx * xd) / (1.0i - wx));
+            const complex<double> ln_104 = log((wx + 1.0i * wx * xd) / (wx - xd));
+            const complex<double> li2_47 = dilog(1.0 - wx * xdinv);
+            const complex<double> li2_48 = dilog(1.0 - xd / wx);
+            const complex<double> ln_105 = log(-((xd + 1.0i * wx * xd) / (wx - xd)));
+            const complex<double> ln_106 = log((1.0 - 1.0i * wx) / (1.0i * wx + wx * xd));
+            const complex<double> ln_107 = log(((-1.0i) * wx) / (1.0i * xd + wx * xd));
+            const complex<double> ln_108 = log((1.0i * wx) / (1.0i * xd + wx * xd));
+            const complex<double> ln_109 = log(1.0 + wxinv * wxinv);
+            const complex<double> ln_110 = log(1.0 + power_of<2>(wx));
+            const complex<double> ln_111 = log((1.0i - 1.0 / wx) * xd);
+            const complex<double> ln_112 = log(-((1.0i + xd) / wx));
+            const complex<double> ln_113 = log((1.0i - xd) / wx);
+            const complex<double> ln_114 = log((1.0 + 1.0i * wx) / (1.0i * wx - wx * xd));
+            const complex<double> ln_115 = log((1.0i * (1.0i + wx)) / (wx * (1.0i + xd)));
+            const complex<double> ln_116 = log(-((1.0i + xd) / (wx - xd)));
+            const complex<double> li2_49 = dilog(xd / (1.0i + xd));
+            const complex<double> ln_117 = log((-1.0i + xd) / (-wx + xd));
+            const complex<double> li2_50 = dilog(xd / (-1.0i + xd));
+            const complex<double> ln_118 = log(1.0 + xdinv * xdinv);
+            const complex<double> ln_119 = log((1.0i + wx) / (1.0i - wx));
+            const complex<double> ln_120 = log((1.0i - wx) / (1.0i + wx));
+            const complex<double> ln_121 = log(1.0 - power_of<2>(wx) * power_of<2>(xdinv));
+            const complex<double> li2_51 = dilog(-(xd / (wx - xd)));
+            const complex<double> li2_52 = dilog(1.0 + 1.0i * xd);
+            const complex<double> ln_122 = log(1.0i / (-1.0i + wx));
+            const complex<double> ln_123 = log(1.0 - wx * xdinv);
+            const complex<double> li2_53 = dilog(1.0 - 1.0i * xd);
+            const complex<double> li2_54 = dilog((-1.0i) * wx);
+            const complex<double> ln_124 = log(-1.0i / (1.0i + wx));
+            const complex<double> li2_55 = dilog(1.0i * wx);
+            const complex<double> ln_125 = log(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd)));
+            const complex<double> li2_56 = dilog(0.5 - (1.0i / 2.0) * wx);
+            const complex<double> ln_126 = log(-(xd / (wx - xd)));
+            const complex<double> li2_57 = dilog(0.5 + (1.0i / 2.0) * wx);
+            const complex<double> li2_58 = dilog(wx / (1.0i + wx));
+            const complex<double> li2_59 = dilog((-1.0i + wx) / (1.0i + wx));
+            const complex<double> li2_60 = dilog(wx / (-1.0i + wx));
+            const complex<double> li2_61 = dilog((1.0i + wx) / (-1.0i + wx));
+            const complex<double> ln_127 = log((2.0 * wx) / (1.0i + wx));
+            const complex<double> ln_128 = log((2.0 * wx) / (-1.0i + wx));
+            const complex<double> ln_129 = log((1.0i - xd) / (1.0i + wx));
+            const complex<double> ln_130 = log((1.0i + xd) / (1.0i - wx));
+            const complex<double> ln_131 = log((-1.0i + wx) / (1.0i + xd));
+            const complex<double> ln_132 = log((1.0i + wx) / (-1.0i + xd));
+            const complex<double> ln_133 = log(((-0.5) * 1.0i) / wx);
+            const complex<double> ln_134 = log(1.0i / 2.0 / wx);
+            const complex<double> ln_135 = log((-2.0 * 1.0i) / wx);
+            const complex<double> ln_136 = log((2.0 * 1.0i) / wx);
+            const complex<double> ln_137 = log((-2.0 * 1.0i) * wx);
+            const complex<double> ln_138 = log((2.0 * 1.0i) * wx);
+            const complex<double> ln_139 = log(wx / (1.0i - wx));
+            const complex<double> ln_140 = log((2.0 * (-1.0i + wx)) / (1.0i + wx));
+            const complex<double> ln_141 = log((2.0 * (1.0i + wx)) / (-1.0i + wx));
+            const complex<double> ln_142 = log((-2.0 - (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)));
+            const complex<double> ln_143 = log(((2.0 * 1.0i) * (1.0i + wx)) / ((-1.0i + wx) * (1.0i + xd)));
+
+            const complex<double> part1 = power_of<4>(M_PI) / 5.0 - (3.0 * power_of<2>(li2_1)) / 4.0 - (3.0 * power_of<2>(li2_2)) / 4.0 + (3.0 * power_of<2>(li2_3)) / 4.0 + (3.0 * power_of<2>(li2_4)) / 4.0 + (9.0 * quadlog(1.0 - 1.0i * wx)) / 2.0 + (9.0 * quadlog(1.0 + 1.0i * wx)) / 2.0 + quadlog(-1.0i / wx) + quadlog(1.0i / wx) + 2.0 * quadlog((-1.0i) * wx) + 2.0 * quadlog(1.0i * wx) + (3.0 * quadlog(-1.0i / (-1.0i + wx))) / 2.0 + quadlog(wx / (-1.0i + wx)) + quadlog((-1.0i + wx) / wx) + (3.0 * quadlog(1.0i / (1.0i + wx))) / 2.0 + quadlog(wx / (1.0i + wx)) + quadlog((1.0i + wx) / wx) - 2.0 * quadlog(1.0 - wx * xdinv) + quadlog((wx - xd) / (-1.0i + wx)) + quadlog((wx - xd) / (1.0i + wx)) - 8.0 * quadlog(1.0 - 1.0i * xd)
                 - 8.0 * quadlog(1.0 + 1.0i * xd) - 6.0 * quadlog((-1.0i) * xd) - 6.0 * quadlog(1.0i * xd) + 9.0 * quadlog(xd / wx) + 2.0 * quadlog(-(xd / (wx - xd))) + 2.0 * quadlog((1.0i * (1.0i + wx) * xd) / (wx - xd)) - 2.0 * quadlog(xd / (-1.0i + xd)) - 3.0 * quadlog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) - 6.0 * quadlog((-1.0i + xd) / (-1.0i + wx)) + quadlog((-1.0i + xd) * xdinv) - 2.0 * quadlog(xd / (1.0i + xd)) - 3.0 * quadlog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) - 6.0 * quadlog((1.0i + xd) / (1.0i + wx)) + quadlog((1.0i + xd) * xdinv) + 8.0 * quadlog(1.0 - xd / wx) + 2.0 * quadlog(-((xd + 1.0i * wx * xd) / (wx - xd))) - li22(-1.0, (-1.0i) * xd) / 2.0 - li22(-1.0, 1.0i * xd) / 2.0 + li22(0.5, 1.0 - 1.0i * wx) / 4.0
                 + li22(0.5, 1.0 + 1.0i * wx) / 4.0 - (5.0 * li22(0.5, (-2.0 * 1.0i) / (-1.0i + wx))) / 2.0 - li22(0.5, (-1.0i + wx) / wx) / 4.0 - (5.0 * li22(0.5, (2.0 * 1.0i) / (1.0i + wx))) / 2.0 - li22(0.5, (1.0i + wx) / wx) / 4.0 + li22(0.5, (2.0 * wx) / (wx - xd)) - li22(0.5, (-2.0 * xd) / (wx - xd)) + li22(0.5, (2.0 * xd) / (-1.0i + xd)) / 2.0 + li22(0.5, (2.0 * xd) / (1.0i + xd)) / 2.0 - li22(0.5 - (1.0i / 2.0) * wx, 1.0i / (1.0i + wx)) / 4.0 + li22(0.5 - (1.0i / 2.0) * wx, (-2.0 * xd) / (wx - xd)) / 2.0 + li22(0.5 - (1.0i / 2.0) * wx, (1.0i + xd) / (1.0i + wx)) / 4.0 + li22(0.5 + (1.0i / 2.0) * wx, (-2.0 * xd) / (wx - xd)) / 2.0 + li22(1.0 - 1.0i * wx, (1.0i + xd) / (1.0i + wx))
                 - li22((1.0 + 1.0i * wx) / 2.0, -1.0i / (-1.0i + wx)) / 4.0 + li22((1.0 + 1.0i * wx) / 2.0, (-1.0i + xd) / (-1.0i + wx)) / 4.0 + li22(1.0 + 1.0i * wx, (-1.0i + xd) / (-1.0i + wx)) + li22(-1.0i / wx, 1.0i * xd) + li22(1.0i / wx, (-1.0i) * xd) + 2.0 * li22(-1.0i / (-1.0i + wx), 2.0) + li22(-1.0i / (-1.0i + wx), 1.0 - 1.0i * wx) - li22(-1.0i / (-1.0i + wx), (1.0 + 1.0i * wx) / 2.0) / 2.0 - li22(-1.0i / (-1.0i + wx), 1.0 + 1.0i * xd) - li22(-1.0i / (-1.0i + wx), (1.0i - wx) / (1.0i + xd)) - li22(-1.0i / (-1.0i + wx), -((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - li22(-1.0i / (-1.0i + wx), (xd + 1.0i * wx * xd) / (1.0i + xd)) / 4.0 - 2.0 * li22((-2.0 * 1.0i) / (-1.0i + wx), 0.5) + 2.0 * li22((-2.0 * 1.0i) / (-1.0i + wx), (1.0 + 1.0i * xd) / 2.0)
@@ -82,347 +290,347 @@ namespace eos
                 - li22((1.0i + xd) / (1.0i + wx), (1.0i - wx) / (1.0i + xd)) - li22((1.0i + xd) / (1.0i - xd), (1.0i - xd) / (1.0i + wx)) + li22(-((1.0i + xd) / (wx - xd)), xd / (1.0i + xd)) / 4.0 - li22(-((1.0i + xd) / (wx - xd)), (xd + 1.0i * wx * xd) / (1.0i + xd)) / 4.0 - li22((1.0i + xd) / (-1.0i + xd), xd / (1.0i + xd)) + li22((1.0i + xd) / (-1.0i + xd), ((-1.0i + wx) * xd) / (wx * (1.0i + xd))) + li22((-1.0i + xd) / (-wx + xd), xd / (-1.0i + xd)) / 4.0 - li22((-1.0i + xd) / (-wx + xd), ((1.0 - 1.0i * wx) * xd) / (-1.0i + xd)) / 4.0 - li22((-wx + xd) / (-1.0i + xd), (-2.0 * xd) / (wx - xd)) / 2.0 + li22((-wx + xd) / (-1.0i + xd), -(xd / (wx - xd))) / 2.0
                 - li22((-wx + xd) / (1.0i + xd), (-2.0 * xd) / (wx - xd)) / 2.0 + li22((-wx + xd) / (1.0i + xd), -(xd / (wx - xd))) / 2.0 + li22((wx - 1.0i * wx * xd) / (wx - xd), (wx - xd) / (2.0 * wx)) / 2.0 + li22((wx + 1.0i * wx * xd) / (wx - xd), (wx - xd) / (2.0 * wx)) / 2.0 + (5.0 * li22(-((xd + 1.0i * wx * xd) / (wx - xd)), -1.0i / (-1.0i + wx))) / 4.0 - li22(-((xd + 1.0i * wx * xd) / (wx - xd)), ((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) / 2.0 + li22(-((xd + 1.0i * wx * xd) / (wx - xd)), (1.0 - 1.0i * xd) / ((-1.0i + wx) * xd)) / 4.0 - li22(-((xd + 1.0i * wx * xd) / (wx - xd)), (-wx + xd) / (2.0 * xd)) / 2.0;
 
-            const complex<double> part2 = - (pisqu * power_of<2>(lnm2)) / 24.0 - (pisqu * ln2 * log(-1.0 + 1.0i / wx)) / 6.0
-                + (pisqu * power_of<2>(log(-1.0 + 1.0i / wx))) / 24.0 - (ln2 * power_of<3>(log(-1.0 + 1.0i / wx))) / 6.0 + (pisqu * ln2 * log(-1.0 - 1.0i * wx)) / 12.0 + (5.0 * pisqu * power_of<2>(log(-1.0 - 1.0i * wx))) / 24.0 + (power_of<2>(lnm2) * power_of<2>(log(-1.0 - 1.0i * wx))) / 16.0 + (ln2 * power_of<3>(log(-1.0 - 1.0i * wx))) / 12.0 + power_of<4>(log(-1.0 - 1.0i * wx)) / 24.0 + (pisqu * lnm2 * log(1.0 - 1.0i * wx)) / 12.0 + (power_of<3>(lnm2) * log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * lnm1 * log(1.0 - 1.0i * wx)) / 12.0 - (power_of<3>(lnm1) * log(1.0 - 1.0i * wx)) / 12.0 + (lnm1 * ln2squ * log(1.0 - 1.0i * wx)) / 4.0 + (pisqu * power_of<2>(log(1.0 - 1.0i * wx))) / 6.0 + power_of<4>(log(1.0 - 1.0i * wx)) / 6.0 + (pisqu * ln2 * log(-1.0 + 1.0i * wx)) / 12.0
-                + (5.0 * pisqu * power_of<2>(log(-1.0 + 1.0i * wx))) / 24.0 + (power_of<2>(lnm2) * power_of<2>(log(-1.0 + 1.0i * wx))) / 16.0 + (ln2 * power_of<3>(log(-1.0 + 1.0i * wx))) / 12.0 + power_of<4>(log(-1.0 + 1.0i * wx)) / 24.0 + (pisqu * lnm2 * log(1.0 + 1.0i * wx)) / 12.0 + (power_of<3>(lnm2) * log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * lnm1 * log(1.0 + 1.0i * wx)) / 12.0 - (power_of<3>(lnm1) * log(1.0 + 1.0i * wx)) / 12.0 + (lnm1 * ln2squ * log(1.0 + 1.0i * wx)) / 4.0 - (pisqu * log(-1.0 + 1.0i / wx) * log(1.0 + 1.0i * wx)) / 6.0 - (power_of<3>(log(-1.0 + 1.0i / wx)) * log(1.0 + 1.0i * wx)) / 6.0 + (pisqu * power_of<2>(log(1.0 + 1.0i * wx))) / 6.0 + power_of<4>(log(1.0 + 1.0i * wx)) / 6.0 + trilog(wx * xdinv) * (2.0 * ln2 + log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx))
-                + (pisqu * ln2 * log(-1.0i / wx)) / 6.0 - (ln2 * power_of<2>(log(1.0 - 1.0i * wx)) * log(-1.0i / wx)) / 2.0 + (pisqu * log(1.0 + 1.0i * wx) * log(-1.0i / wx)) / 6.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * wx) * log(-1.0i / wx)) / 2.0 + (ln2 * power_of<3>(log(-1.0i / wx))) / 6.0 + (log(1.0 + 1.0i * wx) * power_of<3>(log(-1.0i / wx))) / 6.0 + (pisqu * ln2 * log(1.0i / wx)) / 6.0 + (pisqu * log(1.0 - 1.0i * wx) * log(1.0i / wx)) / 6.0 - (ln2 * power_of<2>(log(1.0 + 1.0i * wx)) * log(1.0i / wx)) / 2.0 - (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0 + 1.0i * wx)) * log(1.0i / wx)) / 2.0 + (ln2 * power_of<3>(log(1.0i / wx))) / 6.0 + (log(1.0 - 1.0i * wx) * power_of<3>(log(1.0i / wx))) / 6.0 - (pisqu * ln2 * log((-1.0i) * wx)) / 3.0
-                - (power_of<2>(log(-1.0 + 1.0i / wx)) * log(1.0 + 1.0i * wx) * log((-1.0i) * wx)) / 2.0 - (pisqu * power_of<2>(log((-1.0i) * wx))) / 4.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * power_of<2>(log((-1.0i) * wx))) / 2.0 - (ln2 * power_of<3>(log((-1.0i) * wx))) / 3.0 - (log(-1.0 - 1.0i * wx) * power_of<3>(log((-1.0i) * wx))) / 2.0 + power_of<4>(log((-1.0i) * wx)) / 4.0 - (pisqu * ln2 * log(1.0i * wx)) / 3.0 - (pisqu * power_of<2>(log(1.0i * wx))) / 4.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * power_of<2>(log(1.0i * wx))) / 2.0 - (ln2 * power_of<3>(log(1.0i * wx))) / 3.0 - (log(-1.0 + 1.0i * wx) * power_of<3>(log(1.0i * wx))) / 2.0 + power_of<4>(log(1.0i * wx)) / 4.0 - (pisqu * log(1.0 + 1.0i * wx) * log(-1.0i / (-1.0i + wx))) / 6.0 + (log(1.0 + 1.0i * wx) * power_of<2>(log((-1.0i) * wx)) * log(-1.0i / (-1.0i + wx))) / 2.0
-                - (pisqu * power_of<2>(log(-1.0i / (-1.0i + wx)))) / 6.0 - (log(1.0 + 1.0i * wx) * power_of<3>(log(-1.0i / (-1.0i + wx)))) / 6.0 + power_of<4>(log(-1.0i / (-1.0i + wx))) / 6.0 - (power_of<3>(log(-1.0i / (-1.0i + wx))) * log(-(wx / (-1.0i + wx)))) / 3.0 - (pisqu * lnm2 * log((-1.0i + wx) / wx)) / 12.0 - (power_of<3>(lnm2) * log((-1.0i + wx) / wx)) / 12.0 + (pisqu * lnm1 * log((-1.0i + wx) / wx)) / 12.0 + (power_of<3>(lnm1) * log((-1.0i + wx) / wx)) / 12.0 - (lnm1 * ln2squ * log((-1.0i + wx) / wx)) / 4.0 + (power_of<2>(log(-1.0 - 1.0i * wx)) * log(1.0i / wx) * log((-1.0i + wx) / wx)) / 2.0 - (pisqu * log(1.0i * wx) * log((-1.0i + wx) / wx)) / 6.0 - (power_of<3>(log(1.0i * wx)) * log((-1.0i + wx) / wx)) / 6.0
-                + (pisqu * log(wx / (-1.0i + wx)) * log((-1.0i + wx) / wx)) / 3.0 - power_of<2>(log(1.0i / wx)) * log(wx / (-1.0i + wx)) * log((-1.0i + wx) / wx) + (power_of<3>(log(wx / (-1.0i + wx))) * log((-1.0i + wx) / wx)) / 3.0 + (power_of<2>(log(1.0i / wx)) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + ln2 * log((-1.0i) * wx) * power_of<2>(log((-1.0i + wx) / wx)) + (log(-1.0 - 1.0i * wx) * power_of<3>(log((-1.0i + wx) / wx))) / 3.0 - power_of<4>(log((-1.0i + wx) / wx)) / 3.0 - (pisqu * log(1.0 - 1.0i * wx) * log(1.0i / (1.0i + wx))) / 6.0 + (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0i * wx)) * log(1.0i / (1.0i + wx))) / 2.0 - (pisqu * power_of<2>(log(1.0i / (1.0i + wx)))) / 6.0 - (log(1.0 - 1.0i * wx) * power_of<3>(log(1.0i / (1.0i + wx)))) / 6.0 + power_of<4>(log(1.0i / (1.0i + wx))) / 6.0
-                - (power_of<3>(log(1.0i / (1.0i + wx))) * log(-(wx / (1.0i + wx)))) / 3.0 - (pisqu * ln2 * log(-((1.0i + wx) / wx))) / 6.0 - (pisqu * log(1.0 - 1.0i * wx) * log(-((1.0i + wx) / wx))) / 6.0 + (pisqu * power_of<2>(log(-((1.0i + wx) / wx)))) / 24.0 - (log(1.0 - 1.0i * wx) * log(1.0i * wx) * power_of<2>(log(-((1.0i + wx) / wx)))) / 2.0 - (ln2 * power_of<3>(log(-((1.0i + wx) / wx)))) / 6.0 - (log(1.0 - 1.0i * wx) * power_of<3>(log(-((1.0i + wx) / wx)))) / 6.0 - (pisqu * lnm2 * log((1.0i + wx) / wx)) / 12.0 - (power_of<3>(lnm2) * log((1.0i + wx) / wx)) / 12.0 + (pisqu * lnm1 * log((1.0i + wx) / wx)) / 12.0 + (power_of<3>(lnm1) * log((1.0i + wx) / wx)) / 12.0 - (lnm1 * ln2squ * log((1.0i + wx) / wx)) / 4.0
-                + (power_of<2>(log(-1.0 + 1.0i * wx)) * log(-1.0i / wx) * log((1.0i + wx) / wx)) / 2.0 - (pisqu * log((-1.0i) * wx) * log((1.0i + wx) / wx)) / 6.0 - (power_of<3>(log((-1.0i) * wx)) * log((1.0i + wx) / wx)) / 6.0 + (log((-1.0i) * wx) * power_of<2>(log((-1.0i + wx) / wx)) * log((1.0i + wx) / wx)) / 2.0 + (pisqu * log(wx / (1.0i + wx)) * log((1.0i + wx) / wx)) / 3.0 - power_of<2>(log(-1.0i / wx)) * log(wx / (1.0i + wx)) * log((1.0i + wx) / wx) + (power_of<3>(log(wx / (1.0i + wx))) * log((1.0i + wx) / wx)) / 3.0 + (power_of<2>(log(-1.0i / wx)) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + ln2 * log(1.0i * wx) * power_of<2>(log((1.0i + wx) / wx)) + (log(1.0i * wx) * log((-1.0i + wx) / wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0
-                + (log(-1.0 + 1.0i * wx) * power_of<3>(log((1.0i + wx) / wx))) / 3.0 - power_of<4>(log((1.0i + wx) / wx)) / 3.0 + ((pisqu * ln2) / 12.0 + (pisqu * log(1.0 - 1.0i * wx)) / 12.0) * log(wx * (-1.0i - xdinv)) + (ln2 / 12.0 + log(1.0 - 1.0i * wx) / 12.0) * power_of<3>(log(wx * (-1.0i - xdinv))) + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * log((1.0i + wx) / wx)) / 6.0) * log(1.0i * (1.0 / wx - xdinv)) + ((-1.0 / 6.0) * ln2 + log((1.0i + wx) / wx) / 6.0) * power_of<3>(log(1.0i * (1.0 / wx - xdinv))) + power_of<4>(log(-1.0 + 1.0i / xd)) / 24.0 - (pisqu * log(1.0 - 1.0i * wx) * log(wx * (-1.0i + xdinv))) / 6.0 - (log(1.0 - 1.0i * wx) * power_of<3>(log(wx * (-1.0i + xdinv)))) / 6.0
-                - (pisqu * log(1.0 + 1.0i * wx) * log(wx * (1.0i + xdinv))) / 6.0 - (log(1.0 + 1.0i * wx) * power_of<3>(log(wx * (1.0i + xdinv)))) / 6.0 - power_of<4>(log(-1.0 + wx * xdinv)) / 12.0 + power_of<4>(log(wx / (wx - xd))) / 3.0 - (pisqu * log(1.0 + 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (-1.0i + wx)))) / 6.0 - (log(1.0 + 1.0i * wx) * power_of<3>(log((1.0i * (wx - xd)) / (wx * (-1.0i + wx))))) / 6.0 - (pisqu * log(1.0 - 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (1.0i + wx)))) / 6.0 - (log(1.0 - 1.0i * wx) * power_of<3>(log(((-1.0i) * (wx - xd)) / (wx * (1.0i + wx))))) / 6.0
-                + trilog(wx / (wx - xd)) * (4.0 * ln2 + log(1.0 - 1.0i * wx) / 2.0 + log(1.0 + 1.0i * wx) / 2.0 + log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) + log(0.5 - (1.0i / 2.0) * xd) / 2.0 + log(0.5 + (1.0i / 2.0) * xd) / 2.0) + trilog((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * (ln2 + 2.0 * log(1.0 - 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 - 2.0 * log(1.0 - 1.0i * xd)) - power_of<4>(log(1.0 - 1.0i * xd)) / 3.0 + trilog(-1.0i / xd) * (-2.0 * ln2 - log(1.0 + 1.0i * wx) / 2.0 - log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) / 2.0 + 2.0 * log(1.0 - 1.0i * xd))
-                + dilog((-1.0i + wx) / (wx - xd)) * (2.0 * ln2 * log((-1.0i + wx) / wx) + log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) - log(1.0 + 1.0i * wx) * log(1.0 - 1.0i * xd)) + dilog((-1.0i + wx) / (-1.0i + xd)) * (-(ln2 * log(1.0 + 1.0i * wx)) - log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx) - (log((-1.0i + wx) / wx) * log(1.0 - 1.0i * xd)) / 2.0) + trilog((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * (ln2 + 2.0 * log(1.0 + 1.0i * wx) + log((1.0i + wx) / wx) / 2.0 - 2.0 * log(1.0 + 1.0i * xd)) + trilog(xd / (-wx + xd)) * (-log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd))
-                + power_of<3>(log(1.0i / (wx - xd))) * (ln2 / 6.0 + log(1.0 + 1.0i * wx) / 12.0 + log(1.0 - 1.0i * xd) / 6.0 - log(1.0 + 1.0i * xd) / 4.0) + power_of<3>(log(1.0i * (wx - xd))) * ((-1.0 / 6.0) * ln2 - log(1.0 - 1.0i * wx) / 12.0 + log(1.0 - 1.0i * xd) / 12.0 - log(1.0 + 1.0i * xd) / 12.0) + power_of<3>(log((-1.0i) * (wx - xd))) * ((-1.0 / 6.0) * ln2 - log(1.0 + 1.0i * wx) / 12.0 - log(1.0 - 1.0i * xd) / 12.0 + log(1.0 + 1.0i * xd) / 12.0) + power_of<3>(log(-1.0i / (wx - xd))) * (ln2 / 6.0 + log(1.0 - 1.0i * wx) / 12.0 - log(1.0 - 1.0i * xd) / 4.0 + log(1.0 + 1.0i * xd) / 6.0) - (pisqu * log((-2.0 * 1.0i) / (wx - xd)) * log(1.0 + 1.0i * xd)) / 3.0 - (power_of<3>(log((-2.0 * 1.0i) / (wx - xd))) * log(1.0 + 1.0i * xd)) / 3.0
-                - (pisqu * log((2.0 * 1.0i) / (wx - xd)) * log(1.0 + 1.0i * xd)) / 3.0 - (power_of<3>(log((2.0 * 1.0i) / (wx - xd))) * log(1.0 + 1.0i * xd)) / 3.0 - power_of<4>(log(1.0 + 1.0i * xd)) / 3.0 + trilog(1.0i / xd) * (-2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 + log((-1.0i + wx) / wx) / 2.0 - log((1.0i + wx) / wx) + 2.0 * log(1.0 + 1.0i * xd)) + trilog(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) * (3.0 * log(1.0 - 1.0i * xd) + 3.0 * log(1.0 + 1.0i * xd)) + trilog(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) * (3.0 * log(1.0 - 1.0i * xd) + 3.0 * log(1.0 + 1.0i * xd))
-                + log(1.0i / (wx - xd)) * ((pisqu * ln2) / 6.0 + (pisqu * log(1.0 + 1.0i * wx)) / 12.0 + (pisqu * log(1.0 - 1.0i * xd)) / 6.0 - (pisqu * log(1.0 + 1.0i * xd)) / 4.0) + log(1.0i * (wx - xd)) * ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * log(1.0 - 1.0i * wx)) / 12.0 + (pisqu * log(1.0 - 1.0i * xd)) / 12.0 - (pisqu * log(1.0 + 1.0i * xd)) / 12.0) + log((-1.0i) * (wx - xd)) * ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * log(1.0 - 1.0i * xd)) / 12.0 + (pisqu * log(1.0 + 1.0i * xd)) / 12.0) + log(-1.0i / (wx - xd)) * ((pisqu * ln2) / 6.0 + (pisqu * log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log(1.0 - 1.0i * xd)) / 4.0 + (pisqu * log(1.0 + 1.0i * xd)) / 6.0)
-                + dilog((1.0i + wx) / (wx - xd)) * (2.0 * ln2 * log((1.0i + wx) / wx) + log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) - log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * xd)) + dilog(wx * xdinv) * ((ln2 + log(1.0 + 1.0i * wx)) * log(1.0 - 1.0i * xd) + (ln2 + log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * xd)) + dilog((1.0i + wx) / (1.0i + xd)) * (-(ln2 * log(1.0 - 1.0i * wx)) - log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx) - (log((1.0i + wx) / wx) * log(1.0 + 1.0i * xd)) / 2.0) + dilog(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) * (-3.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) - 3.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd))
-                + dilog(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) * (-3.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) - 3.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd)) + dilog(wx / (wx - xd)) * (dilog(0.5 - (1.0i / 2.0) * xd) / 2.0 + dilog(0.5 + (1.0i / 2.0) * xd) / 2.0 - dilog((-1.0i) * xd) / 2.0 - dilog(1.0i * xd) / 2.0 + (log(0.5 + (1.0i / 2.0) * xd) * log(1.0 - 1.0i * xd)) / 2.0 + (log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd)) / 2.0) + ((-0.5) * ln2 + log(1.0 - 1.0i * wx) / 4.0 - log(1.0 + 1.0i * wx) / 3.0 - log((-1.0i + wx) / wx) / 6.0) * power_of<3>(log(-1.0i / xd))
-                + ((-0.5) * ln2 - log(1.0 - 1.0i * wx) / 3.0 + log(1.0 + 1.0i * wx) / 4.0 - log((1.0i + wx) / wx) / 6.0) * power_of<3>(log(1.0i / xd)) + ((4.0 * ln2) / 3.0 + log((-1.0i + wx) / wx) / 4.0 + log((1.0i + wx) / wx) / 4.0) * power_of<3>(log(wx * xdinv)) + ((pisqu * ln2) / 12.0 + (pisqu * log((1.0i + wx) / wx)) / 12.0) * log((1.0i * wx) / ((-1.0i + wx) * xd)) + (ln2 / 12.0 + log((1.0i + wx) / wx) / 12.0) * power_of<3>(log((1.0i * wx) / ((-1.0i + wx) * xd))) + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * log((-1.0i + wx) / wx)) / 6.0) * log((1.0i * (wx - xd)) / (wx * xd)) + ((-1.0 / 6.0) * ln2 + log((-1.0i + wx) / wx) / 6.0) * power_of<3>(log((1.0i * (wx - xd)) / (wx * xd)))
-                + (log(1.0 + 1.0i * wx) * power_of<3>(log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)))) / 6.0 + (log(1.0 - 1.0i * wx) * power_of<3>(log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)))) / 6.0 + power_of<2>(log(-1.0 + wx * xdinv)) * ((-5.0 * pisqu) / 12.0 - power_of<2>(lnm2) / 8.0 - power_of<2>(log(-1.0 - 1.0i * wx)) / 16.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 16.0 - (log(1.0i / wx) * log((-1.0i + wx) / wx)) / 2.0 - (log(-1.0i / wx) * log((1.0i + wx) / wx)) / 2.0 - (log(1.0 + 1.0i * xd) * log((-1.0i) * xd)) / 2.0 - (log(1.0 - 1.0i * xd) * log(1.0i * xd)) / 2.0) + dilog(xd / (-wx + xd)) * (log(1.0 + 1.0i * xd) * log((-1.0i) * xd) + log(1.0 - 1.0i * xd) * log(1.0i * xd))
-                + trilog(xd / wx) * (6.0 * ln2 + 2.0 * log((-1.0i + wx) / wx) + 2.0 * log((1.0i + wx) / wx) - log(1.0 - 1.0i * xd) / 2.0 - log(1.0 + 1.0i * xd) / 2.0 + log(xd)) + trilog(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) + log(xd)) + trilog(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) + log(xd)) + trilog(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd))) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) + log(xd))
-                + trilog(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd))) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) + log(xd)) - (pisqu * ln2 * log((-1.0i - 1.0 / wx) * xd)) / 12.0 - (ln2 * power_of<3>(log((-1.0i - 1.0 / wx) * xd))) / 12.0 + (pisqu * ln2 * log((-1.0i + 1.0 / wx) * xd)) / 6.0 + (ln2 * power_of<3>(log((-1.0i + 1.0 / wx) * xd))) / 6.0 + (pisqu * ln2 * log((1.0i + 1.0 / wx) * xd)) / 6.0 + (ln2 * power_of<3>(log((1.0i + 1.0 / wx) * xd))) / 6.0 - (pisqu * ln2 * log((1.0i * (1.0i + wx) * xd) / wx)) / 12.0 - (ln2 * power_of<3>(log((1.0i * (1.0i + wx) * xd) / wx))) / 12.0 + (log(1.0 + 1.0i * wx) / 12.0 - log((1.0i + wx) / wx) / 12.0) * power_of<3>(log(xd / (1.0i - xd)))
-                + ((pisqu * ln2) / 6.0 - (pisqu * log((-1.0i + wx) / wx)) / 6.0) * log(((-1.0i) * wx * xd) / (wx - xd)) + (ln2 / 6.0 - log((-1.0i + wx) / wx) / 6.0) * power_of<3>(log(((-1.0i) * wx * xd) / (wx - xd))) + ((pisqu * ln2) / 6.0 - (pisqu * log((1.0i + wx) / wx)) / 6.0) * log((1.0i * wx * xd) / (wx - xd)) + (ln2 / 6.0 - log((1.0i + wx) / wx) / 6.0) * power_of<3>(log((1.0i * wx * xd) / (wx - xd))) - (log(1.0 - 1.0i * wx) * power_of<3>(log((1.0i * (1.0i + wx) * xd) / (wx - xd)))) / 6.0 - power_of<4>(log(-1.0i / (-1.0i + xd))) / 3.0 + log(xd / (1.0i - xd)) * ((pisqu * log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * log((1.0i + wx) / wx)) / 12.0 + (2.0 * power_of<3>(log(-1.0i / (-1.0i + xd)))) / 3.0)
-                - (pisqu * log((-1.0i + wx) / wx) * log((1.0 + 1.0i * wx) / (wx * (-1.0i + xd)))) / 6.0 - (log((-1.0i + wx) / wx) * power_of<3>(log((1.0 + 1.0i * wx) / (wx * (-1.0i + xd))))) / 6.0 + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log((1.0i + wx) / wx)) / 4.0) * log(wx / (-1.0i + xd)) + ((-1.0 / 6.0) * ln2 + log(1.0 - 1.0i * wx) / 12.0 - log((1.0i + wx) / wx) / 4.0) * power_of<3>(log(wx / (-1.0i + xd))) + (log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * log(xd) * power_of<2>(log((-1.0i + wx) / (-1.0i + xd)))) / 2.0
-                + dilog(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) * (log(0.5 + (1.0i / 2.0) * xd) * (-2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + log(xd) * log((-1.0i + wx) / (-1.0i + xd))) + dilog(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd))) * (log(0.5 + (1.0i / 2.0) * xd) * (-2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + log(xd) * log((-1.0i + wx) / (-1.0i + xd))) + trilog((-1.0i + wx) / (2.0 * wx)) * ((-0.5) * lnhalf + log(0.5 + (1.0i / 2.0) * xd) / 2.0 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) - log(xd) + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))))
-                + ((-1.0 / 12.0) * (pisqu * ln2) - (pisqu * log(1.0 - 1.0i * wx)) / 12.0) * log((1.0i * xd) / (wx * (-1.0i + xd))) + ((-1.0 / 12.0) * ln2 - log(1.0 - 1.0i * wx) / 12.0) * power_of<3>(log((1.0i * xd) / (wx * (-1.0i + xd)))) + (log((-1.0i + wx) / wx) * power_of<3>(log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))))) / 6.0 + (pisqu * ln2 * log((-1.0i + xd) / wx)) / 6.0 + (ln2 * power_of<3>(log((-1.0i + xd) / wx))) / 6.0 + trilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) * (2.0 * ln2 + 2.0 * log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx) / 2.0 + (3.0 * log((-1.0i + wx) / wx)) / 2.0 + log(1.0 - 1.0i * xd) / 2.0 + log(xd) - log((-1.0i + xd) / (-1.0i + wx)) / 2.0)
-                + trilog((1.0i + xd) / (1.0i + wx)) * (lnhalf - ln2 - 2.0 * log(1.0 - 1.0i * wx) - 2.0 * log(1.0i * wx) - log((-1.0i + wx) / wx) / 2.0 - log(wx / (1.0i + wx)) + 3.0 * log((-1.0i + wx) / (1.0i + wx)) - log((1.0i + wx) / wx) - (5.0 * log(0.5 + (1.0i / 2.0) * xd)) / 2.0 - 3.0 * log(1.0 - 1.0i * xd) - 3.0 * log(1.0 + 1.0i * xd) + 3.0 * log(1.0i * xd) - log(xd) - log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 - log(xd / (-1.0i + xd)) + log((-1.0i + xd) * xdinv)) - (log((-1.0i + wx) / wx) * power_of<3>(log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)))) / 3.0 - power_of<4>(log(1.0i / (1.0i + xd))) / 3.0
-                + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * log((-1.0i + wx) / wx)) / 4.0) * log(wx / (1.0i + xd)) + ((-1.0 / 6.0) * ln2 + log(1.0 + 1.0i * wx) / 12.0 - log((-1.0i + wx) / wx) / 4.0) * power_of<3>(log(wx / (1.0i + xd))) + (log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) * log(xd) * power_of<2>(log((1.0i + wx) / (1.0i + xd)))) / 2.0 + dilog(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * (log(0.5 - (1.0i / 2.0) * xd) * (-2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + log(xd) * log((1.0i + wx) / (1.0i + xd)))
-                + dilog(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd))) * (log(0.5 - (1.0i / 2.0) * xd) * (-2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd)) + log(xd) * log((1.0i + wx) / (1.0i + xd))) + trilog((1.0i + wx) / (2.0 * wx)) * ((-0.5) * lnhalf + log(0.5 - (1.0i / 2.0) * xd) / 2.0 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) - log(xd) + log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) + power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) * (-(log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * log(1.0 + 1.0i * xd)) - log(1.0 + 1.0i * xd) * log(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))))
-                + ((pisqu * log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log((-1.0i + wx) / wx)) / 12.0) * log(-(xd / (1.0i + xd))) + (log(1.0 - 1.0i * wx) / 12.0 - log((-1.0i + wx) / wx) / 12.0) * power_of<3>(log(-(xd / (1.0i + xd)))) + (log((1.0i + wx) / wx) * power_of<3>(log(((1.0i + wx) * xd) / (wx * (1.0i + xd))))) / 6.0 + ((ln2squ * log(1.0 - 1.0i * wx)) / 4.0 - (ln2squ * log((-1.0i + wx) / wx)) / 4.0) * log((-1.0i + xd) / (1.0i + xd)) + (pisqu * ln2 * log((1.0i + xd) / wx)) / 6.0 + (ln2 * power_of<3>(log((1.0i + xd) / wx))) / 6.0
-                + trilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) * (2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 + 2.0 * log(1.0 + 1.0i * wx) + (3.0 * log((1.0i + wx) / wx)) / 2.0 + log(1.0 + 1.0i * xd) / 2.0 + log(xd) - log((1.0i + xd) / (1.0i + wx)) / 2.0) + trilog(1.0 - xd / wx) * (4.0 * ln2 - (3.0 * log(1.0 - 1.0i * wx)) / 2.0 - (3.0 * log(1.0 + 1.0i * wx)) / 2.0 + log(-1.0i / (-1.0i + wx)) - 3.0 * log((-1.0i + wx) / wx) + log(1.0i / (1.0i + wx)) - 3.0 * log((1.0i + wx) / wx) + log(1.0 - 1.0i * xd) / 2.0 + log(1.0 + 1.0i * xd) / 2.0 - log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 + log((-1.0i + xd) / (-1.0i + wx)) - log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i + wx)))
-                + (pisqu * log((1.0i + wx) / wx) * log((1.0i * wx * (1.0i + xd)) / (1.0i + wx))) / 3.0 + (log((1.0i + wx) / wx) * power_of<3>(log((1.0i * wx * (1.0i + xd)) / (1.0i + wx)))) / 3.0 + trilog((-wx + xd) / (1.0i + xd)) * (-2.0 * ln2 - 2.0 * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 2.0 - (3.0 * log((-1.0i + wx) / wx)) / 2.0 - 2.0 * log(1.0 - 1.0i * xd) - 3.0 * log(1.0 + 1.0i * xd) - log(xd) - log(1.0i / (1.0i + xd)) / 2.0 + log((1.0i - xd) / (1.0i + xd)) / 2.0 - log((1.0i + xd) / (1.0i - xd)) / 2.0)
-                + trilog((-wx + xd) / (-1.0i + xd)) * (-2.0 * ln2 + log(1.0 - 1.0i * wx) / 2.0 - 2.0 * log(1.0 + 1.0i * wx) - (3.0 * log((1.0i + wx) / wx)) / 2.0 - 3.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) - log(xd) - log(-1.0i / (-1.0i + xd)) / 2.0 - log((1.0i - xd) / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i - xd)) / 2.0) + power_of<4>(log(-((1.0i + xd) * xdinv))) / 24.0
-                + dilog(xd / wx) * ((-5.0 * pisqu) / 6.0 + dilog(-1.0i / (-1.0i + xd)) + dilog(1.0i / (1.0i + xd)) - 2.0 * dilog((1.0i - xd) / (1.0i + xd)) - 2.0 * dilog((1.0i + xd) / (1.0i - xd)) - power_of<2>(lnm2) / 2.0 - power_of<2>(log(-1.0 + 1.0i / wx)) / 2.0 - ln2 * log(1.0 - 1.0i * wx) - power_of<2>(log(1.0 - 1.0i * wx)) - ln2 * log(1.0 + 1.0i * wx) - power_of<2>(log(1.0 + 1.0i * wx)) + log(0.5 - (1.0i / 2.0) * wx) * log((-1.0i + wx) / wx) - (3.0 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 - log((-1.0i + wx) / wx) * log((2.0 * 1.0i) / (1.0i + wx)) - power_of<2>(log(-((1.0i + wx) / wx))) / 2.0 - log((-1.0i + wx) / wx) * log((1.0i + wx) / (2.0 * wx)) + log(0.5 + (1.0i / 2.0) * wx) * log((1.0i + wx) / wx)
-                - log((-2.0 * 1.0i) / (-1.0i + wx)) * log((1.0i + wx) / wx) - log((-1.0i + wx) / (2.0 * wx)) * log((1.0i + wx) / wx) - (3.0 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - power_of<2>(log(-1.0 - 1.0i * xd)) / 2.0 + power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 - power_of<2>(log(-1.0 + 1.0i * xd)) / 2.0 + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) + log(0.5 + (1.0i / 2.0) * xd) / 2.0 - 2.0 * log(1.0 + 1.0i * xd) + 2.0 * log(1.0i * xd) + log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 - log((2.0 * xd) / (-1.0i + xd)) + log((-1.0i + xd) / (2.0 * xd)))
-                + log(1.0 + 1.0i * xd) * (log(1.0 - 1.0i * wx) - log((1.0i + wx) / wx) + log(0.5 - (1.0i / 2.0) * xd) / 2.0 + 2.0 * log((-1.0i) * xd) + log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 - log((2.0 * xd) / (1.0i + xd)) + log((1.0i + xd) / (2.0 * xd)))) + trilog((-1.0i + xd) / (-1.0i + wx)) * (lnhalf - ln2 - 2.0 * log(1.0 + 1.0i * wx) - 2.0 * log((-1.0i) * wx) - log(wx / (-1.0i + wx)) - log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) / 2.0 + 3.0 * log((1.0i + wx) / (-1.0i + wx)) - (5.0 * log(0.5 - (1.0i / 2.0) * xd)) / 2.0 - 3.0 * log(1.0 - 1.0i * xd) - 3.0 * log(1.0 + 1.0i * xd) + 3.0 * log((-1.0i) * xd) - log(xd) - log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 - log(xd / (1.0i + xd))
-                + log((1.0i + xd) * xdinv)) + ((pisqu * ln2) / 12.0 + (pisqu * log(1.0 + 1.0i * wx)) / 12.0) * log((1.0i * wx * (1.0i + xd)) * xdinv) + (ln2 / 12.0 + log(1.0 + 1.0i * wx) / 12.0) * power_of<3>(log((1.0i * wx * (1.0i + xd)) * xdinv)) - (log((1.0i + wx) / wx) * power_of<3>(log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)))) / 3.0 + ((ln2squ * log(1.0 + 1.0i * wx)) / 4.0 - (ln2squ * log((1.0i + wx) / wx)) / 4.0) * log((1.0i + xd) / (-1.0i + xd)) + ((-0.25) * (ln2 * power_of<2>(log(1.0 + 1.0i * wx))) - (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 - (ln2 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0) * log((-wx + xd) / (-1.0i + xd))
-                + ((-0.25) * (ln2 * power_of<2>(log(1.0 - 1.0i * wx))) - (power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * wx)) / 4.0 - (ln2 * power_of<2>(log((1.0i + wx) / wx))) / 2.0) * log((-wx + xd) / (1.0i + xd)) + trilog(-1.0i / wx) * ((-0.5) * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 + 8.0 * log(1.0 - 1.0i * xd) + (5.0 * log(1.0 + 1.0i * xd)) / 2.0 + log(xd) - 4.0 * log(1.0 - xd / wx)) + trilog(1.0i / wx) * ((-0.5) * log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx) / 2.0 + (5.0 * log(1.0 - 1.0i * xd)) / 2.0 + 8.0 * log(1.0 + 1.0i * xd) + log(xd) - 4.0 * log(1.0 - xd / wx))
-                + trilog(1.0i * wx) * (-ln2 + (5.0 * log(1.0 - 1.0i * xd)) / 2.0 - (3.0 * log(1.0 + 1.0i * xd)) / 2.0 - 3.0 * log(1.0 - xd / wx)) + trilog((-1.0i) * wx) * (-ln2 - (3.0 * log(1.0 - 1.0i * xd)) / 2.0 + (5.0 * log(1.0 + 1.0i * xd)) / 2.0 - 3.0 * log(1.0 - xd / wx)) + dilog((-1.0i + xd) / (2.0 * xd)) * log(1.0 + 1.0i * xd) * (-log(1.0 - 1.0i * wx) + log((-1.0i + wx) / wx) - 2.0 * log(1.0 - xd / wx)) + dilog((1.0i - xd) / (1.0i + xd)) * log(1.0 + 1.0i * xd) * ((-3.0 * log(1.0 + 1.0i * wx)) / 2.0 + log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) / 2.0 - 2.0 * log(1.0 - xd / wx))
-                + dilog((1.0i + xd) / (2.0 * xd)) * log(1.0 - 1.0i * xd) * (-log(1.0 + 1.0i * wx) + log((1.0i + wx) / wx) - 2.0 * log(1.0 - xd / wx)) + dilog((1.0i + xd) / (1.0i - xd)) * log(1.0 - 1.0i * xd) * ((-3.0 * log(1.0 - 1.0i * wx)) / 2.0 + log((-1.0i + wx) / wx) / 2.0 + log((1.0i + wx) / wx) - 2.0 * log(1.0 - xd / wx)) + trilog(1.0i * xd) * (-ln2 + log(1.0 - 1.0i * wx) / 2.0 - (3.0 * log(1.0 + 1.0i * wx)) / 2.0 - log((1.0i + wx) / wx) - log(1.0 - 1.0i * xd) / 2.0 - (5.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(xd) - log(1.0 - xd / wx))
-                + trilog((-1.0i) * xd) * (-ln2 - (3.0 * log(1.0 - 1.0i * wx)) / 2.0 + log(1.0 + 1.0i * wx) / 2.0 - log((-1.0i + wx) / wx) - (5.0 * log(1.0 - 1.0i * xd)) / 2.0 - log(1.0 + 1.0i * xd) / 2.0 - log(xd) - log(1.0 - xd / wx)) + trilog((wx - 1.0i * wx * xd) / (wx - xd)) * (-2.0 * ln2 - log(1.0 + 1.0i * wx) - 3.0 * log((1.0i + wx) / wx) - log(0.5 + (1.0i / 2.0) * xd) / 2.0 - log(1.0 - 1.0i * xd) / 2.0 + log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 - log(1.0 - xd / wx))
-                + trilog((wx + 1.0i * wx * xd) / (wx - xd)) * (-2.0 * ln2 - log(1.0 - 1.0i * wx) - 3.0 * log((-1.0i + wx) / wx) - log(0.5 - (1.0i / 2.0) * xd) / 2.0 - log(1.0 + 1.0i * xd) / 2.0 + log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 - log(1.0 - xd / wx)) + trilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * (-lnhalf - ln2 - 3.0 * log((-1.0i + wx) / wx) - log(1.0i / (1.0i + wx)) - log(1.0 - 1.0i * xd) / 2.0 + log(1.0 + 1.0i * xd) / 2.0 + (5.0 * log(-1.0i / (-1.0i + xd))) / 2.0 + log((1.0i - xd) / (1.0i + xd)) / 2.0 - log((1.0i + xd) / (1.0i - xd)) / 2.0 - log(1.0 - xd / wx))
-                + trilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * (-lnhalf - ln2 - log(-1.0i / (-1.0i + wx)) - 3.0 * log((1.0i + wx) / wx) + log(1.0 - 1.0i * xd) / 2.0 - log(1.0 + 1.0i * xd) / 2.0 + (5.0 * log(1.0i / (1.0i + xd))) / 2.0 - log((1.0i - xd) / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i - xd)) / 2.0 - log(1.0 - xd / wx)) + power_of<3>(log(wx / (wx - xd))) * ((-2.0 * log(xd / (wx - xd))) / 3.0 - log(1.0 - xd / wx) / 3.0) + power_of<3>(log(-1.0i / (-1.0i + xd))) * ((-1.0 / 6.0) * log(1.0 - 1.0i * wx) + log((-1.0i + wx) / wx) / 12.0 + log((1.0i + wx) / wx) / 6.0 - log(1.0 - xd / wx) / 4.0)
-                + power_of<3>(log(1.0i / (1.0i + xd))) * ((-1.0 / 6.0) * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) / 6.0 + log((1.0i + wx) / wx) / 12.0 + (2.0 * log(-(xd / (1.0i + xd)))) / 3.0 - log(1.0 - xd / wx) / 4.0) + power_of<3>(log((1.0i * wx * (1.0i + wx)) / (wx - xd))) * (log(1.0 - 1.0i * wx) / 6.0 - log(1.0 - xd / wx) / 6.0) + power_of<3>(log(((-1.0 - 1.0i * wx) * wx) / (wx - xd))) * (log(1.0 + 1.0i * wx) / 6.0 - log(1.0 - xd / wx) / 6.0) + power_of<3>(log((-2.0 * 1.0i) * xd)) * ((-1.0 / 12.0) * log(1.0 - 1.0i * wx) - log(1.0 - xd / wx) / 12.0) + power_of<3>(log((2.0 * 1.0i) * xd)) * ((-1.0 / 12.0) * log(1.0 + 1.0i * wx) - log(1.0 - xd / wx) / 12.0)
-                + power_of<3>(log(1.0i / 2.0 * xdinv)) * (log(1.0 - 1.0i * wx) / 12.0 - log((-1.0i + wx) / wx) / 6.0 + log(1.0 - xd / wx) / 4.0) + power_of<3>(log(((-0.5) * 1.0i) * xdinv)) * (log(1.0 + 1.0i * wx) / 12.0 - log((1.0i + wx) / wx) / 6.0 + log(1.0 - xd / wx) / 4.0) + (pisqu * log(wx / (1.0i - xd)) * log(1.0 - xd / wx)) / 6.0 + (power_of<3>(log(wx / (1.0i - xd))) * log(1.0 - xd / wx)) / 6.0 + (power_of<3>(log((-1.0i + wx) / (wx - xd))) * log(1.0 - xd / wx)) / 6.0 + (power_of<3>(log((1.0i + wx) / (wx - xd))) * log(1.0 - xd / wx)) / 6.0 + (pisqu * log(-(wx / (1.0i + xd))) * log(1.0 - xd / wx)) / 6.0 + (power_of<3>(log(-(wx / (1.0i + xd)))) * log(1.0 - xd / wx)) / 6.0 + power_of<4>(log(1.0 - xd / wx)) / 3.0
-                + trilog((-1.0i + wx) / (-1.0i + xd)) * (ln2 + log(1.0 - 1.0i * wx) + log(1.0 - 1.0i * xd) / 2.0 - log(xd) + log(1.0 - xd / wx)) + trilog((1.0i + wx) / (1.0i + xd)) * (ln2 + log(1.0 + 1.0i * wx) + log(1.0 + 1.0i * xd) / 2.0 - log(xd) + log(1.0 - xd / wx)) + trilog((1.0i - xd) / (1.0i + xd)) * ((3.0 * log(1.0 + 1.0i * wx)) / 2.0 - log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) / 2.0 - log((-1.0i + wx) / (wx - xd)) + log((wx - xd) / (-1.0i + wx)) + 2.0 * log(1.0 - xd / wx))
-                + trilog((1.0i + xd) / (1.0i - xd)) * ((3.0 * log(1.0 - 1.0i * wx)) / 2.0 - log((-1.0i + wx) / wx) / 2.0 - log((1.0i + wx) / wx) - log((1.0i + wx) / (wx - xd)) + log((wx - xd) / (1.0i + wx)) + 2.0 * log(1.0 - xd / wx)) + trilog((-2.0 * 1.0i) / (-1.0i + wx)) * (log(wx / (-1.0i + wx)) - log((wx - xd) / (-1.0i + wx)) + log(1.0 - 1.0i * xd) + 3.0 * log(1.0 + 1.0i * xd) - log((1.0i - xd) / (1.0i + xd)) / 2.0 + 2.0 * log(1.0 - xd / wx)) + trilog((2.0 * 1.0i) / (1.0i + wx)) * (log(wx / (1.0i + wx)) - log((wx - xd) / (1.0i + wx)) + 3.0 * log(1.0 - 1.0i * xd) + log(1.0 + 1.0i * xd) - log((1.0i + xd) / (1.0i - xd)) / 2.0 + 2.0 * log(1.0 - xd / wx))
-                + trilog(-1.0) * (log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) + log(1.0 - 1.0i * xd) + log(1.0 + 1.0i * xd) + 2.0 * log(xd) + 8.0 * log(1.0 - xd / wx)) + log((1.0i * wx * (1.0i + wx)) / (wx - xd)) * ((pisqu * log(1.0 - 1.0i * wx)) / 6.0 - (pisqu * log(1.0 - xd / wx)) / 6.0) + log(((-1.0 - 1.0i * wx) * wx) / (wx - xd)) * ((pisqu * log(1.0 + 1.0i * wx)) / 6.0 - (pisqu * log(1.0 - xd / wx)) / 6.0) + log((-2.0 * 1.0i) * xd) * ((-1.0 / 12.0) * (pisqu * log(1.0 - 1.0i * wx)) - (pisqu * log(1.0 - xd / wx)) / 12.0) + log((2.0 * 1.0i) * xd) * ((-1.0 / 12.0) * (pisqu * log(1.0 + 1.0i * wx)) - (pisqu * log(1.0 - xd / wx)) / 12.0)
-                + log(1.0i / 2.0 * xdinv) * ((pisqu * log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log((-1.0i + wx) / wx)) / 6.0 + (pisqu * log(1.0 - xd / wx)) / 4.0) + log(((-0.5) * 1.0i) * xdinv) * ((pisqu * log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * log((1.0i + wx) / wx)) / 6.0 + (pisqu * log(1.0 - xd / wx)) / 4.0);
+            const complex<double> part2 = - (pisqu * power_of<2>(lnm2)) / 24.0 - (pisqu * ln2 * ln_1) / 6.0
+                + (pisqu * power_of<2>(ln_1)) / 24.0 - (ln2 * power_of<3>(ln_1)) / 6.0 + (pisqu * ln2 * ln_2) / 12.0 + (5.0 * pisqu * power_of<2>(ln_2)) / 24.0 + (power_of<2>(lnm2) * power_of<2>(ln_2)) / 16.0 + (ln2 * power_of<3>(ln_2)) / 12.0 + power_of<4>(ln_2) / 24.0 + (pisqu * lnm2 * ln_3) / 12.0 + (power_of<3>(lnm2) * ln_3) / 12.0 - (pisqu * lnm1 * ln_3) / 12.0 - (power_of<3>(lnm1) * ln_3) / 12.0 + (lnm1 * ln2squ * ln_3) / 4.0 + (pisqu * power_of<2>(ln_3)) / 6.0 + power_of<4>(ln_3) / 6.0 + (pisqu * ln2 * ln_4) / 12.0
+                + (5.0 * pisqu * power_of<2>(ln_4)) / 24.0 + (power_of<2>(lnm2) * power_of<2>(ln_4)) / 16.0 + (ln2 * power_of<3>(ln_4)) / 12.0 + power_of<4>(ln_4) / 24.0 + (pisqu * lnm2 * ln_5) / 12.0 + (power_of<3>(lnm2) * ln_5) / 12.0 - (pisqu * lnm1 * ln_5) / 12.0 - (power_of<3>(lnm1) * ln_5) / 12.0 + (lnm1 * ln2squ * ln_5) / 4.0 - (pisqu * ln_1 * ln_5) / 6.0 - (power_of<3>(ln_1) * ln_5) / 6.0 + (pisqu * power_of<2>(ln_5)) / 6.0 + power_of<4>(ln_5) / 6.0 + trilog(wx * xdinv) * (2.0 * ln2 + ln_3 + ln_5)
+                + (pisqu * ln2 * ln_6) / 6.0 - (ln2 * power_of<2>(ln_3) * ln_6) / 2.0 + (pisqu * ln_5 * ln_6) / 6.0 - (power_of<2>(ln_3) * ln_5 * ln_6) / 2.0 + (ln2 * power_of<3>(ln_6)) / 6.0 + (ln_5 * power_of<3>(ln_6)) / 6.0 + (pisqu * ln2 * ln_7) / 6.0 + (pisqu * ln_3 * ln_7) / 6.0 - (ln2 * power_of<2>(ln_5) * ln_7) / 2.0 - (ln_3 * power_of<2>(ln_5) * ln_7) / 2.0 + (ln2 * power_of<3>(ln_7)) / 6.0 + (ln_3 * power_of<3>(ln_7)) / 6.0 - (pisqu * ln2 * ln_8) / 3.0
+                - (power_of<2>(ln_1) * ln_5 * ln_8) / 2.0 - (pisqu * power_of<2>(ln_8)) / 4.0 - (power_of<2>(ln_5) * power_of<2>(ln_8)) / 2.0 - (ln2 * power_of<3>(ln_8)) / 3.0 - (ln_2 * power_of<3>(ln_8)) / 2.0 + power_of<4>(ln_8) / 4.0 - (pisqu * ln2 * ln_9) / 3.0 - (pisqu * power_of<2>(ln_9)) / 4.0 - (power_of<2>(ln_3) * power_of<2>(ln_9)) / 2.0 - (ln2 * power_of<3>(ln_9)) / 3.0 - (ln_4 * power_of<3>(ln_9)) / 2.0 + power_of<4>(ln_9) / 4.0 - (pisqu * ln_5 * ln_10) / 6.0 + (ln_5 * power_of<2>(ln_8) * ln_10) / 2.0
+                - (pisqu * power_of<2>(ln_10)) / 6.0 - (ln_5 * power_of<3>(ln_10)) / 6.0 + power_of<4>(ln_10) / 6.0 - (power_of<3>(ln_10) * log(-(wx / (-1.0i + wx)))) / 3.0 - (pisqu * lnm2 * ln_11) / 12.0 - (power_of<3>(lnm2) * ln_11) / 12.0 + (pisqu * lnm1 * ln_11) / 12.0 + (power_of<3>(lnm1) * ln_11) / 12.0 - (lnm1 * ln2squ * ln_11) / 4.0 + (power_of<2>(ln_2) * ln_7 * ln_11) / 2.0 - (pisqu * ln_9 * ln_11) / 6.0 - (power_of<3>(ln_9) * ln_11) / 6.0
+                + (pisqu * ln_12 * ln_11) / 3.0 - power_of<2>(ln_7) * ln_12 * ln_11 + (power_of<3>(ln_12) * ln_11) / 3.0 + (power_of<2>(ln_7) * power_of<2>(ln_11)) / 2.0 + ln2 * ln_8 * power_of<2>(ln_11) + (ln_2 * power_of<3>(ln_11)) / 3.0 - power_of<4>(ln_11) / 3.0 - (pisqu * ln_3 * ln_13) / 6.0 + (ln_3 * power_of<2>(ln_9) * ln_13) / 2.0 - (pisqu * power_of<2>(ln_13)) / 6.0 - (ln_3 * power_of<3>(ln_13)) / 6.0 + power_of<4>(ln_13) / 6.0
+                - (power_of<3>(ln_13) * ln_14) / 3.0 - (pisqu * ln2 * ln_15) / 6.0 - (pisqu * ln_3 * ln_15) / 6.0 + (pisqu * power_of<2>(ln_15)) / 24.0 - (ln_3 * ln_9 * power_of<2>(ln_15)) / 2.0 - (ln2 * power_of<3>(ln_15)) / 6.0 - (ln_3 * power_of<3>(ln_15)) / 6.0 - (pisqu * lnm2 * ln_16) / 12.0 - (power_of<3>(lnm2) * ln_16) / 12.0 + (pisqu * lnm1 * ln_16) / 12.0 + (power_of<3>(lnm1) * ln_16) / 12.0 - (lnm1 * ln2squ * ln_16) / 4.0
+                + (power_of<2>(ln_4) * ln_6 * ln_16) / 2.0 - (pisqu * ln_8 * ln_16) / 6.0 - (power_of<3>(ln_8) * ln_16) / 6.0 + (ln_8 * power_of<2>(ln_11) * ln_16) / 2.0 + (pisqu * ln_17 * ln_16) / 3.0 - power_of<2>(ln_6) * ln_17 * ln_16 + (power_of<3>(ln_17) * ln_16) / 3.0 + (power_of<2>(ln_6) * power_of<2>(ln_16)) / 2.0 + ln2 * ln_9 * power_of<2>(ln_16) + (ln_9 * ln_11 * power_of<2>(ln_16)) / 2.0
+                + (ln_4 * power_of<3>(ln_16)) / 3.0 - power_of<4>(ln_16) / 3.0 + ((pisqu * ln2) / 12.0 + (pisqu * ln_3) / 12.0) * ln_18 + (ln2 / 12.0 + ln_3 / 12.0) * power_of<3>(ln_18) + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * ln_16) / 6.0) * ln_19 + ((-1.0 / 6.0) * ln2 + ln_16 / 6.0) * power_of<3>(ln_19) + power_of<4>(ln_20) / 24.0 - (pisqu * ln_3 * ln_21) / 6.0 - (ln_3 * power_of<3>(ln_21)) / 6.0
+                - (pisqu * ln_5 * ln_22) / 6.0 - (ln_5 * power_of<3>(ln_22)) / 6.0 - power_of<4>(ln_23) / 12.0 + power_of<4>(ln_24) / 3.0 - (pisqu * ln_5 * log((1.0i * (wx - xd)) / (wx * (-1.0i + wx)))) / 6.0 - (ln_5 * power_of<3>(log((1.0i * (wx - xd)) / (wx * (-1.0i + wx))))) / 6.0 - (pisqu * ln_3 * log(((-1.0i) * (wx - xd)) / (wx * (1.0i + wx)))) / 6.0 - (ln_3 * power_of<3>(log(((-1.0i) * (wx - xd)) / (wx * (1.0i + wx))))) / 6.0
+                + trilog(wx / (wx - xd)) * (4.0 * ln2 + ln_3 / 2.0 + ln_5 / 2.0 + ln_11 + ln_16 + ln_25 / 2.0 + ln_26 / 2.0) + trilog((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * (ln2 + 2.0 * ln_3 + ln_11 / 2.0 - 2.0 * ln_27) - power_of<4>(ln_27) / 3.0 + trilog(-1.0i / xd) * (-2.0 * ln2 - ln_5 / 2.0 - ln_11 + ln_16 / 2.0 + 2.0 * ln_27)
+                + dilog((-1.0i + wx) / (wx - xd)) * (2.0 * ln2 * ln_11 + ln_11 * ln_16 - ln_5 * ln_27) + dilog((-1.0i + wx) / (-1.0i + xd)) * (-(ln2 * ln_5) - ln_3 * ln_5 - (ln_11 * ln_27) / 2.0) + trilog((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * (ln2 + 2.0 * ln_5 + ln_16 / 2.0 - 2.0 * ln_28) + trilog(xd / (-wx + xd)) * (-ln_27 - ln_28)
+                + power_of<3>(log(1.0i / (wx - xd))) * (ln2 / 6.0 + ln_5 / 12.0 + ln_27 / 6.0 - ln_28 / 4.0) + power_of<3>(ln_29) * ((-1.0 / 6.0) * ln2 - ln_3 / 12.0 + ln_27 / 12.0 - ln_28 / 12.0) + power_of<3>(ln_30) * ((-1.0 / 6.0) * ln2 - ln_5 / 12.0 - ln_27 / 12.0 + ln_28 / 12.0) + power_of<3>(log(-1.0i / (wx - xd))) * (ln2 / 6.0 + ln_3 / 12.0 - ln_27 / 4.0 + ln_28 / 6.0) - (pisqu * ln_31 * ln_28) / 3.0 - (power_of<3>(ln_31) * ln_28) / 3.0
+                - (pisqu * ln_32 * ln_28) / 3.0 - (power_of<3>(ln_32) * ln_28) / 3.0 - power_of<4>(ln_28) / 3.0 + trilog(1.0i / xd) * (-2.0 * ln2 - ln_3 / 2.0 + ln_11 / 2.0 - ln_16 + 2.0 * ln_28) + trilog(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) * (3.0 * ln_27 + 3.0 * ln_28) + trilog(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) * (3.0 * ln_27 + 3.0 * ln_28)
+                + log(1.0i / (wx - xd)) * ((pisqu * ln2) / 6.0 + (pisqu * ln_5) / 12.0 + (pisqu * ln_27) / 6.0 - (pisqu * ln_28) / 4.0) + ln_29 * ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * ln_3) / 12.0 + (pisqu * ln_27) / 12.0 - (pisqu * ln_28) / 12.0) + ln_30 * ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * ln_5) / 12.0 - (pisqu * ln_27) / 12.0 + (pisqu * ln_28) / 12.0) + log(-1.0i / (wx - xd)) * ((pisqu * ln2) / 6.0 + (pisqu * ln_3) / 12.0 - (pisqu * ln_27) / 4.0 + (pisqu * ln_28) / 6.0)
+                + dilog((1.0i + wx) / (wx - xd)) * (2.0 * ln2 * ln_16 + ln_11 * ln_16 - ln_3 * ln_28) + dilog(wx * xdinv) * ((ln2 + ln_5) * ln_27 + (ln2 + ln_3) * ln_28) + dilog((1.0i + wx) / (1.0i + xd)) * (-(ln2 * ln_3) - ln_3 * ln_5 - (ln_16 * ln_28) / 2.0) + dilog(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) * (-3.0 * ln_33 * ln_27 - 3.0 * ln_34 * ln_28)
+                + dilog(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) * (-3.0 * ln_33 * ln_27 - 3.0 * ln_34 * ln_28) + li2_5 * (li2_6 / 2.0 + li2_7 / 2.0 - li2_8 / 2.0 - li2_9 / 2.0 + (ln_26 * ln_27) / 2.0 + (ln_25 * ln_28) / 2.0) + ((-0.5) * ln2 + ln_3 / 4.0 - ln_5 / 3.0 - ln_11 / 6.0) * power_of<3>(ln_35)
+                + ((-0.5) * ln2 - ln_3 / 3.0 + ln_5 / 4.0 - ln_16 / 6.0) * power_of<3>(ln_36) + ((4.0 * ln2) / 3.0 + ln_11 / 4.0 + ln_16 / 4.0) * power_of<3>(ln_37) + ((pisqu * ln2) / 12.0 + (pisqu * ln_16) / 12.0) * ln_38 + (ln2 / 12.0 + ln_16 / 12.0) * power_of<3>(ln_38) + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * ln_11) / 6.0) * ln_39 + ((-1.0 / 6.0) * ln2 + ln_11 / 6.0) * power_of<3>(ln_39)
+                + (ln_5 * power_of<3>(ln_40)) / 6.0 + (ln_3 * power_of<3>(ln_41)) / 6.0 + power_of<2>(ln_23) * ((-5.0 * pisqu) / 12.0 - power_of<2>(lnm2) / 8.0 - power_of<2>(ln_2) / 16.0 - power_of<2>(ln_4) / 16.0 - (ln_7 * ln_11) / 2.0 - (ln_6 * ln_16) / 2.0 - (ln_28 * ln_42) / 2.0 - (ln_27 * ln_43) / 2.0) + dilog(xd / (-wx + xd)) * (ln_28 * ln_42 + ln_27 * ln_43)
+                + trilog(xd / wx) * (6.0 * ln2 + 2.0 * ln_11 + 2.0 * ln_16 - ln_27 / 2.0 - ln_28 / 2.0 + ln_44) + trilog(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * (2.0 * ln_27 + 2.0 * ln_28 + ln_44) + trilog(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) * (2.0 * ln_27 + 2.0 * ln_28 + ln_44) + trilog(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd))) * (2.0 * ln_27 + 2.0 * ln_28 + ln_44)
+                + trilog(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd))) * (2.0 * ln_27 + 2.0 * ln_28 + ln_44) - (pisqu * ln2 * ln_45) / 12.0 - (ln2 * power_of<3>(ln_45)) / 12.0 + (pisqu * ln2 * ln_46) / 6.0 + (ln2 * power_of<3>(ln_46)) / 6.0 + (pisqu * ln2 * ln_47) / 6.0 + (ln2 * power_of<3>(ln_47)) / 6.0 - (pisqu * ln2 * ln_48) / 12.0 - (ln2 * power_of<3>(ln_48)) / 12.0 + (ln_5 / 12.0 - ln_16 / 12.0) * power_of<3>(log(xd / (1.0i - xd)))
+                + ((pisqu * ln2) / 6.0 - (pisqu * ln_11) / 6.0) * log(((-1.0i) * wx * xd) / (wx - xd)) + (ln2 / 6.0 - ln_11 / 6.0) * power_of<3>(log(((-1.0i) * wx * xd) / (wx - xd))) + ((pisqu * ln2) / 6.0 - (pisqu * ln_16) / 6.0) * log((1.0i * wx * xd) / (wx - xd)) + (ln2 / 6.0 - ln_16 / 6.0) * power_of<3>(log((1.0i * wx * xd) / (wx - xd))) - (ln_3 * power_of<3>(ln_49)) / 6.0 - power_of<4>(ln_50) / 3.0 + log(xd / (1.0i - xd)) * ((pisqu * ln_5) / 12.0 - (pisqu * ln_16) / 12.0 + (2.0 * power_of<3>(ln_50)) / 3.0)
+                - (pisqu * ln_11 * ln_51) / 6.0 - (ln_11 * power_of<3>(ln_51)) / 6.0 + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * ln_3) / 12.0 - (pisqu * ln_16) / 4.0) * ln_52 + ((-1.0 / 6.0) * ln2 + ln_3 / 12.0 - ln_16 / 4.0) * power_of<3>(ln_52) + (ln_53 * ln_44 * power_of<2>(ln_54)) / 2.0
+                + dilog(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) * (ln_26 * (-2.0 * ln_27 - 2.0 * ln_28) + ln_44 * ln_54) + dilog(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd))) * (ln_26 * (-2.0 * ln_27 - 2.0 * ln_28) + ln_44 * ln_54) + trilog((-1.0i + wx) / (2.0 * wx)) * ((-0.5) * lnhalf + ln_26 / 2.0 - ln_27 - ln_28 - ln_44 + ln_55)
+                + ((-1.0 / 12.0) * (pisqu * ln2) - (pisqu * ln_3) / 12.0) * log((1.0i * xd) / (wx * (-1.0i + xd))) + ((-1.0 / 12.0) * ln2 - ln_3 / 12.0) * power_of<3>(log((1.0i * xd) / (wx * (-1.0i + xd)))) + (ln_11 * power_of<3>(ln_56)) / 6.0 + (pisqu * ln2 * ln_57) / 6.0 + (ln2 * power_of<3>(ln_57)) / 6.0 + trilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) * (2.0 * ln2 + 2.0 * ln_3 - ln_5 / 2.0 + (3.0 * ln_11) / 2.0 + ln_27 / 2.0 + ln_44 - ln_58 / 2.0)
+                + trilog((1.0i + xd) / (1.0i + wx)) * (lnhalf - ln2 - 2.0 * ln_3 - 2.0 * ln_9 - ln_11 / 2.0 - ln_17 + 3.0 * ln_59 - ln_16 - (5.0 * ln_26) / 2.0 - 3.0 * ln_27 - 3.0 * ln_28 + 3.0 * ln_43 - ln_44 - ln_60 / 2.0 - ln_61 + ln_62) - (ln_11 * power_of<3>(ln_63)) / 3.0 - power_of<4>(ln_64) / 3.0
+                + ((-1.0 / 6.0) * (pisqu * ln2) + (pisqu * ln_5) / 12.0 - (pisqu * ln_11) / 4.0) * ln_65 + ((-1.0 / 6.0) * ln2 + ln_5 / 12.0 - ln_11 / 4.0) * power_of<3>(ln_65) + (ln_66 * ln_44 * power_of<2>(ln_67)) / 2.0 + dilog(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) * (ln_25 * (-2.0 * ln_27 - 2.0 * ln_28) + ln_44 * ln_67)
+                + dilog(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd))) * (ln_25 * (-2.0 * ln_27 - 2.0 * ln_28) + ln_44 * ln_67) + trilog((1.0i + wx) / (2.0 * wx)) * ((-0.5) * lnhalf + ln_25 / 2.0 - ln_27 - ln_28 - ln_44 + ln_68) + power_of<2>(ln_26) * (-(ln_53 * ln_28) - ln_28 * ln_69)
+                + ((pisqu * ln_3) / 12.0 - (pisqu * ln_11) / 12.0) * ln_70 + (ln_3 / 12.0 - ln_11 / 12.0) * power_of<3>(ln_70) + (ln_16 * power_of<3>(ln_71)) / 6.0 + ((ln2squ * ln_3) / 4.0 - (ln2squ * ln_11) / 4.0) * log((-1.0i + xd) / (1.0i + xd)) + (pisqu * ln2 * ln_72) / 6.0 + (ln2 * power_of<3>(ln_72)) / 6.0
+                + trilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) * (2.0 * ln2 - ln_3 / 2.0 + 2.0 * ln_5 + (3.0 * ln_16) / 2.0 + ln_28 / 2.0 + ln_44 - ln_73 / 2.0) + trilog(1.0 - xd / wx) * (4.0 * ln2 - (3.0 * ln_3) / 2.0 - (3.0 * ln_5) / 2.0 + ln_10 - 3.0 * ln_11 + ln_13 - 3.0 * ln_16 + ln_27 / 2.0 + ln_28 / 2.0 - ln_60 / 2.0 + ln_58 - ln_74 / 2.0 + ln_73)
+                + (pisqu * ln_16 * ln_75) / 3.0 + (ln_16 * power_of<3>(ln_75)) / 3.0 + trilog((-wx + xd) / (1.0i + xd)) * (-2.0 * ln2 - 2.0 * ln_3 + ln_5 / 2.0 - (3.0 * ln_11) / 2.0 - 2.0 * ln_27 - 3.0 * ln_28 - ln_44 - ln_64 / 2.0 + ln_76 / 2.0 - ln_77 / 2.0)
+                + trilog((-wx + xd) / (-1.0i + xd)) * (-2.0 * ln2 + ln_3 / 2.0 - 2.0 * ln_5 - (3.0 * ln_16) / 2.0 - 3.0 * ln_27 - 2.0 * ln_28 - ln_44 - ln_50 / 2.0 - ln_76 / 2.0 + ln_77 / 2.0) + power_of<4>(ln_78) / 24.0
+                + li2_10 * ((-5.0 * pisqu) / 6.0 + li2_11 + li2_12 - 2.0 * li2_13 - 2.0 * li2_14 - power_of<2>(lnm2) / 2.0 - power_of<2>(ln_1) / 2.0 - ln2 * ln_3 - power_of<2>(ln_3) - ln2 * ln_5 - power_of<2>(ln_5) + ln_79 * ln_11 - (3.0 * power_of<2>(ln_11)) / 2.0 - ln_11 * ln_80 - power_of<2>(ln_15) / 2.0 - ln_11 * ln_81 + ln_82 * ln_16
+                - ln_83 * ln_16 - ln_84 * ln_16 - (3.0 * power_of<2>(ln_16)) / 2.0 - power_of<2>(ln_85) / 2.0 + power_of<2>(ln_27) / 2.0 - power_of<2>(ln_86) / 2.0 + power_of<2>(ln_28) / 2.0 + ln_27 * (ln_5 - ln_11 + ln_26 / 2.0 - 2.0 * ln_28 + 2.0 * ln_43 + ln_60 / 2.0 - log((2.0 * xd) / (-1.0i + xd)) + log((-1.0i + xd) / (2.0 * xd)))
+                + ln_28 * (ln_3 - ln_16 + ln_25 / 2.0 + 2.0 * ln_42 + ln_74 / 2.0 - log((2.0 * xd) / (1.0i + xd)) + log((1.0i + xd) / (2.0 * xd)))) + trilog((-1.0i + xd) / (-1.0i + wx)) * (lnhalf - ln2 - 2.0 * ln_5 - 2.0 * ln_8 - ln_12 - ln_11 - ln_16 / 2.0 + 3.0 * ln_87 - (5.0 * ln_25) / 2.0 - 3.0 * ln_27 - 3.0 * ln_28 + 3.0 * ln_42 - ln_44 - ln_74 / 2.0 - ln_88
+                + ln_89) + ((pisqu * ln2) / 12.0 + (pisqu * ln_5) / 12.0) * ln_90 + (ln2 / 12.0 + ln_5 / 12.0) * power_of<3>(ln_90) - (ln_16 * power_of<3>(ln_91)) / 3.0 + ((ln2squ * ln_5) / 4.0 - (ln2squ * ln_16) / 4.0) * log((1.0i + xd) / (-1.0i + xd)) + ((-0.25) * (ln2 * power_of<2>(ln_5)) - (ln_3 * power_of<2>(ln_5)) / 4.0 - (ln2 * power_of<2>(ln_11)) / 2.0) * ln_92
+                + ((-0.25) * (ln2 * power_of<2>(ln_3)) - (power_of<2>(ln_3) * ln_5) / 4.0 - (ln2 * power_of<2>(ln_16)) / 2.0) * ln_93 + trilog(-1.0i / wx) * ((-0.5) * ln_5 + ln_11 / 2.0 + 8.0 * ln_27 + (5.0 * ln_28) / 2.0 + ln_44 - 4.0 * ln_94) + trilog(1.0i / wx) * ((-0.5) * ln_3 + ln_16 / 2.0 + (5.0 * ln_27) / 2.0 + 8.0 * ln_28 + ln_44 - 4.0 * ln_94)
+                + trilog(1.0i * wx) * (-ln2 + (5.0 * ln_27) / 2.0 - (3.0 * ln_28) / 2.0 - 3.0 * ln_94) + trilog((-1.0i) * wx) * (-ln2 - (3.0 * ln_27) / 2.0 + (5.0 * ln_28) / 2.0 - 3.0 * ln_94) + dilog((-1.0i + xd) / (2.0 * xd)) * ln_28 * (-ln_3 + ln_11 - 2.0 * ln_94) + li2_13 * ln_28 * ((-3.0 * ln_5) / 2.0 + ln_11 + ln_16 / 2.0 - 2.0 * ln_94)
+                + dilog((1.0i + xd) / (2.0 * xd)) * ln_27 * (-ln_5 + ln_16 - 2.0 * ln_94) + li2_14 * ln_27 * ((-3.0 * ln_3) / 2.0 + ln_11 / 2.0 + ln_16 - 2.0 * ln_94) + trilog(1.0i * xd) * (-ln2 + ln_3 / 2.0 - (3.0 * ln_5) / 2.0 - ln_16 - ln_27 / 2.0 - (5.0 * ln_28) / 2.0 - ln_44 - ln_94)
+                + trilog((-1.0i) * xd) * (-ln2 - (3.0 * ln_3) / 2.0 + ln_5 / 2.0 - ln_11 - (5.0 * ln_27) / 2.0 - ln_28 / 2.0 - ln_44 - ln_94) + trilog((wx - 1.0i * wx * xd) / (wx - xd)) * (-2.0 * ln2 - ln_5 - 3.0 * ln_16 - ln_26 / 2.0 - ln_27 / 2.0 + ln_60 / 2.0 - ln_94)
+                + trilog((wx + 1.0i * wx * xd) / (wx - xd)) * (-2.0 * ln2 - ln_3 - 3.0 * ln_11 - ln_25 / 2.0 - ln_28 / 2.0 + ln_74 / 2.0 - ln_94) + trilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * (-lnhalf - ln2 - 3.0 * ln_11 - ln_13 - ln_27 / 2.0 + ln_28 / 2.0 + (5.0 * ln_50) / 2.0 + ln_76 / 2.0 - ln_77 / 2.0 - ln_94)
+                + trilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * (-lnhalf - ln2 - ln_10 - 3.0 * ln_16 + ln_27 / 2.0 - ln_28 / 2.0 + (5.0 * ln_64) / 2.0 - ln_76 / 2.0 + ln_77 / 2.0 - ln_94) + power_of<3>(ln_24) * ((-2.0 * log(xd / (wx - xd))) / 3.0 - ln_94 / 3.0) + power_of<3>(ln_50) * ((-1.0 / 6.0) * ln_3 + ln_11 / 12.0 + ln_16 / 6.0 - ln_94 / 4.0)
+                + power_of<3>(ln_64) * ((-1.0 / 6.0) * ln_5 + ln_11 / 6.0 + ln_16 / 12.0 + (2.0 * ln_70) / 3.0 - ln_94 / 4.0) + power_of<3>(log((1.0i * wx * (1.0i + wx)) / (wx - xd))) * (ln_3 / 6.0 - ln_94 / 6.0) + power_of<3>(log(((-1.0 - 1.0i * wx) * wx) / (wx - xd))) * (ln_5 / 6.0 - ln_94 / 6.0) + power_of<3>(log((-2.0 * 1.0i) * xd)) * ((-1.0 / 12.0) * ln_3 - ln_94 / 12.0) + power_of<3>(log((2.0 * 1.0i) * xd)) * ((-1.0 / 12.0) * ln_5 - ln_94 / 12.0)
+                + power_of<3>(log(1.0i / 2.0 * xdinv)) * (ln_3 / 12.0 - ln_11 / 6.0 + ln_94 / 4.0) + power_of<3>(log(((-0.5) * 1.0i) * xdinv)) * (ln_5 / 12.0 - ln_16 / 6.0 + ln_94 / 4.0) + (pisqu * ln_95 * ln_94) / 6.0 + (power_of<3>(ln_95) * ln_94) / 6.0 + (power_of<3>(ln_96) * ln_94) / 6.0 + (power_of<3>(ln_97) * ln_94) / 6.0 + (pisqu * ln_98 * ln_94) / 6.0 + (power_of<3>(ln_98) * ln_94) / 6.0 + power_of<4>(ln_94) / 3.0
+                + trilog((-1.0i + wx) / (-1.0i + xd)) * (ln2 + ln_3 + ln_27 / 2.0 - ln_44 + ln_94) + trilog((1.0i + wx) / (1.0i + xd)) * (ln2 + ln_5 + ln_28 / 2.0 - ln_44 + ln_94) + trilog((1.0i - xd) / (1.0i + xd)) * ((3.0 * ln_5) / 2.0 - ln_11 - ln_16 / 2.0 - ln_96 + ln_34 + 2.0 * ln_94)
+                + trilog((1.0i + xd) / (1.0i - xd)) * ((3.0 * ln_3) / 2.0 - ln_11 / 2.0 - ln_16 - ln_97 + ln_33 + 2.0 * ln_94) + trilog((-2.0 * 1.0i) / (-1.0i + wx)) * (ln_12 - ln_34 + ln_27 + 3.0 * ln_28 - ln_76 / 2.0 + 2.0 * ln_94) + trilog((2.0 * 1.0i) / (1.0i + wx)) * (ln_17 - ln_33 + 3.0 * ln_27 + ln_28 - ln_77 / 2.0 + 2.0 * ln_94)
+                + trilog(-1.0) * (ln_3 + ln_5 - ln_11 - ln_16 + ln_27 + ln_28 + 2.0 * ln_44 + 8.0 * ln_94) + log((1.0i * wx * (1.0i + wx)) / (wx - xd)) * ((pisqu * ln_3) / 6.0 - (pisqu * ln_94) / 6.0) + log(((-1.0 - 1.0i * wx) * wx) / (wx - xd)) * ((pisqu * ln_5) / 6.0 - (pisqu * ln_94) / 6.0) + log((-2.0 * 1.0i) * xd) * ((-1.0 / 12.0) * (pisqu * ln_3) - (pisqu * ln_94) / 12.0) + log((2.0 * 1.0i) * xd) * ((-1.0 / 12.0) * (pisqu * ln_5) - (pisqu * ln_94) / 12.0)
+                + log(1.0i / 2.0 * xdinv) * ((pisqu * ln_3) / 12.0 - (pisqu * ln_11) / 6.0 + (pisqu * ln_94) / 4.0) + log(((-0.5) * 1.0i) * xdinv) * ((pisqu * ln_5) / 12.0 - (pisqu * ln_16) / 6.0 + (pisqu * ln_94) / 4.0);
 
-            const complex<double> part3 = + dilog((-2.0 * 1.0i) / (-1.0i + wx)) * (dilog((-1.0i) * xd) / 2.0 - dilog(1.0i * xd) + dilog((-1.0i + xd) / (-1.0i + wx)) - dilog((2.0 * xd) / (1.0i + xd)) / 4.0 - 2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + log(1.0 - 1.0i * xd) * (-ln2 - 2.0 * log(1.0 + 1.0i * xd)) + 3.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) - 2.0 * ln2 * log(1.0 - xd / wx))
-                + dilog((2.0 * 1.0i) / (1.0i + wx)) * (-dilog((-1.0i) * xd) + dilog(1.0i * xd) / 2.0 - dilog((2.0 * xd) / (-1.0i + xd)) / 4.0 + dilog((1.0i + xd) / (1.0i + wx)) + 3.0 * log(0.5 + (1.0i / 2.0) * xd) * log(1.0 - 1.0i * xd) - ln2 * log(1.0 + 1.0i * xd) - 2.0 * log(1.0 - 1.0i * xd) * log(1.0 + 1.0i * xd) - 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) - 2.0 * ln2 * log(1.0 - xd / wx)) + dilog((2.0 * 1.0i) / (1.0i + xd)) * ((ln2 * log(1.0 - 1.0i * wx)) / 2.0 - (ln2 * log((-1.0i + wx) / wx)) / 2.0 + 2.0 * ln2 * log(1.0 - xd / wx)) + dilog((-2.0 * 1.0i) / (-1.0i + xd)) * ((ln2 * log(1.0 + 1.0i * wx)) / 2.0 - (ln2 * log((1.0i + wx) / wx)) / 2.0 + 2.0 * ln2 * log(1.0 - xd / wx))
-                + dilog((2.0 * wx) / (-1.0i + wx)) * (pisqu / 24.0 + dilog((-1.0i + wx) / wx) / 4.0 + dilog((wx - xd) / (-1.0i + wx)) / 2.0 - dilog(1.0i * xd) / 2.0 + dilog((2.0 * xd) / (-1.0i + xd)) / 4.0 + power_of<2>(log(-1.0 + 1.0i / wx)) / 8.0 + ln2 * log(1.0 - 1.0i * xd) + 2.0 * ln2 * log(1.0 - xd / wx)) + dilog((2.0 * wx) / (1.0i + wx)) * (pisqu / 24.0 + dilog((1.0i + wx) / wx) / 4.0 + dilog((wx - xd) / (1.0i + wx)) / 2.0 - dilog((-1.0i) * xd) / 2.0 + dilog((2.0 * xd) / (1.0i + xd)) / 4.0 + power_of<2>(log(-((1.0i + wx) / wx))) / 8.0 + ln2 * log(1.0 + 1.0i * xd) + 2.0 * ln2 * log(1.0 - xd / wx))
-                + dilog(-1.0i / xd) * (((-0.5) * log(1.0 + 1.0i * wx) + log((1.0i + wx) / wx) / 2.0) * log(1.0 + 1.0i * xd) + (-2.0 * ln2 - log((-1.0i + wx) / wx)) * log(1.0 - xd / wx)) + dilog((1.0i - wx) / (1.0i + wx)) * ((-1.0 / 12.0) * pisqu + dilog((-1.0i) * xd) - dilog((1.0i + xd) / (1.0i + wx)) - dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 4.0 + (2.0 * lnhalf - log((-1.0i + wx) / wx) / 2.0) * log(1.0 - 1.0i * xd) + (2.0 * lnhalf - (3.0 * log(1.0 + 1.0i * wx)) / 2.0 + log((-1.0i + wx) / wx)) * log(1.0 + 1.0i * xd) - log(1.0 - 1.0i * wx) * log(xd) + (log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx)) * log(1.0 - xd / wx))
-                + dilog((-1.0i + wx) / (2.0 * wx)) * (dilog(0.5 - (1.0i / 2.0) * xd) / 4.0 - dilog(xd / wx) + dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) / 2.0 + (2.0 * lnhalf - log(1.0 + 1.0i * wx)) * log(1.0 - 1.0i * xd) + (2.0 * lnhalf + log(1.0 + 1.0i * wx) - 2.0 * log((-1.0i + wx) / wx)) * log(1.0 + 1.0i * xd) - log(1.0 - 1.0i * wx) * log(xd) + (-log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx)) * log(1.0 - xd / wx)) + dilog(1.0i / xd) * (((-0.5) * log(1.0 - 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0) * log(1.0 - 1.0i * xd) + (-2.0 * ln2 - log((1.0i + wx) / wx)) * log(1.0 - xd / wx))
-                + dilog((1.0i + wx) / (1.0i - wx)) * ((-1.0 / 12.0) * pisqu + dilog(1.0i * xd) - dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 - dilog((-1.0i + xd) / (-1.0i + wx)) - power_of<2>(log(-1.0 - 1.0i * wx)) / 4.0 + (2.0 * lnhalf - (3.0 * log(1.0 - 1.0i * wx)) / 2.0 + log((1.0i + wx) / wx)) * log(1.0 - 1.0i * xd) + (2.0 * lnhalf - log((1.0i + wx) / wx) / 2.0) * log(1.0 + 1.0i * xd) - log(1.0 + 1.0i * wx) * log(xd) + (log(1.0 - 1.0i * wx) - log((1.0i + wx) / wx)) * log(1.0 - xd / wx))
-                + dilog((1.0i + wx) / (2.0 * wx)) * (dilog(0.5 + (1.0i / 2.0) * xd) / 4.0 - dilog(xd / wx) + dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) / 2.0 + (2.0 * lnhalf + log(1.0 - 1.0i * wx) - 2.0 * log((1.0i + wx) / wx)) * log(1.0 - 1.0i * xd) + (2.0 * lnhalf - log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * xd) - log(1.0 + 1.0i * wx) * log(xd) + (-log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx)) * log(1.0 - xd / wx))
-                + dilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) * (log((1.0i + wx) / (wx - xd)) * log(1.0 - 1.0i * xd) + log(1.0 - 1.0i * xd) * (log((wx - xd) / (1.0i + wx)) - log(1.0 - xd / wx) / 2.0) + (-2.0 * ln2 + log(1.0 + 1.0i * wx) / 2.0 - (3.0 * log((-1.0i + wx) / wx)) / 2.0 - log(xd)) * log(1.0 - xd / wx)) + dilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) * (log((-1.0i + wx) / (wx - xd)) * log(1.0 + 1.0i * xd) + log(1.0 + 1.0i * xd) * (log((wx - xd) / (-1.0i + wx)) - log(1.0 - xd / wx) / 2.0) + (-2.0 * ln2 + log(1.0 - 1.0i * wx) / 2.0 - (3.0 * log((1.0i + wx) / wx)) / 2.0 - log(xd)) * log(1.0 - xd / wx))
-                + dilog((-wx + xd) / (1.0i + xd)) * (pisqu / 24.0 + 2.0 * log(1.0 - 1.0i * wx) * log(1.0i * wx) - log((1.0i + wx) / (wx - xd)) * log(1.0 - 1.0i * xd) + 3.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + power_of<2>(log(-((1.0i + xd) * xdinv))) / 8.0 + log(1.0 - 1.0i * xd) * (log((wx - xd) / (1.0i + wx)) + log(1.0 - xd / wx) / 2.0) + (2.0 * ln2 - log(1.0 + 1.0i * wx) / 2.0 + (3.0 * log((-1.0i + wx) / wx)) / 2.0 + log(xd)) * log(1.0 - xd / wx))
-                + dilog((-wx + xd) / (-1.0i + xd)) * (pisqu / 24.0 + 2.0 * log(1.0 + 1.0i * wx) * log((-1.0i) * wx) + power_of<2>(log(-1.0 + 1.0i / xd)) / 8.0 + 3.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) - log((-1.0i + wx) / (wx - xd)) * log(1.0 + 1.0i * xd) + log(1.0 + 1.0i * xd) * (log((wx - xd) / (-1.0i + wx)) + log(1.0 - xd / wx) / 2.0) + (2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 + (3.0 * log((1.0i + wx) / wx)) / 2.0 + log(xd)) * log(1.0 - xd / wx))
-                + dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * ((13.0 * pisqu) / 24.0 - (3.0 * dilog((-1.0i + xd) * xdinv)) / 4.0 - dilog((1.0i + xd) / (-1.0i + xd)) + ln2 * log(1.0 + 1.0i * wx) + log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx) + lnhalf * log((-1.0i + wx) / wx) - log(1.0 - 1.0i * wx) * log((-1.0i + wx) / wx) + (3.0 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + log((-1.0i + wx) / wx) * log(1.0i / (1.0i + wx)) + power_of<2>(log(-((1.0i + wx) / wx))) / 2.0 - (3.0 * power_of<2>(log(-1.0 + 1.0i / xd))) / 8.0 + (log((-1.0i + wx) / wx) * log(1.0 - 1.0i * xd)) / 2.0 - 2.0 * log(1.0 + 1.0i * xd) * log((-1.0i) * xd) + log(xd / wx) * log(1.0 - xd / wx))
-                + dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * ((13.0 * pisqu) / 24.0 - dilog((-1.0i + xd) / (1.0i + xd)) - (3.0 * dilog((1.0i + xd) * xdinv)) / 4.0 + power_of<2>(log(-1.0 + 1.0i / wx)) / 2.0 + ln2 * log(1.0 - 1.0i * wx) + log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx) + lnhalf * log((1.0i + wx) / wx) - log(1.0 + 1.0i * wx) * log((1.0i + wx) / wx) + log(-1.0i / (-1.0i + wx)) * log((1.0i + wx) / wx) + (3.0 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (log((1.0i + wx) / wx) * log(1.0 + 1.0i * xd)) / 2.0 - 2.0 * log(1.0 - 1.0i * xd) * log(1.0i * xd) - (3.0 * power_of<2>(log(-((1.0i + xd) * xdinv)))) / 8.0 + log(xd / wx) * log(1.0 - xd / wx))
-                + dilog((-1.0i + xd) / (-wx + xd)) * (-3.0 * log(1.0i / wx) * log((-1.0i + wx) / wx) + (-2.0 * ln2 - log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * xd) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(0.5 + (1.0i / 2.0) * xd) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) - log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx)) + dilog((wx + 1.0i * wx * xd) / (wx - xd)) * ((2.0 * ln2 + log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * xd) + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx))
-                + power_of<2>(log(xd / wx)) * ((-0.5) * (log(-1.0i / (-1.0i + xd)) * log(1.0 - xd / wx)) + (log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) * log(1.0 - xd / wx)) / 2.0 - (log(1.0i / (1.0i + xd)) * log(1.0 - xd / wx)) / 2.0 + (log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) * log(1.0 - xd / wx)) / 2.0) + dilog(-((1.0i + xd) / (wx - xd))) * (dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 4.0 - 3.0 * log(-1.0i / wx) * log((1.0i + wx) / wx) + (-2.0 * ln2 - log(1.0 + 1.0i * wx) + 2.0 * log(0.5 - (1.0i / 2.0) * xd)) * log(1.0 - 1.0i * xd) - power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + 2.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) - log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx))
-                + dilog((wx - 1.0i * wx * xd) / (wx - xd)) * ((2.0 * ln2 + log(1.0 + 1.0i * wx)) * log(1.0 - 1.0i * xd) + power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx)) + log((1.0i * (1.0i + wx) * xd) / (wx - xd)) * ((-1.0 / 6.0) * (pisqu * log(1.0 - 1.0i * wx)) + (log(1.0 - 1.0i * wx) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + xd))))) / 2.0 + (power_of<2>(log((1.0i + xd) / (1.0i + wx))) * log(1.0 - xd / wx)) / 2.0)
-                + dilog((1.0i + xd) / (-1.0i + xd)) * ((-1.0 / 12.0) * pisqu - power_of<2>(log(-1.0 + 1.0i / xd)) / 4.0 - log(xd) * log((1.0i + wx) / (1.0i + xd)) + log(1.0 - 1.0i * xd) * ((3.0 * log(1.0 - 1.0i * wx)) / 2.0 - log((-1.0i + wx) / wx) / 2.0 - log((1.0i + wx) / wx) + 2.0 * log(1.0 - xd / wx))) + dilog((-1.0i + xd) / (1.0i + xd)) * ((-1.0 / 12.0) * pisqu - dilog((1.0i + xd) * xdinv) / 2.0 - log(xd) * log((-1.0i + wx) / (-1.0i + xd)) - power_of<2>(log(-((1.0i + xd) * xdinv))) / 4.0 + log(1.0 + 1.0i * xd) * ((3.0 * log(1.0 + 1.0i * wx)) / 2.0 - log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) / 2.0 + 2.0 * log(1.0 - xd / wx)))
-                + ((2.0 * pisqu * ln2) / 3.0 + (pisqu * log(1.0 - 1.0i * wx)) / 12.0 + (pisqu * log(1.0 + 1.0i * wx)) / 12.0) * log(-1.0 + xd / wx) + ((-1.0 / 24.0) * pisqu - power_of<2>(lnm2) / 8.0) * power_of<2>(log(-1.0 + xd / wx)) + ((2.0 * ln2) / 3.0 + log(1.0 - 1.0i * wx) / 12.0 + log(1.0 + 1.0i * wx) / 12.0) * power_of<3>(log(-1.0 + xd / wx)) + (pisqu * log(1.0 + 1.0i * wx) * log((1.0i * xd) / (1.0i * wx - wx * xd))) / 6.0 + (log(1.0 + 1.0i * wx) * power_of<3>(log((1.0i * xd) / (1.0i * wx - wx * xd)))) / 6.0 + ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * log(1.0 - 1.0i * wx)) / 12.0) * log((1.0i * wx) / (1.0i * xd - wx * xd)) + ((-1.0 / 6.0) * ln2 - log(1.0 - 1.0i * wx) / 12.0) * power_of<3>(log((1.0i * wx) / (1.0i * xd - wx * xd)))
-                + trilog((1.0i + wx) / (-1.0i + wx)) * (log(1.0 + 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) / 2.0 + (5.0 * log(1.0 - 1.0i * xd)) / 2.0 - log(1.0 + 1.0i * xd) / 2.0 - log((-1.0i + wx) / (-1.0i + xd)) / 2.0 + log((-1.0i + xd) / (-1.0i + wx)) / 2.0 + log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - log((wx - 1.0i * wx * xd) / (wx - xd))) + trilog((-1.0i + xd) / (-wx + xd)) * (2.0 * ln2 + log(1.0 - 1.0i * wx) + 3.0 * log((-1.0i + wx) / wx) - log(wx / (wx - xd)) / 2.0 - 2.0 * log(1.0 - 1.0i * xd) - (3.0 * log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0)
-                + trilog((-1.0i + xd) / (1.0i + xd)) * ((-3.0 * log(1.0 + 1.0i * wx)) / 2.0 + log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) / 2.0 - log(1.0 - 1.0i * xd) - log(xd) + log(1.0i / (1.0i + xd)) - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - 2.0 * log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd))) + dilog((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * ((-ln2 - log((-1.0i + wx) / wx) / 2.0) * log(1.0 - 1.0i * xd) + 2.0 * power_of<2>(log(1.0 - 1.0i * xd)) + log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd)))
-                + dilog((1.0i + xd) / (1.0i + wx)) * (pisqu / 12.0 + dilog((1.0i + xd) / (1.0i - xd)) - power_of<2>(log(-1.0 + 1.0i * wx)) / 4.0 + power_of<2>(log(-1.0 - 1.0i * xd)) / 2.0 - (3.0 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + 2.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) + (3.0 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + log(1.0 - 1.0i * xd) * (-lnhalf + ln2 + log((-1.0i + wx) / wx) / 2.0 + 2.0 * log(0.5 - (1.0i / 2.0) * xd) + log(xd / (-1.0i + xd)) - log((-1.0i + xd) * xdinv)) - log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd)))
-                + dilog(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * (2.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) + 2.0 * log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + (2.0 * ln2 + log(1.0 + 1.0i * wx) / 2.0 - (3.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(xd)) * log(1.0 - xd / wx) - log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd))) + log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * ((pisqu * log(1.0 - 1.0i * wx)) / 6.0 - (log(1.0 - 1.0i * wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0)
-                + log((wx - xd) / (1.0i + wx)) * ((power_of<2>(log(-1.0i / wx)) * log((1.0i + wx) / wx)) / 2.0 - power_of<3>(log(1.0 - 1.0i * xd)) + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * log(1.0 + 1.0i * xd) + 2.0 * log(0.5 - (1.0i / 2.0) * xd) * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * ((-1.0 / 6.0) * pisqu + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) + 2.0 * log(0.5 - (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0) + power_of<2>(log(1.0 - 1.0i * xd)) * ((-0.5) * lnhalf + (3.0 * ln2) / 4.0 + log(1.0 + 1.0i * wx) / 4.0 + log((-1.0i + wx) / wx) / 4.0 - log(1.0 + 1.0i * xd) - log(xd) / 2.0 - log(xd / wx) / 2.0 + log(xd / (-1.0i + xd)) / 2.0 + (3.0 * log((-1.0i + xd) / (-1.0i + wx))) / 2.0)
-                + (log(1.0 - 1.0i * wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0) + log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * ((pisqu * log((1.0i + wx) / wx)) / 6.0 + (-ln2 + log(1.0 + 1.0i * wx) / 4.0 - (3.0 * log((-1.0i + wx) / wx)) / 4.0) * power_of<2>(log(1.0 - xd / wx)) - (log((1.0i + wx) / wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0) + log((1.0i + wx) / (1.0i + xd)) * ((log(1.0 - 1.0i * wx) * power_of<2>(log(1.0i * wx))) / 2.0 + (ln2 - log(1.0 + 1.0i * wx) / 4.0 + (3.0 * log((-1.0i + wx) / wx)) / 4.0) * power_of<2>(log(1.0 - xd / wx)) + (log((1.0i + wx) / wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0) + (pisqu * log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (1.0i - wx))) / 3.0
-                + (log((-1.0i + wx) / wx) * power_of<3>(log((wx + 1.0i * wx * xd) / (1.0i - wx)))) / 3.0 + trilog((-1.0i + wx) / (1.0i + wx)) * (log(1.0 - 1.0i * wx) / 2.0 - log(1.0i / (1.0i + wx)) / 2.0 - log(1.0 - 1.0i * xd) / 2.0 + (5.0 * log(1.0 + 1.0i * xd)) / 2.0 + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log((1.0i + wx) / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i + wx)) / 2.0 - log((wx + 1.0i * wx * xd) / (wx - xd))) + trilog(-((1.0i + xd) / (wx - xd))) * (2.0 * ln2 + log(1.0 + 1.0i * wx) + 3.0 * log((1.0i + wx) / wx) - log(wx / (wx - xd)) / 2.0 - (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - 2.0 * log(1.0 + 1.0i * xd) + log(1.0 - xd / wx) + log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0)
-                + trilog((1.0i + xd) / (-1.0i + xd)) * ((-3.0 * log(1.0 - 1.0i * wx)) / 2.0 + log((-1.0i + wx) / wx) / 2.0 + log((1.0i + wx) / wx) - log(1.0 + 1.0i * xd) - log(xd) + log(-1.0i / (-1.0i + xd)) - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - 2.0 * log(1.0 - xd / wx) + log((wx + 1.0i * wx * xd) / (wx - xd))) + dilog((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * ((-ln2 - log((1.0i + wx) / wx) / 2.0) * log(1.0 + 1.0i * xd) + 2.0 * power_of<2>(log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd)))
-                + dilog(1.0 - wx * xdinv) * ((-0.5) * pisqu + dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(log(-1.0 - 1.0i * wx)) / 8.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 8.0 - log(1.0i / wx) * log((-1.0i + wx) / wx) - log(-1.0i / wx) * log((1.0i + wx) / wx) - 2.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) - 2.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))
-                + (-8.0 * ln2 - (3.0 * log((-1.0i + wx) / wx)) / 2.0 - (3.0 * log((1.0i + wx) / wx)) / 2.0) * log(1.0 - xd / wx) + log(1.0 + 1.0i * xd) * (-log((-1.0i) * xd) + log(1.0 - xd / wx)) + log(1.0 - 1.0i * xd) * (-log(1.0i * xd) + log(1.0 - xd / wx)) - log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) - log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd)))
-                + dilog((-1.0i + xd) / (-1.0i + wx)) * (pisqu / 12.0 - dilog(1.0i / (1.0i + xd)) + dilog((1.0i - xd) / (1.0i + xd)) - power_of<2>(log(-1.0 - 1.0i * wx)) / 4.0 + (3.0 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + power_of<2>(log(-1.0 + 1.0i * xd)) / 2.0 - (3.0 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + log(0.5 + (1.0i / 2.0) * xd) * (2.0 * log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd)) - log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + log(1.0 + 1.0i * xd) * (-lnhalf + ln2 + log((1.0i + wx) / wx) / 2.0 + log(xd / (1.0i + xd)) - log((1.0i + xd) * xdinv)) + log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd)))
-                + dilog((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * (2.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + 2.0 * log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + (2.0 * ln2 + log(1.0 - 1.0i * wx) / 2.0 - (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - log(xd)) * log(1.0 - xd / wx) - log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)))
-                + dilog(1.0 - xd / wx) * ((-1.0 / 12.0) * pisqu - power_of<2>(lnm2) / 4.0 - log((1.0i + wx) / (wx - xd)) * log(1.0 - 1.0i * xd) - power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 - log((-1.0i + wx) / (wx - xd)) * log(1.0 + 1.0i * xd) - power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * (-log((wx - xd) / (1.0i + wx)) + log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0) + 2.0 * log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + log(1.0 + 1.0i * xd) * (-log((wx - xd) / (-1.0i + wx)) + log((2.0 * 1.0i) / (1.0i + xd)) / 2.0) + 2.0 * log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx)
-                + log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx) - log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) - log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd))) + log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * ((pisqu * log(1.0 + 1.0i * wx)) / 6.0 - (log(1.0 + 1.0i * wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0)
-                + log((wx - xd) / (-1.0i + wx)) * ((power_of<2>(log(1.0i / wx)) * log((-1.0i + wx) / wx)) / 2.0 + power_of<2>(log(1.0 - 1.0i * xd)) * (2.0 * log(0.5 + (1.0i / 2.0) * xd) - log(1.0 + 1.0i * xd) / 2.0) - (pisqu * log(1.0 + 1.0i * xd)) / 6.0 + power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) * log(1.0 + 1.0i * xd) - power_of<3>(log(1.0 + 1.0i * xd)) + log(1.0 - 1.0i * xd) * (power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) + 2.0 * log(0.5 + (1.0i / 2.0) * xd) * log(1.0 + 1.0i * xd) - power_of<2>(log(1.0 + 1.0i * xd))) + power_of<2>(log(1.0 + 1.0i * xd)) * ((-0.5) * lnhalf + (3.0 * ln2) / 4.0 + log(1.0 - 1.0i * wx) / 4.0 + log((1.0i + wx) / wx) / 4.0 - log(xd) / 2.0 - log(xd / wx) / 2.0 + log(xd / (1.0i + xd)) / 2.0 + (3.0 * log((1.0i + xd) / (1.0i + wx))) / 2.0)
-                + (log(1.0 + 1.0i * wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0) + log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * ((pisqu * log((-1.0i + wx) / wx)) / 6.0 + (-ln2 + log(1.0 - 1.0i * wx) / 4.0 - (3.0 * log((1.0i + wx) / wx)) / 4.0) * power_of<2>(log(1.0 - xd / wx)) - (log((-1.0i + wx) / wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0) + log((-1.0i + wx) / (-1.0i + xd)) * ((log(1.0 + 1.0i * wx) * power_of<2>(log((-1.0i) * wx))) / 2.0 + (ln2 - log(1.0 - 1.0i * wx) / 4.0 + (3.0 * log((1.0i + wx) / wx)) / 4.0) * power_of<2>(log(1.0 - xd / wx)) + (log((-1.0i + wx) / wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0)
-                + log(xd / wx) * (log((-1.0i + wx) / wx) * power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))) + log((1.0i + wx) / wx) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) + (log((1.0i + wx) / wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0 + (log((-1.0i + wx) / wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0) - (pisqu * log(1.0 + 1.0i * wx) * log(-((xd + 1.0i * wx * xd) / (wx - xd)))) / 6.0 - (log(1.0 + 1.0i * wx) * power_of<3>(log(-((xd + 1.0i * wx * xd) / (wx - xd))))) / 6.0 - (pisqu * log((1.0i + wx) / wx) * log((1.0 - 1.0i * wx) / (1.0i * wx + wx * xd))) / 6.0 - (log((1.0i + wx) / wx) * power_of<3>(log((1.0 - 1.0i * wx) / (1.0i * wx + wx * xd)))) / 6.0
-                + ((-1.0 / 12.0) * (pisqu * ln2) - (pisqu * log(1.0 + 1.0i * wx)) / 12.0) * log(((-1.0i) * xd) / (1.0i * wx + wx * xd)) + ((-1.0 / 12.0) * ln2 - log(1.0 + 1.0i * wx) / 12.0) * power_of<3>(log(((-1.0i) * xd) / (1.0i * wx + wx * xd))) + (pisqu * log(1.0 - 1.0i * wx) * log((1.0i * xd) / (1.0i * wx + wx * xd))) / 6.0 + (log(1.0 - 1.0i * wx) * power_of<3>(log((1.0i * xd) / (1.0i * wx + wx * xd)))) / 6.0 + ((pisqu * ln2) / 12.0 + (pisqu * log((-1.0i + wx) / wx)) / 12.0) * log(((-1.0i) * wx) / (1.0i * xd + wx * xd)) + (ln2 / 12.0 + log((-1.0i + wx) / wx) / 12.0) * power_of<3>(log(((-1.0i) * wx) / (1.0i * xd + wx * xd))) + ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * log(1.0 + 1.0i * wx)) / 12.0) * log((1.0i * wx) / (1.0i * xd + wx * xd))
-                + ((-1.0 / 6.0) * ln2 - log(1.0 + 1.0i * wx) / 12.0) * power_of<3>(log((1.0i * wx) / (1.0i * xd + wx * xd))) - 1.0i * M_PI * H1(xd / (-1.0i + xd), wx / (-1.0i + wx)) * log((-1.0i + wx) / wx) * power_of<2>(log((1.0i * (-wx + xd)) / (wx * xd))) * my_sign(imag(wx / (1.0i - wx))) - (2.0 * 1.0i) * M_PI * H1(xd / (-1.0i + xd), wx / (-1.0i + wx)) * log((-1.0i + wx) / wx) * power_of<2>(log((1.0i * (-1.0 + xd / wx)) * xdinv)) * my_sign(imag(wx / (1.0i - wx))) - (2.0 * 1.0i) * M_PI * H1(xd / (1.0i + xd), wx / (1.0i + wx)) * log((1.0i + wx) / wx) * power_of<2>(log(((-1.0i) * (-1.0 + xd / wx)) * xdinv)) * my_sign(-imag(wx / (1.0i + wx))) - 1.0i * M_PI * H1(wx / (-1.0i + wx), wx / (wx - xd)) * power_of<2>(log((-1.0i + xd) / wx)) * log(1.0 - xd / wx) * my_sign(imag(wx / (wx - xd)))
-                - 1.0i * M_PI * H1(wx / (1.0i + wx), wx / (wx - xd)) * power_of<2>(log((1.0i + xd) / wx)) * log(1.0 - xd / wx) * my_sign(imag(wx / (wx - xd))) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * trilog((1.0 - 1.0i * xd) / ((-1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * trilog(((1.0 - 1.0i * wx) * xd) / (-1.0i + xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * trilog((xd + 1.0i * wx * xd) / (1.0i + xd)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * trilog((1.0 + 1.0i * xd) / (1.0i * xd + wx * xd)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-1.0 + (2.0 * 1.0i) / wx) * my_sign(imag(wx * xdinv))
-                + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-1.0i / wx) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(1.0i / wx) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-((2.0 * 1.0i + wx) / wx)) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log((-1.0i) * wx) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0i * wx) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log(wx * (-2.0 * 1.0i + wx)) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(imag(wx * xdinv))
-                + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(wx * (2.0 * 1.0i + wx)) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * ln2 * power_of<2>(log((1.0i * (1.0i + wx) * xd) / wx)) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) * log((1.0i - xd) / (1.0i + xd)) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * log((1.0i + xd) / (1.0i - xd)) * my_sign(imag(wx * xdinv))
-                + trilog((1.0i - wx) / (1.0i + wx)) * (log(wx / (1.0i + wx)) - log((1.0i + wx) / wx) + log((1.0i + wx) / (wx - xd)) - log((wx - xd) / (1.0i + wx)) - (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - (3.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(xd) + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 - log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv))) + log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * ((-1.0 / 3.0) * (pisqu * log((1.0i + wx) / wx)) + (ln2 + log(1.0 + 1.0i * wx) / 4.0) * power_of<2>(log(1.0 - xd / wx)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)))
-                + trilog((1.0i + wx) / (1.0i - wx)) * (log(wx / (-1.0i + wx)) - log((-1.0i + wx) / wx) + log((-1.0i + wx) / (wx - xd)) - log((wx - xd) / (-1.0i + wx)) - (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - (3.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(xd) + log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 - log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv))) + log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * ((-1.0 / 3.0) * (pisqu * log((-1.0i + wx) / wx)) + (ln2 + log(1.0 - 1.0i * wx) / 4.0) * power_of<2>(log(1.0 - xd / wx)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)))
-                + power_of<2>(log((-1.0i - 1.0 / wx) * xd)) * ((2.0 * 1.0i) * M_PI * H1(1.0i / xd, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(1.0i / xd, wx * xdinv) * log(1.0 - 1.0i * wx) * my_sign(imag(wx * xdinv))) + power_of<2>(log((1.0i - 1.0 / wx) * xd)) * (1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(-1.0i / xd, wx * xdinv) * log(1.0 + 1.0i * wx) * my_sign(imag(wx * xdinv))) + power_of<2>(log(-((1.0i + xd) / wx))) * ((2.0 * 1.0i) * M_PI * H1(1.0i * wx, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * log(1.0 + 1.0i * wx) * my_sign(imag(wx * xdinv)) + ((3.0 * 1.0i) / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * log((-1.0i + wx) / wx) * my_sign(imag(wx * xdinv)))
-                + power_of<2>(log((1.0i - xd) / wx)) * ((2.0 * 1.0i) * M_PI * H1((-1.0i) * wx, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * log(1.0 - 1.0i * wx) * my_sign(imag(wx * xdinv)) + ((3.0 * 1.0i) / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * log((1.0i + wx) / wx) * my_sign(imag(wx * xdinv))) + power_of<2>(log(-((1.0i + xd) * xdinv))) * ((5.0 * pisqu) / 24.0 + power_of<2>(log(-1.0 + 1.0i / wx)) / 8.0 + (log(1.0 - 1.0i * wx) * log(1.0i * wx)) / 2.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)))
-                - 1.0i * M_PI * H1(wx / (-1.0i + wx), (wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * log((-1.0i + wx) / wx) * power_of<2>(log((wx * (1.0 + 1.0i * xd)) / (-1.0i + wx))) * my_sign(imag((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) - (2.0 * 1.0i) * M_PI * H1(wx / (-1.0i + wx), (wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * log((-1.0i + wx) / wx) * power_of<2>(log((1.0 + 1.0i * wx) / (1.0i * wx - wx * xd))) * my_sign(imag((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) - (2.0 * 1.0i) * M_PI * H1(wx / (1.0i + wx), (wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * log((1.0i + wx) / wx) * power_of<2>(log((1.0i * (1.0i + wx)) / (wx * (1.0i + xd)))) * my_sign(imag((wx * (1.0i + xd)) / ((1.0i + wx) * xd)))
-                - 1.0i * M_PI * H1(wx / (1.0i + wx), (wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * log((1.0i + wx) / wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (1.0i + wx))) * my_sign(imag((wx * (1.0i + xd)) / ((1.0i + wx) * xd))) - 1.0i * M_PI * H1(-(xd / (wx - xd)), -1.0i / (-1.0i + wx)) * log(1.0 + 1.0i * wx) * power_of<2>(log(wx * (-1.0i - xdinv))) * my_sign(real(1.0 / (1.0i - wx))) + power_of<3>(log(-((1.0i + xd) * xdinv))) * (log(1.0 - 1.0i * wx) / 6.0 - log(1.0 + 1.0i * wx) / 6.0 - log(1.0 - xd / wx) / 6.0 + (1.0i / 6.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
-                + trilog(xd / (1.0i + xd)) * (lnhalf + log(1.0 - 1.0i * wx) + log(-1.0i / (-1.0i + wx)) - log(wx / (-1.0i + wx)) / 2.0 + log(1.0i / (1.0i + wx)) / 2.0 - log(1.0 - 1.0i * xd) + log(1.0 + 1.0i * xd) / 2.0 + 2.0 * log(1.0i / (1.0i + xd)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx))) + trilog((-1.0i + wx) / (wx - xd)) * (-2.0 * ln2 - log((1.0i + wx) / wx) - log(1.0 - 1.0i * xd) - 4.0 * log(1.0 + 1.0i * xd) - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
-                + trilog((2.0 * xd) / (1.0i + xd)) * (log(1.0 - 1.0i * wx) / 2.0 + log(wx / (-1.0i + wx)) / 2.0 - log((-1.0i + wx) / wx) / 2.0 - log(1.0i / (1.0i + wx)) / 2.0 - log(1.0i / (1.0i + xd)) + log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx))) + log(-((1.0i + xd) * xdinv)) * ((pisqu * log(1.0 - 1.0i * wx)) / 6.0 - (pisqu * log(1.0 + 1.0i * wx)) / 6.0 - (pisqu * log(1.0 - xd / wx)) / 6.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
-                + power_of<2>(log(wx * (-1.0i + xdinv))) * (1.0i * M_PI * H1(xd / wx, -1.0i / wx) * ln2 * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H1(xd / wx, -1.0i / wx) * log(1.0 + 1.0i * wx) * my_sign(-real(1.0 / wx))) + log(-((1.0i + xd) / (wx - xd))) * ((ln2 * power_of<2>(log(1.0 - 1.0i * wx))) / 4.0 + (power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * wx)) / 4.0 + (ln2 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (log((-1.0i + wx) / wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(log(-((1.0i + xd) * xdinv))) * my_sign(-real(1.0 / wx)))
-                + dilog((2.0 * xd) / (1.0i + xd)) * (dilog((-wx + xd) / (1.0i + xd)) / 2.0 - (ln2 * log(1.0 - 1.0i * wx)) / 2.0 - (ln2 * log(wx / (-1.0i + wx))) / 2.0 + (ln2 * log((-1.0i + wx) / wx)) / 2.0 + (ln2 * log(1.0i / (1.0i + wx))) / 2.0 - 2.0 * ln2 * log(1.0 - xd / wx) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * log(-((1.0i + xd) / (wx - xd))) * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * log((-wx + xd) / (1.0i + xd)) * my_sign(-real(1.0 / wx)))
-                + dilog(xd / (1.0i + xd)) * ((-1.0 / 3.0) * pisqu - dilog((2.0 * xd) / (1.0i + xd)) / 2.0 + (5.0 * dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) / 4.0 + dilog((-1.0i + xd) / (1.0i + xd)) / 2.0 - dilog((-wx + xd) / (1.0i + xd)) / 4.0 - log(1.0 - 1.0i * wx) * log(1.0i * wx) + log(1.0 - 1.0i * xd) * log(1.0i * xd) - log(xd / wx) * log(1.0 - xd / wx) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * log((-wx + xd) / (1.0i + xd)) * my_sign(-real(1.0 / wx)));
+            const complex<double> part3 = + li2_15 * (li2_8 / 2.0 - li2_9 + li2_16 - li2_17 / 4.0 - 2.0 * power_of<2>(ln_27) + ln_27 * (-ln2 - 2.0 * ln_28) + 3.0 * ln_25 * ln_28 - 2.0 * ln2 * ln_94)
+                + li2_18 * (-li2_8 + li2_9 / 2.0 - li2_19 / 4.0 + li2_20 + 3.0 * ln_26 * ln_27 - ln2 * ln_28 - 2.0 * ln_27 * ln_28 - 2.0 * power_of<2>(ln_28) - 2.0 * ln2 * ln_94) + dilog((2.0 * 1.0i) / (1.0i + xd)) * ((ln2 * ln_3) / 2.0 - (ln2 * ln_11) / 2.0 + 2.0 * ln2 * ln_94) + dilog((-2.0 * 1.0i) / (-1.0i + xd)) * ((ln2 * ln_5) / 2.0 - (ln2 * ln_16) / 2.0 + 2.0 * ln2 * ln_94)
+                + li2_21 * (pisqu / 24.0 + li2_22 / 4.0 + li2_23 / 2.0 - li2_9 / 2.0 + li2_19 / 4.0 + power_of<2>(ln_1) / 8.0 + ln2 * ln_27 + 2.0 * ln2 * ln_94) + li2_24 * (pisqu / 24.0 + li2_25 / 4.0 + li2_26 / 2.0 - li2_8 / 2.0 + li2_17 / 4.0 + power_of<2>(ln_15) / 8.0 + ln2 * ln_28 + 2.0 * ln2 * ln_94)
+                + dilog(-1.0i / xd) * (((-0.5) * ln_5 + ln_16 / 2.0) * ln_28 + (-2.0 * ln2 - ln_11) * ln_94) + li2_27 * ((-1.0 / 12.0) * pisqu + li2_8 - li2_20 - li2_28 / 2.0 - power_of<2>(ln_4) / 4.0 + (2.0 * lnhalf - ln_11 / 2.0) * ln_27 + (2.0 * lnhalf - (3.0 * ln_5) / 2.0 + ln_11) * ln_28 - ln_3 * ln_44 + (ln_5 - ln_11) * ln_94)
+                + li2_29 * (li2_6 / 4.0 - li2_10 + li2_30 / 2.0 + (2.0 * lnhalf - ln_5) * ln_27 + (2.0 * lnhalf + ln_5 - 2.0 * ln_11) * ln_28 - ln_3 * ln_44 + (-ln_5 + ln_11) * ln_94) + dilog(1.0i / xd) * (((-0.5) * ln_3 + ln_11 / 2.0) * ln_27 + (-2.0 * ln2 - ln_16) * ln_94)
+                + li2_31 * ((-1.0 / 12.0) * pisqu + li2_9 - li2_32 / 2.0 - li2_16 - power_of<2>(ln_2) / 4.0 + (2.0 * lnhalf - (3.0 * ln_3) / 2.0 + ln_16) * ln_27 + (2.0 * lnhalf - ln_16 / 2.0) * ln_28 - ln_5 * ln_44 + (ln_3 - ln_16) * ln_94)
+                + li2_33 * (li2_7 / 4.0 - li2_10 + li2_34 / 2.0 + (2.0 * lnhalf + ln_3 - 2.0 * ln_16) * ln_27 + (2.0 * lnhalf - ln_3) * ln_28 - ln_5 * ln_44 + (-ln_3 + ln_16) * ln_94)
+                + li2_35 * (ln_97 * ln_27 + ln_27 * (ln_33 - ln_94 / 2.0) + (-2.0 * ln2 + ln_5 / 2.0 - (3.0 * ln_11) / 2.0 - ln_44) * ln_94) + li2_36 * (ln_96 * ln_28 + ln_28 * (ln_34 - ln_94 / 2.0) + (-2.0 * ln2 + ln_3 / 2.0 - (3.0 * ln_16) / 2.0 - ln_44) * ln_94)
+                + li2_37 * (pisqu / 24.0 + 2.0 * ln_3 * ln_9 - ln_97 * ln_27 + 3.0 * ln_34 * ln_28 + power_of<2>(ln_78) / 8.0 + ln_27 * (ln_33 + ln_94 / 2.0) + (2.0 * ln2 - ln_5 / 2.0 + (3.0 * ln_11) / 2.0 + ln_44) * ln_94)
+                + li2_38 * (pisqu / 24.0 + 2.0 * ln_5 * ln_8 + power_of<2>(ln_20) / 8.0 + 3.0 * ln_33 * ln_27 - ln_96 * ln_28 + ln_28 * (ln_34 + ln_94 / 2.0) + (2.0 * ln2 - ln_3 / 2.0 + (3.0 * ln_16) / 2.0 + ln_44) * ln_94)
+                + li2_30 * ((13.0 * pisqu) / 24.0 - (3.0 * li2_39) / 4.0 - li2_40 + ln2 * ln_5 + ln_3 * ln_5 + lnhalf * ln_11 - ln_3 * ln_11 + (3.0 * power_of<2>(ln_11)) / 2.0 + ln_11 * ln_13 + power_of<2>(ln_15) / 2.0 - (3.0 * power_of<2>(ln_20)) / 8.0 + (ln_11 * ln_27) / 2.0 - 2.0 * ln_28 * ln_42 + ln_99 * ln_94)
+                + li2_34 * ((13.0 * pisqu) / 24.0 - li2_41 - (3.0 * li2_42) / 4.0 + power_of<2>(ln_1) / 2.0 + ln2 * ln_3 + ln_3 * ln_5 + lnhalf * ln_16 - ln_5 * ln_16 + ln_10 * ln_16 + (3.0 * power_of<2>(ln_16)) / 2.0 + (ln_16 * ln_28) / 2.0 - 2.0 * ln_27 * ln_43 - (3.0 * power_of<2>(ln_78)) / 8.0 + ln_99 * ln_94)
+                + li2_43 * (-3.0 * ln_7 * ln_11 + (-2.0 * ln2 - ln_3) * ln_28 - power_of<2>(ln_28) / 2.0 + ln_26 * (2.0 * ln_27 + 2.0 * ln_28) - ln_58 * ln_94) + li2_44 * ((2.0 * ln2 + ln_3) * ln_28 + power_of<2>(ln_28) / 2.0 + ln_58 * ln_94)
+                + power_of<2>(ln_99) * ((-0.5) * (ln_50 * ln_94) + (ln_55 * ln_94) / 2.0 - (ln_64 * ln_94) / 2.0 + (ln_68 * ln_94) / 2.0) + li2_45 * (li2_28 / 4.0 - 3.0 * ln_6 * ln_16 + (-2.0 * ln2 - ln_5 + 2.0 * ln_25) * ln_27 - power_of<2>(ln_27) / 2.0 + 2.0 * ln_25 * ln_28 - ln_73 * ln_94)
+                + li2_46 * ((2.0 * ln2 + ln_5) * ln_27 + power_of<2>(ln_27) / 2.0 + ln_73 * ln_94) + ln_49 * ((-1.0 / 6.0) * (pisqu * ln_3) + (ln_3 * power_of<2>(ln_68)) / 2.0 + (power_of<2>(ln_73) * ln_94) / 2.0)
+                + li2_40 * ((-1.0 / 12.0) * pisqu - power_of<2>(ln_20) / 4.0 - ln_44 * ln_67 + ln_27 * ((3.0 * ln_3) / 2.0 - ln_11 / 2.0 - ln_16 + 2.0 * ln_94)) + li2_41 * ((-1.0 / 12.0) * pisqu - li2_42 / 2.0 - ln_44 * ln_54 - power_of<2>(ln_78) / 4.0 + ln_28 * ((3.0 * ln_5) / 2.0 - ln_11 - ln_16 / 2.0 + 2.0 * ln_94))
+                + ((2.0 * pisqu * ln2) / 3.0 + (pisqu * ln_3) / 12.0 + (pisqu * ln_5) / 12.0) * ln_100 + ((-1.0 / 24.0) * pisqu - power_of<2>(lnm2) / 8.0) * power_of<2>(ln_100) + ((2.0 * ln2) / 3.0 + ln_3 / 12.0 + ln_5 / 12.0) * power_of<3>(ln_100) + (pisqu * ln_5 * log((1.0i * xd) / (1.0i * wx - wx * xd))) / 6.0 + (ln_5 * power_of<3>(log((1.0i * xd) / (1.0i * wx - wx * xd)))) / 6.0 + ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * ln_3) / 12.0) * ln_101 + ((-1.0 / 6.0) * ln2 - ln_3 / 12.0) * power_of<3>(ln_101)
+                + trilog((1.0i + wx) / (-1.0i + wx)) * (ln_5 / 2.0 - ln_10 / 2.0 + (5.0 * ln_27) / 2.0 - ln_28 / 2.0 - ln_54 / 2.0 + ln_58 / 2.0 + ln_68 - ln_102) + trilog((-1.0i + xd) / (-wx + xd)) * (2.0 * ln2 + ln_3 + 3.0 * ln_11 - ln_24 / 2.0 - 2.0 * ln_27 - (3.0 * ln_28) / 2.0 + ln_94 + ln_102 / 2.0)
+                + trilog((-1.0i + xd) / (1.0i + xd)) * ((-3.0 * ln_5) / 2.0 + ln_11 + ln_16 / 2.0 - ln_27 - ln_44 + ln_64 - ln_68 - 2.0 * ln_94 + ln_102) + dilog((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * ((-ln2 - ln_11 / 2.0) * ln_27 + 2.0 * power_of<2>(ln_27) + ln_3 * ln_68 - ln_3 * ln_102)
+                + li2_20 * (pisqu / 12.0 + li2_14 - power_of<2>(ln_4) / 4.0 + power_of<2>(ln_85) / 2.0 - (3.0 * power_of<2>(ln_27)) / 2.0 + 2.0 * ln_25 * ln_28 + (3.0 * power_of<2>(ln_28)) / 2.0 + ln_27 * (-lnhalf + ln2 + ln_11 / 2.0 + 2.0 * ln_25 + ln_61 - ln_62) - ln_3 * ln_68 + ln_3 * ln_102)
+                + dilog(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * (2.0 * ln_33 * ln_27 + 2.0 * ln_16 * ln_68 + (2.0 * ln2 + ln_5 / 2.0 - (3.0 * ln_28) / 2.0 - ln_44) * ln_94 - ln_16 * ln_102) + ln_41 * ((pisqu * ln_3) / 6.0 - (ln_3 * power_of<2>(ln_102)) / 2.0)
+                + ln_33 * ((power_of<2>(ln_6) * ln_16) / 2.0 - power_of<3>(ln_27) + power_of<2>(ln_25) * ln_28 + 2.0 * ln_25 * power_of<2>(ln_28) + ln_27 * ((-1.0 / 6.0) * pisqu + power_of<2>(ln_25) + 2.0 * ln_25 * ln_28 - power_of<2>(ln_28) / 2.0) + power_of<2>(ln_27) * ((-0.5) * lnhalf + (3.0 * ln2) / 4.0 + ln_5 / 4.0 + ln_11 / 4.0 - ln_28 - ln_44 / 2.0 - ln_99 / 2.0 + ln_61 / 2.0 + (3.0 * ln_58) / 2.0)
+                + (ln_3 * power_of<2>(ln_102)) / 2.0) + ln_71 * ((pisqu * ln_16) / 6.0 + (-ln2 + ln_5 / 4.0 - (3.0 * ln_11) / 4.0) * power_of<2>(ln_94) - (ln_16 * power_of<2>(ln_102)) / 2.0) + ln_67 * ((ln_3 * power_of<2>(ln_9)) / 2.0 + (ln2 - ln_5 / 4.0 + (3.0 * ln_11) / 4.0) * power_of<2>(ln_94) + (ln_16 * power_of<2>(ln_102)) / 2.0) + (pisqu * ln_11 * ln_103) / 3.0
+                + (ln_11 * power_of<3>(ln_103)) / 3.0 + trilog((-1.0i + wx) / (1.0i + wx)) * (ln_3 / 2.0 - ln_13 / 2.0 - ln_27 / 2.0 + (5.0 * ln_28) / 2.0 + ln_55 - ln_67 / 2.0 + ln_73 / 2.0 - ln_104) + trilog(-((1.0i + xd) / (wx - xd))) * (2.0 * ln2 + ln_5 + 3.0 * ln_16 - ln_24 / 2.0 - (3.0 * ln_27) / 2.0 - 2.0 * ln_28 + ln_94 + ln_104 / 2.0)
+                + trilog((1.0i + xd) / (-1.0i + xd)) * ((-3.0 * ln_3) / 2.0 + ln_11 / 2.0 + ln_16 - ln_28 - ln_44 + ln_50 - ln_55 - 2.0 * ln_94 + ln_104) + dilog((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * ((-ln2 - ln_16 / 2.0) * ln_28 + 2.0 * power_of<2>(ln_28) + ln_5 * ln_55 - ln_5 * ln_104)
+                + li2_47 * ((-0.5) * pisqu + li2_32 / 2.0 + li2_28 / 2.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(ln_2) / 8.0 - power_of<2>(ln_4) / 8.0 - ln_7 * ln_11 - ln_6 * ln_16 - 2.0 * ln_33 * ln_27 - 2.0 * ln_34 * ln_28 + ln_5 * ln_55 + ln_3 * ln_68
+                + (-8.0 * ln2 - (3.0 * ln_11) / 2.0 - (3.0 * ln_16) / 2.0) * ln_94 + ln_28 * (-ln_42 + ln_94) + ln_27 * (-ln_43 + ln_94) - ln_3 * ln_102 - ln_5 * ln_104)
+                + li2_16 * (pisqu / 12.0 - li2_12 + li2_13 - power_of<2>(ln_2) / 4.0 + (3.0 * power_of<2>(ln_27)) / 2.0 + power_of<2>(ln_86) / 2.0 - (3.0 * power_of<2>(ln_28)) / 2.0 + ln_26 * (2.0 * ln_27 + 2.0 * ln_28) - ln_5 * ln_55 + ln_28 * (-lnhalf + ln2 + ln_16 / 2.0 + ln_88 - ln_89) + ln_5 * ln_104)
+                + dilog((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * (2.0 * ln_34 * ln_28 + 2.0 * ln_11 * ln_55 + (2.0 * ln2 + ln_3 / 2.0 - (3.0 * ln_27) / 2.0 - ln_44) * ln_94 - ln_11 * ln_104)
+                + li2_48 * ((-1.0 / 12.0) * pisqu - power_of<2>(lnm2) / 4.0 - ln_97 * ln_27 - power_of<2>(ln_27) / 2.0 - ln_96 * ln_28 - power_of<2>(ln_28) / 2.0 + ln_27 * (-ln_33 + ln_60 / 2.0) + 2.0 * ln_11 * ln_55 + ln_28 * (-ln_34 + ln_74 / 2.0) + 2.0 * ln_16 * ln_68 + ln_58 * ln_94
+                + ln_73 * ln_94 - ln_16 * ln_102 - ln_11 * ln_104) + ln_40 * ((pisqu * ln_5) / 6.0 - (ln_5 * power_of<2>(ln_104)) / 2.0)
+                + ln_34 * ((power_of<2>(ln_7) * ln_11) / 2.0 + power_of<2>(ln_27) * (2.0 * ln_26 - ln_28 / 2.0) - (pisqu * ln_28) / 6.0 + power_of<2>(ln_26) * ln_28 - power_of<3>(ln_28) + ln_27 * (power_of<2>(ln_26) + 2.0 * ln_26 * ln_28 - power_of<2>(ln_28)) + power_of<2>(ln_28) * ((-0.5) * lnhalf + (3.0 * ln2) / 4.0 + ln_3 / 4.0 + ln_16 / 4.0 - ln_44 / 2.0 - ln_99 / 2.0 + ln_88 / 2.0 + (3.0 * ln_73) / 2.0)
+                + (ln_5 * power_of<2>(ln_104)) / 2.0) + ln_56 * ((pisqu * ln_11) / 6.0 + (-ln2 + ln_3 / 4.0 - (3.0 * ln_16) / 4.0) * power_of<2>(ln_94) - (ln_11 * power_of<2>(ln_104)) / 2.0) + ln_54 * ((ln_5 * power_of<2>(ln_8)) / 2.0 + (ln2 - ln_3 / 4.0 + (3.0 * ln_16) / 4.0) * power_of<2>(ln_94) + (ln_11 * power_of<2>(ln_104)) / 2.0)
+                + ln_99 * (ln_11 * power_of<2>(ln_55) + ln_16 * power_of<2>(ln_68) + (ln_16 * power_of<2>(ln_102)) / 2.0 + (ln_11 * power_of<2>(ln_104)) / 2.0) - (pisqu * ln_5 * ln_105) / 6.0 - (ln_5 * power_of<3>(ln_105)) / 6.0 - (pisqu * ln_16 * ln_106) / 6.0 - (ln_16 * power_of<3>(ln_106)) / 6.0
+                + ((-1.0 / 12.0) * (pisqu * ln2) - (pisqu * ln_5) / 12.0) * log(((-1.0i) * xd) / (1.0i * wx + wx * xd)) + ((-1.0 / 12.0) * ln2 - ln_5 / 12.0) * power_of<3>(log(((-1.0i) * xd) / (1.0i * wx + wx * xd))) + (pisqu * ln_3 * log((1.0i * xd) / (1.0i * wx + wx * xd))) / 6.0 + (ln_3 * power_of<3>(log((1.0i * xd) / (1.0i * wx + wx * xd)))) / 6.0 + ((pisqu * ln2) / 12.0 + (pisqu * ln_11) / 12.0) * ln_107 + (ln2 / 12.0 + ln_11 / 12.0) * power_of<3>(ln_107) + ((-1.0 / 6.0) * (pisqu * ln2) - (pisqu * ln_5) / 12.0) * ln_108
+                + ((-1.0 / 6.0) * ln2 - ln_5 / 12.0) * power_of<3>(ln_108) - 1.0i * M_PI * H1(xd / (-1.0i + xd), wx / (-1.0i + wx)) * ln_11 * power_of<2>(log((1.0i * (-wx + xd)) / (wx * xd))) * my_sign(imag(wx / (1.0i - wx))) - (2.0 * 1.0i) * M_PI * H1(xd / (-1.0i + xd), wx / (-1.0i + wx)) * ln_11 * power_of<2>(log((1.0i * (-1.0 + xd / wx)) * xdinv)) * my_sign(imag(wx / (1.0i - wx))) - (2.0 * 1.0i) * M_PI * H1(xd / (1.0i + xd), wx / (1.0i + wx)) * ln_16 * power_of<2>(log(((-1.0i) * (-1.0 + xd / wx)) * xdinv)) * my_sign(-imag(wx / (1.0i + wx))) - 1.0i * M_PI * H1(wx / (-1.0i + wx), wx / (wx - xd)) * power_of<2>(ln_57) * ln_94 * my_sign(imag(wx / (wx - xd)))
+                - 1.0i * M_PI * H1(wx / (1.0i + wx), wx / (wx - xd)) * power_of<2>(ln_72) * ln_94 * my_sign(imag(wx / (wx - xd))) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * trilog((1.0 - 1.0i * xd) / ((-1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * trilog(((1.0 - 1.0i * wx) * xd) / (-1.0i + xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * trilog((xd + 1.0i * wx * xd) / (1.0i + xd)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * trilog((1.0 + 1.0i * xd) / (1.0i * xd + wx * xd)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_109) * log(-1.0 + (2.0 * 1.0i) / wx) * my_sign(imag(wx * xdinv))
+                + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_109) * ln_6 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_109) * ln_7 * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_109) * log(-((2.0 * 1.0i + wx) / wx)) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_8 * power_of<2>(ln_110) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * ln_9 * power_of<2>(ln_110) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log(wx * (-2.0 * 1.0i + wx)) * power_of<2>(ln_110) * my_sign(imag(wx * xdinv))
+                + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(wx * (2.0 * 1.0i + wx)) * power_of<2>(ln_110) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * ln2 * power_of<2>(ln_48) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_63) * ln_76 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_56) * ln_77 * my_sign(imag(wx * xdinv))
+                + trilog((1.0i - wx) / (1.0i + wx)) * (ln_17 - ln_16 + ln_97 - ln_33 - (3.0 * ln_27) / 2.0 - (3.0 * ln_28) / 2.0 - ln_44 + ln_55 / 2.0 - ln_104 / 2.0 + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv))) + ln_91 * ((-1.0 / 3.0) * (pisqu * ln_16) + (ln2 + ln_5 / 4.0) * power_of<2>(ln_94) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)))
+                + trilog((1.0i + wx) / (1.0i - wx)) * (ln_12 - ln_11 + ln_96 - ln_34 - (3.0 * ln_27) / 2.0 - (3.0 * ln_28) / 2.0 - ln_44 + ln_68 / 2.0 - ln_102 / 2.0 + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv))) + ln_63 * ((-1.0 / 3.0) * (pisqu * ln_11) + (ln2 + ln_3 / 4.0) * power_of<2>(ln_94) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)))
+                + power_of<2>(ln_45) * ((2.0 * 1.0i) * M_PI * H1(1.0i / xd, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(1.0i / xd, wx * xdinv) * ln_3 * my_sign(imag(wx * xdinv))) + power_of<2>(ln_111) * (1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(-1.0i / xd, wx * xdinv) * ln_5 * my_sign(imag(wx * xdinv))) + power_of<2>(ln_112) * ((2.0 * 1.0i) * M_PI * H1(1.0i * wx, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * ln_5 * my_sign(imag(wx * xdinv)) + ((3.0 * 1.0i) / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * ln_11 * my_sign(imag(wx * xdinv)))
+                + power_of<2>(ln_113) * ((2.0 * 1.0i) * M_PI * H1((-1.0i) * wx, wx * xdinv) * ln2 * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * ln_3 * my_sign(imag(wx * xdinv)) + ((3.0 * 1.0i) / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * ln_16 * my_sign(imag(wx * xdinv))) + power_of<2>(ln_78) * ((5.0 * pisqu) / 24.0 + power_of<2>(ln_1) / 8.0 + (ln_3 * ln_9) / 2.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_91 * my_sign(imag(wx * xdinv)))
+                - 1.0i * M_PI * H1(wx / (-1.0i + wx), (wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * ln_11 * power_of<2>(log((wx * (1.0 + 1.0i * xd)) / (-1.0i + wx))) * my_sign(imag((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) - (2.0 * 1.0i) * M_PI * H1(wx / (-1.0i + wx), (wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * ln_11 * power_of<2>(ln_114) * my_sign(imag((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) - (2.0 * 1.0i) * M_PI * H1(wx / (1.0i + wx), (wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * ln_16 * power_of<2>(ln_115) * my_sign(imag((wx * (1.0i + xd)) / ((1.0i + wx) * xd)))
+                - 1.0i * M_PI * H1(wx / (1.0i + wx), (wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * ln_16 * power_of<2>(log((wx - 1.0i * wx * xd) / (1.0i + wx))) * my_sign(imag((wx * (1.0i + xd)) / ((1.0i + wx) * xd))) - 1.0i * M_PI * H1(-(xd / (wx - xd)), -1.0i / (-1.0i + wx)) * ln_5 * power_of<2>(ln_18) * my_sign(real(1.0 / (1.0i - wx))) + power_of<3>(ln_78) * (ln_3 / 6.0 - ln_5 / 6.0 - ln_94 / 6.0 + (1.0i / 6.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
+                + trilog(xd / (1.0i + xd)) * (lnhalf + ln_3 + ln_10 - ln_12 / 2.0 + ln_13 / 2.0 - ln_27 + ln_28 / 2.0 + 2.0 * ln_64 - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx))) + trilog((-1.0i + wx) / (wx - xd)) * (-2.0 * ln2 - ln_16 - ln_27 - 4.0 * ln_28 - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
+                + trilog((2.0 * xd) / (1.0i + xd)) * (ln_3 / 2.0 + ln_12 / 2.0 - ln_11 / 2.0 - ln_13 / 2.0 - ln_64 + ln_68 + 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx))) + ln_78 * ((pisqu * ln_3) / 6.0 - (pisqu * ln_5) / 6.0 - (pisqu * ln_94) / 6.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)))
+                + power_of<2>(ln_21) * (1.0i * M_PI * H1(xd / wx, -1.0i / wx) * ln2 * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H1(xd / wx, -1.0i / wx) * ln_5 * my_sign(-real(1.0 / wx))) + ln_116 * ((ln2 * power_of<2>(ln_3)) / 4.0 + (power_of<2>(ln_3) * ln_5) / 4.0 + (ln2 * power_of<2>(ln_16)) / 2.0 + (ln_11 * power_of<2>(ln_16)) / 2.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(ln_78) * my_sign(-real(1.0 / wx)))
+                + li2_17 * (li2_37 / 2.0 - (ln2 * ln_3) / 2.0 - (ln2 * ln_12) / 2.0 + (ln2 * ln_11) / 2.0 + (ln2 * ln_13) / 2.0 - 2.0 * ln2 * ln_94 + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_71 * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_91 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * ln_116 * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * ln_93 * my_sign(-real(1.0 / wx)))
+                + li2_49 * ((-1.0 / 3.0) * pisqu - li2_17 / 2.0 + (5.0 * li2_34) / 4.0 + li2_41 / 2.0 - li2_37 / 4.0 - ln_3 * ln_9 + ln_27 * ln_43 - ln_99 * ln_94 - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_71 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * ln_93 * my_sign(-real(1.0 / wx)));
 
-            const complex<double> part4 = + power_of<3>(log(-1.0 + 1.0i / xd)) * ((-1.0 / 6.0) * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 6.0 - log(1.0 - xd / wx) / 6.0 + (1.0i / 6.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + trilog(xd / (-1.0i + xd)) * (lnhalf + log(1.0 + 1.0i * wx) + log(-1.0i / (-1.0i + wx)) / 2.0 + log(1.0i / (1.0i + wx)) - log(wx / (1.0i + wx)) / 2.0 + log(1.0 - 1.0i * xd) / 2.0 - log(1.0 + 1.0i * xd) + 2.0 * log(-1.0i / (-1.0i + xd)) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
-                + trilog((1.0i + wx) / (wx - xd)) * (-2.0 * ln2 - log((-1.0i + wx) / wx) - 4.0 * log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + trilog((2.0 * wx) / (wx - xd)) * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
-                + trilog((2.0 * xd) / (-1.0i + xd)) * (log(1.0 + 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) / 2.0 + log(wx / (1.0i + wx)) / 2.0 - log((1.0i + wx) / wx) / 2.0 - log(-1.0i / (-1.0i + xd)) + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + log(-1.0 + 1.0i / xd) * ((-1.0 / 6.0) * (pisqu * log(1.0 - 1.0i * wx)) + (pisqu * log(1.0 + 1.0i * wx)) / 6.0 + power_of<3>(log(1.0 + 1.0i * xd)) / 3.0 - (pisqu * log(1.0 - xd / wx)) / 6.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
-                + log((-1.0i + xd) / (-wx + xd)) * ((ln2 * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 + (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 + (ln2 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + (power_of<2>(log((-1.0i + wx) / wx)) * log((1.0i + wx) / wx)) / 2.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + power_of<2>(log(wx * (1.0i + xdinv))) * (1.0i * M_PI * H1(xd / wx, 1.0i / wx) * ln2 * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H1(xd / wx, 1.0i / wx) * log(1.0 - 1.0i * wx) * my_sign(real(1.0 / wx)))
-                + power_of<2>(log(-1.0 + 1.0i / xd)) * ((5.0 * pisqu) / 24.0 + (log(1.0 + 1.0i * wx) * log((-1.0i) * wx)) / 2.0 + power_of<2>(log(-((1.0i + wx) / wx))) / 8.0 + (log(1.0 + 1.0i * xd) * log((-1.0i) * xd)) / 2.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * log((-1.0i + xd) / (-wx + xd)) * my_sign(real(1.0 / wx)))
-                + log((1.0i - xd) / (1.0i + xd)) * ((-0.25) * (ln2squ * log(1.0 - 1.0i * wx)) - (ln2squ * log(wx / (-1.0i + wx))) / 4.0 + (ln2squ * log((-1.0i + wx) / wx)) / 4.0 + (ln2squ * log(1.0i / (1.0i + wx))) / 4.0 + (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(log((-wx + xd) / (1.0i + xd))) * my_sign(-real(1.0 / wx)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(log((-1.0i + xd) / (-wx + xd))) * my_sign(real(1.0 / wx)))
-                + dilog((2.0 * xd) / (-1.0i + xd)) * (dilog((-wx + xd) / (-1.0i + xd)) / 2.0 - (ln2 * log(1.0 + 1.0i * wx)) / 2.0 + (ln2 * log(-1.0i / (-1.0i + wx))) / 2.0 - (ln2 * log(wx / (1.0i + wx))) / 2.0 + (ln2 * log((1.0i + wx) / wx)) / 2.0 - 2.0 * ln2 * log(1.0 - xd / wx) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * log((-1.0i + xd) / (-wx + xd)) * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * log((-wx + xd) / (-1.0i + xd)) * my_sign(real(1.0 / wx)))
-                + dilog(xd / (-1.0i + xd)) * ((-1.0 / 3.0) * pisqu - dilog((2.0 * xd) / (-1.0i + xd)) / 2.0 + (5.0 * dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) / 4.0 + dilog((1.0i + xd) / (-1.0i + xd)) / 2.0 - dilog((-wx + xd) / (-1.0i + xd)) / 4.0 - log(1.0 + 1.0i * wx) * log((-1.0i) * wx) + log(1.0 + 1.0i * xd) * log((-1.0i) * xd) - log(xd / wx) * log(1.0 - xd / wx) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * log((-wx + xd) / (-1.0i + xd)) * my_sign(real(1.0 / wx)))
-                + log((1.0i + xd) / (1.0i - xd)) * ((-0.25) * (ln2squ * log(1.0 + 1.0i * wx)) + (ln2squ * log(-1.0i / (-1.0i + wx))) / 4.0 - (ln2squ * log(wx / (1.0i + wx))) / 4.0 + (ln2squ * log((1.0i + wx) / wx)) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log((wx * (1.0i + xd)) / ((1.0i + wx) * xd))) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(log(-((1.0i + xd) / (wx - xd)))) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(log((-wx + xd) / (-1.0i + xd))) * my_sign(real(1.0 / wx))) - (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * power_of<2>(log((-1.0i + xd) / (-wx + xd))) * log((wx - 1.0i * wx * xd) / (wx - xd)) * my_sign(-real(wx))
-                - pisqu * H2((-1.0i) * wx, wx * xdinv) * H2(wx * xdinv, -1.0i / xd) * my_HT(-r((-1.0i) * wx, wx * xdinv) + r(wx * xdinv, -1.0i / xd)) * power_of<2>(log((1.0 + 1.0i * xd) / (1.0i * xd + wx * xd))) * my_sign(imag(wx * xdinv)) * my_sign(-real(wx)) + trilog((1.0i + wx + xd - 1.0i * wx * xd) * xdinv) * ((-1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + dilog((1.0i + wx + xd - 1.0i * wx * xd) * xdinv) * log(1.0 + xdinv * xdinv) * (1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))
-                + trilog((-2.0 * 1.0i) / (-1.0i + xd)) * ((-0.5) * log(1.0 + 1.0i * wx) + log((1.0i + wx) / wx) / 2.0 - 3.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 - xd / wx) + (2.0 * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + power_of<2>(log((1.0i * (wx - xd)) / (wx * xd))) * ((-1.0i) * M_PI * H1(xd / (1.0i + xd), wx / (1.0i + wx)) * log((1.0i + wx) / wx) * my_sign(-imag(wx / (1.0i + wx))) - 1.0i * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * ln2 * my_sign(-real(wx))) + power_of<2>(log((1.0i * (-1.0 + wx * xdinv)) / wx)) * ((-1.0i) * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * ln2 * my_sign(-real(wx)) - 1.0i * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * log((1.0i + wx) / wx) * my_sign(-real(wx)))
-                + dilog((1.0i + xd) * xdinv) * (pisqu / 4.0 + dilog((-wx + xd) / (1.0i + xd)) / 4.0 + power_of<2>(log(-1.0 + 1.0i / wx)) / 4.0 + log(1.0 - 1.0i * wx) * log(1.0i * wx) - (3.0 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + log(1.0 - 1.0i * xd) * (3.0 * ln2 - (3.0 * log(1.0 - 1.0i * wx)) / 2.0 + 2.0 * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) + log(1.0i * xd)) + 2.0 * log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * log(-((1.0i + xd) / (wx - xd))) * my_sign(-real(1.0 / wx))
-                + log(1.0 + xdinv * xdinv) * ((-1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))) - 1.0i * M_PI * H1(1.0i * xd, 1.0i * wx) * ln2 * power_of<2>(log(1.0i * (1.0 / wx - xdinv))) * my_sign(real(wx)) - (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * power_of<2>(log(-((1.0i + xd) / (wx - xd)))) * log((wx + 1.0i * wx * xd) / (wx - xd)) * my_sign(real(wx)) - pisqu * H2(1.0i * wx, wx * xdinv) * H2(wx * xdinv, 1.0i / xd) * my_HT(-r(1.0i * wx, wx * xdinv) + r(wx * xdinv, 1.0i / xd)) * power_of<2>(log((1.0 - 1.0i * xd) / ((-1.0i + wx) * xd))) * my_sign(imag(wx * xdinv)) * my_sign(real(wx))
-                + trilog(((1.0 + 1.0i * wx) * (-1.0i + xd)) * xdinv) * ((-1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))) + dilog(((1.0 + 1.0i * wx) * (-1.0i + xd)) * xdinv) * log(1.0 + xdinv * xdinv) * (1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))) + trilog((2.0 * 1.0i) / (1.0i + xd)) * ((-0.5) * log(1.0 - 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 - 3.0 * log(1.0 + 1.0i * xd) - 2.0 * log(1.0 - xd / wx) + (2.0 * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))
-                + power_of<2>(log(((-1.0i) * (-1.0 + wx * xdinv)) / wx)) * ((-1.0i) * M_PI * H1(1.0i * xd, 1.0i * wx) * ln2 * my_sign(real(wx)) - 1.0i * M_PI * H1(1.0i * xd, 1.0i * wx) * log((-1.0i + wx) / wx) * my_sign(real(wx))) + power_of<2>(log(1.0 + xdinv * xdinv)) * (log((1.0i * (-1.0 + wx * (1.0i + xd))) * xdinv) * ((1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + log((1.0i - wx - 1.0i * wx * xd) * xdinv) * ((1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))))
-                + dilog((-1.0i + xd) * xdinv) * (pisqu / 4.0 - dilog((1.0i + xd) / (-1.0i + xd)) / 2.0 + dilog((-wx + xd) / (-1.0i + xd)) / 4.0 + log(1.0 + 1.0i * wx) * log((-1.0i) * wx) + power_of<2>(log(-((1.0i + wx) / wx))) / 4.0 - (3.0 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 + log(1.0 + 1.0i * xd) * (3.0 * ln2 + 2.0 * log(1.0 - 1.0i * wx) - (3.0 * log(1.0 + 1.0i * wx)) / 2.0 + log((1.0i + wx) / wx) + log((-1.0i) * xd)) + 2.0 * log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * my_sign(imag(wx * xdinv))
-                + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * log((-1.0i + xd) / (-wx + xd)) * my_sign(real(1.0 / wx)) + log(1.0 + xdinv * xdinv) * ((-1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))) + 1.0i * M_PI * H1(-(xd / (wx - xd)), -1.0i / (-1.0i + wx)) * log(1.0 + 1.0i * wx) * power_of<2>(log(-((wx + 1.0i * wx * xd) * xdinv))) * my_sign(real(1.0 / (-1.0i + wx))) + power_of<2>(log((1.0i * wx * (1.0i + xd)) * xdinv)) * (1.0i * M_PI * H1(-(xd / (wx - xd)), 1.0i / (1.0i + wx)) * log(1.0 - 1.0i * wx) * my_sign(-real(1.0 / (1.0i + wx))) - 1.0i * M_PI * H1(-(xd / (wx - xd)), 1.0i / (1.0i + wx)) * log(1.0 - 1.0i * wx) * my_sign(real(1.0 / (1.0i + wx))))
-                - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-1.0 + (2.0 * 1.0i) / wx) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(1.0i / wx) * my_sign(-real(xdinv)) + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * log(-((1.0i + wx) / wx)) * my_sign(-real(xdinv)) + (1.0i / 6.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<3>(log(-((1.0i + wx) / wx))) * my_sign(-real(xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log((-1.0i) * wx) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(-real(xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log(wx * (-2.0 * 1.0i + wx)) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(-real(xdinv))
-                - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * power_of<2>(log((1.0i * (1.0i + wx) * xd) / (wx - xd))) * log((wx + 1.0i * wx * xd) / (wx - xd)) * my_sign(-real(xdinv)) - pisqu * H2(-1.0i / xd, wx * xdinv) * H2(wx * xdinv, 1.0i / xd) * my_HT(-r(-1.0i / xd, wx * xdinv) + r(wx * xdinv, 1.0i / xd)) * power_of<2>(log((1.0i + wx) / (1.0i - wx))) * my_sign(imag(wx * xdinv)) * my_sign(-real(xdinv)) + trilog(-power_of<2>(-1.0i + wx)) * ((-1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)))
-                + trilog(-((xd + 1.0i * wx * xd) / (wx - xd))) * (lnhalf / 2.0 + (3.0 * ln2) / 2.0 + 2.0 * log(1.0 + 1.0i * wx) + log(wx / (1.0i + wx)) / 2.0 + log((1.0i + wx) / wx) / 2.0 - (3.0 * log(wx / (wx - xd))) / 2.0 - log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) + log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)))
-                + trilog((2.0 * wx) / (1.0i + wx)) * (log(1.0 - 1.0i * wx) / 2.0 - log(1.0i / (1.0i + wx)) / 2.0 - log(1.0 + 1.0i * xd) - log((1.0i + wx) / (1.0i + xd)) / 2.0 + log((1.0i - xd) / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i + wx)) / 2.0 - 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv))) + trilog(2.0 - (2.0 * 1.0i) / wx) * ((2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)))
-                + dilog(2.0 - (2.0 * 1.0i) / wx) * ((-2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(-real(xdinv))) + power_of<2>(log((-1.0i + 1.0 / wx) * xd)) * ((-1.0i) * M_PI * H1(wx * xdinv, -1.0i / xd) * ln2 * my_sign(-real(xdinv)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, -1.0i / xd) * log((-1.0i + wx) / wx) * my_sign(-real(xdinv))) + dilog(-power_of<2>(-1.0i + wx)) * (1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(-real(xdinv)))
-                + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) * ((-5.0 * pisqu) / 12.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 4.0 - (lnhalf * log(1.0 + 1.0i * wx)) / 2.0 + (ln2 * log(1.0 + 1.0i * wx)) / 2.0 - power_of<2>(log(1.0 + 1.0i * wx)) - 2.0 * ln2 * log((-1.0i + wx) / wx) - (log(1.0 + 1.0i * wx) * log(wx / (1.0i + wx))) / 2.0 + (log(1.0 + 1.0i * wx) * log((1.0i + wx) / wx)) / 2.0 - log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) + power_of<2>(log(-1.0 + wx * xdinv)) / 4.0 + log(1.0 + 1.0i * wx) * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) * log((-1.0i) * xd) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * log(-((1.0i + xd) / (wx - xd))) * my_sign(real(wx))
-                - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log((1.0i * (1.0i + wx) * xd) / (wx - xd)) * my_sign(-real(xdinv))) + power_of<2>(log(1.0i * (wx - xd))) * ((2.0 * 1.0i) * M_PI * H1(-1.0i / (-1.0i + wx), -1.0i / (-1.0i + xd)) * log(1.0 + 1.0i * xd) * my_sign(real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1(-1.0i / wx, -1.0i / xd) * ln2 * my_sign(-real(xdinv)) - 1.0i * M_PI * H1(-1.0i / wx, -1.0i / xd) * log(1.0 + 1.0i * wx) * my_sign(-real(xdinv)) + log(1.0 - 1.0i * xd) * ((-1.0i) * M_PI * H1(1.0i / xd, 1.0i / wx) * my_sign(real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)))) + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * log(-1.0 + 1.0i / wx) * my_sign(real(xdinv))
-                + (1.0i / 6.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<3>(log(-1.0 + 1.0i / wx)) * my_sign(real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-1.0i / wx) * my_sign(real(xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(1.0 + wxinv * wxinv)) * log(-((2.0 * 1.0i + wx) / wx)) * my_sign(real(xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0i * wx) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(real(xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(wx * (2.0 * 1.0i + wx)) * power_of<2>(log(1.0 + power_of<2>(wx))) * my_sign(real(xdinv))
-                - pisqu * H2(1.0i / xd, wx * xdinv) * H2(wx * xdinv, -1.0i / xd) * my_HT(-r(1.0i / xd, wx * xdinv) + r(wx * xdinv, -1.0i / xd)) * power_of<2>(log((1.0i - wx) / (1.0i + wx))) * my_sign(imag(wx * xdinv)) * my_sign(real(xdinv)) + power_of<3>(log(-1.0 + wx * xdinv)) * (ln2 / 6.0 - log((-1.0i + wx) / wx) / 12.0 - log((1.0i + wx) / wx) / 12.0 - log(1.0 - 1.0i * xd) / 12.0 - log(1.0 + 1.0i * xd) / 12.0 + log(1.0 - xd / wx) / 3.0 - (1.0i / 6.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (1.0i / 6.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
-                + trilog((2.0 * (wx + xd)) * xdinv) * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + dilog((wx + xd) * xdinv) * log(1.0 - power_of<2>(wx) * power_of<2>(xdinv)) * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
+            const complex<double> part4 = + power_of<3>(ln_20) * ((-1.0 / 6.0) * ln_3 + ln_5 / 6.0 - ln_94 / 6.0 + (1.0i / 6.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + trilog(xd / (-1.0i + xd)) * (lnhalf + ln_5 + ln_10 / 2.0 + ln_13 - ln_17 / 2.0 + ln_27 / 2.0 - ln_28 + 2.0 * ln_50 - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
+                + trilog((1.0i + wx) / (wx - xd)) * (-2.0 * ln2 - ln_11 - 4.0 * ln_27 - ln_28 - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + trilog((2.0 * wx) / (wx - xd)) * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
+                + trilog((2.0 * xd) / (-1.0i + xd)) * (ln_5 / 2.0 - ln_10 / 2.0 + ln_17 / 2.0 - ln_16 / 2.0 - ln_50 + ln_55 + 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + ln_20 * ((-1.0 / 6.0) * (pisqu * ln_3) + (pisqu * ln_5) / 6.0 + power_of<3>(ln_28) / 3.0 - (pisqu * ln_94) / 6.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)))
+                + ln_117 * ((ln2 * power_of<2>(ln_5)) / 4.0 + (ln_3 * power_of<2>(ln_5)) / 4.0 + (ln2 * power_of<2>(ln_11)) / 2.0 + (power_of<2>(ln_11) * ln_16) / 2.0 + (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx))) + power_of<2>(ln_22) * (1.0i * M_PI * H1(xd / wx, 1.0i / wx) * ln2 * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H1(xd / wx, 1.0i / wx) * ln_3 * my_sign(real(1.0 / wx)))
+                + power_of<2>(ln_20) * ((5.0 * pisqu) / 24.0 + (ln_5 * ln_8) / 2.0 + power_of<2>(ln_15) / 8.0 + (ln_28 * ln_42) / 2.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_63 * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * ln_117 * my_sign(real(1.0 / wx)))
+                + ln_76 * ((-0.25) * (ln2squ * ln_3) - (ln2squ * ln_12) / 4.0 + (ln2squ * ln_11) / 4.0 + (ln2squ * ln_13) / 4.0 + (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_71) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(ln_93) * my_sign(-real(1.0 / wx)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(ln_117) * my_sign(real(1.0 / wx)))
+                + li2_19 * (li2_38 / 2.0 - (ln2 * ln_5) / 2.0 + (ln2 * ln_10) / 2.0 - (ln2 * ln_17) / 2.0 + (ln2 * ln_16) / 2.0 - 2.0 * ln2 * ln_94 + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_56 * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_63 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * ln_117 * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * ln_92 * my_sign(real(1.0 / wx)))
+                + li2_50 * ((-1.0 / 3.0) * pisqu - li2_19 / 2.0 + (5.0 * li2_30) / 4.0 + li2_40 / 2.0 - li2_38 / 4.0 - ln_5 * ln_8 + ln_28 * ln_42 - ln_99 * ln_94 - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_56 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * ln_92 * my_sign(real(1.0 / wx)))
+                + ln_77 * ((-0.25) * (ln2squ * ln_5) + (ln2squ * ln_10) / 4.0 - (ln2squ * ln_17) / 4.0 + (ln2squ * ln_16) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_91) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(ln_116) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(ln_92) * my_sign(real(1.0 / wx))) - (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * power_of<2>(ln_117) * ln_102 * my_sign(-real(wx))
+                - pisqu * H2((-1.0i) * wx, wx * xdinv) * H2(wx * xdinv, -1.0i / xd) * my_HT(-r((-1.0i) * wx, wx * xdinv) + r(wx * xdinv, -1.0i / xd)) * power_of<2>(log((1.0 + 1.0i * xd) / (1.0i * xd + wx * xd))) * my_sign(imag(wx * xdinv)) * my_sign(-real(wx)) + trilog((1.0i + wx + xd - 1.0i * wx * xd) * xdinv) * ((-1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + dilog((1.0i + wx + xd - 1.0i * wx * xd) * xdinv) * ln_118 * (1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))
+                + trilog((-2.0 * 1.0i) / (-1.0i + xd)) * ((-0.5) * ln_5 + ln_16 / 2.0 - 3.0 * ln_27 - 2.0 * ln_94 + (2.0 * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + power_of<2>(ln_39) * ((-1.0i) * M_PI * H1(xd / (1.0i + xd), wx / (1.0i + wx)) * ln_16 * my_sign(-imag(wx / (1.0i + wx))) - 1.0i * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * ln2 * my_sign(-real(wx))) + power_of<2>(log((1.0i * (-1.0 + wx * xdinv)) / wx)) * ((-1.0i) * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * ln2 * my_sign(-real(wx)) - 1.0i * M_PI * H1((-1.0i) * xd, (-1.0i) * wx) * ln_16 * my_sign(-real(wx)))
+                + li2_42 * (pisqu / 4.0 + li2_37 / 4.0 + power_of<2>(ln_1) / 4.0 + ln_3 * ln_9 - (3.0 * power_of<2>(ln_27)) / 2.0 + ln_27 * (3.0 * ln2 - (3.0 * ln_3) / 2.0 + 2.0 * ln_5 + ln_11 + ln_43) + 2.0 * ln_16 * ln_68 - ln_16 * ln_102 - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_91 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * ln_116 * my_sign(-real(1.0 / wx))
+                + ln_118 * ((-1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))) - 1.0i * M_PI * H1(1.0i * xd, 1.0i * wx) * ln2 * power_of<2>(ln_19) * my_sign(real(wx)) - (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * power_of<2>(ln_116) * ln_104 * my_sign(real(wx)) - pisqu * H2(1.0i * wx, wx * xdinv) * H2(wx * xdinv, 1.0i / xd) * my_HT(-r(1.0i * wx, wx * xdinv) + r(wx * xdinv, 1.0i / xd)) * power_of<2>(log((1.0 - 1.0i * xd) / ((-1.0i + wx) * xd))) * my_sign(imag(wx * xdinv)) * my_sign(real(wx))
+                + trilog(((1.0 + 1.0i * wx) * (-1.0i + xd)) * xdinv) * ((-1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))) + dilog(((1.0 + 1.0i * wx) * (-1.0i + xd)) * xdinv) * ln_118 * (1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))) + trilog((2.0 * 1.0i) / (1.0i + xd)) * ((-0.5) * ln_3 + ln_11 / 2.0 - 3.0 * ln_28 - 2.0 * ln_94 + (2.0 * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))
+                + power_of<2>(log(((-1.0i) * (-1.0 + wx * xdinv)) / wx)) * ((-1.0i) * M_PI * H1(1.0i * xd, 1.0i * wx) * ln2 * my_sign(real(wx)) - 1.0i * M_PI * H1(1.0i * xd, 1.0i * wx) * ln_11 * my_sign(real(wx))) + power_of<2>(ln_118) * (log((1.0i * (-1.0 + wx * (1.0i + xd))) * xdinv) * ((1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx))) + log((1.0i - wx - 1.0i * wx * xd) * xdinv) * ((1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx))))
+                + li2_39 * (pisqu / 4.0 - li2_40 / 2.0 + li2_38 / 4.0 + ln_5 * ln_8 + power_of<2>(ln_15) / 4.0 - (3.0 * power_of<2>(ln_28)) / 2.0 + ln_28 * (3.0 * ln2 + 2.0 * ln_3 - (3.0 * ln_5) / 2.0 + ln_16 + ln_42) + 2.0 * ln_11 * ln_55 - ln_11 * ln_104 - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_63 * my_sign(imag(wx * xdinv))
+                + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * ln_117 * my_sign(real(1.0 / wx)) + ln_118 * ((-1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))) + 1.0i * M_PI * H1(-(xd / (wx - xd)), -1.0i / (-1.0i + wx)) * ln_5 * power_of<2>(log(-((wx + 1.0i * wx * xd) * xdinv))) * my_sign(real(1.0 / (-1.0i + wx))) + power_of<2>(ln_90) * (1.0i * M_PI * H1(-(xd / (wx - xd)), 1.0i / (1.0i + wx)) * ln_3 * my_sign(-real(1.0 / (1.0i + wx))) - 1.0i * M_PI * H1(-(xd / (wx - xd)), 1.0i / (1.0i + wx)) * ln_3 * my_sign(real(1.0 / (1.0i + wx))))
+                - 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_109) * log(-1.0 + (2.0 * 1.0i) / wx) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_109) * ln_7 * my_sign(-real(xdinv)) + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, -1.0i / xd) * ln_15 * my_sign(-real(xdinv)) + (1.0i / 6.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<3>(ln_15) * my_sign(-real(xdinv)) - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_8 * power_of<2>(ln_110) * my_sign(-real(xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * log(wx * (-2.0 * 1.0i + wx)) * power_of<2>(ln_110) * my_sign(-real(xdinv))
+                - (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * power_of<2>(ln_49) * ln_104 * my_sign(-real(xdinv)) - pisqu * H2(-1.0i / xd, wx * xdinv) * H2(wx * xdinv, 1.0i / xd) * my_HT(-r(-1.0i / xd, wx * xdinv) + r(wx * xdinv, 1.0i / xd)) * power_of<2>(ln_119) * my_sign(imag(wx * xdinv)) * my_sign(-real(xdinv)) + trilog(-power_of<2>(-1.0i + wx)) * ((-1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)))
+                + trilog(-((xd + 1.0i * wx * xd) / (wx - xd))) * (lnhalf / 2.0 + (3.0 * ln2) / 2.0 + 2.0 * ln_5 + ln_17 / 2.0 + ln_16 / 2.0 - (3.0 * ln_24) / 2.0 - ln_27 + 2.0 * ln_28 + ln_94 + ln_102 / 2.0 + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)))
+                + trilog((2.0 * wx) / (1.0i + wx)) * (ln_3 / 2.0 - ln_13 / 2.0 - ln_28 - ln_67 / 2.0 + ln_76 / 2.0 + ln_73 / 2.0 - 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv))) + trilog(2.0 - (2.0 * 1.0i) / wx) * ((2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)))
+                + dilog(2.0 - (2.0 * 1.0i) / wx) * ((-2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_109 * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_109 * my_sign(-real(xdinv))) + power_of<2>(ln_46) * ((-1.0i) * M_PI * H1(wx * xdinv, -1.0i / xd) * ln2 * my_sign(-real(xdinv)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, -1.0i / xd) * ln_11 * my_sign(-real(xdinv))) + dilog(-power_of<2>(-1.0i + wx)) * (1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_110 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_110 * my_sign(-real(xdinv)))
+                + li2_28 * ((-5.0 * pisqu) / 12.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(ln_4) / 4.0 - (lnhalf * ln_5) / 2.0 + (ln2 * ln_5) / 2.0 - power_of<2>(ln_5) - 2.0 * ln2 * ln_11 - (ln_5 * ln_17) / 2.0 + (ln_5 * ln_16) / 2.0 - ln_11 * ln_16 + power_of<2>(ln_23) / 4.0 + ln_5 * ln_27 - 2.0 * ln_28 * ln_42 - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * ln_116 * my_sign(real(wx))
+                - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_49 * my_sign(-real(xdinv))) + power_of<2>(ln_29) * ((2.0 * 1.0i) * M_PI * H1(-1.0i / (-1.0i + wx), -1.0i / (-1.0i + xd)) * ln_28 * my_sign(real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1(-1.0i / wx, -1.0i / xd) * ln2 * my_sign(-real(xdinv)) - 1.0i * M_PI * H1(-1.0i / wx, -1.0i / xd) * ln_5 * my_sign(-real(xdinv)) + ln_27 * ((-1.0i) * M_PI * H1(1.0i / xd, 1.0i / wx) * my_sign(real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)))) + (1.0i / 6.0) * power_of<3>(M_PI) * H2(wx * xdinv, 1.0i / xd) * ln_1 * my_sign(real(xdinv))
+                + (1.0i / 6.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<3>(ln_1) * my_sign(real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_109) * ln_6 * my_sign(real(xdinv)) - 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_109) * log(-((2.0 * 1.0i + wx) / wx)) * my_sign(real(xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * ln_9 * power_of<2>(ln_110) * my_sign(real(xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * log(wx * (2.0 * 1.0i + wx)) * power_of<2>(ln_110) * my_sign(real(xdinv))
+                - pisqu * H2(1.0i / xd, wx * xdinv) * H2(wx * xdinv, -1.0i / xd) * my_HT(-r(1.0i / xd, wx * xdinv) + r(wx * xdinv, -1.0i / xd)) * power_of<2>(ln_120) * my_sign(imag(wx * xdinv)) * my_sign(real(xdinv)) + power_of<3>(ln_23) * (ln2 / 6.0 - ln_11 / 12.0 - ln_16 / 12.0 - ln_27 / 12.0 - ln_28 / 12.0 + ln_94 / 3.0 - (1.0i / 6.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (1.0i / 6.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
+                + trilog((2.0 * (wx + xd)) * xdinv) * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + dilog((wx + xd) * xdinv) * ln_121 * ((-2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
                 + trilog((-2.0 * xd) / (wx - xd)) * ((2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + trilog((wx + xd) * xdinv) * ((2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
-                + dilog((2.0 * (wx + xd)) * xdinv) * log(1.0 - power_of<2>(wx) * power_of<2>(xdinv)) * ((2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + log(-1.0 + wx * xdinv) * ((pisqu * ln2) / 6.0 - (pisqu * log((-1.0i + wx) / wx)) / 12.0 - (pisqu * log((1.0i + wx) / wx)) / 12.0 - (pisqu * log(1.0 - 1.0i * xd)) / 12.0 - (pisqu * log(1.0 + 1.0i * xd)) / 12.0 + (pisqu * log(1.0 - xd / wx)) / 3.0 - (2.0 * power_of<3>(log(1.0 - xd / wx))) / 3.0 - (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv))
-                - (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + trilog(-power_of<2>(1.0i + wx)) * ((-1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv))) + trilog(-(xd / (wx - xd))) * (-lnhalf - log(wx / (-1.0i + wx)) / 2.0 - 2.0 * log((-1.0i + wx) / wx) - log(wx / (1.0i + wx)) / 2.0 - 2.0 * log((1.0i + wx) / wx) - 2.0 * log(wx / (wx - xd)) + log(1.0 - 1.0i * xd) / 2.0 + log(1.0 + 1.0i * xd) / 2.0 - 2.0 * log(1.0 - xd / wx) - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv))
-                - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv))) + trilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) * (lnhalf / 2.0 + (3.0 * ln2) / 2.0 + 2.0 * log(1.0 - 1.0i * wx) + log(wx / (-1.0i + wx)) / 2.0 + log((-1.0i + wx) / wx) / 2.0 - (3.0 * log(wx / (wx - xd))) / 2.0 + 2.0 * log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) + log(1.0 - xd / wx) + log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)))
-                + trilog((2.0 * wx) / (-1.0i + wx)) * (log(1.0 + 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) / 2.0 - log(1.0 - 1.0i * xd) - log((-1.0i + wx) / (-1.0i + xd)) / 2.0 + log((-1.0i + xd) / (-1.0i + wx)) / 2.0 + log((1.0i + xd) / (1.0i - xd)) / 2.0 - 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv))) + trilog(2.0 + (2.0 * 1.0i) / wx) * ((2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)))
-                + dilog(2.0 + (2.0 * 1.0i) / wx) * ((-2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(real(xdinv))) + power_of<2>(log((1.0i + 1.0 / wx) * xd)) * ((-1.0i) * M_PI * H1(wx * xdinv, 1.0i / xd) * ln2 * my_sign(real(xdinv)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, 1.0i / xd) * log((1.0i + wx) / wx) * my_sign(real(xdinv))) + dilog(-power_of<2>(1.0i + wx)) * (1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(real(xdinv)))
-                + dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) * ((-5.0 * pisqu) / 12.0 + dilog((-1.0i + xd) / (-wx + xd)) / 4.0 + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(log(-1.0 - 1.0i * wx)) / 4.0 - (lnhalf * log(1.0 - 1.0i * wx)) / 2.0 + (ln2 * log(1.0 - 1.0i * wx)) / 2.0 - power_of<2>(log(1.0 - 1.0i * wx)) - (log(1.0 - 1.0i * wx) * log(wx / (-1.0i + wx))) / 2.0 + (log(1.0 - 1.0i * wx) * log((-1.0i + wx) / wx)) / 2.0 - 2.0 * ln2 * log((1.0i + wx) / wx) - log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) + power_of<2>(log(-1.0 + wx * xdinv)) / 4.0 + log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * xd) - 2.0 * log(1.0 - 1.0i * xd) * log(1.0i * xd)
-                - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * log((-1.0i + xd) / (-wx + xd)) * my_sign(-real(wx)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(-((xd + 1.0i * wx * xd) / (wx - xd))) * my_sign(real(xdinv))) + dilog(-(xd / (wx - xd))) * (pisqu / 3.0 - (3.0 * dilog((1.0i * (1.0i + wx) * xd) / (wx - xd))) / 4.0 - dilog(-((1.0i + xd) / (wx - xd))) / 4.0 - dilog((-1.0i + xd) / (-wx + xd)) / 4.0 - (3.0 * dilog(-((xd + 1.0i * wx * xd) / (wx - xd)))) / 4.0 + 2.0 * log(1.0i / wx) * log((-1.0i + wx) / wx) + 2.0 * log(-1.0i / wx) * log((1.0i + wx) / wx) + 2.0 * log(xd / wx) * log(1.0 - xd / wx) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * log((-1.0i + xd) / (-wx + xd)) * my_sign(-real(wx))
-                + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * log(-((1.0i + xd) / (wx - xd))) * my_sign(real(wx)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log((1.0i * (1.0i + wx) * xd) / (wx - xd)) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(-((xd + 1.0i * wx * xd) / (wx - xd))) * my_sign(real(xdinv))) + power_of<2>(log(1.0 - power_of<2>(wx) * power_of<2>(xdinv))) * (log(-(wx * xdinv)) * ((-1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
-                + log(-1.0 - (2.0 * wx) * xdinv) * (1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))) + 1.0i * M_PI * H1(-1.0i / (-1.0i + wx), (1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * log(1.0 + 1.0i * wx) * power_of<2>(log(((1.0 + 1.0i * wx) * wx) / (wx - xd))) * my_sign(real((wx - xd) / ((-1.0i + wx) * xd))) + 1.0i * M_PI * H1(-1.0i / (-1.0i + wx), (1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * log(1.0 + 1.0i * wx) * power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + wx)))) * my_sign(real((wx - xd) / ((-1.0i + wx) * xd)))
-                + power_of<2>(log((-1.0i) * (wx - xd))) * ((-2.0 * 1.0i) * M_PI * H1(1.0i / wx, 1.0i / xd) * ln2 * my_sign(real(xdinv)) - 1.0i * M_PI * H1(1.0i / wx, 1.0i / xd) * log(1.0 - 1.0i * wx) * my_sign(real(xdinv)) + log(1.0 + 1.0i * xd) * (((-0.5) * 1.0i) * M_PI * H1(-1.0i / xd, -1.0i / wx) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), 1.0i / (1.0i + xd)) * log(1.0 - 1.0i * xd) * my_sign(real(1.0 / (1.0i + xd)))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), ((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * log(1.0 - 1.0i * wx) * power_of<2>(log(((1.0 - 1.0i * wx) * wx) / (wx - xd))) * my_sign(-real((wx - xd) / (1.0i * xd + wx * xd)))
-                + 1.0i * M_PI * H1(1.0i / (1.0i + wx), ((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * log(1.0 - 1.0i * wx) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + wx)))) * my_sign(-real((wx - xd) / (1.0i * xd + wx * xd))) - (1.0i / 6.0) * power_of<3>(M_PI) * lnm2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * power_of<3>(M_PI) * log(-1.0 - 1.0i * wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(log(-1.0 - 1.0i * wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)
-                + trilog(-1.0i / (-1.0i + wx)) * (-lnhalf + ln2 / 2.0 + 3.0 * log((-1.0i) * wx) + 2.0 * log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) / 2.0 - 3.0 * log((1.0i + wx) / (-1.0i + wx)) + (5.0 * log(0.5 - (1.0i / 2.0) * xd)) / 2.0 + 2.0 * log(1.0 - 1.0i * xd) + (5.0 * log(1.0 + 1.0i * xd)) / 2.0 - 3.0 * log((-1.0i) * xd) + log(xd) + log((1.0i - xd) / (1.0i + xd)) / 2.0 + log(xd / (1.0i + xd)) - log(1.0 - xd / wx) / 2.0 + log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
-                + trilog((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * (-2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 - 3.0 * log((-1.0i + wx) / wx) + (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - 2.0 * log(1.0 + 1.0i * xd) + log(xd) + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)) + dilog(-1.0i / (-1.0i + wx)) * ((11.0 * pisqu) / 12.0 - dilog((-2.0 * 1.0i) / (-1.0i + wx)) + dilog((1.0i + wx) / (1.0i - wx)) / 2.0 - dilog(0.5 + (1.0i / 2.0) * xd) / 2.0 - dilog(1.0 + 1.0i * xd) - (3.0 * dilog((-1.0i) * xd)) / 2.0 + dilog(1.0i * xd) - dilog(-(xd / (wx - xd))) / 4.0 + dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 - dilog((-1.0i + xd) / (-1.0i + wx)) / 2.0 + dilog(1.0i / (1.0i + xd)) / 2.0
-                - dilog(xd / (1.0i + xd)) / 4.0 + dilog((2.0 * xd) / (1.0i + xd)) / 2.0 + (3.0 * power_of<2>(log(1.0i / (-1.0i + wx)))) / 4.0 - 2.0 * log(1.0i / wx) * log((-1.0i + wx) / wx) + power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * (-2.0 * lnhalf + log(1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * (-2.0 * lnhalf - log(0.5 - (1.0i / 2.0) * xd) / 2.0 - 3.0 * log((-1.0i) * xd) + log(xd)) + (ln2 * log((1.0i - xd) / (1.0i + xd))) / 2.0 + (log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd))) / 2.0 - 1.0i * M_PI * log(1.0 - wx * xdinv) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
-                + dilog(1.0 + 1.0i * wx) * ((5.0 * pisqu) / 12.0 - dilog((1.0i + wx) / (1.0i - wx)) / 2.0 + (3.0 * dilog(1.0 - wx * xdinv)) / 4.0 + dilog(0.5 + (1.0i / 2.0) * xd) / 2.0 + dilog(1.0 - 1.0i * xd) / 2.0 + dilog(1.0i * xd) - dilog(-(xd / (wx - xd))) - dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 - dilog((-1.0i + xd) / (-1.0i + wx)) / 2.0 + 2.0 * dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) + power_of<2>(lnm2) / 8.0 + 2.0 * ln2 * log((-1.0i + wx) / wx) + log(1.0i / wx) * log((-1.0i + wx) / wx) + log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) + (3.0 * power_of<2>(log(-1.0 + wx * xdinv))) / 8.0 + log((-1.0i + wx) / wx) * log(1.0 - 1.0i * xd) + power_of<2>(log(-1.0 + 1.0i * xd)) / 4.0
-                - log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + log(1.0 + 1.0i * xd) * (-3.0 * log((-1.0i + wx) / wx) - log((-1.0i + wx) / (wx - xd)) + log((wx - xd) / (-1.0i + wx)) - log((2.0 * 1.0i) / (1.0i + xd)) / 2.0) + (log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) / 2.0 + 2.0 * log((-1.0i + wx) / wx) * log(1.0 - xd / wx) + log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(-real(xdinv)) + 1.0i * M_PI * log(1.0 - wx * xdinv) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
-                + dilog((-1.0i) * wx) * (pisqu / 6.0 + dilog(1.0 - wx * xdinv) / 2.0 + dilog(0.5 + (1.0i / 2.0) * xd) + (3.0 * dilog((-1.0i) * xd)) / 2.0 - 2.0 * dilog(1.0i * xd) - dilog(-(xd / (wx - xd))) / 2.0 + dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) + dilog(xd / (1.0i + xd)) / 2.0 - dilog((2.0 * xd) / (1.0i + xd)) / 2.0 + power_of<2>(lnm2) / 4.0 + power_of<2>(log(-1.0 + wx * xdinv)) / 4.0 + (ln2 - log((1.0i + wx) / wx) / 2.0) * log(1.0 - 1.0i * xd) - (ln2 * log((1.0i - xd) / (1.0i + xd))) / 2.0 - (log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) / 2.0
-                + log(1.0 + 1.0i * xd) * (-2.0 * ln2 - 2.0 * log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx) / 2.0 + log(0.5 - (1.0i / 2.0) * xd) / 2.0 - log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 - log(1.0 - xd / wx) / 2.0) - 2.0 * ln2 * log(1.0 - xd / wx) - power_of<2>(log(1.0 - xd / wx)) / 2.0 + (log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd))) / 2.0 + (2.0 * 1.0i) * M_PI * log(1.0 - wx * xdinv) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * lnm2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
-                - (1.0i / 6.0) * power_of<3>(M_PI) * log(-1.0 + 1.0i * wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(log(-1.0 + 1.0i * wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + power_of<3>(log(1.0 - wx * xdinv)) * (((2.0 * 1.0i) / 3.0) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + ((2.0 * 1.0i) / 3.0) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv));
+                + dilog((2.0 * (wx + xd)) * xdinv) * ln_121 * ((2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + (2.0 * 1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + ln_23 * ((pisqu * ln2) / 6.0 - (pisqu * ln_11) / 12.0 - (pisqu * ln_16) / 12.0 - (pisqu * ln_27) / 12.0 - (pisqu * ln_28) / 12.0 + (pisqu * ln_94) / 3.0 - (2.0 * power_of<3>(ln_94)) / 3.0 - (1.0i / 6.0) * power_of<3>(M_PI) * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv))
+                - (1.0i / 6.0) * power_of<3>(M_PI) * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + trilog(-power_of<2>(1.0i + wx)) * ((-1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv))) + trilog(-(xd / (wx - xd))) * (-lnhalf - ln_12 / 2.0 - 2.0 * ln_11 - ln_17 / 2.0 - 2.0 * ln_16 - 2.0 * ln_24 + ln_27 / 2.0 + ln_28 / 2.0 - 2.0 * ln_94 - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) - 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv))
+                - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv))) + trilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) * (lnhalf / 2.0 + (3.0 * ln2) / 2.0 + 2.0 * ln_3 + ln_12 / 2.0 + ln_11 / 2.0 - (3.0 * ln_24) / 2.0 + 2.0 * ln_27 - ln_28 + ln_94 + ln_104 / 2.0 + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)))
+                + trilog((2.0 * wx) / (-1.0i + wx)) * (ln_5 / 2.0 - ln_10 / 2.0 - ln_27 - ln_54 / 2.0 + ln_58 / 2.0 + ln_77 / 2.0 - 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv))) + trilog(2.0 + (2.0 * 1.0i) / wx) * ((2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)))
+                + dilog(2.0 + (2.0 * 1.0i) / wx) * ((-2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_109 * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_109 * my_sign(real(xdinv))) + power_of<2>(ln_47) * ((-1.0i) * M_PI * H1(wx * xdinv, 1.0i / xd) * ln2 * my_sign(real(xdinv)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, 1.0i / xd) * ln_16 * my_sign(real(xdinv))) + dilog(-power_of<2>(1.0i + wx)) * (1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_110 * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_110 * my_sign(real(xdinv)))
+                + li2_32 * ((-5.0 * pisqu) / 12.0 + li2_43 / 4.0 + li2_28 / 2.0 - power_of<2>(lnm2) / 4.0 - power_of<2>(ln_2) / 4.0 - (lnhalf * ln_3) / 2.0 + (ln2 * ln_3) / 2.0 - power_of<2>(ln_3) - (ln_3 * ln_12) / 2.0 + (ln_3 * ln_11) / 2.0 - 2.0 * ln2 * ln_16 - ln_11 * ln_16 + power_of<2>(ln_23) / 4.0 + ln_3 * ln_28 - 2.0 * ln_27 * ln_43
+                - 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * ln_117 * my_sign(-real(wx)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_105 * my_sign(real(xdinv))) + li2_51 * (pisqu / 3.0 - (3.0 * li2_32) / 4.0 - li2_45 / 4.0 - li2_43 / 4.0 - (3.0 * li2_28) / 4.0 + 2.0 * ln_7 * ln_11 + 2.0 * ln_6 * ln_16 + 2.0 * ln_99 * ln_94 + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * ln_117 * my_sign(-real(wx))
+                + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * ln_116 * my_sign(real(wx)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_49 * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_105 * my_sign(real(xdinv))) + power_of<2>(ln_121) * (log(-(wx * xdinv)) * ((-1.0i) * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))
+                + log(-1.0 - (2.0 * wx) * xdinv) * (1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)))) + 1.0i * M_PI * H1(-1.0i / (-1.0i + wx), (1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * ln_5 * power_of<2>(log(((1.0 + 1.0i * wx) * wx) / (wx - xd))) * my_sign(real((wx - xd) / ((-1.0i + wx) * xd))) + 1.0i * M_PI * H1(-1.0i / (-1.0i + wx), (1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * ln_5 * power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + wx)))) * my_sign(real((wx - xd) / ((-1.0i + wx) * xd)))
+                + power_of<2>(ln_30) * ((-2.0 * 1.0i) * M_PI * H1(1.0i / wx, 1.0i / xd) * ln2 * my_sign(real(xdinv)) - 1.0i * M_PI * H1(1.0i / wx, 1.0i / xd) * ln_3 * my_sign(real(xdinv)) + ln_28 * (((-0.5) * 1.0i) * M_PI * H1(-1.0i / xd, -1.0i / wx) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), 1.0i / (1.0i + xd)) * ln_27 * my_sign(real(1.0 / (1.0i + xd)))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), ((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * ln_3 * power_of<2>(log(((1.0 - 1.0i * wx) * wx) / (wx - xd))) * my_sign(-real((wx - xd) / (1.0i * xd + wx * xd)))
+                + 1.0i * M_PI * H1(1.0i / (1.0i + wx), ((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * ln_3 * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + wx)))) * my_sign(-real((wx - xd) / (1.0i * xd + wx * xd))) - (1.0i / 6.0) * power_of<3>(M_PI) * lnm2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * power_of<3>(M_PI) * ln_2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(ln_2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)
+                + trilog(-1.0i / (-1.0i + wx)) * (-lnhalf + ln2 / 2.0 + 3.0 * ln_8 + 2.0 * ln_11 + ln_16 / 2.0 - 3.0 * ln_87 + (5.0 * ln_25) / 2.0 + 2.0 * ln_27 + (5.0 * ln_28) / 2.0 - 3.0 * ln_42 + ln_44 + ln_76 / 2.0 + ln_88 - ln_94 / 2.0 + ln_102 / 2.0 - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
+                + trilog((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) * (-2.0 * ln2 - ln_3 / 2.0 - 3.0 * ln_11 + (3.0 * ln_27) / 2.0 - 2.0 * ln_28 + ln_44 + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)) + li2_3 * ((11.0 * pisqu) / 12.0 - li2_15 + li2_31 / 2.0 - li2_7 / 2.0 - li2_52 - (3.0 * li2_8) / 2.0 + li2_9 - li2_51 / 4.0 + li2_32 / 2.0 - li2_16 / 2.0 + li2_12 / 2.0
+                - li2_49 / 4.0 + li2_17 / 2.0 + (3.0 * power_of<2>(ln_122)) / 4.0 - 2.0 * ln_7 * ln_11 + power_of<2>(ln_27) / 2.0 + power_of<2>(ln_28) / 2.0 + ln_27 * (-2.0 * lnhalf + ln_28) + ln_28 * (-2.0 * lnhalf - ln_25 / 2.0 - 3.0 * ln_42 + ln_44) + (ln2 * ln_76) / 2.0 + (ln_3 * ln_102) / 2.0 - 1.0i * M_PI * ln_123 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
+                + li2_2 * ((5.0 * pisqu) / 12.0 - li2_31 / 2.0 + (3.0 * li2_47) / 4.0 + li2_7 / 2.0 + li2_53 / 2.0 + li2_9 - li2_51 - li2_32 / 2.0 - li2_16 / 2.0 + 2.0 * li2_28 + power_of<2>(lnm2) / 8.0 + 2.0 * ln2 * ln_11 + ln_7 * ln_11 + ln_11 * ln_16 + (3.0 * power_of<2>(ln_23)) / 8.0 + ln_11 * ln_27 + power_of<2>(ln_86) / 4.0
+                - ln_5 * ln_55 + ln_28 * (-3.0 * ln_11 - ln_96 + ln_34 - ln_74 / 2.0) + (ln_3 * ln_68) / 2.0 + 2.0 * ln_11 * ln_94 + ln_5 * ln_104 - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_110 * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * ln_110 * my_sign(-real(xdinv)) + 1.0i * M_PI * ln_123 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv))
+                + li2_54 * (pisqu / 6.0 + li2_47 / 2.0 + li2_7 + (3.0 * li2_8) / 2.0 - 2.0 * li2_9 - li2_51 / 2.0 + li2_32 + li2_49 / 2.0 - li2_17 / 2.0 + power_of<2>(lnm2) / 4.0 + power_of<2>(ln_23) / 4.0 + (ln2 - ln_16 / 2.0) * ln_27 - (ln2 * ln_76) / 2.0 - (ln_3 * ln_68) / 2.0
+                + ln_28 * (-2.0 * ln2 - 2.0 * ln_3 + ln_16 / 2.0 + ln_25 / 2.0 - ln_74 / 2.0 - ln_94 / 2.0) - 2.0 * ln2 * ln_94 - power_of<2>(ln_94) / 2.0 + (ln_3 * ln_102) / 2.0 + (2.0 * 1.0i) * M_PI * ln_123 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv)) - (1.0i / 6.0) * power_of<3>(M_PI) * lnm2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
+                - (1.0i / 6.0) * power_of<3>(M_PI) * ln_4 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 6.0) * M_PI * power_of<3>(ln_4) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + power_of<3>(ln_123) * (((2.0 * 1.0i) / 3.0) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + ((2.0 * 1.0i) / 3.0) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv));
 
-            const complex<double> part5 = + trilog(1.0i / (1.0i + wx)) * (-lnhalf + ln2 / 2.0 + 3.0 * log(1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 - 3.0 * log((-1.0i + wx) / (1.0i + wx)) + 2.0 * log((1.0i + wx) / wx) + (5.0 * log(0.5 + (1.0i / 2.0) * xd)) / 2.0 + (5.0 * log(1.0 - 1.0i * xd)) / 2.0 + 2.0 * log(1.0 + 1.0i * xd) - 3.0 * log(1.0i * xd) + log(xd) + log(xd / (-1.0i + xd)) + log((1.0i + xd) / (1.0i - xd)) / 2.0 - log(1.0 - xd / wx) / 2.0 + log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + trilog(2.0) * (log(1.0 - wx * xdinv) - 2.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) + 2.0 * log(xd) - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 + 12.0 * log(1.0 - xd / wx) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + trilog(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * (-2.0 * ln2 - log(1.0 + 1.0i * wx) / 2.0 - 3.0 * log((1.0i + wx) / wx) - 2.0 * log(1.0 - 1.0i * xd) + (3.0 * log(1.0 + 1.0i * xd)) / 2.0 + log(xd) + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + trilog((-wx + xd) / (2.0 * xd)) * ((2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + trilog(1.0 - wx * xdinv) * (9.0 * ln2 - 2.0 * log(1.0 - 1.0i * wx) - 2.0 * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) + log(1.0 - 1.0i * xd) / 2.0 + log(1.0 + 1.0i * xd) / 2.0 + 2.0 * log(1.0 - xd / wx) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + log(1.0 - wx * xdinv) * ((pisqu * lnm2) / 6.0 + power_of<3>(lnm2) / 6.0 - (power_of<2>(log(1.0 - 1.0i * xd)) * log((-2.0 * 1.0i) / (-1.0i + xd))) / 4.0 - (power_of<2>(log(1.0 + 1.0i * xd)) * log((2.0 * 1.0i) / (1.0i + xd))) / 4.0 + 1.0i * power_of<3>(M_PI) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(log(-1.0 - 1.0i * wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + 1.0i * power_of<3>(M_PI) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
-                + (1.0i / 2.0) * M_PI * power_of<2>(log(-1.0 + 1.0i * wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + dilog(1.0i / (1.0i + wx)) * ((11.0 * pisqu) / 12.0 - dilog((2.0 * 1.0i) / (1.0i + wx)) + dilog((1.0i - wx) / (1.0i + wx)) / 2.0 - dilog(0.5 - (1.0i / 2.0) * xd) / 2.0 - dilog(1.0 - 1.0i * xd) + dilog((-1.0i) * xd) - (3.0 * dilog(1.0i * xd)) / 2.0 - dilog(-(xd / (wx - xd))) / 4.0 + dilog(-1.0i / (-1.0i + xd)) / 2.0 - dilog(xd / (-1.0i + xd)) / 4.0 + dilog((2.0 * xd) / (-1.0i + xd)) / 2.0 - dilog((1.0i + xd) / (1.0i + wx)) / 2.0 + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 + (3.0 * power_of<2>(log(-1.0i / (1.0i + wx)))) / 4.0 - 2.0 * log(-1.0i / wx) * log((1.0i + wx) / wx) + power_of<2>(log(1.0 - 1.0i * xd)) / 2.0
-                - 2.0 * lnhalf * log(1.0 + 1.0i * xd) + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * (-2.0 * lnhalf - log(0.5 + (1.0i / 2.0) * xd) / 2.0 + log(1.0 + 1.0i * xd) - 3.0 * log(1.0i * xd) + log(xd)) + (ln2 * log((1.0i + xd) / (1.0i - xd))) / 2.0 + (log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd))) / 2.0 - 1.0i * M_PI * log(1.0 - wx * xdinv) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + dilog(1.0 - 1.0i * wx) * ((5.0 * pisqu) / 12.0 - dilog((1.0i - wx) / (1.0i + wx)) / 2.0 + (3.0 * dilog(1.0 - wx * xdinv)) / 4.0 + dilog(0.5 - (1.0i / 2.0) * xd) / 2.0 + dilog(1.0 + 1.0i * xd) / 2.0 + dilog((-1.0i) * xd) - dilog(-(xd / (wx - xd))) + 2.0 * dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) - dilog((1.0i + xd) / (1.0i + wx)) / 2.0 - dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 + power_of<2>(lnm2) / 8.0 + 2.0 * ln2 * log((1.0i + wx) / wx) + log(-1.0i / wx) * log((1.0i + wx) / wx) + log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) + (3.0 * power_of<2>(log(-1.0 + wx * xdinv))) / 8.0 + power_of<2>(log(-1.0 - 1.0i * xd)) / 4.0 + log((1.0i + wx) / wx) * log(1.0 + 1.0i * xd)
-                + log(1.0 - 1.0i * xd) * (-3.0 * log((1.0i + wx) / wx) - log((1.0i + wx) / (wx - xd)) + log((wx - xd) / (1.0i + wx)) - log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0) + (log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))) / 2.0 - log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 2.0 * log((1.0i + wx) / wx) * log(1.0 - xd / wx) + log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * log(1.0 + power_of<2>(wx)) * my_sign(real(xdinv)) + 1.0i * M_PI * log(1.0 - wx * xdinv) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + dilog(1.0i * wx) * (pisqu / 6.0 + dilog(1.0 - wx * xdinv) / 2.0 + dilog(0.5 - (1.0i / 2.0) * xd) - 2.0 * dilog((-1.0i) * xd) + (3.0 * dilog(1.0i * xd)) / 2.0 - dilog(-(xd / (wx - xd))) / 2.0 + dilog(xd / (-1.0i + xd)) / 2.0 - dilog((2.0 * xd) / (-1.0i + xd)) / 2.0 + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) + power_of<2>(lnm2) / 4.0 + power_of<2>(log(-1.0 + wx * xdinv)) / 4.0 + (ln2 - log((-1.0i + wx) / wx) / 2.0) * log(1.0 + 1.0i * xd) - (log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))) / 2.0 - (ln2 * log((1.0i + xd) / (1.0i - xd))) / 2.0
-                + log(1.0 - 1.0i * xd) * (-2.0 * ln2 - 2.0 * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 + log(0.5 + (1.0i / 2.0) * xd) / 2.0 - log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 - log(1.0 - xd / wx) / 2.0) - 2.0 * ln2 * log(1.0 - xd / wx) - power_of<2>(log(1.0 - xd / wx)) / 2.0 + (log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd))) / 2.0 + (2.0 * 1.0i) * M_PI * log(1.0 - wx * xdinv) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
-                + dilog(2.0) * ((-1.0 / 12.0) * pisqu + dilog(1.0 - 1.0i * wx) / 4.0 + dilog(1.0 + 1.0i * wx) / 4.0 + dilog((-1.0i) * wx) / 2.0 + dilog(1.0i * wx) / 2.0 - dilog(1.0 - wx * xdinv) / 2.0 + dilog((-1.0i) * xd) / 2.0 + dilog(1.0i * xd) / 2.0 - dilog(xd / wx) - dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 - dilog(1.0 - xd / wx) / 2.0 - dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 + power_of<2>(log(-1.0 - 1.0i * wx)) / 8.0 + (ln2 * log(1.0 - 1.0i * wx)) / 2.0 + power_of<2>(log(-1.0 + 1.0i * wx)) / 8.0 + (ln2 * log(1.0 + 1.0i * wx)) / 2.0 - (ln2 * log((-1.0i + wx) / wx)) / 2.0 - (ln2 * log((1.0i + wx) / wx)) / 2.0 - power_of<2>(log(-1.0 + wx * xdinv)) / 4.0 + ln2 * log(1.0 - 1.0i * xd)
-                + ln2 * log(1.0 + 1.0i * xd) + (-log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx)) * log(xd) + (log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))) / 2.0 + (log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) / 2.0 - 8.0 * ln2 * log(1.0 - xd / wx) - power_of<2>(log(-1.0 + xd / wx)) / 4.0 + log(1.0 - wx * xdinv) * (1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)))
-                + power_of<2>(log(1.0 - wx * xdinv)) * ((1.0i / 2.0) * M_PI * lnhalf * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * log(wx / (-1.0i + wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * log(1.0 + 1.0i * xd) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * lnhalf * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
-                + (1.0i / 2.0) * M_PI * log(wx / (1.0i + wx)) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * log((1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * log(1.0 - 1.0i * xd) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + log(wx * xdinv) * ((-2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)))
-                + power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))) * (-(log((-1.0i + wx) / wx) * log((-1.0i + xd) / (-1.0i + wx))) + log((-1.0i + wx) / wx) * log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) + (log(1.0 + 1.0i * wx) * log(-((xd + 1.0i * wx * xd) / (wx - xd)))) / 2.0 + (2.0 * 1.0i) * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * T(1.0, 1.0i / wx, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(((1.0i - wx) * xd) / (wx - xd))) * T(1.0, (-1.0i) * wx, (wx + 1.0i * wx * xd) / (wx - xd)))
-                + power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd))) * (1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * T(1.0, 1.0i / wx, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(((-1.0i + wx) * xd) / (-wx + xd))) * T(1.0, (-1.0i) * wx, (wx + 1.0i * wx * xd) / (wx - xd))) + log(wx * xdinv) * ((4.0 * pisqu * ln2) / 3.0 + (pisqu * log((-1.0i + wx) / wx)) / 4.0 + (pisqu * log((1.0i + wx) / wx)) / 4.0 + (-4.0 * ln2 - (3.0 * log((-1.0i + wx) / wx)) / 4.0 - (3.0 * log((1.0i + wx) / wx)) / 4.0) * power_of<2>(log(1.0 - xd / wx)) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(real(1.0 / (1.0i - wx))) * T(1.0, (-1.0i) * wx, wx * xdinv)
-                + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(1.0 / (1.0i + wx))) * T(1.0, 1.0i * wx, wx * xdinv)) + power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + xd)))) * (-(log((1.0i + wx) / wx) * log((1.0i + xd) / (1.0i + wx))) + log((1.0i + wx) / wx) * log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) + (2.0 * 1.0i) * M_PI * log((1.0i + wx) / wx) * my_sign(imag(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * T(1.0, -1.0i / wx, (1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(((1.0i + wx) * xd) / (wx - xd))) * T(1.0, 1.0i * wx, (wx - 1.0i * wx * xd) / (wx - xd)))
-                + power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd))) * (1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(imag(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * T(1.0, -1.0i / wx, (1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(((1.0i + wx) * xd) / (-wx + xd))) * T(1.0, 1.0i * wx, (wx - 1.0i * wx * xd) / (wx - xd))) + (1.0i / 3.0) * power_of<3>(M_PI) * log(-((1.0i + wx) / wx)) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + (1.0i / 3.0) * M_PI * power_of<3>(log(-((1.0i + wx) / wx))) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<3>(log((-1.0i + xd) * xdinv)) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)
-                + trilog((-1.0i + xd) / (2.0 * xd)) * (log(1.0 - 1.0i * wx) - log((-1.0i + wx) / wx) + 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + trilog((wx * (-1.0i + xd)) / ((1.0i + wx) * xd)) * ((4.0 * 1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv))
-                + trilog((-1.0i + xd) * xdinv) * (-3.0 * ln2 - 3.0 * log(1.0 - 1.0i * wx) + (5.0 * log(1.0 + 1.0i * wx)) / 2.0 + 3.0 * log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) + (3.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(1.0 - xd / wx) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) + (6.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv))
-                + power_of<2>(log((-1.0i + xd) * xdinv)) * ((-1.0i) * M_PI * lnhalf * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * log(1.0i / (1.0i + wx)) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + log(1.0i / xd) * ((-0.5) * (pisqu * ln2) - (pisqu * log(1.0 - 1.0i * wx)) / 3.0 + (pisqu * log(1.0 + 1.0i * wx)) / 4.0 - (pisqu * log((1.0i + wx) / wx)) / 6.0 + power_of<2>(log(1.0 + xdinv * xdinv)) * (((-0.5) * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))
-                + (3.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(imag(wx / (1.0i - wx))) * T(1.0, 1.0i / wx, 1.0i / xd) + (3.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + xd) * xdinv)) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + (1.0i / 3.0) * power_of<3>(M_PI) * log(-1.0 + 1.0i / wx) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + (1.0i / 3.0) * M_PI * power_of<3>(log(-1.0 + 1.0i / wx)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<3>(log((1.0i + xd) * xdinv)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)
-                + trilog((1.0i + xd) / (2.0 * xd)) * (log(1.0 + 1.0i * wx) - log((1.0i + wx) / wx) + 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + trilog((wx * (1.0i + xd)) / ((-1.0i + wx) * xd)) * ((4.0 * 1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv))
-                + trilog((1.0i + xd) * xdinv) * (-3.0 * ln2 + (5.0 * log(1.0 - 1.0i * wx)) / 2.0 - 3.0 * log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) + 3.0 * log((1.0i + wx) / wx) + (3.0 * log(1.0 - 1.0i * xd)) / 2.0 - log(1.0 - xd / wx) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) + (6.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv))
-                + power_of<2>(log((1.0i + xd) * xdinv)) * ((-1.0i) * M_PI * lnhalf * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * log(-1.0i / (-1.0i + wx)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + log(-1.0i / xd) * ((-0.5) * (pisqu * ln2) + (pisqu * log(1.0 - 1.0i * wx)) / 4.0 - (pisqu * log(1.0 + 1.0i * wx)) / 3.0 - (pisqu * log((-1.0i + wx) / wx)) / 6.0 + power_of<2>(log(1.0 + xdinv * xdinv)) * (((-0.5) * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))
-                + (3.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-imag(wx / (1.0i + wx))) * T(1.0, -1.0i / wx, -1.0i / xd) + (3.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + xd) * xdinv)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * log(1.0 + 1.0i * xd) * (-log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) - log(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) + (3.0 * 1.0i) * M_PI * my_sign(real(xd) / 2.0) * T(1.0, (wx - xd) / (-1.0i + wx), ((-0.5) * 1.0i) * (1.0i + xd))) - (1.0i / 3.0) * power_of<3>(M_PI) * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + 1.0i * M_PI * lnhalf * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
-                - 1.0i * M_PI * ln2 * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (3.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + ((2.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * log((-1.0i + wx) / wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
-                + power_of<3>(log(-1.0 - 1.0i * xd)) * ((-0.25) * ln2 - log(1.0 - 1.0i * wx) / 6.0 + log(1.0 - xd / wx) / 12.0 + (1.0i / 3.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + trilog(1.0 + 1.0i * xd) * ((-3.0 * ln2) / 2.0 - log(1.0 - 1.0i * wx) + 2.0 * log(1.0 + 1.0i * wx) + 2.0 * log((-1.0i) * wx) + log(wx / (-1.0i + wx)) + 4.0 * log((-1.0i + wx) / wx) + log((-1.0i + wx) / (wx - xd)) + log((1.0i + wx) / (wx - xd)) + 2.0 * log(1.0 + 1.0i * xd) + log(1.0 - xd / wx) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
-                + trilog(1.0 - 1.0i * wx) * ((-3.0 * ln2) / 2.0 - 3.0 * log(1.0i * wx) - log((-1.0i + wx) / wx) + log(wx / (wx - xd)) + 5.0 * log(1.0 - 1.0i * xd) - 2.0 * log(1.0 + 1.0i * xd) + log(xd) + log((-2.0 * 1.0i) / (-1.0i + xd)) / 2.0 - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 - log((-1.0i + xd) * xdinv) - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - (9.0 * log(1.0 - xd / wx)) / 2.0 + log((wx - 1.0i * wx * xd) / (wx - xd)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
-                + trilog((1.0i + wx) / (1.0i - xd)) * ((4.0 * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + trilog(0.5 - (1.0i / 2.0) * wx) * (lnhalf / 2.0 - log(0.5 + (1.0i / 2.0) * xd) / 2.0 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) + log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 - log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + log(-1.0 - 1.0i * xd) * ((-0.25) * (pisqu * ln2) - (pisqu * log(1.0 - 1.0i * wx)) / 6.0 + (pisqu * log(1.0 - xd / wx)) / 12.0 + (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
-                + power_of<2>(log(-1.0 - 1.0i * xd)) * (pisqu / 24.0 + power_of<2>(log(-1.0 + 1.0i * wx)) / 8.0 - 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + log((-1.0i + xd) * xdinv) * ((-1.0 / 6.0) * (pisqu * log(-1.0 + 1.0i * wx)) - power_of<3>(log(-1.0 + 1.0i * wx)) / 6.0 - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(log(-((1.0i + wx) / wx))) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
-                + log(1.0i * xd) * ((-0.5) * (log(1.0 - 1.0i * wx) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + xd))))) - (power_of<2>(log((1.0i + xd) / (1.0i + wx))) * log(1.0 - xd / wx)) / 2.0 - (log(1.0 - 1.0i * wx) * power_of<2>(log((wx - 1.0i * wx * xd) / (wx - xd)))) / 2.0 + (3.0 * 1.0i) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + dilog(0.5 - (1.0i / 2.0) * wx) * ((-0.25) * dilog(0.5 - (1.0i / 2.0) * xd) + dilog(1.0i * xd) - dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 + 2.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 + 1.0i * xd) + (log(1.0 - 1.0i * wx) - log((1.0i + wx) / wx) - log(xd)) * log(1.0 - xd / wx)
-                + log(1.0 + 1.0i * xd) * (log(1.0 - 1.0i * wx) - 2.0 * log(wx / (1.0i + wx)) - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + log(1.0 - 1.0i * xd) * (-log(1.0 - 1.0i * wx) - 2.0 * log(wx / (1.0i + wx)) + 2.0 * log((1.0i + wx) / wx) + 2.0 * log((wx - xd) / (1.0i + wx)) - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)))
-                + trilog(((-0.5) * 1.0i) * (1.0i + xd)) * (-log(1.0 + 1.0i * wx) - log(wx / (1.0i + wx)) / 2.0 - 3.0 * log((-1.0i + wx) / (1.0i + wx)) + (3.0 * log((1.0i + wx) / wx)) / 2.0 - log(1.0 - wx * xdinv) / 2.0 - log((wx - xd) / (1.0i + wx)) - log(1.0 - 1.0i * xd) + 2.0 * log(1.0 + 1.0i * xd) - log(xd) + log(-(xd / (wx - xd))) / 2.0 - 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
-                + log(0.5 + (1.0i / 2.0) * xd) * ((-0.5) * (log(xd) * power_of<2>(log((1.0i + wx) / (1.0i + xd)))) - ((5.0 * 1.0i) / 2.0) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + log((-2.0 * 1.0i) / (-1.0i + xd)) * ((pisqu * log(-1.0 + 1.0i * wx)) / 12.0 + power_of<3>(log(-1.0 + 1.0i * wx)) / 12.0 - (pisqu * log(-1.0 + xd / wx)) / 12.0 - power_of<3>(log(-1.0 + xd / wx)) / 12.0 - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
-                + dilog(0.5 - (1.0i / 2.0) * xd) * ((-3.0 * dilog((1.0i + xd) / (1.0i + wx))) / 2.0 - dilog(1.0 - xd / wx) / 2.0 - dilog((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + power_of<2>(log(-1.0 + 1.0i * wx)) / 4.0 + log(xd) * (-log((1.0i + wx) / (1.0i + xd)) + log(1.0 - xd / wx)) - power_of<2>(log(-1.0 + xd / wx)) / 4.0 - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (2.0 * 1.0i) * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)
-                + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * wx) + log(wx / (1.0i + wx)) / 2.0 - (3.0 * log((1.0i + wx) / wx)) / 2.0 + log(1.0 - wx * xdinv) / 2.0 - log(-(xd / (wx - xd))) / 2.0 + 2.0 * log(1.0 - xd / wx) + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))) - (1.0i / 3.0) * power_of<3>(M_PI) * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * lnhalf * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * ln2 * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
-                + (3.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + ((2.0 * 1.0i) / 3.0) * M_PI * power_of<3>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * log((-1.0i) * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * log((1.0i + wx) / wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + power_of<3>(log(-1.0 + 1.0i * xd)) * ((-0.25) * ln2 - log(1.0 + 1.0i * wx) / 6.0 + log(1.0 - xd / wx) / 12.0 + (1.0i / 3.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + li3half * (log(1.0 - 1.0i * wx) / 2.0 + log(1.0 + 1.0i * wx) / 2.0 + log(wx / (-1.0i + wx)) / 2.0 - log((-1.0i + wx) / wx) + log(wx / (1.0i + wx)) / 2.0 + 3.0 * log((-1.0i + wx) / (1.0i + wx)) - log((1.0i + wx) / wx) + 3.0 * log((1.0i + wx) / (-1.0i + wx)) + log((wx - xd) / (-1.0i + wx)) + log((wx - xd) / (1.0i + wx)) - 5.0 * log(1.0 - 1.0i * xd) - 5.0 * log(1.0 + 1.0i * xd) - log(-(xd / (wx - xd))) - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 4.0 * log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0
+            const complex<double> part5 = + trilog(1.0i / (1.0i + wx)) * (-lnhalf + ln2 / 2.0 + 3.0 * ln_9 + ln_11 / 2.0 - 3.0 * ln_59 + 2.0 * ln_16 + (5.0 * ln_26) / 2.0 + (5.0 * ln_27) / 2.0 + 2.0 * ln_28 - 3.0 * ln_43 + ln_44 + ln_61 + ln_77 / 2.0 - ln_94 / 2.0 + ln_104 / 2.0 - 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + trilog(2.0) * (ln_123 - 2.0 * ln_27 - 2.0 * ln_28 + 2.0 * ln_44 - ln_55 / 2.0 - ln_68 / 2.0 + 12.0 * ln_94 - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + trilog(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) * (-2.0 * ln2 - ln_5 / 2.0 - 3.0 * ln_16 - 2.0 * ln_27 + (3.0 * ln_28) / 2.0 + ln_44 + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + trilog((-wx + xd) / (2.0 * xd)) * ((2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + trilog(1.0 - wx * xdinv) * (9.0 * ln2 - 2.0 * ln_3 - 2.0 * ln_5 + ln_11 + ln_16 + ln_27 / 2.0 + ln_28 / 2.0 + 2.0 * ln_94 - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + ln_123 * ((pisqu * lnm2) / 6.0 + power_of<3>(lnm2) / 6.0 - (power_of<2>(ln_27) * ln_60) / 4.0 - (power_of<2>(ln_28) * ln_74) / 4.0 + 1.0i * power_of<3>(M_PI) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(ln_2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + 1.0i * power_of<3>(M_PI) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * power_of<2>(lnm2) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
+                + (1.0i / 2.0) * M_PI * power_of<2>(ln_4) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + li2_4 * ((11.0 * pisqu) / 12.0 - li2_18 + li2_27 / 2.0 - li2_6 / 2.0 - li2_53 + li2_8 - (3.0 * li2_9) / 2.0 - li2_51 / 4.0 + li2_11 / 2.0 - li2_50 / 4.0 + li2_19 / 2.0 - li2_20 / 2.0 + li2_28 / 2.0 + (3.0 * power_of<2>(ln_124)) / 4.0 - 2.0 * ln_6 * ln_16 + power_of<2>(ln_27) / 2.0
+                - 2.0 * lnhalf * ln_28 + power_of<2>(ln_28) / 2.0 + ln_27 * (-2.0 * lnhalf - ln_26 / 2.0 + ln_28 - 3.0 * ln_43 + ln_44) + (ln2 * ln_77) / 2.0 + (ln_5 * ln_104) / 2.0 - 1.0i * M_PI * ln_123 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + li2_1 * ((5.0 * pisqu) / 12.0 - li2_27 / 2.0 + (3.0 * li2_47) / 4.0 + li2_6 / 2.0 + li2_52 / 2.0 + li2_8 - li2_51 + 2.0 * li2_32 - li2_20 / 2.0 - li2_28 / 2.0 + power_of<2>(lnm2) / 8.0 + 2.0 * ln2 * ln_16 + ln_6 * ln_16 + ln_11 * ln_16 + (3.0 * power_of<2>(ln_23)) / 8.0 + power_of<2>(ln_85) / 4.0 + ln_16 * ln_28
+                + ln_27 * (-3.0 * ln_16 - ln_97 + ln_33 - ln_60 / 2.0) + (ln_5 * ln_55) / 2.0 - ln_3 * ln_68 + 2.0 * ln_16 * ln_94 + ln_3 * ln_102 - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_110 * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * ln_110 * my_sign(real(xdinv)) + 1.0i * M_PI * ln_123 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + li2_55 * (pisqu / 6.0 + li2_47 / 2.0 + li2_6 - 2.0 * li2_8 + (3.0 * li2_9) / 2.0 - li2_51 / 2.0 + li2_50 / 2.0 - li2_19 / 2.0 + li2_28 + power_of<2>(lnm2) / 4.0 + power_of<2>(ln_23) / 4.0 + (ln2 - ln_11 / 2.0) * ln_28 - (ln_5 * ln_55) / 2.0 - (ln2 * ln_77) / 2.0
+                + ln_27 * (-2.0 * ln2 - 2.0 * ln_5 + ln_11 / 2.0 + ln_26 / 2.0 - ln_60 / 2.0 - ln_94 / 2.0) - 2.0 * ln2 * ln_94 - power_of<2>(ln_94) / 2.0 + (ln_5 * ln_104) / 2.0 + (2.0 * 1.0i) * M_PI * ln_123 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv))
+                + dilog(2.0) * ((-1.0 / 12.0) * pisqu + li2_1 / 4.0 + li2_2 / 4.0 + li2_54 / 2.0 + li2_55 / 2.0 - li2_47 / 2.0 + li2_8 / 2.0 + li2_9 / 2.0 - li2_10 - li2_32 / 2.0 - li2_48 / 2.0 - li2_28 / 2.0 + power_of<2>(ln_2) / 8.0 + (ln2 * ln_3) / 2.0 + power_of<2>(ln_4) / 8.0 + (ln2 * ln_5) / 2.0 - (ln2 * ln_11) / 2.0 - (ln2 * ln_16) / 2.0 - power_of<2>(ln_23) / 4.0 + ln2 * ln_27
+                + ln2 * ln_28 + (-ln_3 - ln_5) * ln_44 + (ln_5 * ln_55) / 2.0 + (ln_3 * ln_68) / 2.0 - 8.0 * ln2 * ln_94 - power_of<2>(ln_100) / 4.0 + ln_123 * (1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)))
+                + power_of<2>(ln_123) * ((1.0i / 2.0) * M_PI * lnhalf * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * ln_12 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln_11 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * ln_28 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (1.0i / 2.0) * M_PI * lnhalf * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln2 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)
+                + (1.0i / 2.0) * M_PI * ln_17 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - (1.0i / 2.0) * M_PI * ln_16 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * ln_27 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + ln_37 * ((-2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)))
+                + power_of<2>(ln_55) * (-(ln_11 * ln_58) + ln_11 * ln_63 + (ln_5 * ln_105) / 2.0 + (2.0 * 1.0i) * M_PI * ln_11 * my_sign(imag(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * T(1.0, 1.0i / wx, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + 1.0i * M_PI * ln_5 * my_sign(-real(((1.0i - wx) * xd) / (wx - xd))) * T(1.0, (-1.0i) * wx, (wx + 1.0i * wx * xd) / (wx - xd)))
+                + power_of<2>(ln_104) * (1.0i * M_PI * ln_11 * my_sign(imag(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * T(1.0, 1.0i / wx, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + 1.0i * M_PI * ln_5 * my_sign(-real(((-1.0i + wx) * xd) / (-wx + xd))) * T(1.0, (-1.0i) * wx, (wx + 1.0i * wx * xd) / (wx - xd))) + ln_37 * ((4.0 * pisqu * ln2) / 3.0 + (pisqu * ln_11) / 4.0 + (pisqu * ln_16) / 4.0 + (-4.0 * ln2 - (3.0 * ln_11) / 4.0 - (3.0 * ln_16) / 4.0) * power_of<2>(ln_94) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(real(1.0 / (1.0i - wx))) * T(1.0, (-1.0i) * wx, wx * xdinv)
+                + (2.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(real(1.0 / (1.0i + wx))) * T(1.0, 1.0i * wx, wx * xdinv)) + power_of<2>(ln_68) * (-(ln_16 * ln_73) + ln_16 * ln_91 + (2.0 * 1.0i) * M_PI * ln_16 * my_sign(imag(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * T(1.0, -1.0i / wx, (1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 1.0i * M_PI * ln_3 * my_sign(-real(((1.0i + wx) * xd) / (wx - xd))) * T(1.0, 1.0i * wx, (wx - 1.0i * wx * xd) / (wx - xd)))
+                + power_of<2>(ln_102) * (1.0i * M_PI * ln_16 * my_sign(imag(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * T(1.0, -1.0i / wx, (1.0i * (wx - xd)) / (wx * (1.0i + xd))) + 1.0i * M_PI * ln_3 * my_sign(real(((1.0i + wx) * xd) / (-wx + xd))) * T(1.0, 1.0i * wx, (wx - 1.0i * wx * xd) / (wx - xd))) + (1.0i / 3.0) * power_of<3>(M_PI) * ln_15 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + (1.0i / 3.0) * M_PI * power_of<3>(ln_15) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<3>(ln_62) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)
+                + trilog((-1.0i + xd) / (2.0 * xd)) * (ln_3 - ln_11 + 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + trilog((wx * (-1.0i + xd)) / ((1.0i + wx) * xd)) * ((4.0 * 1.0i) * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv))
+                + trilog((-1.0i + xd) * xdinv) * (-3.0 * ln2 - 3.0 * ln_3 + (5.0 * ln_5) / 2.0 + 3.0 * ln_11 - ln_16 + (3.0 * ln_28) / 2.0 - ln_94 + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(1.0i / wx, 1.0i / xd) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) + (6.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv))
+                + power_of<2>(ln_62) * ((-1.0i) * M_PI * lnhalf * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * ln_3 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * ln_13 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + ln_36 * ((-0.5) * (pisqu * ln2) - (pisqu * ln_3) / 3.0 + (pisqu * ln_5) / 4.0 - (pisqu * ln_16) / 6.0 + power_of<2>(ln_118) * (((-0.5) * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)))
+                + (3.0 * 1.0i) * M_PI * power_of<2>(ln_11) * my_sign(imag(wx / (1.0i - wx))) * T(1.0, 1.0i / wx, 1.0i / xd) + (3.0 * 1.0i) * M_PI * power_of<2>(ln_62) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv)) + (1.0i / 3.0) * power_of<3>(M_PI) * ln_1 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + (1.0i / 3.0) * M_PI * power_of<3>(ln_1) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<3>(ln_89) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)
+                + trilog((1.0i + xd) / (2.0 * xd)) * (ln_5 - ln_16 + 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + trilog((wx * (1.0i + xd)) / ((-1.0i + wx) * xd)) * ((4.0 * 1.0i) * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - (4.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv))
+                + trilog((1.0i + xd) * xdinv) * (-3.0 * ln2 + (5.0 * ln_3) / 2.0 - 3.0 * ln_5 - ln_11 + 3.0 * ln_16 + (3.0 * ln_27) / 2.0 - ln_94 + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H2(-1.0i / wx, -1.0i / xd) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) + (6.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv))
+                + power_of<2>(ln_89) * ((-1.0i) * M_PI * lnhalf * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * ln_5 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * ln_10 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + ln_35 * ((-0.5) * (pisqu * ln2) + (pisqu * ln_3) / 4.0 - (pisqu * ln_5) / 3.0 - (pisqu * ln_11) / 6.0 + power_of<2>(ln_118) * (((-0.5) * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)))
+                + (3.0 * 1.0i) * M_PI * power_of<2>(ln_16) * my_sign(-imag(wx / (1.0i + wx))) * T(1.0, -1.0i / wx, -1.0i / xd) + (3.0 * 1.0i) * M_PI * power_of<2>(ln_89) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)) + power_of<2>(ln_25) * ln_28 * (-ln_66 - ln_125 + (3.0 * 1.0i) * M_PI * my_sign(real(xd) / 2.0) * T(1.0, (wx - xd) / (-1.0i + wx), ((-0.5) * 1.0i) * (1.0i + xd))) - (1.0i / 3.0) * power_of<3>(M_PI) * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + 1.0i * M_PI * lnhalf * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
+                - 1.0i * M_PI * ln2 * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (3.0 * 1.0i) * M_PI * ln_82 * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + ((2.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_3) * ln_9 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(ln_3) * ln_11 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
+                + power_of<3>(ln_85) * ((-0.25) * ln2 - ln_3 / 6.0 + ln_94 / 12.0 + (1.0i / 3.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + trilog(1.0 + 1.0i * xd) * ((-3.0 * ln2) / 2.0 - ln_3 + 2.0 * ln_5 + 2.0 * ln_8 + ln_12 + 4.0 * ln_11 + ln_96 + ln_97 + 2.0 * ln_28 + ln_94 / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
+                + trilog(1.0 - 1.0i * wx) * ((-3.0 * ln2) / 2.0 - 3.0 * ln_9 - ln_11 + ln_24 + 5.0 * ln_27 - 2.0 * ln_28 + ln_44 + ln_60 / 2.0 - ln_55 / 2.0 - ln_62 - ln_68 - (9.0 * ln_94) / 2.0 + ln_102 + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(1.0i / xd, wx * xdinv) * my_sign(real(xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
+                + trilog((1.0i + wx) / (1.0i - xd)) * ((4.0 * 1.0i) * M_PI * H2((-1.0i) * wx, wx * xdinv) * my_sign(-real(wx)) - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + trilog(0.5 - (1.0i / 2.0) * wx) * (lnhalf / 2.0 - ln_26 / 2.0 - ln_27 - ln_28 + ln_68 / 2.0 - ln_102 / 2.0 + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + ln_85 * ((-0.25) * (pisqu * ln2) - (pisqu * ln_3) / 6.0 + (pisqu * ln_94) / 12.0 + (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
+                + power_of<2>(ln_85) * (pisqu / 24.0 + power_of<2>(ln_4) / 8.0 - 1.0i * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + ln_62 * ((-1.0 / 6.0) * (pisqu * ln_4) - power_of<3>(ln_4) / 6.0 - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(ln_15) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx))
+                + ln_43 * ((-0.5) * (ln_3 * power_of<2>(ln_68)) - (power_of<2>(ln_73) * ln_94) / 2.0 - (ln_3 * power_of<2>(ln_102)) / 2.0 + (3.0 * 1.0i) * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + li2_56 * ((-0.25) * li2_6 + li2_9 - li2_32 / 2.0 + 2.0 * ln_33 * ln_28 + (ln_3 - ln_16 - ln_44) * ln_94
+                + ln_28 * (ln_3 - 2.0 * ln_17 - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) + ln_27 * (-ln_3 - 2.0 * ln_17 + 2.0 * ln_16 + 2.0 * ln_33 - (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)))
+                + trilog(((-0.5) * 1.0i) * (1.0i + xd)) * (-ln_5 - ln_17 / 2.0 - 3.0 * ln_59 + (3.0 * ln_16) / 2.0 - ln_123 / 2.0 - ln_33 - ln_27 + 2.0 * ln_28 - ln_44 + ln_126 / 2.0 - 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
+                + ln_26 * ((-0.5) * (ln_44 * power_of<2>(ln_67)) - ((5.0 * 1.0i) / 2.0) * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + ln_60 * ((pisqu * ln_4) / 12.0 + power_of<3>(ln_4) / 12.0 - (pisqu * ln_100) / 12.0 - power_of<3>(ln_100) / 12.0 - (1.0i / 2.0) * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
+                + li2_6 * ((-3.0 * li2_20) / 2.0 - li2_48 / 2.0 - li2_46 / 2.0 + power_of<2>(ln_4) / 4.0 + ln_44 * (-ln_67 + ln_94) - power_of<2>(ln_100) / 4.0 - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (2.0 * 1.0i) * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)
+                + ln_27 * (ln_5 + ln_17 / 2.0 - (3.0 * ln_16) / 2.0 + ln_123 / 2.0 - ln_126 / 2.0 + 2.0 * ln_94 + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))) - (1.0i / 3.0) * power_of<3>(M_PI) * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * lnhalf * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * ln2 * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
+                + (3.0 * 1.0i) * M_PI * ln_79 * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + ((2.0 * 1.0i) / 3.0) * M_PI * power_of<3>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_5) * ln_8 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(ln_5) * ln_16 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + power_of<3>(ln_86) * ((-0.25) * ln2 - ln_5 / 6.0 + ln_94 / 12.0 + (1.0i / 3.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
+                + li3half * (ln_3 / 2.0 + ln_5 / 2.0 + ln_12 / 2.0 - ln_11 + ln_17 / 2.0 + 3.0 * ln_59 - ln_16 + 3.0 * ln_87 + ln_34 + ln_33 - 5.0 * ln_27 - 5.0 * ln_28 - ln_126 - ln_55 - ln_68 + 4.0 * ln_94 + ln_102 / 2.0 + ln_104 / 2.0
                 - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + trilog(1.0 - 1.0i * xd) * ((-3.0 * ln2) / 2.0 + 2.0 * log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx) + 2.0 * log(1.0i * wx) + log(wx / (1.0i + wx)) + 4.0 * log((1.0i + wx) / wx) + log((-1.0i + wx) / (wx - xd)) + log((1.0i + wx) / (wx - xd)) + 2.0 * log(1.0 - 1.0i * xd) + log(1.0 - xd / wx) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + trilog(1.0 + 1.0i * wx) * ((-3.0 * ln2) / 2.0 - 3.0 * log((-1.0i) * wx) - log((1.0i + wx) / wx) + log(wx / (wx - xd)) - 2.0 * log(1.0 - 1.0i * xd) + 5.0 * log(1.0 + 1.0i * xd) + log(xd) - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + log((2.0 * 1.0i) / (1.0i + xd)) / 2.0 - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 - log((1.0i + xd) * xdinv) - (9.0 * log(1.0 - xd / wx)) / 2.0 + log((wx + 1.0i * wx * xd) / (wx - xd)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + trilog((1.0i - wx) / (1.0i + xd)) * ((4.0 * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + trilog(0.5 + (1.0i / 2.0) * wx) * (lnhalf / 2.0 - log(0.5 - (1.0i / 2.0) * xd) / 2.0 - log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 - log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + log(-1.0 + 1.0i * xd) * ((-0.25) * (pisqu * ln2) - (pisqu * log(1.0 + 1.0i * wx)) / 6.0 + (pisqu * log(1.0 - xd / wx)) / 12.0 + (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + power_of<2>(log(-1.0 + 1.0i * xd)) * (pisqu / 24.0 + power_of<2>(log(-1.0 - 1.0i * wx)) / 8.0 - 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + dilog(1.0 - 1.0i * xd) * ((-1.0 / 12.0) * pisqu - dilog(xd / wx) + dilog((-1.0i + xd) / (-1.0i + wx)) + dilog((1.0i + xd) / (1.0i + wx)) / 2.0 + power_of<2>(log(-1.0 - 1.0i * wx)) / 4.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 2.0 + log((1.0i + wx) / (wx - xd)) * log(1.0 - 1.0i * xd) - log((-1.0i + wx) / (wx - xd)) * log(1.0 + 1.0i * xd) + log(1.0 - 1.0i * wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx) - log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd))
-                - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + dilog(1.0 + 1.0i * xd) * ((-1.0 / 12.0) * pisqu - dilog(xd / wx) + dilog((-1.0i + xd) / (-1.0i + wx)) / 2.0 + dilog((1.0i + xd) / (1.0i + wx)) - power_of<2>(log(-1.0 - 1.0i * wx)) / 2.0 + power_of<2>(log(-1.0 + 1.0i * wx)) / 4.0 - log((1.0i + wx) / (wx - xd)) * log(1.0 - 1.0i * xd) + log((-1.0i + wx) / (wx - xd)) * log(1.0 + 1.0i * xd) + log(1.0 + 1.0i * wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx)
-                - log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + log((1.0i + xd) * xdinv) * ((-1.0 / 6.0) * (pisqu * log(-1.0 - 1.0i * wx)) - power_of<3>(log(-1.0 - 1.0i * wx)) / 6.0 - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(log(-1.0 + 1.0i / wx)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
-                + log((-1.0i) * xd) * ((-0.5) * (log(1.0 + 1.0i * wx) * power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))))) - (power_of<2>(log((-1.0i + xd) / (-1.0i + wx))) * log(1.0 - xd / wx)) / 2.0 - (log(1.0 + 1.0i * wx) * power_of<2>(log((wx + 1.0i * wx * xd) / (wx - xd)))) / 2.0 + (3.0 * 1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + dilog(0.5 + (1.0i / 2.0) * wx) * ((-0.25) * dilog(0.5 + (1.0i / 2.0) * xd) + dilog((-1.0i) * xd) - dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 + 2.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + (log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) - log(xd)) * log(1.0 - xd / wx)
-                + log(1.0 + 1.0i * xd) * (-log(1.0 + 1.0i * wx) - 2.0 * log(wx / (-1.0i + wx)) + 2.0 * log((-1.0i + wx) / wx) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + log(1.0 - 1.0i * xd) * (log(1.0 + 1.0i * wx) - 2.0 * log(wx / (-1.0i + wx)) + 2.0 * log((wx - xd) / (-1.0i + wx)) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)))
-                + li2half * (dilog(0.5 - (1.0i / 2.0) * wx) / 4.0 + dilog(0.5 + (1.0i / 2.0) * wx) / 4.0 - dilog((-1.0i) * wx) / 2.0 - dilog(1.0i * wx) / 2.0 + (5.0 * dilog(-1.0i / (-1.0i + wx))) / 4.0 - dilog((-1.0i + wx) / (2.0 * wx)) / 4.0 + (5.0 * dilog(1.0i / (1.0i + wx))) / 4.0 - dilog((1.0i + wx) / (2.0 * wx)) / 4.0 - dilog(wx / (wx - xd)) / 2.0 - dilog((-1.0i) * xd) / 2.0 - dilog(1.0i * xd) / 2.0 + dilog(xd / wx) - dilog(-(xd / (wx - xd))) / 2.0 + dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 + dilog(xd / (-1.0i + xd)) / 2.0 - dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + dilog((-1.0i + xd) / (-1.0i + wx)) + dilog(xd / (1.0i + xd)) / 2.0
-                - dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) + dilog((1.0i + xd) / (1.0i + wx)) + dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) - 2.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 + 1.0i * xd) - log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + (log(1.0 - 1.0i * wx) * log((wx - 1.0i * wx * xd) / (wx - xd))) / 2.0 + (log(1.0 + 1.0i * wx) * log((wx + 1.0i * wx * xd) / (wx - xd))) / 2.0
-                + log(1.0 - wx * xdinv) * ((-1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + (2.0 * 1.0i) * M_PI * log((-1.0i + xd) * xdinv) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + (2.0 * 1.0i) * M_PI * log((1.0i + xd) * xdinv) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
-                + log(1.0 + 1.0i * xd) * (2.0 * log(wx / (-1.0i + wx)) + 2.0 * log(wx / (1.0i + wx)) + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + log(1.0 - 1.0i * xd) * (2.0 * log(wx / (-1.0i + wx)) + 2.0 * log(wx / (1.0i + wx)) - 2.0 * log((wx - xd) / (-1.0i + wx)) - log((wx - xd) / (1.0i + wx)) + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)));
+                + trilog(1.0 - 1.0i * xd) * ((-3.0 * ln2) / 2.0 + 2.0 * ln_3 - ln_5 + 2.0 * ln_9 + ln_17 + 4.0 * ln_16 + ln_96 + ln_97 + 2.0 * ln_27 + ln_94 / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
+                + trilog(1.0 + 1.0i * wx) * ((-3.0 * ln2) / 2.0 - 3.0 * ln_8 - ln_16 + ln_24 - 2.0 * ln_27 + 5.0 * ln_28 + ln_44 - ln_55 + ln_74 / 2.0 - ln_68 / 2.0 - ln_89 - (9.0 * ln_94) / 2.0 + ln_104 + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(-1.0i / xd, wx * xdinv) * my_sign(-real(xdinv)) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
+                + trilog((1.0i - wx) / (1.0i + xd)) * ((4.0 * 1.0i) * M_PI * H2(1.0i * wx, wx * xdinv) * my_sign(real(wx)) - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + trilog(0.5 + (1.0i / 2.0) * wx) * (lnhalf / 2.0 - ln_25 / 2.0 - ln_27 - ln_28 + ln_55 / 2.0 - ln_104 / 2.0 + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + ln_86 * ((-0.25) * (pisqu * ln2) - (pisqu * ln_5) / 6.0 + (pisqu * ln_94) / 12.0 + (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
+                + power_of<2>(ln_86) * (pisqu / 24.0 + power_of<2>(ln_2) / 8.0 - 1.0i * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + li2_53 * ((-1.0 / 12.0) * pisqu - li2_10 + li2_16 + li2_20 / 2.0 + power_of<2>(ln_2) / 4.0 - power_of<2>(ln_4) / 2.0 + ln_97 * ln_27 - ln_96 * ln_28 + ln_3 * ln_68 - ln_73 * ln_94 - ln_3 * ln_102
+                - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + li2_52 * ((-1.0 / 12.0) * pisqu - li2_10 + li2_16 / 2.0 + li2_20 - power_of<2>(ln_2) / 2.0 + power_of<2>(ln_4) / 4.0 - ln_97 * ln_27 + ln_96 * ln_28 + ln_5 * ln_55 - ln_58 * ln_94
+                - ln_5 * ln_104 - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + ln_89 * ((-1.0 / 6.0) * (pisqu * ln_2) - power_of<3>(ln_2) / 6.0 - ((4.0 * 1.0i) / 3.0) * power_of<3>(M_PI) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(ln_1) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx))
+                + ln_42 * ((-0.5) * (ln_5 * power_of<2>(ln_55)) - (power_of<2>(ln_58) * ln_94) / 2.0 - (ln_5 * power_of<2>(ln_104)) / 2.0 + (3.0 * 1.0i) * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + li2_57 * ((-0.25) * li2_7 + li2_8 - li2_28 / 2.0 + 2.0 * ln_34 * ln_28 + (ln_5 - ln_11 - ln_44) * ln_94
+                + ln_28 * (-ln_5 - 2.0 * ln_12 + 2.0 * ln_11 - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + ln_27 * (ln_5 - 2.0 * ln_12 + 2.0 * ln_34 - (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)))
+                + li2half * (li2_56 / 4.0 + li2_57 / 4.0 - li2_54 / 2.0 - li2_55 / 2.0 + (5.0 * li2_3) / 4.0 - li2_29 / 4.0 + (5.0 * li2_4) / 4.0 - li2_33 / 4.0 - li2_5 / 2.0 - li2_8 / 2.0 - li2_9 / 2.0 + li2_10 - li2_51 / 2.0 + li2_32 / 2.0 + li2_50 / 2.0 - li2_30 + li2_16 + li2_49 / 2.0
+                - li2_34 + li2_20 + li2_28 / 2.0 - ln_34 * ln_28 - 2.0 * ln_33 * ln_28 - ln_11 * ln_55 - ln_16 * ln_68 + (ln_3 * ln_102) / 2.0 + (ln_5 * ln_104) / 2.0
+                + ln_123 * ((-1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) + (2.0 * 1.0i) * M_PI * ln_62 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + (2.0 * 1.0i) * M_PI * ln_89 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
+                + ln_28 * (2.0 * ln_12 + 2.0 * ln_17 + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + ln_27 * (2.0 * ln_12 + 2.0 * ln_17 - 2.0 * ln_34 - ln_33 + (4.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (4.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)));
 
-            const complex<double> part6 = + trilog((wx - xd) / (2.0 * wx)) * ((-2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + trilog(0.5 + (1.0i / 2.0) * xd) * (-log(1.0 - 1.0i * wx) - log(wx / (-1.0i + wx)) / 2.0 + (3.0 * log((-1.0i + wx) / wx)) / 2.0 - 3.0 * log((1.0i + wx) / (-1.0i + wx)) - log(1.0 - wx * xdinv) / 2.0 - log((wx - xd) / (-1.0i + wx)) + 2.0 * log(1.0 - 1.0i * xd) - log(1.0 + 1.0i * xd) - log(xd) + log(-(xd / (wx - xd))) / 2.0 - 2.0 * log(1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))
-                + log((2.0 * 1.0i) / (1.0i + xd)) * ((pisqu * log(-1.0 - 1.0i * wx)) / 12.0 + power_of<3>(log(-1.0 - 1.0i * wx)) / 12.0 - (pisqu * log(-1.0 + xd / wx)) / 12.0 - power_of<3>(log(-1.0 + xd / wx)) / 12.0 - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))
-                + dilog(0.5 + (1.0i / 2.0) * xd) * ((-3.0 * dilog((-1.0i + xd) / (-1.0i + wx))) / 2.0 - dilog(1.0 - xd / wx) / 2.0 - dilog((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 + power_of<2>(log(-1.0 - 1.0i * wx)) / 4.0 + log(xd) * (-log((-1.0i + wx) / (-1.0i + xd)) + log(1.0 - xd / wx)) - power_of<2>(log(-1.0 + xd / wx)) / 4.0 - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (2.0 * 1.0i) * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
-                + log(1.0 + 1.0i * xd) * (log(1.0 - 1.0i * wx) + log(wx / (-1.0i + wx)) / 2.0 - (3.0 * log((-1.0i + wx) / wx)) / 2.0 + log(1.0 - wx * xdinv) / 2.0 - log(-(xd / (wx - xd))) / 2.0 + 2.0 * log(1.0 - xd / wx) + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))) + log(0.5 - (1.0i / 2.0) * xd) * ((-0.5) * (log(xd) * power_of<2>(log((-1.0i + wx) / (-1.0i + xd)))) - ((5.0 * 1.0i) / 2.0) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
-                + power_of<2>(log(1.0 + 1.0i * xd)) * (log(1.0 - 1.0i * wx) / 4.0 - log(1.0 + 1.0i * wx) / 4.0 + log(wx / (-1.0i + wx)) / 4.0 - log((-1.0i + wx) / wx) / 2.0 - log(-(xd / (wx - xd))) / 4.0 + log(1.0 - xd / wx) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + log(1.0 + 1.0i * xd) * ((-1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)))
-                + dilog(-1.0) * ((-7.0 * pisqu) / 6.0 - dilog(1.0 - 1.0i * wx) - dilog(1.0 + 1.0i * wx) + dilog(-1.0i / (-1.0i + wx)) + dilog(1.0i / (1.0i + wx)) - dilog(1.0 - wx * xdinv) + 2.0 * dilog(wx / (wx - xd)) - dilog((-1.0i) * xd) - dilog(1.0i * xd) + 8.0 * dilog(xd / wx) + dilog(-(xd / (wx - xd))) - dilog((1.0i * (1.0i + wx) * xd) / (wx - xd)) + dilog(xd / (-1.0i + xd)) - 2.0 * dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) - 2.0 * dilog((-1.0i + xd) / (-1.0i + wx)) - dilog((-1.0i + xd) * xdinv) + dilog(xd / (1.0i + xd)) - 2.0 * dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) - 2.0 * dilog((1.0i + xd) / (1.0i + wx)) - dilog((1.0i + xd) * xdinv)
-                - 2.0 * dilog(1.0 - xd / wx) - 2.0 * dilog((wx - 1.0i * wx * xd) / (wx - xd)) - 2.0 * dilog((wx + 1.0i * wx * xd) / (wx - xd)) - dilog(-((xd + 1.0i * wx * xd) / (wx - xd))) - power_of<2>(log(-1.0 - 1.0i * wx)) / 2.0 - power_of<2>(log(-1.0 + 1.0i * wx)) / 2.0 - power_of<2>(log(-1.0 + 1.0i / xd)) / 2.0 - power_of<2>(log(-1.0 + wx * xdinv)) / 2.0 + (log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx)) * log(xd) + (log(1.0 + 1.0i * wx) / 2.0 - log((-1.0i + wx) / wx)) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + (log(1.0 - 1.0i * wx) / 2.0 - log((1.0i + wx) / wx)) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - power_of<2>(log(-((1.0i + xd) * xdinv))) / 2.0
-                + log(1.0 - 1.0i * xd) * (3.0 * log(1.0 - 1.0i * wx) + 2.0 * log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) + log((1.0i + wx) / (wx - xd)) - log((wx - xd) / (1.0i + wx)) + log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) - log((1.0i * (1.0i + wx) * xd) / (wx - xd)) + 2.0 * log(1.0 - xd / wx)) - power_of<2>(log(-1.0 + xd / wx)) + ((-0.5) * log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx)) * log((wx - 1.0i * wx * xd) / (wx - xd)) + ((-0.5) * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx)) * log((wx + 1.0i * wx * xd) / (wx - xd))
-                + log(1.0 + 1.0i * xd) * (2.0 * log(1.0 - 1.0i * wx) + 3.0 * log(1.0 + 1.0i * wx) - log((1.0i + wx) / wx) + log((-1.0i + wx) / (wx - xd)) - log((wx - xd) / (-1.0i + wx)) + log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) + 2.0 * log(1.0 - xd / wx) - log(-((xd + 1.0i * wx * xd) / (wx - xd)))) + log(1.0 - wx * xdinv) * ((-2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) - (4.0 * 1.0i) * M_PI * log((-1.0i + xd) * xdinv) * my_sign(-real(wx)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - (4.0 * 1.0i) * M_PI * log((1.0i + xd) * xdinv) * my_sign(real(wx)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)
-                - (4.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (4.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + log(1.0 - xd / wx) * (-log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) - log((1.0i + wx) / wx) - (4.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (4.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)))
-                + power_of<2>(log((-1.0i + wx) / (wx - xd))) * log(1.0 + 1.0i * xd) * (log(xd / wx) / 2.0 - log((-1.0i + xd) / (-1.0i + wx)) / 2.0 + log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) / 2.0 + 1.0i * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, (-1.0i) * xd, (wx - xd) / (-1.0i + wx))) + power_of<2>(log((1.0i + wx) / (wx - xd))) * log(1.0 - 1.0i * xd) * (log(xd / wx) / 2.0 - log((1.0i + xd) / (1.0i + wx)) / 2.0 + log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) / 2.0 + 1.0i * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 1.0i * xd, (wx - xd) / (1.0i + wx)))
-                + power_of<2>(log((wx - xd) / (1.0i + wx))) * ((2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * xd) * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, (wx - xd) / (1.0i + wx)) + log(1.0 - 1.0i * xd) * (-log(wx * xdinv) - log(xd / wx) / 2.0 + (3.0 * log((-1.0i + wx) / (-1.0i + xd))) / 2.0 + (3.0 * log((-1.0i + xd) / (-1.0i + wx))) / 2.0 + log((1.0i + wx) / (1.0i + xd)) / 2.0 + log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) / 2.0 - (3.0 * log(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) - (3.0 * log(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0
-                    + (2.0 * 1.0i) * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, (wx - xd) / (1.0i + wx)) + 1.0i * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 1.0i * xd, (wx - xd) / (1.0i + wx)))) + power_of<2>(log((-1.0i + xd) / (-1.0i + wx))) * log(1.0 - xd / wx) * (log(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 - 1.0i * M_PI * my_sign(imag((wx - xd) / (-1.0i + wx))) * T(1.0, xd / wx, (-1.0i + xd) / (-1.0i + wx))) - 1.0i * M_PI * power_of<2>(log((1.0i + xd) / (1.0i + wx))) * log(1.0 - xd / wx) * my_sign(imag((wx - xd) / (1.0i + wx))) * T(1.0, xd / wx, (1.0i + xd) / (1.0i + wx))
-                + power_of<2>(log(-1.0i / (-1.0i + xd))) * (pisqu / 3.0 + (2.0 * 1.0i) * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(xd / (1.0i - xd))) * T(1.0, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)), -1.0i / (-1.0i + xd))) + power_of<2>(log(1.0i / (1.0i + xd))) * (pisqu / 3.0 + (2.0 * 1.0i) * M_PI * log((1.0i + wx) / wx) * my_sign(-imag(xd / (1.0i + xd))) * T(1.0, (1.0i * (wx - xd)) / (wx * (1.0i + xd)), 1.0i / (1.0i + xd)))
-                + power_of<2>(log((wx - xd) / (-1.0i + wx))) * ((2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * xd) * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx - xd) / (-1.0i + wx)) + log(1.0 + 1.0i * xd) * (-log(wx * xdinv) - log(xd / wx) / 2.0 + log((-1.0i + wx) / (-1.0i + xd)) / 2.0 + log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) / 2.0 + log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) + (3.0 * log((1.0i + wx) / (1.0i + xd))) / 2.0 - (3.0 * log(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + (3.0 * log((1.0i + xd) / (1.0i + wx))) / 2.0 - (3.0 * log(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0
-                    + 1.0i * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, (-1.0i) * xd, (wx - xd) / (-1.0i + wx)) + (2.0 * 1.0i) * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx - xd) / (-1.0i + wx)))) + 1.0i * M_PI * trilog((1.0 + 1.0i * wx) / (1.0i * wx + wx * xd)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 3.0) * power_of<3>(M_PI) * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + (1.0i / 2.0) * M_PI * log(1.0 - 1.0i * wx) * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * log(1.0i / wx) * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 3.0) * M_PI * power_of<3>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 2.0) * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * log(1.0i / (1.0i + wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + trilog(wx / (1.0i + wx)) * (-ln2 - log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) / 2.0 - log(1.0i / (1.0i + wx)) + log(1.0 - 1.0i * xd) + log(xd) - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - log(xd / (-1.0i + xd)) / 2.0 + log((-1.0i + xd) / (-1.0i + wx)) / 2.0 - log((1.0i - xd) / (1.0i + xd)) / 2.0 + log(1.0 - xd / wx) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
-                + trilog(1.0i / (1.0i + xd)) * ((-3.0 * ln2) / 2.0 + log(1.0 - 1.0i * wx) / 2.0 - log(1.0 + 1.0i * wx) - log((-1.0i + wx) / wx) + log((1.0i + wx) / wx) / 2.0 - log((wx - xd) / (-1.0i + wx)) - log(1.0 - 1.0i * xd) / 2.0 - log(xd) + log((-1.0i + xd) / (-1.0i + wx)) / 2.0 - (3.0 * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
-                + trilog((-1.0i + wx) / wx) * (log(1.0 - 1.0i * wx) - log(1.0 + 1.0i * wx) + log(1.0 - 1.0i * xd) + (11.0 * log(1.0 + 1.0i * xd)) / 2.0 - 2.0 * log(-1.0i / (-1.0i + xd)) - 2.0 * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - 3.0 * log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd)) + log((wx + 1.0i * wx * xd) / (wx - xd)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
-                + dilog(wx / (1.0i + wx)) * (pisqu / 6.0 - dilog((2.0 * wx) / (1.0i + wx)) / 4.0 - dilog((-1.0i + wx) / (1.0i + wx)) / 4.0 + dilog((wx - xd) / (-1.0i + wx)) / 2.0 - dilog((wx - xd) / (1.0i + wx)) / 2.0 + (3.0 * dilog((-1.0i) * xd)) / 2.0 + dilog(xd / wx) - dilog(-1.0i / (-1.0i + xd)) / 4.0 + dilog(xd / (-1.0i + xd)) / 2.0 - dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + dilog(xd / (1.0i + xd)) / 4.0 - dilog((2.0 * xd) / (1.0i + xd)) / 2.0 - dilog(1.0 - xd / wx) + log(1.0 - 1.0i * wx) * log(1.0i * wx) - log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - (ln2 * log((1.0i - xd) / (1.0i + xd))) / 2.0
-                + (log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log((-1.0i + xd) * xdinv) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) + dilog(1.0i / (1.0i + xd)) * (-(log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd)) + (log((-1.0i + xd) / (-1.0i + wx)) * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
-                + log(xd / (1.0i + xd)) * ((-1.0i) * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) + dilog((-1.0i + wx) / (1.0i + wx)) * (pisqu / 24.0 + dilog((1.0i + wx) / wx) / 4.0 + dilog((wx - xd) / (1.0i + wx)) / 2.0 + dilog((-1.0i) * xd) - 2.0 * dilog(xd / wx) + dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + power_of<2>(log(-((1.0i + wx) / wx))) / 8.0 + (log((-1.0i + wx) / wx) * log(1.0 - 1.0i * xd)) / 2.0 + ((3.0 * log(1.0 + 1.0i * wx)) / 2.0 - log((-1.0i + wx) / wx)) * log(1.0 + 1.0i * xd) - (3.0 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0
-                + (-log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx)) * log(1.0 - xd / wx) + log(xd) * (log(1.0 + 1.0i * wx) - log((-1.0i + wx) / (-1.0i + xd)) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))) + dilog((1.0i + wx) / wx) * ((-1.0 / 12.0) * pisqu + dilog((-1.0i) * xd) - dilog(xd / wx) + dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + dilog((-1.0i + xd) * xdinv) / 2.0 + 2.0 * dilog(xd / (1.0i + xd)) - 3.0 * dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) - dilog((1.0i + xd) * xdinv) - ln2 * log(1.0 - 1.0i * wx) - log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx) - log(1.0 - 1.0i * wx) * log(1.0i * wx) + power_of<2>(log(-1.0 + 1.0i / xd)) / 4.0
-                - (5.0 * log(1.0 - 1.0i * wx) * log(1.0 - 1.0i * xd)) / 2.0 + power_of<2>(log(1.0 - 1.0i * xd)) / 2.0 + 2.0 * log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * xd) - 2.0 * log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - power_of<2>(log(-((1.0i + xd) * xdinv))) / 2.0 + (2.0 * log(1.0 - 1.0i * wx) - log((1.0i + xd) / (1.0i + wx))) * log(1.0 - xd / wx) + log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) - log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(real(xdinv))
-                - (2.0 * 1.0i) * M_PI * log((-1.0i + xd) * xdinv) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + log(xd) * (log(1.0 + 1.0i * wx) - log((-1.0i + wx) / (-1.0i + xd)) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))) + 1.0i * M_PI * trilog((1.0 - 1.0i * wx) / (wx * (-1.0i + xd))) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 3.0) * power_of<3>(M_PI) * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
-                + (1.0i / 2.0) * M_PI * log(1.0 + 1.0i * wx) * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * log(-1.0i / wx) * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 2.0) * M_PI * log(-1.0i / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 3.0) * M_PI * power_of<3>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
-                + trilog(wx / (-1.0i + wx)) * (-ln2 - log(1.0 - 1.0i * wx) / 2.0 - log(1.0 + 1.0i * wx) - log(-1.0i / (-1.0i + wx)) - log(1.0i / (1.0i + wx)) / 2.0 + log(1.0 + 1.0i * xd) + log(xd) - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - log(xd / (1.0i + xd)) / 2.0 + log((1.0i + xd) / (1.0i + wx)) / 2.0 - log((1.0i + xd) / (1.0i - xd)) / 2.0 + log(1.0 - xd / wx) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
-                + trilog(-1.0i / (-1.0i + xd)) * ((-3.0 * ln2) / 2.0 - log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 2.0 + log((-1.0i + wx) / wx) / 2.0 - log((1.0i + wx) / wx) - log((wx - xd) / (1.0i + wx)) - log(1.0 + 1.0i * xd) / 2.0 - log(xd) + log((1.0i + xd) / (1.0i + wx)) / 2.0 - (3.0 * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
-                + trilog((1.0i + wx) / wx) * (-log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) + (11.0 * log(1.0 - 1.0i * xd)) / 2.0 + log(1.0 + 1.0i * xd) - 2.0 * log(1.0i / (1.0i + xd)) - 2.0 * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - 3.0 * log(1.0 - xd / wx) + log((wx - 1.0i * wx * xd) / (wx - xd)) + log((wx + 1.0i * wx * xd) / (wx - xd)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
-                + dilog(wx / (-1.0i + wx)) * (pisqu / 6.0 - dilog((2.0 * wx) / (-1.0i + wx)) / 4.0 - dilog(wx / (1.0i + wx)) / 2.0 - dilog((1.0i + wx) / (-1.0i + wx)) / 4.0 - dilog((wx - xd) / (-1.0i + wx)) / 2.0 + dilog((wx - xd) / (1.0i + wx)) / 2.0 + (3.0 * dilog(1.0i * xd)) / 2.0 + dilog(xd / wx) + dilog(xd / (-1.0i + xd)) / 4.0 - dilog((2.0 * xd) / (-1.0i + xd)) / 2.0 - dilog(1.0i / (1.0i + xd)) / 4.0 + dilog(xd / (1.0i + xd)) / 2.0 - dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) - dilog(1.0 - xd / wx) + log(1.0 + 1.0i * wx) * log((-1.0i) * wx) - log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - (ln2 * log((1.0i + xd) / (1.0i - xd))) / 2.0
-                + (log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log((1.0i + xd) * xdinv) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) + dilog(-1.0i / (-1.0i + xd)) * (-dilog((1.0i + xd) / (1.0i + wx)) - log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) + (log((1.0i + xd) / (1.0i + wx)) * log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
-                + log(xd / (-1.0i + xd)) * ((-0.25) * (log((1.0i + xd) / (1.0i + wx)) * power_of<2>(log(1.0 - xd / wx))) - 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) + dilog((1.0i + wx) / (-1.0i + wx)) * (pisqu / 24.0 + dilog((wx - xd) / (-1.0i + wx)) / 2.0 + dilog(1.0i * xd) - 2.0 * dilog(xd / wx) + dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) + power_of<2>(log(-1.0 + 1.0i / wx)) / 8.0 + ((3.0 * log(1.0 - 1.0i * wx)) / 2.0 - log((1.0i + wx) / wx)) * log(1.0 - 1.0i * xd) - (3.0 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 + (log((1.0i + wx) / wx) * log(1.0 + 1.0i * xd)) / 2.0
-                + (-log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx)) * log(1.0 - xd / wx) + log(xd) * (log(1.0 - 1.0i * wx) - log((1.0i + wx) / (1.0i + xd)) - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))) + dilog((-1.0i + wx) / wx) * ((-1.0 / 12.0) * pisqu + dilog((1.0i + wx) / (-1.0i + wx)) / 4.0 + dilog(1.0i * xd) - dilog(xd / wx) + 2.0 * dilog(xd / (-1.0i + xd)) - 3.0 * dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) - dilog((-1.0i + xd) * xdinv) + dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) + dilog((1.0i + xd) * xdinv) / 2.0 - ln2 * log(1.0 + 1.0i * wx) - log(1.0 - 1.0i * wx) * log(1.0 + 1.0i * wx)
-                - log(1.0 + 1.0i * wx) * log((-1.0i) * wx) - power_of<2>(log(-1.0 + 1.0i / xd)) / 2.0 + 2.0 * log(1.0 + 1.0i * wx) * log(1.0 - 1.0i * xd) - (5.0 * log(1.0 + 1.0i * wx) * log(1.0 + 1.0i * xd)) / 2.0 + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0 - 2.0 * log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) + power_of<2>(log(-((1.0i + xd) * xdinv))) / 4.0 + (2.0 * log(1.0 + 1.0i * wx) - log((-1.0i + xd) / (-1.0i + wx))) * log(1.0 - xd / wx) - log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd)) + log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(imag(wx * xdinv))
-                + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * log(1.0 + wxinv * wxinv) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * log((1.0i + xd) * xdinv) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + log(xd) * (log(1.0 - 1.0i * wx) - log((1.0i + wx) / (1.0i + xd)) - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))) - 1.0i * M_PI * trilog((wx * (1.0 - 1.0i * xd)) / (-1.0i + wx)) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)
-                + power_of<3>(log(1.0 - 1.0i * xd)) * (log(1.0 + 1.0i * wx) / 12.0 - (3.0 * log(-1.0i / xd)) / 4.0 + log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) + log((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 4.0 + log(-((1.0i + xd) * xdinv)) / 3.0 + log(1.0 - xd / wx) / 12.0 + (1.0i / 2.0) * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + trilog((wx - xd) / (-1.0i + wx)) * (2.0 * ln2 + log(1.0 - 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) + 3.0 * log((-1.0i + wx) / wx) + log(1.0i / (1.0i + wx)) / 2.0 - (9.0 * log(1.0 - 1.0i * xd)) / 2.0 - log(xd) + log(xd / (1.0i + xd)) / 2.0 - log((1.0i + xd) / (1.0i + wx)) / 2.0 + log(1.0 - xd / wx)
-                + 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + dilog((-1.0i) * xd) * (pisqu / 2.0 - dilog(1.0i * xd) - dilog(xd / wx) + dilog((-1.0i + xd) / (-1.0i + wx)) - dilog(1.0i / (1.0i + xd)) / 2.0 + dilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 + dilog(1.0 - xd / wx) / 2.0 + dilog((wx - 1.0i * wx * xd) / (wx - xd)) + power_of<2>(lnm2) / 4.0 + power_of<2>(log(-1.0 + 1.0i * wx)) / 2.0 + (log(0.5 - (1.0i / 2.0) * wx) * log(1.0 + 1.0i * wx)) / 2.0 + power_of<2>(log(1.0 + 1.0i * wx)) - log(0.5 - (1.0i / 2.0) * wx) * log((-1.0i + wx) / wx) + (log(1.0 - 1.0i * wx) * log((-1.0i + wx) / wx)) / 2.0
-                + (3.0 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 - (log(1.0 + 1.0i * wx) * log((2.0 * 1.0i) / (1.0i + wx))) / 2.0 - (ln2 * log((1.0i - wx) / (1.0i + wx))) / 2.0 + (log(1.0 + 1.0i * wx) * log((2.0 * wx) / (1.0i + wx))) / 2.0 - ln2 * log((-1.0i + wx) / (1.0i + wx)) + power_of<2>(log(-((1.0i + wx) / wx))) / 2.0 - (log(1.0 + 1.0i * wx) * log((1.0i + wx) / (2.0 * wx))) / 2.0 + ln2 * log((1.0i + wx) / wx) + (ln2 * log((1.0i + wx) / (-1.0i + wx))) / 2.0 + log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + (log(1.0 + 1.0i * xd) * log(1.0 - xd / wx)) / 2.0 + power_of<2>(log(1.0 - xd / wx)) / 2.0 + power_of<2>(log(-1.0 + xd / wx)) / 4.0
-                + log(1.0 - xd / wx) * (2.0 * ln2 + log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) / 2.0 - log((1.0i + xd) / (1.0i + wx)) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * log((1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
-                + log(1.0 - 1.0i * xd) * (-2.0 * log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0 - log((1.0i + wx) / (wx - xd)) / 2.0 - log((wx - xd) / (1.0i + wx)) / 2.0 - log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) / 2.0 + log((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0 + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd))) + dilog(1.0i / wx) * (pisqu / 3.0 - dilog(wx / (1.0i + wx)) / 2.0 + dilog((wx - xd) / (1.0i + wx)) / 2.0 + dilog(1.0 - 1.0i * xd) - dilog(1.0i * xd) - dilog(xd / (-1.0i + xd)) / 2.0 + dilog((2.0 * xd) / (-1.0i + xd)) / 2.0 - 2.0 * dilog(1.0i / (1.0i + xd)) + 3.0 * dilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - dilog(xd / (1.0i + xd))
-                + 2.0 * dilog(((1.0i + wx) * xd) / (wx * (1.0i + xd))) + dilog((1.0i + xd) * xdinv) + power_of<2>(log(-1.0 + 1.0i * xd)) / 2.0 + log(1.0 + 1.0i * xd) * (-2.0 * lnhalf + log((1.0i + wx) / wx) / 2.0 + log(xd)) + log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) + (ln2 * log((1.0i + xd) / (1.0i - xd))) / 2.0 + power_of<2>(log(-((1.0i + xd) * xdinv))) / 2.0 + (2.0 * ln2 - log((1.0i + wx) / wx) + 2.0 * log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) + log((1.0i + xd) / (1.0i + wx)) / 2.0 - log((wx * (1.0i + xd)) / ((1.0i + wx) * xd))) * log(1.0 - xd / wx) - log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd))
-                + (4.0 * 1.0i) * M_PI * log((1.0i + xd) * xdinv) * my_sign(real(wx)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + log(1.0 - 1.0i * xd) * (-2.0 * lnhalf + 2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 + (6.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)))
-                + dilog((wx - xd) / (-1.0i + wx)) * ((-1.0 / 6.0) * pisqu - dilog((wx - xd) / (1.0i + wx)) / 2.0 - dilog(1.0i * xd) + dilog(1.0i / (1.0i + xd)) / 2.0 - dilog((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 4.0 + dilog(1.0 - xd / wx) + 3.0 * log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) + (3.0 * power_of<2>(log(1.0 - 1.0i * xd))) / 2.0 - 2.0 * log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - power_of<2>(log(1.0 - xd / wx)) / 2.0 + log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) + 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
-                + log(1.0 - xd / wx) * (-2.0 * ln2 - log(1.0 - 1.0i * wx) / 2.0 - log(1.0i / (1.0i + wx)) / 2.0 + log(xd) - log(xd / (1.0i + xd)) / 2.0 - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + log(1.0 - 1.0i * xd) * ((3.0 * log(1.0 - xd / wx)) / 2.0 + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd))) - 1.0i * M_PI * trilog((wx + 1.0i * wx * xd) / (1.0i + wx)) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd);
+            const complex<double> part6 = + trilog((wx - xd) / (2.0 * wx)) * ((-2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + trilog(0.5 + (1.0i / 2.0) * xd) * (-ln_3 - ln_12 / 2.0 + (3.0 * ln_11) / 2.0 - 3.0 * ln_87 - ln_123 / 2.0 - ln_34 + 2.0 * ln_27 - ln_28 - ln_44 + ln_126 / 2.0 - 2.0 * ln_94 - (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))
+                + ln_74 * ((pisqu * ln_2) / 12.0 + power_of<3>(ln_2) / 12.0 - (pisqu * ln_100) / 12.0 - power_of<3>(ln_100) / 12.0 - (1.0i / 2.0) * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))
+                + li2_7 * ((-3.0 * li2_16) / 2.0 - li2_48 / 2.0 - li2_44 / 2.0 + power_of<2>(ln_2) / 4.0 + ln_44 * (-ln_54 + ln_94) - power_of<2>(ln_100) / 4.0 - (2.0 * 1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (2.0 * 1.0i) * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
+                + ln_28 * (ln_3 + ln_12 / 2.0 - (3.0 * ln_11) / 2.0 + ln_123 / 2.0 - ln_126 / 2.0 + 2.0 * ln_94 + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx))) + ln_25 * ((-0.5) * (ln_44 * power_of<2>(ln_54)) - ((5.0 * 1.0i) / 2.0) * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
+                + power_of<2>(ln_28) * (ln_3 / 4.0 - ln_5 / 4.0 + ln_12 / 4.0 - ln_11 / 2.0 - ln_126 / 4.0 + ln_94 / 2.0 + (1.0i / 2.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + ln_28 * ((-1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)))
+                + dilog(-1.0) * ((-7.0 * pisqu) / 6.0 - li2_1 - li2_2 + li2_3 + li2_4 - li2_47 + 2.0 * li2_5 - li2_8 - li2_9 + 8.0 * li2_10 + li2_51 - li2_32 + li2_50 - 2.0 * li2_30 - 2.0 * li2_16 - li2_39 + li2_49 - 2.0 * li2_34 - 2.0 * li2_20 - li2_42
+                - 2.0 * li2_48 - 2.0 * li2_46 - 2.0 * li2_44 - li2_28 - power_of<2>(ln_2) / 2.0 - power_of<2>(ln_4) / 2.0 - power_of<2>(ln_20) / 2.0 - power_of<2>(ln_23) / 2.0 + (ln_3 + ln_5) * ln_44 + (ln_5 / 2.0 - ln_11) * ln_55 + (ln_3 / 2.0 - ln_16) * ln_68 - power_of<2>(ln_78) / 2.0
+                + ln_27 * (3.0 * ln_3 + 2.0 * ln_5 - ln_11 + ln_97 - ln_33 + ln_41 - ln_49 + 2.0 * ln_94) - power_of<2>(ln_100) + ((-0.5) * ln_3 + ln_16) * ln_102 + ((-0.5) * ln_5 + ln_11) * ln_104
+                + ln_28 * (2.0 * ln_3 + 3.0 * ln_5 - ln_16 + ln_96 - ln_34 + ln_40 + 2.0 * ln_94 - ln_105) + ln_123 * ((-2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv)) - (4.0 * 1.0i) * M_PI * ln_62 * my_sign(-real(wx)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - (4.0 * 1.0i) * M_PI * ln_89 * my_sign(real(wx)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv)
+                - (4.0 * 1.0i) * M_PI * ln_3 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (4.0 * 1.0i) * M_PI * ln_5 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + ln_94 * (-ln_3 - ln_5 - ln_11 - ln_16 - (4.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (4.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)))
+                + power_of<2>(ln_96) * ln_28 * (ln_99 / 2.0 - ln_58 / 2.0 + ln_63 / 2.0 + 1.0i * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, (-1.0i) * xd, (wx - xd) / (-1.0i + wx))) + power_of<2>(ln_97) * ln_27 * (ln_99 / 2.0 - ln_73 / 2.0 + ln_91 / 2.0 + 1.0i * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 1.0i * xd, (wx - xd) / (1.0i + wx)))
+                + power_of<2>(ln_33) * ((2.0 * 1.0i) * M_PI * ln_28 * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, (wx - xd) / (1.0i + wx)) + ln_27 * (-ln_37 - ln_99 / 2.0 + (3.0 * ln_54) / 2.0 + (3.0 * ln_58) / 2.0 + ln_67 / 2.0 + ln_71 / 2.0 - (3.0 * log(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + ln_91 - (3.0 * log(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0
+                    + (2.0 * 1.0i) * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, (wx - xd) / (1.0i + wx)) + 1.0i * M_PI * my_sign(imag((1.0i + xd) / (1.0i + wx))) * T(1.0, 1.0i * xd, (wx - xd) / (1.0i + wx)))) + power_of<2>(ln_58) * ln_94 * (ln_105 / 2.0 - 1.0i * M_PI * my_sign(imag((wx - xd) / (-1.0i + wx))) * T(1.0, xd / wx, (-1.0i + xd) / (-1.0i + wx))) - 1.0i * M_PI * power_of<2>(ln_73) * ln_94 * my_sign(imag((wx - xd) / (1.0i + wx))) * T(1.0, xd / wx, (1.0i + xd) / (1.0i + wx))
+                + power_of<2>(ln_50) * (pisqu / 3.0 + (2.0 * 1.0i) * M_PI * ln_11 * my_sign(imag(xd / (1.0i - xd))) * T(1.0, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)), -1.0i / (-1.0i + xd))) + power_of<2>(ln_64) * (pisqu / 3.0 + (2.0 * 1.0i) * M_PI * ln_16 * my_sign(-imag(xd / (1.0i + xd))) * T(1.0, (1.0i * (wx - xd)) / (wx * (1.0i + xd)), 1.0i / (1.0i + xd)))
+                + power_of<2>(ln_34) * ((2.0 * 1.0i) * M_PI * ln_27 * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx - xd) / (-1.0i + wx)) + ln_28 * (-ln_37 - ln_99 / 2.0 + ln_54 / 2.0 + ln_56 / 2.0 + ln_63 + (3.0 * ln_67) / 2.0 - (3.0 * log(((1.0i + wx) * (-1.0i + xd)) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + (3.0 * ln_73) / 2.0 - (3.0 * log(((-1.0i + wx) * (1.0i + xd)) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0
+                    + 1.0i * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, (-1.0i) * xd, (wx - xd) / (-1.0i + wx)) + (2.0 * 1.0i) * M_PI * my_sign(imag((-1.0i + xd) / (-1.0i + wx))) * T(1.0, ((-0.5) * 1.0i) * (1.0i + xd), (wx - xd) / (-1.0i + wx)))) + 1.0i * M_PI * trilog((1.0 + 1.0i * wx) / (1.0i * wx + wx * xd)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 3.0) * power_of<3>(M_PI) * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + (1.0i / 2.0) * M_PI * ln_3 * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * ln_7 * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 3.0) * M_PI * power_of<3>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + (1.0i / 2.0) * M_PI * power_of<2>(ln_11) * ln_13 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + trilog(wx / (1.0i + wx)) * (-ln2 - ln_3 - ln_5 / 2.0 - ln_10 / 2.0 - ln_13 + ln_27 + ln_44 - ln_55 - ln_61 / 2.0 + ln_58 / 2.0 - ln_76 / 2.0 + ln_94 + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
+                + trilog(1.0i / (1.0i + xd)) * ((-3.0 * ln2) / 2.0 + ln_3 / 2.0 - ln_5 - ln_11 + ln_16 / 2.0 - ln_34 - ln_27 / 2.0 - ln_44 + ln_58 / 2.0 - (3.0 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
+                + trilog((-1.0i + wx) / wx) * (ln_3 - ln_5 + ln_27 + (11.0 * ln_28) / 2.0 - 2.0 * ln_50 - 2.0 * ln_55 - 3.0 * ln_94 + ln_102 + ln_104 - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(imag(wx * xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
+                + li2_58 * (pisqu / 6.0 - li2_24 / 4.0 - li2_59 / 4.0 + li2_23 / 2.0 - li2_26 / 2.0 + (3.0 * li2_8) / 2.0 + li2_10 - li2_11 / 4.0 + li2_50 / 2.0 - li2_30 + li2_49 / 4.0 - li2_17 / 2.0 - li2_48 + ln_3 * ln_9 - ln_11 * ln_55 - (ln2 * ln_76) / 2.0
+                + (ln_58 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_62 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) + li2_12 * (-(ln_34 * ln_28) + (ln_58 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
+                + ln_88 * ((-1.0i) * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) + li2_59 * (pisqu / 24.0 + li2_25 / 4.0 + li2_26 / 2.0 + li2_8 - 2.0 * li2_10 + li2_30 + power_of<2>(ln_15) / 8.0 + (ln_11 * ln_27) / 2.0 + ((3.0 * ln_5) / 2.0 - ln_11) * ln_28 - (3.0 * power_of<2>(ln_28)) / 2.0
+                + (-ln_5 + ln_11) * ln_94 + ln_44 * (ln_5 - ln_54 - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))) + li2_25 * ((-1.0 / 12.0) * pisqu + li2_8 - li2_10 + li2_30 + li2_39 / 2.0 + 2.0 * li2_49 - 3.0 * li2_34 - li2_42 - ln2 * ln_3 - ln_3 * ln_5 - ln_3 * ln_9 + power_of<2>(ln_20) / 4.0
+                - (5.0 * ln_3 * ln_27) / 2.0 + power_of<2>(ln_27) / 2.0 + 2.0 * ln_3 * ln_28 - 2.0 * ln_16 * ln_68 - power_of<2>(ln_78) / 2.0 + (2.0 * ln_3 - ln_73) * ln_94 + ln_16 * ln_102 - ln_11 * ln_104 + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_109 * my_sign(imag(wx * xdinv)) + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * ln_109 * my_sign(real(xdinv))
+                - (2.0 * 1.0i) * M_PI * ln_62 * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + ln_44 * (ln_5 - ln_54 - (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))) + 1.0i * M_PI * trilog((1.0 - 1.0i * wx) / (wx * (-1.0i + xd))) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 3.0) * power_of<3>(M_PI) * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (2.0 * 1.0i) * M_PI * ln2 * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
+                + (1.0i / 2.0) * M_PI * ln_5 * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * ln_6 * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 2.0) * M_PI * ln_10 * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + (1.0i / 3.0) * M_PI * power_of<3>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
+                + trilog(wx / (-1.0i + wx)) * (-ln2 - ln_3 / 2.0 - ln_5 - ln_10 - ln_13 / 2.0 + ln_28 + ln_44 - ln_68 - ln_88 / 2.0 + ln_73 / 2.0 - ln_77 / 2.0 + ln_94 + 1.0i * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
+                + trilog(-1.0i / (-1.0i + xd)) * ((-3.0 * ln2) / 2.0 - ln_3 + ln_5 / 2.0 + ln_11 / 2.0 - ln_16 - ln_33 - ln_28 / 2.0 - ln_44 + ln_73 / 2.0 - (3.0 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
+                + trilog((1.0i + wx) / wx) * (-ln_3 + ln_5 + (11.0 * ln_27) / 2.0 + ln_28 - 2.0 * ln_64 - 2.0 * ln_68 - 3.0 * ln_94 + ln_102 + ln_104 - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H2(wx * xdinv, -1.0i / xd) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H2(wx * xdinv, 1.0i / xd) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
+                + li2_60 * (pisqu / 6.0 - li2_21 / 4.0 - li2_58 / 2.0 - li2_61 / 4.0 - li2_23 / 2.0 + li2_26 / 2.0 + (3.0 * li2_9) / 2.0 + li2_10 + li2_50 / 4.0 - li2_19 / 2.0 - li2_12 / 4.0 + li2_49 / 2.0 - li2_34 - li2_48 + ln_5 * ln_8 - ln_16 * ln_68 - (ln2 * ln_77) / 2.0
+                + (ln_73 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_89 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) + li2_11 * (-li2_20 - ln_33 * ln_27 + (ln_73 * ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
+                + ln_61 * ((-0.25) * (ln_73 * power_of<2>(ln_94)) - 1.0i * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) + li2_61 * (pisqu / 24.0 + li2_23 / 2.0 + li2_9 - 2.0 * li2_10 + li2_34 + power_of<2>(ln_1) / 8.0 + ((3.0 * ln_3) / 2.0 - ln_16) * ln_27 - (3.0 * power_of<2>(ln_27)) / 2.0 + (ln_16 * ln_28) / 2.0
+                + (-ln_3 + ln_16) * ln_94 + ln_44 * (ln_3 - ln_67 - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))) + li2_22 * ((-1.0 / 12.0) * pisqu + li2_61 / 4.0 + li2_9 - li2_10 + 2.0 * li2_50 - 3.0 * li2_30 - li2_39 + li2_34 + li2_42 / 2.0 - ln2 * ln_5 - ln_3 * ln_5
+                - ln_5 * ln_8 - power_of<2>(ln_20) / 2.0 + 2.0 * ln_5 * ln_27 - (5.0 * ln_5 * ln_28) / 2.0 + power_of<2>(ln_28) / 2.0 - 2.0 * ln_11 * ln_55 + power_of<2>(ln_78) / 4.0 + (2.0 * ln_5 - ln_58) * ln_94 - ln_16 * ln_102 + ln_11 * ln_104 + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_109 * my_sign(imag(wx * xdinv))
+                + (2.0 * 1.0i) * M_PI * H2(wx * xdinv, -1.0i / xd) * ln_109 * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * ln_89 * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + ln_44 * (ln_3 - ln_67 - (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))) - 1.0i * M_PI * trilog((wx * (1.0 - 1.0i * xd)) / (-1.0i + wx)) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)
+                + power_of<3>(ln_27) * (ln_5 / 12.0 - (3.0 * ln_35) / 4.0 + ln_41 + ln_49 / 4.0 + ln_78 / 3.0 + ln_94 / 12.0 + (1.0i / 2.0) * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + trilog((wx - xd) / (-1.0i + wx)) * (2.0 * ln2 + ln_3 / 2.0 - ln_10 + 3.0 * ln_11 + ln_13 / 2.0 - (9.0 * ln_27) / 2.0 - ln_44 + ln_88 / 2.0 - ln_73 / 2.0 + ln_94
+                + 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + li2_8 * (pisqu / 2.0 - li2_9 - li2_10 + li2_16 - li2_12 / 2.0 + li2_35 / 2.0 + li2_48 / 2.0 + li2_46 + power_of<2>(lnm2) / 4.0 + power_of<2>(ln_4) / 2.0 + (ln_79 * ln_5) / 2.0 + power_of<2>(ln_5) - ln_79 * ln_11 + (ln_3 * ln_11) / 2.0
+                + (3.0 * power_of<2>(ln_11)) / 2.0 - (ln_5 * ln_80) / 2.0 - (ln2 * ln_120) / 2.0 + (ln_5 * ln_127) / 2.0 - ln2 * ln_59 + power_of<2>(ln_15) / 2.0 - (ln_5 * ln_81) / 2.0 + ln2 * ln_16 + (ln2 * ln_87) / 2.0 + ln_34 * ln_28 + (ln_28 * ln_94) / 2.0 + power_of<2>(ln_94) / 2.0 + power_of<2>(ln_100) / 4.0
+                + ln_94 * (2.0 * ln2 + ln_71 / 2.0 - ln_73 + (2.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + (2.0 * 1.0i) * M_PI * ln_5 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_16 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
+                + ln_27 * (-2.0 * ln_5 + ln_11 / 2.0 - ln_97 / 2.0 - ln_33 / 2.0 - ln_41 / 2.0 + ln_49 / 2.0 + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd))) + dilog(1.0i / wx) * (pisqu / 3.0 - li2_58 / 2.0 + li2_26 / 2.0 + li2_53 - li2_9 - li2_50 / 2.0 + li2_19 / 2.0 - 2.0 * li2_12 + 3.0 * li2_35 - li2_49
+                + 2.0 * li2_34 + li2_42 + power_of<2>(ln_86) / 2.0 + ln_28 * (-2.0 * lnhalf + ln_16 / 2.0 + ln_44) + ln_16 * ln_68 + (ln2 * ln_77) / 2.0 + power_of<2>(ln_78) / 2.0 + (2.0 * ln2 - ln_16 + 2.0 * ln_71 + ln_73 / 2.0 - ln_91) * ln_94 - ln_16 * ln_102
+                + (4.0 * 1.0i) * M_PI * ln_89 * my_sign(real(wx)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) + 1.0i * M_PI * ln_16 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + ln_27 * (-2.0 * lnhalf + 2.0 * ln2 - ln_3 / 2.0 + (6.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)))
+                + li2_23 * ((-1.0 / 6.0) * pisqu - li2_26 / 2.0 - li2_9 + li2_12 / 2.0 - li2_35 / 4.0 + li2_48 + 3.0 * ln_33 * ln_27 + (3.0 * power_of<2>(ln_27)) / 2.0 - 2.0 * ln_11 * ln_55 - power_of<2>(ln_94) / 2.0 + ln_11 * ln_104 + 1.0i * M_PI * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
+                + ln_94 * (-2.0 * ln2 - ln_3 / 2.0 - ln_13 / 2.0 + ln_44 - ln_88 / 2.0 - 1.0i * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + ln_27 * ((3.0 * ln_94) / 2.0 + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd))) - 1.0i * M_PI * trilog((wx + 1.0i * wx * xd) / (1.0i + wx)) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd);
 
-            const complex<double> part7 = + power_of<3>(log(1.0 + 1.0i * xd)) * (log(1.0 - 1.0i * wx) / 12.0 - (3.0 * log(1.0i / xd)) / 4.0 + log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) + log(1.0 - xd / wx) / 12.0 + log(-((xd + 1.0i * wx * xd) / (wx - xd))) / 4.0 + (1.0i / 2.0) * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + trilog((wx - xd) / (1.0i + wx)) * (2.0 * ln2 + log(1.0 + 1.0i * wx) / 2.0 + log(-1.0i / (-1.0i + wx)) / 2.0 - log(1.0i / (1.0i + wx)) + 3.0 * log((1.0i + wx) / wx) - (9.0 * log(1.0 + 1.0i * xd)) / 2.0 - log(xd) + log(xd / (-1.0i + xd)) / 2.0 - log((-1.0i + xd) / (-1.0i + wx)) / 2.0 + log(1.0 - xd / wx) + 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + dilog(1.0i * xd) * (pisqu / 2.0 - dilog(xd / wx) - dilog(-1.0i / (-1.0i + xd)) / 2.0 + dilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 + dilog((1.0i + xd) / (1.0i + wx)) + dilog(1.0 - xd / wx) / 2.0 + dilog((wx + 1.0i * wx * xd) / (wx - xd)) + power_of<2>(lnm2) / 4.0 + power_of<2>(log(-1.0 + 1.0i / wx)) / 2.0 + power_of<2>(log(-1.0 - 1.0i * wx)) / 2.0 + (log(0.5 + (1.0i / 2.0) * wx) * log(1.0 - 1.0i * wx)) / 2.0 + power_of<2>(log(1.0 - 1.0i * wx)) - (log(1.0 - 1.0i * wx) * log((-2.0 * 1.0i) / (-1.0i + wx))) / 2.0 + (log(1.0 - 1.0i * wx) * log((2.0 * wx) / (-1.0i + wx))) / 2.0 - (log(1.0 - 1.0i * wx) * log((-1.0i + wx) / (2.0 * wx))) / 2.0
-                + ln2 * log((-1.0i + wx) / wx) + (ln2 * log((-1.0i + wx) / (1.0i + wx))) / 2.0 - (ln2 * log((1.0i + wx) / (1.0i - wx))) / 2.0 - log(0.5 + (1.0i / 2.0) * wx) * log((1.0i + wx) / wx) + (log(1.0 + 1.0i * wx) * log((1.0i + wx) / wx)) / 2.0 + (3.0 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - ln2 * log((1.0i + wx) / (-1.0i + wx)) + log((wx - xd) / (1.0i + wx)) * log(1.0 - 1.0i * xd) + (log(1.0 - 1.0i * xd) * log(1.0 - xd / wx)) / 2.0 + power_of<2>(log(1.0 - xd / wx)) / 2.0 + power_of<2>(log(-1.0 + xd / wx)) / 4.0 + (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
-                + log(1.0 - xd / wx) * (2.0 * ln2 + log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) / 2.0 - log((-1.0i + xd) / (-1.0i + wx)) + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) - (2.0 * 1.0i) * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + log(1.0 + 1.0i * xd) * (-2.0 * log(1.0 - 1.0i * wx) + log((1.0i + wx) / wx) / 2.0 - log((-1.0i + wx) / (wx - xd)) / 2.0 - log((wx - xd) / (-1.0i + wx)) / 2.0 - log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) / 2.0 + log(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0 + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)))
-                + dilog(-1.0i / wx) * (pisqu / 3.0 - dilog(wx / (-1.0i + wx)) / 2.0 + dilog((wx - xd) / (-1.0i + wx)) / 2.0 + dilog(1.0 + 1.0i * xd) - dilog((-1.0i) * xd) - 2.0 * dilog(-1.0i / (-1.0i + xd)) + 3.0 * dilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) - dilog(xd / (-1.0i + xd)) + 2.0 * dilog(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + dilog((-1.0i + xd) * xdinv) - dilog(xd / (1.0i + xd)) / 2.0 + dilog((2.0 * xd) / (1.0i + xd)) / 2.0 + power_of<2>(log(-1.0 + 1.0i / xd)) / 2.0 + power_of<2>(log(-1.0 - 1.0i * xd)) / 2.0 + log(1.0 - 1.0i * xd) * (-2.0 * lnhalf + log((-1.0i + wx) / wx) / 2.0 + log(xd)) + log((-1.0i + wx) / wx) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))
-                + (ln2 * log((1.0i - xd) / (1.0i + xd))) / 2.0 + (2.0 * ln2 - log((-1.0i + wx) / wx) + 2.0 * log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) + log((-1.0i + xd) / (-1.0i + wx)) / 2.0 - log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) * log(1.0 - xd / wx) - log((-1.0i + wx) / wx) * log((wx + 1.0i * wx * xd) / (wx - xd)) + (4.0 * 1.0i) * M_PI * log((-1.0i + xd) * xdinv) * my_sign(-real(wx)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + log(1.0 + 1.0i * xd) * (-2.0 * lnhalf + 2.0 * ln2 - log(1.0 + 1.0i * wx) / 2.0 + (6.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))) + dilog((wx - xd) / (1.0i + wx)) * ((-1.0 / 6.0) * pisqu - dilog((-1.0i) * xd) + dilog(-1.0i / (-1.0i + xd)) / 2.0 - dilog(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 4.0 + dilog(1.0 - xd / wx) + 3.0 * log((wx - xd) / (-1.0i + wx)) * log(1.0 + 1.0i * xd) + (3.0 * power_of<2>(log(1.0 + 1.0i * xd))) / 2.0 - 2.0 * log((1.0i + wx) / wx) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - power_of<2>(log(1.0 - xd / wx)) / 2.0 + log((1.0i + wx) / wx) * log((wx - 1.0i * wx * xd) / (wx - xd))
-                + 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + log(1.0 - xd / wx) * (-2.0 * ln2 - log(1.0 + 1.0i * wx) / 2.0 - log(-1.0i / (-1.0i + wx)) / 2.0 + log(xd) - log(xd / (-1.0i + xd)) / 2.0 - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + log(1.0 + 1.0i * xd) * ((3.0 * log(1.0 - xd / wx)) / 2.0 + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)))
-                + power_of<2>(log(wx / (wx - xd))) * ((-1.0 / 3.0) * pisqu + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(-imag(xd / (wx - xd))) * T(1.0, (wx - 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-imag(xd / (wx - xd))) * T(1.0, (wx + 1.0i * wx * xd) / (wx - xd), wx / (wx - xd))) - pisqu * power_of<2>(log((-1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + 2.0 * pisqu * log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx)
-                - pisqu * power_of<2>(log((1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) - pisqu * power_of<2>(log((-1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) + 2.0 * pisqu * log((-1.0i + wx) / wx) * log((1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) - pisqu * power_of<2>(log((1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)
-                + log(xd) * ((pisqu * lnm2) / 3.0 + power_of<3>(lnm2) / 3.0 + (pisqu * log(1.0 - 1.0i * wx)) / 6.0 - (power_of<2>(lnm2) * log(1.0 - 1.0i * wx)) / 2.0 + (power_of<2>(log(-1.0 + 1.0i / wx)) * log(1.0 - 1.0i * wx)) / 2.0 + power_of<3>(log(1.0 - 1.0i * wx)) / 6.0 + (pisqu * log(1.0 + 1.0i * wx)) / 6.0 - (power_of<2>(lnm2) * log(1.0 + 1.0i * wx)) / 2.0 + power_of<3>(log(1.0 + 1.0i * wx)) / 6.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * wx) / (-1.0i + wx))) / 2.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((-1.0i + wx) / (2.0 * wx))) / 2.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((2.0 * wx) / (1.0i + wx))) / 2.0 + (log(1.0 + 1.0i * wx) * power_of<2>(log(-((1.0i + wx) / wx)))) / 2.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((1.0i + wx) / (2.0 * wx))) / 2.0
-                + (pisqu * log(((-2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + power_of<3>(log(((-2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + (pisqu * log(((2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + power_of<3>(log(((2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + (pisqu * log((1.0i - xd) / (1.0i + wx))) / 6.0 + power_of<3>(log((1.0i - xd) / (1.0i + wx))) / 6.0 - (pisqu * log(((-2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - power_of<3>(log(((-2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - (pisqu * log(((2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - power_of<3>(log(((2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - (pisqu * log(wx / (-1.0i + xd))) / 6.0 - power_of<3>(log(wx / (-1.0i + xd))) / 6.0 - (pisqu * log(wx / (1.0i + xd))) / 6.0 - power_of<3>(log(wx / (1.0i + xd))) / 6.0
-                + (log(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd))) * power_of<2>(log((1.0i + wx) / (1.0i + xd)))) / 2.0 + (pisqu * log((1.0i + xd) / (1.0i - wx))) / 6.0 + power_of<3>(log((1.0i + xd) / (1.0i - wx))) / 6.0 - (log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 2.0 + (log((-1.0i + xd) / (-1.0i + wx)) * power_of<2>(log(1.0 - xd / wx))) / 2.0 - (log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * power_of<2>(log(1.0 - xd / wx))) / 2.0 - (log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 2.0 + (log((1.0i + xd) / (1.0i + wx)) * power_of<2>(log(1.0 - xd / wx))) / 2.0 - (log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * power_of<2>(log(1.0 - xd / wx))) / 2.0
-                + log((-2.0 * 1.0i) / (-1.0i + xd)) * ((-0.5) * power_of<2>(log((1.0i + wx) / (1.0i + xd))) + log((1.0i + wx) / (1.0i + xd)) * log(1.0 - xd / wx)) + (pisqu * log((1.0i * wx) / (1.0i * xd - wx * xd))) / 6.0 + power_of<3>(log((1.0i * wx) / (1.0i * xd - wx * xd))) / 6.0 + (pisqu * log((1.0i * wx) / (1.0i * xd + wx * xd))) / 6.0 + power_of<3>(log((1.0i * wx) / (1.0i * xd + wx * xd))) / 6.0 - 1.0i * M_PI * H1((1.0i + wx) / (wx - xd), (-1.0i + wx) / (wx - xd)) * power_of<2>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx))) / (wx - xd))) * my_sign(imag((-1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((-1.0i + wx) / (1.0i + wx), (-1.0i + wx) / (wx - xd)) * power_of<2>(log((-1.0i + wx) / (1.0i + xd))) * my_sign(imag((-1.0i + wx) / (wx - xd)))
-                - 1.0i * M_PI * H1((-1.0i + wx) / (wx - xd), (1.0i + wx) / (wx - xd)) * power_of<2>(log((((-0.5) * 1.0i) * (1.0 + power_of<2>(wx))) / (wx - xd))) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((1.0i + wx) / (-1.0i + wx), (1.0i + wx) / (wx - xd)) * power_of<2>(log((1.0i + wx) / (-1.0i + xd))) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((-1.0i) * wx, wx * xdinv) * power_of<2>(log((1.0i - xd) / wx)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(1.0i / xd, wx * xdinv) * power_of<2>(log((-1.0i - 1.0 / wx) * xd)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(log((1.0i - 1.0 / wx) * xd)) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(1.0i * wx, wx * xdinv) * power_of<2>(log(-((1.0i + xd) / wx))) * my_sign(imag(wx * xdinv))
-                + 1.0i * M_PI * H1((1.0i + wx) / (-1.0i + wx), (1.0i + wx) / wx) * power_of<2>(log(-1.0 + 1.0i * wx)) * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H1((-1.0i + wx) / wx, (1.0i + wx) / wx) * power_of<2>(log((((-0.5) * 1.0i) * (1.0 + power_of<2>(wx))) / wx)) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H1((-1.0i + wx) / (1.0i + wx), (-1.0i + wx) / wx) * power_of<2>(log(-1.0 - 1.0i * wx)) * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H1((1.0i + wx) / wx, (-1.0i + wx) / wx) * power_of<2>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx))) / wx)) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * power_of<2>(log(0.5 + (1.0i / 2.0) * wx)) * my_sign(imag((1.0i + wx) / (-1.0i + wx))) * T(1.0, -1.0i / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(-imag(wx / (1.0i + wx))) * T(1.0, -1.0i / (-1.0i + wx), 1.0i / (1.0i + wx))
-                + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(imag(wx / (1.0i - wx))) * T(1.0, 1.0i / (1.0i + wx), -1.0i / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(log(0.5 - (1.0i / 2.0) * wx)) * my_sign(imag((-1.0i + wx) / (1.0i + wx))) * T(1.0, 1.0i / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)) - 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * power_of<2>(log(0.5 + (1.0i / 2.0) * wx)) * my_sign(imag((1.0i + wx) / (-1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(log((1.0i + wx) / (1.0i + xd))) * my_sign(imag((wx - xd) / (1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (1.0i + xd) / (1.0i + wx))
-                - 1.0i * M_PI * power_of<2>(log(0.5 - (1.0i / 2.0) * wx)) * my_sign(imag((-1.0i + wx) / (1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)) + log(1.0 - xd / wx) * ((-2.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * my_sign(imag((-1.0i + wx) / (wx - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) - (2.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * my_sign(imag((1.0i + wx) / (wx - xd))) * T(1.0, (1.0i + xd) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)))
-                + power_of<2>(log((-1.0i + wx) / (-1.0i + xd))) * ((-0.5) * log((2.0 * 1.0i) / (1.0i + xd)) + log(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) / 2.0 + 1.0i * M_PI * my_sign(imag((wx - xd) / (-1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), (-1.0i + xd) / (-1.0i + wx))) - (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(log(-((1.0i + wx) / wx))) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + log((1.0i + wx) / (1.0i + xd)) * ((-1.0 / 6.0) * pisqu - power_of<2>(log(-1.0 + 1.0i / wx)) / 2.0 + power_of<2>(log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) - (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(log(-1.0 + 1.0i / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
-                + log((-1.0i + wx) / (-1.0i + xd)) * ((-1.0 / 6.0) * pisqu - power_of<2>(log(-((1.0i + wx) / wx))) / 2.0 + log((2.0 * 1.0i) / (1.0i + xd)) * log(1.0 - xd / wx) + power_of<2>(log(1.0 - xd / wx)) / 2.0 + (2.0 * 1.0i) * M_PI * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) - 4.0 * pisqu * log((1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) - 4.0 * pisqu * log((-1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)) + 2.0 * pisqu * ln2squ * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0)
-                - 4.0 * pisqu * ln2 * log(1.0 + 1.0i * wx) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) + 2.0 * pisqu * power_of<2>(log(1.0 + 1.0i * wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) + 2.0 * pisqu * ln2squ * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 4.0 * pisqu * ln2 * log(1.0 - 1.0i * wx) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) + 2.0 * pisqu * power_of<2>(log(1.0 - 1.0i * wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0)
-                - pisqu * power_of<2>(log((1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)
-                + power_of<2>(log(1.0 + 1.0i * xd)) * (((3.0 * ln2) / 2.0 + log(1.0 - 1.0i * wx) - (3.0 * log(1.0 + 1.0i * wx)) / 4.0 + log((1.0i + wx) / wx) / 2.0) * log(1.0i / xd) + ((-3.0 * ln2) / 4.0 - log(1.0 - 1.0i * wx) / 4.0 - log((1.0i + wx) / wx) / 4.0) * log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) + power_of<2>(log((-1.0i) * xd)) / 2.0 + log((1.0i + xd) / (2.0 * xd)) * ((-0.25) * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 4.0 + log((-1.0i + wx) / wx) / 2.0 - log(1.0 - xd / wx) / 2.0) + log((2.0 * xd) / (1.0i + xd)) * (log(1.0 - 1.0i * wx) / 4.0 - log(1.0 + 1.0i * wx) / 2.0 + log((-1.0i + wx) / wx) / 2.0 + log((1.0i + wx) / wx) / 4.0 - log(1.0 - xd / wx) / 2.0) + (log((-1.0i) * xd) * log(1.0 - xd / wx)) / 2.0
-                + ((3.0 * ln2) / 4.0 + log(1.0 - 1.0i * wx) / 4.0) * log(-((xd + 1.0i * wx * xd) / (wx - xd))) + 1.0i * M_PI * ln2 * my_sign(-real(xd)) * T(1.0, 1.0 + 1.0i * wx, 1.0 + 1.0i * xd) + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(xd)) * T(1.0, 1.0 + 1.0i * wx, 1.0 + 1.0i * xd) - 1.0i * M_PI * log(wx / (-1.0i + wx)) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) + (3.0 * 1.0i) * M_PI * log((1.0i + wx) / (-1.0i + wx)) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) * T(1.0, (wx - xd) / (-1.0i + wx), (1.0i + wx) / (-1.0i + wx)) + (4.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx)
-                - 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + log((2.0 * 1.0i) / (1.0i + xd)) * ((-0.25) * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 2.0 - log((-1.0i + wx) / wx) / 4.0 - log((1.0i + wx) / wx) / 4.0 + log(1.0 - xd / wx) / 2.0 - (1.0i / 2.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + 1.0i * M_PI * log((-1.0i) * wx) * my_sign(real(1.0 / (1.0i - xd))) * T(1.0, (-1.0i) * xd, (-1.0i) * wx)
-                + 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(xd / (1.0i - xd))) * T(1.0, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)), -1.0i / (-1.0i + xd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) - (1.0i / 2.0) * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) + ((3.0 * 1.0i) / 2.0) * M_PI * log((1.0i + wx) / wx) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) - (1.0i / 2.0) * M_PI * log((1.0i + xd) / (1.0i + wx)) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) + log(xd) * (log(1.0 - xd / wx) / 2.0 + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))
-                - pisqu * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)) - pisqu * power_of<2>(log((-1.0i + wx) / wx)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + power_of<2>(log(1.0 - 1.0i * xd)) * (((3.0 * ln2) / 2.0 - (3.0 * log(1.0 - 1.0i * wx)) / 4.0 + log(1.0 + 1.0i * wx) + log((-1.0i + wx) / wx) / 2.0) * log(-1.0i / xd) + ((-3.0 * ln2) / 4.0 - log(1.0 + 1.0i * wx) / 4.0 - log((-1.0i + wx) / wx) / 4.0) * log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) + power_of<2>(log(1.0i * xd)) / 2.0
-                + log(1.0 + 1.0i * xd) * ((-0.5) * log(((-1.0i) * (wx - xd)) / ((1.0i + wx) * xd)) - log((1.0i * (1.0i + wx) * xd) / (wx - xd)) / 2.0) + ((3.0 * ln2) / 4.0 + log(1.0 + 1.0i * wx) / 4.0) * log((1.0i * (1.0i + wx) * xd) / (wx - xd)) + log((-1.0i + xd) / (2.0 * xd)) * (log(1.0 - 1.0i * wx) / 4.0 - log(1.0 + 1.0i * wx) / 4.0 + log((1.0i + wx) / wx) / 2.0 - log(1.0 - xd / wx) / 2.0) + log((2.0 * xd) / (-1.0i + xd)) * ((-0.5) * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 4.0 + log((-1.0i + wx) / wx) / 4.0 + log((1.0i + wx) / wx) / 2.0 - log(1.0 - xd / wx) / 2.0) + (log(1.0i * xd) * log(1.0 - xd / wx)) / 2.0 + 1.0i * M_PI * ln2 * my_sign(real(xd)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - 1.0i * xd)
-                + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(xd)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - 1.0i * xd) - 1.0i * M_PI * log(wx / (1.0i + wx)) * my_sign(imag((1.0i + wx) / (1.0i + xd))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) + (3.0 * 1.0i) * M_PI * log((-1.0i + wx) / (1.0i + wx)) * my_sign(imag((1.0i + wx) / (1.0i + xd))) * T(1.0, (wx - xd) / (1.0i + wx), (-1.0i + wx) / (1.0i + wx)) + (4.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
-                + log(0.5 + (1.0i / 2.0) * xd) * ((-0.25) * log(1.0 - 1.0i * wx) + log(1.0 + 1.0i * wx) / 4.0 + log(wx / (1.0i + wx)) / 4.0 - log((1.0i + wx) / wx) / 2.0 - log(-(xd / (wx - xd))) / 4.0 + log(1.0 - xd / wx) / 2.0 + (1.0i / 2.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + log((-2.0 * 1.0i) / (-1.0i + xd)) * (log(1.0 - 1.0i * wx) / 2.0 - log(1.0 + 1.0i * wx) / 4.0 - log((-1.0i + wx) / wx) / 4.0 - log((1.0i + wx) / wx) / 4.0 + log(1.0 - xd / wx) / 2.0 - (1.0i / 2.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
-                - 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * log(1.0i * wx) * my_sign(real(1.0 / (1.0i + xd))) * T(1.0, 1.0i * xd, 1.0i * wx) + 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(-imag(xd / (1.0i + xd))) * T(1.0, (1.0i * (wx - xd)) / (wx * (1.0i + xd)), 1.0i / (1.0i + xd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) - (1.0i / 2.0) * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) + ((3.0 * 1.0i) / 2.0) * M_PI * log((-1.0i + wx) / wx) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) - (1.0i / 2.0) * M_PI * log((-1.0i + xd) / (-1.0i + wx)) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)
-                + log(xd) * (log(1.0 - xd / wx) / 2.0 + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) - pisqu * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx)) - 2.0 * pisqu * ln2squ * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 2.0 * pisqu * ln2squ * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0)
-                + power_of<2>(log(1.0 - xd / wx)) * ((-1.0 / 3.0) * pisqu - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, (-1.0i + wx) / wx, 1.0 - xd / wx) - 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(imag(xd / wx)) * T(1.0, (-1.0i + wx) / wx, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, (1.0i + wx) / wx, 1.0 - xd / wx) - 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(imag(xd / wx)) * T(1.0, (1.0i + wx) / wx, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
-                - 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) + 1.0i * M_PI * log(-1.0i / wx) * my_sign(imag(wx / (wx - xd))) * T(1.0, xd / wx, -1.0i / wx) + 1.0i * M_PI * log(1.0i / wx) * my_sign(imag(wx / (wx - xd))) * T(1.0, xd / wx, 1.0i / wx) - 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(imag(xd / (wx - xd))) * T(1.0, (wx - 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) - 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(imag(xd / (wx - xd))) * T(1.0, (wx + 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) - 2.0 * pisqu * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 2.0 * pisqu * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0))
-                + log((wx + 1.0i * wx * xd) / (wx - xd)) * ((-1.0 / 6.0) * (pisqu * log(1.0 + 1.0i * wx)) - (lnhalf * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 - (ln2 * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 - (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 - power_of<3>(log(1.0 + 1.0i * wx)) / 6.0 - (pisqu * log((-1.0i + wx) / wx)) / 3.0 - (ln2 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + (log(1.0 - 1.0i * wx) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 - power_of<3>(log((-1.0i + wx) / wx)) / 6.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log(wx / (1.0i + wx))) / 4.0 + (pisqu * log(-((1.0i + wx) / wx))) / 6.0 - (log((-1.0i + wx) / wx) * power_of<2>(log(-((1.0i + wx) / wx)))) / 2.0 + power_of<3>(log(-((1.0i + wx) / wx))) / 6.0
-                - (power_of<2>(log((-1.0i + wx) / wx)) * log((1.0i + wx) / wx)) / 2.0 - 2.0 * zeta3) + log(1.0i / (1.0i + xd)) * ((-1.0 / 6.0) * (pisqu * log(1.0 + 1.0i * wx)) - (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0i * wx))) / 2.0 + (pisqu * log((-1.0i + wx) / wx)) / 6.0 + (pisqu * log((1.0i + wx) / wx)) / 12.0 - (pisqu * log(1.0 - xd / wx)) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log(((1.0i + wx) * xd) / (wx * (1.0i + xd)))) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(log((-wx + xd) / (1.0i + xd))) * my_sign(-real(1.0 / wx)) - 2.0 * zeta3)
-                + log(-1.0i / (-1.0i + xd)) * ((-1.0 / 6.0) * (pisqu * log(1.0 - 1.0i * wx)) - (log(1.0 + 1.0i * wx) * power_of<2>(log((-1.0i) * wx))) / 2.0 + (pisqu * log((-1.0i + wx) / wx)) / 12.0 + (pisqu * log((1.0i + wx) / wx)) / 6.0 - (pisqu * log(1.0 - xd / wx)) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd)))) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(log((-wx + xd) / (-1.0i + xd))) * my_sign(real(1.0 / wx)) - 2.0 * zeta3)
-                + log((wx - 1.0i * wx * xd) / (wx - xd)) * ((pisqu * log(-1.0 + 1.0i / wx)) / 6.0 + power_of<3>(log(-1.0 + 1.0i / wx)) / 6.0 - (pisqu * log(1.0 - 1.0i * wx)) / 6.0 - (lnhalf * power_of<2>(log(1.0 - 1.0i * wx))) / 4.0 - (ln2 * power_of<2>(log(1.0 - 1.0i * wx))) / 4.0 - power_of<3>(log(1.0 - 1.0i * wx)) / 6.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * wx)) / 4.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log(wx / (-1.0i + wx))) / 4.0 - (pisqu * log((1.0i + wx) / wx)) / 3.0 - (power_of<2>(log(-1.0 + 1.0i / wx)) * log((1.0i + wx) / wx)) / 2.0 - (ln2 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (log(1.0 + 1.0i * wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - (log((-1.0i + wx) / wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - power_of<3>(log((1.0i + wx) / wx)) / 6.0
-                - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * power_of<2>(log(-((xd + 1.0i * wx * xd) / (wx - xd)))) * my_sign(real(xdinv)) - 2.0 * zeta3) + log(1.0 - xd / wx) * ((2.0 * pisqu * lnm2) / 3.0 + (2.0 * power_of<3>(lnm2)) / 3.0 + (4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - 4.0 * lnm1 * ln2squ + (pisqu * log(-1.0 + 1.0i / wx)) / 6.0 + power_of<3>(log(-1.0 + 1.0i / wx)) / 6.0 - (pisqu * log(-1.0 - 1.0i * wx)) / 12.0 - power_of<3>(log(-1.0 - 1.0i * wx)) / 12.0 - (pisqu * log(1.0 - 1.0i * wx)) / 12.0 + (log(0.5 + (1.0i / 2.0) * wx) * power_of<2>(log(1.0 - 1.0i * wx))) / 2.0 - power_of<3>(log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log(-1.0 + 1.0i * wx)) / 12.0 - power_of<3>(log(-1.0 + 1.0i * wx)) / 12.0 - (pisqu * log(1.0 + 1.0i * wx)) / 12.0
-                + (log(0.5 - (1.0i / 2.0) * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 2.0 - power_of<3>(log(1.0 + 1.0i * wx)) / 12.0 + (pisqu * log(((-0.5) * 1.0i) / wx)) / 12.0 + power_of<3>(log(((-0.5) * 1.0i) / wx)) / 12.0 + (pisqu * log(1.0i / 2.0 / wx)) / 12.0 + power_of<3>(log(1.0i / 2.0 / wx)) / 12.0 - (pisqu * log(-1.0i / wx)) / 3.0 + power_of<2>(log(1.0 - 1.0i * wx)) * log(-1.0i / wx) - power_of<3>(log(-1.0i / wx)) / 3.0 - (pisqu * log(1.0i / wx)) / 3.0 + power_of<2>(log(1.0 + 1.0i * wx)) * log(1.0i / wx) - power_of<3>(log(1.0i / wx)) / 3.0 - (pisqu * log((-2.0 * 1.0i) / wx)) / 6.0 - power_of<3>(log((-2.0 * 1.0i) / wx)) / 6.0 - (pisqu * log((2.0 * 1.0i) / wx)) / 6.0 - power_of<3>(log((2.0 * 1.0i) / wx)) / 6.0 - (pisqu * log((-1.0i) * wx)) / 3.0 - power_of<3>(log((-1.0i) * wx)) / 3.0 - (pisqu * log(1.0i * wx)) / 3.0 - power_of<3>(log(1.0i * wx)) / 3.0
-                - (pisqu * log((-2.0 * 1.0i) * wx)) / 12.0 - power_of<3>(log((-2.0 * 1.0i) * wx)) / 12.0 - (pisqu * log((2.0 * 1.0i) * wx)) / 12.0 - power_of<3>(log((2.0 * 1.0i) * wx)) / 12.0 - (pisqu * log(wx / (1.0i - wx))) / 6.0 - power_of<3>(log(wx / (1.0i - wx))) / 6.0 + (pisqu * log(-1.0i / (-1.0i + wx))) / 12.0 + power_of<3>(log(-1.0i / (-1.0i + wx))) / 12.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((-2.0 * 1.0i) / (-1.0i + wx))) / 2.0 + (pisqu * log(wx / (-1.0i + wx))) / 6.0 + power_of<3>(log(wx / (-1.0i + wx))) / 6.0 + (power_of<2>(log(1.0 - 1.0i * wx)) * log((2.0 * wx) / (-1.0i + wx))) / 2.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((-1.0i + wx) / (2.0 * wx))) / 2.0 - (power_of<2>(log(1.0i / wx)) * log((-1.0i + wx) / wx)) / 2.0 - (3.0 * log(1.0i / wx) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0
-                + log((-1.0i) * wx) * power_of<2>(log((-1.0i + wx) / wx)) + (pisqu * log(1.0i / (1.0i + wx))) / 12.0 + power_of<3>(log(1.0i / (1.0i + wx))) / 12.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * 1.0i) / (1.0i + wx))) / 2.0 + power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * 1.0i) / (1.0i + wx)) - (pisqu * log(-(wx / (1.0i + wx)))) / 6.0 - power_of<3>(log(-(wx / (1.0i + wx)))) / 6.0 + (pisqu * log(wx / (1.0i + wx))) / 6.0 + power_of<3>(log(wx / (1.0i + wx))) / 6.0 + (power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * wx) / (1.0i + wx))) / 2.0 - power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * wx) / (1.0i + wx)) + (pisqu * log(-((1.0i + wx) / wx))) / 6.0 + power_of<3>(log(-((1.0i + wx) / wx))) / 6.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((1.0i + wx) / (2.0 * wx))) / 2.0
-                - (power_of<2>(log(-1.0i / wx)) * log((1.0i + wx) / wx)) / 2.0 - (3.0 * log(-1.0i / wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + log(1.0i * wx) * power_of<2>(log((1.0i + wx) / wx)) + log((-2.0 * 1.0i) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx)) - log((2.0 * wx) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx)) - (pisqu * log(1.0i / (-1.0i + xd))) / 6.0 - power_of<3>(log(1.0i / (-1.0i + xd))) / 6.0 - (pisqu * log(-1.0i / (1.0i + xd))) / 6.0 - power_of<3>(log(-1.0i / (1.0i + xd))) / 6.0 + 1.0i * M_PI * H1(wx / (wx - xd), (-1.0i + wx) / (wx - xd)) * power_of<2>(log((1.0i * (-wx + xd)) / (wx * (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (wx - xd)))
-                + 1.0i * M_PI * H1(wx / (wx - xd), (1.0i + wx) / (wx - xd)) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * power_of<2>(log(-1.0i / (-1.0i + wx))) * my_sign(imag(wx / (-1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), -1.0i / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(log(1.0i / (1.0i + wx))) * my_sign(imag(wx / (1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), 1.0i / (1.0i + wx)) + 4.0 * pisqu * ln2 * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) + 4.0 * pisqu * ln2 * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) - 2.0 * zeta3);
+            const complex<double> part7 = + power_of<3>(ln_28) * (ln_3 / 12.0 - (3.0 * ln_36) / 4.0 + ln_40 + ln_94 / 12.0 + ln_105 / 4.0 + (1.0i / 2.0) * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + trilog((wx - xd) / (1.0i + wx)) * (2.0 * ln2 + ln_5 / 2.0 + ln_10 / 2.0 - ln_13 + 3.0 * ln_16 - (9.0 * ln_28) / 2.0 - ln_44 + ln_61 / 2.0 - ln_58 / 2.0 + ln_94 + 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + li2_9 * (pisqu / 2.0 - li2_10 - li2_11 / 2.0 + li2_36 / 2.0 + li2_20 + li2_48 / 2.0 + li2_44 + power_of<2>(lnm2) / 4.0 + power_of<2>(ln_1) / 2.0 + power_of<2>(ln_2) / 2.0 + (ln_82 * ln_3) / 2.0 + power_of<2>(ln_3) - (ln_3 * ln_83) / 2.0 + (ln_3 * ln_128) / 2.0 - (ln_3 * ln_84) / 2.0
+                + ln2 * ln_11 + (ln2 * ln_59) / 2.0 - (ln2 * ln_119) / 2.0 - ln_82 * ln_16 + (ln_5 * ln_16) / 2.0 + (3.0 * power_of<2>(ln_16)) / 2.0 - ln2 * ln_87 + ln_33 * ln_27 + (ln_27 * ln_94) / 2.0 + power_of<2>(ln_94) / 2.0 + power_of<2>(ln_100) / 4.0 + (2.0 * 1.0i) * M_PI * ln_3 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
+                + ln_94 * (2.0 * ln2 + ln_56 / 2.0 - ln_58 + (2.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) - (2.0 * 1.0i) * M_PI * ln_11 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + ln_28 * (-2.0 * ln_3 + ln_16 / 2.0 - ln_96 / 2.0 - ln_34 / 2.0 - ln_40 / 2.0 + ln_105 / 2.0 + 1.0i * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)))
+                + dilog(-1.0i / wx) * (pisqu / 3.0 - li2_60 / 2.0 + li2_23 / 2.0 + li2_52 - li2_8 - 2.0 * li2_11 + 3.0 * li2_36 - li2_50 + 2.0 * li2_30 + li2_39 - li2_49 / 2.0 + li2_17 / 2.0 + power_of<2>(ln_20) / 2.0 + power_of<2>(ln_85) / 2.0 + ln_27 * (-2.0 * lnhalf + ln_11 / 2.0 + ln_44) + ln_11 * ln_55
+                + (ln2 * ln_76) / 2.0 + (2.0 * ln2 - ln_11 + 2.0 * ln_56 + ln_58 / 2.0 - ln_63) * ln_94 - ln_11 * ln_104 + (4.0 * 1.0i) * M_PI * ln_62 * my_sign(-real(wx)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) + 1.0i * M_PI * ln_11 * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + ln_28 * (-2.0 * lnhalf + 2.0 * ln2 - ln_5 / 2.0 + (6.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))) + li2_26 * ((-1.0 / 6.0) * pisqu - li2_8 + li2_11 / 2.0 - li2_36 / 4.0 + li2_48 + 3.0 * ln_34 * ln_28 + (3.0 * power_of<2>(ln_28)) / 2.0 - 2.0 * ln_16 * ln_68 - power_of<2>(ln_94) / 2.0 + ln_16 * ln_102
+                + 1.0i * M_PI * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + ln_94 * (-2.0 * ln2 - ln_5 / 2.0 - ln_10 / 2.0 + ln_44 - ln_61 / 2.0 - 1.0i * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) + ln_28 * ((3.0 * ln_94) / 2.0 + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)))
+                + power_of<2>(ln_24) * ((-1.0 / 3.0) * pisqu + 1.0i * M_PI * ln_3 * my_sign(-imag(xd / (wx - xd))) * T(1.0, (wx - 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) + 1.0i * M_PI * ln_5 * my_sign(-imag(xd / (wx - xd))) * T(1.0, (wx + 1.0i * wx * xd) / (wx - xd), wx / (wx - xd))) - pisqu * power_of<2>(ln_11) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + 2.0 * pisqu * ln_11 * ln_16 * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx)
+                - pisqu * power_of<2>(ln_16) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) - pisqu * power_of<2>(ln_11) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) + 2.0 * pisqu * ln_11 * ln_16 * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) - pisqu * power_of<2>(ln_16) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)
+                + ln_44 * ((pisqu * lnm2) / 3.0 + power_of<3>(lnm2) / 3.0 + (pisqu * ln_3) / 6.0 - (power_of<2>(lnm2) * ln_3) / 2.0 + (power_of<2>(ln_1) * ln_3) / 2.0 + power_of<3>(ln_3) / 6.0 + (pisqu * ln_5) / 6.0 - (power_of<2>(lnm2) * ln_5) / 2.0 + power_of<3>(ln_5) / 6.0 - (power_of<2>(ln_5) * ln_128) / 2.0 - (power_of<2>(ln_5) * ln_84) / 2.0 - (power_of<2>(ln_3) * ln_127) / 2.0 + (ln_5 * power_of<2>(ln_15)) / 2.0 - (power_of<2>(ln_3) * ln_81) / 2.0
+                + (pisqu * log(((-2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + power_of<3>(log(((-2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + (pisqu * log(((2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + power_of<3>(log(((2.0 * 1.0i) * wx) / (1.0 + power_of<2>(wx)))) / 6.0 + (pisqu * ln_129) / 6.0 + power_of<3>(ln_129) / 6.0 - (pisqu * log(((-2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - power_of<3>(log(((-2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - (pisqu * log(((2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - power_of<3>(log(((2.0 * 1.0i) * (wx - xd)) / (1.0 + power_of<2>(wx)))) / 6.0 - (pisqu * ln_52) / 6.0 - power_of<3>(ln_52) / 6.0 - (pisqu * ln_65) / 6.0 - power_of<3>(ln_65) / 6.0
+                + (ln_125 * power_of<2>(ln_67)) / 2.0 + (pisqu * ln_130) / 6.0 + power_of<3>(ln_130) / 6.0 - (ln_56 * power_of<2>(ln_94)) / 2.0 + (ln_58 * power_of<2>(ln_94)) / 2.0 - (ln_63 * power_of<2>(ln_94)) / 2.0 - (ln_71 * power_of<2>(ln_94)) / 2.0 + (ln_73 * power_of<2>(ln_94)) / 2.0 - (ln_91 * power_of<2>(ln_94)) / 2.0
+                + ln_60 * ((-0.5) * power_of<2>(ln_67) + ln_67 * ln_94) + (pisqu * ln_101) / 6.0 + power_of<3>(ln_101) / 6.0 + (pisqu * ln_108) / 6.0 + power_of<3>(ln_108) / 6.0 - 1.0i * M_PI * H1((1.0i + wx) / (wx - xd), (-1.0i + wx) / (wx - xd)) * power_of<2>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx))) / (wx - xd))) * my_sign(imag((-1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((-1.0i + wx) / (1.0i + wx), (-1.0i + wx) / (wx - xd)) * power_of<2>(ln_131) * my_sign(imag((-1.0i + wx) / (wx - xd)))
+                - 1.0i * M_PI * H1((-1.0i + wx) / (wx - xd), (1.0i + wx) / (wx - xd)) * power_of<2>(log((((-0.5) * 1.0i) * (1.0 + power_of<2>(wx))) / (wx - xd))) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((1.0i + wx) / (-1.0i + wx), (1.0i + wx) / (wx - xd)) * power_of<2>(ln_132) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * H1((-1.0i) * wx, wx * xdinv) * power_of<2>(ln_113) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(1.0i / xd, wx * xdinv) * power_of<2>(ln_45) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(ln_111) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(1.0i * wx, wx * xdinv) * power_of<2>(ln_112) * my_sign(imag(wx * xdinv))
+                + 1.0i * M_PI * H1((1.0i + wx) / (-1.0i + wx), (1.0i + wx) / wx) * power_of<2>(ln_4) * my_sign(-real(1.0 / wx)) - 1.0i * M_PI * H1((-1.0i + wx) / wx, (1.0i + wx) / wx) * power_of<2>(log((((-0.5) * 1.0i) * (1.0 + power_of<2>(wx))) / wx)) * my_sign(-real(1.0 / wx)) + 1.0i * M_PI * H1((-1.0i + wx) / (1.0i + wx), (-1.0i + wx) / wx) * power_of<2>(ln_2) * my_sign(real(1.0 / wx)) - 1.0i * M_PI * H1((1.0i + wx) / wx, (-1.0i + wx) / wx) * power_of<2>(log(((1.0i / 2.0) * (1.0 + power_of<2>(wx))) / wx)) * my_sign(real(1.0 / wx)) + 1.0i * M_PI * power_of<2>(ln_82) * my_sign(imag((1.0i + wx) / (-1.0i + wx))) * T(1.0, -1.0i / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(ln_3) * my_sign(-imag(wx / (1.0i + wx))) * T(1.0, -1.0i / (-1.0i + wx), 1.0i / (1.0i + wx))
+                + 1.0i * M_PI * power_of<2>(ln_5) * my_sign(imag(wx / (1.0i - wx))) * T(1.0, 1.0i / (1.0i + wx), -1.0i / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(ln_79) * my_sign(imag((-1.0i + wx) / (1.0i + wx))) * T(1.0, 1.0i / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)) - 1.0i * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * power_of<2>(ln_82) * my_sign(imag((1.0i + wx) / (-1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(ln_67) * my_sign(imag((wx - xd) / (1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (1.0i + xd) / (1.0i + wx))
+                - 1.0i * M_PI * power_of<2>(ln_79) * my_sign(imag((-1.0i + wx) / (1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)) + ln_94 * ((-2.0 * 1.0i) * M_PI * ln_82 * my_sign(imag((-1.0i + wx) / (wx - xd))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + wx)) - (2.0 * 1.0i) * M_PI * ln_79 * my_sign(imag((1.0i + wx) / (wx - xd))) * T(1.0, (1.0i + xd) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + wx)))
+                + power_of<2>(ln_54) * ((-0.5) * ln_74 + ln_69 / 2.0 + 1.0i * M_PI * my_sign(imag((wx - xd) / (-1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), (-1.0i + xd) / (-1.0i + wx))) - (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(ln_15) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + ln_67 * ((-1.0 / 6.0) * pisqu - power_of<2>(ln_1) / 2.0 + power_of<2>(ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)) - (1.0i / 3.0) * power_of<3>(M_PI) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(ln_1) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - 1.0i * M_PI * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)
+                + ln_54 * ((-1.0 / 6.0) * pisqu - power_of<2>(ln_15) / 2.0 + ln_74 * ln_94 + power_of<2>(ln_94) / 2.0 + (2.0 * 1.0i) * M_PI * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx)) - 4.0 * pisqu * ln_16 * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * T(p(-1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) - 4.0 * pisqu * ln_11 * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * T(p(1.0i / wx, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)) + 2.0 * pisqu * ln2squ * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0)
+                - 4.0 * pisqu * ln2 * ln_5 * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) + 2.0 * pisqu * power_of<2>(ln_5) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * T(p((-1.0i) * wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) + 2.0 * pisqu * ln2squ * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 4.0 * pisqu * ln2 * ln_3 * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) + 2.0 * pisqu * power_of<2>(ln_3) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * T(p(1.0i * wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0)
+                - pisqu * power_of<2>(ln_16) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)
+                + power_of<2>(ln_28) * (((3.0 * ln2) / 2.0 + ln_3 - (3.0 * ln_5) / 4.0 + ln_16 / 2.0) * ln_36 + ((-3.0 * ln2) / 4.0 - ln_3 / 4.0 - ln_16 / 4.0) * ln_40 + power_of<2>(ln_42) / 2.0 + log((1.0i + xd) / (2.0 * xd)) * ((-0.25) * ln_3 + ln_5 / 4.0 + ln_11 / 2.0 - ln_94 / 2.0) + log((2.0 * xd) / (1.0i + xd)) * (ln_3 / 4.0 - ln_5 / 2.0 + ln_11 / 2.0 + ln_16 / 4.0 - ln_94 / 2.0) + (ln_42 * ln_94) / 2.0
+                + ((3.0 * ln2) / 4.0 + ln_3 / 4.0) * ln_105 + 1.0i * M_PI * ln2 * my_sign(-real(xd)) * T(1.0, 1.0 + 1.0i * wx, 1.0 + 1.0i * xd) + 1.0i * M_PI * ln_3 * my_sign(-real(xd)) * T(1.0, 1.0 + 1.0i * wx, 1.0 + 1.0i * xd) - 1.0i * M_PI * ln_12 * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) + (3.0 * 1.0i) * M_PI * ln_87 * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) * T(1.0, (wx - xd) / (-1.0i + wx), (1.0i + wx) / (-1.0i + wx)) + (4.0 * 1.0i) * M_PI * ln_79 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx)
+                - 1.0i * M_PI * ln_3 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * ln_5 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + ln_74 * ((-0.25) * ln_3 + ln_5 / 2.0 - ln_11 / 4.0 - ln_16 / 4.0 + ln_94 / 2.0 - (1.0i / 2.0) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + 1.0i * M_PI * ln_8 * my_sign(real(1.0 / (1.0i - xd))) * T(1.0, (-1.0i) * xd, (-1.0i) * wx)
+                + 1.0i * M_PI * ln_11 * my_sign(imag(xd / (1.0i - xd))) * T(1.0, ((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)), -1.0i / (-1.0i + xd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) - (1.0i / 2.0) * M_PI * ln_3 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) + ((3.0 * 1.0i) / 2.0) * M_PI * ln_16 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) - (1.0i / 2.0) * M_PI * ln_73 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) + ln_44 * (ln_94 / 2.0 + 1.0i * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))
+                - pisqu * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx)) - pisqu * power_of<2>(ln_11) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + power_of<2>(ln_27) * (((3.0 * ln2) / 2.0 - (3.0 * ln_3) / 4.0 + ln_5 + ln_11 / 2.0) * ln_35 + ((-3.0 * ln2) / 4.0 - ln_5 / 4.0 - ln_11 / 4.0) * ln_41 + power_of<2>(ln_43) / 2.0
+                + ln_28 * ((-0.5) * ln_41 - ln_49 / 2.0) + ((3.0 * ln2) / 4.0 + ln_5 / 4.0) * ln_49 + log((-1.0i + xd) / (2.0 * xd)) * (ln_3 / 4.0 - ln_5 / 4.0 + ln_16 / 2.0 - ln_94 / 2.0) + log((2.0 * xd) / (-1.0i + xd)) * ((-0.5) * ln_3 + ln_5 / 4.0 + ln_11 / 4.0 + ln_16 / 2.0 - ln_94 / 2.0) + (ln_43 * ln_94) / 2.0 + 1.0i * M_PI * ln2 * my_sign(real(xd)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - 1.0i * xd)
+                + 1.0i * M_PI * ln_5 * my_sign(real(xd)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - 1.0i * xd) - 1.0i * M_PI * ln_17 * my_sign(imag((1.0i + wx) / (1.0i + xd))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) + (3.0 * 1.0i) * M_PI * ln_59 * my_sign(imag((1.0i + wx) / (1.0i + xd))) * T(1.0, (wx - xd) / (1.0i + wx), (-1.0i + wx) / (1.0i + wx)) + (4.0 * 1.0i) * M_PI * ln_82 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - 1.0i * M_PI * ln_3 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
+                + ln_26 * ((-0.25) * ln_3 + ln_5 / 4.0 + ln_17 / 4.0 - ln_16 / 2.0 - ln_126 / 4.0 + ln_94 / 2.0 + (1.0i / 2.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + ln_60 * (ln_3 / 2.0 - ln_5 / 4.0 - ln_11 / 4.0 - ln_16 / 4.0 + ln_94 / 2.0 - (1.0i / 2.0) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + (1.0i / 2.0) * M_PI * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx))
+                - 1.0i * M_PI * ln_5 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * ln_9 * my_sign(real(1.0 / (1.0i + xd))) * T(1.0, 1.0i * xd, 1.0i * wx) + 1.0i * M_PI * ln_16 * my_sign(-imag(xd / (1.0i + xd))) * T(1.0, (1.0i * (wx - xd)) / (wx * (1.0i + xd)), 1.0i / (1.0i + xd)) + (2.0 * 1.0i) * M_PI * ln2 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) - (1.0i / 2.0) * M_PI * ln_5 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) + ((3.0 * 1.0i) / 2.0) * M_PI * ln_11 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) - (1.0i / 2.0) * M_PI * ln_58 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)
+                + ln_44 * (ln_94 / 2.0 + 1.0i * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) - pisqu * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx)) - 2.0 * pisqu * ln2squ * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 2.0 * pisqu * ln2squ * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0)
+                + power_of<2>(ln_94) * ((-1.0 / 3.0) * pisqu - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, (-1.0i + wx) / wx, 1.0 - xd / wx) - 1.0i * M_PI * ln_16 * my_sign(imag(xd / wx)) * T(1.0, (-1.0i + wx) / wx, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, (1.0i + wx) / wx, 1.0 - xd / wx) - 1.0i * M_PI * ln_11 * my_sign(imag(xd / wx)) * T(1.0, (1.0i + wx) / wx, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - 1.0i * M_PI * ln_5 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) - (2.0 * 1.0i) * M_PI * ln2 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
+                - 1.0i * M_PI * ln_3 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) + 1.0i * M_PI * ln_6 * my_sign(imag(wx / (wx - xd))) * T(1.0, xd / wx, -1.0i / wx) + 1.0i * M_PI * ln_7 * my_sign(imag(wx / (wx - xd))) * T(1.0, xd / wx, 1.0i / wx) - 1.0i * M_PI * ln_3 * my_sign(imag(xd / (wx - xd))) * T(1.0, (wx - 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) - 1.0i * M_PI * ln_5 * my_sign(imag(xd / (wx - xd))) * T(1.0, (wx + 1.0i * wx * xd) / (wx - xd), wx / (wx - xd)) - 2.0 * pisqu * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) - 2.0 * pisqu * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0))
+                + ln_104 * ((-1.0 / 6.0) * (pisqu * ln_5) - (lnhalf * power_of<2>(ln_5)) / 4.0 - (ln2 * power_of<2>(ln_5)) / 4.0 - (ln_3 * power_of<2>(ln_5)) / 4.0 - power_of<3>(ln_5) / 6.0 - (pisqu * ln_11) / 3.0 - (ln2 * power_of<2>(ln_11)) / 2.0 + (ln_3 * power_of<2>(ln_11)) / 2.0 - power_of<3>(ln_11) / 6.0 - (power_of<2>(ln_5) * ln_17) / 4.0 + (pisqu * ln_15) / 6.0 - (ln_11 * power_of<2>(ln_15)) / 2.0 + power_of<3>(ln_15) / 6.0
+                - (power_of<2>(ln_11) * ln_16) / 2.0 - 2.0 * zeta3) + ln_64 * ((-1.0 / 6.0) * (pisqu * ln_5) - (ln_3 * power_of<2>(ln_9)) / 2.0 + (pisqu * ln_11) / 6.0 + (pisqu * ln_16) / 12.0 - (pisqu * ln_94) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_71) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(ln_93) * my_sign(-real(1.0 / wx)) - 2.0 * zeta3)
+                + ln_50 * ((-1.0 / 6.0) * (pisqu * ln_3) - (ln_5 * power_of<2>(ln_8)) / 2.0 + (pisqu * ln_11) / 12.0 + (pisqu * ln_16) / 6.0 - (pisqu * ln_94) / 4.0 - (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_56) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(ln_92) * my_sign(real(1.0 / wx)) - 2.0 * zeta3)
+                + ln_102 * ((pisqu * ln_1) / 6.0 + power_of<3>(ln_1) / 6.0 - (pisqu * ln_3) / 6.0 - (lnhalf * power_of<2>(ln_3)) / 4.0 - (ln2 * power_of<2>(ln_3)) / 4.0 - power_of<3>(ln_3) / 6.0 - (power_of<2>(ln_3) * ln_5) / 4.0 - (power_of<2>(ln_3) * ln_12) / 4.0 - (pisqu * ln_16) / 3.0 - (power_of<2>(ln_1) * ln_16) / 2.0 - (ln2 * power_of<2>(ln_16)) / 2.0 + (ln_5 * power_of<2>(ln_16)) / 2.0 - (ln_11 * power_of<2>(ln_16)) / 2.0 - power_of<3>(ln_16) / 6.0
+                - (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * power_of<2>(ln_105) * my_sign(real(xdinv)) - 2.0 * zeta3) + ln_94 * ((2.0 * pisqu * lnm2) / 3.0 + (2.0 * power_of<3>(lnm2)) / 3.0 + (4.0 * pisqu * lnm1) / 3.0 + (4.0 * power_of<3>(lnm1)) / 3.0 - 4.0 * lnm1 * ln2squ + (pisqu * ln_1) / 6.0 + power_of<3>(ln_1) / 6.0 - (pisqu * ln_2) / 12.0 - power_of<3>(ln_2) / 12.0 - (pisqu * ln_3) / 12.0 + (ln_82 * power_of<2>(ln_3)) / 2.0 - power_of<3>(ln_3) / 12.0 - (pisqu * ln_4) / 12.0 - power_of<3>(ln_4) / 12.0 - (pisqu * ln_5) / 12.0
+                + (ln_79 * power_of<2>(ln_5)) / 2.0 - power_of<3>(ln_5) / 12.0 + (pisqu * ln_133) / 12.0 + power_of<3>(ln_133) / 12.0 + (pisqu * ln_134) / 12.0 + power_of<3>(ln_134) / 12.0 - (pisqu * ln_6) / 3.0 + power_of<2>(ln_3) * ln_6 - power_of<3>(ln_6) / 3.0 - (pisqu * ln_7) / 3.0 + power_of<2>(ln_5) * ln_7 - power_of<3>(ln_7) / 3.0 - (pisqu * ln_135) / 6.0 - power_of<3>(ln_135) / 6.0 - (pisqu * ln_136) / 6.0 - power_of<3>(ln_136) / 6.0 - (pisqu * ln_8) / 3.0 - power_of<3>(ln_8) / 3.0 - (pisqu * ln_9) / 3.0 - power_of<3>(ln_9) / 3.0
+                - (pisqu * ln_137) / 12.0 - power_of<3>(ln_137) / 12.0 - (pisqu * ln_138) / 12.0 - power_of<3>(ln_138) / 12.0 - (pisqu * ln_139) / 6.0 - power_of<3>(ln_139) / 6.0 + (pisqu * ln_10) / 12.0 + power_of<3>(ln_10) / 12.0 - (power_of<2>(ln_3) * ln_83) / 2.0 + (pisqu * ln_12) / 6.0 + power_of<3>(ln_12) / 6.0 + (power_of<2>(ln_3) * ln_128) / 2.0 - (power_of<2>(ln_3) * ln_84) / 2.0 - (power_of<2>(ln_7) * ln_11) / 2.0 - (3.0 * ln_7 * power_of<2>(ln_11)) / 2.0
+                + ln_8 * power_of<2>(ln_11) + (pisqu * ln_13) / 12.0 + power_of<3>(ln_13) / 12.0 - (power_of<2>(ln_5) * ln_80) / 2.0 + power_of<2>(ln_11) * ln_80 - (pisqu * ln_14) / 6.0 - power_of<3>(ln_14) / 6.0 + (pisqu * ln_17) / 6.0 + power_of<3>(ln_17) / 6.0 + (power_of<2>(ln_5) * ln_127) / 2.0 - power_of<2>(ln_11) * ln_127 + (pisqu * ln_15) / 6.0 + power_of<3>(ln_15) / 6.0 - (power_of<2>(ln_5) * ln_81) / 2.0
+                - (power_of<2>(ln_6) * ln_16) / 2.0 - (3.0 * ln_6 * power_of<2>(ln_16)) / 2.0 + ln_9 * power_of<2>(ln_16) + ln_83 * power_of<2>(ln_16) - ln_128 * power_of<2>(ln_16) - (pisqu * log(1.0i / (-1.0i + xd))) / 6.0 - power_of<3>(log(1.0i / (-1.0i + xd))) / 6.0 - (pisqu * log(-1.0i / (1.0i + xd))) / 6.0 - power_of<3>(log(-1.0i / (1.0i + xd))) / 6.0 + 1.0i * M_PI * H1(wx / (wx - xd), (-1.0i + wx) / (wx - xd)) * power_of<2>(log((1.0i * (-wx + xd)) / (wx * (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (wx - xd)))
+                + 1.0i * M_PI * H1(wx / (wx - xd), (1.0i + wx) / (wx - xd)) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (wx - xd))) + 1.0i * M_PI * power_of<2>(ln_10) * my_sign(imag(wx / (-1.0i + wx))) * T(1.0, (-1.0i + xd) / (-1.0i + wx), -1.0i / (-1.0i + wx)) + 1.0i * M_PI * power_of<2>(ln_13) * my_sign(imag(wx / (1.0i + wx))) * T(1.0, (1.0i + xd) / (1.0i + wx), 1.0i / (1.0i + wx)) + 4.0 * pisqu * ln2 * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 - 1.0i * xd), 1.0 - 1.0i * xd, 2.0) + 4.0 * pisqu * ln2 * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx) * T(p(xd / wx, 1.0 + 1.0i * xd), 1.0 + 1.0i * xd, 2.0) - 2.0 * zeta3);
 
-            const complex<double> part8 = + log((-1.0i + wx) / (wx - xd)) * (-(power_of<2>(log(1.0i / wx)) * log((-1.0i + wx) / wx)) + (pisqu * log(-1.0 + 1.0i * xd)) / 6.0 + power_of<3>(log(-1.0 + 1.0i * xd)) / 6.0 - (pisqu * log(1.0 + 1.0i * xd)) / 3.0 + power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) * log(1.0 + 1.0i * xd) - (power_of<2>(log(-1.0 + 1.0i * xd)) * log(1.0 + 1.0i * xd)) / 2.0 - (5.0 * power_of<3>(log(1.0 + 1.0i * xd))) / 12.0 + log(1.0 - 1.0i * xd) * (power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) + power_of<2>(log(1.0 + 1.0i * xd)) / 2.0) - (log(1.0 + 1.0i * wx) * power_of<2>(log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))))) / 2.0 + power_of<2>(log(1.0 + 1.0i * xd)) * ((-3.0 * ln2) / 4.0 - log(1.0 - 1.0i * wx) / 4.0 + log((1.0i + xd) * xdinv) / 2.0) + (pisqu * log(1.0 - xd / wx)) / 6.0
-                - (power_of<2>(log((-1.0i + xd) / (-1.0i + wx))) * log(1.0 - xd / wx)) / 2.0 - zeta3) + log((1.0i + wx) / (wx - xd)) * (-(power_of<2>(log(-1.0i / wx)) * log((1.0i + wx) / wx)) + (pisqu * log(-1.0 - 1.0i * xd)) / 6.0 + power_of<3>(log(-1.0 - 1.0i * xd)) / 6.0 + ((-1.0 / 3.0) * pisqu + power_of<2>(log(0.5 - (1.0i / 2.0) * xd))) * log(1.0 - 1.0i * xd) - (power_of<2>(log(-1.0 - 1.0i * xd)) * log(1.0 - 1.0i * xd)) / 2.0 - (5.0 * power_of<3>(log(1.0 - 1.0i * xd))) / 12.0 + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * log(1.0 + 1.0i * xd) + power_of<2>(log(1.0 - 1.0i * xd)) * ((-3.0 * ln2) / 4.0 - log(1.0 + 1.0i * wx) / 4.0 + log(1.0 + 1.0i * xd) / 2.0 + log((-1.0i + xd) * xdinv) / 2.0) - (log(1.0 - 1.0i * wx) * power_of<2>(log((1.0i * (wx - xd)) / (wx * (1.0i + xd))))) / 2.0
-                + (pisqu * log(1.0 - xd / wx)) / 6.0 - (power_of<2>(log((1.0i + xd) / (1.0i + wx))) * log(1.0 - xd / wx)) / 2.0 - zeta3) + log((-1.0i + xd) / (-1.0i + wx)) * ((-0.5) * (log(1.0 + 1.0i * wx) * power_of<2>(log((-1.0i) * wx))) - (log(xd / (1.0i + xd)) * power_of<2>(log(1.0 - xd / wx))) / 4.0 - power_of<3>(log(1.0 - xd / wx)) / 6.0 - (1.0i / 2.0) * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + log(1.0 - xd / wx) * ((-1.0 / 6.0) * pisqu + 1.0i * M_PI * log((1.0i + wx) / wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
-                + power_of<2>(log(1.0 - xd / wx)) * (-ln2 - log(1.0 - 1.0i * wx) / 4.0 - log(1.0i / (1.0i + wx)) / 4.0 - (1.0i / 2.0) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - (1.0i / 2.0) * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) - zeta3) + log((1.0i + xd) / (1.0i + wx)) * ((-0.5) * (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0i * wx))) - power_of<3>(log(1.0 - xd / wx)) / 6.0 - (1.0i / 2.0) * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + log(1.0 - xd / wx) * ((-1.0 / 6.0) * pisqu + 1.0i * M_PI * log((-1.0i + wx) / wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
-                + power_of<2>(log(1.0 - xd / wx)) * (-ln2 - log(1.0 + 1.0i * wx) / 4.0 - log(-1.0i / (-1.0i + wx)) / 4.0 - (1.0i / 2.0) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - (1.0i / 2.0) * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) - zeta3) + log(-1.0i / (-1.0i + wx)) * zeta3 + log((-1.0i + wx) / wx) * zeta3 + log(1.0i / (1.0i + wx)) * zeta3 + log((1.0i + wx) / wx) * zeta3 + (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) * zeta3 + (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) * zeta3 - (6.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) * zeta3
+            const complex<double> part8 = + ln_96 * (-(power_of<2>(ln_7) * ln_11) + (pisqu * ln_86) / 6.0 + power_of<3>(ln_86) / 6.0 - (pisqu * ln_28) / 3.0 + power_of<2>(ln_26) * ln_28 - (power_of<2>(ln_86) * ln_28) / 2.0 - (5.0 * power_of<3>(ln_28)) / 12.0 + ln_27 * (power_of<2>(ln_26) + power_of<2>(ln_28) / 2.0) - (ln_5 * power_of<2>(ln_55)) / 2.0 + power_of<2>(ln_28) * ((-3.0 * ln2) / 4.0 - ln_3 / 4.0 + ln_89 / 2.0) + (pisqu * ln_94) / 6.0
+                - (power_of<2>(ln_58) * ln_94) / 2.0 - zeta3) + ln_97 * (-(power_of<2>(ln_6) * ln_16) + (pisqu * ln_85) / 6.0 + power_of<3>(ln_85) / 6.0 + ((-1.0 / 3.0) * pisqu + power_of<2>(ln_25)) * ln_27 - (power_of<2>(ln_85) * ln_27) / 2.0 - (5.0 * power_of<3>(ln_27)) / 12.0 + power_of<2>(ln_25) * ln_28 + power_of<2>(ln_27) * ((-3.0 * ln2) / 4.0 - ln_5 / 4.0 + ln_28 / 2.0 + ln_62 / 2.0) - (ln_3 * power_of<2>(ln_68)) / 2.0
+                + (pisqu * ln_94) / 6.0 - (power_of<2>(ln_73) * ln_94) / 2.0 - zeta3) + ln_58 * ((-0.5) * (ln_5 * power_of<2>(ln_8)) - (ln_88 * power_of<2>(ln_94)) / 4.0 - power_of<3>(ln_94) / 6.0 - (1.0i / 2.0) * M_PI * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + ln_94 * ((-1.0 / 6.0) * pisqu + 1.0i * M_PI * ln_16 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx))
+                + power_of<2>(ln_94) * (-ln2 - ln_3 / 4.0 - ln_13 / 4.0 - (1.0i / 2.0) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) - (1.0i / 2.0) * M_PI * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) - zeta3) + ln_73 * ((-0.5) * (ln_3 * power_of<2>(ln_9)) - power_of<3>(ln_94) / 6.0 - (1.0i / 2.0) * M_PI * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) + ln_94 * ((-1.0 / 6.0) * pisqu + 1.0i * M_PI * ln_11 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx))
+                + power_of<2>(ln_94) * (-ln2 - ln_5 / 4.0 - ln_10 / 4.0 - (1.0i / 2.0) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) - (1.0i / 2.0) * M_PI * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd)) - zeta3) + ln_10 * zeta3 + ln_11 * zeta3 + ln_13 * zeta3 + ln_16 * zeta3 + (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 - 1.0i * wx, 1.0 - wx * xdinv) * zeta3 + (4.0 * 1.0i) * M_PI * my_sign(imag(wx * xdinv)) * T(1.0, 1.0 + 1.0i * wx, 1.0 - wx * xdinv) * zeta3 - (6.0 * 1.0i) * M_PI * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) * zeta3
                 - (6.0 * 1.0i) * M_PI * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) * zeta3 - (2.0 * 1.0i) * M_PI * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) * zeta3 - (2.0 * 1.0i) * M_PI * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) * zeta3 + (2.0 * 1.0i) * M_PI * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx) * zeta3 + (2.0 * 1.0i) * M_PI * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) * zeta3
-                + log(1.0 + 1.0i * xd) * ((-1.0 / 6.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 6.0 - (pisqu * lnm1) / 6.0 - power_of<3>(lnm1) / 6.0 + (lnm1 * ln2squ) / 2.0 + (pisqu * log(1.0 - 1.0i * wx)) / 6.0 + (log(0.5 + (1.0i / 2.0) * wx) * power_of<2>(log(1.0 - 1.0i * wx))) / 4.0 + power_of<3>(log(1.0 - 1.0i * wx)) / 12.0 - (pisqu * log(-1.0 + 1.0i * wx)) / 4.0 - power_of<3>(log(-1.0 + 1.0i * wx)) / 4.0 - (log(0.5 - (1.0i / 2.0) * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 2.0 + (pisqu * log(((-0.5) * 1.0i) / wx)) / 12.0 + power_of<3>(log(((-0.5) * 1.0i) / wx)) / 12.0 - (pisqu * log(1.0i / 2.0 / wx)) / 12.0 - power_of<3>(log(1.0i / 2.0 / wx)) / 12.0 - (pisqu * log(-1.0i / wx)) / 3.0 + power_of<2>(log(1.0 - 1.0i * wx)) * log(-1.0i / wx) - power_of<3>(log(-1.0i / wx)) / 3.0
-                + (5.0 * pisqu * log(1.0i / wx)) / 12.0 - (5.0 * power_of<2>(log(1.0 + 1.0i * wx)) * log(1.0i / wx)) / 4.0 + (5.0 * power_of<3>(log(1.0i / wx))) / 12.0 + (pisqu * log((-2.0 * 1.0i) / wx)) / 3.0 + power_of<3>(log((-2.0 * 1.0i) / wx)) / 3.0 + (pisqu * log((2.0 * 1.0i) / wx)) / 2.0 + power_of<3>(log((2.0 * 1.0i) / wx)) / 2.0 - (pisqu * log(((-0.5) * 1.0i) * wx)) / 6.0 - power_of<3>(log(((-0.5) * 1.0i) * wx)) / 6.0 + (pisqu * log((-1.0i) * wx)) / 2.0 + power_of<2>(log(1.0 + 1.0i * wx)) * log((-1.0i) * wx) + (log(1.0 + 1.0i * wx) * power_of<2>(log((-1.0i) * wx))) / 2.0 + power_of<3>(log((-1.0i) * wx)) / 2.0 - (pisqu * log(1.0i * wx)) / 6.0 - power_of<3>(log(1.0i * wx)) / 6.0 + (pisqu * log((-2.0 * 1.0i) * wx)) / 12.0 + power_of<3>(log((-2.0 * 1.0i) * wx)) / 12.0 - (pisqu * log((2.0 * 1.0i) * wx)) / 12.0 - power_of<3>(log((2.0 * 1.0i) * wx)) / 12.0
-                + (pisqu * log(wx / (1.0i - wx))) / 12.0 + power_of<3>(log(wx / (1.0i - wx))) / 12.0 + (pisqu * log(1.0i / (-1.0i + wx))) / 12.0 + power_of<3>(log(1.0i / (-1.0i + wx))) / 12.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((-2.0 * 1.0i) / (-1.0i + wx))) / 4.0 + (pisqu * log(wx / (-1.0i + wx))) / 12.0 - power_of<2>(lnhalf) * log(wx / (-1.0i + wx)) + power_of<3>(log(wx / (-1.0i + wx))) / 12.0 + power_of<2>(lnhalf) * log((2.0 * wx) / (-1.0i + wx)) + (power_of<2>(log(1.0 - 1.0i * wx)) * log((2.0 * wx) / (-1.0i + wx))) / 4.0 + power_of<2>(lnhalf) * log((-1.0i + wx) / (2.0 * wx)) - (power_of<2>(log(1.0 - 1.0i * wx)) * log((-1.0i + wx) / (2.0 * wx))) / 4.0 - power_of<2>(lnhalf) * log((-1.0i + wx) / wx) + (log(0.5 - (1.0i / 2.0) * wx) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0
-                - (3.0 * log((-1.0i) * wx) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 - (pisqu * log(1.0i / (1.0i + wx))) / 6.0 - power_of<3>(log(1.0i / (1.0i + wx))) / 6.0 + (3.0 * power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * 1.0i) / (1.0i + wx))) / 4.0 - power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * 1.0i) / (1.0i + wx)) + (ln2squ * log((1.0i - wx) / (1.0i + wx))) / 4.0 - (pisqu * log(-(wx / (1.0i + wx)))) / 12.0 - power_of<3>(log(-(wx / (1.0i + wx)))) / 12.0 - (pisqu * log(wx / (1.0i + wx))) / 6.0 - power_of<2>(lnhalf) * log(wx / (1.0i + wx)) - power_of<3>(log(wx / (1.0i + wx))) / 6.0 + power_of<2>(lnhalf) * log((2.0 * wx) / (1.0i + wx)) - (3.0 * power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * wx) / (1.0i + wx))) / 4.0 + power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * wx) / (1.0i + wx))
-                - (ln2squ * log((-1.0i + wx) / (1.0i + wx))) / 4.0 - (pisqu * log((2.0 * (-1.0i + wx)) / (1.0i + wx))) / 3.0 - power_of<3>(log((2.0 * (-1.0i + wx)) / (1.0i + wx))) / 3.0 - (ln2squ * log((1.0i + wx) / (1.0i - wx))) / 4.0 + (pisqu * log(-((1.0i + wx) / wx))) / 6.0 + power_of<3>(log(-((1.0i + wx) / wx))) / 6.0 + power_of<2>(lnhalf) * log((1.0i + wx) / (2.0 * wx)) + (power_of<2>(log(1.0 + 1.0i * wx)) * log((1.0i + wx) / (2.0 * wx))) / 2.0 - (power_of<2>(log((-1.0i + wx) / wx)) * log((1.0i + wx) / (2.0 * wx))) / 2.0 - power_of<2>(lnhalf) * log((1.0i + wx) / wx) + (log(1.0i * wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (log((-2.0 * 1.0i) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx))) / 4.0
-                - (log((2.0 * wx) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx))) / 4.0 + (ln2squ * log((1.0i + wx) / (-1.0i + wx))) / 4.0 - (pisqu * log((2.0 * (1.0i + wx)) / (-1.0i + wx))) / 3.0 - power_of<3>(log((2.0 * (1.0i + wx)) / (-1.0i + wx))) / 3.0 + (pisqu * log(1.0i / xd)) / 4.0 + power_of<3>(log(1.0i / xd)) / 4.0 - power_of<3>(log(wx * xdinv)) / 6.0 - (pisqu * log((1.0i * wx) / ((-1.0i + wx) * xd))) / 3.0 - power_of<3>(log((1.0i * wx) / ((-1.0i + wx) * xd))) / 3.0 + (pisqu * log((-1.0i + wx) * xdinv)) / 3.0 + power_of<3>(log((-1.0i + wx) * xdinv)) / 3.0 - (pisqu * log((-1.0i + 1.0 / wx) * xd)) / 12.0 - power_of<3>(log((-1.0i + 1.0 / wx) * xd)) / 12.0 + (pisqu * log((1.0i * (1.0i + wx) * xd) / wx)) / 12.0 + power_of<3>(log((1.0i * (1.0i + wx) * xd) / wx)) / 12.0
-                - (pisqu * log(-1.0i / (-1.0i + xd))) / 6.0 - power_of<3>(log(-1.0i / (-1.0i + xd))) / 6.0 - (pisqu * log((1.0 + 1.0i * wx) / (wx * (-1.0i + xd)))) / 6.0 - power_of<3>(log((1.0 + 1.0i * wx) / (wx * (-1.0i + xd)))) / 6.0 - (pisqu * log(wx / (-1.0i + xd))) / 12.0 - power_of<3>(log(wx / (-1.0i + xd))) / 12.0 - power_of<3>(log((-1.0i + wx) / (-1.0i + xd))) / 6.0 + (pisqu * log((-2.0 - (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 3.0 + power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 3.0 + (pisqu * log((2.0 + (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0 + power_of<3>(log((2.0 + (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0 + (pisqu * log((-1.0i + xd) / (-1.0i + wx))) / 6.0 + power_of<3>(log((-1.0i + xd) / (-1.0i + wx))) / 6.0
-                + (pisqu * log(-(wx / (1.0i + xd)))) / 12.0 + power_of<3>(log(-(wx / (1.0i + xd)))) / 12.0 - (pisqu * log((-1.0i + wx) / (1.0i + xd))) / 2.0 - power_of<3>(log((-1.0i + wx) / (1.0i + xd))) / 2.0 + (pisqu * log(((2.0 * 1.0i) * (1.0i + wx)) / ((-1.0i + wx) * (1.0i + xd)))) / 3.0 + power_of<3>(log(((2.0 * 1.0i) * (1.0i + wx)) / ((-1.0i + wx) * (1.0i + xd)))) / 3.0 + ((-0.25) * power_of<2>(log(1.0 - 1.0i * wx)) + power_of<2>(log((1.0i + wx) / wx)) / 4.0) * log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) - (power_of<2>(log(1.0 - 1.0i * wx)) * log(-((1.0i + xd) / (wx - xd)))) / 4.0 + (power_of<2>(log(1.0 - 1.0i * wx)) / 4.0 - power_of<2>(log((1.0i + wx) / wx)) / 4.0) * log((-wx + xd) / (1.0i + xd)) + (pisqu * log(1.0 - xd / wx)) / 12.0 + (log(xd / wx) * power_of<2>(log(1.0 - xd / wx))) / 2.0
-                - (log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 4.0 - (log((1.0i + wx) / (1.0i + xd)) * power_of<2>(log(1.0 - xd / wx))) / 4.0 + (log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 4.0 - (log((wx * (1.0i + xd)) / ((1.0i + wx) * xd)) * power_of<2>(log(1.0 - xd / wx))) / 2.0 + log((-1.0i + wx) / (-1.0i + xd)) * ((-1.0 / 6.0) * pisqu + power_of<2>(log(1.0 - xd / wx)) / 4.0) + log(wx * xdinv) * ((-1.0 / 6.0) * pisqu + power_of<2>(log(1.0 - xd / wx)) / 2.0) + (pisqu * log(-1.0 + xd / wx)) / 12.0 + power_of<3>(log(-1.0 + xd / wx)) / 12.0 + (pisqu * log((1.0 + 1.0i * wx) / (1.0i * wx - wx * xd))) / 3.0 + power_of<3>(log((1.0 + 1.0i * wx) / (1.0i * wx - wx * xd))) / 3.0
-                + (power_of<2>(log(1.0 - 1.0i * wx)) * log((wx - 1.0i * wx * xd) / (wx - xd))) / 4.0 - (pisqu * log((wx + 1.0i * wx * xd) / (1.0i - wx))) / 6.0 - power_of<3>(log((wx + 1.0i * wx * xd) / (1.0i - wx))) / 6.0 + (pisqu * log(((-1.0i) * wx) / (1.0i * xd + wx * xd))) / 12.0 + power_of<3>(log(((-1.0i) * wx) / (1.0i * xd + wx * xd))) / 12.0 + (pisqu * log((1.0i * wx) / (1.0i * xd + wx * xd))) / 6.0 + power_of<3>(log((1.0i * wx) / (1.0i * xd + wx * xd))) / 6.0 + (1.0i / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * power_of<2>(log((1.0i - xd) / wx)) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(log((1.0i - 1.0 / wx) * xd)) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(log((1.0i * (1.0i + wx) * xd) / wx)) * my_sign(imag(wx * xdinv))
-                + (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd))) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(-1.0i / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log((wx * (1.0 + 1.0i * xd)) / (-1.0i + wx))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (3.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1(1.0 + 1.0i * wx, (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log(-(xd / (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd)))
-                + (3.0 * 1.0i) * M_PI * H1((1.0 + 1.0i * wx) / 2.0, (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log((1.0i + xd) / (1.0i - wx))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - 1.0i * M_PI * H1(-1.0i / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log((1.0 + 1.0i * wx) / (1.0i * wx - wx * xd))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (1.0i / 2.0) * M_PI * H1(-1.0i / xd, -1.0i / wx) * power_of<2>(log(1.0i * (-wx + xd))) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(log((-1.0i + xd) / (-wx + xd))) * my_sign(real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, 1.0i * wx) * power_of<2>(log((1.0i + xd) / wx)) * my_sign(real(wx))
-                - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), -1.0i / (-1.0i + xd)) * power_of<2>(log((wx + 1.0i * wx * xd) / (1.0i - wx))) * my_sign(real(1.0 / (1.0i - xd))) + (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * 1.0i - 2.0 * wx))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) + (2.0 * 1.0i) * M_PI * H1(wx * xdinv, 1.0i / xd) * power_of<2>(log((1.0i + 1.0 / wx) * xd)) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((-0.5) * 1.0i) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
-                - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((1.0 + 1.0i * wx) * (1.0i + xd)) / (2.0 * (1.0i + wx)))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (1.0i / 2.0) * M_PI * power_of<2>(log((1.0i + xd) * xdinv)) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / (1.0i - wx))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) - 1.0i * M_PI * power_of<2>(log(wx / (-1.0i + wx))) * my_sign(real(1.0 / (-1.0i + wx))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) - (3.0 * 1.0i) * M_PI * power_of<2>(log((1.0i + wx) / (-1.0i + wx))) * my_sign(-2.0 * real(1.0 / (-1.0i + wx))) * T(1.0, (wx - xd) / (-1.0i + wx), (1.0i + wx) / (-1.0i + wx))
-                + power_of<2>(log((-1.0i) * xd)) * (log(-1.0i / (-1.0i + xd)) / 2.0 - log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) / 2.0 + log(1.0 - xd / wx) / 2.0 - log((wx + 1.0i * wx * xd) / (wx - xd)) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (wx - xd) / (-1.0i + wx), (-1.0i) * xd)) - (2.0 * 1.0i) * M_PI * power_of<2>(log(0.5 - (1.0i / 2.0) * wx)) * my_sign(real(wx) / 2.0) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(log(0.5 + (1.0i / 2.0) * wx)) * my_sign((-0.5) * real(wx)) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (4.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
-                + 1.0i * M_PI * power_of<2>(log(1.0 - 1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (4.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * log((-1.0i) * xd) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * log(xd) * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
-                + log((2.0 * 1.0i) / (1.0i + xd)) * ((-0.25) * power_of<2>(log(-1.0 - 1.0i * wx)) + power_of<2>(log(-1.0 + xd / wx)) / 4.0 + 1.0i * M_PI * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + (2.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i) * wx)) * my_sign(-real(wx)) * T(1.0, (-1.0i) * xd, (-1.0i) * wx) - ((3.0 * 1.0i) / 2.0) * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + log((1.0i + xd) / (1.0i + wx)) * (power_of<2>(log(1.0 - xd / wx)) / 2.0 + 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))
-                + 2.0 * pisqu * log((1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) + zeta3) + log(1.0 - 1.0i * xd) * ((-1.0 / 6.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 6.0 - (pisqu * lnm1) / 6.0 - power_of<3>(lnm1) / 6.0 + (lnm1 * ln2squ) / 2.0 + (pisqu * log(-1.0 + 1.0i / wx)) / 6.0 + power_of<3>(log(-1.0 + 1.0i / wx)) / 6.0 - (pisqu * log(-1.0 - 1.0i * wx)) / 4.0 - power_of<3>(log(-1.0 - 1.0i * wx)) / 4.0 - (log(0.5 + (1.0i / 2.0) * wx) * power_of<2>(log(1.0 - 1.0i * wx))) / 2.0 + (pisqu * log(1.0 + 1.0i * wx)) / 6.0 + (log(0.5 - (1.0i / 2.0) * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 + power_of<3>(log(1.0 + 1.0i * wx)) / 12.0 - (pisqu * log(((-0.5) * 1.0i) / wx)) / 12.0
-                - power_of<3>(log(((-0.5) * 1.0i) / wx)) / 12.0 + (pisqu * log(1.0i / 2.0 / wx)) / 12.0 + power_of<3>(log(1.0i / 2.0 / wx)) / 12.0 + (5.0 * pisqu * log(-1.0i / wx)) / 12.0 - (5.0 * power_of<2>(log(1.0 - 1.0i * wx)) * log(-1.0i / wx)) / 4.0 + (5.0 * power_of<3>(log(-1.0i / wx))) / 12.0 - (pisqu * log(1.0i / wx)) / 3.0 + power_of<2>(log(1.0 + 1.0i * wx)) * log(1.0i / wx) - power_of<3>(log(1.0i / wx)) / 3.0 + (pisqu * log((-2.0 * 1.0i) / wx)) / 2.0 + power_of<3>(log((-2.0 * 1.0i) / wx)) / 2.0 + (pisqu * log((2.0 * 1.0i) / wx)) / 3.0 + power_of<3>(log((2.0 * 1.0i) / wx)) / 3.0 - (pisqu * log((1.0i / 2.0) * wx)) / 6.0 - power_of<3>(log((1.0i / 2.0) * wx)) / 6.0 - (pisqu * log((-1.0i) * wx)) / 6.0 - power_of<3>(log((-1.0i) * wx)) / 6.0 + (pisqu * log(1.0i * wx)) / 2.0 + power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0i * wx) + (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0i * wx))) / 2.0
-                + power_of<3>(log(1.0i * wx)) / 2.0 - (pisqu * log((-2.0 * 1.0i) * wx)) / 12.0 - power_of<3>(log((-2.0 * 1.0i) * wx)) / 12.0 + (pisqu * log((2.0 * 1.0i) * wx)) / 12.0 + power_of<3>(log((2.0 * 1.0i) * wx)) / 12.0 - (pisqu * log(wx / (1.0i - wx))) / 12.0 - power_of<3>(log(wx / (1.0i - wx))) / 12.0 - (pisqu * log(-1.0i / (-1.0i + wx))) / 6.0 - power_of<3>(log(-1.0i / (-1.0i + wx))) / 6.0 + (3.0 * power_of<2>(log(1.0 - 1.0i * wx)) * log((-2.0 * 1.0i) / (-1.0i + wx))) / 4.0 - (pisqu * log(wx / (-1.0i + wx))) / 6.0 - power_of<2>(lnhalf) * log(wx / (-1.0i + wx)) - power_of<3>(log(wx / (-1.0i + wx))) / 6.0 + power_of<2>(lnhalf) * log((2.0 * wx) / (-1.0i + wx)) - (3.0 * power_of<2>(log(1.0 - 1.0i * wx)) * log((2.0 * wx) / (-1.0i + wx))) / 4.0 + power_of<2>(lnhalf) * log((-1.0i + wx) / (2.0 * wx))
-                + (power_of<2>(log(1.0 - 1.0i * wx)) * log((-1.0i + wx) / (2.0 * wx))) / 2.0 - power_of<2>(lnhalf) * log((-1.0i + wx) / wx) + (log((-1.0i) * wx) * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + (pisqu * log(-1.0i / (1.0i + wx))) / 12.0 + power_of<3>(log(-1.0i / (1.0i + wx))) / 12.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * 1.0i) / (1.0i + wx))) / 4.0 + (power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * 1.0i) / (1.0i + wx))) / 4.0 - (ln2squ * log((1.0i - wx) / (1.0i + wx))) / 4.0 + (pisqu * log(-(wx / (1.0i + wx)))) / 12.0 + power_of<3>(log(-(wx / (1.0i + wx)))) / 12.0 + (pisqu * log(wx / (1.0i + wx))) / 12.0 - power_of<2>(lnhalf) * log(wx / (1.0i + wx)) + power_of<3>(log(wx / (1.0i + wx))) / 12.0 + power_of<2>(lnhalf) * log((2.0 * wx) / (1.0i + wx))
-                + (power_of<2>(log(1.0 + 1.0i * wx)) * log((2.0 * wx) / (1.0i + wx))) / 4.0 - (power_of<2>(log((-1.0i + wx) / wx)) * log((2.0 * wx) / (1.0i + wx))) / 4.0 + (ln2squ * log((-1.0i + wx) / (1.0i + wx))) / 4.0 - (pisqu * log((2.0 * (-1.0i + wx)) / (1.0i + wx))) / 3.0 - power_of<3>(log((2.0 * (-1.0i + wx)) / (1.0i + wx))) / 3.0 + (ln2squ * log((1.0i + wx) / (1.0i - wx))) / 4.0 + power_of<2>(lnhalf) * log((1.0i + wx) / (2.0 * wx)) - (power_of<2>(log(1.0 + 1.0i * wx)) * log((1.0i + wx) / (2.0 * wx))) / 4.0 - power_of<2>(lnhalf) * log((1.0i + wx) / wx) + (log(0.5 + (1.0i / 2.0) * wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - (3.0 * log(1.0i * wx) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - log((-2.0 * 1.0i) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx))
-                + log((2.0 * wx) / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx)) - (log((-1.0i + wx) / (2.0 * wx)) * power_of<2>(log((1.0i + wx) / wx))) / 2.0 - (ln2squ * log((1.0i + wx) / (-1.0i + wx))) / 4.0 - (pisqu * log((2.0 * (1.0i + wx)) / (-1.0i + wx))) / 3.0 - power_of<3>(log((2.0 * (1.0i + wx)) / (-1.0i + wx))) / 3.0 + (pisqu * log(wx / (1.0i - xd))) / 12.0 + power_of<3>(log(wx / (1.0i - xd))) / 12.0 - (pisqu * log((-2.0 * 1.0i) / (wx - xd))) / 3.0 - power_of<3>(log((-2.0 * 1.0i) / (wx - xd))) / 3.0 - (pisqu * log((2.0 * 1.0i) / (wx - xd))) / 3.0 - power_of<3>(log((2.0 * 1.0i) / (wx - xd))) / 3.0 + (pisqu * log(-1.0i / xd)) / 4.0 + power_of<3>(log(-1.0i / xd)) / 4.0 - power_of<3>(log(wx * xdinv)) / 6.0 + (pisqu * log((1.0i * wx) / ((-1.0i + wx) * xd))) / 12.0
-                + power_of<3>(log((1.0i * wx) / ((-1.0i + wx) * xd))) / 12.0 + (pisqu * log((1.0i + wx) * xdinv)) / 3.0 + power_of<3>(log((1.0i + wx) * xdinv)) / 3.0 + (pisqu * log((-1.0i - 1.0 / wx) * xd)) / 12.0 + power_of<3>(log((-1.0i - 1.0 / wx) * xd)) / 12.0 - (pisqu * log((1.0i + 1.0 / wx) * xd)) / 12.0 - power_of<3>(log((1.0i + 1.0 / wx) * xd)) / 12.0 + (pisqu * log((-2.0 - (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 3.0 + power_of<3>(log((-2.0 - (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 3.0 - (pisqu * log((1.0i + wx) / (-1.0i + xd))) / 2.0 - power_of<3>(log((1.0i + wx) / (-1.0i + xd))) / 2.0 + ((-0.25) * power_of<2>(log(1.0 + 1.0i * wx)) + power_of<2>(log((-1.0i + wx) / wx)) / 4.0) * log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd)))
-                + power_of<2>(log(0.5 - (1.0i / 2.0) * xd)) * (-log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (wx - xd))) - log(((-2.0 * 1.0i) * (wx - xd)) / ((1.0i + wx) * (-1.0i + xd)))) - (pisqu * log(1.0i / (1.0i + xd))) / 6.0 - power_of<3>(log(1.0i / (1.0i + xd))) / 6.0 - (pisqu * log(wx / (1.0i + xd))) / 12.0 - power_of<3>(log(wx / (1.0i + xd))) / 12.0 + (pisqu * log((2.0 - (2.0 * 1.0i) * wx) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + power_of<3>(log((2.0 - (2.0 * 1.0i) * wx) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 - power_of<3>(log((1.0i + wx) / (1.0i + xd))) / 6.0 + (pisqu * log((1.0i * (1.0i + wx)) / (wx * (1.0i + xd)))) / 3.0 + power_of<3>(log((1.0i * (1.0i + wx)) / (wx * (1.0i + xd)))) / 3.0 + (pisqu * log(((2.0 * 1.0i) * (1.0i + wx)) / ((-1.0i + wx) * (1.0i + xd)))) / 3.0
-                + power_of<3>(log(((2.0 * 1.0i) * (1.0i + wx)) / ((-1.0i + wx) * (1.0i + xd)))) / 3.0 + (pisqu * log((1.0i + xd) / (1.0i + wx))) / 6.0 + power_of<3>(log((1.0i + xd) / (1.0i + wx))) / 6.0 - (pisqu * log((1.0i * wx * (1.0i + xd)) / (1.0i + wx))) / 6.0 - power_of<3>(log((1.0i * wx * (1.0i + xd)) / (1.0i + wx))) / 6.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((-1.0i + xd) / (-wx + xd))) / 4.0 + (power_of<2>(log(1.0 + 1.0i * wx)) / 4.0 - power_of<2>(log((-1.0i + wx) / wx)) / 4.0) * log((-wx + xd) / (-1.0i + xd)) + (pisqu * log(1.0 - xd / wx)) / 12.0 + (log(xd / wx) * power_of<2>(log(1.0 - xd / wx))) / 2.0 - (log((-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log(1.0 - xd / wx))) / 4.0 + (log(((-1.0i + wx) * xd) / (wx * (-1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 4.0
-                - (log((wx * (-1.0i + xd)) / ((-1.0i + wx) * xd)) * power_of<2>(log(1.0 - xd / wx))) / 2.0 - (log(((1.0i + wx) * xd) / (wx * (1.0i + xd))) * power_of<2>(log(1.0 - xd / wx))) / 4.0 + log((1.0i + wx) / (1.0i + xd)) * ((-1.0 / 6.0) * pisqu + power_of<2>(log(1.0 - xd / wx)) / 4.0) + log(wx * xdinv) * ((-1.0 / 6.0) * pisqu + power_of<2>(log(1.0 - xd / wx)) / 2.0) + (pisqu * log(-1.0 + xd / wx)) / 12.0 + power_of<3>(log(-1.0 + xd / wx)) / 12.0 + (pisqu * log((1.0i * wx) / (1.0i * xd - wx * xd))) / 6.0 + power_of<3>(log((1.0i * wx) / (1.0i * xd - wx * xd))) / 6.0 + (power_of<2>(log(1.0 + 1.0i * wx)) * log((wx + 1.0i * wx * xd) / (wx - xd))) / 4.0
-                + power_of<2>(log(1.0 + 1.0i * xd)) * ((-0.5) * log((1.0i * (wx - xd)) / ((-1.0i + wx) * xd)) - log(-((xd + 1.0i * wx * xd) / (wx - xd))) / 2.0) - (pisqu * log((1.0 - 1.0i * wx) / (1.0i * wx + wx * xd))) / 6.0 - power_of<3>(log((1.0 - 1.0i * wx) / (1.0i * wx + wx * xd))) / 6.0 - (pisqu * log(((-1.0i) * wx) / (1.0i * xd + wx * xd))) / 3.0 - power_of<3>(log(((-1.0i) * wx) / (1.0i * xd + wx * xd))) / 3.0 - ((3.0 * 1.0i) / 2.0) * M_PI * H1(1.0i / xd, wx * xdinv) * power_of<2>(log((-1.0i - 1.0 / wx) * xd)) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * power_of<2>(log(-((1.0i + xd) / wx))) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(log((wx * (1.0i + xd)) / ((1.0i + wx) * xd))) * my_sign(imag(wx * xdinv))
-                + (3.0 * 1.0i) * M_PI * H1(0.5 - (1.0i / 2.0) * wx, (1.0i + wx) / (1.0i + xd)) * power_of<2>(log((1.0i - xd) / (1.0i + wx))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (3.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1(1.0 - 1.0i * wx, (1.0i + wx) / (1.0i + xd)) * power_of<2>(log(-(xd / (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - 1.0i * M_PI * H1(1.0i / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(log((1.0i * (1.0i + wx)) / (wx * (1.0i + xd)))) * my_sign(imag((1.0i + wx) / (1.0i + xd)))
-                + 1.0i * M_PI * H1(1.0i / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(log((wx - 1.0i * wx * xd) / (1.0i + wx))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(log(-((1.0i + xd) / (wx - xd)))) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, (-1.0i) * wx) * power_of<2>(log((-1.0i + xd) / wx)) * my_sign(-real(wx)) + (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * 1.0i - 2.0 * wx))) * my_sign(2.0 * real(1.0 / (1.0i - xd)))
-                + (2.0 * 1.0i) * M_PI * H1(wx * xdinv, -1.0i / xd) * power_of<2>(log((-1.0i + 1.0 / wx) * xd)) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), 1.0i / (1.0i + xd)) * power_of<2>(log((1.0i * wx * (1.0i + xd)) / (1.0i + wx))) * my_sign(real(1.0 / (1.0i + xd))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), 1.0i / (1.0i + xd)) * power_of<2>(log(1.0i * (-wx + xd))) * my_sign(real(1.0 / (1.0i + xd))) + 1.0i * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((-0.5) * 1.0i) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((1.0 + 1.0i * wx) * (1.0i + xd)) / (2.0 * (1.0i + wx)))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
-                + 1.0i * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (-wx + xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (1.0i / 2.0) * M_PI * power_of<2>(log((-1.0i + xd) * xdinv)) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(log(wx / (1.0i + wx))) * my_sign(-real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) - 1.0i * M_PI * power_of<2>(log((1.0i + wx) / wx)) * my_sign(real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) - (3.0 * 1.0i) * M_PI * power_of<2>(log((-1.0i + wx) / (1.0i + wx))) * my_sign(2.0 * real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), (-1.0i + wx) / (1.0i + wx))
-                + power_of<2>(log(0.5 + (1.0i / 2.0) * xd)) * (-log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (wx - xd))) - log(((2.0 * 1.0i) * (wx - xd)) / ((-1.0i + wx) * (1.0i + xd))) + (3.0 * 1.0i) * M_PI * my_sign((-0.5) * real(xd)) * T(1.0, (wx - xd) / (1.0i + wx), 0.5 + (1.0i / 2.0) * xd)) + power_of<2>(log(1.0i * xd)) * (log(1.0i / (1.0i + xd)) / 2.0 - log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) / 2.0 + log(1.0 - xd / wx) / 2.0 - log((wx - 1.0i * wx * xd) / (wx - xd)) / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (wx - xd) / (1.0i + wx), 1.0i * xd)) - (2.0 * 1.0i) * M_PI * power_of<2>(log(0.5 - (1.0i / 2.0) * wx)) * my_sign(real(wx) / 2.0) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx)
-                - (2.0 * 1.0i) * M_PI * power_of<2>(log(0.5 + (1.0i / 2.0) * wx)) * my_sign((-0.5) * real(wx)) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (4.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * log(xd) * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + log(1.0i * xd) * (power_of<2>(log(-((1.0i + xd) * xdinv))) / 2.0 - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) - (1.0i / 2.0) * M_PI * power_of<2>(log(1.0 - xd / wx)) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)
-                + log((-2.0 * 1.0i) / (-1.0i + xd)) * ((-0.25) * power_of<2>(log(-1.0 + 1.0i * wx)) + power_of<2>(log(-1.0 + xd / wx)) / 4.0 + 1.0i * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + log(0.5 + (1.0i / 2.0) * xd) * ((-1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) - (4.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * log(1.0 + 1.0i * wx) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * power_of<2>(log(1.0 + 1.0i * wx)) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
-                + log(1.0 + 1.0i * xd) * ((4.0 * 1.0i) * M_PI * log(0.5 - (1.0i / 2.0) * wx) * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx) + (4.0 * 1.0i) * M_PI * log(0.5 + (1.0i / 2.0) * wx) * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (2.0 * 1.0i) * M_PI * log(1.0 - 1.0i * wx) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * log(1.0 + 1.0i * wx) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + (2.0 * 1.0i) * M_PI * power_of<2>(log(1.0i * wx)) * my_sign(real(wx)) * T(1.0, 1.0i * xd, 1.0i * wx) - ((3.0 * 1.0i) / 2.0) * M_PI * power_of<2>(log((-1.0i + wx) / wx)) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
-                + log((-1.0i + xd) / (-1.0i + wx)) * (power_of<2>(log(1.0 - xd / wx)) / 2.0 + 1.0i * M_PI * log(1.0 - xd / wx) * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + 2.0 * pisqu * log((-1.0i + wx) / wx) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + zeta3) + log(wx / (wx - xd)) * (power_of<2>(log(1.0i / wx)) * log((-1.0i + wx) / wx) + power_of<2>(log(-1.0i / wx)) * log((1.0i + wx) / wx) + (log(1.0 + 1.0i * xd) * power_of<2>(log((-1.0i) * xd))) / 2.0 + (log(1.0 - 1.0i * xd) * power_of<2>(log(1.0i * xd))) / 2.0 - (pisqu * log(1.0 - xd / wx)) / 3.0 + power_of<2>(log(xd / wx)) * log(1.0 - xd / wx)
-                + (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * power_of<2>(log((-1.0i + xd) / (-wx + xd))) * my_sign(-real(wx)) + (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * power_of<2>(log(-((1.0i + xd) / (wx - xd)))) * my_sign(real(wx)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * power_of<2>(log((1.0i * (1.0i + wx) * xd) / (wx - xd))) * my_sign(-real(xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * power_of<2>(log(-((xd + 1.0i * wx * xd) / (wx - xd)))) * my_sign(real(xdinv)) + 2.0 * zeta3)
-                + log(((-1.0i) * (wx - xd)) / (wx * (-1.0i + xd))) * ((-1.0 / 12.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 12.0 - (pisqu * log(-1.0 + 1.0i * wx)) / 12.0 - power_of<3>(log(-1.0 + 1.0i * wx)) / 12.0 + (pisqu * log(1.0 + 1.0i * wx)) / 3.0 + (power_of<2>(lnm2) * log(1.0 + 1.0i * wx)) / 4.0 + (power_of<2>(log(-1.0 + 1.0i * wx)) * log(1.0 + 1.0i * wx)) / 4.0 + (log(1.0 - 1.0i * wx) * power_of<2>(log(1.0 + 1.0i * wx))) / 4.0 + power_of<3>(log(1.0 + 1.0i * wx)) / 6.0 + (pisqu * log((-1.0i + wx) / wx)) / 3.0 + (lnhalf * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + (ln2 * power_of<2>(log((-1.0i + wx) / wx))) / 2.0 + power_of<3>(log((-1.0i + wx) / wx)) / 3.0 + (power_of<2>(log((-1.0i + wx) / wx)) * log(1.0i / (1.0i + wx))) / 2.0 - (power_of<2>(log(1.0 + 1.0i * wx)) * log((1.0i + wx) / wx)) / 4.0
-                + 3.0 * zeta3) + log((1.0i * (wx - xd)) / (wx * (1.0i + xd))) * ((-1.0 / 12.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 12.0 - (pisqu * log(-1.0 - 1.0i * wx)) / 12.0 - power_of<3>(log(-1.0 - 1.0i * wx)) / 12.0 + (pisqu * log(1.0 - 1.0i * wx)) / 3.0 + (power_of<2>(lnm2) * log(1.0 - 1.0i * wx)) / 4.0 + (power_of<2>(log(-1.0 - 1.0i * wx)) * log(1.0 - 1.0i * wx)) / 4.0 + power_of<3>(log(1.0 - 1.0i * wx)) / 6.0 + (power_of<2>(log(1.0 - 1.0i * wx)) * log(1.0 + 1.0i * wx)) / 4.0 - (power_of<2>(log(1.0 - 1.0i * wx)) * log((-1.0i + wx) / wx)) / 4.0 + (pisqu * log((1.0i + wx) / wx)) / 3.0 + (lnhalf * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (ln2 * power_of<2>(log((1.0i + wx) / wx))) / 2.0 + (log(-1.0i / (-1.0i + wx)) * power_of<2>(log((1.0i + wx) / wx))) / 2.0
-                + power_of<3>(log((1.0i + wx) / wx)) / 3.0 + 3.0 * zeta3);
+                + ln_28 * ((-1.0 / 6.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 6.0 - (pisqu * lnm1) / 6.0 - power_of<3>(lnm1) / 6.0 + (lnm1 * ln2squ) / 2.0 + (pisqu * ln_3) / 6.0 + (ln_82 * power_of<2>(ln_3)) / 4.0 + power_of<3>(ln_3) / 12.0 - (pisqu * ln_4) / 4.0 - power_of<3>(ln_4) / 4.0 - (ln_79 * power_of<2>(ln_5)) / 2.0 + (pisqu * ln_133) / 12.0 + power_of<3>(ln_133) / 12.0 - (pisqu * ln_134) / 12.0 - power_of<3>(ln_134) / 12.0 - (pisqu * ln_6) / 3.0 + power_of<2>(ln_3) * ln_6 - power_of<3>(ln_6) / 3.0
+                + (5.0 * pisqu * ln_7) / 12.0 - (5.0 * power_of<2>(ln_5) * ln_7) / 4.0 + (5.0 * power_of<3>(ln_7)) / 12.0 + (pisqu * ln_135) / 3.0 + power_of<3>(ln_135) / 3.0 + (pisqu * ln_136) / 2.0 + power_of<3>(ln_136) / 2.0 - (pisqu * log(((-0.5) * 1.0i) * wx)) / 6.0 - power_of<3>(log(((-0.5) * 1.0i) * wx)) / 6.0 + (pisqu * ln_8) / 2.0 + power_of<2>(ln_5) * ln_8 + (ln_5 * power_of<2>(ln_8)) / 2.0 + power_of<3>(ln_8) / 2.0 - (pisqu * ln_9) / 6.0 - power_of<3>(ln_9) / 6.0 + (pisqu * ln_137) / 12.0 + power_of<3>(ln_137) / 12.0 - (pisqu * ln_138) / 12.0 - power_of<3>(ln_138) / 12.0
+                + (pisqu * ln_139) / 12.0 + power_of<3>(ln_139) / 12.0 + (pisqu * ln_122) / 12.0 + power_of<3>(ln_122) / 12.0 - (power_of<2>(ln_3) * ln_83) / 4.0 + (pisqu * ln_12) / 12.0 - power_of<2>(lnhalf) * ln_12 + power_of<3>(ln_12) / 12.0 + power_of<2>(lnhalf) * ln_128 + (power_of<2>(ln_3) * ln_128) / 4.0 + power_of<2>(lnhalf) * ln_84 - (power_of<2>(ln_3) * ln_84) / 4.0 - power_of<2>(lnhalf) * ln_11 + (ln_79 * power_of<2>(ln_11)) / 2.0
+                - (3.0 * ln_8 * power_of<2>(ln_11)) / 2.0 - (pisqu * ln_13) / 6.0 - power_of<3>(ln_13) / 6.0 + (3.0 * power_of<2>(ln_5) * ln_80) / 4.0 - power_of<2>(ln_11) * ln_80 + (ln2squ * ln_120) / 4.0 - (pisqu * ln_14) / 12.0 - power_of<3>(ln_14) / 12.0 - (pisqu * ln_17) / 6.0 - power_of<2>(lnhalf) * ln_17 - power_of<3>(ln_17) / 6.0 + power_of<2>(lnhalf) * ln_127 - (3.0 * power_of<2>(ln_5) * ln_127) / 4.0 + power_of<2>(ln_11) * ln_127
+                - (ln2squ * ln_59) / 4.0 - (pisqu * ln_140) / 3.0 - power_of<3>(ln_140) / 3.0 - (ln2squ * ln_119) / 4.0 + (pisqu * ln_15) / 6.0 + power_of<3>(ln_15) / 6.0 + power_of<2>(lnhalf) * ln_81 + (power_of<2>(ln_5) * ln_81) / 2.0 - (power_of<2>(ln_11) * ln_81) / 2.0 - power_of<2>(lnhalf) * ln_16 + (ln_9 * power_of<2>(ln_16)) / 2.0 + (ln_83 * power_of<2>(ln_16)) / 4.0
+                - (ln_128 * power_of<2>(ln_16)) / 4.0 + (ln2squ * ln_87) / 4.0 - (pisqu * ln_141) / 3.0 - power_of<3>(ln_141) / 3.0 + (pisqu * ln_36) / 4.0 + power_of<3>(ln_36) / 4.0 - power_of<3>(ln_37) / 6.0 - (pisqu * ln_38) / 3.0 - power_of<3>(ln_38) / 3.0 + (pisqu * log((-1.0i + wx) * xdinv)) / 3.0 + power_of<3>(log((-1.0i + wx) * xdinv)) / 3.0 - (pisqu * ln_46) / 12.0 - power_of<3>(ln_46) / 12.0 + (pisqu * ln_48) / 12.0 + power_of<3>(ln_48) / 12.0
+                - (pisqu * ln_50) / 6.0 - power_of<3>(ln_50) / 6.0 - (pisqu * ln_51) / 6.0 - power_of<3>(ln_51) / 6.0 - (pisqu * ln_52) / 12.0 - power_of<3>(ln_52) / 12.0 - power_of<3>(ln_54) / 6.0 + (pisqu * ln_142) / 3.0 + power_of<3>(ln_142) / 3.0 + (pisqu * log((2.0 + (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0 + power_of<3>(log((2.0 + (2.0 * 1.0i) * wx) / ((1.0i + wx) * (-1.0i + xd)))) / 2.0 + (pisqu * ln_58) / 6.0 + power_of<3>(ln_58) / 6.0
+                + (pisqu * ln_98) / 12.0 + power_of<3>(ln_98) / 12.0 - (pisqu * ln_131) / 2.0 - power_of<3>(ln_131) / 2.0 + (pisqu * ln_143) / 3.0 + power_of<3>(ln_143) / 3.0 + ((-0.25) * power_of<2>(ln_3) + power_of<2>(ln_16) / 4.0) * ln_68 - (power_of<2>(ln_3) * ln_116) / 4.0 + (power_of<2>(ln_3) / 4.0 - power_of<2>(ln_16) / 4.0) * ln_93 + (pisqu * ln_94) / 12.0 + (ln_99 * power_of<2>(ln_94)) / 2.0
+                - (ln_56 * power_of<2>(ln_94)) / 4.0 - (ln_67 * power_of<2>(ln_94)) / 4.0 + (ln_71 * power_of<2>(ln_94)) / 4.0 - (ln_91 * power_of<2>(ln_94)) / 2.0 + ln_54 * ((-1.0 / 6.0) * pisqu + power_of<2>(ln_94) / 4.0) + ln_37 * ((-1.0 / 6.0) * pisqu + power_of<2>(ln_94) / 2.0) + (pisqu * ln_100) / 12.0 + power_of<3>(ln_100) / 12.0 + (pisqu * ln_114) / 3.0 + power_of<3>(ln_114) / 3.0
+                + (power_of<2>(ln_3) * ln_102) / 4.0 - (pisqu * ln_103) / 6.0 - power_of<3>(ln_103) / 6.0 + (pisqu * ln_107) / 12.0 + power_of<3>(ln_107) / 12.0 + (pisqu * ln_108) / 6.0 + power_of<3>(ln_108) / 6.0 + (1.0i / 2.0) * M_PI * H1((-1.0i) * wx, wx * xdinv) * power_of<2>(ln_113) * my_sign(imag(wx * xdinv)) - 1.0i * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(ln_111) * my_sign(imag(wx * xdinv)) - (1.0i / 2.0) * M_PI * H1(-1.0i / xd, wx * xdinv) * power_of<2>(ln_48) * my_sign(imag(wx * xdinv))
+                + (1.0i / 2.0) * M_PI * H2(wx * xdinv, 1.0i / xd) * power_of<2>(ln_63) * my_sign(imag(wx * xdinv)) + 1.0i * M_PI * H1(-1.0i / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log((wx * (1.0 + 1.0i * xd)) / (-1.0i + wx))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (3.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1(1.0 + 1.0i * wx, (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(log(-(xd / (-1.0i + wx)))) * my_sign(imag((-1.0i + wx) / (-1.0i + xd)))
+                + (3.0 * 1.0i) * M_PI * H1((1.0 + 1.0i * wx) / 2.0, (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(ln_130) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - 1.0i * M_PI * H1(-1.0i / (-1.0i + xd), (-1.0i + wx) / (-1.0i + xd)) * power_of<2>(ln_114) * my_sign(imag((-1.0i + wx) / (-1.0i + xd))) - (1.0i / 2.0) * M_PI * H1(-1.0i / xd, -1.0i / wx) * power_of<2>(log(1.0i * (-wx + xd))) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H2(1.0i / wx, 1.0i / xd) * power_of<2>(ln_117) * my_sign(real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, 1.0i * wx) * power_of<2>(ln_72) * my_sign(real(wx))
+                - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), -1.0i / (-1.0i + xd)) * power_of<2>(ln_103) * my_sign(real(1.0 / (1.0i - xd))) + (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * 1.0i - 2.0 * wx))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) + (2.0 * 1.0i) * M_PI * H1(wx * xdinv, 1.0i / xd) * power_of<2>(ln_47) * my_sign(real(xdinv)) + (2.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((-0.5) * 1.0i) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
+                - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((1.0 + 1.0i * wx) * (1.0i + xd)) / (2.0 * (1.0i + wx)))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (1.0i / 2.0) * M_PI * power_of<2>(ln_89) * my_sign(-real(xdinv)) * T(1.0, (1.0i + wx) / wx, (1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(ln_11) * my_sign(real(1.0 / (1.0i - wx))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) - 1.0i * M_PI * power_of<2>(ln_12) * my_sign(real(1.0 / (-1.0i + wx))) * T(1.0, (wx - xd) / (-1.0i + wx), wx / (-1.0i + wx)) - (3.0 * 1.0i) * M_PI * power_of<2>(ln_87) * my_sign(-2.0 * real(1.0 / (-1.0i + wx))) * T(1.0, (wx - xd) / (-1.0i + wx), (1.0i + wx) / (-1.0i + wx))
+                + power_of<2>(ln_42) * (ln_50 / 2.0 - ln_55 / 2.0 + ln_94 / 2.0 - ln_104 / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(-real(xd)) * T(1.0, (wx - xd) / (-1.0i + wx), (-1.0i) * xd)) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_79) * my_sign(real(wx) / 2.0) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_82) * my_sign((-0.5) * real(wx)) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (4.0 * 1.0i) * M_PI * ln_82 * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)
+                + 1.0i * M_PI * power_of<2>(ln_3) * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (4.0 * 1.0i) * M_PI * ln_79 * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * ln_42 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * ln_44 * my_sign(real(xdinv)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)
+                + ln_74 * ((-0.25) * power_of<2>(ln_2) + power_of<2>(ln_100) / 4.0 + 1.0i * M_PI * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) - 1.0i * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 - xd / wx)) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_8) * my_sign(-real(wx)) * T(1.0, (-1.0i) * xd, (-1.0i) * wx) - ((3.0 * 1.0i) / 2.0) * M_PI * power_of<2>(ln_16) * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (1.0i + wx) / wx) + ln_73 * (power_of<2>(ln_94) / 2.0 + 1.0i * M_PI * ln_94 * my_sign(-real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd))
+                + 2.0 * pisqu * ln_16 * T(1.0, 1.0 - xd / wx, 1.0 + 1.0i * xd) * T(p((-1.0i) * xd, 1.0 - xd / wx), 1.0 - xd / wx, (1.0i + wx) / wx) + zeta3) + ln_27 * ((-1.0 / 6.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 6.0 - (pisqu * lnm1) / 6.0 - power_of<3>(lnm1) / 6.0 + (lnm1 * ln2squ) / 2.0 + (pisqu * ln_1) / 6.0 + power_of<3>(ln_1) / 6.0 - (pisqu * ln_2) / 4.0 - power_of<3>(ln_2) / 4.0 - (ln_82 * power_of<2>(ln_3)) / 2.0 + (pisqu * ln_5) / 6.0 + (ln_79 * power_of<2>(ln_5)) / 4.0 + power_of<3>(ln_5) / 12.0 - (pisqu * ln_133) / 12.0
+                - power_of<3>(ln_133) / 12.0 + (pisqu * ln_134) / 12.0 + power_of<3>(ln_134) / 12.0 + (5.0 * pisqu * ln_6) / 12.0 - (5.0 * power_of<2>(ln_3) * ln_6) / 4.0 + (5.0 * power_of<3>(ln_6)) / 12.0 - (pisqu * ln_7) / 3.0 + power_of<2>(ln_5) * ln_7 - power_of<3>(ln_7) / 3.0 + (pisqu * ln_135) / 2.0 + power_of<3>(ln_135) / 2.0 + (pisqu * ln_136) / 3.0 + power_of<3>(ln_136) / 3.0 - (pisqu * log((1.0i / 2.0) * wx)) / 6.0 - power_of<3>(log((1.0i / 2.0) * wx)) / 6.0 - (pisqu * ln_8) / 6.0 - power_of<3>(ln_8) / 6.0 + (pisqu * ln_9) / 2.0 + power_of<2>(ln_3) * ln_9 + (ln_3 * power_of<2>(ln_9)) / 2.0
+                + power_of<3>(ln_9) / 2.0 - (pisqu * ln_137) / 12.0 - power_of<3>(ln_137) / 12.0 + (pisqu * ln_138) / 12.0 + power_of<3>(ln_138) / 12.0 - (pisqu * ln_139) / 12.0 - power_of<3>(ln_139) / 12.0 - (pisqu * ln_10) / 6.0 - power_of<3>(ln_10) / 6.0 + (3.0 * power_of<2>(ln_3) * ln_83) / 4.0 - (pisqu * ln_12) / 6.0 - power_of<2>(lnhalf) * ln_12 - power_of<3>(ln_12) / 6.0 + power_of<2>(lnhalf) * ln_128 - (3.0 * power_of<2>(ln_3) * ln_128) / 4.0 + power_of<2>(lnhalf) * ln_84
+                + (power_of<2>(ln_3) * ln_84) / 2.0 - power_of<2>(lnhalf) * ln_11 + (ln_8 * power_of<2>(ln_11)) / 2.0 + (pisqu * ln_124) / 12.0 + power_of<3>(ln_124) / 12.0 - (power_of<2>(ln_5) * ln_80) / 4.0 + (power_of<2>(ln_11) * ln_80) / 4.0 - (ln2squ * ln_120) / 4.0 + (pisqu * ln_14) / 12.0 + power_of<3>(ln_14) / 12.0 + (pisqu * ln_17) / 12.0 - power_of<2>(lnhalf) * ln_17 + power_of<3>(ln_17) / 12.0 + power_of<2>(lnhalf) * ln_127
+                + (power_of<2>(ln_5) * ln_127) / 4.0 - (power_of<2>(ln_11) * ln_127) / 4.0 + (ln2squ * ln_59) / 4.0 - (pisqu * ln_140) / 3.0 - power_of<3>(ln_140) / 3.0 + (ln2squ * ln_119) / 4.0 + power_of<2>(lnhalf) * ln_81 - (power_of<2>(ln_5) * ln_81) / 4.0 - power_of<2>(lnhalf) * ln_16 + (ln_82 * power_of<2>(ln_16)) / 2.0 - (3.0 * ln_9 * power_of<2>(ln_16)) / 2.0 - ln_83 * power_of<2>(ln_16)
+                + ln_128 * power_of<2>(ln_16) - (ln_84 * power_of<2>(ln_16)) / 2.0 - (ln2squ * ln_87) / 4.0 - (pisqu * ln_141) / 3.0 - power_of<3>(ln_141) / 3.0 + (pisqu * ln_95) / 12.0 + power_of<3>(ln_95) / 12.0 - (pisqu * ln_31) / 3.0 - power_of<3>(ln_31) / 3.0 - (pisqu * ln_32) / 3.0 - power_of<3>(ln_32) / 3.0 + (pisqu * ln_35) / 4.0 + power_of<3>(ln_35) / 4.0 - power_of<3>(ln_37) / 6.0 + (pisqu * ln_38) / 12.0
+                + power_of<3>(ln_38) / 12.0 + (pisqu * log((1.0i + wx) * xdinv)) / 3.0 + power_of<3>(log((1.0i + wx) * xdinv)) / 3.0 + (pisqu * ln_45) / 12.0 + power_of<3>(ln_45) / 12.0 - (pisqu * ln_47) / 12.0 - power_of<3>(ln_47) / 12.0 + (pisqu * ln_142) / 3.0 + power_of<3>(ln_142) / 3.0 - (pisqu * ln_132) / 2.0 - power_of<3>(ln_132) / 2.0 + ((-0.25) * power_of<2>(ln_5) + power_of<2>(ln_11) / 4.0) * ln_55
+                + power_of<2>(ln_25) * (-ln_66 - ln_125) - (pisqu * ln_64) / 6.0 - power_of<3>(ln_64) / 6.0 - (pisqu * ln_65) / 12.0 - power_of<3>(ln_65) / 12.0 + (pisqu * log((2.0 - (2.0 * 1.0i) * wx) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 + power_of<3>(log((2.0 - (2.0 * 1.0i) * wx) / ((-1.0i + wx) * (1.0i + xd)))) / 2.0 - power_of<3>(ln_67) / 6.0 + (pisqu * ln_115) / 3.0 + power_of<3>(ln_115) / 3.0 + (pisqu * ln_143) / 3.0
+                + power_of<3>(ln_143) / 3.0 + (pisqu * ln_73) / 6.0 + power_of<3>(ln_73) / 6.0 - (pisqu * ln_75) / 6.0 - power_of<3>(ln_75) / 6.0 - (power_of<2>(ln_5) * ln_117) / 4.0 + (power_of<2>(ln_5) / 4.0 - power_of<2>(ln_11) / 4.0) * ln_92 + (pisqu * ln_94) / 12.0 + (ln_99 * power_of<2>(ln_94)) / 2.0 - (ln_54 * power_of<2>(ln_94)) / 4.0 + (ln_56 * power_of<2>(ln_94)) / 4.0
+                - (ln_63 * power_of<2>(ln_94)) / 2.0 - (ln_71 * power_of<2>(ln_94)) / 4.0 + ln_67 * ((-1.0 / 6.0) * pisqu + power_of<2>(ln_94) / 4.0) + ln_37 * ((-1.0 / 6.0) * pisqu + power_of<2>(ln_94) / 2.0) + (pisqu * ln_100) / 12.0 + power_of<3>(ln_100) / 12.0 + (pisqu * ln_101) / 6.0 + power_of<3>(ln_101) / 6.0 + (power_of<2>(ln_5) * ln_104) / 4.0
+                + power_of<2>(ln_28) * ((-0.5) * ln_40 - ln_105 / 2.0) - (pisqu * ln_106) / 6.0 - power_of<3>(ln_106) / 6.0 - (pisqu * ln_107) / 3.0 - power_of<3>(ln_107) / 3.0 - ((3.0 * 1.0i) / 2.0) * M_PI * H1(1.0i / xd, wx * xdinv) * power_of<2>(ln_45) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H1(1.0i * wx, wx * xdinv) * power_of<2>(ln_112) * my_sign(imag(wx * xdinv)) + (1.0i / 2.0) * M_PI * H2(wx * xdinv, -1.0i / xd) * power_of<2>(ln_91) * my_sign(imag(wx * xdinv))
+                + (3.0 * 1.0i) * M_PI * H1(0.5 - (1.0i / 2.0) * wx, (1.0i + wx) / (1.0i + xd)) * power_of<2>(ln_129) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (3.0 * 1.0i) * M_PI * H1((2.0 * 1.0i) / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(log(((-1.0i + wx) * (1.0 - 1.0i * xd)) / (2.0 * (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1(1.0 - 1.0i * wx, (1.0i + wx) / (1.0i + xd)) * power_of<2>(log(-(xd / (1.0i + wx)))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - 1.0i * M_PI * H1(1.0i / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(ln_115) * my_sign(imag((1.0i + wx) / (1.0i + xd)))
+                + 1.0i * M_PI * H1(1.0i / (1.0i + xd), (1.0i + wx) / (1.0i + xd)) * power_of<2>(log((wx - 1.0i * wx * xd) / (1.0i + wx))) * my_sign(imag((1.0i + wx) / (1.0i + xd))) - (1.0i / 2.0) * M_PI * H2(-1.0i / wx, -1.0i / xd) * power_of<2>(ln_116) * my_sign(-real(1.0 / wx)) - (1.0i / 2.0) * M_PI * H1(wx * xdinv, (-1.0i) * wx) * power_of<2>(ln_57) * my_sign(-real(wx)) + (2.0 * 1.0i) * M_PI * H1((-2.0 * 1.0i) / (-1.0i + wx), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i - xd))) - (2.0 * 1.0i) * M_PI * H1((-1.0i + wx) / (-1.0i + xd), (-2.0 * 1.0i) / (-1.0i + xd)) * power_of<2>(log(((1.0i + wx) * (1.0 + 1.0i * xd)) / (2.0 * 1.0i - 2.0 * wx))) * my_sign(2.0 * real(1.0 / (1.0i - xd)))
+                + (2.0 * 1.0i) * M_PI * H1(wx * xdinv, -1.0i / xd) * power_of<2>(ln_46) * my_sign(-real(xdinv)) - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), 1.0i / (1.0i + xd)) * power_of<2>(ln_75) * my_sign(real(1.0 / (1.0i + xd))) + 1.0i * M_PI * H1(1.0i / (1.0i + wx), 1.0i / (1.0i + xd)) * power_of<2>(log(1.0i * (-wx + xd))) * my_sign(real(1.0 / (1.0i + xd))) + 1.0i * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((-0.5) * 1.0i) * (wx - xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (2.0 * 1.0i) * M_PI * H1((1.0i + wx) / (1.0i + xd), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log(((1.0 + 1.0i * wx) * (1.0i + xd)) / (2.0 * (1.0i + wx)))) * my_sign(2.0 * real(1.0 / (1.0i + xd)))
+                + 1.0i * M_PI * H1((2.0 * 1.0i) / (1.0i + wx), (2.0 * 1.0i) / (1.0i + xd)) * power_of<2>(log((1.0i / 2.0) * (-wx + xd))) * my_sign(2.0 * real(1.0 / (1.0i + xd))) - (1.0i / 2.0) * M_PI * power_of<2>(ln_62) * my_sign(real(xdinv)) * T(1.0, (-1.0i + wx) / wx, (-1.0i + xd) * xdinv) - 1.0i * M_PI * power_of<2>(ln_17) * my_sign(-real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) - 1.0i * M_PI * power_of<2>(ln_16) * my_sign(real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), wx / (1.0i + wx)) - (3.0 * 1.0i) * M_PI * power_of<2>(ln_59) * my_sign(2.0 * real(1.0 / (1.0i + wx))) * T(1.0, (wx - xd) / (1.0i + wx), (-1.0i + wx) / (1.0i + wx))
+                + power_of<2>(ln_26) * (-ln_53 - ln_69 + (3.0 * 1.0i) * M_PI * my_sign((-0.5) * real(xd)) * T(1.0, (wx - xd) / (1.0i + wx), 0.5 + (1.0i / 2.0) * xd)) + power_of<2>(ln_43) * (ln_64 / 2.0 - ln_68 / 2.0 + ln_94 / 2.0 - ln_102 / 2.0 + (2.0 * 1.0i) * M_PI * my_sign(real(xd)) * T(1.0, (wx - xd) / (1.0i + wx), 1.0i * xd)) - (2.0 * 1.0i) * M_PI * power_of<2>(ln_79) * my_sign(real(wx) / 2.0) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx)
+                - (2.0 * 1.0i) * M_PI * power_of<2>(ln_82) * my_sign((-0.5) * real(wx)) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (4.0 * 1.0i) * M_PI * ln_82 * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_3 * ln_44 * my_sign(-real(xdinv)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + ln_43 * (power_of<2>(ln_78) / 2.0 - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx)) - (1.0i / 2.0) * M_PI * power_of<2>(ln_94) * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)
+                + ln_60 * ((-0.25) * power_of<2>(ln_4) + power_of<2>(ln_100) / 4.0 + 1.0i * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - 1.0i * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) + ln_26 * ((-1.0i) * M_PI * ln_3 * my_sign(real(wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) + 1.0i * M_PI * ln_94 * my_sign(imag(xd / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - xd / wx)) - (4.0 * 1.0i) * M_PI * ln_79 * ln_5 * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx) + 1.0i * M_PI * power_of<2>(ln_5) * my_sign(-real(wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)
+                + ln_28 * ((4.0 * 1.0i) * M_PI * ln_79 * my_sign(2.0 * real(1.0 / (1.0i - xd))) * T(1.0, 0.5 - (1.0i / 2.0) * xd, 0.5 - (1.0i / 2.0) * wx) + (4.0 * 1.0i) * M_PI * ln_82 * my_sign(2.0 * real(1.0 / (1.0i + xd))) * T(1.0, 0.5 + (1.0i / 2.0) * xd, 0.5 + (1.0i / 2.0) * wx) - (2.0 * 1.0i) * M_PI * ln_3 * my_sign(-real(1.0 / wx)) * T(1.0, 1.0 - 1.0i * xd, 1.0 - 1.0i * wx) - (2.0 * 1.0i) * M_PI * ln_5 * my_sign(real(1.0 / wx)) * T(1.0, 1.0 + 1.0i * xd, 1.0 + 1.0i * wx)) + (2.0 * 1.0i) * M_PI * power_of<2>(ln_9) * my_sign(real(wx)) * T(1.0, 1.0i * xd, 1.0i * wx) - ((3.0 * 1.0i) / 2.0) * M_PI * power_of<2>(ln_11) * my_sign(real(1.0 / wx)) * T(1.0, 1.0 - xd / wx, (-1.0i + wx) / wx)
+                + ln_58 * (power_of<2>(ln_94) / 2.0 + 1.0i * M_PI * ln_94 * my_sign(real(xd)) * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd)) + 2.0 * pisqu * ln_11 * T(1.0, 1.0 - xd / wx, 1.0 - 1.0i * xd) * T(p(1.0i * xd, 1.0 - xd / wx), 1.0 - xd / wx, (-1.0i + wx) / wx) + zeta3) + ln_24 * (power_of<2>(ln_7) * ln_11 + power_of<2>(ln_6) * ln_16 + (ln_28 * power_of<2>(ln_42)) / 2.0 + (ln_27 * power_of<2>(ln_43)) / 2.0 - (pisqu * ln_94) / 3.0 + power_of<2>(ln_99) * ln_94
+                + (1.0i / 2.0) * M_PI * H2((-1.0i) * wx, wx * xdinv) * power_of<2>(ln_117) * my_sign(-real(wx)) + (1.0i / 2.0) * M_PI * H2(1.0i * wx, wx * xdinv) * power_of<2>(ln_116) * my_sign(real(wx)) + (1.0i / 2.0) * M_PI * H2(-1.0i / xd, wx * xdinv) * power_of<2>(ln_49) * my_sign(-real(xdinv)) + (1.0i / 2.0) * M_PI * H2(1.0i / xd, wx * xdinv) * power_of<2>(ln_105) * my_sign(real(xdinv)) + 2.0 * zeta3)
+                + ln_55 * ((-1.0 / 12.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 12.0 - (pisqu * ln_4) / 12.0 - power_of<3>(ln_4) / 12.0 + (pisqu * ln_5) / 3.0 + (power_of<2>(lnm2) * ln_5) / 4.0 + (power_of<2>(ln_4) * ln_5) / 4.0 + (ln_3 * power_of<2>(ln_5)) / 4.0 + power_of<3>(ln_5) / 6.0 + (pisqu * ln_11) / 3.0 + (lnhalf * power_of<2>(ln_11)) / 2.0 + (ln2 * power_of<2>(ln_11)) / 2.0 + power_of<3>(ln_11) / 3.0 + (power_of<2>(ln_11) * ln_13) / 2.0 - (power_of<2>(ln_5) * ln_16) / 4.0
+                + 3.0 * zeta3) + ln_68 * ((-1.0 / 12.0) * (pisqu * lnm2) - power_of<3>(lnm2) / 12.0 - (pisqu * ln_2) / 12.0 - power_of<3>(ln_2) / 12.0 + (pisqu * ln_3) / 3.0 + (power_of<2>(lnm2) * ln_3) / 4.0 + (power_of<2>(ln_2) * ln_3) / 4.0 + power_of<3>(ln_3) / 6.0 + (power_of<2>(ln_3) * ln_5) / 4.0 - (power_of<2>(ln_3) * ln_11) / 4.0 + (pisqu * ln_16) / 3.0 + (lnhalf * power_of<2>(ln_16)) / 2.0 + (ln2 * power_of<2>(ln_16)) / 2.0 + (ln_10 * power_of<2>(ln_16)) / 2.0
+                + power_of<3>(ln_16) / 3.0 + 3.0 * zeta3);
 
             return 4.0 * (part1 + part2 + part3 + part4 + part5 + part6 + part7 + part8);
         }
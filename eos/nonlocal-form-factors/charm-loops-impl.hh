@@ -22,6 +22,7 @@
 
 #include <eos/maths/complex.hh>
 #include <eos/maths/interpolation.hh>
+#include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 
@@ -53,6 +54,132 @@ namespace eos
         static const double wx3inv = wx4;
         static const double wx4inv = wx3;
 
+        // Constant GPL values appearing in the analytic F_1^(7,9) and F_2^(7,9)
+        // expressions: their arguments involve only numeric literals and the
+        // constant weights wx3 and wx4, so they are evaluated once here and
+        // shared across the translation units instead of being recomputed at
+        // every call
+        static const double c_ln_1 = std::log(8.0);
+        static const double c_ln_2 = std::log(32.0);
+        static const double c_ln_3 = std::log(128.0);
+        static const double c_ln_4 = std::log(16.0);
+        static const double c_ln_5 = std::log(512.0);
+        static const double c_ln_6 = std::log(4096.0);
+        static const complex<double> c_li2_1 = dilog(-1.0i / (-1.0i + wx3));
+        static const complex<double> c_li2_2 = dilog(1.0i / (1.0i + wx3));
+        static const complex<double> c_li2_3 = dilog(-1.0i / (-1.0i + wx4));
+        static const complex<double> c_li2_4 = dilog(1.0i / (1.0i + wx4));
+        static const complex<double> c_ln_7 = std::log(1.0 - 1.0i * wx3);
+        static const complex<double> c_ln_8 = std::log(1.0 + 1.0i * wx3);
+        static const complex<double> c_ln_9 = std::log(1.0 - 1.0i * wx4);
+        static const complex<double> c_ln_10 = std::log(1.0 + 1.0i * wx4);
+        static const complex<double> c_li2_5 = dilog(wx3 / (-1.0i + wx3));
+        static const complex<double> c_li2_6 = dilog(wx3 / (1.0i + wx3));
+        static const complex<double> c_li2_7 = dilog(wx4 / (-1.0i + wx4));
+        static const complex<double> c_li2_8 = dilog(wx4 / (1.0i + wx4));
+        static const complex<double> c_ln_11 = std::log((-1.0i + wx3) / wx3);
+        static const complex<double> c_ln_12 = std::log((1.0i + wx3) / wx3);
+        static const complex<double> c_ln_13 = std::log((-1.0i + wx4) / wx4);
+        static const complex<double> c_ln_14 = std::log((1.0i + wx4) / wx4);
+        static const double c_ln_15 = std::log(1024.0);
+        static const complex<double> c_li3_1 = trilog(-1.0i / wx3);
+        static const complex<double> c_li3_2 = trilog(1.0i / wx3);
+        static const complex<double> c_li3_3 = trilog(-1.0i / (-1.0i + wx3));
+        static const complex<double> c_li3_4 = trilog(wx3 / (-1.0i + wx3));
+        static const complex<double> c_li3_5 = trilog((-1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_li3_6 = trilog((-1.0i + wx3) / wx3);
+        static const complex<double> c_li3_7 = trilog(1.0i / (1.0i + wx3));
+        static const complex<double> c_li3_8 = trilog((1.0i - wx3) / (1.0i + wx3));
+        static const complex<double> c_li3_9 = trilog(wx3 / (1.0i + wx3));
+        static const complex<double> c_li3_10 = trilog((1.0i + wx3) / (1.0i - wx3));
+        static const complex<double> c_li3_11 = trilog((1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_li3_12 = trilog((1.0i + wx3) / wx3);
+        static const complex<double> c_li3_13 = trilog(-1.0i / wx4);
+        static const complex<double> c_li3_14 = trilog(1.0i / wx4);
+        static const complex<double> c_li3_15 = trilog(-1.0i / (-1.0i + wx4));
+        static const complex<double> c_li3_16 = trilog(wx4 / (-1.0i + wx4));
+        static const complex<double> c_li3_17 = trilog((-1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_li3_18 = trilog((-1.0i + wx4) / wx4);
+        static const complex<double> c_li3_19 = trilog(1.0i / (1.0i + wx4));
+        static const complex<double> c_li3_20 = trilog((1.0i - wx4) / (1.0i + wx4));
+        static const complex<double> c_li3_21 = trilog(wx4 / (1.0i + wx4));
+        static const complex<double> c_li3_22 = trilog((1.0i + wx4) / (1.0i - wx4));
+        static const complex<double> c_li3_23 = trilog((1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_li3_24 = trilog((1.0i + wx4) / wx4);
+        static const complex<double> c_li2_9 = dilog((-1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_li2_10 = dilog((1.0i - wx3) / (1.0i + wx3));
+        static const complex<double> c_li2_11 = dilog((1.0i + wx3) / (1.0i - wx3));
+        static const complex<double> c_li2_12 = dilog((1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_li2_13 = dilog((-1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_li2_14 = dilog((1.0i - wx4) / (1.0i + wx4));
+        static const complex<double> c_li2_15 = dilog((1.0i + wx4) / (1.0i - wx4));
+        static const complex<double> c_li2_16 = dilog((1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_ln_16 = std::log((-2.0 * 1.0i) / wx3);
+        static const complex<double> c_ln_17 = std::log((2.0 * 1.0i) / wx3);
+        static const complex<double> c_ln_18 = std::log(wx3 / (-1.0i + wx3));
+        static const complex<double> c_ln_19 = std::log((2.0 * wx3) / (-1.0i + wx3));
+        static const complex<double> c_ln_20 = std::log((-1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_ln_21 = std::log(wx3 / (1.0i + wx3));
+        static const complex<double> c_ln_22 = std::log((2.0 * wx3) / (1.0i + wx3));
+        static const complex<double> c_ln_23 = std::log((2.0 * (-1.0i + wx3)) / (1.0i + wx3));
+        static const complex<double> c_ln_24 = std::log((1.0i + wx3) / (2.0 * wx3));
+        static const complex<double> c_ln_25 = std::log((2.0 * (1.0i + wx3)) / (-1.0i + wx3));
+        static const complex<double> c_ln_26 = std::log((-2.0 * 1.0i) / wx4);
+        static const complex<double> c_ln_27 = std::log((2.0 * 1.0i) / wx4);
+        static const complex<double> c_ln_28 = std::log(wx4 / (-1.0i + wx4));
+        static const complex<double> c_ln_29 = std::log((2.0 * wx4) / (-1.0i + wx4));
+        static const complex<double> c_ln_30 = std::log((-1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_ln_31 = std::log(wx4 / (1.0i + wx4));
+        static const complex<double> c_ln_32 = std::log((2.0 * wx4) / (1.0i + wx4));
+        static const complex<double> c_ln_33 = std::log((2.0 * (-1.0i + wx4)) / (1.0i + wx4));
+        static const complex<double> c_ln_34 = std::log((1.0i + wx4) / (2.0 * wx4));
+        static const complex<double> c_ln_35 = std::log((2.0 * (1.0i + wx4)) / (-1.0i + wx4));
+        static const complex<double> c_li2_17 = dilog(-1.0i / wx3);
+        static const complex<double> c_li2_18 = dilog(1.0i / wx3);
+        static const complex<double> c_li2_19 = dilog(-1.0i / wx4);
+        static const complex<double> c_li2_20 = dilog(1.0i / wx4);
+        static const complex<double> c_li2_21 = dilog((-2.0 * 1.0i) / (-1.0i + wx3));
+        static const complex<double> c_li2_22 = dilog((2.0 * 1.0i) / (1.0i + wx3));
+        static const complex<double> c_li2_23 = dilog((-2.0 * 1.0i) / (-1.0i + wx4));
+        static const complex<double> c_li2_24 = dilog((2.0 * 1.0i) / (1.0i + wx4));
+        static const complex<double> c_ln_36 = std::log(1.0 / 2.0 - (1.0i / 2.0) * wx3);
+        static const complex<double> c_ln_37 = std::log(1.0 / 2.0 + (1.0i / 2.0) * wx3);
+        static const complex<double> c_ln_38 = std::log(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4));
+        static const complex<double> c_ln_39 = std::log(1.0 / 2.0 + (1.0i / 2.0) * wx4);
+        static const complex<double> c_ln_40 = std::log(1.0 / 2.0 - (1.0i / 2.0) * wx4);
+        static const complex<double> c_li2_25 = dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx3));
+        static const complex<double> c_li2_26 = dilog(1.0 / 2.0 + (1.0i / 2.0) * wx3);
+        static const complex<double> c_li2_27 = dilog(((-1.0 / 2.0) * 1.0i) * (1.0i + wx4));
+        static const complex<double> c_li2_28 = dilog(1.0 / 2.0 + (1.0i / 2.0) * wx4);
+        static const double c_ln_41 = std::log(2048.0);
+        static const double c_ln_42 = std::log(8192.0);
+        static const complex<double> c_ln_43 = std::log(-1.0i);
+        static const complex<double> c_ln_44 = std::log(1.0i);
+        static const complex<double> c_li3_25 = trilog(-1.0);
+        static const complex<double> c_li2_29 = dilog(-1.0);
+        static const complex<double> c_li2_30 = dilog(1.0 / 2.0 - (1.0i / 2.0) * wx3);
+        static const complex<double> c_li2_31 = dilog(1.0 / 2.0 - (1.0i / 2.0) * wx4);
+        static const complex<double> c_li3_26 = trilog(1.0 - 1.0i * wx3);
+        static const complex<double> c_li3_27 = trilog(1.0 + 1.0i * wx3);
+        static const complex<double> c_li3_28 = trilog(1.0 - 1.0i * wx4);
+        static const complex<double> c_li3_29 = trilog(1.0 + 1.0i * wx4);
+        static const complex<double> c_ln_45 = std::log(-1.0i / (-1.0i + wx3));
+        static const complex<double> c_ln_46 = std::log(1.0i / (1.0i + wx3));
+        static const complex<double> c_ln_47 = std::log(-1.0i / (-1.0i + wx4));
+        static const complex<double> c_ln_48 = std::log(1.0i / (1.0i + wx4));
+        static const complex<double> c_ln_49 = std::log(-1.0i / (1.0i + wx3));
+        static const complex<double> c_ln_50 = std::log(1.0i / (-1.0i + wx3));
+        static const complex<double> c_ln_51 = std::log(-1.0i / (1.0i + wx4));
+        static const complex<double> c_ln_52 = std::log(1.0i / (-1.0i + wx4));
+        static const complex<double> c_ln_53 = std::log((-2.0 * 1.0i) / (-1.0i + wx3));
+        static const complex<double> c_ln_54 = std::log((2.0 * 1.0i) / (1.0i + wx3));
+        static const complex<double> c_ln_55 = std::log((-2.0 * 1.0i) / (-1.0i + wx4));
+        static const complex<double> c_ln_56 = std::log((2.0 * 1.0i) / (1.0i + wx4));
+        static const complex<double> c_li2_32 = dilog((-1.0i + wx3) / (1.0i + wx3));
+        static const complex<double> c_li2_33 = dilog((1.0i + wx3) / (-1.0i + wx3));
+        static const complex<double> c_li2_34 = dilog((-1.0i + wx4) / (1.0i + wx4));
+        static const complex<double> c_li2_35 = dilog((1.0i + wx4) / (-1.0i + wx4));
+
         struct CharmLoopsParameters
         {
             double muhat;
@@ -21,6 +21,7 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/complex-batch.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/nonlocal-form-factors/charm-loops-impl.hh>
@@ -34,6 +35,7 @@
 #include <cmath>
 #include <complex>
 #include <cstring>
+#include <limits>
 #include <vector>
 
 #include <gsl/gsl_spline.h>
@@ -334,172 +336,209 @@ namespace eos
     }
 
     /* Two-Loop functions for charm-quark loops */
-    // cf. [AAGW2001], Eq. (56), p. 20
-    complex<double>
-    CharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c)
+    namespace impl
     {
-        // cf. [ABGW2001], Appendix B, pp. 34-38
-        static double kap1700[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-1.14266, -0.517135}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-2.20356, 1.59186}, {-5.21743, 1.86168}, {0.592593, 3.72337}, {0.395062, 0}, {0, 0}},
-            {{1.86366, -3.06235}, {-4.66347, 0}, {0, 3.72337}, {0.395062, 0}, {0, 0}},
-            {{-1.21131, 2.89595}, {2.99588, -2.48225}, {-4.14815, 0}, {0, 0}, {0, 0}}
-        };
-
-        static double kap1710[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-2.07503, 1.39626}, {-0.444444, 0.930842}, {0, 0}, {0, 0}, {0, 0}},
-            {{-25.9259, 5.78065}, {-3.40101, 13.0318}, {-4.4917, 3.72337}, {0.395062, 0}, {-0.395062, 0}},
-            {{11.4229, -15.2375}, {-34.0806, 11.1701}, {10.3704, 18.6168}, {2.37037, 0}, {0, 0}},
-            {{11.7509, 15.6984}, {18.9564, -24.8225}, {-14.6173, 0}, {0, 0}, {0, 0}}
+        /*
+         * Coefficients of the small-s expansion of a massive two-loop function,
+         *
+         *     F(s_hat) = sum_k (a[k] + b[k] * log(s_hat)) * s_hat^k,    k = 0 ... 3,
+         *
+         * at fixed values of (mu, m_b, m_q). Assembling the coefficients from the
+         * tables of [ABGW2001] is expensive, whereas evaluating the expansion at a
+         * given point in s_hat is cheap. Likelihood evaluations probe the two-loop
+         * functions at many q^2 points for one and the same set of masses; each
+         * function therefore caches its most recent set of coefficients per thread.
+         */
+        struct CharmLoopsExpansion
+        {
+            // arguments for which the coefficients have been assembled
+            double mu  = std::numeric_limits<double>::quiet_NaN();
+            double m_b = 0.0;
+            double m_q = 0.0;
+
+            complex<double> a[4];
+            complex<double> b[4];
+
+            bool
+            matches(const double & mu, const double & m_b, const double & m_q) const
+            {
+                return (this->mu == mu) && (this->m_b == m_b) && (this->m_q == m_q);
+            }
+
+            complex<double>
+            evaluate(const double & s_hat, const complex<double> & log_s_hat) const
+            {
+                complex<double> result = a[3] + b[3] * log_s_hat;
+                for (int k = 2 ; k >= 0 ; k--)
+                {
+                    result = result * s_hat + a[k] + b[k] * log_s_hat;
+                }
+
+                return result;
+            }
         };
 
-        static double kap1711[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{1.03704, 0.930842}, {0.592593, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-4.66347, 0}, {0, 7.44674}, {2.37037, 0}, {0, 0}, {0, 0}},
-            {{6.73754, 1.86168}, {1.18519, -7.44674}, {-2.37037, 0}, {0, 0}, {0, 0}}
-        };
+        // cf. [AAGW2001], Eq. (56), p. 20
+        CharmLoopsExpansion
+        f17_expansion(const double & mu, const double & m_b, const double & m_c)
+        {
+            // cf. [ABGW2001], Appendix B, pp. 34-38
+            static double kap1700[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-1.14266, -0.517135}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-2.20356, 1.59186}, {-5.21743, 1.86168}, {0.592593, 3.72337}, {0.395062, 0}, {0, 0}},
+                {{1.86366, -3.06235}, {-4.66347, 0}, {0, 3.72337}, {0.395062, 0}, {0, 0}},
+                {{-1.21131, 2.89595}, {2.99588, -2.48225}, {-4.14815, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap1720[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.00555556, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-19.4691, 1.59019}, {-11.6779, 0.930842}, {-2.96296, 0}, {-0.395062, 0}, {0, 0}},
-            {{-90.4953, 14.7788}, {14.9329, 22.3402}, {-24.438, 3.72337}, {1.18519, 0}, {-1.18519, 0}},
-            {{23.8816, -32.8021}, {-82.7915, 39.0954}, {32.2963, 44.6804}, {5.92593, 0}, {0, 0}},
-            {{38.1415, 34.8683}, {38.6436, -80.673}, {-41.5802, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap1710[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-2.07503, 1.39626}, {-0.444444, 0.930842}, {0, 0}, {0, 0}, {0, 0}},
+                {{-25.9259, 5.78065}, {-3.40101, 13.0318}, {-4.4917, 3.72337}, {0.395062, 0}, {-0.395062, 0}},
+                {{11.4229, -15.2375}, {-34.0806, 11.1701}, {10.3704, 18.6168}, {2.37037, 0}, {0, 0}},
+                {{11.7509, 15.6984}, {18.9564, -24.8225}, {-14.6173, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap1721[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{2.37037, 1.86168}, {1.18519, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-13.9904, 3.72337}, {2.37037, 22.3402}, {7.11111, 0}, {0, 0}, {0, 0}},
-            {{27.5428, 3.72337}, {2.37037, -29.787}, {-9.48148, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap1711[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{1.03704, 0.930842}, {0.592593, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-4.66347, 0}, {0, 7.44674}, {2.37037, 0}, {0, 0}, {0, 0}},
+                {{6.73754, 1.86168}, {1.18519, -7.44674}, {-2.37037, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap1730[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.00010778, 0.00258567}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.946811, -0.0258567}, {0.488889, 0}, {0.0987654, 0}, {0, 0}, {0, 0}},
-            {{-41.9952, 1.63673}, {-30.2091, 0.930842}, {-6.22222, 0}, {-1.18519, 0}, {0, 0}},
-            {{-189.354, 25.8196}, {42.6566, 31.0281}, {-57.765, 3.72337}, {2.76543, 0}, {-2.37037, 0}},
-            {{45.1784, -52.4207}, {-145.181, 88.7403}, {70.9136, 81.9141}, {11.0617, 0}, {0, 0}},
-            {{77.3602, 54.2499}, {58.4491, -184.927}, {-96.0988, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap1720[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.00555556, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-19.4691, 1.59019}, {-11.6779, 0.930842}, {-2.96296, 0}, {-0.395062, 0}, {0, 0}},
+                {{-90.4953, 14.7788}, {14.9329, 22.3402}, {-24.438, 3.72337}, {1.18519, 0}, {-1.18519, 0}},
+                {{23.8816, -32.8021}, {-82.7915, 39.0954}, {32.2963, 44.6804}, {5.92593, 0}, {0, 0}},
+                {{38.1415, 34.8683}, {38.6436, -80.673}, {-41.5802, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap1731[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{3.85185, 2.79253}, {1.77778, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-27.3882, 13.0318}, {8.2963, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}},
-            {{69.4495, 1.86168}, {1.18519, -74.4674}, {-23.7037, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap1721[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{2.37037, 1.86168}, {1.18519, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-13.9904, 3.72337}, {2.37037, 22.3402}, {7.11111, 0}, {0, 0}, {0, 0}},
+                {{27.5428, 3.72337}, {2.37037, -29.787}, {-9.48148, 0}, {0, 0}, {0, 0}}
+            };
 
-        double m_c_hat = m_c / m_b, z = power_of<2>(m_c_hat);
-        double s_hat = s / power_of<2>(m_b);
+            static double kap1730[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.00010778, 0.00258567}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.946811, -0.0258567}, {0.488889, 0}, {0.0987654, 0}, {0, 0}, {0, 0}},
+                {{-41.9952, 1.63673}, {-30.2091, 0.930842}, {-6.22222, 0}, {-1.18519, 0}, {0, 0}},
+                {{-189.354, 25.8196}, {42.6566, 31.0281}, {-57.765, 3.72337}, {2.76543, 0}, {-2.37037, 0}},
+                {{45.1784, -52.4207}, {-145.181, 88.7403}, {70.9136, 81.9141}, {11.0617, 0}, {0, 0}},
+                {{77.3602, 54.2499}, {58.4491, -184.927}, {-96.0988, 0}, {0, 0}, {0, 0}}
+            };
 
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.0 < s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F17_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
+            static double kap1731[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{3.85185, 2.79253}, {1.77778, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-27.3882, 13.0318}, {8.2963, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}},
+                {{69.4495, 1.86168}, {1.18519, -74.4674}, {-23.7037, 0}, {0, 0}, {0, 0}}
+            };
 
-        const double rho17[4] = {
-            1.94955 * power_of<3>(m_c_hat), 11.6973 * m_c_hat, 70.1839 * m_c_hat, -3.8991 / m_c_hat + 159.863 * m_c_hat
-        };
+            double m_c_hat = m_c / m_b, z = power_of<2>(m_c_hat);
 
-        // real part
-        complex<double> r = -208.0 / 243.0 * log(mu / m_b);
+            const double rho17[4] = {
+                1.94955 * power_of<3>(m_c_hat), 11.6973 * m_c_hat, 70.1839 * m_c_hat, -3.8991 / m_c_hat + 159.863 * m_c_hat
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 4 ; m++)
-                r = r + kap1700[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
+            // real part
+            double ar[4] = { -208.0 / 243.0 * log(mu / m_b), 0.0, 0.0, 0.0 };
+            double br[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1710[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 4 ; m++)
+                    ar[0] += kap1700[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1711[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[1] += kap1710[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 2 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1720[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[1] += kap1711[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1721[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 2 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[2] += kap1720[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1730[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[2] += kap1721[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1731[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[3] += kap1730[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 0 ; l < 4; l++)
-            r = r + rho17[l] * pow(s_hat, l);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[3] += kap1731[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        // imaginary part
-        complex<double> i = 0.0;
+            for (int l = 0 ; l < 4; l++)
+                ar[l] += rho17[l];
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1700[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
+            // imaginary part
+            double ai[4] = { 0.0, 0.0, 0.0, 0.0 };
+            double bi[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1710[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[0] += kap1700[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1711[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[1] += kap1710[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1720[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[1] += kap1711[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1721[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[2] += kap1720[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1730[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[2] += kap1721[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1731[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[3] += kap1730[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[3] += kap1731[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
+
+            CharmLoopsExpansion result;
+            result.mu = mu;
+            result.m_b = m_b;
+            result.m_q = m_c;
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                result.a[k] = complex<double>(ar[k], ai[k]);
+                result.b[k] = complex<double>(br[k], bi[k]);
+            }
 
-        return r + complex<double>(0.0, 1.0) * i;
-    }
+            return result;
+        }
 
-    namespace impl
-    {
         complex<double> f27_0(const double & mu, const double & m_b, const double & m_q)
         {
             static long double kap2700[7][5][2] = {
@@ -534,556 +573,659 @@ namespace eos
 
             return complex<double>(r, i);
         }
-    }
 
-    // cf. [AAGW2001], Eq. (56), p. 20
-    complex<double>
-    CharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
-    {
-        // cf. [ABGW2001], Appendix B, pp. 34-38
-        static double kap2700[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{6.85597, 3.10281}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{13.2214, -9.55118}, {31.3046, -11.1701}, {-3.55556, -22.3402}, {-2.37037, 0}, {0, 0}},
-            {{-11.182, 18.3741}, {27.9808, 0}, {0, -22.3402}, {-2.37037, 0}, {0, 0}},
-            {{7.26787, -17.3757}, {-17.9753, 14.8935}, {24.8889, 0}, {0, 0}, {0, 0}}
-        };
+        // cf. [AAGW2001], Eq. (56), p. 20
+        CharmLoopsExpansion
+        f27_expansion(const double & mu, const double & m_b, const double & m_q)
+        {
+            // cf. [ABGW2001], Appendix B, pp. 34-38
+            static double kap2700[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{6.85597, 3.10281}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{13.2214, -9.55118}, {31.3046, -11.1701}, {-3.55556, -22.3402}, {-2.37037, 0}, {0, 0}},
+                {{-11.182, 18.3741}, {27.9808, 0}, {0, -22.3402}, {-2.37037, 0}, {0, 0}},
+                {{7.26787, -17.3757}, {-17.9753, 14.8935}, {24.8889, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2710[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{12.4502, -8.37758}, {2.66667, -5.58505}, {0, 0}, {0, 0}, {0, 0}},
-            {{155.555, -34.6839}, {20.4061, -78.1908}, {26.9502, -22.3402}, {-2.37037, 0}, {2.37037, 0}},
-            {{-68.5374, 91.4251}, {204.484, -67.0206}, {-62.2222, -111.701}, {-14.2222, 0}, {0, 0}},
-            {{-70.5057, -94.1903}, {-113.738, 148.935}, {87.7037, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2710[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{12.4502, -8.37758}, {2.66667, -5.58505}, {0, 0}, {0, 0}, {0, 0}},
+                {{155.555, -34.6839}, {20.4061, -78.1908}, {26.9502, -22.3402}, {-2.37037, 0}, {2.37037, 0}},
+                {{-68.5374, 91.4251}, {204.484, -67.0206}, {-62.2222, -111.701}, {-14.2222, 0}, {0, 0}},
+                {{-70.5057, -94.1903}, {-113.738, 148.935}, {87.7037, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2711[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-6.22222, -5.58505}, {-3.55556, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{27.9808, 0}, {0, -44.6804}, {-14.2222, 0}, {0, 0}, {0, 0}},
-            {{-40.4253, -11.1701}, {-7.11111, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2711[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-6.22222, -5.58505}, {-3.55556, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{27.9808, 0}, {0, -44.6804}, {-14.2222, 0}, {0, 0}, {0, 0}},
+                {{-40.4253, -11.1701}, {-7.11111, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2720[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0333333, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{116.815, -9.54113}, {70.0677, -5.58505}, {17.7778, 0}, {2.37037, 0}, {0, 0}},
-            {{542.972, -88.6728}, {-89.5971, -134.041}, {146.628, -22.3402}, {-7.11111, 0}, {7.11111, 0}},
-            {{-143.29, 196.813}, {496.749, -234.572}, {-193.778, -268.083}, {-35.5556, 0}, {0, 0}},
-            {{-228.849, -209.21}, {-231.862, 484.038}, {249.481, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2720[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0333333, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{116.815, -9.54113}, {70.0677, -5.58505}, {17.7778, 0}, {2.37037, 0}, {0, 0}},
+                {{542.972, -88.6728}, {-89.5971, -134.041}, {146.628, -22.3402}, {-7.11111, 0}, {7.11111, 0}},
+                {{-143.29, 196.813}, {496.749, -234.572}, {-193.778, -268.083}, {-35.5556, 0}, {0, 0}},
+                {{-228.849, -209.21}, {-231.862, 484.038}, {249.481, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2721[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-14.2222, -11.1701}, {-7.11111, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{83.9424, -22.3402}, {-14.2222, -134.041}, {-42.6667, 0}, {0, 0}, {0, 0}},
-            {{-165.257, -22.3402}, {-14.2222, 178.722}, {56.8889, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2721[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-14.2222, -11.1701}, {-7.11111, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{83.9424, -22.3402}, {-14.2222, -134.041}, {-42.6667, 0}, {0, 0}, {0, 0}},
+                {{-165.257, -22.3402}, {-14.2222, 178.722}, {56.8889, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2730[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.000646678, -0.015514}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-5.68087, 0.15514}, {-2.93333, 0}, {-0.592593, 0}, {0, 0}, {0, 0}},
-            {{251.971, -9.82039}, {181.255, -5.58505}, {37.3333, 0}, {7.11111, 0}, {0, 0}},
-            {{1136.13, -154.918}, {-255.94, -186.168}, {346.59, -22.3402}, {-16.5926, 0}, {14.2222, 0}},
-            {{-271.07, 314.524}, {871.089, -532.442}, {-425.481, -491.485}, {-66.3704, 0}, {0, 0}},
-            {{-464.161, -325.499}, {-350.695, 1109.56}, {576.593, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2730[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.000646678, -0.015514}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-5.68087, 0.15514}, {-2.93333, 0}, {-0.592593, 0}, {0, 0}, {0, 0}},
+                {{251.971, -9.82039}, {181.255, -5.58505}, {37.3333, 0}, {7.11111, 0}, {0, 0}},
+                {{1136.13, -154.918}, {-255.94, -186.168}, {346.59, -22.3402}, {-16.5926, 0}, {14.2222, 0}},
+                {{-271.07, 314.524}, {871.089, -532.442}, {-425.481, -491.485}, {-66.3704, 0}, {0, 0}},
+                {{-464.161, -325.499}, {-350.695, 1109.56}, {576.593, 0}, {0, 0}, {0, 0}}
+            };
 
-        static double kap2731[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-23.1111, -16.7552}, {-10.6667, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{164.329, -78.1908}, {-49.7778, -268.083}, {-85.3333, 0}, {0, 0}, {0, 0}},
-            {{-416.697, -11.1701}, {-7.11111, 446.804}, {142.222, 0}, {0, 0}, {0, 0}}
-        };
+            static double kap2731[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-23.1111, -16.7552}, {-10.6667, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{164.329, -78.1908}, {-49.7778, -268.083}, {-85.3333, 0}, {0, 0}, {0, 0}},
+                {{-416.697, -11.1701}, {-7.11111, 446.804}, {142.222, 0}, {0, 0}, {0, 0}}
+            };
 
-        double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
+            double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
 
-        const double rho27[4] = {
-            -11.6973 * power_of<3>(m_q_hat), -70.1839 * m_q_hat, -421.103 * m_q_hat, 23.3946 / m_q_hat - 959.179 * m_q_hat
-        };
+            const double rho27[4] = {
+                -11.6973 * power_of<3>(m_q_hat), -70.1839 * m_q_hat, -421.103 * m_q_hat, 23.3946 / m_q_hat - 959.179 * m_q_hat
+            };
 
-        if (s_hat == 0)
-        {
-            return impl::f27_0(mu, m_b, m_q);
-        }
+            // real part
+            double ar[4] = { 416.0 / 81.0 * log(mu / m_b), 0.0, 0.0, 0.0 };
+            double br[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.0 < s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F27_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 4 ; m++)
+                    ar[0] += kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[1] += kap2710[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[1] += kap2711[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 2 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[2] += kap2720[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[2] += kap2721[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[3] += kap2730[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[3] += kap2731[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 0 ; l < 4; l++)
+                ar[l] += rho27[l];
+
+            // imaginary part
+            double ai[4] = { 0.0, 0.0, 0.0, 0.0 };
+            double bi[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[0] += kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[1] += kap2710[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[1] += kap2711[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[2] += kap2720[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[2] += kap2721[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[3] += kap2730[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[3] += kap2731[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            CharmLoopsExpansion result;
+            result.mu = mu;
+            result.m_b = m_b;
+            result.m_q = m_q;
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                result.a[k] = complex<double>(ar[k], ai[k]);
+                result.b[k] = complex<double>(br[k], bi[k]);
+            }
+
+            return result;
         }
 
-        // real part
-        complex<double> r = 416.0 / 81.0 * log(mu / m_b);
+        // cf. [AAGW2001], Eq. (54), p. 19
+        CharmLoopsExpansion
+        f19_expansion(const double & mu, const double & m_b, const double & m_q)
+        {
+            // cf. [ABGW2001], Appendix B, pp. 34-38
+            static double kap1900[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-4.61812, 3.67166}, {5.62963, 1.86168}, {0, 0}, {0, 0}, {0, 0}},
+                {{14.4621, -16.2155}, {9.59321, -11.1701}, {-1.18519, -7.44674}, {-0.790123, 0}, {0, 0}},
+                {{-16.0864, 26.7517}, {54.2439, -14.8935}, {-15.4074, -29.787}, {-3.95062, 0}, {0, 0}},
+                {{-14.73, -23.6892}, {-28.5761, 34.7514}, {20.1481, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1901[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0493827, -0.103427}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.592593, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{4.95977, -1.86168}, {-1.18519, -7.44674}, {-2.37037, 0}, {0, 0}, {0, 0}},
+                {{-9.20287, -1.65483}, {-1.0535, 9.92898}, {3.16049, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2710[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1910[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-2.48507, -0.186168}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{4.47441, -0.310281}, {1.48148, -1.86168}, {0, 0}, {0, 0}, {0, 0}},
+                {{71.3855, -30.7987}, {8.47677, -33.5103}, {12.5389, -7.44674}, {-0.790123, 0}, {0.790123, 0}},
+                {{-18.1301, 66.1439}, {149.596, -67.0206}, {-49.1852, -81.9141}, {-11.0617, 0}, {0, 0}},
+                {{-72.89, -63.7828}, {-68.135, 134.041}, {63.6049, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2711[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1911[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-2.66667, -1.86168}, {-1.18519, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{18.6539, -7.44674}, {-4.74074, -29.787}, {-9.48148, 0}, {0, 0}, {0, 0}},
+                {{-41.6104, -3.72337}, {-2.37037, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 2 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2720[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1920[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.403158, -0.0199466}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0613169, 0.0620562}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{37.1282, -1.36524}, {22.0621, -1.86168}, {5.33333, 0}, {0.790123, 0}, {0, 0}},
+                {{212.74, -52.2081}, {-21.9215, -52.1272}, {57.1724, -7.44674}, {-2.37037, 0}, {2.37037, 0}},
+                {{-44.6829, 108.713}, {272.015, -163.828}, {-119.111, -156.382}, {-21.3333, 0}, {0, 0}},
+                {{-137.203, -106.832}, {-99.437, 330.139}, {168.889, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2721[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1921[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-5.33333, -3.72337}, {-2.37037, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{40.786, -22.3402}, {-14.2222, -67.0206}, {-21.3333, 0}, {0, 0}, {0, 0}},
+                {{-111.356, 0}, {0, 119.148}, {37.9259, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2730[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1930[7][5][2] = {
+                {{-0.0759415, -0.00295505}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.00480894, 0.00369382}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-1.81002, 0.0871741}, {-0.919459, 0}, {-0.197531, 0}, {0, 0}, {0, 0}},
+                {{79.7475, -1.72206}, {57.3171, -1.86168}, {11.2593, 0}, {2.37037, 0}, {0, 0}},
+                {{425.579, -76.6479}, {-68.8016, -69.5029}, {129.357, -7.44674}, {-5.53086, 0}, {4.74074, 0}},
+                {{-87.8946, 148.481}, {417.612, -311.522}, {-227.16, -253.189}, {-34.7654, 0}, {0, 0}},
+                {{-279.268, -135.118}, {-146.853, 652.831}, {331.259, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2731[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap1931[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0219479, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-8.2963, -5.58505}, {-3.55556, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{70.2698, -49.6449}, {-31.6049, -119.148}, {-37.9259, 0}, {0, 0}, {0, 0}},
+                {{-231.893, 18.6168}, {11.8519, 248.225}, {79.0123, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 0 ; l < 4; l++)
-            r = r + rho27[l] * pow(s_hat, l);
+            double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
 
-        // imaginary part
-        complex<double> i = 0.0;
+            const double rho19[4] = {
+                3.8991 * power_of<3>(m_q_hat), -23.3946 * m_q_hat, -140.368 * m_q_hat, 7.79821 / m_q_hat - 319.726 * m_q_hat
+            };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+            // real part
+            double ar[4] = {
+                (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b) - 256.0 / 243.0 * power_of<2>(log(mu/m_b)),
+                (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log(mu/m_b),
+                (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log(mu/m_b),
+                (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log(mu/m_b)
+            };
+            double br[4] = { -16.0 / 243.0 * log(mu/m_b), 0.0, 0.0, 0.0 };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2710[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3  ; l < 7 ; l++)
+                for (int m = 0  ; m < 4  ; m++)
+                    ar[0] += kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2711[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3  ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[0] += kap1901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2720[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 2  ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[1] += kap1910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2721[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 4  ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[1] += kap1911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2730[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 1  ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[2] += kap1920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2731[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3  ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[2] += kap1921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
-    }
+            for (int l = 0  ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[3] += kap1930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-    // cf. [AAGW2001], Eq. (54), p. 19
-    complex<double>
-    CharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
-    {
-        // F19(s) diverges for s -> 0. However, s * F19(s) -> 0 for s -> 0.
-        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F19_massive: F19 diverges for s -> 0. Check that F19 enters via 's * F19(s)' and replace by zero.");
+            for (int l = 3  ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[3] += kap1931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        // cf. [ABGW2001], Appendix B, pp. 34-38
-        static double kap1900[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-4.61812, 3.67166}, {5.62963, 1.86168}, {0, 0}, {0, 0}, {0, 0}},
-            {{14.4621, -16.2155}, {9.59321, -11.1701}, {-1.18519, -7.44674}, {-0.790123, 0}, {0, 0}},
-            {{-16.0864, 26.7517}, {54.2439, -14.8935}, {-15.4074, -29.787}, {-3.95062, 0}, {0, 0}},
-            {{-14.73, -23.6892}, {-28.5761, 34.7514}, {20.1481, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 0 ; l < 4; l++)
+                ar[l] += rho19[l];
 
-        static double kap1901[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0493827, -0.103427}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.592593, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{4.95977, -1.86168}, {-1.18519, -7.44674}, {-2.37037, 0}, {0, 0}, {0, 0}},
-            {{-9.20287, -1.65483}, {-1.0535, 9.92898}, {3.16049, 0}, {0, 0}, {0, 0}}
-        };
+            // imaginary part
+            double ai[4] = { 16.0 / 243.0 * M_PI * log(mu/m_b), 0.0, 0.0, 0.0 };
+            double bi[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-        static double kap1910[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-2.48507, -0.186168}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{4.47441, -0.310281}, {1.48148, -1.86168}, {0, 0}, {0, 0}, {0, 0}},
-            {{71.3855, -30.7987}, {8.47677, -33.5103}, {12.5389, -7.44674}, {-0.790123, 0}, {0.790123, 0}},
-            {{-18.1301, 66.1439}, {149.596, -67.0206}, {-49.1852, -81.9141}, {-11.0617, 0}, {0, 0}},
-            {{-72.89, -63.7828}, {-68.135, 134.041}, {63.6049, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[0] += kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap1911[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-2.66667, -1.86168}, {-1.18519, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{18.6539, -7.44674}, {-4.74074, -29.787}, {-9.48148, 0}, {0, 0}, {0, 0}},
-            {{-41.6104, -3.72337}, {-2.37037, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[0] += kap1901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap1920[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.403158, -0.0199466}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0613169, 0.0620562}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{37.1282, -1.36524}, {22.0621, -1.86168}, {5.33333, 0}, {0.790123, 0}, {0, 0}},
-            {{212.74, -52.2081}, {-21.9215, -52.1272}, {57.1724, -7.44674}, {-2.37037, 0}, {2.37037, 0}},
-            {{-44.6829, 108.713}, {272.015, -163.828}, {-119.111, -156.382}, {-21.3333, 0}, {0, 0}},
-            {{-137.203, -106.832}, {-99.437, 330.139}, {168.889, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 2 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[1] += kap1910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap1921[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0164609, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-5.33333, -3.72337}, {-2.37037, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{40.786, -22.3402}, {-14.2222, -67.0206}, {-21.3333, 0}, {0, 0}, {0, 0}},
-            {{-111.356, 0}, {0, 119.148}, {37.9259, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[1] += kap1911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap1930[7][5][2] = {
-            {{-0.0759415, -0.00295505}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.00480894, 0.00369382}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-1.81002, 0.0871741}, {-0.919459, 0}, {-0.197531, 0}, {0, 0}, {0, 0}},
-            {{79.7475, -1.72206}, {57.3171, -1.86168}, {11.2593, 0}, {2.37037, 0}, {0, 0}},
-            {{425.579, -76.6479}, {-68.8016, -69.5029}, {129.357, -7.44674}, {-5.53086, 0}, {4.74074, 0}},
-            {{-87.8946, 148.481}, {417.612, -311.522}, {-227.16, -253.189}, {-34.7654, 0}, {0, 0}},
-            {{-279.268, -135.118}, {-146.853, 652.831}, {331.259, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[2] += kap1920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap1931[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0219479, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-8.2963, -5.58505}, {-3.55556, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{70.2698, -49.6449}, {-31.6049, -119.148}, {-37.9259, 0}, {0, 0}, {0, 0}},
-            {{-231.893, 18.6168}, {11.8519, 248.225}, {79.0123, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[2] += kap1921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
+            for (int l = 0 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[3] += kap1930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[3] += kap1931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            CharmLoopsExpansion result;
+            result.mu = mu;
+            result.m_b = m_b;
+            result.m_q = m_q;
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                result.a[k] = complex<double>(ar[k], ai[k]);
+                result.b[k] = complex<double>(br[k], bi[k]);
+            }
 
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F19_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+            return result;
         }
 
-        const double rho19[4] = {
-            3.8991 * power_of<3>(m_q_hat), -23.3946 * m_q_hat, -140.368 * m_q_hat, 7.79821 / m_q_hat - 319.726 * m_q_hat
-        };
-
-        // real part
-        complex<double> r = (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b)
-            - 16.0 / 243.0 * log(mu/m_b) * log_s_hat
-            + (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log(mu/m_b) * s_hat
-            + (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log(mu/m_b) * s_hat * s_hat
-            + (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log(mu/m_b) * power_of<3>(s_hat)
-            - 256.0 / 243.0 * power_of<2>(log(mu/m_b));
+        // cf. [AAGW2001], Eq. (54), p. 19
+        CharmLoopsExpansion
+        f29_expansion(const double & mu, const double & m_b, const double & m_q)
+        {
+            // cf. [ABGW2001], Appendix B, pp. 34-38
+            static double kap2900[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-24.2913, -22.0299}, {-23.1111, -11.1701}, {0, 0}, {0, 0}, {0, 0}},
+                {{-86.7723, 97.2931}, {-57.5593, 67.0206}, {7.11111, 44.6804}, {4.74074, 0}, {0, 0}},
+                {{96.5187, -160.51}, {-325.463, 89.3609}, {92.4444, 178.722}, {23.7037, 0}, {0, 0}},
+                {{88.3801, 142.135}, {171.457, -208.509}, {-120.889, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3  ; l < 7 ; l++)
-            for (int m = 0  ; m < 4  ; m++)
-                r = r + kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2901[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.296296, 0.620562}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{3.55556, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-29.7586, 11.1701}, {7.11111, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}},
+                {{55.2172, 9.92898}, {6.32099, -59.5739}, {-18.963, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3  ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2910[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.8462, 1.11701}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-26.8464, 1.86168}, {-8.88889, 11.1701}, {0, 0}, {0, 0}, {0, 0}},
+                {{-428.313, 184.792}, {-50.8606, 201.062}, {-75.2337, 44.6804}, {4.74074, 0}, {-4.74074, 0}},
+                {{108.781, -396.864}, {-897.575, 402.124}, {295.111, 491.485}, {66.3704, 0}, {0, 0}},
+                {{437.34, 382.697}, {408.81, -804.248}, {-381.63, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 2  ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2911[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{16., 11.1701}, {7.11111, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-111.923, 44.6804}, {28.4444, 178.722}, {56.8889, 0}, {0, 0}, {0, 0}},
+                {{249.663, 22.3402}, {14.2222, -268.083}, {-85.3333, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 4  ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2920[7][5][2] = {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0132191, 0.11968}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.367901, -0.372337}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-222.769, 8.19141}, {-132.372, 11.1701}, {-32., 0}, {-4.74074, 0}, {0, 0}},
+                {{-1276.44, 313.249}, {131.529, 312.763}, {-343.034, 44.6804}, {14.2222, 0}, {-14.2222, 0}},
+                {{268.098, -652.279}, {-1632.09, 982.969}, {714.667, 938.289}, {128., 0}, {0, 0}},
+                {{823.218, 640.989}, {596.622, -1980.83}, {-1013.33, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 1  ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2921[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{32., 22.3402}, {14.2222, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-244.716, 134.041}, {85.3333, 402.124}, {128., 0}, {0, 0}, {0, 0}},
+                {{668.137, 0}, {0, -714.887}, {-227.556, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3  ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2930[7][5][2] = {
+                {{-0.0142243, 0.0177303}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0.0288536, -0.0221629}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{10.8601, -0.523045}, {5.51675, 0}, {1.18519, 0}, {0, 0}, {0, 0}},
+                {{-478.485, 10.3323}, {-343.902, 11.1701}, {-67.5556, 0}, {-14.2222, 0}, {0, 0}},
+                {{-2553.47, 459.887}, {412.809, 417.017}, {-776.143, 44.6804}, {33.1852, 0}, {-28.4444, 0}},
+                {{527.368, -890.889}, {-2505.67, 1869.13}, {1362.96, 1519.13}, {208.593, 0}, {0, 0}},
+                {{1675.61, 810.709}, {881.117, -3916.98}, {-1987.56, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 0  ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1930[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+            static double kap2931[7][5][2] = {
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-0.131687, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{49.7778, 33.5103}, {21.3333, 0}, {0, 0}, {0, 0}, {0, 0}},
+                {{-421.619, 297.87}, {189.63, 714.887}, {227.556, 0}, {0, 0}, {0, 0}},
+                {{1391.36, -111.701}, {-71.1111, -1489.35}, {-474.074, 0}, {0, 0}, {0, 0}}
+            };
 
-        for (int l = 3  ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1931[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
 
-        for (int l = 0  ; l < 4; l++)
-            r = r + rho19[l] * pow(s_hat, l);
+            const double rho29[4] = {
+                -23.3946 * power_of<3>(m_q_hat), 140.368 * m_q_hat, 842.206 * m_q_hat, -46.7892 / m_q_hat + 1918.36 * m_q_hat
+            };
 
-        // imaginary part
-        complex<double> i = 16.0 / 243.0 * M_PI * log(mu/m_b);
+            // real part
+            double ar[4] = {
+                (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b) + 512.0 / 81.0 * power_of<2>(log(mu / m_b)),
+                (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log(mu / m_b),
+                (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log(mu / m_b),
+                (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log(mu / m_b)
+            };
+            double br[4] = { 32.0 / 81.0 * log(mu / m_b), 0.0, 0.0, 0.0 };
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 4 ; m++)
+                    ar[0] += kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[0] += kap2901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 2 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 2 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[1] += kap2910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[1] += kap2911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[2] += kap2920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[2] += kap2921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 0 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1930[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 0 ; l < 7 ; l++)
+                for (int m = 0 ; m < 5 ; m++)
+                    ar[3] += kap2930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1931[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    br[3] += kap2931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
-    }
+            for (int l = 0 ; l < 4; l++)
+                ar[l] += rho29[l];
 
-    // cf. [AAGW2001], Eq. (54), p. 19
-    complex<double>
-    CharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
-    {
-        // F29(s) diverges for s -> 0. However, s * F29(s) -> 0 for s -> 0.
-        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F29_massive: F29 diverges for s -> 0. Check that F29 enters via 's * F29(s)' and replace by zero.");
+            // imaginary part
+            double ai[4] = { - 32.0 / 81.0 * M_PI * log(mu/m_b), 0.0, 0.0, 0.0 };
+            double bi[4] = { 0.0, 0.0, 0.0, 0.0 };
 
-        // cf. [ABGW2001], Appendix B, pp. 34-38
-        static double kap2900[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-24.2913, -22.0299}, {-23.1111, -11.1701}, {0, 0}, {0, 0}, {0, 0}},
-            {{-86.7723, 97.2931}, {-57.5593, 67.0206}, {7.11111, 44.6804}, {4.74074, 0}, {0, 0}},
-            {{96.5187, -160.51}, {-325.463, 89.3609}, {92.4444, 178.722}, {23.7037, 0}, {0, 0}},
-            {{88.3801, 142.135}, {171.457, -208.509}, {-120.889, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[0] += kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2901[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.296296, 0.620562}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{3.55556, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-29.7586, 11.1701}, {7.11111, 44.6804}, {14.2222, 0}, {0, 0}, {0, 0}},
-            {{55.2172, 9.92898}, {6.32099, -59.5739}, {-18.963, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 3 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[0] += kap2901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2910[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.8462, 1.11701}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-26.8464, 1.86168}, {-8.88889, 11.1701}, {0, 0}, {0, 0}, {0, 0}},
-            {{-428.313, 184.792}, {-50.8606, 201.062}, {-75.2337, 44.6804}, {4.74074, 0}, {-4.74074, 0}},
-            {{108.781, -396.864}, {-897.575, 402.124}, {295.111, 491.485}, {66.3704, 0}, {0, 0}},
-            {{437.34, 382.697}, {408.81, -804.248}, {-381.63, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 2 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[1] += kap2910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2911[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{16., 11.1701}, {7.11111, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-111.923, 44.6804}, {28.4444, 178.722}, {56.8889, 0}, {0, 0}, {0, 0}},
-            {{249.663, 22.3402}, {14.2222, -268.083}, {-85.3333, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[1] += kap2911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2920[7][5][2] = {{{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0132191, 0.11968}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.367901, -0.372337}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-222.769, 8.19141}, {-132.372, 11.1701}, {-32., 0}, {-4.74074, 0}, {0, 0}},
-            {{-1276.44, 313.249}, {131.529, 312.763}, {-343.034, 44.6804}, {14.2222, 0}, {-14.2222, 0}},
-            {{268.098, -652.279}, {-1632.09, 982.969}, {714.667, 938.289}, {128., 0}, {0, 0}},
-            {{823.218, 640.989}, {596.622, -1980.83}, {-1013.33, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 1 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[2] += kap2920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2921[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.0987654, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{32., 22.3402}, {14.2222, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-244.716, 134.041}, {85.3333, 402.124}, {128., 0}, {0, 0}, {0, 0}},
-            {{668.137, 0}, {0, -714.887}, {-227.556, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[2] += kap2921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        static double kap2930[7][5][2] = {
-            {{-0.0142243, 0.0177303}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0.0288536, -0.0221629}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{10.8601, -0.523045}, {5.51675, 0}, {1.18519, 0}, {0, 0}, {0, 0}},
-            {{-478.485, 10.3323}, {-343.902, 11.1701}, {-67.5556, 0}, {-14.2222, 0}, {0, 0}},
-            {{-2553.47, 459.887}, {412.809, 417.017}, {-776.143, 44.6804}, {33.1852, 0}, {-28.4444, 0}},
-            {{527.368, -890.889}, {-2505.67, 1869.13}, {1362.96, 1519.13}, {208.593, 0}, {0, 0}},
-            {{1675.61, 810.709}, {881.117, -3916.98}, {-1987.56, 0}, {0, 0}, {0, 0}}
-        };
+            for (int l = 0 ; l < 7 ; l++)
+                for (int m = 0 ; m < 3 ; m++)
+                    ai[3] += kap2930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            for (int l = 4 ; l < 7 ; l++)
+                for (int m = 0 ; m < 2 ; m++)
+                    bi[3] += kap2931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+
+            CharmLoopsExpansion result;
+            result.mu = mu;
+            result.m_b = m_b;
+            result.m_q = m_q;
+            for (int k = 0 ; k < 4 ; k++)
+            {
+                result.a[k] = complex<double>(ar[k], ai[k]);
+                result.b[k] = complex<double>(br[k], bi[k]);
+            }
 
-        static double kap2931[7][5][2] = {
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-0.131687, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{49.7778, 33.5103}, {21.3333, 0}, {0, 0}, {0, 0}, {0, 0}},
-            {{-421.619, 297.87}, {189.63, 714.887}, {227.556, 0}, {0, 0}, {0, 0}},
-            {{1391.36, -111.701}, {-71.1111, -1489.35}, {-474.074, 0}, {0, 0}, {0, 0}}
-        };
+            return result;
+        }
+    }
 
-        double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
+    complex<double>
+    CharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c)
+    {
+        double s_hat = s / power_of<2>(m_b);
 
         complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
+        if ((0.0 < s_hat) && (s_hat <= 0.45))
         {
             log_s_hat.imag(0.0);
         }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
         {
             log_s_hat.imag(+M_PI);
         }
         else
         {
-            throw InternalError("CharmLoop::F29_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+            throw InternalError("CharmLoop::F17_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
         }
 
-        const double rho29[4] = {
-            -23.3946 * power_of<3>(m_q_hat), 140.368 * m_q_hat, 842.206 * m_q_hat, -46.7892 / m_q_hat + 1918.36 * m_q_hat
-        };
-
-        // real part
-        complex<double> r = (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b)
-            + 32.0 / 81.0 * log(mu / m_b) * log_s_hat
-            + (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log(mu / m_b) * s_hat
-            + (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log(mu / m_b) * s_hat * s_hat
-            + (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log(mu / m_b) * power_of<3>(s_hat)
-            + 512.0 / 81.0 * power_of<2>(log(mu / m_b));
-
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
-
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
-
-        for (int l = 2 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        static thread_local impl::CharmLoopsExpansion expansion;
+        if (! expansion.matches(mu, m_b, m_c))
+        {
+            expansion = impl::f17_expansion(mu, m_b, m_c);
+        }
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        return expansion.evaluate(s_hat, log_s_hat);
+    }
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+    complex<double>
+    CharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        double s_hat = s / m_b / m_b;
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        if (s_hat == 0)
+        {
+            return impl::f27_0(mu, m_b, m_q);
+        }
 
-        for (int l = 0 ; l < 7 ; l++)
-            for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2930[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.0 < s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F27_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2931[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        static thread_local impl::CharmLoopsExpansion expansion;
+        if (! expansion.matches(mu, m_b, m_q))
+        {
+            expansion = impl::f27_expansion(mu, m_b, m_q);
+        }
 
-        for (int l = 0 ; l < 4; l++)
-            r = r + rho29[l] * pow(s_hat, l);
+        return expansion.evaluate(s_hat, log_s_hat);
+    }
 
-        // imaginary part
-        complex<double> i = - 32.0 / 81.0 * M_PI * log(mu/m_b);
+    complex<double>
+    CharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        // F19(s) diverges for s -> 0. However, s * F19(s) -> 0 for s -> 0.
+        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
+            throw InternalError("CharmLoops::F19_massive: F19 diverges for s -> 0. Check that F19 enters via 's * F19(s)' and replace by zero.");
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+        double s_hat = s / m_b / m_b;
 
-        for (int l = 3 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.000 <= s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F19_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
 
-        for (int l = 2 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        static thread_local impl::CharmLoopsExpansion expansion;
+        if (! expansion.matches(mu, m_b, m_q))
+        {
+            expansion = impl::f19_expansion(mu, m_b, m_q);
+        }
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        return expansion.evaluate(s_hat, log_s_hat);
+    }
 
-        for (int l = 1 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+    complex<double>
+    CharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        // F29(s) diverges for s -> 0. However, s * F29(s) -> 0 for s -> 0.
+        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
+            throw InternalError("CharmLoops::F29_massive: F29 diverges for s -> 0. Check that F29 enters via 's * F29(s)' and replace by zero.");
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        double s_hat = s / m_b / m_b;
 
-        for (int l = 0 ; l < 7 ; l++)
-            for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2930[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.000 <= s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F29_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
 
-        for (int l = 4 ; l < 7 ; l++)
-            for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2931[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+        static thread_local impl::CharmLoopsExpansion expansion;
+        if (! expansion.matches(mu, m_b, m_q))
+        {
+            expansion = impl::f29_expansion(mu, m_b, m_q);
+        }
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return expansion.evaluate(s_hat, log_s_hat);
     }
 
     // cf. [AAGW2001], eqs. (48) and (49), p. 18
@@ -1189,6 +1331,67 @@ namespace eos
         return result;
     }
 
+    // cf. [BFS2001], Eq. (29), p. 8; batched variant of the above
+    void
+    CharmLoops::B0(const double * s, const unsigned & n, const double & m_q, complex<double> * results)
+    {
+        // partition the inputs by branch; indices into s, since the branches map
+        // to disjoint, typically contiguous ranges of momentum transfer
+        std::vector<unsigned> timelike_below, timelike_above, spacelike;
+
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            if ((0.0 == m_q) && (0.0 == s[i]))
+            {
+                throw InternalError("CharmLoops::B0: m_q == 0 & s == 0");
+            }
+
+            results[i] = complex<double>(0.0, 0.0);
+
+            if (0.0 == s[i])
+            {
+                results[i] = complex<double>(-2.0, 0.0);
+                continue;
+            }
+
+            const double z = 4.0 * m_q * m_q / s[i];
+
+            if (z > 1.0) // 0 < s < 4 m_q^2
+            {
+                timelike_below.push_back(i);
+            }
+            else if (z > 0) // s >= 4 m_q^2
+            {
+                timelike_above.push_back(i);
+            }
+            else if (z < 0) // s < 0
+            {
+                spacelike.push_back(i);
+            }
+        }
+
+        for (const auto & i : timelike_below)
+        {
+            const double z = 4.0 * m_q * m_q / s[i];
+            const double w = std::sqrt(z - 1.0);
+            results[i] = complex<double>(-2.0 * w * std::atan(1.0 / w), 0.0);
+        }
+
+        for (const auto & i : timelike_above)
+        {
+            const double z = 4.0 * m_q * m_q / s[i];
+            const double w = std::sqrt(1.0 - z);
+            results[i] = complex<double>(w * std::log((1.0 - w) / (1.0 + w)), w * M_PI);
+        }
+
+        for (const auto & i : spacelike)
+        {
+            const double z = 4.0 * m_q * m_q / s[i];
+            const double w = sqrt(1.0 - z);
+            results[i] = complex<double>(w * log((w - 1.0) / (w + 1.0)), 0.0);
+        }
+    }
+
     // cf. [BFS2001], Eq. (84), p. 30
     complex<double>
     CharmLoops::C0(const double & s, const double & m_q)
@@ -1247,6 +1450,107 @@ namespace eos
         return 1.0 / (1.0 - s_hat) * (2.0 * at1 * (at1 - at2) + log1 * log1 - Li_1 - Li_2 + Li_3 + Li_4);
     }
 
+    // cf. [BFS2001], Eq. (84), p. 30; batched variant of the above
+    void
+    CharmLoops::C0(const double * s, const unsigned & n, const double & m_q, complex<double> * results)
+    {
+        // the near-threshold approximations are polynomial and evaluate inline;
+        // the remaining bulk inputs are gathered for batched evaluation
+        std::vector<unsigned> bulk;
+        bulk.reserve(n);
+
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            const double s_hat = s[i] / (m_q * m_q);
+
+            if (s_hat < 0.0)
+                throw InternalError("CharmLoops::C0: s < 0 is unphysical");
+
+            if (s_hat > 2.0)
+                throw InternalError("CharmLoops::C0: support for s > 2.0 * m_q^2 is not implemented, here s / m_q^2 = " + stringify(s_hat));
+
+            if (s_hat < 0.01)
+            {
+                static const double a = -M_PI * M_PI / 6.0;
+                static const double b = -0.145134;
+
+                results[i] = complex<double>(a + s_hat * b, 0.0);
+            }
+            else if ((0.99 <= s_hat) && (s_hat <= 1.01))
+            {
+                static const double a = -M_PI / std::sqrt(3.0);
+                static const double b = (-9.0 + std::sqrt(3.0) * M_PI) / 18.0;
+                static const double c = (9.0 - 2.0 * std::sqrt(3.0) * M_PI) / 54.0;
+
+                results[i] = complex<double>(a + (s_hat - 1.0) * b + power_of<2>(s_hat - 1.0) * c, 0.0);
+            }
+            else
+            {
+                bulk.push_back(i);
+            }
+        }
+
+        // the elementary functions of the bulk evaluate in tight loops over
+        // contiguous scratch arrays; only the dilogarithms remain scalar calls
+        const std::size_t m = bulk.size();
+        std::vector<double> shat(m), A(m), at1(m), at2(m), log1(m);
+
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            shat[k] = s[bulk[k]] / (m_q * m_q);
+        }
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            A[k] = sqrt(shat[k] * (4.0 - shat[k]));
+        }
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            at1[k] = atan(A[k] / (2.0 - shat[k]));
+        }
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            at2[k] = atan(A[k] / shat[k]);
+        }
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            log1[k] = log(2.0 - shat[k]);
+        }
+
+        // the four dilogarithm arguments per element are decomposed into
+        // polar form in bulk; only the gsl dilogarithm itself remains a
+        // scalar call
+        std::vector<complex<double>> args(4 * m);
+        std::vector<double> magnitudes(4 * m), phases(4 * m);
+
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            args[4 * k + 0] = 0.5 * complex<double>(2.0 - shat[k], -A[k]);
+            args[4 * k + 1] = 0.5 * complex<double>(2.0 - shat[k], +A[k]);
+            args[4 * k + 2] = 0.5 * complex<double>(1.0, -A[k] / (2.0 - shat[k]));
+            args[4 * k + 3] = 0.5 * complex<double>(1.0, +A[k] / (2.0 - shat[k]));
+        }
+        complex_to_polar(args.data(), 4 * m, magnitudes.data(), phases.data());
+
+        for (std::size_t k = 0 ; k < m ; ++k)
+        {
+            gsl_sf_result res_re, res_im;
+
+            gsl_sf_complex_dilog_e(magnitudes[4 * k + 0], phases[4 * k + 0], &res_re, &res_im);
+            complex<double> Li_1(res_re.val, res_im.val);
+
+            gsl_sf_complex_dilog_e(magnitudes[4 * k + 1], phases[4 * k + 1], &res_re, &res_im);
+            complex<double> Li_2(res_re.val, res_im.val);
+
+            gsl_sf_complex_dilog_e(magnitudes[4 * k + 2], phases[4 * k + 2], &res_re, &res_im);
+            complex<double> Li_3(res_re.val, res_im.val);
+
+            gsl_sf_complex_dilog_e(magnitudes[4 * k + 3], phases[4 * k + 3], &res_re, &res_im);
+            complex<double> Li_4(res_re.val, res_im.val);
+
+            results[bulk[k]] = 1.0 / (1.0 - shat[k]) * (2.0 * at1[k] * (at1[k] - at2[k]) + log1[k] * log1[k] - Li_1 - Li_2 + Li_3 + Li_4);
+        }
+    }
+
     complex<double>
     CharmLoops::F17_massive_Qsb(const double & s)
     {
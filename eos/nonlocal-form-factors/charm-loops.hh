@@ -83,6 +83,13 @@ namespace eos
         static complex<double> B0(const double & s, const double & m_q);
         static complex<double> C0(const double & s, const double & m_q);
 
+        // batched variants of B0 and C0: evaluate n momentum transfers in one call.
+        // The inputs are partitioned by their branch (above/below the ccbar threshold,
+        // spacelike, near-threshold approximations), so that the elementary functions
+        // of each partition evaluate in a tight loop.
+        static void B0(const double * s, const unsigned & n, const double & m_q, complex<double> * results);
+        static void C0(const double * s, const unsigned & n, const double & m_q, complex<double> * results);
+
         // Contributions proportional to Q_s = Q_b arising from intermediate ccbar pairs at NLO in alpha_s.
         // These contributions are interpolated from reference values from [AGV:2019]
         // In particular mu = m_b = 4.18 and alpha_s(M_Z) = 0.1185
@@ -22,6 +22,7 @@
 #include <eos/nonlocal-form-factors/charm-loops.hh>
 
 #include <cmath>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -131,6 +132,51 @@ class OneLoopTest :
         }
 } one_loop_test;
 
+class BatchedOneLoopTest :
+    public TestCase
+{
+    public:
+        BatchedOneLoopTest() :
+            TestCase("batched_one_loop_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double m_c = 1.4, eps = 1e-14;
+
+            /* Batched B0 agrees with the scalar implementation across all branches */
+            {
+                static const std::vector<double> s{ -9.0, -4.0, -1.0, 0.0, +1.0, +4.0, +4.0 * m_c * m_c, +8.0, +9.0 };
+
+                std::vector<complex<double>> results(s.size());
+                CharmLoops::B0(s.data(), s.size(), m_c, results.data());
+
+                for (unsigned i = 0 ; i < s.size() ; ++i)
+                {
+                    const complex<double> scalar = CharmLoops::B0(s[i], m_c);
+                    TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(scalar), eps);
+                    TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(scalar), eps);
+                }
+            }
+
+            /* Batched C0 agrees with the scalar implementation across all branches */
+            {
+                static const std::vector<double> s{ 0.0, 0.01, 0.5, 1.0, 1.5, 1.96, 2.5, 3.0, 3.8 };
+
+                std::vector<complex<double>> results(s.size());
+                CharmLoops::C0(s.data(), s.size(), m_c, results.data());
+
+                for (unsigned i = 0 ; i < s.size() ; ++i)
+                {
+                    const complex<double> scalar = CharmLoops::C0(s[i], m_c);
+                    TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(scalar), eps);
+                    TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(scalar), eps);
+                }
+            }
+        }
+} batched_one_loop_test;
+
 class HelperTest :
     public TestCase
 {
@@ -417,6 +463,18 @@ class FormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR(real(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), + 4.0282600,  eps);
                 TEST_CHECK_RELATIVE_ERROR(imag(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), - 0.6601020,  eps);
             }
+
+            /* Massive loops: cached expansion coefficients are refreshed when the masses change */
+            {
+                static const double mu = 4.2, s = 6.0, m_b = 4.6, eps = 1e-12;
+
+                const complex<double> first = CharmLoops::F17_massive(mu, s, m_b, 1.2);
+                CharmLoops::F17_massive(mu, s, m_b, 1.4);
+                const complex<double> again = CharmLoops::F17_massive(mu, s, m_b, 1.2);
+
+                TEST_CHECK_NEARLY_EQUAL(real(first), real(again), eps);
+                TEST_CHECK_NEARLY_EQUAL(imag(first), imag(again), eps);
+            }
         }
 } two_loop_test;
 
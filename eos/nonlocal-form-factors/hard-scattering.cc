@@ -32,6 +32,14 @@ namespace eos
         return 6.0 * u * (1.0 - u) * (1.0 + a_1 * 3.0 * (2.0 * u - 1.0) + a_2 * 3.0 / 2.0 * (5.0 * power_of<2>(2.0 * u - 1.0) - 1.0));
     }
 
+    // Gegenbauer basis of the twist-2 lcda: lcda_tw2(u, a_1, a_2) = basis[0] + a_1 * basis[1] + a_2 * basis[2]
+    inline std::array<double, 3> lcda_tw2_basis(const double & u)
+    {
+        const double w = 6.0 * u * (1.0 - u);
+
+        return {{ w, w * 3.0 * (2.0 * u - 1.0), w * 3.0 / 2.0 * (5.0 * power_of<2>(2.0 * u - 1.0) - 1.0) }};
+    }
+
     static complex<double> z_ratio(const double & s, const double mq2)
     {
         static const complex<double> i{0.0, 1.0};
@@ -321,4 +329,80 @@ namespace eos
 
         return lcda_tw2(u, a_1, a_2) / power_of<2>(ubar + u * s / power_of<2>(m_B));
     }
+
+    // assembles the moment components of j0 to j6 from the shared loop
+    // functions: i1 = I1, t2 = kernel factor of j2 (B0 difference or its
+    // massless limit), h = CharmLoops::h
+    static HardScattering::MomentKernels
+    assemble_moment_kernels(const double & s, const double & u, const double & m_B,
+            const complex<double> & i1, const complex<double> & t2, const complex<double> & h)
+    {
+        const double ubar  = 1.0 - u;
+        const double s_hat = s / power_of<2>(m_B);
+        const double denom = ubar + u * s_hat;
+
+        const std::array<double, 3> phi = lcda_tw2_basis(u);
+        // Gegenbauer basis of the first inverse partial moment of the lcda,
+        // the weight function of j6, cf. [BFS2004], eq. (52)
+        const std::array<double, 3> phi_inv =
+        {{
+            3.0 * power_of<2>(u),
+            power_of<2>(u) * (-9.0 + 12.0 * u),
+            power_of<2>(u) * (18.0 - 60.0 * u + 45.0 * power_of<2>(u))
+        }};
+
+        HardScattering::MomentKernels result;
+        for (unsigned m = 0 ; m < 3 ; ++m)
+        {
+            result.j0[m] = phi[m] / denom;
+            result.j1[m] = phi[m] / ubar * i1;
+            result.j2[m] = phi[m] * t2 / power_of<2>(ubar);
+            result.j3[m] = result.j2[m] * denom;
+            result.j4[m] = phi[m] * h;
+            result.j5[m] = phi[m] / denom * h;
+            result.j6[m] = phi_inv[m] * h;
+        }
+
+        return result;
+    }
+
+    HardScattering::MomentKernels
+    HardScattering::moment_kernels(const double & s, const double & u, const double & m_q, const double & m_B,
+            const double & mu)
+    {
+        const double ubar = 1.0 - u;
+        const double m_B2 = power_of<2>(m_B);
+
+        const complex<double> i1 = I1(s, u, m_q, m_B);
+        const complex<double> t2 = CharmLoops::B0(ubar * m_B2 + u * s, m_q) - CharmLoops::B0(s, m_q);
+        const complex<double> h  = CharmLoops::h(mu, ubar * m_B2 + u * s, m_q);
+
+        return assemble_moment_kernels(s, u, m_B, i1, t2, h);
+    }
+
+    HardScattering::MomentKernels
+    HardScattering::moment_kernels_massless(const double & s, const double & u, const double & m_B,
+            const double & mu)
+    {
+        const double ubar  = 1.0 - u;
+        const double m_B2  = power_of<2>(m_B);
+        const double s_hat = s / m_B2;
+
+        const complex<double> i1 = complex<double>(1.0, 0.0);
+        const complex<double> t2 = std::log(s_hat / (ubar + u * s_hat));
+        const complex<double> h  = CharmLoops::h(mu, ubar * m_B2 + u * s);
+
+        return assemble_moment_kernels(s, u, m_B, i1, t2, h);
+    }
+
+    std::array<complex<double>, 3>
+    HardScattering::j1_moments(const double & s, const double & u, const double & m_q, const double & m_B)
+    {
+        const double ubar = 1.0 - u;
+
+        const std::array<double, 3> phi = lcda_tw2_basis(u);
+        const complex<double> i1 = I1(s, u, m_q, m_B);
+
+        return {{ phi[0] / ubar * i1, phi[1] / ubar * i1, phi[2] / ubar * i1 }};
+    }
 }
@@ -20,6 +20,7 @@
 #ifndef EOS_GUARD_SRC_NONLOCAL_FORM_FACTORS_HARD_SCATTERING_HH
 #define EOS_GUARD_SRC_NONLOCAL_FORM_FACTORS_HARD_SCATTERING_HH 1
 
+#include <array>
 #include <complex>
 
 namespace eos
@@ -194,6 +195,55 @@ namespace eos
          * @param a_2 Second Gegenbauer coefficient
          */
         static double j7(const double & s, const double & u, const double & m_B, const double & a_1, const double & a_2);
+
+        /*!
+         * Gegenbauer-moment components of the kernels j0 to j6: each kernel is
+         * linear in the Gegenbauer coefficients,
+         *     j_k(a_1, a_2) = j_k[0] + a_1 * j_k[1] + a_2 * j_k[2],
+         * so the components can be integrated independently of a_1 and a_2, and
+         * contracted with any set of moments afterwards.
+         */
+        struct MomentKernels
+        {
+            std::array<double, 3> j0;
+
+            std::array<complex<double>, 3> j1, j2, j3, j4, j5, j6;
+        };
+
+        /*!
+         * Evaluates the Gegenbauer-moment components of j0 to j6 in a single
+         * pass, computing the loop functions I1, B0 and h once per sampling
+         * point instead of once per kernel and set of moments.
+         * @param s Dilepton invariant mass
+         * @param u Relative contribution of the quark (versus ubar = 1-u for the antiquark) to the light meson's energy.
+         * @param m_q Mass of the internal loop quark
+         * @param m_B Mass of the B meson
+         * @param mu Renormalization scale
+         */
+        static MomentKernels moment_kernels(const double & s, const double & u, const double & m_q, const double & m_B,
+                const double & mu);
+
+        /*!
+         * As moment_kernels, but with the massless limits of j2 and j3
+         * (cf. j2_massless, j3_massless).
+         * @param s Dilepton invariant mass
+         * @param u Relative contribution of the quark (versus ubar = 1-u for the antiquark) to the light meson's energy.
+         * @param m_B Mass of the B meson
+         * @param mu Renormalization scale
+         */
+        static MomentKernels moment_kernels_massless(const double & s, const double & u, const double & m_B,
+                const double & mu);
+
+        /*!
+         * Gegenbauer-moment components of j1 alone, sharing one evaluation of
+         * I1 across the moments.
+         * @param s Dilepton invariant mass
+         * @param u Relative contribution of the quark (versus ubar = 1-u for the antiquark) to the light meson's energy.
+         * @param m_q Mass of the internal loop quark
+         * @param m_B Mass of the B meson
+         */
+        static std::array<complex<double>, 3> j1_moments(const double & s, const double & u, const double & m_q,
+                const double & m_B);
     };
 }
 
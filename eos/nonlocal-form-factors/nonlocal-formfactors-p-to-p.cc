@@ -23,6 +23,7 @@
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/nonlocal-form-factors/nonlocal-formfactors.hh>
+#include <eos/utils/evaluation-stamp.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/stringify.hh>
@@ -181,6 +182,56 @@ namespace eos
                 // Orthogonal polynomials on an arc of the unit circle
                 const SzegoPolynomial<6u> polynomials;
 
+                // handle on the parameter set, to detect changes
+                Parameters _parameters;
+
+                /*!
+                 * Snapshot of the q2-independent ingredients of H_plus: the
+                 * coefficient array and the positions of the charmonium poles
+                 * in z. Integrated observables evaluate the nonlocal form
+                 * factor at many q2 per parameter point; the snapshot reduces
+                 * each evaluation to the genuinely q2-dependent dispersive
+                 * factors.
+                 */
+                struct Snapshot
+                {
+                    EvaluationStamp stamp;
+
+                    std::array<complex<double>, 7> alpha;
+
+                    complex<double> z_Jpsi, z_psi2S;
+                };
+
+                mutable Snapshot _snapshot;
+
+                const Snapshot & _cache() const
+                {
+                    Snapshot & snapshot = _snapshot;
+
+                    const EvaluationStamp stamp(_parameters);
+                    if (stamp != snapshot.stamp)
+                    {
+                        snapshot.alpha = std::array<complex<double>, 7>{
+                            complex<double>(re_alpha_0_plus, im_alpha_0_plus),
+                            complex<double>(re_alpha_1_plus, im_alpha_1_plus),
+                            complex<double>(re_alpha_2_plus, im_alpha_2_plus),
+                            complex<double>(re_alpha_3_plus, im_alpha_3_plus),
+                            complex<double>(re_alpha_4_plus, im_alpha_4_plus),
+                            complex<double>(re_alpha_5_plus, im_alpha_5_plus),
+                            complex<double>(re_alpha_6_plus, im_alpha_6_plus),
+                        };
+
+                        const double s_0 = this->t_0();
+                        const double s_p = 4.0 * power_of<2>(m_D0);
+                        snapshot.z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),  s_p, s_0);
+                        snapshot.z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S), s_p, s_0);
+
+                        snapshot.stamp = stamp;
+                    }
+
+                    return snapshot;
+                }
+
                 GvDV2020(const Parameters & p, const Options & o) :
                     form_factors(FormFactorFactory<PToP>::create(stringify(Process_::label) + "::" + o.get("form-factors", "BSZ2015"), p)),
 
@@ -214,7 +265,9 @@ namespace eos
 
                     // The parameters of the polynomial expension are computed using t0 = 4.0 and
                     // the masses are set to mB = 5.279 and mK = 0.492 (same values as for local form-factors)
-                    polynomials(SzegoPolynomial<6u>::FlatMeasure(2.48247))
+                    polynomials(SzegoPolynomial<6u>::FlatMeasure(2.48247)),
+
+                    _parameters(p)
                 {
                     this->uses(*form_factors);
                 }
@@ -298,28 +351,18 @@ namespace eos
 
                 virtual complex<double> H_plus(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                   s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),  s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S), s_p, s_0);
+                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, snapshot.z_Jpsi, snapshot.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 3, 2, 2};
 
                     const auto & polynomials_at_z = polynomials(z);
-                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(snapshot.alpha.begin(), snapshot.alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -331,15 +374,7 @@ namespace eos
 
                 virtual complex<double> Hhat_plus(const double & q2) const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
@@ -347,42 +382,22 @@ namespace eos
 
                     const auto & polynomials_at_z = polynomials(z);
 
-                    return std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(snapshot.alpha.begin(), snapshot.alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
 
                 virtual complex<double> H_plus_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 3, 2, 2};
 
-                    return H_residue_jpsi(phi_parameters, alpha);
+                    return H_residue_jpsi(phi_parameters, _cache().alpha);
                 }
 
                 virtual complex<double> H_plus_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 3, 2, 2};
 
-                    return H_residue_psi2s(phi_parameters, alpha);
+                    return H_residue_psi2s(phi_parameters, _cache().alpha);
                 }
 
                 virtual complex<double> normalized_moment_A(const double &) const
@@ -409,15 +424,7 @@ namespace eos
 
                 virtual complex<double> P_ratio_plus(const double & q2) const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const complex<double> F_plus = form_factors->f_p(q2);
 
@@ -426,7 +433,7 @@ namespace eos
                     const auto z       = eos::nff_utils::z(q2, s_p, s_0);
 
                     const auto & polynomials_at_z = polynomials(z);
-                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(snapshot.alpha.begin(), snapshot.alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
                     const std::array<unsigned, 4> phi_parameters = {3, 3, 2, 2};
 
@@ -435,17 +442,7 @@ namespace eos
 
                 virtual complex<double> get_orthonormal_coefficients(const unsigned & i) const
                 {
-                    const std::array<complex<double>, 7> alpha{
-                        complex<double>(re_alpha_0_plus, im_alpha_0_plus),
-                        complex<double>(re_alpha_1_plus, im_alpha_1_plus),
-                        complex<double>(re_alpha_2_plus, im_alpha_2_plus),
-                        complex<double>(re_alpha_3_plus, im_alpha_3_plus),
-                        complex<double>(re_alpha_4_plus, im_alpha_4_plus),
-                        complex<double>(re_alpha_5_plus, im_alpha_5_plus),
-                        complex<double>(re_alpha_6_plus, im_alpha_6_plus),
-                    };
-
-                    return alpha[i];
+                    return _cache().alpha[i];
                 }
 
                 virtual double weak_bound() const
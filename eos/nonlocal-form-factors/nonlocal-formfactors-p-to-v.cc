@@ -24,6 +24,7 @@
 #include <eos/models/model.hh>
 #include <eos/maths/complex.hh>
 #include <eos/nonlocal-form-factors/nonlocal-formfactors.hh>
+#include <eos/utils/evaluation-stamp.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/memoise.hh>
@@ -291,6 +292,81 @@ namespace eos
                 // Orthogonal polynomials on an arc of the unit circle
                 std::shared_ptr<SzegoPolynomial<5u>> polynomials;
 
+                // accuracy/speed tier: "full" evaluates the entire order-5
+                // expansion; "fast" truncates it after the order-2 term. The
+                // orthonormal polynomials are bounded by O(1) on the arc, so
+                // the truncation shifts Hhat by at most the sum of the moduli
+                // of the dropped coefficients alpha_3 ... alpha_5.
+                SwitchOption opt_accuracy;
+                unsigned n_alpha;
+
+                // handle on the parameter set, to detect changes
+                Parameters _parameters;
+
+                /*!
+                 * Snapshot of the q2-independent ingredients of H_perp, H_para
+                 * and H_long: the three coefficient arrays and the positions of
+                 * the charmonium poles in z. Integrated observables evaluate
+                 * the nonlocal form factor at many q2 per parameter point; the
+                 * snapshot reduces each evaluation to the genuinely
+                 * q2-dependent dispersive factors.
+                 */
+                struct Snapshot
+                {
+                    EvaluationStamp stamp;
+
+                    std::array<complex<double>, 6> alpha_perp, alpha_para, alpha_long;
+
+                    complex<double> z_Jpsi, z_psi2S;
+                };
+
+                mutable Snapshot _snapshot;
+
+                const Snapshot & _cache() const
+                {
+                    Snapshot & snapshot = _snapshot;
+
+                    const EvaluationStamp stamp(_parameters);
+                    if (stamp != snapshot.stamp)
+                    {
+                        snapshot.alpha_perp = std::array<complex<double>, 6>{
+                            complex<double>(re_alpha_0_perp, im_alpha_0_perp),
+                            complex<double>(re_alpha_1_perp, im_alpha_1_perp),
+                            complex<double>(re_alpha_2_perp, im_alpha_2_perp),
+                            complex<double>(re_alpha_3_perp, im_alpha_3_perp),
+                            complex<double>(re_alpha_4_perp, im_alpha_4_perp),
+                            complex<double>(re_alpha_5_perp, im_alpha_5_perp),
+                        };
+
+                        snapshot.alpha_para = std::array<complex<double>, 6>{
+                            complex<double>(re_alpha_0_para, im_alpha_0_para),
+                            complex<double>(re_alpha_1_para, im_alpha_1_para),
+                            complex<double>(re_alpha_2_para, im_alpha_2_para),
+                            complex<double>(re_alpha_3_para, im_alpha_3_para),
+                            complex<double>(re_alpha_4_para, im_alpha_4_para),
+                            complex<double>(re_alpha_5_para, im_alpha_5_para),
+                        };
+
+                        snapshot.alpha_long = std::array<complex<double>, 6>{
+                            complex<double>(re_alpha_0_long, im_alpha_0_long),
+                            complex<double>(re_alpha_1_long, im_alpha_1_long),
+                            complex<double>(re_alpha_2_long, im_alpha_2_long),
+                            complex<double>(re_alpha_3_long, im_alpha_3_long),
+                            complex<double>(re_alpha_4_long, im_alpha_4_long),
+                            complex<double>(re_alpha_5_long, im_alpha_5_long),
+                        };
+
+                        const double s_0 = this->t_0();
+                        const double s_p = 4.0 * power_of<2>(m_D0);
+                        snapshot.z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),  s_p, s_0);
+                        snapshot.z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S), s_p, s_0);
+
+                        snapshot.stamp = stamp;
+                    }
+
+                    return snapshot;
+                }
+
                 std::string _final_state() const
                 {
                     switch (opt_q.value()[0])
@@ -364,7 +440,11 @@ namespace eos
 
                     // The parameters of the polynomial expension are computed using t0 = 4.0 and
                     // the masses are set to the same values as for local form-factors
-                    polynomials(PolynomialsFactory::create(opt_q.value()))
+                    polynomials(PolynomialsFactory::create(opt_q.value())),
+
+                    opt_accuracy(o, "accuracy", { "fast", "full" }, "full"),
+                    n_alpha("fast" == opt_accuracy.value() ? 3u : 6u),
+                    _parameters(p)
                 {
                     this->uses(*form_factors);
                 }
@@ -418,7 +498,7 @@ namespace eos
                     const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z_Jpsi);
-                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
 
                     const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_Jpsi2, -0.5) * pow(pow(s_p - m_Jpsi2, 0.5) + pow(s_p - s_0, 0.5), -2);
 
@@ -437,7 +517,7 @@ namespace eos
                     const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z_psi2S);
-                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
 
                     const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_psi2S2, -0.5) * pow(pow(s_p - m_psi2S2, 0.5) + pow(s_p - s_0, 0.5), -2);
 
@@ -446,25 +526,16 @@ namespace eos
 
                 virtual complex<double> H_perp(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_perp.begin(), alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(snapshot.alpha_perp.begin(), snapshot.alpha_perp.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, snapshot.z_Jpsi, snapshot.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
@@ -478,14 +549,7 @@ namespace eos
 
                 virtual complex<double> Hhat_perp(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
@@ -493,32 +557,23 @@ namespace eos
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_perp.begin(), alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(snapshot.alpha_perp.begin(), snapshot.alpha_perp.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
                 virtual complex<double> H_para(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, snapshot.z_Jpsi, snapshot.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
                     const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_para.begin(), alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(snapshot.alpha_para.begin(), snapshot.alpha_para.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -530,14 +585,7 @@ namespace eos
 
                 virtual complex<double> Hhat_para(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
@@ -545,32 +593,23 @@ namespace eos
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_para.begin(), alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(snapshot.alpha_para.begin(), snapshot.alpha_para.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
                 virtual complex<double> H_long(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, snapshot.z_Jpsi, snapshot.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
                     const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_long.begin(), alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(snapshot.alpha_long.begin(), snapshot.alpha_long.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -582,14 +621,7 @@ namespace eos
 
                 virtual complex<double> Hhat_long(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
+                    const Snapshot & snapshot = _cache();
 
                     const double s_0   = this->t_0();
                     const double s_p   = 4.0 * power_of<2>(m_D0);
@@ -597,104 +629,50 @@ namespace eos
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_long.begin(), alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(snapshot.alpha_long.begin(), snapshot.alpha_long.begin() + n_alpha, polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
 
                 virtual complex<double> H_perp_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, alpha_perp);
+                    return H_residue_jpsi(phi_parameters, _cache().alpha_perp);
                 }
 
                 virtual complex<double> H_perp_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, alpha_perp);
+                    return H_residue_psi2s(phi_parameters, _cache().alpha_perp);
                 }
 
                 virtual complex<double> H_para_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, alpha_para);
+                    return H_residue_jpsi(phi_parameters, _cache().alpha_para);
                 }
 
                 virtual complex<double> H_para_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, alpha_para);
+                    return H_residue_psi2s(phi_parameters, _cache().alpha_para);
                 }
 
                 virtual complex<double> H_long_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_jpsi(phi_parameters, alpha_long);
+                    return H_residue_jpsi(phi_parameters, _cache().alpha_long);
                 }
 
                 virtual complex<double> H_long_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_psi2s(phi_parameters, alpha_long);
+                    return H_residue_psi2s(phi_parameters, _cache().alpha_long);
                 }
 
                 virtual complex<double> ratio_perp(const complex<double> & q2) const
@@ -776,46 +754,21 @@ namespace eos
                 virtual complex<double> normalized_moment_V23(const double &) const
                 {
                     return 0.0;
-                }                virtual complex<double> get_orthonormal_perp_coefficients(const unsigned & i) const
-                {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
+                }
 
-                    return alpha_perp[i];
+                virtual complex<double> get_orthonormal_perp_coefficients(const unsigned & i) const
+                {
+                    return _cache().alpha_perp[i];
                 }
 
                 virtual complex<double> get_orthonormal_para_coefficients(const unsigned & i) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
-                    return alpha_para[i];
+                    return _cache().alpha_para[i];
                 }
 
                 virtual complex<double> get_orthonormal_long_coefficients(const unsigned & i) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
-                    return alpha_long[i];
+                    return _cache().alpha_long[i];
                 }
 
                 virtual double weak_bound() const
@@ -33,7 +33,8 @@
 #include <eos/scattering/observables.hh>
 #include <eos/utils/expression-fwd.hh>
 #include <eos/utils/expression-observable.hh>
-#include <eos/utils/expression-parser-impl.hh>
+#include <eos/utils/expression-parser.hh>
+#include <eos/utils/frozen-observable.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_stub.hh>
@@ -41,7 +42,9 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
 
 namespace eos
 {
@@ -50,21 +53,130 @@ namespace eos
         std::map<QualifiedName, ObservableEntryPtr> observable_entries;
     }
 
+    class ObservableSections : public InstantiationPolicy<ObservableSections, Singleton>
+    {
+        private:
+            using SectionFactory = ObservableSection (*)();
+
+            // factories for the sections that have not been materialized yet;
+            // consumed front to back, so that the entry registry fills in the
+            // same order as the former eager construction
+            std::vector<SectionFactory> _factories;
+            std::size_t _next;
+            std::vector<ObservableSection> _sections;
+            std::atomic<bool> _complete;
+            mutable std::mutex _mutex;
+
+            ObservableSections() :
+                _factories({ &make_b_decays_section,
+                             &make_c_decays_section,
+                             &make_rare_b_decays_section,
+                             &make_meson_mixing_section,
+                             &make_nonleptonic_amplitudes_section,
+                             &make_nonlocal_form_factors_section,
+                             &make_form_factors_section,
+                             &make_scattering_section }),
+                _next(0),
+                _complete(false)
+            {
+            }
+
+            ~ObservableSections() = default;
+
+            // materialize one further section and merge its entries into the
+            // shared registry; requires holding _mutex
+            bool _materialize_one()
+            {
+                if (_factories.size() == _next)
+                {
+                    return false;
+                }
+
+                _sections.push_back(_factories[_next]());
+                ++_next;
+
+                for (const auto & group : _sections.back())
+                {
+                    impl::observable_entries.insert(group.begin(), group.end());
+                }
+
+                if (_factories.size() == _next)
+                {
+                    _complete.store(true, std::memory_order_release);
+
+                    Log::instance()->message("ObservableSections::materialize", ll_debug) << "Total number of registered observables: " << impl::observable_entries.size();
+                }
+
+                return true;
+            }
+
+        public:
+            friend class InstantiationPolicy<ObservableSections, Singleton>;
+
+            /// Returns true once all sections have been materialized.
+            bool
+            complete() const
+            {
+                return _complete.load(std::memory_order_acquire);
+            }
+
+            // Look up an entry, materializing further sections only as long as
+            // the name has not been found.
+            ObservableEntryPtr
+            lookup(const QualifiedName & qn)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                do
+                {
+                    auto i = impl::observable_entries.find(qn);
+                    if (impl::observable_entries.end() != i)
+                    {
+                        return i->second;
+                    }
+                }
+                while (_materialize_one());
+
+                return {};
+            }
+
+            // Materialize every remaining section, for consumers that iterate
+            // the full registry.
+            const std::vector<ObservableSection> &
+            sections()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                while (_materialize_one())
+                {
+                }
+
+                return _sections;
+            }
+    };
+
     ObservableEntries::ObservableEntries() :
         _entries(&impl::observable_entries)
     {
-        std::vector<std::function<ObservableSection()>> section_makers = {
-            make_form_factors_section, make_nonlocal_form_factors_section, make_nonleptonic_amplitudes_section, make_b_decays_section,
-            make_c_decays_section,     make_rare_b_decays_section,         make_meson_mixing_section,           make_scattering_section
-        };
+        // the sections materialize lazily, driven by find() misses; cf. ObservableSections
+    }
+
+    ObservableEntryPtr
+    ObservableEntries::find(const QualifiedName & key) const
+    {
+        // bypass the registry lock once all sections have been materialized
+        if (! ObservableSections::instance()->complete())
+        {
+            return ObservableSections::instance()->lookup(key);
+        }
 
-        for (const auto & section_maker : section_makers)
+        auto i = _entries->find(key);
+        if (_entries->end() != i)
         {
-            for (const auto & group : section_maker())
-            {
-                _entries->insert(group.begin(), group.end());
-            }
+            return i->second;
         }
+
+        return {};
     }
 
     ObservableEntries::~ObservableEntries() = default;
@@ -83,14 +195,12 @@ namespace eos
     ObservablePtr
     Observable::make(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & _options)
     {
-        const std::map<QualifiedName, std::shared_ptr<const ObservableEntry>> & observable_entries = ObservableEntries::instance()->entries();
-
         // check if 'name' matches a simple observable
         {
-            auto i = observable_entries.find(name);
-            if (observable_entries.end() != i)
+            auto entry = ObservableEntries::instance()->find(name);
+            if (entry)
             {
-                return i->second->make(parameters, kinematics, name.options() + _options);
+                return entry->make(parameters, kinematics, name.options() + _options);
             }
         }
 
@@ -109,38 +219,11 @@ namespace eos
         return ObservablePtr();
     }
 
-    class ObservableSections : public InstantiationPolicy<ObservableSections, Singleton>
+    ObservablePtr
+    Observable::freeze(const Parameters & parameters) const
     {
-        private:
-            std::vector<ObservableSection> _sections;
-
-            ObservableSections()
-            {
-                // ensure that the observable entries have been generated already
-                auto entries = std::distance(ObservableEntries::instance()->entries().begin(), ObservableEntries::instance()->entries().end());
-                Log::instance()->message("ObservableSections::ObservableSections()", ll_debug) << "Total number of registered observables: " << entries;
-
-                _sections = std::vector<ObservableSection>({ make_b_decays_section(),
-                                                             make_c_decays_section(),
-                                                             make_rare_b_decays_section(),
-                                                             make_meson_mixing_section(),
-                                                             make_nonleptonic_amplitudes_section(),
-                                                             make_nonlocal_form_factors_section(),
-                                                             make_form_factors_section(),
-                                                             make_scattering_section() });
-            }
-
-            ~ObservableSections() = default;
-
-        public:
-            friend class InstantiationPolicy<ObservableSections, Singleton>;
-
-            const std::vector<ObservableSection> &
-            sections() const
-            {
-                return _sections;
-            }
-    };
+        return ObservablePtr(new FrozenObservable(this->clone(parameters)));
+    }
 
     /* ObservableEntry */
 
@@ -242,15 +325,9 @@ namespace eos
 
     template <> struct Implementation<Observables>
     {
-            std::vector<ObservableSection> observable_sections;
-
-            std::map<QualifiedName, ObservableEntryPtr> observable_entries;
-
-            Implementation() :
-                observable_sections(ObservableSections::instance()->sections()),
-                observable_entries(ObservableEntries::instance()->entries())
-            {
-            }
+            // the sections and entries are shared with every other Observables
+            // object through the ObservableSections and ObservableEntries
+            // singletons, and materialize on demand; there is no per-instance state
     };
 
     Observables::Observables() :
@@ -263,20 +340,27 @@ namespace eos
     ObservableEntryPtr
     Observables::operator[] (const QualifiedName & qn) const
     {
-        const auto & observable_entries = ObservableEntries::instance()->entries();
-
-        auto i = observable_entries.find(qn);
-        if (i != observable_entries.end())
+        auto entry = ObservableEntries::instance()->find(qn);
+        if (entry)
         {
-            return i->second;
+            return entry;
         }
 
         throw UnknownObservableError("'" + qn.full() + "' not known");
     }
 
+    void
+    Observables::preload()
+    {
+        ObservableSections::instance()->sections();
+    }
+
     Observables::ObservableIterator
     Observables::begin() const
     {
+        // iteration requires the full registry
+        preload();
+
         const auto & observable_entries = ObservableEntries::instance()->entries();
 
         return ObservableIterator(observable_entries.begin());
@@ -285,6 +369,8 @@ namespace eos
     Observables::ObservableIterator
     Observables::end() const
     {
+        preload();
+
         const auto & observable_entries = ObservableEntries::instance()->entries();
 
         return ObservableIterator(observable_entries.end());
@@ -293,13 +379,13 @@ namespace eos
     Observables::SectionIterator
     Observables::begin_sections() const
     {
-        return SectionIterator(_imp->observable_sections.begin());
+        return SectionIterator(ObservableSections::instance()->sections().begin());
     }
 
     Observables::SectionIterator
     Observables::end_sections() const
     {
-        return SectionIterator(_imp->observable_sections.end());
+        return SectionIterator(ObservableSections::instance()->sections().end());
     }
 
     void
@@ -307,11 +393,7 @@ namespace eos
     {
         eos::exp::Expression expression;
 
-        using It = std::string::const_iterator;
-        ExpressionParser<It> parser;
-
-        It   first(input.begin()), last(input.end());
-        bool completed = qi::phrase_parse(first, last, parser, ascii::space, expression) && (first == last);
+        bool completed = parse_expression(input, expression);
 
         if ((! completed) || expression.empty())
         {
@@ -331,16 +413,7 @@ namespace eos
     bool
     Observables::has(const QualifiedName & name)
     {
-        auto i(_imp->observable_entries.find(name));
-
-        if (_imp->observable_entries.end() == i)
-        {
-            return false;
-        }
-        else
-        {
-            return true;
-        }
+        return static_cast<bool>(ObservableEntries::instance()->find(name));
     }
 
     std::pair<QualifiedName, ObservableEntryPtr>
@@ -353,13 +426,7 @@ namespace eos
         Expression          expression;
 
         {
-            bool completed;
-
-            using It = std::string::const_iterator;
-            ExpressionParser<It> parser;
-
-            It first(input.begin()), last(input.end());
-            completed = qi::phrase_parse(first, last, parser, ascii::space, expression) && (first == last);
+            bool completed = parse_expression(input, expression);
 
             if (! completed)
             {
@@ -57,6 +57,18 @@ namespace eos
 
             virtual ObservablePtr clone(const Parameters & parameters) const = 0;
 
+            /*!
+             * Produce a specialized observable bound to a frozen parameter snapshot.
+             *
+             * The returned observable clones this observable with the given parameters
+             * and memoizes its value: as long as none of the parameters it actually uses
+             * is modified, repeated evaluations reduce to a generation comparison and a
+             * load. Intended for deployments that fix most parameters permanently.
+             *
+             * @param parameters The parameter snapshot against which to freeze.
+             */
+            ObservablePtr freeze(const Parameters & parameters) const;
+
             static ObservablePtr make(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options);
 
             using ParameterUser::uses;
@@ -224,6 +236,16 @@ namespace eos
              */
             void insert(const QualifiedName & name, const std::string & latex, const Unit & unit, const Options & options, const std::string & expression) const;
 
+            /*!
+             * Materialize all sections of the observable registry at once.
+             *
+             * Name look-ups materialize the per-section registry shards on
+             * demand; tools that genuinely iterate everything (such as
+             * eos-list-observables) can preload to pay the full cost up front.
+             * Iteration over observables or sections preloads implicitly.
+             */
+            static void preload();
+
             /*!
              * Verify if an observable with a given name exists.
              *
@@ -247,12 +269,19 @@ namespace eos
         public:
             friend class InstantiationPolicy<ObservableEntries, Singleton>;
 
+            /// Returns the entries registered so far; does not materialize pending sections.
             inline const std::map<QualifiedName, std::shared_ptr<const ObservableEntry>> &
             entries() const
             {
                 return *_entries;
             }
 
+            /*!
+             * Look up an entry by name, materializing further registry sections on demand.
+             * @return The entry, or nullptr if the name is not known.
+             */
+            std::shared_ptr<const ObservableEntry> find(const QualifiedName & key) const;
+
             void insert_or_assign(const QualifiedName & key, const std::shared_ptr<const ObservableEntry> & value);
     };
 } // namespace eos
@@ -0,0 +1,256 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/prediction-grid.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+namespace eos
+{
+    namespace
+    {
+        /*
+         * One independent evaluation context per pool thread: a clone of the
+         * parameters, and all observables at all grid points registered with a
+         * single ObservableCache. The cache evaluates expensive intermediate
+         * results (amplitudes) once per sample and grid point, shared across
+         * the observables.
+         */
+        struct PredictionGridWorker
+        {
+                Parameters parameters;
+
+                ObservableCache cache;
+
+                // cache ids in (point, observable) order
+                std::vector<ObservableCache::Id> ids;
+
+                PredictionGridWorker(const std::vector<QualifiedName> & observable_names, const Parameters & _parameters, const Options & options,
+                        const std::vector<std::string> & kinematic_names, const std::vector<double> & grid_points) :
+                    parameters(_parameters.clone()),
+                    cache(parameters)
+                {
+                    const unsigned n_variables = kinematic_names.size();
+                    const unsigned n_points    = (n_variables > 0) ? grid_points.size() / n_variables : 1;
+
+                    for (unsigned p = 0 ; p < n_points ; ++p)
+                    {
+                        Kinematics kinematics;
+                        for (unsigned v = 0 ; v < n_variables ; ++v)
+                        {
+                            kinematics.declare(kinematic_names[v], grid_points[p * n_variables + v]);
+                        }
+
+                        for (const auto & name : observable_names)
+                        {
+                            ObservablePtr observable = Observable::make(name, parameters, kinematics, options);
+                            if (! observable)
+                                throw UnknownObservableError("PredictionGrid: unknown observable '" + name.full() + "'");
+
+                            ids.push_back(cache.add(observable));
+                        }
+                    }
+                }
+
+                PredictionGridWorker(const PredictionGridWorker &) = delete;
+                PredictionGridWorker & operator= (const PredictionGridWorker &) = delete;
+
+                /*
+                 * Evaluate n samples, laid out row-major with one column per
+                 * varied parameter, writing ids.size() predictions per sample.
+                 */
+                void predict(const unsigned & n, std::vector<Parameter> & varied, const double * samples, double * results)
+                {
+                    const unsigned n_varied = varied.size();
+
+                    for (unsigned s = 0 ; s < n ; ++s)
+                    {
+                        for (unsigned v = 0 ; v < n_varied ; ++v)
+                        {
+                            varied[v].set(samples[s * n_varied + v]);
+                        }
+
+                        cache.update();
+
+                        double * r = results + s * static_cast<size_t>(ids.size());
+                        for (unsigned i = 0, i_end = ids.size() ; i < i_end ; ++i)
+                        {
+                            r[i] = cache[ids[i]];
+                        }
+                    }
+                }
+        };
+    } // namespace
+
+    template <> struct Implementation<PredictionGrid>
+    {
+            unsigned n_observables;
+            unsigned n_points;
+
+            std::vector<std::shared_ptr<PredictionGridWorker>> workers;
+
+            Implementation(const std::vector<QualifiedName> & observable_names, const Parameters & parameters, const Options & options,
+                    const std::vector<std::string> & kinematic_names, const std::vector<double> & grid_points) :
+                n_observables(observable_names.size()),
+                n_points(0)
+            {
+                if (observable_names.empty())
+                    throw InternalError("PredictionGrid: no observables given");
+
+                if (kinematic_names.empty())
+                {
+                    // degenerate grid: a single point without grid kinematics, e.g. when all
+                    // kinematic variables are fixed or the observables do not have any
+                    if (! grid_points.empty())
+                        throw InternalError("PredictionGrid: grid of " + stringify(grid_points.size()) + " values given without kinematic variables");
+
+                    n_points = 1;
+                }
+                else
+                {
+                    if ((grid_points.empty()) || (0 != grid_points.size() % kinematic_names.size()))
+                        throw InternalError("PredictionGrid: grid of " + stringify(grid_points.size()) + " values does not factorize into points of "
+                                + stringify(kinematic_names.size()) + " kinematic variables");
+
+                    n_points = grid_points.size() / kinematic_names.size();
+                }
+
+                // one evaluation context per pool thread, each with an
+                // independent clone of the parameters and observables
+                const unsigned number_of_workers = std::max(1u, ThreadPool::instance()->number_of_threads());
+                for (unsigned w = 0 ; w < number_of_workers ; ++w)
+                {
+                    workers.push_back(std::make_shared<PredictionGridWorker>(observable_names, parameters, options, kinematic_names, grid_points));
+                }
+            }
+
+            std::vector<double>
+            evaluate(const std::vector<std::string> & varied_names, const std::vector<double> & samples)
+            {
+                if (varied_names.empty())
+                {
+                    // degenerate sample matrix: a single evaluation at the nominal parameter point
+                    if (! samples.empty())
+                        throw InternalError("PredictionGrid: sample matrix of " + stringify(samples.size()) + " values given without varied parameters");
+                }
+                else if (0 != samples.size() % varied_names.size())
+                {
+                    throw InternalError("PredictionGrid: sample matrix of " + stringify(samples.size()) + " values does not factorize into samples of "
+                            + stringify(varied_names.size()) + " varied parameters");
+                }
+
+                const unsigned n_samples = varied_names.empty() ? 1 : samples.size() / varied_names.size();
+                const size_t   stride    = static_cast<size_t>(n_points) * n_observables;
+
+                std::vector<double> results(n_samples * stride);
+
+                // split the samples into one contiguous range per worker
+                const unsigned chunk = n_samples / workers.size() + 1;
+                unsigned offset = 0;
+
+                std::vector<Ticket> tickets;
+                std::vector<std::exception_ptr> errors(workers.size());
+
+                for (unsigned w = 0 ; w < workers.size() ; ++w)
+                {
+                    const unsigned size = std::min(chunk, n_samples - offset);
+                    if (0 == size)
+                    {
+                        break;
+                    }
+
+                    PredictionGridWorker * worker = workers[w].get();
+
+                    // resolve the varied parameters against this worker's clone
+                    std::vector<Parameter> varied;
+                    for (const auto & name : varied_names)
+                    {
+                        varied.push_back(worker->parameters[name]);
+                    }
+
+                    const double * s = samples.data() + offset * static_cast<size_t>(varied_names.size());
+                    double * r = results.data() + offset * stride;
+                    std::exception_ptr * error = &errors[w];
+
+                    auto f = [worker, size, varied, s, r, error] () mutable
+                    {
+                        try
+                        {
+                            worker->predict(size, varied, s, r);
+                        }
+                        catch (...)
+                        {
+                            *error = std::current_exception();
+                        }
+                    };
+
+                    tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+
+                    offset += size;
+                }
+
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                        std::rethrow_exception(error);
+                }
+
+                return results;
+            }
+    };
+
+    PredictionGrid::PredictionGrid(const std::vector<QualifiedName> & observable_names, const Parameters & parameters, const Options & options,
+            const std::vector<std::string> & kinematic_names, const std::vector<double> & grid_points) :
+        PrivateImplementationPattern<PredictionGrid>(new Implementation<PredictionGrid>(observable_names, parameters, options, kinematic_names, grid_points))
+    {
+    }
+
+    PredictionGrid::~PredictionGrid() {}
+
+    unsigned
+    PredictionGrid::number_of_observables() const
+    {
+        return _imp->n_observables;
+    }
+
+    unsigned
+    PredictionGrid::number_of_points() const
+    {
+        return _imp->n_points;
+    }
+
+    std::vector<double>
+    PredictionGrid::evaluate(const std::vector<std::string> & varied_names, const std::vector<double> & samples)
+    {
+        return _imp->evaluate(varied_names, samples);
+    }
+} // namespace eos
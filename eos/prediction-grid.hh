@@ -0,0 +1,97 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_PREDICTION_GRID_HH
+#define EOS_GUARD_EOS_PREDICTION_GRID_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Evaluates a list of observables on a grid of kinematic points for many
+     * parameter samples at once.
+     *
+     * The loops are ordered for locality: samples outermost, kinematic points
+     * and observables innermost. Within one sample, all observables at all
+     * grid points share a single ObservableCache, so the expensive
+     * intermediate results of CacheableObservables (e.g. the transversity
+     * amplitudes entering the B->K^*ll angular observables) are computed once
+     * per sample and kinematic point, not once per observable. The samples are
+     * split across the thread pool, with one independent clone of the
+     * parameters and observables per pool thread.
+     *
+     * This replaces the triple Python loop over (samples, points, observables)
+     * that band plots were generated from.
+     */
+    class PredictionGrid : public PrivateImplementationPattern<PredictionGrid>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param observable_names Names of the observables that shall be evaluated at every grid point.
+             * @param parameters       Parameters at which the observables shall be evaluated.
+             * @param options          Options used in the construction of the observables.
+             * @param kinematic_names  Names of the kinematic variables spanning the grid, in column order. May be empty
+             *                         together with grid_points, in which case the grid degenerates to a single point
+             *                         without kinematic variables.
+             * @param grid_points      The grid as one contiguous block of row-major layout and shape (number of points, kinematic_names.size()).
+             */
+            PredictionGrid(const std::vector<QualifiedName> & observable_names, const Parameters & parameters, const Options & options,
+                    const std::vector<std::string> & kinematic_names, const std::vector<double> & grid_points);
+
+            /// Destructor.
+            ~PredictionGrid();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of observables per grid point.
+            unsigned number_of_observables() const;
+
+            /// Retrieve the number of kinematic points in the grid.
+            unsigned number_of_points() const;
+
+            /*!
+             * Evaluate all observables at all grid points for each of the given
+             * parameter samples.
+             *
+             * @param varied_names Names of the parameters varied across the samples, in column order. May be empty
+             *                     together with samples, in which case the observables are evaluated once at the
+             *                     nominal parameter point.
+             * @param samples      The samples as one contiguous block of row-major layout and shape (number of samples, varied_names.size()).
+             * @return The predictions as one contiguous block of row-major layout and shape
+             *         (number of samples, number_of_points(), number_of_observables()).
+             */
+            std::vector<double> evaluate(const std::vector<std::string> & varied_names, const std::vector<double> & samples);
+            ///@}
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,150 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/prediction-grid.hh>
+#include <eos/utils/exception.hh>
+
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class PredictionGridTest : public TestCase
+{
+    public:
+        PredictionGridTest() :
+            TestCase("prediction_grid_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            const std::vector<QualifiedName> names{ "B->D^*lnu::S_1c", "B->D^*lnu::S_3" };
+            const Options options{
+                { "l", "mu" }
+            };
+            const std::vector<std::string> kinematic_names{ "q2_min", "q2_max" };
+            const std::vector<double> grid{
+                // clang-format off
+                 4.00,  6.00,
+                 6.00,  8.00,
+                 8.00, 10.68
+                // clang-format on
+            };
+
+            const std::vector<std::string> varied{ "mass::D_d^*" };
+            const std::vector<double> samples{ 2.00, 2.01, 2.02, 2.03 };
+
+            // predictions agree with direct observable evaluation, sample by sample
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                PredictionGrid pg(names, parameters, options, kinematic_names, grid);
+                TEST_CHECK_EQUAL(pg.number_of_observables(), 2u);
+                TEST_CHECK_EQUAL(pg.number_of_points(), 3u);
+
+                auto results = pg.evaluate(varied, samples);
+                TEST_CHECK_EQUAL(results.size(), samples.size() * 3u * 2u);
+
+                // reference evaluation with the plain triple loop
+                Parameters ref_parameters = Parameters::Defaults();
+                for (unsigned s = 0 ; s < samples.size() ; ++s)
+                {
+                    ref_parameters["mass::D_d^*"] = samples[s];
+
+                    for (unsigned p = 0 ; p < 3u ; ++p)
+                    {
+                        Kinematics kinematics{
+                            { "q2_min", grid[2 * p + 0] },
+                            { "q2_max", grid[2 * p + 1] }
+                        };
+
+                        for (unsigned o = 0 ; o < names.size() ; ++o)
+                        {
+                            auto observable = Observable::make(names[o], ref_parameters, kinematics, options);
+                            TEST_CHECK_RELATIVE_ERROR(results[(s * 3u + p) * 2u + o], observable->evaluate(), eps);
+                        }
+                    }
+                }
+
+                // the caller's parameters are not disturbed by the sweep
+                TEST_CHECK(2.00 != static_cast<double>(parameters["mass::D_d^*"]));
+            }
+
+            // degenerate cases: no varied parameters, and no grid kinematics
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                // without varied parameters, a single evaluation at the nominal parameter point
+                PredictionGrid pg(names, parameters, options, kinematic_names, grid);
+                auto nominal = pg.evaluate({}, {});
+                TEST_CHECK_EQUAL(nominal.size(), 3u * 2u);
+
+                for (unsigned p = 0 ; p < 3u ; ++p)
+                {
+                    Kinematics kinematics{
+                        { "q2_min", grid[2 * p + 0] },
+                        { "q2_max", grid[2 * p + 1] }
+                    };
+
+                    for (unsigned o = 0 ; o < names.size() ; ++o)
+                    {
+                        auto observable = Observable::make(names[o], parameters, kinematics, options);
+                        TEST_CHECK_RELATIVE_ERROR(nominal[p * 2u + o], observable->evaluate(), eps);
+                    }
+                }
+
+                // without kinematic variables, a single grid point; a parameter as observable needs none
+                PredictionGrid pg_parameter({ "mass::D_d^*" }, parameters, options, {}, {});
+                TEST_CHECK_EQUAL(pg_parameter.number_of_points(), 1u);
+
+                auto results = pg_parameter.evaluate(varied, samples);
+                TEST_CHECK_EQUAL(results.size(), samples.size());
+                for (unsigned s = 0 ; s < samples.size() ; ++s)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(results[s], samples[s], eps);
+                }
+            }
+
+            // invalid inputs: must throw
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                // unknown observable
+                TEST_CHECK_THROWS(UnknownObservableError, PredictionGrid({ "B->D^*lnu::does_not_exist" }, parameters, options, kinematic_names, grid));
+
+                // grid does not factorize
+                TEST_CHECK_THROWS(InternalError, PredictionGrid(names, parameters, options, kinematic_names, { 4.00, 6.00, 8.00 }));
+
+                // grid values given without kinematic variables
+                TEST_CHECK_THROWS(InternalError, PredictionGrid(names, parameters, options, {}, { 4.00 }));
+
+                PredictionGrid pg(names, parameters, options, kinematic_names, grid);
+
+                // sample matrix does not factorize
+                TEST_CHECK_THROWS(InternalError, pg.evaluate({ "mass::D_d^*", "mass::D_u^*" }, { 2.00, 2.01, 2.02 }));
+
+                // sample values given without varied parameters
+                TEST_CHECK_THROWS(InternalError, pg.evaluate({}, { 2.00 }));
+            }
+        }
+} prediction_grid_test;
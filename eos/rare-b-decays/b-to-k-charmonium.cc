@@ -107,7 +107,7 @@ namespace eos
         {
             const auto lambda = eos::lambda(power_of<2>(m_B), power_of<2>(m_K), power_of<2>(m_psi));
             const auto prefactor = m_B * power_of<2>(g_fermi * abs(model->ckm_cb() * conj(model->ckm_cs())) / f_psi / power_of<2>(m_psi))
-                    * tau_B() / hbar() * pow(lambda, 1.5) / ( 2.0 * M_PI );
+                    * tau_B() / hbar() * lambda * std::sqrt(lambda) / ( 2.0 * M_PI );
 
             return prefactor * norm(this->residue_H_plus());
         }
@@ -176,11 +176,11 @@ namespace eos
         // cf. [BHP2007], Eq. (B.2) and [BFS2001], Eqs. (38), p. 9
         complex<double> C1nf_top_psd = -(+1.0 / QCD::casimir_f) * (
                 (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
-                + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
                 + (m_B / (2.0 * m_b_PS)) * (
                     wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
                     + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
-                    + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
+                    + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)));
 
         /* parallel, up sector */
         // cf. [BHP2007], Eq. (B.2) and [BFS2004], comment before Eq. (43), p. 24
@@ -191,10 +191,10 @@ namespace eos
         // Use here FF_massive - FF_massless because FF_massless is defined with an extra '-'
         // compared to [S2004]
         complex<double> C1nf_up_psd = -(+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS))
+                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS))));
 
         // compute the factorizing contributions
         complex<double> C_psd = C0_top_psd + lambda_hat_u * C0_up_psd
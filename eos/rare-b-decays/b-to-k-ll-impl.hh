@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_IMPL_HH
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_IMPL_HH 1
+
+#include <eos/observable.hh>
+#include <eos/rare-b-decays/b-to-k-ll.hh>
+
+#include <array>
+
+namespace eos
+{
+    struct BToKDilepton::AngularCoefficients
+    {
+        double a_l, b_l, c_l;
+
+        AngularCoefficients()
+        {
+        }
+
+        AngularCoefficients(const std::array<double, 3> & a) :
+            a_l(a[0]),
+            b_l(a[1]),
+            c_l(a[2])
+        {
+        }
+    };
+
+    class BToKDilepton::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            BToKDilepton::AngularCoefficients ac;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
+}
+
+#endif
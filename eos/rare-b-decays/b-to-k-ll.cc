@@ -22,9 +22,11 @@
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/rare-b-decays/b-to-k-ll-base.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/rare-b-decays/b-to-k-ll-bfs2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gp2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gvdv2020.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
 
@@ -34,22 +36,6 @@ namespace eos
     using std::norm;
     using std::sqrt;
 
-    struct BToKDilepton::AngularCoefficients
-    {
-        double a_l, b_l, c_l;
-
-        AngularCoefficients()
-        {
-        }
-
-        AngularCoefficients(const std::array<double, 3> & a) :
-            a_l(a[0]),
-            b_l(a[1]),
-            c_l(a[2])
-        {
-        }
-    };
-
     /*!
      * Implementation for the decay @f$\bar{B} \to \bar{K} \ell^+ \ell^-@f$.
      */
@@ -70,6 +56,12 @@ namespace eos
         UsedParameter tau;
         UsedParameter mu;
 
+        using IntermediateResult = BToKDilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -81,7 +73,8 @@ namespace eos
             m_K(p["mass::K_" + opt_q.str()], u),
             m_l(p["mass::" + opt_l.str()], u),
             tau(p["life_time::B_" + opt_q.str()], u),
-            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u)
+            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u),
+            n_integration_points(integration_points(o, 64, "B->Kll::angular_coefficients"))
         {
             Context ctx("When constructing B->Kll observables");
 
@@ -178,11 +171,17 @@ namespace eos
         {
             std::function<std::array<double, 3> (const double &)> integrand =
                     std::bind(&Implementation<BToKDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 3> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::array<double, 3> integrated_angular_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
             return BToKDilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
 
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.ac = integrated_angular_coefficients(s_min, s_max);
+            return &intermediate_result;
+        }
+
         inline double beta_l(const double & s) const
         {
             return sqrt(1.0 - 4.0 * m_l * m_l / s);
@@ -275,6 +274,36 @@ namespace eos
 
     }
 
+    const BToKDilepton::IntermediateResult *
+    BToKDilepton::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
+    double
+    BToKDilepton::integrated_decay_width(const IntermediateResult * ir) const
+    {
+        return _imp->unnormalized_decay_width(ir->ac);
+    }
+
+    double
+    BToKDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return _imp->differential_branching_ratio(ir->ac);
+    }
+
+    double
+    BToKDilepton::integrated_flat_term(const IntermediateResult * ir) const
+    {
+        return _imp->differential_flat_term_numerator(ir->ac) / _imp->unnormalized_decay_width(ir->ac);
+    }
+
+    double
+    BToKDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
+    {
+        return _imp->differential_forward_backward_asymmetry_numerator(ir->ac) / _imp->unnormalized_decay_width(ir->ac);
+    }
+
 
     const std::string
     BToKDilepton::description = "\
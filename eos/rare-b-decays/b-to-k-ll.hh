@@ -19,7 +19,7 @@
  */
 
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH
-#define EOS_GUARD_SRC_RARE_B_DECAYS_B_TO_K_LL_HH 1
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH 1
 
 #include <eos/maths/complex.hh>
 #include <eos/utils/options.hh>
@@ -45,6 +45,7 @@ namespace eos
             struct Amplitudes;
             class AmplitudeGenerator;
             struct DipoleFormFactors;
+            class IntermediateResult;
 
             // Differential Observables
             double differential_branching_ratio(const double & s) const;
@@ -62,6 +63,14 @@ namespace eos
             double integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
             double integrated_ratio_muons_electrons(const double & s_min, const double & s_max) const;
 
+            // Integrated Observables, sharing one quadrature sweep over the
+            // angular coefficients through the intermediate result
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+            double integrated_decay_width(const IntermediateResult * ir) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_flat_term(const IntermediateResult * ir) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult * ir) const;
+
             /*!
              * Descriptions of the process and its kinematics.
              */
@@ -159,7 +159,7 @@ namespace eos
         {
             const auto amps = amplitudes_bcvdv2016();
             const auto lambda = eos::lambda(power_of<2>(m_B), power_of<2>(m_Kstar), power_of<2>(m_psi));
-            const auto prefactor = pow(g_fermi * abs(model->ckm_cb() * conj(model->ckm_cs())), 2)
+            const auto prefactor = power_of<2>(g_fermi * abs(model->ckm_cb() * conj(model->ckm_cs())))
                     * tau_B() / hbar() * sqrt(lambda) / (2.0 * M_PI * m_B);
 
             return prefactor * (norm(amps.A_perp) + norm(amps.A_para) + power_of<2>(m_B/m_psi) * norm(amps.A_long));
@@ -26,6 +26,7 @@
 #include <eos/nonlocal-form-factors/hard-scattering.hh>
 #include <eos/nonlocal-form-factors/long-distance.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
+#include <eos/rare-b-decays/qcdf-integrals-cached.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/memoise.hh>
@@ -107,9 +108,32 @@ namespace eos
             qcdf_dilepton_bottom_case = std::bind(&QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>::dilepton_bottom_case,
                         _1, _2, _3, _4, _5, _6, _7, _8, _9);
         }
+        else if ("cached" == qcdf_integrals)
+        {
+            // as "analytical", but tabulates the q^2 dependence of the integrals on
+            // Chebyshev grids covering the large-recoil region whenever the masses,
+            // the scale, or the Gegenbauer moments change; evaluations outside the
+            // tabulated region fall through to the direct analytical calculator
+            auto cache = std::make_shared<QCDFIntegralCache<BToKstarDilepton, tag::Analytical>>(0.1, 9.6);
+            qcdf_dilepton_massless_case = [cache] (const double & s, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp, const double & a_1_parallel, const double & a_2_parallel)
+            {
+                return cache->dilepton_massless_case(s, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+            };
+            qcdf_dilepton_charm_case = [cache] (const double & s, const double & m_c, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp, const double & a_1_parallel, const double & a_2_parallel)
+            {
+                return cache->dilepton_charm_case(s, m_c, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+            };
+            qcdf_dilepton_bottom_case = [cache] (const double & s, const double & m_b, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp, const double & a_1_parallel, const double & a_2_parallel)
+            {
+                return cache->dilepton_bottom_case(s, m_b, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+            };
+        }
         else
         {
-            throw InvalidOptionValueError("qcdf-integrals", qcdf_integrals, "mixed, numerical, analytical");
+            throw InvalidOptionValueError("qcdf-integrals", qcdf_integrals, "mixed, numerical, analytical, cached");
         }
     }
 
@@ -195,11 +219,11 @@ namespace eos
         complex<double> C1f_top_perp_right = (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu()) - L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BFS2001], Eqs. (34), (37), p. 9
         complex<double> C1nf_top_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
                 + (s / (2.0 * m_b_PS * m_B)) * (
                     wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
                     + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
-                    + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
+                    + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)));
 
         /* perpendicular, up sector */
         // cf. [BFS2004], comment before Eq. (43), p. 24
@@ -208,10 +232,10 @@ namespace eos
         // cf. [BFS2001], Eqs. (34), (37), p. 9
         // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
                 + (s / (2.0 * m_b_PS * m_B)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS))
+                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS))));
 
         /* parallel, top sector */
         // cf. [BFS2001], Eqs. (14), (15), p. 5, in comparison with \delta_{2,3} = 1
@@ -221,11 +245,11 @@ namespace eos
         // cf. [BFS2001], Eqs. (38), p. 9
         complex<double> C1nf_top_par = (+1.0 / QCD::casimir_f) * (
                 (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
-                + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
                 + (m_B / (2.0 * m_b_PS)) * (
                     wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
                     + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
-                    + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
+                    + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)));
 
         /* parallel, up sector */
         // cf. [BFS2004], comment before Eq. (43), p. 24
@@ -234,10 +258,10 @@ namespace eos
         // cf. [BFS2004], last paragraph in Sec A.1, p. 24
         // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_par = (+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS))
+                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS))));
 
         // compute the factorizing contributions
         complex<double> C_perp_left  = C0_top_perp_left  + lambda_hat_u * C0_up_perp
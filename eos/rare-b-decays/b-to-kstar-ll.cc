@@ -28,16 +28,86 @@
 #include <eos/rare-b-decays/b-to-kstar-ll-gp2004.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-gvdv2020.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-impl.hh>
+#include <eos/utils/evaluation-precision.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace eos
 {
+    namespace
+    {
+        /*
+         * Cache of the transversity amplitudes, shared by all decay objects with
+         * identical parameters and options. The bins of a binned constraint each
+         * construct their own decay object; pooling their amplitude samples lets
+         * every q^2 point of the per-bin integration grids be evaluated exactly
+         * once per parameter point, so adjacent bins share their endpoints and
+         * repeated bins come for free.
+         */
+        struct BToKstarDileptonAmplitudeCache
+        {
+            Mutex mutex;
+
+            // generation of the parameter set for which the samples are valid
+            std::uint64_t generation = 0;
+
+            std::map<double, BToKstarDilepton::Amplitudes> samples;
+        };
+
+        std::shared_ptr<BToKstarDileptonAmplitudeCache>
+        amplitude_cache_for(const Parameters & parameters, const Options & options)
+        {
+            struct Entry
+            {
+                Parameters parameters;
+
+                std::string options;
+
+                std::weak_ptr<BToKstarDileptonAmplitudeCache> cache;
+            };
+
+            static Mutex mutex;
+            static std::vector<Entry> entries;
+
+            Lock l(mutex);
+
+            const std::string options_key = options.as_string();
+            for (auto i = entries.begin() ; i != entries.end() ; )
+            {
+                auto cache = i->cache.lock();
+                if (! cache)
+                {
+                    i = entries.erase(i);
+                    continue;
+                }
+
+                if ((! (i->parameters != parameters)) && (i->options == options_key))
+                    return cache;
+
+                ++i;
+            }
+
+            auto cache = std::make_shared<BToKstarDileptonAmplitudeCache>();
+            entries.push_back(Entry{ parameters, options_key, cache });
+
+            return cache;
+        }
+    }
+
     /*!
      * Implementation for the decay @f$\bar{B} \to \bar{K}^* \ell^+ \ell^-@f$.
      */
     template <>
     struct Implementation<BToKstarDilepton>
     {
+        Parameters parameters;
+
         std::shared_ptr<BToKstarDilepton::AmplitudeGenerator> amplitude_generator;
 
         std::shared_ptr<Model> model;
@@ -53,15 +123,25 @@ namespace eos
 
         IntermediateResult intermediate_result;
 
+        // cache of the transversity amplitudes, shared with all other decay objects
+        // built on the same parameters and options, cf. amplitude_cache_for();
+        // invalidated whenever any parameter's value changes
+        std::shared_ptr<BToKstarDileptonAmplitudeCache> amplitude_cache;
+
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             model(Model::make(o.get("model", "WET"), p, o)),
             opt_l(o, options, "l"),
             hbar(p["QM::hbar"], u),
             m_l(p["mass::" + opt_l.str()], u),
             tau(p["life_time::B_" + o.get("q", "d")], u),
-            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u)
+            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u),
+            amplitude_cache(amplitude_cache_for(p, o)),
+            n_integration_points(integration_points(o, 64, "B->K^*ll::angular_coefficients"))
         {
             Context ctx("When constructing B->K^*ll observables");
 
@@ -91,6 +171,47 @@ namespace eos
         {
         }
 
+        BToKstarDilepton::Amplitudes amplitudes(const double & q2) const
+        {
+            const std::uint64_t generation = parameters.generation();
+
+            {
+                Lock l(amplitude_cache->mutex);
+
+                if (amplitude_cache->generation != generation)
+                {
+                    amplitude_cache->samples.clear();
+                    amplitude_cache->generation = generation;
+                }
+
+                auto i = amplitude_cache->samples.find(q2);
+                if (amplitude_cache->samples.end() != i)
+                    return i->second;
+            }
+
+            // compute outside the lock: the cache's sharers are evaluated
+            // concurrently across the thread pool, and each brings its own
+            // amplitude generator
+            auto amplitudes = amplitude_generator->amplitudes(q2);
+
+            {
+                Lock l(amplitude_cache->mutex);
+
+                if (amplitude_cache->generation == generation)
+                {
+                    // bound the cache's size for long scans at fixed parameter values
+                    if (amplitude_cache->samples.size() >= 1024)
+                    {
+                        amplitude_cache->samples.clear();
+                    }
+
+                    amplitude_cache->samples.emplace(q2, amplitudes);
+                }
+            }
+
+            return amplitudes;
+        }
+
         inline std::array<double, 12> angular_coefficients_array(const BToKstarDilepton::Amplitudes & A, const double & s) const
         {
             // cf. [BHvD2010], p. 26, eqs. (A1)-(A11)
@@ -194,7 +315,7 @@ namespace eos
 
         inline std::array<double, 12> differential_angular_coefficients_array(const double & s) const
         {
-            return angular_coefficients_array(amplitude_generator->amplitudes(s), s);
+            return angular_coefficients_array(this->amplitudes(s), s);
         }
 
         inline BToKstarDilepton::AngularCoefficients differential_angular_coefficients(const double & s) const
@@ -206,7 +327,7 @@ namespace eos
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BToKstarDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
             return BToKstarDilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
@@ -868,7 +989,7 @@ The azimuthal angle between the Kbar-pi plane and the l^+l^- plane.";
     BToKstarDilepton::Amplitudes
     BToKstarDilepton::amplitudes(const double & q2) const
     {
-        return _imp->amplitude_generator->amplitudes(q2);
+        return _imp->amplitudes(q2);
     }
 
     const std::set<ReferenceName>
@@ -254,7 +254,7 @@ namespace eos
     double
     BToPseudoscalarDineutrino::integrated_branching_ratio(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarDineutrino>::differential_branching_ratio,
+        auto f = std::bind(&Implementation<BToPseudoscalarDineutrino>::differential_branching_ratio,
                 _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, q2_min, q2_max, _imp->int_config);
@@ -299,7 +299,7 @@ namespace eos
     double
     BToVectorDineutrino::integrated_branching_ratio(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToVectorDineutrino>::differential_branching_ratio,
+        auto f = std::bind(&Implementation<BToVectorDineutrino>::differential_branching_ratio,
                 _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(f, q2_min, q2_max, _imp->int_config);
@@ -308,9 +308,9 @@ namespace eos
     double
     BToVectorDineutrino::integrated_longitudinal_polarisation(const double & q2_min, const double & q2_max) const
     {
-        std::function<double (const double &)> longitudinal_width = std::bind(&Implementation<BToVectorDineutrino>::differential_longitudinal_width,
+        auto longitudinal_width = std::bind(&Implementation<BToVectorDineutrino>::differential_longitudinal_width,
                 _imp.get(), std::placeholders::_1);
-        std::function<double (const double &)> decay_width = std::bind(&Implementation<BToVectorDineutrino>::differential_decay_width,
+        auto decay_width = std::bind(&Implementation<BToVectorDineutrino>::differential_decay_width,
                 _imp.get(), std::placeholders::_1);
 
         return integrate<GSL::QAGS>(longitudinal_width, q2_min, q2_max, _imp->int_config) /
@@ -200,8 +200,7 @@ namespace eos
         if (1.0 - s_hat < eps)
             return 0.0;
 
-        return integrate1D(std::function<complex<double> (const double &)>(
-                    std::bind(&Bremsstrahlung::tau_22, s_hat, std::placeholders::_1, z)),
+        return integrate1D(std::bind(&Bremsstrahlung::tau_22, s_hat, std::placeholders::_1, z),
                 128, s_hat + eps, 1.0);
     }
 
@@ -213,8 +212,7 @@ namespace eos
         if (1.0 - s_hat < eps)
             return 0.0;
 
-        return integrate1D(std::function<complex<double> (const double &)>(
-                    std::bind(&Bremsstrahlung::tau_27, s_hat, std::placeholders::_1, z)),
+        return integrate1D(std::bind(&Bremsstrahlung::tau_27, s_hat, std::placeholders::_1, z),
                 128, s_hat + eps, 1.0);
     }
 
@@ -226,8 +224,7 @@ namespace eos
         if (1.0 - s_hat < eps)
             return 0.0;
 
-        return integrate1D(std::function<complex<double> (const double &)>(
-                    std::bind(&Bremsstrahlung::tau_28, s_hat, std::placeholders::_1, z)),
+        return integrate1D(std::bind(&Bremsstrahlung::tau_28, s_hat, std::placeholders::_1, z),
                 128, s_hat + eps, 1.0);
     }
 
@@ -239,8 +236,7 @@ namespace eos
         if (1.0 - s_hat < eps)
             return 0.0;
 
-        return integrate1D(std::function<complex<double> (const double &)>(
-                    std::bind(&Bremsstrahlung::tau_29, s_hat, std::placeholders::_1, z)),
+        return integrate1D(std::bind(&Bremsstrahlung::tau_29, s_hat, std::placeholders::_1, z),
                 128, s_hat + eps, 1.0);
     }
 }
@@ -156,7 +156,7 @@ namespace eos
             const auto prefactor = power_of<2>(g_fermi * abs(model->ckm_cb() * conj(model->ckm_cs())))
                     * tau_Bs() / hbar() * sqrt(lambda) / (2.0 * M_PI * m_Bs);
 
-            return prefactor * (norm(amps.A_perp) + norm(amps.A_para) + pow(m_Bs/m_psi, 2) * norm(amps.A_long));
+            return prefactor * (norm(amps.A_perp) + norm(amps.A_para) + power_of<2>(m_Bs / m_psi) * norm(amps.A_long));
         }
 
     };
@@ -173,11 +173,11 @@ namespace eos
         complex<double> C1f_top_perp_right = (c7eff + wc.c7prime()) * (8.0 * std::log(m_b_PS / mu()) - L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BFS2001], Eqs. (34), (37), p. 9
         complex<double> C1nf_top_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
                 + (s / (2.0 * m_b_PS * m_B)) * (
                     wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
                     + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
-                    + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
+                    + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)));
 
         /* perpendicular, up sector */
         // cf. [BFS2004], comment before Eq. (43), p. 24
@@ -186,10 +186,10 @@ namespace eos
         // cf. [BFS2001], Eqs. (34), (37), p. 9
         // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_perp = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
                 + (s / (2.0 * m_b_PS * m_B)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS))
+                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS))));
 
         /* parallel, top sector */
         // cf. [BFS2001], Eqs. (14), (15), p. 5, in comparison with \delta_{2,3} = 1
@@ -199,11 +199,11 @@ namespace eos
         // cf. [BFS2001], Eqs. (38), p. 9
         complex<double> C1nf_top_par = (+1.0 / QCD::casimir_f) * (
                 (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole)
-                + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
+                + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
                 + (m_B / (2.0 * m_b_PS)) * (
                     wc.c1() * memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole)
                     + wc.c2() * memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole)
-                    + c8eff * CharmLoops::F89_massless(s, m_b_PS)));
+                    + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)));
 
         /* parallel, up sector */
         // cf. [BFS2004], comment before Eq. (43), p. 24
@@ -212,10 +212,10 @@ namespace eos
         // cf. [BFS2004], last paragraph in Sec A.1, p. 24
         // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_par = (+1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, s, m_b_PS))
+                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
                 + (m_B / (2.0 * m_b_PS)) * (
-                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F19_massless(mu, s, m_b_PS))
-                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - CharmLoops::F29_massless(mu, s, m_b_PS))));
+                    wc.c1() * (memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS))
+                    + wc.c2() * (memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS))));
 
         // compute the factorizing contributions
         complex<double> C_perp_left  = C0_top_perp_left  + lambda_hat_u * C0_up_perp
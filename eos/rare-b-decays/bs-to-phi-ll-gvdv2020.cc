@@ -96,13 +96,13 @@ namespace eos
         ////////////////////////////////////////
 
         complex<double> vector_contribution = alpha_s_mu / 4.0 / M_PI * (
-            wc.c1() * memoise(CharmLoops::F19_massive_Qsb, s) + wc.c2() * memoise(CharmLoops::F29_massive_Qsb, s) + c8eff * CharmLoops::F89_massless(s, m_b_PS)
-            + lambda_hat_u * ( wc.c1() * (memoise(CharmLoops::F19_massive_Qsb, s) - CharmLoops::F19_massless(mu, s, m_b_PS)) + wc.c2() * (memoise(CharmLoops::F29_massive_Qsb, s) - CharmLoops::F29_massless(mu, s, m_b_PS)))
+            wc.c1() * memoise(CharmLoops::F19_massive_Qsb, s) + wc.c2() * memoise(CharmLoops::F29_massive_Qsb, s) + c8eff * memoise(CharmLoops::F89_massless, s, m_b_PS)
+            + lambda_hat_u * ( wc.c1() * (memoise(CharmLoops::F19_massive_Qsb, s) - memoise(CharmLoops::F19_massless, mu(), s, m_b_PS)) + wc.c2() * (memoise(CharmLoops::F29_massive_Qsb, s) - memoise(CharmLoops::F29_massless, mu(), s, m_b_PS)))
         );
 
         complex<double> tensor_contribution = alpha_s_mu / 4.0 / M_PI * (
-            (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_Qsb, s) + c8eff * CharmLoops::F87_massless(mu, s, m_b_PS)
-            + lambda_hat_u * (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_Qsb, s) - CharmLoops::F27_massless(mu, s, m_b_PS))
+            (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive_Qsb, s) + c8eff * memoise(CharmLoops::F87_massless, mu(), s, m_b_PS)
+            + lambda_hat_u * (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive_Qsb, s) - memoise(CharmLoops::F27_massless, mu(), s, m_b_PS))
         );
 
         BsToPhiDilepton::FormFactorCorrections result;
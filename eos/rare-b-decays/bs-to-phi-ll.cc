@@ -22,6 +22,7 @@
 #include <eos/rare-b-decays/bs-to-phi-ll-base.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-bfs2004.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-gvdv2020.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
 namespace eos
@@ -77,6 +78,8 @@ namespace eos
         UsedParameter mu;
         UsedParameter phiBs;
 
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -86,7 +89,8 @@ namespace eos
             m_l(p["mass::" + opt_l.str()], u),
             tau(p["life_time::B_s"], u),
             mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u),
-            phiBs(p["B_s::q_over_p_phase"], u)
+            phiBs(p["B_s::q_over_p_phase"], u),
+            n_integration_points(integration_points(o, 64, "B_s->phill::angular_coefficients"))
         {
             Context ctx("When constructing Bs->Phill observables");
 
@@ -232,7 +236,7 @@ namespace eos
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BsToPhiDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
             return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
@@ -913,7 +917,8 @@ The azimuthal angle between the Kbar-K plane and the l^+l^- plane.";
 
     BsToPhiDileptonAndConjugate::BsToPhiDileptonAndConjugate(const Parameters & parameters, const Options & options):
         bstophidilepton(parameters, options + Options{{"cp-conjugate", "true"}}),
-        bstophidilepton_conjugate(parameters, options + Options{{"cp-conjugate", "false"}})
+        bstophidilepton_conjugate(parameters, options + Options{{"cp-conjugate", "false"}}),
+        n_integration_points(integration_points(options, 64))
     {
     }
 
@@ -1090,7 +1095,7 @@ The azimuthal angle between the Kbar-K plane and the l^+l^- plane.";
     {
         std::function<std::array<double, 12> (const double &)> integrand =
                 std::bind(&BsToPhiDileptonAndConjugate::differential_angular_h_coefficients_array, this, std::placeholders::_1);
-        std::array<double, 12> integrated_angular_h_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+        std::array<double, 12> integrated_angular_h_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
         return BsToPhiDileptonAndConjugate::AngularhCoefficients(integrated_angular_h_coefficients_array);
     }
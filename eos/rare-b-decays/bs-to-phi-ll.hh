@@ -262,6 +262,8 @@ namespace eos
             BsToPhiDilepton bstophidilepton;
             BsToPhiDilepton bstophidilepton_conjugate;
 
+            unsigned n_integration_points;
+
             struct AngularhCoefficients;
 
             inline std::array<double, 12> angular_h_coefficients_array(const BsToPhiDilepton::Amplitudes & A, const BsToPhiDilepton::Amplitudes & Atilda, const double & s) const;
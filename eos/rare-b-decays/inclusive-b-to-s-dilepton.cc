@@ -371,7 +371,7 @@ namespace eos
                 0.0,
                 0.0,
                 alpha_s_tilde * kappa,
-                -power_of<2>(alpha_s_tilde) * kappa * CharmLoops::F87_massless(mu, s, m_b_msbar),
+                -power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F87_massless, mu(), s, m_b_msbar),
                 0.0,
                 0.0,
                 0.0,
@@ -388,7 +388,7 @@ namespace eos
                 alpha_s_tilde * kappa * f(5, s_hat),
                 alpha_s_tilde * kappa * f(6, s_hat),
                 0.0,
-                -power_of<2>(alpha_s_tilde) * kappa * CharmLoops::F89_massless(s, m_b_msbar),
+                -power_of<2>(alpha_s_tilde) * kappa * memoise(CharmLoops::F89_massless, s, m_b_msbar),
                 1.0 + alpha_s_tilde * kappa * f9pen(s_hat),
                 0.0,
                 alpha_s_tilde * kappa * f(11, s_hat),
@@ -568,8 +568,7 @@ namespace eos
     double
     BToXsDilepton<HLMW2005>::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        return integrate1D(std::function<double (const double &)>(
-                    std::bind(&BToXsDilepton<HLMW2005>::differential_branching_ratio, this, std::placeholders::_1)),
+        return integrate1D(std::bind(&BToXsDilepton<HLMW2005>::differential_branching_ratio, this, std::placeholders::_1),
                 32, s_min, s_max);
     }
 
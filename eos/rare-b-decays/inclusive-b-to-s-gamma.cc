@@ -28,6 +28,7 @@
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
 
+#include <cstdint>
 #include <iostream>
 
 namespace eos
@@ -147,6 +148,8 @@ namespace eos
     template <>
     struct Implementation<BToXsGamma<NLO>>
     {
+        Parameters parameters;
+
         std::shared_ptr<Model> model;
 
         UsedParameter hbar;
@@ -170,6 +173,7 @@ namespace eos
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             model(Model::make(o.get("model", "SM"), p, o)),
             hbar(p["QM::hbar"], u),
             mu(p["sb::mu"], u),
@@ -179,11 +183,50 @@ namespace eos
             m_b_MSbar(p["mass::b(MSbar)"], u),
             alpha_e(p["QED::alpha_e(m_b)"], u),
             gfermi(p["WET::G_Fermi"], u),
-            tau(p["life_time::B" + (destringify<bool>(o.get("admixture", "true")) ? ("@Y(4S)") : ("_" + o.get("q", "d")))], u)
+            tau(p["life_time::B" + (destringify<bool>(o.get("admixture", "true")) ? ("@Y(4S)") : ("_" + o.get("q", "d")))], u),
+            context_valid(false)
         {
             u.uses(*model);
         }
 
+        /*
+         * Cutoff-independent ingredients of the photon spectrum.
+         *
+         * The spectrum's moments and partial rates are analytic in the photon
+         * energy cutoff E_min; all of the expensive per-evaluation work (the
+         * running of the Wilson coefficients, the loop functions r_i, the
+         * quark masses and the strong coupling) is independent of it. We
+         * compute these ingredients once per parameter point and serve every
+         * moment and partial rate from the cached record, which is
+         * invalidated through the parameter set's generation counter.
+         */
+        struct SpectralContext
+        {
+            // masses and logarithms
+            double m_b_msbar, m_b_kin, m_b_pole, lnmu;
+
+            // kinematics
+            double z;
+
+            // strong coupling
+            double alpha_s;
+
+            WilsonCoefficients<BToS> wc;
+
+            // perturbative b->sgamma contributions, cf. [CMM1996], p. 7, Eq. (31)
+            complex<double> D, Dprime;
+
+            // |C7eff|^2 + |C7'|^2, multiplies the HQE power corrections
+            double c7_2;
+
+            // normalization of the decay rate, cf. [CMM1996], Eq. (30), p. 7
+            double prefactor;
+        };
+
+        mutable SpectralContext context;
+        mutable std::uint64_t context_generation;
+        mutable bool context_valid;
+
         static const std::array<double, 225> f22int1coeffs, f22int2coeffs;
         static const std::array<double, 225> f27int1coeffs, f27int2coeffs;
 
@@ -483,26 +526,63 @@ namespace eos
             return result;
         }
 
-        double decay_rate(const double & emin) const
+        const SpectralContext & spectral_context() const
         {
             // Constants
             static const double pi = M_PI, pi2 = pi * pi, pi4 = pi2 * pi2;
-            static const complex<double> iu(0.0, 1.0);
+
+            const std::uint64_t generation = parameters.generation();
+            if (context_valid && (generation == context_generation))
+            {
+                return context;
+            }
+
+            SpectralContext c;
 
             // masses
-            double m_b_msbar = model->m_b_msbar(mu());
-            double m_b_kin = model->m_b_kin(1.0); // for the HQE correction we use the kinetic mass at mu_kin = 1GeV
-            double m_b_pole = model->m_b_pole();
-            double m_c = model->m_c_msbar(mu());
-            double lnmu = std::log(m_b_MSbar() / mu());
+            c.m_b_msbar = model->m_b_msbar(mu());
+            c.m_b_kin = model->m_b_kin(1.0); // for the HQE correction we use the kinetic mass at mu_kin = 1GeV
+            c.m_b_pole = model->m_b_pole();
+            c.lnmu = std::log(m_b_MSbar() / mu());
 
             // Kinematics
             // Use m_c(mu) instead of m_c_pole, cf. [GM2001], pp. 2-3.
-            double m_c_hat = m_c / m_b_msbar;
-            double z = m_c_hat * m_c_hat;
+            double m_c_hat = model->m_c_msbar(mu()) / c.m_b_msbar;
+            c.z = m_c_hat * m_c_hat;
+
+            // Strong coupling
+            c.alpha_s = model->alpha_s(mu());
+
+            c.wc = model->wilson_coefficients_b_to_s(mu(), LeptonFlavor::muon /* fake lepton flavor */);
+
+            // Perturbative contributions
+            c.D = perturbative_bsgamma(c.z, c.wc, c.alpha_s, c.lnmu);
+            c.Dprime = perturbative_bsgamma_prime(c.z, c.wc, c.alpha_s, c.lnmu);
+            c.c7_2 = std::norm(c7eff(c.wc)) + std::norm(c.wc.c7prime());
+
+            // cf. [CMM1996], Eq. (30), p. 7
+            double lambda_t2 = std::norm(model->ckm_tb() * conj(model->ckm_ts()));
+            c.prefactor = power_of<2>(gfermi()) * alpha_e / (32.0 * pi4) * lambda_t2
+                * power_of<3>(c.m_b_pole) * power_of<2>(c.m_b_msbar);
+
+            context = c;
+            context_generation = generation;
+            context_valid = true;
+
+            return context;
+        }
+
+        double decay_rate(const double & emin) const
+        {
+            // Constants
+            static const double pi = M_PI, pi2 = pi * pi;
+
+            const SpectralContext & c = spectral_context();
+
+            double z = c.z, lnmu = c.lnmu, m_b_kin = c.m_b_kin;
 
             // cutoff parameter delta
-            double delta = 1.0 - 2.0 * emin / m_b_pole, delta2 = delta * delta, delta3 = delta * delta2, delta4 = delta2 * delta2;
+            double delta = 1.0 - 2.0 * emin / c.m_b_pole, delta2 = delta * delta, delta3 = delta * delta2, delta4 = delta2 * delta2;
             double lndelta = std::log(delta), ln2delta = lndelta * lndelta;
 
             // We only support evaluations with 0.03 <= z <= 0.12 and 1/36 <= delta <= 1/3, see also calculation of function f_ij(z, delta).
@@ -513,14 +593,10 @@ namespace eos
             }
 
             // Strong coupling
-            double alpha_s = model->alpha_s(mu()), a_s = alpha_s / (4.0 * pi);
+            double alpha_s = c.alpha_s, a_s = alpha_s / (4.0 * pi);
 
-            WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), LeptonFlavor::muon /* fake lepton flavor */);
-
-            // Perturbative contributions
-            complex<double> D = perturbative_bsgamma(z, wc, alpha_s, lnmu);
-            complex<double> Dprime = perturbative_bsgamma_prime(z, wc, alpha_s, lnmu);
-            double A = perturbative_bsgammagluon(z, delta, wc, alpha_s);
+            // The only cutoff-dependent perturbative contribution
+            double A = perturbative_bsgammagluon(z, delta, c.wc, alpha_s);
 
             /*
              * We use lambda_1 = -mu^2_pi and lambda_2 = mu^2_G / 3.0 and neglect higher order
@@ -542,10 +618,8 @@ namespace eos
                             + (13.0 + 8.0 / delta + 92.0 / 3.0 * delta + 7.0 / 3.0 * delta2) * lndelta)) * (mu2_g / (m_b_kin * m_b_kin));
 
             // cf. [CMM1996], Eq. (30), p. 7
-            double lambda_t2 = std::norm(model->ckm_tb() * conj(model->ckm_ts()));
-            double result = power_of<2>(gfermi()) * alpha_e / (32.0 * pi4) * lambda_t2
-                * power_of<3>(m_b_pole) * power_of<2>(model->m_b_msbar(mu()))
-                * (std::norm(D) + std::norm(Dprime) + A + (std::norm(c7eff(wc)) + std::norm(wc.c7prime())) * hqe);
+            double result = c.prefactor
+                * (std::norm(c.D) + std::norm(c.Dprime) + A + c.c7_2 * hqe);
 
             return result;
         }
@@ -559,8 +633,10 @@ namespace eos
         {
             // Calculation is based on results by [EGN2010].
 
-            const double a = model->alpha_s(mu()) / (4.0 * M_PI);
-            const double m_b = model->m_b_kin(1.0), m_b2 = m_b * m_b;
+            const SpectralContext & c = spectral_context();
+
+            const double a = c.alpha_s / (4.0 * M_PI);
+            const double m_b = c.m_b_kin, m_b2 = m_b * m_b;
             const double z = 2.0 * emin / m_b, z2 = z * z, z3 = z2 * z, z4 = z2 * z2;
             const double ln1mz = std::log(1.0 - z), lnmu = std::log(mu() / m_b);
 
@@ -580,8 +656,10 @@ namespace eos
         {
             // Calculation is based on results by [EGN2010].
 
-            const double a = model->alpha_s(mu()) / (4.0 * M_PI);
-            const double m_b = model->m_b_kin(1.0), m_b2 = m_b * m_b;
+            const SpectralContext & c = spectral_context();
+
+            const double a = c.alpha_s / (4.0 * M_PI);
+            const double m_b = c.m_b_kin, m_b2 = m_b * m_b;
             const double z = 2.0 * emin / m_b, z2 = z * z, z3 = z2 * z, z4 = z2 * z2, z5 = z4 * z;
             const double ln1mz = std::log(1.0 - z);
 
@@ -26,6 +26,7 @@
 #include <eos/nonlocal-form-factors/charm-loops.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
 #include <eos/utils/destringify.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/memoise.hh>
@@ -34,6 +35,7 @@
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
@@ -306,6 +308,8 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LargeRecoil>>
     {
+        Parameters parameters;
+
         std::shared_ptr<Model> model;
 
         UsedParameter hbar;
@@ -325,9 +329,12 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             model(Model::make(o.get("model", "SM"), p, o)),
             hbar(p["QM::hbar"], u),
             tau_Lambda_b(p["life_time::Lambda_b"], u),
@@ -339,7 +346,9 @@ namespace eos
             alpha_e(p["QED::alpha_e(m_b)"], u),
             opt_l(o, options, "l"),
             mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u),
-            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda::" + o.get("form-factors", "BFvD2014"), p, o))
+            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda::" + o.get("form-factors", "BFvD2014"), p, o)),
+            n_integration_points(integration_points(o, 64, "Lambda_b->Lambdall::angular_observables@LargeRecoil")),
+            context_valid(false)
         {
             Context ctx("When constructing L_b->Lll observables");
 
@@ -347,6 +356,76 @@ namespace eos
             u.uses(*model);
         }
 
+        /*
+         * q^2-independent ingredients of the transversity amplitudes.
+         *
+         * The running Wilson coefficients, quark masses, CKM combinations,
+         * and the coefficients of Y(s) do not vary across the q^2 bins of an
+         * integrated observable, yet the amplitudes were recomputing them at
+         * every integration node. They are assembled here once per parameter
+         * point; the record is invalidated through the parameter set's
+         * generation counter, leaving only the genuinely q^2-dependent loop
+         * functions and form factors in the per-q^2 kernel.
+         */
+        struct SetupContext
+        {
+            double alpha_s, m_b_MSbar, m_b_PS, m_c_pole;
+
+            WilsonCoefficients<BToS> wc;
+
+            complex<double> lambda_hat_u;
+
+            // coefficients of Y(s), cf. [BFS2001], Eq. (10), p. 4
+            complex<double> Y_top_c, Y_top_b, Y_top_0, Y_top_;
+
+            // effective Wilson coefficients, cf. [BFS2001], below Eqs. (9) and (26)
+            complex<double> c7eff, c8eff;
+
+            // N(s) = norm_prefactor * sqrt(s * sqrt(lambda(m_Lambda_b^2, m_Lambda^2, s)))
+            double norm_prefactor;
+        };
+
+        mutable SetupContext context;
+        mutable std::uint64_t context_generation;
+        mutable bool context_valid;
+
+        const SetupContext & setup_context() const
+        {
+            const std::uint64_t generation = parameters.generation();
+            if (context_valid && (generation == context_generation))
+            {
+                return context;
+            }
+
+            SetupContext c;
+
+            c.alpha_s = model->alpha_s(mu());
+            c.m_b_MSbar = model->m_b_msbar(mu);
+            c.m_b_PS = model->m_b_ps(2.0);
+            c.m_c_pole = model->m_c_pole();
+
+            c.wc = model->wilson_coefficients_b_to_s(mu(), opt_l.value());
+
+            c.lambda_hat_u = model->ckm_ub() * conj(model->ckm_us()) / std::abs(model->ckm_tb() * conj(model->ckm_ts()));
+
+            c.Y_top_c = 4.0 / 3.0 * c.wc.c1() + c.wc.c2() + 6.0 * c.wc.c3() + 60.0 * c.wc.c5();
+            c.Y_top_b = -0.5 * (7.0 * c.wc.c3() + 4.0 / 3.0 * c.wc.c4() + 76.0 * c.wc.c5() + 64.0 / 3.0 * c.wc.c6());
+            c.Y_top_0 = -0.5 * (c.wc.c3() + 4.0 / 3.0 * c.wc.c4() + 16.0 * c.wc.c5() + 64 / 3.0 * c.wc.c6());
+            c.Y_top_ = 2.0 / 9.0 * (6.0 * c.wc.c3() + 32.0 * c.wc.c5() + 32.0 / 3.0 * c.wc.c6());
+
+            c.c7eff = c.wc.c7() - 1.0/3.0 * c.wc.c3() - 4.0/9.0 * c.wc.c4() - 20.0/3.0 * c.wc.c5() - 80.0/9.0 * c.wc.c6();
+            c.c8eff = c.wc.c8() + c.wc.c3() - 1.0/6.0 * c.wc.c4() + 20.0 * c.wc.c5() - 10.0/3.0 * c.wc.c6();
+
+            c.norm_prefactor = g_fermi() * alpha_e() * abs(model->ckm_tb() * conj(model->ckm_ts()))
+                * sqrt(1.0 / 3.0 / 2048 / power_of<5>(M_PI) / power_of<3>(m_Lambda_b()));
+
+            context = c;
+            context_generation = generation;
+            context_valid = true;
+
+            return context;
+        }
+
         double norm(const double & s) const
         {
             return g_fermi() * alpha_e() * abs(model->ckm_tb() * conj(model->ckm_ts()))
@@ -363,51 +442,46 @@ namespace eos
         {
             lambdab_to_lambda_dilepton::Amplitudes result;
 
-            double alpha_s = model->alpha_s(mu());
-            double m_b_MSbar = model->m_b_msbar(mu), m_b_PS = model->m_b_ps(2.0), m_b_PS2 = m_b_PS * m_b_PS;
-            double m_c_pole = model->m_c_pole();
+            const SetupContext & ctx = setup_context();
+
+            double alpha_s = ctx.alpha_s;
+            double m_b_MSbar = ctx.m_b_MSbar, m_b_PS = ctx.m_b_PS, m_b_PS2 = m_b_PS * m_b_PS;
+            double m_c_pole = ctx.m_c_pole;
 
-            WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), opt_l.value());
+            const WilsonCoefficients<BToS> & wc = ctx.wc;
 
-            complex<double> lambda_hat_u = model->ckm_ub() * conj(model->ckm_us()) / std::abs(model->ckm_tb() * conj(model->ckm_ts()));
+            const complex<double> & lambda_hat_u = ctx.lambda_hat_u;
             double sqrtsminus = sqrt(power_of<2>(m_Lambda_b - m_Lambda) - s), sqrtsplus = sqrt(power_of<2>(m_Lambda_b + m_Lambda) - s), sqrts = sqrt(s);
-            double N = norm(s);
+            double N = ctx.norm_prefactor * sqrt(s * sqrt(lambda(m_Lambda_b * m_Lambda_b, m_Lambda * m_Lambda, s)));
 
             /* Y(s) for the up and the top sector */
-            // cf. [BFS2001], Eq. (10), p. 4
-            complex<double> Y_top_c = 4.0 / 3.0 * wc.c1() + wc.c2() + 6.0 * wc.c3() + 60.0 * wc.c5();
-            complex<double> Y_top_b = -0.5 * (7.0 * wc.c3() + 4.0 / 3.0 * wc.c4() + 76.0 * wc.c5() + 64.0 / 3.0 * wc.c6());
-            complex<double> Y_top_0 = -0.5 * (wc.c3() + 4.0 / 3.0 * wc.c4() + 16.0 * wc.c5() + 64 / 3.0 * wc.c6());
-            complex<double> Y_top_ = 2.0 / 9.0 * (6.0 * wc.c3() + 32.0 * wc.c5() + 32.0 / 3.0 * wc.c6());
             // Use b pole mass according to [BFS2001], Sec. 3.1, paragraph Quark Masses,
             // then replace b pole mass by the PS mass.
-            complex<double> Y_top = Y_top_c * CharmLoops::h(mu, s, m_c_pole)
-                 + Y_top_b * CharmLoops::h(mu, s, m_b_PS)
-                 + Y_top_0 * CharmLoops::h(mu, s)
-                 + Y_top_;
+            complex<double> Y_top = ctx.Y_top_c * CharmLoops::h(mu, s, m_c_pole)
+                 + ctx.Y_top_b * CharmLoops::h(mu, s, m_b_PS)
+                 + ctx.Y_top_0 * CharmLoops::h(mu, s)
+                 + ctx.Y_top_;
             // cf. [BFS2004], Eq. (43), p. 24
             complex<double> Y_up = (4.0 / 3.0 * wc.c1() + wc.c2()) * (CharmLoops::h(mu, s, m_c_pole) - CharmLoops::h(mu, s));
 
-            // calculate effective wilson coefficients
-            // cf. [BFS2001], below Eq. (9), p. 4
-            complex<double> c7eff = wc.c7() - 1.0/3.0 * wc.c3() - 4.0/9.0 * wc.c4() - 20.0/3.0 * wc.c5() - 80.0/9.0 * wc.c6();
-            // cf. [BFS2001], below Eq. (26), p. 8
-            complex<double> c8eff = wc.c8() + wc.c3() - 1.0/6.0 * wc.c4() + 20.0 * wc.c5() - 10.0/3.0 * wc.c6();
+            // effective wilson coefficients, hoisted into the setup context
+            const complex<double> & c7eff = ctx.c7eff;
+            const complex<double> & c8eff = ctx.c8eff;
 
             // two loop virtual corrections, cf. [AAGW2001]
             // charm quarks
-            complex<double> F27c = CharmLoops::F27_massive(mu(), s, m_b_PS, m_c_pole);
+            complex<double> F27c = memoise(CharmLoops::F27_massive, mu(), s, m_b_PS, m_c_pole);
             complex<double> F17c = -F27c / 6.0;
-            complex<double> F19c = CharmLoops::F19_massive(mu(), s, m_b_PS, m_c_pole);
-            complex<double> F29c = CharmLoops::F29_massive(mu(), s, m_b_PS, m_c_pole);
+            complex<double> F19c = memoise(CharmLoops::F19_massive, mu(), s, m_b_PS, m_c_pole);
+            complex<double> F29c = memoise(CharmLoops::F29_massive, mu(), s, m_b_PS, m_c_pole);
             // up quarks
-            complex<double> F27u = CharmLoops::F27_massless(mu(), s, m_b_PS);
+            complex<double> F27u = memoise(CharmLoops::F27_massless, mu(), s, m_b_PS);
             complex<double> F17u = -F27u / 6.0;
-            complex<double> F19u = CharmLoops::F19_massless(mu(), s, m_b_PS);
-            complex<double> F29u = CharmLoops::F29_massless(mu(), s, m_b_PS);
+            complex<double> F19u = memoise(CharmLoops::F19_massless, mu(), s, m_b_PS);
+            complex<double> F29u = memoise(CharmLoops::F29_massless, mu(), s, m_b_PS);
             // gluon
-            complex<double> F87  = CharmLoops::F87_massless(mu(), s, m_b_PS);
-            complex<double> F89  = CharmLoops::F89_massless(s, m_b_PS);
+            complex<double> F87  = memoise(CharmLoops::F87_massless, mu(), s, m_b_PS);
+            complex<double> F89  = memoise(CharmLoops::F89_massless, s, m_b_PS);
 
             // integredients for form factor relations
             // cf. [FY2011]
@@ -491,7 +565,7 @@ namespace eos
         {
             std::function<std::array<double, 34> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
 
-            return integrate1D(integrand, 64, s_min, s_max);
+            return integrate1D(integrand, n_integration_points, s_min, s_max);
         }
 
         inline lambdab_to_lambda_dilepton::AngularObservables differential_angular_observables(const double & s)
@@ -844,6 +918,8 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LowRecoil>>
     {
+        Parameters parameters;
+
         std::shared_ptr<Model> model;
 
         LeptonFlavorOption opt_l;
@@ -866,9 +942,12 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
+            parameters(p),
             model(Model::make(o.get("model", "SM"), p, o)),
             opt_l(o, options, "l"),
             hbar(p["QM::hbar"], u),
@@ -884,12 +963,78 @@ namespace eos
             r_perp_1(p["Lambda_b->Lambdall::r_perp_1@MvD2016"], u),
             r_para_0(p["Lambda_b->Lambdall::r_para_0@MvD2016"], u),
             r_para_1(p["Lambda_b->Lambdall::r_para_1@MvD2016"], u),
-            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda::" + o.get("form-factors", "DM2016"), p, o))
+            form_factors(FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda::" + o.get("form-factors", "DM2016"), p, o)),
+            n_integration_points(integration_points(o, 64, "Lambda_b->Lambdall::angular_observables@LowRecoil")),
+            context_valid(false)
         {
             u.uses(*form_factors);
             u.uses(*model);
         }
 
+        /*
+         * q^2-independent ingredients of the transversity amplitudes.
+         *
+         * Assembled once per parameter point and invalidated through the
+         * parameter set's generation counter; the per-q^2 kernel keeps only
+         * the effective coefficients c7eff/c9eff, the form factor ratios,
+         * and the kinematic factors, all of which genuinely vary with q^2.
+         */
+        struct SetupContext
+        {
+            double alpha_s, m_b, m_c;
+
+            WilsonCoefficients<BToS> wc;
+
+            complex<double> lambda_hat_u;
+
+            double kappa;
+
+            // subleading power corrections, cf. [MvD2016], eq. (B1)
+            complex<double> x_perp_0, x_perp_1, x_para_0, x_para_1;
+
+            // N(s) = norm_prefactor * sqrt(s * sqrt(lambda(m_Lambda_b^2, m_Lambda^2, s)))
+            double norm_prefactor;
+        };
+
+        mutable SetupContext context;
+        mutable std::uint64_t context_generation;
+        mutable bool context_valid;
+
+        const SetupContext & setup_context() const
+        {
+            const std::uint64_t generation = parameters.generation();
+            if (context_valid && (generation == context_generation))
+            {
+                return context;
+            }
+
+            SetupContext c;
+
+            c.alpha_s = model->alpha_s(mu());
+            c.m_b = model->m_b_ps(2.0);
+            c.m_c = model->m_c_msbar(mu());
+
+            c.wc = model->wilson_coefficients_b_to_s(mu(), opt_l.value());
+
+            c.lambda_hat_u = model->ckm_ub() * conj(model->ckm_us()) / abs(model->ckm_tb() * conj(model->ckm_ts()));
+
+            c.kappa = this->kappa();
+
+            c.x_perp_0 = (4.0 / 3.0 * c.wc.c1() + c.wc.c2()) * r_perp_0();
+            c.x_perp_1 = (4.0 / 3.0 * c.wc.c1() + c.wc.c2()) * r_perp_1();
+            c.x_para_0 = (4.0 / 3.0 * c.wc.c1() + c.wc.c2()) * r_para_0();
+            c.x_para_1 = (4.0 / 3.0 * c.wc.c1() + c.wc.c2()) * r_para_1();
+
+            c.norm_prefactor = g_fermi() * alpha_e() * abs(model->ckm_tb() * conj(model->ckm_ts()))
+                * sqrt(1.0 / 3.0 / 2048 / power_of<5>(M_PI) / power_of<3>(m_Lambda_b()));
+
+            context = c;
+            context_generation = generation;
+            context_valid = true;
+
+            return context;
+        }
+
         double norm(const double & s) const
         {
             return g_fermi() * alpha_e() * abs(model->ckm_tb() * conj(model->ckm_ts()))
@@ -906,11 +1051,13 @@ namespace eos
         {
             lambdab_to_lambda_dilepton::Amplitudes result;
 
-            double alpha_s = model->alpha_s(mu()), m_b = model->m_b_ps(2.0), m_c = model->m_c_msbar(mu());
-            WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), opt_l.value());
-            complex<double> lambda_hat_u = model->ckm_ub() * conj(model->ckm_us()) / abs(model->ckm_tb() * conj(model->ckm_ts()));
+            const SetupContext & ctx = setup_context();
+
+            double alpha_s = ctx.alpha_s, m_b = ctx.m_b, m_c = ctx.m_c;
+            const WilsonCoefficients<BToS> & wc = ctx.wc;
+            const complex<double> & lambda_hat_u = ctx.lambda_hat_u;
             double sqrtsminus = sqrt(power_of<2>(m_Lambda_b - m_Lambda) - s), sqrtsplus = sqrt(power_of<2>(m_Lambda_b + m_Lambda) - s), sqrts = sqrt(s);
-            double N = norm(s), kappa = this->kappa();
+            double N = ctx.norm_prefactor * sqrt(s * sqrt(lambda(m_Lambda_b * m_Lambda_b, m_Lambda * m_Lambda, s))), kappa = ctx.kappa;
 
             // calculate effective wilson coefficients
             complex<double> c7eff = ShortDistanceLowRecoil::c7eff(s, mu(), alpha_s, m_b, true, wc);
@@ -922,11 +1069,11 @@ namespace eos
             double zeta_long_V = s / ((m_Lambda_b + m_Lambda) * m_Lambda_b) * form_factors->f_long_t(s)  / form_factors->f_long_v(s);
             double zeta_long_A = s / ((m_Lambda_b - m_Lambda) * m_Lambda_b) * form_factors->f_long_t5(s) / form_factors->f_long_a(s);
 
-            // parametrize subleading power corrections, cf. [MvD2016], eq. (B1), p. ??
-            complex<double> x_perp_0 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_perp_0();
-            complex<double> x_perp_1 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_perp_1();
-            complex<double> x_para_0 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_para_0();
-            complex<double> x_para_1 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_para_1();
+            // subleading power corrections, cf. [MvD2016], eq. (B1), p. ??, hoisted into the setup context
+            const complex<double> & x_perp_0 = ctx.x_perp_0;
+            const complex<double> & x_perp_1 = ctx.x_perp_1;
+            const complex<double> & x_para_0 = ctx.x_para_0;
+            const complex<double> & x_para_1 = ctx.x_para_1;
 
             // cf. [BFvD2014], eqs. (4.9)-(4.10), p. 11
             result.a_perp_1_R = -2.0 *       N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_perp_V + (wc.c10() + wc.c10prime()) + x_perp_1) * form_factors->f_perp_v(s) * sqrtsminus;
@@ -960,7 +1107,7 @@ namespace eos
         {
             std::function<std::array<double, 34> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
 
-            return integrate1D(integrand, 64, s_min, s_max);
+            return integrate1D(integrand, n_integration_points, s_min, s_max);
         }
 
         inline lambdab_to_lambda_dilepton::AngularObservables differential_angular_observables(const double & s)
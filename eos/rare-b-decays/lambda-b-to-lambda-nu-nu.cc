@@ -25,6 +25,7 @@
 #include <eos/rare-b-decays/lambda-b-to-lambda-nu-nu.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-nu-nu-impl.hh>
 #include <eos/utils/destringify.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
@@ -61,6 +62,8 @@ namespace eos
 
         bool cp_conjugate;
 
+        const unsigned n_integration_points;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "SM"), p, o)),
             m_Lambda_b(p["mass::Lambda_b"], u),
@@ -71,7 +74,8 @@ namespace eos
             hbar(p["QM::hbar"], u),
             mu(p["sbnunu::mu"], u),
             opt_cp_conjugate(o, options, "cp-conjugate"),
-            cp_conjugate(opt_cp_conjugate.value())
+            cp_conjugate(opt_cp_conjugate.value()),
+            n_integration_points(integration_points(o, 64, "Lambda_b->Lambdanunu::angular_coefficients"))
         {
             Context ctx("When constructing Lb->Lnunu observables");
 
@@ -120,7 +124,7 @@ namespace eos
         {
             std::function<std::array<double, 2> (const double &)> integrand =
                     std::bind(&Implementation<LambdaBToLambdaDineutrino>::angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 2> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::array<double, 2> integrated_angular_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
             return LambdaBToLambdaDineutrino::AngularCoefficients(integrated_angular_coefficients_array);
         }
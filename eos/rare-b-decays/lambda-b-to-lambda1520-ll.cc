@@ -22,6 +22,7 @@
 #include <eos/maths/power-of.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda1520-ll-base.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda1520-ll-naive.hh>
+#include <eos/utils/evaluation-precision.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
 namespace eos
@@ -43,6 +44,8 @@ namespace eos
         UsedParameter tau;
         UsedParameter mu;
 
+        const unsigned n_integration_points;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -51,7 +54,8 @@ namespace eos
             hbar(p["QM::hbar"], u),
             m_l(p["mass::" + opt_l.str()], u),
             tau(p["life_time::Lambda_b"], u),
-            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u)
+            mu(p["sb" + opt_l.str() + opt_l.str() + "::mu"], u),
+            n_integration_points(integration_points(o, 64, "Lambda_b->Lambda(1520)ll::angular_coefficients"))
         {
             Context ctx("When constructing Lb->L(1520)ll observables");
 
@@ -289,7 +293,7 @@ namespace eos
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<LambdaBToLambda1520Dilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, n_integration_points, s_min, s_max);
 
             return LambdaBToLambda1520Dilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
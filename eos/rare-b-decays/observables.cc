@@ -23,6 +23,7 @@
 #include <eos/rare-b-decays/b-to-ll.hh>
 #include <eos/rare-b-decays/b-to-k-charmonium.hh>
 #include <eos/rare-b-decays/b-to-k-ll.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/rare-b-decays/b-to-kstar-charmonium.hh>
 #include <eos/rare-b-decays/b-to-kstar-gamma.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
@@ -347,8 +348,9 @@ namespace eos
                         <<B->Kll::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B->Kll::BR_CP_specific", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::BR_CP_specific", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -376,13 +378,15 @@ namespace eos
                         (<<B->Kll::BR_CP_specific;cp-conjugate=false>> + <<B->Kll::BR_CP_specific;cp-conjugate=true>>)
                         )"),
 
-                make_observable("B->Kll::Gamma", R"(\Gamma(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::Gamma", R"(\Gamma(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::GeV(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::F_H_CP_specific", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::F_H_CP_specific", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_flat_term,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -396,8 +400,9 @@ namespace eos
                                )
                         )"),
 
-                make_observable("B->Kll::A_FB_CP_specific", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::A_FB_CP_specific", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -100,9 +100,10 @@ namespace eos
             double mh2 = mh * mh, mh4 = mh2 * mh2, mh6 = mh4 * mh2, lnmh = std::log(mh);
             double radix = std::sqrt(1.0 - 4.0 * mh2);
             double atanh = std::atanh(radix);
+            // zm lies in (0, 1/2): its logarithm and dilogarithm are real
             complex<double> zm = 0.5 * (1.0 - radix);
-            complex<double> lnzm = std::log(zm);
-            complex<double> dilogzm = dilog(zm);
+            complex<double> lnzm = std::log(0.5 * (1.0 - radix));
+            complex<double> dilogzm = real_dilog(0.5 * (1.0 - radix));
             complex<double> trilog1 = trilog((-1.0 + radix) / (1.0 + radix));
 
             complex<double> asymp = -4.0 * (-3.0 + 2.0 * mh2 * (6.0 - 3.0 * (1.0 + 2.0 * lnmh - 2.0 * mh2) * pi2
@@ -1132,7 +1133,7 @@ namespace eos
                 aminus(0.5 * complex<double>(1.0, -radixrho)), aplus(1.0 - aminus), lnam(std::log(aminus)),
                 bminus(0.5 * (1.0 + radix4mh2)), bplus(1.0 - bminus), lnbm(std::log(bminus)),
                 lntau(std::log(bminus / mh)),
-                dilogx4(dilog(power_of<2>(aminus / aplus))), dilogx5(dilog(-1.0 * bminus / bplus)),
+                dilogx4(dilog(power_of<2>(aminus / aplus))), dilogx5(real_dilog(-1.0 * bminus / bplus)),
                 diloginvx7(dilog(aminus / bplus)), diloginvx9(dilog(aplus / bplus)),
                 dilogx13(dilog((aplus * bminus) / (aminus * bplus))),
                 redilogx12(real(dilog((aminus * bminus) / (aplus * bplus)))), redilog2ap(real(dilog(2.0 * aplus))),
@@ -1715,7 +1716,7 @@ namespace eos
 
             double lnsh = std::log(sh), ln1msh = std::log(1.0 - sh);
             double atanhsh = std::atanh(1.0 - 2.0 * sh);
-            complex<double> dilogsh = dilog(sh);
+            complex<double> dilogsh = real_dilog(sh); // real for sh in (0, 1)
 
             // asymptotic part
             complex<double> asymp = ((6 + pi2) * (1.0 - sh) + 3.0 * lnsh * (2.0 - 2.0 * (1.0 - sh) * ln1msh + (1 - sh) * lnsh) - 6.0 * (1.0 - sh) * dilogsh)
@@ -1743,7 +1744,7 @@ namespace eos
 
             double sh2 = sh * sh;
             double lnsh = std::log(sh), ln1msh = std::log(1.0 - sh);
-            complex<double> dilogsh = dilog(sh);
+            complex<double> dilogsh = real_dilog(sh); // real for sh in (0, 1)
 
             // asymptotic part
             complex<double> asymp = ((1.0 - sh) * (-9.0 + (15.0 + 2.0 * pi2) * sh)
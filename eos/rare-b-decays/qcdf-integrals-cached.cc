@@ -0,0 +1,361 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/rare-b-decays/qcdf-integrals-cached.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace eos
+{
+    namespace
+    {
+        /*!
+         * Flattening of the integral ensemble into contiguous real channels,
+         * one channel per tabulated Chebyshev series.
+         */
+        template <typename Process_> struct QCDFIntegralsChannels;
+
+        template <> struct QCDFIntegralsChannels<BToKstarDilepton>
+        {
+            // 13 complex integrals and the real integral j7_perp
+            static constexpr unsigned count = 27u;
+
+            static void pack(const QCDFIntegrals<BToKstarDilepton> & results, double * channels)
+            {
+                unsigned i = 0;
+                auto put = [&] (const complex<double> & z) { channels[i++] = real(z); channels[i++] = imag(z); };
+
+                put(results.j0_perp);
+                put(results.j0bar_perp);
+                put(results.j1_perp);
+                put(results.j2_perp);
+                put(results.j4_perp);
+                put(results.j5_perp);
+                put(results.j6_perp);
+                put(results.j0_parallel);
+                put(results.j1_parallel);
+                put(results.j3_parallel);
+                put(results.j4_parallel);
+                put(results.jtilde1_perp);
+                put(results.jtilde2_parallel);
+                channels[i++] = results.j7_perp;
+            }
+
+            static QCDFIntegrals<BToKstarDilepton> unpack(const double * channels)
+            {
+                QCDFIntegrals<BToKstarDilepton> results;
+
+                unsigned i = 0;
+                auto get = [&] () { const double re = channels[i++]; const double im = channels[i++]; return complex<double>(re, im); };
+
+                results.j0_perp          = get();
+                results.j0bar_perp       = get();
+                results.j1_perp          = get();
+                results.j2_perp          = get();
+                results.j4_perp          = get();
+                results.j5_perp          = get();
+                results.j6_perp          = get();
+                results.j0_parallel      = get();
+                results.j1_parallel      = get();
+                results.j3_parallel      = get();
+                results.j4_parallel      = get();
+                results.jtilde1_perp     = get();
+                results.jtilde2_parallel = get();
+                results.j7_perp          = channels[i++];
+
+                return results;
+            }
+        };
+
+        /*!
+         * Chebyshev series for all channels over one smooth piece of the q^2
+         * range. The series are expanded in a mapped coordinate in which the
+         * integrals are analytic within the panel: ln q^2 absorbs the
+         * logarithms of q^2 at the low end, and sqrt(s_threshold - q^2)
+         * regularizes the branch point at the quark-pair threshold.
+         */
+        struct Panel
+        {
+            enum class Map
+            {
+                log,
+                sqrt_threshold
+            };
+
+            Map map;
+
+            // panel bounds in q^2 and in the mapped coordinate
+            double s_lo, s_hi;
+            double x_lo, x_hi;
+
+            // branch point used by the sqrt_threshold map
+            double s_threshold;
+
+            unsigned order;
+
+            // Chebyshev coefficients, channel-major: coefficients[channel * order + k]
+            std::vector<double> coefficients;
+
+            double x_of_s(const double & s) const
+            {
+                switch (map)
+                {
+                    case Map::log:
+                        return std::log(s);
+
+                    case Map::sqrt_threshold:
+                        return std::sqrt(s_threshold - s);
+                }
+
+                return 0.0;
+            }
+
+            double s_of_x(const double & x) const
+            {
+                switch (map)
+                {
+                    case Map::log:
+                        return std::exp(x);
+
+                    case Map::sqrt_threshold:
+                        return s_threshold - x * x;
+                }
+
+                return 0.0;
+            }
+        };
+
+        template <typename Process_>
+        Panel
+        make_panel(const Panel::Map & map, const double & s_lo, const double & s_hi, const double & s_threshold,
+                const unsigned & order, const std::function<QCDFIntegrals<Process_> (const double &)> & f)
+        {
+            using Channels = QCDFIntegralsChannels<Process_>;
+
+            Panel panel;
+            panel.map = map;
+            panel.s_lo = s_lo;
+            panel.s_hi = s_hi;
+            panel.s_threshold = s_threshold;
+            panel.x_lo = std::min(panel.x_of_s(s_lo), panel.x_of_s(s_hi));
+            panel.x_hi = std::max(panel.x_of_s(s_lo), panel.x_of_s(s_hi));
+            panel.order = order;
+            panel.coefficients.assign(Channels::count * order, 0.0);
+
+            // evaluate the integrals on the Chebyshev nodes of the panel
+            std::vector<double> values(order * Channels::count);
+            for (unsigned j = 0 ; j < order ; ++j)
+            {
+                const double u = std::cos(M_PI * (j + 0.5) / order);
+                const double x = 0.5 * (panel.x_lo + panel.x_hi) + 0.5 * (panel.x_hi - panel.x_lo) * u;
+
+                Channels::pack(f(panel.s_of_x(x)), &values[j * Channels::count]);
+            }
+
+            // discrete cosine transform, channel by channel
+            for (unsigned c = 0 ; c < Channels::count ; ++c)
+            {
+                for (unsigned k = 0 ; k < order ; ++k)
+                {
+                    double sum = 0.0;
+                    for (unsigned j = 0 ; j < order ; ++j)
+                    {
+                        sum += values[j * Channels::count + c] * std::cos(M_PI * k * (j + 0.5) / order);
+                    }
+
+                    panel.coefficients[c * order + k] = 2.0 * sum / order;
+                }
+            }
+
+            return panel;
+        }
+
+        template <typename Process_>
+        QCDFIntegrals<Process_>
+        evaluate_panel(const Panel & panel, const double & s)
+        {
+            using Channels = QCDFIntegralsChannels<Process_>;
+
+            const double x = panel.x_of_s(s);
+            const double u = std::min(+1.0, std::max(-1.0, (2.0 * x - panel.x_lo - panel.x_hi) / (panel.x_hi - panel.x_lo)));
+
+            double channels[Channels::count];
+            for (unsigned c = 0 ; c < Channels::count ; ++c)
+            {
+                // Clenshaw recurrence for sum_k coefficients[k] T_k(u)
+                const double * coefficients = &panel.coefficients[c * panel.order];
+
+                double b1 = 0.0, b2 = 0.0;
+                for (unsigned k = panel.order - 1 ; k >= 1 ; --k)
+                {
+                    const double b0 = coefficients[k] + 2.0 * u * b1 - b2;
+                    b2 = b1;
+                    b1 = b0;
+                }
+
+                channels[c] = 0.5 * coefficients[0] + u * b1 - b2;
+            }
+
+            return Channels::unpack(channels);
+        }
+
+        /*!
+         * Tabulation for one of the quark-loop cases: the key collects all
+         * inputs other than q^2, and the panels are rebuilt whenever the key
+         * changes.
+         */
+        struct CaseCache
+        {
+            std::vector<double> key;
+
+            std::vector<Panel> panels;
+        };
+    }
+
+    template <typename Process_, typename Tag_>
+    struct Implementation<QCDFIntegralCache<Process_, Tag_>>
+    {
+        using ResultsType = QCDFIntegrals<Process_>;
+
+        double s_min, s_max;
+
+        unsigned order;
+
+        CaseCache massless, charm, bottom;
+
+        Implementation(const double & s_min, const double & s_max, const unsigned & order) :
+            s_min(s_min),
+            s_max(s_max),
+            order(order)
+        {
+        }
+
+        /*!
+         * Serve one quark-loop case from its tabulation, rebuilding the
+         * panels when the non-q^2 inputs have changed. Evaluations outside
+         * the tabulated range, including above the quark-pair threshold
+         * s_threshold (zero for the massless case), fall through to the
+         * direct calculator.
+         */
+        ResultsType serve(CaseCache & cache, const std::vector<double> & key, const double & s, const double & s_threshold,
+                const std::function<ResultsType (const double &)> & f)
+        {
+            // stay clear of the branch point itself, where the integrals are singular
+            double tab_max = s_max;
+            if (s_threshold > 0.0)
+            {
+                tab_max = std::min(tab_max, s_threshold * (1.0 - 1.0e-6));
+            }
+
+            if ((s < s_min) || (s > tab_max) || (tab_max <= s_min))
+            {
+                return f(s);
+            }
+
+            if (cache.key != key)
+            {
+                cache.key = key;
+                cache.panels.clear();
+
+                if (s_threshold > 0.0)
+                {
+                    // split the range: the low panel resolves the logarithms of q^2,
+                    // the high panel the branch point at the quark-pair threshold
+                    const double s_mid = std::sqrt(s_min * tab_max);
+
+                    cache.panels.push_back(make_panel<Process_>(Panel::Map::log, s_min, s_mid, 0.0, order, f));
+                    cache.panels.push_back(make_panel<Process_>(Panel::Map::sqrt_threshold, s_mid, tab_max, s_threshold, order, f));
+                }
+                else
+                {
+                    cache.panels.push_back(make_panel<Process_>(Panel::Map::log, s_min, tab_max, 0.0, order, f));
+                }
+            }
+
+            for (const auto & panel : cache.panels)
+            {
+                if ((s >= panel.s_lo) && (s <= panel.s_hi))
+                {
+                    return evaluate_panel<Process_>(panel, s);
+                }
+            }
+
+            return f(s);
+        }
+    };
+
+    template <typename Process_, typename Tag_>
+    QCDFIntegralCache<Process_, Tag_>::QCDFIntegralCache(const double & s_min, const double & s_max, const unsigned & order) :
+        PrivateImplementationPattern<QCDFIntegralCache<Process_, Tag_>>(new Implementation<QCDFIntegralCache<Process_, Tag_>>(s_min, s_max, order))
+    {
+    }
+
+    template <typename Process_, typename Tag_>
+    QCDFIntegralCache<Process_, Tag_>::~QCDFIntegralCache()
+    {
+    }
+
+    template <typename Process_, typename Tag_>
+    QCDFIntegrals<Process_>
+    QCDFIntegralCache<Process_, Tag_>::dilepton_bottom_case(const double & s, const double & m_b, const double & m_B, const double & m_V, const double & mu,
+            const double & a_1_perp, const double & a_2_perp,
+            const double & a_1_parallel, const double & a_2_parallel)
+    {
+        return this->_imp->serve(this->_imp->bottom, { m_b, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel },
+                s, 4.0 * m_b * m_b, [&] (const double & s)
+                {
+                    return Calculator::dilepton_bottom_case(s, m_b, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+                });
+    }
+
+    template <typename Process_, typename Tag_>
+    QCDFIntegrals<Process_>
+    QCDFIntegralCache<Process_, Tag_>::dilepton_charm_case(const double & s, const double & m_c, const double & m_B, const double & m_V, const double & mu,
+            const double & a_1_perp, const double & a_2_perp,
+            const double & a_1_parallel, const double & a_2_parallel)
+    {
+        return this->_imp->serve(this->_imp->charm, { m_c, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel },
+                s, 4.0 * m_c * m_c, [&] (const double & s)
+                {
+                    return Calculator::dilepton_charm_case(s, m_c, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+                });
+    }
+
+    template <typename Process_, typename Tag_>
+    QCDFIntegrals<Process_>
+    QCDFIntegralCache<Process_, Tag_>::dilepton_massless_case(const double & s, const double & m_B, const double & m_V, const double & mu,
+            const double & a_1_perp, const double & a_2_perp,
+            const double & a_1_parallel, const double & a_2_parallel)
+    {
+        return this->_imp->serve(this->_imp->massless, { m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel },
+                s, 0.0, [&] (const double & s)
+                {
+                    return Calculator::dilepton_massless_case(s, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_parallel, a_2_parallel);
+                });
+    }
+
+    // explicit instantiation
+    template class QCDFIntegralCache<BToKstarDilepton, tag::Analytical>;
+    template class QCDFIntegralCache<BToKstarDilepton, tag::Mixed>;
+    template class QCDFIntegralCache<BToKstarDilepton, tag::Numerical>;
+}
@@ -0,0 +1,99 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_RARE_B_DECAYS_QCDF_INTEGRALS_CACHED_HH
+#define EOS_GUARD_EOS_RARE_B_DECAYS_QCDF_INTEGRALS_CACHED_HH 1
+
+#include <eos/rare-b-decays/qcdf-integrals.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+namespace eos
+{
+    /*!
+     * QCDFIntegralCache serves the dilepton QCDF integrals from per-component
+     * Chebyshev interpolants in q^2.
+     *
+     * Besides q^2, the integrals depend only on a handful of slowly-varying
+     * inputs: the quark mass, the hadron masses, the renormalization scale,
+     * and the Gegenbauer moments of the vector meson's LCDAs. During a scan
+     * these inputs are constant across thousands of evaluations at varying
+     * q^2. The first time a new set of inputs is seen, the cache therefore
+     * tabulates every component of QCDFIntegrals<Process_> on Chebyshev grids
+     * covering [s_min, s_max], and serves all further evaluations at the same
+     * inputs from the interpolants.
+     *
+     * The grids are chosen such that the integrals are analytic within each
+     * panel: the low-q^2 panel is tabulated in ln q^2, which absorbs the
+     * logarithms of q^2 / m_B^2, whilst for the massive quark loops the
+     * high-q^2 panel is tabulated in sqrt(4 m_q^2 - q^2), which regularizes
+     * the branch point at the quark-pair threshold.
+     *
+     * Evaluations outside [s_min, s_max], or above the quark-pair threshold,
+     * bypass the cache and call the underlying calculator directly. A cache
+     * is not safe for concurrent use; each user should hold its own instance,
+     * as the amplitude objects do.
+     */
+    template <typename Process_, typename Tag_>
+    class QCDFIntegralCache :
+        public PrivateImplementationPattern<QCDFIntegralCache<Process_, Tag_>>
+    {
+        public:
+            using Calculator  = QCDFIntegralCalculator<Process_, Tag_>;
+            using ResultsType = QCDFIntegrals<Process_>;
+
+            /*!
+             * Constructor.
+             *
+             * @param s_min Lower end of the tabulated q^2 range.
+             * @param s_max Upper end of the tabulated q^2 range.
+             * @param order Number of Chebyshev nodes per grid panel.
+             */
+            QCDFIntegralCache(const double & s_min, const double & s_max, const unsigned & order = 48);
+
+            /// Destructor.
+            ~QCDFIntegralCache();
+
+            /*!
+             * Return all QCDF Integrals for a b quark-antiquark loop; see
+             * QCDFIntegralCalculator::dilepton_bottom_case for the arguments.
+             */
+            ResultsType dilepton_bottom_case(const double & s, const double & m_b, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            /*!
+             * Return all QCDF Integrals for a c quark-antiquark loop; see
+             * QCDFIntegralCalculator::dilepton_charm_case for the arguments.
+             */
+            ResultsType dilepton_charm_case(const double & s, const double & m_c, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+
+            /*!
+             * Return all QCDF Integrals for u,d,s (i.e. massless) quark-antiquark
+             * loops; see QCDFIntegralCalculator::dilepton_massless_case for the
+             * arguments.
+             */
+            ResultsType dilepton_massless_case(const double & s, const double & m_B, const double & m_V, const double & mu,
+                    const double & a_1_perp, const double & a_2_perp,
+                    const double & a_1_parallel, const double & a_2_parallel);
+    };
+}
+
+#endif
@@ -0,0 +1,135 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/rare-b-decays/qcdf-integrals-cached.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    void
+    check_component(const complex<double> & cached, const complex<double> & direct, const double & eps)
+    {
+        if (std::abs(direct) > 1e-10)
+        {
+            TEST_CHECK_RELATIVE_ERROR(real(cached), real(direct), eps);
+            TEST_CHECK_NEARLY_EQUAL(imag(cached), imag(direct), eps * std::abs(direct));
+        }
+        else
+        {
+            TEST_CHECK_NEARLY_EQUAL(real(cached), real(direct), eps);
+            TEST_CHECK_NEARLY_EQUAL(imag(cached), imag(direct), eps);
+        }
+    }
+
+    void
+    check_results(const QCDFIntegrals<BToKstarDilepton> & cached, const QCDFIntegrals<BToKstarDilepton> & direct, const double & eps)
+    {
+        check_component(cached.j0_perp,          direct.j0_perp,          eps);
+        check_component(cached.j0bar_perp,       direct.j0bar_perp,       eps);
+        check_component(cached.j1_perp,          direct.j1_perp,          eps);
+        check_component(cached.j2_perp,          direct.j2_perp,          eps);
+        check_component(cached.j4_perp,          direct.j4_perp,          eps);
+        check_component(cached.j5_perp,          direct.j5_perp,          eps);
+        check_component(cached.j6_perp,          direct.j6_perp,          eps);
+        check_component(cached.j0_parallel,      direct.j0_parallel,      eps);
+        check_component(cached.j1_parallel,      direct.j1_parallel,      eps);
+        check_component(cached.j3_parallel,      direct.j3_parallel,      eps);
+        check_component(cached.j4_parallel,      direct.j4_parallel,      eps);
+        check_component(cached.jtilde1_perp,     direct.jtilde1_perp,     eps);
+        check_component(cached.jtilde2_parallel, direct.jtilde2_parallel, eps);
+        TEST_CHECK_RELATIVE_ERROR(cached.j7_perp, direct.j7_perp,         eps);
+    }
+}
+
+class QCDFIntegralCacheTest :
+    public TestCase
+{
+    public:
+        using Calculator = QCDFIntegralCalculator<BToKstarDilepton, tag::Analytical>;
+        using Cache = QCDFIntegralCache<BToKstarDilepton, tag::Analytical>;
+
+        QCDFIntegralCacheTest() :
+            TestCase("qcdf_integral_cache_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double m_B = 5.279, m_Kstar = 0.892, mu = 4.2;
+            static const double m_b = 4.8, m_c = 1.6;
+            static const double a_1_perp = 0.04, a_2_perp = 0.10, a_1_par = 0.05, a_2_par = 0.09;
+
+            static const double s_values[] = { 0.1, 0.5, 1.0, 2.0, 3.0, 4.5, 6.0, 7.5, 9.0, 9.6 };
+
+            Cache cache(0.1, 9.6);
+
+            // serving from the interpolants agrees with the direct calculator throughout the range
+            for (const double & s : s_values)
+            {
+                check_results(
+                        cache.dilepton_massless_case(s, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_massless_case(s, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-8);
+
+                check_results(
+                        cache.dilepton_bottom_case(s, m_b, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_bottom_case(s, m_b, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-8);
+
+                // the charm-pair threshold at 4 m_c^2 = 10.24 limits the convergence
+                // near the upper end of the range
+                check_results(
+                        cache.dilepton_charm_case(s, m_c, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_charm_case(s, m_c, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-6);
+            }
+
+            // changing any non-q^2 input rebuilds the tabulation
+            for (const double & s : s_values)
+            {
+                check_results(
+                        cache.dilepton_massless_case(s, m_B, m_Kstar, 2.0 * mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_massless_case(s, m_B, m_Kstar, 2.0 * mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-8);
+
+                check_results(
+                        cache.dilepton_charm_case(s, m_c, m_B, m_Kstar, 2.0 * mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_charm_case(s, m_c, m_B, m_Kstar, 2.0 * mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-6);
+            }
+
+            // evaluations outside the tabulated range bypass the cache and
+            // reproduce the direct calculator, including its exceptions
+            {
+                check_results(
+                        cache.dilepton_massless_case(15.0, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        Calculator::dilepton_massless_case(15.0, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par),
+                        1e-15);
+
+                TEST_CHECK_THROWS(InternalError,
+                        cache.dilepton_charm_case(15.0, m_c, m_B, m_Kstar, mu, a_1_perp, a_2_perp, a_1_par, a_2_par));
+            }
+        }
+} qcdf_integral_cache_test;
@@ -18,6 +18,7 @@
  */
 
 #include <eos/maths/integrate.hh>
+#include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/nonlocal-form-factors/hard-scattering.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
@@ -25,6 +26,7 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <cmath>
 #include <functional>
 #include <limits>
@@ -33,8 +35,6 @@
 
 namespace eos
 {
-    using namespace std::placeholders;
-
     /* photon final state */
 
     // massless case
@@ -99,11 +99,21 @@ namespace eos
         static const double u_min = 0.0 + 1e-5;
         static const double u_max = 1.0 - 1e-5;
 
-        // we only need to correct integral J_1
-        std::function<complex<double> (const double &)> j_1_perp = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_para, a_2_para);
-        results.j1_perp     = integrate1D(j_1_perp, 128, u_min, u_max);
-        results.j1_parallel = integrate1D(j_1_para, 128, u_min, u_max);
+        // we only need to correct integral J_1; integrating its Gegenbauer-moment
+        // components shares one evaluation of I1 per sampling point across both
+        // polarizations
+        std::function<std::array<double, 6> (const double &)> j_1_components = [=] (const double & u) -> std::array<double, 6>
+        {
+            const auto j1 = HardScattering::j1_moments(s, u, m_c, m_B);
+
+            return {{ real(j1[0]), imag(j1[0]), real(j1[1]), imag(j1[1]), real(j1[2]), imag(j1[2]) }};
+        };
+        const std::array<double, 6> j_1 = integrate1D(j_1_components, 128, u_min, u_max);
+
+        results.j1_perp     = complex<double>(j_1[0] + a_1_perp * j_1[2] + a_2_perp * j_1[4],
+                                              j_1[1] + a_1_perp * j_1[3] + a_2_perp * j_1[5]);
+        results.j1_parallel = complex<double>(j_1[0] + a_1_para * j_1[2] + a_2_para * j_1[4],
+                                              j_1[1] + a_1_para * j_1[3] + a_2_para * j_1[5]);
 
         // composite results
         const double sh = s / m_B / m_B;
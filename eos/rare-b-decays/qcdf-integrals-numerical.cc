@@ -18,6 +18,7 @@
  */
 
 #include <eos/maths/integrate.hh>
+#include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/nonlocal-form-factors/hard-scattering.hh>
 #include <eos/rare-b-decays/qcdf-integrals.hh>
@@ -25,6 +26,7 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/stringify.hh>
 
+#include <array>
 #include <cmath>
 #include <functional>
 #include <limits>
@@ -35,6 +37,83 @@ namespace eos
 {
     using namespace std::placeholders;
 
+    namespace
+    {
+        /*
+         * Evaluates the QCDF integrals that share the domain [u_min, u_max] in a
+         * single fused array-valued pass over the Gegenbauer-moment components:
+         * each kernel is linear in the Gegenbauer coefficients, so the moment
+         * components are integrated once -- with the loop functions evaluated
+         * once per sampling point for all of them -- and contracted with the
+         * perpendicular, charge-conjugated, and parallel moments afterwards.
+         * The massless case differs from the massive ones only in its use of
+         * j2_massless/j3_massless.
+         */
+        template <bool massless_>
+        void
+        fused_dilepton_integrals(QCDFIntegrals<BToKstarDilepton> & results,
+                const double & s, const double & m_q, const double & m_B, const double & mu,
+                const double & a_1_perp, const double & a_2_perp,
+                const double & a_1_para, const double & a_2_para,
+                const double & u_min, const double & u_max)
+        {
+            // layout: [0..2] moment components of j0, followed by the re/im
+            // interleaved moment components of j1 to j6 in blocks of six
+            std::function<std::array<double, 39> (const double &)> integrands = [=] (const double & u) -> std::array<double, 39>
+            {
+                const auto kernels = massless_ ? HardScattering::moment_kernels_massless(s, u, m_B, mu)
+                                               : HardScattering::moment_kernels(s, u, m_q, m_B, mu);
+
+                std::array<double, 39> result;
+                result[0] = kernels.j0[0];
+                result[1] = kernels.j0[1];
+                result[2] = kernels.j0[2];
+
+                unsigned index = 3;
+                for (const auto & kernel : { kernels.j1, kernels.j2, kernels.j3, kernels.j4, kernels.j5, kernels.j6 })
+                {
+                    for (unsigned m = 0 ; m < 3 ; ++m)
+                    {
+                        result[index++] = real(kernel[m]);
+                        result[index++] = imag(kernel[m]);
+                    }
+                }
+
+                return result;
+            };
+
+            const std::array<double, 39> integrals = integrate1D(integrands, 128, u_min, u_max);
+
+            // contractions of the integrated moment components with a set of Gegenbauer moments
+            auto contract_r = [&integrals] (const unsigned & base, const double & a_1, const double & a_2) -> double
+            {
+                return integrals[base] + a_1 * integrals[base + 1] + a_2 * integrals[base + 2];
+            };
+            auto contract_c = [&integrals] (const unsigned & base, const double & a_1, const double & a_2) -> complex<double>
+            {
+                return complex<double>(
+                        integrals[base]     + a_1 * integrals[base + 2] + a_2 * integrals[base + 4],
+                        integrals[base + 1] + a_1 * integrals[base + 3] + a_2 * integrals[base + 5]);
+            };
+
+            // perpendicular amplitude
+            results.j0_perp     = contract_r(0, +a_1_perp, a_2_perp);
+            results.j0bar_perp  = contract_r(0, -a_1_perp, a_2_perp);
+            results.j1_perp     = contract_c( 3, a_1_perp, a_2_perp);
+            results.j2_perp     = contract_c( 9, a_1_perp, a_2_perp);
+            results.j4_perp     = contract_c(21, a_1_perp, a_2_perp);
+            results.j5_perp     = contract_c(27, a_1_perp, a_2_perp);
+            // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
+            results.j6_perp     = contract_c(33, a_1_para, a_2_para);
+
+            // parallel amplitude
+            results.j0_parallel = contract_r(0, a_1_para, a_2_para);
+            results.j1_parallel = contract_c( 3, a_1_para, a_2_para);
+            results.j3_parallel = contract_c(15, a_1_para, a_2_para);
+            results.j4_parallel = contract_c(21, a_1_para, a_2_para);
+        }
+    }
+
     // massless case
     template <>
     QCDFIntegrals<BToKstarDilepton>
@@ -88,34 +167,12 @@ namespace eos
         // in the SM of < 0.3%.
         static const double u_max_7 = 1.0 - 0.5 / m_B;
 
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, 0.0, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2_massless, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, 0.0, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, 0.0, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, 0.0, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate1D(j_0_perp,    128, u_min, u_max);
-        results.j0bar_perp = integrate1D(j_0bar_perp, 128, u_min, u_max);
-        results.j1_perp    = integrate1D(j_1_perp,    128, u_min, u_max);
-        results.j2_perp    = integrate1D(j_2_perp,    128, u_min, u_max);
-        results.j4_perp    = integrate1D(j_4_perp,    128, u_min, u_max);
-        results.j5_perp    = integrate1D(j_5_perp,    128, u_min, u_max);
-        results.j6_perp    = integrate1D(j_6_perp,    128, u_min, u_max);
-        results.j7_perp    = integrate1D(j_7_perp,    128, u_min, u_max_7);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, 0.0, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3_massless, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, 0.0, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate1D(j_0_para, 128, u_min, u_max);
-        results.j1_parallel = integrate1D(j_1_para, 128, u_min, u_max);
-        results.j3_parallel = integrate1D(j_3_para, 128, u_min, u_max);
-        results.j4_parallel = integrate1D(j_4_para, 128, u_min, u_max);
+        // all integrals over the common domain, in one fused pass
+        fused_dilepton_integrals<true>(results, s, 0.0, m_B, mu, a_1_perp, a_2_perp, a_1_para, a_2_para, u_min, u_max);
+
+        // j7 is regularised by its own cut-off
+        auto j_7_perp = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
+        results.j7_perp = integrate1D(j_7_perp, 128, u_min, u_max_7);
 
         // composite results
         const double sh = s / m_B / m_B;
@@ -146,34 +203,12 @@ namespace eos
         // in the SM of < 0.3%.
         static const double u_max_7 = 1.0 - 0.5 / m_B;
 
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2, s, _1, m_c, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, m_c, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, m_c, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, m_c, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate1D(j_0_perp,    128, u_min, u_max);
-        results.j0bar_perp = integrate1D(j_0bar_perp, 128, u_min, u_max);
-        results.j1_perp    = integrate1D(j_1_perp,    128, u_min, u_max);
-        results.j2_perp    = integrate1D(j_2_perp,    128, u_min, u_max);
-        results.j4_perp    = integrate1D(j_4_perp,    128, u_min, u_max);
-        results.j5_perp    = integrate1D(j_5_perp,    128, u_min, u_max);
-        results.j6_perp    = integrate1D(j_6_perp,    128, u_min, u_max);
-        results.j7_perp    = integrate1D(j_7_perp,    128, u_min, u_max_7);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, m_c, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3, s, _1, m_c, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, m_c, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate1D(j_0_para, 128, u_min, u_max);
-        results.j1_parallel = integrate1D(j_1_para, 128, u_min, u_max);
-        results.j3_parallel = integrate1D(j_3_para, 128, u_min, u_max);
-        results.j4_parallel = integrate1D(j_4_para, 128, u_min, u_max);
+        // all integrals over the common domain, in one fused pass
+        fused_dilepton_integrals<false>(results, s, m_c, m_B, mu, a_1_perp, a_2_perp, a_1_para, a_2_para, u_min, u_max);
+
+        // j7 is regularised by its own cut-off
+        auto j_7_perp = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
+        results.j7_perp = integrate1D(j_7_perp, 128, u_min, u_max_7);
 
         // composite results
         const double sh = s / m_B / m_B;
@@ -204,34 +239,12 @@ namespace eos
         // in the SM of < 0.3%.
         static const double u_max_7 = 1.0 - 0.5 / m_B;
 
-        // perpendicular amplitude
-        std::function<double (const double &)>          j_0_perp    = std::bind(&HardScattering::j0, s, _1, m_B, a_1_perp, a_2_perp);
-        std::function<double (const double &)>          j_0bar_perp = std::bind(&HardScattering::j0, s, _1, m_B, -a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_1_perp    = std::bind(&HardScattering::j1, s, _1, m_b, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_2_perp    = std::bind(&HardScattering::j2, s, _1, m_b, m_B, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_4_perp    = std::bind(&HardScattering::j4, s, _1, m_b, m_B, mu, a_1_perp, a_2_perp);
-        std::function<complex<double> (const double &)> j_5_perp    = std::bind(&HardScattering::j5, s, _1, m_b, m_B, mu, a_1_perp, a_2_perp);
-        // This integral arises in perpendicular amplitudes, but depends on parallel Gegenbauer moments!
-        std::function<complex<double> (const double &)> j_6_perp    = std::bind(&HardScattering::j6, s, _1, m_b, m_B, mu, a_1_para, a_2_para);
-        std::function<double (const double &)>          j_7_perp    = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
-        results.j0_perp    = integrate1D(j_0_perp,    128, u_min, u_max);
-        results.j0bar_perp = integrate1D(j_0bar_perp, 128, u_min, u_max);
-        results.j1_perp    = integrate1D(j_1_perp,    128, u_min, u_max);
-        results.j2_perp    = integrate1D(j_2_perp,    128, u_min, u_max);
-        results.j4_perp    = integrate1D(j_4_perp,    128, u_min, u_max);
-        results.j5_perp    = integrate1D(j_5_perp,    128, u_min, u_max);
-        results.j6_perp    = integrate1D(j_6_perp,    128, u_min, u_max);
-        results.j7_perp    = integrate1D(j_7_perp,    128, u_min, u_max_7);
-
-        // parallel amplitude
-        std::function<double (const double &)>          j_0_para = std::bind(&HardScattering::j0, s, _1, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_1_para = std::bind(&HardScattering::j1, s, _1, m_b, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_3_para = std::bind(&HardScattering::j3, s, _1, m_b, m_B, a_1_para, a_2_para);
-        std::function<complex<double> (const double &)> j_4_para = std::bind(&HardScattering::j4, s, _1, m_b, m_B, mu, a_1_para, a_2_para);
-        results.j0_parallel = integrate1D(j_0_para, 128, u_min, u_max);
-        results.j1_parallel = integrate1D(j_1_para, 128, u_min, u_max);
-        results.j3_parallel = integrate1D(j_3_para, 128, u_min, u_max);
-        results.j4_parallel = integrate1D(j_4_para, 128, u_min, u_max);
+        // all integrals over the common domain, in one fused pass
+        fused_dilepton_integrals<false>(results, s, m_b, m_B, mu, a_1_perp, a_2_perp, a_1_para, a_2_para, u_min, u_max);
+
+        // j7 is regularised by its own cut-off
+        auto j_7_perp = std::bind(&HardScattering::j7, s, _1, m_B, a_1_perp, a_2_perp);
+        results.j7_perp = integrate1D(j_7_perp, 128, u_min, u_max_7);
 
         // composite results
         const double sh = s / m_B / m_B;
@@ -26,11 +26,19 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <vector>
 #include <yaml-cpp/yaml.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace fs = boost::filesystem;
 
 namespace eos
@@ -88,16 +96,57 @@ namespace eos
         return _imp->inspire_id;
     }
 
+    namespace
+    {
+        /*
+         * Layout of the binary references cache: an 8-byte magic tag followed by
+         * a 32-bit entry count, then one record per entry holding six
+         * length-prefixed strings (name, authors, title, eprint archive, eprint
+         * id, inspire id) back to back. All integers are 32 bit in host byte
+         * order, since the cache is generated on the build host.
+         */
+        const char reference_cache_magic[8] = { 'E', 'O', 'S', 'R', 'E', 'F', 'S', '1' };
+    }
+
     template <> struct Implementation<References>
     {
             std::map<ReferenceName, std::shared_ptr<const Reference>> reference_map;
 
-            Implementation() { load(); }
+            // memory-mapped binary cache, and the offset of each entry's record within it
+            const unsigned char * cache_data;
+            std::size_t           cache_size;
+
+            std::map<ReferenceName, std::size_t> cache_index;
+
+            // true once either the cache index or the full reference map has been prepared
+            bool initialized;
+
+            // true once reference_map holds every known reference
+            bool complete;
+
+            // loading is deferred until the first access: the references are pure
+            // metadata, and most sessions never print any citation
+            Implementation() :
+                cache_data(nullptr),
+                cache_size(0),
+                initialized(false),
+                complete(false)
+            {
+            }
 
             Implementation(const Implementation &) = delete;
 
-            void
-            load()
+            ~Implementation()
+            {
+                if (cache_data)
+                {
+                    ::munmap(const_cast<unsigned char *>(cache_data), cache_size);
+                }
+            }
+
+            /* Locate the directory containing the references files. */
+            static fs::path
+            base_path()
             {
                 fs::path base;
                 if (std::getenv("EOS_TESTS_REFERENCES"))
@@ -125,7 +174,251 @@ namespace eos
                     throw InternalError("Expect '" + base.string() + " to be a directory");
                 }
 
-                auto file_path = base / "references.yaml";
+                return base;
+            }
+
+            /* Prepare the lazy state on the first access. */
+            void
+            initialize()
+            {
+                if (initialized)
+                {
+                    return;
+                }
+
+                initialized = true;
+
+                // prefer the binary cache; fall back to parsing the YAML file
+                if (map_cache())
+                {
+                    return;
+                }
+
+                load();
+                complete = true;
+            }
+
+            bool
+            map_cache()
+            {
+                try
+                {
+                    const fs::path base       = base_path();
+                    const fs::path cache_path = base / "references.bin";
+                    const fs::path yaml_path  = base / "references.yaml";
+
+                    if (! fs::is_regular_file(fs::status(cache_path)))
+                    {
+                        return false;
+                    }
+
+                    // an out-of-date cache is ignored in favour of the YAML file
+                    if (fs::is_regular_file(fs::status(yaml_path)) && (fs::last_write_time(yaml_path) > fs::last_write_time(cache_path)))
+                    {
+                        return false;
+                    }
+
+                    const int fd = ::open(cache_path.string().c_str(), O_RDONLY);
+                    if (fd < 0)
+                    {
+                        return false;
+                    }
+
+                    struct stat st;
+                    if (::fstat(fd, &st) < 0)
+                    {
+                        ::close(fd);
+                        return false;
+                    }
+
+                    void * data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                    ::close(fd);
+                    if (MAP_FAILED == data)
+                    {
+                        return false;
+                    }
+
+                    cache_data = static_cast<const unsigned char *>(data);
+                    cache_size = st.st_size;
+
+                    if (! index_cache())
+                    {
+                        ::munmap(data, cache_size);
+                        cache_data = nullptr;
+                        cache_size = 0;
+                        cache_index.clear();
+                        return false;
+                    }
+
+                    return true;
+                }
+                catch (...)
+                {
+                    return false;
+                }
+            }
+
+            /* Readers for the cache's wire format; false signals truncated or corrupt data. */
+            bool
+            read_u32(std::size_t & pos, uint32_t & value) const
+            {
+                if (pos + sizeof(uint32_t) > cache_size)
+                {
+                    return false;
+                }
+
+                std::memcpy(&value, cache_data + pos, sizeof(uint32_t));
+                pos += sizeof(uint32_t);
+
+                return true;
+            }
+
+            bool
+            read_string(std::size_t & pos, std::string & value) const
+            {
+                uint32_t length;
+                if (! read_u32(pos, length))
+                {
+                    return false;
+                }
+
+                if (pos + length > cache_size)
+                {
+                    return false;
+                }
+
+                value.assign(reinterpret_cast<const char *>(cache_data + pos), length);
+                pos += length;
+
+                return true;
+            }
+
+            bool
+            skip_string(std::size_t & pos) const
+            {
+                uint32_t length;
+                if (! read_u32(pos, length))
+                {
+                    return false;
+                }
+
+                if (pos + length > cache_size)
+                {
+                    return false;
+                }
+
+                pos += length;
+
+                return true;
+            }
+
+            /* Build the name -> record offset index without decoding any entry's payload. */
+            bool
+            index_cache()
+            {
+                if ((cache_size < sizeof(reference_cache_magic)) || (0 != std::memcmp(cache_data, reference_cache_magic, sizeof(reference_cache_magic))))
+                {
+                    return false;
+                }
+                std::size_t pos = sizeof(reference_cache_magic);
+
+                uint32_t count;
+                if (! read_u32(pos, count))
+                {
+                    return false;
+                }
+
+                for (uint32_t i = 0 ; i < count ; ++i)
+                {
+                    const std::size_t record = pos;
+
+                    std::string name;
+                    if (! read_string(pos, name))
+                    {
+                        return false;
+                    }
+
+                    // skip authors, title, eprint archive, eprint id, inspire id
+                    for (unsigned j = 0 ; j < 5 ; ++j)
+                    {
+                        if (! skip_string(pos))
+                        {
+                            return false;
+                        }
+                    }
+
+                    cache_index.emplace(ReferenceName(name), record);
+                }
+
+                return pos == cache_size;
+            }
+
+            /* Decode a single entry from its record offset. */
+            std::shared_ptr<const Reference>
+            decode(std::size_t pos) const
+            {
+                std::string name, authors, title, eprint_archive, eprint_id, inspire_id;
+
+                if (! (read_string(pos, name) && read_string(pos, authors) && read_string(pos, title)
+                        && read_string(pos, eprint_archive) && read_string(pos, eprint_id) && read_string(pos, inspire_id)))
+                {
+                    throw InternalError("Corrupt entry encountered in the references cache");
+                }
+
+                return std::shared_ptr<const Reference>(new Reference(new Implementation<Reference>{ ReferenceName(name), authors, title, eprint_archive, eprint_id, inspire_id }));
+            }
+
+            std::shared_ptr<const Reference>
+            lookup(const ReferenceName & name)
+            {
+                initialize();
+
+                auto i = reference_map.find(name);
+                if (reference_map.end() != i)
+                {
+                    return i->second;
+                }
+
+                auto j = cache_index.find(name);
+                if (cache_index.end() == j)
+                {
+                    return {};
+                }
+
+                auto reference = decode(j->second);
+                reference_map.emplace(name, reference);
+
+                return reference;
+            }
+
+            /* Decode every entry, e.g. for iteration over all references. */
+            void
+            materialize()
+            {
+                initialize();
+
+                if (complete)
+                {
+                    return;
+                }
+
+                for (const auto & entry : cache_index)
+                {
+                    if (reference_map.end() != reference_map.find(entry.first))
+                    {
+                        continue;
+                    }
+
+                    reference_map.emplace(entry.first, decode(entry.second));
+                }
+
+                complete = true;
+            }
+
+            void
+            load()
+            {
+                auto file_path = base_path() / "references.yaml";
 
                 if (! fs::is_regular_file(status(file_path)))
                 {
@@ -250,26 +543,65 @@ namespace eos
     References::ReferenceIterator
     References::begin() const
     {
+        _imp->materialize();
+
         return ReferenceIterator(_imp->reference_map.cbegin());
     }
 
     References::ReferenceIterator
     References::end() const
     {
+        _imp->materialize();
+
         return ReferenceIterator(_imp->reference_map.cend());
     }
 
     std::shared_ptr<const Reference>
     References::operator[] (const ReferenceName & name) const
     {
-        auto i = _imp->reference_map.find(name);
+        return _imp->lookup(name);
+    }
+
+    void
+    References::write_cache(const std::string & file_name) const
+    {
+        _imp->materialize();
 
-        if (_imp->reference_map.end() == i)
+        std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+        if (! file)
         {
-            return {};
+            throw InternalError("Could not open references cache file '" + file_name + "' for writing");
         }
 
-        return i->second;
+        auto write_u32 = [&file] (const uint32_t & value)
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(uint32_t));
+        };
+        auto write_string = [&] (const std::string & value)
+        {
+            write_u32(value.size());
+            file.write(value.data(), value.size());
+        };
+
+        file.write(reference_cache_magic, sizeof(reference_cache_magic));
+        write_u32(_imp->reference_map.size());
+
+        for (const auto & entry : _imp->reference_map)
+        {
+            const auto & reference = *entry.second;
+
+            write_string(entry.first.str());
+            write_string(reference.authors());
+            write_string(reference.title());
+            write_string(reference.eprint_archive());
+            write_string(reference.eprint_id());
+            write_string(reference.inspire_id());
+        }
+
+        if (! file)
+        {
+            throw InternalError("Could not write references cache file '" + file_name + "'");
+        }
     }
 
     template <> struct WrappedForwardIteratorTraits<ReferenceUser::ReferenceIteratorTag>
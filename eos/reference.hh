@@ -104,6 +104,18 @@ namespace eos
              * @param name  The name of the Reference that shall be retrieved.
              */
             ReferencePtr operator[] (const ReferenceName & name) const;
+
+            /*!
+             * Write all references to a compact binary cache file.
+             *
+             * The cache is generated at build time from references.yaml and
+             * installed next to it. When present and not older than the YAML
+             * file, it is memory-mapped and decoded per entry on first access,
+             * so that constructing References does not parse any YAML.
+             *
+             * @param file_name  The path of the cache file that shall be written.
+             */
+            void write_cache(const std::string & file_name) const;
     };
 
     extern template class WrappedForwardIterator<References::ReferenceIteratorTag, const std::pair<const ReferenceName, ReferencePtr>>;
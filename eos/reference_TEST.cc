@@ -21,8 +21,12 @@
 
 #include <test/test.hh>
 
+#include <cstdlib>
+#include <string>
 #include <vector>
 
+#include <sys/stat.h>
+
 using namespace test;
 using namespace eos;
 
@@ -69,3 +73,65 @@ class ReferencesTest : public TestCase
             }
         }
 } references_test;
+
+class ReferencesCacheTest : public TestCase
+{
+    public:
+        ReferencesCacheTest() :
+            TestCase("references_cache_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            /* Write the binary cache and read the references back through it */
+            {
+                auto yaml_backed = References();
+
+                // a directory holding only the binary cache, so that reading
+                // from it must go through the memory-mapped path
+                static const std::string cache_dir  = "/tmp/references_TEST";
+                static const std::string cache_file = cache_dir + "/references.bin";
+                ::mkdir(cache_dir.c_str(), 0755);
+
+                TEST_CHECK_NO_THROW(yaml_backed.write_cache(cache_file));
+
+                const std::string original_env = std::getenv("EOS_TESTS_REFERENCES");
+                ::setenv("EOS_TESTS_REFERENCES", cache_dir.c_str(), 1);
+
+                auto cache_backed = References();
+
+                // lookups by name agree with the YAML-backed instance
+                static const std::vector<ReferenceName> names{ "ATLAS:2013A", "BHvD:2012A" };
+                for (auto & n : names)
+                {
+                    std::shared_ptr<const Reference> r;
+
+                    TEST_CHECK_NO_THROW(r = cache_backed[n]);
+
+                    TEST_CHECK(r.get() != nullptr);
+                    TEST_CHECK_EQUAL(r->authors(),        yaml_backed[n]->authors());
+                    TEST_CHECK_EQUAL(r->title(),          yaml_backed[n]->title());
+                    TEST_CHECK_EQUAL(r->eprint_archive(), yaml_backed[n]->eprint_archive());
+                    TEST_CHECK_EQUAL(r->eprint_id(),      yaml_backed[n]->eprint_id());
+                    TEST_CHECK_EQUAL(r->inspire_id(),     yaml_backed[n]->inspire_id());
+                }
+
+                // an unknown name yields an empty pointer, as for the YAML path
+                TEST_CHECK(nullptr == cache_backed[ReferenceName("XYZ:2019A")].get());
+
+                // iteration materializes every entry, in the same order
+                auto y = yaml_backed.begin();
+                for (const auto & c : cache_backed)
+                {
+                    TEST_CHECK(yaml_backed.end() != y);
+                    TEST_CHECK_EQUAL(c.first.str(), y->first.str());
+                    ++y;
+                }
+                TEST_CHECK(yaml_backed.end() == y);
+
+                ::setenv("EOS_TESTS_REFERENCES", original_env.c_str(), 1);
+            }
+        }
+} references_cache_test;
@@ -0,0 +1,49 @@
+/* vim: set sw=4 sts=4 et foldmethod=marker foldmarker={{{,}}} : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/reference.hh>
+
+#include <iostream>
+
+/*
+ * Build-time helper: parses references.yaml (located through the usual
+ * EOS_TESTS_REFERENCES / EOS_HOME / EOS_DATADIR search) and writes the binary
+ * references cache that References memory-maps at run time.
+ */
+int
+main(int argc, char * argv[])
+{
+    if (2 != argc)
+    {
+        std::cerr << "usage: references-cache-generator OUTPUT-FILE" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        eos::References().write_cache(argv[1]);
+    }
+    catch (eos::Exception & e)
+    {
+        std::cerr << "references-cache-generator: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
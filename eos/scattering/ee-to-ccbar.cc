@@ -356,7 +356,7 @@ namespace eos
             return T1f;
         }
 
-        double sigma_eetochannel(const IntermediateResult * intermediate_result, const Channels & channel)
+        double sigma_from_row(const std::array<complex<double>, EEToCCBar::nchannels> & tmatrix_row_0, const complex<double> & s, const Channels & channel)
         {
             // Conversion factor between GeV^2 and nb
             static const double speedoflight = 299792458.; // Exact value
@@ -364,9 +364,14 @@ namespace eos
 
             // Channel properties
             const double Nf = 2.0 * K->_channels[channel]->_l_orbital + 1.0;
-            const double rhof = std::abs(K->_channels[channel]->rho(intermediate_result->s));
+            const double rhof = std::abs(K->_channels[channel]->rho(s));
+
+            return GeVtonb / std::abs(s) * Nf * rhof * norm(tmatrix_row_0[channel]);
+        }
 
-            return GeVtonb / std::abs(intermediate_result->s) * Nf * rhof * norm(T_eetochannel(intermediate_result, channel));
+        double sigma_eetochannel(const IntermediateResult * intermediate_result, const Channels & channel)
+        {
+            return sigma_from_row(intermediate_result->tmatrix_row_0, intermediate_result->s, channel);
         }
 
         // K matrix widths, they are not expected to match the experimental ones
@@ -398,6 +403,61 @@ namespace eos
         {
             return K->spectral_function(resonance, E * E);
         }
+
+        // Dense energy scan: one T-matrix row per energy, shared between all
+        // quantities, through the batched fixed-size kernel
+        EEToCCBar::ScanResults scan(const std::vector<double> & energies)
+        {
+            const std::size_t n = energies.size();
+
+            std::vector<complex<double>> s(n);
+            for (std::size_t k = 0 ; k < n ; ++k)
+            {
+                s[k] = complex<double>(energies[k] * energies[k], 0.0);
+            }
+
+            std::vector<std::array<complex<double>, EEToCCBar::nchannels>> rows(n);
+            K->tmatrix_row(0, s.data(), rows.data(), n);
+
+            EEToCCBar::ScanResults results;
+            results.T_ee.resize(n);
+            results.T_eff.resize(n);
+            results.T_D0Dbar0.resize(n);
+            results.T_DpDm.resize(n);
+            results.sigma_ee.resize(n);
+            results.sigma_eff.resize(n);
+            results.sigma_D0Dbar0.resize(n);
+            results.sigma_DpDm.resize(n);
+            results.R.resize(n);
+
+            for (std::size_t k = 0 ; k < n ; ++k)
+            {
+                const auto & row = rows[k];
+
+                results.T_ee[k]      = row[ee];
+                results.T_eff[k]     = row[eff3770];
+                results.T_D0Dbar0[k] = row[D0Dbar0];
+                results.T_DpDm[k]    = row[DpDm];
+
+                results.sigma_ee[k] = exclusive_norm * sigma_from_row(row, s[k], ee);
+                results.sigma_eff[k] = exclusive_norm * (
+                      sigma_from_row(row, s[k], effJpsi)
+                    + sigma_from_row(row, s[k], eff2S)
+                    + sigma_from_row(row, s[k], eff3770)
+                    );
+                results.sigma_D0Dbar0[k] = exclusive_norm * sigma_from_row(row, s[k], D0Dbar0);
+                results.sigma_DpDm[k]    = exclusive_norm * sigma_from_row(row, s[k], DpDm);
+
+                double total_sigma = 0.0;
+                for (unsigned i = 1 ; i < EEToCCBar::nchannels ; i++)
+                {
+                    total_sigma += sigma_from_row(row, s[k], Channels(i));
+                }
+                results.R[k] = total_sigma / sigma_eetomumu_leading_order(energies[k]) + Rconstant;
+            }
+
+            return results;
+        }
     };
 
     EEToCCBar::EEToCCBar(const Parameters & parameters, const Options & options) :
@@ -747,6 +807,12 @@ namespace eos
         return _imp->R(ir);
     }
 
+    EEToCCBar::ScanResults
+    EEToCCBar::scan(const std::vector<double> & energies) const
+    {
+        return _imp->scan(energies);
+    }
+
     const std::set<ReferenceName>
     EEToCCBar::references
     {
@@ -314,6 +314,34 @@ namespace eos
             // R ratios
             double R(const IntermediateResult *) const;
 
+            /*!
+             * Results of a dense energy scan, stored as one contiguous array
+             * per quantity; see scan().
+             */
+            struct ScanResults
+            {
+                // amplitudes ee -> channel on the first Riemann sheet
+                std::vector<complex<double>> T_ee, T_eff, T_D0Dbar0, T_DpDm;
+
+                // cross sections, with sigma_eff summing the three effective channels
+                std::vector<double> sigma_ee, sigma_eff, sigma_D0Dbar0, sigma_DpDm;
+
+                // R ratio
+                std::vector<double> R;
+            };
+
+            /*!
+             * Evaluate the channel amplitudes, the channel cross sections, and
+             * the R ratio for an array of energies in one call.
+             *
+             * The T-matrix row is computed once per energy and shared between
+             * all quantities, and the K-matrix parameters are read only once
+             * for the whole scan; this is substantially cheaper than preparing
+             * each energy through the observable interface when scanning a
+             * lineshape over thousands of points.
+             */
+            ScanResults scan(const std::vector<double> & energies) const;
+
             /*!
              * References used in the computation of our observables.
              */
@@ -239,5 +239,56 @@ class eetoccbarTest :
                 TEST_CHECK_RELATIVE_ERROR(c.re_T_II_eetoDpDm(irc),  0.296099,   eps);
                 TEST_CHECK_RELATIVE_ERROR(c.im_T_II_eetoDpDm(irc), -0.0682443,  eps);
             }
+
+            {
+                // Test the batched energy scan against the pointwise observables
+                Parameters p = Parameters::Defaults();
+                p["mass::psi(3770)"]                      =  3.796443282051135;
+                p["ee->ccbar::g0(psi(2S),e^+e^-)"]        = -0.02077753547690923;
+                p["ee->ccbar::g0(psi(3770),e^+e^-)"]      = -0.001999916489715092;
+                p["ee->ccbar::g0(psi(2S),D^0Dbar^0)"]     = -3.3693829070086214;
+                p["ee->ccbar::g0(psi(3770),D^0Dbar^0)"]   =  8.38428874933062;
+                p["ee->ccbar::g0(psi(2S),D^+D^-)"]        =  3.5692138012280807;
+                p["ee->ccbar::g0(psi(3770),D^+D^-)"]      = -8.391199026268827;
+                p["ee->ccbar::g0(psi(2S),eff(2S))"]       =  0.09237874214140328;
+                p["ee->ccbar::g0(psi(3770),eff(3770))"]   = -1.5409316160476978;
+
+                p["ee->ccbar::effective_mass"] = 0.1349768;
+
+                // Channels effective momentum
+                p["ee->ccbar::q_0"] = 0.5;
+
+                Options oo;
+                EEToCCBar c(p, oo);
+
+                const std::vector<double> energies{ 3.74, 3.78, 3.8037, 3.85 };
+
+                auto scan = c.scan(energies);
+
+                TEST_CHECK_EQUAL(scan.T_ee.size(),          energies.size());
+                TEST_CHECK_EQUAL(scan.sigma_D0Dbar0.size(), energies.size());
+                TEST_CHECK_EQUAL(scan.R.size(),             energies.size());
+
+                for (unsigned k = 0 ; k < energies.size() ; k++)
+                {
+                    auto ir = c.prepare(energies[k]);
+
+                    TEST_CHECK_RELATIVE_ERROR(real(scan.T_ee[k]),      c.re_T_eetoee(ir),      eps);
+                    TEST_CHECK_RELATIVE_ERROR(imag(scan.T_ee[k]),      c.im_T_eetoee(ir),      eps);
+                    TEST_CHECK_RELATIVE_ERROR(real(scan.T_eff[k]),     c.re_T_eetoeff(ir),     eps);
+                    TEST_CHECK_RELATIVE_ERROR(imag(scan.T_eff[k]),     c.im_T_eetoeff(ir),     eps);
+                    TEST_CHECK_RELATIVE_ERROR(real(scan.T_D0Dbar0[k]), c.re_T_eetoD0Dbar0(ir), eps);
+                    TEST_CHECK_RELATIVE_ERROR(imag(scan.T_D0Dbar0[k]), c.im_T_eetoD0Dbar0(ir), eps);
+                    TEST_CHECK_RELATIVE_ERROR(real(scan.T_DpDm[k]),    c.re_T_eetoDpDm(ir),    eps);
+                    TEST_CHECK_RELATIVE_ERROR(imag(scan.T_DpDm[k]),    c.im_T_eetoDpDm(ir),    eps);
+
+                    TEST_CHECK_RELATIVE_ERROR(scan.sigma_ee[k],      c.sigma_eetoee(ir),      eps);
+                    TEST_CHECK_RELATIVE_ERROR(scan.sigma_eff[k],     c.sigma_eetoeff(ir),     eps);
+                    TEST_CHECK_RELATIVE_ERROR(scan.sigma_D0Dbar0[k], c.sigma_eetoD0Dbar0(ir), eps);
+                    TEST_CHECK_RELATIVE_ERROR(scan.sigma_DpDm[k],    c.sigma_eetoDpDm(ir),    eps);
+
+                    TEST_CHECK_RELATIVE_ERROR(scan.R[k],             c.R(ir),                 eps);
+                }
+            }
         }
 } eetoccbar_test;
@@ -0,0 +1,248 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-event-block.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <memory>
+
+namespace eos
+{
+    namespace
+    {
+        /*
+         * One independent evaluation context per pool thread: a clone of the
+         * parameters and kinematics, and the PDF bound to these clones. The
+         * per-event kinematic variables are resolved once, so the inner loop
+         * only sets their values and evaluates.
+         */
+        struct SignalPDFEventBlockWorker
+        {
+                Parameters parameters;
+
+                Kinematics kinematics;
+
+                SignalPDFPtr pdf;
+
+                std::vector<KinematicVariable> variables;
+
+                SignalPDFEventBlockWorker(const QualifiedName & name, const Parameters & _parameters, const Kinematics & _kinematics,
+                        const Options & options, const std::vector<std::string> & kinematic_names) :
+                    parameters(_parameters.clone()),
+                    kinematics(_kinematics.clone())
+                {
+                    pdf = SignalPDF::make(name, parameters, kinematics, options);
+                    if (! pdf)
+                        throw InternalError("SignalPDFEventBlock: unknown signal PDF '" + name.full() + "'");
+
+                    for (const auto & n : kinematic_names)
+                    {
+                        variables.push_back(kinematics[n]);
+                    }
+                }
+
+                SignalPDFEventBlockWorker(const SignalPDFEventBlockWorker &) = delete;
+                SignalPDFEventBlockWorker & operator= (const SignalPDFEventBlockWorker &) = delete;
+
+                /*
+                 * Sum the (unnormalized) log PDF over n events, reading the
+                 * per-event values from the given columns at the given offset.
+                 */
+                double evaluate(const unsigned & offset, const unsigned & n, const std::vector<const double *> & columns)
+                {
+                    const unsigned n_variables = variables.size();
+
+                    double sum = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        for (unsigned v = 0 ; v < n_variables ; ++v)
+                        {
+                            variables[v].set(columns[v][offset + i]);
+                        }
+
+                        sum += pdf->evaluate();
+                    }
+
+                    return sum;
+                }
+        };
+    } // namespace
+
+    template <> struct Implementation<SignalPDFEventBlock>
+    {
+            // Event sample in columnar layout, one column per kinematic variable
+            std::vector<double> events;
+
+            unsigned n_events;
+
+            // The parameter set whose current point log_pdf_sum() evaluates
+            Parameters parameters;
+
+            std::vector<std::shared_ptr<SignalPDFEventBlockWorker>> workers;
+
+            // Generation of the master parameter set up to which the workers'
+            // clones have been synchronized
+            std::uint64_t last_sync_generation;
+
+            Implementation(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics,
+                    const Options & options, const std::vector<std::string> & kinematic_names, const std::vector<double> & events) :
+                events(events),
+                n_events(0),
+                parameters(parameters),
+                last_sync_generation(parameters.generation())
+            {
+                if (kinematic_names.empty())
+                    throw InternalError("SignalPDFEventBlock: no kinematic variables given");
+
+                if ((this->events.empty()) || (0 != this->events.size() % kinematic_names.size()))
+                    throw InternalError("SignalPDFEventBlock: event block of " + stringify(this->events.size()) + " values does not factorize into columns of "
+                            + stringify(kinematic_names.size()) + " kinematic variables");
+
+                n_events = this->events.size() / kinematic_names.size();
+
+                // one evaluation context per pool thread, each with an
+                // independent clone of the parameters and kinematics
+                const unsigned number_of_workers = std::max(1u, ThreadPool::instance()->number_of_threads());
+                for (unsigned w = 0 ; w < number_of_workers ; ++w)
+                {
+                    workers.push_back(std::make_shared<SignalPDFEventBlockWorker>(name, parameters, kinematics, options, kinematic_names));
+                }
+            }
+
+            // Propagate the parameters modified since the last synchronization
+            // to every worker's clone
+            void synchronize()
+            {
+                const std::uint64_t current_generation = parameters.generation();
+                if (current_generation == last_sync_generation)
+                    return;
+
+                for (auto p = parameters.begin(), p_end = parameters.end() ; p != p_end ; ++p)
+                {
+                    if ((*p).generation() <= last_sync_generation)
+                        continue;
+
+                    const double value = (*p).evaluate();
+                    for (const auto & worker : workers)
+                    {
+                        worker->parameters[(*p).name()].set(value);
+                    }
+                }
+
+                last_sync_generation = current_generation;
+            }
+
+            double log_pdf_sum()
+            {
+                synchronize();
+
+                // resolve the column pointers into the columnar buffer
+                const unsigned n_columns = events.size() / n_events;
+                std::vector<const double *> columns;
+                for (unsigned c = 0 ; c < n_columns ; ++c)
+                {
+                    columns.push_back(events.data() + c * static_cast<size_t>(n_events));
+                }
+
+                // split the events into one contiguous range per worker
+                const unsigned chunk = n_events / workers.size() + 1;
+                unsigned offset = 0;
+
+                std::vector<Ticket> tickets;
+                std::vector<double> partial_sums(workers.size(), 0.0);
+                std::vector<std::exception_ptr> errors(workers.size());
+
+                for (unsigned w = 0 ; w < workers.size() ; ++w)
+                {
+                    const unsigned size = std::min(chunk, n_events - offset);
+                    if (0 == size)
+                    {
+                        break;
+                    }
+
+                    SignalPDFEventBlockWorker * worker = workers[w].get();
+                    double * partial_sum = &partial_sums[w];
+                    std::exception_ptr * error = &errors[w];
+                    const unsigned worker_offset = offset;
+
+                    auto f = [worker, worker_offset, size, &columns, partial_sum, error] ()
+                    {
+                        try
+                        {
+                            *partial_sum = worker->evaluate(worker_offset, size, columns);
+                        }
+                        catch (...)
+                        {
+                            *error = std::current_exception();
+                        }
+                    };
+
+                    tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+
+                    offset += size;
+                }
+
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                        std::rethrow_exception(error);
+                }
+
+                double sum = 0.0;
+                for (const auto & partial_sum : partial_sums)
+                {
+                    sum += partial_sum;
+                }
+
+                // subtract the (log-scale) normalization once per event
+                return sum - static_cast<double>(n_events) * workers.front()->pdf->normalization();
+            }
+    };
+
+    SignalPDFEventBlock::SignalPDFEventBlock(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics,
+            const Options & options, const std::vector<std::string> & kinematic_names, const std::vector<double> & events) :
+        PrivateImplementationPattern<SignalPDFEventBlock>(new Implementation<SignalPDFEventBlock>(name, parameters, kinematics, options, kinematic_names, events))
+    {
+    }
+
+    SignalPDFEventBlock::~SignalPDFEventBlock() {}
+
+    unsigned
+    SignalPDFEventBlock::number_of_events() const
+    {
+        return _imp->n_events;
+    }
+
+    double
+    SignalPDFEventBlock::log_pdf_sum()
+    {
+        return _imp->log_pdf_sum();
+    }
+} // namespace eos
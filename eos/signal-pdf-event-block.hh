@@ -0,0 +1,87 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_SIGNAL_PDF_EVENT_BLOCK_HH
+#define EOS_GUARD_EOS_SIGNAL_PDF_EVENT_BLOCK_HH 1
+
+#include <eos/signal-pdf.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Evaluates the unbinned log-likelihood of a signal PDF over a fixed block
+     * of events.
+     *
+     * The events are loaded once, at construction, into a columnar buffer with
+     * one column per kinematic variable, and the block holds one independent
+     * clone of the PDF per pool thread. Each call to log_pdf_sum() then sums
+     * the log PDF over all events at the current parameter point, partitioned
+     * across the thread pool, and subtracts the normalization -- replacing the
+     * per-event round trips through the bindings that dominate unbinned fits
+     * over large event samples.
+     */
+    class SignalPDFEventBlock :
+        public PrivateImplementationPattern<SignalPDFEventBlock>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param name            The name of the signal PDF.
+             * @param parameters      The set of parameters at which the PDF shall be evaluated; subsequent
+             *                        changes to these parameters are picked up by log_pdf_sum().
+             * @param kinematics      The set of kinematic variables bound to the PDF, including the
+             *                        integration boundaries of its normalization.
+             * @param options         The set of options used when creating the PDF.
+             * @param kinematic_names The names of the per-event kinematic variables, one per column of the event block.
+             * @param events          The event sample in columnar layout: all values of the first variable,
+             *                        followed by all values of the second variable, and so on.
+             */
+            SignalPDFEventBlock(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics,
+                    const Options & options, const std::vector<std::string> & kinematic_names, const std::vector<double> & events);
+
+            /// Destructor.
+            ~SignalPDFEventBlock();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of events in the block.
+            unsigned number_of_events() const;
+
+            /*!
+             * Evaluate the total unbinned log-likelihood of the block at the current
+             * parameter point, i.e. the sum of the normalized log PDF over all events.
+             */
+            double log_pdf_sum();
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-event-block.hh>
+
+#include <test/test.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class SignalPDFEventBlockTest : public TestCase
+{
+    public:
+        SignalPDFEventBlockTest() :
+            TestCase("signal_pdf_event_block_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            constexpr double eps = 1e-13;
+
+            Kinematics kinematics
+            {
+                { "z",     0.0  },
+                { "z_min", -1.0 },
+                { "z_max", +1.0 },
+            };
+
+            // the block sums match a direct per-event evaluation
+            {
+                const std::vector<double> events{ -0.9, -0.5, -0.1, 0.0, 0.2, 0.4, 0.6, 0.8 };
+
+                auto parameters = Parameters::Defaults();
+                SignalPDFEventBlock block("Test::Legendre1D", parameters, kinematics, Options{}, { "z" }, events);
+
+                TEST_CHECK_EQUAL(block.number_of_events(), events.size());
+
+                auto reference_kinematics = kinematics.clone();
+                auto pdf = SignalPDF::make("Test::Legendre1D", parameters, reference_kinematics, Options{});
+                auto z = reference_kinematics["z"];
+
+                double reference = 0.0;
+                for (const auto & event : events)
+                {
+                    z = event;
+                    reference += pdf->evaluate();
+                }
+                reference -= events.size() * pdf->normalization();
+
+                TEST_CHECK_NEARLY_EQUAL(block.log_pdf_sum(), reference, eps);
+
+                // modifying a parameter resynchronizes the worker clones
+                parameters["mass::b(MSbar)"] = 4.3;
+                TEST_CHECK_NEARLY_EQUAL(block.log_pdf_sum(), reference, eps);
+            }
+
+            // invalid inputs are rejected
+            {
+                auto parameters = Parameters::Defaults();
+
+                TEST_CHECK_THROWS(InternalError, SignalPDFEventBlock("Test::Legendre1D", parameters, kinematics, Options{}, {}, { 0.1 }));
+                TEST_CHECK_THROWS(InternalError, SignalPDFEventBlock("Test::Legendre1D", parameters, kinematics, Options{}, { "z" }, {}));
+                TEST_CHECK_THROWS(InternalError, SignalPDFEventBlock("Test::Legendre1D", parameters, kinematics, Options{}, { "z", "q2" }, { 0.1, 0.2, 0.3 }));
+            }
+        }
+
+} signal_pdf_event_block_test;
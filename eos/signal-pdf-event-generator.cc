@@ -0,0 +1,397 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-event-generator.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace eos
+{
+    namespace
+    {
+        /*
+         * Per-thread stage of the generation pipeline: an independent clone of
+         * the SignalPDF, the kinematic handles into the clone's Kinematics, and
+         * a private random number generator for the proposal coordinates.
+         */
+        struct EventGeneratorWorker
+        {
+                SignalPDFPtr pdf;
+
+                Kinematics kinematics;
+
+                std::vector<KinematicRange> ranges;
+
+                gsl_rng * rng;
+
+                std::vector<size_t> strata;
+
+                EventGeneratorWorker(const SignalPDFPtr & pdf, const std::vector<KinematicRange> & ranges, const unsigned long & seed) :
+                    pdf(pdf),
+                    kinematics(pdf->kinematics()),
+                    ranges(ranges),
+                    rng(gsl_rng_alloc(gsl_rng_mt19937))
+                {
+                    gsl_rng_set(rng, seed);
+
+                    // the proposals are written through Kinematics::set_all, which
+                    // assigns in declaration order; make sure that order matches
+                    // the layout of the proposal points
+                    auto k = kinematics.begin();
+                    for (const auto & range : ranges)
+                    {
+                        if ((kinematics.end() == k) || (k->name() != range.name))
+                        {
+                            throw InternalError("SignalPDFEventGenerator: kinematic variables are not declared in the order of the PDF's kinematic ranges");
+                        }
+
+                        ++k;
+                    }
+                    if (kinematics.end() != k)
+                    {
+                        throw InternalError("SignalPDFEventGenerator: kinematic variables are not declared in the order of the PDF's kinematic ranges");
+                    }
+                }
+
+                EventGeneratorWorker(const EventGeneratorWorker &) = delete;
+                EventGeneratorWorker & operator= (const EventGeneratorWorker &) = delete;
+
+                ~EventGeneratorWorker()
+                {
+                    gsl_rng_free(rng);
+                }
+
+                /*
+                 * Draw n stratified proposals and evaluate the PDF at each of them.
+                 *
+                 * Within this chunk, each kinematic variable is sampled Latin-hypercube
+                 * stratified: its range is split into n cells of equal probability, and
+                 * each cell is visited exactly once, in randomly permuted order. The
+                 * proposals are written in row-major layout to points, their log-PDF
+                 * values to log_values.
+                 */
+                void
+                propose_and_evaluate(const unsigned & n, double * points, double * log_values)
+                {
+                    const unsigned dimension = ranges.size();
+
+                    strata.resize(n);
+
+                    for (unsigned d = 0 ; d < dimension ; ++d)
+                    {
+                        for (size_t p = 0 ; p < n ; ++p)
+                        {
+                            strata[p] = p;
+                        }
+                        gsl_ran_shuffle(rng, strata.data(), n, sizeof(size_t));
+
+                        const double min = ranges[d].min, width = ranges[d].max - ranges[d].min;
+
+                        for (unsigned p = 0 ; p < n ; ++p)
+                        {
+                            const double u = (strata[p] + gsl_rng_uniform(rng)) / n;
+
+                            points[p * dimension + d] = min + u * width;
+                        }
+                    }
+
+                    for (unsigned p = 0 ; p < n ; ++p)
+                    {
+                        kinematics.set_all(points + p * static_cast<size_t>(dimension));
+
+                        try
+                        {
+                            log_values[p] = pdf->evaluate();
+                        }
+                        catch (Exception &)
+                        {
+                            log_values[p] = -std::numeric_limits<double>::infinity();
+                        }
+                    }
+                }
+        };
+    } // namespace
+
+    template <> struct Implementation<SignalPDFEventGenerator>
+    {
+            SignalPDFEventGenerator::Config config;
+
+            SignalPDFPtr signal_pdf;
+
+            std::vector<KinematicRange> ranges;
+
+            unsigned dimension;
+
+            std::vector<std::string> variable_names;
+
+            std::vector<std::shared_ptr<EventGeneratorWorker>> workers;
+
+            // random number generator for the accept/reject decisions
+            gsl_rng * rng;
+
+            // logarithm of the rejection envelope; calibrated lazily
+            double log_envelope;
+
+            bool calibrated;
+
+            unsigned long proposed, accepted;
+
+            Implementation(const QualifiedName & name, const Parameters & parameters, const Options & options, const SignalPDFEventGenerator::Config & config) :
+                config(config),
+                rng(gsl_rng_alloc(gsl_rng_mt19937)),
+                log_envelope(-std::numeric_limits<double>::infinity()),
+                calibrated(false),
+                proposed(0),
+                accepted(0)
+            {
+                gsl_rng_set(rng, config.seed);
+
+                SignalPDFEntryPtr entry = SignalPDFs()[name];
+                if (! entry)
+                {
+                    throw InternalError("SignalPDFEventGenerator: unknown signal PDF '" + name.full() + "'");
+                }
+
+                Kinematics kinematics;
+                for (const auto & range : entry->kinematic_ranges())
+                {
+                    kinematics.declare(range.name, 0.5 * (range.min + range.max));
+                    ranges.push_back(range);
+                    variable_names.push_back(range.name);
+                }
+                dimension = ranges.size();
+
+                signal_pdf = entry->make(parameters, kinematics, options);
+
+                // one pipeline stage per pool thread, each with an independent
+                // clone of the PDF and its own stream of random numbers
+                const unsigned number_of_workers = ThreadPool::instance()->number_of_threads();
+                for (unsigned w = 0 ; w < number_of_workers ; ++w)
+                {
+                    SignalPDFPtr clone = std::static_pointer_cast<SignalPDF>(signal_pdf->clone());
+                    workers.push_back(std::make_shared<EventGeneratorWorker>(clone, ranges, config.seed + w + 1));
+                }
+            }
+
+            ~Implementation()
+            {
+                gsl_rng_free(rng);
+            }
+
+            /*
+             * Draw and evaluate one batch of n proposals, split across the
+             * pool threads. Returns the tickets of the enqueued stages.
+             */
+            std::vector<Ticket>
+            start_batch(const unsigned & n, std::vector<double> & points, std::vector<double> & log_values)
+            {
+                points.resize(n * static_cast<size_t>(dimension));
+                log_values.resize(n);
+
+                std::vector<Ticket> tickets;
+
+                const unsigned chunk = n / workers.size() + 1;
+                unsigned offset = 0;
+
+                for (const auto & worker : workers)
+                {
+                    const unsigned size = std::min(chunk, n - offset);
+                    if (0 == size)
+                    {
+                        break;
+                    }
+
+                    EventGeneratorWorker * w = worker.get();
+                    double * p = points.data() + offset * static_cast<size_t>(dimension);
+                    double * v = log_values.data() + offset;
+
+                    auto f = [w, size, p, v]() { w->propose_and_evaluate(size, p, v); };
+
+                    tickets.push_back(ThreadPool::instance()->enqueue(std::function<void(void)>(f)));
+
+                    offset += size;
+                }
+
+                return tickets;
+            }
+
+            /*
+             * Perform the accept/reject decisions for one evaluated batch, and
+             * append the accepted events to the contiguous result block.
+             */
+            void
+            compact_batch(const std::vector<double> & points, const std::vector<double> & log_values, const unsigned & n, std::vector<double> & results)
+            {
+                for (unsigned p = 0 ; p < n ; ++p)
+                {
+                    const double log_value = log_values[p];
+
+                    if (log_value > log_envelope)
+                    {
+                        // enlarge the envelope; events accepted so far keep a
+                        // slight bias toward the old envelope, which the
+                        // calibration headroom is meant to prevent
+                        Log::instance()->message("SignalPDFEventGenerator.compact_batch", ll_warning)
+                                << "PDF value exceeds the rejection envelope; enlarging the envelope by a factor "
+                                << std::exp(log_value - log_envelope) * config.envelope_headroom;
+
+                        log_envelope = log_value + std::log(config.envelope_headroom);
+                    }
+
+                    ++proposed;
+
+                    if (std::log(gsl_rng_uniform_pos(rng)) < log_value - log_envelope)
+                    {
+                        ++accepted;
+
+                        const double * point = points.data() + p * static_cast<size_t>(dimension);
+                        results.insert(results.end(), point, point + dimension);
+                    }
+                }
+            }
+
+            void
+            calibrate()
+            {
+                std::vector<double> points, log_values;
+
+                auto tickets = start_batch(config.calibration_points, points, log_values);
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                double max_log_value = -std::numeric_limits<double>::infinity();
+                for (const double & log_value : log_values)
+                {
+                    max_log_value = std::max(max_log_value, log_value);
+                }
+
+                if (! std::isfinite(max_log_value))
+                {
+                    throw InternalError("SignalPDFEventGenerator: PDF evaluates to zero throughout the calibration batch");
+                }
+
+                log_envelope = max_log_value + std::log(config.envelope_headroom);
+                calibrated = true;
+
+                Log::instance()->message("SignalPDFEventGenerator.calibrate", ll_informational)
+                        << "calibrated rejection envelope to exp(" << log_envelope << ") from "
+                        << config.calibration_points << " points";
+            }
+
+            std::vector<double>
+            generate(const unsigned & n)
+            {
+                if (! calibrated)
+                {
+                    calibrate();
+                }
+
+                std::vector<double> results;
+                results.reserve(n * static_cast<size_t>(dimension));
+
+                // double buffering: evaluate batch k on the pool threads while
+                // this thread compacts the accepted events of batch k - 1
+                std::vector<double> points[2], log_values[2];
+                unsigned sizes[2] = { 0, 0 };
+
+                unsigned current = 0;
+                sizes[current] = config.batch_size;
+                auto tickets = start_batch(sizes[current], points[current], log_values[current]);
+
+                while (results.size() < n * static_cast<size_t>(dimension))
+                {
+                    for (auto & ticket : tickets)
+                    {
+                        ticket.wait();
+                    }
+
+                    const unsigned previous = current;
+                    current = 1 - current;
+
+                    sizes[current] = config.batch_size;
+                    tickets = start_batch(sizes[current], points[current], log_values[current]);
+
+                    compact_batch(points[previous], log_values[previous], sizes[previous], results);
+                }
+
+                // drain the batch still in flight
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                results.resize(n * static_cast<size_t>(dimension));
+
+                return results;
+            }
+    };
+
+    SignalPDFEventGenerator::SignalPDFEventGenerator(const QualifiedName & name, const Parameters & parameters, const Options & options, const Config & config) :
+        PrivateImplementationPattern<SignalPDFEventGenerator>(new Implementation<SignalPDFEventGenerator>(name, parameters, options, config))
+    {
+    }
+
+    SignalPDFEventGenerator::SignalPDFEventGenerator(const QualifiedName & name, const Parameters & parameters, const Options & options) :
+        SignalPDFEventGenerator(name, parameters, options, Config())
+    {
+    }
+
+    SignalPDFEventGenerator::~SignalPDFEventGenerator() = default;
+
+    unsigned
+    SignalPDFEventGenerator::dimension() const
+    {
+        return _imp->dimension;
+    }
+
+    const std::vector<std::string> &
+    SignalPDFEventGenerator::variable_names() const
+    {
+        return _imp->variable_names;
+    }
+
+    std::vector<double>
+    SignalPDFEventGenerator::generate(const unsigned & n)
+    {
+        return _imp->generate(n);
+    }
+
+    double
+    SignalPDFEventGenerator::acceptance_rate() const
+    {
+        if (0 == _imp->proposed)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>(_imp->accepted) / _imp->proposed;
+    }
+} // namespace eos
@@ -0,0 +1,105 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_SIGNAL_PDF_EVENT_GENERATOR_HH
+#define EOS_GUARD_EOS_SIGNAL_PDF_EVENT_GENERATOR_HH 1
+
+#include <eos/signal-pdf.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Generates pseudo-events distributed according to a SignalPDF.
+     *
+     * The accept/reject loop is carried out over batches of phase-space
+     * points rather than one event at a time: each batch of proposals is
+     * drawn Latin-hypercube stratified across the kinematic ranges of the
+     * underlying SignalPDFEntry, and is evaluated in parallel on the thread
+     * pool (one cloned SignalPDF per pool thread). While a batch is in
+     * flight, the calling thread compacts the accepted events of the
+     * previous batch into a contiguous block, so proposal generation, PDF
+     * evaluation, and event selection are pipelined.
+     *
+     * The rejection envelope is calibrated from an initial exploration batch
+     * and enlarged on the fly if a later evaluation exceeds it.
+     */
+    class SignalPDFEventGenerator : public PrivateImplementationPattern<SignalPDFEventGenerator>
+    {
+        public:
+            struct Config
+            {
+                /// Seed for the pseudo-random number generators.
+                unsigned long seed = 0;
+
+                /// Number of proposal points per pipelined batch.
+                unsigned batch_size = 65536;
+
+                /// Number of proposal points used to calibrate the rejection envelope.
+                unsigned calibration_points = 8192;
+
+                /// Headroom factor applied to the largest PDF value seen during calibration.
+                double envelope_headroom = 1.25;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param name       Name of the SignalPDF from which events shall be generated.
+             * @param parameters Parameters at which the SignalPDF shall be evaluated.
+             * @param options    Options used in the construction of the SignalPDF.
+             * @param config     Configuration of the event generation.
+             */
+            SignalPDFEventGenerator(const QualifiedName & name, const Parameters & parameters, const Options & options, const Config & config);
+
+            /// Constructor using the default configuration.
+            SignalPDFEventGenerator(const QualifiedName & name, const Parameters & parameters, const Options & options);
+
+            /// Destructor.
+            ~SignalPDFEventGenerator();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of kinematic variables per event.
+            unsigned dimension() const;
+
+            /// Retrieve the names of the kinematic variables, in event-column order.
+            const std::vector<std::string> & variable_names() const;
+
+            /*!
+             * Generate pseudo-events by batched accept/reject sampling.
+             *
+             * @param n Number of events to generate.
+             * @return The events as one contiguous block of row-major layout and shape (n, dimension()).
+             */
+            std::vector<double> generate(const unsigned & n);
+
+            /// Retrieve the acceptance rate observed so far.
+            double acceptance_rate() const;
+            ///@}
+    };
+} // namespace eos
+
+#endif
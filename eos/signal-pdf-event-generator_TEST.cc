@@ -0,0 +1,73 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-event-generator.hh>
+
+#include <test/test.hh>
+
+using namespace test;
+using namespace eos;
+
+class SignalPDFEventGeneratorTest : public TestCase
+{
+    public:
+        SignalPDFEventGeneratorTest() :
+            TestCase("signal_pdf_event_generator_test")
+        {
+        }
+
+        virtual void
+        run() const
+        {
+            // generate events from the 1D test PDF and compare the sample
+            // moments with the analytic ones:
+            // pdf(z) = (9 + 8 z + 9 z^2) / 24 on -1 <= z <= +1,
+            // with <z> = 2 / 9 and <z^2> = 2 / 5
+            {
+                SignalPDFEventGenerator::Config config;
+                config.seed = 1723;
+                config.batch_size = 16384;
+
+                SignalPDFEventGenerator generator("Test::Legendre1D", Parameters::Defaults(), Options{}, config);
+
+                TEST_CHECK_EQUAL(generator.dimension(), 1u);
+                TEST_CHECK_EQUAL(generator.variable_names().front(), "z");
+
+                const unsigned n = 100000;
+                const auto events = generator.generate(n);
+
+                TEST_CHECK_EQUAL(events.size(), n);
+
+                double sum = 0.0, sum2 = 0.0;
+                for (const double & z : events)
+                {
+                    TEST_CHECK((-1.0 <= z) && (z <= +1.0));
+
+                    sum += z;
+                    sum2 += z * z;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(sum / n,  2.0 / 9.0, 5.0e-3);
+                TEST_CHECK_NEARLY_EQUAL(sum2 / n, 2.0 / 5.0, 5.0e-3);
+
+                // the envelope calibration keeps the acceptance rate well away from zero
+                TEST_CHECK(generator.acceptance_rate() > 0.25);
+            }
+        }
+} signal_pdf_event_generator_test;
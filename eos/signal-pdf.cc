@@ -27,9 +27,12 @@
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <map>
 #include <ostream>
 
@@ -138,6 +141,102 @@ namespace eos
         return SignalPDFPtr();
     }
 
+    /* SignalPDFNormalizationPlan */
+
+    template <> struct Implementation<SignalPDFNormalizationPlan>
+    {
+        std::vector<SignalPDFPtr> pdfs;
+
+        // Cached log-scale normalizations, indexed as the pdfs above
+        std::vector<double> normalizations;
+
+        // Generation of each PDF's parameter set at the time of its last
+        // renormalization; a PDF is stale whenever its set has moved on
+        std::vector<std::uint64_t> generations;
+
+        // False until the respective PDF has been renormalized at least once
+        std::vector<bool> updated;
+
+        Implementation(const std::vector<SignalPDFPtr> & pdfs) :
+            pdfs(pdfs),
+            normalizations(pdfs.size(), std::numeric_limits<double>::quiet_NaN()),
+            generations(pdfs.size(), 0),
+            updated(pdfs.size(), false)
+        {
+            for (const auto & pdf : this->pdfs)
+            {
+                if (! pdf)
+                    throw InternalError("SignalPDFNormalizationPlan: encountered an empty SignalPDFPtr");
+            }
+        }
+    };
+
+    SignalPDFNormalizationPlan::SignalPDFNormalizationPlan(const std::vector<SignalPDFPtr> & pdfs) :
+        PrivateImplementationPattern<SignalPDFNormalizationPlan>(new Implementation<SignalPDFNormalizationPlan>(pdfs))
+    {
+    }
+
+    SignalPDFNormalizationPlan::~SignalPDFNormalizationPlan() = default;
+
+    void
+    SignalPDFNormalizationPlan::update()
+    {
+        // determine which PDFs are stale, i.e. whose parameter set has been
+        // modified since their last renormalization
+        std::vector<unsigned> stale;
+        stale.reserve(_imp->pdfs.size());
+
+        std::vector<unsigned> current(_imp->pdfs.size());
+        for (unsigned i = 0, i_end = _imp->pdfs.size() ; i != i_end ; ++i)
+        {
+            current[i] = _imp->pdfs[i]->parameters().generation();
+
+            if ((! _imp->updated[i]) || (current[i] > _imp->generations[i]))
+                stale.push_back(i);
+        }
+
+        // renormalize the stale PDFs in one parallel pass; a chunk size of one
+        // lets the pool's work stealing even out PDFs of unequal cost
+        ThreadPool::instance()->parallel_for(0, stale.size(), [this, &stale] (size_t b, size_t e)
+        {
+            for (size_t i = b ; i != e ; ++i)
+            {
+                const unsigned idx = stale[i];
+                try
+                {
+                    _imp->normalizations[idx] = _imp->pdfs[idx]->normalization();
+                }
+                catch (Exception & e)
+                {
+                    Log::instance()->message("SignalPDFNormalizationPlan::update", ll_error)
+                        << "Exception encountered when renormalizing signal PDF '" << _imp->pdfs[idx]->name() << "': " << e.what();
+                    _imp->normalizations[idx] = std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }, 1);
+
+        for (const auto & idx : stale)
+        {
+            _imp->generations[idx] = current[idx];
+            _imp->updated[idx] = true;
+        }
+    }
+
+    double
+    SignalPDFNormalizationPlan::normalization(const unsigned & index) const
+    {
+        if (index >= _imp->pdfs.size())
+            throw InternalError("SignalPDFNormalizationPlan::normalization(): index exceeds the number of PDFs");
+
+        return _imp->normalizations[index];
+    }
+
+    unsigned
+    SignalPDFNormalizationPlan::size() const
+    {
+        return _imp->pdfs.size();
+    }
+
     /* SignalPDFSections */
 
     class SignalPDFSections : public InstantiationPolicy<SignalPDFSections, Singleton>
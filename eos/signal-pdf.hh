@@ -32,6 +32,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -69,6 +70,51 @@ namespace eos
             static SignalPDFPtr make(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & options);
     };
 
+    /*!
+     * Computes and caches the normalization constants of a set of signal PDFs.
+     *
+     * The plan batches the renormalization of all PDFs of an analysis into a
+     * single pass that is parallelized across the thread pool. Results are
+     * cached by the generation of each PDF's parameter set: an update only
+     * renormalizes those PDFs whose parameters changed since the last update,
+     * so varying one PDF's parameters does not pay for renormalizing every
+     * other PDF. Note that PDFs bound to one common Parameters object are
+     * renormalized together, since generations are tracked per set.
+     */
+    class SignalPDFNormalizationPlan :
+        public PrivateImplementationPattern<SignalPDFNormalizationPlan>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param pdfs The signal PDFs whose normalizations shall be computed and cached.
+             */
+            SignalPDFNormalizationPlan(const std::vector<SignalPDFPtr> & pdfs);
+
+            /// Destructor.
+            ~SignalPDFNormalizationPlan();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Recompute the normalizations of all stale PDFs in one parallel pass.
+            void update();
+
+            /*!
+             * Retrieve the cached normalization of a given PDF, on the log scale.
+             *
+             * @param index The index of the PDF within the plan, following the order of construction.
+             */
+            double normalization(const unsigned & index) const;
+
+            /// Retrieve the number of PDFs covered by the plan.
+            unsigned size() const;
+            ///@}
+    };
+
     /**
      * SignalPDFSection is used to keep track of one or more SignalPDFGroup objects, and groups
      * them together under a common name. Examples of observable sections include semileptonic B decays
@@ -21,6 +21,8 @@
 
 #include <test/test.hh>
 
+#include <cmath>
+
 using namespace test;
 using namespace eos;
 
@@ -41,6 +43,39 @@ class SignalPDFTest : public TestCase
 
                 TEST_CHECK(std::distance(signal_pdfs.begin(), signal_pdfs.end()) > 0);
             }
+
+            // batched normalization of several PDFs through a plan
+            {
+                Kinematics kinematics
+                {
+                    { "z",     0.0  },
+                    { "z_min", -1.0 },
+                    { "z_max", +1.0 },
+                };
+
+                auto parameters_1 = Parameters::Defaults();
+                auto parameters_2 = Parameters::Defaults();
+                auto pdf_1 = SignalPDF::make("Test::Legendre1D", parameters_1, kinematics.clone(), Options{});
+                auto pdf_2 = SignalPDF::make("Test::Legendre1D", parameters_2, kinematics.clone(), Options{});
+
+                SignalPDFNormalizationPlan plan({ pdf_1, pdf_2 });
+
+                TEST_CHECK_EQUAL(plan.size(), 2u);
+
+                // normalizations are unavailable before the first update
+                TEST_CHECK(std::isnan(plan.normalization(0)));
+
+                plan.update();
+                TEST_CHECK_NEARLY_EQUAL(plan.normalization(0), pdf_1->normalization(), 1e-15);
+                TEST_CHECK_NEARLY_EQUAL(plan.normalization(1), pdf_2->normalization(), 1e-15);
+
+                // a further update with modified parameters keeps the cache consistent
+                parameters_1["mass::b(MSbar)"] = 4.3;
+                plan.update();
+                TEST_CHECK_NEARLY_EQUAL(plan.normalization(0), pdf_1->normalization(), 1e-15);
+
+                TEST_CHECK_THROWS(InternalError, plan.normalization(2));
+            }
         }
 
 } signal_pdf_test;
@@ -21,9 +21,14 @@
 #include <eos/statistics/log-posterior.hh>
 #include <eos/statistics/test-statistic-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <gsl/gsl_cdf.h>
+
+#include <limits>
 #include <map>
+#include <vector>
 
 namespace eos
 {
@@ -34,6 +39,7 @@ namespace eos
 
         double total_chi_square;
         int total_degrees_of_freedom;
+        double total_p_value;
 
         std::map<QualifiedName, test_statistics::ChiSquare> chi_squares;
 
@@ -43,9 +49,11 @@ namespace eos
             log_posterior(log_posterior),
             total_chi_square(0.0),
             total_degrees_of_freedom(log_posterior.informative_priors() - log_posterior.varied_parameters().size()),
+            total_p_value(std::numeric_limits<double>::quiet_NaN()),
             current_constraint(nullptr)
         {
             compute_test_statistics();
+            compute_p_values();
         }
 
         ~Implementation() = default;
@@ -54,24 +62,58 @@ namespace eos
         {
             auto log_likelihood = log_posterior.log_likelihood();
             auto observable_cache = log_likelihood.observable_cache();
+
+            // bring the predictions up to date; observables that are still fresh
+            // from the last likelihood evaluation are not re-evaluated
             observable_cache.update();
 
-            /* compute the test statistics for each constraint*/
-            for (auto c = log_likelihood.begin(), c_end = log_likelihood.end() ; c != c_end ; ++c)
-            {
-                current_constraint = &(*c);
+            std::vector<Constraint> constraints(log_likelihood.begin(), log_likelihood.end());
+            std::vector<std::vector<TestStatistic>> test_statistics(constraints.size());
 
-                /* compute the test statistics for each log-likelihood block */
-                for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+            /* compute the test statistics for each constraint; the constraints are
+             * independent of each other and only read from the observable cache */
+            ThreadPool::instance()->parallel_for(0, constraints.size(), [&] (size_t begin, size_t end)
+            {
+                for (size_t i = begin ; i != end ; ++i)
                 {
-                    auto test_statistic = (*b)->primary_test_statistic();
+                    for (auto b = constraints[i].begin_blocks(), b_end = constraints[i].end_blocks() ; b != b_end ; ++b)
+                    {
+                        test_statistics[i].push_back((*b)->primary_test_statistic());
+                    }
+                }
+            });
 
+            /* accumulate the test statistics serially */
+            for (size_t i = 0 ; i != constraints.size() ; ++i)
+            {
+                current_constraint = &constraints[i];
+
+                for (auto & test_statistic : test_statistics[i])
+                {
                     // apply special treatsments based on its type
                     test_statistic.accept(*this);
                 }
             }
         }
 
+        /* convert the accumulated chi^2 values to p values in one batched pass,
+         * so that consumers do not need to apply the chi^2 CDF entry by entry */
+        void compute_p_values()
+        {
+            for (auto & chi_square : chi_squares)
+            {
+                if (chi_square.second.dof > 0)
+                {
+                    chi_square.second.local_p_value = gsl_cdf_chisq_Q(chi_square.second.chi2, chi_square.second.dof);
+                }
+            }
+
+            if (total_degrees_of_freedom > 0)
+            {
+                total_p_value = gsl_cdf_chisq_Q(total_chi_square, total_degrees_of_freedom);
+            }
+        }
+
         void visit(const test_statistics::Empty &) { }
         void visit(const test_statistics::ChiSquare & c)
         {
@@ -107,6 +149,12 @@ namespace eos
         return _imp->total_degrees_of_freedom;
     }
 
+    double
+    GoodnessOfFit::total_p_value() const
+    {
+        return _imp->total_p_value;
+    }
+
     GoodnessOfFit::ChiSquareIterator
     GoodnessOfFit::begin_chi_square() const
     {
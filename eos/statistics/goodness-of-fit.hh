@@ -38,6 +38,7 @@ namespace eos
             ///@{
             double total_chi_square() const;
             int total_degrees_of_freedom() const;
+            double total_p_value() const;
 
             struct ChiSquareIteratorTag;
             using ChiSquareIterator = WrappedForwardIterator<ChiSquareIteratorTag, const std::pair<const QualifiedName, test_statistics::ChiSquare>>;
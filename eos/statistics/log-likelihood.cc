@@ -24,13 +24,19 @@
 #include <eos/utils/observable_cache.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/probes.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <map>
+#include <tuple>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_cdf.h>
@@ -42,6 +48,8 @@
 #include <gsl/gsl_sf_result.h>
 #include <gsl/gsl_vector.h>
 
+#include <yaml-cpp/yaml.h>
+
 #include <config.h>
 
 #ifdef EOS_USE_GSL_LINALG_CHOLESKY_DECOMP
@@ -135,6 +143,11 @@ namespace eos
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                return cache.depends_on(id, parameter_id);
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -189,6 +202,33 @@ namespace eos
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual double evaluate_resampled(gsl_rng * rng) const
+            {
+                // draw a displaced central value from the experimental
+                // distribution around the reported mode, using the
+                // inverse-transform method; unlike sample(), there is no
+                // mirroring or shifting, since the theory prediction is
+                // re-scored against resampled data
+                const double u = gsl_rng_uniform(rng);
+                const double w_lower = sigma_lower / (sigma_lower + sigma_upper);
+
+                double center;
+                if (u < w_lower)
+                {
+                    center = mode + gsl_cdf_gaussian_Pinv(u / c_lower, sigma_lower);
+                }
+                else
+                {
+                    center = mode + gsl_cdf_gaussian_Pinv(0.5 + (u - w_lower) / c_upper, sigma_upper);
+                }
+
+                const double value = cache[id];
+                const double sigma = (value > center) ? sigma_upper : sigma_lower;
+                const double chi = (value - center) / sigma;
+
+                return norm - power_of<2>(chi) / 2.0;
+            }
+
             virtual double significance() const
             {
                 const double value = cache[id];
@@ -315,6 +355,11 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                return cache.depends_on(id, parameter_id);
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -549,6 +594,11 @@ namespace eos
                 return norm + (alpha * beta - 1) * std::log(z) - std::pow(z, beta);
             }
 
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                return cache.depends_on(id, parameter_id);
+            }
+
             inline double mode() const
             {
                 return physical_limit + theta * std::pow(alpha - 1 / beta, 1 / beta);
@@ -753,6 +803,17 @@ namespace eos
                 return ret_val;
             }
 
+            bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                for (const auto & component : components)
+                {
+                    if (component->depends_on(parameter_id))
+                        return true;
+                }
+
+                return false;
+            }
+
             unsigned number_of_observations() const
             {
                 return components.front()->number_of_observations();
@@ -798,18 +859,41 @@ namespace eos
             gsl_matrix * const _response;
             const unsigned _number_of_observations;
 
-            // the normalization constant of the density
-            const double _norm;
-
             // cholesky matrix of covariance, and inverse of covariance
             gsl_matrix * _chol;
             gsl_matrix * _covariance_inv;
 
+            // the normalization constant of the density
+            const double _norm;
+
             // temporary storage for evaluation
             gsl_vector * _observables;
             gsl_vector * _measurements;
             gsl_vector * _measurements_2;
 
+            // union of the ids of the parameters our observables depend on; empty
+            // if any observable does not declare its used parameter ids, in which
+            // case the block is conservatively re-evaluated on every call
+            std::vector<Parameter::Id> _used_parameter_ids;
+
+            // sparse storage of the response matrix: row-major (row, column, value)
+            // triplets of its non-vanishing entries
+            std::vector<std::tuple<unsigned, unsigned, double>> _response_nonzeros;
+            bool _response_sparse;
+
+            // compressed-row storage of the cholesky factor: per row, the
+            // strictly-lower non-vanishing entries as (column, value) pairs,
+            // with the rows delimited by offsets into the pair vector
+            std::vector<std::pair<unsigned, double>> _chol_nonzeros;
+            std::vector<unsigned> _chol_row_offsets;
+            std::vector<double> _chol_inv_diag;
+            bool _chol_sparse;
+
+            // cached chi^2 value, and the cache generation for which it is valid
+            mutable double _chi_square_cached;
+            mutable std::uint64_t _chi_square_generation;
+            mutable bool _chi_square_valid;
+
             MultivariateGaussianBlock(const ObservableCache & cache, const std::vector<ObservableCache::Id> && ids,
                     gsl_vector * mean, gsl_matrix * covariance, gsl_matrix * response, const unsigned & number_of_observations) :
                 _cache(cache),
@@ -820,12 +904,17 @@ namespace eos
                 _covariance(covariance),
                 _response(response),
                 _number_of_observations(number_of_observations),
-                _norm(compute_norm()),
                 _chol(gsl_matrix_alloc(covariance->size1, covariance->size2)),
                 _covariance_inv(gsl_matrix_alloc(covariance->size1, covariance->size2)),
+                _norm(compute_norm()),
                 _observables(gsl_vector_alloc(_dim_pred)),
                 _measurements(gsl_vector_alloc(_dim_meas)),
-                _measurements_2(gsl_vector_alloc(_dim_meas))
+                _measurements_2(gsl_vector_alloc(_dim_meas)),
+                _response_sparse(false),
+                _chol_sparse(false),
+                _chi_square_cached(0.0),
+                _chi_square_generation(0),
+                _chi_square_valid(false)
             {
                 if (_covariance->size1 != _covariance->size2)
                     throw InternalError("MultivariateGaussianBlock: covariance matrix is not a square matrix");
@@ -839,9 +928,9 @@ namespace eos
                 if (_dim_pred != _response->size2)
                     throw InternalError("MultivariateGaussianBlock: number of predictions and number of columns in response matrix are not identical");
 
-                // cholesky decomposition (informally: the sqrt of the covariance matrix)
+                // the cholesky decomposition (informally: the sqrt of the covariance matrix)
+                // has already been computed for the normalization constant;
                 // the GSL matrix contains both the cholesky and its transpose, see GSL reference, ch. 14.5
-                cholesky();
                 invert_covariance();
 
                 // keep only the lower and diagonal parts, set upper parts to zero
@@ -852,6 +941,71 @@ namespace eos
                         gsl_matrix_set(_chol, i, j, 0.0);
                     }
                 }
+
+                // gather the union of our observables' used parameter ids; an
+                // observable without declared dependencies poisons the mask, and
+                // the block then re-evaluates its chi^2 on every call
+                bool mask_complete = true;
+                for (const auto & id : _ids)
+                {
+                    const auto & dependencies = _cache.dependencies(id);
+
+                    if (dependencies.empty())
+                    {
+                        mask_complete = false;
+                        break;
+                    }
+
+                    _used_parameter_ids.insert(_used_parameter_ids.end(), dependencies.cbegin(), dependencies.cend());
+                }
+                if (mask_complete)
+                {
+                    std::sort(_used_parameter_ids.begin(), _used_parameter_ids.end());
+                    _used_parameter_ids.erase(std::unique(_used_parameter_ids.begin(), _used_parameter_ids.end()), _used_parameter_ids.end());
+                }
+                else
+                {
+                    _used_parameter_ids.clear();
+                }
+
+                // record the non-vanishing entries of the response matrix; the
+                // sparse application pays off once at least half of the entries
+                // vanish, which is the common case for combined constraints whose
+                // measurements each respond to few predictions
+                for (unsigned i = 0 ; i < _dim_meas ; ++i)
+                {
+                    for (unsigned j = 0 ; j < _dim_pred ; ++j)
+                    {
+                        const double value = gsl_matrix_get(_response, i, j);
+
+                        if (0.0 != value)
+                        {
+                            _response_nonzeros.push_back(std::make_tuple(i, j, value));
+                        }
+                    }
+                }
+                _response_sparse = (2 * _response_nonzeros.size() <= _dim_meas * _dim_pred);
+
+                // record the cholesky factor in compressed-row form; a
+                // block-sparse covariance (e.g. bin-diagonal with short-ranged
+                // correlations) has a factor with the same block structure, and
+                // the forward substitution then skips the vanishing entries
+                _chol_row_offsets.push_back(0);
+                for (unsigned i = 0 ; i < _dim_meas ; ++i)
+                {
+                    for (unsigned j = 0 ; j < i ; ++j)
+                    {
+                        const double value = gsl_matrix_get(_chol, i, j);
+
+                        if (0.0 != value)
+                        {
+                            _chol_nonzeros.push_back(std::make_pair(j, value));
+                        }
+                    }
+                    _chol_row_offsets.push_back(_chol_nonzeros.size());
+                    _chol_inv_diag.push_back(1.0 / gsl_matrix_get(_chol, i, i));
+                }
+                _chol_sparse = (4 * _chol_nonzeros.size() <= _dim_meas * (_dim_meas - 1));
             }
 
             virtual ~MultivariateGaussianBlock()
@@ -956,48 +1110,105 @@ namespace eos
             }
 
             // compute the normalization constant on log scale
-            // -k/2 * log 2 Pi - 1/2 log(abs(det(V^{-1})))
+            // -k/2 * log 2 Pi - 1/2 log(abs(det(V)))
             double compute_norm()
             {
-                // copy covariance matrix
-                gsl_matrix * M = gsl_matrix_alloc(_dim_meas, _dim_meas);
-                gsl_matrix_memcpy(M, _covariance);
-
-                // find LU decomposition
-                int signum = 0;
-                gsl_permutation * p = gsl_permutation_alloc(_dim_meas);
-                gsl_linalg_LU_decomp(M, p, &signum);
-
-                // calculate determinant
-                const double log_det = gsl_linalg_LU_lndet(M);
+                // perform the cholesky decomposition; its factor is reused in every evaluation
+                cholesky();
 
-                gsl_permutation_free(p);
-                gsl_matrix_free(M);
+                // calculate the log-determinant from the cholesky factor: log det(V) = 2 sum_i log L_ii
+                double log_det = 0.0;
+                for (unsigned i = 0 ; i < _dim_meas ; ++i)
+                {
+                    log_det += std::log(gsl_matrix_get(_chol, i, i));
+                }
 
-                return -0.5 * _dim_meas * std::log(2 * M_PI) - 0.5 * log_det;
+                return -0.5 * _dim_meas * std::log(2 * M_PI) - log_det;
             }
 
             double chi_square() const
             {
+                // reuse the cached value when none of our used parameters has been
+                // modified since the cache update that the cached value was
+                // computed from; stamping the cache's generation (rather than the
+                // parameters') ensures that an evaluation ahead of the pending
+                // cache update does not mark the block clean prematurely
+                if (_chi_square_valid && (! _used_parameter_ids.empty()))
+                {
+                    auto parameters = _cache.parameters();
+                    const bool clean = std::none_of(_used_parameter_ids.cbegin(), _used_parameter_ids.cend(),
+                            [&parameters, this] (const Parameter::Id & id)
+                            {
+                                return parameters[id].generation() > _chi_square_generation;
+                            });
+
+                    if (clean)
+                        return _chi_square_cached;
+                }
+
+                const std::uint64_t current_generation = _cache.generation();
+
                 // read observable values from cache, and subtract mean
                 for (auto i = 0u ; i < _dim_pred ; ++i)
                 {
                     gsl_vector_set(_observables, i, _cache[_ids[i]]);
                 }
 
-                // prepare for centering
-                //   measurements <- mean
-                gsl_vector_memcpy(_measurements, _mean);
+                if (_response_sparse)
+                {
+                    // apply response matrix and center the gaussian, touching only
+                    // the non-vanishing entries:
+                    //   measurements <- R * observables - mean
+                    for (auto i = 0u ; i < _dim_meas ; ++i)
+                    {
+                        gsl_vector_set(_measurements, i, -gsl_vector_get(_mean, i));
+                    }
 
-                // apply response matrix and center the gaussian:
-                //   measurements <- R * observables - measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, -1.0, _measurements);
+                    for (const auto & [i, j, value] : _response_nonzeros)
+                    {
+                        gsl_vector_set(_measurements, i, gsl_vector_get(_measurements, i) + value * gsl_vector_get(_observables, j));
+                    }
+                }
+                else
+                {
+                    // prepare for centering
+                    //   measurements <- mean
+                    gsl_vector_memcpy(_measurements, _mean);
 
-                // observables <- inv(covariance) * measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements, 0.0, _measurements_2);
+                    // apply response matrix and center the gaussian:
+                    //   measurements <- R * observables - measurements
+                    gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, -1.0, _measurements);
+                }
 
+                // solve the triangular system L y = measurements in place;
+                // then chi^2 = y^T y, since inv(covariance) = L^-T L^-1
                 double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
+                if (_chol_sparse)
+                {
+                    // forward substitution on the compressed rows:
+                    //   y_i = (b_i - sum_j L_ij y_j) / L_ii
+                    result = 0.0;
+                    for (unsigned i = 0 ; i < _dim_meas ; ++i)
+                    {
+                        double y = gsl_vector_get(_measurements, i);
+                        for (unsigned k = _chol_row_offsets[i] ; k < _chol_row_offsets[i + 1] ; ++k)
+                        {
+                            y -= _chol_nonzeros[k].second * gsl_vector_get(_measurements, _chol_nonzeros[k].first);
+                        }
+                        y *= _chol_inv_diag[i];
+                        gsl_vector_set(_measurements, i, y);
+                        result += y * y;
+                    }
+                }
+                else
+                {
+                    gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, _chol, _measurements);
+                    gsl_blas_ddot(_measurements, _measurements, &result);
+                }
+
+                _chi_square_cached = result;
+                _chi_square_generation = current_generation;
+                _chi_square_valid = true;
 
                 return result;
             }
@@ -1007,6 +1218,17 @@ namespace eos
                 return _norm - 0.5 * chi_square();
             }
 
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                for (const auto & id : _ids)
+                {
+                    if (_cache.depends_on(id, parameter_id))
+                        return true;
+                }
+
+                return false;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -1014,28 +1236,77 @@ namespace eos
 
             virtual double sample(gsl_rng * rng) const
             {
+                // local scratch keeps concurrent pseudo-datasets from racing
+                // on the block's shared evaluation storage
+                gsl_vector * measurements = gsl_vector_alloc(_dim_meas);
+                gsl_vector * measurements_2 = gsl_vector_alloc(_dim_meas);
+
                 // generate standard normals in observables
                 for (auto i = 0u ; i < _dim_meas ; ++i)
                 {
-                    gsl_vector_set(_measurements, i, gsl_ran_ugaussian(rng));
+                    gsl_vector_set(measurements, i, gsl_ran_ugaussian(rng));
                 }
 
                 // transform: observables2 <- _chol * observables
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements, 0.0, _measurements_2);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, measurements, 0.0, measurements_2);
 
                 // To be consistent with the univariate Gaussian, we would center observables around theory,
                 // then compare to theory. Hence we can forget about theory, and stay centered on zero.
                 // transform: observables <- inv(covariance) * observables2
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements_2, 0.0, _measurements);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, measurements_2, 0.0, measurements);
 
                 double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
+                gsl_blas_ddot(measurements, measurements_2, &result);
                 result *= -0.5;
                 result += _norm;
 
+                gsl_vector_free(measurements_2);
+                gsl_vector_free(measurements);
+
                 return result;
             }
 
+            virtual double evaluate_resampled(gsl_rng * rng) const
+            {
+                // displace the means by a draw L z from the measurement
+                // covariance; local scratch keeps concurrent replicas from
+                // racing on the block's shared evaluation storage
+                gsl_vector * observables = gsl_vector_alloc(_dim_pred);
+                gsl_vector * noise = gsl_vector_alloc(_dim_meas);
+                gsl_vector * residual = gsl_vector_alloc(_dim_meas);
+
+                for (auto i = 0u ; i < _dim_pred ; ++i)
+                {
+                    gsl_vector_set(observables, i, _cache[_ids[i]]);
+                }
+
+                for (auto i = 0u ; i < _dim_meas ; ++i)
+                {
+                    gsl_vector_set(noise, i, gsl_ran_ugaussian(rng));
+                }
+
+                // residual <- mean + L * noise
+                gsl_vector_memcpy(residual, _mean);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, noise, 1.0, residual);
+
+                // apply response matrix and center the gaussian:
+                //   residual <- R * observables - residual
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, observables, -1.0, residual);
+
+                // solve the triangular system L y = residual in place;
+                // then chi^2 = y^T y, since inv(covariance) = L^-T L^-1
+                gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, _chol, residual);
+
+                double chi_square;
+                gsl_blas_ddot(residual, residual, &chi_square);
+
+                gsl_vector_free(residual);
+                gsl_vector_free(noise);
+                gsl_vector_free(observables);
+
+                return _norm - 0.5 * chi_square;
+            }
+
             virtual double significance() const
             {
                 const auto chi_squared = this->chi_square();
@@ -1120,6 +1391,17 @@ namespace eos
                 }
             }
 
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                for (auto i : ids)
+                {
+                    if (cache.depends_on(i, parameter_id))
+                        return true;
+                }
+
+                return false;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return 0.0;
@@ -1180,12 +1462,364 @@ namespace eos
                 return LogLikelihoodBlockPtr(new UniformBoundBlock(cache, std::move(ids), bound, uncertainty));
             }
         };
+
+        /*
+         * Evaluates the main (Poisson) term of a binned HistFactory likelihood,
+         * as specified by a workspace in the pyhf JSON format. The modifiers'
+         * constraint terms are not part of this block; as for the python-side
+         * pyhf bridge, they are expected to enter through the priors of the
+         * analysis.
+         */
+        struct HistFactoryBlock :
+            public LogLikelihoodBlock
+        {
+            // Multiplicative response of a sample to a scalar nuisance parameter
+            // alpha: hi^alpha above alpha = +1, lo^(-alpha) below alpha = -1, and
+            // a sixth-order polynomial in between that matches the values and the
+            // first two derivatives at the boundaries (HistFactory interpolation
+            // code 4).
+            struct NormSys
+            {
+                ObservableCache::Id id;
+
+                double hi;
+                double lo;
+
+                std::array<double, 6> coefficients;
+            };
+
+            // Additive per-bin response of a sample to a scalar nuisance
+            // parameter alpha: piecewise linear in the deviations of the hi/lo
+            // templates from the nominal one outside |alpha| = 1, and a
+            // sixth-order polynomial in between that matches the values and the
+            // first two derivatives at the boundaries (HistFactory interpolation
+            // code 4p).
+            struct HistoSys
+            {
+                ObservableCache::Id id;
+
+                std::vector<double> delta_up;   // hi_data - nominal
+                std::vector<double> delta_down; // nominal - lo_data
+                std::vector<double> s;          // (delta_up + delta_down) / 2
+                std::vector<double> a;          // (delta_up - delta_down) / 16
+            };
+
+            struct Sample
+            {
+                std::vector<double> nominal;
+
+                // normfactor and lumi parameters: plain multiplicative scalars
+                std::vector<ObservableCache::Id> scale_ids;
+
+                std::vector<NormSys> normsys;
+                std::vector<HistoSys> histosys;
+
+                // staterror, shapesys and shapefactor parameters: one
+                // multiplicative factor per bin
+                std::vector<std::vector<ObservableCache::Id>> binwise_ids;
+            };
+
+            struct Channel
+            {
+                std::vector<double> observed;
+                std::vector<Sample> samples;
+            };
+
+            ObservableCache cache;
+
+            std::vector<Channel> channels;
+
+            // unique ids of all registered workspace parameters
+            std::vector<ObservableCache::Id> parameter_ids;
+
+            unsigned n_bins;
+
+            // constant term -log(n!), summed over all bins
+            double norm;
+
+            // scratch buffers, to avoid per-evaluation allocations
+            mutable std::vector<double> rates;
+            mutable std::vector<double> yields;
+
+            HistFactoryBlock(const ObservableCache & cache, std::vector<Channel> && channels,
+                    std::vector<ObservableCache::Id> && parameter_ids) :
+                cache(cache),
+                channels(channels),
+                parameter_ids(parameter_ids),
+                n_bins(0),
+                norm(0.0)
+            {
+                for (const auto & channel : this->channels)
+                {
+                    n_bins += channel.observed.size();
+
+                    for (const double & n : channel.observed)
+                    {
+                        norm -= gsl_sf_lngamma(n + 1.0);
+                    }
+                }
+            }
+
+            virtual ~HistFactoryBlock()
+            {
+            }
+
+            // Coefficients of the interpolating polynomial of code 4, obtained by
+            // matching value, first and second derivative of hi^alpha at alpha = +1
+            // and of lo^(-alpha) at alpha = -1.
+            static std::array<double, 6> normsys_coefficients(const double & hi, const double & lo)
+            {
+                const double log_hi = std::log(hi), log_lo = std::log(lo);
+
+                // values and derivatives of the exponential pieces at the boundaries,
+                // split into their symmetric and antisymmetric parts
+                const double s0 = (hi + lo) / 2.0,                         a0 = (hi - lo) / 2.0;
+                const double s1 = (hi * log_hi - lo * log_lo) / 2.0,       a1 = (hi * log_hi + lo * log_lo) / 2.0;
+                const double s2 = (hi * log_hi * log_hi + lo * log_lo * log_lo) / 2.0;
+                const double a2 = (hi * log_hi * log_hi - lo * log_lo * log_lo) / 2.0;
+
+                const double c5 = (3.0 * a0 - 3.0 * s1 + a2) / 8.0;
+                const double c3 = (5.0 * s1 - 5.0 * a0 - a2) / 4.0;
+                const double c1 = a0 - c3 - c5;
+                const double c6 = (s2 - 5.0 * a1) / 8.0 + s0 - 1.0;
+                const double c4 = a1 / 2.0 - s0 + 1.0 - 2.0 * c6;
+                const double c2 = s0 - 1.0 - c4 - c6;
+
+                return { c1, c2, c3, c4, c5, c6 };
+            }
+
+            // Compute the expected event rates of one channel at the current
+            // parameter point; the result is left in the given rates buffer.
+            // The buffers are caller-provided so that concurrent pseudo-dataset
+            // scoring can use local scratch.
+            void expected_rates(const Channel & channel, std::vector<double> & rates, std::vector<double> & yields) const
+            {
+                const unsigned bins = channel.observed.size();
+
+                rates.assign(bins, 0.0);
+
+                for (const auto & sample : channel.samples)
+                {
+                    yields.assign(sample.nominal.begin(), sample.nominal.end());
+
+                    // additive shape variations
+                    for (const auto & h : sample.histosys)
+                    {
+                        const double alpha = cache[h.id];
+
+                        if (alpha >= +1.0)
+                        {
+                            for (auto b = 0u ; b < bins ; ++b)
+                            {
+                                yields[b] += alpha * h.delta_up[b];
+                            }
+                        }
+                        else if (alpha <= -1.0)
+                        {
+                            for (auto b = 0u ; b < bins ; ++b)
+                            {
+                                yields[b] += alpha * h.delta_down[b];
+                            }
+                        }
+                        else
+                        {
+                            const double alpha2 = alpha * alpha;
+                            const double q = alpha2 * (15.0 + alpha2 * (-10.0 + 3.0 * alpha2));
+
+                            for (auto b = 0u ; b < bins ; ++b)
+                            {
+                                yields[b] += alpha * h.s[b] + q * h.a[b];
+                            }
+                        }
+                    }
+
+                    // per-bin multiplicative factors
+                    for (const auto & binwise : sample.binwise_ids)
+                    {
+                        for (auto b = 0u ; b < bins ; ++b)
+                        {
+                            yields[b] *= cache[binwise[b]];
+                        }
+                    }
+
+                    // scalar multiplicative factors
+                    double factor = 1.0;
+                    for (const auto & id : sample.scale_ids)
+                    {
+                        factor *= cache[id];
+                    }
+                    for (const auto & n : sample.normsys)
+                    {
+                        const double alpha = cache[n.id];
+
+                        if (alpha >= +1.0)
+                        {
+                            factor *= std::pow(n.hi, alpha);
+                        }
+                        else if (alpha <= -1.0)
+                        {
+                            factor *= std::pow(n.lo, -alpha);
+                        }
+                        else
+                        {
+                            const auto & c = n.coefficients;
+                            factor *= 1.0 + alpha * (c[0] + alpha * (c[1] + alpha * (c[2] + alpha * (c[3] + alpha * (c[4] + alpha * c[5])))));
+                        }
+                    }
+
+                    for (auto b = 0u ; b < bins ; ++b)
+                    {
+                        rates[b] += factor * yields[b];
+                    }
+                }
+            }
+
+            virtual std::string as_string() const
+            {
+                std::string result = "HistFactory: ";
+                result += stringify(channels.size()) + " channels with " + stringify(n_bins) + " bins, ";
+                result += stringify(parameter_ids.size()) + " parameters";
+
+                return result;
+            }
+
+            virtual double evaluate() const
+            {
+                double result = norm;
+
+                for (const auto & channel : channels)
+                {
+                    expected_rates(channel, rates, yields);
+
+                    const unsigned bins = channel.observed.size();
+                    for (auto b = 0u ; b < bins ; ++b)
+                    {
+                        if (! (rates[b] > 0.0))
+                        {
+                            return -std::numeric_limits<double>::infinity();
+                        }
+
+                        result += channel.observed[b] * std::log(rates[b]) - rates[b];
+                    }
+                }
+
+                return result;
+            }
+
+            virtual bool depends_on(const Parameter::Id & parameter_id) const
+            {
+                for (const auto & id : parameter_ids)
+                {
+                    if (cache.depends_on(id, parameter_id))
+                        return true;
+                }
+
+                return false;
+            }
+
+            virtual unsigned number_of_observations() const
+            {
+                return n_bins;
+            }
+
+            virtual double sample(gsl_rng * rng) const
+            {
+                // draw toy observations from the Poisson distributions at the
+                // current expected rates, and score the toys against those rates;
+                // local buffers keep concurrent pseudo-datasets independent
+                std::vector<double> rates, yields;
+
+                double result = 0.0;
+
+                for (const auto & channel : channels)
+                {
+                    expected_rates(channel, rates, yields);
+
+                    const unsigned bins = channel.observed.size();
+                    for (auto b = 0u ; b < bins ; ++b)
+                    {
+                        const unsigned n = gsl_ran_poisson(rng, rates[b]);
+                        result += n * std::log(rates[b]) - rates[b] - gsl_sf_lngamma(n + 1.0);
+                    }
+                }
+
+                return result;
+            }
+
+            virtual double significance() const
+            {
+                throw InternalError("LogLikelihoodBlock::HistFactory: significance() is not defined for a multi-bin Poisson block");
+
+                return 0.0;
+            }
+
+            virtual TestStatistic primary_test_statistic() const
+            {
+                return test_statistics::Empty();
+            }
+
+            virtual LogLikelihoodBlockPtr clone(ObservableCache cache) const
+            {
+                // add the parameters' observables to the new cache, and remap all ids
+                std::map<ObservableCache::Id, ObservableCache::Id> id_map;
+                std::vector<ObservableCache::Id> ids;
+                for (const auto & id : parameter_ids)
+                {
+                    id_map[id] = cache.add(this->cache.observable(id)->clone(cache.parameters()));
+                    ids.push_back(id_map[id]);
+                }
+
+                std::vector<Channel> cloned(channels);
+                for (auto & channel : cloned)
+                {
+                    for (auto & sample : channel.samples)
+                    {
+                        for (auto & id : sample.scale_ids)
+                        {
+                            id = id_map.at(id);
+                        }
+                        for (auto & n : sample.normsys)
+                        {
+                            n.id = id_map.at(n.id);
+                        }
+                        for (auto & h : sample.histosys)
+                        {
+                            h.id = id_map.at(h.id);
+                        }
+                        for (auto & binwise : sample.binwise_ids)
+                        {
+                            for (auto & id : binwise)
+                            {
+                                id = id_map.at(id);
+                            }
+                        }
+                    }
+                }
+
+                return LogLikelihoodBlockPtr(new HistFactoryBlock(cache, std::move(cloned), std::move(ids)));
+            }
+        };
     }
 
     LogLikelihoodBlock::~LogLikelihoodBlock()
     {
     }
 
+    bool
+    LogLikelihoodBlock::depends_on(const Parameter::Id &) const
+    {
+        // conservative default for blocks that do not know their observables' cache ids
+        return true;
+    }
+
+    double
+    LogLikelihoodBlock::evaluate_resampled(gsl_rng *) const
+    {
+        // default for blocks without a resamplable central value: contribute
+        // the nominal likelihood
+        return evaluate();
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable,
             const double & min, const double & central, const double & max,
@@ -1324,6 +1958,201 @@ namespace eos
         return LogLikelihoodBlockPtr(new implementation::UniformBoundBlock(cache, std::move(indices), bound, uncertainty));
     }
 
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::HistFactory(ObservableCache cache, const std::string & workspace,
+            const std::map<std::string, std::string> & parameter_map)
+    {
+        YAML::Node node;
+        try
+        {
+            node = YAML::LoadFile(workspace);
+        }
+        catch (YAML::Exception & e)
+        {
+            throw InternalError("LogLikelihoodBlock::HistFactory: cannot load workspace '" + workspace + "': " + e.what());
+        }
+
+        if ((! node["channels"]) || (! node["channels"].IsSequence()))
+            throw InternalError("LogLikelihoodBlock::HistFactory: workspace '" + workspace + "' does not specify any channels");
+
+        // observed event counts per channel
+        std::map<std::string, std::vector<double>> observations;
+        for (auto && o : node["observations"])
+        {
+            observations[o["name"].as<std::string>()] = o["data"].as<std::vector<double>>();
+        }
+
+        // per-parameter overrides of the initial values and bounds, taken from
+        // the first measurement's configuration
+        std::map<std::string, YAML::Node> config;
+        if (node["measurements"] && (node["measurements"].size() > 0) && node["measurements"][0]["config"])
+        {
+            for (auto && p : node["measurements"][0]["config"]["parameters"])
+            {
+                config[p["name"].as<std::string>()] = static_cast<const YAML::Node &>(p);
+            }
+        }
+
+        // pyhf's suggested initial value and bounds per modifier type
+        static const std::map<std::string, std::array<double, 3>> defaults
+        {
+            { "normfactor",  { 1.0,   0.0, 10.0 } },
+            { "shapefactor", { 1.0,   0.0, 10.0 } },
+            { "lumi",        { 1.0,   0.0, 10.0 } },
+            { "staterror",   { 1.0, 1e-10, 10.0 } },
+            { "shapesys",    { 1.0, 1e-10, 10.0 } },
+            { "normsys",     { 0.0,  -5.0,  5.0 } },
+            { "histosys",    { 0.0,  -5.0,  5.0 } },
+        };
+
+        Parameters parameters = cache.parameters();
+
+        // register one workspace parameter as an EOS parameter (or resolve it
+        // to an existing observable), mirroring the python-side pyhf bridge;
+        // per-bin parameters carry a '[bin]' suffix
+        std::map<std::string, ObservableCache::Id> ids;
+        std::vector<ObservableCache::Id> parameter_ids;
+        auto register_parameter = [&] (const std::string & pyhf_name, const std::string & type, const unsigned & bin, const bool & scalar) -> ObservableCache::Id
+        {
+            const std::string full_name = scalar ? pyhf_name : pyhf_name + "[" + stringify(bin) + "]";
+
+            auto i = ids.find(full_name);
+            if (ids.end() != i)
+                return i->second;
+
+            const auto & d = defaults.find(type)->second;
+            double init = d[0], min = d[1], max = d[2];
+            auto c = config.find(pyhf_name);
+            if (config.end() != c)
+            {
+                if (c->second["inits"] && (c->second["inits"].size() > bin))
+                {
+                    init = c->second["inits"][bin].as<double>();
+                }
+                if (c->second["bounds"] && (c->second["bounds"].size() > bin))
+                {
+                    min = c->second["bounds"][bin][0].as<double>();
+                    max = c->second["bounds"][bin][1].as<double>();
+                }
+            }
+
+            std::string name = "pyhf::" + full_name;
+            auto m = parameter_map.find(full_name);
+            if (parameter_map.end() != m)
+            {
+                name = m->second;
+            }
+
+            const QualifiedName qn(name);
+            ObservablePtr observable;
+            try
+            {
+                observable = Observable::make(qn, parameters, Kinematics{}, Options{});
+            }
+            catch (UnknownObservableError &)
+            {
+                parameters.declare_and_insert(qn, full_name, Unit::Undefined(), init, min, max);
+                observable = Observable::make(qn, parameters, Kinematics{}, Options{});
+            }
+
+            // (re)initialize plain parameters to the workspace's initial value
+            if (parameters.has(qn))
+            {
+                parameters[qn] = init;
+            }
+
+            const ObservableCache::Id id = cache.add(observable);
+            ids[full_name] = id;
+            parameter_ids.push_back(id);
+
+            return id;
+        };
+
+        std::vector<implementation::HistFactoryBlock::Channel> channels;
+        for (auto && c : node["channels"])
+        {
+            const std::string channel_name = c["name"].as<std::string>();
+
+            auto o = observations.find(channel_name);
+            if (observations.end() == o)
+                throw InternalError("LogLikelihoodBlock::HistFactory: workspace '" + workspace + "' provides no observed data for channel '" + channel_name + "'");
+
+            implementation::HistFactoryBlock::Channel channel;
+            channel.observed = o->second;
+            const unsigned bins = channel.observed.size();
+
+            for (auto && s : c["samples"])
+            {
+                implementation::HistFactoryBlock::Sample sample;
+                sample.nominal = s["data"].as<std::vector<double>>();
+                if (sample.nominal.size() != bins)
+                    throw InternalError("LogLikelihoodBlock::HistFactory: sample '" + s["name"].as<std::string>() + "' in channel '" + channel_name + "' does not match the channel's number of bins");
+
+                for (auto && m : s["modifiers"])
+                {
+                    const std::string name = m["name"].as<std::string>();
+                    const std::string type = m["type"].as<std::string>();
+
+                    if (("normfactor" == type) || ("lumi" == type))
+                    {
+                        sample.scale_ids.push_back(register_parameter(name, type, 0, true));
+                    }
+                    else if ("normsys" == type)
+                    {
+                        const double hi = m["data"]["hi"].as<double>();
+                        const double lo = m["data"]["lo"].as<double>();
+
+                        sample.normsys.push_back(implementation::HistFactoryBlock::NormSys
+                        {
+                            register_parameter(name, type, 0, true),
+                            hi, lo,
+                            implementation::HistFactoryBlock::normsys_coefficients(hi, lo)
+                        });
+                    }
+                    else if ("histosys" == type)
+                    {
+                        const std::vector<double> hi = m["data"]["hi_data"].as<std::vector<double>>();
+                        const std::vector<double> lo = m["data"]["lo_data"].as<std::vector<double>>();
+                        if ((hi.size() != bins) || (lo.size() != bins))
+                            throw InternalError("LogLikelihoodBlock::HistFactory: histosys modifier '" + name + "' in channel '" + channel_name + "' does not match the channel's number of bins");
+
+                        implementation::HistFactoryBlock::HistoSys h;
+                        h.id = register_parameter(name, type, 0, true);
+                        for (auto b = 0u ; b < bins ; ++b)
+                        {
+                            const double delta_up = hi[b] - sample.nominal[b];
+                            const double delta_down = sample.nominal[b] - lo[b];
+                            h.delta_up.push_back(delta_up);
+                            h.delta_down.push_back(delta_down);
+                            h.s.push_back((delta_up + delta_down) / 2.0);
+                            h.a.push_back((delta_up - delta_down) / 16.0);
+                        }
+                        sample.histosys.push_back(std::move(h));
+                    }
+                    else if (("staterror" == type) || ("shapesys" == type) || ("shapefactor" == type))
+                    {
+                        std::vector<ObservableCache::Id> binwise;
+                        for (auto b = 0u ; b < bins ; ++b)
+                        {
+                            binwise.push_back(register_parameter(name, type, b, false));
+                        }
+                        sample.binwise_ids.push_back(std::move(binwise));
+                    }
+                    else
+                    {
+                        throw InternalError("LogLikelihoodBlock::HistFactory: unsupported modifier type '" + type + "' in workspace '" + workspace + "'");
+                    }
+                }
+
+                channel.samples.push_back(std::move(sample));
+            }
+
+            channels.push_back(std::move(channel));
+        }
+
+        return LogLikelihoodBlockPtr(new implementation::HistFactoryBlock(cache, std::move(channels), std::move(parameter_ids)));
+    }
+
     template <>
     struct WrappedForwardIteratorTraits<LogLikelihood::ConstraintIteratorTag>
     {
@@ -1345,9 +2174,13 @@ namespace eos
         // Container for all external likelihood blocks
         std::vector<LogLikelihoodBlockPtr> external_blocks;
 
+        // Instrumentation: number of likelihood evaluations carried out so far
+        unsigned long evaluations;
+
         Implementation(const Parameters & parameters) :
             parameters(parameters),
-            cache(parameters)
+            cache(parameters),
+            evaluations(0)
         {
         }
 
@@ -1378,31 +2211,18 @@ namespace eos
                                      << "The value of the test statistic (total likelihood) "
                                      << "for the current parameters is = " << t_obs;
 
-            // count data sets with smaller likelihood
-            unsigned n_low = 0;
-
-            // test value
-            double t;
-
-            gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
-            gsl_rng_set(rng, datasets);
-
             Log::instance()->message("log_likelihood.bootstrap_pvalue", ll_informational)
                                      << "Begin sampling " << datasets << " simulated "
                                      << "values of the likelihood";
 
-            // collect samples
-            for (unsigned i = 0 ; i < datasets ; ++i)
-            {
-                t = 0.0;
-                for (const auto & constraint : constraints)
-                {
-                    for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
-                    {
-                        t += (*b)->sample(rng);
-                    }
-                }
+            // collect samples; the seed retains the historical choice
+            std::vector<double> ensemble(datasets, 0.0);
+            simulate(datasets, datasets, ensemble.data());
 
+            // count data sets with smaller likelihood
+            unsigned n_low = 0;
+            for (const double & t : ensemble)
+            {
                 if (t < t_obs)
                 {
                     ++n_low;
@@ -1421,21 +2241,75 @@ namespace eos
                                      << "The simulated p-value is " << p
                                      << " with uncertainty " << uncertainty;
 
-            gsl_rng_free(rng);
-
             return std::make_pair(p, uncertainty);
         }
 
+        // Number of constraint blocks from which onwards their evaluation is
+        // dispatched across the ThreadPool rather than carried out serially
+        static constexpr unsigned parallel_block_threshold = 16;
+
         double log_likelihood() const
         {
             double result = 0.0;
 
-            // loop over all constraint-based likelihood blocks
+            // collect the constraint-based likelihood blocks; each block appears
+            // exactly once, and distinct blocks do not share evaluation scratch,
+            // so they can safely be evaluated concurrently
+            std::vector<LogLikelihoodBlock *> blocks;
             for (const auto & constraint : constraints)
             {
                 for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
                 {
-                    double llh = (*b)->evaluate();
+                    blocks.push_back(b->get());
+                }
+            }
+
+            if ((blocks.size() >= parallel_block_threshold) && (ThreadPool::instance()->number_of_threads() >= 2))
+            {
+                // size-aware scheduling: start the largest blocks first, so that a
+                // big multivariate block does not straggle behind a tail of cheap ones
+                std::stable_sort(blocks.begin(), blocks.end(), [] (const LogLikelihoodBlock * lhs, const LogLikelihoodBlock * rhs)
+                {
+                    return lhs->number_of_observations() > rhs->number_of_observations();
+                });
+
+                std::vector<double> values(blocks.size());
+                std::vector<std::exception_ptr> errors(blocks.size());
+
+                ThreadPool::instance()->parallel_for(0, blocks.size(), [&blocks, &values, &errors] (size_t begin, size_t end)
+                {
+                    for (size_t i = begin ; i != end ; ++i)
+                    {
+                        try
+                        {
+                            values[i] = blocks[i]->evaluate();
+                        }
+                        catch (...)
+                        {
+                            errors[i] = std::current_exception();
+                        }
+                    }
+                }, 1);
+
+                for (const auto & error : errors)
+                {
+                    if (error)
+                        std::rethrow_exception(error);
+                }
+
+                for (const double & llh : values)
+                {
+                    if (! std::isfinite(llh))
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += llh;
+                }
+            }
+            else
+            {
+                for (const auto & block : blocks)
+                {
+                    double llh = block->evaluate();
                     if (! std::isfinite(llh))
                         return -std::numeric_limits<double>::infinity();
 
@@ -1443,7 +2317,8 @@ namespace eos
                 }
             }
 
-            // loop over all external likelihood blocks
+            // loop over all external likelihood blocks; these may carry arbitrary
+            // user-provided state, so they are evaluated serially
             for (const auto & block : external_blocks)
             {
                 double llh = block->evaluate();
@@ -1455,6 +2330,112 @@ namespace eos
 
             return result;
         }
+
+        // Evaluate an ensemble of likelihoods with resampled experimental central
+        // values; the cached predictions have been computed once up front and are
+        // shared by all replicas.
+        void resample(const unsigned & datasets, const unsigned long & seed, double * results) const
+        {
+            std::vector<const LogLikelihoodBlock *> blocks;
+            for (const auto & constraint : constraints)
+            {
+                for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                {
+                    blocks.push_back(b->get());
+                }
+            }
+
+            // external blocks may carry arbitrary user-provided state; their
+            // nominal contribution is computed once, serially, and shared by
+            // all replicas
+            double external = 0.0;
+            for (const auto & block : external_blocks)
+            {
+                external += block->evaluate();
+            }
+
+            auto evaluate_replicas = [&blocks, &external, &seed, results] (size_t begin, size_t end)
+            {
+                for (size_t r = begin ; r != end ; ++r)
+                {
+                    // one generator per replica, seeded independently of the
+                    // thread partition, keeps the ensemble reproducible
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, seed + r);
+
+                    double result = external;
+                    for (const auto & block : blocks)
+                    {
+                        const double llh = block->evaluate_resampled(rng);
+                        if (! std::isfinite(llh))
+                        {
+                            result = -std::numeric_limits<double>::infinity();
+                            break;
+                        }
+
+                        result += llh;
+                    }
+                    results[r] = result;
+
+                    gsl_rng_free(rng);
+                }
+            };
+
+            if ((datasets >= 2) && (ThreadPool::instance()->number_of_threads() >= 2))
+            {
+                ThreadPool::instance()->parallel_for(0, datasets, evaluate_replicas, 1);
+            }
+            else
+            {
+                evaluate_replicas(0, datasets);
+            }
+        }
+
+        // Draw an ensemble of pseudo-datasets from the likelihood blocks at the
+        // current predictions, and score each pseudo-dataset with its generating
+        // distribution; the resulting values sample the distribution of the
+        // total-likelihood test statistic. The predictions are computed once up
+        // front and shared by all pseudo-datasets.
+        void simulate(const unsigned & datasets, const unsigned long & seed, double * results) const
+        {
+            std::vector<const LogLikelihoodBlock *> blocks;
+            for (const auto & constraint : constraints)
+            {
+                for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                {
+                    blocks.push_back(b->get());
+                }
+            }
+
+            auto sample_replicas = [&blocks, &seed, results] (size_t begin, size_t end)
+            {
+                for (size_t r = begin ; r != end ; ++r)
+                {
+                    // one generator per pseudo-dataset, seeded independently of
+                    // the thread partition, keeps the ensemble reproducible
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, seed + r);
+
+                    double result = 0.0;
+                    for (const auto & block : blocks)
+                    {
+                        result += block->sample(rng);
+                    }
+                    results[r] = result;
+
+                    gsl_rng_free(rng);
+                }
+            };
+
+            if ((datasets >= 2) && (ThreadPool::instance()->number_of_threads() >= 2))
+            {
+                ThreadPool::instance()->parallel_for(0, datasets, sample_replicas, 1);
+            }
+            else
+            {
+                sample_replicas(0, datasets);
+            }
+        }
     };
 
     LogLikelihood::LogLikelihood(const Parameters & parameters) :
@@ -1567,7 +2548,123 @@ namespace eos
     LogLikelihood::operator() () const
     {
         _imp->cache.update();
+        ++_imp->evaluations;
+
+        // feed the probe sampler; no more than an atomic increment unless sampling is enabled
+        ProbeRegistry::instance()->tick();
 
         return _imp->log_likelihood();
     }
+
+    void
+    LogLikelihood::profile(const Parameter & parameter, const double * points, const size_t & n_points, double * results) const
+    {
+        Parameter p = parameter;
+        const double original_value = p.evaluate();
+
+        // bring every prediction up to date at the current parameter point
+        _imp->cache.update();
+
+        // partition the blocks: the contribution of every block independent of the
+        // scanned parameter is constant along the profile and computed only once
+        std::vector<LogLikelihoodBlockPtr> dependent_blocks;
+        double base = 0.0;
+
+        for (const auto & constraint : _imp->constraints)
+        {
+            for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+            {
+                if ((*b)->depends_on(p.id()))
+                {
+                    dependent_blocks.push_back(*b);
+                    continue;
+                }
+
+                double llh = (*b)->evaluate();
+                if (! std::isfinite(llh))
+                {
+                    base = -std::numeric_limits<double>::infinity();
+                    break;
+                }
+
+                base += llh;
+            }
+        }
+
+        // external blocks do not necessarily know their observables' cache ids,
+        // so LogLikelihoodBlock::depends_on() treats them conservatively
+        for (const auto & block : _imp->external_blocks)
+        {
+            if (block->depends_on(p.id()))
+            {
+                dependent_blocks.push_back(block);
+            }
+            else
+            {
+                double llh = block->evaluate();
+                if (! std::isfinite(llh))
+                {
+                    base = -std::numeric_limits<double>::infinity();
+                    break;
+                }
+
+                base += llh;
+            }
+        }
+
+        for (size_t i = 0 ; i < n_points ; ++i)
+        {
+            p = points[i];
+
+            // only the dependent predictions are stale, since no other parameter changed
+            _imp->cache.update(p.id());
+            ++_imp->evaluations;
+
+            double result = base;
+            for (const auto & block : dependent_blocks)
+            {
+                if (! std::isfinite(result))
+                    break;
+
+                double llh = block->evaluate();
+                if (! std::isfinite(llh))
+                {
+                    result = -std::numeric_limits<double>::infinity();
+                    break;
+                }
+
+                result += llh;
+            }
+
+            results[i] = result;
+        }
+
+        // restore the scanned parameter and the dependent predictions
+        p = original_value;
+        _imp->cache.update(p.id());
+    }
+
+    void
+    LogLikelihood::simulate(const unsigned & datasets, const unsigned long & seed, double * results) const
+    {
+        // bring the shared predictions up to date once for the entire ensemble
+        _imp->cache.update();
+
+        _imp->simulate(datasets, seed, results);
+    }
+
+    void
+    LogLikelihood::resample(const unsigned & datasets, const unsigned long & seed, double * results) const
+    {
+        // the predictions are computed once and shared by all replicas
+        _imp->cache.update();
+
+        _imp->resample(datasets, seed, results);
+    }
+
+    unsigned long
+    LogLikelihood::number_of_evaluations() const
+    {
+        return _imp->evaluations;
+    }
 }
@@ -35,6 +35,8 @@
 #include <gsl/gsl_vector.h>
 
 #include <cmath>
+#include <map>
+#include <string>
 
 namespace eos
 {
@@ -61,6 +63,31 @@ namespace eos
             /// Compute the logarithm of the likelihood for this block.
             virtual double evaluate() const = 0;
 
+            /*!
+             * Compute the logarithm of the likelihood for this block, with its
+             * experimental central values displaced by a random draw from the
+             * block's own uncertainty distribution. Neither the block nor the
+             * cached predictions are modified.
+             *
+             * The default implementation returns evaluate(): a block that does
+             * not model a resamplable central value contributes its nominal
+             * likelihood.
+             *
+             * @param rng The random number generator from which the displacement is drawn.
+             */
+            virtual double evaluate_resampled(gsl_rng * rng) const;
+
+            /*!
+             * Return whether this block's value depends on the given parameter.
+             *
+             * The default implementation conservatively reports a dependence on
+             * every parameter; blocks that know the cache ids of their observables
+             * override it with an exact answer.
+             *
+             * @param id The id of the parameter in question.
+             */
+            virtual bool depends_on(const Parameter::Id & id) const;
+
             /// The number of experimental observations (not observables!) used in this block.
             virtual unsigned number_of_observations() const = 0;
 
@@ -299,6 +326,30 @@ namespace eos
              */
             static LogLikelihoodBlockPtr UniformBound(ObservableCache cache, const std::vector<ObservablePtr> & observables,
                                                       const double & bound, const double & uncertainty);
+
+            /*!
+             * Create a new LogLikelihoodBlock for the main term of a binned
+             * HistFactory likelihood, specified by a workspace file in the
+             * pyhf JSON format.
+             *
+             * The workspace is evaluated natively: each bin contributes a
+             * Poisson term, with the samples' expected rates modified by the
+             * workspace's normfactor, lumi, normsys, histosys, staterror,
+             * shapesys and shapefactor parameters. The modifiers' constraint
+             * terms are not part of this block; as for the python-side pyhf
+             * bridge, they are expected to enter through the priors of the
+             * analysis.
+             *
+             * Each workspace parameter is registered as an EOS parameter named
+             * 'pyhf::<name>', unless parameter_map assigns it the qualified
+             * name of an existing EOS parameter or observable.
+             *
+             * @param cache         The Observable cache into which the workspace's parameters are registered.
+             * @param workspace     Path of the workspace file.
+             * @param parameter_map Optional map of workspace parameter names to qualified names.
+             */
+            static LogLikelihoodBlockPtr HistFactory(ObservableCache cache, const std::string & workspace,
+                    const std::map<std::string, std::string> & parameter_map = {});
     };
 
     /*!
@@ -405,6 +456,68 @@ namespace eos
              * @note: all observables are recalculated
              */
             double operator()() const;
+
+            /*!
+             * Evaluate the log likelihood along a one-parameter profile.
+             *
+             * The scanned parameter is declared up front: the contribution of every
+             * block independent of it is computed once at the current parameter
+             * point, and per scan point only the dependent observables and blocks
+             * are re-evaluated. All other parameters must remain fixed throughout
+             * the scan. On return, the scanned parameter and the dependent
+             * predictions are restored to their original values.
+             *
+             * @param parameter The parameter that is scanned; must belong to this likelihood's Parameters object.
+             * @param points    Pointer to the first of n_points values of the scanned parameter.
+             * @param n_points  Number of scan points to evaluate.
+             * @param results   Pointer to an array of n_points entries to which the log likelihood values are written.
+             */
+            void profile(const Parameter & parameter, const double * points, const size_t & n_points, double * results) const;
+
+            /*!
+             * Evaluate an ensemble of likelihoods whose experimental central
+             * values are resampled from the blocks' own uncertainty
+             * distributions.
+             *
+             * The predictions of all observables are computed once at the
+             * current parameter point and shared across the ensemble; each
+             * replica then re-scores those predictions against central values
+             * displaced by a random draw from the respective block's
+             * covariance. Replicas are evaluated concurrently across the
+             * ThreadPool's threads, and replica i is reproducible for a given
+             * seed regardless of the number of threads.
+             *
+             * @param datasets Number of resampled replicas to evaluate.
+             * @param seed     Seed for the random displacements.
+             * @param results  Pointer to an array of datasets entries to which the log likelihood values are written.
+             */
+            void resample(const unsigned & datasets, const unsigned long & seed, double * results) const;
+
+            /*!
+             * Simulate the distribution of the total-likelihood test statistic
+             * by drawing pseudo-datasets from the likelihood blocks.
+             *
+             * The predictions of all observables are computed once at the
+             * current parameter point and shared across the ensemble; each
+             * pseudo-dataset is then drawn from the blocks' distributions at
+             * those predictions and scored with its generating distribution.
+             * Pseudo-datasets are evaluated concurrently across the
+             * ThreadPool's threads, and entry i is reproducible for a given
+             * seed regardless of the number of threads. The empirical
+             * distribution of the results calibrates p values such as the one
+             * returned by bootstrap_p_value().
+             *
+             * @param datasets Number of pseudo-datasets to draw.
+             * @param seed     Seed for the pseudo-dataset draws.
+             * @param results  Pointer to an array of datasets entries to which the test statistic values are written.
+             */
+            void simulate(const unsigned & datasets, const unsigned long & seed, double * results) const;
+            ///@}
+
+            ///@name Instrumentation
+            ///@{
+            /// Retrieve the number of likelihood evaluations carried out so far.
+            unsigned long number_of_evaluations() const;
             ///@}
     };
 
@@ -23,6 +23,11 @@
 #include <eos/statistics/log-posterior_TEST.hh>
 #include <eos/maths/power-of.hh>
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include <unistd.h>
 
 using namespace test;
 using namespace eos;
@@ -210,6 +215,48 @@ namespace eos
                     TEST_CHECK_EQUAL(llh.observable_cache().size(), 2);
                 }
 
+                // deduplication reporting
+                {
+                    LogLikelihood llh(p);
+
+                    // same observable shared by three measurements, plus one genuinely new one
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), +4.1, +4.2, +4.3);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), +4.3, +4.4, +4.5);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), +4.0, +4.1, +4.2);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::c",        k)), +1.15, +1.2, +1.25);
+
+                    auto cache = llh.observable_cache();
+                    TEST_CHECK_EQUAL(cache.size(), 2);
+                    TEST_CHECK_EQUAL(cache.number_of_additions(), 4);
+                    TEST_CHECK_RELATIVE_ERROR(cache.deduplication_rate(), 0.5, eps);
+                }
+
+                // concurrent block evaluation agrees with the serial sum
+                {
+                    // enough blocks to trigger the parallel evaluation path
+                    static const unsigned n_blocks = 24;
+
+                    p["mass::b(MSbar)"] = 4.3;
+
+                    LogLikelihood llh(p);
+
+                    double expected = 0.0;
+                    for (unsigned i = 0 ; i < n_blocks ; ++i)
+                    {
+                        const double min     = 4.10 + 0.01 * i;
+                        const double central = min + 0.10;
+                        const double max     = central + 0.10;
+
+                        llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), min, central, max);
+
+                        LogLikelihood reference(p);
+                        reference.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), min, central, max);
+                        expected += reference();
+                    }
+
+                    TEST_CHECK_NEARLY_EQUAL(llh(), expected, eps);
+                }
+
                 // check single Gaussian block likelihood
                 {
                     ObservablePtr obs(new ObservableStub(p, "mass::b(MSbar)", k));
@@ -655,6 +702,209 @@ namespace eos
                     // ratio of pdfs at mode given by weight ratio
                     TEST_CHECK_RELATIVE_ERROR(pdf_favored, pdf_suppressed + std::log(weights[0] / weights[1]), 1e-12);
                 }
+
+                // resampling ensemble
+                {
+                    Parameters parameters = Parameters::Defaults();
+                    LogLikelihood llh(parameters);
+                    llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), +4.1, +4.2, +4.3);
+
+                    std::array<ObservablePtr, 2> obs
+                    {{
+                        ObservablePtr(new ObservableStub(parameters, "mass::c")),
+                        ObservablePtr(new ObservableStub(parameters, "mass::tau"))
+                    }};
+                    std::array<double, 2> mean{{ 1.2, 1.8 }};
+                    std::array<std::array<double, 2>, 2> covariance;
+                    covariance[0][0] = 0.05 * 0.05;
+                    covariance[1][1] = 0.04 * 0.04;
+                    covariance[0][1] = covariance[1][0] = 0.0008;
+
+                    ObservableCache cache(parameters);
+                    auto block = LogLikelihoodBlock::MultivariateGaussian<2>(cache, obs, mean, covariance);
+                    llh.add(Constraint("test::charm-tau-masses", std::vector<ObservablePtr>(obs.begin(), obs.end()),
+                        std::vector<LogLikelihoodBlockPtr>{ block }));
+
+                    parameters["mass::b(MSbar)"] = 4.25;
+                    parameters["mass::c"] = 1.25;
+                    parameters["mass::tau"] = 1.75;
+
+                    const double nominal = llh();
+
+                    const unsigned n = 50000;
+                    std::vector<double> ensemble(n, 0.0);
+                    llh.resample(n, 1701, ensemble.data());
+
+                    // the ensemble is reproducible for a given seed ...
+                    std::vector<double> repeat(n, 0.0);
+                    llh.resample(n, 1701, repeat.data());
+                    TEST_CHECK(ensemble == repeat);
+
+                    // ... and non-degenerate
+                    TEST_CHECK(ensemble[0] != ensemble[1]);
+
+                    // resampling the central values adds one unit of chi^2 per
+                    // observation in expectation: E[llh'] = llh - k / 2 with
+                    // k = 3 observations
+                    double sum = 0.0;
+                    for (const double & value : ensemble)
+                    {
+                        sum += value;
+                    }
+                    TEST_CHECK_NEARLY_EQUAL(sum / n, nominal - 1.5, 5e-2);
+                }
+
+                // simulated test-statistic distribution
+                {
+                    Parameters parameters  = Parameters::Defaults();
+                    LogLikelihood llh(parameters);
+                    llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.182, 1.192, 1.202);
+                    llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.19, 1.2, 1.21);
+
+                    parameters["mass::c"] = 1.196;
+                    const double t_obs = llh();
+
+                    const unsigned n = 50000;
+                    std::vector<double> ensemble(n, 0.0);
+                    llh.simulate(n, 1701, ensemble.data());
+
+                    // the ensemble is reproducible for a given seed ...
+                    std::vector<double> repeat(n, 0.0);
+                    llh.simulate(n, 1701, repeat.data());
+                    TEST_CHECK(ensemble == repeat);
+
+                    // ... and non-degenerate
+                    TEST_CHECK(ensemble[0] != ensemble[1]);
+
+                    // the empirical p-value from the ensemble reproduces the
+                    // bootstrap result for chi^2=0.32 and two degrees-of-freedom
+                    unsigned n_low = 0;
+                    for (const double & t : ensemble)
+                    {
+                        if (t < t_obs)
+                        {
+                            ++n_low;
+                        }
+                    }
+                    TEST_CHECK_NEARLY_EQUAL(n_low / double(n), 0.852143788, 5e-3);
+                }
+
+                // HistFactory main term
+                {
+                    static const double eps = 5e-13;
+
+                    auto write_workspace = [] (const char * content) -> std::string
+                    {
+                        char filename[] = "/tmp/eos-log-likelihood_TEST-XXXXXX";
+                        int fd = mkstemp(filename);
+                        TEST_CHECK(-1 != fd);
+                        close(fd);
+
+                        std::ofstream file(filename);
+                        file << content;
+
+                        return filename;
+                    };
+
+                    // two-bin counting experiment with normfactor, histosys,
+                    // staterror and shapesys modifiers
+                    static const char * workspace_a = R"(
+                    {
+                        "channels": [ { "name": "single_channel", "samples": [
+                            { "name": "signal", "data": [5.0, 10.0], "modifiers": [
+                                { "name": "mu", "type": "normfactor", "data": null },
+                                { "name": "stat_unc", "type": "staterror", "data": [1.0, 2.0] } ] },
+                            { "name": "background", "data": [50.0, 60.0], "modifiers": [
+                                { "name": "correlated_bkg_uncertainty", "type": "histosys",
+                                  "data": { "hi_data": [45.0, 54.0], "lo_data": [55.0, 66.0] } },
+                                { "name": "stat_unc", "type": "staterror", "data": [10.0, 12.0] },
+                                { "name": "shape_unc", "type": "shapesys", "data": [10.0, 12.0] } ] } ] } ],
+                        "measurements": [ { "name": "measurement", "config": { "poi": "mu", "parameters": [
+                            { "name": "mu", "inits": [1.0], "bounds": [[0.0, 10.0]] },
+                            { "name": "correlated_bkg_uncertainty", "inits": [0.0], "bounds": [[-5.0, 5.0]] } ] } } ],
+                        "observations": [ { "name": "single_channel", "data": [60.0, 80.0] } ]
+                    }
+                    )";
+
+                    const std::string file_a = write_workspace(workspace_a);
+
+                    Parameters parameters = Parameters::Defaults();
+                    ObservableCache cache(parameters);
+
+                    auto block = LogLikelihoodBlock::HistFactory(cache, file_a);
+                    cache.update();
+
+                    TEST_CHECK_EQUAL(block->number_of_observations(), 2u);
+
+                    // at the workspace's initial values: rates {55, 70} vs. observations {60, 80}
+                    TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.9816872314683, eps);
+
+                    // the normfactor scales the signal sample only: rates {60, 80}
+                    parameters["pyhf::mu"] = 2.0;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.078493202128783, eps);
+                    parameters["pyhf::mu"] = 1.0;
+
+                    // the histosys response is linear here, since the hi/lo templates
+                    // deviate symmetrically from the nominal one
+                    parameters["pyhf::correlated_bkg_uncertainty"] = 0.5;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -7.777097982233386, eps);
+                    parameters["pyhf::correlated_bkg_uncertainty"] = 0.0;
+
+                    // the staterror factor scales both samples' first bin
+                    parameters["pyhf::stat_unc[0]"] = 1.1;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block->evaluate(), -6.763076443208831, eps);
+                    parameters["pyhf::stat_unc[0]"] = 1.0;
+
+                    TEST_CHECK(block->depends_on(parameters["pyhf::mu"].id()));
+                    TEST_CHECK(! block->depends_on(parameters["mass::b(MSbar)"].id()));
+
+                    // single-bin counting experiment with an asymmetric normsys modifier
+                    static const char * workspace_b = R"(
+                    {
+                        "channels": [ { "name": "counting", "samples": [
+                            { "name": "signal", "data": [100.0], "modifiers": [
+                                { "name": "syst", "type": "normsys", "data": { "hi": 1.2, "lo": 0.9 } } ] } ] } ],
+                        "observations": [ { "name": "counting", "data": [105.0] } ]
+                    }
+                    )";
+
+                    const std::string file_b = write_workspace(workspace_b);
+
+                    auto block_b = LogLikelihoodBlock::HistFactory(cache, file_b);
+                    cache.update();
+
+                    // rate 100 at alpha = 0
+                    TEST_CHECK_NEARLY_EQUAL(block_b->evaluate(), -3.369679594467925, eps);
+
+                    // exponential pieces at and beyond the boundaries: rates 120 and 81
+                    parameters["pyhf::syst"] = +1.0;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block_b->evaluate(), -4.225916131102736, eps);
+                    parameters["pyhf::syst"] = -2.0;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block_b->evaluate(), -6.495387882611453, eps);
+
+                    // polynomial interpolation inside the boundaries
+                    parameters["pyhf::syst"] = +0.5;
+                    cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(block_b->evaluate(), -3.3270758028912155, eps);
+
+                    // a clone tracks its own parameters
+                    Parameters cloned_parameters = parameters.clone();
+                    ObservableCache cloned_cache(cloned_parameters);
+                    auto cloned = block_b->clone(cloned_cache);
+
+                    cloned_parameters["pyhf::syst"] = 0.0;
+                    cloned_cache.update();
+                    TEST_CHECK_NEARLY_EQUAL(cloned->evaluate(), -3.369679594467925, eps);
+                    TEST_CHECK_NEARLY_EQUAL(block_b->evaluate(), -3.3270758028912155, eps);
+
+                    std::remove(file_a.c_str());
+                    std::remove(file_b.c_str());
+                }
             }
     } log_likelihood_test;
 }
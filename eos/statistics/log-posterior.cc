@@ -21,14 +21,21 @@
 #include <config.h>
 
 #include <eos/statistics/log-posterior.hh>
+#include <eos/maths/derivative.hh>
 #include <eos/utils/density-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/result-store.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <gsl/gsl_cdf.h>
 
 #include <algorithm>
+#include <chrono>
+#include <limits>
+#include <set>
+#include <sstream>
 
 namespace eos
 {
@@ -48,6 +55,17 @@ namespace eos
     {
     }
 
+    LogPosterior::LogPosterior(const LogPosterior & other) :
+        _log_likelihood(other._log_likelihood),
+        _parameters(other._parameters),
+        _parameter_names(other._parameter_names),
+        _priors(other._priors),
+        _informative_priors(other._informative_priors),
+        _varied_parameters(other._varied_parameters),
+        _result_store_seed(other._result_store_seed)
+    {
+    }
+
     LogPosterior::~LogPosterior()
     {
     }
@@ -103,10 +121,417 @@ namespace eos
         return LogPosteriorPtr(result);
     }
 
+    std::uint64_t
+    LogPosterior::_compute_result_store_seed() const
+    {
+        std::uint64_t seed = ResultStore::initial_seed;
+
+        for (const auto & _prior : _priors)
+        {
+            const std::string s = _prior->as_string();
+            seed = ResultStore::hash(seed, s.data(), s.size());
+        }
+
+        for (const auto & _parameter : _varied_parameters)
+        {
+            const std::string & s = _parameter.name();
+            seed = ResultStore::hash(seed, s.data(), s.size());
+        }
+
+        // the values of the non-varied parameters are part of the analysis'
+        // structure: two runs that differ only in a fixed-parameter override
+        // must not share cached values. The varied parameters' values enter
+        // the key per evaluation point instead.
+        std::set<Parameter::Id> varied_ids;
+        for (const auto & _parameter : _varied_parameters)
+        {
+            varied_ids.insert(_parameter.id());
+        }
+
+        for (const auto & _parameter : _parameters)
+        {
+            if (varied_ids.find(_parameter.id()) != varied_ids.end())
+                continue;
+
+            const std::string & s = _parameter.name();
+            seed = ResultStore::hash(seed, s.data(), s.size());
+
+            const double value = _parameter.evaluate();
+            seed = ResultStore::hash(seed, &value, sizeof(value));
+        }
+
+        for (auto c = _log_likelihood.begin(), c_end = _log_likelihood.end() ; c != c_end ; ++c)
+        {
+            const std::string & s = c->name().full();
+            seed = ResultStore::hash(seed, s.data(), s.size());
+
+            // fingerprint the resolved constraint content, too: a later EOS
+            // version can implement different data under an unchanged name
+            for (auto o = c->begin_observables(), o_end = c->end_observables() ; o != o_end ; ++o)
+            {
+                const std::string os = (*o)->name().full() + (*o)->kinematics().as_string();
+                seed = ResultStore::hash(seed, os.data(), os.size());
+            }
+
+            for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+            {
+                const std::string bs = (*b)->as_string();
+                seed = ResultStore::hash(seed, bs.data(), bs.size());
+            }
+        }
+
+        // zero is reserved as the 'not yet computed' sentinel
+        if (0 == seed)
+            seed = ResultStore::initial_seed;
+
+        return seed;
+    }
+
     double
     LogPosterior::evaluate() const
     {
-        return log_posterior();
+        ResultStore * store = ResultStore::instance();
+        if (! store->active())
+            return log_posterior();
+
+        if (0 == _result_store_seed)
+        {
+            _result_store_seed = _compute_result_store_seed();
+        }
+
+        // key = hash of the analysis' structure, extended by the parameter point
+        std::vector<double> point;
+        point.reserve(_varied_parameters.size());
+        for (const auto & _parameter : _varied_parameters)
+        {
+            point.push_back(_parameter.evaluate());
+        }
+        const std::uint64_t key = ResultStore::hash(_result_store_seed, point.data(), point.size() * sizeof(double));
+
+        double result;
+        if (store->lookup(key, result))
+            return result;
+
+        result = log_posterior();
+        store->store(key, result);
+
+        return result;
+    }
+
+    const std::vector<LogPosteriorPtr> &
+    LogPosterior::_evaluation_contexts(const size_t & n) const
+    {
+        // a parameter change invalidates the clones' snapshots of the
+        // non-varied parameters
+        if (_worker_clones_generation != _parameters.generation())
+        {
+            _worker_clones.clear();
+        }
+
+        while (_worker_clones.size() < n)
+        {
+            _worker_clones.push_back(this->clone());
+        }
+
+        _worker_clones_generation = _parameters.generation();
+
+        return _worker_clones;
+    }
+
+    void
+    LogPosterior::evaluate(const double * points, const size_t & n_points, double * results) const
+    {
+        if (0 == n_points)
+            return;
+
+        const size_t n_dim = _varied_parameters.size();
+
+        // each worker evaluates a contiguous chunk of points on its own
+        // persistent clone, so that the Parameters updates of distinct points
+        // cannot interfere and repeated calls do not pay the cloning cost again
+        const size_t n_workers = std::min<size_t>(ThreadPool::instance()->number_of_threads(), n_points);
+        const size_t chunk_size = (n_points + n_workers - 1) / n_workers;
+
+        const auto & contexts = _evaluation_contexts(n_workers);
+
+        std::vector<Ticket> tickets;
+        tickets.reserve(n_workers);
+
+        for (size_t w = 0 ; w < n_workers ; ++w)
+        {
+            const size_t chunk_begin = w * chunk_size;
+            const size_t chunk_end   = std::min(n_points, chunk_begin + chunk_size);
+
+            if (chunk_begin >= chunk_end)
+                break;
+
+            LogPosteriorPtr posterior = contexts[w];
+
+            auto f = [=] ()
+            {
+                const auto & varied_parameters = posterior->varied_parameters();
+
+                for (size_t i = chunk_begin ; i != chunk_end ; ++i)
+                {
+                    const double * point = points + i * n_dim;
+
+                    for (size_t j = 0 ; j != n_dim ; ++j)
+                    {
+                        Parameter p = varied_parameters[j];
+                        p = point[j];
+                    }
+
+                    try
+                    {
+                        results[i] = posterior->log_posterior();
+                    }
+                    catch (Exception & e)
+                    {
+                        Log::instance()->message("LogPosterior::evaluate", ll_error)
+                            << "Exception encountered when evaluating parameter point " << i << ": " << e.what();
+                        results[i] = -std::numeric_limits<double>::infinity();
+                    }
+                }
+            };
+            tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+        }
+
+        for (auto & ticket : tickets)
+        {
+            ticket.wait();
+        }
+    }
+
+    void
+    LogPosterior::profile(const Parameter & parameter, const double * points, const size_t & n_points, double * results) const
+    {
+        // the likelihood re-evaluates only the observables and blocks that
+        // depend on the scanned parameter
+        _log_likelihood.profile(parameter, points, n_points, results);
+
+        // the priors are cheap in comparison, so they are simply re-evaluated
+        // in full at every scan point
+        Parameter p = parameter;
+        const double original_value = p.evaluate();
+
+        for (size_t i = 0 ; i < n_points ; ++i)
+        {
+            p = points[i];
+            results[i] += log_prior();
+        }
+
+        p = original_value;
+    }
+
+    void
+    LogPosterior::gradient(double * gradient) const
+    {
+        const size_t n_dim = _varied_parameters.size();
+
+        if (0 == n_dim)
+            return;
+
+        // prior contributions: analytic, and cheap enough to compute serially.
+        // the priors' varied parameters occupy consecutive entries of
+        // _varied_parameters, in the order in which the priors were added.
+        {
+            size_t offset = 0;
+
+            for (const auto & _prior : _priors)
+            {
+                _prior->gradient(gradient + offset);
+                offset += _prior->dimension();
+            }
+        }
+
+        // likelihood contributions: numeric, with the components dispatched
+        // across the ThreadPool. each worker differentiates a persistent clone,
+        // so that the temporary parameter shifts of distinct components cannot
+        // interfere.
+        std::vector<double> point(n_dim);
+        for (size_t j = 0 ; j != n_dim ; ++j)
+        {
+            point[j] = _varied_parameters[j].evaluate();
+        }
+
+        const size_t n_workers = std::min<size_t>(ThreadPool::instance()->number_of_threads(), n_dim);
+        const size_t chunk_size = (n_dim + n_workers - 1) / n_workers;
+
+        const auto & contexts = _evaluation_contexts(n_workers);
+
+        std::vector<Ticket> tickets;
+        tickets.reserve(n_workers);
+
+        for (size_t w = 0 ; w < n_workers ; ++w)
+        {
+            const size_t chunk_begin = w * chunk_size;
+            const size_t chunk_end   = std::min(n_dim, chunk_begin + chunk_size);
+
+            if (chunk_begin >= chunk_end)
+                break;
+
+            LogPosteriorPtr posterior = contexts[w];
+
+            auto f = [=, &point] ()
+            {
+                const auto & varied_parameters = posterior->varied_parameters();
+                LogLikelihood llh = posterior->log_likelihood();
+
+                for (size_t j = 0 ; j != n_dim ; ++j)
+                {
+                    Parameter p = varied_parameters[j];
+                    p = point[j];
+                }
+
+                for (size_t j = chunk_begin ; j != chunk_end ; ++j)
+                {
+                    Parameter p = varied_parameters[j];
+
+                    auto g = std::function<double (const double &)>([&] (const double & x) -> double
+                    {
+                        p = x;
+                        return llh();
+                    });
+
+                    try
+                    {
+                        gradient[j] += derivative<1u, deriv::TwoSided>(g, point[j]);
+                    }
+                    catch (Exception & e)
+                    {
+                        Log::instance()->message("LogPosterior::gradient", ll_error)
+                            << "Exception encountered when differentiating w.r.t. parameter " << p.name() << ": " << e.what();
+                        gradient[j] = std::numeric_limits<double>::quiet_NaN();
+                    }
+
+                    p = point[j];
+                }
+            };
+            tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+        }
+
+        for (auto & ticket : tickets)
+        {
+            ticket.wait();
+        }
+    }
+
+    void
+    LogPosterior::prepare(const unsigned & repetitions) const
+    {
+        ObservableCache cache = _log_likelihood.observable_cache();
+        cache.calibrate(repetitions);
+
+        // summarize the plan that the calibration has put in place
+        double total_cost = 0.0;
+        double max_cost = 0.0;
+        ObservableCache::Id max_id = 0;
+        for (ObservableCache::Id id = 0, id_end = cache.size() ; id != id_end ; ++id)
+        {
+            const double cost = cache.cost_estimate(id);
+            total_cost += cost;
+            if (cost > max_cost)
+            {
+                max_cost = cost;
+                max_id = id;
+            }
+        }
+
+        Log::instance()->message("LogPosterior::prepare", ll_informational)
+            << "calibrated " << cache.size() << " unique observables (deduplication rate "
+            << cache.deduplication_rate() << "); estimated cost per update: " << total_cost
+            << " s, dominated by '" << ((cache.size() > 0) ? cache.observable(max_id)->name().full() : "")
+            << "' at " << max_cost << " s";
+    }
+
+    std::string
+    LogPosterior::timing_profile(const unsigned & repetitions) const
+    {
+        using clock = std::chrono::steady_clock;
+
+        const unsigned n = std::max(1u, repetitions);
+
+        // one untimed evaluation warms the observable cache, so that the
+        // per-block timings below measure the likelihood arithmetic only
+        _log_likelihood();
+
+        // frames are separated by semicolons and lines end at the first
+        // space, so neither may appear within a frame
+        auto frame = [] (const std::string & name) -> std::string
+        {
+            std::string result(name);
+            std::replace(result.begin(), result.end(), ';', ',');
+            std::replace(result.begin(), result.end(), ' ', '_');
+
+            return result;
+        };
+
+        auto average_ns = [n] (const clock::time_point & start, const clock::time_point & stop) -> long
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / n;
+        };
+
+        std::ostringstream out;
+
+        // prior frames, one per prior, labelled by its varied parameters
+        for (const auto & _prior : _priors)
+        {
+            std::string label;
+            for (auto p = _prior->begin(), p_end = _prior->end() ; p != p_end ; ++p)
+            {
+                if (! label.empty())
+                {
+                    label += ',';
+                }
+                label += p->name();
+            }
+
+            const auto start = clock::now();
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                (*_prior)();
+            }
+            const auto stop = clock::now();
+
+            out << "posterior;priors;" << frame(label) << ' ' << average_ns(start, stop) << '\n';
+        }
+
+        // likelihood frames: constraint -> decay process (the observable
+        // name's prefix) -> observable
+        for (auto c = _log_likelihood.begin(), c_end = _log_likelihood.end() ; c != c_end ; ++c)
+        {
+            const std::string constraint = frame(c->name().full());
+
+            for (auto o = c->begin_observables(), o_end = c->end_observables() ; o != o_end ; ++o)
+            {
+                const auto start = clock::now();
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    (*o)->evaluate();
+                }
+                const auto stop = clock::now();
+
+                out << "posterior;likelihood;" << constraint << ';'
+                    << frame((*o)->name().prefix_part().str()) << ';'
+                    << frame((*o)->name().full()) << ' ' << average_ns(start, stop) << '\n';
+            }
+
+            // the blocks combine the cached predictions into the constraint's
+            // contribution to the log-likelihood
+            const auto start = clock::now();
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+                {
+                    (*b)->evaluate();
+                }
+            }
+            const auto stop = clock::now();
+
+            out << "posterior;likelihood;" << constraint << ";blocks " << average_ns(start, stop) << '\n';
+        }
+
+        return out.str();
     }
 
     Parameters
@@ -31,7 +31,9 @@
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstdint>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace eos
@@ -55,6 +57,31 @@ namespace eos
             /// Parameters with priors
             std::vector<Parameter> _varied_parameters;
 
+            /// seed of the result-store key: a hash of the analysis' structure.
+            /// computed lazily on the first evaluation; zero while unset.
+            mutable std::uint64_t _result_store_seed = 0;
+
+            /// Hash the priors, varied parameter names, fixed parameter values,
+            /// and likelihood constraints (names and content) into the seed of
+            /// the result-store key.
+            std::uint64_t _compute_result_store_seed() const;
+
+            /// per-thread evaluation contexts: persistent clones of this posterior,
+            /// reused across batched evaluations and gradient computations
+            mutable std::vector<LogPosteriorPtr> _worker_clones;
+
+            /// generation of _parameters at which the worker clones were built
+            mutable std::uint64_t _worker_clones_generation = 0;
+
+            /*!
+             * Return at least n persistent worker clones of this posterior.
+             *
+             * The clones are built lazily and rebuilt whenever a parameter
+             * changed since the previous use; rebuilding is never more
+             * expensive than the per-call cloning it replaces.
+             */
+            const std::vector<LogPosteriorPtr> & _evaluation_contexts(const size_t & n) const;
+
         public:
             friend struct Implementation<LogPosterior>;
 
@@ -72,14 +99,104 @@ namespace eos
              */
             LogPosterior(const LogLikelihood & log_likelihood);
 
+            /// Copy-constructor. The copy shares the likelihood and parameters,
+            /// but starts with its own (empty) pool of worker clones.
+            LogPosterior(const LogPosterior & other);
+
             /// Destructor.
             virtual ~LogPosterior();
 
             /// Clone this LogPosterior
             LogPosteriorPtr clone() const;
 
-            /// Evaluate the Log(posterior) density at the current parameter values.
+            /*!
+             * Evaluate the Log(posterior) density at the current parameter values.
+             *
+             * When the ResultStore is active, the value is first looked up under
+             * a key derived from the analysis' structure and the parameter point;
+             * only a miss triggers the actual computation, whose result is then
+             * published to the store.
+             */
             virtual double evaluate() const;
+
+            /*!
+             * Evaluate the Log(posterior) density at several parameter points at once.
+             *
+             * The points are stored contiguously: point i occupies the entries
+             * points[i * n] ... points[i * n + n - 1], where n is the number of varied
+             * parameters, in the order of varied_parameters(). Independent points are
+             * dispatched across the ThreadPool, with each worker evaluating a clone of
+             * this posterior. A point whose evaluation raises an exception yields
+             * -inf, and the exception is logged.
+             *
+             * @param points   Pointer to the first entry of n_points contiguous parameter points.
+             * @param n_points Number of parameter points to evaluate.
+             * @param results  Pointer to an array of n_points entries to which the Log(posterior) values are written.
+             */
+            void evaluate(const double * points, const size_t & n_points, double * results) const;
+
+            /*!
+             * Evaluate the gradient of the Log(posterior) at the current parameter values.
+             *
+             * The prior contributions are computed analytically via LogPrior::gradient().
+             * The likelihood contributions are computed by two-sided numerical
+             * differentiation, with the components dispatched across the ThreadPool;
+             * each worker differentiates a clone of this posterior, so the bound
+             * parameters are left untouched. A component whose evaluation raises an
+             * exception yields NaN, and the exception is logged.
+             *
+             * @param gradient Pointer to an array with one entry per varied parameter,
+             *                 in the order of varied_parameters().
+             */
+            void gradient(double * gradient) const;
+
+            /*!
+             * Evaluate the Log(posterior) along a one-parameter profile.
+             *
+             * The scanned parameter is declared up front and forwarded to
+             * LogLikelihood::profile(): every observable independent of it is
+             * computed once at the current parameter point, and per scan point
+             * only the dependent observables and likelihood blocks are
+             * re-evaluated. All other parameters must remain fixed throughout
+             * the scan. On return, the scanned parameter and the dependent
+             * predictions are restored to their original values.
+             *
+             * @param parameter The parameter that is scanned; must belong to this posterior's Parameters object.
+             * @param points    Pointer to the first of n_points values of the scanned parameter.
+             * @param n_points  Number of scan points to evaluate.
+             * @param results   Pointer to an array of n_points entries to which the Log(posterior) values are written.
+             */
+            void profile(const Parameter & parameter, const double * points, const size_t & n_points, double * results) const;
+
+            /*!
+             * Prepare this posterior for a long-running fit.
+             *
+             * Walks the likelihood's observable cache and calibrates the
+             * per-observable cost estimates from timed evaluations at the
+             * current parameter point. The estimates constitute the plan that
+             * every subsequent update reuses when ordering and partitioning
+             * its work across threads and MPI ranks; without preparation, the
+             * plan only converges over the first few evaluations of a fit.
+             * A summary of the plan is logged.
+             *
+             * @param repetitions Number of timed calibration evaluations per observable.
+             */
+            void prepare(const unsigned & repetitions = 3) const;
+
+            /*!
+             * Record a hierarchical timing profile of one posterior evaluation.
+             *
+             * Each prior, each observable of each constraint, and each
+             * constraint's likelihood blocks are timed individually. The
+             * result is returned in collapsed-stack format -- one line of
+             * semicolon-separated frames followed by the average evaluation
+             * time in nanoseconds -- which flamegraph tooling consumes
+             * directly. The frames below an observable follow its qualified
+             * name, so the decay process appears as its own level.
+             *
+             * @param repetitions Number of timed evaluations over which each entry is averaged.
+             */
+            std::string timing_profile(const unsigned & repetitions = 1) const;
             ///@}
 
             ///@name Accessors
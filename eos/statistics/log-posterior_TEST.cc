@@ -22,6 +22,9 @@
 
 #include <eos/statistics/log-posterior_TEST.hh>
 
+#include <sstream>
+#include <string>
+
 using namespace test;
 using namespace eos;
 
@@ -130,5 +133,229 @@ class LogPosteriorTest :
 
                 TEST_CHECK_THROWS(InternalError, log_posterior.log_prior());
             }
+
+            // preparation calibrates the cache's cost estimates without
+            // changing the posterior's value
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+
+                const double before = log_posterior.log_posterior();
+
+                log_posterior.prepare(2);
+
+                ObservableCache cache = log_posterior.log_likelihood().observable_cache();
+                for (ObservableCache::Id id = 0 ; id < cache.size() ; ++id)
+                {
+                    TEST_CHECK(cache.evaluation_count(id) >= 2);
+                    TEST_CHECK(cache.cost_estimate(id) >= 0.0);
+                }
+
+                TEST_CHECK_EQUAL(log_posterior.log_posterior(), before);
+            }
+
+            // the timing profile lists every prior and every constraint in
+            // collapsed-stack format: frames, a space, and a non-negative count
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+
+                const std::string profile = log_posterior.timing_profile(2);
+                TEST_CHECK(! profile.empty());
+
+                std::istringstream lines(profile);
+                std::string line;
+                unsigned n_priors = 0, n_likelihood = 0;
+                while (std::getline(lines, line))
+                {
+                    const auto space = line.rfind(' ');
+                    TEST_CHECK(std::string::npos != space);
+                    TEST_CHECK(std::stol(line.substr(space + 1)) >= 0);
+
+                    if (0 == line.compare(0, 17, "posterior;priors;"))
+                    {
+                        ++n_priors;
+                    }
+                    else if (0 == line.compare(0, 21, "posterior;likelihood;"))
+                    {
+                        ++n_likelihood;
+                    }
+                }
+
+                TEST_CHECK_EQUAL(n_priors, 1u);
+                TEST_CHECK(n_likelihood >= 2u); // at least one observable and one blocks frame
+            }
         }
 } log_posterior_test;
+
+class LogPosteriorBatchEvaluateTest :
+    public TestCase
+{
+    public:
+        LogPosteriorBatchEvaluateTest() :
+            TestCase("log_posterior_batch_evaluate_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-13;
+
+            LogPosterior log_posterior = make_log_posterior(false);
+
+            // evaluate a batch of points and compare against point-by-point evaluation
+            {
+                static const size_t n_points = 7;
+                const double points[n_points] = { 4.10, 4.15, 4.20, 4.25, 4.30, 4.35, 4.40 };
+
+                double batch_results[n_points];
+                log_posterior.evaluate(points, n_points, batch_results);
+
+                Parameter p = log_posterior[0];
+                for (size_t i = 0 ; i < n_points ; ++i)
+                {
+                    p.set(points[i]);
+                    TEST_CHECK_RELATIVE_ERROR(batch_results[i], log_posterior.log_posterior(), eps);
+                }
+            }
+
+            // an empty batch is a no-op
+            {
+                log_posterior.evaluate(nullptr, 0, nullptr);
+            }
+
+            // a second batch reuses the persistent worker clones; a parameter
+            // change in between must not leak stale values into the results
+            {
+                static const size_t n_points = 5;
+                const double points[n_points] = { 4.12, 4.18, 4.24, 4.31, 4.38 };
+
+                Parameter p = log_posterior[0];
+                p.set(4.27);
+
+                double batch_results[n_points];
+                log_posterior.evaluate(points, n_points, batch_results);
+
+                for (size_t i = 0 ; i < n_points ; ++i)
+                {
+                    p.set(points[i]);
+                    TEST_CHECK_RELATIVE_ERROR(batch_results[i], log_posterior.log_posterior(), eps);
+                }
+            }
+        }
+} log_posterior_batch_evaluate_test;
+
+class LogPosteriorProfileTest :
+    public TestCase
+{
+    public:
+        LogPosteriorProfileTest() :
+            TestCase("log_posterior_profile_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-13;
+
+            // posterior over two parameters: the scanned one and an independent spectator
+            Parameters parameters = Parameters::Defaults();
+
+            LogLikelihood llh(parameters);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.16, 1.27, 1.38);
+
+            LogPosterior log_posterior(llh);
+            log_posterior.add(LogPrior::CurtailedGauss(parameters, "mass::b(MSbar)", 3.7, 4.9, 4.3, 4.4, 4.5));
+            log_posterior.add(LogPrior::Flat(parameters, "mass::c", 1.0, 2.0));
+
+            static const size_t n_points = 7;
+            static const double points[n_points] = { 4.10, 4.15, 4.20, 4.25, 4.30, 4.35, 4.40 };
+
+            Parameter p = parameters["mass::b(MSbar)"];
+
+            // reference values from full point-by-point evaluation
+            double reference[n_points];
+            for (size_t i = 0 ; i < n_points ; ++i)
+            {
+                p.set(points[i]);
+                reference[i] = log_posterior.log_posterior();
+            }
+
+            p.set(4.2);
+            const double at_start = log_posterior.log_posterior();
+
+            // locate the spectator's observable in the cache
+            auto cache = log_posterior.log_likelihood().observable_cache();
+            ObservableCache::Id id_c = cache.size();
+            for (ObservableCache::Id id = 0 ; id < cache.size() ; ++id)
+            {
+                if (cache.observable(id)->name() == QualifiedName("mass::c"))
+                    id_c = id;
+            }
+            TEST_CHECK(id_c < cache.size());
+            const unsigned long count_before = cache.evaluation_count(id_c);
+
+            // the profile agrees with the point-by-point evaluation
+            double results[n_points];
+            log_posterior.profile(p, points, n_points, results);
+            for (size_t i = 0 ; i < n_points ; ++i)
+            {
+                TEST_CHECK_RELATIVE_ERROR(results[i], reference[i], eps);
+            }
+
+            // the spectator's observable was evaluated at most once, for the
+            // initial full update; never per scan point
+            TEST_CHECK(cache.evaluation_count(id_c) <= count_before + 1);
+
+            // the scanned parameter and the posterior are restored afterwards
+            TEST_CHECK_EQUAL(p.evaluate(), 4.2);
+            TEST_CHECK_RELATIVE_ERROR(log_posterior.log_posterior(), at_start, eps);
+        }
+} log_posterior_profile_test;
+
+class LogPosteriorGradientTest :
+    public TestCase
+{
+    public:
+        LogPosteriorGradientTest() :
+            TestCase("log_posterior_gradient_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            LogPosterior log_posterior = make_log_posterior(false);
+
+            Parameter p = log_posterior[0];
+
+            // compare against a central finite difference of the full posterior
+            {
+                static const double h = 1e-5;
+
+                for (const double x : { 4.10, 4.25, 4.30, 4.35, 4.55 })
+                {
+                    p.set(x);
+
+                    double gradient[1];
+                    log_posterior.gradient(gradient);
+
+                    p.set(x + h);
+                    const double upper = log_posterior.log_posterior();
+                    p.set(x - h);
+                    const double lower = log_posterior.log_posterior();
+                    p.set(x);
+
+                    TEST_CHECK_RELATIVE_ERROR(gradient[0], (upper - lower) / (2.0 * h), 1e-5);
+                }
+            }
+
+            // the parameter values are left untouched
+            {
+                p.set(4.3);
+
+                double gradient[1];
+                log_posterior.gradient(gradient);
+
+                TEST_CHECK_EQUAL(p.evaluate(), 4.3);
+            }
+        }
+} log_posterior_gradient_test;
@@ -19,6 +19,7 @@
  */
 
 #include <eos/statistics/log-prior.hh>
+#include <eos/maths/derivative.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/log.hh>
 #include <eos/maths/power-of.hh>
@@ -136,11 +137,25 @@ namespace eos
                     _parameter.set(_parameter.evaluate_generator() * (_max - _min) + _min);
                 }
 
+                virtual void inverse_cdf(const double * u, double * out, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        out[i] = u[i] * (_max - _min) + _min;
+                    }
+                }
+
                 virtual void compute_cdf()
                 {
                     _parameter.set_generator((_parameter.evaluate() - _min) / (_max - _min));
                 }
 
+                virtual void gradient(double * out)
+                {
+                    // the density is constant on the support
+                    out[0] = 0.0;
+                }
+
                 virtual bool informative() const
                 {
                     return false;
@@ -266,6 +281,18 @@ namespace eos
                        _parameter.set(gsl_cdf_gaussian_Pinv((p - _prob_lower) / _c_a + 0.5,  _sigma_upper) + _central);
                 }
 
+                virtual void inverse_cdf(const double * u, double * out, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        const double p = u[i];
+
+                        out[i] = (p < _prob_lower)
+                            ? gsl_cdf_gaussian_Pinv((p - _prob_lower) / _c_b + 0.5, _sigma_lower) + _central
+                            : gsl_cdf_gaussian_Pinv((p - _prob_lower) / _c_a + 0.5, _sigma_upper) + _central;
+                    }
+                }
+
                 virtual void compute_cdf()
                 {
                     // CDF = c \Phi(x - x_{central} / \sigma) + b
@@ -279,6 +306,14 @@ namespace eos
                         _parameter.set_generator(_c_a * gsl_cdf_gaussian_P((x - _central) / _sigma_upper, 1.0) + _prob_lower);
                 }
 
+                virtual void gradient(double * out)
+                {
+                    const double x     = _parameter.evaluate();
+                    const double sigma = (x < _central) ? _sigma_lower : _sigma_upper;
+
+                    out[0] = (_central - x) / power_of<2>(sigma);
+                }
+
                 virtual bool informative() const
                 {
                     return true;
@@ -352,6 +387,14 @@ namespace eos
                     _parameter.set(_mu_0 * std::pow(_lambda, 2.0 * _parameter.evaluate_generator() - 1.0));
                 }
 
+                virtual void inverse_cdf(const double * u, double * out, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        out[i] = _mu_0 * std::pow(_lambda, 2.0 * u[i] - 1.0);
+                    }
+                }
+
                 virtual void compute_cdf()
                 {
                     // CDF: p = [\ln x - \ln \mu_0 + \ln \lambda] / (2.0 \ln \lambda)
@@ -360,6 +403,20 @@ namespace eos
                     _parameter.set_generator((std::log(_parameter.evaluate() / _mu_0) + _ln_lambda) / (2.0 * _ln_lambda));
                 }
 
+                virtual void gradient(double * out)
+                {
+                    const double x = _parameter.evaluate();
+
+                    if ((x < _min) || (_max < x))
+                    {
+                        out[0] = 0.0;
+                        return;
+                    }
+
+                    // derivative of the density as returned by operator()
+                    out[0] = -1.0 / (2.0 * _ln_lambda * x * x);
+                }
+
                 virtual bool informative() const
                 {
                     return true;
@@ -392,6 +449,7 @@ namespace eos
                     _sigma(sigma),
                     _ln_norm(-0.5 * std::log(2 * M_PI) - std::log(sigma))
                 {
+                    _varied_parameters.push_back(_parameter);
                 }
 
                 ~Gaussian() = default;
@@ -421,6 +479,14 @@ namespace eos
                     _parameter.set(x);
                 }
 
+                virtual void inverse_cdf(const double * u, double * out, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        out[i] = gsl_cdf_gaussian_Pinv(u[i], _sigma) + _mu;
+                    }
+                }
+
                 virtual void compute_cdf()
                 {
                     const double x = _parameter.evaluate();
@@ -428,6 +494,11 @@ namespace eos
                     _parameter.set_generator(u);
                 }
 
+                virtual void gradient(double * out)
+                {
+                    out[0] = (_mu - _parameter.evaluate()) / power_of<2>(_sigma);
+                }
+
                 virtual bool informative() const
                 {
                     return true;
@@ -681,6 +752,29 @@ namespace eos
                     }
                 }
 
+                virtual void gradient(double * out)
+                {
+                    // read parameters
+                    for (auto i = 0u ; i < _dim ; ++i)
+                    {
+                        gsl_vector_set(_observables, i, _parameters[i].evaluate());
+                    }
+
+                    // center the gaussian:
+                    //   measurements <- mean - observables
+                    gsl_vector_memcpy(_measurements, _mean);
+                    gsl_blas_daxpy(-1.0, _observables, _measurements);
+
+                    // gradient of the log density:
+                    //   measurements_2 <- inv(covariance) * (mean - observables)
+                    gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements, 0.0, _measurements_2);
+
+                    for (auto i = 0u ; i < _dim ; ++i)
+                    {
+                        out[i] = gsl_vector_get(_measurements_2, i);
+                    }
+                }
+
                 virtual bool informative() const
                 {
                     return true;
@@ -749,6 +843,13 @@ namespace eos
                     _parameter.set_generator(u);
                 }
 
+                virtual void gradient(double * out)
+                {
+                    const double x = _parameter.evaluate();
+
+                    out[0] = _k * (1.0 / x - 1.0);
+                }
+
                 virtual bool informative() const
                 {
                     return true;
@@ -990,6 +1091,54 @@ namespace eos
         return LogPrior::Iterator(_varied_parameters.end());
     }
 
+    void
+    LogPrior::inverse_cdf(const double * u, double * out, const std::size_t & n)
+    {
+        const std::size_t d = _varied_parameters.size();
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            for (std::size_t j = 0 ; j < d ; ++j)
+            {
+                _varied_parameters[j].set_generator(u[i * d + j]);
+            }
+
+            this->sample();
+
+            for (std::size_t j = 0 ; j < d ; ++j)
+            {
+                out[i * d + j] = _varied_parameters[j].evaluate();
+            }
+        }
+    }
+
+    void
+    LogPrior::gradient(double * out)
+    {
+        const std::size_t d = _varied_parameters.size();
+
+        for (std::size_t j = 0 ; j < d ; ++j)
+        {
+            Parameter p = _varied_parameters[j];
+            const double x0 = p.evaluate();
+
+            auto f = std::function<double (const double &)>([&] (const double & x) -> double
+            {
+                p.set(x);
+                return (*this)();
+            });
+
+            out[j] = derivative<1u, deriv::TwoSided>(f, x0);
+            p.set(x0);
+        }
+    }
+
+    unsigned
+    LogPrior::dimension() const
+    {
+        return _varied_parameters.size();
+    }
+
     LogPriorPtr
     LogPrior::Flat(const Parameters & parameters, const std::string & name, const double & min, const double & max)
     {
@@ -25,6 +25,7 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstddef>
 #include <vector>
 #include <memory>
 
@@ -108,6 +109,37 @@ namespace eos
              */
             virtual void compute_cdf() = 0;
 
+            /*!
+             * Apply the inverse CDF to a whole batch of uniform variates.
+             *
+             * Both u and out are row-major matrices of shape n x dimension().
+             * The generic implementation falls back on sample(), so the bound
+             * parameters may be modified as a side effect and their values
+             * after the call are unspecified; the common 1D priors override
+             * it with a direct, vectorizable transform.
+             *
+             * @param u   The uniform variates in [0, 1).
+             * @param out The prior samples.
+             * @param n   The number of samples, i.e. of rows.
+             */
+            virtual void inverse_cdf(const double * u, double * out, const std::size_t & n);
+
+            /*!
+             * Compute the gradient of the log(prior) w.r.t. the varied parameters.
+             *
+             * The derivatives are evaluated at the current parameter values and
+             * written to out[0] ... out[dimension() - 1], in the order of the
+             * varied parameters. The generic implementation differentiates
+             * numerically, temporarily modifying the bound parameters; most
+             * priors override it with the analytic derivative.
+             *
+             * @param out The gradient components.
+             */
+            virtual void gradient(double * out);
+
+            /// Retrieve the number of varied parameters covered by this prior.
+            unsigned dimension() const;
+
             /*!
              * Return whether or not this prior is informative.
              */
@@ -0,0 +1,856 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/utils/evaluation-precision.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace fs = boost::filesystem;
+
+namespace eos
+{
+    template <>
+    struct Implementation<MarkovChainSampler>
+    {
+        LogPosteriorPtr log_posterior;
+
+        MarkovChainSampler::Config config;
+
+        // number of varied parameters
+        unsigned dimension;
+
+        gsl_rng * rng;
+
+        // Cholesky factor of the proposal covariance
+        gsl_matrix * proposal_chol;
+
+        // overall scale factor of the proposal covariance, tuned between preruns
+        double proposal_scale;
+
+        // current point of the chain, in u space
+        std::vector<double> current_point;
+        double current_log_posterior;
+
+        // coarse-precision clone of the posterior used to screen proposals,
+        // and the screen's value at the current point
+        LogPosteriorPtr screen_posterior;
+        double current_screen_log_posterior;
+
+        // proposals rejected by the screen alone, without a full evaluation
+        unsigned long screen_proposals;
+        unsigned long screen_rejections;
+
+        // results of the main run
+        std::vector<double> samples;
+        std::vector<double> usamples;
+        std::vector<double> weights;
+        double acceptance_rate;
+
+        // progress of the run, serialized into checkpoint records
+        unsigned preruns_done;
+        unsigned long main_steps_done;
+        unsigned long main_accepted;
+
+        // number of recorded samples already covered by checkpoint records
+        unsigned long samples_checkpointed;
+
+        static constexpr uint32_t checkpoint_version = 1;
+
+        static constexpr uint32_t proposal_version = 1;
+
+        Implementation(const LogPosteriorPtr & log_posterior, const MarkovChainSampler::Config & config) :
+            log_posterior(log_posterior),
+            config(config),
+            dimension(log_posterior->varied_parameters().size()),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            proposal_chol(gsl_matrix_calloc(dimension, dimension)),
+            proposal_scale(1.0),
+            current_point(dimension, 0.0),
+            current_log_posterior(-std::numeric_limits<double>::infinity()),
+            current_screen_log_posterior(-std::numeric_limits<double>::infinity()),
+            screen_proposals(0),
+            screen_rejections(0),
+            acceptance_rate(0.0),
+            preruns_done(0),
+            main_steps_done(0),
+            main_accepted(0),
+            samples_checkpointed(0)
+        {
+            gsl_rng_set(rng, config.seed);
+
+            // assume each parameter's u-space value to be uniformly distributed on [0, 1),
+            // whose variance is 1 / 12
+            const double sigma = std::sqrt(config.cov_scale / 12.0);
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                gsl_matrix_set(proposal_chol, i, i, sigma);
+            }
+
+            // clone the posterior at coarse precision to obtain the cheap
+            // screening surrogate; the clone re-constructs the observables,
+            // which consult the active precision tier
+            if (config.screen)
+            {
+                const EvaluationPrecision::Tier tier = EvaluationPrecision::instance()->tier();
+                EvaluationPrecision::instance()->set_tier(EvaluationPrecision::Tier::coarse);
+                screen_posterior = log_posterior->clone();
+                EvaluationPrecision::instance()->set_tier(tier);
+            }
+
+            // use the configured starting point, or draw one uniformly from the unit hypercube
+            if (config.start_point.size() == dimension)
+            {
+                current_point = config.start_point;
+            }
+            else
+            {
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    current_point[i] = gsl_rng_uniform(rng);
+                }
+            }
+            current_log_posterior = evaluate(log_posterior, current_point);
+            if (screen_posterior)
+            {
+                current_screen_log_posterior = evaluate(screen_posterior, current_point);
+            }
+        }
+
+        ~Implementation()
+        {
+            gsl_matrix_free(proposal_chol);
+            gsl_rng_free(rng);
+        }
+
+        // Map a u-space point to the given posterior's parameter space through
+        // the priors' inverse CDFs.
+        void apply(const LogPosteriorPtr & posterior, const std::vector<double> & u)
+        {
+            const auto & varied_parameters = posterior->varied_parameters();
+
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                Parameter p = varied_parameters[i];
+                p.set_generator(u[i]);
+            }
+
+            for (auto prior = posterior->begin_priors(), prior_end = posterior->end_priors() ; prior != prior_end ; ++prior)
+            {
+                (*prior)->sample();
+            }
+        }
+
+        // Evaluate a log(posterior) at a u-space point; -inf outside the unit hypercube.
+        double evaluate(const LogPosteriorPtr & posterior, const std::vector<double> & u)
+        {
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                if ((u[i] < 0.0) || (u[i] >= 1.0))
+                    return -std::numeric_limits<double>::infinity();
+            }
+
+            apply(posterior, u);
+
+            try
+            {
+                return posterior->log_posterior();
+            }
+            catch (Exception & e)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_error)
+                    << "Exception encountered when evaluating log(posterior): " << e.what();
+
+                return -std::numeric_limits<double>::infinity();
+            }
+        }
+
+        // Advance the chain by one step; returns true if the proposal was accepted.
+        bool step()
+        {
+            std::vector<double> proposal(dimension, 0.0);
+
+            // proposal = current + scale * L z, with z a vector of independent standard normal variates
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                proposal[i] = gsl_ran_ugaussian(rng);
+            }
+
+            for (unsigned i = dimension ; i > 0 ; --i)
+            {
+                double sum = 0.0;
+                for (unsigned j = 0 ; j < i ; ++j)
+                {
+                    sum += gsl_matrix_get(proposal_chol, i - 1, j) * proposal[j];
+                }
+                proposal[i - 1] = current_point[i - 1] + proposal_scale * sum;
+            }
+
+            // first stage of the delayed acceptance: accept or reject on the
+            // coarse screening posterior alone, without a full evaluation
+            double proposal_screen_log_posterior = 0.0;
+            if (screen_posterior)
+            {
+                ++screen_proposals;
+                proposal_screen_log_posterior = evaluate(screen_posterior, proposal);
+
+                if (! ((proposal_screen_log_posterior >= current_screen_log_posterior)
+                        || (std::log(gsl_rng_uniform(rng)) < proposal_screen_log_posterior - current_screen_log_posterior)))
+                {
+                    ++screen_rejections;
+
+                    return false;
+                }
+            }
+
+            // evaluate the proposal inside a transaction: on rejection, the rollback
+            // restores the current point without rewriting every varied parameter
+            Parameters parameters = log_posterior->parameters();
+            parameters.begin_transaction();
+
+            const double proposal_log_posterior = evaluate(log_posterior, proposal);
+
+            // Metropolis acceptance for a symmetric proposal density; under
+            // screening, the first-stage factor is divided out again, so the
+            // chain targets the full posterior regardless of the screen's bias
+            double log_alpha = proposal_log_posterior - current_log_posterior;
+            if (screen_posterior
+                    && std::isfinite(proposal_screen_log_posterior)
+                    && std::isfinite(current_screen_log_posterior))
+            {
+                log_alpha -= proposal_screen_log_posterior - current_screen_log_posterior;
+            }
+
+            if ((log_alpha >= 0.0) || (std::log(gsl_rng_uniform(rng)) < log_alpha))
+            {
+                parameters.commit_transaction();
+                current_point = proposal;
+                current_log_posterior = proposal_log_posterior;
+                if (screen_posterior)
+                {
+                    current_screen_log_posterior = proposal_screen_log_posterior;
+                }
+
+                return true;
+            }
+
+            parameters.rollback_transaction();
+
+            return false;
+        }
+
+        // Re-estimate the proposal covariance from the samples of the last prerun, and
+        // tune the overall scale towards the optimal random-walk acceptance rate.
+        void adapt(const std::vector<double> & prerun_samples, const double & prerun_acceptance_rate)
+        {
+            const unsigned n = prerun_samples.size() / dimension;
+
+            if (n > 1)
+            {
+                std::vector<double> mean(dimension, 0.0);
+                for (unsigned s = 0 ; s < n ; ++s)
+                {
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        mean[i] += prerun_samples[s * dimension + i];
+                    }
+                }
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    mean[i] /= n;
+                }
+
+                gsl_matrix * covariance = gsl_matrix_calloc(dimension, dimension);
+                for (unsigned s = 0 ; s < n ; ++s)
+                {
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        const double di = prerun_samples[s * dimension + i] - mean[i];
+                        for (unsigned j = 0 ; j <= i ; ++j)
+                        {
+                            const double dj = prerun_samples[s * dimension + j] - mean[j];
+                            gsl_matrix_set(covariance, i, j, gsl_matrix_get(covariance, i, j) + di * dj / (n - 1.0));
+                        }
+                    }
+                }
+
+                // scale towards the asymptotically optimal covariance 2.38^2 / d Sigma,
+                // and regularize to keep the covariance positive definite
+                const double scale = 2.38 * 2.38 / dimension;
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    for (unsigned j = 0 ; j < i ; ++j)
+                    {
+                        const double v = scale * gsl_matrix_get(covariance, i, j);
+                        gsl_matrix_set(covariance, i, j, v);
+                        gsl_matrix_set(covariance, j, i, v);
+                    }
+                    gsl_matrix_set(covariance, i, i, scale * gsl_matrix_get(covariance, i, i) + 1.0e-8);
+                }
+
+                if (GSL_SUCCESS == gsl_linalg_cholesky_decomp1(covariance))
+                {
+                    gsl_matrix_memcpy(proposal_chol, covariance);
+
+                    // zero out the upper triangle left over by GSL
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        for (unsigned j = i + 1 ; j < dimension ; ++j)
+                        {
+                            gsl_matrix_set(proposal_chol, i, j, 0.0);
+                        }
+                    }
+                }
+
+                gsl_matrix_free(covariance);
+            }
+
+            // aim for an acceptance rate within [0.15, 0.35]
+            if (prerun_acceptance_rate < 0.15)
+            {
+                proposal_scale /= 1.5;
+            }
+            else if (prerun_acceptance_rate > 0.35)
+            {
+                proposal_scale *= 1.5;
+            }
+        }
+
+        template <typename T_>
+        static void write_pod(std::ofstream & file, const T_ & value)
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(T_));
+        }
+
+        template <typename T_>
+        static bool read_pod(std::ifstream & file, T_ & value)
+        {
+            file.read(reinterpret_cast<char *>(&value), sizeof(T_));
+
+            return bool(file);
+        }
+
+        // FNV-1a hash over the analysis' layout and the initial proposal guess;
+        // deliberately independent of the seed and the run lengths, so that any
+        // run of the same analysis can reuse a persisted proposal state
+        uint64_t proposal_hash() const
+        {
+            uint64_t hash = 14695981039346656037ul;
+            auto mix = [&hash] (const void * data, const size_t & size)
+            {
+                const unsigned char * bytes = static_cast<const unsigned char *>(data);
+                for (size_t i = 0 ; i < size ; ++i)
+                {
+                    hash = (hash ^ bytes[i]) * 1099511628211ul;
+                }
+            };
+
+            mix(&dimension, sizeof(dimension));
+            for (const auto & parameter : log_posterior->varied_parameters())
+            {
+                const std::string & name = parameter.name();
+                mix(name.data(), name.size());
+            }
+            mix(&config.cov_scale, sizeof(config.cov_scale));
+
+            return hash;
+        }
+
+        // FNV-1a hash over the analysis' layout and the run's configuration; guards a
+        // checkpoint against being restored into a different analysis or run
+        uint64_t analysis_hash() const
+        {
+            uint64_t hash = proposal_hash();
+            auto mix = [&hash] (const void * data, const size_t & size)
+            {
+                const unsigned char * bytes = static_cast<const unsigned char *>(data);
+                for (size_t i = 0 ; i < size ; ++i)
+                {
+                    hash = (hash ^ bytes[i]) * 1099511628211ul;
+                }
+            };
+
+            mix(&config.seed, sizeof(config.seed));
+            mix(&config.preruns, sizeof(config.preruns));
+            mix(&config.pre_n, sizeof(config.pre_n));
+            mix(&config.n, sizeof(config.n));
+            mix(&config.stride, sizeof(config.stride));
+
+            return hash;
+        }
+
+        // Persist the adapted proposal -- the tuned scale and the covariance's
+        // Cholesky factor -- for reuse by later runs of the same analysis; the
+        // file is replaced atomically, so concurrent chains cannot corrupt it.
+        void save_proposal() const
+        {
+            const std::string tmp = config.proposal_file + ".tmp";
+            std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+            if (! file)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "cannot write to proposal file '" << config.proposal_file << "'";
+
+                return;
+            }
+
+            file.write("EOSMCSAS", 8);
+            write_pod(file, proposal_version);
+            write_pod(file, proposal_hash());
+            write_pod(file, (uint32_t) dimension);
+            write_pod(file, proposal_scale);
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                for (unsigned j = 0 ; j < dimension ; ++j)
+                {
+                    write_pod(file, gsl_matrix_get(proposal_chol, i, j));
+                }
+            }
+
+            file.flush();
+            if (! file)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "cannot write to proposal file '" << config.proposal_file << "'";
+
+                return;
+            }
+            file.close();
+
+            boost::system::error_code error;
+            fs::rename(fs::path(tmp), fs::path(config.proposal_file), error);
+            if (error)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "cannot replace proposal file '" << config.proposal_file << "': " << error.message();
+            }
+        }
+
+        // Adopt the proposal state persisted by an earlier run of the same
+        // analysis; returns false when no usable state exists.
+        bool load_proposal()
+        {
+            const fs::path path(config.proposal_file);
+            if (! fs::exists(path))
+                return false;
+
+            std::ifstream file(config.proposal_file, std::ios::binary);
+            if (! file)
+                return false;
+
+            char magic[8];
+            uint32_t version = 0, dim = 0;
+            uint64_t hash = 0;
+            file.read(magic, 8);
+            if ((! file) || (0 != std::memcmp(magic, "EOSMCSAS", 8))
+                    || (! read_pod(file, version)) || (proposal_version != version)
+                    || (! read_pod(file, hash)) || (proposal_hash() != hash)
+                    || (! read_pod(file, dim)) || (dimension != dim))
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "proposal file '" << config.proposal_file << "' does not match this analysis; adapting afresh";
+
+                return false;
+            }
+
+            double scale;
+            std::vector<double> chol(dimension * dimension, 0.0);
+            if (! read_pod(file, scale))
+                return false;
+            file.read(reinterpret_cast<char *>(chol.data()), chol.size() * sizeof(double));
+            if (! file)
+                return false;
+
+            proposal_scale = scale;
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                for (unsigned j = 0 ; j < dimension ; ++j)
+                {
+                    gsl_matrix_set(proposal_chol, i, j, chol[i * dimension + j]);
+                }
+            }
+
+            return true;
+        }
+
+        // Start a fresh checkpoint file by writing its header.
+        void start_checkpoint() const
+        {
+            std::ofstream file(config.checkpoint_file, std::ios::binary | std::ios::trunc);
+            if (! file)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "cannot write to checkpoint file '" << config.checkpoint_file << "'; continuing without checkpoints";
+
+                return;
+            }
+
+            file.write("EOSMCSCP", 8);
+            write_pod(file, checkpoint_version);
+            write_pod(file, analysis_hash());
+            write_pod(file, (uint32_t) dimension);
+            write_pod(file, (uint64_t) gsl_rng_size(rng));
+        }
+
+        // Append a record of the current state and the chain's tail since the
+        // previous record; the file grows incrementally rather than being rewritten.
+        void write_checkpoint()
+        {
+            if (config.checkpoint_file.empty())
+                return;
+
+            std::ofstream file(config.checkpoint_file, std::ios::binary | std::ios::app);
+            if (! file)
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "cannot append to checkpoint file '" << config.checkpoint_file << "'";
+
+                return;
+            }
+
+            write_pod(file, (uint32_t) preruns_done);
+            write_pod(file, (uint64_t) main_steps_done);
+            write_pod(file, (uint64_t) main_accepted);
+
+            file.write(static_cast<const char *>(gsl_rng_state(rng)), gsl_rng_size(rng));
+
+            write_pod(file, proposal_scale);
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                for (unsigned j = 0 ; j < dimension ; ++j)
+                {
+                    write_pod(file, gsl_matrix_get(proposal_chol, i, j));
+                }
+            }
+
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                write_pod(file, current_point[i]);
+            }
+            write_pod(file, current_log_posterior);
+
+            const uint64_t recorded = weights.size();
+            write_pod(file, recorded - samples_checkpointed);
+            for (uint64_t s = samples_checkpointed ; s < recorded ; ++s)
+            {
+                file.write(reinterpret_cast<const char *>(&usamples[s * dimension]), dimension * sizeof(double));
+                file.write(reinterpret_cast<const char *>(&samples[s * dimension]), dimension * sizeof(double));
+                write_pod(file, weights[s]);
+            }
+
+            file.flush();
+            if (file)
+            {
+                samples_checkpointed = recorded;
+            }
+        }
+
+        // Restore the run's state from the last complete record of a matching
+        // checkpoint file; returns false when no usable checkpoint exists.
+        bool load_checkpoint()
+        {
+            const fs::path path(config.checkpoint_file);
+            if (! fs::exists(path))
+                return false;
+
+            std::ifstream file(config.checkpoint_file, std::ios::binary);
+            if (! file)
+                return false;
+
+            // validate the header against this analysis and configuration
+            char magic[8];
+            uint32_t version = 0, dim = 0;
+            uint64_t hash = 0, rng_size = 0;
+            file.read(magic, 8);
+            if ((! file) || (0 != std::memcmp(magic, "EOSMCSCP", 8))
+                    || (! read_pod(file, version)) || (checkpoint_version != version)
+                    || (! read_pod(file, hash)) || (analysis_hash() != hash)
+                    || (! read_pod(file, dim)) || (dimension != dim)
+                    || (! read_pod(file, rng_size)) || (gsl_rng_size(rng) != rng_size))
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_warning)
+                    << "checkpoint file '" << config.checkpoint_file << "' does not match this analysis; starting afresh";
+
+                return false;
+            }
+
+            // replay the records in order; stop at a clean end of file or at a
+            // partial record left behind by a preemption
+            bool restored = false;
+            std::streampos end_of_last_record = file.tellg();
+            std::vector<char> rng_state(rng_size);
+            std::vector<double> chol(dimension * dimension, 0.0);
+            std::vector<double> point(dimension, 0.0);
+            while (true)
+            {
+                uint32_t record_preruns;
+                uint64_t record_steps, record_accepted, record_tail;
+                double record_scale, record_log_posterior;
+
+                if (! read_pod(file, record_preruns))
+                    break;
+                if ((! read_pod(file, record_steps)) || (! read_pod(file, record_accepted)))
+                    break;
+                file.read(rng_state.data(), rng_size);
+                if ((! file) || (! read_pod(file, record_scale)))
+                    break;
+                file.read(reinterpret_cast<char *>(chol.data()), chol.size() * sizeof(double));
+                file.read(reinterpret_cast<char *>(point.data()), point.size() * sizeof(double));
+                if ((! file) || (! read_pod(file, record_log_posterior)) || (! read_pod(file, record_tail)))
+                    break;
+
+                std::vector<double> tail_usamples(record_tail * dimension, 0.0);
+                std::vector<double> tail_samples(record_tail * dimension, 0.0);
+                std::vector<double> tail_weights(record_tail, 0.0);
+                for (uint64_t s = 0 ; s < record_tail ; ++s)
+                {
+                    file.read(reinterpret_cast<char *>(&tail_usamples[s * dimension]), dimension * sizeof(double));
+                    file.read(reinterpret_cast<char *>(&tail_samples[s * dimension]), dimension * sizeof(double));
+                    read_pod(file, tail_weights[s]);
+                }
+                if (! file)
+                    break;
+
+                // the record is complete; apply it
+                preruns_done = record_preruns;
+                main_steps_done = record_steps;
+                main_accepted = record_accepted;
+                std::memcpy(gsl_rng_state(rng), rng_state.data(), rng_size);
+                proposal_scale = record_scale;
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    for (unsigned j = 0 ; j < dimension ; ++j)
+                    {
+                        gsl_matrix_set(proposal_chol, i, j, chol[i * dimension + j]);
+                    }
+                }
+                current_point = point;
+                current_log_posterior = record_log_posterior;
+                usamples.insert(usamples.end(), tail_usamples.cbegin(), tail_usamples.cend());
+                samples.insert(samples.end(), tail_samples.cbegin(), tail_samples.cend());
+                weights.insert(weights.end(), tail_weights.cbegin(), tail_weights.cend());
+
+                end_of_last_record = file.tellg();
+                restored = true;
+            }
+            file.close();
+
+            if (! restored)
+                return false;
+
+            samples_checkpointed = weights.size();
+
+            // drop any partial trailing record, so that subsequent records append cleanly
+            fs::resize_file(path, static_cast<uintmax_t>(end_of_last_record));
+
+            Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                << "resuming from checkpoint: " << preruns_done << " preruns and "
+                << weights.size() << " recorded samples restored";
+
+            return true;
+        }
+
+        void run()
+        {
+            // resume from a matching checkpoint, or start a fresh checkpoint file
+            bool resumed = false;
+            if (! config.checkpoint_file.empty())
+            {
+                resumed = load_checkpoint();
+                if (! resumed)
+                {
+                    start_checkpoint();
+                }
+            }
+
+            if (resumed)
+            {
+                // re-sync the parameters with the restored point; thereafter they
+                // track the current point across steps
+                apply(log_posterior, current_point);
+
+                // the screen's value is not part of the checkpoint record
+                if (screen_posterior)
+                {
+                    current_screen_log_posterior = evaluate(screen_posterior, current_point);
+                }
+            }
+            else
+            {
+                preruns_done = 0;
+                main_steps_done = 0;
+                main_accepted = 0;
+                samples_checkpointed = 0;
+                samples.clear();
+                usamples.clear();
+                weights.clear();
+
+                // adopt the proposal state of an earlier run of the same analysis,
+                // and skip the preruns that would merely re-learn it
+                if ((! config.proposal_file.empty()) && load_proposal())
+                {
+                    preruns_done = config.preruns;
+                    Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                        << "reusing adapted proposal from '" << config.proposal_file << "'; skipping " << config.preruns << " preruns";
+                }
+            }
+
+            // preruns: adapt the proposal, discard the samples
+            const unsigned preruns_entered = preruns_done;
+            for (unsigned prerun = preruns_done ; prerun < config.preruns ; ++prerun)
+            {
+                std::vector<double> prerun_samples;
+                prerun_samples.reserve(config.pre_n * dimension);
+
+                unsigned accepted = 0;
+                for (unsigned s = 0 ; s < config.pre_n ; ++s)
+                {
+                    if (step())
+                        ++accepted;
+
+                    prerun_samples.insert(prerun_samples.end(), current_point.cbegin(), current_point.cend());
+                }
+
+                const double prerun_acceptance_rate = double(accepted) / config.pre_n;
+                Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                    << "prerun " << prerun << ": acceptance rate is " << prerun_acceptance_rate;
+
+                adapt(prerun_samples, prerun_acceptance_rate);
+
+                preruns_done = prerun + 1;
+                write_checkpoint();
+            }
+
+            // persist the freshly adapted proposal for later runs
+            if ((! config.proposal_file.empty()) && (preruns_done > preruns_entered))
+            {
+                save_proposal();
+            }
+
+            // main run: record every stride-th sample
+            samples.reserve(config.n * dimension);
+            usamples.reserve(config.n * dimension);
+            weights.reserve(config.n);
+
+            const auto & varied_parameters = log_posterior->varied_parameters();
+
+            const unsigned long total = (unsigned long) (config.n) * config.stride;
+            for (unsigned long s = main_steps_done ; s < total ; ++s)
+            {
+                if (step())
+                    ++main_accepted;
+
+                ++main_steps_done;
+
+                if (s % config.stride != config.stride - 1)
+                    continue;
+
+                // the parameters track the current point: accepted proposals are
+                // committed, rejected ones rolled back
+                usamples.insert(usamples.end(), current_point.cbegin(), current_point.cend());
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    samples.push_back(varied_parameters[i].evaluate());
+                }
+                weights.push_back(current_log_posterior);
+
+                if ((config.checkpoint_interval > 0)
+                        && (weights.size() - samples_checkpointed >= config.checkpoint_interval))
+                {
+                    write_checkpoint();
+                }
+            }
+
+            acceptance_rate = double(main_accepted) / total;
+            write_checkpoint();
+            Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                << "main run: acceptance rate is " << acceptance_rate;
+
+            if (screen_posterior && (screen_proposals > 0))
+            {
+                Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                    << "screening rejected " << screen_rejections << " of " << screen_proposals
+                    << " proposals without a full-precision evaluation";
+            }
+        }
+    };
+
+    MarkovChainSampler::MarkovChainSampler(const LogPosteriorPtr & log_posterior, const Config & config) :
+        PrivateImplementationPattern<MarkovChainSampler>(new Implementation<MarkovChainSampler>(log_posterior, config))
+    {
+    }
+
+    MarkovChainSampler::~MarkovChainSampler()
+    {
+    }
+
+    void
+    MarkovChainSampler::run()
+    {
+        _imp->run();
+    }
+
+    unsigned
+    MarkovChainSampler::dimension() const
+    {
+        return _imp->dimension;
+    }
+
+    const std::vector<double> &
+    MarkovChainSampler::samples() const
+    {
+        return _imp->samples;
+    }
+
+    const std::vector<double> &
+    MarkovChainSampler::usamples() const
+    {
+        return _imp->usamples;
+    }
+
+    const std::vector<double> &
+    MarkovChainSampler::weights() const
+    {
+        return _imp->weights;
+    }
+
+    double
+    MarkovChainSampler::acceptance_rate() const
+    {
+        return _imp->acceptance_rate;
+    }
+}
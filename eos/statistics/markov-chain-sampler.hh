@@ -0,0 +1,143 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * MarkovChainSampler draws samples of a LogPosterior using an adaptive
+     * random-walk Metropolis algorithm.
+     *
+     * Sampling proceeds in the unit hypercube ("u space"): proposals are drawn
+     * from a multivariate Gaussian whose covariance is adapted between preruns,
+     * and each u-space point is mapped to the parameter space through the
+     * priors' inverse CDFs. All proposals are generated and evaluated natively,
+     * without crossing any language boundary.
+     *
+     * When configured with a checkpoint file, the sampler periodically appends
+     * a binary record of its state -- the RNG state, the adaptation state, and
+     * the chain's tail since the previous record -- so that a preempted run
+     * can be resumed by a subsequent call to run() without repeating the
+     * preruns. A checkpoint is only restored when its analysis hash matches
+     * the current posterior and configuration.
+     *
+     * When configured with a proposal file, the sampler persists its adapted
+     * proposal -- the covariance's Cholesky factor and the tuned scale -- once
+     * the preruns are complete, and a later run of the same analysis adopts
+     * that state and skips its preruns entirely. Unlike a checkpoint, the
+     * proposal state is shared across runs with different seeds and run
+     * lengths.
+     *
+     * When screening is enabled, proposals are first tested against a
+     * coarse-precision clone of the posterior (cf. EvaluationPrecision), and
+     * the full posterior is evaluated only for proposals that survive this
+     * screen. The delayed-acceptance construction corrects the second-stage
+     * acceptance probability for the screen, so the chain still targets the
+     * full posterior exactly; the screen merely removes the full-precision
+     * cost of the clearly-bad proposals that dominate the early preruns.
+     */
+    class MarkovChainSampler :
+        public PrivateImplementationPattern<MarkovChainSampler>
+    {
+        public:
+            struct Config
+            {
+                /// Seed for the random number generator.
+                unsigned long seed = 0;
+
+                /// Number of adaptation preruns whose samples are discarded.
+                unsigned preruns = 3;
+
+                /// Number of samples per prerun.
+                unsigned pre_n = 150;
+
+                /// Number of samples of the main run that are returned.
+                unsigned n = 1000;
+
+                /// Thinning stride applied to the main run.
+                unsigned stride = 5;
+
+                /// Scale factor for the initial guess of the proposal covariance.
+                double cov_scale = 0.1;
+
+                /// Starting point of the chain in u space; drawn at random if empty.
+                std::vector<double> start_point = {};
+
+                /// Path of the binary checkpoint file; empty disables checkpointing.
+                std::string checkpoint_file = {};
+
+                /// Number of recorded main-run samples between checkpoint records.
+                unsigned checkpoint_interval = 1000;
+
+                /// Path of the persistent proposal-state file; empty disables reuse.
+                std::string proposal_file = {};
+
+                /// Screen proposals against a coarse-precision clone of the posterior.
+                bool screen = false;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The LogPosterior that shall be sampled.
+             * @param config        The configuration of the sampling run.
+             */
+            MarkovChainSampler(const LogPosteriorPtr & log_posterior, const Config & config);
+
+            /// Destructor.
+            ~MarkovChainSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /// Carry out the preruns and the main run.
+            void run();
+            ///@}
+
+            ///@name Access to the results
+            ///@{
+            /// Retrieve the number of varied parameters.
+            unsigned dimension() const;
+
+            /// Retrieve the main run's samples in parameter space, stored row major.
+            const std::vector<double> & samples() const;
+
+            /// Retrieve the main run's samples in u space, stored row major.
+            const std::vector<double> & usamples() const;
+
+            /// Retrieve the values of the log(posterior) associated with the samples.
+            const std::vector<double> & weights() const;
+
+            /// Retrieve the acceptance rate of the main run.
+            double acceptance_rate() const;
+            ///@}
+    };
+}
+
+#endif
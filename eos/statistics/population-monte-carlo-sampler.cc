@@ -0,0 +1,536 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/population-monte-carlo-sampler.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace eos
+{
+    template <>
+    struct Implementation<PopulationMonteCarloSampler>
+    {
+        LogPosteriorPtr log_posterior;
+
+        PopulationMonteCarloSampler::Config config;
+
+        // number of varied parameters
+        unsigned dimension;
+
+        gsl_rng * rng;
+
+        // mixture proposal in u space: weights, means, and lower Cholesky
+        // factors of the covariances of the Gaussian components
+        std::vector<double> component_weights;
+        std::vector<std::vector<double>> component_means;
+        std::vector<gsl_matrix *> component_chols;
+
+        // results of the final step
+        std::vector<double> samples;
+        std::vector<double> usamples;
+        std::vector<double> weights;
+        double effective_sample_size;
+        double evidence;
+
+        Implementation(const LogPosteriorPtr & log_posterior, const PopulationMonteCarloSampler::Config & config) :
+            log_posterior(log_posterior),
+            config(config),
+            dimension(log_posterior->varied_parameters().size()),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            effective_sample_size(0.0),
+            evidence(0.0)
+        {
+            gsl_rng_set(rng, config.seed);
+
+            // scatter the components' means across the unit hypercube, and
+            // assume each parameter's u-space value to be uniformly distributed
+            // on [0, 1), whose variance is 1 / 12
+            const double sigma = std::sqrt(config.cov_scale / 12.0);
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                component_weights.push_back(1.0 / config.components);
+
+                std::vector<double> mean(dimension, 0.0);
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    mean[i] = gsl_rng_uniform(rng);
+                }
+                component_means.push_back(mean);
+
+                gsl_matrix * chol = gsl_matrix_calloc(dimension, dimension);
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    gsl_matrix_set(chol, i, i, sigma);
+                }
+                component_chols.push_back(chol);
+            }
+        }
+
+        ~Implementation()
+        {
+            for (auto & chol : component_chols)
+            {
+                gsl_matrix_free(chol);
+            }
+            gsl_rng_free(rng);
+        }
+
+        // Evaluate the log of component k's Gaussian density at a u-space point.
+        double log_component_density(const unsigned & k, const double * u) const
+        {
+            const gsl_matrix * chol = component_chols[k];
+            const std::vector<double> & mean = component_means[k];
+
+            // solve L z = u - mean by forward substitution
+            std::vector<double> z(dimension, 0.0);
+            double log_det = 0.0, chi2 = 0.0;
+            for (unsigned i = 0 ; i < dimension ; ++i)
+            {
+                double sum = u[i] - mean[i];
+                for (unsigned j = 0 ; j < i ; ++j)
+                {
+                    sum -= gsl_matrix_get(chol, i, j) * z[j];
+                }
+                z[i] = sum / gsl_matrix_get(chol, i, i);
+
+                log_det += std::log(gsl_matrix_get(chol, i, i));
+                chi2 += z[i] * z[i];
+            }
+
+            return -0.5 * chi2 - log_det - 0.5 * dimension * std::log(2.0 * M_PI);
+        }
+
+        // Evaluate the log of the mixture density at a u-space point, and the
+        // components' responsibilities rho_k = alpha_k N_k / q.
+        double log_mixture_density(const double * u, std::vector<double> & responsibilities) const
+        {
+            std::vector<double> log_terms(config.components, 0.0);
+            double max_log_term = -std::numeric_limits<double>::infinity();
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                log_terms[k] = std::log(component_weights[k]) + log_component_density(k, u);
+                max_log_term = std::max(max_log_term, log_terms[k]);
+            }
+
+            double sum = 0.0;
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                responsibilities[k] = std::exp(log_terms[k] - max_log_term);
+                sum += responsibilities[k];
+            }
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                responsibilities[k] /= sum;
+            }
+
+            return max_log_term + std::log(sum);
+        }
+
+        // Draw a population of n points from the mixture proposal.
+        void draw(const unsigned & n, std::vector<double> & upoints)
+        {
+            upoints.resize(n * dimension);
+
+            for (unsigned s = 0 ; s < n ; ++s)
+            {
+                // select a component according to the mixture weights
+                unsigned k = 0;
+                double cumulative = component_weights[0];
+                const double x = gsl_rng_uniform(rng);
+                while ((x >= cumulative) && (k + 1 < config.components))
+                {
+                    ++k;
+                    cumulative += component_weights[k];
+                }
+
+                // point = mean + L z, with z a vector of independent standard normal variates
+                std::vector<double> z(dimension, 0.0);
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    z[i] = gsl_ran_ugaussian(rng);
+                }
+
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    double sum = component_means[k][i];
+                    for (unsigned j = 0 ; j <= i ; ++j)
+                    {
+                        sum += gsl_matrix_get(component_chols[k], i, j) * z[j];
+                    }
+                    upoints[s * dimension + i] = sum;
+                }
+            }
+        }
+
+        // Evaluate the log(likelihood) at each point of a population, dispatched
+        // across the ThreadPool. Each worker evaluates a clone of the posterior,
+        // so that the Parameters updates of distinct points cannot interfere.
+        // Points outside the unit hypercube carry no likelihood.
+        void evaluate(const std::vector<double> & upoints, std::vector<double> & results) const
+        {
+            const size_t n_points = upoints.size() / dimension;
+            results.resize(n_points);
+
+            const size_t n_workers = std::min<size_t>(ThreadPool::instance()->number_of_threads(), n_points);
+            const size_t chunk_size = (n_points + n_workers - 1) / n_workers;
+
+            std::vector<Ticket> tickets;
+            tickets.reserve(n_workers);
+
+            for (size_t w = 0 ; w < n_workers ; ++w)
+            {
+                const size_t chunk_begin = w * chunk_size;
+                const size_t chunk_end   = std::min(n_points, chunk_begin + chunk_size);
+
+                if (chunk_begin >= chunk_end)
+                    break;
+
+                LogPosteriorPtr posterior = log_posterior->clone();
+
+                auto f = [=, this, &upoints, &results] ()
+                {
+                    const auto & varied_parameters = posterior->varied_parameters();
+                    LogLikelihood llh = posterior->log_likelihood();
+
+                    for (size_t s = chunk_begin ; s != chunk_end ; ++s)
+                    {
+                        const double * u = &upoints[s * dimension];
+
+                        bool inside = true;
+                        for (unsigned i = 0 ; i < dimension ; ++i)
+                        {
+                            if ((u[i] < 0.0) || (u[i] >= 1.0))
+                            {
+                                inside = false;
+                                break;
+                            }
+                        }
+                        if (! inside)
+                        {
+                            results[s] = -std::numeric_limits<double>::infinity();
+                            continue;
+                        }
+
+                        // map the point to the parameter space through the priors' inverse CDFs
+                        for (unsigned i = 0 ; i < dimension ; ++i)
+                        {
+                            Parameter p = varied_parameters[i];
+                            p.set_generator(u[i]);
+                        }
+                        for (auto prior = posterior->begin_priors(), prior_end = posterior->end_priors() ; prior != prior_end ; ++prior)
+                        {
+                            (*prior)->sample();
+                        }
+
+                        try
+                        {
+                            results[s] = llh();
+                        }
+                        catch (Exception & e)
+                        {
+                            Log::instance()->message("PopulationMonteCarloSampler::run", ll_error)
+                                << "Exception encountered when evaluating log(likelihood): " << e.what();
+                            results[s] = -std::numeric_limits<double>::infinity();
+                        }
+                    }
+                };
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+        }
+
+        // Compute the normalized importance weights of a population, together
+        // with the normalized effective sample size and the evidence estimate.
+        void importance_weights(const std::vector<double> & upoints, const std::vector<double> & log_likelihoods,
+                std::vector<double> & normalized_weights, double & ess, double & evidence_estimate) const
+        {
+            const size_t n_points = log_likelihoods.size();
+            normalized_weights.resize(n_points);
+
+            std::vector<double> responsibilities(config.components, 0.0);
+
+            // log w = log L - log q, with q the mixture density
+            std::vector<double> log_weights(n_points, 0.0);
+            double max_log_weight = -std::numeric_limits<double>::infinity();
+            for (size_t s = 0 ; s < n_points ; ++s)
+            {
+                log_weights[s] = log_likelihoods[s] - log_mixture_density(&upoints[s * dimension], responsibilities);
+                max_log_weight = std::max(max_log_weight, log_weights[s]);
+            }
+
+            if (! std::isfinite(max_log_weight))
+            {
+                std::fill(normalized_weights.begin(), normalized_weights.end(), 1.0 / n_points);
+                ess = 0.0;
+                evidence_estimate = 0.0;
+
+                return;
+            }
+
+            double sum = 0.0, sum_of_squares = 0.0;
+            for (size_t s = 0 ; s < n_points ; ++s)
+            {
+                normalized_weights[s] = std::exp(log_weights[s] - max_log_weight);
+                sum += normalized_weights[s];
+            }
+            for (size_t s = 0 ; s < n_points ; ++s)
+            {
+                normalized_weights[s] /= sum;
+                sum_of_squares += normalized_weights[s] * normalized_weights[s];
+            }
+
+            ess = 1.0 / (sum_of_squares * n_points);
+            evidence_estimate = std::exp(max_log_weight) * sum / n_points;
+        }
+
+        // Update the mixture's weights, means, and covariances in place, using
+        // the Rao-Blackwellized estimates of Cappe et al. based on the
+        // components' responsibilities for the current population.
+        void adapt(const std::vector<double> & upoints, const std::vector<double> & normalized_weights)
+        {
+            const size_t n_points = normalized_weights.size();
+
+            std::vector<double> responsibilities(config.components, 0.0);
+
+            // accumulate weights and means in a single pass
+            std::vector<double> new_weights(config.components, 0.0);
+            std::vector<std::vector<double>> new_means(config.components, std::vector<double>(dimension, 0.0));
+            std::vector<std::vector<double>> rho(n_points, std::vector<double>(config.components, 0.0));
+            for (size_t s = 0 ; s < n_points ; ++s)
+            {
+                log_mixture_density(&upoints[s * dimension], responsibilities);
+                rho[s] = responsibilities;
+
+                for (unsigned k = 0 ; k < config.components ; ++k)
+                {
+                    const double w = normalized_weights[s] * responsibilities[k];
+                    new_weights[k] += w;
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        new_means[k][i] += w * upoints[s * dimension + i];
+                    }
+                }
+            }
+
+            gsl_matrix * covariance = gsl_matrix_calloc(dimension, dimension);
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                // a component that no longer carries weight cannot be updated;
+                // keep it unchanged, it will die out in the mixture weights
+                if (new_weights[k] < 1.0e-10)
+                {
+                    component_weights[k] = new_weights[k];
+                    continue;
+                }
+
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    new_means[k][i] /= new_weights[k];
+                }
+
+                gsl_matrix_set_zero(covariance);
+                for (size_t s = 0 ; s < n_points ; ++s)
+                {
+                    const double w = normalized_weights[s] * rho[s][k] / new_weights[k];
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        const double di = upoints[s * dimension + i] - new_means[k][i];
+                        for (unsigned j = 0 ; j <= i ; ++j)
+                        {
+                            const double dj = upoints[s * dimension + j] - new_means[k][j];
+                            gsl_matrix_set(covariance, i, j, gsl_matrix_get(covariance, i, j) + w * di * dj);
+                        }
+                    }
+                }
+
+                // regularize to keep the covariance positive definite
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    for (unsigned j = 0 ; j < i ; ++j)
+                    {
+                        gsl_matrix_set(covariance, j, i, gsl_matrix_get(covariance, i, j));
+                    }
+                    gsl_matrix_set(covariance, i, i, gsl_matrix_get(covariance, i, i) + 1.0e-8);
+                }
+
+                if (GSL_SUCCESS == gsl_linalg_cholesky_decomp1(covariance))
+                {
+                    gsl_matrix_memcpy(component_chols[k], covariance);
+
+                    // zero out the upper triangle left over by GSL
+                    for (unsigned i = 0 ; i < dimension ; ++i)
+                    {
+                        for (unsigned j = i + 1 ; j < dimension ; ++j)
+                        {
+                            gsl_matrix_set(component_chols[k], i, j, 0.0);
+                        }
+                    }
+
+                    component_means[k] = new_means[k];
+                }
+                component_weights[k] = new_weights[k];
+            }
+            gsl_matrix_free(covariance);
+
+            // renormalize the mixture weights
+            double sum = 0.0;
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                sum += component_weights[k];
+            }
+            for (unsigned k = 0 ; k < config.components ; ++k)
+            {
+                component_weights[k] /= sum;
+            }
+        }
+
+        void run()
+        {
+            std::vector<double> upoints, log_likelihoods, normalized_weights;
+
+            // adaptation steps: update the mixture, discard the samples
+            for (unsigned step = 0 ; step < config.steps ; ++step)
+            {
+                draw(config.samples_per_step, upoints);
+                evaluate(upoints, log_likelihoods);
+
+                double ess, evidence_estimate;
+                importance_weights(upoints, log_likelihoods, normalized_weights, ess, evidence_estimate);
+
+                Log::instance()->message("PopulationMonteCarloSampler::run", ll_informational)
+                    << "adaptation step " << step << ": effective sample size is " << ess
+                    << ", evidence estimate is " << evidence_estimate;
+
+                adapt(upoints, normalized_weights);
+
+                if (ess >= config.min_ess)
+                    break;
+            }
+
+            // final step: record the samples and their importance weights
+            draw(config.final_n, upoints);
+            evaluate(upoints, log_likelihoods);
+            importance_weights(upoints, log_likelihoods, weights, effective_sample_size, evidence);
+
+            Log::instance()->message("PopulationMonteCarloSampler::run", ll_informational)
+                << "final step: effective sample size is " << effective_sample_size
+                << ", evidence estimate is " << evidence;
+
+            usamples = upoints;
+
+            // map the samples to parameter space before recording them
+            const auto & varied_parameters = log_posterior->varied_parameters();
+
+            samples.clear();
+            samples.reserve(config.final_n * dimension);
+            for (unsigned s = 0 ; s < config.final_n ; ++s)
+            {
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    Parameter p = varied_parameters[i];
+                    p.set_generator(usamples[s * dimension + i]);
+                }
+                for (auto prior = log_posterior->begin_priors(), prior_end = log_posterior->end_priors() ; prior != prior_end ; ++prior)
+                {
+                    (*prior)->sample();
+                }
+
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    samples.push_back(varied_parameters[i].evaluate());
+                }
+            }
+        }
+    };
+
+    PopulationMonteCarloSampler::PopulationMonteCarloSampler(const LogPosteriorPtr & log_posterior, const Config & config) :
+        PrivateImplementationPattern<PopulationMonteCarloSampler>(new Implementation<PopulationMonteCarloSampler>(log_posterior, config))
+    {
+    }
+
+    PopulationMonteCarloSampler::~PopulationMonteCarloSampler()
+    {
+    }
+
+    void
+    PopulationMonteCarloSampler::run()
+    {
+        _imp->run();
+    }
+
+    unsigned
+    PopulationMonteCarloSampler::dimension() const
+    {
+        return _imp->dimension;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::samples() const
+    {
+        return _imp->samples;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::usamples() const
+    {
+        return _imp->usamples;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::weights() const
+    {
+        return _imp->weights;
+    }
+
+    double
+    PopulationMonteCarloSampler::effective_sample_size() const
+    {
+        return _imp->effective_sample_size;
+    }
+
+    double
+    PopulationMonteCarloSampler::evidence() const
+    {
+        return _imp->evidence;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::component_weights() const
+    {
+        return _imp->component_weights;
+    }
+}
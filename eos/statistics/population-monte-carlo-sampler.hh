@@ -0,0 +1,120 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_POPULATION_MONTE_CARLO_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_POPULATION_MONTE_CARLO_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * PopulationMonteCarloSampler draws weighted samples of a LogPosterior
+     * using adaptive importance sampling from a mixture of Gaussian proposal
+     * components (Population Monte Carlo).
+     *
+     * Sampling proceeds in the unit hypercube ("u space"), where the priors
+     * are uniform by construction: each u-space point is mapped to the
+     * parameter space through the priors' inverse CDFs, so the target density
+     * in u space is the likelihood, and the mean importance weight estimates
+     * the evidence. The mixture components are updated in place between steps
+     * using Rao-Blackwellized estimates of their weights, means, and
+     * covariances, and adaptation stops early once the effective sample size
+     * exceeds a configurable fraction of the population size. The likelihood
+     * evaluations of each population are dispatched across the ThreadPool,
+     * with each worker evaluating a clone of the posterior.
+     */
+    class PopulationMonteCarloSampler :
+        public PrivateImplementationPattern<PopulationMonteCarloSampler>
+    {
+        public:
+            struct Config
+            {
+                /// Seed for the random number generator.
+                unsigned long seed = 0;
+
+                /// Number of Gaussian components of the mixture proposal.
+                unsigned components = 3;
+
+                /// Maximal number of adaptation steps.
+                unsigned steps = 10;
+
+                /// Number of samples drawn and evaluated per adaptation step.
+                unsigned samples_per_step = 500;
+
+                /// Number of samples of the final step that are returned.
+                unsigned final_n = 2000;
+
+                /// Stop adapting early once the effective sample size exceeds this fraction of the population size.
+                double min_ess = 0.9;
+
+                /// Scale factor for the initial guess of the components' covariances.
+                double cov_scale = 0.1;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The LogPosterior that shall be sampled.
+             * @param config        The configuration of the sampling run.
+             */
+            PopulationMonteCarloSampler(const LogPosteriorPtr & log_posterior, const Config & config);
+
+            /// Destructor.
+            ~PopulationMonteCarloSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /// Carry out the adaptation steps and the final step.
+            void run();
+            ///@}
+
+            ///@name Access to the results
+            ///@{
+            /// Retrieve the number of varied parameters.
+            unsigned dimension() const;
+
+            /// Retrieve the final step's samples in parameter space, stored row major.
+            const std::vector<double> & samples() const;
+
+            /// Retrieve the final step's samples in u space, stored row major.
+            const std::vector<double> & usamples() const;
+
+            /// Retrieve the normalized importance weights associated with the samples.
+            const std::vector<double> & weights() const;
+
+            /// Retrieve the effective sample size of the final step, as a fraction of the population size.
+            double effective_sample_size() const;
+
+            /// Retrieve the estimate of the evidence.
+            double evidence() const;
+
+            /// Retrieve the weights of the mixture components after adaptation.
+            const std::vector<double> & component_weights() const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,226 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/log-prior.hh>
+#include <eos/statistics/prior-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/philox-rng.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <gsl/gsl_qrng.h>
+
+#include <cmath>
+#include <vector>
+
+namespace eos
+{
+    template <>
+    struct Implementation<PriorSampler>
+    {
+        LogPosteriorPtr log_posterior;
+
+        PriorSampler::Scheme scheme;
+
+        // number of varied parameters
+        unsigned dimension;
+
+        // counter-based generator: the variates of sample i occupy draw indices
+        // i * dimension ... (i + 1) * dimension - 1, independently of batching
+        PhiloxRNG rng;
+
+        // index of the next sample to be drawn
+        std::size_t next_sample;
+
+        // Sobol sequence generator; only allocated for the sobol scheme
+        gsl_qrng * qrng;
+
+        // per-dimension Cranley-Patterson rotation of the Sobol points
+        std::vector<double> rotation;
+
+        Implementation(const LogPosteriorPtr & log_posterior, const PriorSampler::Scheme & scheme, unsigned long seed) :
+            log_posterior(log_posterior),
+            scheme(scheme),
+            dimension(log_posterior->varied_parameters().size()),
+            rng(seed),
+            next_sample(0),
+            qrng(nullptr)
+        {
+            if (PriorSampler::Scheme::sobol == scheme)
+            {
+                // the GSL Sobol tables cover at most 40 dimensions
+                if (dimension > 40)
+                {
+                    throw InternalError("PriorSampler: Sobol scheme is limited to 40 varied parameters, posterior has " + stringify(dimension));
+                }
+
+                qrng = gsl_qrng_alloc(gsl_qrng_sobol, dimension);
+
+                // randomize the sequence by a rotation modulo 1, drawn from a
+                // dedicated stream so that it never collides with the variates
+                PhiloxRNG rotation_rng(seed, 1);
+                rotation.resize(dimension);
+                for (unsigned i = 0 ; i < dimension ; ++i)
+                {
+                    rotation[i] = rotation_rng.uniform();
+                }
+            }
+        }
+
+        ~Implementation()
+        {
+            if (qrng)
+            {
+                gsl_qrng_free(qrng);
+            }
+        }
+
+        // Fill a row-major n x dimension matrix with uniform variates according to the scheme.
+        void generate(std::vector<double> & u, const std::size_t & n)
+        {
+            switch (scheme)
+            {
+                case PriorSampler::Scheme::pseudo:
+                    rng.seek(std::uint64_t(next_sample) * dimension);
+                    for (std::size_t i = 0 ; i < n * dimension ; ++i)
+                    {
+                        u[i] = rng.uniform();
+                    }
+                    break;
+
+                case PriorSampler::Scheme::antithetic:
+                    if (n % 2 != 0)
+                    {
+                        throw InternalError("PriorSampler: antithetic scheme requires an even number of samples, got " + stringify(n));
+                    }
+
+                    // both members of a pair are derived from the even member's draws
+                    rng.seek(std::uint64_t(next_sample / 2) * dimension);
+                    for (std::size_t i = 0 ; i < n ; i += 2)
+                    {
+                        for (unsigned j = 0 ; j < dimension ; ++j)
+                        {
+                            const double v = rng.uniform();
+
+                            u[i * dimension + j]       = v;
+                            u[(i + 1) * dimension + j] = 1.0 - v;
+                        }
+                    }
+                    break;
+
+                case PriorSampler::Scheme::sobol:
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        gsl_qrng_get(qrng, u.data() + i * dimension);
+
+                        for (unsigned j = 0 ; j < dimension ; ++j)
+                        {
+                            double v = u[i * dimension + j] + rotation[j];
+                            if (v >= 1.0)
+                            {
+                                v -= 1.0;
+                            }
+
+                            u[i * dimension + j] = v;
+                        }
+                    }
+                    break;
+            }
+
+            next_sample += n;
+        }
+
+        void sample(double * out, const std::size_t & n)
+        {
+            std::vector<double> u(n * dimension);
+            generate(u, n);
+
+            // each prior transforms its own contiguous block of columns, in the
+            // order in which the priors were added to the posterior
+            std::vector<double> u_block, out_block;
+            unsigned offset = 0;
+            for (auto prior = log_posterior->begin_priors(), prior_end = log_posterior->end_priors() ; prior != prior_end ; ++prior)
+            {
+                const unsigned prior_dimension = (*prior)->dimension();
+
+                u_block.resize(n * prior_dimension);
+                out_block.resize(n * prior_dimension);
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    for (unsigned j = 0 ; j < prior_dimension ; ++j)
+                    {
+                        u_block[i * prior_dimension + j] = u[i * dimension + offset + j];
+                    }
+                }
+
+                (*prior)->inverse_cdf(u_block.data(), out_block.data(), n);
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    for (unsigned j = 0 ; j < prior_dimension ; ++j)
+                    {
+                        out[i * dimension + offset + j] = out_block[i * prior_dimension + j];
+                    }
+                }
+
+                offset += prior_dimension;
+            }
+        }
+    };
+
+    PriorSampler::PriorSampler(const LogPosteriorPtr & log_posterior, const Scheme & scheme, unsigned long seed) :
+        PrivateImplementationPattern<PriorSampler>(new Implementation<PriorSampler>(log_posterior, scheme, seed))
+    {
+    }
+
+    PriorSampler::~PriorSampler()
+    {
+    }
+
+    void
+    PriorSampler::sample(double * out, const std::size_t & n)
+    {
+        _imp->sample(out, n);
+    }
+
+    void
+    PriorSampler::seek(const std::size_t & index)
+    {
+        if (Scheme::sobol == _imp->scheme)
+        {
+            throw InternalError("PriorSampler: the sobol scheme does not support seeking");
+        }
+
+        if ((Scheme::antithetic == _imp->scheme) && (index % 2 != 0))
+        {
+            throw InternalError("PriorSampler: antithetic scheme requires an even sample index, got " + stringify(index));
+        }
+
+        _imp->next_sample = index;
+    }
+
+    unsigned
+    PriorSampler::dimension() const
+    {
+        return _imp->dimension;
+    }
+}
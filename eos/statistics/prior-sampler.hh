@@ -0,0 +1,101 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_PRIOR_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_PRIOR_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <cstddef>
+
+namespace eos
+{
+    /*!
+     * PriorSampler draws batches of samples from the priors of a LogPosterior.
+     *
+     * Uniform variates are generated natively and pushed through the priors'
+     * batched inverse CDFs; no per-sample language boundary is crossed. Besides
+     * plain pseudo-random variates, the sampler supports antithetic pairs and a
+     * randomized Sobol low-discrepancy sequence, both of which reduce the number
+     * of samples needed for stable prior-predictive bands.
+     */
+    class PriorSampler :
+        public PrivateImplementationPattern<PriorSampler>
+    {
+        public:
+            /// The scheme by which uniform variates are generated.
+            enum class Scheme
+            {
+                pseudo,     ///< independent pseudo-random variates (counter-based Philox)
+                antithetic, ///< pseudo-random variates, mirrored in pairs u, 1 - u
+                sobol       ///< Sobol sequence with a random Cranley-Patterson rotation
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The LogPosterior whose priors shall be sampled.
+             * @param scheme        The scheme by which uniform variates are generated.
+             * @param seed          Seed for the pseudo-random generator and the Sobol rotation.
+             */
+            PriorSampler(const LogPosteriorPtr & log_posterior, const Scheme & scheme, unsigned long seed);
+
+            /// Destructor.
+            ~PriorSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Draw a batch of prior samples.
+             *
+             * Successive calls continue the underlying sequence. For the antithetic
+             * scheme, n must be even so that every sample is paired with its mirror.
+             *
+             * @param out The prior samples, stored row major with shape n x dimension().
+             * @param n   The number of samples, i.e. of rows.
+             */
+            void sample(double * out, const std::size_t & n);
+
+            /*!
+             * Position the sampler at the given absolute sample index.
+             *
+             * The pseudo and antithetic schemes are counter-based, so the sample
+             * at any index is a pure function of the seed and the index; workers
+             * can partition one reproducible sequence by seeking to disjoint
+             * ranges. Not supported for the sobol scheme, whose generator state
+             * cannot be advanced in O(1).
+             *
+             * @param index The index of the next sample to be drawn.
+             */
+            void seek(const std::size_t & index);
+            ///@}
+
+            ///@name Access to metadata
+            ///@{
+            /// Retrieve the number of varied parameters.
+            unsigned dimension() const;
+            ///@}
+    };
+}
+
+#endif
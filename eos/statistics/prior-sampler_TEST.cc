@@ -0,0 +1,163 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/log-prior.hh>
+#include <eos/statistics/prior-sampler.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class PriorSamplerTest :
+    public TestCase
+{
+    public:
+        PriorSamplerTest() :
+            TestCase("prior_sampler_test")
+        {
+        }
+
+        static LogPosteriorPtr make_log_posterior()
+        {
+            Parameters parameters = Parameters::Defaults();
+
+            LogLikelihood llh(parameters);
+            LogPosteriorPtr result = std::make_shared<LogPosterior>(llh);
+            result->add(LogPrior::Flat(parameters, "mass::b(MSbar)", 4.0, 5.0), false);
+            result->add(LogPrior::Flat(parameters, "mass::c", 1.0, 2.0), false);
+
+            return result;
+        }
+
+        virtual void run() const
+        {
+            // all schemes respect the priors' supports and column order
+            {
+                for (auto scheme : { PriorSampler::Scheme::pseudo, PriorSampler::Scheme::antithetic, PriorSampler::Scheme::sobol })
+                {
+                    PriorSampler sampler(make_log_posterior(), scheme, 1723);
+
+                    TEST_CHECK_EQUAL(sampler.dimension(), 2u);
+
+                    static const std::size_t n = 64;
+                    std::vector<double> samples(n * 2);
+                    sampler.sample(samples.data(), n);
+
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        TEST_CHECK(samples[i * 2 + 0] >= 4.0);
+                        TEST_CHECK(samples[i * 2 + 0] <  5.0);
+                        TEST_CHECK(samples[i * 2 + 1] >= 1.0);
+                        TEST_CHECK(samples[i * 2 + 1] <  2.0);
+                    }
+                }
+            }
+
+            // antithetic samples are mirrored in pairs; for flat priors the
+            // mirror acts linearly on the parameter values
+            {
+                PriorSampler sampler(make_log_posterior(), PriorSampler::Scheme::antithetic, 1723);
+
+                static const std::size_t n = 64;
+                std::vector<double> samples(n * 2);
+                sampler.sample(samples.data(), n);
+
+                for (std::size_t i = 0 ; i < n ; i += 2)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(samples[i * 2 + 0] + samples[(i + 1) * 2 + 0], 9.0, 1e-13);
+                    TEST_CHECK_NEARLY_EQUAL(samples[i * 2 + 1] + samples[(i + 1) * 2 + 1], 3.0, 1e-13);
+                }
+
+                // an odd batch size cannot be paired
+                TEST_CHECK_THROWS(InternalError, sampler.sample(samples.data(), 3));
+            }
+
+            // the Sobol sequence stratifies better than its pseudo-random
+            // counterpart: every sixteenth of each flat prior's support is
+            // populated by a batch of 64 samples
+            {
+                PriorSampler sampler(make_log_posterior(), PriorSampler::Scheme::sobol, 1723);
+
+                static const std::size_t n = 64;
+                std::vector<double> samples(n * 2);
+                sampler.sample(samples.data(), n);
+
+                for (unsigned j = 0 ; j < 2 ; ++j)
+                {
+                    const double min = (0 == j) ? 4.0 : 1.0;
+
+                    std::vector<unsigned> counts(16, 0);
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        const unsigned bin = std::min<unsigned>(15, 16 * (samples[i * 2 + j] - min));
+                        counts[bin] += 1;
+                    }
+
+                    for (unsigned bin = 0 ; bin < 16 ; ++bin)
+                    {
+                        TEST_CHECK(counts[bin] > 0);
+                    }
+                }
+            }
+
+            // successive batches continue the sequence instead of repeating it
+            {
+                PriorSampler sampler(make_log_posterior(), PriorSampler::Scheme::sobol, 1723);
+
+                std::vector<double> first(32 * 2), second(32 * 2);
+                sampler.sample(first.data(), 32);
+                sampler.sample(second.data(), 32);
+
+                TEST_CHECK(first != second);
+            }
+
+            // the pseudo and antithetic sequences are counter-based: a sampler
+            // seeking to index i reproduces the i-th row of another sampler's
+            // sequence, independently of how the draws were batched
+            {
+                for (auto scheme : { PriorSampler::Scheme::pseudo, PriorSampler::Scheme::antithetic })
+                {
+                    PriorSampler serial(make_log_posterior(), scheme, 1723);
+                    PriorSampler sought(make_log_posterior(), scheme, 1723);
+
+                    static const std::size_t n = 16;
+                    std::vector<double> whole(n * 2), tail((n - 4) * 2);
+                    serial.sample(whole.data(), n);
+
+                    sought.seek(4);
+                    sought.sample(tail.data(), n - 4);
+
+                    for (std::size_t i = 0 ; i < (n - 4) * 2 ; ++i)
+                    {
+                        TEST_CHECK_EQUAL(whole[8 + i], tail[i]);
+                    }
+                }
+
+                PriorSampler sampler(make_log_posterior(), PriorSampler::Scheme::sobol, 1723);
+                TEST_CHECK_THROWS(InternalError, sampler.seek(4));
+            }
+        }
+} prior_sampler_test;
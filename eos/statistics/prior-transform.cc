@@ -0,0 +1,182 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/prior-transform.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace eos
+{
+    template <>
+    struct Implementation<PriorTransform>
+    {
+        // owns its Parameters object, so that transforms cannot interfere
+        // with the posterior handed to the constructor
+        LogPosteriorPtr posterior;
+
+        // the ordered priors, with the column offset of each prior's block
+        std::vector<LogPriorPtr> priors;
+        std::vector<unsigned> offsets;
+
+        // persistent per-worker clones for the fused path, built lazily on
+        // first use; the master posterior above is never evaluated itself
+        std::vector<LogPosteriorPtr> clones;
+
+        unsigned dimension;
+
+        Implementation(const LogPosterior & log_posterior) :
+            posterior(log_posterior.clone()),
+            dimension(log_posterior.varied_parameters().size())
+        {
+            unsigned offset = 0;
+            for (auto p = posterior->begin_priors(), p_end = posterior->end_priors() ; p != p_end ; ++p)
+            {
+                priors.push_back(*p);
+                offsets.push_back(offset);
+                offset += (*p)->dimension();
+            }
+        }
+
+        void transform(const double * u, double * points, const std::size_t & n) const
+        {
+            // each prior consumes a contiguous block of columns; its batched
+            // inverse CDF expects contiguous rows, so the block is gathered
+            // into scratch storage, transformed, and scattered back
+            std::vector<double> scratch_u, scratch_out;
+
+            for (std::size_t k = 0 ; k < priors.size() ; ++k)
+            {
+                const unsigned d = priors[k]->dimension();
+                const unsigned offset = offsets[k];
+
+                scratch_u.resize(n * d);
+                scratch_out.resize(n * d);
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    std::copy(u + i * dimension + offset, u + i * dimension + offset + d, scratch_u.begin() + i * d);
+                }
+
+                priors[k]->inverse_cdf(scratch_u.data(), scratch_out.data(), n);
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    std::copy(scratch_out.begin() + i * d, scratch_out.begin() + (i + 1) * d, points + i * dimension + offset);
+                }
+            }
+        }
+    };
+
+    PriorTransform::PriorTransform(const LogPosterior & log_posterior) :
+        PrivateImplementationPattern<PriorTransform>(new Implementation<PriorTransform>(log_posterior))
+    {
+    }
+
+    PriorTransform::~PriorTransform()
+    {
+    }
+
+    unsigned
+    PriorTransform::dimension() const
+    {
+        return _imp->dimension;
+    }
+
+    void
+    PriorTransform::transform(const double * u, double * points, const std::size_t & n) const
+    {
+        _imp->transform(u, points, n);
+    }
+
+    void
+    PriorTransform::transform_and_evaluate(const double * u, double * points, double * results, const std::size_t & n) const
+    {
+        _imp->transform(u, points, n);
+
+        if (0 == n)
+            return;
+
+        const std::size_t n_dim = _imp->dimension;
+
+        // each worker evaluates a contiguous chunk of points on its own
+        // persistent clone, so that the Parameters updates of distinct points
+        // cannot interfere and repeated calls do not pay the cloning cost again
+        const std::size_t n_workers = std::min<std::size_t>(ThreadPool::instance()->number_of_threads(), n);
+        const std::size_t chunk_size = (n + n_workers - 1) / n_workers;
+
+        while (_imp->clones.size() < n_workers)
+        {
+            _imp->clones.push_back(_imp->posterior->clone());
+        }
+
+        std::vector<Ticket> tickets;
+        tickets.reserve(n_workers);
+
+        for (std::size_t w = 0 ; w < n_workers ; ++w)
+        {
+            const std::size_t chunk_begin = w * chunk_size;
+            const std::size_t chunk_end   = std::min(n, chunk_begin + chunk_size);
+
+            if (chunk_begin >= chunk_end)
+                break;
+
+            LogPosteriorPtr posterior = _imp->clones[w];
+
+            auto f = [=] ()
+            {
+                const auto & varied_parameters = posterior->varied_parameters();
+                LogLikelihood log_likelihood = posterior->log_likelihood();
+
+                for (std::size_t i = chunk_begin ; i != chunk_end ; ++i)
+                {
+                    const double * point = points + i * n_dim;
+
+                    for (std::size_t j = 0 ; j != n_dim ; ++j)
+                    {
+                        Parameter p = varied_parameters[j];
+                        p = point[j];
+                    }
+
+                    try
+                    {
+                        results[i] = log_likelihood();
+                    }
+                    catch (Exception & e)
+                    {
+                        Log::instance()->message("PriorTransform::transform_and_evaluate", ll_error)
+                            << "Exception encountered when evaluating parameter point " << i << ": " << e.what();
+                        results[i] = -std::numeric_limits<double>::infinity();
+                    }
+                }
+            };
+            tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+        }
+
+        for (auto & ticket : tickets)
+        {
+            ticket.wait();
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_PRIOR_TRANSFORM_HH
+#define EOS_GUARD_EOS_STATISTICS_PRIOR_TRANSFORM_HH 1
+
+#include <eos/statistics/log-posterior-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <cstddef>
+
+namespace eos
+{
+    /*!
+     * Maps points from the unit hypercube to the parameter space of a
+     * LogPosterior, in the order of its priors.
+     *
+     * External nested-sampling implementations separate the prior from the
+     * likelihood: live points are proposed on [0, 1)^D and transformed
+     * through the inverse CDFs of the priors. PriorTransform compiles the
+     * ordered priors of a posterior once and serves whole batches of points
+     * through the batched LogPrior::inverse_cdf() kernels, instead of looping
+     * per dimension and per point. The posterior is cloned at construction,
+     * so the caller's Parameters object is never modified.
+     */
+    class PriorTransform :
+        public PrivateImplementationPattern<PriorTransform>
+    {
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The posterior whose priors define the transform.
+             */
+            PriorTransform(const LogPosterior & log_posterior);
+
+            /// Destructor.
+            ~PriorTransform();
+
+            /// Retrieve the number of varied parameters.
+            unsigned dimension() const;
+
+            /*!
+             * Transform a batch of unit-hypercube points to parameter space.
+             *
+             * Both u and points are row-major matrices of shape n x dimension(),
+             * with the columns in the order of the posterior's varied parameters.
+             *
+             * @param u      The unit-hypercube points in [0, 1)^D.
+             * @param points The transformed parameter points.
+             * @param n      The number of points, i.e. of rows.
+             */
+            void transform(const double * u, double * points, const std::size_t & n) const;
+
+            /*!
+             * Transform a batch of unit-hypercube points and evaluate the
+             * Log(likelihood) at each of them.
+             *
+             * The points are dispatched across the ThreadPool, with each worker
+             * evaluating a clone of the posterior's likelihood. A point whose
+             * evaluation raises an exception yields -inf, and the exception is
+             * logged. Note that the results are pure likelihood values, without
+             * the prior contribution, as consumed by nested samplers.
+             *
+             * @param u       The unit-hypercube points in [0, 1)^D, row-major n x dimension().
+             * @param points  The transformed parameter points, row-major n x dimension().
+             * @param results Pointer to an array of n entries to which the Log(likelihood) values are written.
+             * @param n       The number of points, i.e. of rows.
+             */
+            void transform_and_evaluate(const double * u, double * points, double * results, const std::size_t & n) const;
+    };
+}
+
+#endif
@@ -0,0 +1,110 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/prior-transform.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class PriorTransformTest :
+    public TestCase
+{
+    public:
+        PriorTransformTest() :
+            TestCase("prior_transform_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1.0e-13;
+
+            Parameters parameters = Parameters::Defaults();
+
+            LogLikelihood llh(parameters);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+            llh.add(ObservablePtr(new ObservableStub(parameters, "mass::c")), 1.15, 1.2, 1.25);
+
+            LogPosterior log_posterior(llh);
+            log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", 3.7, 4.9));
+            log_posterior.add(LogPrior::CurtailedGauss(parameters, "mass::c", 1.0, 1.48, 1.182, 1.2, 1.218));
+
+            PriorTransform transform(log_posterior);
+
+            TEST_CHECK_EQUAL(transform.dimension(), 2u);
+
+            static const std::size_t n = 11;
+            std::vector<double> u(2 * n), points(2 * n);
+            for (std::size_t i = 0 ; i < n ; ++i)
+            {
+                u[2 * i + 0] = (i + 0.5) / n;
+                u[2 * i + 1] = 1.0 - (i + 0.25) / n;
+            }
+
+            const double mass_b_before = parameters["mass::b(MSbar)"].evaluate();
+            const double mass_c_before = parameters["mass::c"].evaluate();
+
+            transform.transform(u.data(), points.data(), n);
+
+            // the batched transform matches the per-point sample() path
+            for (std::size_t i = 0 ; i < n ; ++i)
+            {
+                parameters["mass::b(MSbar)"].set_generator(u[2 * i + 0]);
+                parameters["mass::c"].set_generator(u[2 * i + 1]);
+                for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+                {
+                    (*p)->sample();
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(points[2 * i + 0], parameters["mass::b(MSbar)"].evaluate(), eps);
+                TEST_CHECK_NEARLY_EQUAL(points[2 * i + 1], parameters["mass::c"].evaluate(), eps);
+            }
+
+            // the fused entry reproduces the separate transform and evaluation
+            {
+                std::vector<double> fused_points(2 * n), results(n);
+                transform.transform_and_evaluate(u.data(), fused_points.data(), results.data(), n);
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_EQUAL(fused_points[2 * i + 0], points[2 * i + 0]);
+                    TEST_CHECK_EQUAL(fused_points[2 * i + 1], points[2 * i + 1]);
+
+                    parameters["mass::b(MSbar)"] = points[2 * i + 0];
+                    parameters["mass::c"] = points[2 * i + 1];
+
+                    TEST_CHECK_NEARLY_EQUAL(results[i], llh(), eps);
+                }
+            }
+
+            // the transform operates on a clone; the caller's parameters are
+            // only modified by this test's own reference computations
+            parameters["mass::b(MSbar)"] = mass_b_before;
+            parameters["mass::c"] = mass_c_before;
+            transform.transform(u.data(), points.data(), n);
+            TEST_CHECK_EQUAL(parameters["mass::b(MSbar)"].evaluate(), mass_b_before);
+            TEST_CHECK_EQUAL(parameters["mass::c"].evaluate(), mass_c_before);
+        }
+} prior_transform_test;
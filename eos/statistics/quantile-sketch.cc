@@ -0,0 +1,260 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/quantile-sketch.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace eos
+{
+    namespace
+    {
+        struct Centroid
+        {
+            double mean;
+
+            double weight;
+        };
+    }
+
+    template <> struct Implementation<QuantileSketch>
+    {
+        unsigned compression;
+
+        // sorted by mean between compression passes
+        std::vector<Centroid> centroids;
+
+        // unsorted incoming values, folded into the centroids when full
+        std::vector<Centroid> buffer;
+
+        double total;
+
+        double minimum, maximum;
+
+        Implementation(const unsigned & compression) :
+            compression(std::max(compression, 20u)),
+            total(0.0),
+            minimum(+std::numeric_limits<double>::infinity()),
+            maximum(-std::numeric_limits<double>::infinity())
+        {
+            buffer.reserve(8u * this->compression);
+        }
+
+        // the k_1 scale function of the merging t-digest; its unit steps
+        // bound the centroid sizes, keeping the tails finely resolved
+        double k(const double & q) const
+        {
+            return compression / (2.0 * M_PI) * std::asin(2.0 * q - 1.0);
+        }
+
+        void compress()
+        {
+            if (buffer.empty())
+                return;
+
+            centroids.insert(centroids.end(), buffer.begin(), buffer.end());
+            buffer.clear();
+
+            std::sort(centroids.begin(), centroids.end(), [] (const Centroid & a, const Centroid & b) { return a.mean < b.mean; });
+
+            std::vector<Centroid> merged;
+            merged.reserve(2u * compression);
+
+            double so_far = 0.0;
+            Centroid current = centroids.front();
+            for (auto c = centroids.begin() + 1, c_end = centroids.end() ; c != c_end ; ++c)
+            {
+                const double q_lower = so_far / total;
+                const double q_upper = (so_far + current.weight + c->weight) / total;
+
+                if (k(q_upper) - k(q_lower) <= 1.0)
+                {
+                    current.mean = (current.mean * current.weight + c->mean * c->weight) / (current.weight + c->weight);
+                    current.weight += c->weight;
+                }
+                else
+                {
+                    merged.push_back(current);
+                    so_far += current.weight;
+                    current = *c;
+                }
+            }
+            merged.push_back(current);
+
+            centroids.swap(merged);
+        }
+
+        void add(const double & value, const double & weight)
+        {
+            if (! std::isfinite(value))
+                throw InternalError("QuantileSketch::add(): value '" + stringify(value) + "' is not finite");
+
+            if ((! std::isfinite(weight)) || (weight < 0.0))
+                throw InternalError("QuantileSketch::add(): weight '" + stringify(weight) + "' is not finite and non-negative");
+
+            if (0.0 == weight)
+                return;
+
+            buffer.push_back(Centroid{ value, weight });
+            total += weight;
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+
+            if (buffer.size() >= 8u * compression)
+            {
+                compress();
+            }
+        }
+
+        double quantile(const double & p)
+        {
+            compress();
+
+            if (1 == centroids.size())
+                return centroids.front().mean;
+
+            const double target = p * total;
+
+            // below the first half centroid, interpolate from the exact minimum
+            const double first_half = 0.5 * centroids.front().weight;
+            if (target <= first_half)
+                return minimum + target / first_half * (centroids.front().mean - minimum);
+
+            // above the last half centroid, interpolate towards the exact maximum
+            const double last_half = 0.5 * centroids.back().weight;
+            if (target >= total - last_half)
+                return maximum - (total - target) / last_half * (maximum - centroids.back().mean);
+
+            // otherwise interpolate between the bracketing centroid means
+            double so_far = 0.0;
+            for (auto c = centroids.begin(), c_end = centroids.end() - 1 ; c != c_end ; ++c)
+            {
+                const double position_this = so_far + 0.5 * c->weight;
+                const double position_next = so_far + c->weight + 0.5 * (c + 1)->weight;
+
+                if ((position_this <= target) && (target <= position_next))
+                    return c->mean + (target - position_this) / (position_next - position_this) * ((c + 1)->mean - c->mean);
+
+                so_far += c->weight;
+            }
+
+            return centroids.back().mean;
+        }
+    };
+
+    QuantileSketch::QuantileSketch(const unsigned & compression) :
+        PrivateImplementationPattern<QuantileSketch>(new Implementation<QuantileSketch>(compression))
+    {
+    }
+
+    QuantileSketch::~QuantileSketch() = default;
+
+    void
+    QuantileSketch::add(const double & value, const double & weight)
+    {
+        _imp->add(value, weight);
+    }
+
+    void
+    QuantileSketch::merge(const QuantileSketch & other)
+    {
+        // copy first, so that merging a sketch into itself (or into one that
+        // shares its implementation) remains well defined
+        std::vector<Centroid> pending(other._imp->centroids);
+        pending.insert(pending.end(), other._imp->buffer.begin(), other._imp->buffer.end());
+
+        for (const auto & c : pending)
+        {
+            _imp->add(c.mean, c.weight);
+        }
+    }
+
+    double
+    QuantileSketch::total_weight() const
+    {
+        return _imp->total;
+    }
+
+    double
+    QuantileSketch::min() const
+    {
+        if (_imp->total <= 0.0)
+            throw InternalError("QuantileSketch::min(): sketch is empty");
+
+        return _imp->minimum;
+    }
+
+    double
+    QuantileSketch::max() const
+    {
+        if (_imp->total <= 0.0)
+            throw InternalError("QuantileSketch::max(): sketch is empty");
+
+        return _imp->maximum;
+    }
+
+    double
+    QuantileSketch::quantile(const double & p) const
+    {
+        if (_imp->total <= 0.0)
+            throw InternalError("QuantileSketch::quantile(): sketch is empty");
+
+        if ((p < 0.0) || (p > 1.0))
+            throw InternalError("QuantileSketch::quantile(): probability '" + stringify(p) + "' is outside [0, 1]");
+
+        return _imp->quantile(p);
+    }
+
+    std::pair<double, double>
+    QuantileSketch::hpd_interval(const double & level) const
+    {
+        if (_imp->total <= 0.0)
+            throw InternalError("QuantileSketch::hpd_interval(): sketch is empty");
+
+        if ((level <= 0.0) || (level >= 1.0))
+            throw InternalError("QuantileSketch::hpd_interval(): level '" + stringify(level) + "' is outside (0, 1)");
+
+        // scan the lower endpoint's probability over a fine grid and keep the
+        // narrowest interval that contains the requested mass
+        static const unsigned n_probes = 256;
+
+        double best_lower = _imp->quantile(0.0);
+        double best_upper = _imp->quantile(level);
+        for (unsigned i = 1 ; i <= n_probes ; ++i)
+        {
+            const double p = (1.0 - level) * i / n_probes;
+
+            const double lower = _imp->quantile(p);
+            const double upper = _imp->quantile(p + level);
+            if (upper - lower < best_upper - best_lower)
+            {
+                best_lower = lower;
+                best_upper = upper;
+            }
+        }
+
+        return std::make_pair(best_lower, best_upper);
+    }
+}
@@ -0,0 +1,106 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_QUANTILE_SKETCH_HH
+#define EOS_GUARD_EOS_STATISTICS_QUANTILE_SKETCH_HH 1
+
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <utility>
+
+namespace eos
+{
+    /*!
+     * QuantileSketch summarizes a stream of weighted values in a bounded
+     * number of centroids, from which weighted quantiles and credible
+     * intervals can be extracted without retaining the full stream.
+     *
+     * The summary follows the merging t-digest: incoming values are buffered
+     * and periodically folded into a sorted list of (mean, weight) centroids,
+     * whose sizes are limited by a scale function that keeps the tails finely
+     * resolved. Mid-range quantiles of a long stream are accurate to a few
+     * permille at the default compression; the extreme quantiles are exact,
+     * since the minimum and maximum are tracked separately. Sketches filled
+     * on different threads can be merged into one summary.
+     */
+    class QuantileSketch :
+        public PrivateImplementationPattern<QuantileSketch>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param compression Bound on the number of centroids; larger values trade memory for accuracy.
+             */
+            QuantileSketch(const unsigned & compression = 200);
+
+            /// Destructor.
+            ~QuantileSketch();
+            ///@}
+
+            ///@name Streaming
+            ///@{
+            /*!
+             * Add one value to the stream.
+             *
+             * @param value  The value; must be finite.
+             * @param weight The value's weight; must be finite and non-negative. Zero-weight values are ignored.
+             */
+            void add(const double & value, const double & weight = 1.0);
+
+            /// Fold another sketch's summary into this one.
+            void merge(const QuantileSketch & other);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the total weight of the stream so far.
+            double total_weight() const;
+
+            /// Retrieve the smallest value of the stream; throws InternalError on an empty sketch.
+            double min() const;
+
+            /// Retrieve the largest value of the stream; throws InternalError on an empty sketch.
+            double max() const;
+
+            /*!
+             * Retrieve the weighted quantile at probability p in [0, 1].
+             *
+             * Interpolates linearly between the centroid means; throws
+             * InternalError on an empty sketch.
+             */
+            double quantile(const double & p) const;
+
+            /*!
+             * Retrieve the shortest interval that contains the given
+             * probability mass, as a (lower, upper) pair.
+             *
+             * For unimodal marginal densities this coincides with the
+             * highest-posterior-density (HPD) credible interval. The level
+             * must lie strictly between 0 and 1; throws InternalError on an
+             * empty sketch.
+             */
+            std::pair<double, double> hpd_interval(const double & level) const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,138 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/quantile-sketch.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // deterministic pseudo-uniform values in [0, 1)
+    double lcg(unsigned long & state)
+    {
+        state = (6364136223846793005ul * state + 1442695040888963407ul);
+
+        return (state >> 11) * 0x1.0p-53;
+    }
+}
+
+class QuantileSketchTest :
+    public TestCase
+{
+    public:
+        QuantileSketchTest() :
+            TestCase("quantile_sketch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // quantiles of a shuffled uniform stream
+            {
+                QuantileSketch sketch;
+
+                unsigned long state = 42;
+                for (unsigned i = 0 ; i < 100000 ; ++i)
+                {
+                    sketch.add(lcg(state));
+                }
+
+                TEST_CHECK_EQUAL(sketch.total_weight(), 100000.0);
+                TEST_CHECK_EQUAL(sketch.quantile(0.0), sketch.min());
+                TEST_CHECK_EQUAL(sketch.quantile(1.0), sketch.max());
+
+                TEST_CHECK_NEARLY_EQUAL(sketch.quantile(0.15865), 0.15865, 5e-3);
+                TEST_CHECK_NEARLY_EQUAL(sketch.quantile(0.5),     0.5,     5e-3);
+                TEST_CHECK_NEARLY_EQUAL(sketch.quantile(0.84135), 0.84135, 5e-3);
+            }
+
+            // weights shift the quantiles: weighting values above 1/2 three
+            // times as much moves the median up to 2/3
+            {
+                QuantileSketch sketch;
+
+                unsigned long state = 13;
+                for (unsigned i = 0 ; i < 100000 ; ++i)
+                {
+                    const double x = lcg(state);
+                    sketch.add(x, x < 0.5 ? 1.0 : 3.0);
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(sketch.quantile(0.5), 2.0 / 3.0, 5e-3);
+            }
+
+            // sketches filled on disjoint parts of the stream merge into the
+            // summary of the full stream
+            {
+                QuantileSketch lower, upper, merged;
+
+                unsigned long state = 7;
+                for (unsigned i = 0 ; i < 50000 ; ++i)
+                {
+                    lower.add(0.5 * lcg(state));
+                    upper.add(0.5 + 0.5 * lcg(state));
+                }
+
+                merged.merge(lower);
+                merged.merge(upper);
+
+                TEST_CHECK_EQUAL(merged.total_weight(), 100000.0);
+                TEST_CHECK_NEARLY_EQUAL(merged.quantile(0.25), 0.25, 5e-3);
+                TEST_CHECK_NEARLY_EQUAL(merged.quantile(0.5),  0.5,  5e-3);
+                TEST_CHECK_NEARLY_EQUAL(merged.quantile(0.75), 0.75, 5e-3);
+            }
+
+            // for a density rising towards its upper edge, the shortest
+            // interval hugs that edge
+            {
+                QuantileSketch sketch;
+
+                unsigned long state = 23;
+                for (unsigned i = 0 ; i < 100000 ; ++i)
+                {
+                    // density 2 x on [0, 1]: mode at 1
+                    sketch.add(std::sqrt(lcg(state)));
+                }
+
+                const auto [lower, upper] = sketch.hpd_interval(0.68);
+                TEST_CHECK_NEARLY_EQUAL(upper, 1.0, 5e-3);
+                TEST_CHECK_NEARLY_EQUAL(lower, std::sqrt(1.0 - 0.68), 5e-3);
+            }
+
+            // invalid uses
+            {
+                QuantileSketch sketch;
+
+                TEST_CHECK_THROWS(InternalError, sketch.quantile(0.5));
+                TEST_CHECK_THROWS(InternalError, sketch.min());
+                TEST_CHECK_THROWS(InternalError, sketch.hpd_interval(0.68));
+                TEST_CHECK_THROWS(InternalError, sketch.add(std::nan("")));
+                TEST_CHECK_THROWS(InternalError, sketch.add(1.0, -1.0));
+
+                sketch.add(1.0);
+                TEST_CHECK_THROWS(InternalError, sketch.quantile(1.5));
+                TEST_CHECK_THROWS(InternalError, sketch.hpd_interval(1.0));
+            }
+        }
+} quantile_sketch_test;
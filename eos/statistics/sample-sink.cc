@@ -0,0 +1,300 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/sample-sink.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+namespace fs = boost::filesystem;
+
+namespace eos
+{
+    namespace
+    {
+        // fixed size of the NPY v1.0 preamble written to each file; large
+        // enough that the final shape can be patched in upon finalization
+        constexpr unsigned npy_header_size = 128;
+
+        /*
+         * Format a complete NPY v1.0 header (magic string, version, header
+         * length, and the padded dictionary) for a float64 array of the given
+         * shape; columns == 0 denotes a one-dimensional array.
+         */
+        std::string npy_header(const unsigned long & rows, const unsigned & columns)
+        {
+            std::string dict = "{'descr': '<f8', 'fortran_order': False, 'shape': (" + std::to_string(rows);
+            if (columns > 0)
+            {
+                dict += ", " + std::to_string(columns);
+            }
+            else
+            {
+                dict += ",";
+            }
+            dict += "), }";
+
+            std::string result = "\x93NUMPY";
+            result += '\x01';
+            result += '\x00';
+            const unsigned dict_size = npy_header_size - result.size() - 2;
+            result += static_cast<char>(dict_size & 0xff);
+            result += static_cast<char>((dict_size >> 8) & 0xff);
+
+            if (dict.size() + 1 > dict_size)
+                throw InternalError("SampleSink: NPY header dictionary exceeds its fixed size");
+
+            dict.resize(dict_size - 1, ' ');
+            result += dict;
+            result += '\n';
+
+            return result;
+        }
+    }
+
+    template <> struct Implementation<SampleSink>
+    {
+        std::string path;
+
+        unsigned dimension;
+
+        bool with_posterior_values;
+
+        unsigned capacity;
+
+        std::ofstream samples_file, weights_file, posterior_values_file;
+
+        std::vector<double> samples_buffer, weights_buffer, posterior_values_buffer;
+
+        // one streaming summary per column; constructed one by one, since
+        // copies of a QuantileSketch share their state
+        std::vector<QuantileSketch> sketches;
+
+        unsigned long rows;
+
+        bool closed;
+
+        Implementation(const std::string & path, const unsigned & dimension,
+                const bool & with_posterior_values, const unsigned & capacity) :
+            path(path),
+            dimension(dimension),
+            with_posterior_values(with_posterior_values),
+            capacity(std::max(capacity, 1u)),
+            rows(0),
+            closed(false)
+        {
+            if (0 == dimension)
+                throw InternalError("SampleSink: dimension must be at least 1");
+
+            fs::create_directories(fs::path(path));
+
+            open(samples_file, "samples.npy", this->dimension);
+            open(weights_file, "weights.npy", 0);
+            if (with_posterior_values)
+            {
+                open(posterior_values_file, "posterior_values.npy", 0);
+            }
+
+            for (unsigned d = 0 ; d < dimension ; ++d)
+            {
+                sketches.push_back(QuantileSketch());
+            }
+
+            samples_buffer.reserve(static_cast<std::size_t>(this->capacity) * dimension);
+            weights_buffer.reserve(this->capacity);
+            if (with_posterior_values)
+            {
+                posterior_values_buffer.reserve(this->capacity);
+            }
+        }
+
+        ~Implementation()
+        {
+            try
+            {
+                finalize();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        void open(std::ofstream & file, const std::string & name, const unsigned & columns)
+        {
+            file.open((fs::path(path) / name).string(), std::ios::binary | std::ios::trunc);
+            if (! file)
+                throw InternalError("SampleSink: cannot open '" + (fs::path(path) / name).string() + "' for writing");
+
+            // placeholder header; the true number of rows is patched in upon finalization
+            const std::string header = npy_header(0, columns);
+            file.write(header.data(), header.size());
+        }
+
+        void sketch_row(const std::vector<double> & sample, const double & weight)
+        {
+            for (unsigned d = 0 ; d < dimension ; ++d)
+            {
+                sketches[d].add(sample[d], weight);
+            }
+        }
+
+        void drain(std::ofstream & file, std::vector<double> & buffer)
+        {
+            if (buffer.empty())
+                return;
+
+            file.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(double));
+            if (! file)
+                throw InternalError("SampleSink: writing to '" + path + "' failed");
+
+            buffer.clear();
+        }
+
+        void flush()
+        {
+            drain(samples_file, samples_buffer);
+            drain(weights_file, weights_buffer);
+            if (with_posterior_values)
+            {
+                drain(posterior_values_file, posterior_values_buffer);
+            }
+        }
+
+        void patch_header(std::ofstream & file, const unsigned & columns)
+        {
+            const std::string header = npy_header(rows, columns);
+            file.seekp(0);
+            file.write(header.data(), header.size());
+            file.close();
+        }
+
+        void finalize()
+        {
+            if (closed)
+                return;
+
+            flush();
+
+            patch_header(samples_file, dimension);
+            patch_header(weights_file, 0);
+            if (with_posterior_values)
+            {
+                patch_header(posterior_values_file, 0);
+            }
+
+            closed = true;
+        }
+    };
+
+    SampleSink::SampleSink(const std::string & path, const unsigned & dimension,
+            const bool & with_posterior_values, const unsigned & capacity) :
+        PrivateImplementationPattern<SampleSink>(new Implementation<SampleSink>(path, dimension, with_posterior_values, capacity))
+    {
+    }
+
+    SampleSink::~SampleSink() = default;
+
+    void
+    SampleSink::append(const std::vector<double> & sample, const double & weight)
+    {
+        if (_imp->with_posterior_values)
+            throw InternalError("SampleSink::append(): this sink streams posterior values; use the three-argument overload");
+
+        if (_imp->closed)
+            throw InternalError("SampleSink::append(): sink has already been closed");
+
+        if (sample.size() != _imp->dimension)
+            throw InternalError("SampleSink::append(): sample of dimension " + std::to_string(sample.size())
+                    + " does not match the sink's dimension " + std::to_string(_imp->dimension));
+
+        _imp->samples_buffer.insert(_imp->samples_buffer.end(), sample.begin(), sample.end());
+        _imp->weights_buffer.push_back(weight);
+        _imp->sketch_row(sample, weight);
+        ++_imp->rows;
+
+        if (_imp->weights_buffer.size() >= _imp->capacity)
+        {
+            _imp->flush();
+        }
+    }
+
+    void
+    SampleSink::append(const std::vector<double> & sample, const double & weight, const double & posterior_value)
+    {
+        if (! _imp->with_posterior_values)
+            throw InternalError("SampleSink::append(): this sink does not stream posterior values; use the two-argument overload");
+
+        if (_imp->closed)
+            throw InternalError("SampleSink::append(): sink has already been closed");
+
+        if (sample.size() != _imp->dimension)
+            throw InternalError("SampleSink::append(): sample of dimension " + std::to_string(sample.size())
+                    + " does not match the sink's dimension " + std::to_string(_imp->dimension));
+
+        _imp->samples_buffer.insert(_imp->samples_buffer.end(), sample.begin(), sample.end());
+        _imp->weights_buffer.push_back(weight);
+        _imp->posterior_values_buffer.push_back(posterior_value);
+        _imp->sketch_row(sample, weight);
+        ++_imp->rows;
+
+        if (_imp->weights_buffer.size() >= _imp->capacity)
+        {
+            _imp->flush();
+        }
+    }
+
+    void
+    SampleSink::flush()
+    {
+        _imp->flush();
+    }
+
+    void
+    SampleSink::close()
+    {
+        _imp->finalize();
+    }
+
+    unsigned
+    SampleSink::dimension() const
+    {
+        return _imp->dimension;
+    }
+
+    unsigned long
+    SampleSink::size() const
+    {
+        return _imp->rows;
+    }
+
+    QuantileSketch
+    SampleSink::sketch(const unsigned & column) const
+    {
+        if (column >= _imp->dimension)
+            throw InternalError("SampleSink::sketch(): column " + std::to_string(column)
+                    + " does not exist in a sink of dimension " + std::to_string(_imp->dimension));
+
+        return _imp->sketches[column];
+    }
+}
@@ -0,0 +1,102 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_SAMPLE_SINK_HH
+#define EOS_GUARD_EOS_STATISTICS_SAMPLE_SINK_HH 1
+
+#include <eos/statistics/quantile-sketch.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * SampleSink streams samples, their weights, and optionally the associated
+     * log-posterior values to NumPy-compatible files on disk as they are
+     * produced.
+     *
+     * Rows are buffered in memory and written out whenever the buffer's
+     * capacity is reached, so the memory footprint of a sampling run is bounded
+     * by the buffer instead of the run length. The files -- samples.npy and
+     * weights.npy, plus posterior_values.npy when requested -- match the
+     * directory layout read by the eos.data classes on the Python side.
+     *
+     * Alongside the files, the sink maintains one QuantileSketch per column,
+     * updated with each appended row. Weighted quantiles and credible
+     * intervals of every tracked column are therefore available as soon as
+     * the stream ends, without re-reading and sorting the files.
+     */
+    class SampleSink :
+        public PrivateImplementationPattern<SampleSink>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param path       Directory to which the files are written; created if it does not exist.
+             * @param dimension  Number of columns per sample.
+             * @param with_posterior_values Whether a posterior_values.npy stream shall be written, too.
+             * @param capacity   Number of rows buffered in memory between writes.
+             */
+            SampleSink(const std::string & path, const unsigned & dimension,
+                    const bool & with_posterior_values = false, const unsigned & capacity = 16384);
+
+            /// Destructor; finalizes the files on disk.
+            ~SampleSink();
+            ///@}
+
+            ///@name Streaming
+            ///@{
+            /// Append one sample together with its weight.
+            void append(const std::vector<double> & sample, const double & weight);
+
+            /// Append one sample together with its weight and its log-posterior value.
+            void append(const std::vector<double> & sample, const double & weight, const double & posterior_value);
+
+            /// Write all buffered rows to disk.
+            void flush();
+
+            /// Flush and finalize the files; appending afterwards is an error.
+            void close();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of columns per sample.
+            unsigned dimension() const;
+
+            /// Retrieve the number of samples appended so far.
+            unsigned long size() const;
+
+            /*!
+             * Retrieve the quantile sketch of one column.
+             *
+             * The returned sketch shares its state with the sink, and keeps
+             * accumulating as further rows are appended.
+             */
+            QuantileSketch sketch(const unsigned & column) const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,147 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/sample-sink.hh>
+#include <eos/utils/exception.hh>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+    struct NpyFile
+    {
+        std::string header;
+
+        std::vector<double> data;
+    };
+
+    NpyFile read_npy(const fs::path & file_name)
+    {
+        std::ifstream file(file_name.string(), std::ios::binary);
+        TEST_CHECK(file.good());
+
+        NpyFile result;
+        result.header.resize(128);
+        file.read(&result.header[0], 128);
+
+        double value;
+        while (file.read(reinterpret_cast<char *>(&value), sizeof(double)))
+        {
+            result.data.push_back(value);
+        }
+
+        return result;
+    }
+}
+
+class SampleSinkTest :
+    public TestCase
+{
+    public:
+        SampleSinkTest() :
+            TestCase("sample_sink_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            const fs::path path = fs::temp_directory_path() / ("eos-sample-sink-test-" + std::to_string(getpid()));
+
+            // stream more rows than the buffer capacity and verify the files
+            {
+                {
+                    SampleSink sink(path.string(), 2, true, 16);
+
+                    TEST_CHECK_EQUAL(2u, sink.dimension());
+
+                    for (unsigned i = 0 ; i < 100 ; ++i)
+                    {
+                        sink.append(std::vector<double>{ 1.0 * i, 2.0 * i }, 0.5 * i, -1.0 * i);
+                    }
+
+                    TEST_CHECK_EQUAL(100ul, sink.size());
+
+                    sink.close();
+
+                    // appending to a closed sink is an error
+                    TEST_CHECK_THROWS(InternalError, sink.append(std::vector<double>{ 1.0, 2.0 }, 1.0, -1.0));
+                }
+
+                auto samples = read_npy(path / "samples.npy");
+                auto weights = read_npy(path / "weights.npy");
+                auto posterior_values = read_npy(path / "posterior_values.npy");
+
+                TEST_CHECK(std::string::npos != samples.header.find("'shape': (100, 2)"));
+                TEST_CHECK(std::string::npos != weights.header.find("'shape': (100,)"));
+                TEST_CHECK(std::string::npos != posterior_values.header.find("'shape': (100,)"));
+
+                TEST_CHECK_EQUAL(200u, samples.data.size());
+                TEST_CHECK_EQUAL(100u, weights.data.size());
+                TEST_CHECK_EQUAL(100u, posterior_values.data.size());
+
+                TEST_CHECK_EQUAL(99.0,  samples.data[198]);
+                TEST_CHECK_EQUAL(198.0, samples.data[199]);
+                TEST_CHECK_EQUAL(49.5,  weights.data[99]);
+                TEST_CHECK_EQUAL(-99.0, posterior_values.data[99]);
+            }
+
+            // mismatching sample dimension and overload misuse are errors
+            {
+                SampleSink sink((path / "plain").string(), 3);
+
+                TEST_CHECK_THROWS(InternalError, sink.append(std::vector<double>{ 1.0, 2.0 }, 1.0));
+                TEST_CHECK_THROWS(InternalError, sink.append(std::vector<double>{ 1.0, 2.0, 3.0 }, 1.0, -1.0));
+
+                sink.append(std::vector<double>{ 1.0, 2.0, 3.0 }, 1.0);
+            }
+
+            // the per-column sketches summarize the stream as it is appended
+            {
+                SampleSink sink((path / "sketches").string(), 2);
+
+                for (unsigned i = 0 ; i < 1001 ; ++i)
+                {
+                    sink.append(std::vector<double>{ 0.001 * i, 1.0 - 0.001 * i }, 1.0);
+                }
+
+                TEST_CHECK_EQUAL(sink.sketch(0).total_weight(), 1001.0);
+                TEST_CHECK_NEARLY_EQUAL(sink.sketch(0).quantile(0.5), 0.5, 5e-3);
+                TEST_CHECK_NEARLY_EQUAL(sink.sketch(1).quantile(0.25), 0.25, 5e-3);
+                TEST_CHECK_EQUAL(sink.sketch(0).min(), 0.0);
+                TEST_CHECK_EQUAL(sink.sketch(0).max(), 1.0);
+
+                TEST_CHECK_THROWS(InternalError, sink.sketch(2));
+            }
+
+            fs::remove_all(path);
+        }
+} sample_sink_test;
@@ -41,6 +41,8 @@ namespace eos
                 double chi2;
                 int dof;
                 double signed_chi;
+                /// Local p value; NaN until filled in, e.g. by GoodnessOfFit.
+                double local_p_value;
 
                 ChiSquare(const double & chi2, const int & dof, const double & signed_chi);
 
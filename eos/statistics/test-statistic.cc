@@ -39,7 +39,8 @@ namespace eos
         ChiSquare::ChiSquare(const double & chi2, const int & dof, const double & signed_chi) :
             chi2(chi2),
             dof(dof),
-            signed_chi(signed_chi)
+            signed_chi(signed_chi),
+            local_p_value(std::numeric_limits<double>::quiet_NaN())
         {
         }
 
@@ -0,0 +1,134 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/allocation-tracker.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+
+#include <string>
+
+namespace eos
+{
+    template class InstantiationPolicy<AllocationTracker, Singleton>;
+
+    AllocationTracker::AllocationTracker() :
+        _enabled(false)
+    {
+        reset();
+    }
+
+    AllocationTracker::~AllocationTracker() = default;
+
+    void
+    AllocationTracker::enable()
+    {
+        _enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void
+    AllocationTracker::disable()
+    {
+        _enabled.store(false, std::memory_order_relaxed);
+    }
+
+    bool
+    AllocationTracker::enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void
+    AllocationTracker::record_allocation(const AllocationArena & arena, const std::size_t & bytes)
+    {
+        if (! _enabled.load(std::memory_order_relaxed))
+            return;
+
+        Counters & counters = _counters[static_cast<unsigned>(arena)];
+
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t live = counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+        // advance the high-water mark; concurrent updates race benignly
+        // toward the maximum
+        std::size_t peak = counters.peak_bytes.load(std::memory_order_relaxed);
+        while ((live > peak) && (! counters.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)))
+        {
+        }
+    }
+
+    void
+    AllocationTracker::record_deallocation(const AllocationArena & arena, const std::size_t & bytes)
+    {
+        if (! _enabled.load(std::memory_order_relaxed))
+            return;
+
+        Counters & counters = _counters[static_cast<unsigned>(arena)];
+
+        counters.live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    std::size_t
+    AllocationTracker::live_bytes(const AllocationArena & arena) const
+    {
+        return _counters[static_cast<unsigned>(arena)].live_bytes.load(std::memory_order_relaxed);
+    }
+
+    std::size_t
+    AllocationTracker::peak_bytes(const AllocationArena & arena) const
+    {
+        return _counters[static_cast<unsigned>(arena)].peak_bytes.load(std::memory_order_relaxed);
+    }
+
+    std::size_t
+    AllocationTracker::allocations(const AllocationArena & arena) const
+    {
+        return _counters[static_cast<unsigned>(arena)].allocations.load(std::memory_order_relaxed);
+    }
+
+    void
+    AllocationTracker::reset()
+    {
+        for (auto & counters : _counters)
+        {
+            counters.live_bytes.store(0, std::memory_order_relaxed);
+            counters.peak_bytes.store(0, std::memory_order_relaxed);
+            counters.allocations.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    Diagnostics
+    AllocationTracker::diagnostics() const
+    {
+        static const std::array<std::string, 3> names
+        {
+            "maths", "form-factors", "statistics"
+        };
+
+        Diagnostics result;
+        for (auto a = 0u ; a < _counters.size() ; ++a)
+        {
+            const AllocationArena arena = static_cast<AllocationArena>(a);
+
+            result.add(Diagnostics::Entry{ static_cast<double>(live_bytes(arena)),  names[a] + ": live bytes" });
+            result.add(Diagnostics::Entry{ static_cast<double>(peak_bytes(arena)),  names[a] + ": peak bytes" });
+            result.add(Diagnostics::Entry{ static_cast<double>(allocations(arena)), names[a] + ": allocations" });
+        }
+
+        return result;
+    }
+}
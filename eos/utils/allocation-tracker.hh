@@ -0,0 +1,168 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_ALLOCATION_TRACKER_HH
+#define EOS_GUARD_EOS_UTILS_ALLOCATION_TRACKER_HH 1
+
+#include <eos/utils/diagnostics.hh>
+#include <eos/utils/instantiation_policy.hh>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace eos
+{
+    /// Subsystem arenas for which allocator traffic is tracked separately.
+    enum class AllocationArena : unsigned
+    {
+        maths = 0,
+        form_factors,
+        statistics
+    };
+
+    /*!
+     * AllocationTracker records allocator traffic per subsystem arena.
+     *
+     * Tracking is opt-in on two levels: a container takes part by using
+     * ArenaAllocator as its allocator, and the recording is armed at run
+     * time through enable(). While disarmed, recording reduces to a single
+     * relaxed atomic load per allocation.
+     *
+     * For each arena, the tracker keeps the presently live byte count, its
+     * high-water mark, and the number of allocations. The counters can be
+     * queried directly or collected into a Diagnostics object; they quantify
+     * the allocator traffic behind a given computation, and provide
+     * measurable targets for future arena adoption.
+     */
+    class AllocationTracker :
+        public InstantiationPolicy<AllocationTracker, Singleton>
+    {
+        private:
+            struct Counters
+            {
+                std::atomic<std::size_t> live_bytes;
+                std::atomic<std::size_t> peak_bytes;
+                std::atomic<std::size_t> allocations;
+            };
+
+            std::atomic<bool> _enabled;
+
+            std::array<Counters, 3> _counters;
+
+            /// Constructor.
+            AllocationTracker();
+
+        public:
+            friend class InstantiationPolicy<AllocationTracker, Singleton>;
+
+            /// Destructor.
+            ~AllocationTracker();
+
+            ///@name Arming the instrumentation
+            ///@{
+            /// Arm the recording of allocator traffic.
+            void enable();
+
+            /// Disarm the recording of allocator traffic.
+            void disable();
+
+            /// Return whether recording is presently armed.
+            bool enabled() const;
+            ///@}
+
+            ///@name Recording
+            ///@{
+            /// Record an allocation of bytes in the given arena.
+            void record_allocation(const AllocationArena & arena, const std::size_t & bytes);
+
+            /// Record a deallocation of bytes in the given arena.
+            void record_deallocation(const AllocationArena & arena, const std::size_t & bytes);
+            ///@}
+
+            ///@name Access to the counters
+            ///@{
+            /// Retrieve the number of presently live bytes in the given arena.
+            std::size_t live_bytes(const AllocationArena & arena) const;
+
+            /// Retrieve the high-water mark of live bytes in the given arena.
+            std::size_t peak_bytes(const AllocationArena & arena) const;
+
+            /// Retrieve the number of allocations recorded in the given arena.
+            std::size_t allocations(const AllocationArena & arena) const;
+
+            /// Reset all counters to zero.
+            void reset();
+
+            /// Collect all counters into a Diagnostics object.
+            Diagnostics diagnostics() const;
+            ///@}
+    };
+
+    /*!
+     * Standard-library-compatible allocator that records its traffic in the
+     * AllocationTracker under the given subsystem arena.
+     */
+    template <typename T_, AllocationArena arena_>
+    class ArenaAllocator
+    {
+        public:
+            using value_type = T_;
+
+            ArenaAllocator() = default;
+
+            template <typename U_>
+            ArenaAllocator(const ArenaAllocator<U_, arena_> &)
+            {
+            }
+
+            template <typename U_>
+            struct rebind
+            {
+                using other = ArenaAllocator<U_, arena_>;
+            };
+
+            T_ * allocate(std::size_t n)
+            {
+                AllocationTracker::instance()->record_allocation(arena_, n * sizeof(T_));
+
+                return std::allocator<T_>().allocate(n);
+            }
+
+            void deallocate(T_ * p, std::size_t n)
+            {
+                AllocationTracker::instance()->record_deallocation(arena_, n * sizeof(T_));
+
+                std::allocator<T_>().deallocate(p, n);
+            }
+
+            bool operator== (const ArenaAllocator &) const
+            {
+                return true;
+            }
+
+            bool operator!= (const ArenaAllocator &) const
+            {
+                return false;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,97 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/allocation-tracker.hh>
+
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class AllocationTrackerTest :
+    public TestCase
+{
+    public:
+        AllocationTrackerTest() :
+            TestCase("allocation_tracker_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            auto tracker = AllocationTracker::instance();
+
+            // recording is disarmed by default
+            {
+                TEST_CHECK(! tracker->enabled());
+
+                std::vector<double, ArenaAllocator<double, AllocationArena::maths>> v(128);
+
+                TEST_CHECK_EQUAL(tracker->allocations(AllocationArena::maths), 0u);
+                TEST_CHECK_EQUAL(tracker->live_bytes(AllocationArena::maths),  0u);
+            }
+
+            // armed recording tracks live bytes, the high-water mark, and the
+            // number of allocations per arena
+            {
+                tracker->reset();
+                tracker->enable();
+
+                {
+                    std::vector<double, ArenaAllocator<double, AllocationArena::maths>> v(128);
+
+                    TEST_CHECK_EQUAL(tracker->allocations(AllocationArena::maths), 1u);
+                    TEST_CHECK_EQUAL(tracker->live_bytes(AllocationArena::maths),  128u * sizeof(double));
+                    TEST_CHECK_EQUAL(tracker->peak_bytes(AllocationArena::maths),  128u * sizeof(double));
+
+                    // other arenas are unaffected
+                    TEST_CHECK_EQUAL(tracker->allocations(AllocationArena::statistics), 0u);
+                }
+
+                // deallocation lowers the live byte count but not the high-water mark
+                TEST_CHECK_EQUAL(tracker->live_bytes(AllocationArena::maths), 0u);
+                TEST_CHECK_EQUAL(tracker->peak_bytes(AllocationArena::maths), 128u * sizeof(double));
+
+                tracker->disable();
+            }
+
+            // the counters are collected into a Diagnostics object, three
+            // entries per arena
+            {
+                Diagnostics diagnostics = tracker->diagnostics();
+                TEST_CHECK_EQUAL(diagnostics.size(), 9u);
+
+                auto d = diagnostics.begin();
+                TEST_CHECK_EQUAL(d->value, 0.0);                           // maths: live bytes
+                ++d;
+                TEST_CHECK_EQUAL(d->value, 128.0 * sizeof(double));        // maths: peak bytes
+                ++d;
+                TEST_CHECK_EQUAL(d->value, 1.0);                           // maths: allocations
+            }
+
+            // reset clears all counters
+            {
+                tracker->reset();
+
+                TEST_CHECK_EQUAL(tracker->allocations(AllocationArena::maths), 0u);
+                TEST_CHECK_EQUAL(tracker->peak_bytes(AllocationArena::maths),  0u);
+            }
+        }
+} allocation_tracker_test;
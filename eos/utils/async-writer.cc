@@ -0,0 +1,166 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/async-writer.hh>
+#include <eos/utils/condition_variable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread.hh>
+
+#include <deque>
+#include <memory>
+#include <ostream>
+
+namespace eos
+{
+    template <> struct Implementation<AsyncWriter>
+    {
+        std::ostream & stream;
+
+        const unsigned max_pending;
+
+        Mutex mutex;
+
+        // signalled when a buffer is enqueued or the writer shall terminate
+        ConditionVariable pending;
+
+        // signalled when the worker empties the queue or completes a buffer
+        ConditionVariable drained;
+
+        std::deque<std::string> queue;
+
+        // true whilst the worker holds a buffer that is not yet written out
+        bool writing;
+
+        bool terminate;
+
+        // started last, so that all other members are initialized before the worker runs
+        std::unique_ptr<Thread> worker;
+
+        Implementation(std::ostream & stream, const unsigned & max_pending) :
+            stream(stream),
+            max_pending(max_pending),
+            writing(false),
+            terminate(false)
+        {
+            if (0 == max_pending)
+                throw InternalError("AsyncWriter: max_pending must not be zero");
+
+            worker.reset(new Thread(std::bind(&Implementation<AsyncWriter>::work, this)));
+        }
+
+        ~Implementation()
+        {
+            {
+                Lock l(mutex);
+                terminate = true;
+                pending.broadcast();
+            }
+
+            // joins the worker, which drains the queue before terminating
+            worker.reset();
+
+            stream.flush();
+        }
+
+        void
+        work()
+        {
+            while (true)
+            {
+                std::string buffer;
+
+                {
+                    Lock l(mutex);
+
+                    while (queue.empty() && ! terminate)
+                    {
+                        pending.wait(mutex);
+                    }
+
+                    if (queue.empty())
+                        break;
+
+                    buffer = std::move(queue.front());
+                    queue.pop_front();
+                    writing = true;
+                }
+
+                // perform the I/O without holding the lock, so producers keep enqueueing
+                stream.write(buffer.data(), buffer.size());
+
+                {
+                    Lock l(mutex);
+                    writing = false;
+                    drained.broadcast();
+                }
+            }
+        }
+
+        void
+        enqueue(std::string && buffer)
+        {
+            Lock l(mutex);
+
+            while (queue.size() >= max_pending)
+            {
+                drained.wait(mutex);
+            }
+
+            queue.push_back(std::move(buffer));
+            pending.signal();
+        }
+
+        void
+        wait_for_drain()
+        {
+            Lock l(mutex);
+
+            while ((! queue.empty()) || writing)
+            {
+                drained.wait(mutex);
+            }
+        }
+    };
+
+    AsyncWriter::AsyncWriter(std::ostream & stream, const unsigned & max_pending) :
+        PrivateImplementationPattern<AsyncWriter>(new Implementation<AsyncWriter>(stream, max_pending))
+    {
+    }
+
+    AsyncWriter::~AsyncWriter() = default;
+
+    void
+    AsyncWriter::write(std::string && buffer)
+    {
+        if (buffer.empty())
+            return;
+
+        _imp->enqueue(std::move(buffer));
+    }
+
+    void
+    AsyncWriter::flush()
+    {
+        _imp->wait_for_drain();
+        _imp->stream.flush();
+    }
+}
@@ -0,0 +1,74 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_ASYNC_WRITER_HH
+#define EOS_GUARD_EOS_UTILS_ASYNC_WRITER_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <iosfwd>
+#include <string>
+
+namespace eos
+{
+    /*!
+     * Double-buffered asynchronous writer for bulk output.
+     *
+     * Buffers handed to write() are appended to a bounded queue and drained to
+     * the underlying stream by a dedicated worker thread, so that the producing
+     * thread returns to its work whilst the operating system performs the I/O.
+     * When the queue is full, write() blocks until the worker catches up, which
+     * bounds the memory held in flight. Buffers are written in the order in
+     * which they were handed over; both text and binary payloads are passed
+     * through unmodified.
+     *
+     * Destruction drains all pending buffers and flushes the stream.
+     */
+    class AsyncWriter :
+        public InstantiationPolicy<AsyncWriter, NonCopyable>,
+        public PrivateImplementationPattern<AsyncWriter>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param stream      The stream to which all buffers are written.
+             * @param max_pending The largest number of buffers held in the queue before write() blocks.
+             */
+            AsyncWriter(std::ostream & stream, const unsigned & max_pending = 4);
+
+            /// Destructor; drains all pending buffers and flushes the stream.
+            ~AsyncWriter();
+            ///@}
+
+            ///@name Output
+            ///@{
+            /// Hand over one buffer for writing; blocks only when the queue is full.
+            void write(std::string && buffer);
+
+            /// Block until all pending buffers are written, then flush the stream.
+            void flush();
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,97 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/async-writer.hh>
+
+#include <sstream>
+#include <string>
+
+using namespace test;
+using namespace eos;
+
+class AsyncWriterTest :
+    public TestCase
+{
+    public:
+        AsyncWriterTest() :
+            TestCase("async_writer_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // buffers come out in order and complete, with the destructor draining the queue
+            {
+                std::ostringstream stream;
+                std::string expected;
+
+                {
+                    AsyncWriter writer(stream);
+
+                    for (unsigned i = 0 ; i < 100 ; ++i)
+                    {
+                        std::string buffer = "buffer " + std::to_string(i) + "\n";
+                        expected += buffer;
+                        writer.write(std::move(buffer));
+                    }
+                }
+
+                TEST_CHECK_EQUAL(stream.str(), expected);
+            }
+
+            // flush() makes all previously written buffers visible
+            {
+                std::ostringstream stream;
+
+                AsyncWriter writer(stream, 2);
+                writer.write("first\n");
+                writer.write("second\n");
+                writer.flush();
+
+                TEST_CHECK_EQUAL(stream.str(), "first\nsecond\n");
+            }
+
+            // binary payloads, including embedded NUL bytes, pass through unmodified
+            {
+                std::ostringstream stream;
+                const std::string payload("\x00\x01\x02\xff", 4);
+
+                {
+                    AsyncWriter writer(stream);
+                    writer.write(std::string(payload));
+                }
+
+                TEST_CHECK_EQUAL(stream.str().size(), payload.size());
+                TEST_CHECK(stream.str() == payload);
+            }
+
+            // empty buffers are ignored
+            {
+                std::ostringstream stream;
+
+                {
+                    AsyncWriter writer(stream);
+                    writer.write(std::string());
+                }
+
+                TEST_CHECK_EQUAL(stream.str(), std::string());
+            }
+        }
+} async_writer_test;
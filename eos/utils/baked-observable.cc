@@ -0,0 +1,421 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/observable-impl.hh>
+#include <eos/utils/baked-observable.hh>
+#include <eos/utils/binary-io.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/options.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/wrapped_forward_iterator-impl.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace eos
+{
+    BakedObservableError::BakedObservableError(const std::string & message) throw () :
+        Exception("Baked observable error: " + message)
+    {
+    }
+
+    namespace baked
+    {
+        // magic bytes at the head of a baked-table file
+        static const char magic[8] = { 'E', 'O', 'S', 'B', 'A', 'K', 'E', '1' };
+
+        struct Axis
+        {
+            enum class Kind :
+                std::uint32_t
+            {
+                parameter = 0,
+                kinematic = 1
+            };
+
+            Kind kind;
+
+            std::string name;
+
+            // strictly increasing grid nodes; point into the file mapping
+            const double * grid;
+
+            std::uint32_t points;
+        };
+
+        struct Table
+        {
+            QualifiedName name;
+
+            std::string latex;
+
+            Unit unit;
+
+            // estimated maximal absolute interpolation error, as probed by the baker
+            double max_error;
+
+            std::vector<Axis> axes;
+
+            // tabulated values, row-major with the last axis fastest; point into the file mapping
+            const double * values;
+
+            // keeps the mapping alive for the lifetime of the table
+            std::shared_ptr<binary_io::MappedFile> file;
+
+            Table(const QualifiedName & name) :
+                name(name),
+                unit(Unit::Undefined()),
+                max_error(0.0),
+                values(nullptr)
+            {
+            }
+        };
+
+        using TablePtr = std::shared_ptr<const Table>;
+    }
+
+    /*
+     * Observable backed by a baked table; evaluates by multilinear
+     * interpolation on the table's memory-mapped value array.
+     */
+    class BakedObservable :
+        public Observable
+    {
+        private:
+            baked::TablePtr _table;
+
+            Parameters _parameters;
+
+            Kinematics _kinematics;
+
+            Options _options;
+
+            // per-axis handles to the interpolation coordinates, in axis order
+            std::vector<Parameter> _parameter_handles;
+
+            std::vector<KinematicVariable> _kinematic_handles;
+
+            // per-axis index into the handle vector matching the axis' kind
+            std::vector<unsigned> _handle_indices;
+
+            // scratch for the cell indices and normalized offsets per axis
+            mutable std::vector<unsigned> _cell;
+
+            mutable std::vector<double> _frac;
+
+        public:
+            BakedObservable(const baked::TablePtr & table, const Parameters & parameters, const Kinematics & kinematics, const Options & options) :
+                _table(table),
+                _parameters(parameters),
+                _kinematics(kinematics),
+                _options(options),
+                _cell(table->axes.size(), 0),
+                _frac(table->axes.size(), 0.0)
+            {
+                for (const auto & axis : _table->axes)
+                {
+                    if (baked::Axis::Kind::parameter == axis.kind)
+                    {
+                        Parameter p = _parameters[QualifiedName(axis.name)];
+                        _handle_indices.push_back(_parameter_handles.size());
+                        _parameter_handles.push_back(p);
+                        this->uses(p.id());
+                    }
+                    else
+                    {
+                        _handle_indices.push_back(_kinematic_handles.size());
+                        _kinematic_handles.push_back(_kinematics[axis.name]);
+                    }
+                }
+            }
+
+            ~BakedObservable() = default;
+
+            virtual const QualifiedName &
+            name() const
+            {
+                return _table->name;
+            }
+
+            virtual double
+            evaluate() const
+            {
+                const auto & axes = _table->axes;
+                const unsigned d = axes.size();
+
+                // locate the cell and the normalized offset on each axis,
+                // clamping coordinates to the tabulated domain
+                for (unsigned k = 0 ; k < d ; ++k)
+                {
+                    const auto & axis = axes[k];
+                    const double x = (baked::Axis::Kind::parameter == axis.kind)
+                            ? _parameter_handles[_handle_indices[k]].evaluate()
+                            : _kinematic_handles[_handle_indices[k]].evaluate();
+
+                    if (x <= axis.grid[0])
+                    {
+                        _cell[k] = 0;
+                        _frac[k] = 0.0;
+                    }
+                    else if (x >= axis.grid[axis.points - 1])
+                    {
+                        _cell[k] = axis.points - 2;
+                        _frac[k] = 1.0;
+                    }
+                    else
+                    {
+                        const unsigned i = std::upper_bound(axis.grid, axis.grid + axis.points, x) - axis.grid - 1;
+                        _cell[k] = i;
+                        _frac[k] = (x - axis.grid[i]) / (axis.grid[i + 1] - axis.grid[i]);
+                    }
+                }
+
+                // accumulate the 2^d corner contributions of the enclosing cell
+                double result = 0.0;
+                for (unsigned corner = 0 ; corner < (1u << d) ; ++corner)
+                {
+                    double weight = 1.0;
+                    std::size_t index = 0;
+                    for (unsigned k = 0 ; k < d ; ++k)
+                    {
+                        const unsigned bit = (corner >> k) & 1u;
+                        weight *= bit ? _frac[k] : (1.0 - _frac[k]);
+                        index = index * axes[k].points + (_cell[k] + bit);
+                    }
+
+                    result += weight * _table->values[index];
+                }
+
+                return result;
+            }
+
+            /// Estimated maximal absolute interpolation error, as probed by the baker.
+            double
+            max_error() const
+            {
+                return _table->max_error;
+            }
+
+            virtual Kinematics
+            kinematics()
+            {
+                return _kinematics;
+            }
+
+            virtual Parameters
+            parameters()
+            {
+                return _parameters;
+            }
+
+            virtual Options
+            options()
+            {
+                return _options;
+            }
+
+            virtual ObservablePtr
+            clone() const
+            {
+                return ObservablePtr(new BakedObservable(_table, _parameters.clone(), _kinematics.clone(), _options));
+            }
+
+            virtual ObservablePtr
+            clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new BakedObservable(_table, parameters, _kinematics.clone(), _options));
+            }
+    };
+
+    class BakedObservableEntry :
+        public ObservableEntry
+    {
+        private:
+            baked::TablePtr _table;
+
+            std::vector<std::string> _kinematics_names;
+
+            std::vector<OptionSpecification> _option_specifications;
+
+        public:
+            BakedObservableEntry(const baked::TablePtr & table) :
+                _table(table)
+            {
+                for (const auto & axis : table->axes)
+                {
+                    if (baked::Axis::Kind::kinematic == axis.kind)
+                    {
+                        _kinematics_names.push_back(axis.name);
+                    }
+                }
+            }
+
+            ~BakedObservableEntry() = default;
+
+            virtual ObservableEntry::KinematicVariableIterator
+            begin_kinematic_variables() const
+            {
+                return _kinematics_names.data();
+            }
+
+            virtual ObservableEntry::KinematicVariableIterator
+            end_kinematic_variables() const
+            {
+                return _kinematics_names.data() + _kinematics_names.size();
+            }
+
+            virtual ObservableEntry::OptionIterator
+            begin_options() const
+            {
+                return _option_specifications.cbegin();
+            }
+
+            virtual ObservableEntry::OptionIterator
+            end_options() const
+            {
+                return _option_specifications.cend();
+            }
+
+            virtual ObservablePtr
+            make(const Parameters & parameters, const Kinematics & kinematics, const Options & options) const
+            {
+                return ObservablePtr(new BakedObservable(_table, parameters, kinematics, options));
+            }
+
+            virtual const QualifiedName &
+            name() const
+            {
+                return _table->name;
+            }
+
+            virtual const std::string &
+            latex() const
+            {
+                return _table->latex;
+            }
+
+            virtual const Unit &
+            unit() const
+            {
+                return _table->unit;
+            }
+    };
+
+    namespace
+    {
+        // the value arrays are mapped in place; skip to the next 8-byte boundary
+        std::size_t
+        align_to_doubles(std::istream & in)
+        {
+            std::size_t pos = in.tellg();
+            pos = (pos + 7u) & ~std::size_t(7u);
+            in.seekg(pos);
+
+            return pos;
+        }
+    }
+
+    std::vector<QualifiedName>
+    BakedObservables::load(const std::string & file)
+    {
+        std::vector<QualifiedName> result;
+
+        auto mapping = std::make_shared<binary_io::MappedFile>(file);
+
+        try
+        {
+            binary_io::MappedInputStream in(*mapping);
+            in.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
+
+            char magic[sizeof(baked::magic)];
+            in.read(magic, sizeof(magic));
+            if (! std::equal(std::begin(magic), std::end(magic), std::begin(baked::magic)))
+            {
+                throw BakedObservableError("'" + file + "' is not a baked-table file");
+            }
+
+            const std::uint32_t version = binary_io::read<std::uint32_t>(in);
+            if (1u != version)
+            {
+                throw BakedObservableError("'" + file + "' uses unsupported format version " + stringify(version));
+            }
+
+            const std::uint32_t n_tables = binary_io::read<std::uint32_t>(in);
+            for (std::uint32_t t = 0 ; t < n_tables ; ++t)
+            {
+                auto table = std::make_shared<baked::Table>(QualifiedName(binary_io::read_string(in)));
+                table->latex     = binary_io::read_string(in);
+                table->unit      = Unit(binary_io::read_string(in));
+                table->max_error = binary_io::read<double>(in);
+                table->file      = mapping;
+
+                std::size_t n_values = 1;
+                const std::uint32_t n_axes = binary_io::read<std::uint32_t>(in);
+                for (std::uint32_t a = 0 ; a < n_axes ; ++a)
+                {
+                    baked::Axis axis;
+                    axis.kind   = static_cast<baked::Axis::Kind>(binary_io::read<std::uint32_t>(in));
+                    axis.name   = binary_io::read_string(in);
+                    axis.points = binary_io::read<std::uint32_t>(in);
+
+                    if (axis.points < 2)
+                    {
+                        throw BakedObservableError("axis '" + axis.name + "' of table '" + table->name.str() + "' has fewer than two grid points");
+                    }
+
+                    const std::size_t pos = align_to_doubles(in);
+                    axis.grid = reinterpret_cast<const double *>(mapping->data() + pos);
+                    in.seekg(pos + axis.points * sizeof(double));
+
+                    if (! std::is_sorted(axis.grid, axis.grid + axis.points, std::less_equal<double>()))
+                    {
+                        throw BakedObservableError("axis '" + axis.name + "' of table '" + table->name.str() + "' is not strictly increasing");
+                    }
+
+                    n_values *= axis.points;
+                    table->axes.push_back(std::move(axis));
+                }
+
+                const std::size_t pos = align_to_doubles(in);
+                if (pos + n_values * sizeof(double) > mapping->size())
+                {
+                    throw BakedObservableError("value array of table '" + table->name.str() + "' exceeds the file size");
+                }
+                table->values = reinterpret_cast<const double *>(mapping->data() + pos);
+                in.seekg(pos + n_values * sizeof(double));
+
+                ObservableEntries::instance()->insert_or_assign(table->name, std::make_shared<const BakedObservableEntry>(table));
+                result.push_back(table->name);
+
+                Log::instance()->message("BakedObservables::load", ll_informational)
+                    << "registered baked observable '" << table->name.str() << "' with estimated maximal interpolation error " << table->max_error;
+            }
+        }
+        catch (std::ios_base::failure &)
+        {
+            throw BakedObservableError("'" + file + "' is truncated or malformed");
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,70 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_BAKED_OBSERVABLE_HH
+#define EOS_GUARD_EOS_UTILS_BAKED_OBSERVABLE_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * BakedObservableError is thrown when a baked observable table cannot be
+     * loaded or fails its consistency checks.
+     */
+    struct BakedObservableError :
+        public Exception
+    {
+        BakedObservableError(const std::string & message) throw ();
+    };
+
+    /*!
+     * Loader for pre-evaluated ("baked") observable surrogates.
+     *
+     * A baked table, produced offline by the 'bake' task, stores an
+     * observable's values on a tensor-product grid of parameter and kinematic
+     * axes, together with an interpolation error estimate. Loading a table
+     * registers one Observable per stored table, evaluated by multilinear
+     * interpolation; the value arrays remain memory-mapped, so that look-ups
+     * need microseconds and concurrent processes share one copy of the
+     * table's pages. Coordinates outside the tabulated domain are clamped to
+     * its boundary.
+     *
+     * By convention, the tables register their observables under the source
+     * observable's name with a 'baked' suffix, e.g. 'B->Kll::BR@baked'.
+     */
+    class BakedObservables
+    {
+        public:
+            /*!
+             * Load a baked-table file and register its observables.
+             *
+             * @param file  The path to the table file.
+             * @return The names under which the tables' observables have been registered.
+             */
+            static std::vector<QualifiedName> load(const std::string & file);
+    };
+}
+
+#endif
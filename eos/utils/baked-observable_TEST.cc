@@ -0,0 +1,145 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/observable.hh>
+#include <eos/utils/baked-observable.hh>
+#include <eos/utils/binary-io.hh>
+#include <eos/utils/kinematic.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    void
+    write_padding(std::ofstream & out)
+    {
+        static const char zeros[8] = {};
+        const std::size_t pos = out.tellp();
+        out.write(zeros, ((pos + 7u) & ~std::size_t(7u)) - pos);
+    }
+
+    // bake the function f(m_c, q2) = 2 m_c + 3 q2 on a 3x3 grid; linear in
+    // both axes, so multilinear interpolation reproduces it exactly
+    std::string
+    write_test_table()
+    {
+        const std::string file = "/tmp/eos_baked_observable_TEST_" + std::to_string(::getpid()) + ".eosbake";
+
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        out.write("EOSBAKE1", 8);
+        binary_io::write<std::uint32_t>(out, 1); // version
+        binary_io::write<std::uint32_t>(out, 1); // number of tables
+
+        binary_io::write_string(out, "mass::test-baked@baked");
+        binary_io::write_string(out, R"(\text{baked test})");
+        binary_io::write_string(out, "GeV");
+        binary_io::write<double>(out, 1.0e-12);  // max error
+        binary_io::write<std::uint32_t>(out, 2); // number of axes
+
+        binary_io::write<std::uint32_t>(out, 0); // parameter axis
+        binary_io::write_string(out, "mass::c");
+        binary_io::write<std::uint32_t>(out, 3);
+        write_padding(out);
+        for (const double & node : { 1.0, 1.5, 2.0 })
+        {
+            binary_io::write<double>(out, node);
+        }
+
+        binary_io::write<std::uint32_t>(out, 1); // kinematic axis
+        binary_io::write_string(out, "q2");
+        binary_io::write<std::uint32_t>(out, 3);
+        write_padding(out);
+        for (const double & node : { 0.0, 5.0, 10.0 })
+        {
+            binary_io::write<double>(out, node);
+        }
+
+        write_padding(out);
+        for (const double & m_c : { 1.0, 1.5, 2.0 })
+        {
+            for (const double & q2 : { 0.0, 5.0, 10.0 })
+            {
+                binary_io::write<double>(out, 2.0 * m_c + 3.0 * q2);
+            }
+        }
+
+        return file;
+    }
+}
+
+class BakedObservableTest :
+    public TestCase
+{
+    public:
+        BakedObservableTest() :
+            TestCase("baked_observable_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-12;
+
+            const std::string file = write_test_table();
+
+            const auto names = BakedObservables::load(file);
+            TEST_CHECK_EQUAL(names.size(), 1u);
+            TEST_CHECK_EQUAL(names.front().str(), "mass::test-baked@baked");
+
+            Parameters parameters = Parameters::Defaults();
+            Kinematics kinematics{ { "q2", 4.0 } };
+
+            ObservablePtr observable = Observable::make("mass::test-baked@baked", parameters, kinematics, Options{ });
+            TEST_CHECK(nullptr != observable.get());
+
+            // exact reproduction of the baked linear function, on and off the nodes
+            parameters["mass::c"] = 1.5;
+            TEST_CHECK_NEARLY_EQUAL(observable->evaluate(), 2.0 * 1.5 + 3.0 * 4.0, eps);
+
+            parameters["mass::c"] = 1.2;
+            kinematics.set("q2", 7.5);
+            TEST_CHECK_NEARLY_EQUAL(observable->evaluate(), 2.0 * 1.2 + 3.0 * 7.5, eps);
+
+            // coordinates outside the tabulated domain clamp to its boundary
+            parameters["mass::c"] = 5.0;
+            TEST_CHECK_NEARLY_EQUAL(observable->evaluate(), 2.0 * 2.0 + 3.0 * 7.5, eps);
+
+            // the observable tracks its parameter axis
+            TEST_CHECK(std::find(observable->begin(), observable->end(), parameters["mass::c"].id()) != observable->end());
+
+            // a clone evaluates independently
+            ObservablePtr clone = observable->clone();
+            clone->parameters()["mass::c"] = 1.0;
+            clone->kinematics().set("q2", 0.0);
+            TEST_CHECK_NEARLY_EQUAL(clone->evaluate(), 2.0, eps);
+
+            ::unlink(file.c_str());
+        }
+} baked_observable_test;
@@ -0,0 +1,166 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_BINARY_IO_HH
+#define EOS_GUARD_EOS_UTILS_BINARY_IO_HH 1
+
+#include <eos/utils/exception.hh>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    /*
+     * Helpers for the binary on-disk caches (parameter defaults, constraint index).
+     *
+     * The format is not portable across architectures; the caches are therefore
+     * validated against their inputs and silently regenerated on any mismatch.
+     */
+    namespace binary_io
+    {
+        template <typename T_>
+        void
+        write(std::ostream & os, const T_ & value)
+        {
+            os.write(reinterpret_cast<const char *>(&value), sizeof(T_));
+        }
+
+        template <typename T_>
+        T_
+        read(std::istream & is)
+        {
+            T_ value;
+            is.read(reinterpret_cast<char *>(&value), sizeof(T_));
+
+            return value;
+        }
+
+        inline void
+        write_string(std::ostream & os, const std::string & s)
+        {
+            write<std::uint32_t>(os, s.size());
+            os.write(s.data(), s.size());
+        }
+
+        inline std::string
+        read_string(std::istream & is)
+        {
+            const std::uint32_t size = read<std::uint32_t>(is);
+            if (size > (1u << 20))
+            {
+                throw InternalError("Implausible string size in binary cache");
+            }
+
+            std::string s(size, '\0');
+            is.read(&s[0], size);
+
+            return s;
+        }
+
+        /*
+         * Read-only memory mapping of a cache file.
+         *
+         * All processes on a node map the same physical pages, so concurrent
+         * EOS processes share one copy of the cache bytes instead of each
+         * reading them into a private buffer.
+         */
+        class MappedFile
+        {
+            private:
+                char * _data;
+
+                std::size_t _size;
+
+            public:
+                explicit MappedFile(const std::string & file) :
+                    _data(nullptr),
+                    _size(0)
+                {
+                    int fd = ::open(file.c_str(), O_RDONLY);
+                    if (fd < 0)
+                    {
+                        throw InternalError("Could not open '" + file + "' for mapping");
+                    }
+
+                    struct stat st;
+                    if (::fstat(fd, &st) < 0)
+                    {
+                        ::close(fd);
+                        throw InternalError("Could not stat '" + file + "'");
+                    }
+                    _size = st.st_size;
+
+                    void * p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+                    ::close(fd);
+                    if (MAP_FAILED == p)
+                    {
+                        throw InternalError("Could not map '" + file + "'");
+                    }
+                    _data = static_cast<char *>(p);
+                }
+
+                ~MappedFile()
+                {
+                    if (_data)
+                    {
+                        ::munmap(_data, _size);
+                    }
+                }
+
+                MappedFile(const MappedFile &) = delete;
+                MappedFile & operator= (const MappedFile &) = delete;
+
+                const char * data() const
+                {
+                    return _data;
+                }
+
+                std::size_t size() const
+                {
+                    return _size;
+                }
+        };
+
+        /// Input stream over a MappedFile, for use with the read helpers above.
+        class MappedInputStream :
+            private std::streambuf,
+            public std::istream
+        {
+            public:
+                explicit MappedInputStream(const MappedFile & file) :
+                    std::istream(this)
+                {
+                    // the mapping is read-only; istream only ever reads through this buffer
+                    char * begin = const_cast<char *>(file.data());
+                    setg(begin, begin, begin + file.size());
+                }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,185 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/chebyshev-observable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace eos
+{
+    template <>
+    struct Implementation<ChebyshevObservable>
+    {
+        ObservablePtr observable;
+
+        Parameters parameters;
+
+        Kinematics kinematics;
+
+        std::string variable_name;
+
+        KinematicVariable variable;
+
+        double min, max;
+
+        unsigned order;
+
+        // the fitted interpolant, valid for the recorded parameter generation
+        std::vector<double> coefficients;
+
+        std::uint64_t generation;
+
+        bool fitted;
+
+        Implementation(const ObservablePtr & o, const std::string & v, const double & min, const double & max, const unsigned & order) :
+            observable(o),
+            parameters(o->parameters()),
+            kinematics(o->kinematics()),
+            variable_name(v),
+            variable(kinematics[v]),
+            min(min),
+            max(max),
+            order(order),
+            generation(0),
+            fitted(false)
+        {
+            if (! (min < max))
+                throw InternalError("ChebyshevObservable: empty range [" + stringify(min) + ", " + stringify(max) + "]");
+
+            if (order < 2)
+                throw InternalError("ChebyshevObservable: order must be at least 2");
+        }
+
+        void fit()
+        {
+            const double old_value = variable.evaluate();
+
+            // evaluate the underlying observable on the Chebyshev nodes
+            std::vector<double> values(order);
+            for (unsigned k = 0 ; k < order ; ++k)
+            {
+                const double t = std::cos(M_PI * (k + 0.5) / order);
+                variable.set(0.5 * (max + min) + 0.5 * (max - min) * t);
+                values[k] = observable->evaluate();
+            }
+            variable.set(old_value);
+
+            // discrete cosine transform of the node values
+            coefficients.assign(order, 0.0);
+            for (unsigned j = 0 ; j < order ; ++j)
+            {
+                double sum = 0.0;
+                for (unsigned k = 0 ; k < order ; ++k)
+                {
+                    sum += values[k] * std::cos(j * M_PI * (k + 0.5) / order);
+                }
+                coefficients[j] = 2.0 / order * sum;
+            }
+
+            generation = parameters.generation();
+            fitted = true;
+        }
+
+        double interpolate(const double & x) const
+        {
+            // Clenshaw recurrence on [-1, +1]
+            const double t = (2.0 * x - (max + min)) / (max - min);
+
+            double b1 = 0.0, b2 = 0.0;
+            for (unsigned j = order - 1 ; j >= 1 ; --j)
+            {
+                const double b0 = 2.0 * t * b1 - b2 + coefficients[j];
+                b2 = b1;
+                b1 = b0;
+            }
+
+            return t * b1 - b2 + 0.5 * coefficients[0];
+        }
+    };
+
+    ChebyshevObservable::ChebyshevObservable(const ObservablePtr & observable, const std::string & variable,
+            const double & min, const double & max, const unsigned & order) :
+        PrivateImplementationPattern<ChebyshevObservable>(new Implementation<ChebyshevObservable>(observable, variable, min, max, order))
+    {
+        uses(static_cast<const ParameterUser &>(*observable));
+    }
+
+    ChebyshevObservable::~ChebyshevObservable()
+    {
+    }
+
+    const QualifiedName &
+    ChebyshevObservable::name() const
+    {
+        return _imp->observable->name();
+    }
+
+    double
+    ChebyshevObservable::evaluate() const
+    {
+        const double x = _imp->variable.evaluate();
+
+        // no extrapolation: outside the fitted range, fall through to the
+        // underlying observable
+        if ((x < _imp->min) || (_imp->max < x))
+            return _imp->observable->evaluate();
+
+        if ((! _imp->fitted) || (_imp->parameters.generation() != _imp->generation))
+        {
+            _imp->fit();
+        }
+
+        return _imp->interpolate(x);
+    }
+
+    Kinematics
+    ChebyshevObservable::kinematics()
+    {
+        return _imp->kinematics;
+    }
+
+    Parameters
+    ChebyshevObservable::parameters()
+    {
+        return _imp->parameters;
+    }
+
+    Options
+    ChebyshevObservable::options()
+    {
+        return _imp->observable->options();
+    }
+
+    ObservablePtr
+    ChebyshevObservable::clone() const
+    {
+        return ObservablePtr(new ChebyshevObservable(_imp->observable->clone(), _imp->variable_name, _imp->min, _imp->max, _imp->order));
+    }
+
+    ObservablePtr
+    ChebyshevObservable::clone(const Parameters & parameters) const
+    {
+        return ObservablePtr(new ChebyshevObservable(_imp->observable->clone(parameters), _imp->variable_name, _imp->min, _imp->max, _imp->order));
+    }
+}
@@ -0,0 +1,76 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_CHEBYSHEV_OBSERVABLE_HH
+#define EOS_GUARD_EOS_UTILS_CHEBYSHEV_OBSERVABLE_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+
+namespace eos
+{
+    /*!
+     * Proxy for an expensive observable that is smooth in one kinematic variable.
+     *
+     * Upon first evaluation, the proxy fits a Chebyshev interpolant to the
+     * underlying observable over the declared range of the kinematic variable,
+     * at the current parameter point. Subsequent evaluations anywhere in the
+     * range only evaluate the interpolant; the fit is redone once the
+     * parameters' generation has changed. Evaluations outside the declared
+     * range fall through to the underlying observable.
+     */
+    class ChebyshevObservable :
+        public Observable,
+        public PrivateImplementationPattern<ChebyshevObservable>
+    {
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param observable The underlying observable.
+             * @param variable   The name of the kinematic variable in which the observable is smooth.
+             * @param min        The lower end of the interpolated range.
+             * @param max        The upper end of the interpolated range.
+             * @param order      The number of Chebyshev nodes; the interpolant is exact for
+             *                   polynomials in the variable up to degree order - 1.
+             */
+            ChebyshevObservable(const ObservablePtr & observable, const std::string & variable,
+                    const double & min, const double & max, const unsigned & order = 32);
+
+            ~ChebyshevObservable();
+
+            virtual const QualifiedName & name() const;
+
+            virtual double evaluate() const;
+
+            virtual Kinematics kinematics();
+
+            virtual Parameters parameters();
+
+            virtual Options options();
+
+            virtual ObservablePtr clone() const;
+
+            virtual ObservablePtr clone(const Parameters & parameters) const;
+    };
+}
+
+#endif
@@ -0,0 +1,175 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/chebyshev-observable.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    /* an inexpensive stand-in for an expensive observable: polynomial in q2,
+     * scaled by a parameter, counting how often it is evaluated */
+    class TestObservable :
+        public Observable
+    {
+        private:
+            QualifiedName _name;
+
+            Parameters _parameters;
+
+            Kinematics _kinematics;
+
+            Parameter _scale;
+
+            KinematicVariable _q2;
+
+            unsigned * _evaluations;
+
+        public:
+            TestObservable(const Parameters & parameters, const Kinematics & kinematics, unsigned * evaluations) :
+                _name("B->pilnu::BR"),
+                _parameters(parameters),
+                _kinematics(kinematics),
+                _scale(parameters["mass::b(MSbar)"]),
+                _q2(kinematics["q2"]),
+                _evaluations(evaluations)
+            {
+                uses(_scale.id());
+            }
+
+            virtual const QualifiedName & name() const
+            {
+                return _name;
+            }
+
+            virtual double evaluate() const
+            {
+                ++(*_evaluations);
+
+                const double q2 = _q2.evaluate();
+
+                return _scale.evaluate() * (1.0 + q2 + 0.1 * q2 * q2 * q2);
+            }
+
+            virtual Kinematics kinematics()
+            {
+                return _kinematics;
+            }
+
+            virtual Parameters parameters()
+            {
+                return _parameters;
+            }
+
+            virtual Options options()
+            {
+                return Options();
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return clone(_parameters.clone());
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new TestObservable(parameters, _kinematics.clone(), _evaluations));
+            }
+    };
+}
+
+class ChebyshevObservableTest :
+    public TestCase
+{
+    public:
+        ChebyshevObservableTest() :
+            TestCase("chebyshev_observable_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-12;
+
+            Parameters parameters = Parameters::Defaults();
+            Kinematics kinematics{ { "q2", 0.0 } };
+
+            unsigned evaluations = 0;
+            ObservablePtr observable(new TestObservable(parameters, kinematics, &evaluations));
+
+            static const unsigned order = 16;
+            ObservablePtr proxy(new ChebyshevObservable(observable, "q2", 0.0, 10.0, order));
+
+            // inside the range, the proxy reproduces the underlying observable
+            // from a single fit
+            {
+                for (double q2 = 0.0 ; q2 <= 10.0 ; q2 += 0.37)
+                {
+                    kinematics.set("q2", q2);
+
+                    const double direct = observable->evaluate();
+                    evaluations = 0;
+                    const double interpolated = proxy->evaluate();
+
+                    TEST_CHECK_RELATIVE_ERROR(interpolated, direct, eps);
+                }
+            }
+
+            // the whole sweep above cost at most one fit of the interpolant
+            {
+                TEST_CHECK(evaluations <= order);
+
+                evaluations = 0;
+                kinematics.set("q2", 4.2);
+                proxy->evaluate();
+
+                TEST_CHECK_EQUAL(evaluations, 0u);
+            }
+
+            // changing a parameter invalidates the fit
+            {
+                parameters["mass::b(MSbar)"] = 2.0 * parameters["mass::b(MSbar)"].evaluate();
+
+                evaluations = 0;
+                const double interpolated = proxy->evaluate();
+
+                TEST_CHECK_EQUAL(evaluations, order);
+
+                const double direct = observable->evaluate();
+                TEST_CHECK_RELATIVE_ERROR(interpolated, direct, eps);
+            }
+
+            // outside the range, the proxy falls through to the underlying
+            // observable
+            {
+                kinematics.set("q2", 12.5);
+
+                evaluations = 0;
+                const double direct = observable->evaluate();
+                const double outside = proxy->evaluate();
+
+                TEST_CHECK_EQUAL(evaluations, 2u);
+                TEST_CHECK_EQUAL(outside, direct);
+            }
+        }
+} chebyshev_observable_test;
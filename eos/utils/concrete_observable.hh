@@ -39,6 +39,9 @@ namespace eos
         public Observable
     {
         public:
+            // bound member-function pointer; invoked directly in evaluate() without
+            // any std::function indirection or heap allocation
+            using FunctionType = double (Decay_::*)(const Args_ & ...) const;
 
         private:
             QualifiedName _name;
@@ -51,10 +54,11 @@ namespace eos
 
             Decay_ _decay;
 
-            std::function<double (const Decay_ *, const Args_ & ...)> _function;
+            FunctionType _function;
 
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
+            // kinematic variable slots, resolved by name once at construction
             std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type ...> _argument_tuple;
 
         public:
@@ -62,7 +66,7 @@ namespace eos
                     const Parameters & parameters,
                     const Kinematics & kinematics,
                     const Options & options,
-                    const std::function<double (const Decay_ *, const Args_ & ...)> & function,
+                    const FunctionType & function,
                     const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names) :
                 _name(name),
                 _parameters(parameters),
@@ -84,9 +88,28 @@ namespace eos
 
             virtual double evaluate() const
             {
-                std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
+                // almost all observables take at most two kinematic arguments; invoke
+                // these directly on the bound member pointer, without going through a
+                // temporary value tuple and std::apply
+                if constexpr (sizeof...(Args_) == 0)
+                {
+                    return (std::get<0>(_argument_tuple)->*_function)();
+                }
+                else if constexpr (sizeof...(Args_) == 1)
+                {
+                    return (std::get<0>(_argument_tuple)->*_function)(static_cast<double>(std::get<1>(_argument_tuple)));
+                }
+                else if constexpr (sizeof...(Args_) == 2)
+                {
+                    return (std::get<0>(_argument_tuple)->*_function)(static_cast<double>(std::get<1>(_argument_tuple)),
+                            static_cast<double>(std::get<2>(_argument_tuple)));
+                }
+                else
+                {
+                    std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
 
-                return std::apply(_function, values);
+                    return std::apply(_function, values);
+                }
             };
 
             virtual Parameters parameters()
@@ -126,7 +149,7 @@ namespace eos
 
             Unit _unit;
 
-            std::function<double (const Decay_ *, const Args_ & ...)> _function;
+            typename ConcreteObservable<Decay_, Args_ ...>::FunctionType _function;
 
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
@@ -137,7 +160,7 @@ namespace eos
         public:
             ConcreteObservableEntry(const QualifiedName & name, const std::string & latex,
                     const Unit & unit,
-                    const std::function<double (const Decay_ *, const Args_ & ...)> & function,
+                    const typename ConcreteObservable<Decay_, Args_ ...>::FunctionType & function,
                     const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names,
                     const Options & forced_options) :
                 _name(name),
@@ -214,7 +237,7 @@ namespace eos
 
         return std::make_shared<ConcreteObservableEntry<Decay_, Args_ ...>>(name, latex,
                 unit,
-                std::function<double (const Decay_ *, const Args_ & ...)>(std::mem_fn(function)),
+                function,
                 kinematics_names, forced_options);
     }
 }
@@ -22,7 +22,10 @@
 
 #include <eos/utils/exception.hh>
 
+#include <charconv>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 namespace eos
 {
@@ -56,7 +59,50 @@ namespace eos
             }
         };
 
-        template <typename T_> struct DoDestringify : public SimpleDestringify<T_> {};
+        /*
+         * Numeric types avoid the iostream round trip and parse through
+         * std::from_chars instead, which neither allocates nor consults the
+         * locale. The iostream-based reader accepts surrounding whitespace
+         * and a leading '+'; both are stripped up front to keep the accepted
+         * inputs unchanged.
+         */
+        template <typename T_>
+        struct FromCharsDestringify
+        {
+            static T_ destringify(const std::string & input)
+            {
+                const char * begin = input.data();
+                const char * end   = begin + input.size();
+
+                while ((begin != end) && ((' ' == *begin) || ('\t' == *begin)))
+                {
+                    ++begin;
+                }
+                while ((begin != end) && ((' ' == *(end - 1)) || ('\t' == *(end - 1))))
+                {
+                    --end;
+                }
+                if ((begin != end) && ('+' == *begin) && ((end - begin) > 1) && ('-' != *(begin + 1)))
+                {
+                    ++begin;
+                }
+
+                T_ value;
+                const auto [ptr, ec] = std::from_chars(begin, end, value);
+                if ((std::errc() != ec) || (end != ptr) || (begin == end))
+                {
+                    throw DestringifyError(input);
+                }
+
+                return value;
+            }
+        };
+
+        template <typename T_>
+        struct DoDestringify :
+            public std::conditional_t<std::is_arithmetic_v<T_>, FromCharsDestringify<T_>, SimpleDestringify<T_>>
+        {
+        };
 
         template <> struct DoDestringify<bool>
         {
@@ -76,6 +122,50 @@ namespace eos
     {
         return impl::DoDestringify<T_>::destringify(input);
     }
+
+    /*!
+     * Destringify a whitespace- or comma-separated sequence of numbers in a
+     * single pass, e.g. the rows of a covariance matrix in a constraint file.
+     *
+     * @param input The sequence as one string.
+     * @return The numbers in order of appearance.
+     */
+    template <typename T_>
+    std::vector<T_>
+    destringify_sequence(const std::string & input)
+    {
+        static_assert(std::is_arithmetic_v<T_> && ! std::is_same_v<T_, bool>, "destringify_sequence is only implemented for numeric types");
+
+        std::vector<T_> result;
+
+        const char * pos = input.data();
+        const char * end = pos + input.size();
+        while (pos != end)
+        {
+            if ((' ' == *pos) || ('\t' == *pos) || ('\n' == *pos) || ('\r' == *pos) || (',' == *pos))
+            {
+                ++pos;
+                continue;
+            }
+
+            if (('+' == *pos) && ((end - pos) > 1) && ('-' != *(pos + 1)))
+            {
+                ++pos;
+            }
+
+            T_ value;
+            const auto [ptr, ec] = std::from_chars(pos, end, value);
+            if ((std::errc() != ec) || (pos == ptr))
+            {
+                throw DestringifyError(input);
+            }
+
+            result.push_back(value);
+            pos = ptr;
+        }
+
+        return result;
+    }
 }
 
 #endif
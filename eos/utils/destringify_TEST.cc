@@ -0,0 +1,80 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/destringify.hh>
+
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class DestringifyTest :
+    public TestCase
+{
+    public:
+        DestringifyTest() :
+            TestCase("destringify_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // numbers
+            {
+                TEST_CHECK_EQUAL(destringify<double>("1.25e-3"),  1.25e-3);
+                TEST_CHECK_EQUAL(destringify<double>("-0.5"),    -0.5);
+                TEST_CHECK_EQUAL(destringify<double>("+2.5"),     2.5);
+                TEST_CHECK_EQUAL(destringify<double>("  3.5 "),   3.5);
+                TEST_CHECK_EQUAL(destringify<int>("-42"),        -42);
+                TEST_CHECK_EQUAL(destringify<unsigned>("17"),     17u);
+            }
+
+            // booleans
+            {
+                TEST_CHECK_EQUAL(destringify<bool>("true"),  true);
+                TEST_CHECK_EQUAL(destringify<bool>("false"), false);
+            }
+
+            // invalid inputs: must throw
+            {
+                TEST_CHECK_THROWS(DestringifyError, destringify<double>(""));
+                TEST_CHECK_THROWS(DestringifyError, destringify<double>("abc"));
+                TEST_CHECK_THROWS(DestringifyError, destringify<double>("1.5x"));
+                TEST_CHECK_THROWS(DestringifyError, destringify<double>("+-3"));
+                TEST_CHECK_THROWS(DestringifyError, destringify<double>("1 2"));
+                TEST_CHECK_THROWS(DestringifyError, destringify<unsigned>("-1"));
+            }
+
+            // sequences
+            {
+                const std::vector<double> reference{ 1.0, 2.5, -3.0e2, 4.0 };
+                const auto sequence = destringify_sequence<double>(" 1.0, 2.5\t-3e2\n4 ");
+
+                TEST_CHECK_EQUAL(sequence.size(), reference.size());
+                for (unsigned i = 0 ; i < reference.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(sequence[i], reference[i]);
+                }
+
+                TEST_CHECK(destringify_sequence<double>("  ").empty());
+                TEST_CHECK_THROWS(DestringifyError, destringify_sequence<double>("1.0, oops"));
+            }
+        }
+} destringify_test;
@@ -0,0 +1,152 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/evaluation-precision.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+
+#include <algorithm>
+
+namespace eos
+{
+    template class InstantiationPolicy<EvaluationPrecision, Singleton>;
+
+    EvaluationPrecision::EvaluationPrecision() :
+        _tier(Tier::standard)
+    {
+    }
+
+    EvaluationPrecision::~EvaluationPrecision()
+    {
+    }
+
+    EvaluationPrecision::Tier
+    EvaluationPrecision::tier() const
+    {
+        return _tier.load(std::memory_order_relaxed);
+    }
+
+    void
+    EvaluationPrecision::set_tier(const Tier & tier)
+    {
+        _tier.store(tier, std::memory_order_relaxed);
+    }
+
+    EvaluationPrecision::Tier
+    EvaluationPrecision::tier_from_string(const std::string & name)
+    {
+        if ("coarse" == name)
+            return Tier::coarse;
+
+        if ("default" == name)
+            return Tier::standard;
+
+        if ("fine" == name)
+            return Tier::fine;
+
+        throw InvalidOptionValueError("precision", name, "coarse, default, fine");
+    }
+
+    void
+    EvaluationPrecision::register_call_site(const std::string & call_site, const unsigned & default_points)
+    {
+        Lock l(_mutex);
+
+        _call_sites.insert(std::make_pair(call_site, default_points));
+    }
+
+    std::map<std::string, unsigned>
+    EvaluationPrecision::call_sites() const
+    {
+        Lock l(_mutex);
+
+        return _call_sites;
+    }
+
+    void
+    EvaluationPrecision::calibrate(const std::string & call_site, const unsigned & points)
+    {
+        Lock l(_mutex);
+
+        _calibrated_points[call_site] = points;
+    }
+
+    void
+    EvaluationPrecision::clear_calibration()
+    {
+        Lock l(_mutex);
+
+        _calibrated_points.clear();
+    }
+
+    unsigned
+    EvaluationPrecision::calibrated_points(const std::string & call_site) const
+    {
+        Lock l(_mutex);
+
+        auto i = _calibrated_points.find(call_site);
+        if (_calibrated_points.end() == i)
+            return 0;
+
+        return i->second;
+    }
+
+    unsigned
+    integration_points(const Options & options, const unsigned & default_points)
+    {
+        EvaluationPrecision::Tier tier;
+
+        if (options.has("precision"))
+        {
+            tier = EvaluationPrecision::tier_from_string(options.get("precision", "default"));
+        }
+        else
+        {
+            tier = EvaluationPrecision::instance()->tier();
+        }
+
+        switch (tier)
+        {
+            case EvaluationPrecision::Tier::coarse:
+                return std::max(16u, default_points / 4);
+
+            case EvaluationPrecision::Tier::fine:
+                return default_points * 4;
+
+            default:
+                return default_points;
+        }
+    }
+
+    unsigned
+    integration_points(const Options & options, const unsigned & default_points, const std::string & call_site)
+    {
+        EvaluationPrecision::instance()->register_call_site(call_site, default_points);
+
+        // an explicit per-observable precision request overrides the calibration
+        if (! options.has("precision"))
+        {
+            const unsigned calibrated = EvaluationPrecision::instance()->calibrated_points(call_site);
+            if (calibrated > 0)
+                return calibrated;
+        }
+
+        return integration_points(options, default_points);
+    }
+}
@@ -0,0 +1,150 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_EVALUATION_PRECISION_HH
+#define EOS_GUARD_EOS_UTILS_EVALUATION_PRECISION_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/options.hh>
+
+#include <atomic>
+#include <map>
+#include <string>
+
+namespace eos
+{
+    /*!
+     * Global policy that trades integration accuracy for scan speed.
+     *
+     * Decay-class integrations consult this policy through
+     * integration_points() when they are constructed: exploratory scans can
+     * run at coarse precision, whilst final results are obtained at default
+     * or fine precision. The active tier applies to observables constructed
+     * after it has been set; individual observables can override it through
+     * their "precision" option.
+     */
+    class EvaluationPrecision :
+        public InstantiationPolicy<EvaluationPrecision, Singleton>
+    {
+        public:
+            /*!
+             * The available precision tiers; Tier::standard corresponds to
+             * the option value "default".
+             */
+            enum class Tier : unsigned
+            {
+                coarse,
+                standard,
+                fine
+            };
+
+        private:
+            std::atomic<Tier> _tier;
+
+            mutable Mutex _mutex;
+
+            // default orders of the named call sites, registered on first use
+            std::map<std::string, unsigned> _call_sites;
+
+            // calibrated orders, overriding the tier scaling per call site
+            std::map<std::string, unsigned> _calibrated_points;
+
+            /// Constructor.
+            EvaluationPrecision();
+
+        public:
+            friend class InstantiationPolicy<EvaluationPrecision, Singleton>;
+
+            /// Destructor.
+            ~EvaluationPrecision();
+
+            /// Retrieve the active precision tier.
+            Tier tier() const;
+
+            /// Set the active precision tier.
+            void set_tier(const Tier & tier);
+
+            /*!
+             * Parse a precision tier from its name.
+             *
+             * @param name One of "coarse", "default", or "fine".
+             */
+            static Tier tier_from_string(const std::string & name);
+
+            /*!
+             * Record that a named integration call site exists, together with
+             * its number of sampling points at default precision.
+             *
+             * Called by integration_points() on behalf of the decay classes;
+             * registration makes the site discoverable for calibration.
+             */
+            void register_call_site(const std::string & call_site, const unsigned & default_points);
+
+            /// Retrieve the registered call sites and their default orders.
+            std::map<std::string, unsigned> call_sites() const;
+
+            /*!
+             * Pin a call site to a calibrated number of sampling points.
+             *
+             * The calibrated order replaces the tier scaling for observables
+             * constructed afterwards; the per-observable "precision" option
+             * still takes precedence.
+             */
+            void calibrate(const std::string & call_site, const unsigned & points);
+
+            /// Drop all calibrated orders, reverting to the tier scaling.
+            void clear_calibration();
+
+            /*!
+             * Retrieve the calibrated number of sampling points for a call
+             * site, or 0 when the site has not been calibrated.
+             */
+            unsigned calibrated_points(const std::string & call_site) const;
+    };
+
+    /*!
+     * Number of sampling points for a decay-class integration.
+     *
+     * Consults the "precision" option when specified, and the global
+     * EvaluationPrecision policy otherwise: the call site's default order is
+     * quartered at coarse and quadrupled at fine precision. The result stays
+     * a power of two, as required by integrate1D, and never drops below 16
+     * points.
+     *
+     * @param options        The options of the observable under construction.
+     * @param default_points The call site's number of sampling points at default precision.
+     */
+    unsigned integration_points(const Options & options, const unsigned & default_points);
+
+    /*!
+     * Number of sampling points for a named decay-class integration.
+     *
+     * Registers the call site with the EvaluationPrecision policy and
+     * consults, in order of precedence: the "precision" option, the site's
+     * calibrated order, and the global tier scaling of the default order.
+     *
+     * @param options        The options of the observable under construction.
+     * @param default_points The call site's number of sampling points at default precision.
+     * @param call_site      A name identifying the call site, e.g. "B->Kll::angular_coefficients".
+     */
+    unsigned integration_points(const Options & options, const unsigned & default_points, const std::string & call_site);
+}
+
+#endif
@@ -0,0 +1,106 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_EVALUATION_STAMP_HH
+#define EOS_GUARD_EOS_UTILS_EVALUATION_STAMP_HH 1
+
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/parameters.hh>
+
+#include <cstdint>
+#include <limits>
+
+namespace eos
+{
+    /*!
+     * Compact snapshot of the generation counters of a Parameters set and,
+     * optionally, a Kinematics set.
+     *
+     * An EvaluationStamp records the point in time at which a cached result
+     * was computed; comparing a stored stamp against a freshly taken one
+     * answers "has any relevant input changed since?" in O(1), without
+     * inspecting individual parameters or kinematic variables. A
+     * default-constructed stamp compares unequal to any stamp taken from live
+     * objects, so caches initialized with it recompute on first use.
+     */
+    class EvaluationStamp
+    {
+        private:
+            std::uint64_t _parameters_generation;
+
+            std::uint64_t _kinematics_generation;
+
+        public:
+            ///@name Basic Functions
+            ///@{
+            /// Construct a stamp that matches no stamp taken from live objects.
+            EvaluationStamp() :
+                _parameters_generation(std::numeric_limits<std::uint64_t>::max()),
+                _kinematics_generation(std::numeric_limits<std::uint64_t>::max())
+            {
+            }
+
+            /*!
+             * Construct a stamp of the current generation of a set of parameters.
+             *
+             * Use this constructor for caches whose inputs do not involve a
+             * Kinematics object, e.g. because the kinematic point enters as a
+             * plain function argument.
+             *
+             * @param parameters The set of parameters whose generation shall be recorded.
+             */
+            EvaluationStamp(const Parameters & parameters) :
+                _parameters_generation(parameters.generation()),
+                _kinematics_generation(0)
+            {
+            }
+
+            /*!
+             * Construct a stamp of the current generations of a set of parameters
+             * and a set of kinematic variables.
+             *
+             * @param parameters The set of parameters whose generation shall be recorded.
+             * @param kinematics The set of kinematic variables whose generation shall be recorded.
+             */
+            EvaluationStamp(const Parameters & parameters, const Kinematics & kinematics) :
+                _parameters_generation(parameters.generation()),
+                _kinematics_generation(kinematics.generation())
+            {
+            }
+            ///@}
+
+            ///@name Comparison
+            ///@{
+            /// Equality comparison operator.
+            bool operator== (const EvaluationStamp & rhs) const
+            {
+                return (_parameters_generation == rhs._parameters_generation)
+                    && (_kinematics_generation == rhs._kinematics_generation);
+            }
+
+            /// Inequality comparison operator.
+            bool operator!= (const EvaluationStamp & rhs) const
+            {
+                return ! (*this == rhs);
+            }
+            ///@}
+    };
+}
+
+#endif
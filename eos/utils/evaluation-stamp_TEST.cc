@@ -0,0 +1,80 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/evaluation-stamp.hh>
+
+using namespace test;
+using namespace eos;
+
+class EvaluationStampTest :
+    public TestCase
+{
+    public:
+        EvaluationStampTest() :
+            TestCase("evaluation_stamp_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters parameters = Parameters::Defaults();
+            Kinematics kinematics
+            {
+                { "q2", 1.0 },
+            };
+
+            // a default-constructed stamp never matches a stamp of live objects
+            {
+                TEST_CHECK(EvaluationStamp() != EvaluationStamp(parameters, kinematics));
+                TEST_CHECK(EvaluationStamp() != EvaluationStamp(parameters));
+            }
+
+            // stamps are stable as long as neither input is modified
+            {
+                const EvaluationStamp stamp(parameters, kinematics);
+
+                TEST_CHECK(stamp == EvaluationStamp(parameters, kinematics));
+            }
+
+            // modifying a parameter's value invalidates the stamp
+            {
+                const EvaluationStamp stamp(parameters, kinematics);
+
+                parameters["mass::b(MSbar)"] = 4.3;
+                TEST_CHECK(stamp != EvaluationStamp(parameters, kinematics));
+            }
+
+            // modifying a kinematic variable's value invalidates the stamp, ...
+            {
+                const EvaluationStamp stamp(parameters, kinematics);
+
+                kinematics["q2"] = 2.0;
+                TEST_CHECK(stamp != EvaluationStamp(parameters, kinematics));
+            }
+
+            // ... but not a parameters-only stamp
+            {
+                const EvaluationStamp stamp(parameters);
+
+                kinematics["q2"] = 3.0;
+                TEST_CHECK(stamp == EvaluationStamp(parameters));
+            }
+        }
+} evaluation_stamp_test;
@@ -25,12 +25,33 @@ namespace eos
 {
     namespace impl
     {
-        static thread_local std::list<std::tuple<source_location, std::string>> context;
+        // One active context frame; the entry string is either stored eagerly, or
+        // produced on demand by make_entry when an exception captures the trace.
+        struct ContextEntry
+        {
+            source_location location;
+
+            std::string entry;
+
+            std::function<std::string ()> make_entry;
+
+            std::string materialize() const
+            {
+                return make_entry ? make_entry() : entry;
+            }
+        };
+
+        static thread_local std::list<ContextEntry> context;
     }
 
     Context::Context(const std::string & entry, const source_location location)
     {
-        impl::context.push_back(std::make_tuple(location, entry));
+        impl::context.push_back(impl::ContextEntry{ location, entry, nullptr });
+    }
+
+    Context::Context(std::function<std::string ()> && make_entry, const source_location location)
+    {
+        impl::context.push_back(impl::ContextEntry{ location, std::string(), std::move(make_entry) });
     }
 
     Context::Context(const Context & other) = default;
@@ -54,9 +75,9 @@ namespace eos
 
         std::string result;
 
-        auto append = [&](const std::tuple<source_location, std::string> & entry)
+        auto append = [&](const impl::ContextEntry & entry)
         {
-            result += std::get<1>(entry) + "[" + std::get<0>(entry).file_name() + ":" + std::to_string(std::get<0>(entry).line()) + " -> " + std::get<0>(entry).function_name() + "]";
+            result += entry.materialize() + "[" + entry.location.file_name() + ":" + std::to_string(entry.location.line()) + " -> " + entry.location.function_name() + "]";
             result += delimiter;
         };
 
@@ -75,8 +96,12 @@ namespace eos
 
             ContextData()
             {
-                // use assign to ensure copying each element
-                local_context.assign(impl::context.begin(), impl::context.end());
+                // materialize each frame's entry: deferred entries may reference
+                // locals that will not survive the stack unwinding
+                for (const auto & entry : impl::context)
+                {
+                    local_context.push_back(std::make_tuple(entry.location, entry.materialize()));
+                }
             }
 
             ContextData(const ContextData &) = default;
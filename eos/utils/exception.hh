@@ -21,6 +21,7 @@
 #define EOS_GUARD_EOS_UTILS_EXCEPTION_HH 1
 
 #include <exception>
+#include <functional>
 #include <memory>
 #include <string>
 #ifdef __clang__
@@ -45,6 +46,17 @@ namespace eos
 
         public:
             Context(const std::string & entry, const source_location = source_location::current());
+
+            /*!
+             * Deferred variant: the callable is stored unevaluated and invoked only
+             * when an exception captures the context or a backtrace is requested.
+             *
+             * Preferred in hot paths, where assembling the entry string would
+             * otherwise dominate; the callable may capture local variables by
+             * reference, since it cannot outlive the enclosing scope.
+             */
+            Context(std::function<std::string ()> && make_entry, const source_location = source_location::current());
+
             ~Context() noexcept(false);
 
             std::string backtrace(const std::string & delimiter) const;
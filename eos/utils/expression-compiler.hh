@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021 Méril Reboud
+ * Copyright (c) 2024 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH
+#define EOS_GUARD_EOS_UTILS_EXPRESSION_COMPILER_HH 1
+
+#include <eos/utils/expression.hh>
+#include <eos/utils/expression-fwd.hh>
+#include <eos/utils/kinematic.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/parameters.hh>
+
+#include <utility>
+#include <vector>
+
+namespace eos::exp
+{
+    /*
+     * Flat, stack-machine form of an expression tree.
+     *
+     * Compiling walks the tree once and emits one instruction per node, folding
+     * subexpressions that consist of constants only. Evaluation runs a tight loop
+     * over the instruction vector, without any tree traversal or variant dispatch.
+     */
+    class CompiledExpression
+    {
+        public:
+            enum class OpCode : unsigned char
+            {
+                push_constant,            // push value
+                load_parameter,           // push parameters[index]
+                load_kinematic_variable,  // push kinematic_variables[index]
+                load_observable,          // push observables[index]->evaluate()
+                load_cached_observable,   // push cached_observables[index]
+                add,                      // pop two operands, push their sum
+                subtract,                 // pop two operands, push their difference
+                multiply,                 // pop two operands, push their product
+                divide,                   // pop two operands, push their ratio
+                power,                    // pop two operands, push lhs to the power of rhs
+                call                      // pop one operand, push function(operand)
+            };
+
+            struct Instruction
+            {
+                OpCode op;
+                unsigned index;                             // slot in one of the operand vectors below
+                double value;                               // constant for push_constant
+                FunctionExpression::FunctionType function;  // unary function for call
+            };
+
+            std::vector<Instruction> instructions;
+
+            // operand slots, resolved once at compile time
+            std::vector<Parameter> parameters;
+            std::vector<KinematicVariable> kinematic_variables;
+            std::vector<ObservablePtr> observables;
+            std::vector<std::pair<ObservableCache, ObservableCache::Id>> cached_observables;
+
+            // largest number of values on the stack at any point of the evaluation
+            static const unsigned max_stack_depth = 256;
+
+            CompiledExpression() = default;
+
+            // Compile an expression whose names have already been resolved, cf. ExpressionMaker and ExpressionCacher.
+            explicit CompiledExpression(const Expression & expression);
+
+            ~CompiledExpression() = default;
+
+            double evaluate() const;
+
+            bool empty() const
+            {
+                return instructions.empty();
+            }
+    };
+
+    // Visit the expression tree and append its instructions to a CompiledExpression
+    class ExpressionCompiler
+    {
+        private:
+            CompiledExpression & _program;
+
+        public:
+            ExpressionCompiler(CompiledExpression & program);
+            ~ExpressionCompiler() = default;
+
+            void visit(BinaryExpression & e);
+
+            void visit(FunctionExpression & e);
+
+            void visit(ConstantExpression & e);
+
+            void visit(ObservableNameExpression &);
+
+            void visit(ObservableExpression & e);
+
+            void visit(ParameterNameExpression &);
+
+            void visit(ParameterExpression & e);
+
+            void visit(KinematicVariableNameExpression &);
+
+            void visit(KinematicVariableExpression & e);
+
+            void visit(CachedObservableExpression & e);
+    };
+}
+
+#endif
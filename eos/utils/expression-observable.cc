@@ -19,7 +19,7 @@
 #include <eos/observable-impl.hh>
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-cloner.hh>
-#include <eos/utils/expression-evaluator.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
 #include <eos/utils/expression-maker.hh>
 #include <eos/utils/expression-observable.hh>
@@ -50,6 +50,7 @@ namespace eos
 
         exp::ExpressionMaker maker(parameters, kinematics, options, this);
         _expression = expression.accept_returning<Expression>(maker);
+        _compiled_expression = exp::CompiledExpression(_expression);
 
         exp::ExpressionUsedParameterReader reader;
         _expression.accept(reader);
@@ -78,6 +79,7 @@ namespace eos
 
         exp::ExpressionCacher cacher(cache);
         _expression = expression.accept_returning<Expression>(cacher);
+        _compiled_expression = exp::CompiledExpression(_expression);
 
         exp::ExpressionUsedParameterReader reader;
         _expression.accept(reader);
@@ -91,14 +93,12 @@ namespace eos
     double
     ExpressionObservable::evaluate() const
     {
-        if (_expression.empty())
+        if (_compiled_expression.empty())
         {
             throw InternalError("Empty expression encountered in ExpressionObservable::evaluate!");
         }
 
-        exp::ExpressionEvaluator evaluator;
-
-        return _expression.accept_returning<double>(evaluator);
+        return _compiled_expression.evaluate();
     }
 
 
@@ -19,6 +19,7 @@
 #define EOS_GUARD_EOS_UTILS_EXPRESSION_OBSERVABLE_HH 1
 
 #include <eos/observable.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-fwd.hh>
 #include <eos/utils/expression-parser.hh>
 #include <eos/utils/options.hh>
@@ -45,6 +46,9 @@ namespace eos
 
             Expression _expression;
 
+            // flat form of _expression, compiled once at construction
+            exp::CompiledExpression _compiled_expression;
+
         public:
             ExpressionObservable(const QualifiedName & name,
                     const Parameters & parameters,
@@ -22,4 +22,17 @@
  namespace eos
  {
      template struct ExpressionParser<std::string::const_iterator>;
+
+     bool
+     parse_expression(const std::string & input, exp::Expression & expression)
+     {
+         using It = std::string::const_iterator;
+
+         // the grammar carries no state between parses
+         static thread_local ExpressionParser<It> parser;
+
+         It first(input.begin()), last(input.end());
+
+         return qi::phrase_parse(first, last, parser, ascii::space, expression) && (first == last);
+     }
  }
@@ -62,6 +62,19 @@ namespace eos
     };
 
     extern template struct ExpressionParser<std::string::const_iterator>;
+
+    /*!
+     * Parse an expression from a string.
+     *
+     * Reuses a thread-local parser instance: constructing the boost-spirit
+     * grammar allocates its entire rule graph, which dominates the cost of
+     * parsing a short expression. The several hundred expression observables
+     * registered at startup, and analysis files with many derived
+     * observables, would otherwise each construct their own.
+     *
+     * @return true if the entire input was consumed.
+     */
+    bool parse_expression(const std::string & input, exp::Expression & expression);
 }
 
 #endif
@@ -21,6 +21,7 @@
 #include <eos/utils/expression.hh>
 #include <eos/utils/expression-fwd.hh>
 #include <eos/utils/expression-cloner.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-evaluator.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
 #include <eos/utils/expression-maker.hh>
@@ -46,14 +47,11 @@ class ExpressionTest
         Expression e;
         bool completed;
 
-        using It = std::string::const_iterator;
-        ExpressionParser<It> parser;
-
+        // exercises the shared thread-local parser across repeated parses
         ExpressionTest(const std::string input) :
             _input(input)
         {
-            It first(_input.begin()), last(_input.end());
-            completed = qi::phrase_parse(first, last, parser, ascii::space, e) && (first == last);
+            completed = parse_expression(_input, e);
         }
 };
 
@@ -328,6 +326,35 @@ class ExpressionParserTest :
                 TEST_CHECK_EQUAL(used_ids, expected_ids);
             }
 
+            // testing compilation of expressions to their flat stack-machine form
+            {
+                ExpressionTest test("(2 ^ 3 - 4) * {q2} + 2 * [[mass::mu]]");
+                TEST_CHECK(test.completed);
+
+                Options o;
+                Kinematics k = Kinematics({{"q2", 3.0}});
+                Parameters p = Parameters::Defaults();
+                p["mass::mu"] = 0.5;
+
+                ExpressionMaker maker(p, k, o);
+                Expression assessable_test = test.e.accept_returning<Expression>(maker);
+
+                CompiledExpression compiled(assessable_test);
+
+                // constants have been folded: '2 ^ 3 - 4' collapses to a single instruction
+                TEST_CHECK_EQUAL(7u, compiled.instructions.size());
+
+                // the compiled form agrees with the tree walk
+                ExpressionEvaluator evaluator;
+                TEST_CHECK_EQUAL(assessable_test.accept_returning<double>(evaluator), compiled.evaluate());
+                TEST_CHECK_EQUAL(13.0, compiled.evaluate());
+
+                // updates to parameters and kinematic variables propagate to the compiled form
+                p["mass::mu"] = 1.5;
+                k.set("q2", 5.0);
+                TEST_CHECK_EQUAL(23.0, compiled.evaluate());
+            }
+
             // testing mixing of kinematic variables and observables
             {
                 // { } are not allowed in the prefix of QualifiedNames
@@ -22,6 +22,7 @@
 #include <eos/utils/expression.hh>
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-cloner.hh>
+#include <eos/utils/expression-compiler.hh>
 #include <eos/utils/expression-evaluator.hh>
 #include <eos/utils/expression-kinematic-reader.hh>
 #include <eos/utils/expression-maker.hh>
@@ -33,6 +34,8 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/qualified-name.hh>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <set>
 
@@ -805,4 +808,226 @@ namespace eos::exp
             this->parameter_ids.insert(parameter_id);
         }
     }
+
+    /*
+     * ExpressionCompiler
+     */
+
+    ExpressionCompiler::ExpressionCompiler(CompiledExpression & program) :
+        _program(program)
+    {
+    }
+
+    void
+    ExpressionCompiler::visit(BinaryExpression & e)
+    {
+        e.lhs.accept(*this);
+        e.rhs.accept(*this);
+
+        auto & instructions = _program.instructions;
+
+        // constant folding: both operands have been reduced to single constants
+        if ((instructions.size() >= 2)
+                && (CompiledExpression::OpCode::push_constant == instructions[instructions.size() - 1].op)
+                && (CompiledExpression::OpCode::push_constant == instructions[instructions.size() - 2].op))
+        {
+            const double result = BinaryExpression::Method(e.op)(instructions[instructions.size() - 2].value, instructions[instructions.size() - 1].value);
+
+            instructions.pop_back();
+            instructions.back() = CompiledExpression::Instruction{ CompiledExpression::OpCode::push_constant, 0, result, nullptr };
+
+            return;
+        }
+
+        CompiledExpression::OpCode op;
+        switch (e.op)
+        {
+            case '+': op = CompiledExpression::OpCode::add;      break;
+            case '-': op = CompiledExpression::OpCode::subtract; break;
+            case '*': op = CompiledExpression::OpCode::multiply; break;
+            case '/': op = CompiledExpression::OpCode::divide;   break;
+            case '^': op = CompiledExpression::OpCode::power;    break;
+
+            default:
+                throw InternalError("Unknown binary operator '" + std::string(1, e.op) + "' in ExpressionCompiler::visit");
+        }
+
+        instructions.push_back(CompiledExpression::Instruction{ op, 0, 0.0, nullptr });
+    }
+
+    void
+    ExpressionCompiler::visit(FunctionExpression & e)
+    {
+        e.arg.accept(*this);
+
+        auto & instructions = _program.instructions;
+
+        // constant folding: the argument has been reduced to a single constant
+        if ((! instructions.empty()) && (CompiledExpression::OpCode::push_constant == instructions.back().op))
+        {
+            instructions.back().value = e.f(instructions.back().value);
+
+            return;
+        }
+
+        instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::call, 0, 0.0, e.f });
+    }
+
+    void
+    ExpressionCompiler::visit(ConstantExpression & e)
+    {
+        _program.instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::push_constant, 0, e.value, nullptr });
+    }
+
+    void
+    ExpressionCompiler::visit(ObservableNameExpression &)
+    {
+        throw InternalError("Encountered ObservableNameExpression in ExpressionCompiler::visit");
+    }
+
+    void
+    ExpressionCompiler::visit(ObservableExpression & e)
+    {
+        _program.observables.push_back(e.observable);
+        _program.instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::load_observable, static_cast<unsigned>(_program.observables.size() - 1), 0.0, nullptr });
+    }
+
+    void
+    ExpressionCompiler::visit(ParameterNameExpression &)
+    {
+        throw InternalError("Encountered ParameterNameExpression in ExpressionCompiler::visit");
+    }
+
+    void
+    ExpressionCompiler::visit(ParameterExpression & e)
+    {
+        _program.parameters.push_back(e.parameter);
+        _program.instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::load_parameter, static_cast<unsigned>(_program.parameters.size() - 1), 0.0, nullptr });
+    }
+
+    void
+    ExpressionCompiler::visit(KinematicVariableNameExpression &)
+    {
+        throw InternalError("Encountered KinematicVariableNameExpression in ExpressionCompiler::visit");
+    }
+
+    void
+    ExpressionCompiler::visit(KinematicVariableExpression & e)
+    {
+        _program.kinematic_variables.push_back(e.kinematic_variable);
+        _program.instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::load_kinematic_variable, static_cast<unsigned>(_program.kinematic_variables.size() - 1), 0.0, nullptr });
+    }
+
+    void
+    ExpressionCompiler::visit(CachedObservableExpression & e)
+    {
+        _program.cached_observables.push_back(std::make_pair(e.cache, e.id));
+        _program.instructions.push_back(CompiledExpression::Instruction{ CompiledExpression::OpCode::load_cached_observable, static_cast<unsigned>(_program.cached_observables.size() - 1), 0.0, nullptr });
+    }
+
+    /*
+     * CompiledExpression
+     */
+
+    CompiledExpression::CompiledExpression(const Expression & expression)
+    {
+        ExpressionCompiler compiler(*this);
+        expression.accept(compiler);
+
+        // verify that the evaluation stack suffices; only pushes grow the stack
+        unsigned depth = 0, max_depth = 0;
+        for (const auto & instruction : instructions)
+        {
+            switch (instruction.op)
+            {
+                case OpCode::add:
+                case OpCode::subtract:
+                case OpCode::multiply:
+                case OpCode::divide:
+                case OpCode::power:
+                    --depth;
+                    break;
+
+                case OpCode::call:
+                    break;
+
+                default:
+                    ++depth;
+                    max_depth = std::max(max_depth, depth);
+                    break;
+            }
+        }
+
+        if (max_depth > max_stack_depth)
+        {
+            throw InternalError("Expression exceeds the maximal stack depth in CompiledExpression");
+        }
+    }
+
+    double
+    CompiledExpression::evaluate() const
+    {
+        double stack[max_stack_depth];
+        double * top = stack;
+
+        for (const auto & instruction : instructions)
+        {
+            switch (instruction.op)
+            {
+                case OpCode::push_constant:
+                    *top++ = instruction.value;
+                    break;
+
+                case OpCode::load_parameter:
+                    *top++ = parameters[instruction.index].evaluate();
+                    break;
+
+                case OpCode::load_kinematic_variable:
+                    *top++ = kinematic_variables[instruction.index].evaluate();
+                    break;
+
+                case OpCode::load_observable:
+                    *top++ = observables[instruction.index]->evaluate();
+                    break;
+
+                case OpCode::load_cached_observable:
+                    {
+                        const auto & cached = cached_observables[instruction.index];
+                        *top++ = cached.first[cached.second];
+                    }
+                    break;
+
+                case OpCode::add:
+                    top[-2] = top[-2] + top[-1];
+                    --top;
+                    break;
+
+                case OpCode::subtract:
+                    top[-2] = top[-2] - top[-1];
+                    --top;
+                    break;
+
+                case OpCode::multiply:
+                    top[-2] = top[-2] * top[-1];
+                    --top;
+                    break;
+
+                case OpCode::divide:
+                    top[-2] = top[-2] / top[-1];
+                    --top;
+                    break;
+
+                case OpCode::power:
+                    top[-2] = std::pow(top[-2], top[-1]);
+                    --top;
+                    break;
+
+                case OpCode::call:
+                    top[-1] = instruction.function(top[-1]);
+                    break;
+            }
+        }
+
+        return top[-1];
+    }
 }
@@ -0,0 +1,150 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/frozen-observable.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace eos
+{
+    template <>
+    struct Implementation<FrozenObservable>
+    {
+        ObservablePtr observable;
+
+        Parameters parameters;
+
+        // the parameters the underlying observable actually uses, with the
+        // generation stamps they carried when 'value' was last computed
+        std::vector<Parameter> used_parameters;
+        mutable std::vector<std::uint64_t> used_generations;
+
+        // generation of the parameter set as a whole at the last evaluation;
+        // a match rules out any modification without per-parameter checks
+        mutable std::uint64_t generation;
+
+        mutable double value;
+
+        mutable bool valid;
+
+        Implementation(const ObservablePtr & observable, ParameterUser & user) :
+            observable(observable),
+            parameters(observable->parameters()),
+            generation(0),
+            value(std::numeric_limits<double>::quiet_NaN()),
+            valid(false)
+        {
+            for (const auto & id : *observable)
+            {
+                used_parameters.push_back(parameters[id]);
+            }
+            used_generations.resize(used_parameters.size(), 0u);
+
+            user.uses(*observable);
+        }
+    };
+
+    FrozenObservable::FrozenObservable(const ObservablePtr & observable) :
+        PrivateImplementationPattern<FrozenObservable>(new Implementation<FrozenObservable>(observable, *this))
+    {
+    }
+
+    FrozenObservable::~FrozenObservable()
+    {
+    }
+
+    const QualifiedName &
+    FrozenObservable::name() const
+    {
+        return _imp->observable->name();
+    }
+
+    double
+    FrozenObservable::evaluate() const
+    {
+        const std::uint64_t generation = _imp->parameters.generation();
+
+        if (_imp->valid && (generation == _imp->generation))
+            return _imp->value;
+
+        if (_imp->valid)
+        {
+            // the parameter set was modified, but possibly only in parameters
+            // that the underlying observable does not use
+            bool stale = false;
+            for (auto i = 0u, i_end = unsigned(_imp->used_parameters.size()) ; i < i_end ; ++i)
+            {
+                if (_imp->used_parameters[i].generation() != _imp->used_generations[i])
+                {
+                    stale = true;
+                    break;
+                }
+            }
+
+            if (! stale)
+            {
+                _imp->generation = generation;
+                return _imp->value;
+            }
+        }
+
+        _imp->value = _imp->observable->evaluate();
+        for (auto i = 0u, i_end = unsigned(_imp->used_parameters.size()) ; i < i_end ; ++i)
+        {
+            _imp->used_generations[i] = _imp->used_parameters[i].generation();
+        }
+        _imp->generation = generation;
+        _imp->valid = true;
+
+        return _imp->value;
+    }
+
+    Kinematics
+    FrozenObservable::kinematics()
+    {
+        return _imp->observable->kinematics();
+    }
+
+    Parameters
+    FrozenObservable::parameters()
+    {
+        return _imp->parameters;
+    }
+
+    Options
+    FrozenObservable::options()
+    {
+        return _imp->observable->options();
+    }
+
+    ObservablePtr
+    FrozenObservable::clone() const
+    {
+        return ObservablePtr(new FrozenObservable(_imp->observable->clone()));
+    }
+
+    ObservablePtr
+    FrozenObservable::clone(const Parameters & parameters) const
+    {
+        return ObservablePtr(new FrozenObservable(_imp->observable->clone(parameters)));
+    }
+}
@@ -0,0 +1,70 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_FROZEN_OBSERVABLE_HH
+#define EOS_GUARD_EOS_UTILS_FROZEN_OBSERVABLE_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+namespace eos
+{
+    /*!
+     * Lightweight evaluation wrapper around an observable bound to a frozen
+     * parameter snapshot, as produced by Observable::freeze().
+     *
+     * The wrapper records the generation stamps of the parameters the
+     * underlying observable actually uses. As long as none of them has been
+     * modified, evaluate() returns the previously computed value without
+     * touching the underlying observable; only a change to a used parameter
+     * triggers a re-evaluation. In deployments where most parameters are
+     * fixed permanently, repeated evaluations thus reduce to a generation
+     * comparison and a load.
+     */
+    class FrozenObservable :
+        public Observable,
+        public PrivateImplementationPattern<FrozenObservable>
+    {
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param observable The underlying observable, already bound to the frozen parameter snapshot.
+             */
+            FrozenObservable(const ObservablePtr & observable);
+
+            ~FrozenObservable();
+
+            virtual const QualifiedName & name() const;
+
+            virtual double evaluate() const;
+
+            virtual Kinematics kinematics();
+
+            virtual Parameters parameters();
+
+            virtual Options options();
+
+            virtual ObservablePtr clone() const;
+
+            virtual ObservablePtr clone(const Parameters & parameters) const;
+    };
+}
+
+#endif
@@ -0,0 +1,149 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/frozen-observable.hh>
+
+#include <atomic>
+#include <memory>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // doubles the value of a single parameter, and counts its evaluations
+    class CountingObservable :
+        public Observable
+    {
+        private:
+            Parameters _parameters;
+
+            UsedParameter _parameter;
+
+            Kinematics _kinematics;
+
+            Options _options;
+
+            QualifiedName _name;
+
+            std::shared_ptr<std::atomic<unsigned>> _evaluations;
+
+        public:
+            CountingObservable(const Parameters & parameters, const std::string & parameter_name,
+                    const std::shared_ptr<std::atomic<unsigned>> & evaluations) :
+                _parameters(parameters),
+                _parameter(parameters[parameter_name], *this),
+                _name("test::observable"),
+                _evaluations(evaluations)
+            {
+            }
+
+            virtual ~CountingObservable()
+            {
+            }
+
+            virtual double evaluate() const
+            {
+                _evaluations->fetch_add(1);
+
+                return 2.0 * _parameter();
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return ObservablePtr(new CountingObservable(_parameters.clone(), _parameter.name(), _evaluations));
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new CountingObservable(parameters, _parameter.name(), _evaluations));
+            }
+
+            virtual Parameters parameters()
+            {
+                return _parameters;
+            }
+
+            virtual Kinematics kinematics()
+            {
+                return _kinematics;
+            }
+
+            virtual Options options()
+            {
+                return _options;
+            }
+
+            virtual const QualifiedName & name() const
+            {
+                return _name;
+            }
+    };
+}
+
+class FrozenObservableTest :
+    public TestCase
+{
+    public:
+        FrozenObservableTest() :
+            TestCase("frozen_observable_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            Parameters parameters = Parameters::Defaults();
+            parameters["mass::c"] = 1.27;
+
+            auto evaluations = std::make_shared<std::atomic<unsigned>>(0);
+            ObservablePtr observable(new CountingObservable(parameters, "mass::c", evaluations));
+
+            // freezing binds the observable to its own parameter snapshot
+            Parameters snapshot = parameters.clone();
+            ObservablePtr frozen = observable->freeze(snapshot);
+            TEST_CHECK(! (frozen->parameters() != snapshot));
+
+            // the first evaluation computes and memoizes the value
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 2.54, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 1u);
+
+            // repeated evaluations at an unchanged snapshot are served from the memo
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 2.54, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 1u);
+
+            // modifying a parameter that the observable does not use leaves the memo valid
+            snapshot["mass::b(MSbar)"] = 4.3;
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 2.54, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 1u);
+
+            // modifying a used parameter triggers exactly one re-evaluation
+            snapshot["mass::c"] = 1.50;
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 3.00, eps);
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 3.00, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 2u);
+
+            // changes to the original parameters do not leak into the frozen observable
+            parameters["mass::c"] = 1.80;
+            TEST_CHECK_NEARLY_EQUAL(frozen->evaluate(), 3.00, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 2u);
+        }
+} frozen_observable_test;
@@ -0,0 +1,82 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_FUNCTION_REF_HH
+#define EOS_GUARD_EOS_UTILS_FUNCTION_REF_HH 1
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace eos
+{
+    template <typename Signature_> class FunctionRef;
+
+    /*!
+     * Non-owning view of a callable, for use in evaluation-path interfaces.
+     *
+     * Unlike std::function, constructing a FunctionRef from a closure never
+     * allocates and never copies the closure's captures; the view holds only
+     * a pointer to the callable and a call thunk. Interfaces taking a
+     * FunctionRef parameter therefore accept lambdas, bind expressions and
+     * std::function objects alike without boxing them per call.
+     *
+     * The view does not extend the callable's lifetime: it may only be used
+     * while the callable it was constructed from is alive. Passing a
+     * temporary closure directly to a FunctionRef parameter is fine, since
+     * the temporary outlives the full expression; storing a FunctionRef
+     * beyond that requires the callable to be kept alive by the caller.
+     *
+     * The callable's return type must match the signature's result type
+     * exactly. This keeps overload sets built on FunctionRef unambiguous,
+     * e.g. between real- and complex-valued integrands.
+     */
+    template <typename Result_, typename... Args_>
+    class FunctionRef<Result_ (Args_...)>
+    {
+        private:
+            void * _object;
+
+            Result_ (* _thunk)(void *, Args_...);
+
+        public:
+            template <typename Callable_>
+            requires ((! std::is_same_v<std::remove_cvref_t<Callable_>, FunctionRef>)
+                    && std::is_same_v<std::invoke_result_t<Callable_ &, Args_...>, Result_>)
+            FunctionRef(Callable_ && callable) :
+                _object(const_cast<void *>(static_cast<const void *>(std::addressof(callable)))),
+                _thunk([] (void * object, Args_... args) -> Result_
+                {
+                    return (*static_cast<std::remove_reference_t<Callable_> *>(object))(std::forward<Args_>(args)...);
+                })
+            {
+            }
+
+            FunctionRef(const FunctionRef &) = default;
+            FunctionRef & operator= (const FunctionRef &) = default;
+
+            /// Invoke the referenced callable.
+            Result_ operator() (Args_... args) const
+            {
+                return _thunk(_object, std::forward<Args_>(args)...);
+            }
+    };
+}
+
+#endif
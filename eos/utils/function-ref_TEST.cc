@@ -0,0 +1,98 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/complex.hh>
+#include <eos/utils/function-ref.hh>
+
+#include <functional>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    double
+    invoke_view(const FunctionRef<double (const double &)> & f, const double & x)
+    {
+        return f(x);
+    }
+
+    // overload set distinguishing real- and complex-valued callables
+    std::string
+    describe(const FunctionRef<double (const double &)> &)
+    {
+        return "real";
+    }
+
+    std::string
+    describe(const FunctionRef<complex<double> (const double &)> &)
+    {
+        return "complex";
+    }
+}
+
+class FunctionRefTest :
+    public TestCase
+{
+    public:
+        FunctionRefTest() :
+            TestCase("function_ref_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // viewing a lambda
+            {
+                auto square = [] (const double & x) -> double { return x * x; };
+
+                TEST_CHECK_EQUAL(invoke_view(square, 3.0), 9.0);
+                TEST_CHECK_EQUAL(invoke_view([] (const double & x) -> double { return 2.0 * x; }, 3.0), 6.0);
+            }
+
+            // the view aliases the closure rather than copying its captures
+            {
+                double scale = 2.0;
+                auto scaled = [&scale] (const double & x) -> double { return scale * x; };
+
+                FunctionRef<double (const double &)> view(scaled);
+                TEST_CHECK_EQUAL(view(3.0), 6.0);
+
+                scale = 5.0;
+                TEST_CHECK_EQUAL(view(3.0), 15.0);
+            }
+
+            // viewing a std::function
+            {
+                std::function<double (const double &)> f = [] (const double & x) -> double { return x + 1.0; };
+
+                TEST_CHECK_EQUAL(invoke_view(f, 3.0), 4.0);
+            }
+
+            // the exact-return-type constraint keeps overload sets unambiguous
+            {
+                auto real_valued = [] (const double & x) -> double { return x; };
+                auto complex_valued = [] (const double & x) -> complex<double> { return complex<double>(0.0, x); };
+
+                TEST_CHECK_EQUAL(describe(real_valued), "real");
+                TEST_CHECK_EQUAL(describe(complex_valued), "complex");
+            }
+        }
+} function_ref_test;
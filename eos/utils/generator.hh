@@ -0,0 +1,122 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_GENERATOR_HH
+#define EOS_GUARD_EOS_UTILS_GENERATOR_HH 1
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace eos
+{
+    /*!
+     * Minimal generator coroutine.
+     *
+     * A function with return type Generator<T_> produces a lazy sequence of
+     * values via co_yield; the consumer pulls them one at a time with next().
+     * Production is interleaved with consumption, which lets e.g. the
+     * command-line clients overlap the generation of work items with their
+     * processing. Exceptions thrown by the producer are rethrown from next().
+     *
+     * Note that coroutine parameters taken by reference outlive neither
+     * suspension nor the caller's scope; producers should take their
+     * parameters by value.
+     */
+    template <typename T_>
+    class Generator
+    {
+        public:
+            struct promise_type
+            {
+                std::optional<T_> value;
+                std::exception_ptr exception;
+
+                Generator get_return_object()
+                {
+                    return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() const noexcept { return { }; }
+                std::suspend_always final_suspend() const noexcept { return { }; }
+
+                std::suspend_always yield_value(T_ v)
+                {
+                    value = std::move(v);
+                    return { };
+                }
+
+                void return_void() const noexcept { }
+
+                void unhandled_exception()
+                {
+                    exception = std::current_exception();
+                }
+            };
+
+        private:
+            std::coroutine_handle<promise_type> _handle;
+
+            explicit Generator(std::coroutine_handle<promise_type> handle) :
+                _handle(handle)
+            {
+            }
+
+        public:
+            Generator(Generator && other) noexcept :
+                _handle(std::exchange(other._handle, nullptr))
+            {
+            }
+
+            Generator(const Generator &) = delete;
+            Generator & operator= (const Generator &) = delete;
+
+            ~Generator()
+            {
+                if (_handle)
+                {
+                    _handle.destroy();
+                }
+            }
+
+            /*!
+             * Produce the next value of the sequence.
+             *
+             * @return The value, or nothing once the sequence is exhausted.
+             */
+            std::optional<T_> next()
+            {
+                if (! _handle || _handle.done())
+                    return std::nullopt;
+
+                _handle.resume();
+
+                if (_handle.promise().exception)
+                    std::rethrow_exception(_handle.promise().exception);
+
+                if (_handle.done())
+                    return std::nullopt;
+
+                return std::move(_handle.promise().value);
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/generator.hh>
+#include <eos/utils/exception.hh>
+
+#include <string>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    Generator<unsigned> count_to(unsigned n)
+    {
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    Generator<std::string> fail_after_one()
+    {
+        co_yield std::string("first");
+
+        throw InternalError("fail_after_one: no more values");
+    }
+}
+
+class GeneratorTest :
+    public TestCase
+{
+    public:
+        GeneratorTest() :
+            TestCase("generator_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // produce a finite sequence, then signal exhaustion
+            {
+                auto generator = count_to(5);
+
+                std::vector<unsigned> values;
+                while (auto value = generator.next())
+                {
+                    values.push_back(*value);
+                }
+
+                TEST_CHECK_EQUAL(values.size(), 5u);
+                for (unsigned i = 0 ; i < 5 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(values[i], i);
+                }
+
+                // further calls keep signalling exhaustion
+                TEST_CHECK(! generator.next());
+            }
+
+            // an empty sequence signals exhaustion right away
+            {
+                auto generator = count_to(0);
+
+                TEST_CHECK(! generator.next());
+            }
+
+            // exceptions thrown by the producer are rethrown from next()
+            {
+                auto generator = fail_after_one();
+
+                TEST_CHECK_EQUAL(*generator.next(), "first");
+                TEST_CHECK_THROWS(InternalError, generator.next());
+            }
+        }
+} generator_test;
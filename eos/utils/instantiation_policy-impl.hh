@@ -24,8 +24,8 @@
 #define EOS_GUARD_EOS_UTILS_INSTANTIATION_POLICY_IMPL_HH 1
 
 #include <eos/utils/instantiation_policy.hh>
-#include <eos/utils/lock.hh>
-#include <eos/utils/mutex.hh>
+
+#include <typeinfo>
 
 namespace eos
 {
@@ -40,52 +40,64 @@ namespace eos
     class InstantiationPolicy<T_, Singleton>::DeleteOnDestruction
     {
         private:
-            T_ * * const _ptr;
+            std::atomic<T_ *> * const _storage;
 
         public:
-            DeleteOnDestruction(T_ * * const ptr) :
-                _ptr(ptr)
+            DeleteOnDestruction(std::atomic<T_ *> * const storage) :
+                _storage(storage)
             {
             }
 
             ~DeleteOnDestruction()
             {
-                InstantiationPolicy<T_, Singleton>::_delete(*_ptr);
-
-                *_ptr = 0;
+                InstantiationPolicy<T_, Singleton>::_delete(_storage->exchange(nullptr));
             }
     };
 
     template <typename T_>
-    T_ * *
-    InstantiationPolicy<T_, Singleton>::_instance_ptr()
+    std::atomic<T_ *> &
+    InstantiationPolicy<T_, Singleton>::_storage()
     {
-        static T_ * instance(0);
-        static DeleteOnDestruction delete_instance(&instance);
+        static std::atomic<T_ *> storage(nullptr);
+        static DeleteOnDestruction delete_instance(&storage);
 
-        return &instance;
+        return storage;
+    }
+
+    template <typename T_>
+    std::once_flag &
+    InstantiationPolicy<T_, Singleton>::_once_flag()
+    {
+        static std::once_flag flag;
+
+        return flag;
     }
 
     template <typename T_>
     T_ *
     InstantiationPolicy<T_, Singleton>::instance()
     {
-        T_ * * instance_ptr(_instance_ptr());
+        std::atomic<T_ *> & storage(_storage());
 
-        if (0 == *instance_ptr)
+        // fast path: a single load; pairs with the release store below
+        T_ * result = storage.load(std::memory_order_acquire);
+        if (nullptr == result)
         {
-            static Mutex m;
-            Lock l(m);
+            std::call_once(_once_flag(), [&storage]()
+            {
+                const auto start = std::chrono::steady_clock::now();
+                T_ * instance = new T_;
+                const auto stop = std::chrono::steady_clock::now();
 
-            instance_ptr = _instance_ptr();
+                storage.store(instance, std::memory_order_release);
 
-            if (0 == *instance_ptr)
-            {
-                *instance_ptr = new T_;
-            }
+                SingletonAudit::record(typeid(T_).name(), stop - start);
+            });
+
+            result = storage.load(std::memory_order_acquire);
         }
 
-        return *instance_ptr;
+        return result;
     }
 }
 
@@ -0,0 +1,65 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS program. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+
+namespace eos
+{
+    namespace
+    {
+        /*
+         * The audit registry deliberately uses function-local statics rather than
+         * InstantiationPolicy<_, Singleton>, since it is itself invoked from the
+         * singleton initialization path.
+         */
+        Mutex &
+        audit_mutex()
+        {
+            static Mutex mutex;
+
+            return mutex;
+        }
+
+        std::vector<SingletonAudit::Record> &
+        audit_records()
+        {
+            static std::vector<SingletonAudit::Record> records;
+
+            return records;
+        }
+    }
+
+    std::vector<SingletonAudit::Record>
+    SingletonAudit::records()
+    {
+        Lock l(audit_mutex());
+
+        return audit_records();
+    }
+
+    void
+    SingletonAudit::record(std::string && name, const std::chrono::steady_clock::duration & duration)
+    {
+        Lock l(audit_mutex());
+
+        audit_records().push_back(Record{ std::move(name), duration });
+    }
+}
@@ -23,6 +23,12 @@
 #ifndef EOS_GUARD_EOS_UTILS_INSTANTIATION_POLICY_HH
 #define EOS_GUARD_EOS_UTILS_INSTANTIATION_POLICY_HH 1
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
 namespace eos
 {
     /**
@@ -94,8 +100,11 @@ namespace eos
 
             friend class DeleteOnDestruction;
 
-            /// Returns a pointer to our instance pointer.
-            static T_ * * _instance_ptr();
+            /// Returns the atomic storage holding our instance pointer.
+            static std::atomic<T_ *> & _storage();
+
+            /// Returns the once-flag that guards our initialization.
+            static std::once_flag & _once_flag();
 
             /// Deletes the object of T_ that is pointed at by ptr.
             static void _delete(T_ * const ptr);
@@ -113,12 +122,43 @@ namespace eos
             }
 
         public:
-            /// Returns the instance.
+            /// Returns the instance; once initialized, this is a single atomic load.
             static T_ * instance();
 
     };
 
     /// \}
+
+    /**
+     * Audit log of singleton initializations.
+     *
+     * Every InstantiationPolicy<T_, Singleton> registers itself upon first use.
+     * The records list the singletons in initialization order, together with the
+     * time spent in their constructors; useful to spot analysis setup that
+     * serializes on singleton construction.
+     */
+    class SingletonAudit
+    {
+        private:
+            /// Unwanted default constructor: Do not implement!
+            SingletonAudit();
+
+        public:
+            struct Record
+            {
+                /// implementation-defined (mangled) name of the singleton type
+                std::string name;
+
+                /// time spent in the singleton's constructor
+                std::chrono::steady_clock::duration duration;
+            };
+
+            /// Returns the records of all initialized singletons, in initialization order.
+            static std::vector<Record> records();
+
+            /// \internal called by InstantiationPolicy<T_, Singleton>::instance()
+            static void record(std::string && name, const std::chrono::steady_clock::duration & duration);
+    };
 }
 
 #endif
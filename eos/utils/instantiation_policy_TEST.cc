@@ -0,0 +1,103 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS program. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    class Counted :
+        public InstantiationPolicy<Counted, Singleton>
+    {
+        private:
+            Counted()
+            {
+                ++constructions;
+            }
+
+        public:
+            friend class InstantiationPolicy<Counted, Singleton>;
+
+            static unsigned constructions;
+    };
+
+    unsigned Counted::constructions = 0;
+}
+
+namespace eos
+{
+    template class InstantiationPolicy<Counted, Singleton>;
+}
+
+class SingletonTest :
+    public TestCase
+{
+    public:
+        SingletonTest() :
+            TestCase("singleton_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // concurrent first use constructs exactly one instance
+            {
+                std::vector<Counted *> results(8, nullptr);
+                std::vector<std::thread> threads;
+
+                for (unsigned i = 0 ; i < 8 ; ++i)
+                {
+                    threads.emplace_back([&results, i]() { results[i] = Counted::instance(); });
+                }
+
+                for (auto & t : threads)
+                {
+                    t.join();
+                }
+
+                TEST_CHECK_EQUAL(Counted::constructions, 1u);
+                for (unsigned i = 0 ; i < 8 ; ++i)
+                {
+                    TEST_CHECK(results[i] == Counted::instance());
+                }
+            }
+
+            // the audit log records the initialization
+            {
+                const auto records = SingletonAudit::records();
+                const std::string name = typeid(Counted).name();
+
+                auto r = std::find_if(records.begin(), records.end(),
+                        [&name](const SingletonAudit::Record & record) { return record.name == name; });
+
+                TEST_CHECK(r != records.end());
+                TEST_CHECK(r->duration >= std::chrono::steady_clock::duration::zero());
+            }
+        }
+} singleton_test;
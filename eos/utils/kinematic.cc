@@ -22,6 +22,7 @@
 #include <eos/utils/stringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <cstdint>
 #include <map>
 #include <vector>
 
@@ -37,7 +38,54 @@ namespace eos
     template <>
     struct Implementation<Kinematics>
     {
-        std::vector<double> variables_data;
+        /*
+         * Small-buffer-optimized storage for the variables' values: almost every
+         * Kinematics object holds only a handful of variables, so the first
+         * inline_capacity values live inline and only larger sets spill to the
+         * heap. This keeps the hot KinematicVariable::set/evaluate path free of
+         * a second pointer indirection.
+         */
+        struct DataStore
+        {
+            static constexpr unsigned inline_capacity = 8;
+
+            double inline_data[inline_capacity];
+
+            std::vector<double> overflow_data;
+
+            unsigned n = 0;
+
+            double & operator[] (const unsigned & index)
+            {
+                return index < inline_capacity ? inline_data[index] : overflow_data[index - inline_capacity];
+            }
+
+            const double & operator[] (const unsigned & index) const
+            {
+                return index < inline_capacity ? inline_data[index] : overflow_data[index - inline_capacity];
+            }
+
+            void push_back(const double & value)
+            {
+                if (n < inline_capacity)
+                {
+                    inline_data[n] = value;
+                }
+                else
+                {
+                    overflow_data.push_back(value);
+                }
+
+                ++n;
+            }
+
+            unsigned size() const
+            {
+                return n;
+            }
+        };
+
+        DataStore variables_data;
 
         std::map<std::string, unsigned> variables_map;
 
@@ -46,6 +94,10 @@ namespace eos
         std::map<std::string, unsigned> alias_map;
 
         std::vector<KinematicVariable> variables;
+
+        // Incremented upon each modification of any variable's numeric value;
+        // mirrors the generation counter of Implementation<Parameters>.
+        std::uint64_t generation = 0;
     };
 
     Kinematics::Kinematics() :
@@ -224,51 +276,78 @@ namespace eos
     Kinematics::declare(const std::string & name, const double & value)
     {
         const auto i(_imp->variables_map.find(name));
-        const auto j(_imp->alias_map.find(name));
-        bool regular    = (_imp->variables_map.end() != i);
-        bool alias      = (_imp->alias_map.end() != j);
-        bool undeclared = (! regular) && (! alias);
-
-        if (undeclared)
-        {
-            int index = _imp->variables_data.size();
-            _imp->variables_map[name] = index;
-            _imp->variables_data.push_back(value);
-            _imp->variables_names.push_back(name);
-            _imp->variables.push_back(KinematicVariable(_imp, index, false));
 
-            return KinematicVariable(_imp, index, false);
-        }
-        else if (regular)
+        if (_imp->variables_map.end() != i)
         {
             _imp->variables_data[i->second] = value;
+            ++_imp->generation;
 
             return KinematicVariable(_imp, i->second, false);
         }
-        else // alias
+
+        const auto j(_imp->alias_map.find(name));
+
+        if (_imp->alias_map.end() != j)
         {
             _imp->variables_data[j->second] = value;
+            ++_imp->generation;
 
             return KinematicVariable(_imp, j->second, true);
         }
+
+        int index = _imp->variables_data.size();
+        _imp->variables_map[name] = index;
+        _imp->variables_data.push_back(value);
+        _imp->variables_names.push_back(name);
+        _imp->variables.push_back(KinematicVariable(_imp, index, false));
+        ++_imp->generation;
+
+        return KinematicVariable(_imp, index, false);
     }
 
     void
     Kinematics::set(const std::string & name, const double & value)
     {
         const auto i(_imp->variables_map.find(name));
-        const auto j(_imp->alias_map.find(name));
-        bool regular    = (_imp->variables_map.end() != i);
-        bool alias      = (_imp->alias_map.end() == j);
-        bool undeclared = (! regular) && (! alias);
-
-        if (undeclared)
-            throw UnknownKinematicVariableError(name);
 
-        if (regular)
+        if (_imp->variables_map.end() != i)
+        {
             _imp->variables_data[i->second] = value;
-        else // alias
+            ++_imp->generation;
+
+            return;
+        }
+
+        const auto j(_imp->alias_map.find(name));
+
+        if (_imp->alias_map.end() != j)
+        {
             _imp->variables_data[j->second] = value;
+            ++_imp->generation;
+
+            return;
+        }
+
+        throw UnknownKinematicVariableError(name);
+    }
+
+    void
+    Kinematics::set_all(const double * values)
+    {
+        const unsigned n = _imp->variables_data.size();
+
+        for (unsigned i = 0 ; i < n ; ++i)
+        {
+            _imp->variables_data[i] = values[i];
+        }
+
+        ++_imp->generation;
+    }
+
+    std::uint64_t
+    Kinematics::generation() const
+    {
+        return _imp->generation;
     }
 
     Kinematics::KinematicVariableIterator
@@ -321,6 +400,7 @@ namespace eos
     KinematicVariable::operator= (const double & value)
     {
         _imp->variables_data[_index] = value;
+        ++_imp->generation;
 
         return *this;
     }
@@ -329,6 +409,7 @@ namespace eos
     KinematicVariable::set(const double & value)
     {
         _imp->variables_data[_index] = value;
+        ++_imp->generation;
     }
 
     const std::string &
@@ -25,6 +25,8 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstdint>
+
 namespace eos
 {
     /*!
@@ -141,12 +143,35 @@ namespace eos
              */
             void set(const std::string & variable, const double & value);
 
+            /*!
+             * Set all kinematic variables' numeric values at once.
+             *
+             * The values are assigned in declaration order, i.e., the order in
+             * which begin()/end() iterate over the variables. No name lookup is
+             * involved, which makes this the preferred mutator for tight
+             * phase-space loops. Aliases need no separate update, since they
+             * share their variable's storage.
+             *
+             * @param values Pointer to one new numeric value per declared variable.
+             */
+            void set_all(const double * values);
+
             /*!
              * Retrieve a variable's KinematicVariable object by name.
              *
              * @param name  The name of the KinematicVariable that shall be retrieved.
              */
             KinematicVariable operator[] (const std::string & variable) const;
+
+            /*!
+             * Retrieve the current generation of this set of kinematic variables.
+             *
+             * The generation is incremented upon each modification of any variable's
+             * numeric value. Together with Parameters::generation(), it allows caches
+             * to decide in O(1) whether a previously computed result is still current;
+             * see EvaluationStamp.
+             */
+            std::uint64_t generation() const;
             ///@}
 
             ///@name Iteration over our kinematic variables
@@ -19,6 +19,7 @@
 
 #include <test/test.hh>
 #include <eos/utils/kinematic.hh>
+#include <eos/utils/stringify.hh>
 
 #include <cmath>
 
@@ -81,6 +82,15 @@ class KinematicsTest :
                 kinematics.set("foo", 17.0);
 
                 TEST_CHECK_EQUAL(17.0, kinematics["foo"]);
+
+                // setting through an alias modifies the underlying variable
+                kinematics.alias("bar", "foo");
+                kinematics.set("bar", 23.0);
+                TEST_CHECK_EQUAL(23.0, kinematics["foo"]);
+                TEST_CHECK_EQUAL(23.0, kinematics["bar"]);
+
+                // setting an undeclared variable throws
+                TEST_CHECK_THROWS(UnknownKinematicVariableError, kinematics.set("baz", 1.0));
             }
 
             // Equality/Inequality
@@ -175,5 +185,88 @@ class KinematicsTest :
 
                 TEST_CHECK_NO_THROW(-0.5 == k["z"].evaluate());
             }
+
+            // Bulk mutation (in declaration order, visible through aliases and handles)
+            {
+                Kinematics k
+                {
+                    { "s_min",       1.0 },
+                    { "s_max",       6.0 },
+                    { "cos(theta)", -0.5 },
+                };
+                k.alias("z", "cos(theta)");
+
+                auto handle = k["s_max"];
+
+                static const double values[3] = { 2.0, 5.0, 0.25 };
+                k.set_all(values);
+
+                TEST_CHECK_EQUAL(2.0,  k["s_min"]);
+                TEST_CHECK_EQUAL(5.0,  k["s_max"]);
+                TEST_CHECK_EQUAL(0.25, k["cos(theta)"]);
+                TEST_CHECK_EQUAL(0.25, k["z"]);
+                TEST_CHECK_EQUAL(5.0,  handle.evaluate());
+            }
+
+            // Generation counter (incremented by every value modification)
+            {
+                Kinematics k
+                {
+                    { "s_min", 1.0 },
+                    { "s_max", 6.0 },
+                };
+
+                const unsigned generation = k.generation();
+
+                // reads leave the generation untouched
+                TEST_CHECK_EQUAL(1.0, k["s_min"]);
+                TEST_CHECK_EQUAL(generation, k.generation());
+
+                // every mutator advances the generation
+                k.set("s_min", 2.0);
+                TEST_CHECK(generation < k.generation());
+
+                const unsigned after_set = k.generation();
+                k["s_max"] = 5.0;
+                TEST_CHECK(after_set < k.generation());
+
+                const unsigned after_assignment = k.generation();
+                static const double values[2] = { 1.5, 5.5 };
+                k.set_all(values);
+                TEST_CHECK(after_assignment < k.generation());
+
+                // an independent clone advances its generation independently
+                auto c = k.clone();
+                const unsigned cloned = c.generation();
+                c.set("s_min", 0.5);
+                TEST_CHECK(cloned < c.generation());
+                TEST_CHECK_EQUAL(k.generation(), cloned);
+            }
+
+            // More variables than the inline storage can hold
+            {
+                Kinematics k;
+                for (unsigned i = 0 ; i < 12 ; ++i)
+                {
+                    k.declare("v" + stringify(i), 1.0 * i);
+                }
+
+                for (unsigned i = 0 ; i < 12 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(1.0 * i, k["v" + stringify(i)]);
+                }
+
+                double values[12];
+                for (unsigned i = 0 ; i < 12 ; ++i)
+                {
+                    values[i] = 100.0 + i;
+                }
+                k.set_all(values);
+
+                for (unsigned i = 0 ; i < 12 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(100.0 + i, k["v" + stringify(i)]);
+                }
+            }
         }
 } kinematics_test;
@@ -21,16 +21,11 @@
 #define EOS_GUARD_EOS_UTILS_KMATRIX_IMPL_HH 1
 
 #include <eos/maths/complex.hh>
+#include <eos/maths/matrix.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/kmatrix.hh>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_complex_math.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_matrix.h>
-
 #include <limits>
 
 namespace eos
@@ -43,12 +38,7 @@ namespace eos
         _channels(channels),
         _resonances(resonances),
         _bkgcst(bkgcst),
-        _prefix(prefix),
-        _Khat(gsl_matrix_complex_calloc(nchannels_, nchannels_)),
-        _That(gsl_matrix_complex_calloc(nchannels_, nchannels_)),
-        _tmp_1(gsl_matrix_complex_calloc(nchannels_, nchannels_)),
-        _tmp_2(gsl_matrix_complex_calloc(nchannels_, nchannels_)),
-        _perm(gsl_permutation_calloc(nchannels_))
+        _prefix(prefix)
     {
         // Perform size checks
         if (channels.size() != nchannels_)
@@ -59,42 +49,6 @@ namespace eos
             throw InternalError("The array of background constants is not valid");
         if (resonances.size() != nresonances_)
             throw InternalError("The size of the resonances array does not match nresonances_.");
-
-        // Perform pointer checks
-        if (_Khat == nullptr)
-            throw std::bad_alloc();
-        if (_That == nullptr)
-            throw std::bad_alloc();
-        if (_tmp_1 == nullptr)
-            throw std::bad_alloc();
-        if (_tmp_2 == nullptr)
-            throw std::bad_alloc();
-        if (_perm == nullptr)
-            throw std::bad_alloc();
-    }
-
-    template <unsigned nchannels_, unsigned nresonances_>
-    KMatrix<nchannels_, nresonances_>::~KMatrix()
-    {
-        if (_perm)
-            gsl_permutation_free(_perm);
-        _perm = nullptr;
-
-        if (_tmp_1)
-            gsl_matrix_complex_free(_tmp_1);
-        _tmp_1 = nullptr;
-
-        if (_tmp_2)
-            gsl_matrix_complex_free(_tmp_2);
-        _tmp_2 = nullptr;
-
-        if (_That)
-            gsl_matrix_complex_free(_That);
-        _That = nullptr;
-
-        if (_Khat)
-            gsl_matrix_complex_free(_Khat);
-        _Khat = nullptr;
     }
 
 
@@ -148,9 +102,6 @@ namespace eos
         // Adapt s to avoid pole in the K matrix
         const complex<double> s = adapt_s(_s);
 
-        gsl_matrix_complex_set_zero(_tmp_1);
-        gsl_matrix_complex_set_zero(_tmp_2);
-
         for (size_t i = 0 ; i < nchannels_ ; ++i)
         {
             const unsigned li = channels[i]->_l_orbital;
@@ -167,9 +118,10 @@ namespace eos
             nfactors[i] = pow(q / q0, li) * Fi;
         }
 
-        /////////////////////////////////////////////////////////////
-        // 1. Fill tmp_1 = analytic continuation of (i * rho * n * n)
-        /////////////////////////////////////////////////////////////
+        //////////////////////////////////////////////////////////////////
+        // 1. Fill the analytic continuation of (i * rho * n * n); diagonal
+        //////////////////////////////////////////////////////////////////
+        std::array<complex<double>, nchannels_> rhonn;
         for (size_t i = 0 ; i < nchannels_ ; ++i)
         {
             complex<double> entry = channels[i]->chew_mandelstam(s);
@@ -179,12 +131,14 @@ namespace eos
                 entry += complex<double>(0.0, 2.0) * channels[i]->rho(s) * nfactors[i] * nfactors[i];
             }
 
-            gsl_matrix_complex_set(_tmp_1,  i,  i, gsl_complex_rect(entry.real(), entry.imag()));
+            rhonn[i] = entry;
         }
 
         ///////////////
         // 2. Fill Khat
         ///////////////
+        // Khat contains the normalized K-matrix entries as described in [CBHKSS:1995A]
+        Matrix Khat;
         for (size_t i = 0 ; i < nchannels_ ; ++i)
         {
             for (size_t j = 0 ; j < nchannels_ ; ++j)
@@ -201,60 +155,149 @@ namespace eos
                     entry += g0rci * g0rcj / (mres_2 - s);
                 }
 
-                gsl_matrix_complex_set(_Khat, i, j, gsl_complex_rect(entry.real(), entry.imag()));
+                Khat[i][j] = entry;
             }
         }
 
         //////////////////
         // 3. Compute That
         //////////////////
-        static const gsl_complex one  = gsl_complex_rect(1.0, 0.0);
-        static const gsl_complex minusone  = gsl_complex_rect(-1.0, 0.0);
-        static const gsl_complex zero = gsl_complex_rect(0.0, 0.0);
+        // 3a. assemble M = 1 - Khat * (i * rho * n * n); the second factor is diagonal
+        Matrix M;
+        for (size_t i = 0 ; i < nchannels_ ; ++i)
+        {
+            for (size_t j = 0 ; j < nchannels_ ; ++j)
+            {
+                M[i][j] = ((i == j) ? 1.0 : 0.0) - Khat[i][j] * rhonn[j];
+            }
+        }
+
+        // 3b. calculate That = 1 / (1 - i * Khat * rho * n * n) * Khat,
+        // with the fixed-dimension inverse unrolled at compile time
+        const Matrix That = inverse(M) * Khat;
 
-        // 3a. Set 1.0 to the diagonal elements of tmp_2
-        for (unsigned i = 0 ; i < nchannels_ ; ++i)
+        ///////////////////////////////////////////////////////////
+        // 4. Extract T matrix row, multiplied by n on either side
+        ///////////////////////////////////////////////////////////
+        for (size_t i = 0 ; i < nchannels_ ; ++i)
         {
-            gsl_matrix_complex_set(_tmp_2, i, i, one);
+            tmatrixrow[i] = That[rowindex][i] * nfactors[rowindex] * nfactors[i];
         }
 
-        // 3b. multiply Khat with - (i * rho * n * n) from the right, add one and assign to tmp_2
-        // -> tmp_2 = tmp_2 - Khat * tmp_1; tmp_1 = i * rho * n * n
-        gsl_blas_zgemm(CblasNoTrans, CblasNoTrans, minusone, _Khat, _tmp_1, one, _tmp_2);
+        return tmatrixrow;
+    }
 
-        // 3c. invert tmp_2 and assign the result to tmp_1
-        int signum = 0;
-        gsl_permutation_init(_perm);
-        gsl_linalg_complex_LU_decomp(_tmp_2, _perm, &signum);
-        gsl_linalg_complex_LU_invert(_tmp_2, _perm, _tmp_1);
+    template <unsigned nchannels_, unsigned nresonances_>
+    void
+    KMatrix<nchannels_, nresonances_>::tmatrix_row(unsigned rowindex, const complex<double> * s_values,
+            std::array<complex<double>, nchannels_> * results, const std::size_t & n, bool second_sheet) const
+    {
+        const auto & channels = this->_channels;
+        const auto & resonances = this->_resonances;
+        const auto & bkgcst = this->_bkgcst;
 
-        // 3d. calculate That = 1 / (1 - i * Khat * rho * n * n) * Khat + zero * That
-        //                    = tmp_1 * Khat + zero * That
-        gsl_blas_zgemm(CblasNoTrans, CblasNoTrans, one, _tmp_1, _Khat, zero, _That);
+        // hoist every parameter read out of the scan loop; the parameters
+        // are fixed while one scan runs
+        std::array<unsigned, nchannels_> l;
+        std::array<double, nchannels_> q0, threshold;
+        std::array<complex<double>, nchannels_> m1_2, m2_2;
+        for (size_t i = 0 ; i < nchannels_ ; ++i)
+        {
+            l[i] = channels[i]->_l_orbital;
+            q0[i] = channels[i]->_q0.evaluate();
+            m1_2[i] = power_of<2>(channels[i]->_m1());
+            m2_2[i] = power_of<2>(channels[i]->_m2());
+            threshold[i] = power_of<2>(channels[i]->_m1.evaluate() + channels[i]->_m2.evaluate());
+        }
 
-        // 3e. Multiply That by n from the left and from the right
-        for (unsigned i = 0 ; i < nchannels_ ; ++i)
+        std::array<complex<double>, nresonances_> mres_2;
+        for (size_t a = 0 ; a < nresonances_ ; ++a)
         {
-            for (unsigned j = 0 ; j < nchannels_ ; ++j)
-            {
-                auto thatentry = gsl_matrix_complex_get(_That, i, j);
-                auto ninj = gsl_complex_rect(real(nfactors[i] * nfactors[j]), imag(nfactors[i] * nfactors[j]));
-                thatentry = gsl_complex_mul(thatentry, ninj);
-                gsl_matrix_complex_set(_That, i, j, thatentry);
-            }
+            mres_2[a] = power_of<2>(resonances[a]->_m());
         }
 
-        ///////////////////
-        // 4. Extract T matrix row
-        ///////////////////
+        std::array<std::array<double, nchannels_>, nchannels_> bkg;
+        std::array<std::array<double, nresonances_>, nchannels_> g;
         for (size_t i = 0 ; i < nchannels_ ; ++i)
         {
-            gsl_complex value = gsl_matrix_complex_get(_That, rowindex, i);
-            complex<double> cvalue(GSL_REAL(value), GSL_IMAG(value));
-            tmatrixrow[i] = cvalue;
+            for (size_t j = 0 ; j < nchannels_ ; ++j)
+            {
+                bkg[i][j] = bkgcst[i][j].evaluate();
+            }
+            for (size_t a = 0 ; a < nresonances_ ; ++a)
+            {
+                g[i][a] = channels[i]->_g0s[a].evaluate();
+            }
         }
 
-        return tmatrixrow;
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            // Adapt s to avoid pole in the K matrix
+            const complex<double> s = adapt_s(s_values[k]);
+
+            std::array<complex<double>, nchannels_> nfactors;
+            for (size_t i = 0 ; i < nchannels_ ; ++i)
+            {
+                // Momentum of particles in their center-of-momentum frame
+                const complex<double> q = 0.5 * sqrt(eos::lambda(s, m1_2[i], m2_2[i])) / sqrt(s);
+
+                // Blatt-Weisskopf factors, cf eq. (50.26)
+                const complex<double> Fi = kmatrix_utils::blatt_weisskopf_factor(l[i], q / q0[i]);
+
+                nfactors[i] = pow(q / q0[i], l[i]) * Fi;
+            }
+
+            std::array<complex<double>, nchannels_> rhonn;
+            for (size_t i = 0 ; i < nchannels_ ; ++i)
+            {
+                complex<double> entry = channels[i]->chew_mandelstam(s);
+
+                if (second_sheet && (real(s) > threshold[i]))
+                {
+                    entry += complex<double>(0.0, 2.0) * channels[i]->rho(s) * nfactors[i] * nfactors[i];
+                }
+
+                rhonn[i] = entry;
+            }
+
+            std::array<complex<double>, nresonances_> pole;
+            for (size_t a = 0 ; a < nresonances_ ; ++a)
+            {
+                pole[a] = 1.0 / (mres_2[a] - s);
+            }
+
+            Matrix Khat;
+            for (size_t i = 0 ; i < nchannels_ ; ++i)
+            {
+                for (size_t j = 0 ; j < nchannels_ ; ++j)
+                {
+                    complex<double> entry = complex<double>(bkg[i][j], 0.0);
+
+                    for (size_t a = 0 ; a < nresonances_ ; ++a)
+                    {
+                        entry += g[i][a] * g[j][a] * pole[a];
+                    }
+
+                    Khat[i][j] = entry;
+                }
+            }
+
+            Matrix M;
+            for (size_t i = 0 ; i < nchannels_ ; ++i)
+            {
+                for (size_t j = 0 ; j < nchannels_ ; ++j)
+                {
+                    M[i][j] = ((i == j) ? 1.0 : 0.0) - Khat[i][j] * rhonn[j];
+                }
+            }
+
+            const Matrix That = inverse(M) * Khat;
+
+            for (size_t i = 0 ; i < nchannels_ ; ++i)
+            {
+                results[k][i] = That[rowindex][i] * nfactors[rowindex] * nfactors[i];
+            }
+        }
     }
 
     template <unsigned nchannels_, unsigned nresonances_>
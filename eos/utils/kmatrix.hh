@@ -21,16 +21,12 @@
 #define EOS_GUARD_EOS_UTILS_KMATRIX_HH 1
 
 #include <eos/maths/complex.hh>
+#include <eos/maths/matrix.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/parameters.hh>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_complex_math.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_matrix.h>
-
 #include <array>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -51,17 +47,10 @@ namespace eos
 
             const std::string & _prefix;
 
-            // Khat contains the normalized K-matrix entries
-            // as described in [CBHKSS:1995A].
-            gsl_matrix_complex * _Khat;
-            // That is defined as T = (1-i*rho*K)^(-1)*K
-            gsl_matrix_complex * _That;
-
-            // Two temporary matrices and a permutation are needed to evaluate That
-            gsl_matrix_complex * _tmp_1;
-            gsl_matrix_complex * _tmp_2;
-            gsl_matrix_complex * _tmp_3;
-            gsl_permutation * _perm;
+            // All matrices are of fixed dimension nchannels_ x nchannels_, so that
+            // their storage lives on the stack and the linear algebra unrolls at
+            // compile time; cf. eos/maths/matrix.hh.
+            using Matrix = std::array<std::array<complex<double>, nchannels_>, nchannels_>;
 
             // Constructor
             KMatrix(std::array<std::shared_ptr<KMatrix::Channel>, nchannels_> channels,
@@ -69,9 +58,6 @@ namespace eos
                 std::array<std::array<Parameter, nchannels_>, nchannels_> bkgcst,
                 const std::string & prefix);
 
-            // Destructor
-            ~KMatrix();
-
             // Adapt s to avoid resonnances masses
             complex<double> adapt_s(const complex<double> s) const;
 
@@ -80,6 +66,13 @@ namespace eos
             // If second_sheet is set to true, the value is calculated on the second Riemann sheet
             std::array<complex<double>, nchannels_> tmatrix_row(unsigned rowindex, const complex<double> s, bool second_sheet = false) const;
 
+            // Batch overload: evaluate the row for n values of s in one call.
+            // The parameters entering the K matrix (couplings, background constants,
+            // resonance and channel masses) are read only once and reused for every
+            // point, which removes the dominant per-point overhead of dense energy scans.
+            void tmatrix_row(unsigned rowindex, const complex<double> * s, std::array<complex<double>, nchannels_> * results,
+                    const std::size_t & n, bool second_sheet = false) const;
+
 
             // Return the K matrix partial and total widths of a resonance.
             // Note that these widths do not necessarily correspond to the experimental ones.
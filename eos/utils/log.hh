@@ -56,6 +56,17 @@ namespace eos
     std::istream & operator>> (std::istream & lhs, LogLevel & rhs);
     ///@}
 
+/*!
+ * Maximum log level compiled into the binary.
+ *
+ * Callable-based log statements whose level exceeds this constant are removed
+ * at compile time. Release builds may define it to, e.g., eos::ll_completed to
+ * compile out in-progress, informational and debug messages entirely.
+ */
+#ifndef EOS_MAX_STATIC_LOG_LEVEL
+#define EOS_MAX_STATIC_LOG_LEVEL eos::ll_debug
+#endif
+
     // forward declaration for use in Log
     class LogMessageHandler;
 
@@ -119,6 +130,31 @@ namespace eos
              */
             LogMessageHandler message(const std::string & id, const LogLevel & log_level) __attribute__((warn_unused_result));
 
+            /*!
+             * Emit a message whose text is produced lazily by the given callable.
+             *
+             * The callable is invoked only when the message passes the current
+             * log level, so no string formatting takes place for suppressed
+             * messages. Preferred over the stream-like message() in hot paths.
+             *
+             * @param id           The message's unique identifier.
+             * @param log_level    The message's log level.
+             * @param make_message Callable producing the message text on demand.
+             */
+            template <typename MakeMessage_>
+            void message(const std::string & id, const LogLevel & log_level, MakeMessage_ && make_message)
+            {
+                // with a literal level at the call site, this comparison folds to a
+                // constant and the whole statement is compiled out
+                if (log_level > EOS_MAX_STATIC_LOG_LEVEL)
+                    return;
+
+                if (log_level > get_log_level())
+                    return;
+
+                _message(id, log_level, make_message());
+            }
+
             /*!
              * Class to be used as a RAII guard for a one-time log message.
              *
@@ -185,3 +185,57 @@ class LogOneTimeMessageTest :
             }
         }
 } one_time_message_test;
+
+
+class LogLazyMessageTest :
+    public TestCase
+{
+    public:
+        LogLazyMessageTest() :
+            TestCase("log_lazy_message_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            std::vector<std::tuple<std::string, LogLevel, std::string>> messages;
+
+            // register callback
+            std::function<void(const std::string &, const LogLevel &, const std::string &)> callback = [&messages](const std::string & id, const LogLevel & level, const std::string & message) {
+                messages.push_back(std::make_tuple(id, level, message));
+            };
+            Log::instance()->register_callback(callback);
+
+            const LogLevel previous_log_level = Log::instance()->get_log_level();
+            Log::instance()->set_log_level(ll_warning);
+
+            // message passing the log level: callable invoked, message delivered
+            {
+                bool invoked = false;
+                Log::instance()->message("test-lazy-message", ll_warning, [&invoked] () {
+                    invoked = true;
+                    return std::string("This message is assembled on demand.");
+                });
+
+                TEST_CHECK(invoked);
+                TEST_CHECK_EQUAL(1u, messages.size());
+                TEST_CHECK_EQUAL("test-lazy-message", std::get<0>(messages.back()));
+                TEST_CHECK_EQUAL(ll_warning, std::get<1>(messages.back()));
+                TEST_CHECK_EQUAL("This message is assembled on demand.", std::get<2>(messages.back()));
+            }
+
+            // message below the log level: callable never invoked
+            {
+                bool invoked = false;
+                Log::instance()->message("test-lazy-message-suppressed", ll_debug, [&invoked] () {
+                    invoked = true;
+                    return std::string("This message must not be assembled.");
+                });
+
+                TEST_CHECK(! invoked);
+                TEST_CHECK_EQUAL(1u, messages.size());
+            }
+
+            Log::instance()->set_log_level(previous_log_level);
+        }
+} lazy_message_test;
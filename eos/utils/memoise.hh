@@ -28,8 +28,10 @@
 
 #include <cstdint>
 #include <functional>
+#include <list>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /* We are using a custom std::hash for tuple<FunctionPtr, double, ..., double> */
@@ -123,56 +125,103 @@ namespace eos
             using KeyType = std::tuple<FunctionType, Params_...>;
 
         private:
-            Mutex * const _mutex;
+            /*!
+             * The store is sharded by key hash: each shard guards its own entries
+             * with its own mutex, so threads memoising unrelated keys do not
+             * contend on a single global lock. Within a shard, keys are kept in
+             * least-recently-used order, and the least recently used entry is
+             * evicted once the shard exceeds its size bound.
+             */
+            struct Shard
+            {
+                Mutex mutex;
+
+                // Keys in least-recently-used order; the front is the most recently used key.
+                std::list<KeyType> usage;
+
+                // Maps each key to its memoised result and its position in the usage list.
+                std::unordered_map<KeyType, std::pair<Result_, typename std::list<KeyType>::iterator>> entries;
+            };
+
+            static const uint64_t number_of_shards = 16;
+
+            static const uint64_t max_entries_per_shard = 8192;
 
-            std::unordered_map<KeyType, Result_> _memoisations;
+            Shard * const _shards;
+
+            Shard & _shard_for(const KeyType & key) const
+            {
+                uint64_t h = std::hash<KeyType>()(key);
+
+                // the tuple hash concentrates its entropy in the upper bits, so fold them in
+                return _shards[(h ^ (h >> 32)) % number_of_shards];
+            }
 
         public:
             Memoiser() :
-                _mutex(new Mutex)
+                _shards(new Shard[number_of_shards])
             {
                 MemoisationControl::instance()->register_clear_function(std::bind(&Memoiser<Result_, Params_ ...>::clear, this));
             }
 
             ~Memoiser()
             {
-                delete _mutex;
+                delete[] _shards;
             }
 
             Result_ operator() (const FunctionType & f, const Params_ & ... p)
             {
-                Lock l(*_mutex);
-
                 KeyType key(f, p ...);
-                auto i = _memoisations.find(key);
+                Shard & shard = _shard_for(key);
+
+                Lock l(shard.mutex);
 
-                if (_memoisations.end() != i)
-                    return i->second;
+                auto i = shard.entries.find(key);
+
+                if (shard.entries.end() != i)
+                {
+                    shard.usage.splice(shard.usage.begin(), shard.usage, i->second.second);
+
+                    return i->second.first;
+                }
 
                 Result_ result = f(p ...);
 
-                if (_memoisations.size() > 100000u)
+                if (shard.entries.size() >= max_entries_per_shard)
                 {
-                    _memoisations.clear();
+                    shard.entries.erase(shard.usage.back());
+                    shard.usage.pop_back();
                 }
 
-                _memoisations.insert(std::pair<KeyType, Result_>(key, result));
+                shard.usage.push_front(key);
+                shard.entries.insert(std::make_pair(key, std::make_pair(result, shard.usage.begin())));
 
                 return result;
             }
 
             void clear()
             {
-                Lock l(*_mutex);
+                for (uint64_t s = 0 ; s < number_of_shards ; ++s)
+                {
+                    Lock l(_shards[s].mutex);
 
-                _memoisations.clear();
+                    _shards[s].entries.clear();
+                    _shards[s].usage.clear();
+                }
             }
 
             unsigned number_of_memoisations() const
             {
-                Lock l(*_mutex);
+                unsigned result = 0;
 
-                return _memoisations.size();
+                for (uint64_t s = 0 ; s < number_of_shards ; ++s)
+                {
+                    Lock l(_shards[s].mutex);
+
+                    result += _shards[s].entries.size();
+                }
+
+                return result;
             }
     };
 
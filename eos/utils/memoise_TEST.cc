@@ -104,5 +104,24 @@ class MemoiseTest :
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f2, 0.0, 0.0));
             }
+
+            /* Test that the store stays bounded and evicted entries are recomputed correctly */
+            {
+                static const unsigned number_of_keys = 200000;
+
+                for (unsigned i = 0 ; i < number_of_keys ; ++i)
+                {
+                    TEST_CHECK_EQUAL(0.5 * i, memoise(f1, 1.0 * i, 2.0));
+                }
+
+                // The least recently used entries must have been evicted
+                TEST_CHECK(number_of_memoisations(f1, 0.0, 0.0) < number_of_keys);
+
+                // Evicted entries are recomputed, not lost
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+
+                MemoisationControl::instance()->clear();
+                TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
+            }
         }
 } memoise_test;
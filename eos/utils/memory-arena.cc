@@ -0,0 +1,144 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/memory-arena.hh>
+
+#include <cstring>
+
+namespace eos
+{
+    namespace
+    {
+        // every allocation is preceded by a header recording its usable size,
+        // sized to keep the payload aligned for any object type
+        constexpr std::size_t header_size = alignof(std::max_align_t);
+
+        // size of the first block; subsequent blocks double in size
+        constexpr std::size_t initial_block_size = 64 * 1024;
+
+        std::size_t align_up(const std::size_t & size)
+        {
+            return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        }
+    }
+
+    MemoryArena::MemoryArena() :
+        _current(0)
+    {
+        _blocks.push_back(Block{ std::unique_ptr<char[]>(new char[initial_block_size]), initial_block_size, 0 });
+    }
+
+    MemoryArena::~MemoryArena() = default;
+
+    void
+    MemoryArena::_grow(const std::size_t & size)
+    {
+        // reuse a retained block if one follows the current block
+        while (_current + 1 < _blocks.size())
+        {
+            ++_current;
+            _blocks[_current].used = 0;
+
+            if (_blocks[_current].size >= size)
+                return;
+        }
+
+        std::size_t block_size = 2 * _blocks.back().size;
+        while (block_size < size)
+        {
+            block_size *= 2;
+        }
+
+        _blocks.push_back(Block{ std::unique_ptr<char[]>(new char[block_size]), block_size, 0 });
+        _current = _blocks.size() - 1;
+    }
+
+    void *
+    MemoryArena::allocate(const std::size_t & size)
+    {
+        const std::size_t needed = header_size + align_up(size);
+
+        if (_blocks[_current].size - _blocks[_current].used < needed)
+        {
+            _grow(needed);
+        }
+
+        Block & block = _blocks[_current];
+        char * p = block.data.get() + block.used;
+        block.used += needed;
+
+        *reinterpret_cast<std::size_t *>(p) = align_up(size);
+
+        return p + header_size;
+    }
+
+    void *
+    MemoryArena::reallocate(void * p, const std::size_t & size)
+    {
+        if (nullptr == p)
+            return allocate(size);
+
+        char * const payload = static_cast<char *>(p);
+        const std::size_t old_size = *reinterpret_cast<std::size_t *>(payload - header_size);
+
+        if (size <= old_size)
+            return p;
+
+        // extend in place if p is the most recent allocation in the current block
+        Block & block = _blocks[_current];
+        if (payload + old_size == block.data.get() + block.used)
+        {
+            const std::size_t additional = align_up(size) - old_size;
+
+            if (block.size - block.used >= additional)
+            {
+                block.used += additional;
+                *reinterpret_cast<std::size_t *>(payload - header_size) = align_up(size);
+
+                return p;
+            }
+        }
+
+        void * result = allocate(size);
+        std::memcpy(result, p, old_size);
+
+        return result;
+    }
+
+    MemoryArena *
+    MemoryArena::thread_instance()
+    {
+        static thread_local MemoryArena arena;
+
+        return &arena;
+    }
+
+    MemoryArena::Scope::Scope() :
+        _arena(MemoryArena::thread_instance()),
+        _block(_arena->_current),
+        _used(_arena->_blocks[_arena->_current].used)
+    {
+    }
+
+    MemoryArena::Scope::~Scope()
+    {
+        _arena->_current = _block;
+        _arena->_blocks[_block].used = _used;
+    }
+}
@@ -0,0 +1,143 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_MEMORY_ARENA_HH
+#define EOS_GUARD_EOS_UTILS_MEMORY_ARENA_HH 1
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Monotonic bump allocator for short-lived per-evaluation temporaries.
+     *
+     * Allocation is a pointer increment into geometrically growing blocks that
+     * are retained for reuse; individual deallocation is a no-op. A
+     * MemoryArena::Scope records the arena's state on construction and releases
+     * everything allocated within the scope en bloc on destruction, so nested
+     * evaluations compose. Each thread uses its own arena, cf. thread_instance().
+     */
+    class MemoryArena
+    {
+        private:
+            struct Block
+            {
+                std::unique_ptr<char[]> data;
+
+                std::size_t size;
+
+                std::size_t used;
+            };
+
+            std::vector<Block> _blocks;
+
+            // index of the block that currently serves allocations
+            std::size_t _current;
+
+            // append a block of at least the given size and make it current
+            void _grow(const std::size_t & size);
+
+        public:
+            MemoryArena();
+            ~MemoryArena();
+
+            MemoryArena(const MemoryArena &) = delete;
+            MemoryArena & operator= (const MemoryArena &) = delete;
+
+            /// Allocate size bytes, suitably aligned for any object type.
+            void * allocate(const std::size_t & size);
+
+            /*!
+             * Grow an allocation obtained from this arena to size bytes,
+             * preserving its contents; the last allocation is extended in place
+             * when possible.
+             */
+            void * reallocate(void * p, const std::size_t & size);
+
+            /// Retrieve this thread's arena.
+            static MemoryArena * thread_instance();
+
+            /*!
+             * Release all allocations made after construction of the scope upon
+             * its destruction.
+             */
+            class Scope
+            {
+                private:
+                    MemoryArena * const _arena;
+
+                    std::size_t _block;
+
+                    std::size_t _used;
+
+                public:
+                    Scope();
+                    ~Scope();
+
+                    Scope(const Scope &) = delete;
+                    Scope & operator= (const Scope &) = delete;
+            };
+    };
+
+    /*!
+     * Standard-library allocator backed by the calling thread's MemoryArena.
+     *
+     * Deallocation is a no-op; pair containers that use this allocator with a
+     * MemoryArena::Scope spanning their lifetime, so that their memory is
+     * released en bloc.
+     */
+    template <typename T_>
+    class ArenaAllocator
+    {
+        public:
+            using value_type = T_;
+
+            ArenaAllocator() = default;
+
+            template <typename U_>
+            ArenaAllocator(const ArenaAllocator<U_> &)
+            {
+            }
+
+            T_ * allocate(const std::size_t & n)
+            {
+                return static_cast<T_ *>(MemoryArena::thread_instance()->allocate(n * sizeof(T_)));
+            }
+
+            void deallocate(T_ *, const std::size_t &)
+            {
+            }
+
+            template <typename U_>
+            bool operator== (const ArenaAllocator<U_> &) const
+            {
+                return true;
+            }
+
+            template <typename U_>
+            bool operator!= (const ArenaAllocator<U_> &) const
+            {
+                return false;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,128 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/memory-arena.hh>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace test;
+using namespace eos;
+
+class MemoryArenaTest :
+    public TestCase
+{
+    public:
+        MemoryArenaTest() :
+            TestCase("memory_arena_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            MemoryArena * arena = MemoryArena::thread_instance();
+
+            // allocations are distinct, usable, and suitably aligned
+            {
+                MemoryArena::Scope scope;
+
+                double * x = static_cast<double *>(arena->allocate(8 * sizeof(double)));
+                double * y = static_cast<double *>(arena->allocate(8 * sizeof(double)));
+
+                TEST_CHECK(x != y);
+                TEST_CHECK(0 == reinterpret_cast<std::uintptr_t>(x) % alignof(std::max_align_t));
+
+                for (unsigned i = 0 ; i < 8 ; ++i)
+                {
+                    x[i] = 1.0 * i;
+                    y[i] = 2.0 * i;
+                }
+
+                for (unsigned i = 0 ; i < 8 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(x[i], 1.0 * i);
+                    TEST_CHECK_EQUAL(y[i], 2.0 * i);
+                }
+            }
+
+            // reallocation preserves contents
+            {
+                MemoryArena::Scope scope;
+
+                char * p = static_cast<char *>(arena->allocate(16));
+                std::memcpy(p, "0123456789abcdef", 16);
+
+                char * q = static_cast<char *>(arena->reallocate(p, 1024));
+                TEST_CHECK_EQUAL(0, std::memcmp(q, "0123456789abcdef", 16));
+            }
+
+            // scopes release memory for reuse, and nest
+            {
+                void * first;
+                {
+                    MemoryArena::Scope outer;
+
+                    first = arena->allocate(32);
+
+                    {
+                        MemoryArena::Scope inner;
+
+                        arena->allocate(32);
+                    }
+
+                    // the inner scope released its allocation, not ours
+                    void * second = arena->allocate(32);
+                    TEST_CHECK(first != second);
+                }
+
+                MemoryArena::Scope scope;
+
+                // the outer scope's memory has been released for reuse
+                TEST_CHECK(first == arena->allocate(32));
+            }
+
+            // containers can use the arena through ArenaAllocator
+            {
+                MemoryArena::Scope scope;
+
+                std::vector<double, ArenaAllocator<double>> v;
+                v.reserve(128);
+                for (unsigned i = 0 ; i < 128 ; ++i)
+                {
+                    v.push_back(1.0 * i);
+                }
+
+                TEST_CHECK_EQUAL(v[0],   0.0);
+                TEST_CHECK_EQUAL(v[127], 127.0);
+            }
+
+            // allocations larger than one block are served, too
+            {
+                MemoryArena::Scope scope;
+
+                char * p = static_cast<char *>(arena->allocate(1024 * 1024));
+                p[0] = 'a';
+                p[1024 * 1024 - 1] = 'z';
+
+                TEST_CHECK_EQUAL('a', p[0]);
+                TEST_CHECK_EQUAL('z', p[1024 * 1024 - 1]);
+            }
+        }
+} memory_arena_test;
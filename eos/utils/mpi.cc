@@ -0,0 +1,118 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+#include <eos/utils/mpi.hh>
+
+#ifdef EOS_ENABLE_MPI
+#  include <mpi.h>
+#endif
+
+namespace eos
+{
+    namespace mpi
+    {
+#ifdef EOS_ENABLE_MPI
+        static bool
+        initialized()
+        {
+            int initialized = 0, finalized = 0;
+
+            MPI_Initialized(&initialized);
+            MPI_Finalized(&finalized);
+
+            return initialized && (! finalized);
+        }
+
+        bool
+        available()
+        {
+            return true;
+        }
+
+        bool
+        active()
+        {
+            return initialized() && (size() > 1);
+        }
+
+        unsigned
+        rank()
+        {
+            if (! initialized())
+                return 0;
+
+            int result = 0;
+            MPI_Comm_rank(MPI_COMM_WORLD, &result);
+
+            return result;
+        }
+
+        unsigned
+        size()
+        {
+            if (! initialized())
+                return 1;
+
+            int result = 1;
+            MPI_Comm_size(MPI_COMM_WORLD, &result);
+
+            return result;
+        }
+
+        void
+        allreduce_sum(double * data, const unsigned & n)
+        {
+            if ((! active()) || (0 == n))
+                return;
+
+            MPI_Allreduce(MPI_IN_PLACE, data, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        }
+#else
+        bool
+        available()
+        {
+            return false;
+        }
+
+        bool
+        active()
+        {
+            return false;
+        }
+
+        unsigned
+        rank()
+        {
+            return 0;
+        }
+
+        unsigned
+        size()
+        {
+            return 1;
+        }
+
+        void
+        allreduce_sum(double *, const unsigned &)
+        {
+        }
+#endif
+    } // namespace mpi
+} // namespace eos
@@ -0,0 +1,62 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_MPI_HH
+#define EOS_GUARD_EOS_UTILS_MPI_HH 1
+
+namespace eos
+{
+    /*!
+     * Thin wrapper around the optional MPI dependency.
+     *
+     * EOS never initializes or finalizes MPI itself; the hosting application
+     * (e.g. an mpi4py-based driver script) is expected to do so before the
+     * first likelihood evaluation. When EOS was built without --enable-mpi,
+     * or when MPI has not been initialized, or when only a single rank takes
+     * part, all functions fall back to the trivial single-process behaviour.
+     */
+    namespace mpi
+    {
+        /// Return whether EOS was configured with --enable-mpi.
+        bool available();
+
+        /// Return whether MPI is initialized and more than one rank takes part.
+        bool active();
+
+        /// Return this process' rank within the world communicator; 0 when MPI is not active.
+        unsigned rank();
+
+        /// Return the number of ranks within the world communicator; 1 when MPI is not active.
+        unsigned size();
+
+        /*!
+         * Sum the entries of a buffer element-wise across all ranks, in place.
+         *
+         * All ranks must call this function collectively, with buffers of
+         * identical length. When MPI is not active, the buffer is left
+         * untouched.
+         *
+         * @param data The buffer whose entries shall be summed.
+         * @param n    The number of entries in the buffer.
+         */
+        void allreduce_sum(double * data, const unsigned & n);
+    } // namespace mpi
+} // namespace eos
+
+#endif
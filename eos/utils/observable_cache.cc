@@ -21,6 +21,7 @@
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-observable.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mpi.hh>
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
@@ -28,6 +29,8 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <tuple>
@@ -49,26 +52,69 @@ namespace eos
         // Parameters which are common to all observables in the cache.
         Parameters parameters;
 
-        // Contains each observable that needs to be calculated exactly once
+        // Contains each observable that needs to be calculated exactly once.
+        // This vector holds the single owning reference of each observable: the
+        // cache acts as the arena of its analysis, and all per-category index
+        // structures below refer into it through stable non-owning handles, so
+        // that neither setup nor updates touch the shared reference counts.
         std::vector<ObservablePtr> observables;
 
         // Contains each regular observable and its associated index
-        std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> regular_observables;
+        std::vector<std::tuple<Observable *, ObservableCache::Id>> regular_observables;
 
         // Contains each cacheable observable and its associated index
         std::multimap<std::type_index, std::tuple<CacheableObservable *, ObservableCache::Id>> cacheable_observables;
 
         // Contains each cached observable and its associated index
-        std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> cached_observables;
+        std::vector<std::tuple<Observable *, ObservableCache::Id>> cached_observables;
 
         // Contains each expression observable and its associated index
-        std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> expression_observables;
+        std::vector<std::tuple<Observable *, ObservableCache::Id>> expression_observables;
 
         // Contains values of all observables
         std::vector<double> predictions;
 
+        // Contains the evaluation time of each observable measured during the last
+        // updates, in seconds; used as cost estimates when scheduling an update
+        std::vector<double> evaluation_costs;
+
+        // Instrumentation: number of evaluations and cumulative evaluation time
+        // in seconds per observable, and the number of updates carried out
+        std::vector<unsigned long> evaluation_counts;
+        std::vector<double> evaluation_times;
+        unsigned long updates;
+
+        // Contains the ids of the parameters on which each observable depends, indexed by the observable's id
+        std::vector<std::vector<Parameter::Id>> dependencies;
+
+        // Maps each observable's canonical structural key (name, kinematics, options)
+        // to its id; deduplicates insertions without a linear scan over the cache
+        std::map<std::string, ObservableCache::Id> index_by_key;
+
+        // Instrumentation: number of add() calls, and how many of them returned a
+        // previously inserted entry
+        unsigned long additions;
+        unsigned long deduplications;
+
+        // Contains the id of each observable's group leader, indexed by the observable's id;
+        // used to distribute updates across MPI ranks. Cached observables share the group
+        // of their underlying cacheable observable, since they rely on the intermediate
+        // result it prepares; all other observables lead their own group.
+        std::vector<unsigned> groups;
+
+        // Generation of the common Parameters object at the time of the last update
+        std::uint64_t last_update_generation;
+
+        // False until the first update has been carried out
+        bool updated_once;
+
         Implementation(const Parameters & parameters) :
-            parameters(parameters)
+            parameters(parameters),
+            updates(0),
+            additions(0),
+            deduplications(0),
+            last_update_generation(0),
+            updated_once(false)
         {
         }
 
@@ -76,27 +122,42 @@ namespace eos
         {
         }
 
-        static bool identical_observables(const ObservablePtr & lhs, const ObservablePtr & rhs)
+        /*
+         * Determine which observables need to be re-evaluated, i.e. which depend on
+         * a parameter whose value changed since the last update.
+         *
+         * Before the first update all observables are stale. Observables that do not
+         * declare any used parameter ids are conservatively treated as always stale.
+         */
+        std::vector<bool> stale_observables() const
         {
-            // compare name
-            if (lhs->name() != rhs->name())
-            {
-                return false;
-            }
+            std::vector<bool> stale(observables.size(), true);
 
-            // compare kinematics
-            if( lhs->kinematics() != rhs->kinematics())
-            {
-                return false;
-            }
+            if (! updated_once)
+                return stale;
 
-            // compare options
-            if (lhs->options() != rhs->options())
+            for (unsigned i = 0, i_end = observables.size() ; i != i_end ; ++i)
             {
-                return false;
+                const auto & ids = dependencies[i];
+
+                if (ids.empty())
+                    continue;
+
+                stale[i] = std::any_of(ids.cbegin(), ids.cend(), [this] (const Parameter::Id & id)
+                {
+                    return parameters[id].generation() > last_update_generation;
+                });
             }
 
-            return true;
+            return stale;
+        }
+
+        // Canonical structural key of an observable: two observables are one and the
+        // same cache entry if and only if their name, kinematics (including aliases
+        // and values) and options coincide
+        static std::string structural_key(const ObservablePtr & observable)
+        {
+            return observable->name().full() + '\n' + observable->kinematics().as_string() + '\n' + observable->options().as_string();
         }
 
         ObservableCache::Id add(const ObservablePtr & observable, const ObservableCache & cache)
@@ -104,14 +165,19 @@ namespace eos
             if (observable->parameters() != parameters)
                 throw InternalError("ObservableCache::add(): Mismatch of Parameters between different observables detected.");
 
-            // compare each observable for options, kinematics and name
-            unsigned index = 0;
-            for (auto i = observables.begin(), i_end = observables.end() ; i != i_end ; ++i, ++index)
+            ++additions;
+
+            // deduplicate structurally identical observables
+            const std::string key = structural_key(observable);
+            auto k = index_by_key.find(key);
+            if (index_by_key.end() != k)
             {
-                if (identical_observables(*i, observable))
-                    return index;
+                ++deduplications;
+                return k->second;
             }
 
+            unsigned index = observables.size();
+
             CacheableObservable * cacheable_observable = dynamic_cast<CacheableObservable *>(observable.get());
             ExpressionObservable * expression_observable = dynamic_cast<ExpressionObservable *>(observable.get());
 
@@ -128,7 +194,13 @@ namespace eos
 
                 observables.push_back(cached_expression_observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                expression_observables.push_back(std::make_tuple(cached_expression_observable, index));
+                evaluation_costs.push_back(0.0);
+                evaluation_counts.push_back(0);
+                evaluation_times.push_back(0.0);
+                dependencies.push_back(std::vector<Parameter::Id>(cached_expression_observable->begin(), cached_expression_observable->end()));
+                groups.push_back(index);
+                expression_observables.push_back(std::make_tuple(cached_expression_observable.get(), index));
+                index_by_key.emplace(key, index);
 
                 return index;
             }
@@ -152,10 +224,20 @@ namespace eos
                     if (! cached_observable)
                         throw InternalError("make_cached_observable() failed");
 
-                    // add the newly created cached observable
+                    // add the newly created cached observable; it goes stale whenever either its own
+                    // parameters or those of the underlying cacheable observable change
+                    std::vector<Parameter::Id> ids(cached_observable->begin(), cached_observable->end());
+                    ids.insert(ids.end(), std::get<0>(c->second)->begin(), std::get<0>(c->second)->end());
+
                     observables.push_back(cached_observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                    cached_observables.push_back(std::make_tuple(cached_observable, index));
+                    evaluation_costs.push_back(0.0);
+                    evaluation_counts.push_back(0);
+                    evaluation_times.push_back(0.0);
+                    dependencies.push_back(ids);
+                    groups.push_back(groups[std::get<1>(c->second)]);
+                    cached_observables.push_back(std::make_tuple(cached_observable.get(), index));
+                    index_by_key.emplace(key, index);
 
                     return index;
                 }
@@ -163,7 +245,13 @@ namespace eos
                 // else add this new cacheable observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                evaluation_costs.push_back(0.0);
+                evaluation_counts.push_back(0);
+                evaluation_times.push_back(0.0);
+                dependencies.push_back(std::vector<Parameter::Id>(observable->begin(), observable->end()));
+                groups.push_back(index);
                 cacheable_observables.insert(std::make_pair(type_index, std::make_tuple(cacheable_observable, index)));
+                index_by_key.emplace(key, index);
 
                 return index;
             }
@@ -172,7 +260,13 @@ namespace eos
                 // add this new regular observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                regular_observables.push_back(std::make_tuple(observable, index));
+                evaluation_costs.push_back(0.0);
+                evaluation_counts.push_back(0);
+                evaluation_times.push_back(0.0);
+                dependencies.push_back(std::vector<Parameter::Id>(observable->begin(), observable->end()));
+                groups.push_back(index);
+                regular_observables.push_back(std::make_tuple(observable.get(), index));
+                index_by_key.emplace(key, index);
 
                 return index;
             }
@@ -199,98 +293,276 @@ namespace eos
     void
     ObservableCache::update()
     {
-        // parallelize the evaluation of the observables
-        std::vector<Ticket> cacheable_tickets;
-        cacheable_tickets.reserve(_imp->cacheable_observables.size());
+        // determine which observables depend on a parameter whose value changed
+        // since the last update
+        _update(_imp->stale_observables());
+    }
+
+    void
+    ObservableCache::update(const Parameter::Id & changed)
+    {
+        // under the profile-scan contract only the given parameter may have
+        // changed since the last update, so exactly its dependents are stale;
+        // observables without declared dependencies stay conservatively stale
+        std::vector<bool> stale(_imp->observables.size(), true);
 
-        // evaluate all cacheable observables in parallel
-        for (auto co : _imp->cacheable_observables)
+        if (_imp->updated_once)
         {
-            auto f = [=, this]() {
-                auto & o   = std::get<0>(co.second);
-                auto & idx = std::get<1>(co.second);
-                try
-                {
-                    _imp->predictions[idx] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating cacheable observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
-                        << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+            for (unsigned i = 0, i_end = _imp->observables.size() ; i != i_end ; ++i)
+            {
+                const auto & ids = _imp->dependencies[i];
 
-                }
-            };
-            cacheable_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+                if (ids.empty())
+                    continue;
+
+                stale[i] = std::find(ids.cbegin(), ids.cend(), changed) != ids.cend();
+            }
         }
 
-        std::vector<Ticket> regular_tickets;
-        regular_tickets.reserve(_imp->regular_observables.size());
+        _update(stale);
+    }
+
+    bool
+    ObservableCache::depends_on(const ObservableCache::Id & id, const Parameter::Id & changed) const
+    {
+        const auto & ids = _imp->dependencies[id];
+
+        if (ids.empty())
+            return true;
+
+        return std::find(ids.cbegin(), ids.cend(), changed) != ids.cend();
+    }
+
+    const std::vector<Parameter::Id> &
+    ObservableCache::dependencies(const ObservableCache::Id & id) const
+    {
+        return _imp->dependencies[id];
+    }
+
+    void
+    ObservableCache::_update(const std::vector<bool> & stale)
+    {
+        // take a snapshot of the parameters' generation for which the predictions
+        // will be up to date after this update
+        const std::uint64_t current_generation = _imp->parameters.generation();
+
+        // evaluate one observable, converting exceptions into NaN predictions;
+        // the evaluation is timed to obtain the cost estimate for the next update
+        auto evaluate_one = [this] (const unsigned & idx)
+        {
+            Observable * const o = _imp->observables[idx].get();
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                _imp->predictions[idx] = o->evaluate();
+            }
+            catch (eos::Exception & e)
+            {
+                Log::instance()->message("ObservableCache::update", ll_error)
+                    << "Exception encountered when evaluating observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
+                    << e.what();
+                _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double duration = std::chrono::duration<double>(stop - start).count();
+
+            // smooth the measurements over successive updates
+            _imp->evaluation_costs[idx] = 0.5 * (_imp->evaluation_costs[idx] + duration);
+
+            _imp->evaluation_counts[idx] += 1;
+            _imp->evaluation_times[idx] += duration;
+        };
+
+        // when MPI is active, statically partition the update across the ranks:
+        // each group of observables (a cacheable observable together with its
+        // cached dependents, or a single regular observable) is owned by exactly
+        // one rank, and the freshly evaluated predictions are synchronized across
+        // all ranks afterwards
+        const unsigned mpi_size = mpi::active() ? mpi::size() : 1;
+        const unsigned mpi_rank = (mpi_size > 1) ? mpi::rank() : 0;
+        auto owned = [&] (const unsigned & idx) { return (_imp->groups[idx] % mpi_size) == mpi_rank; };
+
+        // collect the stale observables into two phases: cacheable and regular
+        // observables are mutually independent, whilst cached observables rely on
+        // the results of their underlying cacheable observables. Each phase is
+        // clustered so that observables of one decay class (and cached observables
+        // of one underlying object) are evaluated consecutively on one worker:
+        // this keeps the instruction cache and the decay classes' internal
+        // per-point caches warm across the cluster's members
+        std::vector<std::vector<unsigned>> first_phase, second_phase;
+        std::vector<unsigned> synchronized;
 
-        // evaluate all regular observables in parallel
-        for (auto ro : _imp->regular_observables)
         {
-            auto f = [=, this]() {
-                auto & o   = std::get<0>(ro);
-                auto & idx = std::get<1>(ro);
-                try
+            std::map<std::type_index, unsigned> cluster_by_type;
+
+            for (auto co : _imp->cacheable_observables)
+            {
+                const unsigned idx = std::get<1>(co.second);
+                if (! stale[idx])
+                    continue;
+                if (mpi_size > 1)
+                    synchronized.push_back(idx);
+                if (! owned(idx))
+                    continue;
+
+                auto c = cluster_by_type.find(co.first);
+                if (cluster_by_type.end() == c)
                 {
-                    _imp->predictions[idx] = o->evaluate();
+                    c = cluster_by_type.emplace(co.first, first_phase.size()).first;
+                    first_phase.push_back({});
                 }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating regular observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
-                        << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+                first_phase[c->second].push_back(idx);
+            }
+        }
+
+        {
+            std::map<std::type_index, unsigned> cluster_by_type;
 
+            for (auto ro : _imp->regular_observables)
+            {
+                const unsigned idx = std::get<1>(ro);
+                if (! stale[idx])
+                    continue;
+                if (mpi_size > 1)
+                    synchronized.push_back(idx);
+                if (! owned(idx))
+                    continue;
+
+                const std::type_index type(typeid(*std::get<0>(ro)));
+                auto c = cluster_by_type.find(type);
+                if (cluster_by_type.end() == c)
+                {
+                    c = cluster_by_type.emplace(type, first_phase.size()).first;
+                    first_phase.push_back({});
                 }
-            };
-            regular_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+                first_phase[c->second].push_back(idx);
+            }
         }
 
-        // await completion of the cacheable observables
-        for (auto ticket : cacheable_tickets)
         {
-            ticket.wait();
-        }
+            // cached observables that share their group leader share the very
+            // object whose intermediate results they read
+            std::map<unsigned, unsigned> cluster_by_leader;
 
-        std::vector<Ticket> cached_tickets;
-        cached_tickets.reserve(_imp->cached_observables.size());
+            for (auto co : _imp->cached_observables)
+            {
+                const unsigned idx = std::get<1>(co);
+                if (! stale[idx])
+                    continue;
+                if (mpi_size > 1)
+                    synchronized.push_back(idx);
+                if (! owned(idx))
+                    continue;
+
+                auto c = cluster_by_leader.find(_imp->groups[idx]);
+                if (cluster_by_leader.end() == c)
+                {
+                    c = cluster_by_leader.emplace(_imp->groups[idx], second_phase.size()).first;
+                    second_phase.push_back({});
+                }
+                second_phase[c->second].push_back(idx);
+            }
+        }
 
-        // evaluate all cached observables in parallel
-        for (auto co : _imp->cached_observables)
+        // chop the clusters into schedulable units of bounded cost, so that one
+        // populous decay class cannot serialize the whole update, and schedule
+        // the expensive units first: together with the pool's work stealing, this
+        // approximates a longest-processing-time-first balance. The bounds come
+        // from the evaluation times measured in previous updates; before the
+        // first update all costs are zero and the units are bounded by count
+        using Unit = std::pair<double, std::vector<unsigned>>;
+        auto schedule = [this] (const std::vector<std::vector<unsigned>> & clusters) -> std::vector<Unit>
         {
-            auto f = [=, this]() {
-                auto & o   = std::get<0>(co);
-                auto & idx = std::get<1>(co);
-                try
+            const unsigned n_threads = std::max(1u, ThreadPool::instance()->number_of_threads());
+
+            double total_cost = 0.0;
+            unsigned total_size = 0;
+            for (const auto & cluster : clusters)
+            {
+                for (const auto & idx : cluster)
+                {
+                    total_cost += _imp->evaluation_costs[idx];
+                }
+                total_size += cluster.size();
+            }
+
+            // a quarter of one worker's fair share leaves room for balancing
+            const double   cost_bound = total_cost / (4.0 * n_threads);
+            const unsigned size_bound = std::max(1u, (total_size + 4 * n_threads - 1) / (4 * n_threads));
+
+            std::vector<Unit> units;
+            for (const auto & cluster : clusters)
+            {
+                Unit unit{ 0.0, {} };
+                for (const auto & idx : cluster)
                 {
-                    _imp->predictions[idx] = o->evaluate();
+                    unit.first += _imp->evaluation_costs[idx];
+                    unit.second.push_back(idx);
+
+                    if ((unit.first > cost_bound) || (unit.second.size() >= size_bound))
+                    {
+                        units.push_back(std::move(unit));
+                        unit = Unit{ 0.0, {} };
+                    }
                 }
-                catch (eos::Exception & e)
+                if (! unit.second.empty())
                 {
-                    Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating cached observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
-                        << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+                    units.push_back(std::move(unit));
+                }
+            }
 
+            std::sort(units.begin(), units.end(), [] (const Unit & lhs, const Unit & rhs)
+            {
+                return lhs.first > rhs.first;
+            });
+
+            return units;
+        };
+
+        const std::vector<Unit> first_units  = schedule(first_phase);
+        const std::vector<Unit> second_units = schedule(second_phase);
+
+        // evaluate each phase in parallel across the thread pool; a chunk size of
+        // one keeps the schedule at the granularity of the units
+        ThreadPool::instance()->parallel_for(0, first_units.size(), [&] (size_t b, size_t e)
+        {
+            for (size_t i = b ; i != e ; ++i)
+            {
+                for (const unsigned & idx : first_units[i].second)
+                {
+                    evaluate_one(idx);
                 }
-            };
-            cached_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
-        }
+            }
+        }, 1);
 
-        // await completion of the regular observables
-        for (auto ticket : regular_tickets)
+        ThreadPool::instance()->parallel_for(0, second_units.size(), [&] (size_t b, size_t e)
         {
-            ticket.wait();
-        }
+            for (size_t i = b ; i != e ; ++i)
+            {
+                for (const unsigned & idx : second_units[i].second)
+                {
+                    evaluate_one(idx);
+                }
+            }
+        }, 1);
 
-        // await completion of the cached observables
-        for (auto ticket : cached_tickets)
+        // synchronize the freshly evaluated predictions across all ranks: entries
+        // owned by another rank were not touched locally, so contribute zero and
+        // let the element-wise sum fill in the owner's value
+        if (mpi_size > 1)
         {
-            ticket.wait();
+            std::vector<double> buffer(synchronized.size());
+            for (unsigned i = 0, i_end = synchronized.size() ; i != i_end ; ++i)
+            {
+                buffer[i] = owned(synchronized[i]) ? _imp->predictions[synchronized[i]] : 0.0;
+            }
+
+            mpi::allreduce_sum(buffer.data(), buffer.size());
+
+            for (unsigned i = 0, i_end = synchronized.size() ; i != i_end ; ++i)
+            {
+                _imp->predictions[synchronized[i]] = buffer[i];
+            }
         }
 
         // evaluate all expression observables in a serial fashion
@@ -305,6 +577,7 @@ namespace eos
         {
             auto & o   = std::get<0>(eo);
             auto & idx = std::get<1>(eo);
+            const auto start = std::chrono::steady_clock::now();
             try
             {
                 _imp->predictions[idx] = o->evaluate();
@@ -316,7 +589,16 @@ namespace eos
                     << e.what();
                 _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
             }
+            const auto stop = std::chrono::steady_clock::now();
+
+            _imp->evaluation_counts[idx] += 1;
+            _imp->evaluation_times[idx] += std::chrono::duration<double>(stop - start).count();
         }
+
+        // record the generation for which the predictions are now up to date
+        _imp->last_update_generation = current_generation;
+        _imp->updated_once = true;
+        ++_imp->updates;
     }
 
     Parameters
@@ -325,6 +607,12 @@ namespace eos
         return _imp->parameters;
     }
 
+    std::uint64_t
+    ObservableCache::generation() const
+    {
+        return _imp->last_update_generation;
+    }
+
     double
     ObservableCache::operator[] (const ObservableCache::Id & id) const
     {
@@ -355,6 +643,64 @@ namespace eos
         return _imp->observables.end();
     }
 
+    unsigned long
+    ObservableCache::evaluation_count(const ObservableCache::Id & id) const
+    {
+        return _imp->evaluation_counts[id];
+    }
+
+    double
+    ObservableCache::evaluation_time(const ObservableCache::Id & id) const
+    {
+        return _imp->evaluation_times[id];
+    }
+
+    double
+    ObservableCache::cost_estimate(const ObservableCache::Id & id) const
+    {
+        return _imp->evaluation_costs[id];
+    }
+
+    void
+    ObservableCache::calibrate(const unsigned & repetitions)
+    {
+        const std::vector<bool> stale(_imp->observables.size(), true);
+
+        for (unsigned r = 0 ; r < repetitions ; ++r)
+        {
+            _update(stale);
+        }
+    }
+
+    unsigned long
+    ObservableCache::number_of_updates() const
+    {
+        return _imp->updates;
+    }
+
+    unsigned long
+    ObservableCache::number_of_additions() const
+    {
+        return _imp->additions;
+    }
+
+    double
+    ObservableCache::deduplication_rate() const
+    {
+        if (0 == _imp->additions)
+            return 0.0;
+
+        return static_cast<double>(_imp->deduplications) / _imp->additions;
+    }
+
+    void
+    ObservableCache::reset_statistics()
+    {
+        std::fill(_imp->evaluation_counts.begin(), _imp->evaluation_counts.end(), 0);
+        std::fill(_imp->evaluation_times.begin(), _imp->evaluation_times.end(), 0.0);
+        _imp->updates = 0;
+    }
+
     ObservableCache
     ObservableCache::clone(const Parameters & parameters) const
     {
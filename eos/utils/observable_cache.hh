@@ -26,8 +26,20 @@
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 
+#include <cstdint>
+#include <vector>
+
 namespace eos
 {
+    /*!
+     * Caches the predictions of a set of unique observables.
+     *
+     * The cache holds the single owning reference of every observable added
+     * to it, acting as the arena of its analysis. Internally, the observables
+     * are addressed through their stable ids and non-owning handles rather
+     * than through shared pointers, which confines reference counting to the
+     * accessors of the public interface.
+     */
     class ObservableCache :
         public PrivateImplementationPattern<ObservableCache>
     {
@@ -59,9 +71,52 @@ namespace eos
             /// Update the predictions for all observables.
             void update();
 
+            /*!
+             * Update the predictions for only those observables that depend on
+             * the given parameter.
+             *
+             * Intended for one-parameter profile scans: when the given parameter
+             * is the only one whose value has changed since the last update, this
+             * skips the re-evaluation of every independent observable. Observables
+             * that do not declare their used parameter ids are conservatively
+             * re-evaluated.
+             *
+             * @param changed The id of the only parameter whose value may have changed since the last update.
+             */
+            void update(const Parameter::Id & changed);
+
+            /*!
+             * Return whether the given observable depends on the given parameter.
+             *
+             * Observables that do not declare their used parameter ids are
+             * conservatively treated as depending on every parameter.
+             *
+             * @param id      The unique ObservableCache::Id of the observable in question.
+             * @param changed The id of the parameter in question.
+             */
+            bool depends_on(const ObservableCache::Id & id, const Parameter::Id & changed) const;
+
+            /*!
+             * Retrieve the ids of the parameters on which the given observable depends.
+             *
+             * An empty result means that the observable does not declare its used
+             * parameter ids, and must be conservatively treated as depending on
+             * every parameter.
+             *
+             * @param id The unique ObservableCache::Id of the observable in question.
+             */
+            const std::vector<Parameter::Id> & dependencies(const ObservableCache::Id & id) const;
+
             /// Retrieve the cache's common Parameters object.
             Parameters parameters() const;
 
+            /*!
+             * Retrieve the parameter generation for which the cached predictions
+             * are up to date, i.e. the generation of the common Parameters object
+             * at the time of the last update.
+             */
+            std::uint64_t generation() const;
+
             /*!
              * Retrieve a unique observable by its ObservableCache::Id.
              *
@@ -85,8 +140,70 @@ namespace eos
             Iterator end() const;
             ///@}
 
+            ///@name Instrumentation
+            ///@{
+            /*!
+             * Retrieve the number of times the given observable has been (re)evaluated
+             * across all updates.
+             *
+             * @param id The unique ObservableCache::Id whose associated observable's statistics shall be retrieved.
+             */
+            unsigned long evaluation_count(const ObservableCache::Id & id) const;
+
+            /*!
+             * Retrieve the cumulative wall-clock time, in seconds, spent evaluating the
+             * given observable across all updates.
+             *
+             * @param id The unique ObservableCache::Id whose associated observable's statistics shall be retrieved.
+             */
+            double evaluation_time(const ObservableCache::Id & id) const;
+
+            /*!
+             * Retrieve the current estimate of the wall-clock cost, in seconds, of one
+             * evaluation of the given observable.
+             *
+             * The estimates are obtained by timing the evaluations of previous updates;
+             * they steer the scheduling of the parallel updates.
+             *
+             * @param id The unique ObservableCache::Id whose associated observable's cost estimate shall be retrieved.
+             */
+            double cost_estimate(const ObservableCache::Id & id) const;
+
+            /*!
+             * Calibrate the per-observable cost estimates by carrying out the given
+             * number of timed updates at the current parameter point.
+             *
+             * Without calibration, the estimates start at zero and only converge over
+             * the first few updates of a fit; calibrating up front lets already the
+             * first update schedule its work from measured costs.
+             *
+             * @param repetitions The number of timed evaluations per observable.
+             */
+            void calibrate(const unsigned & repetitions);
+
+            /// Retrieve the number of updates carried out so far.
+            unsigned long number_of_updates() const;
+
+            /// Retrieve the number of calls to add() so far.
+            unsigned long number_of_additions() const;
+
+            /*!
+             * Retrieve the fraction of calls to add() that were resolved to a
+             * previously inserted observable with identical name, kinematics and
+             * options, rather than creating a new cache entry.
+             */
+            double deduplication_rate() const;
+
+            /// Reset all instrumentation counters.
+            void reset_statistics();
+            ///@}
+
             /// Clone this cache whilst keeping the observables in the given order, i.e. all ids remain valid.
             ObservableCache clone(const Parameters & parameters) const;
+
+        private:
+            /// Re-evaluate the observables flagged as stale; common backend of the update() overloads.
+            void _update(const std::vector<bool> & stale);
     };
 
     extern template class WrappedForwardIterator<ObservableCache::IteratorTag, ObservablePtr>;
@@ -0,0 +1,313 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/observable_predictor.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace eos
+{
+    template <>
+    struct Implementation<ObservablePredictor>
+    {
+        // per-worker state: a clone of the Parameters object, the observables
+        // evaluated on that clone, and handles to the varied parameters
+        struct Context
+        {
+            Parameters parameters;
+
+            ObservableCache cache;
+
+            std::vector<Parameter> varied_parameters;
+
+            Context(const Parameters & parameters, const ObservableCache & cache, const std::vector<std::string> & varied_parameter_names) :
+                parameters(parameters),
+                cache(cache.clone(this->parameters))
+            {
+                for (const auto & name : varied_parameter_names)
+                {
+                    varied_parameters.push_back(this->parameters[name]);
+                }
+            }
+        };
+
+        Parameters parameters;
+
+        ObservableCache cache;
+
+        std::vector<ObservableCache::Id> ids;
+
+        std::vector<std::string> varied_parameter_names;
+
+        Mutex mutex;
+
+        std::vector<std::shared_ptr<Context>> contexts;
+
+        Implementation(const Parameters & parameters, const std::vector<ObservablePtr> & observables, const std::vector<std::string> & varied_parameter_names) :
+            parameters(parameters),
+            cache(parameters),
+            varied_parameter_names(varied_parameter_names)
+        {
+            for (const auto & observable : observables)
+            {
+                ids.push_back(cache.add(observable));
+            }
+
+            // one context per worker thread; the contexts are handed out to
+            // the chunks of work, at most one chunk per thread at a time
+            const unsigned number_of_contexts = ThreadPool::instance()->number_of_threads() + 1;
+            for (unsigned i = 0 ; i < number_of_contexts ; ++i)
+            {
+                contexts.push_back(std::make_shared<Context>(parameters.clone(), cache, varied_parameter_names));
+            }
+        }
+
+        std::shared_ptr<Context>
+        acquire()
+        {
+            {
+                Lock l(mutex);
+
+                if (! contexts.empty())
+                {
+                    auto result = contexts.back();
+                    contexts.pop_back();
+
+                    return result;
+                }
+            }
+
+            // cannot happen with the ThreadPool's chunking; guard against it regardless
+            return std::make_shared<Context>(parameters.clone(), cache, varied_parameter_names);
+        }
+
+        void
+        release(const std::shared_ptr<Context> & context)
+        {
+            Lock l(mutex);
+
+            contexts.push_back(context);
+        }
+    };
+
+    ObservablePredictor::ObservablePredictor(const Parameters & parameters, const std::vector<ObservablePtr> & observables,
+            const std::vector<std::string> & varied_parameter_names) :
+        PrivateImplementationPattern<ObservablePredictor>(new Implementation<ObservablePredictor>(parameters, observables, varied_parameter_names))
+    {
+    }
+
+    ObservablePredictor::~ObservablePredictor() = default;
+
+    unsigned
+    ObservablePredictor::number_of_observables() const
+    {
+        return _imp->ids.size();
+    }
+
+    unsigned
+    ObservablePredictor::number_of_varied_parameters() const
+    {
+        return _imp->varied_parameter_names.size();
+    }
+
+    unsigned
+    ObservablePredictor::predict(const double * samples, const unsigned & n_samples, double * results) const
+    {
+        const unsigned columns        = _imp->varied_parameter_names.size();
+        const unsigned n_observables  = _imp->ids.size();
+
+        std::atomic<unsigned> failures(0);
+
+        ThreadPool::instance()->parallel_for(0, n_samples, [&](const size_t begin, const size_t end)
+        {
+            auto context = _imp->acquire();
+
+            for (size_t row = begin ; row < end ; ++row)
+            {
+                const double * sample = samples + row * columns;
+                double * result       = results + row * n_observables;
+
+                for (unsigned column = 0 ; column < columns ; ++column)
+                {
+                    context->varied_parameters[column] = sample[column];
+                }
+
+                try
+                {
+                    context->cache.update();
+
+                    for (unsigned i = 0 ; i < n_observables ; ++i)
+                    {
+                        result[i] = context->cache[_imp->ids[i]];
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    for (unsigned i = 0 ; i < n_observables ; ++i)
+                    {
+                        result[i] = std::numeric_limits<double>::quiet_NaN();
+                    }
+                    ++failures;
+                }
+            }
+
+            _imp->release(context);
+        });
+
+        return failures;
+    }
+
+    unsigned
+    ObservablePredictor::predict_covariance(const double * samples, const double * weights, const unsigned & n_samples,
+            double * mean, double * covariance) const
+    {
+        const unsigned columns       = _imp->varied_parameter_names.size();
+        const unsigned n_observables = _imp->ids.size();
+
+        std::atomic<unsigned> failures(0);
+
+        // global accumulator: total weight, weighted means, and co-moment
+        // matrix; per-chunk accumulators are merged into it under the mutex
+        double total_weight = 0.0;
+        std::vector<double> total_mean(n_observables, 0.0);
+        std::vector<double> total_comoment(n_observables * n_observables, 0.0);
+        Mutex merge_mutex;
+
+        ThreadPool::instance()->parallel_for(0, n_samples, [&](const size_t begin, const size_t end)
+        {
+            auto context = _imp->acquire();
+
+            // chunk-local weighted Welford accumulator
+            double chunk_weight = 0.0;
+            std::vector<double> chunk_mean(n_observables, 0.0);
+            std::vector<double> chunk_comoment(n_observables * n_observables, 0.0);
+            std::vector<double> predictions(n_observables), delta(n_observables);
+
+            for (size_t row = begin ; row < end ; ++row)
+            {
+                const double * sample = samples + row * columns;
+                const double weight   = weights[row];
+
+                if (! (weight > 0.0))
+                {
+                    continue;
+                }
+
+                for (unsigned column = 0 ; column < columns ; ++column)
+                {
+                    context->varied_parameters[column] = sample[column];
+                }
+
+                try
+                {
+                    context->cache.update();
+
+                    for (unsigned i = 0 ; i < n_observables ; ++i)
+                    {
+                        predictions[i] = context->cache[_imp->ids[i]];
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    ++failures;
+                    continue;
+                }
+
+                chunk_weight += weight;
+                const double fraction = weight / chunk_weight;
+                for (unsigned i = 0 ; i < n_observables ; ++i)
+                {
+                    delta[i] = predictions[i] - chunk_mean[i];
+                    chunk_mean[i] += fraction * delta[i];
+                }
+                for (unsigned i = 0 ; i < n_observables ; ++i)
+                {
+                    const double row_factor = weight * delta[i];
+                    double * comoment_row = &chunk_comoment[i * n_observables];
+                    for (unsigned j = 0 ; j < n_observables ; ++j)
+                    {
+                        comoment_row[j] += row_factor * (predictions[j] - chunk_mean[j]);
+                    }
+                }
+            }
+
+            _imp->release(context);
+
+            if (chunk_weight > 0.0)
+            {
+                Lock l(merge_mutex);
+
+                const double merged_weight = total_weight + chunk_weight;
+                const double cross_factor  = total_weight * chunk_weight / merged_weight;
+                for (unsigned i = 0 ; i < n_observables ; ++i)
+                {
+                    const double delta_i = chunk_mean[i] - total_mean[i];
+                    for (unsigned j = 0 ; j < n_observables ; ++j)
+                    {
+                        total_comoment[i * n_observables + j] += chunk_comoment[i * n_observables + j]
+                            + cross_factor * delta_i * (chunk_mean[j] - total_mean[j]);
+                    }
+                }
+                for (unsigned i = 0 ; i < n_observables ; ++i)
+                {
+                    total_mean[i] += chunk_weight / merged_weight * (chunk_mean[i] - total_mean[i]);
+                }
+                total_weight = merged_weight;
+            }
+        });
+
+        if (total_weight > 0.0)
+        {
+            for (unsigned i = 0 ; i < n_observables ; ++i)
+            {
+                mean[i] = total_mean[i];
+
+                // symmetrize to absorb the rounding asymmetry of the streaming updates
+                for (unsigned j = 0 ; j <= i ; ++j)
+                {
+                    const double value = 0.5 * (total_comoment[i * n_observables + j] + total_comoment[j * n_observables + i]) / total_weight;
+
+                    covariance[i * n_observables + j] = value;
+                    covariance[j * n_observables + i] = value;
+                }
+            }
+        }
+        else
+        {
+            for (unsigned i = 0 ; i < n_observables ; ++i)
+            {
+                mean[i] = std::numeric_limits<double>::quiet_NaN();
+                for (unsigned j = 0 ; j < n_observables ; ++j)
+                {
+                    covariance[i * n_observables + j] = std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }
+
+        return failures;
+    }
+}
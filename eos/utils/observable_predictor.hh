@@ -0,0 +1,103 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_OBSERVABLE_PREDICTOR_HH
+#define EOS_GUARD_EOS_UTILS_OBSERVABLE_PREDICTOR_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Predicts a set of observables for a whole matrix of parameter samples.
+     *
+     * The work is distributed over the ThreadPool, with one clone of the
+     * Parameters object and of the observables per worker, so that the
+     * caller's Parameters object is left untouched and the workers cannot
+     * interfere with each other.
+     */
+    class ObservablePredictor :
+        public PrivateImplementationPattern<ObservablePredictor>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters              The Parameters object common to all observables.
+             * @param observables             The observables that shall be predicted.
+             * @param varied_parameter_names  The names of the parameters to which the sample columns correspond, in order.
+             */
+            ObservablePredictor(const Parameters & parameters, const std::vector<ObservablePtr> & observables,
+                    const std::vector<std::string> & varied_parameter_names);
+
+            /// Destructor.
+            ~ObservablePredictor();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of observables per sample.
+            unsigned number_of_observables() const;
+
+            /// Retrieve the number of varied parameters, i.e. the number of sample columns.
+            unsigned number_of_varied_parameters() const;
+
+            /*!
+             * Predict all observables for each of the samples.
+             *
+             * @param samples   The parameter samples, row major, of shape n_samples x number_of_varied_parameters().
+             * @param n_samples The number of samples, i.e. of rows.
+             * @param results   The preallocated output array, row major, of shape n_samples x number_of_observables().
+             *
+             * @return The number of samples whose predictions failed to evaluate; the corresponding rows are filled with NaN.
+             */
+            unsigned predict(const double * samples, const unsigned & n_samples, double * results) const;
+
+            /*!
+             * Predict all observables for each of the samples and accumulate their weighted
+             * mean vector and covariance matrix in a single streaming pass.
+             *
+             * The accumulation is blocked over the ThreadPool, with one weighted Welford
+             * accumulator per chunk; the per-chunk results are merged exactly. At no point
+             * is the full samples x observables matrix materialized.
+             *
+             * @param samples    The parameter samples, row major, of shape n_samples x number_of_varied_parameters().
+             * @param weights    The sample weights on a linear scale, of shape n_samples.
+             * @param n_samples  The number of samples, i.e. of rows.
+             * @param mean       The preallocated output array for the weighted means, of shape number_of_observables().
+             * @param covariance The preallocated output array for the weighted covariance matrix, row major,
+             *                   of shape number_of_observables() x number_of_observables().
+             *
+             * @return The number of samples whose predictions failed to evaluate; these samples are
+             *         excluded from the accumulation.
+             */
+            unsigned predict_covariance(const double * samples, const double * weights, const unsigned & n_samples,
+                    double * mean, double * covariance) const;
+            ///@}
+    };
+}
+
+#endif
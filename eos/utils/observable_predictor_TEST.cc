@@ -0,0 +1,129 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/observable_predictor.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <string>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ObservablePredictorTest :
+    public TestCase
+{
+    public:
+        ObservablePredictorTest() :
+            TestCase("observable_predictor_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Kinematics k;
+
+            std::vector<ObservablePtr> observables
+            {
+                ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)),
+                ObservablePtr(new ObservableStub(p, "mass::c", k))
+            };
+            std::vector<std::string> varied_parameter_names{ "mass::b(MSbar)", "mass::c" };
+
+            ObservablePredictor predictor(p, observables, varied_parameter_names);
+
+            TEST_CHECK_EQUAL(2u, predictor.number_of_observables());
+            TEST_CHECK_EQUAL(2u, predictor.number_of_varied_parameters());
+
+            // the stub observables evaluate to the varied parameters themselves
+            static const unsigned n_samples = 100;
+            std::vector<double> samples(n_samples * 2, 0.0);
+            std::vector<double> results(n_samples * 2, 0.0);
+            for (unsigned i = 0 ; i < n_samples ; ++i)
+            {
+                samples[2 * i + 0] = 4.18 + 0.001 * i;
+                samples[2 * i + 1] = 1.27 + 0.001 * i;
+            }
+
+            const unsigned failures = predictor.predict(samples.data(), n_samples, results.data());
+            TEST_CHECK_EQUAL(0u, failures);
+
+            static const double eps = 1.0e-15;
+            for (unsigned i = 0 ; i < n_samples ; ++i)
+            {
+                TEST_CHECK_NEARLY_EQUAL(results[2 * i + 0], samples[2 * i + 0], eps);
+                TEST_CHECK_NEARLY_EQUAL(results[2 * i + 1], samples[2 * i + 1], eps);
+            }
+
+            // the caller's Parameters object is left untouched
+            TEST_CHECK_EQUAL(p["mass::b(MSbar)"].evaluate(), p["mass::b(MSbar)"].central());
+
+            // streaming covariance must agree with the direct two-pass computation
+            // on the predictions obtained above
+            {
+                std::vector<double> weights(n_samples);
+                for (unsigned i = 0 ; i < n_samples ; ++i)
+                {
+                    weights[i] = 1.0 + 0.01 * (i % 7);
+                }
+
+                std::vector<double> mean(2, 0.0);
+                std::vector<double> covariance(4, 0.0);
+                const unsigned cov_failures = predictor.predict_covariance(samples.data(), weights.data(), n_samples, mean.data(), covariance.data());
+                TEST_CHECK_EQUAL(0u, cov_failures);
+
+                double w_sum = 0.0;
+                std::vector<double> ref_mean(2, 0.0), ref_covariance(4, 0.0);
+                for (unsigned i = 0 ; i < n_samples ; ++i)
+                {
+                    w_sum += weights[i];
+                    ref_mean[0] += weights[i] * results[2 * i + 0];
+                    ref_mean[1] += weights[i] * results[2 * i + 1];
+                }
+                ref_mean[0] /= w_sum;
+                ref_mean[1] /= w_sum;
+                for (unsigned i = 0 ; i < n_samples ; ++i)
+                {
+                    for (unsigned a = 0 ; a < 2 ; ++a)
+                    {
+                        for (unsigned b = 0 ; b < 2 ; ++b)
+                        {
+                            ref_covariance[2 * a + b] += weights[i] * (results[2 * i + a] - ref_mean[a]) * (results[2 * i + b] - ref_mean[b]);
+                        }
+                    }
+                }
+                for (auto & c : ref_covariance)
+                {
+                    c /= w_sum;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(mean[0],       ref_mean[0],       1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(mean[1],       ref_mean[1],       1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(covariance[0], ref_covariance[0], 1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(covariance[1], ref_covariance[1], 1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(covariance[2], ref_covariance[2], 1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(covariance[3], ref_covariance[3], 1.0e-13);
+
+                // the covariance matrix is exactly symmetric
+                TEST_CHECK_EQUAL(covariance[1], covariance[2]);
+            }
+        }
+} observable_predictor_test;
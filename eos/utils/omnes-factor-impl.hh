@@ -44,15 +44,38 @@ namespace eos
         _work(gsl_vector_calloc(nints_ * order_)),
         _x(gsl_vector_calloc(nints_ * order_)),
         _b(gsl_vector_calloc(nints_ * order_ + 1)),
+        _kernel(gsl_matrix_calloc(nints_ * order_ + 1, nints_ * order_)),
+        _kernel_bc_pos(0.0),
+        _kernel_ready(false),
+        _batch_kernel(nullptr),
+        _batch_weights(gsl_vector_calloc(nints_ * order_)),
+        _batch_results(nullptr),
         _err(-1.0),
         _scattering_phase(scattering_phase)
     {
         // Perform pointer check
-        if ((_sys == nullptr) || (_sys2 == nullptr) || (_V == nullptr) || (_S == nullptr) || (_work == nullptr) || (_x == nullptr) || (_b == nullptr)) { throw std::bad_alloc(); }
+        if ((_sys == nullptr) || (_sys2 == nullptr) || (_V == nullptr) || (_S == nullptr) || (_work == nullptr) || (_x == nullptr) || (_b == nullptr) || (_kernel == nullptr)
+            || (_batch_weights == nullptr))
+        {
+            throw std::bad_alloc();
+        }
 
         // Obtain zeros of Legendre Polynomials and compute Gauss-Legendre weights
         LegendrePVector<order_> lp;
         lp.gauss_legendre(_zeros, _weights);
+
+        // Compute the s-values of the discretization nodes
+        for (unsigned i = 0 ; i < nints_ - 1 ; i++)
+        {
+            for (unsigned j = 0 ; j < order_ ; j++)
+            {
+                _nodes[i * order_ + j] = (_intervals[i] + _intervals[i + 1] + (_intervals[i + 1] - _intervals[i]) * _zeros[j]) / 2;
+            }
+        }
+        for (unsigned j = 0 ; j < order_ ; j++)
+        {
+            _nodes[(nints_ - 1) * order_ + j] = 2 * _intervals[nints_ - 1] / (1 - _zeros[j]);
+        }
     }
 
     // Deallocate memory
@@ -79,65 +102,105 @@ namespace eos
 
         if (_b) { gsl_vector_free(_b); }
         _b = nullptr;
+
+        if (_kernel) { gsl_matrix_free(_kernel); }
+        _kernel = nullptr;
+
+        if (_batch_kernel) { gsl_matrix_free(_batch_kernel); }
+        _batch_kernel = nullptr;
+
+        if (_batch_weights) { gsl_vector_free(_batch_weights); }
+        _batch_weights = nullptr;
+
+        if (_batch_results) { gsl_vector_free(_batch_results); }
+        _batch_results = nullptr;
     }
 
-    // Prepare system of equations
+    // Compute one row of the phase-independent kernel, evaluated at z
     template <unsigned order_, unsigned nints_>
-    std::array<double, nints_ * order_> OmnesFactor<order_, nints_>::solve_sys(const double & bc_pos)
+    std::array<double, nints_ * order_> OmnesFactor<order_, nints_>::p_row(const double & z) const
     {
-        std::array<double, (nints_ + 1) * order_> slist  {};
-        std::array<double, (nints_ + 1) * order_> bc  {};
-        std::array<double, nints_ * order_> sol {};
+        std::array<double, nints_ * order_> ret_vec  {};
 
-        for (unsigned i = 0 ; i < nints_ - 1 ; i++)
+        for (unsigned j = 0 ; j < nints_ ; j++)
         {
-            std::array<double, order_> bcslice = rr_ab(bc_pos, _intervals[i], _intervals[i + 1]);
-            for (unsigned j = 0 ; j < order_ ; j++)
+            std::array<double, order_> block  {};
+            if (j != nints_ - 1)
             {
-                slist[i * order_ + j] = (_intervals[i] + _intervals[i + 1] + (_intervals[i + 1] - _intervals[i]) * _zeros[j]) / 2;
-                bc[i * order_ + j] = bcslice[j];
+                block = p_ab(z, _intervals[j], _intervals[j + 1]);
+            }
+            else
+            {
+                block = p_inf(z, _intervals[j]);
+            }
+            for (unsigned k = 0 ; k < order_ ; k++)
+            {
+                ret_vec[j * order_ + k] = block[k];
             }
         }
-        std::array<double, order_> bc_end = rr_inf(bc_pos, _intervals[nints_ - 1]);
-        for (unsigned j = 0 ; j < order_ ; j++)
+        return ret_vec;
+    }
+
+    // Fill the kernel matrix for a given boundary-condition position. The kernel
+    // depends only on the grid geometry and bc_pos, so it is computed at most once
+    // per bc_pos and reused across re-solves with updated phases.
+    template <unsigned order_, unsigned nints_>
+    void OmnesFactor<order_, nints_>::prepare_kernel(const double & bc_pos)
+    {
+        if (_kernel_ready && (bc_pos == _kernel_bc_pos))
+        {
+            return;
+        }
+
+        for (unsigned i = 0 ; i < nints_ * order_ ; i++)
+        {
+            std::array<double, nints_ * order_> row = p_row(_nodes[i]);
+            for (unsigned j = 0 ; j < nints_ * order_ ; j++)
+            {
+                gsl_matrix_set(_kernel, i, j, row[j]);
+            }
+        }
+
+        std::array<double, nints_ * order_> bc_row = p_row(bc_pos);
+        for (unsigned j = 0 ; j < nints_ * order_ ; j++)
+        {
+            gsl_matrix_set(_kernel, nints_ * order_, j, bc_row[j]);
+        }
+
+        _kernel_bc_pos = bc_pos;
+        _kernel_ready = true;
+    }
+
+    // Prepare system of equations
+    template <unsigned order_, unsigned nints_>
+    std::array<double, nints_ * order_> OmnesFactor<order_, nints_>::solve_sys(const double & bc_pos)
+    {
+        std::array<double, nints_ * order_> sol {};
+
+        prepare_kernel(bc_pos);
+
+        // Phase-dependent part: tangent of the phase at the discretization nodes
+        std::array<double, nints_ * order_> tan_phase  {};
+        for (unsigned j = 0 ; j < nints_ * order_ ; j++)
         {
-            slist[(nints_ - 1) * order_ + j] = (2 * _intervals[nints_ - 1] / (1 - _zeros[j]));
-            bc[(nints_ - 1) * order_ + j] = bc_end[j];
+            tan_phase[j] = std::tan(_scattering_phase(_nodes[j]));
         }
 
         for (unsigned i = 0 ; i < nints_ * order_; i++)
         {
-            for (unsigned j = 0 ; j < nints_ ; j++)
+            for (unsigned j = 0 ; j < nints_ * order_ ; j++)
             {
-                std::array<double, order_> row  {};
-                if (j != nints_ - 1)
-                {
-                    row = rr_ab(slist[i], _intervals[j], _intervals[j + 1]);
-                }
-                else
-                {
-                    row = rr_inf(slist[i], _intervals[j]);
-                }
-                for (unsigned k = 0 ; k < order_ ; k++)
-                {
-                    if (i == j * order_ + k)
-                    {
-                        gsl_matrix_set(_sys, i, j * order_ + k, 1.0 - row[k]);
-                    }
-                    else
-                    {
-                        gsl_matrix_set(_sys, i, j * order_ + k, -row[k]);
-                    }
-                }
+                gsl_matrix_set(_sys, i, j, (i == j ? 1.0 : 0.0) - gsl_matrix_get(_kernel, i, j) * tan_phase[j]);
             }
         }
 
         for (unsigned j = 0 ; j < nints_ * order_ ; j++)
         {
-            gsl_matrix_set(_sys, nints_ * order_, j, bc[j]);
+            gsl_matrix_set(_sys, nints_ * order_, j, gsl_matrix_get(_kernel, nints_ * order_, j) * tan_phase[j]);
         }
 
         // Initialize b & sys2
+        gsl_vector_set_zero(_b);
         gsl_vector_set(_b, nints_ * order_, 1.0);
         gsl_matrix_memcpy(_sys2, _sys);
 
@@ -283,6 +346,98 @@ namespace eos
             return complex<double>(res, 0);
         }
     }
+
+    template <unsigned order_, unsigned nints_>
+    std::vector<complex<double>> OmnesFactor<order_, nints_>::evaluate(const std::vector<double> & points)
+    {
+        static const double eps = 1e-7;
+
+        std::vector<complex<double>> results(points.size());
+
+        if (points.empty())
+        {
+            return results;
+        }
+
+        // Points too close to an interval border are averaged over both sides by
+        // operator() and cannot be represented by a single kernel row
+        auto is_border = [this] (const double & s) -> bool
+        {
+            for (unsigned i = 0 ; i < nints_ ; i++)
+            {
+                if (std::abs(_intervals[i] - s) < eps)
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        // (Re)build the cached kernel rows if the evaluation points changed
+        if (points != _batch_points)
+        {
+            if (_batch_kernel) { gsl_matrix_free(_batch_kernel); }
+            _batch_kernel = nullptr;
+
+            if (_batch_results) { gsl_vector_free(_batch_results); }
+            _batch_results = nullptr;
+
+            _batch_kernel = gsl_matrix_calloc(points.size(), nints_ * order_);
+            _batch_results = gsl_vector_calloc(points.size());
+            if ((_batch_kernel == nullptr) || (_batch_results == nullptr)) { throw std::bad_alloc(); }
+
+            for (unsigned i = 0 ; i < points.size() ; i++)
+            {
+                if (is_border(points[i]))
+                {
+                    continue;
+                }
+
+                std::array<double, nints_ * order_> row = p_row(points[i]);
+                for (unsigned j = 0 ; j < nints_ * order_ ; j++)
+                {
+                    gsl_matrix_set(_batch_kernel, i, j, row[j]);
+                }
+            }
+
+            _batch_points = points;
+        }
+
+        // Phase-dependent part: tangent of the phase at the discretization nodes,
+        // combined with the solution weights
+        for (unsigned j = 0 ; j < nints_ * order_ ; j++)
+        {
+            gsl_vector_set(_batch_weights, j, std::tan(_scattering_phase(_nodes[j])) * _sol[j]);
+        }
+
+        gsl_blas_dgemv(CblasNoTrans, 1.0, _batch_kernel, _batch_weights, 0.0, _batch_results);
+
+        for (unsigned i = 0 ; i < points.size() ; i++)
+        {
+            if (is_border(points[i]))
+            {
+                results[i] = (*this)(points[i]);
+                continue;
+            }
+
+            if (std::abs(_scattering_phase(points[i]) - M_PI / 2.0) < eps)
+            {
+                throw InternalError("Tried to evaluate Omnes factor too close to delta(s) = Pi/2!");
+            }
+
+            const double res = gsl_vector_get(_batch_results, i);
+            if (points[i] > _intervals[0])
+            {
+                results[i] = complex<double>(res, res * std::tan(_scattering_phase(points[i])));
+            }
+            else
+            {
+                results[i] = complex<double>(res, 0);
+            }
+        }
+
+        return results;
+    }
 }
 
 #endif
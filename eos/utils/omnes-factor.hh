@@ -27,6 +27,7 @@
 
 #include <array>
 #include <functional>
+#include <vector>
 
 namespace eos
 {
@@ -55,6 +56,22 @@ namespace eos
             // Array containing zeros of Legendre Polynomials
             std::array<double, order_> _zeros {};
 
+            // Array containing the s-values of the discretization nodes
+            std::array<double, nints_ * order_> _nodes {};
+
+            // Discretized integral kernel (system rows plus boundary-condition row);
+            // depends only on the grid geometry and the position of the boundary
+            // condition, not on the scattering phase
+            gsl_matrix * _kernel;
+            double _kernel_bc_pos;
+            bool _kernel_ready;
+
+            // Kernel rows for batch evaluation, cached per set of evaluation points
+            std::vector<double> _batch_points;
+            gsl_matrix * _batch_kernel;
+            gsl_vector * _batch_weights;
+            gsl_vector * _batch_results;
+
             // Array containing solution weights
             std::array<double, nints_ * order_> _sol {};
 
@@ -74,6 +91,12 @@ namespace eos
             std::array<double, order_> rr_ab(const double & z, const double & a, const double & b) const;
             std::array<double, order_> rr_inf(const double & z, const double & a) const;
 
+            // Compute one row of the phase-independent kernel, evaluated at z
+            std::array<double, nints_ * order_> p_row(const double & z) const;
+
+            // Fill the kernel matrix for a given boundary-condition position
+            void prepare_kernel(const double & bc_pos);
+
             // Solve the system of equations
             std::array<double, nints_ * order_> solve_sys(const double & bc_pos);
 
@@ -94,6 +117,19 @@ namespace eos
             // Return weights
             std::array<double, nints_ * order_> get_weights() { return _sol; }
 
+            // Re-solve for the current phase input. The discretized kernel matrix is
+            // phase-independent and reused; only the tangent of the phase at the
+            // discretization nodes is recomputed, so re-solving per parameter point
+            // is much cheaper than constructing a new OmnesFactor.
+            void resolve(const double & bc_pos) { _sol = solve_sys(bc_pos); }
+
+            // Return the Omnes factor evaluated at a batch of s-values. The kernel
+            // rows for the given points are cached, so that repeated evaluation on
+            // the same batch (e.g. within a fit) reduces to a single matrix-vector
+            // product per parameter point. Points within 1e-7 of an interval border
+            // are evaluated through operator() instead.
+            std::vector<complex<double>> evaluate(const std::vector<double> & points);
+
             // Return Omnes factor evaluated at s
             complex<double> constexpr operator() (const double & s) const
             {
@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include <array>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -75,5 +76,37 @@ class OmnesFactorTest :
                 TEST_CHECK_NEARLY_EQUAL(O2(1.0),        1.0,            eps);
                 TEST_CHECK_NEARLY_EQUAL(abs(O2(16.1)),  4.808139781,    eps);
             }
+
+            // Batch evaluation agrees with point-by-point evaluation
+            {
+                std::array<double, 4> intervals = {4.0, 10.0, 25.0, 50.0};
+                OmnesFactor<50, 4> O(intervals, test_phase, 1.0);
+
+                const std::vector<double> points{ -25.0, -12.5, -1.5, 1.0, 2.5, 3.9, 4.1, 8.0, 12.0, 16.1, 25.0, 25.01, 30.0 };
+
+                // twice, to exercise the cached kernel rows on the second pass
+                for (unsigned pass = 0 ; pass < 2 ; pass++)
+                {
+                    std::vector<complex<double>> results = O.evaluate(points);
+
+                    for (unsigned i = 0 ; i < points.size() ; i++)
+                    {
+                        TEST_CHECK_NEARLY_EQUAL(real(results[i]), real(O(points[i])), 1e-10);
+                        TEST_CHECK_NEARLY_EQUAL(imag(results[i]), imag(O(points[i])), 1e-10);
+                    }
+                }
+            }
+
+            // Re-solving reuses the kernel and reproduces the solution
+            {
+                std::array<double, 4> intervals = {4.0, 10.0, 25.0, 50.0};
+                OmnesFactor<50, 4> O(intervals, test_phase, 1.0);
+
+                O.resolve(1.0);
+
+                TEST_CHECK_NEARLY_EQUAL(O(1.0),         1.0,            eps);
+                TEST_CHECK_NEARLY_EQUAL(abs(O(16.1)),   4.808139781,    eps);
+                TEST_CHECK_NEARLY_EQUAL(abs(O(30.0)),   1.122981676,    eps);
+            }
     }
 } omnes_factor_test;
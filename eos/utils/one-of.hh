@@ -23,10 +23,10 @@
 #ifndef EOS_GUARD_EOS_UTILS_ONE_OF_HH
 #define EOS_GUARD_EOS_UTILS_ONE_OF_HH 1
 
-#include <cstdlib>
 #include <memory>
-#include <string>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 namespace eos
 {
@@ -52,128 +52,24 @@ namespace eos
                 >::type;
     };
 
-    /* OneOfVisitor */
-    template <typename Type_>
-    struct OneOfVisitorVisit
-    {
-        virtual void visit(Type_ &) = 0;
-    };
-
-    template <typename ... Types_>
-    struct OneOfVisitor :
-        OneOfVisitorVisit<Types_> ...
-    {
-    };
-
-    /* OneOfVisitorWrapper */
-    template <typename Visitor_, typename Underlying_, typename Result_, typename ... Types_>
-    struct OneOfVisitorWrapperVisit;
-
-    template <typename Visitor_, typename Underlying_, typename Result_>
-    struct OneOfVisitorWrapperVisit<Visitor_, Underlying_, Result_> :
-        Visitor_
-    {
-        Underlying_ & underlying;
-
-        Result_ result;
-
-        OneOfVisitorWrapperVisit(Underlying_ & u) :
-            underlying(u)
-        {
-        }
-    };
-
-    template <typename Visitor_, typename Underlying_>
-    struct OneOfVisitorWrapperVisit<Visitor_, Underlying_, void> :
-        Visitor_
-    {
-        Underlying_ & underlying;
-
-        OneOfVisitorWrapperVisit(Underlying_ & u) :
-            underlying(u)
-        {
-        }
-    };
-
-    template <typename Visitor_, typename Underlying_, typename Type_, typename ... Rest_>
-    struct OneOfVisitorWrapperVisit<Visitor_, Underlying_, void, Type_, Rest_ ...> :
-        OneOfVisitorWrapperVisit<Visitor_, Underlying_, void, Rest_ ...>
-    {
-        OneOfVisitorWrapperVisit(Underlying_ & u) :
-            OneOfVisitorWrapperVisit<Visitor_, Underlying_, void, Rest_ ...>(u)
-        {
-        }
-
-        virtual void visit(Type_ & t)
-        {
-            this->underlying.visit(t);
-        }
-    };
-
-    template <typename Visitor_, typename Underlying_, typename Result_, typename Type_, typename ... Rest_>
-    struct OneOfVisitorWrapperVisit<Visitor_, Underlying_, Result_, Type_, Rest_ ...> :
-        OneOfVisitorWrapperVisit<Visitor_, Underlying_, Result_, Rest_ ...>
-    {
-        OneOfVisitorWrapperVisit(Underlying_ & u) :
-            OneOfVisitorWrapperVisit<Visitor_, Underlying_, Result_, Rest_ ...>(u)
-        {
-        }
-
-        virtual void visit(Type_ & t)
-        {
-            this->result = this->underlying.visit(t);
-        }
-    };
-
-    template <typename Underlying_, typename Result_, typename ... Types_>
-    struct OneOfVisitorWrapper :
-        OneOfVisitorWrapperVisit<OneOfVisitor<Types_ ...>, Underlying_, Result_, Types_...>
-    {
-        OneOfVisitorWrapper(Underlying_ & u) :
-            OneOfVisitorWrapperVisit<OneOfVisitor<Types_ ...>, Underlying_, Result_, Types_...>(u)
-        {
-        }
-    };
-
-    /* OneOf */
-    template <typename ... Types_>
-    struct OneOfValueBase
-    {
-        virtual ~OneOfValueBase() = 0;
-
-        virtual void accept(OneOfVisitor<Types_ ...> &) = 0;
-    };
-
-    template <typename ... Types_>
-    OneOfValueBase<Types_ ...>::~OneOfValueBase() = default;
-
-    template <typename Type_, typename ... Types_>
-    struct OneOfValue :
-        OneOfValueBase<Types_ ...>
-    {
-        Type_ value;
-
-        OneOfValue(const Type_ & type) :
-            value(type)
-        {
-        }
-
-        virtual void accept(OneOfVisitor<Types_ ...> & visitor)
-        {
-            static_cast<OneOfVisitorVisit<Type_> &>(visitor).visit(value);
-        }
-    };
-
+    /*!
+     * A discriminated union over Types_ with shared-value copy semantics.
+     *
+     * The value is held in a std::variant behind a shared_ptr: copies of a
+     * OneOf refer to the same value, and the alternative types only need to
+     * be complete where a OneOf is constructed or visited, which permits the
+     * recursive expression AST. Visitation maps onto std::visit, i.e. a
+     * tag-indexed jump table into the visitor's (inlinable) visit()
+     * overloads, rather than double dispatch through virtual accept()/visit()
+     * calls.
+     */
     template <typename ... Types_>
     class OneOf
     {
         private:
-            std::shared_ptr<OneOfValueBase<Types_ ...>> _value;
+            using ValueType = std::variant<Types_ ...>;
 
-            OneOf(OneOfValueBase<Types_ ...> * ptr) :
-                _value(ptr)
-            {
-            }
+            std::shared_ptr<ValueType> _value;
 
         public:
             OneOf()
@@ -182,7 +78,7 @@ namespace eos
 
             template <typename Type_>
             OneOf(const Type_ & value) :
-                _value(new OneOfValue<typename SelectOneOfType<Type_, Types_ ...>::Type, Types_ ...>{value})
+                _value(std::make_shared<ValueType>(std::in_place_type<typename SelectOneOfType<Type_, Types_ ...>::Type>, value))
             {
             }
 
@@ -199,7 +95,7 @@ namespace eos
             template <typename Type_>
             OneOf & operator= (const Type_ & value)
             {
-                _value.reset(new OneOfValue<typename SelectOneOfType<Type_, Types_ ...>::Type, Types_ ...>{value});
+                _value = std::make_shared<ValueType>(std::in_place_type<typename SelectOneOfType<Type_, Types_ ...>::Type>, value);
                 return *this;
             }
 
@@ -213,19 +109,13 @@ namespace eos
             template <typename Visitor_>
             void accept(Visitor_ & visitor) const
             {
-                OneOfVisitorWrapper<Visitor_, void, Types_ ...> visitor_wrapper(visitor);
-
-                _value->accept(visitor_wrapper);
+                std::visit([&visitor] (auto & value) { visitor.visit(value); }, *_value);
             }
 
             template <typename Result_, typename Visitor_>
             Result_ accept_returning(Visitor_ & visitor) const
             {
-                OneOfVisitorWrapper<Visitor_, Result_, Types_ ...> visitor_wrapper(visitor);
-
-                _value->accept(visitor_wrapper);
-
-                return visitor_wrapper.result;
+                return std::visit([&visitor] (auto & value) -> Result_ { return visitor.visit(value); }, *_value);
             }
     };
 }
@@ -23,22 +23,30 @@
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
-#include <map>
 #include <algorithm>
+#include <map>
+#include <vector>
 
 namespace eos
 {
     template <>
     struct WrappedForwardIteratorTraits<Options::OptionIteratorTag>
     {
-        using UnderlyingIterator = std::map<std::string, std::string>::const_iterator;
+        using UnderlyingIterator = std::vector<std::pair<std::string, std::string>>::const_iterator;
     };
-    template class WrappedForwardIterator<Options::OptionIteratorTag, const std::pair<const std::string, std::string>>;
+    template class WrappedForwardIterator<Options::OptionIteratorTag, const std::pair<std::string, std::string>>;
 
     template <>
     struct Implementation<Options>
     {
-        std::map<std::string, std::string> options;
+        /*
+         * The options, as key/value pairs sorted by key. Observable
+         * construction and constraint resolution perform large numbers of
+         * small lookups and merges; a flat sorted vector serves these with
+         * contiguous binary searches and linear-time merges, where the
+         * previously used std::map spent its time rebalancing nodes.
+         */
+        std::vector<std::pair<std::string, std::string>> options;
 
         Implementation()
         {
@@ -48,8 +56,47 @@ namespace eos
         {
             for (const auto & _option : _options)
             {
-                options.insert(_option);
+                insert(_option.first, _option.second, false);
+            }
+        }
+
+        std::vector<std::pair<std::string, std::string>>::const_iterator
+        find(const std::string & key) const
+        {
+            const auto i = std::lower_bound(options.cbegin(), options.cend(), key,
+                    [] (const std::pair<std::string, std::string> & option, const std::string & key) -> bool
+                    {
+                        return option.first < key;
+                    });
+
+            if ((options.cend() == i) || (i->first != key))
+            {
+                return options.cend();
             }
+
+            return i;
+        }
+
+        void
+        insert(const std::string & key, const std::string & value, const bool & overwrite)
+        {
+            const auto i = std::lower_bound(options.begin(), options.end(), key,
+                    [] (const std::pair<std::string, std::string> & option, const std::string & key) -> bool
+                    {
+                        return option.first < key;
+                    });
+
+            if ((options.end() != i) && (i->first == key))
+            {
+                if (overwrite)
+                {
+                    i->second = value;
+                }
+
+                return;
+            }
+
+            options.emplace(i, key, value);
         }
     };
 
@@ -91,8 +138,8 @@ namespace eos
     const std::string &
     Options::operator[] (const std::string & key) const
     {
-        auto i(_imp->options.find(key));
-        if (_imp->options.end() == i)
+        auto i(_imp->find(key));
+        if (_imp->options.cend() == i)
             throw UnknownOptionError(key);
 
         return i->second;
@@ -101,29 +148,21 @@ namespace eos
     bool
     Options::has(const std::string & key) const
     {
-        return _imp->options.end() != _imp->options.find(key);
+        return _imp->options.cend() != _imp->find(key);
     }
 
     void
     Options::declare(const std::string & key, const std::string & value)
     {
-        auto i(_imp->options.find(key));
-        if (_imp->options.end() != i)
-        {
-            i->second = value;
-        }
-        else
-        {
-            _imp->options[key] = value;
-        }
+        _imp->insert(key, value, true);
     }
 
     std::string
     Options::get(const std::string & key, const std::string & default_value) const
     {
-        auto i(_imp->options.find(key));
+        auto i(_imp->find(key));
 
-        if (_imp->options.end() == i)
+        if (_imp->options.cend() == i)
             return default_value;
 
         return i->second;
@@ -188,21 +227,37 @@ namespace eos
     {
         Options result;
 
-        result._imp->options.insert(lhs._imp->options.cbegin(), lhs._imp->options.cend());
-
         /*
-         * merge all options from rhs into result. Make sure to overwrite
-         * existing lhs options with the same key.
+         * merge the sorted options of lhs and rhs in a single linear pass.
+         * Make sure to overwrite existing lhs options with the same key.
          */
-        for (auto o : rhs._imp->options)
-        {
-            auto retval = result._imp->options.insert(o);
+        auto & merged = result._imp->options;
+        merged.reserve(lhs._imp->options.size() + rhs._imp->options.size());
+
+        auto l = lhs._imp->options.cbegin(), l_end = lhs._imp->options.cend();
+        auto r = rhs._imp->options.cbegin(), r_end = rhs._imp->options.cend();
 
-            if (! retval.second)
+        while ((l != l_end) && (r != r_end))
+        {
+            if (l->first < r->first)
+            {
+                merged.push_back(*l);
+                ++l;
+            }
+            else if (r->first < l->first)
             {
-                retval.first->second = o.second;
+                merged.push_back(*r);
+                ++r;
+            }
+            else
+            {
+                merged.push_back(*r);
+                ++l;
+                ++r;
             }
         }
+        merged.insert(merged.end(), l, l_end);
+        merged.insert(merged.end(), r, r_end);
 
         return result;
     }
@@ -290,13 +345,7 @@ namespace eos
     LeptonFlavorOption::LeptonFlavorOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key) :
         SpecifiedOption(options, specifications, key)
     {
-    }
-
-    LeptonFlavorOption::~LeptonFlavorOption() = default;
-
-    LeptonFlavor
-    LeptonFlavorOption::value() const
-    {
+        // resolve the option to its enum value once, at construction time
         static const std::map<std::string, LeptonFlavor> map
         {
             { "e",   LeptonFlavor::electron },
@@ -306,9 +355,17 @@ namespace eos
 
         const auto i = map.find(_value);
         if (map.cend() == i)
-            throw InternalError("Invalid lepton flavor '" + _value + "' encountered in LeptonFlavorOption::value()");
+            throw InternalError("Invalid lepton flavor '" + _value + "' encountered in LeptonFlavorOption::LeptonFlavorOption()");
 
-        return i->second;
+        _flavor_value = i->second;
+    }
+
+    LeptonFlavorOption::~LeptonFlavorOption() = default;
+
+    LeptonFlavor
+    LeptonFlavorOption::value() const
+    {
+        return _flavor_value;
     }
 
     const std::string &
@@ -320,13 +377,7 @@ namespace eos
     QuarkFlavorOption::QuarkFlavorOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key) :
         SpecifiedOption(options, specifications, key)
     {
-    }
-
-    QuarkFlavorOption::~QuarkFlavorOption() = default;
-
-    QuarkFlavor
-    QuarkFlavorOption::value() const
-    {
+        // resolve the option to its enum value once, at construction time
         static const std::map<std::string, QuarkFlavor> map
         {
             { "u", QuarkFlavor::up      },
@@ -339,9 +390,17 @@ namespace eos
 
         const auto i = map.find(_value);
         if (map.cend() == i)
-            throw InternalError("Invalid quark flavor '" + _value + "' encountered in QuarkFlavorOption::value()");
+            throw InternalError("Invalid quark flavor '" + _value + "' encountered in QuarkFlavorOption::QuarkFlavorOption()");
 
-        return i->second;
+        _flavor_value = i->second;
+    }
+
+    QuarkFlavorOption::~QuarkFlavorOption() = default;
+
+    QuarkFlavor
+    QuarkFlavorOption::value() const
+    {
+        return _flavor_value;
     }
 
     const std::string &
@@ -353,13 +412,7 @@ namespace eos
     LightMesonOption::LightMesonOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key) :
         SpecifiedOption(options, specifications, key)
     {
-    }
-
-    LightMesonOption::~LightMesonOption() = default;
-
-    LightMeson
-    LightMesonOption::value() const
-    {
+        // resolve the option to its enum value once, at construction time
         static const std::map<std::string, LightMeson> map
         {
             { "pi^0",      LightMeson::pi0     },
@@ -376,9 +429,17 @@ namespace eos
 
         const auto i = map.find(_value);
         if (map.cend() == i)
-            throw InternalError("Invalid light meson '" + _value + "' encountered in LightMesonOption::value()");
+            throw InternalError("Invalid light meson '" + _value + "' encountered in LightMesonOption::LightMesonOption()");
 
-        return i->second;
+        _meson_value = i->second;
+    }
+
+    LightMesonOption::~LightMesonOption() = default;
+
+    LightMeson
+    LightMesonOption::value() const
+    {
+        return _meson_value;
     }
 
     const std::string &
@@ -110,14 +110,14 @@ namespace eos
             ///@name Iteration over our options
             ///@{
             struct OptionIteratorTag;
-            using OptionIterator = WrappedForwardIterator<OptionIteratorTag, const std::pair<const std::string, std::string>>;
+            using OptionIterator = WrappedForwardIterator<OptionIteratorTag, const std::pair<std::string, std::string>>;
 
             OptionIterator begin() const;
             OptionIterator end() const;
             ///@}
     };
 
-    extern template class WrappedForwardIterator<Options::OptionIteratorTag, const std::pair<const std::string, std::string>>;
+    extern template class WrappedForwardIterator<Options::OptionIteratorTag, const std::pair<std::string, std::string>>;
 
     /// Merge operator.
     Options operator+ (const Options & lhs, const Options & rhs);
@@ -176,6 +176,9 @@ namespace eos
     class LeptonFlavorOption :
         public SpecifiedOption
     {
+        private:
+            LeptonFlavor _flavor_value;
+
         public:
             LeptonFlavorOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key = "l");
             ~LeptonFlavorOption();
@@ -187,6 +190,9 @@ namespace eos
     class QuarkFlavorOption :
         public SpecifiedOption
     {
+        private:
+            QuarkFlavor _flavor_value;
+
         public:
             QuarkFlavorOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key = "q");
             ~QuarkFlavorOption();
@@ -198,6 +204,9 @@ namespace eos
     class LightMesonOption :
         public SpecifiedOption
     {
+        private:
+            LightMeson _meson_value;
+
         public:
             LightMesonOption(const Options & options, const std::vector<OptionSpecification> & specifications, const std::string & key);
             ~LightMesonOption();
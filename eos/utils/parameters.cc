@@ -21,6 +21,7 @@
 
 #include <config.h>
 
+#include <eos/utils/binary-io.hh>
 #include <eos/utils/cartesian-product.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
@@ -30,7 +31,10 @@
 #include <eos/utils/stringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
 #include <map>
 #include <random>
 #include <vector>
@@ -44,6 +48,8 @@
 
 #include <iostream>
 
+#include <unistd.h>
+
 namespace fs = boost::filesystem;
 
 namespace eos
@@ -191,14 +197,10 @@ namespace eos
     struct Parameter::Data :
         Parameter::Template
     {
-        double value, generator_value;
-
         Parameter::Id id;
 
         Data(const Parameter::Template & t, const Parameter::Id & i) :
             Parameter::Template(t),
-            value(t.central),
-            generator_value(0.0),
             id(i)
         {
         }
@@ -206,7 +208,64 @@ namespace eos
 
     struct Parameters::Data
     {
-        std::vector<Parameter::Data> data;
+        // hot data: the live values, generator values, and per-parameter modification
+        // generations are kept in contiguous arrays indexed by Parameter::Id, so that
+        // evaluation code reading many parameters gets cache-line locality, and
+        // whole-point updates reduce to copying the values array
+        std::vector<double> values;
+
+        std::vector<double> generator_values;
+
+        // generation in which each parameter's value was last modified; zero if never modified
+        std::vector<std::uint64_t> generations;
+
+        // cold data: names, ranges, and display metadata. The table is shared between
+        // clones with copy-on-write semantics: copying a Data object only copies the
+        // hot arrays, and the table is materialized on the first metadata modification.
+        std::shared_ptr<std::vector<Parameter::Data>> table;
+
+        // monotonically increasing counter, incremented upon each modification of any parameter's value
+        std::uint64_t generation = 0;
+
+        Data() :
+            table(new std::vector<Parameter::Data>)
+        {
+        }
+
+        // the copy shares the metadata table
+        Data(const Data &) = default;
+
+        // materialize our own copy of the metadata table before modifying it
+        void detach()
+        {
+            if (table.use_count() > 1)
+            {
+                table = std::make_shared<std::vector<Parameter::Data>>(*table);
+            }
+        }
+
+        const Parameter::Data & datum(const unsigned & index) const
+        {
+            return (*table)[index];
+        }
+
+        Parameter::Data & mutable_datum(const unsigned & index)
+        {
+            detach();
+
+            return (*table)[index];
+        }
+
+        // append a new parameter, keeping the hot arrays and the cold table in sync
+        void push_back(const Parameter::Data & d)
+        {
+            detach();
+
+            values.push_back(d.central);
+            generator_values.push_back(0.0);
+            generations.push_back(0);
+            table->push_back(d);
+        }
     };
 
     template <>
@@ -223,29 +282,41 @@ namespace eos
     };
     template class WrappedForwardIterator<Parameters::SectionIteratorTag, const ParameterSection &>;
 
+    namespace
+    {
+        const char parameter_cache_magic[8] = { 'E', 'O', 'S', 'P', 'C', '0', '1', '\n' };
+    }
+
     class ParameterDefaults :
         public InstantiationPolicy<ParameterDefaults, Singleton>
     {
         private:
             std::shared_ptr<Parameters::Data> _data;
 
-            std::map<QualifiedName, unsigned> _map;
+            // shared with Parameters instances with copy-on-write semantics
+            std::shared_ptr<std::map<QualifiedName, unsigned>> _map;
 
             std::vector<ParameterSection> _sections;
 
             ParameterDefaults() :
-                _data(new Parameters::Data)
+                _data(new Parameters::Data),
+                _map(new std::map<QualifiedName, unsigned>)
             {
-                _load_defaults();
+                const fs::path base = _base_path();
+
+                // prefer the precompiled binary store over parsing the YAML inputs
+                if (_try_load_cache(base))
+                    return;
+
+                _load_defaults(base);
+                _write_cache(base);
             }
 
             ~ParameterDefaults() = default;
 
-            void
-            _load_defaults()
+            static fs::path
+            _base_path()
             {
-                Context ctx("When loading parameter defaults");
-
                 fs::path base;
                 if (std::getenv("EOS_TESTS_PARAMETERS"))
                 {
@@ -272,7 +343,224 @@ namespace eos
                     throw InternalError("Expect '" + base.string() + " to be a directory");
                 }
 
-                unsigned idx = _data->data.size();
+                return base;
+            }
+
+            static fs::path
+            _cache_path()
+            {
+                if (std::getenv("EOS_DISABLE_PARAMETER_CACHE"))
+                    return fs::path();
+
+                if (std::getenv("XDG_CACHE_HOME"))
+                    return fs::path(std::getenv("XDG_CACHE_HOME")) / "eos" / "parameters.cache";
+
+                if (std::getenv("HOME"))
+                    return fs::path(std::getenv("HOME")) / ".cache" / "eos" / "parameters.cache";
+
+                return fs::path();
+            }
+
+            // Determine the number of YAML input files and the time of the most recent modification,
+            // which together invalidate the binary store.
+            static void
+            _scan_input_files(const fs::path & base, std::uint32_t & n_files, std::int64_t & newest)
+            {
+                n_files = 0;
+                newest  = 0;
+
+                for (fs::directory_iterator f(base), f_end ; f != f_end ; ++f)
+                {
+                    auto file_path = f->path();
+
+                    if (! fs::is_regular_file(status(file_path)))
+                        continue;
+
+                    if (".yaml" != file_path.extension().string())
+                        continue;
+
+                    ++n_files;
+                    newest = std::max<std::int64_t>(newest, fs::last_write_time(file_path));
+                }
+            }
+
+            bool
+            _try_load_cache(const fs::path & base)
+            {
+                const fs::path cache = _cache_path();
+
+                if (cache.empty() || ! fs::is_regular_file(fs::status(cache)))
+                    return false;
+
+                try
+                {
+                    // map the cache read-only; concurrent processes on the same node
+                    // then share one copy of its pages
+                    binary_io::MappedFile      mapping(cache.string());
+                    binary_io::MappedInputStream in(mapping);
+                    in.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
+
+                    char magic[sizeof(parameter_cache_magic)];
+                    in.read(magic, sizeof(magic));
+                    if (! std::equal(std::begin(magic), std::end(magic), std::begin(parameter_cache_magic)))
+                        return false;
+
+                    // the cache is stale if the YAML inputs changed since it was written
+                    std::uint32_t n_files;
+                    std::int64_t  newest;
+                    _scan_input_files(base, n_files, newest);
+
+                    if ((binary_io::read<std::uint32_t>(in) != n_files) || (binary_io::read<std::int64_t>(in) != newest))
+                        return false;
+
+                    // parameter data
+                    const std::uint32_t n_data = binary_io::read<std::uint32_t>(in);
+                    _data->table->reserve(n_data);
+                    for (std::uint32_t idx = 0 ; idx < n_data ; ++idx)
+                    {
+                        QualifiedName name(binary_io::read_string(in));
+                        std::string latex = binary_io::read_string(in);
+                        Unit unit = Unit::FromId(static_cast<Unit::Id>(binary_io::read<std::int32_t>(in)));
+                        double min     = binary_io::read<double>(in);
+                        double central = binary_io::read<double>(in);
+                        double max     = binary_io::read<double>(in);
+
+                        _data->push_back(Parameter::Data(Parameter::Template { name, min, central, max, latex, unit }, idx));
+                    }
+
+                    // name -> index map, including aliases
+                    const std::uint32_t n_map = binary_io::read<std::uint32_t>(in);
+                    for (std::uint32_t i = 0 ; i < n_map ; ++i)
+                    {
+                        QualifiedName name(binary_io::read_string(in));
+                        const std::uint32_t idx = binary_io::read<std::uint32_t>(in);
+                        _map->emplace(name, idx);
+                    }
+
+                    // sections and groups
+                    const std::uint32_t n_sections = binary_io::read<std::uint32_t>(in);
+                    for (std::uint32_t i = 0 ; i < n_sections ; ++i)
+                    {
+                        std::string section_title = binary_io::read_string(in);
+                        std::string section_desc  = binary_io::read_string(in);
+
+                        std::vector<ParameterGroup> section_groups;
+                        const std::uint32_t n_groups = binary_io::read<std::uint32_t>(in);
+                        for (std::uint32_t j = 0 ; j < n_groups ; ++j)
+                        {
+                            std::string group_title = binary_io::read_string(in);
+                            std::string group_desc  = binary_io::read_string(in);
+
+                            std::vector<Parameter> group_parameters;
+                            const std::uint32_t n_parameters = binary_io::read<std::uint32_t>(in);
+                            for (std::uint32_t k = 0 ; k < n_parameters ; ++k)
+                            {
+                                group_parameters.push_back(Parameter(_data, binary_io::read<std::uint32_t>(in)));
+                            }
+
+                            section_groups.push_back(ParameterGroup(new Implementation<ParameterGroup>(group_title, group_desc, std::move(group_parameters))));
+                        }
+
+                        _sections.push_back(ParameterSection(new Implementation<ParameterSection>(section_title, section_desc, std::move(section_groups))));
+                    }
+
+                    return true;
+                }
+                catch (...)
+                {
+                    // fall back to parsing the YAML inputs
+                    _data.reset(new Parameters::Data);
+                    _map.reset(new std::map<QualifiedName, unsigned>);
+                    _sections.clear();
+
+                    return false;
+                }
+            }
+
+            void
+            _write_cache(const fs::path & base) const
+            {
+                const fs::path cache = _cache_path();
+
+                if (cache.empty())
+                    return;
+
+                try
+                {
+                    fs::create_directories(cache.parent_path());
+
+                    // write to a temporary file first, so that concurrent processes never observe
+                    // a partially written cache
+                    const fs::path tmp = cache.string() + ".tmp." + stringify(::getpid());
+
+                    {
+                        std::ofstream out(tmp.string(), std::ios::binary | std::ios::trunc);
+                        out.exceptions(std::ios::badbit | std::ios::failbit);
+
+                        out.write(parameter_cache_magic, sizeof(parameter_cache_magic));
+
+                        std::uint32_t n_files;
+                        std::int64_t  newest;
+                        _scan_input_files(base, n_files, newest);
+                        binary_io::write<std::uint32_t>(out, n_files);
+                        binary_io::write<std::int64_t>(out, newest);
+
+                        binary_io::write<std::uint32_t>(out, _data->table->size());
+                        for (const auto & d : *_data->table)
+                        {
+                            binary_io::write_string(out, d.name.full());
+                            binary_io::write_string(out, d.latex);
+                            binary_io::write<std::int32_t>(out, static_cast<std::int32_t>(d.unit.id()));
+                            binary_io::write<double>(out, d.min);
+                            binary_io::write<double>(out, d.central);
+                            binary_io::write<double>(out, d.max);
+                        }
+
+                        binary_io::write<std::uint32_t>(out, _map->size());
+                        for (const auto & [name, idx] : *_map)
+                        {
+                            binary_io::write_string(out, name.full());
+                            binary_io::write<std::uint32_t>(out, idx);
+                        }
+
+                        binary_io::write<std::uint32_t>(out, _sections.size());
+                        for (const auto & section : _sections)
+                        {
+                            binary_io::write_string(out, section.name());
+                            binary_io::write_string(out, section.description());
+
+                            std::vector<ParameterGroup> groups(section.begin(), section.end());
+                            binary_io::write<std::uint32_t>(out, groups.size());
+                            for (const auto & group : groups)
+                            {
+                                binary_io::write_string(out, group.name());
+                                binary_io::write_string(out, group.description());
+
+                                std::vector<Parameter> parameters(group.begin(), group.end());
+                                binary_io::write<std::uint32_t>(out, parameters.size());
+                                for (const auto & parameter : parameters)
+                                {
+                                    binary_io::write<std::uint32_t>(out, parameter.id());
+                                }
+                            }
+                        }
+                    }
+
+                    fs::rename(tmp, cache);
+                }
+                catch (...)
+                {
+                    Log::instance()->message("ParameterDefaults", ll_informational)
+                        << "Could not write the binary parameter cache to '" << cache.string() << "'";
+                }
+            }
+
+            void
+            _load_defaults(const fs::path & base)
+            {
+                Context ctx("When loading parameter defaults");
+
+                unsigned idx = _data->table->size();
                 for (fs::directory_iterator f(base), f_end ; f != f_end ; ++f)
                 {
                     auto file_path = f->path();
@@ -284,7 +572,7 @@ namespace eos
                         continue;
 
                     std::string file = file_path.string();
-                    Context ctx("When parsing parameter file '" + file + "'");
+                    Context ctx([&] () { return "When parsing parameter file '" + file + "'"; });
 
                     try
                     {
@@ -300,7 +588,7 @@ namespace eos
                             throw ParameterInputFileNodeError(file, "title", "is not a scalar");
                         std::string section_title = section_title_node.as<std::string>();
 
-                        Context ctx("When parsing metadata for section '" + section_title + "'");
+                        Context ctx([&] () { return "When parsing metadata for section '" + section_title + "'"; });
 
                         auto section_desc_node = root_node["description"];
                         if (! section_desc_node)
@@ -327,7 +615,7 @@ namespace eos
                                 throw ParameterInputFileNodeError(file, "title", "is not a scalar");
                             std::string group_title = group_title_node.as<std::string>();
 
-                            Context ctx("When parsing metadata for group '" + group_title + "'");
+                            Context ctx([&] () { return "When parsing metadata for group '" + group_title + "'"; });
 
                             auto group_desc_node = group_node["description"];
                             if (! group_desc_node)
@@ -346,7 +634,7 @@ namespace eos
                             for (auto && p : group_parameters_node)
                             {
                                 std::string name = p.first.Scalar();
-                                Context ctx("When parsing metadata for parameter '" + name + "'");
+                                Context ctx([&] () { return "When parsing metadata for parameter '" + name + "'"; });
 
                                 double central, min, max;
 
@@ -411,7 +699,7 @@ namespace eos
 
                                 if (name.find("%") == std::string::npos) // The parameter is not templated
                                 {
-                                    if (_map.end() != _map.find(name))
+                                    if (_map->end() != _map->find(name))
                                     {
                                         throw ParameterInputDuplicateError(file, name);
                                     }
@@ -424,11 +712,11 @@ namespace eos
                                         latex = latex_node.as<std::string>();
                                     }
 
-                                    _data->data.push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex, unit }, idx));
-                                    _map[name] = idx;
+                                    _data->push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex, unit }, idx));
+                                    (*_map)[name] = idx;
                                     for (auto && alias_of_item : alias_of_list)
                                     {
-                                        _map[alias_of_item] = idx;
+                                        (*_map)[alias_of_item] = idx;
                                     }
                                     group_parameters.push_back(Parameter(_data, idx));
 
@@ -507,13 +795,13 @@ namespace eos
 
                                             QualifiedName qn(templated_name.str());
 
-                                            if (_map.end() != _map.find(qn))
+                                            if (_map->end() != _map->find(qn))
                                             {
                                                 throw ParameterInputDuplicateError(file, qn.str());
                                             }
 
-                                            _data->data.push_back(Parameter::Data(Parameter::Template { qn, min, central, max, templated_latex.str(), unit }, idx));
-                                            _map[templated_name.str()] = idx;
+                                            _data->push_back(Parameter::Data(Parameter::Template { qn, min, central, max, templated_latex.str(), unit }, idx));
+                                            (*_map)[templated_name.str()] = idx;
                                             group_parameters.push_back(Parameter(_data, idx));
 
                                             ++idx;
@@ -533,6 +821,16 @@ namespace eos
                 }
             }
 
+            // materialize our own copy of the name map before modifying it; Parameters
+            // instances created earlier keep the map they were sharing
+            void _detach_map()
+            {
+                if (_map.use_count() > 1)
+                {
+                    _map = std::make_shared<std::map<QualifiedName, unsigned>>(*_map);
+                }
+            }
+
         public:
             friend class InstantiationPolicy<ParameterDefaults, Singleton>;
 
@@ -541,7 +839,7 @@ namespace eos
                 return *_data;
             }
 
-            const std::map<QualifiedName, unsigned> & map() const
+            const std::shared_ptr<std::map<QualifiedName, unsigned>> & map() const
             {
                 return _map;
             }
@@ -553,17 +851,21 @@ namespace eos
 
             Parameter::Id declare(const QualifiedName & key, const Parameter::Template & value)
             {
-                unsigned idx = _data->data.size();
-                _data->data.push_back(Parameter::Data{ value, idx });
-                _map[key] = idx;
+                _detach_map();
+
+                unsigned idx = _data->table->size();
+                _data->push_back(Parameter::Data{ value, idx });
+                (*_map)[key] = idx;
 
                 return idx;
             }
 
             void redirect(const QualifiedName & name, const Parameter::Id & id)
             {
-                auto i = _map.find(name);
-                if (_map.end() == i)
+                _detach_map();
+
+                auto i = _map->find(name);
+                if (_map->end() == i)
                     throw UnknownParameterError(name);
 
                 i->second = id;
@@ -575,29 +877,64 @@ namespace eos
     {
         std::shared_ptr<Parameters::Data> parameters_data;
 
-        std::map<QualifiedName, unsigned> parameters_map;
+        // shared between clones with copy-on-write semantics
+        std::shared_ptr<std::map<QualifiedName, unsigned>> parameters_map;
 
+        // Parameter handles for iteration; built on demand, since most clones
+        // never iterate
         std::vector<Parameter> parameters;
 
+        // transaction snapshot of the hot arrays; the storage is reused across
+        // transactions, so steady-state transactions do not allocate
+        bool transaction_active;
+
+        std::uint64_t transaction_generation;
+
+        std::vector<double> transaction_values;
+
+        std::vector<double> transaction_generator_values;
+
         Implementation() :
             parameters_data(new Parameters::Data(ParameterDefaults::instance()->data())),
-            parameters_map(ParameterDefaults::instance()->map())
+            parameters_map(ParameterDefaults::instance()->map()),
+            transaction_active(false),
+            transaction_generation(0)
         {
-            for (auto i = parameters_data->data.begin(), i_end = parameters_data->data.end() ; i != i_end ; ++i)
-            {
-                parameters.push_back(Parameter(parameters_data, i->id));
-            }
         }
 
+        // cloning copies the hot value arrays and shares the metadata table and
+        // the name map, making clones O(live parameters' values) rather than
+        // O(full parameter table); an active transaction does not carry over
         Implementation(const Implementation & other) :
             parameters_data(new Parameters::Data(*other.parameters_data)),
-            parameters_map(other.parameters_map)
+            parameters_map(other.parameters_map),
+            transaction_active(false),
+            transaction_generation(0)
+        {
+        }
+
+        // materialize our own copy of the name map before modifying it
+        void detach_map()
         {
-            parameters.reserve(other.parameters.size());
-            for (unsigned i = 0 ; i != parameters.size() ; ++i)
+            if (parameters_map.use_count() > 1)
             {
-                parameters.push_back(Parameter(parameters_data, i));
+                parameters_map = std::make_shared<std::map<QualifiedName, unsigned>>(*parameters_map);
+            }
+        }
+
+        std::vector<Parameter> & handles()
+        {
+            if (parameters.size() != parameters_data->values.size())
+            {
+                parameters.clear();
+                parameters.reserve(parameters_data->values.size());
+                for (unsigned i = 0 ; i < parameters_data->values.size() ; ++i)
+                {
+                    parameters.push_back(Parameter(parameters_data, i));
+                }
             }
+
+            return parameters;
         }
 
         void
@@ -677,28 +1014,29 @@ namespace eos
                         unit = Unit(unit_node.as<std::string>());
                     }
 
-                    auto i = parameters_map.find(name);
-                    if (parameters_map.end() != i)
+                    auto i = parameters_map->find(name);
+                    if (parameters_map->end() != i)
                     {
                         Log::instance()->message("[parameters.override]", ll_informational)
                             << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
-                        parameters_data->data[i->second].value = central;
+                        parameters_data->values[i->second] = central;
+                        parameters_data->generations[i->second] = ++parameters_data->generation;
                         if (has_min)
                         {
-                            parameters_data->data[i->second].min = min;
+                            parameters_data->mutable_datum(i->second).min = min;
                         }
                         if (has_max)
                         {
-                            parameters_data->data[i->second].max = max;
+                            parameters_data->mutable_datum(i->second).max = max;
                         }
                         if (has_latex)
                         {
-                            parameters_data->data[i->second].latex = latex;
+                            parameters_data->mutable_datum(i->second).latex = latex;
                         }
                         if (has_unit)
                         {
-                            parameters_data->data[i->second].unit = unit;
+                            parameters_data->mutable_datum(i->second).unit = unit;
                         }
                     }
                     else
@@ -715,10 +1053,10 @@ namespace eos
                             max = central;
                         }
 
-                        auto idx = parameters_data->data.size();
-                        parameters_data->data.push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex, unit }, idx));
-                        parameters_map[name] = idx;
-                        parameters.push_back(Parameter(parameters_data, idx));
+                        auto idx = parameters_data->table->size();
+                        parameters_data->push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex, unit }, idx));
+                        detach_map();
+                        (*parameters_map)[name] = idx;
                     }
                 }
             }
@@ -747,9 +1085,9 @@ namespace eos
     Parameter
     Parameters::operator[] (const QualifiedName & name) const
     {
-        auto i(_imp->parameters_map.find(name));
+        auto i(_imp->parameters_map->find(name));
 
-        if (_imp->parameters_map.end() == i)
+        if (_imp->parameters_map->end() == i)
             throw UnknownParameterError(name);
 
         return Parameter(_imp->parameters_data, i->second);
@@ -758,10 +1096,10 @@ namespace eos
     Parameter
     Parameters::operator[] (const Parameter::Id & id) const
     {
-        if (id >= _imp->parameters.size())
+        if (id >= _imp->parameters_data->values.size())
             throw InternalError("Parameters::operator[] (Parameter::Id): invalid id '" + stringify(id) + "'");
 
-        return _imp->parameters[id];
+        return Parameter(_imp->parameters_data, id);
     }
 
     Parameter::Id
@@ -774,8 +1112,8 @@ namespace eos
     Parameters::declare_and_insert(const QualifiedName & name, const std::string & latex, Unit unit, const double & value, const double & min, const double & max)
     {
         // is the parameter already available?
-        auto i(_imp->parameters_map.find(name));
-        if (_imp->parameters_map.end() != i)
+        auto i(_imp->parameters_map->find(name));
+        if (_imp->parameters_map->end() != i)
         {
             Log::instance()->message("[parameters.declare_and_insert]", ll_error)
                 << "Parameter '" << name << "' is already declared, returning existing instance; check your code for conflicting duplicate declarations";
@@ -787,13 +1125,13 @@ namespace eos
         ParameterDefaults::instance()->declare(name, Parameter::Template { name, min, value, max, latex, unit });
 
         // ... and insert it into this parameter set ...
-        unsigned idx = _imp->parameters.size();
-        _imp->parameters_data->data.push_back(Parameter::Data(Parameter::Template { name, min, value, max, latex, unit }, idx));
-        _imp->parameters_map[name] = idx;
-        _imp->parameters.push_back(Parameter(_imp->parameters_data, idx));
+        unsigned idx = _imp->parameters_data->table->size();
+        _imp->parameters_data->push_back(Parameter::Data(Parameter::Template { name, min, value, max, latex, unit }, idx));
+        _imp->detach_map();
+        (*_imp->parameters_map)[name] = idx;
 
         // ... before returning it
-        return _imp->parameters.back();
+        return Parameter(_imp->parameters_data, idx);
     }
 
     void
@@ -809,8 +1147,10 @@ namespace eos
         ParameterDefaults::instance()->redirect(name, id);
 
         // ... and apply the change to this parameter set ...
-        auto i = _imp->parameters_map.find(name);
-        if (_imp->parameters_map.end() == i)
+        _imp->detach_map();
+
+        auto i = _imp->parameters_map->find(name);
+        if (_imp->parameters_map->end() == i)
             throw UnknownParameterError(name);
 
         i->second = id;
@@ -819,20 +1159,118 @@ namespace eos
     void
     Parameters::set(const QualifiedName & name, const double & value)
     {
-        auto i(_imp->parameters_map.find(name));
+        auto i(_imp->parameters_map->find(name));
 
-        if (_imp->parameters_map.end() == i)
+        if (_imp->parameters_map->end() == i)
             throw UnknownParameterError(name);
 
-        _imp->parameters_data->data[i->second].value = value;
+        _imp->parameters_data->values[i->second] = value;
+        _imp->parameters_data->generations[i->second] = ++_imp->parameters_data->generation;
+    }
+
+    void
+    Parameters::update(const Parameters & rhs)
+    {
+        auto & data = *_imp->parameters_data;
+        const auto & rhs_data = *rhs._imp->parameters_data;
+
+        if (data.values.size() != rhs_data.values.size())
+            throw InternalError("Parameters::update(): parameter sets descend from different declarations");
+
+        // copy the contiguous hot arrays in one go; the cold metadata is left untouched
+        data.values = rhs_data.values;
+        data.generator_values = rhs_data.generator_values;
+        data.generations.assign(data.generations.size(), ++data.generation);
+    }
+
+    double *
+    Parameters::values_data()
+    {
+        return _imp->parameters_data->values.data();
+    }
+
+    std::size_t
+    Parameters::values_size() const
+    {
+        return _imp->parameters_data->values.size();
+    }
+
+    void
+    Parameters::commit()
+    {
+        auto & data = *_imp->parameters_data;
+        data.generations.assign(data.generations.size(), ++data.generation);
+    }
+
+    std::uint64_t
+    Parameters::generation() const
+    {
+        return _imp->parameters_data->generation;
+    }
+
+    void
+    Parameters::begin_transaction()
+    {
+        if (_imp->transaction_active)
+            throw InternalError("Parameters::begin_transaction(): a transaction is already active");
+
+        const auto & data = *_imp->parameters_data;
+
+        _imp->transaction_values = data.values;
+        _imp->transaction_generator_values = data.generator_values;
+        _imp->transaction_generation = data.generation;
+        _imp->transaction_active = true;
+    }
+
+    void
+    Parameters::commit_transaction()
+    {
+        if (! _imp->transaction_active)
+            throw InternalError("Parameters::commit_transaction(): no transaction is active");
+
+        _imp->transaction_active = false;
+    }
+
+    void
+    Parameters::rollback_transaction()
+    {
+        if (! _imp->transaction_active)
+            throw InternalError("Parameters::rollback_transaction(): no transaction is active");
+
+        auto & data = *_imp->parameters_data;
+
+        // restore every parameter modified since begin_transaction(), and mark
+        // exactly those parameters as modified once more: caches may have
+        // evaluated at the discarded point and must re-read them. The generation
+        // counter stays monotonic for the same reason.
+        const std::size_t n = std::min(data.values.size(), _imp->transaction_values.size());
+        std::uint64_t stamp = 0;
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (data.generations[i] <= _imp->transaction_generation)
+                continue;
+
+            if (0 == stamp)
+            {
+                stamp = ++data.generation;
+            }
+
+            data.values[i] = _imp->transaction_values[i];
+            data.generations[i] = stamp;
+        }
+
+        // generator values carry no generation stamps; restore them wholesale
+        std::copy(_imp->transaction_generator_values.cbegin(), _imp->transaction_generator_values.cbegin() + n, data.generator_values.begin());
+
+        _imp->transaction_active = false;
     }
 
     bool
     Parameters::has(const QualifiedName & name)
     {
-        auto i(_imp->parameters_map.find(name));
+        auto i(_imp->parameters_map->find(name));
 
-        if (_imp->parameters_map.end() == i)
+        if (_imp->parameters_map->end() == i)
             return false;
         else return true;
     }
@@ -840,13 +1278,13 @@ namespace eos
     Parameters::Iterator
     Parameters::begin() const
     {
-        return Parameters::Iterator(_imp->parameters.begin());
+        return Parameters::Iterator(_imp->handles().begin());
     }
 
     Parameters::Iterator
     Parameters::end() const
     {
-        return Parameters::Iterator(_imp->parameters.end());
+        return Parameters::Iterator(_imp->handles().end());
     }
 
     Parameters::SectionIterator
@@ -905,31 +1343,32 @@ namespace eos
 
     Parameter::operator double () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::operator() () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::evaluate() const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::evaluate_generator() const
     {
-        return _parameters_data->data[_index].generator_value;
+        return _parameters_data->generator_values[_index];
     }
 
     const Parameter &
     Parameter::operator= (const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->values[_index] = value;
+        _parameters_data->generations[_index] = ++_parameters_data->generation;
 
         return *this;
     }
@@ -937,67 +1376,74 @@ namespace eos
     void
     Parameter::set(const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->values[_index] = value;
+        _parameters_data->generations[_index] = ++_parameters_data->generation;
     }
 
     void
     Parameter::set_generator(const double & value)
     {
-        _parameters_data->data[_index].generator_value = value;
+        _parameters_data->generator_values[_index] = value;
     }
 
     const double &
     Parameter::central() const
     {
-        return _parameters_data->data[_index].central;
+        return _parameters_data->datum(_index).central;
     }
 
     const double &
     Parameter::max() const
     {
-        return _parameters_data->data[_index].max;
+        return _parameters_data->datum(_index).max;
     }
 
     void
     Parameter::set_max(const double & value)
     {
-        _parameters_data->data[_index].max = value;
+        _parameters_data->mutable_datum(_index).max = value;
     }
 
     const double &
     Parameter::min() const
     {
-        return _parameters_data->data[_index].min;
+        return _parameters_data->datum(_index).min;
     }
 
     void
     Parameter::set_min(const double & value)
     {
-        _parameters_data->data[_index].min = value;
+        _parameters_data->mutable_datum(_index).min = value;
     }
 
     const std::string &
     Parameter::name() const
     {
-        return _parameters_data->data[_index].name.str();
+        return _parameters_data->datum(_index).name.str();
     }
 
     const std::string &
     Parameter::latex() const
     {
-        return _parameters_data->data[_index].latex;
+        return _parameters_data->datum(_index).latex;
     }
 
     Unit
     Parameter::unit() const
     {
-        return _parameters_data->data[_index].unit;
+        return _parameters_data->datum(_index).unit;
     }
 
     Parameter::Id
     Parameter::id() const
     {
-        return _parameters_data->data[_index].id;
+        return _parameters_data->datum(_index).id;
+    }
+
+    std::uint64_t
+    Parameter::generation() const
+    {
+        return _parameters_data->generations[_index];
     }
 
     /* ParameterUser */
@@ -1040,11 +1486,38 @@ namespace eos
     }
 
     UsedParameter::UsedParameter(const Parameter & parameter, ParameterUser & user) :
-        Parameter(parameter)
+        Parameter(parameter),
+        _cached_value(parameter.evaluate()),
+        _cached_generation(_parameters_data->generation)
     {
         user.uses(parameter.id());
     }
 
+    UsedParameter::operator double () const
+    {
+        const std::uint64_t generation = _parameters_data->generation;
+
+        if (generation != _cached_generation)
+        {
+            _cached_value      = _parameters_data->values[_index];
+            _cached_generation = generation;
+        }
+
+        return _cached_value;
+    }
+
+    double
+    UsedParameter::operator() () const
+    {
+        return UsedParameter::operator double ();
+    }
+
+    double
+    UsedParameter::evaluate() const
+    {
+        return UsedParameter::operator double ();
+    }
+
     UnknownParameterError::UnknownParameterError(const QualifiedName & name) throw () :
         Exception("Unknown parameter: '" + name.full() + "'")
     {
@@ -29,6 +29,8 @@
 #include <eos/utils/units.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <limits>
 
@@ -215,12 +217,86 @@ namespace eos
              */
             void set(const QualifiedName & name, const double & value);
 
+            /*!
+             * Adopt the numeric values of all parameters from another set of parameters.
+             *
+             * Both sets must descend from the same parameter declarations. The values
+             * are copied as one contiguous block, which makes this the preferred way
+             * to move a sampler to a new parameter point; ranges and metadata are
+             * left untouched.
+             *
+             * @param rhs  The set of parameters whose numeric values shall be adopted.
+             */
+            void update(const Parameters & rhs);
+
+            /*!
+             * Expose the contiguous array of parameter values, indexed by Parameter::Id.
+             *
+             * Writing through this pointer bypasses the modification tracking; a bulk
+             * write must therefore be followed by a call to commit() before any
+             * dependent quantity is evaluated.
+             */
+            double * values_data();
+
+            /// Retrieve the number of entries in the values array.
+            std::size_t values_size() const;
+
+            /*!
+             * Record an out-of-band modification of the values array.
+             *
+             * Conservatively marks every parameter as modified in a new generation,
+             * exactly as update() does; pair with values_data() to update a whole
+             * parameter point in one block write.
+             */
+            void commit();
+
             /*!
              * Verify if a parameter with a given name exists.
              *
              * @param name  The name to be checked against the known parameters.
              */
             bool has(const QualifiedName & name);
+            ///@}
+
+            ///@name Transactions
+            ///@{
+            /*!
+             * Begin a transaction on this parameter set.
+             *
+             * Snapshots the current numeric and generator values, so that a
+             * subsequent rollback_transaction() can restore them. At most one
+             * transaction can be active at any time; beginning a second one
+             * raises an InternalError.
+             */
+            void begin_transaction();
+
+            /*!
+             * Commit the active transaction, keeping all modifications since
+             * begin_transaction().
+             */
+            void commit_transaction();
+
+            /*!
+             * Roll back the active transaction.
+             *
+             * Restores the numeric and generator values of every parameter
+             * modified since begin_transaction(), and marks exactly those
+             * parameters as modified in a new generation; downstream caches
+             * thereby re-read only the parameters the transaction touched,
+             * rather than every parameter a sampler would rewrite by hand.
+             * Parameters declared while the transaction was active are
+             * retained.
+             */
+            void rollback_transaction();
+
+            /*!
+             * Retrieve the current generation of this parameter set.
+             *
+             * The generation is incremented upon each modification of any parameter's
+             * numeric value. It can be compared against Parameter::generation() to
+             * determine which parameters changed since a given point in time.
+             */
+            std::uint64_t generation() const;
 
             /*!
              * Retrieve a parameter's Parameter object by name.
@@ -265,6 +341,12 @@ namespace eos
             struct Data;
             struct Template;
 
+            ///@name Basic Functions
+            ///@{
+            Parameter(const std::shared_ptr<Parameters::Data> & imp, unsigned index);
+            ///@}
+
+        protected:
             ///@name Internal Data
             ///@{
             std::shared_ptr<Parameters::Data> _parameters_data;
@@ -272,11 +354,6 @@ namespace eos
             unsigned _index;
             ///@}
 
-            ///@name Basic Functions
-            ///@{
-            Parameter(const std::shared_ptr<Parameters::Data> & imp, unsigned index);
-            ///@}
-
         public:
             friend class Parameters;
             friend class ParameterDefaults;
@@ -346,6 +423,13 @@ namespace eos
             /// Retrieve the Parameter's id.
             Id id() const;
 
+            /*!
+             * Retrieve the generation in which the Parameter's numeric value was last modified.
+             *
+             * Returns zero if the value has never been modified.
+             */
+            std::uint64_t generation() const;
+
             /// Retrieve the Parameter's name as a LaTeX representation
             const std::string & latex() const;
 
@@ -459,10 +543,24 @@ namespace eos
 
     /*!
      * Wrapper class to automate usage tracking of Parameter objects.
+     *
+     * Reads go through an inline cache of the numeric value, guarded by the
+     * parameter set's generation counter: the shared parameter table is only
+     * dereferenced when some parameter's value has changed since the last
+     * read. Hot amplitude code reading the same parameters many times per
+     * evaluation thereby hits a value local to the object.
      */
     class UsedParameter :
         public Parameter
     {
+        private:
+            ///@name Inline Value Cache
+            ///@{
+            mutable double _cached_value;
+
+            mutable std::uint64_t _cached_generation;
+            ///@}
+
         public:
             /*!
              * Constructor.
@@ -475,6 +573,15 @@ namespace eos
             UsedParameter(const Parameter & parameter, ParameterUser & user);
 
             using Parameter::operator=;
+
+            ///@name Access to the Numeric Value through the Inline Cache
+            ///@{
+            virtual operator double () const;
+
+            virtual double operator() () const;
+
+            virtual double evaluate() const;
+            ///@}
     };
 
     struct ParameterDescription
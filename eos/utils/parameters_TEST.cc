@@ -87,6 +87,24 @@ class ParametersTest :
                 TEST_CHECK_EQUAL(m_c_clone(), m_c_clone.central());
             }
 
+            // Copy-on-write cloning of the metadata table
+            {
+                Parameters original = Parameters::Defaults();
+                Parameters clone = original.clone();
+
+                // the clone shares the metadata table with the original
+                TEST_CHECK_EQUAL(&original["mass::c"].latex(), &clone["mass::c"].latex());
+
+                // modifying metadata materializes the clone's own table ...
+                const double original_min = original["mass::c"].min();
+                clone["mass::c"].set_min(0.5);
+                TEST_CHECK(&original["mass::c"].latex() != &clone["mass::c"].latex());
+                TEST_CHECK_EQUAL(clone["mass::c"].min(), 0.5);
+
+                // ... and leaves the original untouched
+                TEST_CHECK_EQUAL(original["mass::c"].min(), original_min);
+            }
+
             // Parameters::has
             {
                 Parameters p = Parameters::Defaults();
@@ -161,3 +179,119 @@ class ParametersTest :
             }
         }
 } parameters_test;
+
+class ParameterGenerationTest :
+    public TestCase
+{
+    public:
+        ParameterGenerationTest() :
+            TestCase("parameter_generation_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+
+            Parameter p_b = p["mass::b(MSbar)"];
+            Parameter p_c = p["mass::c"];
+
+            // a pristine parameter set has generation zero throughout
+            TEST_CHECK_EQUAL(p.generation(),     0u);
+            TEST_CHECK_EQUAL(p_b.generation(),   0u);
+            TEST_CHECK_EQUAL(p_c.generation(),   0u);
+
+            // modifying a parameter bumps both its own and the set's generation
+            p_b = 4.30;
+            TEST_CHECK_EQUAL(p.generation(),     1u);
+            TEST_CHECK_EQUAL(p_b.generation(),   1u);
+            TEST_CHECK_EQUAL(p_c.generation(),   0u);
+
+            p_c.set(1.30);
+            TEST_CHECK_EQUAL(p.generation(),     2u);
+            TEST_CHECK_EQUAL(p_b.generation(),   1u);
+            TEST_CHECK_EQUAL(p_c.generation(),   2u);
+
+            // modifications via Parameters::set are tracked, too
+            p.set("mass::b(MSbar)", 4.25);
+            TEST_CHECK_EQUAL(p.generation(),     3u);
+            TEST_CHECK_EQUAL(p_b.generation(),   3u);
+
+            // a clone carries its own, independent generation counters
+            Parameters q = p.clone();
+            TEST_CHECK_EQUAL(q.generation(),     3u);
+            q["mass::c"] = 1.27;
+            TEST_CHECK_EQUAL(q.generation(),     4u);
+            TEST_CHECK_EQUAL(p.generation(),     3u);
+
+            // a whole-point update adopts all values and bumps the generation
+            p.update(q);
+            TEST_CHECK_NEARLY_EQUAL(p["mass::c"].evaluate(), 1.27, 1e-12);
+            TEST_CHECK_EQUAL(p.generation(),     4u);
+            TEST_CHECK_EQUAL(p_b.generation(),   4u);
+            TEST_CHECK_EQUAL(p_c.generation(),   4u);
+
+            // out-of-band writes through the raw values array are published by commit()
+            double * values = p.values_data();
+            TEST_CHECK_EQUAL(values[p_b.id()], p_b.evaluate());
+            values[p_b.id()] = 4.18;
+            p.commit();
+            TEST_CHECK_EQUAL(p_b.evaluate(),     4.18);
+            TEST_CHECK_EQUAL(p.generation(),     5u);
+            TEST_CHECK_EQUAL(p_b.generation(),   5u);
+            TEST_CHECK_EQUAL(p_c.generation(),   5u);
+        }
+} parameter_generation_test;
+
+class ParameterTransactionTest :
+    public TestCase
+{
+    public:
+        ParameterTransactionTest() :
+            TestCase("parameter_transaction_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+
+            Parameter p_b = p["mass::b(MSbar)"];
+            Parameter p_c = p["mass::c"];
+
+            p_b = 4.30;
+            p_c = 1.30;
+            const unsigned generation_before = p.generation();
+
+            // a committed transaction keeps all modifications
+            p.begin_transaction();
+            p_b = 4.20;
+            p.commit_transaction();
+            TEST_CHECK_NEARLY_EQUAL(p_b.evaluate(), 4.20, 1e-12);
+
+            // a rolled-back transaction restores the values of the touched
+            // parameters, and marks exactly those as modified once more
+            p.begin_transaction();
+            p_b = 4.10;
+            p_b.set_generator(0.75);
+            TEST_CHECK_NEARLY_EQUAL(p_b.evaluate(), 4.10, 1e-12);
+            p.rollback_transaction();
+            TEST_CHECK_NEARLY_EQUAL(p_b.evaluate(),           4.20, 1e-12);
+            TEST_CHECK_NEARLY_EQUAL(p_b.evaluate_generator(), 0.00, 1e-12);
+            TEST_CHECK(p_b.generation() > generation_before);
+            TEST_CHECK_EQUAL(p_c.generation(), generation_before);
+
+            // a rollback without modifications leaves the generation untouched
+            const unsigned generation_after = p.generation();
+            p.begin_transaction();
+            p.rollback_transaction();
+            TEST_CHECK_EQUAL(p.generation(), generation_after);
+
+            // misuse raises errors
+            p.begin_transaction();
+            TEST_CHECK_THROWS(InternalError, p.begin_transaction());
+            p.commit_transaction();
+            TEST_CHECK_THROWS(InternalError, p.commit_transaction());
+            TEST_CHECK_THROWS(InternalError, p.rollback_transaction());
+        }
+} parameter_transaction_test;
@@ -0,0 +1,152 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_PHILOX_RNG_HH
+#define EOS_GUARD_EOS_UTILS_PHILOX_RNG_HH 1
+
+#include <array>
+#include <cstdint>
+
+namespace eos
+{
+    /*!
+     * Counter-based pseudo-random number generator, using the Philox-4x32-10
+     * algorithm [SMDS:2011A].
+     *
+     * Unlike a stateful generator, the n-th draw is a pure function of the
+     * seed, the stream identifier, and n. This makes parallel sampling both
+     * embarrassingly parallel and reproducible: independent streams need no
+     * communication, any sample index can be regenerated in O(1) via seek(),
+     * and results do not depend on how the draws are batched across workers.
+     *
+     * The interface satisfies the UniformRandomBitGenerator requirements, so
+     * the generator can also drive the standard library's distributions.
+     */
+    class PhiloxRNG
+    {
+        private:
+            // the key, derived from the seed
+            std::uint32_t _key[2];
+
+            // the stream identifier, occupying the counter's upper half
+            std::uint32_t _stream[2];
+
+            // index of the next 32-bit draw; consecutive draws share blocks of four
+            std::uint64_t _index;
+
+            // block of outputs for the counter value _index / 4, valid when _valid
+            std::array<std::uint32_t, 4> _block;
+            std::uint64_t _block_index;
+            bool _valid;
+
+            static inline void _round(std::uint32_t (& ctr)[4], const std::uint32_t (& key)[2])
+            {
+                const std::uint64_t product0 = std::uint64_t(0xD2511F53u) * ctr[0];
+                const std::uint64_t product1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+
+                const std::uint32_t hi0 = product0 >> 32, lo0 = product0;
+                const std::uint32_t hi1 = product1 >> 32, lo1 = product1;
+
+                ctr[0] = hi1 ^ ctr[1] ^ key[0];
+                ctr[1] = lo1;
+                ctr[2] = hi0 ^ ctr[3] ^ key[1];
+                ctr[3] = lo0;
+            }
+
+            std::array<std::uint32_t, 4> _generate(const std::uint64_t & block_index) const
+            {
+                std::uint32_t ctr[4] = { std::uint32_t(block_index), std::uint32_t(block_index >> 32), _stream[0], _stream[1] };
+                std::uint32_t key[2] = { _key[0], _key[1] };
+
+                _round(ctr, key);
+                for (unsigned r = 1 ; r < 10 ; ++r)
+                {
+                    key[0] += 0x9E3779B9u;
+                    key[1] += 0xBB67AE85u;
+                    _round(ctr, key);
+                }
+
+                return { ctr[0], ctr[1], ctr[2], ctr[3] };
+            }
+
+        public:
+            using result_type = std::uint32_t;
+
+            /*!
+             * Constructor.
+             *
+             * Generators with the same seed but different stream identifiers
+             * yield statistically independent sequences.
+             *
+             * @param seed   The seed, forming the generator's key.
+             * @param stream The stream identifier.
+             */
+            explicit PhiloxRNG(const std::uint64_t & seed, const std::uint64_t & stream = 0) :
+                _key{ std::uint32_t(seed), std::uint32_t(seed >> 32) },
+                _stream{ std::uint32_t(stream), std::uint32_t(stream >> 32) },
+                _index(0),
+                _block_index(0),
+                _valid(false)
+            {
+            }
+
+            static constexpr result_type min() { return 0; }
+            static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+            /// Return the next 32 bits of the stream.
+            result_type operator() ()
+            {
+                const std::uint64_t block_index = _index >> 2;
+                if ((! _valid) || (block_index != _block_index))
+                {
+                    _block       = _generate(block_index);
+                    _block_index = block_index;
+                    _valid       = true;
+                }
+
+                return _block[_index++ & 3];
+            }
+
+            /// Return the next draw as a uniform variate in [0, 1).
+            double uniform()
+            {
+                return (*this)() * 0x1p-32;
+            }
+
+            /// Position the generator at the given draw index, in O(1).
+            void seek(const std::uint64_t & index)
+            {
+                _index = index;
+            }
+
+            /// Advance the generator by n draws, in O(1).
+            void skip(const std::uint64_t & n)
+            {
+                _index += n;
+            }
+
+            /// Retrieve the index of the next draw.
+            std::uint64_t index() const
+            {
+                return _index;
+            }
+    };
+}
+
+#endif
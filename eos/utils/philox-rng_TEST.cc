@@ -0,0 +1,105 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/philox-rng.hh>
+
+using namespace test;
+using namespace eos;
+
+class PhiloxRNGTest :
+    public TestCase
+{
+    public:
+        PhiloxRNGTest() :
+            TestCase("philox_rng_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // known answer for the all-zero counter and key, cf. [SMDS:2011A]
+            {
+                PhiloxRNG rng(0, 0);
+
+                TEST_CHECK_EQUAL(0x6627e8d5u, rng());
+                TEST_CHECK_EQUAL(0xe169c58du, rng());
+                TEST_CHECK_EQUAL(0xbc57ac4cu, rng());
+                TEST_CHECK_EQUAL(0x9b00dbd8u, rng());
+            }
+
+            // generators with equal seed and stream yield equal sequences
+            {
+                PhiloxRNG lhs(987654321, 5), rhs(987654321, 5);
+
+                for (unsigned i = 0 ; i < 100 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(lhs(), rhs());
+                }
+            }
+
+            // seek() reaches the same state as drawing, in O(1)
+            {
+                PhiloxRNG drawn(42, 7), sought(42, 7);
+
+                for (unsigned i = 0 ; i < 1000 ; ++i)
+                {
+                    drawn();
+                }
+                sought.seek(1000);
+
+                TEST_CHECK_EQUAL(drawn(), sought());
+                TEST_CHECK_EQUAL(drawn.index(), sought.index());
+            }
+
+            // distinct streams yield distinct sequences
+            {
+                PhiloxRNG lhs(42, 0), rhs(42, 1);
+
+                unsigned matches = 0;
+                for (unsigned i = 0 ; i < 100 ; ++i)
+                {
+                    if (lhs() == rhs())
+                    {
+                        ++matches;
+                    }
+                }
+
+                TEST_CHECK_EQUAL(0u, matches);
+            }
+
+            // uniform() is confined to [0, 1) and is not obviously biased
+            {
+                PhiloxRNG rng(20260828);
+
+                double sum = 0.0;
+                for (unsigned i = 0 ; i < 10000 ; ++i)
+                {
+                    const double u = rng.uniform();
+
+                    TEST_CHECK(0.0 <= u);
+                    TEST_CHECK(u < 1.0);
+
+                    sum += u;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(0.5, sum / 10000, 0.01);
+            }
+        }
+} philox_rng_test;
@@ -0,0 +1,159 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/probes.hh>
+#include <eos/utils/stringify.hh>
+
+namespace eos
+{
+    template class InstantiationPolicy<ProbeRegistry, Singleton>;
+
+    ProbeRegistry::Registration::Registration(const std::uint64_t & id) :
+        _id(id)
+    {
+    }
+
+    ProbeRegistry::Registration::Registration(Registration && other) :
+        _id(other._id)
+    {
+        other._id = 0;
+    }
+
+    ProbeRegistry::Registration::~Registration()
+    {
+        if (0 != _id)
+        {
+            ProbeRegistry::instance()->_remove(_id);
+        }
+    }
+
+    ProbeRegistry::ProbeRegistry() :
+        _mutex(new Mutex),
+        _next_id(1),
+        _evaluations(0),
+        _interval(0),
+        _capacity(0)
+    {
+    }
+
+    ProbeRegistry::~ProbeRegistry()
+    {
+        delete _mutex;
+    }
+
+    ProbeRegistry::Registration
+    ProbeRegistry::add(const std::string & label, const Probe & probe)
+    {
+        Lock l(*_mutex);
+
+        const std::uint64_t id = _next_id++;
+        _probes[id] = std::make_pair(label, probe);
+
+        return Registration(id);
+    }
+
+    void
+    ProbeRegistry::_remove(const std::uint64_t & id)
+    {
+        Lock l(*_mutex);
+
+        _probes.erase(id);
+    }
+
+    Diagnostics
+    ProbeRegistry::_collect() const
+    {
+        Diagnostics result;
+        for (const auto & probe : _probes)
+        {
+            result.add(Diagnostics::Entry{ probe.second.second(), probe.second.first });
+        }
+
+        return result;
+    }
+
+    Diagnostics
+    ProbeRegistry::collect() const
+    {
+        Lock l(*_mutex);
+
+        return _collect();
+    }
+
+    std::vector<ProbeRegistry::Snapshot>
+    ProbeRegistry::history() const
+    {
+        Lock l(*_mutex);
+
+        return std::vector<Snapshot>(_history.begin(), _history.end());
+    }
+
+    void
+    ProbeRegistry::enable_sampling(const unsigned & interval, const unsigned & capacity)
+    {
+        if (0 == interval)
+        {
+            throw InternalError("ProbeRegistry: sampling interval must be positive");
+        }
+
+        if (0 == capacity)
+        {
+            throw InternalError("ProbeRegistry: sampling capacity must be positive");
+        }
+
+        Lock l(*_mutex);
+
+        _capacity = capacity;
+        while (_history.size() > _capacity)
+        {
+            _history.pop_front();
+        }
+
+        _interval.store(interval, std::memory_order_release);
+    }
+
+    void
+    ProbeRegistry::disable_sampling()
+    {
+        _interval.store(0, std::memory_order_release);
+    }
+
+    void
+    ProbeRegistry::tick()
+    {
+        const unsigned long evaluation = _evaluations.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        const unsigned interval = _interval.load(std::memory_order_acquire);
+        if ((0 == interval) || (0 != evaluation % interval))
+        {
+            return;
+        }
+
+        Lock l(*_mutex);
+
+        _history.push_back(Snapshot{ evaluation, _collect() });
+        while (_history.size() > _capacity)
+        {
+            _history.pop_front();
+        }
+    }
+}
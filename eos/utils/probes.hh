@@ -0,0 +1,158 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_PROBES_HH
+#define EOS_GUARD_EOS_UTILS_PROBES_HH 1
+
+#include <eos/utils/diagnostics.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/mutex.hh>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Registry of lazily-evaluated diagnostic probes.
+     *
+     * Unlike Diagnostics, which requires its values to be computed eagerly at
+     * the point of use, a probe is a labelled callable that is only invoked
+     * when an inspection API asks for it. Classes that wish to expose internal
+     * quantities register a probe and keep the returned Registration alive for
+     * as long as the quantity can be evaluated; the probe is removed when the
+     * Registration is destroyed.
+     *
+     * In addition to on-demand collection, the registry supports a sampling
+     * mode: every interval-th likelihood evaluation, all registered probes are
+     * snapshot into a bounded ring buffer. This allows watching quantities
+     * drift over the course of a long fit. When sampling is disabled (the
+     * default), the per-evaluation cost is a single atomic counter increment.
+     */
+    class ProbeRegistry :
+        public InstantiationPolicy<ProbeRegistry, Singleton>
+    {
+        public:
+            /// Callable yielding the current value of a probed quantity.
+            using Probe = std::function<double ()>;
+
+            /// Values of all probes as of a given likelihood evaluation.
+            struct Snapshot
+            {
+                /// Number of the likelihood evaluation at which the snapshot was taken.
+                unsigned long evaluation;
+
+                /// Labelled probe values, in order of registration.
+                Diagnostics values;
+            };
+
+            /*!
+             * Handle to a registered probe; removes the probe from the
+             * registry upon destruction.
+             */
+            class Registration
+            {
+                private:
+                    friend class ProbeRegistry;
+
+                    std::uint64_t _id;
+
+                    explicit Registration(const std::uint64_t & id);
+
+                public:
+                    Registration(Registration && other);
+
+                    Registration(const Registration &) = delete;
+                    Registration & operator= (const Registration &) = delete;
+
+                    ~Registration();
+            };
+
+        private:
+            Mutex * const _mutex;
+
+            // probes in order of registration; the id doubles as the key for removal
+            std::map<std::uint64_t, std::pair<std::string, Probe>> _probes;
+            std::uint64_t _next_id;
+
+            // number of likelihood evaluations seen so far
+            std::atomic<unsigned long> _evaluations;
+
+            // snapshot every _interval-th evaluation; 0 disables sampling
+            std::atomic<unsigned> _interval;
+
+            std::deque<Snapshot> _history;
+            unsigned _capacity;
+
+            void _remove(const std::uint64_t & id);
+
+            Diagnostics _collect() const;
+
+        public:
+            ProbeRegistry();
+
+            ~ProbeRegistry();
+
+            ///@name Registration
+            ///@{
+            /*!
+             * Register a probe under the given label.
+             *
+             * The probe must remain callable until the returned Registration
+             * is destroyed.
+             */
+            Registration add(const std::string & label, const Probe & probe);
+            ///@}
+
+            ///@name Inspection
+            ///@{
+            /// Evaluate all registered probes now.
+            Diagnostics collect() const;
+
+            /// Return the snapshots accumulated so far, oldest first.
+            std::vector<Snapshot> history() const;
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Snapshot all registered probes every interval-th likelihood
+             * evaluation, keeping no more than capacity snapshots.
+             */
+            void enable_sampling(const unsigned & interval, const unsigned & capacity);
+
+            /// Stop taking snapshots; the history accumulated so far is kept.
+            void disable_sampling();
+
+            /*!
+             * Record one likelihood evaluation; called by LogLikelihood.
+             *
+             * Cheap when sampling is disabled.
+             */
+            void tick();
+            ///@}
+    };
+}
+
+#endif
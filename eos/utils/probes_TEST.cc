@@ -0,0 +1,108 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/probes.hh>
+
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ProbeRegistryTest :
+    public TestCase
+{
+    public:
+        ProbeRegistryTest() :
+            TestCase("probe_registry_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // probes are evaluated lazily, in order of registration, and
+            // deregistered when their Registration goes out of scope
+            {
+                unsigned invocations = 0;
+                double value = 17.0;
+
+                {
+                    auto first = ProbeRegistry::instance()->add("first", [&] { ++invocations; return value; });
+                    auto second = ProbeRegistry::instance()->add("second", [] { return 23.0; });
+
+                    TEST_CHECK_EQUAL(invocations, 0u);
+
+                    Diagnostics diagnostics = ProbeRegistry::instance()->collect();
+                    TEST_CHECK_EQUAL(diagnostics.size(), 2u);
+                    TEST_CHECK_EQUAL(invocations, 1u);
+
+                    auto entry = diagnostics.begin();
+                    TEST_CHECK_EQUAL(entry->description, "first");
+                    TEST_CHECK_EQUAL(entry->value, 17.0);
+                    ++entry;
+                    TEST_CHECK_EQUAL(entry->description, "second");
+                    TEST_CHECK_EQUAL(entry->value, 23.0);
+
+                    // collect() sees the current value, not the one at registration
+                    value = 19.0;
+                    diagnostics = ProbeRegistry::instance()->collect();
+                    TEST_CHECK_EQUAL(diagnostics.begin()->value, 19.0);
+                }
+
+                TEST_CHECK_EQUAL(ProbeRegistry::instance()->collect().size(), 0u);
+            }
+
+            // sampling snapshots every interval-th evaluation into a bounded
+            // ring buffer, keeping the most recent snapshots
+            {
+                double value = 0.0;
+                auto probe = ProbeRegistry::instance()->add("drifting", [&] { return value; });
+
+                TEST_CHECK_THROWS(InternalError, ProbeRegistry::instance()->enable_sampling(0, 3));
+                TEST_CHECK_THROWS(InternalError, ProbeRegistry::instance()->enable_sampling(2, 0));
+
+                ProbeRegistry::instance()->enable_sampling(2, 3);
+                for (unsigned i = 1 ; i <= 8 ; ++i)
+                {
+                    value = i;
+                    ProbeRegistry::instance()->tick();
+                }
+
+                std::vector<ProbeRegistry::Snapshot> history = ProbeRegistry::instance()->history();
+                TEST_CHECK_EQUAL(history.size(), 3u);
+
+                // snapshots were taken at evaluations 2, 4, 6 and 8; the
+                // capacity of 3 retains the last three
+                for (unsigned i = 0 ; i < 3 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(history[i].evaluation % 2, 0u);
+                    TEST_CHECK_EQUAL(history[i].values.size(), 1u);
+                    TEST_CHECK_EQUAL(history[i].values.begin()->value, double(history[i].evaluation));
+                }
+                TEST_CHECK_EQUAL(history[2].evaluation - history[0].evaluation, 4u);
+
+                // disabling sampling stops the buffer from growing, but keeps it
+                ProbeRegistry::instance()->disable_sampling();
+                ProbeRegistry::instance()->tick();
+                ProbeRegistry::instance()->tick();
+                TEST_CHECK_EQUAL(ProbeRegistry::instance()->history().size(), 3u);
+            }
+        }
+} probe_registry_test;
@@ -23,9 +23,174 @@
 
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 namespace eos
 {
+    namespace
+    {
+        // per-order switches that zero out the coefficients beyond the requested loop order
+        std::array<double, 4>
+        loop_switches(unsigned int loop_order)
+        {
+            std::array<double, 4> switches;
+            std::generate(switches.begin(), switches.end(), [i = 0u, l = loop_order] () mutable { return (i++ < l) ? 1.0 : 0.0;});
+
+            return switches;
+        }
+
+        // Scale-independent state of the [CKS2000] alpha_s evolution; computing
+        // it once per batch hoists the initial-condition logarithms out of the
+        // per-scale loop.
+        struct AlphaSEvolution
+        {
+            double beta0, b1, b2, b3;
+
+            double ln_lambda2;
+        };
+
+        AlphaSEvolution
+        alpha_s_evolution(const double & alpha_s_0, const double & mu_0, const QCD::BetaFunction & beta, unsigned int loop_order)
+        {
+            const double a = alpha_s_0 / M_PI;
+            const std::array<double, 4> switches = loop_switches(loop_order);
+
+            // Adjust for a different convention on beta function coefficients
+            AlphaSEvolution result;
+            const double beta0 = beta[0] / 4.0;
+            const double beta1 = switches[1] * beta[1] / 16.0;
+            const double beta2 = switches[2] * beta[2] / 64.0;
+            const double beta3 = switches[3] * beta[3] / 256.0;
+            result.beta0 = beta0;
+            result.b1 = beta1 / beta0;
+            result.b2 = beta2 / beta0;
+            result.b3 = beta3 / beta0;
+
+            // cf. [CKS2000], Eq. (4), p. 3
+            result.ln_lambda2 = 2.0 * log(mu_0)
+                - (1.0 / a + result.b1 * log(a) + (result.b2 - result.b1 * result.b1) * a
+                        + (result.b3 / 2.0 - result.b1 * result.b2 + result.b1 * result.b1 * result.b1 / 2.0) * a * a) / beta0
+                // Use C for MSbar definition
+                - result.b1 / beta0 * log(beta0);
+
+            return result;
+        }
+
+        double
+        alpha_s_at(const AlphaSEvolution & evolution, const double & mu)
+        {
+            const double & beta0 = evolution.beta0;
+            const double & b1 = evolution.b1, & b2 = evolution.b2, & b3 = evolution.b3;
+
+            const double L = 2.0 * log(mu) - evolution.ln_lambda2, lnL = log(L);
+            const double denom = beta0 * L, denom2 = denom * denom, denom3 = denom2 * denom, denom4 = denom2 * denom2;
+
+            // cf. [CKS2000], Eq. (5), p. 3
+            const double result = 1.0 / denom
+                - b1 * lnL / denom2
+                + (b1 * b1 * (lnL * lnL - lnL - 1.0) + b2) / denom3
+                + (b1 * b1 * b1 * (-1.0 * lnL * lnL * lnL + 5.0 / 2.0 * lnL * lnL + 2.0 * lnL - 0.5) - 3.0 * b1 * b2 * lnL + b3 / 2.0) / denom4;
+
+            return M_PI * result;
+        }
+
+        // Coupling-independent state of the [CKS2000] mass evolution: the
+        // expansion coefficients of the evolution factor c(a), and that factor
+        // evaluated at the initial coupling.
+        struct MassEvolution
+        {
+            double c0, k1, k2, k3;
+
+            double c_mu0;
+        };
+
+        // cf. [CKS2000], Eq. (10), p. 6
+        double
+        mass_evolution_factor(const MassEvolution & evolution, const double & a)
+        {
+            return pow(a, evolution.c0) * (1.0 + a * (evolution.k1 + a * (evolution.k2 + a * evolution.k3)));
+        }
+
+        MassEvolution
+        mass_evolution(const double & alpha_s_0, const QCD::BetaFunction & beta, const QCD::AnomalousMassDimension & gamma_m, unsigned int loop_order)
+        {
+            const std::array<double, 4> switches = loop_switches(loop_order);
+
+            // Adjust for a different convention on beta function coefficients
+            const double beta0 = beta[0] / 4.0;
+            const double beta1 = switches[1] * beta[1] / 16.0;
+            const double beta2 = switches[2] * beta[2] / 64.0;
+            const double beta3 = switches[3] * beta[3] / 256.0;
+            const double b1 = beta1 / beta0;
+            const double b2 = beta2 / beta0;
+            const double b3 = beta3 / beta0;
+
+            // Adjust for a different convention on gamma function coefficients
+            const double gamma0_m = gamma_m[0];
+            const double gamma1_m = switches[1] * gamma_m[1] / 16.0;
+            const double gamma2_m = switches[2] * gamma_m[2] / 64.0;
+            const double gamma3_m = switches[3] * gamma_m[3] / 256.0;
+            const double c0 = gamma0_m / beta0;
+            const double c1 = gamma1_m / beta0;
+            const double c2 = gamma2_m / beta0;
+            const double c3 = gamma3_m / beta0;
+
+            MassEvolution result;
+            result.c0 = c0;
+            result.k1 = c1 - b1 * c0;
+            result.k2 = 0.5 * (pow(c1 - b1 * c0, 2) + c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0);
+            result.k3 = pow(c1 - b1 * c0, 3) / 6.0 + (c1 - b1 * c0) / 2.0 * (c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0)
+                + (c3 - b1 * c2 + b1 * b1 * c1 - b2 * c1 - b1 * b1 * b1 * c0 + 2.0 * b1 * b2 * c0 - b3 * c0) / 3.0;
+            result.c_mu0 = mass_evolution_factor(result, alpha_s_0 / M_PI);
+
+            return result;
+        }
+
+        /* Small per-thread memo tables for the scalar entry points: one
+         * likelihood evaluation reaches the running routines through several
+         * independent code paths with identical arguments. The keys cover the
+         * complete argument lists, so an entry can never serve a stale result
+         * and no further invalidation is needed. The tables are direct-mapped
+         * on the bits of the most rapidly varying argument. */
+
+        constexpr std::size_t qcd_memo_size = 16;
+
+        std::size_t
+        qcd_memo_slot(const double & x)
+        {
+            std::uint64_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+
+            return (bits ^ (bits >> 33)) % qcd_memo_size;
+        }
+
+        struct AlphaSMemoEntry
+        {
+            double mu, alpha_s_0, mu_0;
+            QCD::BetaFunction beta;
+            unsigned int loop_order;
+
+            bool valid;
+            double result;
+        };
+
+        thread_local std::array<AlphaSMemoEntry, qcd_memo_size> alpha_s_memo {};
+
+        struct MassMemoEntry
+        {
+            double m_q_0, alpha_s_0, alpha_s_mu;
+            QCD::BetaFunction beta;
+            QCD::AnomalousMassDimension gamma_m;
+            unsigned int loop_order;
+
+            bool valid;
+            double result;
+        };
+
+        thread_local std::array<MassMemoEntry, qcd_memo_size> m_q_msbar_memo {};
+    }
+
     const double QCD::casimir_f = 4.0 / 3.0;
 
     /* 6 flavor QCD constants */
@@ -111,35 +276,38 @@ namespace eos
             throw InternalError("QCD::alpha_s: loop order " + stringify(loop_order) + " not yet implemented");
         }
 
-        double a = alpha_s_0 / M_PI;
-        std::array<double, 4> switches;
-        std::generate(switches.begin(), switches.end(), [i = 0u, l = loop_order] () mutable { return (i++ < l) ? 1.0 : 0.0;});
-
-        // Adjust for a different convention on beta function coefficients
-        double beta0 = beta[0] / 4.0;
-        double beta1 = switches[1] * beta[1] / 16.0;
-        double beta2 = switches[2] * beta[2] / 64.0;
-        double beta3 = switches[3] * beta[3] / 256.0;
-        double b1 = beta1 / beta0;
-        double b2 = beta2 / beta0;
-        double b3 = beta3 / beta0;
-
-        // cf. [CKS2000], Eq. (4), p. 3
-        double ln_lambda2 = 2.0 * log(mu_0)
-            - (1.0 / a + b1 * log(a) + (b2 - b1 * b1) * a + (b3 / 2.0 - b1 * b2 + b1 * b1 * b1 / 2.0) * a * a) / beta0
-            // Use C for MSbar definition
-            - b1 / beta0 * log(beta0);
-
-        double L = 2.0 * log(mu) - ln_lambda2, lnL = log(L);
-        double denom = beta0 * L, denom2 = denom * denom, denom3 = denom2 * denom, denom4 = denom2 * denom2;
-
-        // cf. [CKS2000], Eq. (5), p. 3
-        double result = 1.0 / denom
-            - b1 * lnL / denom2
-            + (b1 * b1 * (lnL * lnL - lnL - 1.0) + b2) / denom3
-            + (b1 * b1 * b1 * (-1.0 * lnL * lnL * lnL + 5.0 / 2.0 * lnL * lnL + 2.0 * lnL - 0.5) - 3.0 * b1 * b2 * lnL + b3 / 2.0) / denom4;
-
-        return M_PI * result;
+        AlphaSMemoEntry & entry = alpha_s_memo[qcd_memo_slot(mu)];
+        if (entry.valid && (entry.mu == mu) && (entry.alpha_s_0 == alpha_s_0) && (entry.mu_0 == mu_0)
+                && (entry.beta == beta) && (entry.loop_order == loop_order))
+        {
+            return entry.result;
+        }
+
+        const double result = alpha_s_at(alpha_s_evolution(alpha_s_0, mu_0, beta, loop_order), mu);
+
+        entry = AlphaSMemoEntry{ mu, alpha_s_0, mu_0, beta, loop_order, true, result };
+
+        return result;
+    }
+
+    void
+    QCD::alpha_s(const double * mu, double * results, const std::size_t & n, const double & alpha_s_0, const double & mu_0,
+            const BetaFunction & beta, unsigned int loop_order)
+    {
+        if (loop_order == 0)
+        {
+            throw InternalError("QCD::alpha_s: zero loop order not implemented");
+        }
+        if (loop_order > 4)
+        {
+            throw InternalError("QCD::alpha_s: loop order " + stringify(loop_order) + " not yet implemented");
+        }
+
+        const AlphaSEvolution evolution = alpha_s_evolution(alpha_s_0, mu_0, beta, loop_order);
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            results[k] = alpha_s_at(evolution, mu[k]);
+        }
     }
 
     double
@@ -154,48 +322,43 @@ namespace eos
             throw InternalError("QCD::alpha_s: loop order " + stringify(loop_order) + " not yet implemented");
         }
 
-        double a_mu0 = alpha_s_0 / M_PI;
-        double a_mu = alpha_s_mu / M_PI;
-        std::array<double, 4> switches;
-        std::generate(switches.begin(), switches.end(), [i = 0u, l = loop_order] () mutable { return (i++ < l) ? 1.0 : 0.0;});
-
-        // Adjust for a different convention on beta function coefficients
-        double beta0 = beta[0] / 4.0;
-        double beta1 = switches[1] * beta[1] / 16.0;
-        double beta2 = switches[2] * beta[2] / 64.0;
-        double beta3 = switches[3] * beta[3] / 256.0;
-        double b1 = beta1 / beta0;
-        double b2 = beta2 / beta0;
-        double b3 = beta3 / beta0;
-
-        // Adjust for a different convention on gamma function coefficients
-        double gamma0_m = gamma_m[0];
-        double gamma1_m = switches[1] * gamma_m[1] / 16.0;
-        double gamma2_m = switches[2] * gamma_m[2] / 64.0;
-        double gamma3_m = switches[3] * gamma_m[3] / 256.0;
-        double c0 = gamma0_m / beta0;
-        double c1 = gamma1_m / beta0;
-        double c2 = gamma2_m / beta0;
-        double c3 = gamma3_m / beta0;
+        MassMemoEntry & entry = m_q_msbar_memo[qcd_memo_slot(alpha_s_mu)];
+        if (entry.valid && (entry.m_q_0 == m_q_0) && (entry.alpha_s_0 == alpha_s_0) && (entry.alpha_s_mu == alpha_s_mu)
+                && (entry.beta == beta) && (entry.gamma_m == gamma_m) && (entry.loop_order == loop_order))
+        {
+            return entry.result;
+        }
 
-        // cf. [CKS2000], Eq. (10), p. 6
-        double c_mu0 = pow(a_mu0, c0) * (
-                1.0
-                + a_mu0 * (c1 - b1 * c0)
-                + a_mu0 * a_mu0 * 0.5 * (pow(c1 - b1 * c0, 2) + c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0)
-                + a_mu0 * a_mu0 * a_mu0 * (pow(c1 - b1 * c0, 3) / 6.0 + (c1 - b1 * c0) / 2.0 * (c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0)
-                    + (c3 - b1 * c2 + b1 * b1 * c1 - b2 * c1 - b1 * b1 * b1 * c0 + 2.0 * b1 * b2 * c0 - b3 * c0) / 3.0));
+        const MassEvolution evolution = mass_evolution(alpha_s_0, beta, gamma_m, loop_order);
 
-        // cf. [CKS2000], Eq. (10), p. 6
-        double c_mu = pow(a_mu, c0) * (
-                1.0
-                + a_mu * (c1 - b1 * c0)
-                + a_mu * a_mu * 0.5 * (pow(c1 - b1 * c0, 2) + c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0)
-                + a_mu * a_mu * a_mu * (pow(c1 - b1 * c0, 3) / 6.0 + (c1 - b1 * c0) / 2.0 * (c2 - b1 * c1 + b1 * b1 * c0 - b2 * c0)
-                    + (c3 - b1 * c2 + b1 * b1 * c1 - b2 * c1 - b1 * b1 * b1 * c0 + 2.0 * b1 * b2 * c0 - b3 * c0) / 3.0));
+        // cf. [CKS2000], Eq. (9), p. 6
+        const double result = m_q_0 * mass_evolution_factor(evolution, alpha_s_mu / M_PI) / evolution.c_mu0;
+
+        entry = MassMemoEntry{ m_q_0, alpha_s_0, alpha_s_mu, beta, gamma_m, loop_order, true, result };
+
+        return result;
+    }
+
+    void
+    QCD::m_q_msbar(const double & m_q_0, const double & alpha_s_0, const double * alpha_s_mu, double * results, const std::size_t & n,
+            const BetaFunction & beta, const AnomalousMassDimension & gamma_m, unsigned int loop_order)
+    {
+        if (loop_order == 0)
+        {
+            throw InternalError("QCD::alpha_s: zero loop order not implemented");
+        }
+        if (loop_order > 4)
+        {
+            throw InternalError("QCD::alpha_s: loop order " + stringify(loop_order) + " not yet implemented");
+        }
+
+        const MassEvolution evolution = mass_evolution(alpha_s_0, beta, gamma_m, loop_order);
 
         // cf. [CKS2000], Eq. (9), p. 6
-        return m_q_0 * c_mu / c_mu0;
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            results[k] = m_q_0 * mass_evolution_factor(evolution, alpha_s_mu[k] / M_PI) / evolution.c_mu0;
+        }
     }
 
     double
@@ -21,6 +21,7 @@
 #define EOS_GUARD_EOS_UTILS_QCD_HH 1
 
 #include <array>
+#include <cstddef>
 
 namespace eos
 {
@@ -38,6 +39,10 @@ namespace eos
              *
              * Calculation according to [CKS2000].
              *
+             * Repeated calls with identical arguments are served from a small
+             * per-thread memo table; the key covers the complete argument
+             * list, so the table cannot serve stale results.
+             *
              * @param mu          scale at which alpha_s shall be evaluated
              * @param alpha_s_0   alpha_s at the initial scale mu_0
              * @param mu_0        initial scale mu_0
@@ -45,11 +50,31 @@ namespace eos
              */
             static double alpha_s(const double & mu, const double & alpha_s_0, const double & mu_0, const BetaFunction & beta, unsigned int loop_order = 4);
 
+            /*!
+             * Calculate RGE running of strong coupling alpha_s for an array of scales
+             * sharing one initial condition.
+             *
+             * The scale-independent part of the [CKS2000] evolution is computed once
+             * and reused for every scale.
+             *
+             * @param mu          pointer to the first of n scales at which alpha_s shall be evaluated
+             * @param results     pointer to an array of n entries to which the alpha_s values are written
+             * @param n           number of scales
+             * @param alpha_s_0   alpha_s at the initial scale mu_0
+             * @param mu_0        initial scale mu_0
+             * @param beta        parameters of QCD beta function that control the running
+             */
+            static void alpha_s(const double * mu, double * results, const std::size_t & n, const double & alpha_s_0, const double & mu_0,
+                    const BetaFunction & beta, unsigned int loop_order = 4);
+
             /*!
              * Calculate RGE running of quark mass m_q in the MSbar scheme.
              *
              * Calculation according to [CKS2000].
              *
+             * Repeated calls with identical arguments are served from a small
+             * per-thread memo table, analogously to alpha_s().
+             *
              * @param m_q         quark mass in the MSbar scheme at the scale m_q
              * @param alpha_s_0   alpha_s at the scale mu_0 = m_q
              * @param alpha_s_mu  alpha_s at the scale mu
@@ -58,6 +83,24 @@ namespace eos
              */
             static double m_q_msbar(const double & m_q, const double & alpha_s_0, const double & alpha_s_mu, const BetaFunction & beta, const AnomalousMassDimension & gamma_m, unsigned int loop_order = 4);
 
+            /*!
+             * Calculate RGE running of quark mass m_q in the MSbar scheme for an array
+             * of couplings sharing one initial condition.
+             *
+             * The initial-condition factor of the [CKS2000] evolution is computed once
+             * and reused for every coupling.
+             *
+             * @param m_q         quark mass in the MSbar scheme at the scale m_q
+             * @param alpha_s_0   alpha_s at the scale mu_0 = m_q
+             * @param alpha_s_mu  pointer to the first of n values of alpha_s at the target scales
+             * @param results     pointer to an array of n entries to which the quark masses are written
+             * @param n           number of target couplings
+             * @param beta        parameters of QCD beta function that control the running
+             * @param gamma_m     parameters of QCD anomalous mass dimension that control the running
+             */
+            static void m_q_msbar(const double & m_q, const double & alpha_s_0, const double * alpha_s_mu, double * results, const std::size_t & n,
+                    const BetaFunction & beta, const AnomalousMassDimension & gamma_m, unsigned int loop_order = 4);
+
             /*!
              * Calculate the shift from pole mass scheme to MSbar.
              *
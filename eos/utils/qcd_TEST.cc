@@ -58,6 +58,31 @@ class QCDMassesTest :
                 TEST_CHECK_NEARLY_EQUAL(QCD::m_q_msbar(4.18, 0.2329548830209454, 0.12, QCD::beta_function_nf_5, QCD::gamma_m_nf_5, 4), 2.826500455559605, eps);
             }
 
+            // batch evaluation agrees with the scalar entry points
+            {
+                static const double eps = 1e-15;
+
+                const std::array<double, 4> scales{{ 2.0, 4.18, 10.0, 91.2 }};
+                std::array<double, 4> couplings;
+                QCD::alpha_s(scales.data(), couplings.data(), scales.size(), 0.12, 91.2, QCD::beta_function_nf_5);
+
+                for (auto k = 0u ; k < scales.size() ; ++k)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(couplings[k], QCD::alpha_s(scales[k], 0.12, 91.2, QCD::beta_function_nf_5), eps);
+                }
+
+                std::array<double, 4> masses;
+                QCD::m_q_msbar(4.18, couplings[1], couplings.data(), masses.data(), couplings.size(), QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
+                for (auto k = 0u ; k < couplings.size() ; ++k)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(masses[k], QCD::m_q_msbar(4.18, couplings[1], couplings[k], QCD::beta_function_nf_5, QCD::gamma_m_nf_5), 1e-14);
+                }
+
+                // repeated calls with identical arguments are served from the memo table and stay exact
+                TEST_CHECK_EQUAL(QCD::alpha_s(4.18, 0.12, 91.2, QCD::beta_function_nf_5),
+                                 QCD::alpha_s(4.18, 0.12, 91.2, QCD::beta_function_nf_5));
+            }
+
             // m_q_msbar(m_q_pole) at 3-loop
             {
                 static const double eps = 1e-7;
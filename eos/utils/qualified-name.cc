@@ -18,8 +18,13 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/qualified-name.hh>
 
+#include <functional>
+#include <unordered_map>
+
 namespace eos
 {
     namespace qnp
@@ -157,12 +162,12 @@ namespace eos
         }
     }
 
-    QualifiedName::QualifiedName(const std::string & input) :
-        _full(input),
-        _prefix("null"),
-        _name("empty"),
-        _suffix(""),
-        _options()
+    QualifiedName::Data::Data(const std::string & input) :
+        full(input),
+        prefix("null"),
+        name("empty"),
+        suffix(""),
+        options()
     {
         if (input.empty())
         {
@@ -179,7 +184,7 @@ namespace eos
         }
 
         // A valid prefix does not contain either a ';' or an '@'.
-        _prefix = qnp::Prefix(input.substr(0, pos_scope));
+        prefix = qnp::Prefix(input.substr(0, pos_scope));
 
 
         // Check that the suffix comes before the options list, prohibiting
@@ -197,9 +202,9 @@ namespace eos
             len_name -= pos_scope + 2;
         }
 
-        _name = qnp::Name(input.substr(pos_scope + 2, len_name));
+        name = qnp::Name(input.substr(pos_scope + 2, len_name));
 
-        _str = _prefix.str() + "::" + _name.str();
+        str = prefix.str() + "::" + name.str();
 
         // The suffix is optional
         if (std::string::npos != pos_at)
@@ -210,9 +215,9 @@ namespace eos
                 len_suffix -= pos_at + 1;
             }
 
-            _suffix = qnp::Suffix(input.substr(pos_at + 1, len_suffix));
+            suffix = qnp::Suffix(input.substr(pos_at + 1, len_suffix));
 
-            _str += "@" + _suffix.str();
+            str += "@" + suffix.str();
         }
 
         auto pos_option_start = pos_semicolon;
@@ -229,34 +234,54 @@ namespace eos
             qnp::OptionKey key(input.substr(pos_option_start + 1, pos_equal - pos_option_start - 1));
             qnp::OptionValue value(input.substr(pos_equal + 1, pos_next_comma - pos_equal - 1));
 
-            _options.declare(key.str(), value.str());
+            options.declare(key.str(), value.str());
 
             pos_option_start = pos_next_comma;
         }
+
+        hash = std::hash<std::string>()(str);
+    }
+
+    std::shared_ptr<const QualifiedName::Data>
+    QualifiedName::_intern(const std::string & input)
+    {
+        static Mutex mutex;
+        static std::unordered_map<std::string, std::shared_ptr<const Data>> pool;
+
+        {
+            Lock lock(mutex);
+
+            auto i = pool.find(input);
+            if (pool.end() != i)
+                return i->second;
+        }
+
+        // parse outside the lock; parsing can throw
+        auto data = std::make_shared<const Data>(input);
+
+        Lock lock(mutex);
+
+        // on a concurrent insertion of the same input, keep the first interned instance
+        return pool.emplace(input, data).first->second;
+    }
+
+    QualifiedName::QualifiedName(const std::string & input) :
+        _data(QualifiedName::_intern(input))
+    {
     }
 
     QualifiedName::QualifiedName(const char * input) :
-        QualifiedName(std::string(input))
+        _data(QualifiedName::_intern(std::string(input)))
     {
     }
 
     QualifiedName::QualifiedName(const QualifiedName & other) :
-        _str(other._str),
-        _full(other._full),
-        _prefix(other._prefix),
-        _name(other._name),
-        _suffix(other._suffix),
-        _options(other._options)
+        _data(other._data)
     {
     }
 
     QualifiedName::QualifiedName(const qnp::Prefix & p, const qnp::Name & n, const qnp::Suffix & s) :
-        _str(p.str() + "::" + n.str() + (s.empty() ? std::string() : "@" + s.str())),
-        _full(_str),
-        _prefix(p),
-        _name(n),
-        _suffix(s),
-        _options()
+        _data(QualifiedName::_intern(p.str() + "::" + n.str() + (s.empty() ? std::string() : "@" + s.str())))
     {
     }
 
@@ -24,6 +24,7 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/options.hh>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -124,12 +125,31 @@ namespace eos
         friend std::ostream & operator<< (std::ostream &, const QualifiedName &);
 
         private:
-            std::string  _str;     // short hand name, excluding possible options
-            std::string  _full;    // full name, including all given options
-            qnp::Prefix  _prefix;
-            qnp::Name    _name;
-            qnp::Suffix  _suffix;
-            Options      _options;
+            /*
+             * The immutable parsed representation of a qualified name.
+             *
+             * Instances are interned in a global pool keyed by the raw input
+             * string, so constructing the same qualified name repeatedly
+             * reduces to a single hash lookup, and all copies share one
+             * parsed representation. The pool only ever grows; the set of
+             * parameter and observable names used by a process is finite.
+             */
+            struct Data
+            {
+                std::string  str;     // short hand name, excluding possible options
+                std::string  full;    // full name, including all given options
+                qnp::Prefix  prefix;
+                qnp::Name    name;
+                qnp::Suffix  suffix;
+                Options      options;
+                std::size_t  hash;    // hash of the short hand name
+
+                explicit Data(const std::string & input);
+            };
+
+            std::shared_ptr<const Data> _data;
+
+            static std::shared_ptr<const Data> _intern(const std::string & input);
 
         public:
             QualifiedName(const std::string & name);
@@ -138,21 +158,31 @@ namespace eos
             QualifiedName(const qnp::Prefix & prefix, const qnp::Name & name, const qnp::Suffix & suffix = qnp::Suffix());
             ~QualifiedName();
 
-            inline const std::string & str() const { return _str; };
-            inline const std::string & full() const { return _full; };
-            inline const qnp::Prefix & prefix_part() const { return _prefix; };
-            inline const qnp::Name & name_part() const { return _name; };
-            inline const qnp::Suffix & suffix_part() const { return _suffix; };
-            inline const Options & options() const { return _options; };
+            inline const std::string & str() const { return _data->str; };
+            inline const std::string & full() const { return _data->full; };
+            inline const qnp::Prefix & prefix_part() const { return _data->prefix; };
+            inline const qnp::Name & name_part() const { return _data->name; };
+            inline const qnp::Suffix & suffix_part() const { return _data->suffix; };
+            inline const Options & options() const { return _data->options; };
+
+            /// Return the precomputed hash of the short hand name.
+            inline std::size_t hash() const { return _data->hash; };
 
             /*
              * Two qualified names are compared based on their short names only.
              * As a consequence, two qualified names can be identical, even if their
-             * full names aren't.
+             * full names aren't. Names sharing one interned representation
+             * compare equal without touching the strings.
              */
-            inline bool operator<  (const QualifiedName & rhs) const { return this->_str <  rhs._str; };
-            inline bool operator== (const QualifiedName & rhs) const { return this->_str == rhs._str; };
-            inline bool operator!= (const QualifiedName & rhs) const { return this->_str != rhs._str; };
+            inline bool operator<  (const QualifiedName & rhs) const
+            {
+                if (_data == rhs._data)
+                    return false;
+
+                return this->_data->str < rhs._data->str;
+            };
+            inline bool operator== (const QualifiedName & rhs) const { return (_data == rhs._data) || (this->_data->str == rhs._data->str); };
+            inline bool operator!= (const QualifiedName & rhs) const { return ! (*this == rhs); };
     };
 
     class QualifiedNameSyntaxError :
@@ -164,10 +194,23 @@ namespace eos
 
     inline std::ostream & operator<< (std::ostream & lhs, const QualifiedName & rhs)
     {
-        lhs << rhs._str;
+        lhs << rhs._data->str;
 
         return lhs;
     }
 }
 
+namespace std
+{
+    template <>
+    struct hash<eos::QualifiedName>
+    {
+        std::size_t
+        operator() (const eos::QualifiedName & qn) const
+        {
+            return qn.hash();
+        }
+    };
+}
+
 #endif
@@ -180,5 +180,26 @@ class QualifiedNameTest :
                     );
 
             TEST_CHECK_THROWS(QualifiedNameSyntaxError, auto qn = QualifiedName(""));
+
+            // names constructed from the same input share one interned
+            // representation, with identical precomputed hashes
+            {
+                QualifiedName qn1("B->K^*ll::A_FB(s)@LargeRecoil;form-factors=KMPW2010");
+                QualifiedName qn2("B->K^*ll::A_FB(s)@LargeRecoil;form-factors=KMPW2010");
+
+                TEST_CHECK(qn1 == qn2);
+                TEST_CHECK_EQUAL(&qn1.str(), &qn2.str());
+                TEST_CHECK_EQUAL(qn1.hash(), qn2.hash());
+                TEST_CHECK_EQUAL(qn1.hash(), std::hash<QualifiedName>()(qn2));
+            }
+
+            // equal short hand names with different options hash identically
+            {
+                QualifiedName qn1("B->K^*ll::A_FB(s)@LargeRecoil;form-factors=KMPW2010");
+                QualifiedName qn2("B->K^*ll::A_FB(s)@LargeRecoil;form-factors=BSZ2015");
+
+                TEST_CHECK(qn1 == qn2);
+                TEST_CHECK_EQUAL(qn1.hash(), qn2.hash());
+            }
         }
 } qualified_name_test;
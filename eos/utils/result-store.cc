@@ -0,0 +1,225 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/result-store.hh>
+#include <eos/utils/stringify.hh>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    template class InstantiationPolicy<ResultStore, Singleton>;
+
+    namespace
+    {
+        /*
+         * One slot of the lossy hash table. The tag is the key XORed with the
+         * value's bits: a reader accepts the pair only if the relation holds,
+         * so a write torn by a concurrent writer, or a slot belonging to a
+         * different key, reads as a miss. A zero tag marks an empty slot.
+         */
+        struct ResultStoreEntry
+        {
+                std::atomic<std::uint64_t> tag;
+                std::atomic<std::uint64_t> bits;
+        };
+
+        static_assert(16 == sizeof(ResultStoreEntry), "ResultStoreEntry is expected to occupy two 64-bit words");
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "ResultStore requires lock-free 64-bit atomics");
+
+        // number of slots; must be a power of two. 2^20 slots occupy 16 MiB.
+        static const std::uint64_t result_store_slots = 1 << 20;
+
+        // length of the linear probe sequence before falling back to
+        // overwriting the home slot
+        static const std::uint64_t result_store_probes = 4;
+    } // namespace
+
+    template <> struct Implementation<ResultStore>
+    {
+            ResultStoreEntry * entries;
+
+            Implementation() :
+                entries(nullptr)
+            {
+                const char * path = std::getenv("EOS_RESULT_STORE");
+
+                if (nullptr == path)
+                    return;
+
+                const std::size_t size = result_store_slots * sizeof(ResultStoreEntry);
+
+                // a freshly created file is zero-filled by ftruncate, i.e. all
+                // of its slots are empty
+                int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+                if (fd < 0)
+                {
+                    Log::instance()->message("ResultStore", ll_warning)
+                        << "cannot open result store file '" << path << "': " << std::strerror(errno) << "; continuing without a result store";
+
+                    return;
+                }
+
+                struct stat status;
+                if ((0 != ::fstat(fd, &status)) || ((0 != status.st_size) && (static_cast<std::size_t>(status.st_size) != size))
+                        || ((0 == status.st_size) && (0 != ::ftruncate(fd, size))))
+                {
+                    Log::instance()->message("ResultStore", ll_warning)
+                        << "result store file '" << path << "' cannot be sized to " << stringify(size) << " bytes; continuing without a result store";
+
+                    ::close(fd);
+
+                    return;
+                }
+
+                void * mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+                // the mapping keeps its own reference to the file
+                ::close(fd);
+
+                if (MAP_FAILED == mapping)
+                {
+                    Log::instance()->message("ResultStore", ll_warning)
+                        << "cannot map result store file '" << path << "': " << std::strerror(errno) << "; continuing without a result store";
+
+                    return;
+                }
+
+                entries = static_cast<ResultStoreEntry *>(mapping);
+            }
+
+            ~Implementation()
+            {
+                if (nullptr != entries)
+                {
+                    ::munmap(entries, result_store_slots * sizeof(ResultStoreEntry));
+                }
+            }
+    };
+
+    ResultStore::ResultStore() :
+        PrivateImplementationPattern<ResultStore>(new Implementation<ResultStore>())
+    {
+    }
+
+    ResultStore::~ResultStore() = default;
+
+    ResultStore *
+    ResultStore::instance()
+    {
+        return InstantiationPolicy<ResultStore, Singleton>::instance();
+    }
+
+    bool
+    ResultStore::active() const
+    {
+        return nullptr != _imp->entries;
+    }
+
+    const std::uint64_t ResultStore::initial_seed = 14695981039346656037ull;
+
+    std::uint64_t
+    ResultStore::hash(const std::uint64_t & seed, const void * data, const std::size_t & size)
+    {
+        static const std::uint64_t prime = 1099511628211ull;
+
+        std::uint64_t result = seed;
+
+        const unsigned char * bytes = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0 ; i < size ; ++i)
+        {
+            result = (result ^ bytes[i]) * prime;
+        }
+
+        return result;
+    }
+
+    bool
+    ResultStore::lookup(const std::uint64_t & key, double & value) const
+    {
+        if (nullptr == _imp->entries)
+            return false;
+
+        for (std::uint64_t p = 0 ; p < result_store_probes ; ++p)
+        {
+            const ResultStoreEntry & entry = _imp->entries[(key + p) & (result_store_slots - 1)];
+
+            const std::uint64_t tag = entry.tag.load(std::memory_order_acquire);
+            if (0 == tag)
+                continue;
+
+            const std::uint64_t bits = entry.bits.load(std::memory_order_relaxed);
+            if (tag != (key ^ bits))
+                continue;
+
+            std::memcpy(&value, &bits, sizeof(double));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void
+    ResultStore::store(const std::uint64_t & key, const double & value)
+    {
+        if (nullptr == _imp->entries)
+            return;
+
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(double));
+
+        const std::uint64_t tag = key ^ bits;
+        // a zero tag is indistinguishable from an empty slot; such a pair
+        // cannot be represented and is simply not stored
+        if (0 == tag)
+            return;
+
+        // prefer an empty slot or the key's own slot within the probe
+        // sequence; otherwise, evict the entry in the home slot
+        ResultStoreEntry * target = &_imp->entries[key & (result_store_slots - 1)];
+        for (std::uint64_t p = 0 ; p < result_store_probes ; ++p)
+        {
+            ResultStoreEntry & entry = _imp->entries[(key + p) & (result_store_slots - 1)];
+
+            const std::uint64_t occupant = entry.tag.load(std::memory_order_acquire);
+            if ((0 == occupant) || (key == (occupant ^ entry.bits.load(std::memory_order_relaxed))))
+            {
+                target = &entry;
+                break;
+            }
+        }
+
+        // writes between these two stores are torn; the tag check in lookup()
+        // rejects them
+        target->bits.store(bits, std::memory_order_relaxed);
+        target->tag.store(tag, std::memory_order_release);
+    }
+} // namespace eos
@@ -0,0 +1,100 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_RESULT_STORE_HH
+#define EOS_GUARD_EOS_UTILS_RESULT_STORE_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eos
+{
+    /*!
+     * ResultStore is a content-addressed cache of scalar results, shared
+     * between the processes of one machine through a memory-mapped file.
+     *
+     * Farm scans of overlapping grids, and restarted jobs, re-evaluate
+     * identical (analysis, parameter point) pairs. The store maps a 64-bit
+     * key -- a hash of the analysis' structure and of the parameter point --
+     * to the value computed for it, so that a repeated evaluation becomes a
+     * table lookup. The table is a fixed-size, lossy hash table: colliding
+     * entries overwrite each other, and a lookup can therefore always miss,
+     * but never needs to block.
+     *
+     * Readers and writers synchronize without locks. Each entry pairs the
+     * value's bits with a tag that is the key XORed with those bits; an entry
+     * whose tag does not match is either torn or foreign, and is treated as a
+     * miss. This makes concurrent access by any number of processes safe,
+     * at the price of an occasional spurious recomputation.
+     *
+     * The store is inactive by default. It is enabled by pointing the
+     * EOS_RESULT_STORE environment variable at the store file, which is
+     * created on first use. The file must reside on node-local storage;
+     * mmap coherence across machines is not guaranteed by networked
+     * filesystems.
+     */
+    class ResultStore :
+        public InstantiationPolicy<ResultStore, Singleton>,
+        public PrivateImplementationPattern<ResultStore>
+    {
+        public:
+            ResultStore();
+
+            ~ResultStore();
+
+            /// Access to the singleton instance of ResultStore.
+            static ResultStore * instance();
+
+            /// Returns true if the store has been enabled and mapped successfully.
+            bool active() const;
+
+            /*!
+             * Extend a running FNV-1a hash by a block of raw bytes.
+             *
+             * @param seed  The hash computed so far, or ResultStore::initial_seed.
+             * @param data  Pointer to the bytes to be hashed.
+             * @param size  Number of bytes to be hashed.
+             */
+            static std::uint64_t hash(const std::uint64_t & seed, const void * data, const std::size_t & size);
+
+            /// Initial seed for ResultStore::hash, the FNV-1a offset basis.
+            static const std::uint64_t initial_seed;
+
+            /*!
+             * Look up the value stored for a key.
+             *
+             * @param key    The key to be looked up.
+             * @param value  On a hit, set to the stored value.
+             * @returns      True on a hit, false on a miss.
+             */
+            bool lookup(const std::uint64_t & key, double & value) const;
+
+            /*!
+             * Store a value for a key, potentially evicting a colliding entry.
+             *
+             * A no-op when the store is inactive.
+             */
+            void store(const std::uint64_t & key, const double & value);
+    };
+} // namespace eos
+
+#endif
@@ -0,0 +1,117 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/result-store.hh>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+class ResultStoreTest :
+    public TestCase
+{
+    public:
+        ResultStoreTest() :
+            TestCase("result_store_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // hashing: deterministic, and sensitive to every byte
+            {
+                const unsigned char data[] = { 0x01, 0x02, 0x03, 0x04 };
+                const unsigned char tweaked[] = { 0x01, 0x02, 0x03, 0x05 };
+
+                const std::uint64_t h1 = ResultStore::hash(ResultStore::initial_seed, data, sizeof(data));
+                const std::uint64_t h2 = ResultStore::hash(ResultStore::initial_seed, data, sizeof(data));
+                const std::uint64_t h3 = ResultStore::hash(ResultStore::initial_seed, tweaked, sizeof(tweaked));
+
+                TEST_CHECK_EQUAL(h1, h2);
+                TEST_CHECK(h1 != h3);
+
+                // extending a hash in two steps matches hashing in one
+                const std::uint64_t partial = ResultStore::hash(ResultStore::initial_seed, data, 2);
+                TEST_CHECK_EQUAL(ResultStore::hash(partial, data + 2, 2), h1);
+            }
+
+            // the singleton is constructed on first use, so the environment
+            // variable must be set before ResultStore::instance() is called
+            const std::string file = "/tmp/eos_result_store_TEST_" + std::to_string(::getpid());
+            ::setenv("EOS_RESULT_STORE", file.c_str(), 1);
+
+            ResultStore * store = ResultStore::instance();
+            TEST_CHECK(store->active());
+
+            // lookups in a fresh store miss
+            {
+                double value = 0.0;
+                TEST_CHECK(! store->lookup(17u, value));
+            }
+
+            // store and retrieve, including non-finite values
+            {
+                const std::uint64_t key = ResultStore::hash(ResultStore::initial_seed, "analysis", 8);
+
+                store->store(key, -1234.5);
+
+                double value = 0.0;
+                TEST_CHECK(store->lookup(key, value));
+                TEST_CHECK_EQUAL(value, -1234.5);
+
+                store->store(key + 1, -std::numeric_limits<double>::infinity());
+                TEST_CHECK(store->lookup(key + 1, value));
+                TEST_CHECK_EQUAL(value, -std::numeric_limits<double>::infinity());
+
+                // storing under the same key replaces the previous value
+                store->store(key, 42.0);
+                TEST_CHECK(store->lookup(key, value));
+                TEST_CHECK_EQUAL(value, 42.0);
+            }
+
+            // the table is lossy: an eviction must surface as a miss, never
+            // as a wrong value
+            {
+                for (std::uint64_t key = 1000u ; key < 2000u ; ++key)
+                {
+                    store->store(key, 0.5 * key);
+                }
+
+                for (std::uint64_t key = 1000u ; key < 2000u ; ++key)
+                {
+                    double value = 0.0;
+                    if (store->lookup(key, value))
+                    {
+                        TEST_CHECK_EQUAL(value, 0.5 * key);
+                    }
+                }
+            }
+
+            ::unsetenv("EOS_RESULT_STORE");
+            std::remove(file.c_str());
+        }
+} result_store_test;
@@ -20,7 +20,9 @@
 #ifndef EOS_GUARD_EOS_UTILS_RGE_IMPL_HH
 #define EOS_GUARD_EOS_UTILS_RGE_IMPL_HH 1
 
+#include <eos/utils/exception.hh>
 #include <eos/utils/rge.hh>
+#include <eos/utils/stringify.hh>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_linalg.h>
@@ -44,6 +46,8 @@ namespace eos
         _V(make_gsl_matrix(dim_, dim_)),
         _Vinv(make_gsl_matrix(dim_, dim_)),
         _U_0(make_gsl_matrix(dim_, dim_)),
+        _cached_alpha_s_mu(0.0),
+        _cached_alpha_s_0(0.0),
         _c_0_0(make_gsl_vector(dim_)),
         _tmp_matrix(make_gsl_matrix(dim_, dim_)),
         _tmp_vector(make_gsl_vector(dim_))
@@ -70,13 +74,17 @@ namespace eos
     }
 
     template <unsigned nf_, unsigned dim_>
-    std::array<double, dim_>
-    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
-            const std::array<double, dim_> & c_0_0) const
+    void
+    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::_update(const double & alpha_s_mu, const double & alpha_s_0) const
     {
-        // LL evolution:
-        //   c(mu) = U_0 . c(mu_0),
-        // where
+        // the evolution matrix depends only on the anomalous dimensions and the
+        // two couplings; reuse it as long as the couplings do not change
+        if ((_cached_alpha_s_mu == alpha_s_mu) && (_cached_alpha_s_0 == alpha_s_0))
+        {
+            return;
+        }
+
+        // LL evolution matrix:
         //   U_0 = V . diag[ eta^(gamma_0_ev / (2 * beta_0)) ] . V^-1
         // since
         //   gamma_0 = V^-1,T . diag[ gamma_0_ev ] . V^T,
@@ -91,13 +99,31 @@ namespace eos
         for (unsigned i = 0; i < dim_; ++i)
         {
             gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
         }
         // tmp_matrix <- V . U_0
         gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
         // U_0 <- tmp_matrix . V
         gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
 
+        _cached_alpha_s_mu = alpha_s_mu;
+        _cached_alpha_s_0  = alpha_s_0;
+    }
+
+    template <unsigned nf_, unsigned dim_>
+    std::array<double, dim_>
+    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
+            const std::array<double, dim_> & c_0_0) const
+    {
+        // LL evolution:
+        //   c(mu) = U_0 . c(mu_0)
+
+        _update(alpha_s_mu, alpha_s_0);
+
+        for (unsigned i = 0; i < dim_; ++i)
+        {
+            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
+        }
+
         // tmp_vector <- U_0 * c_0_0
         gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
 
@@ -110,6 +136,37 @@ namespace eos
         return result;
     }
 
+    template <unsigned nf_, unsigned dim_>
+    std::vector<std::array<double, dim_>>
+    MultiplicativeRenormalizationGroupEvolution<accuracy::LL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
+            const std::vector<std::array<double, dim_>> & c_0_0) const
+    {
+        _update(alpha_s_mu, alpha_s_0);
+
+        std::vector<std::array<double, dim_>> results;
+        results.reserve(c_0_0.size());
+
+        for (const auto & c : c_0_0)
+        {
+            for (unsigned i = 0; i < dim_; ++i)
+            {
+                gsl_vector_set(_c_0_0.get(), i, c[i]);
+            }
+
+            // tmp_vector <- U_0 * c_0_0
+            gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
+
+            std::array<double, dim_> result;
+            for (unsigned i = 0; i < dim_; ++i)
+            {
+                result[i] = gsl_vector_get(_tmp_vector.get(), i);
+            }
+            results.push_back(result);
+        }
+
+        return results;
+    }
+
     template <unsigned nf_, unsigned dim_>
     MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::MultiplicativeRenormalizationGroupEvolution(
             const std::array<double, dim_> & gamma_0_ev,
@@ -121,6 +178,10 @@ namespace eos
         _G(make_gsl_matrix(dim_, dim_)),
         _U_0(make_gsl_matrix(dim_, dim_)),
         _J(make_gsl_matrix(dim_, dim_)),
+        _A(make_gsl_matrix(dim_, dim_)),
+        _B(make_gsl_matrix(dim_, dim_)),
+        _cached_alpha_s_mu(0.0),
+        _cached_alpha_s_0(0.0),
         _c_0_0(make_gsl_vector(dim_)),
         _c_0_1(make_gsl_vector(dim_)),
         _tmp_matrix(make_gsl_matrix(dim_, dim_)),
@@ -183,13 +244,21 @@ namespace eos
     }
 
     template <unsigned nf_, unsigned dim_>
-    std::array<double, dim_>
-    MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
-            const std::array<double, dim_> & c_0_0, const std::array<double, dim_> & c_0_1) const
+    void
+    MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::_update(const double & alpha_s_mu, const double & alpha_s_0) const
     {
-        // NLL evolution:
-        //   U = (1 + a_s_mu J) . U_0 . (1 - a_s_0 J)
-        //   c(mu) = U . c_0(mu_0) + a_s_0 * U_0 . c_0_1(mu_0)
+        // the evolution matrices depend only on the anomalous dimensions and
+        // the two couplings; reuse them as long as the couplings do not change
+        if ((_cached_alpha_s_mu == alpha_s_mu) && (_cached_alpha_s_0 == alpha_s_0))
+        {
+            return;
+        }
+
+        // NLL evolution, cf. [BBL:1995A], p. 34, eqs. (III.93) & (III.99):
+        //   c(mu) = A . c_0_0(mu_0) + B . c_0_1(mu_0)
+        // with the affine representation
+        //   A = (1 + a_s_mu J) . U_0 . (1 - a_s_0 J),
+        //   B = a_s_0 * (1 + a_s_mu J) . U_0,
         // where
         //   a_s(x) = alpha_s(x) / (4 pi),
         //   U_0 = V . diag[ eta^(gamma_0_ev / (2 * beta_0)) ] . V^-1
@@ -209,35 +278,57 @@ namespace eos
         for (unsigned i = 0; i < dim_; ++i)
         {
             gsl_matrix_set(_U_0.get(), i, i, std::pow(eta, _gamma_0_ev[i] / (2.0 * beta_0)));
-            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
-            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
         }
         // tmp_matrix <- V . U_0
         gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _V.get(), _U_0.get(), 0.0, _tmp_matrix.get());
         // U_0 <- tmp_matrix * V^-1
         gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _Vinv.get(), 0.0, _U_0.get());
 
-        // tmp_vector := c_0_0 + alpha_s_0 / (4 pi) * (c_0_1 - J * c_0_0), cf. [BBL:1995A], p. 34, eq. (III.99)
-        // tmp_vector <- c_0_1
-        gsl_vector_memcpy(_tmp_vector.get(), _c_0_1.get());
-        // tmp_vector <- -1.0 * J * c_0_0 + 1.0 * tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, -1.0, _J.get(), _c_0_0.get(), 1.0, _tmp_vector.get());
-        // tmp_vector <- c_0_0 + alpha_s(mu_0) / (4 pi) * tmp_vector
-        gsl_vector_axpby(1.0, _c_0_0.get(), alpha_s_0 / (4.0 * M_PI), _tmp_vector.get());
-
-        // tmp_matrix <- unit_matrix
-        gsl_matrix_set_zero(_tmp_matrix.get());
+        // tmp_matrix <- 1 + alpha_s(mu) / (4 pi) * J
         gsl_matrix_set_identity(_tmp_matrix.get());
-        // tmp_matrix2 <- alpha_s(mu) / (4 pi) * J
         gsl_matrix_memcpy(_tmp_matrix_2.get(), _J.get());
         gsl_matrix_scale(_tmp_matrix_2.get(), alpha_s_mu / (4.0 * M_PI));
-        // tmp_matrix <- tmp_matrix + tmp_matrix_2
         gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
 
-        // tmp_vector_2 <- U_0 . tmp_vector
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _U_0.get(), _tmp_vector.get(), 0.0, _tmp_vector_2.get());
-        // tmp_vector <- tmp_matrix . tmp_vector_2
-        gsl_blas_dgemv(CblasNoTrans, 1.0, _tmp_matrix.get(), _tmp_vector_2.get(), 0.0, _tmp_vector.get());
+        // B <- (1 + a_s_mu J) . U_0
+        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _tmp_matrix.get(), _U_0.get(), 0.0, _B.get());
+
+        // tmp_matrix <- 1 - alpha_s(mu_0) / (4 pi) * J
+        gsl_matrix_set_identity(_tmp_matrix.get());
+        gsl_matrix_memcpy(_tmp_matrix_2.get(), _J.get());
+        gsl_matrix_scale(_tmp_matrix_2.get(), -1.0 * alpha_s_0 / (4.0 * M_PI));
+        gsl_matrix_add(_tmp_matrix.get(), _tmp_matrix_2.get());
+
+        // A <- B . (1 - a_s_0 J)
+        gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, _B.get(), _tmp_matrix.get(), 0.0, _A.get());
+
+        // B <- a_s_0 * B
+        gsl_matrix_scale(_B.get(), alpha_s_0 / (4.0 * M_PI));
+
+        _cached_alpha_s_mu = alpha_s_mu;
+        _cached_alpha_s_0  = alpha_s_0;
+    }
+
+    template <unsigned nf_, unsigned dim_>
+    std::array<double, dim_>
+    MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
+            const std::array<double, dim_> & c_0_0, const std::array<double, dim_> & c_0_1) const
+    {
+        // NLL evolution:
+        //   c(mu) = A . c_0_0(mu_0) + B . c_0_1(mu_0)
+
+        _update(alpha_s_mu, alpha_s_0);
+
+        for (unsigned i = 0; i < dim_; ++i)
+        {
+            gsl_vector_set(_c_0_0.get(), i, c_0_0[i]);
+            gsl_vector_set(_c_0_1.get(), i, c_0_1[i]);
+        }
+
+        // tmp_vector <- A . c_0_0
+        gsl_blas_dgemv(CblasNoTrans, 1.0, _A.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
+        // tmp_vector <- B . c_0_1 + tmp_vector
+        gsl_blas_dgemv(CblasNoTrans, 1.0, _B.get(), _c_0_1.get(), 1.0, _tmp_vector.get());
 
         std::array<double, dim_> result;
         for (unsigned i = 0; i < dim_; ++i)
@@ -247,6 +338,46 @@ namespace eos
 
         return result;
     }
+
+    template <unsigned nf_, unsigned dim_>
+    std::vector<std::array<double, dim_>>
+    MultiplicativeRenormalizationGroupEvolution<accuracy::NLL, nf_, dim_>::evolve(const double & alpha_s_mu, const double & alpha_s_0,
+            const std::vector<std::array<double, dim_>> & c_0_0, const std::vector<std::array<double, dim_>> & c_0_1) const
+    {
+        if (c_0_0.size() != c_0_1.size())
+        {
+            throw InternalError("MultiplicativeRenormalizationGroupEvolution<accuracy::NLL>::evolve: mismatch of the numbers of initial conditions ("
+                    + stringify(c_0_0.size()) + " vs " + stringify(c_0_1.size()) + ")");
+        }
+
+        _update(alpha_s_mu, alpha_s_0);
+
+        std::vector<std::array<double, dim_>> results;
+        results.reserve(c_0_0.size());
+
+        for (auto i0 = c_0_0.cbegin(), i1 = c_0_1.cbegin(); i0 != c_0_0.cend(); ++i0, ++i1)
+        {
+            for (unsigned i = 0; i < dim_; ++i)
+            {
+                gsl_vector_set(_c_0_0.get(), i, (*i0)[i]);
+                gsl_vector_set(_c_0_1.get(), i, (*i1)[i]);
+            }
+
+            // tmp_vector <- A . c_0_0
+            gsl_blas_dgemv(CblasNoTrans, 1.0, _A.get(), _c_0_0.get(), 0.0, _tmp_vector.get());
+            // tmp_vector <- B . c_0_1 + tmp_vector
+            gsl_blas_dgemv(CblasNoTrans, 1.0, _B.get(), _c_0_1.get(), 1.0, _tmp_vector.get());
+
+            std::array<double, dim_> result;
+            for (unsigned i = 0; i < dim_; ++i)
+            {
+                result[i] = gsl_vector_get(_tmp_vector.get(), i);
+            }
+            results.push_back(result);
+        }
+
+        return results;
+    }
 }
 
 #endif /* EOS_GUARD_EOS_UTILS_RGE_IMPL_HH */
@@ -22,6 +22,8 @@
 
 #include <eos/maths/gsl-interface.hh>
 
+#include <vector>
+
 namespace eos
 {
 
@@ -42,8 +44,10 @@ namespace eos
             std::array<double, dim_> _gamma_0_ev;
             GSLMatrixPtr _V, _Vinv;
 
-            // evolution matrix
+            // evolution matrix, cached for the pair of couplings below; it depends
+            // only on the anomalous dimensions and the ratio of the couplings
             GSLMatrixPtr _U_0;
+            mutable double _cached_alpha_s_mu, _cached_alpha_s_0;
 
             // initial conditions
             GSLVectorPtr _c_0_0;
@@ -52,6 +56,9 @@ namespace eos
             GSLMatrixPtr _tmp_matrix;
             GSLVectorPtr _tmp_vector;
 
+            // recompute the evolution matrix if the couplings changed since the last call
+            void _update(const double & alpha_s_mu, const double & alpha_s_0) const;
+
         public:
             /*!
              * Constructor.
@@ -82,6 +89,19 @@ namespace eos
              * @param c_0_0 The initial conditions for the Wilson coefficients at the scale mu_0 at order alpha_s^0
              */
             std::array<double, dim_> evolve(const double & alpha_s_mu, const double & alpha_s_0, const std::array<double, dim_> & c_0_0) const;
+
+            /*!
+             * Evolve several sets of Wilson coefficients between the same pair of scales
+             * at leading-logarithmic accuracy.
+             *
+             * The evolution matrix is computed only once and applied to each of the sets,
+             * which is beneficial for scan grids of Wilson coefficients.
+             *
+             * @param alpha_s_mu The value of the strong coupling constant at the scale mu.
+             * @param alpha_s_0 The value of the strong coupling constant at the scale mu_0.
+             * @param c_0_0 The sets of initial conditions for the Wilson coefficients at the scale mu_0 at order alpha_s^0
+             */
+            std::vector<std::array<double, dim_>> evolve(const double & alpha_s_mu, const double & alpha_s_0, const std::vector<std::array<double, dim_>> & c_0_0) const;
     };
 
     // Next-to-leading logarithmic accuracy, see [BBL:1995A], p. 34, eq. (III.93)
@@ -100,6 +120,13 @@ namespace eos
             GSLMatrixPtr _U_0;
             GSLMatrixPtr _J;
 
+            // affine representation of the NLL evolution,
+            //   c(mu) = A . c_0_0 + B . c_0_1,
+            // cached for the pair of couplings below; it depends only on the
+            // anomalous dimensions and the two couplings
+            GSLMatrixPtr _A, _B;
+            mutable double _cached_alpha_s_mu, _cached_alpha_s_0;
+
             // initial conditions
             GSLVectorPtr _c_0_0;
             GSLVectorPtr _c_0_1;
@@ -108,6 +135,9 @@ namespace eos
             GSLMatrixPtr _tmp_matrix, _tmp_matrix_2;
             GSLVectorPtr _tmp_vector, _tmp_vector_2;
 
+            // recompute the evolution matrices if the couplings changed since the last call
+            void _update(const double & alpha_s_mu, const double & alpha_s_0) const;
+
         public:
             /*!
              * Constructor.
@@ -143,6 +173,22 @@ namespace eos
              */
             std::array<double, dim_> evolve(const double & alpha_s_mu, const double & alpha_s_0, const std::array<double, dim_> & c_0_0,
                     const std::array<double, dim_> & c_0_1) const;
+
+            /*!
+             * Evolve several sets of Wilson coefficients between the same pair of scales
+             * at next-to-leading logarithmic accuracy.
+             *
+             * The evolution matrices are computed only once and applied to each of the sets,
+             * which is beneficial for scan grids of Wilson coefficients.
+             *
+             * @param alpha_s_mu The value of the strong coupling constant at the scale mu.
+             * @param alpha_s_0 The value of the strong coupling constant at the scale mu_0.
+             * @param c_0_0 The sets of initial conditions for the Wilson coefficients at the scale mu_0 at order alpha_s^0
+             * @param c_0_1 The sets of initial conditions for the Wilson coefficients at the scale mu_0 at order alpha_s^1,
+             *              reduced by r^T . c_0_0, cf. [BBL:1995A], p. 34, eqs. (III.84) & (III.99).
+             */
+            std::vector<std::array<double, dim_>> evolve(const double & alpha_s_mu, const double & alpha_s_0, const std::vector<std::array<double, dim_>> & c_0_0,
+                    const std::vector<std::array<double, dim_>> & c_0_1) const;
     };
 }
 
@@ -22,6 +22,7 @@
 #include <eos/utils/rge-impl.hh>
 
 #include <array>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -112,6 +113,18 @@ class MultiplicativeRGELLTest :
                 static const double eps = 1.0e-6;
                 TEST_CHECK_NEARLY_EQUAL(result[0], +0.134504, eps);
                 TEST_CHECK_NEARLY_EQUAL(result[1], +1.733962, eps);
+
+                // batched evolution agrees with the one-by-one results
+                const std::vector<std::array<double, 2u>> batch_c_0_0{ { 0.0, 1.0 }, { 1.0, 0.0 }, { 0.3, -0.7 } };
+                const auto batch_results = rge.evolve(alpha_s_mu, alpha_s_0, batch_c_0_0);
+
+                TEST_CHECK_EQUAL(batch_results.size(), batch_c_0_0.size());
+                for (unsigned i = 0 ; i < batch_c_0_0.size() ; ++i)
+                {
+                    const auto reference = rge.evolve(alpha_s_mu, alpha_s_0, batch_c_0_0[i]);
+                    TEST_CHECK_NEARLY_EQUAL(batch_results[i][0], reference[0], eps);
+                    TEST_CHECK_NEARLY_EQUAL(batch_results[i][1], reference[1], eps);
+                }
             }
         }
 } multiplicative_rge_ll_test;
@@ -228,6 +241,23 @@ class MultiplicativeRGENLLTest :
                 static const double eps = 1.0e-6;
                 TEST_CHECK_NEARLY_EQUAL(result[0], +0.229589, eps);
                 TEST_CHECK_NEARLY_EQUAL(result[1], +1.826340, eps);
+
+                // batched evolution agrees with the one-by-one results
+                const std::vector<std::array<double, 2u>> batch_c_0_0{ { 0.0, 1.0 }, { 1.0, 0.0 }, { 0.3, -0.7 } };
+                const std::vector<std::array<double, 2u>> batch_c_0_1{ { 11.0 / 2.0, -11.0 / 6.0 }, { 0.0, 0.0 }, { -1.2, 0.4 } };
+                const auto batch_results = rge.evolve(alpha_s_mu, alpha_s_0, batch_c_0_0, batch_c_0_1);
+
+                TEST_CHECK_EQUAL(batch_results.size(), batch_c_0_0.size());
+                for (unsigned i = 0 ; i < batch_c_0_0.size() ; ++i)
+                {
+                    const auto reference = rge.evolve(alpha_s_mu, alpha_s_0, batch_c_0_0[i], batch_c_0_1[i]);
+                    TEST_CHECK_NEARLY_EQUAL(batch_results[i][0], reference[0], eps);
+                    TEST_CHECK_NEARLY_EQUAL(batch_results[i][1], reference[1], eps);
+                }
+
+                // mismatching numbers of initial conditions are an error
+                const std::vector<std::array<double, 2u>> short_c_0_1{ { 0.0, 0.0 } };
+                TEST_CHECK_THROWS(InternalError, rge.evolve(alpha_s_mu, alpha_s_0, batch_c_0_0, short_c_0_1));
             }
         }
 } multiplicative_rge_nll_test;
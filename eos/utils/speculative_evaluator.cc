@@ -0,0 +1,226 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/condition_variable.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/speculative_evaluator.hh>
+#include <eos/utils/thread.hh>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace eos
+{
+    template <> struct
+    Implementation<SpeculativeEvaluator>
+    {
+        // the live parameter set, modified by the client
+        Parameters live_parameters;
+
+        // staging area: a snapshot of the live values, taken on the client's
+        // thread so that the worker never reads the live set
+        Parameters staging_parameters;
+
+        // the worker's private clone, and the cache bound to it
+        Parameters speculative_parameters;
+
+        ObservableCache cache;
+
+        // protects the staging area and the state below
+        Mutex mutex;
+
+        // signalled when a request arrives, and when a speculation completes
+        ConditionVariable request_arrival;
+        ConditionVariable request_completion;
+
+        // serialises cache updates on the worker against add()
+        Mutex evaluation_mutex;
+
+        // generation of the live set at the time of the last request, of the
+        // request the worker is currently evaluating, and of the last
+        // completed speculation
+        std::uint64_t requested_generation;
+        std::uint64_t in_flight_generation;
+        std::uint64_t completed_generation;
+
+        // whether a request has not yet been picked up by the worker, whether
+        // the worker is currently evaluating one, and whether the cache's
+        // predictions are valid at completed_generation
+        bool pending;
+        bool in_flight;
+        bool valid;
+
+        bool shutdown;
+
+        std::unique_ptr<Thread> thread;
+
+        Implementation(const Parameters & parameters) :
+            live_parameters(parameters),
+            staging_parameters(parameters.clone()),
+            speculative_parameters(parameters.clone()),
+            cache(speculative_parameters),
+            requested_generation(parameters.generation()),
+            in_flight_generation(parameters.generation()),
+            completed_generation(parameters.generation()),
+            pending(false),
+            in_flight(false),
+            valid(false),
+            shutdown(false)
+        {
+            thread.reset(new Thread(std::bind(std::mem_fn(&Implementation<SpeculativeEvaluator>::work), this)));
+        }
+
+        ~Implementation()
+        {
+            {
+                Lock l(mutex);
+
+                shutdown = true;
+                request_arrival.broadcast();
+            }
+
+            // joins the worker
+            thread.reset();
+        }
+
+        // must be called with the mutex held
+        void
+        request(const std::uint64_t & generation)
+        {
+            staging_parameters.update(live_parameters);
+            requested_generation = generation;
+            pending = true;
+            request_arrival.signal();
+        }
+
+        void
+        work()
+        {
+            while (true)
+            {
+                {
+                    Lock l(mutex);
+
+                    while ((! shutdown) && (! pending))
+                    {
+                        request_arrival.wait(mutex);
+                    }
+
+                    if (shutdown)
+                    {
+                        return;
+                    }
+
+                    pending = false;
+                    in_flight = true;
+                    in_flight_generation = requested_generation;
+                    speculative_parameters.update(staging_parameters);
+                }
+
+                // evaluate without the state mutex, so that notify() never
+                // blocks on a running evaluation
+                {
+                    Lock l(evaluation_mutex);
+
+                    cache.update();
+                }
+
+                {
+                    Lock l(mutex);
+
+                    in_flight = false;
+                    completed_generation = in_flight_generation;
+                    valid = true;
+                    request_completion.broadcast();
+                }
+            }
+        }
+    };
+
+    SpeculativeEvaluator::SpeculativeEvaluator(const Parameters & parameters) :
+        PrivateImplementationPattern<SpeculativeEvaluator>(new Implementation<SpeculativeEvaluator>(parameters))
+    {
+    }
+
+    SpeculativeEvaluator::~SpeculativeEvaluator()
+    {
+    }
+
+    ObservableCache::Id
+    SpeculativeEvaluator::add(const ObservablePtr & observable)
+    {
+        // fences off a running cache update; never held together with the
+        // state mutex by the worker, so the fixed order add() uses cannot
+        // deadlock
+        Lock l1(_imp->evaluation_mutex);
+        Lock l2(_imp->mutex);
+
+        const auto id = _imp->cache.add(observable->clone(_imp->speculative_parameters));
+        // the new observable has not been evaluated yet
+        _imp->valid = false;
+
+        return id;
+    }
+
+    void
+    SpeculativeEvaluator::notify()
+    {
+        Lock l(_imp->mutex);
+
+        const std::uint64_t generation = _imp->live_parameters.generation();
+        if (_imp->valid && (_imp->completed_generation == generation))
+        {
+            return;
+        }
+
+        _imp->request(generation);
+    }
+
+    double
+    SpeculativeEvaluator::value(const ObservableCache::Id & id)
+    {
+        Lock l(_imp->mutex);
+
+        while (true)
+        {
+            // re-read the target each round: the live set may have moved on
+            // while we waited, and we always serve the latest point
+            const std::uint64_t generation = _imp->live_parameters.generation();
+
+            if (_imp->valid && (_imp->completed_generation == generation))
+            {
+                // the worker cannot be mid-update here: any request it could
+                // be evaluating postdates completed_generation, and the
+                // generation counter never decreases back to it
+                return _imp->cache[id];
+            }
+
+            if ((! (_imp->pending && (_imp->requested_generation == generation)))
+                    && (! (_imp->in_flight && (_imp->in_flight_generation == generation))))
+            {
+                _imp->request(generation);
+            }
+
+            _imp->request_completion.wait(_imp->mutex);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_SPECULATIVE_EVALUATOR_HH
+#define EOS_GUARD_EOS_UTILS_SPECULATIVE_EVALUATOR_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+namespace eos
+{
+    /*!
+     * Pre-evaluates a set of registered observables on a background thread
+     * whenever the live parameter set changes, so that interactive clients
+     * (e.g. notebook re-plots) find up-to-date predictions ready in the cache
+     * instead of blocking on their evaluation.
+     *
+     * The evaluator keeps a private clone of the live Parameters, and an
+     * ObservableCache bound to that clone; the background thread only ever
+     * touches the clone. Invalidation piggy-backs on the parameter set's
+     * generation counter: a prediction is served straight from the cache if
+     * and only if it was computed at the live set's current generation.
+     *
+     * The client is expected to call notify() and value() from the same
+     * thread that modifies the live parameter set.
+     */
+    class SpeculativeEvaluator :
+        public PrivateImplementationPattern<SpeculativeEvaluator>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters The live parameter set whose changes shall be speculated upon.
+             */
+            SpeculativeEvaluator(const Parameters & parameters);
+
+            /// Destructor.
+            ~SpeculativeEvaluator();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /*!
+             * Register an observable with the evaluator and return the id
+             * under which its predictions can be retrieved. The observable is
+             * internally rebound to the evaluator's private parameter clone.
+             *
+             * @param observable The observable which shall be evaluated speculatively.
+             */
+            ObservableCache::Id add(const ObservablePtr & observable);
+
+            /*!
+             * Notify the evaluator that the live parameter set may have
+             * changed. Takes a snapshot of the live values and returns
+             * immediately; the registered observables are then evaluated at
+             * the new point on the background thread.
+             */
+            void notify();
+
+            /*!
+             * Retrieve the prediction for the given observable at the live
+             * parameter set's current point. If the speculative evaluation
+             * for the current generation has completed, this is a plain cache
+             * look-up; otherwise, it waits for (or triggers) the evaluation.
+             *
+             * @param id The unique ObservableCache::Id returned by add().
+             */
+            double value(const ObservableCache::Id & id);
+            ///@}
+    };
+}
+
+#endif
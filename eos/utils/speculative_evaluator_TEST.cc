@@ -0,0 +1,150 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/speculative_evaluator.hh>
+
+#include <atomic>
+#include <memory>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // doubles the value of a single parameter, and counts its evaluations
+    class TestObservable :
+        public Observable
+    {
+        private:
+            Parameters _parameters;
+
+            UsedParameter _parameter;
+
+            Kinematics _kinematics;
+
+            Options _options;
+
+            QualifiedName _name;
+
+            std::shared_ptr<std::atomic<unsigned>> _evaluations;
+
+        public:
+            TestObservable(const Parameters & parameters, const std::string & parameter_name,
+                    const std::shared_ptr<std::atomic<unsigned>> & evaluations) :
+                _parameters(parameters),
+                _parameter(parameters[parameter_name], *this),
+                _name("test::observable"),
+                _evaluations(evaluations)
+            {
+            }
+
+            virtual ~TestObservable()
+            {
+            }
+
+            virtual double evaluate() const
+            {
+                _evaluations->fetch_add(1);
+
+                return 2.0 * _parameter();
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return ObservablePtr(new TestObservable(_parameters.clone(), _parameter.name(), _evaluations));
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new TestObservable(parameters, _parameter.name(), _evaluations));
+            }
+
+            virtual Parameters parameters()
+            {
+                return _parameters;
+            }
+
+            virtual Kinematics kinematics()
+            {
+                return _kinematics;
+            }
+
+            virtual Options options()
+            {
+                return _options;
+            }
+
+            virtual const QualifiedName & name() const
+            {
+                return _name;
+            }
+    };
+}
+
+class SpeculativeEvaluatorTest :
+    public TestCase
+{
+    public:
+        SpeculativeEvaluatorTest() :
+            TestCase("speculative_evaluator_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            Parameters parameters = Parameters::Defaults();
+            Parameter mass = parameters["mass::c"];
+
+            auto evaluations = std::make_shared<std::atomic<unsigned>>(0);
+
+            SpeculativeEvaluator evaluator(parameters);
+            auto id = evaluator.add(ObservablePtr(new TestObservable(parameters, "mass::c", evaluations)));
+
+            // a plain value() triggers the evaluation and waits for it
+            mass = 1.27;
+            TEST_CHECK_NEARLY_EQUAL(evaluator.value(id), 2.54, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 1u);
+
+            // at an unchanged point, value() is a cache hit
+            TEST_CHECK_NEARLY_EQUAL(evaluator.value(id), 2.54, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 1u);
+
+            // a speculated point is evaluated exactly once, whether value()
+            // arrives before or after the background evaluation completes
+            mass = 1.50;
+            evaluator.notify();
+            TEST_CHECK_NEARLY_EQUAL(evaluator.value(id), 3.00, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 2u);
+
+            // a redundant notify() does not re-evaluate
+            evaluator.notify();
+            TEST_CHECK_NEARLY_EQUAL(evaluator.value(id), 3.00, eps);
+            TEST_CHECK_EQUAL(evaluations->load(), 2u);
+
+            // changes to the live set between notify() and value() are served
+            // at the latest point
+            mass = 1.10;
+            evaluator.notify();
+            mass = 1.30;
+            TEST_CHECK_NEARLY_EQUAL(evaluator.value(id), 2.60, eps);
+        }
+} speculative_evaluator_test;
@@ -1,7 +1,7 @@
 /* vim: set sw=4 sts=4 et foldmethod=syntax : */
 
 /*
- * Copyright (c) 2010, 2011, 2021 Danny van Dyk
+ * Copyright (c) 2010, 2011, 2021, 2026 Danny van Dyk
  *
  * This file is part of the EOS project. EOS is free software;
  * you can redistribute it and/or modify it under the terms of the GNU General
@@ -26,15 +26,82 @@
 #include <eos/utils/thread.hh>
 #include <eos/utils/thread_pool.hh>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
 #include <list>
+#include <memory>
+#include <vector>
 
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
 
 namespace eos
 {
+    namespace
+    {
+        // Index of this thread's deque within the pool; -1 for threads that do not belong to the pool.
+        thread_local int thread_pool_worker_index = -1;
+
+        /*
+         * Pin the calling pool thread to a single CPU, assigning the workers
+         * round-robin over the CPUs available to the process. A pinned worker
+         * stays on a fixed core and hence on a fixed NUMA node, which avoids
+         * cross-socket migration of its working set on multi-socket machines.
+         *
+         * Pinning is opt-in via the EOS_PIN_THREADS environment variable, since
+         * it is counterproductive on machines shared with other workloads.
+         */
+        void maybe_pin_thread(const unsigned & index)
+        {
+            static const bool pin = (nullptr != std::getenv("EOS_PIN_THREADS"));
+
+            if (! pin)
+                return;
+
+            cpu_set_t available;
+            if (0 != pthread_getaffinity_np(pthread_self(), sizeof(available), &available))
+                return;
+
+            const unsigned n_available = CPU_COUNT(&available);
+            if (0 == n_available)
+                return;
+
+            // select the index-th available CPU, modulo the number of CPUs
+            const unsigned target = index % n_available;
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (unsigned cpu = 0, seen = 0 ; cpu < CPU_SETSIZE ; ++cpu)
+            {
+                if (! CPU_ISSET(cpu, &available))
+                    continue;
+
+                if (seen++ == target)
+                {
+                    CPU_SET(cpu, &mask);
+                    break;
+                }
+            }
+
+            pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+        }
+    }
+
     template <>
     struct Implementation<ThreadPool>
     {
+        using Job = std::pair<Ticket, std::function<void (void)> *>;
+
+        // Per-thread work deque: the owning thread pushes and pops at the back,
+        // whilst thieves steal from the front.
+        struct Worker
+        {
+            Mutex mutex;
+
+            std::deque<Job> deque;
+        };
+
         unsigned number_of_threads;
         unsigned long nominal_capacity;
         unsigned long stop_capacity;
@@ -52,15 +119,57 @@ namespace eos
 
         unsigned long waiting_for_jobs;
         unsigned long pending_jobs;
+        unsigned long queued_jobs;
+
+        std::vector<std::unique_ptr<Worker>> workers;
 
-        std::list<std::pair<Ticket, std::function<void (void)> *>> queue;
+        // Round-robin index used to spread jobs submitted by non-pool threads.
+        std::atomic<unsigned> next_worker;
 
         std::list<Thread *> threads;
 
-        void thread_function()
+        bool pop_local(const unsigned & index, Job & job)
         {
-            std::function<void (void)> * job;
-            Ticket ticket;
+            Worker & worker = *workers[index];
+
+            Lock l(worker.mutex);
+
+            if (worker.deque.empty())
+                return false;
+
+            job = worker.deque.back();
+            worker.deque.pop_back();
+
+            return true;
+        }
+
+        bool steal(const unsigned & index, Job & job)
+        {
+            for (unsigned offset = 1 ; offset < number_of_threads ; ++offset)
+            {
+                Worker & victim = *workers[(index + offset) % number_of_threads];
+
+                Lock l(victim.mutex);
+
+                if (victim.deque.empty())
+                    continue;
+
+                job = victim.deque.front();
+                victim.deque.pop_front();
+
+                return true;
+            }
+
+            return false;
+        }
+
+        void thread_function(const unsigned & index)
+        {
+            thread_pool_worker_index = index;
+
+            maybe_pin_thread(index);
+
+            Job job;
 
             do
             {
@@ -70,33 +179,41 @@ namespace eos
                         break;
                 }
 
-                job = 0;
+                // obtain work: first from our own deque, then by stealing from our siblings
+                bool found = pop_local(index, job);
 
+                if (! found)
+                    found = steal(index, job);
+
+                if (! found)
                 {
                     Lock l(*job_mutex);
 
-                    if (queue.empty())
+                    // re-check under the lock: a job may have arrived since our last scan
+                    if (0 == queued_jobs)
                     {
                         waiting_for_jobs += 1;
                         job_arrival->wait(*job_mutex);
                         waiting_for_jobs -= 1;
                     }
 
-                    if (queue.empty())
                     {
-                        Lock l(*terminate_mutex);
+                        Lock l2(*terminate_mutex);
                         if (terminate)
                             break;
-                        else
-                            continue;
                     }
 
-                    ticket = queue.front().first;
-                    job = queue.front().second;
-                    queue.pop_front();
+                    continue;
+                }
+
+                {
+                    Lock l(*job_mutex);
+                    queued_jobs -= 1;
                 }
 
-                (*job)();
+                (*job.second)();
+                delete job.second;
+
                 {
                     Lock l(*job_mutex);
                     pending_jobs -= 1;
@@ -105,7 +222,7 @@ namespace eos
                         job_capacity->signal();
 
                 }
-                ticket.mark();
+                job.first.mark();
             }
             while (true);
         }
@@ -136,11 +253,18 @@ namespace eos
             job_arrival(new ConditionVariable),
             job_capacity(new ConditionVariable),
             waiting_for_jobs(0),
-            pending_jobs(0)
+            pending_jobs(0),
+            queued_jobs(0),
+            next_worker(0)
         {
             for (unsigned i(0) ; i < number_of_threads ; ++i)
             {
-                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this)));
+                workers.push_back(std::make_unique<Worker>());
+            }
+
+            for (unsigned i(0) ; i < number_of_threads ; ++i)
+            {
+                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this, i)));
             }
         }
 
@@ -161,6 +285,48 @@ namespace eos
                 delete thread;
             }
         }
+
+        Ticket enqueue(const std::function<void (void)> & job)
+        {
+            Job item(Ticket(), new std::function<void (void)>(job));
+
+            // pool threads push to their own deque for locality; foreign threads
+            // spread their jobs round-robin across the deques
+            unsigned index;
+            if (thread_pool_worker_index >= 0)
+            {
+                index = thread_pool_worker_index;
+            }
+            else
+            {
+                index = next_worker.fetch_add(1, std::memory_order_relaxed) % number_of_threads;
+            }
+
+            {
+                Lock l(workers[index]->mutex);
+                workers[index]->deque.push_back(item);
+            }
+
+            {
+                Lock l(*job_mutex);
+                pending_jobs += 1;
+                queued_jobs += 1;
+
+                if (waiting_for_jobs > 0)
+                    job_arrival->signal();
+            }
+
+            return item.first;
+        }
+
+        unsigned idle_threads()
+        {
+            Lock l(*job_mutex);
+
+            // workers that have already been woken for queued jobs are not
+            // idle for long; discount them
+            return (waiting_for_jobs > queued_jobs) ? waiting_for_jobs - queued_jobs : 0;
+        }
     };
 
     ThreadPool::ThreadPool() :
@@ -176,18 +342,88 @@ namespace eos
     Ticket
     ThreadPool::enqueue(const std::function<void (void)> & job)
     {
-        std::pair<Ticket, std::function<void (void)> *> item(Ticket(), new std::function<void (void)>(job));
+        return _imp->enqueue(job);
+    }
 
+    void
+    ThreadPool::enqueue(const std::function<void (void)> & job, CompletionLatch & latch)
+    {
+        // register before dispatching, so that a concurrent wait() cannot
+        // miss the task; completion is one atomic decrement per task
+        latch.add();
+
+        _imp->enqueue([job, latch] () mutable
         {
-            Lock l(*_imp->job_mutex);
-            _imp->queue.push_back(item);
-            _imp->pending_jobs += 1;
+            job();
+            latch.complete();
+        });
+    }
 
-            if (_imp->waiting_for_jobs > 0)
-                _imp->job_arrival->signal();
+    void
+    ThreadPool::parallel_for(const size_t & begin, const size_t & end, const std::function<void (size_t, size_t)> & f, const size_t & chunk_size)
+    {
+        if (begin >= end)
+            return;
+
+        const size_t n = end - begin;
+
+        // cooperative nesting: a parallel loop inside a pool job may only
+        // recruit workers that are currently idle. When every worker is busy
+        // with the outer level, the loop runs inline on the calling thread,
+        // without any task dispatch; when cores are idle, they are donated to
+        // the inner loop.
+        const bool nested = (thread_pool_worker_index >= 0);
+
+        size_t participants = _imp->number_of_threads;
+        if (nested)
+        {
+            const size_t idle = _imp->idle_threads();
+            if (0 == idle)
+            {
+                f(begin, end);
+                return;
+            }
+
+            participants = idle + 1; // the calling thread participates
+        }
+
+        // batch the indices into chunks; by default aim for several chunks per
+        // participating thread, so that stealing can even out imbalanced
+        // workloads; nested loops use coarser chunks, since their helpers may
+        // be reclaimed by outer-level work at any time
+        size_t chunk = chunk_size;
+        if (0 == chunk)
+        {
+            chunk = std::max<size_t>(1, n / ((nested ? 2 : 4) * participants));
         }
 
-        return item.first;
+        auto next = std::make_shared<std::atomic<size_t>>(begin);
+
+        auto worker = [next, begin, end, chunk, &f] ()
+        {
+            size_t b;
+            while ((b = next->fetch_add(chunk, std::memory_order_relaxed)) < end)
+            {
+                f(b, std::min(end, b + chunk));
+            }
+        };
+
+        // fork: the pool threads share the chunks with the calling thread, which
+        // participates in the execution and thereby cannot deadlock; a nested
+        // caller pushes the helper tasks onto its own deque, where idle threads
+        // steal them from
+        const size_t n_helpers = std::min<size_t>(participants, (n + chunk - 1) / chunk);
+
+        CompletionLatch latch;
+        for (size_t i = 1 ; i < n_helpers ; ++i)
+        {
+            enqueue(worker, latch);
+        }
+
+        worker();
+
+        // join
+        latch.wait();
     }
 
     ThreadPool *
@@ -212,4 +448,10 @@ namespace eos
     {
         return _imp->number_of_threads;
     }
+
+    unsigned
+    ThreadPool::number_of_idle_threads() const
+    {
+        return _imp->idle_threads();
+    }
 }
@@ -24,10 +24,24 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/ticket.hh>
 
+#include <cstddef>
 #include <functional>
 
 namespace eos
 {
+    /*!
+     * ThreadPool is a work-stealing task scheduler.
+     *
+     * Each pool thread owns a deque of jobs: the owner pushes and pops at the
+     * back, whilst idle threads steal from the front of their siblings' deques.
+     * This avoids contention on a central queue when many small jobs are
+     * submitted at once.
+     *
+     * The number of pool threads defaults to the number of configured
+     * processors, and can be limited via the EOS_MAX_THREADS environment
+     * variable. Setting EOS_PIN_THREADS pins each pool thread to a fixed CPU,
+     * which keeps its working set on one NUMA node on multi-socket machines.
+     */
     class ThreadPool :
         public InstantiationPolicy<ThreadPool, Singleton>,
         public PrivateImplementationPattern<ThreadPool>
@@ -39,11 +53,55 @@ namespace eos
 
             Ticket enqueue(const std::function<void (void)> & work);
 
+            /*!
+             * Enqueue work whose completion is tracked by a CompletionLatch
+             * instead of an individual Ticket.
+             *
+             * Preferred when many fine-grained tasks are submitted and awaited
+             * in bulk: the latch registers the task before this function
+             * returns, and completes it once the work has run.
+             *
+             * @param work  The work to be executed on a pool thread.
+             * @param latch The latch tracking the work's completion.
+             */
+            void enqueue(const std::function<void (void)> & work, CompletionLatch & latch);
+
+            /*!
+             * Execute a function over the index range [begin, end) in parallel (fork/join).
+             *
+             * The range is split into contiguous chunks which are distributed across the
+             * pool threads; the calling thread participates in the execution, so this
+             * function may safely be called from within a pool job. It returns only once
+             * the whole range has been processed.
+             *
+             * Nested invocations cooperate with the outer level instead of competing
+             * with it: a parallel loop inside a pool job only recruits workers that are
+             * currently idle, and runs inline on the calling thread when there are
+             * none. Wide workloads (many parallel observables) thus do not pay for
+             * nested task dispatch, whilst deep workloads (few expensive observables)
+             * can spread their inner loops over the idle cores.
+             *
+             * @param begin      First index of the range.
+             * @param end        One past the last index of the range.
+             * @param f          Invoked as f(chunk_begin, chunk_end) for disjoint subranges of [begin, end).
+             * @param chunk_size Number of indices per chunk; zero (the default) selects a chunk size
+             *                   that yields several chunks per pool thread.
+             */
+            void parallel_for(const size_t & begin, const size_t & end, const std::function<void (size_t, size_t)> & f, const size_t & chunk_size = 0);
+
             static ThreadPool * instance();
 
             void wait_for_free_capacity();
 
             unsigned number_of_threads() const;
+
+            /*!
+             * Retrieve the number of pool threads that are currently idle, i.e.
+             * waiting for work that has not already been queued. The value is a
+             * snapshot and may change immediately; it is intended as a hint for
+             * cooperative scheduling decisions.
+             */
+            unsigned number_of_idle_threads() const;
     };
 }
 
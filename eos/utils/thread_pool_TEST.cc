@@ -0,0 +1,316 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ThreadPoolEnqueueTest :
+    public TestCase
+{
+    public:
+        ThreadPoolEnqueueTest() :
+            TestCase("thread_pool_enqueue_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const unsigned n_jobs = 1000;
+
+            std::atomic<unsigned> counter(0);
+
+            std::vector<Ticket> tickets;
+            tickets.reserve(n_jobs);
+
+            for (unsigned i = 0 ; i < n_jobs ; ++i)
+            {
+                tickets.push_back(ThreadPool::instance()->enqueue([&counter] { counter.fetch_add(1); }));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            TEST_CHECK_EQUAL(counter.load(), n_jobs);
+        }
+} thread_pool_enqueue_test;
+
+class ThreadPoolCompletionLatchTest :
+    public TestCase
+{
+    public:
+        ThreadPoolCompletionLatchTest() :
+            TestCase("thread_pool_completion_latch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // bulk-waiting on many fine-grained tasks through a single latch
+            {
+                static const unsigned n_jobs = 10000;
+
+                std::atomic<unsigned> counter(0);
+
+                CompletionLatch latch;
+                for (unsigned i = 0 ; i < n_jobs ; ++i)
+                {
+                    ThreadPool::instance()->enqueue([&counter] { counter.fetch_add(1); }, latch);
+                }
+
+                latch.wait();
+
+                TEST_CHECK_EQUAL(counter.load(), n_jobs);
+            }
+
+            // a latch without registered tasks does not block
+            {
+                CompletionLatch latch;
+                latch.wait();
+            }
+
+            // a latch can be reused for several bulk waits
+            {
+                std::atomic<unsigned> counter(0);
+
+                CompletionLatch latch;
+                for (unsigned round = 0 ; round < 3 ; ++round)
+                {
+                    for (unsigned i = 0 ; i < 100 ; ++i)
+                    {
+                        ThreadPool::instance()->enqueue([&counter] { counter.fetch_add(1); }, latch);
+                    }
+
+                    latch.wait();
+
+                    TEST_CHECK_EQUAL(counter.load(), (round + 1) * 100);
+                }
+            }
+
+            // a chained callback runs before the ticket completes
+            {
+                std::atomic<unsigned> order(0);
+                unsigned callback_at = 0;
+
+                Ticket ticket;
+                ticket.on_completion([&order, &callback_at] { callback_at = order.fetch_add(1) + 1; });
+                ticket.mark();
+                ticket.wait();
+
+                const unsigned wait_at = order.fetch_add(1) + 1;
+
+                TEST_CHECK_EQUAL(callback_at, 1u);
+                TEST_CHECK_EQUAL(wait_at, 2u);
+            }
+        }
+} thread_pool_completion_latch_test;
+
+class ThreadPoolContinuationTest :
+    public TestCase
+{
+    public:
+        ThreadPoolContinuationTest() :
+            TestCase("thread_pool_continuation_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // chained stages run in order, without a blocked coordinator thread
+            {
+                std::atomic<unsigned> stage(0);
+
+                auto first = ThreadPool::instance()->enqueue([&stage] { stage.fetch_add(1); });
+                auto second = first.then([&stage] { stage.fetch_add(10); });
+                auto third = second.then([&stage] { stage.fetch_add(100); });
+
+                third.wait();
+
+                TEST_CHECK_EQUAL(stage.load(), 111u);
+            }
+
+            // chaining onto an already completed ticket still runs the work
+            {
+                std::atomic<bool> ran(false);
+
+                Ticket ticket;
+                ticket.mark();
+
+                ticket.then([&ran] { ran.store(true); }).wait();
+
+                TEST_CHECK_EQUAL(ran.load(), true);
+            }
+
+            // a list continuation runs only after the whole generation completed
+            {
+                static const unsigned n_jobs = 100;
+
+                std::atomic<unsigned> counter(0);
+                std::atomic<unsigned> seen(0);
+
+                TicketList tickets;
+                for (unsigned i = 0 ; i < n_jobs ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&counter] { counter.fetch_add(1); }));
+                }
+
+                auto ticket = tickets.then([&counter, &seen] { seen.store(counter.load()); });
+                ticket.wait();
+
+                TEST_CHECK_EQUAL(seen.load(), n_jobs);
+
+                tickets.wait();
+            }
+
+            // an empty list chains immediately
+            {
+                std::atomic<bool> ran(false);
+
+                TicketList tickets;
+                tickets.then([&ran] { ran.store(true); }).wait();
+
+                TEST_CHECK_EQUAL(ran.load(), true);
+            }
+        }
+} thread_pool_continuation_test;
+
+class ThreadPoolParallelForTest :
+    public TestCase
+{
+    public:
+        ThreadPoolParallelForTest() :
+            TestCase("thread_pool_parallel_for_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // every index is visited exactly once
+            {
+                static const size_t n = 10000;
+
+                std::vector<std::atomic<unsigned>> visited(n);
+
+                ThreadPool::instance()->parallel_for(0, n, [&visited] (size_t b, size_t e)
+                {
+                    for (size_t i = b ; i != e ; ++i)
+                    {
+                        visited[i].fetch_add(1);
+                    }
+                });
+
+                for (size_t i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_EQUAL(visited[i].load(), 1u);
+                }
+            }
+
+            // an empty range is a no-op
+            {
+                std::atomic<unsigned> invocations(0);
+
+                ThreadPool::instance()->parallel_for(7, 7, [&invocations] (size_t, size_t)
+                {
+                    invocations.fetch_add(1);
+                });
+
+                TEST_CHECK_EQUAL(invocations.load(), 0u);
+            }
+
+            // explicit chunk sizes are honoured, including chunks larger than the range
+            {
+                static const size_t n = 17;
+
+                std::atomic<size_t> sum(0);
+
+                ThreadPool::instance()->parallel_for(0, n, [&sum] (size_t b, size_t e)
+                {
+                    for (size_t i = b ; i != e ; ++i)
+                    {
+                        sum.fetch_add(i);
+                    }
+                }, 64);
+
+                TEST_CHECK_EQUAL(sum.load(), n * (n - 1) / 2);
+            }
+
+            // parallel_for may be used from within a pool job without deadlocking
+            {
+                static const size_t n = 100;
+
+                std::atomic<size_t> sum(0);
+
+                auto ticket = ThreadPool::instance()->enqueue([&sum] {
+                    ThreadPool::instance()->parallel_for(0, n, [&sum] (size_t b, size_t e)
+                    {
+                        for (size_t i = b ; i != e ; ++i)
+                        {
+                            sum.fetch_add(i);
+                        }
+                    });
+                });
+                ticket.wait();
+
+                TEST_CHECK_EQUAL(sum.load(), n * (n - 1) / 2);
+            }
+
+            // nested parallel loops cooperate with a saturated pool: every worker
+            // runs an outer job with an inner loop, and all indices are still
+            // visited exactly once
+            {
+                const unsigned n_outer = 2 * ThreadPool::instance()->number_of_threads();
+                static const size_t n_inner = 257;
+
+                std::vector<std::atomic<unsigned>> visited(n_outer * n_inner);
+
+                CompletionLatch latch;
+                for (unsigned j = 0 ; j < n_outer ; ++j)
+                {
+                    ThreadPool::instance()->enqueue([&visited, j] {
+                        ThreadPool::instance()->parallel_for(0, n_inner, [&visited, j] (size_t b, size_t e)
+                        {
+                            for (size_t i = b ; i != e ; ++i)
+                            {
+                                visited[j * n_inner + i].fetch_add(1);
+                            }
+                        });
+                    }, latch);
+                }
+
+                latch.wait();
+
+                for (size_t i = 0 ; i < visited.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(visited[i].load(), 1u);
+                }
+            }
+
+            // the idle-thread count is a bounded snapshot
+            {
+                TEST_CHECK(ThreadPool::instance()->number_of_idle_threads() <= ThreadPool::instance()->number_of_threads());
+            }
+        }
+} thread_pool_parallel_for_test;
@@ -20,8 +20,11 @@
 #ifndef EOS_GUARD_EOS_UTILS_TICKET_HH
 #define EOS_GUARD_EOS_UTILS_TICKET_HH 1
 
+#include <eos/utils/instantiation_policy.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 
+#include <functional>
+
 namespace eos
 {
     // Forward declaration for Ticket.
@@ -58,6 +61,30 @@ namespace eos
 
             /// Wait for ticket completion.
             void wait() const;
+
+            /*!
+             * Chain a callback that is invoked by the completing thread,
+             * immediately before the ticket becomes visible as completed.
+             *
+             * May be called at any time, including after the ticket has been
+             * handed to the executing thread; runs the callback immediately
+             * when the ticket has already completed. Multiple callbacks are
+             * invoked in registration order.
+             */
+            void on_completion(const std::function<void (void)> & callback);
+
+            /*!
+             * Chain work that is executed on the thread pool once this ticket
+             * has completed.
+             *
+             * Unlike wait(), no thread blocks on the completion; the returned
+             * ticket completes once the chained work has finished, so further
+             * stages can be chained onto it.
+             *
+             * @param work The work to be executed on a pool thread.
+             * @return A ticket tracking the chained work's completion.
+             */
+            Ticket then(const std::function<void (void)> & work);
     };
 
     /**
@@ -84,6 +111,62 @@ namespace eos
 
             /// Wait for ticket completion.
             void wait() const;
+
+            /*!
+             * Chain work that is executed on the thread pool once all tickets
+             * currently in the list have completed.
+             *
+             * Tickets pushed after this call do not delay the chained work.
+             * Unlike wait(), no thread blocks on the completion; the returned
+             * ticket completes once the chained work has finished, so whole
+             * pipelines of task generations can be chained without a blocked
+             * coordinator thread.
+             *
+             * @param work The work to be executed on a pool thread.
+             * @return A ticket tracking the chained work's completion.
+             */
+            Ticket then(const std::function<void (void)> & work);
+    };
+
+    /**
+     * CompletionLatch counts outstanding tasks and lets threads wait for all
+     * of them to complete in bulk.
+     *
+     * The bookkeeping is a single atomic counter, and waiting uses the
+     * futex-backed atomic wait/notify operations; neither registering,
+     * completing, nor awaiting tasks takes a lock. Prefer one latch over many
+     * individual tickets when a large number of fine-grained tasks is
+     * submitted and awaited together.
+     *
+     * Copies of a CompletionLatch share their state, like copies of a Ticket.
+     */
+    class CompletionLatch :
+        public PrivateImplementationPattern<CompletionLatch>
+    {
+        public:
+            /// \name Basic Operations
+            /// \{
+
+            /// Constructor.
+            CompletionLatch();
+
+            /// Destructor.
+            ~CompletionLatch();
+
+            /// \}
+
+            /*!
+             * Register further tasks whose completion shall be awaited.
+             *
+             * @param n Number of tasks to register.
+             */
+            void add(const unsigned long & n = 1);
+
+            /// Mark one task as completed.
+            void complete();
+
+            /// Wait until all registered tasks have completed.
+            void wait() const;
     };
 }
 
@@ -22,66 +22,96 @@
 #include <eos/utils/log.hh>
 #include <eos/utils/units.hh>
 
-#include <map>
+#include <algorithm>
+#include <array>
 #include <string>
-#include <vector>
+#include <string_view>
 
 namespace eos
 {
-    const std::string &
-    Unit::latex() const
-    {
-        static const std::vector<std::string> representations
+    namespace
+    {
+        /*
+         * One row per Unit::Id, in id order. The textual names and LaTeX
+         * representations are interned here once; every accessor hands out
+         * references into this table, and lookups by name compare against it
+         * without constructing strings.
+         */
+        struct UnitEntry
         {
-            R"(\textrm{undefined})",
-            "1",
-            R"(\textrm{GeV})",
-            R"(\textrm{GeV}^2)",
-            R"(\textrm{GeV}^3)",
-            R"(\textrm{GeV}^{-1})",
-            R"(\textrm{GeV}^{-2})",
-            R"(\textrm{GeV}^{-4})",
-            R"(\textrm{s})",
-            R"(\textrm{s}^{-1})",
-            R"(\textrm{ps}^{-1})",
-            R"(\textrm{GeV}\,\textrm{s})",
-            R"(\textrm{fm}^2)",
+                std::string name;
+                std::string latex;
         };
 
-        return representations[static_cast<int>(_id)];
+        // function-local static, so that units resolve correctly even when
+        // used during the static initialization of other translation units
+        const std::array<UnitEntry, 13> &
+        unit_entries()
+        {
+            static const std::array<UnitEntry, 13> entries
+            {{
+                { "undefined", R"(\textrm{undefined})"          },
+                { "1",         "1"                              },
+                { "GeV",       R"(\textrm{GeV})"                },
+                { "GeV^2",     R"(\textrm{GeV}^2)"              },
+                { "GeV^3",     R"(\textrm{GeV}^3)"              },
+                { "GeV^-1",    R"(\textrm{GeV}^{-1})"           },
+                { "GeV^-2",    R"(\textrm{GeV}^{-2})"           },
+                { "GeV^-4",    R"(\textrm{GeV}^{-4})"           },
+                { "s",         R"(\textrm{s})"                  },
+                { "s^-1",      R"(\textrm{s}^{-1})"             },
+                { "ps^-1",     R"(\textrm{ps}^{-1})"            },
+                { "GeV s",     R"(\textrm{GeV}\,\textrm{s})"    },
+                { "fm^2",      R"(\textrm{fm}^2)"               },
+            }};
+
+            return entries;
+        }
+    } // namespace
+
+    const std::string &
+    Unit::name() const
+    {
+        return unit_entries()[static_cast<int>(_id)].name;
+    }
+
+    const std::string &
+    Unit::latex() const
+    {
+        return unit_entries()[static_cast<int>(_id)].latex;
     }
 
     Unit::Unit(const std::string & s) :
         Unit(Id::undefined)
     {
-        static const std::map<std::string, Id> map
-        {
-            { "1",       Id::none         },
-            { "GeV",     Id::gev          },
-            { "GeV^2",   Id::gev2         },
-            { "GeV^3",   Id::gev3         },
-            { "GeV^-2",  Id::inverse_gev2 },
-            { "GeV^-1",  Id::inverse_gev  },
-            { "GeV^-4",  Id::inverse_gev4 },
-            { "s",       Id::s            },
-            { "s^-1",    Id::inverse_s    },
-            { "ps^-1",   Id::inverse_ps   },
-            { "GeV s",   Id::gev_s        },
-            { "fm^2",    Id::fm2          },
-        };
+        const auto & entries = unit_entries();
 
-        const auto i = map.find(s);
-        if (map.cend() == i)
+        const auto i = std::find_if(entries.begin() + 1, entries.end(),
+                [&s] (const UnitEntry & entry) { return std::string_view(entry.name) == std::string_view(s); });
+
+        if (entries.end() == i)
         {
             Log::instance()->message("Unit", ll_error)
                 << "Unrecognized unit '" << s << "' encountered";
         }
         else
         {
-            _id = i->second;
+            _id = static_cast<Id>(i - entries.begin());
         }
     }
 
+    Unit::Id
+    Unit::id() const
+    {
+        return _id;
+    }
+
+    Unit
+    Unit::FromId(const Id & id)
+    {
+        return Unit(id);
+    }
+
     Unit
     Unit::Undefined()
     {
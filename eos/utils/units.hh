@@ -60,8 +60,18 @@ namespace eos
             Unit(Unit &&) = default;
             ~Unit() = default;
 
+            /// Retrieve the Unit's textual name, as accepted by the string constructor.
+            const std::string & name() const;
+
+            /// Retrieve the Unit's LaTeX representation.
             const std::string & latex() const;
 
+            /// Retrieve the Unit's underlying id.
+            Id id() const;
+
+            /// Construct a Unit from its underlying id.
+            static Unit FromId(const Id &);
+
             static Unit Undefined();
             static Unit None();
             static Unit GeV();
@@ -19,91 +19,29 @@
 
 #include <eos/observable.hh>
 #include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/wilson-polynomial.hh>
 
 #include <cmath>
+#include <exception>
+#include <limits>
+#include <vector>
 
 namespace eos
 {
-    /* WilsonPolynomial elements */
-    struct Constant
-    {
-        double value;
-
-        Constant(const double & value) :
-            value(value)
-        {
-        }
-    };
-
-    struct Sum
-    {
-        std::list<WilsonPolynomial> summands;
-
-        Sum()
-        {
-        }
-
-        Sum(const WilsonPolynomial & x, const WilsonPolynomial & y)
-        {
-            add(x);
-            add(y);
-        }
-
-        void add(const WilsonPolynomial & summand)
-        {
-            summands.push_back(summand);
-        }
-    };
-
-    struct Product
-    {
-        WilsonPolynomial x, y;
-
-        Product() :
-            x(Constant(0)),
-            y(Constant(0))
-        {
-        }
-
-        Product(const WilsonPolynomial & x, const WilsonPolynomial & y) :
-            x(x),
-            y(y)
-        {
-        };
-    };
-
-    struct Sine
-    {
-        WilsonPolynomial phi;
-
-        Sine(const WilsonPolynomial & phi) :
-            phi(phi)
-        {
-        }
-    };
-
-    struct Cosine
-    {
-        WilsonPolynomial phi;
-
-        Cosine(const WilsonPolynomial & phi) :
-            phi(phi)
-        {
-        }
-    };
-
     /* Build a WilsonPolynomial from an observable */
     WilsonPolynomial make_polynomial(const ObservablePtr & o, const std::list<std::string> & _coefficients)
     {
         Sum result;
 
-        std::list<std::tuple<Parameter, double, double>> coefficients; // <p_i, q_i, l_i>
+        std::vector<Parameter> coefficients;
         for (const auto & _coefficient : _coefficients)
         {
-            coefficients.push_back(std::make_tuple(o->parameters()[_coefficient], 0.0, 0.0));
+            coefficients.push_back(o->parameters()[_coefficient]);
         }
 
+        const size_t n_coefficients = coefficients.size();
+
         /*
          * Wilson-Polynomials have the form
          *
@@ -112,78 +50,159 @@ namespace eos
          *     + \sum_{i, j > i} c_ij P_i P_j
          */
 
-        // Set all parameters to zero
-        for (auto & coefficient : coefficients)
+        // Enumerate all sample points up front, one row of coefficient values
+        // per point: the zero point, +1 and -1 along each coordinate
+        // direction, and (1, 1) for each coordinate pair
+        const size_t n_points = 1 + 2 * n_coefficients + (n_coefficients * (n_coefficients - 1)) / 2;
+        std::vector<double> points(n_points * n_coefficients, 0.0);
         {
-            std::get<0>(coefficient) = 0.0;
+            size_t row = 1;
+            for (size_t i = 0 ; i < n_coefficients ; ++i)
+            {
+                points[row * n_coefficients + i] = +1.0;
+                ++row;
+                points[row * n_coefficients + i] = -1.0;
+                ++row;
+            }
+
+            for (size_t i = 0 ; i < n_coefficients ; ++i)
+            {
+                for (size_t j = i + 1 ; j < n_coefficients ; ++j)
+                {
+                    points[row * n_coefficients + i] = 1.0;
+                    points[row * n_coefficients + j] = 1.0;
+                    ++row;
+                }
+            }
         }
 
-        // Determine the constant part 'n'
-        double n = o->evaluate();
-        result.add(Constant(n));
+        // Evaluate all points in a single parallel sweep. Each chunk works on
+        // an independent clone of the observable and its parameters, and
+        // touches a coefficient only when its value changes from row to row;
+        // the observable's own parameters are never modified.
+        std::vector<double> values(n_points, 0.0);
+        std::vector<std::exception_ptr> errors(n_points);
+        ThreadPool::instance()->parallel_for(0, n_points, [&] (size_t begin, size_t end)
+        {
+            try
+            {
+                Parameters parameters = o->parameters().clone();
+                ObservablePtr clone = o->clone(parameters);
+
+                std::vector<Parameter> p;
+                p.reserve(n_coefficients);
+                for (const auto & coefficient : coefficients)
+                {
+                    p.push_back(parameters[coefficient.name()]);
+                }
+
+                std::vector<double> current(n_coefficients, std::numeric_limits<double>::quiet_NaN());
+                for (size_t s = begin ; s != end ; ++s)
+                {
+                    const double * row = points.data() + s * n_coefficients;
+                    for (size_t i = 0 ; i < n_coefficients ; ++i)
+                    {
+                        if (row[i] != current[i])
+                        {
+                            p[i] = row[i];
+                            current[i] = row[i];
+                        }
+                    }
+
+                    values[s] = clone->evaluate();
+                }
+            }
+            catch (...)
+            {
+                errors[begin] = std::current_exception();
+            }
+        });
 
-        // Determine the true quadratic terms 'q_i' and linear terms 'l_i'
-        for (auto & coefficient : coefficients)
+        for (const auto & error : errors)
         {
-            Parameter p_i = std::get<0>(coefficient);
+            if (error)
+                std::rethrow_exception(error);
+        }
 
+        // Extract the constant part 'n'
+        const double n = values[0];
+        result.add(Constant(n));
 
-            // calculate observables
-            p_i = +1.0;
-            double o_plus_one = o->evaluate();
+        // Extract the true quadratic terms 'q_i' and linear terms 'l_i'
+        std::vector<double> q(n_coefficients), l(n_coefficients);
+        size_t row = 1;
+        for (size_t i = 0 ; i < n_coefficients ; ++i)
+        {
+            const double o_plus_one = values[row];
+            ++row;
+            const double o_minus_one = values[row];
+            ++row;
 
-            p_i = -1.0;
-            double o_minus_one = o->evaluate();
+            q[i] = 0.5 * ((o_plus_one + o_minus_one) - 2.0 * n);
+            result.add(Product(Constant(q[i]), Product(coefficients[i], coefficients[i])));
 
-            double q_i = 0.5 * ((o_plus_one + o_minus_one) - 2.0 * n);
-            result.add(Product(Constant(q_i), Product(p_i, p_i)));
-            std::get<1>(coefficient) = q_i;
+            l[i] = 0.5 * (o_plus_one - o_minus_one);
+            result.add(Product(Constant(l[i]), coefficients[i]));
+        }
 
-            double l_i = 0.5 * (o_plus_one - o_minus_one);
-            result.add(Product(Constant(l_i), p_i));
-            std::get<2>(coefficient) = l_i;
+        // Extract the bilinear terms 'b_{ij}'
+        for (size_t i = 0 ; i < n_coefficients ; ++i)
+        {
+            for (size_t j = i + 1 ; j < n_coefficients ; ++j)
+            {
+                const double b_ij = values[row] - n - q[i] - l[i] - q[j] - l[j];
+                ++row;
 
-            // reset parameter to zero
-            p_i = 0.0;
+                result.add(Product(Constant(b_ij), Product(coefficients[i], coefficients[j])));
+            }
         }
 
-        // Determine the bilinear terms 'b_{ij}'
-        for (auto i = coefficients.begin(), i_end = coefficients.end() ; i != i_end ; ++i)
-        {
-            Parameter p_i = std::get<0>(*i);
-            double q_i = std::get<1>(*i), l_i = std::get<2>(*i);
-            p_i = 1.0;
+        return result;
+    }
+
+    std::vector<double>
+    evaluate_many(const WilsonPolynomial & polynomial, const std::vector<Parameter> & _coefficients, const std::vector<double> & points)
+    {
+        if (_coefficients.empty())
+            throw InternalError("evaluate_many: no coefficient parameters given");
 
-            auto j = i;
-            if (j != i_end)
-                ++j;
+        if (0 != points.size() % _coefficients.size())
+            throw InternalError("evaluate_many: point matrix of " + stringify(points.size()) + " values does not factorize into points of "
+                    + stringify(_coefficients.size()) + " coefficients");
 
-            for ( ; j != i_end; ++j)
-            {
-                Parameter p_j = std::get<0>(*j);
-                double q_j = std::get<1>(*j), l_j = std::get<2>(*j);
-                p_j = 1.0;
+        std::vector<Parameter> coefficients(_coefficients);
 
-                // extract bilinear term
-                double b_ij = o->evaluate() - n - q_i - l_i - q_j - l_j;
+        const size_t n_coefficients = coefficients.size();
+        const size_t n_points = points.size() / n_coefficients;
 
-                result.add(Product(Constant(b_ij), Product(p_i, p_j)));
+        // remember the prior coefficient values, to be restored after the sweep
+        std::vector<double> saved;
+        saved.reserve(n_coefficients);
+        for (const auto & coefficient : coefficients)
+        {
+            saved.push_back(coefficient());
+        }
 
-                p_j = 0.0;
+        std::vector<double> results(n_points);
+
+        WilsonPolynomialEvaluator evaluator;
+        for (size_t s = 0 ; s < n_points ; ++s)
+        {
+            const double * row = points.data() + s * n_coefficients;
+            for (size_t i = 0 ; i < n_coefficients ; ++i)
+            {
+                coefficients[i] = row[i];
             }
 
-            p_i = 0.0;
+            results[s] = polynomial.accept_returning<double>(evaluator);
         }
 
-        // Reset parameters to defaults
-        for (const auto & coefficient : coefficients)
+        for (size_t i = 0 ; i < n_coefficients ; ++i)
         {
-            Parameter p_i = std::get<0>(coefficient);
-
-            p_i = p_i.central();
+            coefficients[i] = saved[i];
         }
 
-        return result;
+        return results;
     }
 
     class WilsonPolynomialRatio :
@@ -25,6 +25,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -40,8 +41,94 @@ namespace eos
 
     using WilsonPolynomial = OneOf<Constant, Sum, Product, Sine, Cosine, Parameter>;
 
+    /*
+     * The polynomial's node types are defined here rather than in the
+     * translation unit, since visitation of a OneOf requires all of its
+     * alternatives to be complete at the point of use.
+     */
+    struct Constant
+    {
+        double value;
+
+        Constant(const double & value) :
+            value(value)
+        {
+        }
+    };
+
+    struct Sum
+    {
+        std::list<WilsonPolynomial> summands;
+
+        Sum()
+        {
+        }
+
+        Sum(const WilsonPolynomial & x, const WilsonPolynomial & y)
+        {
+            add(x);
+            add(y);
+        }
+
+        void add(const WilsonPolynomial & summand)
+        {
+            summands.push_back(summand);
+        }
+    };
+
+    struct Product
+    {
+        WilsonPolynomial x, y;
+
+        Product() :
+            x(Constant(0)),
+            y(Constant(0))
+        {
+        }
+
+        Product(const WilsonPolynomial & x, const WilsonPolynomial & y) :
+            x(x),
+            y(y)
+        {
+        };
+    };
+
+    struct Sine
+    {
+        WilsonPolynomial phi;
+
+        Sine(const WilsonPolynomial & phi) :
+            phi(phi)
+        {
+        }
+    };
+
+    struct Cosine
+    {
+        WilsonPolynomial phi;
+
+        Cosine(const WilsonPolynomial & phi) :
+            phi(phi)
+        {
+        }
+    };
+
     WilsonPolynomial make_polynomial(const ObservablePtr &, const std::list<std::string> &);
 
+    /*!
+     * Evaluate a WilsonPolynomial at many points in Wilson-coefficient space
+     * in one call.
+     *
+     * @param polynomial   The polynomial that shall be evaluated.
+     * @param coefficients The coefficient parameters of the polynomial, in the order of the point columns.
+     * @param points       Row-major matrix of coefficient values, one row per point.
+     *
+     * @return One value per row of @p points. The coefficient parameters are
+     * restored to their prior values before returning.
+     */
+    std::vector<double> evaluate_many(const WilsonPolynomial & polynomial, const std::vector<Parameter> & coefficients,
+            const std::vector<double> & points);
+
     /*!
      * Return an Observable that wraps a WilsonPolynomial object.
      *
@@ -20,22 +20,34 @@
  */
 
 #include "eos/constraint.hh"
+#include "eos/kinematic-coalescing.hh"
 #include "eos/models/model.hh"
 #include "eos/nonlocal-form-factors/charm-loops-impl.hh"
 #include "eos/observable.hh"
+#include "eos/prediction-grid.hh"
 #include "eos/reference.hh"
 #include "eos/signal-pdf.hh"
+#include "eos/signal-pdf-event-block.hh"
 #include "eos/statistics/goodness-of-fit.hh"
 #include "eos/statistics/log-likelihood.hh"
 #include "eos/statistics/log-posterior.hh"
 #include "eos/statistics/log-prior.hh"
+#include "eos/statistics/markov-chain-sampler.hh"
+#include "eos/statistics/prior-sampler.hh"
+#include "eos/statistics/prior-transform.hh"
+#include "eos/statistics/quantile-sketch.hh"
+#include "eos/statistics/sample-sink.hh"
 #include "eos/statistics/test-statistic-impl.hh"
+#include "eos/utils/baked-observable.hh"
+#include "eos/utils/evaluation-precision.hh"
 #include "eos/utils/kinematic.hh"
 #include "eos/utils/log.hh"
+#include "eos/utils/observable_predictor.hh"
 #include "eos/utils/options.hh"
 #include "eos/utils/parameters.hh"
 #include "eos/utils/qualified-name.hh"
 #include "eos/utils/reference-name.hh"
+#include "eos/utils/speculative_evaluator.hh"
 #include "eos/utils/units.hh"
 
 #include "python/_eos/external-log-likelihood-block.hh"
@@ -115,6 +127,837 @@ namespace impl
             }
     };
 
+    // accessors for the global evaluation-precision policy; the tier applies
+    // to observables constructed after it has been set
+    void
+    set_evaluation_precision(const std::string & name)
+    {
+        eos::EvaluationPrecision::instance()->set_tier(eos::EvaluationPrecision::tier_from_string(name));
+    }
+
+    std::string
+    evaluation_precision()
+    {
+        switch (eos::EvaluationPrecision::instance()->tier())
+        {
+            case eos::EvaluationPrecision::Tier::coarse: return "coarse";
+            case eos::EvaluationPrecision::Tier::fine:   return "fine";
+            default:                                     return "default";
+        }
+    }
+
+    // integration call sites registered so far, with their default orders
+    boost::python::dict
+    integration_call_sites()
+    {
+        boost::python::dict result;
+        for (const auto & [call_site, default_points] : eos::EvaluationPrecision::instance()->call_sites())
+        {
+            result[call_site] = default_points;
+        }
+
+        return result;
+    }
+
+    void
+    calibrate_integration_points(const std::string & call_site, const unsigned & points)
+    {
+        eos::EvaluationPrecision::instance()->calibrate(call_site, points);
+    }
+
+    void
+    clear_integration_calibration()
+    {
+        eos::EvaluationPrecision::instance()->clear_calibration();
+    }
+
+    // loads a baked observable table and returns the registered names
+    boost::python::list
+    load_baked_observables(const std::string & file)
+    {
+        boost::python::list result;
+        for (const auto & name : eos::BakedObservables::load(file))
+        {
+            result.append(name.str());
+        }
+
+        return result;
+    }
+
+    // evaluates an ensemble of likelihoods with resampled experimental central values
+    boost::python::list
+    log_likelihood_resample(const eos::LogLikelihood & log_likelihood, unsigned datasets, unsigned long seed)
+    {
+        std::vector<double> results(datasets, 0.0);
+        log_likelihood.resample(datasets, seed, results.data());
+
+        boost::python::list result;
+        for (const double & value : results)
+        {
+            result.append(value);
+        }
+
+        return result;
+    }
+
+    // simulates the distribution of the total-likelihood test statistic
+    boost::python::list
+    log_likelihood_simulate(const eos::LogLikelihood & log_likelihood, unsigned datasets, unsigned long seed)
+    {
+        std::vector<double> results(datasets, 0.0);
+        log_likelihood.simulate(datasets, seed, results.data());
+
+        boost::python::list result;
+        for (const double & value : results)
+        {
+            result.append(value);
+        }
+
+        return result;
+    }
+
+    // factory for the native HistFactory log-likelihood block; converts the
+    // parameter map from a python dict
+    eos::LogLikelihoodBlockPtr
+    make_histfactory_block(const eos::ObservableCache & cache, const std::string & workspace, boost::python::dict parameter_map)
+    {
+        std::map<std::string, std::string> map;
+
+        boost::python::list items = parameter_map.items();
+        for (long i = 0, n = boost::python::len(items) ; i < n ; ++i)
+        {
+            map[boost::python::extract<std::string>(items[i][0])] = boost::python::extract<std::string>(items[i][1]);
+        }
+
+        return eos::LogLikelihoodBlock::HistFactory(cache, workspace, map);
+    }
+
+    // factory for MarkovChainSampler: samples a clone of the given posterior,
+    // so that the sampler cannot interfere with the caller's Parameters object
+    std::shared_ptr<eos::MarkovChainSampler>
+    make_markov_chain_sampler(const eos::LogPosterior & log_posterior, unsigned long seed, unsigned preruns, unsigned pre_n,
+            unsigned n, unsigned stride, double cov_scale, const std::vector<double> & start_point,
+            const std::string & checkpoint_file, unsigned checkpoint_interval, const std::string & proposal_file,
+            bool screen)
+    {
+        eos::MarkovChainSampler::Config config;
+        config.seed                = seed;
+        config.preruns             = preruns;
+        config.pre_n               = pre_n;
+        config.n                   = n;
+        config.stride              = stride;
+        config.cov_scale           = cov_scale;
+        config.start_point         = start_point;
+        config.checkpoint_file     = checkpoint_file;
+        config.checkpoint_interval = checkpoint_interval;
+        config.proposal_file       = proposal_file;
+        config.screen              = screen;
+
+        return std::make_shared<eos::MarkovChainSampler>(log_posterior.clone(), config);
+    }
+
+    // factory for PriorSampler: samples a clone of the given posterior,
+    // so that the sampler cannot interfere with the caller's Parameters object
+    std::shared_ptr<eos::PriorSampler>
+    make_prior_sampler(const eos::LogPosterior & log_posterior, const std::string & scheme, unsigned long seed)
+    {
+        eos::PriorSampler::Scheme _scheme;
+        if ("pseudo" == scheme)
+        {
+            _scheme = eos::PriorSampler::Scheme::pseudo;
+        }
+        else if ("antithetic" == scheme)
+        {
+            _scheme = eos::PriorSampler::Scheme::antithetic;
+        }
+        else if ("sobol" == scheme)
+        {
+            _scheme = eos::PriorSampler::Scheme::sobol;
+        }
+        else
+        {
+            PyErr_SetString(PyExc_ValueError, "PriorSampler: scheme must be one of 'pseudo', 'antithetic', or 'sobol'");
+            throw_error_already_set();
+            return nullptr; // unreachable
+        }
+
+        return std::make_shared<eos::PriorSampler>(log_posterior.clone(), _scheme, seed);
+    }
+
+    // factory for SignalPDFEventBlock: loads the event sample once from a
+    // NumPy array via the buffer protocol into the block's columnar buffer
+    std::shared_ptr<eos::SignalPDFEventBlock>
+    make_signal_pdf_event_block(const eos::QualifiedName & name, const eos::Parameters & parameters, const eos::Kinematics & kinematics,
+            const eos::Options & options, const std::vector<std::string> & kinematic_names, object events)
+    {
+        Py_buffer events_buffer;
+
+        if (0 != PyObject_GetBuffer(events.ptr(), &events_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item = static_cast<Py_ssize_t>(sizeof(double));
+        if ((events_buffer.itemsize != item) || (0 != events_buffer.len % item))
+        {
+            PyBuffer_Release(&events_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "SignalPDFEventBlock: events must be a C-contiguous float64 array of shape (len(kinematic_names), n)");
+            throw_error_already_set();
+        }
+
+        const double * begin = static_cast<const double *>(events_buffer.buf);
+        std::vector<double> _events(begin, begin + events_buffer.len / item);
+        PyBuffer_Release(&events_buffer);
+
+        return std::make_shared<eos::SignalPDFEventBlock>(name, parameters, kinematics, options, kinematic_names, _events);
+    }
+
+    // evaluate an observable with the GIL released; this allows awaitable
+    // wrappers to dispatch the call to a worker thread without stalling the
+    // interpreter
+    double
+    observable_evaluate(eos::Observable & observable)
+    {
+        double result;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            result = observable.evaluate();
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return result;
+    }
+
+    // evaluate the log(likelihood) with the GIL released; external blocks
+    // reacquire it for the duration of their python callbacks
+    double
+    log_likelihood_evaluate(eos::LogLikelihood & log_likelihood)
+    {
+        double result;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            result = log_likelihood();
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return result;
+    }
+
+    // construct a batch of constraints with the GIL released, so that the
+    // thread pool can build them concurrently
+    std::vector<eos::Constraint>
+    constraint_make_all(const std::vector<eos::QualifiedName> & names, const eos::Options & options)
+    {
+        std::vector<eos::Constraint> results;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            results = eos::Constraint::make_all(names, options);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return results;
+    }
+
+    // evaluate the log(posterior) with the GIL released
+    double
+    log_posterior_evaluate(eos::LogPosterior & log_posterior)
+    {
+        double result;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            result = log_posterior.evaluate();
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return result;
+    }
+
+    // sum the log PDF over the whole event block with the GIL released
+    double
+    signal_pdf_event_block_log_pdf_sum(eos::SignalPDFEventBlock & block)
+    {
+        double result;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            result = block.log_pdf_sum();
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return result;
+    }
+
+    // draw a batch of prior samples into a NumPy array via the buffer
+    // protocol, with the GIL released while the C++ code runs
+    void
+    prior_sampler_sample(eos::PriorSampler & sampler, object out)
+    {
+        Py_buffer out_buffer;
+
+        if (0 != PyObject_GetBuffer(out.ptr(), &out_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item      = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t dimension = sampler.dimension();
+        const Py_ssize_t n         = (dimension > 0) ? out_buffer.len / (item * dimension) : 0;
+
+        if ((out_buffer.itemsize != item) || (out_buffer.len != n * dimension * item))
+        {
+            PyBuffer_Release(&out_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "PriorSampler.sample: out must be a C-contiguous, writable float64 array of shape (n, dimension)");
+            throw_error_already_set();
+        }
+
+        // no Python objects are touched during the sampling, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            sampler.sample(static_cast<double *>(out_buffer.buf), n);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&out_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&out_buffer);
+    }
+
+    // evaluate the gradient of the log(posterior) into a NumPy array via the
+    // buffer protocol, with the GIL released while the C++ code runs
+    void
+    log_posterior_gradient(eos::LogPosterior & log_posterior, object out)
+    {
+        static const char * error_message = "LogPosterior.gradient: out must be a C-contiguous, writable float64 array with one entry per varied parameter";
+
+        const std::size_t n_dim = log_posterior.varied_parameters().size();
+
+        Py_buffer out_buffer;
+        if (0 != PyObject_GetBuffer(out.ptr(), &out_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE))
+        {
+            throw_error_already_set();
+        }
+
+        if ((static_cast<std::size_t>(out_buffer.itemsize) != sizeof(double)) || (static_cast<std::size_t>(out_buffer.len) != n_dim * sizeof(double)))
+        {
+            PyBuffer_Release(&out_buffer);
+            PyErr_SetString(PyExc_ValueError, error_message);
+            throw_error_already_set();
+        }
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            log_posterior.gradient(static_cast<double *>(out_buffer.buf));
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&out_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&out_buffer);
+    }
+
+    // evaluate an observable for a whole sequence of values of one kinematic
+    // variable, looping in C++ with the GIL released
+    std::vector<double>
+    observable_evaluate_many(eos::Observable & o, const std::string & kinematic_name, const std::vector<double> & values)
+    {
+        eos::KinematicVariable variable = o.kinematics()[kinematic_name];
+
+        std::vector<double> results(values.size(), 0.0);
+
+        // no Python objects are touched in the loop, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            for (std::size_t i = 0 ; i < values.size() ; ++i)
+            {
+                variable.set(values[i]);
+                results[i] = o.evaluate();
+            }
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return results;
+    }
+
+    // zero-copy writable view of the contiguous parameter-value array; the
+    // caller must keep the Parameters object alive for the view's lifetime,
+    // and publish bulk writes via Parameters.commit()
+    object
+    parameters_values_view(eos::Parameters & parameters)
+    {
+        PyObject * view = PyMemoryView_FromMemory(reinterpret_cast<char *>(parameters.values_data()),
+                static_cast<Py_ssize_t>(parameters.values_size() * sizeof(double)), PyBUF_WRITE);
+        if (nullptr == view)
+        {
+            throw_error_already_set();
+        }
+
+        return object(handle<>(view));
+    }
+
+    // assign all kinematic variables from a NumPy array in one call via the
+    // buffer protocol
+    void
+    kinematics_set_all(eos::Kinematics & kinematics, object values)
+    {
+        Py_ssize_t dimension = 0;
+        for (auto v = kinematics.begin(), v_end = kinematics.end() ; v != v_end ; ++v)
+        {
+            ++dimension;
+        }
+
+        Py_buffer values_buffer;
+        if (0 != PyObject_GetBuffer(values.ptr(), &values_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item = static_cast<Py_ssize_t>(sizeof(double));
+        if ((values_buffer.itemsize != item) || (values_buffer.len != dimension * item))
+        {
+            PyBuffer_Release(&values_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "Kinematics.set_all: values must be a C-contiguous float64 array with one entry per declared variable");
+            throw_error_already_set();
+        }
+
+        kinematics.set_all(static_cast<const double *>(values_buffer.buf));
+        PyBuffer_Release(&values_buffer);
+    }
+
+    // batch inverse-CDF transform of a prior: maps a matrix of uniform
+    // variates to prior samples with the GIL released
+    void
+    log_prior_inverse_cdf(eos::LogPrior & prior, object u, object out)
+    {
+        Py_buffer u_buffer, out_buffer;
+
+        if (0 != PyObject_GetBuffer(u.ptr(), &u_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(out.ptr(), &out_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&u_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item      = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t dimension = prior.dimension();
+        const Py_ssize_t n         = (dimension > 0) ? u_buffer.len / (item * dimension) : 0;
+
+        if ((u_buffer.itemsize != item) || (out_buffer.itemsize != item)
+                || (u_buffer.len != n * dimension * item)
+                || (out_buffer.len != u_buffer.len))
+        {
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&out_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "LogPrior.inverse_cdf: u and out must be C-contiguous float64 arrays of equal shape (n, dimension)");
+            throw_error_already_set();
+        }
+
+        // no Python objects are touched during the transform, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            prior.inverse_cdf(static_cast<const double *>(u_buffer.buf), static_cast<double *>(out_buffer.buf), n);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&out_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&u_buffer);
+        PyBuffer_Release(&out_buffer);
+    }
+
+    // bulk prior-volume transform: maps a matrix of unit-hypercube points to
+    // parameter points with the GIL released
+    void
+    prior_transform_transform(eos::PriorTransform & transform, object u, object points)
+    {
+        Py_buffer u_buffer, points_buffer;
+
+        if (0 != PyObject_GetBuffer(u.ptr(), &u_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(points.ptr(), &points_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&u_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item      = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t dimension = transform.dimension();
+        const Py_ssize_t n         = (dimension > 0) ? u_buffer.len / (item * dimension) : 0;
+
+        if ((u_buffer.itemsize != item) || (points_buffer.itemsize != item)
+                || (u_buffer.len != n * dimension * item)
+                || (points_buffer.len != u_buffer.len))
+        {
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&points_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "PriorTransform.transform: u and points must be C-contiguous float64 arrays of equal shape (n, dimension)");
+            throw_error_already_set();
+        }
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            transform.transform(static_cast<const double *>(u_buffer.buf), static_cast<double *>(points_buffer.buf), n);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&points_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&u_buffer);
+        PyBuffer_Release(&points_buffer);
+    }
+
+    // fused prior-volume transform and likelihood evaluation with the GIL
+    // released; the evaluations run on the worker threads of the ThreadPool
+    void
+    prior_transform_transform_and_evaluate(eos::PriorTransform & transform, object u, object points, object results)
+    {
+        Py_buffer u_buffer, points_buffer, results_buffer;
+
+        if (0 != PyObject_GetBuffer(u.ptr(), &u_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(points.ptr(), &points_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&u_buffer);
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(results.ptr(), &results_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&points_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item      = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t dimension = transform.dimension();
+        const Py_ssize_t n         = (dimension > 0) ? u_buffer.len / (item * dimension) : 0;
+
+        if ((u_buffer.itemsize != item) || (points_buffer.itemsize != item) || (results_buffer.itemsize != item)
+                || (u_buffer.len != n * dimension * item)
+                || (points_buffer.len != u_buffer.len)
+                || (results_buffer.len != n * item))
+        {
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&points_buffer);
+            PyBuffer_Release(&results_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "PriorTransform.transform_and_evaluate: u and points must be C-contiguous float64 arrays of shape (n, dimension), results of shape (n,)");
+            throw_error_already_set();
+        }
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            transform.transform_and_evaluate(static_cast<const double *>(u_buffer.buf), static_cast<double *>(points_buffer.buf),
+                    static_cast<double *>(results_buffer.buf), n);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&u_buffer);
+            PyBuffer_Release(&points_buffer);
+            PyBuffer_Release(&results_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&u_buffer);
+        PyBuffer_Release(&points_buffer);
+        PyBuffer_Release(&results_buffer);
+    }
+
+    // bulk prediction: evaluate a set of observables for a whole matrix of
+    // samples with the GIL released, writing into a preallocated array
+    unsigned
+    observable_predictor_predict(eos::ObservablePredictor & predictor, object samples, object results)
+    {
+        Py_buffer samples_buffer, results_buffer;
+
+        if (0 != PyObject_GetBuffer(samples.ptr(), &samples_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(results.ptr(), &results_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&samples_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item          = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t columns       = predictor.number_of_varied_parameters();
+        const Py_ssize_t n_observables = predictor.number_of_observables();
+        const Py_ssize_t n_samples     = (columns > 0) ? samples_buffer.len / (item * columns) : 0;
+
+        if ((samples_buffer.itemsize != item) || (results_buffer.itemsize != item)
+                || (samples_buffer.len != n_samples * columns * item)
+                || (results_buffer.len != n_samples * n_observables * item))
+        {
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&results_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "ObservablePredictor.predict: samples and results must be C-contiguous float64 arrays of shapes "
+                    "(n, number_of_varied_parameters) and (n, number_of_observables), respectively");
+            throw_error_already_set();
+        }
+
+        unsigned failures = 0;
+
+        // no Python objects are touched during the prediction, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            failures = predictor.predict(static_cast<const double *>(samples_buffer.buf), n_samples, static_cast<double *>(results_buffer.buf));
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&results_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&samples_buffer);
+        PyBuffer_Release(&results_buffer);
+
+        return failures;
+    }
+
+    // streaming covariance: accumulate the weighted mean vector and covariance
+    // matrix of the predictions with the GIL released, without materializing
+    // the full samples x observables matrix
+    unsigned
+    observable_predictor_predict_covariance(eos::ObservablePredictor & predictor, object samples, object weights, object mean, object covariance)
+    {
+        Py_buffer samples_buffer, weights_buffer, mean_buffer, covariance_buffer;
+
+        if (0 != PyObject_GetBuffer(samples.ptr(), &samples_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(weights.ptr(), &weights_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&samples_buffer);
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(mean.ptr(), &mean_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&weights_buffer);
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(covariance.ptr(), &covariance_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&weights_buffer);
+            PyBuffer_Release(&mean_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item          = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t columns       = predictor.number_of_varied_parameters();
+        const Py_ssize_t n_observables = predictor.number_of_observables();
+        const Py_ssize_t n_samples     = (columns > 0) ? samples_buffer.len / (item * columns) : 0;
+
+        if ((samples_buffer.itemsize != item) || (weights_buffer.itemsize != item)
+                || (mean_buffer.itemsize != item) || (covariance_buffer.itemsize != item)
+                || (samples_buffer.len != n_samples * columns * item)
+                || (weights_buffer.len != n_samples * item)
+                || (mean_buffer.len != n_observables * item)
+                || (covariance_buffer.len != n_observables * n_observables * item))
+        {
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&weights_buffer);
+            PyBuffer_Release(&mean_buffer);
+            PyBuffer_Release(&covariance_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "ObservablePredictor.predict_covariance: samples, weights, mean and covariance must be C-contiguous float64 arrays of shapes "
+                    "(n, number_of_varied_parameters), (n,), (number_of_observables,) and (number_of_observables, number_of_observables), respectively");
+            throw_error_already_set();
+        }
+
+        unsigned failures = 0;
+
+        // no Python objects are touched during the accumulation, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            failures = predictor.predict_covariance(static_cast<const double *>(samples_buffer.buf), static_cast<const double *>(weights_buffer.buf),
+                    n_samples, static_cast<double *>(mean_buffer.buf), static_cast<double *>(covariance_buffer.buf));
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&weights_buffer);
+            PyBuffer_Release(&mean_buffer);
+            PyBuffer_Release(&covariance_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&samples_buffer);
+        PyBuffer_Release(&weights_buffer);
+        PyBuffer_Release(&mean_buffer);
+        PyBuffer_Release(&covariance_buffer);
+
+        return failures;
+    }
+
+    // bulk evaluation of a PredictionGrid: evaluate all observables at all
+    // grid points for a whole matrix of samples with the GIL released,
+    // writing into a preallocated array
+    void
+    prediction_grid_evaluate(eos::PredictionGrid & grid, const std::vector<std::string> & varied_names, object samples, object results)
+    {
+        Py_buffer samples_buffer, results_buffer;
+
+        if (0 != PyObject_GetBuffer(samples.ptr(), &samples_buffer, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            throw_error_already_set();
+        }
+        if (0 != PyObject_GetBuffer(results.ptr(), &results_buffer, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+        {
+            PyBuffer_Release(&samples_buffer);
+            throw_error_already_set();
+        }
+
+        const Py_ssize_t item      = static_cast<Py_ssize_t>(sizeof(double));
+        const Py_ssize_t columns   = static_cast<Py_ssize_t>(varied_names.size());
+        const Py_ssize_t stride    = static_cast<Py_ssize_t>(grid.number_of_points()) * grid.number_of_observables();
+        const Py_ssize_t n_samples = (columns > 0) ? samples_buffer.len / (item * columns) : 1;
+
+        if ((results_buffer.itemsize != item)
+                || ((samples_buffer.len > 0) && (samples_buffer.itemsize != item))
+                || (samples_buffer.len != n_samples * columns * item)
+                || (results_buffer.len != n_samples * stride * item))
+        {
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&results_buffer);
+            PyErr_SetString(PyExc_ValueError,
+                    "PredictionGrid.evaluate: samples and results must be C-contiguous float64 arrays of shapes "
+                    "(n, len(varied_names)) and (n, number_of_points() * number_of_observables()), respectively");
+            throw_error_already_set();
+        }
+
+        std::vector<double> _samples;
+        if (samples_buffer.len > 0)
+        {
+            const double * begin = static_cast<const double *>(samples_buffer.buf);
+            _samples.assign(begin, begin + n_samples * columns);
+        }
+
+        // no Python objects are touched during the evaluation, so release the GIL
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            const std::vector<double> _results = grid.evaluate(varied_names, _samples);
+
+            double * out = static_cast<double *>(results_buffer.buf);
+            for (std::size_t i = 0, i_end = _results.size() ; i < i_end ; ++i)
+            {
+                out[i] = _results[i];
+            }
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            PyBuffer_Release(&samples_buffer);
+            PyBuffer_Release(&results_buffer);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+        PyBuffer_Release(&samples_buffer);
+        PyBuffer_Release(&results_buffer);
+    }
+
+    // retrieve a speculative prediction, with the GIL released while waiting
+    // for the background evaluation to complete
+    double
+    speculative_evaluator_value(eos::SpeculativeEvaluator & evaluator, const eos::ObservableCache::Id & id)
+    {
+        double result;
+
+        PyThreadState * thread_state = PyEval_SaveThread();
+        try
+        {
+            result = evaluator.value(id);
+        }
+        catch (...)
+        {
+            PyEval_RestoreThread(thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(thread_state);
+
+        return result;
+    }
+
     template <typename T> struct iterable_to_std_vector_converter
     {
             iterable_to_std_vector_converter() { converter::registry::push_back(&convertible, &construct, type_id<std::vector<T>>()); }
@@ -169,6 +1012,16 @@ BOOST_PYTHON_MODULE(_eos)
     def("_register_log_callback", &::impl::register_log_callback);
     def("_emit_native_log", &::impl::emit_native_log);
     def("_set_native_log_level", &::impl::set_native_log_level);
+
+    // global evaluation-precision policy
+    def("_set_evaluation_precision", &::impl::set_evaluation_precision);
+    def("_evaluation_precision", &::impl::evaluation_precision);
+    def("_integration_call_sites", &::impl::integration_call_sites);
+    def("_calibrate_integration_points", &::impl::calibrate_integration_points);
+    def("_clear_integration_calibration", &::impl::clear_integration_calibration);
+
+    // baked observable surrogates
+    def("_load_baked_observables", &::impl::load_baked_observables);
     enum_<LogLevel>("_NativeLogLevel")
             .value("SILENT", ll_silent)
             .value("ERROR", ll_error)
@@ -318,6 +1171,26 @@ BOOST_PYTHON_MODULE(_eos)
             :type value: float
             )")
             .def("has", &Parameters::has)
+            .def("values_view", &::impl::parameters_values_view, R"(
+            Returns a writable memoryview of the contiguous parameter-value array, indexed by parameter id.
+
+            Wrap it in ``numpy.frombuffer`` for a zero-copy float64 view; a whole parameter
+            point can then be updated with one vectorized assignment. Writes through the
+            view bypass the modification tracking and must be published by calling
+            :meth:`commit <eos.Parameters.commit>` before any dependent quantity is evaluated.
+            The view must not outlive this parameter set.
+        )")
+            .def("commit", &Parameters::commit, R"(
+            Publishes out-of-band writes made through :meth:`values_view <eos.Parameters.values_view>`.
+
+            Marks every parameter as modified in a new generation, so that caches pick up
+            the new values on their next update.
+        )")
+            .def("generation", &Parameters::generation, R"(
+            Returns the current generation of this parameter set.
+
+            The generation is incremented upon each modification of any parameter's value.
+        )")
             .def("override_from_file", &Parameters::override_from_file);
 
     // Mutable
@@ -392,6 +1265,15 @@ BOOST_PYTHON_MODULE(_eos)
             .def("__add__", &Kinematics::operator+)
             .def("__iter__", range(&Kinematics::begin, &Kinematics::end))
             .def("__getitem__", (KinematicVariable(Kinematics::*)(const std::string &) const) &Kinematics::operator[])
+            .def("set_all", &::impl::kinematics_set_all, R"(
+            Assigns all kinematic variables from a C-contiguous float64 array in one call.
+
+            The values are assigned in declaration order, with no per-element binding
+            overhead or name lookup; aliases need no separate update.
+
+            :param values: One new numeric value per declared variable.
+            :type values: numpy.ndarray
+        )", args("values"))
             .def("declare", &Kinematics::declare, return_value_policy<return_by_value>(), R"(
             Declares a new kinematic variable.
 
@@ -411,7 +1293,7 @@ BOOST_PYTHON_MODULE(_eos)
             .def("evaluate", &KinematicVariable::evaluate);
 
     // Options
-    ::impl::std_pair_to_python_converter<const std::string, std::string> converter_options_iter;
+    ::impl::std_pair_to_python_converter<std::string, std::string> converter_options_iter;
     class_<Options>("Options", R"(
             Represents the set of options provided to an observable.
 
@@ -485,6 +1367,7 @@ BOOST_PYTHON_MODULE(_eos)
             .staticmethod("GeVSecond")
             .def("Femtometer2", &Unit::Femtometer2)
             .staticmethod("Femtometer2")
+            .def("name", &Unit::name, return_value_policy<copy_const_reference>())
             .def("latex", &Unit::latex, return_value_policy<copy_const_reference>())
             .def("__eq__", &Unit::operator==);
 
@@ -546,13 +1429,139 @@ BOOST_PYTHON_MODULE(_eos)
             :rtype: int
         )",
                  args("observable"))
-            .def("update", &ObservableCache::update, R"(
+            .def("update", (void (ObservableCache::*)()) &ObservableCache::update, R"(
             Update the cache for the current parameter point.
         )")
             .def("parameters", &ObservableCache::parameters, R"(
             Retrieve the set of parameters bound to this cache.
+        )")
+            .def("evaluation_count", &ObservableCache::evaluation_count, R"(
+            Retrieve the number of times a cached observable has been (re)evaluated across all updates.
+
+            :param handle: The handle of the observable.
+            :type handle: int
+        )",
+                 args("handle"))
+            .def("evaluation_time", &ObservableCache::evaluation_time, R"(
+            Retrieve the cumulative wall-clock time, in seconds, spent evaluating a cached observable across all updates.
+
+            :param handle: The handle of the observable.
+            :type handle: int
+        )",
+                 args("handle"))
+            .def("number_of_updates", &ObservableCache::number_of_updates, R"(
+            Retrieve the number of cache updates carried out so far.
+        )")
+            .def("reset_statistics", &ObservableCache::reset_statistics, R"(
+            Reset the per-observable evaluation counters and timers.
         )");
 
+    // ObservablePredictor
+    class_<ObservablePredictor, boost::noncopyable>("ObservablePredictor", R"(
+        Predicts a set of observables for a whole matrix of parameter samples.
+
+        The evaluations run in C++ with the GIL released, distributed over a thread
+        pool with one clone of the parameters and observables per worker thread.
+    )",
+                                                    init<const Parameters &, const std::vector<ObservablePtr> &, const std::vector<std::string> &>())
+            .def("number_of_observables", &ObservablePredictor::number_of_observables, R"(
+            Retrieve the number of observables per sample, i.e. the number of results columns.
+        )")
+            .def("number_of_varied_parameters", &ObservablePredictor::number_of_varied_parameters, R"(
+            Retrieve the number of varied parameters, i.e. the number of samples columns.
+        )")
+            .def("predict", &::impl::observable_predictor_predict, R"(
+            Predict all observables for each of the samples.
+
+            :param samples: The parameter samples, a C-contiguous float64 array of shape (n, number_of_varied_parameters).
+            :type samples: numpy.ndarray
+            :param results: The preallocated output array, a C-contiguous float64 array of shape (n, number_of_observables).
+            :type results: numpy.ndarray
+
+            :returns: The number of samples whose predictions failed to evaluate; the corresponding rows are filled with NaN.
+            :rtype: int
+        )",
+                 args("samples", "results"))
+            .def("predict_covariance", &::impl::observable_predictor_predict_covariance, R"(
+            Predict all observables for each of the samples and accumulate their weighted
+            mean vector and covariance matrix in a single streaming pass.
+
+            The predictions themselves are never stored; the accumulation uses one
+            weighted Welford accumulator per thread-pool chunk, with an exact merge of
+            the per-chunk results.
+
+            :param samples: The parameter samples, a C-contiguous float64 array of shape (n, number_of_varied_parameters).
+            :type samples: numpy.ndarray
+            :param weights: The sample weights on a linear scale, a C-contiguous float64 array of shape (n,).
+            :type weights: numpy.ndarray
+            :param mean: The preallocated output array for the weighted means, a C-contiguous float64 array of shape (number_of_observables,).
+            :type mean: numpy.ndarray
+            :param covariance: The preallocated output array for the weighted covariance matrix, a C-contiguous float64 array of shape (number_of_observables, number_of_observables).
+            :type covariance: numpy.ndarray
+
+            :returns: The number of samples whose predictions failed to evaluate; these samples are excluded from the accumulation.
+            :rtype: int
+        )",
+                 args("samples", "weights", "mean", "covariance"));
+
+    // KinematicCoalescingPlan
+    ::impl::iterable_to_std_vector_converter<Constraint> iterable_to_std_vector_converter_Constraint;
+    class_<KinematicCoalescingPlan, boost::noncopyable>("KinematicCoalescingPlan", R"(
+        Discovers overlapping integration ranges of the same observable across the constraints
+        of an analysis, and plans a shared partition so that overlapping bins can reuse
+        evaluations.
+
+        Reassembling a bin from its atomic subranges is exact only for observables that are
+        additive in the integration variable, such as integrated branching ratios; normalized
+        or averaged observables must not be coalesced this way.
+    )",
+                                                        init<const std::vector<Constraint> &>())
+            .def("number_of_groups", &KinematicCoalescingPlan::number_of_groups, R"(
+            Retrieve the number of groups whose ranges overlap.
+        )")
+            .def("number_of_bins", &KinematicCoalescingPlan::number_of_bins, R"(
+            Retrieve the number of observable bins within the overlapping groups.
+        )")
+            .def("number_of_atomic_bins", &KinematicCoalescingPlan::number_of_atomic_bins, R"(
+            Retrieve the number of atomic subranges the overlapping groups coalesce into.
+        )")
+            .def("redundancy", &KinematicCoalescingPlan::redundancy, R"(
+            Retrieve the ratio of the total length of all grouped ranges to the length of
+            their union; a value of 3 means that shared quadrature removes two thirds of the
+            node evaluations.
+        )")
+            .def("__str__", &KinematicCoalescingPlan::as_string, return_value_policy<return_by_value>());
+
+    // PredictionGrid
+    class_<PredictionGrid, boost::noncopyable>("PredictionGrid", R"(
+        Evaluates a list of observables on a grid of kinematic points for many parameter samples at once.
+
+        Within one sample, all observables at all grid points share a single observable cache, so
+        expensive intermediate results (e.g. the transversity amplitudes entering the angular
+        observables) are computed once per sample and grid point, not once per observable. The
+        samples are split across the C++ thread pool, with one clone of the parameters and
+        observables per worker thread.
+    )",
+                                               init<const std::vector<QualifiedName> &, const Parameters &, const Options &, const std::vector<std::string> &,
+                                                    const std::vector<double> &>())
+            .def("number_of_observables", &PredictionGrid::number_of_observables, R"(
+            Retrieve the number of observables per grid point.
+        )")
+            .def("number_of_points", &PredictionGrid::number_of_points, R"(
+            Retrieve the number of kinematic points in the grid.
+        )")
+            .def("evaluate", &::impl::prediction_grid_evaluate, R"(
+            Evaluate all observables at all grid points for each of the parameter samples.
+
+            :param varied_names: The names of the parameters varied across the samples, in column order; may be empty, in which case the observables are evaluated once at the nominal parameter point.
+            :type varied_names: list of str
+            :param samples: The parameter samples, a C-contiguous float64 array of shape (n, len(varied_names)).
+            :type samples: numpy.ndarray
+            :param results: The preallocated output array, a C-contiguous float64 array of shape (n, number_of_points() * number_of_observables()).
+            :type results: numpy.ndarray
+        )",
+                 args("varied_names", "samples", "results"));
+
     // ReferenceName
     class_<ReferenceName>("ReferenceName", init<std::string>())
             .def("__str__", &ReferenceName::str, return_value_policy<copy_const_reference>())
@@ -561,6 +1570,40 @@ BOOST_PYTHON_MODULE(_eos)
             .def("__lt__", &ReferenceName::operator<);
     implicitly_convertible<std::string, ReferenceName>();
 
+    // SpeculativeEvaluator
+    class_<SpeculativeEvaluator, boost::noncopyable>("SpeculativeEvaluator", R"(
+        Pre-evaluates registered observables on a background thread whenever the
+        parameters change, so that interactive re-plots find their predictions
+        ready in the cache instead of blocking on their evaluation.
+    )",
+                                                     init<const Parameters &>())
+            .def("add", &SpeculativeEvaluator::add, R"(
+            Register an observable for speculative evaluation.
+
+            :param observable: The observable to register.
+            :type observable: eos.Observable
+
+            :returns: An internal handle to the registered observable. The observable's prediction can be retrieved using ``value(handle)``.
+            :rtype: int
+        )",
+                 args("observable"))
+            .def("notify", &SpeculativeEvaluator::notify, R"(
+            Notify the evaluator that the parameters may have changed; the registered
+            observables are then re-evaluated at the new point in the background.
+        )")
+            .def("value", &::impl::speculative_evaluator_value, R"(
+            Retrieve the prediction for a registered observable at the current parameter
+            point. If the background evaluation has completed, this is a plain cache
+            look-up; otherwise, it waits for (or triggers) the evaluation.
+
+            :param handle: The handle returned by add().
+            :type handle: int
+
+            :returns: The observable's prediction.
+            :rtype: float
+        )",
+                 args("handle"));
+
     // }}}
 
     // {{{ eos/statistics
@@ -586,7 +1629,27 @@ BOOST_PYTHON_MODULE(_eos)
             :rtype: eos.LogLikelihoodBlock
         )",
                  args("cache", "factory"))
-            .staticmethod("External");
+            .staticmethod("External")
+            .def("HistFactory", &::impl::make_histfactory_block, R"(
+            Create a new log-likelihood block for the main term of a binned HistFactory
+            likelihood, specified by a workspace file in the pyhf JSON format.
+
+            The workspace is evaluated natively, without per-evaluation calls into Python.
+            The modifiers' constraint terms are not part of the block; as for
+            :class:`eos.PyhfLogLikelihood`, they are expected to enter through the priors
+            of the analysis.
+
+            :param cache: The observable cache used by the total log-likelihood.
+            :type cache: eos.ObservableCache
+            :param workspace: The path of the workspace file.
+            :type workspace: str
+            :param parameter_map: Maps workspace parameter names to qualified names of EOS parameters or observables.
+            :type parameter_map: dict
+            :returns: The new block.
+            :rtype: eos.LogLikelihoodBlock
+        )",
+                 args("cache", "workspace", "parameter_map"))
+            .staticmethod("HistFactory");
 
     // LogLikelihood
     class_<LogLikelihood>("LogLikelihood", R"(
@@ -597,12 +1660,68 @@ BOOST_PYTHON_MODULE(_eos)
             .def("add", (void(LogLikelihood::*)(const LogLikelihoodBlockPtr &)) & LogLikelihood::add)
             .def("__iter__", range(&LogLikelihood::begin, &LogLikelihood::end))
             .def("observable_cache", &LogLikelihood::observable_cache)
-            .def("evaluate", &LogLikelihood::operator());
+            .def("evaluate", &::impl::log_likelihood_evaluate, R"(
+            Evaluates the log(likelihood) at the current parameter point.
+
+            The evaluation runs with the GIL released; external blocks reacquire it for
+            the duration of their callbacks.
+
+            :return: The value of the log(likelihood).
+            :rtype: float
+        )")
+            .def("resample", &::impl::log_likelihood_resample, R"(
+            Evaluates an ensemble of likelihoods whose experimental central values are
+            resampled from the constraints' own uncertainty distributions.
+
+            The observable predictions are computed once at the current parameter point
+            and shared across the ensemble; the replicas are evaluated concurrently.
+
+            :param datasets: Number of resampled replicas to evaluate.
+            :type datasets: int
+            :param seed: Seed for the random displacements; a given seed yields a reproducible ensemble.
+            :type seed: int
+            :returns: The log(likelihood) values of the replicas.
+            :rtype: list of float
+        )", args("datasets", "seed"))
+            .def("simulate", &::impl::log_likelihood_simulate, R"(
+            Simulates the distribution of the total-likelihood test statistic.
+
+            Pseudo-datasets are drawn from the likelihood's constraints at the predictions
+            of the current parameter point, and each one is scored with its generating
+            distribution. The predictions are computed once and shared across the
+            ensemble; the pseudo-datasets are evaluated concurrently.
+
+            :param datasets: Number of pseudo-datasets to draw.
+            :type datasets: int
+            :param seed: Seed for the pseudo-dataset draws; a given seed yields a reproducible ensemble.
+            :type seed: int
+            :returns: The simulated test statistic values.
+            :rtype: list of float
+        )", args("datasets", "seed"))
+            .def("number_of_evaluations", &LogLikelihood::number_of_evaluations, R"(
+            Retrieve the number of likelihood evaluations carried out so far.
+        )");
 
     // Constraint
+    ::impl::std_vector_to_python_converter<Constraint> converter_std_vector_constraint;
     class_<Constraint>("Constraint", no_init)
             .def("make", &Constraint::make, return_value_policy<return_by_value>())
             .staticmethod("make")
+            .def("make_all", &::impl::constraint_make_all, R"(
+            Create several of the built-in constraints at once.
+
+            The constraints are constructed concurrently on the thread pool and
+            returned in the order of their names, which amortizes the
+            construction cost when assembling a large likelihood.
+
+            :param names: Names of the constraints.
+            :type names: list of eos.QualifiedName
+            :param options: Options common to all of the constraints.
+            :type options: eos.Options
+            :returns: The constraints, in the order of their names.
+            :rtype: list of eos.Constraint
+        )", args("names", "options"))
+            .staticmethod("make_all")
             .def("name", &Constraint::name, return_value_policy<copy_const_reference>())
             .def("blocks", range(&Constraint::begin_blocks, &Constraint::end_blocks))
             .def("observables", range(&Constraint::begin_observables, &Constraint::end_observables));
@@ -634,6 +1753,9 @@ BOOST_PYTHON_MODULE(_eos)
     ::impl::iterable_to_std_vector_converter<QualifiedName>       iterable_to_std_vector_converter_QualifiedName;
     ::impl::iterable_to_std_vector_converter<double>              iterable_to_std_vector_converter_double;
     ::impl::iterable_to_std_vector_converter<std::vector<double>> iterable_to_std_vector_converter_vector_double;
+    ::impl::iterable_to_std_vector_converter<std::string>         iterable_to_std_vector_converter_string;
+    ::impl::iterable_to_std_vector_converter<ObservablePtr>       iterable_to_std_vector_converter_ObservablePtr;
+    ::impl::iterable_to_std_vector_converter<SignalPDFPtr>        iterable_to_std_vector_converter_SignalPDFPtr;
     class_<LogPrior, boost::noncopyable>("LogPrior", R"(
             Represents a Bayesian prior on the log scale.
 
@@ -769,7 +1891,21 @@ BOOST_PYTHON_MODULE(_eos)
             Returns the cumulative probabilities :math:`p` assigned to each parameter via its
             :meth:`Parameter.evaluate_generator` method.
         )")
-            .def("varied_parameters", range(&LogPrior::begin, &LogPrior::end));
+            .def("varied_parameters", range(&LogPrior::begin, &LogPrior::end))
+            .def("dimension", &LogPrior::dimension, R"(
+            Returns the number of varied parameters covered by this prior.
+        )")
+            .def("inverse_cdf", &::impl::log_prior_inverse_cdf, R"(
+            Applies the inverse CDF to a whole matrix of uniform variates.
+
+            The transform runs in C++ with the GIL released.
+
+            :param u: The uniform variates in [0, 1), a C-contiguous float64 array of shape (n, dimension).
+            :type u: numpy.ndarray
+            :param out: The preallocated output array for the prior samples, of the same shape as ``u``.
+            :type out: numpy.ndarray
+        )",
+                 args("u", "out"));
 
     // LogPosterior
     class_<LogPosterior>("LogPosterior", R"(
@@ -785,15 +1921,213 @@ BOOST_PYTHON_MODULE(_eos)
             .def("log_priors", range(&LogPosterior::begin_priors, &LogPosterior::end_priors), R"(
             Returns a range of :class:`LogPrior` objects used as part of the posterior.
         )")
-            .def("evaluate", &LogPosterior::evaluate, R"(
+            .def("evaluate", &::impl::log_posterior_evaluate, R"(
             Returns the posterior probability density.
+
+            The evaluation runs with the GIL released, so that calls dispatched to worker
+            threads (e.g. through :mod:`eos.aio`) do not stall the interpreter.
+        )")
+            .def("prepare", &LogPosterior::prepare, R"(
+            Prepares the posterior for a long-running fit.
+
+            Calibrates the per-observable cost estimates from timed evaluations at the
+            current parameter point; subsequent evaluations reuse them when scheduling
+            their work. A summary of the resulting plan is logged.
+
+            :param repetitions: Number of timed calibration evaluations per observable.
+            :type repetitions: int
+        )", args("repetitions"))
+            .def("timing_profile", &LogPosterior::timing_profile, R"(
+            Returns a hierarchical timing profile of one posterior evaluation.
+
+            Each prior, each observable of each constraint, and each constraint's
+            likelihood blocks are timed individually. The result is a string in
+            collapsed-stack format -- one line of semicolon-separated frames followed
+            by the average evaluation time in nanoseconds -- which flamegraph tooling
+            (e.g. flamegraph.pl or speedscope) consumes directly.
+
+            :param repetitions: Number of timed evaluations over which each entry is averaged.
+            :type repetitions: int
+        )", args("repetitions"))
+            .def("gradient", &::impl::log_posterior_gradient, R"(
+            Evaluates the gradient of the log(posterior) at the current parameter values.
+
+            The prior contributions are computed analytically, the likelihood contributions
+            numerically, in parallel and with the GIL released.
+
+            :param out: C-contiguous, writable float64 array with one entry per varied parameter, in the order of the varied parameters.
+            :type out: numpy.ndarray
+        )", args("out"));
+
+    // MarkovChainSampler
+    register_ptr_to_python<std::shared_ptr<MarkovChainSampler>>();
+    ::impl::std_vector_to_python_converter<double> converter_std_vector_double;
+    class_<MarkovChainSampler, std::shared_ptr<MarkovChainSampler>, boost::noncopyable>("_MarkovChainSampler", R"(
+            Draws samples of a LogPosterior using a native adaptive random-walk Metropolis algorithm.
+        )",
+                                                                                        no_init)
+            .def("__init__", make_constructor(&::impl::make_markov_chain_sampler))
+            .def("run", &MarkovChainSampler::run, R"(
+            Carries out the preruns and the main run.
+        )")
+            .def("dimension", &MarkovChainSampler::dimension, R"(
+            Returns the number of varied parameters.
+        )")
+            .def("samples", &MarkovChainSampler::samples, return_value_policy<return_by_value>(), R"(
+            Returns the main run's samples in parameter space, flattened in row-major order.
+        )")
+            .def("usamples", &MarkovChainSampler::usamples, return_value_policy<return_by_value>(), R"(
+            Returns the main run's samples in u space, flattened in row-major order.
+        )")
+            .def("weights", &MarkovChainSampler::weights, return_value_policy<return_by_value>(), R"(
+            Returns the values of the log(posterior) associated with the samples.
+        )")
+            .def("acceptance_rate", &MarkovChainSampler::acceptance_rate, R"(
+            Returns the acceptance rate of the main run.
+        )");
+
+    // PriorSampler
+    register_ptr_to_python<std::shared_ptr<PriorSampler>>();
+    class_<PriorSampler, std::shared_ptr<PriorSampler>, boost::noncopyable>("_PriorSampler", R"(
+            Draws batches of samples from the priors of a LogPosterior, using pseudo-random,
+            antithetic, or randomized Sobol uniform variates.
+        )",
+                                                                            no_init)
+            .def("__init__", make_constructor(&::impl::make_prior_sampler))
+            .def("sample", &::impl::prior_sampler_sample, R"(
+            Draws a batch of prior samples; successive calls continue the underlying sequence.
+
+            :param out: C-contiguous, writable float64 array of shape (n, dimension).
+            :type out: numpy.ndarray
+        )", args("out"))
+            .def("seek", &PriorSampler::seek, R"(
+            Positions the sampler at the given absolute sample index.
+
+            The pseudo and antithetic schemes are counter-based, so workers can partition one
+            reproducible sequence by seeking to disjoint index ranges. Not supported for the
+            sobol scheme.
+
+            :param index: Index of the next sample to be drawn.
+            :type index: int
+        )", args("index"))
+            .def("dimension", &PriorSampler::dimension, R"(
+            Returns the number of varied parameters.
         )");
 
+    // PriorTransform
+    class_<PriorTransform>("PriorTransform", R"(
+            Maps batches of unit-hypercube points to the parameter space of a LogPosterior,
+            through the inverse CDFs of its priors and in their order. Serves external
+            nested-sampling implementations; the posterior is cloned at construction, so the
+            transform does not modify the posterior's parameters.
+        )",
+                           init<LogPosterior>())
+            .def("dimension", &PriorTransform::dimension, R"(
+            Returns the number of varied parameters.
+        )")
+            .def("transform", &::impl::prior_transform_transform, R"(
+            Transforms a batch of unit-hypercube points to parameter space.
+
+            :param u: C-contiguous float64 array of shape (n, dimension) with entries in [0, 1).
+            :type u: numpy.ndarray
+            :param points: C-contiguous, writable float64 array of shape (n, dimension).
+            :type points: numpy.ndarray
+        )", args("u", "points"))
+            .def("transform_and_evaluate", &::impl::prior_transform_transform_and_evaluate, R"(
+            Transforms a batch of unit-hypercube points and evaluates the log(likelihood) at each.
+
+            The evaluations are dispatched across the worker threads, each using its own clone
+            of the posterior, with the GIL released. The results are pure likelihood values,
+            without the prior contribution. A point whose evaluation raises an exception yields
+            -inf.
+
+            :param u: C-contiguous float64 array of shape (n, dimension) with entries in [0, 1).
+            :type u: numpy.ndarray
+            :param points: C-contiguous, writable float64 array of shape (n, dimension).
+            :type points: numpy.ndarray
+            :param results: C-contiguous, writable float64 array of shape (n,).
+            :type results: numpy.ndarray
+        )", args("u", "points", "results"));
+
+    // SampleSink
+    class_<SampleSink, boost::noncopyable>("SampleSink", R"(
+            Streams samples, their weights, and optionally the associated log-posterior values to
+            NumPy-compatible files on disk as they are produced. The memory footprint is bounded
+            by the in-memory buffer instead of the run length, and the files match the directory
+            layout read by the eos.data classes.
+        )",
+                                           init<std::string, unsigned, bool, unsigned>())
+            .def(init<std::string, unsigned, bool>())
+            .def(init<std::string, unsigned>())
+            .def("append", (void (SampleSink::*)(const std::vector<double> &, const double &)) &SampleSink::append, R"(
+            Appends one sample together with its weight.
+        )")
+            .def("append", (void (SampleSink::*)(const std::vector<double> &, const double &, const double &)) &SampleSink::append, R"(
+            Appends one sample together with its weight and its log-posterior value.
+        )")
+            .def("flush", &SampleSink::flush, R"(
+            Writes all buffered rows to disk.
+        )")
+            .def("close", &SampleSink::close, R"(
+            Flushes and finalizes the files on disk; appending afterwards raises an error.
+        )")
+            .def("dimension", &SampleSink::dimension, R"(
+            Returns the number of columns per sample.
+        )")
+            .def("size", &SampleSink::size, R"(
+            Returns the number of samples appended so far.
+        )")
+            .def("sketch", &SampleSink::sketch, R"(
+            Returns the quantile sketch of one column.
+
+            The returned sketch shares its state with the sink, and keeps accumulating
+            as further rows are appended.
+
+            :param column: Index of the column.
+            :type column: int
+            :rtype: eos.QuantileSketch
+        )", args("column"));
+
+    // QuantileSketch
+    ::impl::std_pair_to_python_converter<double, double> converter_quantile_sketch_interval;
+    class_<QuantileSketch>("QuantileSketch", R"(
+            Summarizes a stream of weighted values in a bounded number of centroids, from which
+            weighted quantiles and credible intervals are extracted without retaining the full
+            stream. Sketches filled independently, e.g. on several processes, can be merged
+            into one summary.
+        )",
+                           init<unsigned>())
+            .def(init<>())
+            .def("add", &QuantileSketch::add, R"(
+            Adds one value with the given weight to the stream.
+        )", (arg("value"), arg("weight") = 1.0))
+            .def("merge", &QuantileSketch::merge, R"(
+            Folds another sketch's summary into this one.
+        )", args("other"))
+            .def("total_weight", &QuantileSketch::total_weight, R"(
+            Returns the total weight of the stream so far.
+        )")
+            .def("min", &QuantileSketch::min, R"(
+            Returns the smallest value of the stream.
+        )")
+            .def("max", &QuantileSketch::max, R"(
+            Returns the largest value of the stream.
+        )")
+            .def("quantile", &QuantileSketch::quantile, R"(
+            Returns the weighted quantile at probability p in [0, 1].
+        )", args("p"))
+            .def("hpd_interval", &QuantileSketch::hpd_interval, R"(
+            Returns the shortest interval containing the given probability mass as a
+            (lower, upper) pair. For unimodal marginal densities this coincides with the
+            highest-posterior-density (HPD) credible interval.
+        )", args("level"));
+
     // test_statistics::ChiSquare
     class_<test_statistics::ChiSquare>("test_statisticsChiSquare", no_init)
             .def_readonly("chi2", &test_statistics::ChiSquare::chi2)
             .def_readonly("dof", &test_statistics::ChiSquare::dof)
-            .def_readonly("signed_chi", &test_statistics::ChiSquare::signed_chi);
+            .def_readonly("signed_chi", &test_statistics::ChiSquare::signed_chi)
+            .def_readonly("local_p_value", &test_statistics::ChiSquare::local_p_value);
 
     // GoodnessOfFit
     ::impl::std_pair_to_python_converter<const QualifiedName, test_statistics::ChiSquare> converter_goodnessoffit_chi_square_iter;
@@ -808,6 +2142,10 @@ BOOST_PYTHON_MODULE(_eos)
         )")
             .def("total_degrees_of_freedom", &GoodnessOfFit::total_degrees_of_freedom, R"(
             Returns the total number of degrees of freedom in the log(posterior).
+        )")
+            .def("total_p_value", &GoodnessOfFit::total_p_value, R"(
+            Returns the p value associated with the total :math:`\chi^2` value and the total
+            number of degrees of freedom; NaN if the number of degrees of freedom is not positive.
         )");
 
     // }}}
@@ -857,13 +2195,45 @@ BOOST_PYTHON_MODULE(_eos)
         )",
                  args("name", "parameters", "kinematics", "options"))
             .staticmethod("make")
-            .def("evaluate", &Observable::evaluate, R"(
+            .def("evaluate", &::impl::observable_evaluate, R"(
             Evaluates the observable for the present values of its bound set of parameters and set of kinematic variables.
 
+            The evaluation runs with the GIL released, so that calls dispatched to worker
+            threads (e.g. through :mod:`eos.aio`) do not stall the interpreter.
+
             :return: The value of the observable.
             :rtype: float
         )",
                  args("self"))
+            .def("evaluate_many", &::impl::observable_evaluate_many, R"(
+            Evaluates the observable once for each element of a sequence of values of one kinematic variable.
+
+            The loop over the values runs in C++ with the GIL released, updating the bound kinematic
+            variable in place; this is substantially faster than repeated calls to
+            :meth:`evaluate <eos.Observable.evaluate>`.
+
+            :param kinematic_name: The name of the kinematic variable to scan; must be bound to this observable.
+            :type kinematic_name: str
+            :param values: The values of the kinematic variable for which the observable shall be evaluated.
+            :type values: iterable of float
+            :return: The values of the observable.
+            :rtype: list of float
+        )",
+                 args("self", "kinematic_name", "values"))
+            .def("freeze", &Observable::freeze, R"(
+            Returns a specialized observable bound to a frozen parameter snapshot.
+
+            The specialized observable memoizes its value: as long as none of the parameters
+            it actually uses is modified, repeated evaluations are served from the memo
+            without re-computing the observable. Intended for deployments that fix most
+            parameters permanently.
+
+            :param parameters: The parameter snapshot against which to freeze.
+            :type parameters: eos.Parameters
+            :return: The specialized observable.
+            :rtype: eos.Observable
+        )",
+                 args("self", "parameters"))
             .def("name", &Observable::name, return_value_policy<copy_const_reference>(), R"(
             Returns the name of the observable.
         )")
@@ -921,6 +2291,13 @@ BOOST_PYTHON_MODULE(_eos)
         )",
                  args("name", "latex", "unit", "options", "expression"))
             .def("__contains__", &Observables::has)
+            .def("preload", &Observables::preload, R"(
+            Materializes all sections of the observable registry at once.
+
+            Name look-ups materialize the registry section by section, on demand; tools
+            that iterate over all observables can preload to pay the full cost up front.
+        )")
+            .staticmethod("preload")
             .def("sections", range(&Observables::begin_sections, &Observables::end_sections));
 
 
@@ -962,6 +2339,61 @@ BOOST_PYTHON_MODULE(_eos)
             Returns the set of kinematic variables bound to this PDF.
         )");
 
+    // SignalPDFNormalizationPlan
+    class_<SignalPDFNormalizationPlan, boost::noncopyable>("SignalPDFNormalizationPlan", R"(
+            Computes and caches the normalization constants of a set of signal PDFs.
+
+            The plan renormalizes all of its PDFs in one pass that is parallelized across the
+            thread pool, and caches the results by the generation of each PDF's parameter set:
+            an update only renormalizes those PDFs whose parameters changed since the last update.
+    )",
+                                                          init<const std::vector<SignalPDFPtr> &>())
+            .def("update", &SignalPDFNormalizationPlan::update, R"(
+            Recomputes the normalizations of all stale PDFs in one parallel pass.
+        )")
+            .def("normalization", &SignalPDFNormalizationPlan::normalization, R"(
+            Returns the cached normalization of a given PDF, on the log scale.
+
+            :param index: The index of the PDF within the plan, following the order of construction.
+            :type index: int
+        )",
+                 args("index"))
+            .def("size", &SignalPDFNormalizationPlan::size, R"(
+            Returns the number of PDFs covered by the plan.
+        )");
+
+    // SignalPDFEventBlock
+    register_ptr_to_python<std::shared_ptr<SignalPDFEventBlock>>();
+    class_<SignalPDFEventBlock, std::shared_ptr<SignalPDFEventBlock>, boost::noncopyable>("SignalPDFEventBlock", R"(
+            Evaluates the unbinned log-likelihood of a signal PDF over a fixed block of events.
+
+            The events are loaded once, at construction, into a columnar buffer with one column per
+            kinematic variable; :meth:`log_pdf_sum <eos.SignalPDFEventBlock.log_pdf_sum>` then sums
+            the normalized log PDF over all events at the current parameter point in C++, partitioned
+            across the thread pool.
+
+            :param name: The name of the signal PDF.
+            :type name: eos.QualifiedName
+            :param parameters: The set of parameters at which the PDF shall be evaluated; subsequent changes to these parameters are picked up by log_pdf_sum.
+            :type parameters: eos.Parameters
+            :param kinematics: The set of kinematic variables bound to the PDF, including the integration boundaries of its normalization.
+            :type kinematics: eos.Kinematics
+            :param options: The set of options used when creating the PDF.
+            :type options: eos.Options
+            :param kinematic_names: The names of the per-event kinematic variables, one per row of the event block.
+            :type kinematic_names: list of str
+            :param events: C-contiguous float64 array of shape (len(kinematic_names), n), holding one row per kinematic variable.
+            :type events: numpy.ndarray
+    )",
+                                                                                          no_init)
+            .def("__init__", make_constructor(&::impl::make_signal_pdf_event_block))
+            .def("number_of_events", &SignalPDFEventBlock::number_of_events, R"(
+            Returns the number of events in the block.
+        )")
+            .def("log_pdf_sum", &::impl::signal_pdf_event_block_log_pdf_sum, R"(
+            Returns the total unbinned log-likelihood of the block at the current parameter point.
+        )");
+
     // SignalPDFEntry
     register_ptr_to_python<std::shared_ptr<const SignalPDFEntry>>();
     class_<SignalPDFEntry, boost::noncopyable>("SignalPDFEntry", no_init)
@@ -62,7 +62,23 @@ namespace eos
     double
     ExternalLogLikelihoodBlock::evaluate() const
     {
-        return extract<double>(_evaluate());
+        // the surrounding likelihood may be evaluated from a context that has
+        // released the GIL; reacquire it for the duration of the callback
+        PyGILState_STATE gil_state = PyGILState_Ensure();
+
+        double result;
+        try
+        {
+            result = extract<double>(_evaluate());
+        }
+        catch (...)
+        {
+            PyGILState_Release(gil_state);
+            throw;
+        }
+        PyGILState_Release(gil_state);
+
+        return result;
     }
 
     unsigned int
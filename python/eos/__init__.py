@@ -36,21 +36,80 @@ try:
 except NameError:
     pass
 
+import sys
+
 from _eos import *
 from _eos import __version__
-from .data import *
-from .plot import *
-from .datasets import DataSets
-from .analysis import Analysis, BestFitPoint
-from .analysis_file import AnalysisFile
-from .constraint import Constraints
-from .ipython import __ipython__
-from .observable import Observables
-from .parameter import Parameters
-from .reference import References
-from .signal_pdf import SignalPDF, SignalPDFs
-from .tasks import *
-from .pyhf_likelihood import PyhfLogLikelihood
+
+# detect an interactive IPython session without importing the formatters,
+# which would pull in numpy
+__ipython__ = False
+try:
+    if __IPYTHON__:
+        __ipython__ = True
+except NameError:
+    pass
+
+# The submodules below pull in heavy third-party packages (matplotlib, scipy,
+# pypmc, dynesty); loading them eagerly dominated the import time of scripts
+# that only use the native classes. They are resolved lazily through the
+# module-level __getattr__ (PEP 562) on first attribute access instead.
+import importlib as _importlib
+
+_lazy_submodules = (
+    'aio',
+    'data',
+    'datasets',
+    'figure',
+    'plot',
+    'tasks',
+)
+
+_lazy_attributes = {
+    'Analysis':            '.analysis',
+    'BestFitPoint':        '.analysis',
+    'AnalysisFile':        '.analysis_file',
+    'Constraints':         '.constraint',
+    'DataSets':            '.datasets',
+    'DataSetImporter':     '.datasets',
+    'DataSetExporter':     '.datasets',
+    'Observables':         '.observable',
+    'Parameters':          '.parameter',
+    'PyhfLogLikelihood':   '.pyhf_likelihood',
+    'References':          '.reference',
+    'SignalPDF':           '.signal_pdf',
+    'SignalPDFs':          '.signal_pdf',
+}
+
+def __getattr__(name):
+    if name.startswith('__') and name.endswith('__'):
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+    if name in _lazy_submodules:
+        module = _importlib.import_module('.' + name, __name__)
+        globals()[name] = module
+        return module
+
+    if name in _lazy_attributes:
+        module = _importlib.import_module(_lazy_attributes[name], __name__)
+        value = getattr(module, name)
+        globals()[name] = value
+        return value
+
+    # names historically star-exported from eos.tasks and eos.data
+    for fallback in ('.tasks', '.data'):
+        module = _importlib.import_module(fallback, __name__)
+        try:
+            value = getattr(module, name)
+            globals()[name] = value
+            return value
+        except AttributeError:
+            pass
+
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+def __dir__():
+    return sorted(set(globals()) | set(_lazy_submodules) | set(_lazy_attributes))
 
 import logging
 logging.addLevelName(logging.INFO + 1, 'INPROGRESS')
@@ -124,6 +183,22 @@ def _log_callback(id, level, msg):
 
 _register_log_callback(_log_callback)
 
+def load_baked_observables(file):
+    """
+    Loads a baked observable table file, as produced by the ``bake`` task.
+
+    Registers one observable per stored table under the source observable's
+    name with a ``baked`` suffix; the registered observables evaluate by
+    multilinear interpolation on the memory-mapped table.
+
+    :param file: The path to the table file.
+    :type file: str
+    :returns: The names under which the tables' observables have been registered.
+    :rtype: list of str
+    """
+    from _eos import _load_baked_observables
+    return _load_baked_observables(file)
+
 # log to stderr by default in non-interactive Python code
 if not __ipython__:
     import logging
@@ -134,10 +209,10 @@ if not __ipython__:
 import time as _time
 import os as _os
 def installation_time():
-    return _time.ctime(_os.path.getmtime(eos.__file__))
+    return _time.ctime(_os.path.getmtime(__file__))
 
 def installation_dir():
-    return _os.path.dirname(eos.__file__)
+    return _os.path.dirname(__file__)
 
 # setup IPython integration
 if __ipython__:
@@ -0,0 +1,118 @@
+#!/usr/bin/python
+# vim: set sw=4 sts=4 et tw=120 :
+
+# Copyright (c) 2026 Danny van Dyk
+#
+# This file is part of the EOS project. EOS is free software;
+# you can redistribute it and/or modify it under the terms of the GNU General
+# Public License version 2, as published by the Free Software Foundation.
+#
+# EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+# Place, Suite 330, Boston, MA  02111-1307  USA
+
+"""
+Awaitable variants of the expensive EOS entry points.
+
+The functions in this module dispatch their underlying call to a worker
+thread and return an :mod:`asyncio` awaitable. The bindings they wrap
+release the GIL while the C++ code runs, so a Jupyter kernel or any other
+asyncio event loop stays responsive during long evaluations, and independent
+evaluations can overlap.
+
+Note that most EOS objects share a mutable :class:`Parameters <eos.Parameters>`
+set. Overlapping evaluations are only independent if they act on independent
+clones; awaiting each result before modifying the shared parameters is always
+safe.
+"""
+
+import asyncio
+import atexit
+import concurrent.futures
+import functools
+import os
+
+_executor = None
+
+def _get_executor():
+    global _executor
+    if _executor is None:
+        _executor = concurrent.futures.ThreadPoolExecutor(
+            max_workers=min(4, os.cpu_count() or 1),
+            thread_name_prefix='eos-aio')
+        atexit.register(_executor.shutdown)
+    return _executor
+
+def dispatch(func, /, *args, **kwargs):
+    """Runs ``func(*args, **kwargs)`` in a worker thread.
+
+    This is the generic entry point underlying all awaitable variants in this
+    module; it can wrap any callable whose binding releases the GIL.
+
+    :param func: The callable to dispatch.
+    :returns: An awaitable yielding the callable's result.
+    """
+    loop = asyncio.get_running_loop()
+    return loop.run_in_executor(_get_executor(), functools.partial(func, *args, **kwargs))
+
+async def evaluate(observable):
+    """Awaitable variant of :meth:`Observable.evaluate <eos.Observable.evaluate>`.
+
+    :param observable: The observable to evaluate.
+    :type observable: eos.Observable
+    """
+    return await dispatch(observable.evaluate)
+
+async def evaluate_many(observable, kinematic_name, values):
+    """Awaitable variant of :meth:`Observable.evaluate_many <eos.Observable.evaluate_many>`.
+
+    :param observable: The observable to evaluate.
+    :type observable: eos.Observable
+    :param kinematic_name: The name of the kinematic variable to scan.
+    :type kinematic_name: str
+    :param values: The values of the kinematic variable for which the observable shall be evaluated.
+    :type values: iterable of float
+    """
+    return await dispatch(observable.evaluate_many, kinematic_name, values)
+
+async def evaluate_grid(grid, varied_names, samples, results):
+    """Awaitable variant of :meth:`PredictionGrid.evaluate <eos.PredictionGrid.evaluate>`.
+
+    :param grid: The prediction grid to evaluate.
+    :type grid: eos.PredictionGrid
+    :param varied_names: The names of the varied parameters, one per sample column.
+    :type varied_names: list of str
+    :param samples: C-contiguous float64 array of shape ``(n, len(varied_names))``.
+    :param results: C-contiguous, writable float64 array receiving the predictions.
+    """
+    return await dispatch(grid.evaluate, varied_names, samples, results)
+
+async def evaluate_log_likelihood(log_likelihood):
+    """Awaitable variant of :meth:`LogLikelihood.evaluate <eos.LogLikelihood.evaluate>`.
+
+    :param log_likelihood: The log(likelihood) to evaluate.
+    :type log_likelihood: eos.LogLikelihood
+    """
+    return await dispatch(log_likelihood.evaluate)
+
+async def evaluate_log_posterior(log_posterior):
+    """Awaitable variant of :meth:`LogPosterior.evaluate <eos.LogPosterior.evaluate>`.
+
+    :param log_posterior: The log(posterior) to evaluate.
+    :type log_posterior: eos.LogPosterior
+    """
+    return await dispatch(log_posterior.evaluate)
+
+async def sample_prior(sampler, out):
+    """Awaitable variant of :meth:`PriorSampler.sample <eos.PriorSampler.sample>`.
+
+    :param sampler: The prior sampler to draw from.
+    :type sampler: eos.PriorSampler
+    :param out: C-contiguous, writable float64 array of shape ``(n, dimension)``.
+    """
+    return await dispatch(sampler.sample, out)
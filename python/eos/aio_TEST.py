@@ -0,0 +1,40 @@
+import unittest
+import asyncio
+import eos
+
+class AwaitableEvaluationTests(unittest.TestCase):
+
+    def test_evaluate(self):
+        "awaitable observable evaluation matches the synchronous result"
+
+        observable = eos.Observable.make('B->Dlnu::BR;l=e,q=d',
+                eos.Parameters.Defaults(), eos.Kinematics(q2_min=0.02, q2_max=11.6), eos.Options())
+
+        synchronous = observable.evaluate()
+        awaited = asyncio.run(eos.aio.evaluate(observable))
+
+        self.assertEqual(awaited, synchronous)
+
+
+    def test_overlapping_evaluations(self):
+        "independent observables evaluate concurrently from one event loop"
+
+        parameters = eos.Parameters.Defaults()
+        kinematics = eos.Kinematics(q2_min=0.02, q2_max=11.6)
+        observables = [
+            eos.Observable.make('B->Dlnu::BR;l=e,q=d', parameters.clone(), kinematics, eos.Options())
+            for _ in range(4)
+        ]
+
+        async def evaluate_all():
+            return await asyncio.gather(*(eos.aio.evaluate(o) for o in observables))
+
+        results = asyncio.run(evaluate_all())
+
+        self.assertEqual(len(results), 4)
+        for result in results[1:]:
+            self.assertEqual(result, results[0])
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=5)
@@ -65,11 +65,15 @@ class Analysis:
     :type fixed_parameters: dict, optional
     :param parameters: The optional set of parameters that shall be used for this analysis. Defaults to `None` which means that a new instance of :class:`eos.Parameters` is created.
     :type parameters: :class:`eos.Parameters` or None, optional
+    :param constraint_entries: Pre-serialized constraint entries as (name, YAML string) pairs, e.g. as recorded by
+        :class:`eos.data.CompiledAnalysis`. Constraints listed here are deserialized directly instead of being resolved
+        through the constraints database.
+    :type constraint_entries: dict, optional
     """
 
-    def __init__(self, priors, likelihood, external_likelihood=[], global_options={}, manual_constraints={}, fixed_parameters={}, parameters=None):
+    def __init__(self, priors, likelihood, external_likelihood=[], global_options={}, manual_constraints={}, fixed_parameters={}, parameters=None, constraint_entries={}):
         """Constructor."""
-        self.init_args = { 'priors': priors, 'likelihood': likelihood, 'external_likelihood': external_likelihood, 'global_options': global_options, 'manual_constraints': manual_constraints, 'fixed_parameters':fixed_parameters }
+        self.init_args = { 'priors': priors, 'likelihood': likelihood, 'external_likelihood': external_likelihood, 'global_options': global_options, 'manual_constraints': manual_constraints, 'fixed_parameters':fixed_parameters, 'constraint_entries': constraint_entries }
         self.parameters = parameters if parameters else eos.Parameters.Defaults()
         """The set of parameters used for this analysis."""
         self.global_options = eos.Options()
@@ -222,15 +226,22 @@ class Analysis:
         # record all constraints that comprise the likelihood
         self._constraint_names = list(set_likelihood.union(set_manual_constraints))
 
-        # create the likelihood
+        # create the likelihood; the built-in constraints are constructed as one
+        # concurrent batch, which dominates the setup time of large likelihoods
+        builtin_names = [n for n in self._constraint_names
+                         if n not in manual_constraints.keys() and n not in constraint_entries.keys()]
+        builtin = dict(zip(builtin_names, eos.Constraint.make_all(builtin_names, self.global_options)))
         for constraint_name in self._constraint_names:
             if constraint_name in manual_constraints.keys():
                 import yaml
                 yaml_string = yaml.dump(self._sanitize_manual_input(manual_constraints[constraint_name]))
                 constraint_entry = eos.ConstraintEntry.deserialize(constraint_name, yaml_string)
                 constraint = constraint_entry.make(constraint_name, self.global_options)
+            elif constraint_name in constraint_entries.keys():
+                constraint_entry = eos.ConstraintEntry.deserialize(constraint_name, constraint_entries[constraint_name])
+                constraint = constraint_entry.make(constraint_name, self.global_options)
             else:
-                constraint = eos.Constraint.make(constraint_name, self.global_options)
+                constraint = builtin[constraint_name]
             self._log_likelihood.add(constraint)
 
         # add external likelihood
@@ -333,7 +344,7 @@ class Analysis:
         return eos.GoodnessOfFit(self._log_posterior)
 
 
-    def optimize(self, start_point=None, rng=np.random.mtrand, **kwargs):
+    def optimize(self, start_point=None, rng=np.random.mtrand, evaluation_log=None, **kwargs):
         r"""
         Optimize the log(posterior) and returns a best-fit-point summary.
 
@@ -342,9 +353,31 @@ class Analysis:
                             If not specified, optimization starts at the current parameter point.
         :type start_point: iterable, optional
         :param rng: Optional random number generator
+        :param evaluation_log: Optional path of a persistent evaluation log; cf. :class:`eos.data.EvaluationLog`.
+            Every log(posterior) evaluation of this run is appended to the log, and -- unless a start point is
+            specified -- the run warm starts from the best previously logged point. For the 'Nelder-Mead' method,
+            the best logged points also seed the initial simplex. The warm start cuts down the number of iterations
+            when the same analysis is re-optimized repeatedly, e.g. with slightly updated constraints.
+        :type evaluation_log: str, optional
         :param \**kwargs: Are passed to `scipy.optimize.minimize`
 
         """
+        _evaluation_log = None
+        if evaluation_log is not None:
+            _evaluation_log = eos.data.EvaluationLog(evaluation_log, len(self.varied_parameters))
+
+        # warm start from the logged evaluations when no start point is requested
+        u_start_point = None
+        if start_point is None and _evaluation_log is not None and len(_evaluation_log) > 0:
+            best = _evaluation_log.best(len(self.varied_parameters) + 1)
+            u_start_point = best[0, :-1]
+            eos.info(f'Warm starting optimization from the best of {len(_evaluation_log)} logged evaluations')
+
+            if kwargs.get('method', None) == 'Nelder-Mead' and best.shape[0] == len(self.varied_parameters) + 1:
+                options = dict(kwargs.get('options', {}))
+                options.setdefault('initial_simplex', best[:, :-1])
+                kwargs['options'] = options
+
         if str(start_point) == "random":
             # generate random uniform probabilities and store them in the generator values
             for param in self.varied_parameters:
@@ -364,9 +397,19 @@ class Analysis:
         # Update default values. If no keyword arguments are passed, kwargs is an empty dict
         scipy_opt_kwargs.update(kwargs)
 
+        if u_start_point is None:
+            u_start_point = self._par_to_u(_start_point)
+
+        objective = self.negative_log_pdf
+        if _evaluation_log is not None:
+            def objective(u, *args):
+                value = self.log_pdf(u, *args)
+                _evaluation_log.append(u, value)
+                return -value
+
         res = scipy.optimize.minimize(
-            self.negative_log_pdf,
-            self._par_to_u(_start_point),
+            objective,
+            u_start_point,
             args=None,
             bounds=[(0.0, 1.0) for _ in self.varied_parameters],
             **scipy_opt_kwargs)
@@ -419,7 +462,7 @@ class Analysis:
         return -self.log_pdf(u, *args)
 
 
-    def sample_prior(self, N=1000, rng=np.random.mtrand):
+    def sample_prior(self, N=1000, rng=np.random.mtrand, method='pseudo'):
         """
         Return prior samples of the parameters.
 
@@ -427,23 +470,46 @@ class Analysis:
 
         :param N: Number of samples that shall be returned
         :type N: int
-        :param rng: Optional random number generator
+        :param rng: Optional random number generator; for the 'antithetic' and 'sobol' methods, only used to seed the native sampler.
+        :param method: Scheme by which the uniform variates are generated: 'pseudo' (default) for independent
+            pseudo-random variates, 'antithetic' for pseudo-random variates mirrored in pairs, or 'sobol' for a
+            randomized Sobol low-discrepancy sequence. The latter two are generated natively and reduce the number
+            of samples needed for stable prior-predictive bands.
+        :type method: str, optional
 
         :return: An iterable of the parameter samples of size N.
         """
-        samples = []
-        for _ in range(N):
-            u_samples = rng.uniform(0.0, 1.0, len(self.varied_parameters))
-            samples.append(self._u_to_par(u_samples))
-        return np.array(samples)
+        D = len(self.varied_parameters)
+
+        if method in ['antithetic', 'sobol']:
+            # derive a seed for the native sampler from the provided rng
+            seed = int(rng.uniform(0.0, 1.0) * 2**31)
+            sampler = eos._PriorSampler(self._log_posterior, method, seed)
+            samples = np.empty((N, D))
+            sampler.sample(samples)
+            return samples
+        elif method != 'pseudo':
+            raise ValueError(f'Unknown sampling method \'{method}\'')
+        u = rng.uniform(0.0, 1.0, (N, D))
+        samples = np.empty((N, D))
+
+        # each prior transforms its own columns in one batched C++ call
+        column = { p.name(): i for i, p in enumerate(self.varied_parameters) }
+        for prior in self._log_posterior.log_priors():
+            columns = [column[p.name()] for p in prior.varied_parameters()]
+            u_block = np.ascontiguousarray(u[:, columns])
+            out_block = np.empty_like(u_block)
+            prior.inverse_cdf(u_block, out_block)
+            samples[:, columns] = out_block
+        return samples
 
 
     def sample(self, N=1000, stride=5, pre_N=150, preruns=3, cov_scale=0.1, observables=None, start_point=None, rng=np.random.mtrand,
-               return_uspace=False):
+               return_uspace=False, checkpoint=None, checkpoint_interval=1000, proposal_file=None, screen=False):
         """
         Return samples of the parameters, log(weights), and optionally posterior-predictive samples for a sequence of observables.
 
-        Obtains random samples of the log(posterior) using an adaptive Markov Chain Monte Carlo with PyPMC.
+        Obtains random samples of the log(posterior) using a native adaptive Markov Chain Monte Carlo sampler.
         A prerun with adaptations is carried out first and its samples are discarded.
 
         :param N: Number of samples that shall be returned
@@ -455,64 +521,48 @@ class Analysis:
         :type observables: list-like, optional
         :param start_point: Optional starting point for the chain
         :type start_point: list-like, optional
-        :param rng: Optional random number generator (must be compatible with the requirements of pypmc.sampler.markov_chain.MarkovChain)
+        :param rng: Optional random number generator; only used to seed the native sampler.
+        :param checkpoint: Optional path of a binary checkpoint file. The sampler periodically appends its state
+            -- RNG state, adaptation state, and the chain's tail -- and resumes a preempted run from the last
+            complete record, provided the analysis and the sampling settings (including the seed) are unchanged.
+        :type checkpoint: str, optional
+        :param checkpoint_interval: Number of recorded samples between checkpoint records.
+        :type checkpoint_interval: int, optional
+        :param proposal_file: Optional path of a persistent proposal-state file. Once the preruns are complete,
+            the sampler stores its adapted proposal -- covariance and scale factor -- in this file; a later run
+            of the same analysis reuses that state and skips its preruns entirely. Unlike a checkpoint, the
+            proposal state is shared across runs with different seeds and run lengths.
+        :type proposal_file: str, optional
+        :param screen: If set to True, proposals are first screened against a coarse-precision clone
+            of the posterior, and the full posterior is only evaluated for proposals that survive the
+            screen. The delayed-acceptance construction keeps the chain exact; the screen merely removes
+            the full-precision cost of clearly-bad proposals, which dominate the preruns.
+        :type screen: bool, optional
 
         :return: A tuple of the parameters as array of size N, the logarithmic weights as array of size N, and optionally the posterior-predictive samples of the observables as array of size N x len(observables).
-
-        .. note::
-           This method requiries the PyPMC python module, which can be installed from PyPI.
         """
-        try:
-            from tqdm.auto import tqdm
-            progressbar = tqdm
-        except ImportError:
-            progressbar = lambda x, **kw: x
-
-        ind_lower = np.array([ 0.0 for _ in self.varied_parameters])
-        ind_upper = np.array([+1.0 for _ in self.varied_parameters])
-        ind = pypmc.tools.indicator.hyperrectangle(ind_lower, ind_upper)
+        # transform a provided start point to u space
+        if start_point is None:
+            u_start_point = []
+        else:
+            u_start_point = list(self._par_to_u(start_point))
 
-        log_target = pypmc.tools.indicator.merge_function_with_indicator(self.log_pdf, ind, -np.inf)
+        # derive a seed for the native sampler from the provided rng
+        seed = int(rng.uniform(0.0, 1.0) * 2**31)
 
-        # create initial covariance, assuming that each parameter's u-space value is uniformly distributed on [0, 1)
-        sigma = np.diag([1.0 / 12.0 * cov_scale for _ in self.varied_parameters])   # 1 / 12 is the vairance U(0, 1)
-        log_proposal = pypmc.density.gauss.LocalGauss(sigma)
+        sampler = eos._MarkovChainSampler(self._log_posterior, seed, preruns, pre_N, N, stride, cov_scale, u_start_point,
+                                          checkpoint if checkpoint is not None else '', checkpoint_interval,
+                                          proposal_file if proposal_file is not None else '', screen)
 
-        # create start point, if not provided or transform a provided start point to u space
-        if start_point is None:
-            start_point = np.array([rng.uniform(0.0, 1.0) for _ in self.varied_parameters])
-        else:
-            start_point = self._par_to_u(start_point)
-
-        # create MC sampler
-        sampler = pypmc.sampler.markov_chain.AdaptiveMarkovChain(log_target, log_proposal, start_point, save_target_values=True, rng=rng)
-
-        # pre run to adapt markov chains
-        eos.inprogress('Beginning preruns ...')
-        for i in progressbar(range(0, preruns), desc="Preruns", leave=False):
-            eos.info(f'Prerun {i} out of {preruns}')
-            accept_count = sampler.run(pre_N)
-            accept_rate  = accept_count / pre_N * 100
-            eos.info(f'Prerun {i}: acceptance rate is {accept_rate:3.0f}%')
-            sampler.adapt()
-        sampler.clear()
-        eos.completed(f'... completed {preruns} preruns')
-
-        # obtain final samples
-        eos.inprogress('Beginning main run ...')
-        sample_total  = N * stride
-        sample_chunk  = sample_total // 100
-        sample_chunks = [sample_chunk for i in range(0, 99)]
-        sample_chunks.append(sample_total - 99 * sample_chunk)
-        for current_chunk in progressbar(sample_chunks, desc="Main run", leave=False):
-            accept_count = accept_count + sampler.run(current_chunk)
-        accept_rate  = accept_count / (N * stride) * 100
+        eos.inprogress('Beginning preruns and main run ...')
+        sampler.run()
+        accept_rate = sampler.acceptance_rate() * 100
         eos.completed(f'... completed main run with acceptance rate {accept_rate:3.0f}%')
 
-        # Transform from generator values in u space to the parameter values
-        u_samples = sampler.samples[:][::stride]
-        parameter_samples = np.apply_along_axis(self._u_to_par, 1, u_samples)
-        weights = sampler.target_values[:][::stride, 0]
+        dimension = sampler.dimension()
+        parameter_samples = np.array(sampler.samples()).reshape(-1, dimension)
+        u_samples = np.array(sampler.usamples()).reshape(-1, dimension)
+        weights = np.array(sampler.weights())
 
         if not observables:
             if return_uspace:
@@ -148,11 +148,16 @@ class AnalysisFile:
                         eos.info(f'pyhf workspace parameter {pyhf_prior["parameter"]} added to prior; manually specify this prior to overwrite settings')
                         prior.append(PriorDescription.from_dict(**pyhf_prior))
 
-                # create likelihood block
-                llh_block = eos.LogLikelihoodBlock.External(
-                                cache,
-                                lambda cache: eos.PyhfLogLikelihood.factory(cache, workspace, parameter_map)
-                                )
+                # create likelihood block; evaluate the workspace natively when the
+                # parameter map only renames parameters, and fall back to the
+                # python-side bridge when it also assigns kinematics or options
+                if all(isinstance(v, str) for v in parameter_map.values()):
+                    llh_block = eos.LogLikelihoodBlock.HistFactory(cache, workspace, parameter_map)
+                else:
+                    llh_block = eos.LogLikelihoodBlock.External(
+                                    cache,
+                                    lambda cache: eos.PyhfLogLikelihood.factory(cache, workspace, parameter_map)
+                                    )
 
                 external_likelihood.extend([llh_block])
 
@@ -575,6 +575,75 @@ class Prediction:
         _np.save(os.path.join(path, 'weights.npy'), weights)
 
 
+class PredictionCovariance:
+    def __init__(self, path):
+        """ Read a PredictionCovariance object from disk.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description = yaml.load(df, Loader=yaml.SafeLoader)
+
+        if not description['type'] == 'PredictionCovariance':
+            raise RuntimeError(f'Path {path} not pointing to a PredictionCovariance')
+
+        self.type = 'PredictionCovariance'
+        self.observables = description['observables']
+        self.lookup_table = { item['name']: idx for idx, item in enumerate(self.observables) }
+
+        f = os.path.join(path, 'mean.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Mean file {f} does not exist or is not a file')
+        self.mean = _np.load(f)
+
+        f = os.path.join(path, 'covariance.npy')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Covariance file {f} does not exist or is not a file')
+        self.covariance = _np.load(f)
+
+
+    @staticmethod
+    def create(path, observables, mean, covariance):
+        """ Write a new PredictionCovariance object to disk.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param observables: Observables as a 1D array of shape (O, ).
+        :type observables: list or iterable of eos.Observable
+        :param mean: Weighted means of the observables as a 1D array of shape (O, ).
+        :type mean: 1D numpy array
+        :param covariance: Weighted covariance matrix of the observables as a 2D array of shape (O, O).
+        :type covariance: 2D numpy array
+        """
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'PredictionCovariance'
+        description['observables'] = [{
+            'name': o.name().full(),
+            'kinematics': { k.name(): float(k) for k in o.kinematics() }
+        } for o in observables]
+
+        if not mean.shape == (len(observables), ):
+            raise RuntimeError(f'Shape of mean {mean.shape} incompatible with number of observables {len(observables)}')
+
+        if not covariance.shape == (len(observables), len(observables)):
+            raise RuntimeError(f'Shape of covariance {covariance.shape} incompatible with number of observables {len(observables)}')
+
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
+            yaml.dump(description, description_file, default_flow_style=False)
+        _np.save(os.path.join(path, 'mean.npy'), mean)
+        _np.save(os.path.join(path, 'covariance.npy'), covariance)
+
+
 class DynestyResults:
     def __init__(self, path):
         """ Read Results object (in the dynesty.results module) from disk.
@@ -697,3 +766,219 @@ class NabuLikelihood:
             yaml.dump(description, description_file, default_flow_style=False)
 
         likelihood.save(os.path.join(path, 'likelihood.nabu'))
+
+
+class CompiledAnalysis:
+    def __init__(self, path):
+        """ Read a compiled analysis from disk.
+
+        A compiled analysis records the fully resolved inputs of an :class:`eos.Analysis` object:
+        the prior descriptions, the serialized constraint entries that comprise the likelihood,
+        and the global options and fixed parameters. Constructing an analysis from this artifact
+        skips the resolution of constraints through the constraints database, which dominates the
+        setup time when the same analysis is instantiated repeatedly, e.g. in batch jobs.
+
+        :param path: Path to the storage location.
+        :type path: str
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description = yaml.load(df, Loader=yaml.SafeLoader)
+
+        if not description['type'] == 'CompiledAnalysis':
+            raise RuntimeError(f'Path {path} not pointing to a CompiledAnalysis')
+
+        self.type = 'CompiledAnalysis'
+        self.priors = description['priors']
+        self.likelihood = description['likelihood']
+        self.global_options = description['global_options']
+        self.manual_constraints = description['manual_constraints']
+        self.fixed_parameters = description['fixed_parameters']
+        self.varied_parameters = description['parameters']
+
+        f = os.path.join(path, 'constraints.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Constraints file {f} does not exist or is not a file')
+
+        with open(f) as cf:
+            self.constraint_entries = yaml.load(cf, Loader=yaml.SafeLoader)
+
+
+    def analysis(self, parameters=None):
+        """ Create a new :class:`eos.Analysis` object from the compiled inputs.
+
+        :param parameters: The optional set of parameters that shall be used for the analysis; cf. :class:`eos.Analysis`.
+        :type parameters: :class:`eos.Parameters` or None, optional
+        """
+        return eos.Analysis(self.priors, self.likelihood,
+                            global_options=self.global_options,
+                            manual_constraints=self.manual_constraints,
+                            fixed_parameters=self.fixed_parameters,
+                            parameters=parameters,
+                            constraint_entries=self.constraint_entries)
+
+
+    @staticmethod
+    def create(path, analysis):
+        """ Write a new CompiledAnalysis object to disk.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param analysis: The analysis whose resolved inputs shall be recorded.
+        :type analysis: eos.Analysis
+        """
+        if analysis.init_args['external_likelihood']:
+            raise RuntimeError('Cannot compile an analysis with external likelihood blocks')
+
+        manual_constraints = {
+            name: eos.Analysis._sanitize_manual_input(entry)
+            for name, entry in analysis.init_args['manual_constraints'].items()
+        }
+
+        # freeze the database constraints as serialized entries
+        constraints = eos.Constraints()
+        constraint_entries = {}
+        for name in analysis.init_args['likelihood']:
+            constraint_entries[name] = constraints[eos.QualifiedName(name)].serialize()
+
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'CompiledAnalysis'
+        description['priors'] = analysis.init_args['priors']
+        description['likelihood'] = list(analysis.init_args['likelihood'])
+        description['global_options'] = dict(analysis.init_args['global_options'])
+        description['manual_constraints'] = manual_constraints
+        description['fixed_parameters'] = dict(analysis.init_args['fixed_parameters'])
+        description['parameters'] = [{
+            'name': p.name(),
+            'min': p.min(),
+            'max': p.max()
+        } for p in analysis.varied_parameters]
+
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
+            yaml.dump(description, description_file, default_flow_style=False)
+        with open(os.path.join(path, 'constraints.yaml'), 'w') as constraints_file:
+            yaml.dump(constraint_entries, constraints_file, default_flow_style=False)
+
+
+class EvaluationLog:
+    """ Bounded, persistent log of log(posterior) evaluations.
+
+    The log is a single append-only binary file of fixed-size records, each holding
+    one parameter point in u space followed by the log(posterior) value at that point.
+    Reading maps the file into memory without copying it. :meth:`eos.Analysis.optimize`
+    appends its evaluations to such a log and consults the best logged points to warm
+    start subsequent mode-finding runs of the same analysis.
+
+    When the log exceeds its capacity, it is compacted down to the better-valued half
+    of its records, so that the file stays bounded across arbitrarily many runs.
+
+    :param path: Path to the log file, which is created if it does not exist.
+    :type path: str
+    :param dimension: Number of varied parameters, i.e. the dimension of the u-space points.
+    :type dimension: int
+    :param capacity: Maximum number of records retained in the log.
+    :type capacity: int, optional
+    """
+
+    MAGIC = b'EOS-EVALUATION-LOG-1\n'
+
+    def __init__(self, path, dimension, capacity=65536):
+        self.type = 'EvaluationLog'
+        self.path = path
+        self.dimension = int(dimension)
+        self.capacity = int(capacity)
+        self._record_size = (self.dimension + 1) * 8
+
+        if self.dimension < 1:
+            raise RuntimeError(f'Dimension {dimension} must be at least 1')
+        if self.capacity < 2:
+            raise RuntimeError(f'Capacity {capacity} must be at least 2')
+
+        if os.path.exists(path):
+            if not os.path.isfile(path):
+                raise RuntimeError(f'Path {path} exists but is not a file')
+
+            with open(path, 'rb') as f:
+                magic = f.read(len(self.MAGIC))
+                if magic != self.MAGIC:
+                    raise RuntimeError(f'Path {path} not pointing to an EvaluationLog file')
+                dimension_on_disk = int(_np.frombuffer(f.read(4), dtype='<u4')[0])
+
+            if dimension_on_disk != self.dimension:
+                raise RuntimeError(f'EvaluationLog file {path} records points of dimension {dimension_on_disk}, expected {self.dimension}')
+        else:
+            with open(path, 'wb') as f:
+                f.write(self.MAGIC)
+                f.write(_np.array(self.dimension, dtype='<u4').tobytes())
+
+        self._header_size = len(self.MAGIC) + 4
+
+
+    def __len__(self):
+        return (os.path.getsize(self.path) - self._header_size) // self._record_size
+
+
+    def entries(self):
+        """ Return the logged records as a read-only, memory-mapped 2D array.
+
+        Each row holds the u-space point in its first ``dimension`` columns and the
+        log(posterior) value in the last column.
+        """
+        n = len(self)
+        if 0 == n:
+            return _np.empty((0, self.dimension + 1))
+
+        return _np.memmap(self.path, dtype='<f8', mode='r', offset=self._header_size,
+                          shape=(n, self.dimension + 1))
+
+
+    def best(self, n):
+        """ Return (up to) the n best-valued records, sorted by descending log(posterior) value.
+
+        Records with non-finite values are skipped.
+
+        :param n: Maximum number of records to return.
+        :type n: int
+        """
+        entries = self.entries()
+        entries = entries[_np.isfinite(entries[:, -1])]
+        order = _np.argsort(entries[:, -1])[::-1]
+
+        return _np.array(entries[order[:n]])
+
+
+    def append(self, u, value):
+        """ Append one evaluation record to the log.
+
+        :param u: Parameter point in u space as a 1D array of shape (dimension, ).
+        :type u: iterable
+        :param value: The log(posterior) value at the point.
+        :type value: float
+        """
+        record = _np.empty(self.dimension + 1)
+        record[:-1] = u
+        record[-1] = value
+
+        if len(self) >= self.capacity:
+            self._compact()
+
+        with open(self.path, 'ab') as f:
+            f.write(record.astype('<f8').tobytes())
+
+
+    def _compact(self):
+        """ Shrink the log to the better-valued half of its records."""
+        survivors = self.best(self.capacity // 2)
+
+        with open(self.path, 'wb') as f:
+            f.write(self.MAGIC)
+            f.write(_np.array(self.dimension, dtype='<u4').tobytes())
+            f.write(survivors.astype('<f8').tobytes())
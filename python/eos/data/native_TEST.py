@@ -36,5 +36,42 @@ class PMCSamplerTests(unittest.TestCase):
 
         file = eos.data.ImportanceSamples(os.path.join(os.environ['SOURCE_DIR'], "eos/data/native_TEST.d/samples"))
 
+class EvaluationLogTests(unittest.TestCase):
+
+    def test_round_trip(self):
+        "Test appending to, reading back, and compacting an evaluation log."
+
+        import tempfile
+        with tempfile.TemporaryDirectory() as dir:
+            path = os.path.join(dir, 'evaluations.bin')
+
+            log = eos.data.EvaluationLog(path, 2, capacity=8)
+            for i in range(5):
+                log.append([0.1 * i, 0.2 * i], float(-i))
+
+            self.assertEqual(len(log), 5)
+
+            entries = log.entries()
+            self.assertEqual(entries.shape, (5, 3))
+            self.assertAlmostEqual(entries[3, 0], 0.3)
+            self.assertAlmostEqual(entries[3, 2], -3.0)
+
+            # the best records are sorted by descending value
+            best = log.best(2)
+            self.assertAlmostEqual(best[0, 2],  0.0)
+            self.assertAlmostEqual(best[1, 2], -1.0)
+
+            # reopening persists the records, but a dimension mismatch is rejected
+            log = eos.data.EvaluationLog(path, 2, capacity=8)
+            self.assertEqual(len(log), 5)
+            with self.assertRaises(RuntimeError):
+                eos.data.EvaluationLog(path, 3)
+
+            # exceeding the capacity compacts the log to its better-valued half
+            for i in range(5, 9):
+                log.append([0.1 * i, 0.2 * i], float(-i))
+            self.assertEqual(len(log), 5)
+            self.assertAlmostEqual(log.best(1)[0, 2], 0.0)
+
 if __name__ == '__main__':
     unittest.main(verbosity=5)
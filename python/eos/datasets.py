@@ -26,6 +26,15 @@ from scipy.special import erf
 from scipy.stats import chi2
 
 
+def _pyarrow():
+    try:
+        import pyarrow
+    except ImportError:
+        raise RuntimeError("Arrow and Parquet support needs to import the 'pyarrow' module. Please install it.")
+
+    return pyarrow
+
+
 class DataSets:
     """
     Utility class to download public EOS data sets.
@@ -104,35 +113,40 @@ class DataSets:
             import requests
         except ImportError:
             raise RuntimeError("eos.DataSets.download() needs to import the 'requests' module. Please install it.")
-        import io, zipfile # part of the Python standard library
+        import zipfile # part of the Python standard library
 
         idnoversion = id if 'v' not in id else id[:id.rfind('v')]
         if self._data_sets[id].doi is not None:
-            doi             = self._data_sets[id].doi
-            url             = self.DOWNLOAD_URL_DOI.format(doi=doi)
-            expect_redirect = True
-        else:
-            url             = self.DOWNLOAD_URL_GITHUB.format(id=id)
-            expect_redirect = False
+            doi = self._data_sets[id].doi
+            url = self.DOWNLOAD_URL_DOI.format(doi=doi)
 
-        eos.inprogress(f"Downloading EOS data set '{id}' from '{url}' ...")
-        r = requests.get(url)
-        if not r.ok:
-            raise RuntimeError(f"Could not download EOS data set {id} from {url}; status code: {r.status_code}")
-
-        if expect_redirect:
+            # resolve the DOI to the Zenodo record; only the landing page is fetched here
+            r = requests.get(url)
+            if not r.ok:
+                raise RuntimeError(f"Could not download EOS data set {id} from {url}; status code: {r.status_code}")
             if not r.history:
                 raise RuntimeError(f"Could not download EOS data set {id} from {url}; expected redirect to Zenodo.org did not happen")
 
             url = self.DOWNLOAD_URL_ZENODO.format(url=r.url, id=id)
-            r = requests.get(url)
+        else:
+            url = self.DOWNLOAD_URL_GITHUB.format(id=id)
+
+        # stream the archive to disk in chunks, so that multi-GB data sets
+        # do not need to fit into memory
+        archive = os.path.join(self.storage_directory, id.replace('/', '-') + '.zip.part')
+        eos.inprogress(f"Downloading EOS data set '{id}' from '{url}' ...")
+        with requests.get(url, stream=True) as r:
             if not r.ok:
                 raise RuntimeError(f"Could not download EOS data set {id} from {url}; status code: {r.status_code}")
 
+            with open(archive, 'wb') as f:
+                for chunk in r.iter_content(chunk_size=16 * 1024 * 1024):
+                    f.write(chunk)
+
         directory = os.path.join(self.storage_directory, id)
         eos.inprogress(f"... and extracting to '{directory}' ...")
         os.makedirs(directory, exist_ok=True)
-        with zipfile.ZipFile(io.BytesIO(r.content)) as zf:
+        with zipfile.ZipFile(archive) as zf:
             for zi in zf.infolist():
                 oldname = zi.filename
                 newname = os.path.join(*(oldname.split('/'))[1:])
@@ -142,6 +156,7 @@ class DataSets:
                 zi.filename = newname
                 targetdir = os.path.join(self.storage_directory, id)
                 zf.extract(zi, path=targetdir)
+        os.remove(archive)
         eos.completed(f"... done")
 
 
@@ -246,3 +261,371 @@ class DataSets:
         result += '</table>'
 
         return result
+
+
+class _NpyStreamWriter:
+    """
+    Writes a 2D float64 ``.npy`` file one chunk of rows at a time.
+
+    The header is written with a placeholder shape and rewritten with the
+    final number of rows on close, so the file can be produced without ever
+    holding more than one chunk in memory.
+    """
+
+    # pads the total header to 128 bytes, including the 10-byte preamble
+    _HEADER_LEN = 118
+
+    def __init__(self, path, columns):
+        self._file = open(path, 'wb')
+        self._columns = columns
+        self._rows = 0
+        self._write_header()
+
+    def _write_header(self):
+        import struct
+        header = "{'descr': '<f8', 'fortran_order': False, 'shape': (%d, %d), }" % (self._rows, self._columns)
+        header = header.ljust(self._HEADER_LEN - 1) + '\n'
+        self._file.write(b'\x93NUMPY\x01\x00')
+        self._file.write(struct.pack('<H', self._HEADER_LEN))
+        self._file.write(header.encode('latin1'))
+
+    def append(self, chunk):
+        chunk = _np.ascontiguousarray(chunk, dtype=_np.float64)
+        if chunk.ndim != 2 or chunk.shape[1] != self._columns:
+            raise RuntimeError(f'Chunk of shape {chunk.shape} incompatible with {self._columns} columns')
+        self._file.write(chunk.tobytes())
+        self._rows += chunk.shape[0]
+
+    def close(self):
+        self._file.seek(0)
+        self._write_header()
+        self._file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+
+class DataSetImporter:
+    """
+    Streams an external sample file into the EOS sample-storage layout.
+
+    The source file is never materialized as a whole: ``.npy`` files are
+    memory-mapped and read one chunk of rows at a time, Arrow IPC files are
+    memory-mapped and decoded one record batch at a time, Parquet files are
+    read one row group at a time, CSV files are parsed line by line, and the
+    column and row selection is applied per chunk, before materialization.
+    Conversion therefore runs in bounded memory and starts producing output
+    with the first chunk.
+    """
+
+    def __init__(self, source, columns=None, where=None, chunk_size=65536, delimiter=','):
+        """
+        :param source: Path to the source file. Supported are ``.npy`` files, Arrow IPC files (``.arrow``), Parquet files (``.parquet``), and CSV files (optionally gzip-compressed), with or without a header line.
+        :type source: str
+        :param columns: Columns to import, each either an index or a name from the CSV header line; all columns are imported by default.
+        :type columns: list of int or str, optional
+        :param where: Row predicate; called with each (column-selected) chunk of shape (N, C), must return a boolean mask of the rows to keep.
+        :type where: callable, optional
+        :param chunk_size: Number of source rows per chunk.
+        :type chunk_size: int, optional
+        :param delimiter: Column delimiter of CSV sources.
+        :type delimiter: str, optional
+        """
+        if not os.path.exists(source) or not os.path.isfile(source):
+            raise RuntimeError(f'Source file {source} does not exist or is not a file')
+
+        self.source = source
+        self.columns = columns
+        self.where = where
+        self.chunk_size = int(chunk_size)
+        self.delimiter = delimiter
+
+        if self.chunk_size < 1:
+            raise ValueError('chunk_size must be positive')
+
+    def _column_indices(self, ncolumns, names):
+        if self.columns is None:
+            return list(range(ncolumns))
+
+        result = []
+        for column in self.columns:
+            if isinstance(column, str):
+                if names is None or column not in names:
+                    raise ValueError(f'Column {column} not found in source file {self.source}')
+                result.append(names.index(column))
+            else:
+                if not 0 <= int(column) < ncolumns:
+                    raise ValueError(f'Column index {column} out of range for source file {self.source}')
+                result.append(int(column))
+
+        return result
+
+    def _select(self, chunk):
+        if self.where is None:
+            return chunk
+
+        return chunk[_np.asarray(self.where(chunk), dtype=bool)]
+
+    def _chunks_npy(self):
+        # memory-mapped access: only the requested rows and columns are paged in
+        data = _np.load(self.source, mmap_mode='r')
+        if data.ndim != 2:
+            raise RuntimeError(f'Source file {self.source} does not contain a 2D array')
+
+        column_indices = self._column_indices(data.shape[1], None)
+        for begin in range(0, data.shape[0], self.chunk_size):
+            chunk = _np.asarray(data[begin:begin + self.chunk_size, column_indices], dtype=_np.float64)
+            yield self._select(chunk)
+
+    def _chunks_csv(self):
+        import gzip, io
+        opener = gzip.open if self.source.endswith('.gz') else open
+
+        with opener(self.source, 'rt') as f:
+            first = f.readline()
+            names = None
+            pending = []
+            try:
+                [float(token) for token in first.strip().split(self.delimiter)]
+                pending.append(first)
+            except ValueError:
+                names = [token.strip() for token in first.strip().split(self.delimiter)]
+
+            column_indices = None
+            while True:
+                for line in f:
+                    if line.strip():
+                        pending.append(line)
+                    if len(pending) >= self.chunk_size:
+                        break
+
+                if not pending:
+                    break
+
+                chunk = _np.loadtxt(io.StringIO(''.join(pending)), delimiter=self.delimiter, ndmin=2, dtype=_np.float64)
+                pending = []
+
+                if column_indices is None:
+                    column_indices = self._column_indices(chunk.shape[1], names)
+
+                yield self._select(chunk[:, column_indices])
+
+    def _chunks_arrow(self):
+        pa = _pyarrow()
+
+        # memory-mapped access: the record batches reference the mapped region,
+        # and numeric columns are handed to numpy without copying
+        with pa.memory_map(self.source, 'r') as mapped:
+            reader = pa.ipc.open_file(mapped)
+            names = reader.schema.names
+            column_indices = self._column_indices(len(names), names)
+
+            for i in range(reader.num_record_batches):
+                batch = reader.get_batch(i)
+                chunk = _np.column_stack([batch.column(j).to_numpy(zero_copy_only=False) for j in column_indices])
+                yield self._select(_np.asarray(chunk, dtype=_np.float64))
+
+    def _chunks_parquet(self):
+        _pyarrow()
+        import pyarrow.parquet as _pq
+
+        source = _pq.ParquetFile(self.source, memory_map=True)
+        names = source.schema_arrow.names
+        column_indices = self._column_indices(len(names), names)
+
+        for batch in source.iter_batches(batch_size=self.chunk_size, columns=[names[j] for j in column_indices]):
+            chunk = _np.column_stack([batch.column(j).to_numpy(zero_copy_only=False) for j in range(batch.num_columns)])
+            yield self._select(_np.asarray(chunk, dtype=_np.float64))
+
+    def chunks(self):
+        """
+        Returns a generator that yields the selected columns and rows of the source, one chunk at a time.
+        """
+        if self.source.endswith('.npy'):
+            yield from self._chunks_npy()
+        elif self.source.endswith('.arrow'):
+            yield from self._chunks_arrow()
+        elif self.source.endswith('.parquet'):
+            yield from self._chunks_parquet()
+        else:
+            yield from self._chunks_csv()
+
+    def to_importance_samples(self, path, parameters, weight_column=None):
+        """
+        Converts the source into an :class:`eos.data.ImportanceSamples` object on disk.
+
+        The output files are written incrementally, one chunk at a time.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param parameters: Descriptions of the imported parameter columns, in their order within the selected columns; each either an :class:`eos.Parameter` or a dict with keys ``name``, ``min``, and ``max``.
+        :type parameters: list
+        :param weight_column: Position of the importance weights within the selected columns; unit weights are written if not provided.
+        :type weight_column: int, optional
+        :returns: The path to the created ImportanceSamples object.
+        :rtype: str
+        """
+        def _describe(p):
+            if isinstance(p, dict):
+                return { 'name': p['name'], 'min': p['min'], 'max': p['max'] }
+            return { 'name': p.name(), 'min': p.min(), 'max': p.max() }
+
+        description = {}
+        description['version'] = eos.__version__
+        description['type'] = 'ImportanceSamples'
+        description['parameters'] = [_describe(p) for p in parameters]
+
+        eos.inprogress(f"Importing samples from '{self.source}' to '{path}' ...")
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
+            _yaml.dump(description, description_file, default_flow_style=False)
+
+        nparameters = len(parameters)
+        with _NpyStreamWriter(os.path.join(path, 'samples.npy'), nparameters) as samples_writer, \
+                _NpyStreamWriter(os.path.join(path, 'weights.npy'), 1) as weights_writer:
+            for chunk in self.chunks():
+                if weight_column is None:
+                    samples = chunk
+                    weights = _np.ones((chunk.shape[0], 1))
+                else:
+                    samples = _np.delete(chunk, weight_column, axis=1)
+                    weights = chunk[:, weight_column:weight_column + 1]
+
+                if samples.shape[1] != nparameters:
+                    raise RuntimeError(f'Shape of samples {samples.shape} incompatible with number of parameters {nparameters}')
+
+                samples_writer.append(samples)
+                weights_writer.append(weights)
+        eos.completed(f"... done")
+
+        return path
+
+
+class DataSetExporter:
+    """
+    Exports an EOS sample-storage object to Apache Arrow IPC or Parquet files.
+
+    The source object's sample files are memory-mapped and converted one chunk
+    of rows at a time; each chunk's column buffers are handed to ``pyarrow``
+    without further copies. Downstream analytics (Spark, duckdb, pandas) can
+    then memory-map the Arrow IPC file or scan the Parquet file directly,
+    without converting through Python serialization.
+    """
+
+    def __init__(self, path, chunk_size=65536):
+        """
+        :param path: Path to the storage location of the source object. Supported are :class:`eos.data.ImportanceSamples`, :class:`eos.data.Prediction`, and :class:`eos.data.MarkovChain` objects.
+        :type path: str
+        :param chunk_size: Number of rows per record batch (Arrow IPC) or per row group (Parquet).
+        :type chunk_size: int, optional
+        """
+        if not os.path.exists(path) or not os.path.isdir(path):
+            raise RuntimeError(f'Path {path} does not exist or is not a directory')
+
+        f = os.path.join(path, 'description.yaml')
+        if not os.path.exists(f) or not os.path.isfile(f):
+            raise RuntimeError(f'Description file {f} does not exist or is not a file')
+
+        with open(f) as df:
+            description = _yaml.safe_load(df)
+
+        self.path = path
+        self.type = description['type']
+        self.chunk_size = int(chunk_size)
+
+        if self.chunk_size < 1:
+            raise ValueError('chunk_size must be positive')
+
+        if self.type in ('ImportanceSamples', 'MarkovChain'):
+            names = [p['name'] for p in description['parameters']]
+        elif self.type == 'Prediction':
+            names = [o['name'] for o in description['observables']]
+        else:
+            raise RuntimeError(f'Unsupported data object of type {self.type} for export')
+
+        # memory-mapped access: rows are paged in as they are converted
+        samples = _np.load(os.path.join(path, 'samples.npy'), mmap_mode='r')
+        if samples.ndim != 2 or samples.shape[1] != len(names):
+            raise RuntimeError(f'Shape of samples {samples.shape} incompatible with {len(names)} columns')
+
+        self._rows = samples.shape[0]
+        self._columns = [(name, samples, column) for column, name in enumerate(names)]
+
+        f = os.path.join(path, 'weights.npy')
+        if os.path.exists(f) and os.path.isfile(f):
+            weights = _np.load(f, mmap_mode='r')
+            if weights.shape[0] != self._rows:
+                raise RuntimeError(f'Shape of weights {weights.shape} incompatible with shape of samples {samples.shape}')
+            self._columns.append(('weight', weights, 0))
+
+        f = os.path.join(path, 'posterior_values.npy')
+        if os.path.exists(f) and os.path.isfile(f):
+            posterior_values = _np.load(f, mmap_mode='r')
+            if posterior_values.shape[0] != self._rows:
+                raise RuntimeError(f'Shape of posterior values {posterior_values.shape} incompatible with shape of samples {samples.shape}')
+            self._columns.append(('posterior', posterior_values, 0))
+
+    def _schema(self, pa):
+        return pa.schema([pa.field(name, pa.float64()) for name, _, _ in self._columns])
+
+    def batches(self):
+        """
+        Returns a generator that yields the export as a sequence of ``pyarrow.RecordBatch`` objects.
+        """
+        pa = _pyarrow()
+        schema = self._schema(pa)
+
+        for begin in range(0, self._rows, self.chunk_size):
+            end = min(begin + self.chunk_size, self._rows)
+            arrays = []
+            for _, data, column in self._columns:
+                chunk = _np.ascontiguousarray(data[begin:end].reshape(end - begin, -1)[:, column], dtype=_np.float64)
+                # pyarrow wraps the contiguous buffer without copying it
+                arrays.append(pa.array(chunk))
+
+            yield pa.record_batch(arrays, schema=schema)
+
+    def to_arrow(self, target):
+        """
+        Exports the source object to an Arrow IPC file.
+
+        :param target: Path to the Arrow IPC file to be written.
+        :type target: str
+        :returns: The path to the written file.
+        :rtype: str
+        """
+        pa = _pyarrow()
+
+        eos.inprogress(f"Exporting '{self.path}' to Arrow IPC file '{target}' ...")
+        with pa.OSFile(target, 'wb') as sink:
+            with pa.ipc.new_file(sink, self._schema(pa)) as writer:
+                for batch in self.batches():
+                    writer.write_batch(batch)
+        eos.completed(f"... done")
+
+        return target
+
+    def to_parquet(self, target, compression='snappy'):
+        """
+        Exports the source object to a Parquet file.
+
+        :param target: Path to the Parquet file to be written.
+        :type target: str
+        :param compression: Compression codec, as understood by ``pyarrow.parquet.ParquetWriter``.
+        :type compression: str, optional
+        :returns: The path to the written file.
+        :rtype: str
+        """
+        pa = _pyarrow()
+        import pyarrow.parquet as _pq
+
+        eos.inprogress(f"Exporting '{self.path}' to Parquet file '{target}' ...")
+        with _pq.ParquetWriter(target, self._schema(pa), compression=compression) as writer:
+            for batch in self.batches():
+                writer.write_table(pa.Table.from_batches([batch]))
+        eos.completed(f"... done")
+
+        return target
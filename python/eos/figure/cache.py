@@ -0,0 +1,60 @@
+# Copyright (c) 2026 Danny van Dyk
+#
+# This file is part of the EOS project. EOS is free software;
+# you can redistribute it and/or modify it under the terms of the GNU General
+# Public License version 2, as published by the Free Software Foundation.
+#
+# EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+# Place, Suite 330, Boston, MA  02111-1307  USA
+
+"""Process-resident cache of warm :class:`PredictionGrid <eos.PredictionGrid>` objects.
+
+Constructing a PredictionGrid is the expensive part of drawing a figure item:
+it instantiates every observable at every grid point once per worker thread.
+Interactive sessions redraw the same items over and over with new parameter
+values, so the grids are kept resident in the process and looked up by the
+item's full construction signature; a redraw then only pays for the batched
+evaluation itself, against already-warm observable caches. The extension
+module shares the interpreter's address space, so no serialization or process
+boundary is involved in serving a cached grid.
+"""
+
+from collections import OrderedDict
+
+# bounds the number of resident grids; each entry holds one clone of the
+# parameters and observables per worker thread
+_capacity = 32
+
+_grids = OrderedDict()
+
+
+def resident_grid(signature, factory):
+    """Return the warm grid for the given signature, constructing it on a miss.
+
+    :param signature: Hashable description of the grid: observable names, kinematic grid, options, and fixed parameters.
+    :type signature: tuple
+    :param factory: Zero-argument callable constructing the PredictionGrid on a cache miss.
+    :returns: The resident :class:`PredictionGrid <eos.PredictionGrid>`.
+    """
+    if signature in _grids:
+        _grids.move_to_end(signature)
+        return _grids[signature]
+
+    grid = factory()
+
+    _grids[signature] = grid
+    if len(_grids) > _capacity:
+        _grids.popitem(last=False)
+
+    return grid
+
+
+def clear():
+    "Drop all resident grids, e.g. ahead of a change of the thread pool size."
+    _grids.clear()
@@ -45,7 +45,19 @@ class Figure:
             self.plots.append(PlotFactory.make(ax, contents, **plot_description))
 
 
+    def prepare(self):
+        """Prepare the data of all items of all plots for drawing.
+
+        The items' data are computed in batched calls to the EOS library, one per item;
+        parameter samples read from a data file are loaded once and shared across all
+        items of the figure.
+        """
+        for plot in self.plots:
+            plot.prepare()
+
+
     def draw(self):
+        self.prepare()
         for plot in self.plots:
             plot.draw()
 
@@ -17,18 +17,89 @@
 import eos
 
 import numpy as np
+import os
+
+from . import cache
+
+# Parameter samples are typically shared by several items of one figure (and by
+# several figures rendered from the same posterior); cache them per storage
+# location so that each data file is read from disk only once.
+_sample_cache = {}
+
+def _load_samples(datafile):
+    """Load (and cache) parameter samples from a data file.
+
+    :param datafile: Path to the storage location of the samples (either importance samples or a Markov chain).
+    :type datafile: str
+    :returns: The samples of shape (n, number of varied parameters), their weights (or None), and the names of the varied parameters.
+    """
+    path = os.path.abspath(datafile)
+    if path in _sample_cache:
+        return _sample_cache[path]
+
+    df = None
+    for dataclass in [eos.data.ImportanceSamples, eos.data.MarkovChain]:
+        try:
+            df = dataclass(path)
+            break
+        except RuntimeError:
+            continue
+
+    if df is None:
+        raise ValueError(f"Path '{datafile}' points to neither importance samples nor a Markov chain")
+
+    names = [p['name'] for p in df.varied_parameters]
+    _sample_cache[path] = (df.samples, df.weights, names)
+
+    return _sample_cache[path]
+
+
+def _weighted_quantiles(values, quantiles, weights=None):
+    """Compute the quantiles of a weighted sample.
+
+    :param values: Sample from which the quantiles are computed.
+    :type values: array-like of float
+    :param quantiles: Quantiles to compute, with values in [0, 1].
+    :type quantiles: array-like of float
+    :param weights: Weights of the samples, of the same length as values. Defaults to uniform weights.
+    :type weights: array-like of float, optional
+    :returns: The computed quantiles.
+    :rtype: numpy.array
+    """
+    if weights is None:
+        weights = np.ones(len(values))
+
+    sorter = np.argsort(values)
+    values = np.array(values)[sorter]
+    weights = np.array(weights)[sorter]
+
+    # each sample's weight is assigned half to the left and half to the right of the point
+    weighted_quantiles = np.cumsum(weights) - 0.5 * weights
+    weighted_quantiles /= np.sum(weights)
+
+    return np.interp(quantiles, weighted_quantiles, values)
+
 
 class Item:
     "Can display itself using a Matplotlib ax object"
 
     def __init__(self):
         "Setup of the item attributes and validation of all supplied arguments"
-        pass
+        self._prepared = False
 
     def prepare(self):
         "Setup of the item such as computing data points of an observable"
         pass
 
+    def invalidate(self):
+        """Discard the prepared data so that the next draw re-evaluates the item.
+
+        Interactive sessions call this after changing parameter values; the
+        re-evaluation is served by the process-resident grid cache and does not
+        re-instantiate the observables.
+        """
+        self._prepared = False
+
     def draw(self, ax):
         """
         Draw the item using a set of axis
@@ -86,14 +157,12 @@ class Observable(Item):
         self.label = label
 
 
-        # Create kinematics
-        eos_kinematics = eos.Kinematics()
+        # Validate the fixed kinematics
         if fixed_kinematics:
-            for k, v in fixed_kinematics.items():
+            for k in fixed_kinematics.keys():
                 if k not in valid_kin_vars:
                     raise ValueError("Kinematic variable '" + k + "' does not " +
                     "match any of the declared kinematic variables '" + observable + "': " + valid_kin_vars.__repr__())
-                eos_kinematics.declare(k, v)
 
         # Create parameters
         eos_parameters = eos.Parameters.Defaults()
@@ -121,18 +190,19 @@ class Observable(Item):
         #             "also specified as a fix kinematic with value " + str(val))
 
 
-        # Declare variable that is either parameter or kinematic
-        self.var = None
+        # Classify the variable as either kinematic variable or parameter
 
         # Does the variable correspond to one of the kinematic variables?
         if variable in valid_kin_vars:
-            self.var = eos_kinematics.declare(variable, np.nan)
+            self.variable_is_kinematic = True
         else:
             # Is the variable name a QualifiedName?
             try:
                 qn = eos.QualifiedName(variable)
-                # Continues only if no failure occures
-                self.var = eos_parameters.declare(qn, np.nan)
+                # Continues only if no failure occures; declare the parameter so
+                # that the name resolves when it is varied across the grid
+                eos_parameters.declare(qn, np.nan)
+                self.variable_is_kinematic = False
             except RuntimeError:
                 raise ValueError("Value of 'variable' for observable '" + observable +
                     "' is neither a valid kinematic variable nor parameter: '" + variable + "'")
@@ -142,20 +212,57 @@ class Observable(Item):
         eos_options = eos.Options()
         if options:
             for key, value in options.items():
-                options.declare(key, value)
+                eos_options.declare(key, value)
 
-        self.eos_observable = eos.Observable.make(observable, eos_parameters, eos_kinematics, eos_options)
+        self.observable = observable
+        self.variable = variable
+        self.eos_parameters = eos_parameters
+        self.eos_options = eos_options
+        self.fixed_kinematics = dict(fixed_kinematics) if fixed_kinematics else {}
+
+        # identifies the grid in the process-resident cache; everything that
+        # enters the construction of the observables must be part of it
+        self._options_key    = tuple(sorted(options.items())) if options else ()
+        self._parameters_key = tuple(sorted(fixed_parameters.items())) if fixed_parameters else ()
 
         self.x_values = x_values
         self.kwargs = kwargs
 
 
     def prepare(self):
-        "Evaluate the observable at the sample points"
-        self.y_values = np.empty((len(self.x_values),))
-        for i, x in enumerate(self.x_values):
-            self.var.set(x)
-            self.y_values[i] = self.eos_observable.evaluate()
+        "Evaluate the observable at the sample points in a single batched call"
+        if self._prepared:
+            return
+
+        fixed_names  = list(self.fixed_kinematics.keys())
+        fixed_values = [self.fixed_kinematics[name] for name in fixed_names]
+
+        if self.variable_is_kinematic:
+            # the sample points span the kinematic grid; evaluate once at the nominal parameter point
+            kinematic_names = [self.variable] + fixed_names
+            grid_points = [value for x in self.x_values for value in [x] + fixed_values]
+            varied_names = []
+            samples = np.empty((0,), dtype=np.float64)
+            n_samples = 1
+        else:
+            # the sample points are parameter samples; the grid is the single fixed kinematic point
+            kinematic_names = fixed_names
+            grid_points = fixed_values
+            varied_names = [self.variable]
+            samples = np.ascontiguousarray(self.x_values, dtype=np.float64)
+            n_samples = len(self.x_values)
+
+        signature = ('observable', self.observable, self.variable,
+            tuple(kinematic_names), tuple(grid_points),
+            self._parameters_key, self._options_key)
+        grid = cache.resident_grid(signature, lambda: eos.PredictionGrid(
+            [self.observable], self.eos_parameters, self.eos_options,
+            kinematic_names, grid_points))
+        results = np.empty((n_samples, grid.number_of_points()), dtype=np.float64)
+        grid.evaluate(varied_names, samples, results)
+
+        self.y_values = results.reshape((-1,))
+        self._prepared = True
 
 
     def draw(self, ax):
@@ -164,9 +271,148 @@ class Observable(Item):
         ax.plot(self.x_values, self.y_values, label=self.label, **self.kwargs)
 
 
+class UncertaintyBand(Item):
+    r"""Represents the uncertainty band of an observable as a function of a kinematic variable.
+
+    The band is computed from the parameter samples of a previous sampling run. The samples
+    are loaded once per data file and shared across all items of a figure; the observable is
+    evaluated for all samples and all sample points in a single batched call that runs on the
+    C++ thread pool.
+
+    :param observable: EOS qualified name of an observable
+    :type observable: str
+    :param variable: Name of the kinematic variable spanning the band
+    :type variable: str
+    :param x_values: Values to be used as sampling points
+    :type x_values: list of float numbers
+    :param datafile: Path to the storage location of the parameter samples (either importance samples or a Markov chain)
+    :type datafile: str
+    :param fixed_kinematics: Names and values of fixed kinematic variables
+    :type fixed_kinematics: dict
+    :param fixed_parameters: Names and values of fixed parameters
+    :type fixed_parameters: dict
+    :param options: Names and values of options passed to the EOS observable
+    :type options: dict
+    :param band: The constituents of the band to draw; any of 'area', 'outer', 'median'
+    :type band: list of str
+    :param label: Label used in the legend
+    :type label: str
+    :param \**kwargs: Additional keyword arguments to pass to the ``matplotlib.axes.Axes`` drawing methods
+    """
+
+    def __init__(self,
+            observable,
+            variable:str,
+            x_values:list,
+            datafile:str,
+            fixed_kinematics:dict=None,
+            fixed_parameters:dict=None,
+            options:dict=None,
+            band:list=None,
+            label:str=None,
+            **kwargs
+        ):
+        super().__init__()
+
+        obs_entry = eos.Observables()[observable]
+        valid_kin_vars = [kv for kv in obs_entry.kinematic_variables()]
+        eos.info(f'Plotting uncertainty band of EOS observable "{observable}"')
+
+        if variable not in valid_kin_vars:
+            raise ValueError("Value of 'variable' for observable '" + observable +
+                "' does not match any of the declared kinematic variables: '" + variable + "'")
+
+        # Validate the fixed kinematics
+        if fixed_kinematics:
+            for k in fixed_kinematics.keys():
+                if k not in valid_kin_vars:
+                    raise ValueError("Kinematic variable '" + k + "' does not " +
+                    "match any of the declared kinematic variables '" + observable + "': " + valid_kin_vars.__repr__())
+
+        # Create parameters
+        eos_parameters = eos.Parameters.Defaults()
+        if fixed_parameters:
+            for key, value in fixed_parameters.items():
+                eos_parameters.set(key, value)
+
+        # Create options
+        eos_options = eos.Options()
+        if options:
+            for key, value in options.items():
+                eos_options.declare(key, value)
+
+        self.observable = observable
+        self.variable = variable
+        self.eos_parameters = eos_parameters
+        self.eos_options = eos_options
+        self.fixed_kinematics = dict(fixed_kinematics) if fixed_kinematics else {}
+        self.datafile = datafile
+        self.band = band if band else ['area', 'outer', 'median']
+        self.label = label
+
+        # identifies the grid in the process-resident cache; everything that
+        # enters the construction of the observables must be part of it
+        self._options_key    = tuple(sorted(options.items())) if options else ()
+        self._parameters_key = tuple(sorted(fixed_parameters.items())) if fixed_parameters else ()
+
+        self.x_values = x_values
+        self.kwargs = kwargs
+
+
+    def prepare(self):
+        "Evaluate the observable for all parameter samples in a single batched call"
+        if self._prepared:
+            return
+
+        samples, weights, varied_names = _load_samples(self.datafile)
+
+        fixed_names  = list(self.fixed_kinematics.keys())
+        fixed_values = [self.fixed_kinematics[name] for name in fixed_names]
+
+        kinematic_names = [self.variable] + fixed_names
+        grid_points = [value for x in self.x_values for value in [x] + fixed_values]
+
+        signature = ('uncertainty-band', self.observable, self.variable,
+            tuple(kinematic_names), tuple(grid_points),
+            self._parameters_key, self._options_key)
+        grid = cache.resident_grid(signature, lambda: eos.PredictionGrid(
+            [self.observable], self.eos_parameters, self.eos_options,
+            kinematic_names, grid_points))
+        results = np.empty((len(samples), grid.number_of_points()), dtype=np.float64)
+        grid.evaluate(varied_names, np.ascontiguousarray(samples, dtype=np.float64), results)
+
+        self.y_lower   = np.empty((len(self.x_values),))
+        self.y_median  = np.empty((len(self.x_values),))
+        self.y_higher  = np.empty((len(self.x_values),))
+        for i in range(len(self.x_values)):
+            lower, median, higher = _weighted_quantiles(results[:, i], [0.15865, 0.5, 0.84135], weights)
+            self.y_lower[i]  = lower
+            self.y_median[i] = median
+            self.y_higher[i] = higher
+
+        self._prepared = True
+
+
+    def draw(self, ax):
+        "Draw the uncertainty band of the observable"
+        super().draw(ax)
+
+        label = self.label
+        if 'area' in self.band:
+            ax.fill_between(self.x_values, self.y_lower, self.y_higher, label=label, lw=0, **self.kwargs)
+            label = None
+        if 'outer' in self.band:
+            ax.plot(self.x_values, self.y_lower,  label=label, **self.kwargs)
+            ax.plot(self.x_values, self.y_higher, **self.kwargs)
+            label = None
+        if 'median' in self.band:
+            ax.plot(self.x_values, self.y_median, label=label, **self.kwargs)
+
+
 class ItemFactory:
     registry = {
         'observable': Observable,
+        'uncertainty-band': UncertaintyBand,
     }
 
 
@@ -52,6 +52,12 @@ class Plot:
             self.content_items.append(ItemFactory.make(ax, item['type'], **item['description']))
 
 
+    def prepare(self):
+        "Prepare the data of all items for drawing"
+        for item in self.content_items:
+            item.prepare()
+
+
     def draw(self):
         "Draw the plot including all items"
         # A child of Plot class can add items to ax before this method should be called.
@@ -16,7 +16,6 @@
 # Place, Suite 330, Boston, MA  02111-1307  USA
 
 import numpy as _np
-import scipy
 
 def __format_Parameter(p):
     name = ''
@@ -162,13 +161,13 @@ def __format_GoodnessOfFit(gof):
         local_chi2   = entry[1].chi2
         local_dof    = entry[1].dof
         local_chi    = f'{entry[1].signed_chi:+6.4f}' if not _np.isnan(entry[1].signed_chi) else '&mdash;'
-        local_pvalue = 1.0 - scipy.stats.chi2(local_dof).cdf(local_chi2)
+        local_pvalue = entry[1].local_p_value
         style        = 'color: red;' if local_pvalue < 0.05 else 'color: orange' if local_pvalue < 0.32 else ''
         result += f'<tr style="{style}"><td><tt>{entry[0]}</tt></td><td>{local_chi2:6.4f}</td><td>{local_chi}</td><td>{local_dof}</td><td>{local_pvalue * 100:6.4f}%</td></tr>\n'
     result += '</table><br/>\n'
     chi2 = gof.total_chi_square()
     dof  = gof.total_degrees_of_freedom()
-    pvalue = 1.0 - scipy.stats.chi2(dof).cdf(chi2)
+    pvalue = gof.total_p_value()
     result += '<table>\n'
     result += f'<tr><th>total &chi;<sup>2</sup></th><td>{chi2:6.4f}</td></tr>\n'
     result += f'<tr><th>total degrees of freedom</th><td>{dof}</td></tr>\n'
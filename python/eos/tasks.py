@@ -25,7 +25,6 @@ import logging
 import numpy as _np
 import os
 import pypmc
-import scipy
 import sys
 import copy as _copy
 import warnings
@@ -230,12 +229,12 @@ def find_mode(analysis_file:str, posterior:str, base_directory:str='./', optimiz
         eos.info(f'  - {p.name()} -> {v}')
     eos.info(f'total chi^2 = {min_chi2:.2f}')
     eos.info(f'total dof   = {gof.total_degrees_of_freedom()}')
-    pvalue = (1.0 - scipy.stats.chi2(gof.total_degrees_of_freedom()).cdf(gof.total_chi_square()))
+    pvalue = gof.total_p_value()
     eos.info(f'p value     = {100 * pvalue:.2f}%')
     eos.info('individual test statistics:')
     local_pvalues = {}
     for n, e in gof:
-        local_pvalue = (1.0 - scipy.stats.chi2(e.dof).cdf(e.chi2))
+        local_pvalue = e.local_p_value
         local_pvalues[f'{n}'] = float(local_pvalue)
         eos.info(f'  - {n}: chi^2 / dof = {e.chi2:.2f} / {e.dof}, local_pvalue = {100 * local_pvalue:.2f}%')
 
@@ -257,7 +256,7 @@ def find_mode(analysis_file:str, posterior:str, base_directory:str='./', optimiz
 
 
 @task('sample-mcmc', '{posterior}/mcmc-{chain:04}')
-def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str='./', pre_N:int=150, preruns:int=3, N:int=1000, stride:int=5, cov_scale:float=0.1, start_point:list=None):
+def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str='./', pre_N:int=150, preruns:int=3, N:int=1000, stride:int=5, cov_scale:float=0.1, start_point:list=None, reuse_proposal:bool=False):
     """
     Samples from a named posterior PDF using Markov Chain Monte Carlo (MCMC) methods.
 
@@ -283,12 +282,20 @@ def sample_mcmc(analysis_file:str, posterior:str, chain:int, base_directory:str=
     :type cov_scale: float, optional
     :param start_point: Optional starting point for the chain
     :type start_point: list-like, optional
+    :param reuse_proposal: Whether to persist the adapted proposal in EOS_BASE_DIRECTORY/POSTERIOR/proposal-state
+        and to reuse it across chains and re-runs of the same posterior, skipping their preruns. Defaults to False.
+    :type reuse_proposal: bool, optional
     """
 
     analysis = analysis_file.analysis(posterior)
     rng = _np.random.mtrand.RandomState(int(chain) + 1701)
+    proposal_file = None
+    if reuse_proposal:
+        os.makedirs(os.path.join(base_directory, posterior), exist_ok=True)
+        proposal_file = os.path.join(base_directory, posterior, 'proposal-state')
     try:
-        samples, usamples, weights = analysis.sample(N=N, stride=stride, pre_N=pre_N, preruns=preruns, rng=rng, cov_scale=cov_scale, start_point=start_point, return_uspace=True)
+        samples, usamples, weights = analysis.sample(N=N, stride=stride, pre_N=pre_N, preruns=preruns, rng=rng, cov_scale=cov_scale, start_point=start_point, return_uspace=True,
+                                                     proposal_file=proposal_file)
         eos.data.MarkovChain.create(os.path.join(base_directory, posterior, f'mcmc-{chain:04}'), analysis.varied_parameters, samples, usamples, weights)
     except RuntimeError as e:
         eos.error(f'encountered run time error ({e}) in parameter point:')
@@ -476,11 +483,10 @@ def predict_observables(analysis_file:str, posterior:str, prediction:str, base_d
     :param end: The index beyond the last sample to use for the predictions. Defaults to None.
     :type begin: int
     '''
+    _apply_integration_calibration(base_directory, posterior)
     _analysis      = analysis_file.analysis(posterior)
     _parameters    = _analysis.parameters
-    cache          = eos.ObservableCache(_parameters)
     observables    = analysis_file.observables(posterior, prediction, _parameters)
-    observable_ids = [cache.add(o) for o in observables]
 
     data = eos.data.ImportanceSamples(os.path.join(base_directory, posterior, 'samples'))
 
@@ -490,32 +496,206 @@ def predict_observables(analysis_file:str, posterior:str, prediction:str, base_d
     if analysis_varied_params != samples_varied_params:
         raise ValueError(f"Parameters varied in the analysis file don't match those from the loaded sample")
 
-    try:
-        from tqdm.auto import tqdm
-        progressbar = tqdm
-    except ImportError:
-        progressbar = lambda x: x
-
-    parameters = [_parameters[p['name']] for p in data.varied_parameters]
-    observable_samples = []
-    nsamples = len(data.samples[begin:end])
+    predictor = eos.ObservablePredictor(_parameters, observables, [p['name'] for p in data.varied_parameters])
+
+    samples = _np.ascontiguousarray(data.samples[begin:end], dtype=_np.float64)
+    nsamples = len(samples)
+    observable_samples = _np.empty((nsamples, len(observables)), dtype=_np.float64)
     eos.inprogress(f'Predicting observables from set \'{prediction}\' for {nsamples} samples')
-    for i, sample in enumerate(progressbar(data.samples[begin:end])):
-        for p, v in zip(parameters, sample):
-            p.set(v)
-        try:
-            cache.update()
-            observable_samples.append([cache[id] for id in observable_ids])
-        except RuntimeError as e:
-            eos.error(f'skipping prediction for sample {i} due to runtime error ({e}): {sample}')
-            observable_samples.append([_np.nan for _ in observable_ids])
-    observable_samples = _np.array(observable_samples)
+    failures = predictor.predict(samples, observable_samples)
+    if failures > 0:
+        eos.error(f'predictions failed for {failures} of {nsamples} samples; the corresponding rows are set to NaN')
     eos.completed(f'... done')
 
     output_path = os.path.join(base_directory, posterior, f'pred-{prediction}')
     eos.data.Prediction.create(output_path, observables, observable_samples, data.weights[begin:end])
 
 
+# Predict the covariance of observables
+@task('predict-covariance', '{posterior}/cov-{prediction}')
+def predict_covariance(analysis_file:str, posterior:str, prediction:str, base_directory:str='./', begin:int=0, end:int=None):
+    '''
+    Predicts the weighted mean vector and covariance matrix of a set of observables
+    based on previously obtained importance samples.
+
+    The accumulation runs as a single streaming pass in C++: the per-sample
+    predictions are never stored, which makes this task suitable for sample sizes
+    and observable counts for which the full matrix of predictions would not fit
+    into memory.
+
+    The input files are expected in EOS_BASE_DIRECTORY/POSTERIOR/samples.
+    The output files will be stored in EOS_BASE_DIRECTORY/POSTERIOR/cov-PREDICTION.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or `eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param prediction: The name of the set of observables whose covariance shall be predicted.
+    :type prediction: str
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    :param begin: The index of the first sample to use for the predictions. Defaults to 0.
+    :type begin: int
+    :param end: The index beyond the last sample to use for the predictions. Defaults to None.
+    :type begin: int
+    '''
+    _apply_integration_calibration(base_directory, posterior)
+    _analysis      = analysis_file.analysis(posterior)
+    _parameters    = _analysis.parameters
+    observables    = analysis_file.observables(posterior, prediction, _parameters)
+
+    data = eos.data.ImportanceSamples(os.path.join(base_directory, posterior, 'samples'))
+
+    # Check the parameters varied in the analysis file match those of the loaded ImportanceSamples
+    analysis_varied_params = [p.name() for p in _analysis.varied_parameters]
+    samples_varied_params = [p["name"] for p in data.varied_parameters]
+    if analysis_varied_params != samples_varied_params:
+        raise ValueError(f"Parameters varied in the analysis file don't match those from the loaded sample")
+
+    predictor = eos.ObservablePredictor(_parameters, observables, [p['name'] for p in data.varied_parameters])
+
+    samples = _np.ascontiguousarray(data.samples[begin:end], dtype=_np.float64)
+    weights = _np.ascontiguousarray(data.weights[begin:end], dtype=_np.float64)
+    nsamples = len(samples)
+    mean = _np.empty((len(observables), ), dtype=_np.float64)
+    covariance = _np.empty((len(observables), len(observables)), dtype=_np.float64)
+    eos.inprogress(f'Accumulating the covariance of observables from set \'{prediction}\' over {nsamples} samples')
+    failures = predictor.predict_covariance(samples, weights, mean, covariance)
+    if failures > 0:
+        eos.error(f'predictions failed for {failures} of {nsamples} samples; these samples are excluded from the accumulation')
+    eos.completed(f'... done')
+
+    output_path = os.path.join(base_directory, posterior, f'cov-{prediction}')
+    eos.data.PredictionCovariance.create(output_path, observables, mean, covariance)
+
+
+# Bake observable surrogate tables
+@task('bake', '{posterior}/bake-{prediction}')
+def bake(analysis_file:str, posterior:str, prediction:str, base_directory:str='./', points:int=5, error_probes:int=64, seed:int=1701):
+    '''
+    Bakes memory-mapped surrogate tables for a set of observables.
+
+    The named observables are evaluated on a tensor-product grid over the posterior's
+    varied parameters, at the kinematics fixed in the prediction set. Loading the
+    resulting table file with ``eos.load_baked_observables`` registers one observable
+    per table under the source observable's name with a ``baked`` suffix; these
+    surrogates evaluate by multilinear interpolation on the memory-mapped table,
+    replacing millisecond evaluations by microsecond look-ups. The estimated maximal
+    interpolation error is probed at random points and stored alongside each table.
+
+    The output file will be stored as EOS_BASE_DIRECTORY/POSTERIOR/bake-PREDICTION/table.eosbake.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or `eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param prediction: The name of the set of observables to bake.
+    :type prediction: str
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    :param points: The number of grid points per parameter axis. Defaults to 5.
+    :type points: int, optional
+    :param error_probes: The number of random points at which the interpolation error is probed. Defaults to 64.
+    :type error_probes: int, optional
+    :param seed: The seed used to generate the error-probe points. Defaults to 1701.
+    :type seed: int, optional
+    '''
+    import struct
+
+    _analysis   = analysis_file.analysis(posterior)
+    observables = analysis_file.observables(posterior, prediction, _analysis.parameters)
+    varied      = _analysis.varied_parameters
+
+    d       = len(varied)
+    shape   = tuple([points] * d)
+    n_nodes = points ** d
+    if n_nodes * len(observables) > 10000000:
+        raise ValueError(f'baking would require {n_nodes * len(observables)} evaluations; reduce the number of grid points or split the prediction set')
+
+    grids = [_np.linspace(p.min(), p.max(), points) for p in varied]
+
+    eos.inprogress(f'Baking {len(observables)} observables from set \'{prediction}\' on a grid of {n_nodes} nodes')
+    values = _np.empty((len(observables),) + shape)
+    for idx in _np.ndindex(shape):
+        for p, g, i in zip(varied, grids, idx):
+            p.set(g[i])
+        for j, o in enumerate(observables):
+            values[j][idx] = o.evaluate()
+
+    # multilinear interpolation on the baked grid, mirroring the runtime implementation
+    def _interpolate(table, x):
+        cell = []
+        frac = []
+        for g, xi in zip(grids, x):
+            i = min(max(int(_np.searchsorted(g, xi)) - 1, 0), len(g) - 2)
+            cell.append(i)
+            frac.append((xi - g[i]) / (g[i + 1] - g[i]))
+        acc = 0.0
+        for corner in range(1 << d):
+            weight = 1.0
+            idx = []
+            for k in range(d):
+                bit = (corner >> k) & 1
+                weight *= frac[k] if bit else 1.0 - frac[k]
+                idx.append(cell[k] + bit)
+            acc += weight * table[tuple(idx)]
+        return acc
+
+    rng = _np.random.mtrand.RandomState(seed)
+    max_errors = _np.zeros(len(observables))
+    for _ in range(error_probes):
+        x = [rng.uniform(g[0], g[-1]) for g in grids]
+        for p, xi in zip(varied, x):
+            p.set(xi)
+        for j, o in enumerate(observables):
+            max_errors[j] = max(max_errors[j], abs(o.evaluate() - _interpolate(values[j], x)))
+
+    # the surrogate registers under the source observable's name with a 'baked' suffix
+    def _baked_name(name):
+        base = name.split(';')[0]
+        return base + (':baked' if '@' in base else '@baked')
+
+    def _entry_metadata(name):
+        try:
+            entry = eos.Observables()[name.split(';')[0]]
+            return (entry.latex(), entry.unit().name())
+        except Exception:
+            return (name, 'undefined')
+
+    output_path = os.path.join(base_directory, posterior, f'bake-{prediction}')
+    os.makedirs(output_path, exist_ok=True)
+    table_file = os.path.join(output_path, 'table.eosbake')
+
+    def _write_string(fh, s):
+        data = s.encode('utf-8')
+        fh.write(struct.pack('=I', len(data)))
+        fh.write(data)
+
+    def _align(fh):
+        fh.write(b'\0' * (-fh.tell() % 8))
+
+    with open(table_file, 'wb') as fh:
+        fh.write(b'EOSBAKE1')
+        fh.write(struct.pack('=II', 1, len(observables)))
+        for j, o in enumerate(observables):
+            latex, unit = _entry_metadata(str(o.name()))
+            _write_string(fh, _baked_name(str(o.name())))
+            _write_string(fh, latex)
+            _write_string(fh, unit)
+            fh.write(struct.pack('=d', max_errors[j]))
+            fh.write(struct.pack('=I', d))
+            for p, g in zip(varied, grids):
+                fh.write(struct.pack('=I', 0)) # parameter axis
+                _write_string(fh, p.name())
+                fh.write(struct.pack('=I', len(g)))
+                _align(fh)
+                fh.write(_np.ascontiguousarray(g, dtype=_np.float64).tobytes())
+            _align(fh)
+            fh.write(_np.ascontiguousarray(values[j], dtype=_np.float64).tobytes())
+
+    eos.completed(f'... stored {len(observables)} surrogate tables in \'{table_file}\'')
+
+
 # Run one analysis step
 @task('run', '')
 def run(analysis_file:str, id:str, base_directory:str='./', dry_run:bool=False):
@@ -604,6 +784,147 @@ def sample_nested(analysis_file:str, posterior:str, base_directory:str='./', bou
                                       samples, weights, posterior_values=posterior_values)
 
 
+@task('scan-posterior', '{posterior}/scan-{label}')
+def scan_posterior(analysis_file:str, posterior:str, parameters:list, base_directory:str='./', label:str='default',
+                   points:int=10, levels:int=3, refinement_fraction:float=0.25):
+    r"""
+    Maps the named posterior over a grid in a subset of its parameters, with adaptive refinement.
+
+    A coarse uniform grid over the scan parameters is refined recursively: after each pass,
+    the cells across whose corners the log(posterior) varies the most are subdivided, so that
+    evaluations concentrate where the posterior changes fastest while flat regions are left
+    at the coarse resolution. The parameters that are not scanned keep their current values.
+
+    Every evaluated point is recorded in a content-addressed store below the output directory,
+    keyed by a digest of the point's coordinates. Repeated invocations resume from the store,
+    and invocations running concurrently (e.g. one per batch job) share their work through it.
+    Within one invocation, each evaluation fans out over the constraints via the built-in
+    thread pool.
+
+    The output is stored as importance samples in EOS_BASE_DIRECTORY/POSTERIOR/scan-LABEL,
+    with the posterior values on the grid as weights, and can be consumed by the plotting
+    facilities like any other set of importance samples.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or `eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param parameters: The names of the parameters spanning the scan grid, typically two.
+    :type parameters: list of str
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    :param label: The label attached to the output directory. Defaults to 'default'.
+    :type label: str, optional
+    :param points: The number of coarse grid points per scan parameter. Defaults to 10.
+    :type points: int, optional
+    :param levels: The number of refinement passes; each pass halves the cell size of the refined cells. Defaults to 3.
+    :type levels: int, optional
+    :param refinement_fraction: The fraction of cells subdivided per refinement pass. Defaults to 0.25.
+    :type refinement_fraction: float, optional
+    """
+    import hashlib as _hashlib
+    import itertools as _itertools
+
+    if points < 2:
+        raise ValueError(f'The number of coarse grid points per parameter must be at least 2, not {points}')
+    if levels < 0:
+        raise ValueError(f'The number of refinement passes must not be negative')
+    if not (0.0 < refinement_fraction <= 1.0):
+        raise ValueError(f'The refinement fraction must lie in (0, 1], not {refinement_fraction}')
+
+    analysis = analysis_file.analysis(posterior)
+    varied_parameter_names = [p.name() for p in analysis.varied_parameters]
+    scan_parameters = []
+    for name in parameters:
+        if name not in varied_parameter_names:
+            raise ValueError(f'Parameter \'{name}\' is not varied in posterior \'{posterior}\'')
+        scan_parameters.append(analysis.parameters[name])
+
+    D = len(scan_parameters)
+    mins = _np.array([p.min() for p in scan_parameters])
+    maxs = _np.array([p.max() for p in scan_parameters])
+
+    # all evaluated points live on an integer lattice at the finest resolution,
+    # which makes shared corners of neighbouring cells exactly reproducible
+    resolution = (points - 1) * (1 << levels)
+
+    outputpath = os.path.join(base_directory, posterior, f'scan-{label}')
+    storepath = os.path.join(outputpath, 'store')
+    os.makedirs(storepath, exist_ok=True)
+
+    # warm the in-memory cache from the content-addressed store
+    cache = {}
+    for file_name in glob.glob(os.path.join(storepath, '*.npy')):
+        entry = _np.load(file_name)
+        if entry.shape == (D + 1,):
+            cache[tuple(int(c) for c in entry[:D])] = entry[D]
+    if cache:
+        eos.info(f'Resuming from {len(cache)} stored evaluations')
+
+    def evaluate(index):
+        if index in cache:
+            return cache[index]
+
+        point = mins + (maxs - mins) * _np.array(index) / resolution
+        for p, v in zip(scan_parameters, point):
+            p.set(v)
+        try:
+            value = analysis._log_posterior.evaluate()
+        except RuntimeError as e:
+            eos.warn(f'Run time error ({e}) when evaluating log(posterior) at {point}; recording -inf')
+            value = -_np.inf
+
+        cache[index] = value
+        entry = _np.array([float(i) for i in index] + [value])
+        digest = _hashlib.sha256(entry[:D].tobytes()).hexdigest()
+        _np.save(os.path.join(storepath, digest[:16] + '.npy'), entry)
+        return value
+
+    def corners(lower, stride):
+        for offsets in _itertools.product((0, stride), repeat=D):
+            yield tuple(l + o for l, o in zip(lower, offsets))
+
+    # evaluate the coarse grid
+    stride = 1 << levels
+    cells = [(lower, stride) for lower in _itertools.product(*(range(0, resolution, stride) for _ in range(D)))]
+    for cell in cells:
+        for corner in corners(*cell):
+            evaluate(corner)
+    eos.info(f'Coarse grid of {len(cache)} points evaluated')
+
+    for level in range(levels):
+        # rank the cells by the spread of the log(posterior) across their corners
+        def spread(cell):
+            values = [cache[corner] for corner in corners(*cell)]
+            finite = [v for v in values if _np.isfinite(v)]
+            if len(finite) < len(values):
+                # cells straddling a failing region are always candidates
+                return _np.inf
+            return max(finite) - min(finite)
+
+        cells.sort(key=spread, reverse=True)
+        n_refine = max(1, int(_np.ceil(refinement_fraction * len(cells))))
+
+        refined = []
+        for lower, stride in cells[:n_refine]:
+            half = stride // 2
+            for sublower in _itertools.product(*(range(l, l + stride, half) for l in lower)):
+                refined.append((sublower, half))
+        for cell in refined:
+            for corner in corners(*cell):
+                evaluate(corner)
+        cells = cells[n_refine:] + refined
+        eos.info(f'Refinement pass {level + 1} of {levels}: {len(refined)} new cells, {len(cache)} points evaluated in total')
+
+    # export the evaluated points as importance samples, ordered by lattice index
+    indices = sorted(cache.keys())
+    samples = mins + (maxs - mins) * _np.array(indices) / resolution
+    posterior_values = _np.array([cache[index] for index in indices])
+    weights = _np.exp(posterior_values - _np.max(posterior_values[_np.isfinite(posterior_values)]))
+    weights /= _np.sum(weights)
+    eos.data.ImportanceSamples.create(outputpath, scan_parameters, samples, weights, posterior_values=posterior_values)
+
+
 def _get_modes(posterior:str, base_directory:str='./'):
     result = []
     search_path = os.path.join(base_directory, posterior, 'mode-*')
@@ -782,6 +1103,174 @@ def validate(analysis_file:str):
     analysis_file.validate()
 
 
+@task('validate-precision', '', logfile=False)
+def validate_precision(analysis_file:str, posterior:str, prediction:str, threshold:float=1.0e-3):
+    """
+    Reports the shifts of predicted observables between evaluation-precision tiers.
+
+    The named set of observables is rebuilt and evaluated at the analysis'
+    default parameter values under each of the tiers coarse, default, and
+    fine. The relative shifts of the coarse and default tiers with respect to
+    the fine tier document the error incurred when scanning at reduced
+    precision.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or :class:`eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param prediction: The name of the set of observables to validate.
+    :type prediction: str
+    :param threshold: The relative shift above which a warning is emitted. Defaults to 1.0e-3.
+    :type threshold: float, optional
+    :returns: One record per observable, listing its values per tier and the relative shifts.
+    :rtype: list of dict
+    """
+    from _eos import _evaluation_precision, _set_evaluation_precision
+
+    previous_tier = _evaluation_precision()
+    values = {}
+    names = None
+    try:
+        for tier in ('coarse', 'default', 'fine'):
+            # the tier is latched when the observables are constructed, so they
+            # need to be rebuilt for each tier
+            _set_evaluation_precision(tier)
+            _analysis = analysis_file.analysis(posterior)
+            observables = analysis_file.observables(posterior, prediction, _analysis.parameters)
+            values[tier] = [o.evaluate() for o in observables]
+            if names is None:
+                names = [str(o.name()) for o in observables]
+    finally:
+        _set_evaluation_precision(previous_tier)
+
+    results = []
+    for name, coarse, default, fine in zip(names, values['coarse'], values['default'], values['fine']):
+        scale = abs(fine) if fine != 0.0 else 1.0
+        shift_coarse = abs(coarse - fine) / scale
+        shift_default = abs(default - fine) / scale
+        results.append({
+            'name': name,
+            'coarse': coarse, 'default': default, 'fine': fine,
+            'shift_coarse': shift_coarse, 'shift_default': shift_default
+        })
+
+        message = f'{name}: coarse shift {shift_coarse:.2e}, default shift {shift_default:.2e} (relative to fine)'
+        if max(shift_coarse, shift_default) > threshold:
+            eos.warn(message)
+        else:
+            eos.info(message)
+
+    return results
+
+
+def _integration_calibration_file(base_directory, posterior):
+    return os.path.join(base_directory, posterior, 'calibration', 'integration-orders.yaml')
+
+
+def _apply_integration_calibration(base_directory, posterior):
+    """
+    Applies a persisted integration-order calibration, if one exists.
+
+    Returns True when a calibration file was found and applied. The calibrated
+    orders affect observables constructed afterwards.
+    """
+    from _eos import _calibrate_integration_points
+    import yaml
+
+    path = _integration_calibration_file(base_directory, posterior)
+    if not os.path.exists(path):
+        return False
+
+    with open(path) as f:
+        calibration = yaml.safe_load(f)
+
+    for call_site, points in calibration.items():
+        _calibrate_integration_points(call_site, int(points))
+
+    eos.info(f'Applied calibrated integration orders for {len(calibration)} call sites from \'{path}\'')
+    return True
+
+
+@task('calibrate-integrations', '{posterior}/calibration')
+def calibrate_integrations(analysis_file:str, posterior:str, prediction:str, base_directory:str='./', tolerance:float=1.0e-4):
+    """
+    Calibrates the integration orders of the decay classes for one analysis.
+
+    The named set of observables is evaluated at the analysis' default
+    parameter values, registering every named integration call site. Each
+    site is then probed in isolation with reduced orders, and the minimal
+    power-of-two order whose predictions stay within the tolerance of the
+    default-order results is persisted to
+    EOS_BASE_DIRECTORY/POSTERIOR/calibration/integration-orders.yaml.
+    Subsequent prediction tasks for the same posterior load the calibration
+    automatically, cutting the quadrature cost without accuracy loss.
+
+    :param analysis_file: The name of the analysis file that describes the named posterior, or an object of class `eos.AnalysisFile`.
+    :type analysis_file: str or :class:`eos.AnalysisFile`
+    :param posterior: The name of the posterior.
+    :type posterior: str
+    :param prediction: The name of the set of observables used to measure convergence.
+    :type prediction: str
+    :param base_directory: The base directory for the storage of data files. Can also be set via the EOS_BASE_DIRECTORY environment variable.
+    :type base_directory: str, optional
+    :param tolerance: The maximal acceptable relative shift with respect to the default-order results. Defaults to 1.0e-4.
+    :type tolerance: float, optional
+    :returns: The calibrated number of integration points per call site.
+    :rtype: dict
+    """
+    from _eos import _calibrate_integration_points, _clear_integration_calibration, \
+        _evaluation_precision, _integration_call_sites, _set_evaluation_precision
+    import yaml
+
+    def _evaluate():
+        # the integration orders are latched when the observables are
+        # constructed, so they need to be rebuilt for every probe
+        _analysis = analysis_file.analysis(posterior)
+        observables = analysis_file.observables(posterior, prediction, _analysis.parameters)
+        return _np.array([o.evaluate() for o in observables])
+
+    previous_tier = _evaluation_precision()
+    _clear_integration_calibration()
+    calibration = {}
+    try:
+        _set_evaluation_precision('default')
+
+        reference = _evaluate()
+        scale = _np.where(reference != 0.0, _np.abs(reference), 1.0)
+        call_sites = dict(_integration_call_sites())
+
+        eos.inprogress(f'Calibrating {len(call_sites)} integration call sites against a tolerance of {tolerance:.1e}')
+        for call_site, default_points in sorted(call_sites.items()):
+            chosen = int(default_points)
+            candidate = 16
+            while candidate < default_points:
+                _clear_integration_calibration()
+                _calibrate_integration_points(call_site, candidate)
+                shift = _np.max(_np.abs(_evaluate() - reference) / scale)
+                if shift <= tolerance:
+                    chosen = candidate
+                    break
+                candidate *= 2
+
+            calibration[call_site] = chosen
+            eos.info(f'{call_site}: calibrated to {chosen} points (default {default_points})')
+    finally:
+        _clear_integration_calibration()
+        _set_evaluation_precision(previous_tier)
+
+    # apply the calibration in this process and persist it for later runs
+    for call_site, points in calibration.items():
+        _calibrate_integration_points(call_site, points)
+
+    path = _integration_calibration_file(base_directory, posterior)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'w') as f:
+        yaml.safe_dump(calibration, f)
+    eos.completed(f'... persisted the calibration to \'{path}\'')
+
+    return calibration
+
+
 @task('list-steps', '', logfile=False)
 def list_steps(analysis_file:str):
     """
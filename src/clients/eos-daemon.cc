@@ -0,0 +1,488 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 Danny van Dyk
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/observable.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/stringify.hh>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace eos;
+
+class DoUsage
+{
+    private:
+        std::string _what;
+
+    public:
+        DoUsage(const std::string & what) :
+            _what(what)
+        {
+        }
+
+        const std::string &
+        what() const
+        {
+            return _what;
+        }
+};
+
+class CommandLine : public InstantiationPolicy<CommandLine, Singleton>
+{
+    public:
+        std::string socket_path;
+
+        CommandLine()
+        {
+        }
+
+        void
+        parse(int argc, char ** argv)
+        {
+            Log::instance()->set_program_name("eos-daemon");
+
+            for (char **a(argv + 1), **a_end(argv + argc); a != a_end; ++a)
+            {
+                std::string argument(*a);
+
+                if ("--socket" == argument)
+                {
+                    socket_path = std::string(*(++a));
+
+                    continue;
+                }
+
+                throw DoUsage("Unknown command line argument: " + argument);
+            }
+
+            if (socket_path.empty())
+            {
+                throw DoUsage("No socket path specified");
+            }
+        }
+};
+
+/*
+ * Wire protocol, host byte order (the socket is local to one machine).
+ *
+ * Every request starts with a one-byte opcode:
+ *
+ *   0x00  shutdown      -> status
+ *   0x01  evaluate      [string name] [u16 n] { [string kinematic] [f64 value] }*n
+ *                       -> status [f64 value]
+ *   0x02  set-parameter [string name] [f64 value]
+ *                       -> status
+ *   0x03  reset-parameters
+ *                       -> status
+ *
+ * Strings are a u32 length followed by that many bytes. Every response starts
+ * with a one-byte status: 0x00 for success (followed by the payload, if any),
+ * 0x01 for failure (followed by a string diagnostic).
+ */
+class ProtocolError :
+    public Exception
+{
+    public:
+        ProtocolError(const std::string & message) :
+            Exception("Protocol error: " + message)
+        {
+        }
+};
+
+class Connection
+{
+    private:
+        int _fd;
+
+    public:
+        Connection(const int & fd) :
+            _fd(fd)
+        {
+        }
+
+        ~Connection()
+        {
+            close(_fd);
+        }
+
+        // returns false on an orderly end of stream before the first byte
+        bool
+        read_exact(void * buffer, const std::size_t & size, const bool & eof_ok = false)
+        {
+            auto * p = reinterpret_cast<char *>(buffer);
+            std::size_t done = 0;
+
+            while (done < size)
+            {
+                const ssize_t n = read(_fd, p + done, size - done);
+                if (n < 0)
+                {
+                    if (EINTR == errno)
+                    {
+                        continue;
+                    }
+
+                    throw ProtocolError(std::string("read failed: ") + std::strerror(errno));
+                }
+                if (0 == n)
+                {
+                    if (eof_ok && (0 == done))
+                    {
+                        return false;
+                    }
+
+                    throw ProtocolError("unexpected end of stream");
+                }
+
+                done += n;
+            }
+
+            return true;
+        }
+
+        void
+        write_exact(const void * buffer, const std::size_t & size)
+        {
+            const auto * p = reinterpret_cast<const char *>(buffer);
+            std::size_t done = 0;
+
+            while (done < size)
+            {
+                const ssize_t n = write(_fd, p + done, size - done);
+                if (n < 0)
+                {
+                    if (EINTR == errno)
+                    {
+                        continue;
+                    }
+
+                    throw ProtocolError(std::string("write failed: ") + std::strerror(errno));
+                }
+
+                done += n;
+            }
+        }
+
+        std::string
+        read_string()
+        {
+            uint32_t length;
+            read_exact(&length, sizeof(length));
+
+            if (length > 65536)
+            {
+                throw ProtocolError("string length " + stringify(length) + " exceeds limit");
+            }
+
+            std::string result(length, '\0');
+            read_exact(result.data(), length);
+
+            return result;
+        }
+
+        double
+        read_double()
+        {
+            double result;
+            read_exact(&result, sizeof(result));
+
+            return result;
+        }
+
+        void
+        write_status(const uint8_t & status)
+        {
+            write_exact(&status, sizeof(status));
+        }
+
+        void
+        write_double(const double & value)
+        {
+            write_exact(&value, sizeof(value));
+        }
+
+        void
+        write_string(const std::string & value)
+        {
+            const uint32_t length = value.size();
+            write_exact(&length, sizeof(length));
+            write_exact(value.data(), length);
+        }
+};
+
+/*
+ * The warm process state: the parameter set and the observables instantiated
+ * so far. Observables are cached by name and kinematic signature, so that
+ * batch clients pipelining many requests against the same observable pay the
+ * construction cost (registry lookup, option parsing, parameter binding)
+ * exactly once.
+ */
+class Server
+{
+    private:
+        Parameters _parameters;
+
+        struct CacheEntry
+        {
+                Kinematics kinematics;
+
+                ObservablePtr observable;
+        };
+
+        std::map<std::string, CacheEntry> _cache;
+
+        CacheEntry &
+        _entry(const std::string & name, const std::vector<std::string> & kinematic_names)
+        {
+            std::string key = name;
+            for (const auto & kinematic_name : kinematic_names)
+            {
+                key += '\0' + kinematic_name;
+            }
+
+            auto i = _cache.find(key);
+            if (_cache.end() == i)
+            {
+                CacheEntry entry;
+                for (const auto & kinematic_name : kinematic_names)
+                {
+                    entry.kinematics.declare(kinematic_name);
+                }
+
+                entry.observable = Observable::make(name, _parameters, entry.kinematics, Options());
+                if (! entry.observable)
+                {
+                    throw UnknownObservableError(name);
+                }
+
+                i = _cache.insert(std::make_pair(key, entry)).first;
+            }
+
+            return i->second;
+        }
+
+    public:
+        Server() :
+            _parameters(Parameters::Defaults())
+        {
+        }
+
+        // returns false once the client requested a shutdown of the daemon
+        bool
+        serve(Connection & connection)
+        {
+            uint8_t opcode;
+
+            while (connection.read_exact(&opcode, sizeof(opcode), true))
+            {
+                try
+                {
+                    switch (opcode)
+                    {
+                        case 0x00: // shutdown
+                            connection.write_status(0x00);
+
+                            return false;
+
+                        case 0x01: // evaluate
+                        {
+                            const std::string name = connection.read_string();
+
+                            uint16_t n;
+                            connection.read_exact(&n, sizeof(n));
+
+                            std::vector<std::string> kinematic_names;
+                            std::vector<double> kinematic_values;
+                            for (uint16_t i = 0; i < n; ++i)
+                            {
+                                kinematic_names.push_back(connection.read_string());
+                                kinematic_values.push_back(connection.read_double());
+                            }
+
+                            auto & entry = _entry(name, kinematic_names);
+                            for (uint16_t i = 0; i < n; ++i)
+                            {
+                                entry.kinematics.set(kinematic_names[i], kinematic_values[i]);
+                            }
+
+                            const double value = entry.observable->evaluate();
+
+                            connection.write_status(0x00);
+                            connection.write_double(value);
+
+                            break;
+                        }
+
+                        case 0x02: // set-parameter
+                        {
+                            const std::string name = connection.read_string();
+                            const double value = connection.read_double();
+
+                            Parameter parameter = _parameters[name];
+                            parameter = value;
+
+                            connection.write_status(0x00);
+
+                            break;
+                        }
+
+                        case 0x03: // reset-parameters
+                            _parameters = Parameters::Defaults();
+                            _cache.clear();
+
+                            connection.write_status(0x00);
+
+                            break;
+
+                        default:
+                            throw ProtocolError("unknown opcode " + stringify(static_cast<unsigned>(opcode)));
+                    }
+                }
+                catch (ProtocolError &)
+                {
+                    // the stream is no longer in a well-defined state; drop the connection
+                    throw;
+                }
+                catch (Exception & e)
+                {
+                    connection.write_status(0x01);
+                    connection.write_string(e.what());
+                }
+            }
+
+            return true;
+        }
+};
+
+int
+run_daemon(const std::string & socket_path)
+{
+    // a client disconnecting mid-response must not kill the daemon
+    signal(SIGPIPE, SIG_IGN);
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0)
+    {
+        std::cerr << "eos-daemon: cannot create socket: " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "eos-daemon: socket path too long: " << socket_path << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    {
+        std::cerr << "eos-daemon: cannot bind to " << socket_path << ": " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (listen(listen_fd, 8) < 0)
+    {
+        std::cerr << "eos-daemon: cannot listen on " << socket_path << ": " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // load everything once, before we announce readiness
+    Server server;
+    std::cout << "eos-daemon: serving on " << socket_path << std::endl;
+
+    bool keep_running = true;
+    while (keep_running)
+    {
+        const int client_fd = accept(listen_fd, nullptr, nullptr);
+        if (client_fd < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            std::cerr << "eos-daemon: accept failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        Connection connection(client_fd);
+        try
+        {
+            keep_running = server.serve(connection);
+        }
+        catch (ProtocolError & e)
+        {
+            Log::instance()->message("eos-daemon", ll_warning) << e.what();
+        }
+    }
+
+    close(listen_fd);
+    unlink(socket_path.c_str());
+
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char * argv[])
+{
+    try
+    {
+        CommandLine::instance()->parse(argc, argv);
+
+        return run_daemon(CommandLine::instance()->socket_path);
+    }
+    catch (DoUsage & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << "Usage: eos-daemon --socket PATH" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Serves observable evaluations to local clients over a unix domain socket," << std::endl;
+        std::cout << "so that batch scripts pay the library initialization cost only once." << std::endl;
+    }
+    catch (Exception & e)
+    {
+        std::cerr << "Caught exception: '" << e.what() << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch (...)
+    {
+        std::cerr << "Aborting after unknown exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -19,14 +19,20 @@
 
 #include <eos/maths/power-of.hh>
 #include <eos/observable.hh>
+#include <eos/utils/async-writer.hh>
 #include <eos/utils/cartesian-product.hh>
 #include <eos/utils/destringify.hh>
+#include <eos/utils/generator.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/thread_pool.hh>
+#include <eos/utils/ticket.hh>
 
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
+#include <utility>
 #include <vector>
 
 using namespace eos;
@@ -78,11 +84,14 @@ class CommandLine : public InstantiationPolicy<CommandLine, Singleton>
 
         int precision;
 
+        bool binary;
+
         CommandLine() :
             parameters(Parameters::Defaults()),
             budgets{ std::make_tuple(std::string("delta"), std::vector<Parameter>()) },
             use_budget(false),
-            precision(-1)
+            precision(-1),
+            binary(false)
         {
         }
 
@@ -104,6 +113,13 @@ class CommandLine : public InstantiationPolicy<CommandLine, Singleton>
                     continue;
                 }
 
+                if ("--binary" == argument)
+                {
+                    binary = true;
+
+                    continue;
+                }
+
                 if ("--kinematics" == argument)
                 {
                     std::string name  = std::string(*(++a));
@@ -211,23 +227,149 @@ class CommandLine : public InstantiationPolicy<CommandLine, Singleton>
         }
 };
 
-void
-evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluation_input)
+// one row of the output grid: kinematic values, central value, and the
+// squared up/down contributions per budget
+struct ResultRow
 {
-    // print headlines
-    std::cout << "# " << evaluation_input->observable->name() << ": " << evaluation_input->observable->options().as_string() << std::endl;
+        std::vector<double> point;
+
+        double central;
 
-    std::cout << "# ";
-    for (const auto & kinematic_name : evaluation_input->kinematic_names)
+        std::vector<std::pair<double, double>> budgets;
+
+        double delta_min, delta_max;
+};
+
+// per-slot evaluation context: works on clones of the parameters and the
+// observable, so that one batch can be evaluated on the ThreadPool while
+// another one is being written out
+struct PipelineContext
+{
+        Parameters parameters;
+
+        ObservablePtr observable;
+
+        Kinematics kinematics;
+
+        std::vector<std::tuple<std::string, std::vector<Parameter>>> budgets;
+
+        PipelineContext(const std::shared_ptr<EvaluationInput> & input) :
+            parameters(CommandLine::instance()->parameters.clone()),
+            observable(input->observable->clone(parameters)),
+            kinematics(observable->kinematics())
+        {
+            // rebind the budgets' variation parameters to our clone
+            for (const auto & budget : CommandLine::instance()->budgets)
+            {
+                std::vector<Parameter> variations;
+                for (const auto & variation : std::get<1>(budget))
+                {
+                    variations.push_back(parameters[variation.name()]);
+                }
+                budgets.push_back(std::make_tuple(std::get<0>(budget), variations));
+            }
+        }
+
+        ResultRow
+        evaluate(const std::vector<double> & point, const std::vector<std::string> & kinematic_names)
+        {
+            ResultRow row{ point, 0.0, {}, 0.0, 0.0 };
+
+            for (std::size_t i = 0; i < point.size(); ++i)
+            {
+                kinematics.set(kinematic_names[i], point[i]);
+            }
+
+            row.central = observable->evaluate();
+
+            // do the variations
+            for (auto & budget : budgets)
+            {
+                double budget_min = 0.0;
+                double budget_max = 0.0;
+
+                for (auto & variation : std::get<1>(budget))
+                {
+                    double old_v = variation;
+
+                    for (const double & new_v : { variation.max(), variation.min() })
+                    {
+                        variation = new_v;
+
+                        double value = observable->evaluate();
+
+                        if (value > row.central)
+                        {
+                            budget_max += power_of<2>(value - row.central);
+                        }
+                        else if (value < row.central)
+                        {
+                            budget_min += power_of<2>(value - row.central);
+                        }
+                    }
+
+                    variation = old_v;
+                }
+
+                row.delta_min += budget_min;
+                row.delta_max += budget_max;
+                row.budgets.push_back(std::make_pair(budget_min, budget_max));
+            }
+
+            return row;
+        }
+};
+
+// first pipeline stage: lazily generate the kinematics grid.
+// the input is taken by value: coroutine parameters must outlive suspension.
+Generator<std::vector<double>>
+kinematics_grid(std::shared_ptr<EvaluationInput> input)
+{
+    if (input->ranges.size() == 0)
+    {
+        // no ranges specified: evaluate at the fixed kinematics exactly once
+        co_yield std::vector<double>();
+        co_return;
+    }
+
+    for (auto r = input->ranges.begin(), r_end = input->ranges.end(); r != r_end; ++r)
     {
-        std::cout << kinematic_name << '\t';
+        co_yield *r;
     }
-    std::cout << "central";
-    for (auto & budget : CommandLine::instance()->budgets)
+}
+
+void
+evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluation_input, AsyncWriter & writer)
+{
+    const bool binary = CommandLine::instance()->binary;
+
+    // print headlines; in binary mode they go to stderr, so that stdout
+    // carries nothing but raw rows
     {
-        std::cout << '\t' << std::get<0>(budget) << "_min\t" << std::get<0>(budget) << "_max";
+        std::ostringstream header;
+        header << "# " << evaluation_input->observable->name() << ": " << evaluation_input->observable->options().as_string() << '\n';
+
+        header << "# ";
+        for (const auto & kinematic_name : evaluation_input->kinematic_names)
+        {
+            header << kinematic_name << '\t';
+        }
+        header << "central";
+        for (auto & budget : CommandLine::instance()->budgets)
+        {
+            header << '\t' << std::get<0>(budget) << "_min\t" << std::get<0>(budget) << "_max";
+        }
+        header << "\tdelta_min\tdelta_max" << '\n';
+
+        if (binary)
+        {
+            std::cerr << header.str() << std::flush;
+        }
+        else
+        {
+            writer.write(header.str());
+        }
     }
-    std::cout << "\tdelta_min\tdelta_max" << std::endl;
 
     int precision = CommandLine::instance()->precision;
     // set requested precision
@@ -236,88 +378,160 @@ evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluation_i
         std::cout.precision(precision);
     }
 
-    bool ranges_empty = false;
-    // check if the kinematical ranges are empty
-    if (evaluation_input->ranges.size() == 0)
+    // pipeline: the grid generator feeds batches of points to the ThreadPool,
+    // and the main thread formats and writes batch i while batch i + 1 is
+    // being evaluated
+    static const std::size_t batch_size = 64;
+
+    auto grid = kinematics_grid(evaluation_input);
+
+    struct Slot
     {
-        ranges_empty = true;
+            PipelineContext context;
 
-        // create a vector with a single entry
-        std::vector<double> range(1, 1.0);
-        // insert a dummy value for the for-loop
-        evaluation_input->ranges.over(range);
-    }
+            std::vector<std::vector<double>> points;
 
-    // iterate over all kinematical ranges
-    for (auto r = evaluation_input->ranges.begin(); r != evaluation_input->ranges.end(); ++r)
+            std::vector<ResultRow> rows;
+
+            Ticket ticket;
+
+            Slot(const std::shared_ptr<EvaluationInput> & input) :
+                context(input)
+            {
+            }
+    };
+
+    std::vector<Slot> slots;
+    slots.reserve(2);
+    slots.emplace_back(evaluation_input);
+    slots.emplace_back(evaluation_input);
+
+    auto fill = [&grid] (Slot & slot) -> bool
     {
-        if (! ranges_empty)
+        slot.points.clear();
+        while (slot.points.size() < batch_size)
         {
-            // set the kinematics
-            // for every dimension
-            for (std::size_t i = 0; i < (*r).size(); ++i)
+            auto point = grid.next();
+            if (! point)
             {
-                evaluation_input->kinematics->set(evaluation_input->kinematic_names[i], (*r)[i]);
-                std::cout << (*r)[i] << '\t';
+                break;
             }
+
+            slot.points.push_back(std::move(*point));
         }
 
-        double central = evaluation_input->observable->evaluate();
+        return ! slot.points.empty();
+    };
 
-        std::cout << central;
+    const std::vector<std::string> & kinematic_names = evaluation_input->kinematic_names;
 
-        // do the variations
-        double delta_max = 0.0, delta_min = 0.0;
-        for (auto & budget : CommandLine::instance()->budgets)
+    auto enqueue = [&kinematic_names] (Slot & slot)
+    {
+        slot.ticket = ThreadPool::instance()->enqueue(std::function<void (void)>([&slot, &kinematic_names] ()
         {
-            double budget_min = 0.0;
-            double budget_max = 0.0;
-
-            std::vector<Parameter> variations = std::get<1>(budget);
-
-            for (auto & variation : variations)
+            slot.rows.clear();
+            slot.rows.reserve(slot.points.size());
+            for (const auto & point : slot.points)
             {
-                double old_v = variation;
+                slot.rows.push_back(slot.context.evaluate(point, kinematic_names));
+            }
+        }));
+    };
 
-                // raise value
-                variation = variation.max();
+    // format the finished batch into a single buffer and hand it to the
+    // asynchronous writer, so that the main thread immediately resumes
+    // filling the next batch while the worker performs the I/O
+    auto write = [&writer, binary] (const Slot & slot)
+    {
+        if (binary)
+        {
+            // raw little-endian float64 rows, same columns as the text
+            // output minus the percentage annotation
+            std::string buffer;
+            if (! slot.rows.empty())
+            {
+                buffer.reserve(slot.rows.size() * (slot.rows.front().point.size() + 2 * slot.rows.front().budgets.size() + 3) * sizeof(double));
+            }
 
-                double value = evaluation_input->observable->evaluate();
+            auto append = [&buffer] (const double & value)
+            {
+                buffer.append(reinterpret_cast<const char *>(&value), sizeof(double));
+            };
 
-                if (value > central)
+            for (const auto & row : slot.rows)
+            {
+                for (const auto & value : row.point)
                 {
-                    budget_max += power_of<2>(value - central);
+                    append(value);
                 }
-                else if (value < central)
+
+                append(row.central);
+
+                for (const auto & budget : row.budgets)
                 {
-                    budget_min += power_of<2>(value - central);
+                    append(std::sqrt(budget.first));
+                    append(std::sqrt(budget.second));
                 }
 
-                // lower value
-                variation = variation.min();
+                append(std::sqrt(row.delta_min));
+                append(std::sqrt(row.delta_max));
+            }
 
-                value = evaluation_input->observable->evaluate();
+            writer.write(std::move(buffer));
 
-                if (value > central)
-                {
-                    budget_max += power_of<2>(value - central);
-                }
-                else if (value < central)
-                {
-                    budget_min += power_of<2>(value - central);
-                }
+            return;
+        }
+
+        std::ostringstream buffer;
+        buffer.precision(std::cout.precision());
+
+        for (const auto & row : slot.rows)
+        {
+            for (const auto & value : row.point)
+            {
+                buffer << value << '\t';
+            }
 
-                variation = old_v;
+            buffer << row.central;
+
+            for (const auto & budget : row.budgets)
+            {
+                buffer << '\t' << std::sqrt(budget.first) << '\t' << std::sqrt(budget.second);
             }
 
-            delta_min += budget_min;
-            delta_max += budget_max;
+            buffer << '\t' << std::sqrt(row.delta_min) << '\t' << std::sqrt(row.delta_max) << "   (-" << std::abs(std::sqrt(row.delta_min) / row.central) * 100
+                   << "% / +" << std::abs(std::sqrt(row.delta_max) / row.central) * 100 << "%)" << '\n';
+        }
+
+        writer.write(buffer.str());
+    };
+
+    unsigned current = 0;
+    if (! fill(slots[current]))
+    {
+        return;
+    }
+    enqueue(slots[current]);
+
+    while (true)
+    {
+        // fetch and submit the next batch before blocking on the current one
+        const unsigned next = 1 - current;
+        const bool have_next = fill(slots[next]);
+        if (have_next)
+        {
+            enqueue(slots[next]);
+        }
 
-            std::cout << '\t' << std::sqrt(budget_min) << '\t' << std::sqrt(budget_max);
+        slots[current].ticket.wait();
+        write(slots[current]);
+
+        if (! have_next)
+        {
+            break;
         }
 
-        std::cout << '\t' << std::sqrt(delta_min) << '\t' << std::sqrt(delta_max) << "   (-" << std::abs(std::sqrt(delta_min) / central) * 100 << "% / +"
-                  << std::abs(std::sqrt(delta_max) / central) * 100 << "%)" << std::endl;
+        current = next;
     }
 }
 
@@ -333,9 +547,13 @@ main(int argc, char * argv[])
             throw DoUsage("No input specified");
         }
 
+        // one writer for all inputs: buffers are written out in order by a
+        // dedicated thread while the main thread keeps evaluating
+        AsyncWriter writer(std::cout);
+
         for (const auto & evaluation_input : CommandLine::instance()->evaluation_inputs)
         {
-            evaluate_with_sum_of_squares(evaluation_input);
+            evaluate_with_sum_of_squares(evaluation_input, writer);
         }
     }
     catch (DoUsage & e)
@@ -343,6 +561,7 @@ main(int argc, char * argv[])
         std::cout << e.what() << std::endl;
         std::cout << "Usage: eos-evaluate" << std::endl;
         std::cout << "  [--precision PRECISION]" << std::endl;
+        std::cout << "  [--binary]" << std::endl;
         std::cout << "  [--vary PARAMETER]*" << std::endl;
         std::cout << "  [{--budget BUDGET[--parameter PARAMETER]*}*|{--parameter PARAMETER}*]" << std::endl;
         std::cout << "  [[--kinematics NAME VALUE|--range NAME MIN MAX POINTS]* --observable OBSERVABLE]*" << std::endl;